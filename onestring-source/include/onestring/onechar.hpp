@@ -47,15 +47,58 @@
 
 #include <cstdint>
 #include <cstring>
+#include <functional>
 #include <iomanip>
 #include <iostream>
 
+#include "onestring/onestring_hasher.hpp"
+#include "onestring/unicode/case_tables.hpp"
+#include "onestring/unicode/property_tables.hpp"
+#include "onestring/unicode/width_tables.hpp"
+
 class onestring;
+class onestring_charset;
+class onestring_matcher;
+class onestring_regex;
+class onestring_search;
+class onestring_segments;
+class onestring_view;
+
+/// The Unicode General_Category values, such as UPPERCASE_LETTER.
+using onestring_category = onestring_property_tables::general_category;
+
+/// The Unicode Script values, such as LATIN.
+using onestring_script = onestring_property_tables::script_code;
+
+/** The classes of character that onechar::is_class() and
+ * onestring::classify() test for. */
+enum class onestring_class {
+	/// Letters (General_Category L)
+	LETTER,
+	/// Decimal digits (General_Category Nd)
+	DIGIT,
+	/// Punctuation (General_Category P)
+	PUNCTUATION,
+	/// Characters with the Alphabetic property, which includes letters
+	/// and some marks and numbers, such as Roman numerals
+	ALPHABETIC,
+	/// Characters with a Numeric_Type, which includes digits, fractions,
+	/// and numerals
+	NUMERIC,
+	/// Characters with the White_Space property
+	WHITESPACE
+};
 
 /** Stores a single unicode character */
 class onechar
 {
 	friend onestring;
+	friend onestring_charset;
+	friend onestring_matcher;
+	friend onestring_regex;
+	friend onestring_search;
+	friend onestring_segments;
+	friend onestring_view;
 
 private:
 	/* We never store more than 4 bytes of meaningful data.
@@ -69,6 +112,26 @@ private:
 	/// The character array as a c-string.
 	char internal[MAX_SIZE + 1];
 
+	/** The bytesize of a UTF-8 character, as sixteen 4-bit entries indexed
+	 * by the lead byte's high nibble. Packing the table into one integer
+	 * keeps the lookup in a register instead of a memory load. */
+	inline static constexpr uint64_t LENGTH_TABLE = 0x4322111111111111;
+
+	/// The payload bits of a lead byte, indexed by the character bytesize.
+	inline static constexpr unsigned char LEAD_MASK_TABLE[MAX_SIZE + 1] = {
+		0x00, 0x7F, 0x1F, 0x0F, 0x07};
+
+	/// The right shift that drops unused byte slots, indexed by bytesize.
+	inline static constexpr unsigned char SHIFT_TABLE[MAX_SIZE + 1] = {
+		0, 18, 12, 6, 0};
+
+	/// The code point substituted for one that cannot be encoded.
+	inline static const char32_t REPLACEMENT_CODEPOINT = 0xFFFD;
+
+	/// The marker bits of a lead byte, indexed by the character bytesize.
+	inline static constexpr unsigned char LEAD_TABLE[MAX_SIZE + 1] = {
+		0x00, 0x00, 0xC0, 0xE0, 0xF0};
+
 	/** Store an ASCII character in this onechar
 	 * \param the char to copy */
 	void parse(const char ch)
@@ -92,6 +155,122 @@ private:
 		memcpy(this->internal, cstr, sizeof(char) * this->size);
 	}
 
+	/** Lowercases an ASCII byte without branching.
+	 * \param the byte to convert
+	 * \return the lowercase byte */
+	static char asciiLower(char ch)
+	{
+		// Only 'A' through 'Z' subtract to below 26.
+		unsigned char offset = static_cast<unsigned char>(ch - 'A');
+		return static_cast<char>(ch | ((offset < 26) << 5));
+	}
+
+	/** Uppercases an ASCII byte without branching.
+	 * \param the byte to convert
+	 * \return the uppercase byte */
+	static char asciiUpper(char ch)
+	{
+		// Only 'a' through 'z' subtract to below 26.
+		unsigned char offset = static_cast<unsigned char>(ch - 'a');
+		return static_cast<char>(ch & ~((offset < 26) << 5));
+	}
+
+	/** Copies a mapping longer than one code point from a table.
+	 * \param the table, sorted by code point
+	 * \param the code point to find, which must be in the table
+	 * \param the array of at least three code points to write to
+	 * \return the number of code points written */
+	template<size_t N>
+	static size_t fullMapping(
+		const onestring_case_tables::full_mapping (&table)[N],
+		char32_t cp,
+		char32_t* mapping)
+	{
+		size_t low = 0;
+		size_t high = N - 1;
+		while (low < high) {
+			size_t mid = (low + high) / 2;
+			if (table[mid].cp < cp) {
+				low = mid + 1;
+			} else {
+				high = mid;
+			}
+		}
+
+		size_t count = 0;
+		while (count < 3 && table[low].mapping[count] != 0) {
+			mapping[count] = table[low].mapping[count];
+			++count;
+		}
+		return count;
+	}
+
+	/** The general categories and property flags that make up each
+	 * onestring_class. A character is in the class if either matches. */
+	struct class_mask
+	{
+		/// A bit for each general_category in the class
+		uint32_t categories;
+		/// The property flags of the class
+		uint8_t flags;
+	};
+
+	/// The masks of each onestring_class, in order.
+	inline static constexpr class_mask CLASS_MASKS[] = {
+		{0x0000001F, 0},  // LETTER: Lu, Ll, Lt, Lm, Lo
+		{0x00000100, 0},  // DIGIT: Nd
+		{0x0003F800, 0},  // PUNCTUATION: Pc, Pd, Ps, Pe, Pi, Pf, Po
+		{0, onestring_property_tables::ALPHABETIC},
+		{0, onestring_property_tables::NUMERIC},
+		{0, onestring_property_tables::WHITE_SPACE}};
+
+	/** Looks up the Unicode properties of the onechar.
+	 * \return the record of its properties */
+	const onestring_property_tables::record& properties() const
+	{
+		// ASCII is its own code point.
+		if (this->size == 1) {
+			return onestring_property_tables::lookup(
+				static_cast<unsigned char>(this->internal[0]));
+		}
+		return onestring_property_tables::lookup(codepoint());
+	}
+
+	/** Looks up the display width of the onechar, with its emoji flags.
+	 * \return the record of its width */
+	const onestring_width_tables::record& widths() const
+	{
+		// ASCII is its own code point.
+		if (this->size == 1) {
+			return onestring_width_tables::lookup(
+				static_cast<unsigned char>(this->internal[0]));
+		}
+		return onestring_width_tables::lookup(codepoint());
+	}
+
+	/** Encode and store a Unicode code point as UTF-8.
+	 * The code point is assumed to be valid (not a surrogate, and no
+	 * greater than U+10FFFF); that is the responsibility of the caller.
+	 * \param the code point to encode */
+	void parseCodepoint(char32_t cp)
+	{
+		this->size = 1 + (cp > 0x7F) + (cp > 0x7FF) + (cp > 0xFFFF);
+
+		/* Align the payload as if it were a 4-byte character, so the same
+		 * shifts produce every byte; slots past the end are then zeroed.
+		 * This keeps the encode free of data-dependent branches. */
+		char32_t aligned = cp << SHIFT_TABLE[this->size];
+		this->internal[0] =
+			static_cast<char>(LEAD_TABLE[this->size] | (aligned >> 18));
+		this->internal[1] = static_cast<char>(
+			(0x80 | ((aligned >> 12) & 0x3F)) * (this->size > 1));
+		this->internal[2] = static_cast<char>(
+			(0x80 | ((aligned >> 6) & 0x3F)) * (this->size > 2));
+		this->internal[3] =
+			static_cast<char>((0x80 | (aligned & 0x3F)) * (this->size > 3));
+		this->internal[4] = '\0';
+	}
+
 	/** Extract and store a Unicode character from a std::string.
 	 * If more than one character is present in the std::string, only
 	 * the first will be parsed out; the rest will be ignored.
@@ -165,6 +344,15 @@ public:
 		parse(str);
 	}
 
+	/** Initialize a onechar with a Unicode code point.
+	 * Surrogates and values above U+10FFFF are replaced with U+FFFD. */
+	explicit onechar(char32_t cp)
+	: size(1), internal{'\0', '\0', '\0', '\0', '\0'}
+	{
+		// Encode the code point as UTF-8
+		parseCodepoint(isCodepoint(cp) ? cp : REPLACEMENT_CODEPOINT);
+	}
+
 	/** Initialize a onechar as a copy of another. */
 	onechar(const onechar& cpy)
 	: size(cpy.size), internal{'\0', '\0', '\0', '\0', '\0'}
@@ -247,12 +435,229 @@ public:
 		return (memcmp(this->internal, cmp.internal, this->size) == 0);
 	}
 
+	/** Creates a onechar from a Unicode code point.
+	 * Surrogates and values above U+10FFFF are replaced with U+FFFD.
+	 * \param the code point to encode
+	 * \return the new onechar */
+	static onechar from_codepoint(char32_t cp) { return onechar(cp); }
+
+	/** Returns the Unicode code point of the onechar.
+	 * \return the code point */
+	char32_t codepoint() const { return evaluateCodepoint(this->internal); }
+
+	/** Tests whether a value is a Unicode scalar value, meaning it can be
+	 * encoded: not a surrogate, and no greater than U+10FFFF.
+	 * \param the value to test
+	 * \return true if it can be encoded, else false */
+	static bool isCodepoint(char32_t cp)
+	{
+		return (cp <= 0x10FFFF && (cp < 0xD800 || cp > 0xDFFF));
+	}
+
+	/** Returns the simple lowercase mapping of a code point, which is
+	 * always a single code point.
+	 * \param the code point to map
+	 * \return the lowercase code point */
+	static char32_t simpleLower(char32_t cp)
+	{
+		return cp + onestring_case_tables::lookup(cp).lower;
+	}
+
+	/** Returns the simple uppercase mapping of a code point, which is
+	 * always a single code point.
+	 * \param the code point to map
+	 * \return the uppercase code point */
+	static char32_t simpleUpper(char32_t cp)
+	{
+		return cp + onestring_case_tables::lookup(cp).upper;
+	}
+
+	/** Writes the full lowercase mapping of a code point, ignoring
+	 * conditional mappings such as the final sigma.
+	 * \param the code point to map
+	 * \param the array of at least three code points to write to
+	 * \return the number of code points written */
+	static size_t fullLower(char32_t cp, char32_t* mapping)
+	{
+		const auto& record = onestring_case_tables::lookup(cp);
+		if (record.flags & onestring_case_tables::FULL_LOWER) {
+			return fullMapping(
+				onestring_case_tables::FULL_LOWER_MAPPINGS, cp, mapping);
+		}
+		mapping[0] = cp + record.lower;
+		return 1;
+	}
+
+	/** Writes the full uppercase mapping of a code point, such as "SS"
+	 * for "ß".
+	 * \param the code point to map
+	 * \param the array of at least three code points to write to
+	 * \return the number of code points written */
+	static size_t fullUpper(char32_t cp, char32_t* mapping)
+	{
+		const auto& record = onestring_case_tables::lookup(cp);
+		if (record.flags & onestring_case_tables::FULL_UPPER) {
+			return fullMapping(
+				onestring_case_tables::FULL_UPPER_MAPPINGS, cp, mapping);
+		}
+		mapping[0] = cp + record.upper;
+		return 1;
+	}
+
+	/** Returns the simple case folding of a code point, which is always a
+	 * single code point.
+	 * \param the code point to fold
+	 * \return the folded code point */
+	static char32_t simpleFold(char32_t cp)
+	{
+		return cp + onestring_case_tables::lookup(cp).fold;
+	}
+
+	/** Writes the full case folding of a code point, such as "ss" for "ß".
+	 * Strings that differ only by case have the same full case folding.
+	 * \param the code point to fold
+	 * \param the array of at least three code points to write to
+	 * \return the number of code points written */
+	static size_t fullFold(char32_t cp, char32_t* mapping)
+	{
+		const auto& record = onestring_case_tables::lookup(cp);
+		if (record.flags & onestring_case_tables::FULL_FOLD) {
+			return fullMapping(
+				onestring_case_tables::FULL_FOLD_MAPPINGS, cp, mapping);
+		}
+		mapping[0] = cp + record.fold;
+		return 1;
+	}
+
+	/** Tests whether a code point has the Unicode Cased property.
+	 * \param the code point to test
+	 * \return true if cased, else false */
+	static bool isCased(char32_t cp)
+	{
+		return onestring_case_tables::lookup(cp).flags &
+			   onestring_case_tables::CASED;
+	}
+
+	/** Tests whether a code point has the Unicode Case_Ignorable property.
+	 * \param the code point to test
+	 * \return true if case-ignorable, else false */
+	static bool isCaseIgnorable(char32_t cp)
+	{
+		return onestring_case_tables::lookup(cp).flags &
+			   onestring_case_tables::CASE_IGNORABLE;
+	}
+
+	/** Gets the Unicode General_Category of the onechar.
+	 * \return the category, such as onestring_category::UPPERCASE_LETTER */
+	onestring_category general_category() const
+	{
+		return properties().category;
+	}
+
+	/** Gets the Unicode Script of the onechar.
+	 * \return the script, such as onestring_script::LATIN */
+	onestring_script script() const { return properties().script; }
+
+	/** Gets the number of terminal columns the onechar takes on its own:
+	 * 2 for East Asian wide characters and emoji, 0 for controls, combining
+	 * marks and other invisible characters, and otherwise 1. Use
+	 * onestring::display_width() for the width of emoji sequences.
+	 * \return the number of columns */
+	size_t display_width() const { return widths().width; }
+
+	/** Hashes the onechar. A onestring holding only this character has the
+	 * same hash.
+	 * \return the hash */
+	size_t hash() const
+	{
+		return static_cast<size_t>(
+			onestring_hasher::hash(this->internal, this->size));
+	}
+
+	/** Tests whether the onechar is in a class of characters.
+	 * \param the class to test for
+	 * \return true if it is in the class, else false */
+	bool is_class(onestring_class cls) const
+	{
+		const auto& record = properties();
+		const class_mask& mask = CLASS_MASKS[static_cast<size_t>(cls)];
+		return ((mask.categories >> static_cast<unsigned>(record.category)) &
+				1) ||
+			   (record.flags & mask.flags);
+	}
+
+	/** Tests whether the onechar is a letter (General_Category L).
+	 * \return true if it is a letter, else false */
+	bool is_letter() const { return is_class(onestring_class::LETTER); }
+
+	/** Tests whether the onechar is a decimal digit (General_Category Nd),
+	 * in any script.
+	 * \return true if it is a digit, else false */
+	bool is_digit() const { return is_class(onestring_class::DIGIT); }
+
+	/** Tests whether the onechar is punctuation (General_Category P).
+	 * \return true if it is punctuation, else false */
+	bool is_punctuation() const
+	{
+		return is_class(onestring_class::PUNCTUATION);
+	}
+
+	/** Tests whether the onechar has the Unicode Alphabetic property.
+	 * \return true if it is alphabetic, else false */
+	bool is_alphabetic() const { return is_class(onestring_class::ALPHABETIC); }
+
+	/** Tests whether the onechar has a Unicode Numeric_Type, as digits,
+	 * fractions, and numerals such as "Ⅻ" do.
+	 * \return true if it is numeric, else false */
+	bool is_numeric() const { return is_class(onestring_class::NUMERIC); }
+
+	/** Tests whether the onechar has the Unicode White_Space property.
+	 * \return true if it is whitespace, else false */
+	bool is_whitespace() const { return is_class(onestring_class::WHITESPACE); }
+
+	/** Converts the onechar to lowercase, using the simple mapping.
+	 * \return a reference to the onechar */
+	onechar& to_lower()
+	{
+		if (this->size == 1) {
+			this->internal[0] = asciiLower(this->internal[0]);
+		} else {
+			parseCodepoint(simpleLower(codepoint()));
+		}
+		return *this;
+	}
+
+	/** Converts the onechar to uppercase, using the simple mapping.
+	 * \return a reference to the onechar */
+	onechar& to_upper()
+	{
+		if (this->size == 1) {
+			this->internal[0] = asciiUpper(this->internal[0]);
+		} else {
+			parseCodepoint(simpleUpper(codepoint()));
+		}
+		return *this;
+	}
+
+	/** Case folds the onechar, using the simple folding.
+	 * \return a reference to the onechar */
+	onechar& fold_case()
+	{
+		if (this->size == 1) {
+			this->internal[0] = asciiLower(this->internal[0]);
+		} else {
+			parseCodepoint(simpleFold(codepoint()));
+		}
+		return *this;
+	}
+
 	/** Returns the c-string representation of the onechar.
 	 * Appends a null terminator.
 	 * \return c-string of the character */
 	const char* c_str() const { return this->internal; }
 
 	/** Compare against a character.
+	 * Characters are ordered by code point.
 	 * \param the char to test against
 	 * \return 0 if equal to argument, negative if less, positive if greater */
 	int compare(const char cmp) const
@@ -260,18 +665,19 @@ public:
 		/* This algorithm will not return a meaningful integer; only its
 		 * relation to 0 will be useful */
 
-		int sizeDiff = this->size - 1;
-		// If the bytesize was the same...
-		if (sizeDiff == 0) {
-			// ...return the results of a direct memory comparison
-			return memcmp(this->internal, &cmp, 1);
+		// UTF-8 byte order is code point order, so the lead bytes decide...
+		int r = static_cast<unsigned char>(this->internal[0]) -
+				static_cast<unsigned char>(cmp);
+		if (r != 0) {
+			return r;
 		}
-		// Otherwise, return the difference in bytesize.
-		return sizeDiff;
+		// ...unless this is a longer (invalid) sequence with the same lead.
+		return static_cast<int>(this->size) - 1;
 	}
 
 	/** Compare against a c-string.
 	 * Does NOT ignore extraneous characters in the c-string
+	 * Characters are ordered by code point.
 	 * \param the c-string to test against
 	 * \return 0 if equal to argument, negative if less, positive if greater */
 	int compare(const char* cmp) const
@@ -279,14 +685,17 @@ public:
 		/* This algorithm will not return a meaningful integer; only its
 		 * relation to 0 will be useful */
 
-		int sizeDiff = this->size - evaluateLength(cmp);
-		// If the bytesize was the same...
-		if (sizeDiff == 0) {
-			// ...return the results of a direct memory comparison
-			return memcmp(this->internal, cmp, this->size);
+		// Compare byte by byte; a null terminator in cmp is a mismatch,
+		// so this never reads past the end of the c-string.
+		for (size_t b = 0; b < this->size; ++b) {
+			int r = static_cast<unsigned char>(this->internal[b]) -
+					static_cast<unsigned char>(cmp[b]);
+			if (r != 0) {
+				return r;
+			}
 		}
-		// Otherwise, return the difference in bytesize.
-		return sizeDiff;
+		return static_cast<int>(this->size) -
+			   static_cast<int>(evaluateLength(cmp));
 	}
 
 	/** Compare against a std::string.
@@ -300,6 +709,7 @@ public:
 	}
 
 	/** Compare against another onechar
+	 * Characters are ordered by code point.
 	 * \param the onechar to test against
 	 * \return 0 if equal to argument, negative if less, positive if greater */
 	int compare(const onechar& cmp) const
@@ -307,14 +717,20 @@ public:
 		/* This algorithm will not return a meaningful integer; only its
 		 * relation to 0 will be useful */
 
-		int sizeDiff = this->size - cmp.size;
-		// If the bytesize was the same...
-		if (sizeDiff == 0) {
-			// ...return the results of a direct memory comparison
-			return memcmp(this->internal, cmp.internal, this->size);
+		// UTF-8 byte order is code point order, so the lead bytes decide
+		// most comparisons, and equal lead bytes mean equal bytesizes.
+		int r = static_cast<unsigned char>(this->internal[0]) -
+				static_cast<unsigned char>(cmp.internal[0]);
+		if (r != 0) {
+			return r;
+		}
+		size_t len = (this->size < cmp.size) ? this->size : cmp.size;
+		r = memcmp(this->internal, cmp.internal, len);
+		if (r != 0) {
+			return r;
 		}
-		// Otherwise, return the difference in bytesize.
-		return sizeDiff;
+		// A shorter (invalid) sequence sorts before a longer one.
+		return static_cast<int>(this->size) - static_cast<int>(cmp.size);
 	}
 
 	/** Evaluate the number of bytes in a Unicode character.
@@ -323,27 +739,100 @@ public:
 	 * \return the number of bytes in the Unicode character */
 	static size_t evaluateLength(const char* cstr)
 	{
-		switch (cstr[0] & 0xF0) {
-			case 0xF0: {
-				// Unicode code points U+10000 to U+10FFFF
-				return 4;
-			}
+		/* The high nibble of the lead byte alone determines the length,
+		 * so a table lookup replaces the branches on the data. */
+		unsigned int nibble = static_cast<unsigned char>(cstr[0]) >> 4;
+		return (LENGTH_TABLE >> (nibble * 4)) & 0xF;
+	}
+
+	/** Evaluate the Unicode code point of a UTF-8 character.
+	 * Ignores all subsequent characters, and never reads past the
+	 * bytes belonging to the first character.
+	 * \param the pointer to the Unicode character (c-string)
+	 * \return the code point of the Unicode character */
+	static char32_t evaluateCodepoint(const char* cstr)
+	{
+		const unsigned char* bytes = reinterpret_cast<const unsigned char*>(cstr);
+		size_t len = evaluateLength(cstr);
+
+		/* Bytes past the end of the character are replaced by the lead
+		 * byte (index 0), whose bits are then shifted out below. This
+		 * keeps the decode free of data-dependent branches. */
+		char32_t b0 = bytes[0] & LEAD_MASK_TABLE[len];
+		char32_t b1 = bytes[1 * (len > 1)] & 0x3F;
+		char32_t b2 = bytes[2 * (len > 2)] & 0x3F;
+		char32_t b3 = bytes[3 * (len > 3)] & 0x3F;
+
+		return ((b0 << 18) | (b1 << 12) | (b2 << 6) | b3) >> SHIFT_TABLE[len];
+	}
+
+	/** Check that a UTF-8 character is well-formed, per Table 3-7 of the
+	 * Unicode Standard. Stray continuation bytes, overlong encodings,
+	 * surrogates, values above U+10FFFF, and truncated sequences are all
+	 * malformed. Never reads past the first byte that fails the check, so
+	 * it is safe on null-terminated c-strings.
+	 * \param the pointer to the Unicode character (c-string)
+	 * \param receives the bytesize of the character if well-formed;
+	 * otherwise, the bytesize of the malformed sequence (the bytes that
+	 * should be replaced with a single U+FFFD). If this equals the number
+	 * of bytes available, the sequence was only cut off, and may yet be
+	 * completed by more data.
+	 * \param the number of bytes available to read, default 4
+	 * \return true if well-formed, else false */
+	static bool validate(const char* cstr, size_t& len, size_t available = MAX_SIZE)
+	{
+		const unsigned char* bytes = reinterpret_cast<const unsigned char*>(cstr);
+
+		// ASCII is always well-formed.
+		if (bytes[0] < 0x80) {
+			len = 1;
+			return true;
+		}
+
+		// Reject continuation bytes and lead bytes that can never be valid.
+		if (bytes[0] < 0xC2 || bytes[0] > 0xF4) {
+			len = 1;
+			return false;
+		}
+
+		/* Some lead bytes narrow the range of the second byte, to rule out
+		 * overlong encodings, surrogates, and values above U+10FFFF. */
+		unsigned char low = 0x80;
+		unsigned char high = 0xBF;
+		switch (bytes[0]) {
 			case 0xE0: {
-				// Unicode code points U+0800 to U+FFFF
-				return 3;
+				low = 0xA0;
+				break;
+			}
+			case 0xED: {
+				high = 0x9F;
+				break;
+			}
+			case 0xF0: {
+				low = 0x90;
+				break;
 			}
-			case 0xD0:
-			case 0xC0: {
-				// Unicode code points U+0080 to U+07FF
-				return 2;
+			case 0xF4: {
+				high = 0x8F;
+				break;
 			}
 			default: {
-				// Unicode code points U+0000 to U+007F
-				return 1;
+				break;
 			}
 		}
-		// Can't happen
-		return 0;
+
+		size_t needed = evaluateLength(cstr);
+		for (size_t i = 1; i < needed; ++i) {
+			if (i >= available || bytes[i] < low || bytes[i] > high) {
+				len = i;
+				return false;
+			}
+			low = 0x80;
+			high = 0xBF;
+		}
+
+		len = needed;
+		return true;
 	}
 
 	// Assignment Operators
@@ -522,4 +1011,11 @@ public:
 	}
 };
 
+/** Hashes onechars, for use as the keys of unordered containers. */
+template<>
+struct std::hash<onechar>
+{
+	size_t operator()(const onechar& ochr) const { return ochr.hash(); }
+};
+
 #endif  // ONESTRING_ONECHAR_HPP
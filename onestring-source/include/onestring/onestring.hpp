@@ -49,19 +49,55 @@
 #define ONESTRING_ONESTRING_HPP
 
 #include <algorithm>
-#include <cctype>  // isspace()
 #include <climits>
+#include <cstdint>
 #include <cstring>
+#include <functional>
 #include <iomanip>
 #include <iostream>
 #include <istream>
-#include <locale>  // std::toupper, std::tolower, std::locale
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include "onestring/onechar.hpp"
+#include "onestring/onestring_charset.hpp"
+#include "onestring/onestring_search.hpp"
+#include "onestring/onestring_segments.hpp"
+#include "onestring/onestring_view.hpp"
+#include "onestring/unicode/normalization_tables.hpp"
+
+class onestring_collator;
+class onestring_decoder;
+
+/** How malformed UTF-8 input is handled. */
+enum class onestring_policy {
+	/// Input is trusted to be well-formed, and is not checked at all.
+	TRUSTED,
+	/// Each malformed sequence is replaced with U+FFFD.
+	REPLACE,
+	/// Malformed input throws std::invalid_argument.
+	STRICT
+};
+
+/** The Unicode normalization forms. */
+enum class onestring_form {
+	/// Canonical composition, such as "é" as a single character.
+	NFC,
+	/// Canonical decomposition, such as "é" as "e" and a combining accent.
+	NFD,
+	/// Compatibility composition, which also folds variants such as "ﬁ".
+	NFKC,
+	/// Compatibility decomposition.
+	NFKD
+};
 
 class onestring
 {
+	friend onestring_collator;
+	friend onestring_decoder;
+
 public:
 	/// The default size the onestring is initialized at
 	inline static const size_t BASE_SIZE = 4;
@@ -88,6 +124,15 @@ private:
 	/// properly.
 	mutable char* _c_str;
 
+	/// Whether the hash is cached, and if so, whether it is current.
+	enum class hash_state : unsigned char { UNCACHED, STALE, CURRENT };
+
+	/// The cached hash, which is only valid while it is CURRENT.
+	mutable size_t _hash;
+
+	/// The state of the cached hash.
+	mutable hash_state _hash_state;
+
 public:
 	/*******************************************
 	 * Constructors + Destructor
@@ -95,7 +140,8 @@ public:
 
 	/**Default Constructor*/
 	onestring()
-	: _capacity(BASE_SIZE), _elements(0), internal(nullptr), _c_str(0)
+	: _capacity(BASE_SIZE), _elements(0), internal(nullptr), _c_str(0),
+	  _hash(0), _hash_state(hash_state::UNCACHED)
 	{
 		allocate(this->_capacity);
 		// assign('\0');
@@ -105,17 +151,43 @@ public:
 	 * \param the c-string to be converted to onestring */
 	// cppcheck-suppress noExplicitConstructor
 	onestring(const char* cstr)
-	: _capacity(BASE_SIZE), _elements(0), internal(nullptr), _c_str(0)
+	: _capacity(BASE_SIZE), _elements(0), internal(nullptr), _c_str(0),
+	  _hash(0), _hash_state(hash_state::UNCACHED)
 	{
 		allocate(this->_capacity);
 		assign(cstr);
 	}
 
-	/**Create a onestring from std::basic_string
+	/**Create a onestring from a UTF-16 c-string
+	 * \param the UTF-16 c-string to be converted to onestring */
+	// cppcheck-suppress noExplicitConstructor
+	onestring(const char16_t* cstr)
+	: _capacity(BASE_SIZE), _elements(0), internal(nullptr), _c_str(0),
+	  _hash(0), _hash_state(hash_state::UNCACHED)
+	{
+		allocate(this->_capacity);
+		assign(cstr);
+	}
+
+	/**Create a onestring from a UTF-32 c-string
+	 * \param the UTF-32 c-string to be converted to onestring */
+	// cppcheck-suppress noExplicitConstructor
+	onestring(const char32_t* cstr)
+	: _capacity(BASE_SIZE), _elements(0), internal(nullptr), _c_str(0),
+	  _hash(0), _hash_state(hash_state::UNCACHED)
+	{
+		allocate(this->_capacity);
+		assign(cstr);
+	}
+
+	/**Create a onestring from std::basic_string.
+	 * Strings of 16-bit and 32-bit characters (such as std::u16string and
+	 * std::u32string) are decoded as UTF-16 and UTF-32 respectively.
 	 * \param the string to be converted to onestring */
 	// cppcheck-suppress noExplicitConstructor
 	template<typename T> onestring(const std::basic_string<T>& str)
-	: _capacity(BASE_SIZE), _elements(0), internal(nullptr), _c_str(0)
+	: _capacity(BASE_SIZE), _elements(0), internal(nullptr), _c_str(0),
+	  _hash(0), _hash_state(hash_state::UNCACHED)
 	{
 		allocate(this->_capacity);
 		append(str);
@@ -124,17 +196,22 @@ public:
 	/**Create a onestring from another onestring
 	 * \param the onestring to be copied */
 	onestring(const onestring& ostr)
-	: _capacity(BASE_SIZE), _elements(0), internal(nullptr), _c_str(0)
+	: _capacity(BASE_SIZE), _elements(0), internal(nullptr), _c_str(0),
+	  _hash(0), _hash_state(hash_state::UNCACHED)
 	{
 		allocate(this->_capacity);
 		assign(ostr);
+		// A copy caches its hash if the original does.
+		this->_hash = ostr._hash;
+		this->_hash_state = ostr._hash_state;
 	}
 
 	/**Create a onestring from a char
 	 *  \param the char to be added */
 	// cppcheck-suppress noExplicitConstructor
 	onestring(char ch)
-	: _capacity(BASE_SIZE), _elements(0), internal(nullptr), _c_str(0)
+	: _capacity(BASE_SIZE), _elements(0), internal(nullptr), _c_str(0),
+	  _hash(0), _hash_state(hash_state::UNCACHED)
 	{
 		allocate(this->_capacity);
 		assign(ch);
@@ -144,12 +221,24 @@ public:
 	 *  \param the onechar to be added */
 	// cppcheck-suppress noExplicitConstructor
 	onestring(const onechar& ochr)
-	: _capacity(BASE_SIZE), _elements(0), internal(nullptr), _c_str(0)
+	: _capacity(BASE_SIZE), _elements(0), internal(nullptr), _c_str(0),
+	  _hash(0), _hash_state(hash_state::UNCACHED)
 	{
 		allocate(this->_capacity);
 		assign(ochr);
 	}
 
+	/**Create a onestring from a onestring_view
+	 *  \param the view to be copied */
+	// cppcheck-suppress noExplicitConstructor
+	onestring(const onestring_view& view)
+	: _capacity(BASE_SIZE), _elements(0), internal(nullptr), _c_str(0),
+	  _hash(0), _hash_state(hash_state::UNCACHED)
+	{
+		allocate(this->_capacity);
+		assign(view);
+	}
+
 	/**Destructor*/
 	~onestring()
 	{
@@ -238,6 +327,654 @@ private:
 			delete[] this->_c_str;
 			this->_c_str = nullptr;
 		}
+		invalidate_hash();
+	}
+
+	/** Invalidate the cached hash, if there is one.
+	  * It will be recomputed on next call to hash()
+	  */
+	void invalidate_hash()
+	{
+		if (this->_hash_state == hash_state::CURRENT) {
+			this->_hash_state = hash_state::STALE;
+		}
+	}
+
+	/** Appends every complete character at the start of a byte buffer.
+	 * Stops before a multibyte character that runs past the end of the
+	 * buffer, so the caller can hold those bytes for the next buffer.
+	 * Null bytes are stored as characters, not treated as terminators.
+	 * \param the policy for malformed input
+	 * \param the buffer to append from
+	 * \param the number of bytes in the buffer
+	 * \return the number of bytes consumed */
+	template<onestring_policy P = onestring_policy::TRUSTED>
+	size_t append_complete(const char* buffer, size_t len)
+	{
+		if constexpr (P != onestring_policy::TRUSTED) {
+			return append_validated<P>(buffer, len);
+		}
+
+		// Count the complete characters, so we only allocate once.
+		size_t index = 0;
+		size_t count = 0;
+		while (index < len) {
+			size_t charLen = onechar::evaluateLength(buffer + index);
+			// Stop before a character cut off by the end of the buffer.
+			if (index + charLen > len) {
+				break;
+			}
+			index += charLen;
+			++count;
+		}
+
+		expand(count);
+
+		size_t consumed = 0;
+		while (consumed < index) {
+			consumed += internal[_elements++].parseFromString(buffer, consumed);
+		}
+
+		if (count > 0) {
+			this->invalidate_c_str();
+		}
+		return consumed;
+	}
+
+	/** Tests whether eight bytes are all ASCII, checking them all at once.
+	 * \param the first of the eight bytes
+	 * \return true if all eight bytes are ASCII, else false */
+	static bool is_ascii_block(const char* bytes)
+	{
+		uint64_t block;
+/* Callers always check that eight bytes remain, but GCC still warns when
+ * this is inlined into dead code for a shorter string literal. */
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Warray-bounds"
+#endif
+		memcpy(&block, bytes, sizeof(block));
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+		return (block & 0x8080808080808080) == 0;
+	}
+
+	/// The code point substituted for malformed input.
+	inline static const char32_t REPLACEMENT_CHARACTER = 0xFFFD;
+
+	/** Appends every complete character at the start of a byte buffer,
+	 * checking that each is well-formed UTF-8. Used by append_complete()
+	 * for every policy except TRUSTED. If STRICT throws, nothing is
+	 * appended.
+	 * \param the policy for malformed input
+	 * \param the buffer to append from
+	 * \param the number of bytes in the buffer
+	 * \return the number of bytes consumed */
+	template<onestring_policy P>
+	size_t append_validated(const char* buffer, size_t len)
+	{
+		// There is never more than one character per byte.
+		expand(len);
+		size_t before = _elements;
+
+		size_t index = 0;
+		while (index < len) {
+			// Copy runs of ASCII eight bytes at a time.
+			while (index + 8 <= len && is_ascii_block(buffer + index)) {
+				for (size_t i = 0; i < 8; ++i) {
+					this->internal[_elements++].parse(buffer[index + i]);
+				}
+				index += 8;
+			}
+			if (index >= len) {
+				break;
+			}
+
+			size_t charLen = 0;
+			if (onechar::validate(buffer + index, charLen, len - index)) {
+				index += this->internal[_elements++].parseFromString(buffer, index);
+				continue;
+			}
+
+			/* Stop before a character cut off by the end of the buffer, but
+			 * only if later bytes could still finish it: a valid lead byte,
+			 * and every byte after it a valid continuation. */
+			auto lead = static_cast<unsigned char>(buffer[index]);
+			if (index + charLen == len && lead >= 0xC2 && lead <= 0xF4) {
+				break;
+			}
+
+			if constexpr (P == onestring_policy::STRICT) {
+				// Leave the onestring as it was, not partly appended.
+				_elements = before;
+				throw std::invalid_argument(
+					"Onestring: malformed UTF-8 at byte " +
+					std::to_string(index));
+			}
+			this->internal[_elements++].parseCodepoint(REPLACEMENT_CHARACTER);
+			index += charLen;
+		}
+
+		this->invalidate_c_str();
+		return index;
+	}
+
+	/** Throws std::invalid_argument if a c-string is not well-formed.
+	 * \param the c-string to check */
+	static void require_valid(const char* cstr)
+	{
+		size_t index = validate(cstr);
+		if (index != npos) {
+			throw std::invalid_argument("Onestring: malformed UTF-8 at byte " +
+										std::to_string(index));
+		}
+	}
+
+	/** Appends UTF-16 code units, decoding surrogate pairs.
+	 * Unpaired surrogates are replaced with U+FFFD.
+	 * \param the buffer of code units to append from
+	 * \param the number of code units in the buffer */
+	void append_utf16(const char16_t* buffer, size_t len)
+	{
+		// There is never more than one character per code unit.
+		expand(len);
+
+		size_t index = 0;
+		while (index < len) {
+			/* Copy runs of ASCII four code units at a time, checking all
+			 * four for high bits at once (a single 64-bit test). */
+			while (index + 4 <= len) {
+				if ((buffer[index] | buffer[index + 1] | buffer[index + 2] |
+					 buffer[index + 3]) &
+					0xFF80) {
+					break;
+				}
+				for (size_t i = 0; i < 4; ++i) {
+					this->internal[_elements++].parse(
+						static_cast<char>(buffer[index + i]));
+				}
+				index += 4;
+			}
+			if (index >= len) {
+				break;
+			}
+
+			char32_t cp = buffer[index++];
+			// If this is a high surrogate...
+			if (cp >= 0xD800 && cp <= 0xDBFF) {
+				// ...combine it with the low surrogate that must follow.
+				if (index < len && buffer[index] >= 0xDC00 &&
+					buffer[index] <= 0xDFFF) {
+					cp = 0x10000 + ((cp - 0xD800) << 10) +
+						 (buffer[index++] - 0xDC00);
+				} else {
+					cp = REPLACEMENT_CHARACTER;
+				}
+			}
+			// Otherwise, a lone low surrogate is invalid.
+			else if (cp >= 0xDC00 && cp <= 0xDFFF) {
+				cp = REPLACEMENT_CHARACTER;
+			}
+			this->internal[_elements++].parseCodepoint(cp);
+		}
+		this->invalidate_c_str();
+	}
+
+	/** Appends UTF-32 code points.
+	 * Surrogates and values above U+10FFFF are replaced with U+FFFD.
+	 * \param the buffer of code points to append from
+	 * \param the number of code points in the buffer */
+	void append_utf32(const char32_t* buffer, size_t len)
+	{
+		expand(len);
+
+		for (size_t index = 0; index < len; ++index) {
+			char32_t cp = buffer[index];
+			if (!onechar::isCodepoint(cp)) {
+				cp = REPLACEMENT_CHARACTER;
+			}
+			this->internal[_elements++].parseCodepoint(cp);
+		}
+		this->invalidate_c_str();
+	}
+
+	/** Tests whether the capital sigma at the given index ends a word,
+	 * meaning it is preceded by a cased letter and not followed by one,
+	 * ignoring any case-ignorable characters in between.
+	 * \param the index of the sigma
+	 * \return true if it is a final sigma, else false */
+	bool is_final_sigma(size_t index) const
+	{
+		bool preceded = false;
+		for (size_t i = index; i > 0;) {
+			char32_t cp = this->internal[--i].codepoint();
+			if (onechar::isCased(cp)) {
+				preceded = true;
+				break;
+			}
+			if (!onechar::isCaseIgnorable(cp)) {
+				break;
+			}
+		}
+		if (!preceded) {
+			return false;
+		}
+
+		for (size_t i = index + 1; i < this->_elements; ++i) {
+			char32_t cp = this->internal[i].codepoint();
+			if (onechar::isCased(cp)) {
+				return false;
+			}
+			if (!onechar::isCaseIgnorable(cp)) {
+				break;
+			}
+		}
+		return true;
+	}
+
+	/// The case mappings that map_case() can apply.
+	enum class case_mapping { LOWER, UPPER, FOLD };
+
+	/** Writes the full case mapping of one character.
+	 * \param the mapping to apply
+	 * \param the index of the character
+	 * \param the array of at least three code points to write to
+	 * \return the number of code points written */
+	template<case_mapping MAPPING>
+	size_t map_character(size_t index, char32_t* mapping) const
+	{
+		char32_t cp = this->internal[index].codepoint();
+		if constexpr (MAPPING == case_mapping::UPPER) {
+			return onechar::fullUpper(cp, mapping);
+		} else if constexpr (MAPPING == case_mapping::FOLD) {
+			return onechar::fullFold(cp, mapping);
+		} else {
+			size_t count = onechar::fullLower(cp, mapping);
+			if (cp == 0x03A3 && is_final_sigma(index)) {
+				mapping[0] = 0x03C2;
+			}
+			return count;
+		}
+	}
+
+	/** Converts every character to lowercase, uppercase, or its case
+	 * folding, using the full Unicode mappings. Characters are converted in
+	 * place until one maps to more than one code point; the rest of the
+	 * string is then rebuilt.
+	 * \param the mapping to apply
+	 * \return a reference to the onestring */
+	template<case_mapping MAPPING>
+	onestring& map_case()
+	{
+		char32_t mapping[3];
+		size_t i = 0;
+
+		for (; i < this->_elements; ++i) {
+			onechar& ch = this->internal[i];
+			// ASCII always maps to a single ASCII character.
+			if (ch.size == 1) {
+				ch.internal[0] = (MAPPING == case_mapping::UPPER)
+									 ? onechar::asciiUpper(ch.internal[0])
+									 : onechar::asciiLower(ch.internal[0]);
+				continue;
+			}
+			if (map_character<MAPPING>(i, mapping) != 1) {
+				break;
+			}
+			ch.parseCodepoint(mapping[0]);
+		}
+
+		if (i < this->_elements) {
+			onestring mapped;
+			mapped.reserve(this->_elements + 2);
+			for (size_t j = 0; j < i; ++j) {
+				mapped.internal[j] = this->internal[j];
+			}
+			mapped._elements = i;
+
+			for (; i < this->_elements; ++i) {
+				size_t count = map_character<MAPPING>(i, mapping);
+				mapped.expand(count);
+				for (size_t m = 0; m < count; ++m) {
+					mapped.internal[mapped._elements++].parseCodepoint(
+						mapping[m]);
+				}
+			}
+
+			// Take the rebuilt array; the old one is freed with mapped.
+			std::swap(this->internal, mapped.internal);
+			std::swap(this->_capacity, mapped._capacity);
+			std::swap(this->_elements, mapped._elements);
+		}
+
+		this->invalidate_c_str();
+		return *this;
+	}
+
+	/** Reads the full case folding of a sequence of characters one code
+	 * point at a time, so that strings can be compared without regard to
+	 * case without copying them. */
+	class case_folder
+	{
+	private:
+		/// The next character to fold, if reading onechars
+		const onechar* _next;
+		/// The end of the onechars
+		const onechar* _end;
+		/// The next character to fold, if reading a c-string
+		const char* _cstr;
+		/// The rest of the folding of the last character read
+		char32_t _pending[3];
+		/// The number of code points in _pending
+		size_t _count;
+		/// The index of the next code point to read in _pending
+		size_t _index;
+
+	public:
+		/** Create a folder over a series of onechars.
+		 * \param the first onechar
+		 * \param the number of onechars */
+		case_folder(const onechar* chars, size_t length)
+		: _next(chars), _end(chars + length), _cstr(nullptr), _count(0),
+		  _index(0)
+		{
+		}
+
+		/** Create a folder over a c-string.
+		 * \param the c-string */
+		explicit case_folder(const char* cstr)
+		: _next(nullptr), _end(nullptr), _cstr(cstr), _count(0), _index(0)
+		{
+		}
+
+		/** Reads the next code point of the folding.
+		 * \param the code point to write to
+		 * \return false if the folding has ended, else true */
+		bool next(char32_t& cp)
+		{
+			if (_index < _count) {
+				cp = _pending[_index++];
+				return true;
+			}
+
+			onechar parsed;
+			const onechar* ch = &parsed;
+			if (_cstr != nullptr) {
+				if (*_cstr == '\0') {
+					return false;
+				}
+				parsed.parse(_cstr);
+				_cstr += parsed.size;
+			} else {
+				if (_next == _end) {
+					return false;
+				}
+				ch = _next++;
+			}
+
+			// ASCII folds to lowercase, without a table lookup.
+			if (ch->size == 1) {
+				cp = static_cast<unsigned char>(
+					onechar::asciiLower(ch->internal[0]));
+				return true;
+			}
+			_count = onechar::fullFold(ch->codepoint(), _pending);
+			_index = 1;
+			cp = _pending[0];
+			return true;
+		}
+	};
+
+	/** Compares the case foldings of two strings by code point.
+	 * \param the folder over the first string
+	 * \param the folder over the second string
+	 * \return a negative integer if the first folding is lower, zero if
+	 * they are the same, or a positive integer if the first is higher */
+	static int compare_folded(case_folder lhs, case_folder rhs)
+	{
+		char32_t a = 0;
+		char32_t b = 0;
+		while (true) {
+			bool more = lhs.next(a);
+			if (more != rhs.next(b)) {
+				return more ? 1 : -1;
+			}
+			if (!more) {
+				return 0;
+			}
+			if (a != b) {
+				return (a < b) ? -1 : 1;
+			}
+		}
+	}
+
+	using normalization = onestring_normalization_tables;
+
+	/// The Hangul syllables and conjoining jamo, which are decomposed and
+	/// composed algorithmically rather than by table.
+	inline static const char32_t HANGUL_S_BASE = 0xAC00;
+	inline static const char32_t HANGUL_L_BASE = 0x1100;
+	inline static const char32_t HANGUL_V_BASE = 0x1161;
+	inline static const char32_t HANGUL_T_BASE = 0x11A7;
+	inline static const char32_t HANGUL_L_COUNT = 19;
+	inline static const char32_t HANGUL_V_COUNT = 21;
+	inline static const char32_t HANGUL_T_COUNT = 28;
+	inline static const char32_t HANGUL_N_COUNT = 588;
+	inline static const char32_t HANGUL_S_COUNT = 11172;
+
+	/// The result of a normalization quick check.
+	enum class quick_check_result { YES, NO, MAYBE };
+
+	/** Checks whether the onestring is in a normalization form without
+	 * allocating, using the Unicode quick check property.
+	 * \param the normalization form
+	 * \param set to the index of the first character that is not, or may
+	 * not be, in the form, or npos if there is none
+	 * \return YES or NO if that is certain, else MAYBE */
+	quick_check_result quick_check(onestring_form form, size_t& first) const
+	{
+		uint8_t no = normalization::NFC_NO;
+		uint8_t maybe = normalization::NFC_MAYBE;
+		if (form == onestring_form::NFD) {
+			no = normalization::NFD_NO;
+			maybe = 0;
+		} else if (form == onestring_form::NFKC) {
+			no = normalization::NFKC_NO;
+			maybe = normalization::NFKC_MAYBE;
+		} else if (form == onestring_form::NFKD) {
+			no = normalization::NFKD_NO;
+			maybe = 0;
+		}
+
+		quick_check_result result = quick_check_result::YES;
+		first = npos;
+		uint8_t last_ccc = 0;
+		for (size_t i = 0; i < this->_elements; ++i) {
+			// ASCII is a starter in every form.
+			if (this->internal[i].size == 1) {
+				last_ccc = 0;
+				continue;
+			}
+
+			const auto& record =
+				normalization::lookup(this->internal[i].codepoint());
+			if ((record.ccc != 0 && last_ccc > record.ccc) ||
+				(record.flags & no)) {
+				if (first == npos) {
+					first = i;
+				}
+				return quick_check_result::NO;
+			}
+			if ((record.flags & maybe) && first == npos) {
+				first = i;
+				result = quick_check_result::MAYBE;
+			}
+			last_ccc = record.ccc;
+		}
+		return result;
+	}
+
+	/** Appends the full decomposition of a code point to a buffer.
+	 * \param the code point to decompose
+	 * \param true for the compatibility decomposition, else canonical
+	 * \param the buffer to append to */
+	static void decompose(char32_t cp,
+						  bool compatibility,
+						  std::u32string& buffer)
+	{
+		if (cp - HANGUL_S_BASE < HANGUL_S_COUNT) {
+			char32_t index = cp - HANGUL_S_BASE;
+			buffer.push_back(HANGUL_L_BASE + index / HANGUL_N_COUNT);
+			buffer.push_back(
+				HANGUL_V_BASE + (index % HANGUL_N_COUNT) / HANGUL_T_COUNT);
+			if (index % HANGUL_T_COUNT != 0) {
+				buffer.push_back(HANGUL_T_BASE + index % HANGUL_T_COUNT);
+			}
+			return;
+		}
+
+		const auto& record = normalization::lookup(cp);
+		if (compatibility && (record.flags & normalization::NFKD_NO)) {
+			append_decomposition(normalization::COMPATIBILITY, cp, buffer);
+		} else if (!compatibility && (record.flags & normalization::NFD_NO)) {
+			append_decomposition(normalization::CANONICAL, cp, buffer);
+		} else {
+			buffer.push_back(cp);
+		}
+	}
+
+	/** Appends a decomposition from a table to a buffer.
+	 * \param the table, sorted by code point
+	 * \param the code point, which must be in the table
+	 * \param the buffer to append to */
+	template<size_t N>
+	static void append_decomposition(
+		const normalization::decomposition (&table)[N],
+		char32_t cp,
+		std::u32string& buffer)
+	{
+		auto found = std::lower_bound(
+			table,
+			table + N,
+			cp,
+			[](const normalization::decomposition& entry, char32_t key) {
+				return entry.cp < key;
+			});
+		buffer.append(normalization::DATA + found->offset, found->length);
+	}
+
+	/** Sorts each run of non-starters in a buffer by combining class,
+	 * keeping the order of those with the same class.
+	 * \param the buffer to reorder */
+	static void reorder(std::u32string& buffer)
+	{
+		for (size_t i = 1; i < buffer.size(); ++i) {
+			char32_t cp = buffer[i];
+			uint8_t ccc = normalization::lookup(cp).ccc;
+			if (ccc == 0) {
+				continue;
+			}
+
+			size_t j = i;
+			while (j > 0 && normalization::lookup(buffer[j - 1]).ccc > ccc) {
+				buffer[j] = buffer[j - 1];
+				--j;
+			}
+			buffer[j] = cp;
+		}
+	}
+
+	/** Finds the primary composite of two code points.
+	 * \param the first code point, a starter
+	 * \param the second code point
+	 * \return the composite, or 0 if they do not compose */
+	static char32_t compose_pair(char32_t first, char32_t second)
+	{
+		if (first - HANGUL_L_BASE < HANGUL_L_COUNT &&
+			second - HANGUL_V_BASE < HANGUL_V_COUNT) {
+			return HANGUL_S_BASE +
+				   ((first - HANGUL_L_BASE) * HANGUL_V_COUNT +
+					(second - HANGUL_V_BASE)) *
+					   HANGUL_T_COUNT;
+		}
+		if (first - HANGUL_S_BASE < HANGUL_S_COUNT &&
+			(first - HANGUL_S_BASE) % HANGUL_T_COUNT == 0 &&
+			second - HANGUL_T_BASE - 1 < HANGUL_T_COUNT - 1) {
+			return first + (second - HANGUL_T_BASE);
+		}
+
+		const auto* end = normalization::COMPOSITIONS +
+						  sizeof(normalization::COMPOSITIONS) /
+							  sizeof(normalization::COMPOSITIONS[0]);
+		auto found = std::lower_bound(
+			normalization::COMPOSITIONS,
+			end,
+			first,
+			[second](const normalization::composition& entry, char32_t key) {
+				return entry.first < key ||
+					   (entry.first == key && entry.second < second);
+			});
+		if (found != end && found->first == first && found->second == second) {
+			return found->composite;
+		}
+		return 0;
+	}
+
+	/** Composes a decomposed, reordered buffer in place.
+	 * \param the buffer to compose */
+	static void compose(std::u32string& buffer)
+	{
+		size_t starter = npos;
+		uint8_t last_ccc = 0;
+		size_t out = 0;
+
+		for (size_t i = 0; i < buffer.size(); ++i) {
+			char32_t cp = buffer[i];
+			uint8_t ccc = normalization::lookup(cp).ccc;
+
+			// A character composes with the last starter unless a character
+			// between them has the same or a higher combining class.
+			if (starter != npos && (out == starter + 1 || last_ccc < ccc)) {
+				char32_t composite = compose_pair(buffer[starter], cp);
+				if (composite != 0) {
+					buffer[starter] = composite;
+					continue;
+				}
+			}
+
+			if (ccc == 0) {
+				starter = out;
+			}
+			last_ccc = ccc;
+			buffer[out++] = cp;
+		}
+		buffer.resize(out);
+	}
+
+	/** Tests whether the character at an index is a starter that cannot
+	 * change when normalized, meaning nothing before it can affect it.
+	 * \param the index of the character
+	 * \param the normalization form
+	 * \return true if normalization can begin there, else false */
+	bool is_stable(size_t index, onestring_form form) const
+	{
+		if (this->internal[index].size == 1) {
+			return true;
+		}
+
+		uint8_t unstable = normalization::NFC_NO | normalization::NFC_MAYBE;
+		if (form == onestring_form::NFD) {
+			unstable = normalization::NFD_NO;
+		} else if (form == onestring_form::NFKC) {
+			unstable = normalization::NFKC_NO | normalization::NFKC_MAYBE;
+		} else if (form == onestring_form::NFKD) {
+			unstable = normalization::NFKD_NO;
+		}
+
+		const auto& record =
+			normalization::lookup(this->internal[index].codepoint());
+		return record.ccc == 0 && !(record.flags & unstable);
 	}
 
 public:
@@ -317,6 +1054,38 @@ public:
 		return count;
 	}
 
+	/** Finds the first malformed UTF-8 sequence in a c-string.
+	 * \param the c-string to check
+	 * \return the byte index of the first malformed sequence,
+	 * or npos if the c-string is well-formed */
+	static size_t validate(const char* cstr) { return validate(cstr, strlen(cstr)); }
+
+	/** Finds the first malformed UTF-8 sequence in a byte buffer.
+	 * \param the buffer to check
+	 * \param the number of bytes in the buffer
+	 * \return the byte index of the first malformed sequence,
+	 * or npos if the buffer is well-formed */
+	static size_t validate(const char* buffer, size_t len)
+	{
+		size_t index = 0;
+		while (index < len) {
+			// Skip runs of ASCII eight bytes at a time.
+			while (index + 8 <= len && is_ascii_block(buffer + index)) {
+				index += 8;
+			}
+			if (index >= len) {
+				break;
+			}
+
+			size_t charLen = 0;
+			if (!onechar::validate(buffer + index, charLen, len - index)) {
+				return index;
+			}
+			index += charLen;
+		}
+		return npos;
+	}
+
 	/*******************************************
 	 * Accessors
 	 *******************************************/
@@ -330,6 +1099,8 @@ public:
 			throw std::out_of_range("Onestring::at(): Index out of bounds.");
 		}
 
+		// The onechar may be changed through the reference.
+		invalidate_hash();
 		return internal[pos];
 	}
 
@@ -351,6 +1122,7 @@ public:
 	{
 		// WARNING: If string is empty, this is undefined (but memory safe)
 		// Return a reference to the last element in the string.
+		invalidate_hash();
 		return this->internal[_elements - 1];
 	}
 
@@ -412,6 +1184,40 @@ public:
 		return cstr_i;
 	}
 
+	/** Copies the code points of a substring to the given buffer.
+	 * No null terminator is written.
+	 * \param pointer to an array of code points
+	 * \param the maximum number of code points in the array
+	 * \param the number of Unicode characters to copy. Defaults to 0,
+	 * which will copy as many characters as will fit into the array.
+	 * \param the position of the first character to be copied (optional)
+	 * If this is greater than the string length, it throws out_of_range
+	 * \return the number of code points copied to the array */
+	size_t copy_codepoints(char32_t* arr,
+						   size_t max,
+						   size_t len = 0,
+						   size_t pos = 0) const
+	{
+		if (pos > this->_elements) {
+			throw std::out_of_range(
+				"Onestring::copy_codepoints(): specified pos out of range");
+		}
+
+		if (len == 0 || len > this->_elements - pos) {
+			len = this->_elements - pos;
+		}
+		if (len > max) {
+			len = max;
+		}
+
+		// Every character decodes independently, without branching on size.
+		const onechar* src = this->internal + pos;
+		for (size_t i = 0; i < len; ++i) {
+			arr[i] = src[i].codepoint();
+		}
+		return len;
+	}
+
 	/** Returns a c-string equivalent of a onestring.
 	  * Pointer may become invalidated by calls to other member functions.
 	  * \return the c-string */
@@ -440,12 +1246,62 @@ public:
 		return this->_c_str;
 	}
 
-	/** Returns a std::basic_string equivalent of a onestring
+	/** Returns a std::basic_string equivalent of a onestring.
+	 * Strings of 16-bit and 32-bit characters (such as std::u16string and
+	 * std::u32string) are encoded as UTF-16 and UTF-32 respectively.
 	 * \return the std::basic_string
 	 */
 	template<typename T>
 	operator std::basic_string<T>() const {
-		auto r = std::basic_string<T>(this->c_str());
+		if constexpr (sizeof(T) == sizeof(char16_t)) {
+			std::u16string u16 = to_u16string();
+			return std::basic_string<T>(u16.begin(), u16.end());
+		} else if constexpr (sizeof(T) == sizeof(char32_t)) {
+			std::u32string u32 = to_u32string();
+			return std::basic_string<T>(u32.begin(), u32.end());
+		} else {
+			auto r = std::basic_string<T>(
+				reinterpret_cast<const T*>(this->c_str()));
+			return r;
+		}
+	}
+
+	/** Returns a UTF-16 equivalent of a onestring.
+	 * \return the std::u16string */
+	std::u16string to_u16string() const
+	{
+		std::u16string r;
+		// Most characters need only one code unit.
+		r.reserve(this->_elements);
+
+		for (size_t i = 0; i < this->_elements; ++i) {
+			// ASCII needs no decoding.
+			if (this->internal[i].size == 1) {
+				r.push_back(static_cast<unsigned char>(this->internal[i].internal[0]));
+				continue;
+			}
+
+			char32_t cp = this->internal[i].codepoint();
+			// Code points beyond the BMP become a surrogate pair.
+			if (cp >= 0x10000) {
+				cp -= 0x10000;
+				r.push_back(static_cast<char16_t>(0xD800 + (cp >> 10)));
+				r.push_back(static_cast<char16_t>(0xDC00 + (cp & 0x3FF)));
+			} else {
+				r.push_back(static_cast<char16_t>(cp));
+			}
+		}
+		return r;
+	}
+
+	/** Returns a UTF-32 equivalent of a onestring.
+	 * \return the std::u32string */
+	std::u32string to_u32string() const
+	{
+		std::u32string r(this->_elements, U'\0');
+		for (size_t i = 0; i < this->_elements; ++i) {
+			r[i] = this->internal[i].codepoint();
+		}
 		return r;
 	}
 
@@ -467,6 +1323,7 @@ public:
 	{
 		// WARNING: If string is empty, this is undefined (but memory safe)
 		// Return a reference to the first element in the string.
+		invalidate_hash();
 		return this->internal[0];
 	}
 
@@ -530,6 +1387,125 @@ public:
 		return r;
 	}
 
+	/** Creates a view of part of the onestring, without copying.
+	 * The view is invalidated by any change to the onestring.
+	 * \param the position of the first character, default 0
+	 * If this is greater than the string length, it throws out_of_range
+	 * \param the number of characters, default to the end of the string
+	 * \return the view */
+	onestring_view view(size_t pos = 0, size_t len = npos) const
+	{
+		if (pos > this->_elements) {
+			throw std::out_of_range(
+				"Onestring::view(): specified pos out of range");
+		}
+		if (len > this->_elements - pos) {
+			len = this->_elements - pos;
+		}
+		return onestring_view(this->internal + pos, len);
+	}
+
+	/** Gets the grapheme clusters of the onestring, which are the
+	 * user-perceived characters, such as a letter with its accents, or an
+	 * emoji sequence. These are invalidated by any change to the onestring.
+	 * \return the grapheme clusters, which iterate as onestring_views */
+	onestring_segments graphemes() const
+	{
+		return onestring_segments(view(), onestring_unit::GRAPHEME);
+	}
+
+	/** Gets the number of grapheme clusters in the onestring.
+	 * \return the number of grapheme clusters */
+	size_t grapheme_length() const { return graphemes().count(); }
+
+	/** Gets the number of terminal columns the onestring takes, counting
+	 * East Asian wide characters and emoji as 2 and combining marks as 0.
+	 * See onestring_view::display_width().
+	 * \return the number of columns */
+	size_t display_width() const { return view().display_width(); }
+
+	/** Gets the words of the onestring. The spaces and punctuation between
+	 * words are segments too, which onestring_segments::is_word() can
+	 * filter out. These are invalidated by any change to the onestring.
+	 * \return the words, which iterate as onestring_views */
+	onestring_segments words() const
+	{
+		return onestring_segments(view(), onestring_unit::WORD);
+	}
+
+	/** Gets the sentences of the onestring, each with any spaces after it.
+	 * These are invalidated by any change to the onestring.
+	 * \return the sentences, which iterate as onestring_views */
+	onestring_segments sentences() const
+	{
+		return onestring_segments(view(), onestring_unit::SENTENCE);
+	}
+
+	/** Tests every character of the onestring against a class of
+	 * characters, such as letters or whitespace, writing one bit for each.
+	 * Bit (i % 64) of mask[i / 64] is set if character i is in the class.
+	 * \param the class to test for
+	 * \param the array of at least (length() + 63) / 64 words to write to */
+	void classify(onestring_class cls, uint64_t* mask) const
+	{
+		const onechar::class_mask& classes =
+			onechar::CLASS_MASKS[static_cast<size_t>(cls)];
+
+		for (size_t start = 0; start < this->_elements; start += 64) {
+			size_t end = std::min(start + 64, this->_elements);
+			uint64_t bits = 0;
+			for (size_t i = start; i < end; ++i) {
+				const auto& record = this->internal[i].properties();
+				uint64_t in = ((classes.categories >>
+								static_cast<unsigned>(record.category)) &
+							   1) |
+							  ((record.flags & classes.flags) != 0);
+				bits |= in << (i - start);
+			}
+			mask[start / 64] = bits;
+		}
+	}
+
+	/** Tests every character of the onestring against a class of
+	 * characters, such as letters or whitespace, giving one bit for each.
+	 * \param the class to test for
+	 * \return the bits, where bit (i % 64) of word (i / 64) is set if
+	 * character i is in the class */
+	std::vector<uint64_t> classify(onestring_class cls) const
+	{
+		std::vector<uint64_t> mask((this->_elements + 63) / 64);
+		classify(cls, mask.data());
+		return mask;
+	}
+
+	/** Creates a smaller string out of a series of grapheme clusters in
+	 * the existing onestring.
+	 * \param the grapheme cluster to begin the string to be created
+	 * If this is greater than the number of clusters, it throws out_of_range
+	 * \param the number of grapheme clusters, optional.
+	 * \return the created string */
+	onestring grapheme_substr(size_t pos = 0, size_t len = npos) const
+	{
+		onestring_view text = view();
+		size_t start = 0;
+		for (size_t cluster = 0; cluster < pos; ++cluster) {
+			if (start == this->_elements) {
+				throw std::out_of_range(
+					"Onestring::grapheme_substr(): specified pos out of range");
+			}
+			start = onestring_segments::next_boundary(
+				text, start, onestring_unit::GRAPHEME);
+		}
+
+		size_t end = start;
+		for (size_t cluster = 0; cluster < len && end < this->_elements;
+			 ++cluster) {
+			end = onestring_segments::next_boundary(
+				text, end, onestring_unit::GRAPHEME);
+		}
+		return onestring(text.substr(start, end - start));
+	}
+
 	/**Gets the byte size of the equivalent c-string.
 	 * WARNING: Given a onestring 's', s.size() < sizeof(s)
 	 * \return the number of bytes in the onestring */
@@ -574,101 +1550,160 @@ public:
 	 ********************************************/
 
 	/** Compares the onestring against a single char.
+	 * Strings are ordered lexicographically by code point, the same
+	 * order as comparing their UTF-8 bytes.
 	 * \return an integer representing the result.
-	 * Returns a negative integer IF this onestring is shorter
-	 * OR the same length and lower in value
+	 * Returns a negative integer IF this onestring sorts first
 	 * Returns zero if the values are the same
-	 * Returns a positive integer IF this onestring is longer
-	 * OR the same length and higher in value */
+	 * Returns a positive integer IF this onestring sorts last */
 	int compare(const char ch) const
 	{
-		int sizeDiff = this->_elements - 1;
-		if (sizeDiff == 0) {
-			return this->internal[0].compare(ch);
+		if (this->_elements == 0) {
+			return -1;
 		}
-		return sizeDiff;
+		int r = this->internal[0].compare(ch);
+		if (r != 0) {
+			return r;
+		}
+		return (this->_elements > 1) ? 1 : 0;
 	}
 
 	/** Compares the onestring against a single onechar.
+	 * Strings are ordered lexicographically by code point, the same
+	 * order as comparing their UTF-8 bytes.
 	 * \return an integer representing the result.
-	 * Returns a negative integer IF this onestring is shorter
-	 * OR the same length and lower in value
+	 * Returns a negative integer IF this onestring sorts first
 	 * Returns zero if the values are the same
-	 * Returns a positive integer IF this onestring is longer
-	 * OR the same length and higher in value */
+	 * Returns a positive integer IF this onestring sorts last */
 	int compare(const onechar& ochr) const
 	{
-		int sizeDiff = this->_elements - 1;
-		if (sizeDiff == 0) {
-			return this->internal[0].compare(ochr);
+		if (this->_elements == 0) {
+			return -1;
+		}
+		int r = this->internal[0].compare(ochr);
+		if (r != 0) {
+			return r;
 		}
-		return sizeDiff;
+		return (this->_elements > 1) ? 1 : 0;
 	}
 
 	/** Compares the onestring against a c-string.
+	 * Strings are ordered lexicographically by code point, the same
+	 * order as comparing their UTF-8 bytes.
 	 * \return an integer representing the result.
-	 * Returns a negative integer IF this onestring is shorter
-	 * OR the same length and lower in value
+	 * Returns a negative integer IF this onestring sorts first
 	 * Returns zero if the values are the same
-	 * Returns a positive integer IF this onestring is longer
-	 * OR the same length and higher in value */
+	 * Returns a positive integer IF this onestring sorts last */
 	int compare(const char* cstr) const
 	{
 		/* This algorithm will not return a meaningful integer; only its
 		 * relation to 0 will be useful */
 
-		int sizeDiff = this->_elements - characterCount(cstr);
-
-		if (sizeDiff == 0) {
-			size_t j = 0;
-			// If the strings are the same length, compare each character...
-			for (size_t i = 0; i < this->_elements; ++i) {
-				// Return the compare result of the first character mismatch
-				int r = this->internal[i].compare(cstr + j);
-				if (r != 0) {
-					return r;
-				}
-
-				j += onechar::evaluateLength(cstr + j);
+		for (size_t i = 0; i < this->_elements; ++i) {
+			// If the c-string ends first, it is a prefix of this string.
+			if (*cstr == '\0') {
+				return 1;
+			}
+			// Return the compare result of the first character mismatch
+			int r = this->internal[i].compare(cstr);
+			if (r != 0) {
+				return r;
 			}
+			cstr += this->internal[i].size;
 		}
-		return sizeDiff;
+		// This string is a prefix of the c-string, or equal to it.
+		return (*cstr == '\0') ? 0 : -1;
 	}
 
 	/** Compares the onestring against a std::basic_string.
+	 * Strings are ordered lexicographically by code point, the same
+	 * order as comparing their UTF-8 bytes.
 	 * \return an integer representing the result.
-	 * Returns a negative integer IF this onestring is shorter
-	 * OR the same length and lower in value
+	 * Returns a negative integer IF this onestring sorts first
 	 * Returns zero if the values are the same
-	 * Returns a positive integer IF this onestring is longer
-	 * OR the same length and higher in value */
+	 * Returns a positive integer IF this onestring sorts last */
 	template<typename T>
-	int compare(const std::basic_string<T>& str) const { return compare(str.c_str()); }
+	int compare(const std::basic_string<T>& str) const
+	{
+		if constexpr (sizeof(T) == sizeof(char)) {
+			return compare(reinterpret_cast<const char*>(str.data()),
+						   str.size());
+		} else {
+			return compare(onestring(str));
+		}
+	}
+
+	/** Compares the onestring against a std::string_view.
+	 * \return an integer representing the result.
+	 * Returns a negative integer IF this onestring sorts first
+	 * Returns zero if the values are the same
+	 * Returns a positive integer IF this onestring sorts last */
+	int compare(std::string_view str) const
+	{
+		return compare(str.data(), str.size());
+	}
+
+	/** Compares the onestring against a UTF-8 string of known length,
+	 * which need not be null-terminated.
+	 * Strings are ordered lexicographically by code point, the same
+	 * order as comparing their UTF-8 bytes.
+	 * \param the UTF-8 string to compare against
+	 * \param the length of the string, in bytes
+	 * \return an integer representing the result.
+	 * Returns a negative integer IF this onestring sorts first
+	 * Returns zero if the values are the same
+	 * Returns a positive integer IF this onestring sorts last */
+	int compare(const char* str, size_t len) const
+	{
+		/* This algorithm will not return a meaningful integer; only its
+		 * relation to 0 will be useful */
+
+		const char* end = str + len;
+		for (size_t i = 0; i < this->_elements; ++i) {
+			const onechar& ch = this->internal[i];
+			size_t remaining = static_cast<size_t>(end - str);
+			size_t bytes = (ch.size < remaining) ? ch.size : remaining;
+			// An empty remainder compares equal, and falls through below.
+			int r = memcmp(ch.internal, str, bytes);
+			if (r != 0) {
+				return r;
+			}
+			// If the argument ends first, it is a prefix of this string.
+			if (bytes < ch.size) {
+				return 1;
+			}
+			str += ch.size;
+		}
+		// This string is a prefix of the argument, or equal to it.
+		return (str == end) ? 0 : -1;
+	}
 
 	/** Compares the onestring against a onestring.
+	 * Strings are ordered lexicographically by code point, the same
+	 * order as comparing their UTF-8 bytes.
 	 * \return an integer representing the result.
-	 * Returns a negative integer IF this onestring is shorter
-	 * OR the same length and lower in value
+	 * Returns a negative integer IF this onestring sorts first
 	 * Returns zero if the values are the same
-	 * Returns a positive integer IF this onestring is longer
-	 * OR the same length and higher in value */
+	 * Returns a positive integer IF this onestring sorts last */
 	int compare(const onestring& ostr) const
 	{
 		/* This algorithm will not return a meaningful integer; only its
 		 * relation to 0 will be useful */
 
-		int sizeDiff = this->_elements - ostr._elements;
-		if (sizeDiff == 0) {
-			// If the strings are the same length, compare each character...
-			for (size_t i = 0; i < this->_elements; ++i) {
-				// Return the compare result of the first character mismatch
-				int r = this->internal[i].compare(ostr.internal[i]);
-				if (r != 0) {
-					return r;
-				}
+		size_t len = (this->_elements < ostr._elements) ? this->_elements
+														: ostr._elements;
+		for (size_t i = 0; i < len; ++i) {
+			// Return the compare result of the first character mismatch
+			int r = this->internal[i].compare(ostr.internal[i]);
+			if (r != 0) {
+				return r;
 			}
 		}
-		return sizeDiff;
+		// If one string is a prefix of the other, the shorter sorts first.
+		if (this->_elements == ostr._elements) {
+			return 0;
+		}
+		return (this->_elements < ostr._elements) ? -1 : 1;
 	}
 
 	/** Tests if the onestring value is equivalent to a single char.
@@ -692,29 +1727,72 @@ public:
 	 * \return true if equal, else false */
 	bool equals(const char* cstr) const
 	{
-		size_t index = 0;
-		size_t compare_to = 0;
-		if (this->_elements != characterCount(cstr)) {
-			return false;
-		}
-		while (cstr[index] != '\0') {
-			if (!(this->internal[compare_to].equals_at(cstr + index))) {
-				return false;
-			}
-			index += onechar::evaluateLength(cstr + index);
-			if (compare_to++ > this->_elements) {
-				return false;
+		// Compare in one pass, and stop at the first mismatch.
+		for (size_t i = 0; i < this->_elements; ++i) {
+			const onechar& ch = this->internal[i];
+			for (size_t b = 0; b < ch.size; ++b, ++cstr) {
+				// Stop at the null terminator, rather than read past it.
+				if (*cstr == '\0' || *cstr != ch.internal[b]) {
+					return false;
+				}
 			}
 		}
-
-		return true;
+		return *cstr == '\0';
 	}
 
 	/** Tests if the onestring value is equivalent to a std::basic_string.
 	 * \param the std::basic_string to compare against
 	 * \return true if equal, else false */
 	template<typename T>
-	bool equals(const std::basic_string<T>& str) const { return equals(str.c_str()); }
+	bool equals(const std::basic_string<T>& str) const
+	{
+		if constexpr (sizeof(T) == sizeof(char)) {
+			return equals(reinterpret_cast<const char*>(str.data()), str.size());
+		} else {
+			return equals(onestring(str));
+		}
+	}
+
+	/** Tests if the onestring value is equivalent to a std::string_view.
+	 * \param the std::string_view to compare against
+	 * \return true if equal, else false */
+	bool equals(std::string_view str) const
+	{
+		return equals(str.data(), str.size());
+	}
+
+	/** Tests if the onestring value is equivalent to a UTF-8 string of
+	 * known length, which need not be null-terminated.
+	 * \param the UTF-8 string to compare against
+	 * \param the length of the string, in bytes
+	 * \return true if equal, else false */
+	bool equals(const char* str, size_t len) const
+	{
+		// Each character is one to four bytes, so most strings of a
+		// different length are rejected without reading them.
+		if (len < this->_elements ||
+			len > this->_elements * onechar::MAX_SIZE) {
+			return false;
+		}
+		const char* end = str + len;
+		for (size_t i = 0; i < this->_elements; ++i) {
+			const onechar& ch = this->internal[i];
+			if (static_cast<size_t>(end - str) < ch.size ||
+				memcmp(ch.internal, str, ch.size) != 0) {
+				return false;
+			}
+			str += ch.size;
+		}
+		return str == end;
+	}
+
+	/** Tests if the onestring value is equivalent to a onestring_view.
+	 * \param the onestring_view to compare against
+	 * \return true if equal, else false */
+	bool equals(const onestring_view& other) const
+	{
+		return other.equals(view());
+	}
 
 	/** Tests if the onestring value is equivalent to another onestring.
 	 * \param the onestring to compare against
@@ -733,6 +1811,163 @@ public:
 		return true;
 	}
 
+	/** Compares the onestring against a c-string, ignoring case.
+	 * The full case foldings of the strings are compared by code point,
+	 * without copying either string.
+	 * \param the c-string to compare against
+	 * \return a negative integer if this onestring is lower, zero if the
+	 * strings are equal except for case, or a positive integer if this
+	 * onestring is higher */
+	int compare_icase(const char* cstr) const
+	{
+		return compare_folded(case_folder(this->internal, this->_elements),
+							  case_folder(cstr));
+	}
+
+	/** Compares the onestring against a std::basic_string, ignoring case.
+	 * \param the std::basic_string to compare against
+	 * \return a negative integer if this onestring is lower, zero if the
+	 * strings are equal except for case, or a positive integer if this
+	 * onestring is higher */
+	template<typename T>
+	int compare_icase(const std::basic_string<T>& str) const
+	{
+		if constexpr (sizeof(T) == sizeof(char)) {
+			return compare_icase(reinterpret_cast<const char*>(str.c_str()));
+		} else {
+			return compare_icase(onestring(str));
+		}
+	}
+
+	/** Compares the onestring against a onestring_view, ignoring case.
+	 * \param the onestring_view to compare against
+	 * \return a negative integer if this onestring is lower, zero if the
+	 * strings are equal except for case, or a positive integer if this
+	 * onestring is higher */
+	int compare_icase(const onestring_view& ostr) const
+	{
+		return compare_folded(case_folder(this->internal, this->_elements),
+							  case_folder(ostr.data(), ostr.length()));
+	}
+
+	/** Compares the onestring against another onestring, ignoring case.
+	 * \param the onestring to compare against
+	 * \return a negative integer if this onestring is lower, zero if the
+	 * strings are equal except for case, or a positive integer if this
+	 * onestring is higher */
+	int compare_icase(const onestring& ostr) const
+	{
+		return compare_folded(case_folder(this->internal, this->_elements),
+							  case_folder(ostr.internal, ostr._elements));
+	}
+
+	/** Tests if the onestring is equivalent to a c-string, ignoring case.
+	 * \param the c-string to compare against
+	 * \return true if the strings have the same case folding, else false */
+	bool equals_icase(const char* cstr) const
+	{
+		return compare_icase(cstr) == 0;
+	}
+
+	/** Tests if the onestring is equivalent to a std::basic_string,
+	 * ignoring case.
+	 * \param the std::basic_string to compare against
+	 * \return true if the strings have the same case folding, else false */
+	template<typename T>
+	bool equals_icase(const std::basic_string<T>& str) const
+	{
+		return compare_icase(str) == 0;
+	}
+
+	/** Tests if the onestring is equivalent to a onestring_view, ignoring
+	 * case.
+	 * \param the onestring_view to compare against
+	 * \return true if the strings have the same case folding, else false */
+	bool equals_icase(const onestring_view& ostr) const
+	{
+		return compare_icase(ostr) == 0;
+	}
+
+	/** Tests if the onestring is equivalent to another onestring, ignoring
+	 * case.
+	 * \param the onestring to compare against
+	 * \return true if the strings have the same case folding, else false */
+	bool equals_icase(const onestring& ostr) const
+	{
+		// At the same length, compare any leading ASCII byte by byte.
+		size_t index = 0;
+		if (this->_elements == ostr._elements) {
+			for (; index < this->_elements; ++index) {
+				const onechar& lhs = this->internal[index];
+				const onechar& rhs = ostr.internal[index];
+				if (lhs.size != 1 || rhs.size != 1) {
+					break;
+				}
+				if (onechar::asciiLower(lhs.internal[0]) !=
+					onechar::asciiLower(rhs.internal[0])) {
+					return false;
+				}
+			}
+		}
+		return compare_folded(
+				   case_folder(this->internal + index, this->_elements - index),
+				   case_folder(ostr.internal + index, ostr._elements - index)) ==
+			   0;
+	}
+
+	/** Hashes the onestring. A onestring_view, c-string, or std::string
+	 * with the same characters has the same hash. If hash caching is
+	 * enabled, the hash is only computed again after the onestring changes.
+	 * \return the hash */
+	size_t hash() const
+	{
+		if (this->_hash_state == hash_state::CURRENT) {
+			return this->_hash;
+		}
+		size_t result = view().hash();
+		if (this->_hash_state == hash_state::STALE) {
+			this->_hash = result;
+			this->_hash_state = hash_state::CURRENT;
+		}
+		return result;
+	}
+
+	/** Enables or disables caching the hash of the onestring, which is
+	 * worthwhile for strings that are hashed many times between changes,
+	 * such as keys that are looked up repeatedly. Copies of the onestring
+	 * cache their hashes as well.
+	 * \param true to cache the hash, false to compute it on every call */
+	void cache_hash(bool enable = true)
+	{
+		if (!enable) {
+			this->_hash_state = hash_state::UNCACHED;
+		} else if (this->_hash_state == hash_state::UNCACHED) {
+			this->_hash_state = hash_state::STALE;
+		}
+	}
+
+	/** Tests if the hash of the onestring is cached.
+	 * \return true if hash caching is enabled, else false */
+	bool hash_cached() const
+	{
+		return this->_hash_state != hash_state::UNCACHED;
+	}
+
+	/** Hashes the case folding of the onestring, so that strings which are
+	 * equal ignoring case have the same hash. Used by onestring_icase_hash.
+	 * \return the hash */
+	size_t hash_icase() const
+	{
+		// 64-bit FNV-1a over the folded code points
+		uint64_t hash = 0xCBF29CE484222325;
+		case_folder folder(this->internal, this->_elements);
+		char32_t cp = 0;
+		while (folder.next(cp)) {
+			hash = (hash ^ cp) * 0x100000001B3;
+		}
+		return static_cast<size_t>(hash);
+	}
+
 	/*******************************************
 	 * Mutators
 	 ********************************************/
@@ -790,6 +2025,48 @@ public:
 		return *this;
 	}
 
+	/** Appends characters to the end of the onestring, handling
+	 * malformed UTF-8 according to the given policy. With the TRUSTED
+	 * policy, this is identical to append(const char*).
+	 * \param the policy for malformed input
+	 * \param the c-string to append from
+	 * \param how many times to repeat the append, default 1
+	 * \return a reference to the onestring */
+	template<onestring_policy P>
+	onestring& append(const char* cstr, size_t repeat = 1)
+	{
+		if constexpr (P == onestring_policy::TRUSTED) {
+			return append(cstr, repeat);
+		} else if constexpr (P == onestring_policy::STRICT) {
+			// Check everything first, so nothing is appended on failure.
+			require_valid(cstr);
+			return append(cstr, repeat);
+		} else {
+			size_t len = strlen(cstr);
+			for (size_t a = 0; a < repeat; ++a) {
+				// Complete input must not end partway through a character.
+				if (append_complete<P>(cstr, len) < len) {
+					expand(1);
+					this->internal[_elements++].parseCodepoint(
+						REPLACEMENT_CHARACTER);
+				}
+			}
+			return *this;
+		}
+	}
+
+	/** Appends characters to the end of the onestring, handling
+	 * malformed UTF-8 according to the given policy.
+	 * \param the policy for malformed input
+	 * \param the std::string to append from
+	 * \param how many times to repeat the append, default 1
+	 * \return a reference to the onestring */
+	template<onestring_policy P>
+	onestring& append(const std::string& str, size_t repeat = 1)
+	{
+		return append<P>(str.c_str(), repeat);
+	}
+
 	/** Appends characters to the end of the onestring.
 	 * \param the std::basic_string to append from
 	 * \param how many times to repeat the append, default 1
@@ -797,12 +2074,61 @@ public:
 	template<typename T>
 	onestring& append(const std::basic_string<T>& str, size_t repeat = 1)
 	{
-		// Parse the internal c string directly.
-		append(str.c_str(), repeat);
+		if constexpr (sizeof(T) == sizeof(char16_t)) {
+			for (size_t a = 0; a < repeat; ++a) {
+				append_utf16(reinterpret_cast<const char16_t*>(str.data()),
+							 str.size());
+			}
+		} else if constexpr (sizeof(T) == sizeof(char32_t)) {
+			for (size_t a = 0; a < repeat; ++a) {
+				append_utf32(reinterpret_cast<const char32_t*>(str.data()),
+							 str.size());
+			}
+		} else {
+			// Parse the internal c string directly.
+			append(reinterpret_cast<const char*>(str.c_str()), repeat);
+		}
 		this->invalidate_c_str();
 		return *this;
 	}
 
+	/** Appends characters to the end of the onestring.
+	 * \param the UTF-16 c-string to append from
+	 * \param how many times to repeat the append, default 1
+	 * \return a reference to the onestring */
+	onestring& append(const char16_t* cstr, size_t repeat = 1)
+	{
+		size_t len = std::char_traits<char16_t>::length(cstr);
+		for (size_t a = 0; a < repeat; ++a) {
+			append_utf16(cstr, len);
+		}
+		return *this;
+	}
+
+	/** Appends characters to the end of the onestring.
+	 * \param the UTF-32 c-string to append from
+	 * \param how many times to repeat the append, default 1
+	 * \return a reference to the onestring */
+	onestring& append(const char32_t* cstr, size_t repeat = 1)
+	{
+		size_t len = std::char_traits<char32_t>::length(cstr);
+		for (size_t a = 0; a < repeat; ++a) {
+			append_utf32(cstr, len);
+		}
+		return *this;
+	}
+
+	/** Appends code points to the end of the onestring.
+	 * Surrogates and values above U+10FFFF are replaced with U+FFFD.
+	 * \param the buffer of code points to append from
+	 * \param the number of code points in the buffer
+	 * \return a reference to the onestring */
+	onestring& append_codepoints(const char32_t* buffer, size_t len)
+	{
+		append_utf32(buffer, len);
+		return *this;
+	}
+
 	/** Appends characters to the end of the onestring.
 	 * \param the onestring to append from
 	 * \param how many times to repeat the append, default 1
@@ -822,6 +2148,25 @@ public:
 		return *this;
 	}
 
+	/** Appends characters to the end of the onestring.
+	 * \param the onestring_view to append from
+	 * \param how many times to repeat the append, default 1
+	 * \return a reference to the onestring */
+	onestring& append(const onestring_view& view, size_t repeat = 1)
+	{
+		expand(view.length() * repeat);
+
+		for (size_t a = 0; a < repeat; ++a) {
+			for (size_t i = 0; i < view.length(); ++i) {
+				this->internal[_elements + i] = view[i];
+			}
+
+			_elements += view.length();
+		}
+		this->invalidate_c_str();
+		return *this;
+	}
+
 	/** Assigns a character to the onestring.
 	 * \param the char to copy
 	 * \return a reference to the onestring */
@@ -866,17 +2211,83 @@ public:
 		return *this;
 	}
 
+	/** Assigns characters to the onestring, handling malformed UTF-8
+	 * according to the given policy. With the TRUSTED policy, this is
+	 * identical to assign(const char*).
+	 * \param the policy for malformed input
+	 * \param the c-string to copy from
+	 * \return a reference to the onestring */
+	template<onestring_policy P>
+	onestring& assign(const char* cstr)
+	{
+		if constexpr (P == onestring_policy::TRUSTED) {
+			return assign(cstr);
+		} else if constexpr (P == onestring_policy::STRICT) {
+			// Check everything first, so nothing is changed on failure.
+			require_valid(cstr);
+			return assign(cstr);
+		} else {
+			clear();
+			return append<P>(cstr);
+		}
+	}
+
+	/** Assigns characters to the onestring, handling malformed UTF-8
+	 * according to the given policy.
+	 * \param the policy for malformed input
+	 * \param the std::string to copy from
+	 * \return a reference to the onestring */
+	template<onestring_policy P>
+	onestring& assign(const std::string& str)
+	{
+		return assign<P>(str.c_str());
+	}
+
 	/** Assigns characters to the onestring.
 	 * \param the std::basic_string to copy from
 	 * \return a reference to the onestring */
 	template<typename T>
 	onestring& assign(const std::basic_string<T>& str)
 	{
-		assign(str.c_str());
+		if constexpr (sizeof(T) == sizeof(char)) {
+			assign(reinterpret_cast<const char*>(str.c_str()));
+		} else {
+			clear();
+			append(str);
+		}
 		this->invalidate_c_str();
 		return *this;
 	}
 
+	/** Assigns characters to the onestring.
+	 * \param the UTF-16 c-string to copy from
+	 * \return a reference to the onestring */
+	onestring& assign(const char16_t* cstr)
+	{
+		clear();
+		return append(cstr);
+	}
+
+	/** Assigns characters to the onestring.
+	 * \param the UTF-32 c-string to copy from
+	 * \return a reference to the onestring */
+	onestring& assign(const char32_t* cstr)
+	{
+		clear();
+		return append(cstr);
+	}
+
+	/** Assigns code points to the onestring.
+	 * Surrogates and values above U+10FFFF are replaced with U+FFFD.
+	 * \param the buffer of code points to copy from
+	 * \param the number of code points in the buffer
+	 * \return a reference to the onestring */
+	onestring& assign_codepoints(const char32_t* buffer, size_t len)
+	{
+		clear();
+		return append_codepoints(buffer, len);
+	}
+
 	/** Assigns characters to the onestring.
 	 * \param the onestring to copy from
 	 * \return a reference to the onestring */
@@ -892,6 +2303,15 @@ public:
 		return *this;
 	}
 
+	/** Assigns characters to the onestring.
+	 * \param the onestring_view to copy from
+	 * \return a reference to the onestring */
+	onestring& assign(const onestring_view& view)
+	{
+		clear();
+		return append(view);
+	}
+
 	/** Clears a onestring and reallocates it back to BASE_SIZE */
 	void clear()
 	{
@@ -1398,6 +2818,11 @@ public:
 	/** Reverses the contents of the onestring in place. */
 	onestring& reverse()
 	{
+		// An empty string has no last element to swap.
+		if (this->_elements == 0) {
+			return *this;
+		}
+
 		// Create temporary storage unit
 		onechar temp;
 
@@ -1416,6 +2841,55 @@ public:
 		return *this;
 	}
 
+	/** Reverses the order of the grapheme clusters of the onestring in
+	 * place, keeping the characters of each cluster in order, so that
+	 * accents and emoji sequences stay intact. */
+	onestring& grapheme_reverse()
+	{
+		std::vector<size_t> boundaries;
+		onestring_segments clusters = graphemes();
+		for (auto it = clusters.begin(); it != clusters.end(); ++it) {
+			boundaries.push_back(it.position());
+		}
+		boundaries.push_back(this->_elements);
+
+		// Reverse every character, then put each cluster back in order.
+		reverse();
+		for (size_t i = 0; i + 1 < boundaries.size(); ++i) {
+			size_t lhe = this->_elements - boundaries[i + 1];
+			size_t rhe = this->_elements - boundaries[i] - 1;
+			while (lhe < rhe) {
+				std::swap(this->internal[lhe++], this->internal[rhe--]);
+			}
+		}
+		return *this;
+	}
+
+	/** Shortens the onestring to fit in a number of terminal columns,
+	 * removing whole grapheme clusters from the end, so that no accent or
+	 * emoji sequence is split.
+	 * \param the number of columns to fit in
+	 * \return a reference to the onestring */
+	onestring& truncate_width(size_t width)
+	{
+		onestring_view text = view();
+		size_t end = 0;
+		while (end < this->_elements) {
+			size_t next = onestring_segments::next_boundary(
+				text, end, onestring_unit::GRAPHEME);
+			size_t cluster = text.substr(end, next - end).display_width();
+			if (cluster > width) {
+				break;
+			}
+			width -= cluster;
+			end = next;
+		}
+		if (end < this->_elements) {
+			erase(end);
+		}
+		return *this;
+	}
+
 	/** Exchanges the content of this onestring with that of the given
 	 * std::basic_string.
 	 * \param the std::basic_string to swap with
@@ -1460,62 +2934,115 @@ public:
 	 */
 	static void swap(onestring& lhs, onestring& rhs) { lhs.swap(rhs); }
 
-	/** Convert the all characters of a onstring to lower case.
-	 * \param the onestring to convert to upper case.
-	 */
-	onestring& to_lower()
+	/** Converts every character of the onestring to lowercase, using the
+	 * full Unicode mappings. A capital sigma at the end of a word becomes
+	 * a final sigma.
+	 * \return a reference to the onestring */
+	onestring& to_lower() { return map_case<case_mapping::LOWER>(); }
+
+	/** Converts every character of the onestring to uppercase, using the
+	 * full Unicode mappings, so "ß" becomes "SS".
+	 * \return a reference to the onestring */
+	onestring& to_upper() { return map_case<case_mapping::UPPER>(); }
+
+	/** Case folds every character of the onestring, using the full Unicode
+	 * case folding, so that strings which differ only by case become equal.
+	 * For example, "Straße" and "STRASSE" both fold to "strasse".
+	 * \return a reference to the onestring */
+	onestring& fold_case() { return map_case<case_mapping::FOLD>(); }
+
+	/** Converts the onestring to a Unicode normalization form. Text that is
+	 * already in the form is confirmed in one pass, without allocating.
+	 * Otherwise, only the characters from the last one that cannot be
+	 * affected are rebuilt.
+	 * \param the normalization form, default NFC
+	 * \return a reference to the onestring */
+	onestring& normalize(onestring_form form = onestring_form::NFC)
 	{
-		/** std::locale is used as predicate that perform string collation with
-		 * the standard containers and can be accessed directly to obtain or
-		 * modify the facets they hold.
-		 */
-		std::locale loc;
+		size_t first;
+		if (quick_check(form, first) == quick_check_result::YES) {
+			return *this;
+		}
 
-		for (size_t i = 0; i < this->_elements; ++i) {
-			this->internal[i] = std::tolower(this->c_str()[i], loc);
+		// Back up to a character that nothing before it can affect.
+		size_t start = first;
+		while (start > 0) {
+			--start;
+			if (is_stable(start, form)) {
+				break;
+			}
 		}
 
-		this->invalidate_c_str();
+		bool compatibility =
+			(form == onestring_form::NFKC || form == onestring_form::NFKD);
+		std::u32string buffer;
+		buffer.reserve(this->_elements - start);
+		for (size_t i = start; i < this->_elements; ++i) {
+			decompose(this->internal[i].codepoint(), compatibility, buffer);
+		}
+		reorder(buffer);
+		if (form == onestring_form::NFC || form == onestring_form::NFKC) {
+			compose(buffer);
+		}
 
+		this->_elements = start;
+		append_utf32(buffer.data(), buffer.size());
 		return *this;
 	}
 
-	/** Convert the all characters of a onstring to upper case.
-	 * \param the onestring to convert to upper case.
-	 */
-	onestring& to_upper()
+	/** Tests whether the onestring is in a Unicode normalization form.
+	 * \param the normalization form, default NFC
+	 * \return true if it is in the form, else false */
+	bool is_normalized(onestring_form form = onestring_form::NFC) const
 	{
-		/** std::locale is used as predicate that perform string collation with
-		 * the standard containers and can be accessed directly to obtain or
-		 * modify the facets they hold.
-		 */
-		std::locale loc;
-
-		for (size_t i = 0; i < this->_elements; ++i) {
-			this->internal[i] = std::toupper(this->c_str()[i], loc);
+		size_t first;
+		quick_check_result result = quick_check(form, first);
+		if (result != quick_check_result::MAYBE) {
+			return result == quick_check_result::YES;
 		}
 
-		this->invalidate_c_str();
-
-		return *this;
+		onestring normalized(*this);
+		return normalized.normalize(form) == *this;
 	}
 
 	/*********************************************
 	 * Finders
 	 ********************************************/
 
-	int find(const std::string& str, size_t pos = 0)
+	int find(const std::string& str, size_t pos = 0) const
 	{
-		onestring rhs = str;
+		return this->find(std::string_view(str), pos);
+	}
 
-		return this->find(rhs, pos);
+	int find(const char* cstr, size_t pos = 0) const
+	{
+		return this->find(std::string_view(cstr), pos);
 	}
 
-	int find(const char* cstr, size_t pos = 0)
+	/** Searches for string for the first occurrence of the sequence specified
+	 * by its arguments, reading it in place without allocating
+	 * unless it is longer than onestring_search::STACK_NEEDLE characters.
+	 * \param str UTF-8 string to search for.
+	 * \param pos position of the first character in the string to be considered
+	 * in the search
+	 */
+	int find(std::string_view str, size_t pos = 0) const
 	{
-		onestring rhs = cstr;
+		// if pos is greater than the onestring length throws error
+		if (pos >= this->_elements) {
+			throw std::out_of_range(
+				"Onestring::find(): specified pos out of range");
+		}
 
-		return this->find(rhs, pos);
+		size_t found = onestring_search::find(this->internal + pos,
+											  this->_elements - pos,
+											  str.data(),
+											  str.size());
+		// returns -1 when no match
+		if (found == onestring_search::npos) {
+			return -1;
+		}
+		return static_cast<int>(pos + found);
 	}
 
 	/** Searches for string for the first occurrence of the sequence specified
@@ -1524,7 +3051,18 @@ public:
 	 * \param pos position of the first character in the string to be considered
 	 * in the search
 	 */
-	int find(onestring str, size_t pos = 0)
+	int find(const onestring& str, size_t pos = 0) const
+	{
+		return this->find(str.view(), pos);
+	}
+
+	/** Searches for string for the first occurrence of the sequence specified
+	 * by its arguments.
+	 * \param str view of the characters to search for.
+	 * \param pos position of the first character in the string to be considered
+	 * in the search
+	 */
+	int find(const onestring_view& str, size_t pos = 0) const
 	{
 		// if pos is greater than the onestring length throws error
 		if (pos >= this->_elements) {
@@ -1532,147 +3070,211 @@ public:
 				"Onestring::find(): specified pos out of range");
 		}
 
-		size_t matches = 0;
+		size_t found = onestring_search::find(this->internal + pos,
+											  this->_elements - pos,
+											  str.data(),
+											  str.length());
+		// returns -1 when no match
+		if (found == onestring_search::npos) {
+			return -1;
+		}
+		// returns position of the first character of the first match
+		return static_cast<int>(pos + found);
+	}
 
-		// checks onestring chars one by one
-		for (size_t i = pos; i < this->_elements; ++i) {
-			// checks if contains onechars from str, when no match it breaks the loop
-			for (size_t j = 0; j < str.length(); ++j) {
-				if (this->internal[i + j] == str.internal[j]) {
-					matches++;
-				} else {
-					break;
-				}
-			}
+	int find(char ch, size_t pos = 0) const
+	{
+		return this->find(onechar(ch), pos);
+	}
 
-			if (matches == str._elements) {
-				// returns position of the first character of the first match
-				return static_cast<int>(i);
-			}
+	/** Searches the string for the first occurrence of a character.
+	 * \param ochr character to search for.
+	 * \param pos position of the first character in the string to be considered
+	 * in the search
+	 */
+	int find(const onechar& ochr, size_t pos = 0) const
+	{
+		// if pos is greater than the onestring length throws error
+		if (pos >= this->_elements) {
+			throw std::out_of_range(
+				"Onestring::find(): specified pos out of range");
 		}
 
+		size_t found = onestring_search::find(this->internal + pos,
+											  this->_elements - pos,
+											  ochr);
 		// returns -1 when no match
-		return -1;
+		if (found == onestring_search::npos) {
+			return -1;
+		}
+		return static_cast<int>(pos + found);
 	}
 
-	/** Overload functions to convert str::string or char to a new Onestring
-	 * for later comparison in function
-	 */
+	int find_first_not_of(const std::string& str, size_t pos = 0) const
+	{
+		onestring_charset set(str.data(), str.size());
+		return this->find_first_not_of(set, pos);
+	}
 
-	int find_first_not_of(const std::string& str, size_t pos = 0)
+	int find_first_not_of(std::string_view str, size_t pos = 0) const
 	{
-		onestring rhs = str;
+		onestring_charset set(str.data(), str.size());
+		return this->find_first_not_of(set, pos);
+	}
 
-		return this->find_first_not_of(rhs, pos);
+	int find_first_not_of(const char* cstr, size_t pos = 0) const
+	{
+		onestring_charset set(cstr);
+		return this->find_first_not_of(set, pos);
 	}
 
-	int find_first_not_of(const char* cstr, size_t pos = 0)
+	int find_first_not_of(const onestring& str, size_t pos = 0) const
 	{
-		onestring rhs = cstr;
+		onestring_charset set(str.internal, str._elements);
+		return this->find_first_not_of(set, pos);
+	}
 
-		return this->find_first_not_of(rhs, pos);
+	int find_first_not_of(const onestring_view& str, size_t pos = 0) const
+	{
+		onestring_charset set(str.data(), str.length());
+		return this->find_first_not_of(set, pos);
 	}
 
-	/** Searches the string for the first occurrence that does not match any of
-	 * the characters specified by its arguments.
-	 * \param str string to search for.
+	/** Searches the string for the first character that is not in a set.
+	 * \param set characters to search for, which may be reused across searches.
 	 * \param pos position of the first character in the string to be considered
 	 * in the search
 	 */
-
-	int find_first_not_of(onestring str, size_t pos = 0)
+	int find_first_not_of(const onestring_charset& set, size_t pos = 0) const
 	{
-		// if the index start position is greater than the onestring length
-		// throws error
+		// if pos is greater than the onestring length throws error
 		if (pos >= this->_elements) {
 			throw std::out_of_range(
 				"Onestring::find_first_not_of(): specified pos out of range");
 		}
 
-		// iterate over the chars of the giving string one by one
-		for (size_t i = pos; i < this->_elements; ++i) {
-			// reset the matches after every comparision
-			size_t matches = 0;
-			// check if the character can be found in the string we're searching
-			for (size_t j = 0; j < str.length(); ++j) {
-				if (str.find(this->internal[i]) != -1) {
-					matches++;
-					break;
-				}
-			}
-
-			// verify the none equivalence of chars, then return the position
-			if (matches == 0) {
-				return i;
-			}
+		size_t found = set.find(this->internal + pos,
+								this->_elements - pos,
+								false);
+		// returns -1 when no character is found
+		if (found == onestring_charset::npos) {
+			return -1;
 		}
-		// returns -1 in case all characters are found
-		return -1;
+		return static_cast<int>(pos + found);
 	}
 
-	/** Overload functions to convert str::string or char to a new Onestring
-	 * for later comparison in function
-	 */
+	int find_last_not_of(const std::string& str, size_t pos = 0) const
+	{
+		onestring_charset set(str.data(), str.size());
+		return this->find_last_not_of(set, pos);
+	}
 
-	int find_last_not_of(const std::string& str, size_t pos = 0)
+	int find_last_not_of(std::string_view str, size_t pos = 0) const
 	{
-		onestring rhs = str;
-		return this->find_last_not_of(rhs, pos);
+		onestring_charset set(str.data(), str.size());
+		return this->find_last_not_of(set, pos);
 	}
 
-	int find_last_not_of(const char* cstr, size_t pos = 0)
+	int find_last_not_of(const char* cstr, size_t pos = 0) const
 	{
-		onestring rhs = cstr;
-		return this->find_last_not_of(rhs, pos);
+		onestring_charset set(cstr);
+		return this->find_last_not_of(set, pos);
 	}
 
-	/** Searches the string for the last occurrence of the sequence specified by
-	 * its arguments. \param str string to search for. \param pos position of
-	 * the last character in the string to be considered in the search
-	 */
+	int find_last_not_of(const onestring& str, size_t pos = 0) const
+	{
+		onestring_charset set(str.internal, str._elements);
+		return this->find_last_not_of(set, pos);
+	}
+
+	int find_last_not_of(const onestring_view& str, size_t pos = 0) const
+	{
+		onestring_charset set(str.data(), str.length());
+		return this->find_last_not_of(set, pos);
+	}
 
-	int find_last_not_of(onestring str, size_t pos = 0)
+	/** Searches the string for the last character that is not in a set.
+	 * \param set characters to search for, which may be reused across searches.
+	 * \param pos position of the last character in the string to be considered
+	 * in the search, or 0 to search the whole string
+	 */
+	int find_last_not_of(const onestring_charset& set, size_t pos = 0) const
 	{
-		// if the index end position is greater than the onestring length
-		// throws error
+		// if pos is greater than the onestring length throws error
 		if (pos >= this->_elements) {
 			throw std::out_of_range(
 				"Onestring::find_last_not_of(): specified pos out of range");
 		}
 
-		// iterate over the chars of the giving string one by one starting from
-		// the end the loop, the limits depending on the position value
-		for (int i = (pos == 0 ? this->_elements - 1 : pos); i >= 0; --i) {
-			// check if the character can be found in the string we're searching
-			if (str.find(this->internal[i]) == -1) {
-				return i;
-			}
+		// searches back from pos, or from the end of the string if pos is 0
+		size_t end = (pos == 0) ? this->_elements : pos + 1;
+		size_t found = set.rfind(this->internal, end, false);
+		// returns -1 when no character is found
+		if (found == onestring_charset::npos) {
+			return -1;
 		}
-		// returns -1 in case all characters are found
-		return -1;
+		return static_cast<int>(found);
 	}
 
-	int rfind(const std::string& str, size_t pos = 0)
+	int rfind(const std::string& str, size_t pos = 0) const
 	{
-		onestring rhs = str;
+		return this->rfind(std::string_view(str), pos);
+	}
 
-		return this->rfind(rhs, pos);
+	int rfind(const char* cstr, size_t pos = 0) const
+	{
+		return this->rfind(std::string_view(cstr), pos);
 	}
 
-	int rfind(const char* cstr, size_t pos = 0)
+	/** Searches for string for the last occurrence of the sequence specified
+	 * by its arguments, reading it in place without allocating
+	 * unless it is longer than onestring_search::STACK_NEEDLE characters.
+	 * \param str UTF-8 string to search for.
+	 * \param pos position of the last character in the string to be considered
+	 * as the beginning of a match, or 0 to consider the whole string.
+	 */
+	int rfind(std::string_view str, size_t pos = 0) const
 	{
-		onestring rhs = cstr;
+		// if pos is greater than the onestring length throws error
+		if (pos >= this->_elements) {
+			throw std::out_of_range(
+				"Onestring::rfind(): specified pos out of range");
+		}
 
-		return this->rfind(rhs, pos);
+		// only matches beginning at or before the last position are searched
+		size_t last = (pos == 0) ? this->_elements - 1 : pos;
+		size_t count = onestring_search::characters(str.data(), str.size());
+		size_t end = this->_elements;
+		if (count < end - last) {
+			end = last + count;
+		}
+		size_t found = onestring_search::rfind(this->internal, end,
+											   str.data(), str.size());
+		// returns -1 when no match
+		if (found == onestring_search::npos) {
+			return -1;
+		}
+		return static_cast<int>(found);
 	}
 
 	/** Searches for string for the last occurrence of the sequence specified
 	 * by its arguments.
 	 * \param str onestring to search for.
 	 * \param pos position of the last character in the string to be considered
-	 * as the beginning of a match.
+	 * as the beginning of a match, or 0 to consider the whole string.
+	 */
+	int rfind(const onestring& str, size_t pos = 0) const
+	{
+		return this->rfind(str.view(), pos);
+	}
+
+	/** Searches for string for the last occurrence of the sequence specified
+	 * by its arguments.
+	 * \param str view of the characters to search for.
+	 * \param pos position of the last character in the string to be considered
+	 * as the beginning of a match, or 0 to consider the whole string.
 	 */
-	int rfind(onestring str, size_t pos = 0)
+	int rfind(const onestring_view& str, size_t pos = 0) const
 	{
 		// if pos is greater than the onestring length throws error
 		if (pos >= this->_elements) {
@@ -1680,105 +3282,164 @@ public:
 				"Onestring::rfind(): specified pos out of range");
 		}
 
-		// checks onestring chars one by one from the end of the onestring,
-		// when the index goes below index 0 it breaks the loop
-		for (size_t i = (pos == 0 ? this->_elements - 1 : pos); i != UINT_MAX;
-			 --i) {
-			size_t j;
-			/* checks if contains onechars from str, when no match it breaks the
-			 * loop*/
-			for (j = 0; j < str.length(); ++j) {
-				if (this->internal[i + j] != str.internal[j]) {
-					break;
-				}
-			}
-			// return the last index of i when it finishes to check str
-			if (j == str._elements) {
-				return i;
-			}
-			/* checks if i arrived at the first index of onestring,then breaks
-			 * the loop to prevent negative index values stored in i */
-			if (i == 0) {
-				break;
-			}
+		// only matches beginning at or before the last position are searched
+		size_t last = (pos == 0) ? this->_elements - 1 : pos;
+		size_t end = this->_elements;
+		if (str.length() < end - last) {
+			end = last + str.length();
 		}
+		size_t found = onestring_search::rfind(this->internal, end,
+											   str.data(), str.length());
 		// returns -1 when no match
-		return -1;
+		if (found == onestring_search::npos) {
+			return -1;
+		}
+		// returns position of the first character of the last match
+		return static_cast<int>(found);
 	}
 
-	int find_first_of(const std::string& str, size_t pos = 0)
+	int rfind(char ch, size_t pos = 0) const
 	{
-		onestring rhs = str;
-		return this->find_first_of(rhs, pos);
+		return this->rfind(onechar(ch), pos);
 	}
 
-	int find_first_of(const char* cstr, size_t pos = 0)
+	/** Searches the string for the last occurrence of a character.
+	 * \param ochr character to search for.
+	 * \param pos position of the last character in the string to be considered
+	 * in the search, or 0 to search the whole string.
+	 */
+	int rfind(const onechar& ochr, size_t pos = 0) const
 	{
-		onestring rhs = cstr;
-		return this->find_first_of(rhs, pos);
+		// if pos is greater than the onestring length throws error
+		if (pos >= this->_elements) {
+			throw std::out_of_range(
+				"Onestring::rfind(): specified pos out of range");
+		}
+
+		size_t end = (pos == 0) ? this->_elements : pos + 1;
+		size_t found = onestring_search::rfind(this->internal, end, ochr);
+		// returns -1 when no match
+		if (found == onestring_search::npos) {
+			return -1;
+		}
+		return static_cast<int>(found);
 	}
 
-	/** Searches the string for the first occurrence of the sequence specified
-	 * by its arguments. \param str string to search for. \param pos position of
-	 * the first character in the string to be considered in the search
+	size_t count(char ch) const { return this->count(onechar(ch)); }
+
+	/** Counts the occurrences of a character in the string.
+	 * \param ochr character to count.
+	 * \return the number of occurrences
 	 */
+	size_t count(const onechar& ochr) const
+	{
+		return onestring_search::count(this->internal, this->_elements, ochr);
+	}
+
+	int find_first_of(const std::string& str, size_t pos = 0) const
+	{
+		onestring_charset set(str.data(), str.size());
+		return this->find_first_of(set, pos);
+	}
+
+	int find_first_of(std::string_view str, size_t pos = 0) const
+	{
+		onestring_charset set(str.data(), str.size());
+		return this->find_first_of(set, pos);
+	}
+
+	int find_first_of(const char* cstr, size_t pos = 0) const
+	{
+		onestring_charset set(cstr);
+		return this->find_first_of(set, pos);
+	}
+
+	int find_first_of(const onestring& str, size_t pos = 0) const
+	{
+		onestring_charset set(str.internal, str._elements);
+		return this->find_first_of(set, pos);
+	}
+
+	int find_first_of(const onestring_view& str, size_t pos = 0) const
+	{
+		onestring_charset set(str.data(), str.length());
+		return this->find_first_of(set, pos);
+	}
 
-	int find_first_of(onestring str, size_t pos = 0)
+	/** Searches the string for the first character that is in a set.
+	 * \param set characters to search for, which may be reused across searches.
+	 * \param pos position of the first character in the string to be considered
+	 * in the search
+	 */
+	int find_first_of(const onestring_charset& set, size_t pos = 0) const
 	{
-		// if the index start position is greater than the onestring length
-		// throws error
+		// if pos is greater than the onestring length throws error
 		if (pos >= this->_elements) {
 			throw std::out_of_range(
 				"Onestring::find_first_of(): specified pos out of range");
 		}
 
-		// iterate over the chars of the giving string one by one
-		for (size_t i = pos; i < this->_elements; ++i) {
-			// check if the character can be found in the string we're searching
-			if (str.find(this->internal[i]) != -1) {
-				return i;
-			}
+		size_t found = set.find(this->internal + pos,
+								this->_elements - pos,
+								true);
+		// returns -1 when no character is found
+		if (found == onestring_charset::npos) {
+			return -1;
 		}
-		// returns -1 in case no character matches
-		return -1;
+		return static_cast<int>(pos + found);
 	}
 
-	int find_last_of(const std::string& str, size_t pos = 0)
+	int find_last_of(const std::string& str, size_t pos = 0) const
 	{
-		onestring rhs = str;
-		return this->find_last_of(rhs, pos);
+		onestring_charset set(str.data(), str.size());
+		return this->find_last_of(set, pos);
 	}
 
-	int find_last_of(const char* cstr, size_t pos = 0)
+	int find_last_of(std::string_view str, size_t pos = 0) const
 	{
-		onestring rhs = cstr;
-		return this->find_last_of(rhs, pos);
+		onestring_charset set(str.data(), str.size());
+		return this->find_last_of(set, pos);
 	}
 
-	/** Searches the string for the last occurrence of the sequence specified
-	 * by its arguments. \param str string to search for. \param pos position of
-	 * the first character in the string to be considered in the search
-	 */
+	int find_last_of(const char* cstr, size_t pos = 0) const
+	{
+		onestring_charset set(cstr);
+		return this->find_last_of(set, pos);
+	}
+
+	int find_last_of(const onestring& str, size_t pos = 0) const
+	{
+		onestring_charset set(str.internal, str._elements);
+		return this->find_last_of(set, pos);
+	}
 
-	int find_last_of(onestring str, size_t pos = 0)
+	int find_last_of(const onestring_view& str, size_t pos = 0) const
 	{
-		// if the index start position is greater than the onestring length
-		// throws error
+		onestring_charset set(str.data(), str.length());
+		return this->find_last_of(set, pos);
+	}
+
+	/** Searches the string for the last character that is in a set.
+	 * \param set characters to search for, which may be reused across searches.
+	 * \param pos position of the last character in the string to be considered
+	 * in the search, or 0 to search the whole string
+	 */
+	int find_last_of(const onestring_charset& set, size_t pos = 0) const
+	{
+		// if pos is greater than the onestring length throws error
 		if (pos >= this->_elements) {
 			throw std::out_of_range(
 				"Onestring::find_last_of(): specified pos out of range");
 		}
 
-		// iterate over the chars of the giving string one by one, starting from
-		// the end
-		for (int i = (pos == 0 ? this->_elements - 1 : pos); i >= 0; --i) {
-			// check if the character can be found in the string we're searching
-			if (str.find(this->internal[i]) != -1) {
-				return i;
-			}
+		// searches back from pos, or from the end of the string if pos is 0
+		size_t end = (pos == 0) ? this->_elements : pos + 1;
+		size_t found = set.rfind(this->internal, end, true);
+		// returns -1 when no character is found
+		if (found == onestring_charset::npos) {
+			return -1;
 		}
-		// returns -1 in case no character matches
-		return -1;
+		return static_cast<int>(found);
 	}
 
 	/*******************************************
@@ -1806,6 +3467,18 @@ public:
 		return *this;
 	}
 
+	onestring& operator=(const char16_t* cstr)
+	{
+		assign(cstr);
+		return *this;
+	}
+
+	onestring& operator=(const char32_t* cstr)
+	{
+		assign(cstr);
+		return *this;
+	}
+
 	template<typename T>
 	onestring& operator=(const std::basic_string<T>& str)
 	{
@@ -1821,6 +3494,8 @@ public:
 	void operator+=(const char ch) { append(ch); }
 	void operator+=(const onechar& ochr) { append(ochr); }
 	void operator+=(const char* cstr) { append(cstr); }
+	void operator+=(const char16_t* cstr) { append(cstr); }
+	void operator+=(const char32_t* cstr) { append(cstr); }
 	template<typename T>
 	void operator+=(const std::basic_string<T>& str) { append(str); }
 	void operator+=(const onestring& ostr) { append(ostr); }
@@ -1892,6 +3567,8 @@ public:
 	bool operator==(const char* cstr) const { return equals(cstr); }
 	template<typename T>
 	bool operator==(const std::basic_string<T>& str) const { return equals(str); }
+	bool operator==(std::string_view str) const { return equals(str); }
+	bool operator==(const onestring_view& other) const { return equals(other); }
 	bool operator==(const onestring& ostr) const { return equals(ostr); }
 
 	friend bool operator==(const char ch, const onestring& ostr)
@@ -1911,12 +3588,22 @@ public:
 	{
 		return ostr.equals(str);
 	}
+	friend bool operator==(std::string_view str, const onestring& ostr)
+	{
+		return ostr.equals(str);
+	}
+	friend bool operator==(const onestring_view& other, const onestring& ostr)
+	{
+		return ostr.equals(other);
+	}
 
 	bool operator!=(const char ch) const { return !equals(ch); }
 	bool operator!=(const onechar& ochr) const { return !equals(ochr); }
 	bool operator!=(const char* cstr) const { return !equals(cstr); }
 	template<typename T>
 	bool operator!=(const std::basic_string<T>& str) const { return !equals(str); }
+	bool operator!=(std::string_view str) const { return !equals(str); }
+	bool operator!=(const onestring_view& other) const { return !equals(other); }
 	bool operator!=(const onestring& ostr) const { return !equals(ostr); }
 
 	friend bool operator!=(const char ch, const onestring& ostr)
@@ -1936,6 +3623,14 @@ public:
 	{
 		return !ostr.equals(str);
 	}
+	friend bool operator!=(std::string_view str, const onestring& ostr)
+	{
+		return !ostr.equals(str);
+	}
+	friend bool operator!=(const onestring_view& other, const onestring& ostr)
+	{
+		return !ostr.equals(other);
+	}
 
 	bool operator<(const char ch) const { return (compare(ch) < 0); }
 	bool operator<(const onechar& ochr) const { return (compare(ochr) < 0); }
@@ -2055,9 +3750,31 @@ public:
 	{
 		ostr.clear();
 
-		char ch;
-		while (is.get(ch) && !isspace(ch)) {
-			ostr.append(ch);
+		/* The longest UTF-8 character, padded to the eight bytes that
+		 * GCC sees append_complete() read at once, though it never does
+		 * for fewer than eight. */
+		char bytes[8];
+		while (is.get(bytes[0])) {
+			// Read the rest of the character, but only continuation bytes.
+			size_t length = onechar::evaluateLength(bytes);
+			size_t read = 1;
+			while (read < length && (is.peek() & 0xC0) == 0x80) {
+				is.get(bytes[read++]);
+			}
+
+			size_t start = ostr._elements;
+			// Pass the byte count, so that a null byte is kept as a character.
+			if (ostr.append_complete<onestring_policy::REPLACE>(bytes, read) <
+				read) {
+				// The stream cut the character off, so nothing can finish it.
+				ostr.push_back(onechar(REPLACEMENT_CHARACTER));
+			}
+			// Stop at Unicode whitespace, which is left out of the word.
+			if (ostr._elements > start &&
+				ostr.internal[start].is_whitespace()) {
+				ostr.pop_back();
+				break;
+			}
 		}
 		return is;
 	}
@@ -2069,4 +3786,52 @@ public:
 	}
 };
 
+/** Hashes onestrings, for use as the keys of unordered containers.
+ * C-strings, std::strings, std::string_views, and onestring_views hash the
+ * same as onestrings with the same characters. The hash is transparent, so
+ * C++20 containers with std::equal_to<> can look them up without making a
+ * onestring. */
+template<>
+struct std::hash<onestring>
+{
+	using is_transparent = void;
+
+	size_t operator()(const onestring& ostr) const { return ostr.hash(); }
+
+	size_t operator()(const onestring_view& view) const { return view.hash(); }
+
+	size_t operator()(const char* cstr) const
+	{
+		return static_cast<size_t>(onestring_hasher::hash(cstr, strlen(cstr)));
+	}
+
+	size_t operator()(const std::string& str) const
+	{
+		return static_cast<size_t>(
+			onestring_hasher::hash(str.data(), str.size()));
+	}
+
+	size_t operator()(std::string_view str) const
+	{
+		return static_cast<size_t>(
+			onestring_hasher::hash(str.data(), str.size()));
+	}
+};
+
+/** Hashes onestrings without regard to case, for use as the hash of an
+ * unordered container along with onestring_icase_equal. */
+struct onestring_icase_hash
+{
+	size_t operator()(const onestring& ostr) const { return ostr.hash_icase(); }
+};
+
+/** Compares onestrings for equality without regard to case. */
+struct onestring_icase_equal
+{
+	bool operator()(const onestring& lhs, const onestring& rhs) const
+	{
+		return lhs.equals_icase(rhs);
+	}
+};
+
 #endif  // ONESTRING_ONESTRING_HPP
@@ -0,0 +1,247 @@
+/** Onestring Charset
+ * Version: 1.0
+ *
+ * Onestring Charset holds a set of characters, compiled so that testing a
+ * character for membership takes a single bit test for ASCII, and a binary
+ * search for anything else.
+ *
+ * Author(s): Jason C. McDonald
+ */
+
+/* LICENSE (BSD-3-Clause)
+ * Copyright (c) 2016-2021 MousePaw Media.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * CONTRIBUTING
+ * See https://www.mousepawmedia.com/developers for information
+ * on how to contribute to our projects.
+ */
+
+#ifndef ONESTRING_ONESTRING_CHARSET_HPP
+#define ONESTRING_ONESTRING_CHARSET_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "onestring/onechar.hpp"
+
+/** A set of characters, such as the delimiters for a tokenizer. ASCII
+ * characters are held in a 128-bit map, and all others in a sorted table
+ * of code points, which is only allocated once it outgrows the set. */
+class onestring_charset
+{
+public:
+	/// The result when no character is found.
+	inline static const size_t npos = -1;
+
+	/// The most code points held in the set before the table is allocated.
+	inline static const size_t INLINE_CODEPOINTS = 16;
+
+	/** Creates an empty set. */
+	onestring_charset() : ascii{0, 0}, count(0), codepoints() {}
+
+	/** Creates a set of the characters in a c-string.
+	 * \param the c-string of characters */
+	explicit onestring_charset(const char* cstr)
+	: ascii{0, 0}, count(0), codepoints()
+	{
+		insert(cstr, strlen(cstr));
+	}
+
+	/** Creates a set of the characters in a UTF-8 string of known length,
+	 * which may contain null characters.
+	 * \param the characters
+	 * \param the number of bytes */
+	onestring_charset(const char* str, size_t len)
+	: ascii{0, 0}, count(0), codepoints()
+	{
+		insert(str, len);
+	}
+
+	/** Creates a set of the characters in a run of onechars.
+	 * \param the characters
+	 * \param the number of characters */
+	onestring_charset(const onechar* chars, size_t count)
+	: ascii{0, 0}, count(0), codepoints()
+	{
+		for (size_t i = 0; i < count; ++i) {
+			insert(chars[i]);
+		}
+	}
+
+	/** Adds a character to the set.
+	 * \param the character to add */
+	void insert(const onechar& ch)
+	{
+		if (ch.size == 1 && is_ascii(ch.internal[0])) {
+			insert_ascii(ch.internal[0]);
+		} else {
+			insert_codepoint(ch.codepoint());
+		}
+	}
+
+	/** Adds the characters in a UTF-8 string of known length to the set.
+	 * A character cut off by the end of the string is left out.
+	 * \param the characters
+	 * \param the number of bytes */
+	void insert(const char* str, size_t len)
+	{
+		size_t index = 0;
+		while (index < len) {
+			if (is_ascii(str[index])) {
+				insert_ascii(str[index++]);
+				continue;
+			}
+			size_t charLen = onechar::evaluateLength(str + index);
+			if (index + charLen > len) {
+				break;
+			}
+			insert_codepoint(onechar::evaluateCodepoint(str + index));
+			index += charLen;
+		}
+	}
+
+	/** Tests whether a character is in the set.
+	 * \param the character to test
+	 * \return true if in the set, else false */
+	bool contains(const onechar& ch) const
+	{
+		if (ch.size == 1 && is_ascii(ch.internal[0])) {
+			unsigned char byte = static_cast<unsigned char>(ch.internal[0]);
+			return (ascii[byte >> 6] >> (byte & 63)) & 1;
+		}
+		// Most sets are ASCII alone, and need no search.
+		if (count == 0) {
+			return false;
+		}
+		const char32_t* table = this->table();
+		return std::binary_search(table, table + count, ch.codepoint());
+	}
+
+	/** Tests whether the set is empty.
+	 * \return true if empty, else false */
+	bool empty() const
+	{
+		return (ascii[0] | ascii[1]) == 0 && count == 0;
+	}
+
+	/** Finds the first character that is in the set, or is not.
+	 * \param the characters to search
+	 * \param the number of characters to search
+	 * \param true to find a character in the set, false for one not in it
+	 * \return the position of the character, or npos */
+	size_t find(const onechar* chars, size_t length, bool member) const
+	{
+		for (size_t i = 0; i < length; ++i) {
+			if (contains(chars[i]) == member) {
+				return i;
+			}
+		}
+		return npos;
+	}
+
+	/** Finds the last character that is in the set, or is not.
+	 * \param the characters to search
+	 * \param the number of characters to search
+	 * \param true to find a character in the set, false for one not in it
+	 * \return the position of the character, or npos */
+	size_t rfind(const onechar* chars, size_t length, bool member) const
+	{
+		for (size_t i = length; i > 0; --i) {
+			if (contains(chars[i - 1]) == member) {
+				return i - 1;
+			}
+		}
+		return npos;
+	}
+
+private:
+	/// One bit for each ASCII character, set if it is in the set.
+	uint64_t ascii[2];
+
+	/// The number of code points in the set.
+	size_t count;
+
+	/// The code points of the other characters in the set, sorted, until
+	/// there are too many to hold here.
+	char32_t small[INLINE_CODEPOINTS];
+
+	/// The code points of the other characters in the set, sorted, once
+	/// there are too many to hold in the set itself.
+	std::vector<char32_t> codepoints;
+
+	/** Gets the sorted table of code points, wherever it is held.
+	 * \return the table */
+	const char32_t* table() const
+	{
+		return codepoints.empty() ? small : codepoints.data();
+	}
+
+	/** Tests whether a byte is an ASCII character.
+	 * \param the byte
+	 * \return true if ASCII, else false */
+	static bool is_ascii(char byte)
+	{
+		return static_cast<unsigned char>(byte) < 0x80;
+	}
+
+	/** Adds an ASCII character to the map.
+	 * \param the ASCII character */
+	void insert_ascii(char byte)
+	{
+		unsigned char bit = static_cast<unsigned char>(byte);
+		ascii[bit >> 6] |= static_cast<uint64_t>(1) << (bit & 63);
+	}
+
+	/** Adds a code point to the table, keeping it sorted and unique.
+	 * \param the code point */
+	void insert_codepoint(char32_t cp)
+	{
+		const char32_t* table = this->table();
+		size_t at = std::lower_bound(table, table + count, cp) - table;
+		if (at < count && table[at] == cp) {
+			return;
+		}
+		if (count < INLINE_CODEPOINTS) {
+			memmove(small + at + 1, small + at, (count - at) * sizeof(cp));
+			small[at] = cp;
+		} else {
+			if (codepoints.empty()) {
+				codepoints.assign(small, small + count);
+			}
+			codepoints.insert(codepoints.begin() + at, cp);
+		}
+		++count;
+	}
+};
+
+#endif  // ONESTRING_ONESTRING_CHARSET_HPP
@@ -0,0 +1,600 @@
+/** Onestring Collator
+ * Version: 1.0
+ *
+ * Onestring Collator orders Onestrings as people expect to find them sorted,
+ * by the Unicode Collation Algorithm, with tailoring for languages that sort
+ * differently. It also makes binary sort keys, which compare with memcmp().
+ *
+ * Author(s): Jason C. McDonald
+ */
+
+/* LICENSE (BSD-3-Clause)
+ * Copyright (c) 2016-2021 MousePaw Media.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * CONTRIBUTING
+ * See https://www.mousepawmedia.com/developers for information
+ * on how to contribute to our projects.
+ */
+
+#ifndef ONESTRING_ONESTRING_COLLATOR_HPP
+#define ONESTRING_ONESTRING_COLLATOR_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "onestring/onestring.hpp"
+#include "onestring/onestring_view.hpp"
+#include "onestring/unicode/collation_tables.hpp"
+#include "onestring/unicode/normalization_tables.hpp"
+
+/** The levels of difference that a onestring_collator tells apart. */
+enum class onestring_strength {
+	/// Base letters only, so that "a", "á", and "A" are equal.
+	PRIMARY = 1,
+	/// Base letters and accents, so that "a" < "á", but "a" == "A".
+	SECONDARY,
+	/// Base letters, accents, and case, so that "a" < "á" < "A".
+	TERTIARY,
+	/// As TERTIARY, and with onestring_alternate::SHIFTED, also the spaces
+	/// and punctuation that the other levels ignore.
+	QUATERNARY
+};
+
+/** How a onestring_collator weighs spaces, punctuation, and symbols. */
+enum class onestring_alternate {
+	/// They sort before letters and digits, like any other character.
+	NON_IGNORABLE,
+	/// They are ignored, except at the quaternary strength, so that
+	/// "de luge", "de-luge", and "deluge" sort together.
+	SHIFTED
+};
+
+/** Orders onestrings by the Unicode Collation Algorithm */
+class onestring_collator
+{
+private:
+	using tables = onestring_collation_tables;
+	using normalization = onestring_normalization_tables;
+
+	/// The number of bits each weight is shifted left by, so that
+	/// tailored weights can fall between those of the DUCET.
+	inline static const unsigned TAILORING_BITS = 8;
+
+	/// The bits of a weight that hold its tailored part.
+	inline static const uint32_t TAILORING_MASK = (1u << TAILORING_BITS) - 1;
+
+	/// The number of levels with weights in a collation element.
+	inline static const size_t LEVELS = 3;
+
+	/** A collation element, with its primary, secondary, and tertiary
+	 * weights shifted left by TAILORING_BITS. */
+	struct element
+	{
+		uint32_t weights[LEVELS];
+		bool variable;
+	};
+
+	/** A sequence of code points, in NFD, with tailored collation
+	 * elements. */
+	struct tailoring
+	{
+		std::u32string sequence;
+		std::vector<element> elements;
+	};
+
+	/// The levels of difference to compare.
+	onestring_strength _strength;
+
+	/// How variable collation elements are weighed.
+	onestring_alternate _alternate;
+
+	/// The tailored sequences, checked before the DUCET.
+	std::vector<tailoring> _tailorings;
+
+	/// Whether each level has tailored weights, which take three bytes in
+	/// a sort key, instead of two.
+	bool _wide[LEVELS];
+
+	/** Unpacks a collation element from the collation tables.
+	 * \param the packed collation element
+	 * \return the collation element */
+	static element unpack(uint32_t packed)
+	{
+		return element{{((packed >> 14) & 0xFFFF) << TAILORING_BITS,
+						 ((packed >> 5) & 0x1FF) << TAILORING_BITS,
+						 (packed & 0x1F) << TAILORING_BITS},
+					   (packed & tables::VARIABLE) != 0};
+	}
+
+	/** Appends a run of collation elements from EXPANSIONS.
+	 * \param the offset of the run
+	 * \param the number of collation elements
+	 * \param the collation elements to append to */
+	static void append_expansion(size_t offset,
+								 size_t count,
+								 std::vector<element>& elements)
+	{
+		for (size_t i = 0; i < count; ++i) {
+			elements.push_back(unpack(tables::EXPANSIONS[offset + i]));
+		}
+	}
+
+	/** Appends the implicit collation elements of a code point that is
+	 * not in the DUCET, which sort it by code point after everything
+	 * that is.
+	 * \param the code point
+	 * \param the collation elements to append to */
+	static void append_implicit(char32_t cp, std::vector<element>& elements)
+	{
+		const auto* begin = tables::IMPLICIT_RANGES;
+		const auto* end = begin + sizeof(tables::IMPLICIT_RANGES) /
+									  sizeof(tables::IMPLICIT_RANGES[0]);
+		// Find the last range that begins at or before the code point.
+		const auto* range = std::upper_bound(
+			begin, end, cp, [](char32_t key, const tables::implicit_range& r) {
+				return key < r.first;
+			});
+
+		uint32_t base = tables::UNASSIGNED_BASE;
+		char32_t origin = 0;
+		if (range != begin && cp <= (range - 1)->last) {
+			base = (range - 1)->base;
+			origin = (range - 1)->origin;
+		}
+
+		char32_t offset = cp - origin;
+		elements.push_back(element{{(base + (offset >> 15)) << TAILORING_BITS,
+									 0x20u << TAILORING_BITS,
+									 0x02u << TAILORING_BITS},
+								   false});
+		elements.push_back(
+			element{{((offset & 0x7FFF) | 0x8000) << TAILORING_BITS, 0, 0},
+					false});
+	}
+
+	/** Finds the first contraction that begins with a sequence.
+	 * \param the sequence, padded with zeros
+	 * \param the number of code points in the sequence
+	 * \return the contraction, or nullptr if none begins with the
+	 * sequence. If the sequence is itself a contraction, that is the one
+	 * found. */
+	static const tables::contraction* find_contraction(
+		const char32_t (&sequence)[3],
+		size_t length)
+	{
+		const auto* begin = tables::CONTRACTIONS;
+		const auto* end = begin + sizeof(tables::CONTRACTIONS) /
+									  sizeof(tables::CONTRACTIONS[0]);
+		const auto* found = std::lower_bound(
+			begin,
+			end,
+			sequence,
+			[](const tables::contraction& entry, const char32_t(&key)[3]) {
+				return std::lexicographical_compare(
+					entry.sequence, entry.sequence + 3, key, key + 3);
+			});
+		if (found == end ||
+			!std::equal(sequence, sequence + length, found->sequence)) {
+			return nullptr;
+		}
+		return found;
+	}
+
+	/** Tests whether a contraction is exactly a sequence, and not longer.
+	 * \param the contraction
+	 * \param the number of code points in the sequence
+	 * \return true if the contraction has that many code points */
+	static bool is_exact(const tables::contraction* found, size_t length)
+	{
+		return length == 3 || found->sequence[length] == 0;
+	}
+
+	/** Appends the collation elements of a code point that begins a
+	 * contraction, and of the rest of the longest contraction it begins.
+	 * Combining marks that are not part of the contraction may fall
+	 * between its code points, as in "ŀ" followed by an accent; those
+	 * that are part of it are removed from the text.
+	 * \param the text, in NFD
+	 * \param the position of the code point
+	 * \param the STAGE2 value of the code point
+	 * \param the collation elements to append to
+	 * \return the number of code points consumed from the position */
+	static size_t append_contraction(std::u32string& text,
+									 size_t pos,
+									 uint32_t value,
+									 std::vector<element>& elements)
+	{
+		char32_t sequence[3] = {text[pos], 0, 0};
+		const tables::contraction* match = nullptr;
+		size_t matched = 1;
+
+		// Find the longest contraction of consecutive code points.
+		for (size_t length = 1; length < 3 && pos + length < text.size();
+			 ++length) {
+			sequence[length] = text[pos + length];
+			const auto* found = find_contraction(sequence, length + 1);
+			if (found == nullptr) {
+				break;
+			}
+			if (is_exact(found, length + 1)) {
+				match = found;
+				matched = length + 1;
+			}
+		}
+		std::fill(sequence + matched, sequence + 3, 0);
+		size_t consumed = matched;
+
+		/* Extend it with any following combining marks that are not
+		 * blocked from it, by a mark of the same or a higher combining
+		 * class between them. */
+		uint8_t last_ccc = 0;
+		for (size_t i = pos + consumed; matched < 3 && i < text.size();) {
+			uint8_t ccc = normalization::lookup(text[i]).ccc;
+			if (ccc == 0) {
+				break;
+			}
+			if (last_ccc < ccc) {
+				sequence[matched] = text[i];
+				const auto* found = find_contraction(sequence, matched + 1);
+				if (found != nullptr && is_exact(found, matched + 1)) {
+					match = found;
+					++matched;
+					text.erase(i, 1);
+					continue;
+				}
+				sequence[matched] = 0;
+			}
+			last_ccc = ccc;
+			++i;
+		}
+
+		if (match != nullptr) {
+			append_expansion(match->offset, match->count, elements);
+		} else if ((value & tables::COUNT_MASK) == 0) {
+			append_implicit(text[pos], elements);
+		} else {
+			append_expansion(value >> tables::OFFSET_SHIFT,
+							 value & tables::COUNT_MASK,
+							 elements);
+		}
+		return consumed;
+	}
+
+	/** Appends the collation elements of the longest tailored sequence at
+	 * a position in the text, if any.
+	 * \param the text, in NFD
+	 * \param the position
+	 * \param the collation elements to append to
+	 * \return the number of code points consumed, or 0 if no tailored
+	 * sequence is there */
+	size_t append_tailoring(const std::u32string& text,
+							size_t pos,
+							std::vector<element>& elements) const
+	{
+		const tailoring* longest = nullptr;
+		for (const tailoring& entry : _tailorings) {
+			size_t length = entry.sequence.size();
+			if ((longest == nullptr || length > longest->sequence.size()) &&
+				text.compare(pos, length, entry.sequence) == 0) {
+				longest = &entry;
+			}
+		}
+		if (longest == nullptr) {
+			return 0;
+		}
+		elements.insert(
+			elements.end(), longest->elements.begin(), longest->elements.end());
+		return longest->sequence.size();
+	}
+
+	/** Converts text to NFD code points.
+	 * \param the text
+	 * \param the buffer to write the code points to */
+	static void decompose(onestring_view text, std::u32string& buffer)
+	{
+		buffer.clear();
+		bool ascii = true;
+		for (const onechar& ch : text) {
+			char32_t cp = ch.codepoint();
+			if (cp < 0x80) {
+				buffer.push_back(cp);
+			} else {
+				onestring::decompose(cp, false, buffer);
+				ascii = false;
+			}
+		}
+		// ASCII has no combining marks to reorder.
+		if (!ascii) {
+			onestring::reorder(buffer);
+		}
+	}
+
+	/** Finds the collation elements of text.
+	 * \param the text, in NFD, which may have combining marks removed
+	 * \param the collation elements to append to */
+	void collate(std::u32string& text, std::vector<element>& elements) const
+	{
+		size_t pos = 0;
+		while (pos < text.size()) {
+			if (!_tailorings.empty()) {
+				size_t consumed = append_tailoring(text, pos, elements);
+				if (consumed > 0) {
+					pos += consumed;
+					continue;
+				}
+			}
+
+			uint32_t value = tables::lookup(text[pos]);
+			if (value & tables::DIRECT) {
+				elements.push_back(unpack(value));
+				++pos;
+			} else if (value & tables::CONTRACTION) {
+				pos += append_contraction(text, pos, value, elements);
+			} else if (value == 0) {
+				append_implicit(text[pos], elements);
+				++pos;
+			} else {
+				append_expansion(value >> tables::OFFSET_SHIFT,
+								 value & tables::COUNT_MASK,
+								 elements);
+				++pos;
+			}
+		}
+	}
+
+	/** Appends a weight to a sort key, most significant byte first.
+	 * \param the sort key
+	 * \param the weight, shifted left by TAILORING_BITS
+	 * \param true to include the tailored part of the weight */
+	static void append_weight(std::string& key, uint32_t weight, bool wide)
+	{
+		key.push_back(static_cast<char>(weight >> 16));
+		key.push_back(static_cast<char>(weight >> 8));
+		if (wide) {
+			key.push_back(static_cast<char>(weight));
+		}
+	}
+
+public:
+	/** Create a collator using the DUCET.
+	 * \param the levels of difference to compare, default TERTIARY
+	 * \param how to weigh spaces, punctuation, and symbols, default
+	 * NON_IGNORABLE */
+	explicit onestring_collator(
+		onestring_strength strength = onestring_strength::TERTIARY,
+		onestring_alternate alternate = onestring_alternate::NON_IGNORABLE)
+	: _strength(strength), _alternate(alternate), _wide{false, false, false}
+	{
+	}
+
+	/** Gets the levels of difference the collator compares.
+	 * \return the strength */
+	onestring_strength strength() const { return _strength; }
+
+	/** Gets how the collator weighs spaces, punctuation, and symbols.
+	 * \return the alternate handling */
+	onestring_alternate alternate() const { return _alternate; }
+
+	/** Tailors the collator for a language, so that a sequence sorts
+	 * immediately after another, which it differs from at a given level.
+	 * Sequences tailored after the same anchor sort in the order they were
+	 * tailored. For example, Swedish sorts "ä" as a letter after "z":
+	 *     collator.tailor("z", "ä", onestring_strength::PRIMARY);
+	 * and Slovak sorts "ch" as a letter after "h":
+	 *     collator.tailor("h", "ch", onestring_strength::PRIMARY);
+	 * Sort keys made before a tailoring cannot be compared with those made
+	 * after it.
+	 * \param the sequence to sort after
+	 * \param the sequence to tailor, replacing any earlier tailoring of it
+	 * \param the level of the difference: PRIMARY, SECONDARY, or TERTIARY
+	 * If the anchor has no weight at that level, or it is QUATERNARY, this
+	 * throws invalid_argument
+	 * \return a reference to the collator */
+	onestring_collator& tailor(const onestring& anchor,
+							   const onestring& sequence,
+							   onestring_strength difference)
+	{
+		size_t level = static_cast<size_t>(difference) - 1;
+		std::u32string text;
+		decompose(sequence.view(), text);
+		if (level >= LEVELS || text.empty()) {
+			throw std::invalid_argument(
+				"Onestring_collator::tailor(): invalid tailoring");
+		}
+
+		std::u32string anchor_text;
+		decompose(anchor.view(), anchor_text);
+		std::vector<element> elements;
+		collate(anchor_text, elements);
+
+		// The tailored element is the last one with a weight at the level.
+		auto last = std::find_if(
+			elements.rbegin(), elements.rend(), [level](const element& e) {
+				return e.weights[level] != 0;
+			});
+		if (last == elements.rend()) {
+			throw std::invalid_argument(
+				"Onestring_collator::tailor(): anchor has no weight at the "
+				"given strength");
+		}
+
+		// Sort after the anchor, and after anything already tailored
+		// between it and the next weight of the DUCET.
+		uint32_t weight = last->weights[level];
+		uint32_t next = weight + 1;
+		for (const tailoring& entry : _tailorings) {
+			for (const element& e : entry.elements) {
+				if ((e.weights[level] & ~TAILORING_MASK) ==
+						(weight & ~TAILORING_MASK) &&
+					e.weights[level] >= next) {
+					next = e.weights[level] + 1;
+				}
+			}
+		}
+		if ((next & ~TAILORING_MASK) != (weight & ~TAILORING_MASK)) {
+			throw std::length_error(
+				"Onestring_collator::tailor(): too many tailorings after "
+				"one anchor");
+		}
+		last->weights[level] = next;
+		_wide[level] = true;
+
+		for (tailoring& entry : _tailorings) {
+			if (entry.sequence == text) {
+				entry.elements = std::move(elements);
+				return *this;
+			}
+		}
+		_tailorings.push_back(tailoring{std::move(text), std::move(elements)});
+		return *this;
+	}
+
+	/** Makes the sort key of text, replacing the contents of a buffer,
+	 * which may be reused for the next key. Sort keys made by the same
+	 * collator compare, as byte strings, in the order of their text, so
+	 * that key1 < key2 (or memcmp) gives the same result as compare().
+	 * \param the text
+	 * \param the buffer to write the sort key to */
+	void sort_key(onestring_view text, std::string& key) const
+	{
+		std::u32string buffer;
+		decompose(text, buffer);
+		std::vector<element> elements;
+		elements.reserve(buffer.size());
+		collate(buffer, elements);
+
+		key.clear();
+		size_t levels = std::min(static_cast<size_t>(_strength), LEVELS);
+		bool shifted = (_alternate == onestring_alternate::SHIFTED);
+		key.reserve(elements.size() * levels * 3);
+
+		for (size_t level = 0; level < levels; ++level) {
+			// Levels are separated by a weight lower than any other.
+			if (level > 0) {
+				append_weight(key, 0, _wide[level - 1]);
+			}
+			bool after_variable = false;
+			for (const element& e : elements) {
+				// Shifted elements, and marks that follow them, are
+				// ignored until the quaternary level.
+				if (shifted && e.variable) {
+					after_variable = true;
+					continue;
+				}
+				if (e.weights[0] != 0) {
+					after_variable = false;
+				} else if (after_variable) {
+					continue;
+				}
+				if (e.weights[level] != 0) {
+					append_weight(key, e.weights[level], _wide[level]);
+				}
+			}
+		}
+
+		if (_strength == onestring_strength::QUATERNARY && shifted) {
+			append_weight(key, 0, _wide[LEVELS - 1]);
+			bool after_variable = false;
+			for (const element& e : elements) {
+				if (e.variable) {
+					after_variable = true;
+					append_weight(key, e.weights[0], _wide[0]);
+				} else if (e.weights[0] != 0 ||
+						   (!after_variable &&
+							(e.weights[1] != 0 || e.weights[2] != 0))) {
+					after_variable = after_variable && e.weights[0] == 0;
+					append_weight(key, 0xFFFFu << TAILORING_BITS, _wide[0]);
+				}
+			}
+		}
+	}
+
+	/** Makes the sort key of text. Sort keys made by the same collator
+	 * compare, as byte strings, in the order of their text.
+	 * \param the text
+	 * \return the sort key */
+	std::string sort_key(onestring_view text) const
+	{
+		std::string key;
+		sort_key(text, key);
+		return key;
+	}
+
+	/** Makes the sort key of a onestring.
+	 * \param the onestring
+	 * \return the sort key */
+	std::string sort_key(const onestring& ostr) const
+	{
+		return sort_key(ostr.view());
+	}
+
+	/** Compares two texts by the collation order. To sort many strings,
+	 * it is faster to make the sort key of each once, and sort by those.
+	 * \param the first text
+	 * \param the second text
+	 * \return 0 if equal, negative if the first sorts before the second,
+	 * positive if after */
+	int compare(onestring_view lhs, onestring_view rhs) const
+	{
+		if (lhs == rhs) {
+			return 0;
+		}
+		std::string lhs_key;
+		std::string rhs_key;
+		sort_key(lhs, lhs_key);
+		sort_key(rhs, rhs_key);
+		return lhs_key.compare(rhs_key);
+	}
+
+	/** Compares two onestrings by the collation order.
+	 * \param the first onestring
+	 * \param the second onestring
+	 * \return 0 if equal, negative if the first sorts before the second,
+	 * positive if after */
+	int compare(const onestring& lhs, const onestring& rhs) const
+	{
+		return compare(lhs.view(), rhs.view());
+	}
+
+	/** Tests whether one onestring sorts before another, so that the
+	 * collator can be used with std::sort() and std::map.
+	 * \param the first onestring
+	 * \param the second onestring
+	 * \return true if the first sorts before the second, else false */
+	bool operator()(const onestring& lhs, const onestring& rhs) const
+	{
+		return compare(lhs, rhs) < 0;
+	}
+};
+
+#endif  // ONESTRING_ONESTRING_COLLATOR_HPP
@@ -0,0 +1,186 @@
+/** Onestring Decoder
+ * Version: 1.0
+ *
+ * Onestring Decoder incrementally parses UTF-8 data that arrives in chunks,
+ * such as from a socket or pipe, into a Onestring. Multibyte characters
+ * split across two chunks are held until they are complete.
+ *
+ * Author(s): Jason C. McDonald
+ */
+
+/* LICENSE (BSD-3-Clause)
+ * Copyright (c) 2016-2021 MousePaw Media.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * CONTRIBUTING
+ * See https://www.mousepawmedia.com/developers for information
+ * on how to contribute to our projects.
+ */
+
+#ifndef ONESTRING_ONESTRING_DECODER_HPP
+#define ONESTRING_ONESTRING_DECODER_HPP
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include "onestring/onestring.hpp"
+
+/** Incrementally decodes chunked UTF-8 data into a onestring */
+class onestring_decoder
+{
+public:
+	/// The most bytes of an incomplete character that can be held.
+	inline static const size_t MAX_PENDING = 3;
+
+private:
+	/// The leading bytes of a character cut off by the end of a chunk.
+	char _pending[MAX_PENDING + 1];
+
+	/// The number of bytes currently held in _pending.
+	size_t _pending_size;
+
+	/** Decodes a chunk of UTF-8 data, as decode() does, but without
+	 * undoing anything if the STRICT policy throws.
+	 * \param the policy for malformed input
+	 * \param the chunk to decode
+	 * \param the number of bytes in the chunk
+	 * \param the onestring to append to
+	 * \return the number of characters appended */
+	template<onestring_policy P>
+	size_t decode_chunk(const char* chunk, size_t len, onestring& ostr)
+	{
+		size_t start = ostr.length();
+		size_t index = 0;
+
+		// Complete the character held over from the previous chunk.
+		if (_pending_size > 0) {
+			/* Join the held bytes with enough of this chunk to finish
+			 * the character, and parse them together. */
+			char joined[MAX_PENDING * 2];
+			size_t take = (len < MAX_PENDING) ? len : MAX_PENDING;
+			memcpy(joined, _pending, _pending_size);
+			memcpy(joined + _pending_size, chunk, take);
+
+			size_t consumed =
+				ostr.append_complete<P>(joined, _pending_size + take);
+
+			// If the chunk was too short to finish the character, wait.
+			if (consumed < _pending_size) {
+				memcpy(_pending, joined, _pending_size + take);
+				_pending_size += take;
+				return ostr.length() - start;
+			}
+
+			index = consumed - _pending_size;
+			_pending_size = 0;
+		}
+
+		index += ostr.append_complete<P>(chunk + index, len - index);
+
+		// Hold the leading bytes of a character cut off by the chunk end.
+		_pending_size = len - index;
+		memcpy(_pending, chunk + index, _pending_size);
+
+		return ostr.length() - start;
+	}
+
+public:
+	/** Initialize a decoder with no pending bytes */
+	onestring_decoder() : _pending{'\0', '\0', '\0', '\0'}, _pending_size(0)
+	{
+	}
+
+	/** Destructor */
+	~onestring_decoder() = default;
+
+	/** Decodes a chunk of UTF-8 data, appending every complete character
+	 * to the onestring. A character cut off by the end of the chunk is
+	 * held and completed by the start of the next chunk. Null bytes are
+	 * stored as characters, not treated as terminators.
+	 *
+	 * If the STRICT policy throws invalid_argument, neither the onestring
+	 * nor the decoder is changed, and the bytes held from the previous
+	 * chunk are still held.
+	 * \param the policy for malformed input, default TRUSTED
+	 * \param the chunk to decode
+	 * \param the number of bytes in the chunk
+	 * \param the onestring to append to
+	 * \return the number of characters appended */
+	template<onestring_policy P = onestring_policy::TRUSTED>
+	size_t decode(const char* chunk, size_t len, onestring& ostr)
+	{
+		if constexpr (P == onestring_policy::STRICT) {
+			size_t start = ostr._elements;
+			char pending[MAX_PENDING + 1];
+			size_t pending_size = _pending_size;
+			memcpy(pending, _pending, sizeof(pending));
+			try {
+				return decode_chunk<P>(chunk, len, ostr);
+			} catch (const std::invalid_argument&) {
+				// Undo the characters appended before the malformed one.
+				ostr._elements = start;
+				ostr.invalidate_c_str();
+				memcpy(_pending, pending, sizeof(pending));
+				_pending_size = pending_size;
+				throw;
+			}
+		}
+		return decode_chunk<P>(chunk, len, ostr);
+	}
+
+	/** Decodes a chunk of UTF-8 data, appending every complete character
+	 * to the onestring.
+	 * \param the policy for malformed input, default TRUSTED
+	 * \param the std::string holding the chunk to decode
+	 * \param the onestring to append to
+	 * \return the number of characters appended */
+	template<onestring_policy P = onestring_policy::TRUSTED>
+	size_t decode(const std::string& chunk, onestring& ostr)
+	{
+		return decode<P>(chunk.data(), chunk.size(), ostr);
+	}
+
+	/** Ends the current stream, discarding any incomplete character
+	 * still held. The decoder is then ready for a new stream.
+	 * \return the number of bytes in the discarded partial character,
+	 * or 0 if the stream ended on a character boundary */
+	size_t flush()
+	{
+		size_t dangling = _pending_size;
+		_pending_size = 0;
+		return dangling;
+	}
+
+	/** Gets the number of bytes held from an incomplete character.
+	 * \return the number of pending bytes */
+	size_t pending() const { return _pending_size; }
+};
+
+#endif  // ONESTRING_ONESTRING_DECODER_HPP
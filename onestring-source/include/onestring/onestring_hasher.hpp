@@ -0,0 +1,279 @@
+/** Onestring Hasher
+ * Version: 1.0
+ *
+ * Onestring Hasher computes a fast 64-bit hash of UTF-8 text. The text may
+ * arrive as contiguous bytes or one character at a time, and hashes the
+ * same either way, so onestrings, views, and c-strings with equal contents
+ * have equal hashes.
+ *
+ * Author(s): Jason C. McDonald
+ */
+
+/* LICENSE (BSD-3-Clause)
+ * Copyright (c) 2016-2021 MousePaw Media.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * CONTRIBUTING
+ * See https://www.mousepawmedia.com/developers for information
+ * on how to contribute to our projects.
+ */
+
+#ifndef ONESTRING_ONESTRING_HASHER_HPP
+#define ONESTRING_ONESTRING_HASHER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/** Hashes a stream of UTF-8 bytes, in the manner of wyhash.
+ * The bytes are gathered into 16-byte blocks, each of which is mixed into
+ * the state with a single 64x64-bit multiplication. */
+class onestring_hasher
+{
+private:
+	/// Constants for mixing, which are odd and have balanced bits.
+	inline static const uint64_t SECRET[4] = {0xA0761D6478BD642F,
+											  0xE7037ED1A0B428DB,
+											  0x8EBC6AF09C88C6E3,
+											  0x589965CC75374CC3};
+
+	/// The mixed state of every complete block.
+	uint64_t state;
+
+	/// The total number of bytes hashed.
+	uint64_t length;
+
+	/// The first word of the current block, if it is complete.
+	uint64_t first;
+
+	/// Whether the first word of the current block is complete.
+	bool half;
+
+	/// The bytes of the current word, little-endian.
+	uint64_t pending;
+
+	/// The number of bytes in the current word.
+	size_t pending_bytes;
+
+	/** Multiplies two words and folds the 128-bit product.
+	 * \param the first word
+	 * \param the second word
+	 * \return the high and low halves of the product, XORed */
+	static uint64_t mix(uint64_t lhs, uint64_t rhs)
+	{
+#if defined(__SIZEOF_INT128__)
+		__uint128_t product = static_cast<__uint128_t>(lhs) * rhs;
+		return static_cast<uint64_t>(product) ^
+			   static_cast<uint64_t>(product >> 64);
+#else
+		uint64_t lhs_hi = lhs >> 32, lhs_lo = static_cast<uint32_t>(lhs);
+		uint64_t rhs_hi = rhs >> 32, rhs_lo = static_cast<uint32_t>(rhs);
+		uint64_t hi_hi = lhs_hi * rhs_hi, hi_lo = lhs_hi * rhs_lo;
+		uint64_t lo_hi = lhs_lo * rhs_hi, lo_lo = lhs_lo * rhs_lo;
+		uint64_t middle = (lo_lo >> 32) + static_cast<uint32_t>(hi_lo) +
+						  static_cast<uint32_t>(lo_hi);
+		uint64_t low = (middle << 32) | static_cast<uint32_t>(lo_lo);
+		uint64_t high =
+			hi_hi + (hi_lo >> 32) + (lo_hi >> 32) + (middle >> 32);
+		return low ^ high;
+#endif
+	}
+
+	/** Reads eight bytes as a little-endian word.
+	 * \param the first of the eight bytes
+	 * \return the word */
+	static uint64_t read64(const char* bytes)
+	{
+		uint64_t word;
+		memcpy(&word, bytes, sizeof(word));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+		word = __builtin_bswap64(word);
+#endif
+		return word;
+	}
+
+	/** Reads four bytes as a little-endian word.
+	 * \param the first of the four bytes
+	 * \return the word */
+	static uint32_t read32(const char* bytes)
+	{
+		uint32_t word;
+		memcpy(&word, bytes, sizeof(word));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+		word = __builtin_bswap32(word);
+#endif
+		return word;
+	}
+
+	/** Reads up to eight bytes as a little-endian word, without reading
+	 * past them. Overlapping fixed-size reads avoid a variable-length copy.
+	 * \param the first of the bytes
+	 * \param the number of bytes to read, from 0 to 8
+	 * \return the word, with any unread high bytes zeroed */
+	static uint64_t read_tail(const char* bytes, size_t count)
+	{
+		if (count >= 4) {
+			uint64_t low = read32(bytes);
+			uint64_t high = read32(bytes + count - 4);
+			return low | (high << ((count - 4) * 8));
+		} else if (count > 0) {
+			const unsigned char* ubytes =
+				reinterpret_cast<const unsigned char*>(bytes);
+			return static_cast<uint64_t>(ubytes[0]) |
+				   static_cast<uint64_t>(ubytes[count / 2]) << (count / 2 * 8) |
+				   static_cast<uint64_t>(ubytes[count - 1]) << ((count - 1) * 8);
+		}
+		return 0;
+	}
+
+	/** Mixes a complete block into the state.
+	 * \param the first eight bytes of the block
+	 * \param the last eight bytes of the block */
+	void mix_block(uint64_t lhs, uint64_t rhs)
+	{
+		this->state = mix(lhs ^ SECRET[1], rhs ^ this->state);
+	}
+
+	/** Adds a complete word to the current block.
+	 * \param the word */
+	void push_word(uint64_t word)
+	{
+		if (this->half) {
+			mix_block(this->first, word);
+		} else {
+			this->first = word;
+		}
+		this->half = !this->half;
+	}
+
+	/** Adds up to eight bytes to the current word.
+	 * \param the bytes, as a little-endian word with unused bytes zeroed
+	 * \param the number of bytes, from 0 to 8 */
+	void push_bytes(uint64_t bytes, size_t count)
+	{
+		this->pending |= bytes << (this->pending_bytes * 8);
+		this->pending_bytes += count;
+		if (this->pending_bytes >= 8) {
+			push_word(this->pending);
+			this->pending_bytes -= 8;
+			// Any bytes that did not fit start the next word.
+			size_t used = count - this->pending_bytes;
+			this->pending = (used < 8) ? bytes >> (used * 8) : 0;
+		}
+	}
+
+public:
+	/** Creates a hasher.
+	 * \param the seed, which changes every hash */
+	explicit onestring_hasher(uint64_t seed = 0)
+	: state(seed ^ SECRET[0]), length(0), first(0), half(false), pending(0),
+	  pending_bytes(0)
+	{
+	}
+
+	/** Adds one character to the hash.
+	 * The character may be up to four bytes, but four bytes must always
+	 * be readable from the pointer; bytes after the character are ignored.
+	 * \param the bytes of the character
+	 * \param the number of bytes in the character, from 0 to 4 */
+	void append_char(const char* bytes, size_t size)
+	{
+		this->length += size;
+		uint64_t mask = UINT64_C(0xFFFFFFFF) >> (32 - size * 8);
+		push_bytes(read32(bytes) & mask, size);
+	}
+
+	/** Adds contiguous bytes to the hash.
+	 * \param the bytes
+	 * \param the number of bytes */
+	void append(const char* bytes, size_t len)
+	{
+		this->length += len;
+		// Fill out a partial word...
+		if (this->pending_bytes != 0) {
+			size_t count = 8 - this->pending_bytes;
+			count = (len < count) ? len : count;
+			push_bytes(read_tail(bytes, count), count);
+			bytes += count;
+			len -= count;
+			if (this->pending_bytes != 0) {
+				return;
+			}
+		}
+		// ...and a partial block...
+		if (this->half && len >= 8) {
+			push_word(read64(bytes));
+			bytes += 8;
+			len -= 8;
+		}
+		// ...then mix whole blocks straight from the bytes...
+		if (!this->half) {
+			while (len >= 16) {
+				mix_block(read64(bytes), read64(bytes + 8));
+				bytes += 16;
+				len -= 16;
+			}
+		}
+		// ...and keep the rest for the next call.
+		if (len >= 8) {
+			push_word(read64(bytes));
+			bytes += 8;
+			len -= 8;
+		}
+		this->pending = read_tail(bytes, len);
+		this->pending_bytes = len;
+	}
+
+	/** Finishes the hash.
+	 * The hasher should not be used after this.
+	 * \return the hash */
+	uint64_t finish()
+	{
+		// Mix in any partial block, padded with zeroes.
+		if (this->half) {
+			mix_block(this->first, this->pending);
+		} else if (this->pending_bytes != 0) {
+			mix_block(this->pending, 0);
+		}
+		return mix(this->state ^ SECRET[2], this->length ^ SECRET[3]);
+	}
+
+	/** Hashes contiguous bytes.
+	 * \param the bytes
+	 * \param the number of bytes
+	 * \return the hash */
+	static uint64_t hash(const char* bytes, size_t len)
+	{
+		onestring_hasher hasher;
+		hasher.append(bytes, len);
+		return hasher.finish();
+	}
+};
+
+#endif  // ONESTRING_ONESTRING_HASHER_HPP
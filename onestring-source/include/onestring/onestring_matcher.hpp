@@ -0,0 +1,408 @@
+/** Onestring Matcher
+ * Version: 1.0
+ *
+ * Onestring Matcher finds every occurrence of many patterns at once, in a
+ * single pass over the text, by the Aho-Corasick algorithm.
+ *
+ * Author(s): Jason C. McDonald
+ */
+
+/* LICENSE (BSD-3-Clause)
+ * Copyright (c) 2016-2021 MousePaw Media.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * CONTRIBUTING
+ * See https://www.mousepawmedia.com/developers for information
+ * on how to contribute to our projects.
+ */
+
+#ifndef ONESTRING_ONESTRING_MATCHER_HPP
+#define ONESTRING_ONESTRING_MATCHER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "onestring/onestring.hpp"
+#include "onestring/onestring_view.hpp"
+
+/** Finds every occurrence of a fixed list of patterns in a text, in one
+ * pass, by an Aho-Corasick automaton over the UTF-8 bytes of the patterns.
+ * The transitions of the automaton are held in a double array, where the
+ * transition from a state on a byte is at the state's base plus the byte,
+ * and belongs to the state if its check says so. */
+class onestring_matcher
+{
+public:
+	/** An occurrence of a pattern in a text. */
+	struct match
+	{
+		/// The position of the first character of the occurrence.
+		size_t position;
+
+		/// The number of characters in the occurrence.
+		size_t length;
+
+		/// The index of the pattern in the list it was built from.
+		size_t pattern;
+
+		bool operator==(const match& other) const
+		{
+			return position == other.position && length == other.length &&
+				   pattern == other.pattern;
+		}
+	};
+
+private:
+	/// The root of the automaton, where every search begins.
+	inline static const uint32_t ROOT = 0;
+
+	/// Marks a slot of the double array that no state owns, or the lack
+	/// of a state or pattern.
+	inline static const uint32_t NONE = UINT32_MAX;
+
+	/// Whether patterns and text are compared with their case folded.
+	bool _fold_case;
+
+	/// The base of each state, from which its transitions are found.
+	std::vector<uint32_t> _base;
+
+	/// The state that owns each transition, or NONE.
+	std::vector<uint32_t> _check;
+
+	/// The state to fall back to when a state has no transition on a byte.
+	std::vector<uint32_t> _fail;
+
+	/// The first pattern that ends at each state, or NONE.
+	std::vector<uint32_t> _output;
+
+	/// The nearest state along the failure links with a pattern ending at
+	/// it, or NONE.
+	std::vector<uint32_t> _report;
+
+	/// The transition from the root on each byte, which always exists.
+	uint32_t _root_next[256];
+
+	/// The number of characters in each pattern.
+	std::vector<size_t> _lengths;
+
+	/// The next pattern with the same text as each, or NONE.
+	std::vector<uint32_t> _same_text;
+
+	/** A node of the trie the automaton is built from. */
+	struct node
+	{
+		/// The byte and node of each child, in the order of the bytes.
+		std::vector<std::pair<unsigned char, size_t>> children;
+
+		/// The first pattern that ends at the node, or NONE.
+		uint32_t pattern = NONE;
+	};
+
+	/** Appends the bytes of a character, with its case folded if need be.
+	 * \param the character
+	 * \param the bytes to append to */
+	void append_bytes(const onechar& ch,
+					  std::vector<unsigned char>& bytes) const
+	{
+		onechar folded = fold(ch);
+		for (size_t i = 0; i < folded.size; ++i) {
+			bytes.push_back(static_cast<unsigned char>(folded.internal[i]));
+		}
+	}
+
+	/** Folds the case of a character, if the matcher folds case, by its
+	 * simple case folding, so that it stays one character.
+	 * \param the character
+	 * \return the character, folded if need be */
+	onechar fold(const onechar& ch) const
+	{
+		if (!_fold_case) {
+			return ch;
+		}
+		if (ch.size == 1) {
+			return onechar(onechar::asciiLower(ch.internal[0]));
+		}
+		return onechar(onechar::simpleFold(ch.codepoint()));
+	}
+
+	/** Finds the transition from a state on a byte.
+	 * \param the state
+	 * \param the byte
+	 * \return the next state, or NONE */
+	uint32_t next(uint32_t state, unsigned char byte) const
+	{
+		size_t slot = static_cast<size_t>(_base[state]) + byte + 1;
+		if (slot < _check.size() && _check[slot] == state) {
+			return static_cast<uint32_t>(slot);
+		}
+		return NONE;
+	}
+
+	/** Builds the trie of the patterns.
+	 * \param the patterns
+	 * \return the nodes of the trie, with the root first */
+	std::vector<node> build_trie(const std::vector<onestring>& patterns)
+	{
+		std::vector<node> trie(1);
+		std::vector<uint32_t> last_same;
+		std::vector<unsigned char> bytes;
+		for (size_t id = 0; id < patterns.size(); ++id) {
+			const onestring& pattern = patterns[id];
+			if (pattern.empty()) {
+				throw std::invalid_argument(
+					"Onestring_matcher(): patterns cannot be empty");
+			}
+			bytes.clear();
+			for (size_t i = 0; i < pattern.length(); ++i) {
+				append_bytes(pattern[i], bytes);
+			}
+
+			size_t at = 0;
+			for (unsigned char byte : bytes) {
+				auto& children = trie[at].children;
+				auto child = children.begin();
+				while (child != children.end() && child->first < byte) {
+					++child;
+				}
+				if (child == children.end() || child->first != byte) {
+					child = children.insert(child, {byte, trie.size()});
+					trie.emplace_back();
+				}
+				at = child->second;
+			}
+
+			_lengths.push_back(pattern.length());
+			_same_text.push_back(NONE);
+			last_same.push_back(NONE);
+			// Patterns with the same text are reported in the given order.
+			uint32_t head = trie[at].pattern;
+			if (head == NONE) {
+				trie[at].pattern = static_cast<uint32_t>(id);
+				last_same[id] = static_cast<uint32_t>(id);
+			} else {
+				_same_text[last_same[head]] = static_cast<uint32_t>(id);
+				last_same[head] = static_cast<uint32_t>(id);
+			}
+		}
+		return trie;
+	}
+
+	/** Places the states of the trie in the double array, breadth first.
+	 * \param the trie
+	 * \return the states, in breadth-first order */
+	std::vector<uint32_t> place(const std::vector<node>& trie)
+	{
+		_base.assign(1, 0);
+		_check.assign(1, ROOT);
+		_output.assign(1, trie[0].pattern);
+		std::vector<uint32_t> order;
+		std::vector<std::pair<size_t, uint32_t>> queue = {{0, ROOT}};
+		// Every slot before this one is known to be owned.
+		size_t first_free = 1;
+
+		for (size_t q = 0; q < queue.size(); ++q) {
+			const node& from = trie[queue[q].first];
+			uint32_t state = queue[q].second;
+			order.push_back(state);
+			if (from.children.empty()) {
+				continue;
+			}
+
+			// Find the lowest base where every child has a free slot.
+			while (first_free < _check.size() && _check[first_free] != NONE) {
+				++first_free;
+			}
+			size_t lowest = from.children[0].first + 1;
+			size_t at = (first_free > lowest) ? first_free - lowest : 0;
+			for (;; ++at) {
+				bool fits = true;
+				for (const auto& child : from.children) {
+					size_t slot = at + child.first + 1;
+					if (slot < _check.size() && _check[slot] != NONE) {
+						fits = false;
+						break;
+					}
+				}
+				if (fits) {
+					break;
+				}
+			}
+
+			_base[state] = static_cast<uint32_t>(at);
+			size_t needed = at + from.children.back().first + 2;
+			if (needed > _check.size()) {
+				_base.resize(needed, 0);
+				_check.resize(needed, NONE);
+				_output.resize(needed, NONE);
+			}
+			for (const auto& child : from.children) {
+				size_t slot = at + child.first + 1;
+				_check[slot] = state;
+				_output[slot] = trie[child.second].pattern;
+				queue.push_back({child.second, static_cast<uint32_t>(slot)});
+			}
+		}
+		return order;
+	}
+
+	/** Links each state to the state for its longest proper suffix that
+	 * is also in the automaton, in breadth-first order, so that each
+	 * state's link is known before its children need it.
+	 * \param the states, in breadth-first order */
+	void link(const std::vector<uint32_t>& order)
+	{
+		_fail.assign(_check.size(), ROOT);
+		_report.assign(_check.size(), NONE);
+		for (uint32_t state : order) {
+			for (unsigned int i = 0; i < 256; ++i) {
+				unsigned char byte = static_cast<unsigned char>(i);
+				uint32_t child = next(state, byte);
+				if (child == NONE) {
+					continue;
+				}
+				uint32_t back = ROOT;
+				if (state != ROOT) {
+					back = _fail[state];
+					while (back != ROOT && next(back, byte) == NONE) {
+						back = _fail[back];
+					}
+					uint32_t to = next(back, byte);
+					back = (to == NONE) ? ROOT : to;
+				}
+				_fail[child] = back;
+				_report[child] = (_output[back] != NONE) ? back : _report[back];
+			}
+		}
+		for (unsigned int byte = 0; byte < 256; ++byte) {
+			uint32_t to = next(ROOT, static_cast<unsigned char>(byte));
+			_root_next[byte] = (to == NONE) ? ROOT : to;
+		}
+	}
+
+public:
+	/** Builds a matcher for a list of patterns.
+	 * \param the patterns, none of which may be empty, or this throws
+	 * invalid_argument
+	 * \param whether to ignore case, by simple case folding, default
+	 * false */
+	explicit onestring_matcher(const std::vector<onestring>& patterns,
+							   bool fold_case = false)
+	: _fold_case(fold_case), _base(), _check(), _fail(), _output(), _report(),
+	  _root_next(), _lengths(), _same_text()
+	{
+		std::vector<node> trie = build_trie(patterns);
+		link(place(trie));
+	}
+
+	/** Gets the number of patterns.
+	 * \return the number of patterns */
+	size_t size() const { return _lengths.size(); }
+
+	/** Gets whether the matcher ignores case.
+	 * \return true if it folds case, else false */
+	bool folds_case() const { return _fold_case; }
+
+	/** Finds every occurrence of every pattern, overlapping or not, in one
+	 * pass, and passes each to a callback. Occurrences are found in the
+	 * order of where they end, and those that end together from the
+	 * longest to the shortest.
+	 * \param the text to search
+	 * \param the callback, which takes a const match& */
+	template<typename Callback>
+	void scan(onestring_view text, Callback&& found) const
+	{
+		uint32_t state = ROOT;
+		const onechar* chars = text.data();
+		for (size_t i = 0; i < text.length(); ++i) {
+			const onechar* ch = chars + i;
+			onechar folded;
+			if (_fold_case) {
+				folded = fold(*ch);
+				ch = &folded;
+			}
+			for (size_t b = 0; b < ch->size; ++b) {
+				auto byte = static_cast<unsigned char>(ch->internal[b]);
+				for (;;) {
+					if (state == ROOT) {
+						state = _root_next[byte];
+						break;
+					}
+					uint32_t to = next(state, byte);
+					if (to != NONE) {
+						state = to;
+						break;
+					}
+					state = _fail[state];
+				}
+			}
+
+			// Report every pattern that ends here, longest first.
+			uint32_t at = (_output[state] != NONE) ? state : _report[state];
+			for (; at != NONE; at = _report[at]) {
+				uint32_t id = _output[at];
+				for (; id != NONE; id = _same_text[id]) {
+					found(match{i + 1 - _lengths[id], _lengths[id], id});
+				}
+			}
+		}
+	}
+
+	/** Finds every occurrence of every pattern, overlapping or not, in one
+	 * pass, and passes each to a callback.
+	 * \param the text to search
+	 * \param the callback, which takes a const match& */
+	template<typename Callback>
+	void scan(const onestring& text, Callback&& found) const
+	{
+		scan(text.view(), std::forward<Callback>(found));
+	}
+
+	/** Finds every occurrence of every pattern, overlapping or not.
+	 * \param the text to search
+	 * \return the occurrences, in the order scan() finds them */
+	std::vector<match> find_all(onestring_view text) const
+	{
+		std::vector<match> matches;
+		scan(text, [&matches](const match& m) { matches.push_back(m); });
+		return matches;
+	}
+
+	/** Finds every occurrence of every pattern, overlapping or not.
+	 * \param the text to search
+	 * \return the occurrences, in the order scan() finds them */
+	std::vector<match> find_all(const onestring& text) const
+	{
+		return find_all(text.view());
+	}
+};
+
+#endif  // ONESTRING_ONESTRING_MATCHER_HPP
@@ -0,0 +1,1508 @@
+/** Onestring Regex
+ * Version: 1.0
+ *
+ * Onestring Regex matches regular expressions against onestrings, by code
+ * point, in time linear in the length of the text.
+ *
+ * Author(s): Jason C. McDonald
+ */
+
+/* LICENSE (BSD-3-Clause)
+ * Copyright (c) 2016-2021 MousePaw Media.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * CONTRIBUTING
+ * See https://www.mousepawmedia.com/developers for information
+ * on how to contribute to our projects.
+ */
+
+#ifndef ONESTRING_ONESTRING_REGEX_HPP
+#define ONESTRING_ONESTRING_REGEX_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "onestring/onechar.hpp"
+#include "onestring/onestring.hpp"
+#include "onestring/onestring_view.hpp"
+#include "onestring/unicode/property_tables.hpp"
+
+/** A regular expression, matched against the code points of a onestring
+ * without converting it to a C string. The pattern is compiled to a
+ * program for a Pike VM, which finds the leftmost match and its capture
+ * groups, preferring the earlier of two alternatives and the longer of
+ * two greedy repetitions, as Perl does. Tests that need no captures run on
+ * a DFA built from the same program as it is needed. Neither backtracks,
+ * so every search takes time linear in the length of the text, whatever
+ * the pattern.
+ *
+ * The syntax supported is:
+ * - literal characters, and `.` for any character but a line feed
+ * - `[...]` and `[^...]` classes of characters and ranges of them
+ * - `\d`, `\w` and `\s` for Unicode digits, word characters and
+ *   whitespace, and `\D`, `\W` and `\S` for everything else
+ * - `\p{..}` and `\P{..}` for a General_Category, such as `L` or `Lu`, or
+ *   the Alphabetic, Numeric or White_Space property
+ * - `\n`, `\r`, `\t`, `\f`, `\v`, `\xHH` and `\x{HHHHHH}`, and a
+ *   backslash before any other punctuation to match it literally
+ * - `^` and `$` for the start and end of the text
+ * - `(...)` capture groups, `(?:...)` groups that do not capture, and `|`
+ * - `*`, `+`, `?`, `{n}`, `{n,}` and `{n,m}`, each of which may be
+ *   followed by `?` to prefer fewer repetitions
+ *
+ * The DFA is kept in the regex, and grows as searches need it, so a regex
+ * must not be used by more than one thread at a time. Copies of a regex
+ * are independent. */
+class onestring_regex
+{
+public:
+	/// The position of a group that did not take part in a match.
+	inline static const size_t npos = -1;
+
+	/** The positions of a match, and of its capture groups, in characters
+	 * from the start of the text searched. */
+	class match
+	{
+		friend onestring_regex;
+
+	private:
+		/// The start and end of the match, then of each group, or npos.
+		std::vector<size_t> _slots;
+
+		/** Gets the start or end of a group.
+		 * \param the group, or 0 for the whole match
+		 * \param 0 for the start, or 1 for the end
+		 * \return the position, or npos */
+		size_t slot(size_t group, size_t side) const
+		{
+			if (group * 2 >= _slots.size()) {
+				throw std::out_of_range(
+					"Onestring_regex::match: no such group");
+			}
+			return _slots[group * 2 + side];
+		}
+
+	public:
+		match() : _slots() {}
+
+		/** Gets the number of capture groups in the regex that found the
+		 * match, not counting the whole match.
+		 * \return the number of groups, or 0 if nothing was found */
+		size_t groups() const
+		{
+			return _slots.empty() ? 0 : _slots.size() / 2 - 1;
+		}
+
+		/** Tests whether a group took part in the match.
+		 * \param the group, default 0 for the whole match
+		 * \return true if it took part, else false */
+		bool matched(size_t group = 0) const
+		{
+			return group * 2 < _slots.size() && _slots[group * 2] != npos;
+		}
+
+		/** Gets the position of the first character of a group. Throws
+		 * out_of_range if there is no such group.
+		 * \param the group, default 0 for the whole match
+		 * \return the position, or npos if the group took no part */
+		size_t position(size_t group = 0) const { return slot(group, 0); }
+
+		/** Gets the position just past the last character of a group.
+		 * Throws out_of_range if there is no such group.
+		 * \param the group, default 0 for the whole match
+		 * \return the position, or npos if the group took no part */
+		size_t end(size_t group = 0) const { return slot(group, 1); }
+
+		/** Gets the number of characters in a group. Throws out_of_range
+		 * if there is no such group.
+		 * \param the group, default 0 for the whole match
+		 * \return the number of characters, or 0 if the group took no
+		 * part */
+		size_t length(size_t group = 0) const
+		{
+			size_t start = slot(group, 0);
+			return (start == npos) ? 0 : slot(group, 1) - start;
+		}
+	};
+
+private:
+	/// The most instructions a compiled pattern may have.
+	inline static const size_t MAX_PROGRAM = 65536;
+
+	/// The most times a bounded repetition may repeat.
+	inline static const size_t MAX_REPEAT = 1000;
+
+	/// The most groups that may be nested inside one another.
+	inline static const size_t MAX_DEPTH = 250;
+
+	/// The most DFA states kept before the DFA is thrown away and rebuilt.
+	inline static const size_t MAX_STATES = 4096;
+
+	/// Marks the lack of an instruction, state or slot.
+	inline static const uint32_t NONE = UINT32_MAX;
+
+	/// Marks a repetition with no upper bound.
+	inline static const size_t UNBOUNDED = SIZE_MAX;
+
+	/// The two-letter name of each General_Category, in order.
+	inline static const char* CATEGORY_NAMES[] = {
+		"Lu", "Ll", "Lt", "Lm", "Lo", "Mn", "Mc", "Me", "Nd", "Nl",
+		"No", "Pc", "Pd", "Ps", "Pe", "Pi", "Pf", "Po", "Sm", "Sc",
+		"Sk", "So", "Zs", "Zl", "Zp", "Cc", "Cf", "Cs", "Co", "Cn"};
+
+	static_assert(sizeof(CATEGORY_NAMES) / sizeof(CATEGORY_NAMES[0]) ==
+					  onestring_property_tables::GENERAL_CATEGORIES,
+				  "every General_Category needs a name");
+
+	/// The categories of \d: Nd.
+	inline static const uint32_t DIGIT_CATEGORIES = 0x00000100;
+
+	/// The categories of \w, besides the Alphabetic ones: M, Nd and Pc.
+	inline static const uint32_t WORD_CATEGORIES = 0x000009E0;
+
+	/** The operations of the program. */
+	enum class opcode : uint8_t {
+		/// Consumes the code point x.
+		CHAR,
+		/// Consumes any code point but a line feed.
+		ANY,
+		/// Consumes a code point in the class x.
+		CLASS,
+		/// Continues at x, then, with lower priority, at y.
+		SPLIT,
+		/// Continues at x.
+		JUMP,
+		/// Records the position in slot x.
+		SAVE,
+		/// Continues only at the start of the text.
+		BEGIN,
+		/// Continues only at the end of the text.
+		END,
+		/// Reports a match.
+		MATCH
+	};
+
+	/** An instruction of the program. */
+	struct instruction
+	{
+		opcode op;
+		uint32_t x;
+		uint32_t y;
+	};
+
+	/** A part of a class: either a range of code points, or the code
+	 * points in some General_Categories or with some properties. */
+	struct class_item
+	{
+		char32_t low;
+		char32_t high;
+		uint32_t categories;
+		uint8_t flags;
+		bool negated;
+	};
+
+	/** A class of characters, which holds a code point if any of its items
+	 * holds it, unless it is negated. */
+	struct char_class
+	{
+		std::vector<class_item> items;
+		bool negated = false;
+
+		/// Whether the class holds each ASCII code point.
+		uint64_t ascii[2] = {0, 0};
+
+		/** Tests whether the class holds a code point, by its items.
+		 * \param the code point
+		 * \return true if the class holds it, else false */
+		bool test(char32_t cp) const
+		{
+			for (const class_item& item : items) {
+				bool hit;
+				if (item.categories == 0 && item.flags == 0) {
+					hit = (cp >= item.low && cp <= item.high);
+				} else {
+					const auto& record = onestring_property_tables::lookup(cp);
+					auto category = static_cast<unsigned>(record.category);
+					hit = ((item.categories >> category) & 1) ||
+						  (record.flags & item.flags);
+					hit = (hit != item.negated);
+				}
+				if (hit) {
+					return !negated;
+				}
+			}
+			return negated;
+		}
+
+		/** Tests whether the class holds a code point.
+		 * \param the code point
+		 * \return true if the class holds it, else false */
+		bool contains(char32_t cp) const
+		{
+			if (cp < 128) {
+				return (ascii[cp >> 6] >> (cp & 63)) & 1;
+			}
+			return test(cp);
+		}
+	};
+
+	/** The kinds of node in a parsed pattern. */
+	enum class node_kind : uint8_t {
+		LITERAL,
+		ANY,
+		CLASS,
+		BEGIN,
+		END,
+		GROUP,
+		CONCAT,
+		ALTERNATE,
+		REPEAT
+	};
+
+	/** A node of a parsed pattern. */
+	struct node
+	{
+		node_kind kind;
+
+		/// The code point, class or group of the node.
+		uint32_t value = 0;
+
+		/// The least and most times a repetition repeats.
+		size_t min = 0;
+		size_t max = 0;
+
+		/// Whether a repetition prefers to repeat more.
+		bool greedy = true;
+
+		/// The nodes inside this one.
+		std::vector<size_t> children;
+	};
+
+	/** The state of the parser. */
+	struct parse_state
+	{
+		/// The code points of the pattern.
+		std::vector<char32_t> pattern;
+
+		/// The position of the next code point to parse.
+		size_t at = 0;
+
+		/// How many groups the next code point is inside of.
+		size_t depth = 0;
+
+		/// The nodes parsed so far.
+		std::vector<node> nodes;
+
+		bool done() const { return at >= pattern.size(); }
+		char32_t peek() const { return pattern[at]; }
+	};
+
+	/** A set of instructions, in the order they were added, which can
+	 * hold a copy of the slots for each. */
+	struct thread_list
+	{
+		/// The index in dense of each instruction, if it is there.
+		std::vector<uint32_t> sparse;
+
+		/// The instructions in the set, in order.
+		std::vector<uint32_t> dense;
+
+		/// The slots of each instruction in dense, in the same order.
+		std::vector<size_t> slots;
+
+		thread_list() : sparse(), dense(), slots() {}
+
+		explicit thread_list(size_t program)
+		: sparse(program, 0), dense(), slots()
+		{
+			dense.reserve(program);
+		}
+
+		bool contains(uint32_t pc) const
+		{
+			uint32_t i = sparse[pc];
+			return i < dense.size() && dense[i] == pc;
+		}
+
+		void insert(uint32_t pc)
+		{
+			sparse[pc] = static_cast<uint32_t>(dense.size());
+			dense.push_back(pc);
+		}
+
+		void clear() { dense.clear(); }
+	};
+
+	/** A step of the Pike VM's walk through instructions that consume
+	 * nothing: either an instruction to visit, or a slot to restore. */
+	struct frame
+	{
+		uint32_t pc;
+		uint32_t slot;
+		size_t value;
+	};
+
+	/** The working memory of the Pike VM, kept between searches. */
+	struct vm_scratch
+	{
+		thread_list current;
+		thread_list next;
+		std::vector<frame> stack;
+		std::vector<size_t> seed;
+		std::vector<size_t> copy;
+	};
+
+	/** A state of the DFA: the instructions the Pike VM would have
+	 * threads at, and the states that follow on each code point, as they
+	 * become known. */
+	struct dfa_state
+	{
+		/// The instructions that consume or match, and the END assertions
+		/// that wait for the end of the text, in order.
+		std::vector<uint32_t> pcs;
+
+		/// Whether a match ends here.
+		bool match;
+
+		/// Whether a match ends here if the text does.
+		bool match_at_end;
+
+		/// The next state on each ASCII code point, or NONE.
+		uint32_t ascii[128];
+
+		/// The next state on each other code point seen so far.
+		std::unordered_map<char32_t, uint32_t> others;
+	};
+
+	/** A DFA, built as searches need its states. */
+	struct dfa
+	{
+		/// Whether a match must start where the search does. If not, a
+		/// new thread starts at every position.
+		bool anchored = false;
+
+		/// The states built so far.
+		std::vector<dfa_state> states;
+
+		/// The state for each set of instructions, apart from, then at,
+		/// the start of the text.
+		std::map<std::vector<uint32_t>, uint32_t> index[2];
+
+		/// The first state, apart from, then at, the start of the text,
+		/// or NONE.
+		uint32_t start[2] = {NONE, NONE};
+
+		/// How many times the states have been thrown away.
+		size_t generation = 0;
+
+		/// The working memory for building states.
+		thread_list set;
+		std::vector<uint32_t> stack;
+	};
+
+	/// The compiled program, which starts at its first instruction.
+	std::vector<instruction> _program;
+
+	/// The classes the program refers to.
+	std::vector<char_class> _classes;
+
+	/// The number of capture groups.
+	size_t _groups;
+
+	/// The DFA for whole matches, which starts at the start of the text.
+	mutable dfa _anchored;
+
+	/// The DFA for matches anywhere in the text.
+	mutable dfa _unanchored;
+
+	/// The working memory of the Pike VM.
+	mutable vm_scratch _vm;
+
+	/// Whether each ASCII code point can start a match.
+	uint64_t _first[2];
+
+	/// Whether any other code point can start a match.
+	bool _first_other;
+
+	/// Whether every match starts with a character in _first, so that
+	/// the Pike VM can skip to the next one.
+	bool _skip;
+
+	/** Gets the code point of a character, without decoding ASCII.
+	 * \param the character
+	 * \return the code point */
+	static char32_t code(const onechar& ch)
+	{
+		if (ch.size == 1) {
+			return static_cast<unsigned char>(ch.internal[0]);
+		}
+		return ch.codepoint();
+	}
+
+	/** Tests whether a character is an ASCII digit.
+	 * \param the code point
+	 * \return true if it is 0-9, else false */
+	static bool is_digit(char32_t cp) { return cp >= '0' && cp <= '9'; }
+
+	/** Gets the value of a hexadecimal digit.
+	 * \param the code point
+	 * \return the value, or 16 if it is not a hexadecimal digit */
+	static unsigned int hex_value(char32_t cp)
+	{
+		if (cp >= '0' && cp <= '9') {
+			return static_cast<unsigned int>(cp - '0');
+		}
+		if (cp >= 'a' && cp <= 'f') {
+			return static_cast<unsigned int>(cp - 'a' + 10);
+		}
+		if (cp >= 'A' && cp <= 'F') {
+			return static_cast<unsigned int>(cp - 'A' + 10);
+		}
+		return 16;
+	}
+
+	/** Adds a node to the parsed pattern.
+	 * \param the parser
+	 * \param the kind of node
+	 * \param the code point, class or group of the node
+	 * \return the index of the node */
+	static size_t add_node(parse_state& state,
+						   node_kind kind,
+						   uint32_t value = 0)
+	{
+		node added;
+		added.kind = kind;
+		added.value = value;
+		state.nodes.push_back(std::move(added));
+		return state.nodes.size() - 1;
+	}
+
+	/** Adds a class, working out which ASCII code points it holds.
+	 * \param the class
+	 * \return the index of the class */
+	uint32_t add_class(char_class cls)
+	{
+		for (char32_t cp = 0; cp < 128; ++cp) {
+			if (cls.test(cp)) {
+				cls.ascii[cp >> 6] |= uint64_t(1) << (cp & 63);
+			}
+		}
+		_classes.push_back(std::move(cls));
+		return static_cast<uint32_t>(_classes.size() - 1);
+	}
+
+	/** Looks up the name of a General_Category or property.
+	 * \param the name, such as "L", "Lu" or "White_Space"
+	 * \param the item to set the categories or flags of */
+	static void lookup_property(const std::string& name, class_item& item)
+	{
+		item.categories = 0;
+		item.flags = 0;
+		const size_t count = onestring_property_tables::GENERAL_CATEGORIES;
+		for (size_t i = 0; i < count; ++i) {
+			const char* category = CATEGORY_NAMES[i];
+			if ((name.size() == 1 && name[0] == category[0]) ||
+				name == category) {
+				item.categories |= uint32_t(1) << i;
+			}
+		}
+		if (name == "Alphabetic") {
+			item.flags = onestring_property_tables::ALPHABETIC;
+		} else if (name == "Numeric") {
+			item.flags = onestring_property_tables::NUMERIC;
+		} else if (name == "White_Space") {
+			item.flags = onestring_property_tables::WHITE_SPACE;
+		}
+		if (item.categories == 0 && item.flags == 0) {
+			throw std::invalid_argument(
+				"Onestring_regex(): unknown property '" + name + "'");
+		}
+	}
+
+	/** Parses the name of a property after \p or \P: either one letter,
+	 * or a name in braces.
+	 * \param the parser
+	 * \param the item to set the categories or flags of */
+	static void parse_property(parse_state& state, class_item& item)
+	{
+		std::string name;
+		if (state.done()) {
+			throw std::invalid_argument(
+				"Onestring_regex(): missing property name");
+		}
+		if (state.peek() != '{') {
+			name.push_back(static_cast<char>(state.pattern[state.at++]));
+		} else {
+			++state.at;
+			while (!state.done() && state.peek() != '}') {
+				char32_t cp = state.pattern[state.at++];
+				// Property names are ASCII; anything else is unknown.
+				name.push_back(cp < 128 ? static_cast<char>(cp) : '?');
+			}
+			if (state.done()) {
+				throw std::invalid_argument(
+					"Onestring_regex(): missing '}' after property name");
+			}
+			++state.at;
+		}
+		lookup_property(name, item);
+	}
+
+	/** Parses the hexadecimal code point after \x: either two digits, or
+	 * any number in braces.
+	 * \param the parser
+	 * \return the code point */
+	static char32_t parse_hex(parse_state& state)
+	{
+		bool braced = !state.done() && state.peek() == '{';
+		if (braced) {
+			++state.at;
+		}
+		char32_t cp = 0;
+		size_t digits = 0;
+		while (!state.done() && (braced || digits < 2)) {
+			unsigned int digit = hex_value(state.peek());
+			if (digit == 16) {
+				break;
+			}
+			cp = cp * 16 + digit;
+			if (cp > 0x10FFFF) {
+				throw std::invalid_argument(
+					"Onestring_regex(): code point out of range");
+			}
+			++digits;
+			++state.at;
+		}
+		if (digits == 0 || (!braced && digits < 2)) {
+			throw std::invalid_argument(
+				"Onestring_regex(): invalid hexadecimal escape");
+		}
+		if (braced) {
+			if (state.done() || state.peek() != '}') {
+				throw std::invalid_argument(
+					"Onestring_regex(): missing '}' after code point");
+			}
+			++state.at;
+		}
+		return cp;
+	}
+
+	/** Parses an escape, after its backslash.
+	 * \param the parser
+	 * \param set to the code point, if the escape is of one
+	 * \param set to the class item, if the escape is of a class
+	 * \return true if the escape is of a class, else false */
+	static bool parse_escape(parse_state& state,
+							 char32_t& literal,
+							 class_item& item)
+	{
+		if (state.done()) {
+			throw std::invalid_argument(
+				"Onestring_regex(): pattern ends with a backslash");
+		}
+		char32_t cp = state.pattern[state.at++];
+		item = class_item{0, 0, 0, 0, false};
+		switch (cp) {
+			case 'D':
+				item.negated = true;
+				[[fallthrough]];
+			case 'd':
+				item.categories = DIGIT_CATEGORIES;
+				return true;
+			case 'W':
+				item.negated = true;
+				[[fallthrough]];
+			case 'w':
+				item.categories = WORD_CATEGORIES;
+				item.flags = onestring_property_tables::ALPHABETIC;
+				return true;
+			case 'S':
+				item.negated = true;
+				[[fallthrough]];
+			case 's':
+				item.flags = onestring_property_tables::WHITE_SPACE;
+				return true;
+			case 'P':
+				item.negated = true;
+				[[fallthrough]];
+			case 'p':
+				parse_property(state, item);
+				return true;
+			case 'n':
+				literal = '\n';
+				return false;
+			case 'r':
+				literal = '\r';
+				return false;
+			case 't':
+				literal = '\t';
+				return false;
+			case 'f':
+				literal = '\f';
+				return false;
+			case 'v':
+				literal = '\v';
+				return false;
+			case 'x':
+				literal = parse_hex(state);
+				return false;
+			default:
+				break;
+		}
+		// Letters and digits are kept for escapes not yet supported.
+		if ((cp >= 'a' && cp <= 'z') || (cp >= 'A' && cp <= 'Z') ||
+			is_digit(cp)) {
+			throw std::invalid_argument("Onestring_regex(): unknown escape");
+		}
+		literal = cp;
+		return false;
+	}
+
+	/** Parses a class, after its opening bracket.
+	 * \param the parser
+	 * \return the index of the class */
+	uint32_t parse_class(parse_state& state)
+	{
+		char_class cls;
+		if (!state.done() && state.peek() == '^') {
+			cls.negated = true;
+			++state.at;
+		}
+		// A bracket that opens the class is a literal.
+		bool first = true;
+		for (;;) {
+			if (state.done()) {
+				throw std::invalid_argument("Onestring_regex(): missing ']'");
+			}
+			char32_t low = state.pattern[state.at++];
+			if (low == ']' && !first) {
+				break;
+			}
+			first = false;
+			class_item item;
+			if (low == '\\' && parse_escape(state, low, item)) {
+				cls.items.push_back(item);
+				continue;
+			}
+
+			char32_t high = low;
+			if (state.at + 1 < state.pattern.size() && state.peek() == '-' &&
+				state.pattern[state.at + 1] != ']') {
+				++state.at;
+				high = state.pattern[state.at++];
+				if (high == '\\' && parse_escape(state, high, item)) {
+					throw std::invalid_argument(
+						"Onestring_regex(): class range ends with a class");
+				}
+				if (high < low) {
+					throw std::invalid_argument(
+						"Onestring_regex(): class range out of order");
+				}
+			}
+			cls.items.push_back(class_item{low, high, 0, 0, false});
+		}
+		return add_class(std::move(cls));
+	}
+
+	/** Parses a repetition count.
+	 * \param the parser
+	 * \return the count, or more than MAX_REPEAT if it is larger */
+	static size_t parse_count(parse_state& state)
+	{
+		size_t count = 0;
+		while (!state.done() && is_digit(state.peek())) {
+			if (count <= MAX_REPEAT) {
+				count = count * 10 + (state.peek() - '0');
+			}
+			++state.at;
+		}
+		return count;
+	}
+
+	/** Parses an atom: a character, class, anchor or group.
+	 * \param the parser
+	 * \return the index of the node */
+	size_t parse_atom(parse_state& state)
+	{
+		char32_t cp = state.pattern[state.at++];
+		switch (cp) {
+			case '(': {
+				uint32_t group = NONE;
+				if (!state.done() && state.peek() == '?') {
+					if (state.at + 1 >= state.pattern.size() ||
+						state.pattern[state.at + 1] != ':') {
+						throw std::invalid_argument(
+							"Onestring_regex(): unsupported group");
+					}
+					state.at += 2;
+				} else {
+					group = static_cast<uint32_t>(++_groups);
+				}
+				if (++state.depth > MAX_DEPTH) {
+					throw std::invalid_argument(
+						"Onestring_regex(): groups nested too deeply");
+				}
+				size_t inner = parse_alternation(state);
+				if (state.done()) {
+					throw std::invalid_argument(
+						"Onestring_regex(): missing ')'");
+				}
+				++state.at;
+				--state.depth;
+				if (group == NONE) {
+					return inner;
+				}
+				size_t added = add_node(state, node_kind::GROUP, group);
+				state.nodes[added].children.push_back(inner);
+				return added;
+			}
+			case '*':
+			case '+':
+			case '?':
+				throw std::invalid_argument(
+					"Onestring_regex(): nothing to repeat");
+			case '{':
+				if (!state.done() && is_digit(state.peek())) {
+					throw std::invalid_argument(
+						"Onestring_regex(): nothing to repeat");
+				}
+				return add_node(state, node_kind::LITERAL, cp);
+			case '.':
+				return add_node(state, node_kind::ANY);
+			case '^':
+				return add_node(state, node_kind::BEGIN);
+			case '$':
+				return add_node(state, node_kind::END);
+			case '[':
+				return add_node(state, node_kind::CLASS, parse_class(state));
+			case '\\': {
+				class_item item;
+				if (parse_escape(state, cp, item)) {
+					char_class cls;
+					cls.items.push_back(item);
+					uint32_t added = add_class(std::move(cls));
+					return add_node(state, node_kind::CLASS, added);
+				}
+				return add_node(state, node_kind::LITERAL, cp);
+			}
+			default:
+				return add_node(state, node_kind::LITERAL, cp);
+		}
+	}
+
+	/** Parses an atom and any repetitions of it.
+	 * \param the parser
+	 * \return the index of the node */
+	size_t parse_repeat(parse_state& state)
+	{
+		size_t atom = parse_atom(state);
+		while (!state.done()) {
+			char32_t cp = state.peek();
+			size_t min = 0;
+			size_t max = UNBOUNDED;
+			if (cp == '*') {
+				++state.at;
+			} else if (cp == '+') {
+				min = 1;
+				++state.at;
+			} else if (cp == '?') {
+				max = 1;
+				++state.at;
+			} else if (cp == '{' && state.at + 1 < state.pattern.size() &&
+					   is_digit(state.pattern[state.at + 1])) {
+				++state.at;
+				min = parse_count(state);
+				max = min;
+				if (!state.done() && state.peek() == ',') {
+					++state.at;
+					bool bounded = !state.done() && state.peek() != '}';
+					max = bounded ? parse_count(state) : UNBOUNDED;
+				}
+				if (state.done() || state.peek() != '}') {
+					throw std::invalid_argument(
+						"Onestring_regex(): invalid repetition");
+				}
+				++state.at;
+				bool huge = (max != UNBOUNDED && max > MAX_REPEAT);
+				if (min > MAX_REPEAT || huge) {
+					throw std::invalid_argument(
+						"Onestring_regex(): repetition is too large");
+				}
+				if (max < min) {
+					throw std::invalid_argument(
+						"Onestring_regex(): repetition out of order");
+				}
+			} else {
+				break;
+			}
+
+			bool greedy = true;
+			if (!state.done() && state.peek() == '?') {
+				greedy = false;
+				++state.at;
+			}
+			size_t added = add_node(state, node_kind::REPEAT);
+			node& repeat = state.nodes[added];
+			repeat.min = min;
+			repeat.max = max;
+			repeat.greedy = greedy;
+			repeat.children.push_back(atom);
+			atom = added;
+		}
+		return atom;
+	}
+
+	/** Parses a sequence of atoms, up to a `|` or `)`.
+	 * \param the parser
+	 * \return the index of the node */
+	size_t parse_concat(parse_state& state)
+	{
+		size_t concat = add_node(state, node_kind::CONCAT);
+		while (!state.done() && state.peek() != '|' && state.peek() != ')') {
+			size_t next = parse_repeat(state);
+			state.nodes[concat].children.push_back(next);
+		}
+		return concat;
+	}
+
+	/** Parses sequences separated by `|`.
+	 * \param the parser
+	 * \return the index of the node */
+	size_t parse_alternation(parse_state& state)
+	{
+		size_t first = parse_concat(state);
+		if (state.done() || state.peek() != '|') {
+			return first;
+		}
+		size_t alternate = add_node(state, node_kind::ALTERNATE);
+		state.nodes[alternate].children.push_back(first);
+		while (!state.done() && state.peek() == '|') {
+			++state.at;
+			size_t next = parse_concat(state);
+			state.nodes[alternate].children.push_back(next);
+		}
+		return alternate;
+	}
+
+	/** Appends an instruction to the program.
+	 * \param the operation
+	 * \param its first operand
+	 * \param its second operand
+	 * \return the index of the instruction */
+	uint32_t emit(opcode op, uint32_t x = 0, uint32_t y = 0)
+	{
+		if (_program.size() >= MAX_PROGRAM) {
+			throw std::invalid_argument(
+				"Onestring_regex(): pattern is too large");
+		}
+		_program.push_back(instruction{op, x, y});
+		return static_cast<uint32_t>(_program.size() - 1);
+	}
+
+	/** Points a SPLIT at the body of a repetition and at what follows it,
+	 * in the order of preference.
+	 * \param the index of the SPLIT
+	 * \param the index of the body
+	 * \param the index of what follows
+	 * \param whether to prefer the body */
+	void branch(uint32_t split, uint32_t body, uint32_t out, bool greedy)
+	{
+		_program[split].x = greedy ? body : out;
+		_program[split].y = greedy ? out : body;
+	}
+
+	/** Compiles a node, and the nodes inside it, to the program.
+	 * \param the nodes of the pattern
+	 * \param the index of the node */
+	void compile(const std::vector<node>& nodes, size_t at)
+	{
+		const node& from = nodes[at];
+		switch (from.kind) {
+			case node_kind::LITERAL:
+				emit(opcode::CHAR, from.value);
+				break;
+			case node_kind::ANY:
+				emit(opcode::ANY);
+				break;
+			case node_kind::CLASS:
+				emit(opcode::CLASS, from.value);
+				break;
+			case node_kind::BEGIN:
+				emit(opcode::BEGIN);
+				break;
+			case node_kind::END:
+				emit(opcode::END);
+				break;
+			case node_kind::GROUP:
+				emit(opcode::SAVE, from.value * 2);
+				compile(nodes, from.children[0]);
+				emit(opcode::SAVE, from.value * 2 + 1);
+				break;
+			case node_kind::CONCAT:
+				for (size_t child : from.children) {
+					compile(nodes, child);
+				}
+				break;
+			case node_kind::ALTERNATE: {
+				std::vector<uint32_t> jumps;
+				for (size_t i = 0; i + 1 < from.children.size(); ++i) {
+					uint32_t split = emit(opcode::SPLIT);
+					compile(nodes, from.children[i]);
+					jumps.push_back(emit(opcode::JUMP));
+					auto next = static_cast<uint32_t>(_program.size());
+					branch(split, split + 1, next, true);
+				}
+				compile(nodes, from.children.back());
+				for (uint32_t jump : jumps) {
+					_program[jump].x = static_cast<uint32_t>(_program.size());
+				}
+				break;
+			}
+			case node_kind::REPEAT: {
+				size_t body = from.children[0];
+				for (size_t i = 0; i < from.min; ++i) {
+					compile(nodes, body);
+				}
+				if (from.max == UNBOUNDED) {
+					uint32_t split = emit(opcode::SPLIT);
+					compile(nodes, body);
+					emit(opcode::JUMP, split);
+					auto out = static_cast<uint32_t>(_program.size());
+					branch(split, split + 1, out, from.greedy);
+					break;
+				}
+				// Each optional repetition may skip to the end.
+				std::vector<uint32_t> splits;
+				for (size_t i = from.min; i < from.max; ++i) {
+					splits.push_back(emit(opcode::SPLIT));
+					compile(nodes, body);
+				}
+				auto out = static_cast<uint32_t>(_program.size());
+				for (uint32_t split : splits) {
+					branch(split, split + 1, out, from.greedy);
+				}
+				break;
+			}
+		}
+	}
+
+	/** Tests whether an instruction consumes a code point.
+	 * \param the instruction
+	 * \param the code point
+	 * \return true if it consumes the code point, else false */
+	bool accepts(const instruction& in, char32_t cp) const
+	{
+		switch (in.op) {
+			case opcode::CHAR:
+				return cp == in.x;
+			case opcode::ANY:
+				return cp != '\n';
+			case opcode::CLASS:
+				return _classes[in.x].contains(cp);
+			default:
+				return false;
+		}
+	}
+
+	/** Adds a thread to a list of threads, following every instruction
+	 * that consumes nothing, in order of priority. Each thread that
+	 * reaches an instruction that consumes or matches takes a copy of the
+	 * slots as they were along its path.
+	 * \param the list to add to
+	 * \param the stack to walk with
+	 * \param the instruction the thread starts at
+	 * \param the position in the text
+	 * \param the length of the text
+	 * \param the slots of the thread, which are restored before
+	 * returning */
+	void add_thread(thread_list& list,
+					std::vector<frame>& stack,
+					uint32_t pc,
+					size_t at,
+					size_t length,
+					size_t* slots) const
+	{
+		const size_t width = _groups * 2 + 2;
+		stack.push_back(frame{pc, NONE, 0});
+		while (!stack.empty()) {
+			frame top = stack.back();
+			stack.pop_back();
+			if (top.slot != NONE) {
+				slots[top.slot] = top.value;
+				continue;
+			}
+			pc = top.pc;
+			while (!list.contains(pc)) {
+				list.insert(pc);
+				const instruction& in = _program[pc];
+				if (in.op == opcode::JUMP) {
+					pc = in.x;
+				} else if (in.op == opcode::SPLIT) {
+					stack.push_back(frame{in.y, NONE, 0});
+					pc = in.x;
+				} else if (in.op == opcode::SAVE) {
+					stack.push_back(frame{0, in.x, slots[in.x]});
+					slots[in.x] = at;
+					++pc;
+				} else if (in.op == opcode::BEGIN && at == 0) {
+					++pc;
+				} else if (in.op == opcode::END && at == length) {
+					++pc;
+				} else {
+					if (in.op != opcode::BEGIN && in.op != opcode::END) {
+						size_t row = list.dense.size() - 1;
+						if (list.slots.size() < (row + 1) * width) {
+							list.slots.resize((row + 1) * width);
+						}
+						std::copy(slots, slots + width,
+								  list.slots.begin() + row * width);
+					}
+					break;
+				}
+			}
+		}
+	}
+
+	/** Works out which characters a match can start with, away from the
+	 * start of the text. */
+	void find_first()
+	{
+		_first[0] = 0;
+		_first[1] = 0;
+		_first_other = false;
+		_skip = true;
+		thread_list set(_program.size());
+		std::vector<uint32_t> stack;
+		closure(set, stack, 0, false, false);
+		for (uint32_t pc : set.dense) {
+			const instruction& in = _program[pc];
+			if (in.op == opcode::CHAR) {
+				if (in.x < 128) {
+					_first[in.x >> 6] |= uint64_t(1) << (in.x & 63);
+				} else {
+					_first_other = true;
+				}
+			} else if (in.op == opcode::CLASS) {
+				_first[0] |= _classes[in.x].ascii[0];
+				_first[1] |= _classes[in.x].ascii[1];
+				_first_other = true;
+			} else if (in.op == opcode::ANY || in.op == opcode::END ||
+					   in.op == opcode::MATCH) {
+				_skip = false;
+			}
+		}
+	}
+
+	/** Tests whether a match can start with a character.
+	 * \param the character
+	 * \return true if it can, else false */
+	bool can_start(const onechar& ch) const
+	{
+		auto byte = static_cast<unsigned char>(ch.internal[0]);
+		if (ch.size == 1 && byte < 128) {
+			return (_first[byte >> 6] >> (byte & 63)) & 1;
+		}
+		return _first_other;
+	}
+
+	/** Finds the leftmost match, and its capture groups, with the Pike
+	 * VM, which runs every thread in step over the text.
+	 * \param the text
+	 * \param the position to start at
+	 * \param the match to fill in
+	 * \return true if a match was found, else false */
+	bool run_vm(onestring_view text, size_t pos, match& result) const
+	{
+		const size_t width = _groups * 2 + 2;
+		vm_scratch& vm = _vm;
+		if (vm.current.sparse.size() != _program.size()) {
+			vm.current = thread_list(_program.size());
+			vm.next = thread_list(_program.size());
+		}
+		vm.current.clear();
+		vm.next.clear();
+		vm.seed.assign(width, npos);
+		vm.copy.resize(width);
+
+		const onechar* chars = text.data();
+		const size_t length = text.length();
+		bool found = false;
+		for (size_t at = pos;; ++at) {
+			// A new thread starts here, with less priority than the rest,
+			// until a match is found.
+			if (!found) {
+				// With no threads left, skip to where a match can start.
+				if (_skip && at != 0 && vm.current.dense.empty()) {
+					while (at < length && !can_start(chars[at])) {
+						++at;
+					}
+					if (at == length) {
+						break;
+					}
+				}
+				add_thread(vm.current, vm.stack, 0, at, length,
+						   vm.seed.data());
+			}
+			if (vm.current.dense.empty()) {
+				break;
+			}
+			bool more = (at < length);
+			char32_t cp = more ? code(chars[at]) : 0;
+			for (size_t i = 0; i < vm.current.dense.size(); ++i) {
+				const instruction& in = _program[vm.current.dense[i]];
+				const size_t* slots = nullptr;
+				if (in.op == opcode::MATCH || (more && accepts(in, cp))) {
+					slots = vm.current.slots.data() + i * width;
+				}
+				if (in.op == opcode::MATCH) {
+					// Threads of less priority than this one are dropped.
+					result._slots.assign(slots, slots + width);
+					found = true;
+					break;
+				}
+				if (slots) {
+					std::copy(slots, slots + width, vm.copy.begin());
+					add_thread(vm.next, vm.stack, vm.current.dense[i] + 1,
+							   at + 1, length, vm.copy.data());
+				}
+			}
+			std::swap(vm.current, vm.next);
+			vm.next.clear();
+			if (!more) {
+				break;
+			}
+		}
+		return found;
+	}
+
+	/** Follows every instruction that consumes nothing from one, adding
+	 * each instruction reached to a set.
+	 * \param the set to add to
+	 * \param the stack to walk with
+	 * \param the instruction to start at
+	 * \param whether this is the start of the text
+	 * \param whether this is the end of the text */
+	void closure(thread_list& set,
+				 std::vector<uint32_t>& stack,
+				 uint32_t pc,
+				 bool at_start,
+				 bool at_end) const
+	{
+		stack.push_back(pc);
+		while (!stack.empty()) {
+			pc = stack.back();
+			stack.pop_back();
+			while (!set.contains(pc)) {
+				set.insert(pc);
+				const instruction& in = _program[pc];
+				if (in.op == opcode::JUMP) {
+					pc = in.x;
+				} else if (in.op == opcode::SPLIT) {
+					stack.push_back(in.y);
+					pc = in.x;
+				} else if (in.op == opcode::SAVE ||
+						   (in.op == opcode::BEGIN && at_start) ||
+						   (in.op == opcode::END && at_end)) {
+					++pc;
+				} else {
+					break;
+				}
+			}
+		}
+	}
+
+	/** Throws away the states of a DFA.
+	 * \param the DFA */
+	void reset(dfa& machine) const
+	{
+		machine.states.clear();
+		machine.index[0].clear();
+		machine.index[1].clear();
+		machine.start[0] = NONE;
+		machine.start[1] = NONE;
+		++machine.generation;
+		if (machine.set.sparse.size() != _program.size()) {
+			machine.set = thread_list(_program.size());
+		}
+	}
+
+	/** Finds or builds the DFA state for the set of instructions in the
+	 * DFA's working set.
+	 * \param the DFA
+	 * \param whether this is the start of the text
+	 * \return the index of the state */
+	uint32_t intern(dfa& machine, bool at_start) const
+	{
+		std::vector<uint32_t> pcs;
+		for (uint32_t pc : machine.set.dense) {
+			opcode op = _program[pc].op;
+			if (op == opcode::CHAR || op == opcode::ANY ||
+				op == opcode::CLASS || op == opcode::MATCH ||
+				op == opcode::END) {
+				pcs.push_back(pc);
+			}
+		}
+		std::sort(pcs.begin(), pcs.end());
+		auto& index = machine.index[at_start ? 1 : 0];
+		auto known = index.find(pcs);
+		if (known != index.end()) {
+			return known->second;
+		}
+
+		// Rebuilding states is linear too, so a DFA too large to keep
+		// starts over rather than growing without bound.
+		if (machine.states.size() >= MAX_STATES) {
+			reset(machine);
+		}
+		dfa_state added;
+		added.match = false;
+		added.match_at_end = false;
+		machine.set.clear();
+		for (uint32_t pc : pcs) {
+			if (_program[pc].op == opcode::MATCH) {
+				added.match = true;
+			} else if (_program[pc].op == opcode::END) {
+				closure(machine.set, machine.stack, pc, at_start, true);
+			}
+		}
+		added.match_at_end = added.match;
+		for (uint32_t pc : machine.set.dense) {
+			added.match_at_end |= (_program[pc].op == opcode::MATCH);
+		}
+		std::fill(added.ascii, added.ascii + 128, NONE);
+		added.pcs = pcs;
+		machine.states.push_back(std::move(added));
+		auto state = static_cast<uint32_t>(machine.states.size() - 1);
+		machine.index[at_start ? 1 : 0].emplace(std::move(pcs), state);
+		return state;
+	}
+
+	/** Gets the first state of a DFA.
+	 * \param the DFA
+	 * \param whether the search starts at the start of the text
+	 * \return the index of the state */
+	uint32_t start(dfa& machine, bool at_start) const
+	{
+		uint32_t& first = machine.start[at_start ? 1 : 0];
+		if (first == NONE) {
+			machine.set.clear();
+			closure(machine.set, machine.stack, 0, at_start, false);
+			uint32_t state = intern(machine, at_start);
+			machine.start[at_start ? 1 : 0] = state;
+			return state;
+		}
+		return first;
+	}
+
+	/** Builds the transition from a DFA state on a code point, and keeps
+	 * it unless the states were thrown away to build it.
+	 * \param the DFA
+	 * \param the state
+	 * \param the code point
+	 * \return the index of the next state */
+	uint32_t step(dfa& machine, uint32_t from, char32_t cp) const
+	{
+		machine.set.clear();
+		for (uint32_t pc : machine.states[from].pcs) {
+			if (accepts(_program[pc], cp)) {
+				closure(machine.set, machine.stack, pc + 1, false, false);
+			}
+		}
+		if (!machine.anchored) {
+			closure(machine.set, machine.stack, 0, false, false);
+		}
+		size_t generation = machine.generation;
+		uint32_t to = intern(machine, false);
+		if (machine.generation == generation) {
+			if (cp < 128) {
+				machine.states[from].ascii[cp] = to;
+			} else {
+				machine.states[from].others.emplace(cp, to);
+			}
+		}
+		return to;
+	}
+
+	/** Runs a DFA over a text.
+	 * \param the DFA
+	 * \param the text
+	 * \param the position to start at
+	 * \return true if there is a match, else false */
+	bool run_dfa(dfa& machine, onestring_view text, size_t pos) const
+	{
+		const onechar* chars = text.data();
+		const size_t length = text.length();
+		uint32_t state = start(machine, pos == 0);
+		for (size_t at = pos; at < length; ++at) {
+			const dfa_state& current = machine.states[state];
+			if (current.match && !machine.anchored) {
+				return true;
+			}
+			if (current.pcs.empty()) {
+				return false;
+			}
+			char32_t cp = code(chars[at]);
+			uint32_t next = NONE;
+			if (cp < 128) {
+				next = current.ascii[cp];
+			} else {
+				auto known = current.others.find(cp);
+				if (known != current.others.end()) {
+					next = known->second;
+				}
+			}
+			state = (next == NONE) ? step(machine, state, cp) : next;
+		}
+		return machine.states[state].match_at_end;
+	}
+
+public:
+	/** Compiles a regular expression.
+	 * \param the pattern, which throws invalid_argument if it is not
+	 * valid */
+	explicit onestring_regex(const onestring& pattern)
+	: _program(), _classes(), _groups(0), _anchored(), _unanchored(), _vm(),
+	  _first(), _first_other(false), _skip(false)
+	{
+		parse_state state;
+		state.pattern.reserve(pattern.length());
+		for (size_t i = 0; i < pattern.length(); ++i) {
+			state.pattern.push_back(pattern[i].codepoint());
+		}
+		size_t root = parse_alternation(state);
+		if (!state.done()) {
+			throw std::invalid_argument("Onestring_regex(): unmatched ')'");
+		}
+
+		emit(opcode::SAVE, 0);
+		compile(state.nodes, root);
+		emit(opcode::SAVE, 1);
+		emit(opcode::MATCH);
+
+		_anchored.anchored = true;
+		reset(_anchored);
+		reset(_unanchored);
+		find_first();
+	}
+
+	/** Gets the number of capture groups, not counting the whole match.
+	 * \return the number of groups */
+	size_t groups() const { return _groups; }
+
+	/** Tests whether the regex matches the whole of a text.
+	 * \param the text
+	 * \return true if it matches, else false */
+	bool matches(onestring_view text) const
+	{
+		return run_dfa(_anchored, text, 0);
+	}
+
+	/** Tests whether the regex matches the whole of a text.
+	 * \param the text
+	 * \return true if it matches, else false */
+	bool matches(const onestring& text) const { return matches(text.view()); }
+
+	/** Tests whether the regex matches anywhere in a text.
+	 * \param the text
+	 * \return true if it matches, else false */
+	bool search(onestring_view text) const
+	{
+		return run_dfa(_unanchored, text, 0);
+	}
+
+	/** Tests whether the regex matches anywhere in a text.
+	 * \param the text
+	 * \return true if it matches, else false */
+	bool search(const onestring& text) const { return search(text.view()); }
+
+	/** Finds the leftmost match in a text, and its capture groups.
+	 * \param the text
+	 * \param the match to fill in
+	 * \param the position to start at, which may be the length of the
+	 * text, or this throws out_of_range
+	 * \return true if a match was found, else false */
+	bool find(onestring_view text, match& result, size_t pos = 0) const
+	{
+		if (pos > text.length()) {
+			throw std::out_of_range("Onestring_regex::find(): out of range");
+		}
+		result._slots.clear();
+		// Most texts do not match, which the DFA finds out faster.
+		if (!run_dfa(_unanchored, text, pos)) {
+			return false;
+		}
+		return run_vm(text, pos, result);
+	}
+
+	/** Finds the leftmost match in a text, and its capture groups.
+	 * \param the text
+	 * \param the match to fill in
+	 * \param the position to start at, which may be the length of the
+	 * text, or this throws out_of_range
+	 * \return true if a match was found, else false */
+	bool find(const onestring& text, match& result, size_t pos = 0) const
+	{
+		return find(text.view(), result, pos);
+	}
+
+	/** Finds every match in a text that does not overlap an earlier one.
+	 * After an empty match, the search goes on from the next character.
+	 * \param the text
+	 * \return the matches, in order */
+	std::vector<match> find_all(onestring_view text) const
+	{
+		std::vector<match> found;
+		match next;
+		size_t pos = 0;
+		while (pos <= text.length() && find(text, next, pos)) {
+			size_t end = next.end();
+			pos = (end == next.position()) ? end + 1 : end;
+			found.push_back(std::move(next));
+		}
+		return found;
+	}
+
+	/** Finds every match in a text that does not overlap an earlier one.
+	 * After an empty match, the search goes on from the next character.
+	 * \param the text
+	 * \return the matches, in order */
+	std::vector<match> find_all(const onestring& text) const
+	{
+		return find_all(text.view());
+	}
+};
+
+#endif  // ONESTRING_ONESTRING_REGEX_HPP
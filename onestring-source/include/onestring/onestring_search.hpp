@@ -0,0 +1,614 @@
+/** Onestring Search
+ * Version: 1.0
+ *
+ * Onestring Search finds a run of characters within a longer run of
+ * characters, in linear time in the worst case, and skipping most of the
+ * text in the usual case.
+ *
+ * Author(s): Jason C. McDonald
+ */
+
+/* LICENSE (BSD-3-Clause)
+ * Copyright (c) 2016-2021 MousePaw Media.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * CONTRIBUTING
+ * See https://www.mousepawmedia.com/developers for information
+ * on how to contribute to our projects.
+ */
+
+#ifndef ONESTRING_ONESTRING_SEARCH_HPP
+#define ONESTRING_ONESTRING_SEARCH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <vector>
+
+#include "onestring/onechar.hpp"
+
+/** Searches runs of onechars for a needle, by the Two-Way algorithm of
+ * Crochemore and Perrin, which never compares a character of the haystack
+ * more than twice. A Horspool-style table of skips, keyed by the last byte
+ * of each character, lets the search jump over most of the haystack.
+ * Searching for the last occurrence runs the same algorithm over the
+ * haystack and needle in reverse. */
+class onestring_search
+{
+public:
+	/// The result when the needle is not found.
+	inline static const size_t npos = -1;
+
+	/// Needles shorter than this are found by checking each position.
+	inline static const size_t SHORT_NEEDLE = 3;
+
+	/// Haystacks shorter than this are found by checking each position.
+	inline static const size_t SHORT_HAYSTACK = 64;
+
+	/// The largest skip that the table can hold.
+	inline static const size_t MAX_SKIP = UINT8_MAX;
+
+	/// The most characters of a UTF-8 needle that are parsed onto the stack.
+	inline static const size_t STACK_NEEDLE = 32;
+
+	/** A needle, prepared for the Two-Way search in one direction. */
+	struct pattern
+	{
+		/// The characters of the needle, which must outlive the pattern.
+		const onechar* chars;
+
+		/// The number of characters in the needle.
+		size_t length;
+
+		/// The start of the right half of the critical factorization, counted
+		/// from the end of the needle if it is prepared in reverse.
+		size_t suffix;
+
+		/// The period of the needle, or a lower bound on the skip after a
+		/// mismatch in the left half, if the needle is not periodic.
+		size_t period;
+
+		/// Whether the left half of the needle repeats within the period.
+		bool periodic;
+
+		/// How far the needle can move when the character under its end (or
+		/// its start, in reverse) has a given last byte.
+		uint8_t skip[256];
+	};
+
+	/** Prepares a needle for finding its first occurrence.
+	 * \param the pattern to prepare
+	 * \param the characters of the needle, which must outlive the pattern
+	 * \param the number of characters in the needle */
+	static void prepare(pattern& needle, const onechar* chars, size_t length)
+	{
+		needle.chars = chars;
+		needle.length = length;
+		prepare_chars(needle, chars);
+	}
+
+	/** Prepares a needle for finding its last occurrence.
+	 * \param the pattern to prepare
+	 * \param the characters of the needle, which must outlive the pattern
+	 * \param the number of characters in the needle */
+	static void prepare_reverse(pattern& needle, const onechar* chars,
+								size_t length)
+	{
+		needle.chars = chars;
+		needle.length = length;
+		prepare_chars(needle, backward(chars, length));
+	}
+
+	/** Finds the first occurrence of a prepared needle.
+	 * \param the characters to search
+	 * \param the number of characters to search
+	 * \param the needle, prepared by prepare()
+	 * \return the position of the first occurrence, or npos */
+	static size_t find(const onechar* haystack, size_t length,
+					   const pattern& needle)
+	{
+		return search(haystack, length, needle.chars, needle);
+	}
+
+	/** Finds the last occurrence of a needle prepared in reverse.
+	 * \param the characters to search
+	 * \param the number of characters to search
+	 * \param the needle, prepared by prepare_reverse()
+	 * \return the position of the last occurrence, or npos */
+	static size_t rfind(const onechar* haystack, size_t length,
+						const pattern& needle)
+	{
+		size_t found = search(backward(haystack, length),
+							  length,
+							  backward(needle.chars, needle.length),
+							  needle);
+		return (found == npos) ? npos : length - needle.length - found;
+	}
+
+	/** Finds the first occurrence of a needle.
+	 * \param the characters to search
+	 * \param the number of characters to search
+	 * \param the characters of the needle
+	 * \param the number of characters in the needle
+	 * \return the position of the first occurrence, or npos */
+	static size_t find(const onechar* haystack, size_t length,
+					   const onechar* chars, size_t count)
+	{
+		if (count > length) {
+			return npos;
+		}
+		// Preparing a needle is not worth it for short searches.
+		if (count < SHORT_NEEDLE || length < SHORT_HAYSTACK) {
+			return find_short(haystack, length, chars, count);
+		}
+		pattern needle;
+		prepare(needle, chars, count);
+		return find(haystack, length, needle);
+	}
+
+	/** Finds the last occurrence of a needle.
+	 * \param the characters to search
+	 * \param the number of characters to search
+	 * \param the characters of the needle
+	 * \param the number of characters in the needle
+	 * \return the position of the last occurrence, or npos */
+	static size_t rfind(const onechar* haystack, size_t length,
+						const onechar* chars, size_t count)
+	{
+		if (count > length) {
+			return npos;
+		}
+		if (count < SHORT_NEEDLE || length < SHORT_HAYSTACK) {
+			size_t found = find_short(backward(haystack, length),
+									  length,
+									  backward(chars, count),
+									  count);
+			return (found == npos) ? npos : length - count - found;
+		}
+		pattern needle;
+		prepare_reverse(needle, chars, count);
+		return rfind(haystack, length, needle);
+	}
+
+	/** Counts the characters in a run of UTF-8 bytes. A character cut off
+	 * by the end of the bytes counts as one.
+	 * \param the bytes
+	 * \param the number of bytes
+	 * \return the number of characters */
+	static size_t characters(const char* bytes, size_t len)
+	{
+		size_t count = 0;
+		for (size_t used = 0; used < len; ++count) {
+			used += onechar::evaluateLength(bytes + used);
+		}
+		return count;
+	}
+
+	/** Finds the first occurrence of a needle given as UTF-8 bytes. A
+	 * needle of up to STACK_NEEDLE characters is parsed onto the stack, so
+	 * the search does not allocate; a longer one is parsed onto the heap.
+	 * \param the characters to search
+	 * \param the number of characters to search
+	 * \param the bytes of the needle
+	 * \param the number of bytes in the needle
+	 * \return the position of the first occurrence, or npos */
+	static size_t find(const onechar* haystack, size_t length,
+					   const char* bytes, size_t len)
+	{
+		onechar head[STACK_NEEDLE];
+		size_t used = 0;
+		size_t count = parse(head, STACK_NEEDLE, bytes, len, used);
+		if (used == len) {
+			return find(haystack, length, head, count);
+		}
+		/* Searching for the head and checking the tail at each hit would
+		 * be quadratic on a periodic haystack, so search for all of it. */
+		std::vector<onechar> chars = parse_all(bytes, len);
+		return find(haystack, length, chars.data(), chars.size());
+	}
+
+	/** Finds the last occurrence of a needle given as UTF-8 bytes, without
+	 * allocating unless the needle is longer than STACK_NEEDLE characters.
+	 * \param the characters to search
+	 * \param the number of characters to search
+	 * \param the bytes of the needle
+	 * \param the number of bytes in the needle
+	 * \return the position of the last occurrence, or npos */
+	static size_t rfind(const onechar* haystack, size_t length,
+						const char* bytes, size_t len)
+	{
+		onechar head[STACK_NEEDLE];
+		size_t used = 0;
+		size_t count = parse(head, STACK_NEEDLE, bytes, len, used);
+		if (used == len) {
+			return rfind(haystack, length, head, count);
+		}
+		std::vector<onechar> chars = parse_all(bytes, len);
+		return rfind(haystack, length, chars.data(), chars.size());
+	}
+
+	/** Finds the first occurrence of a single character. An ASCII
+	 * character is matched on its byte alone; any other is filtered on its
+	 * lead byte, then checked in full.
+	 * \param the characters to search
+	 * \param the number of characters to search
+	 * \param the character to find
+	 * \return the position of the first occurrence, or npos */
+	static size_t find(const onechar* haystack, size_t length,
+					   const onechar& ch)
+	{
+		char lead = ch.internal[0];
+		if (is_ascii(ch)) {
+			for (size_t i = 0; i < length; ++i) {
+				if (haystack[i].internal[0] == lead) {
+					return i;
+				}
+			}
+			return npos;
+		}
+		for (size_t i = 0; i < length; ++i) {
+			if (same(haystack[i], ch)) {
+				return i;
+			}
+		}
+		return npos;
+	}
+
+	/** Finds the last occurrence of a single character.
+	 * \param the characters to search
+	 * \param the number of characters to search
+	 * \param the character to find
+	 * \return the position of the last occurrence, or npos */
+	static size_t rfind(const onechar* haystack, size_t length,
+						const onechar& ch)
+	{
+		char lead = ch.internal[0];
+		if (is_ascii(ch)) {
+			for (size_t i = length; i > 0; --i) {
+				if (haystack[i - 1].internal[0] == lead) {
+					return i - 1;
+				}
+			}
+			return npos;
+		}
+		for (size_t i = length; i > 0; --i) {
+			if (same(haystack[i - 1], ch)) {
+				return i - 1;
+			}
+		}
+		return npos;
+	}
+
+	/** Counts the occurrences of a single character.
+	 * \param the characters to search
+	 * \param the number of characters to search
+	 * \param the character to count
+	 * \return the number of occurrences */
+	static size_t count(const onechar* haystack, size_t length,
+						const onechar& ch)
+	{
+		char lead = ch.internal[0];
+		size_t total = 0;
+		if (is_ascii(ch)) {
+			// Counting without a branch leaves nothing to mispredict.
+			for (size_t i = 0; i < length; ++i) {
+				total += (haystack[i].internal[0] == lead);
+			}
+			return total;
+		}
+		for (size_t i = 0; i < length; ++i) {
+			total += same(haystack[i], ch);
+		}
+		return total;
+	}
+
+private:
+	/// Characters read from the last to the first.
+	typedef std::reverse_iterator<const onechar*> reversed;
+
+	/** Reads characters from the last to the first.
+	 * \param the characters
+	 * \param the number of characters
+	 * \return the characters in reverse */
+	static reversed backward(const onechar* chars, size_t count)
+	{
+		return reversed(chars + count);
+	}
+
+	/** Finds the critical factorization, period, and skips of a needle,
+	 * whose characters and length are already set.
+	 * \param the pattern to prepare
+	 * \param the characters of the needle, in the order to search by */
+	template<typename Chars>
+	static void prepare_chars(pattern& needle, Chars chars)
+	{
+		size_t length = needle.length;
+		needle.suffix = critical_factorization(chars, length, needle.period);
+
+		// If the left half repeats at the period, the needle is periodic.
+		needle.periodic = needle.period + needle.suffix <= length;
+		for (size_t i = 0; needle.periodic && i < needle.suffix; ++i) {
+			if (!same(chars[i], chars[i + needle.period])) {
+				needle.periodic = false;
+			}
+		}
+		if (!needle.periodic) {
+			size_t longer = (needle.suffix > length - needle.suffix)
+								? needle.suffix
+								: length - needle.suffix;
+			needle.period = longer + 1;
+		}
+
+		/* Characters that share a last byte share a skip, which is the
+		 * shortest of theirs, so no alignment is ever skipped wrongly. */
+		memset(needle.skip,
+			   static_cast<int>((length < MAX_SKIP) ? length : MAX_SKIP),
+			   sizeof(needle.skip));
+		for (size_t i = 0; i < length; ++i) {
+			size_t distance = length - 1 - i;
+			needle.skip[key(chars[i])] = static_cast<uint8_t>(
+				(distance < MAX_SKIP) ? distance : MAX_SKIP);
+		}
+	}
+
+	/** Finds the first occurrence of a prepared needle, with the haystack
+	 * and needle both read in the order the needle was prepared in.
+	 * \param the characters to search
+	 * \param the number of characters to search
+	 * \param the characters of the needle
+	 * \param the prepared needle
+	 * \return the position of the first occurrence, or npos */
+	template<typename Chars>
+	static size_t search(Chars haystack, size_t length, Chars chars,
+						 const pattern& needle)
+	{
+		size_t count = needle.length;
+		size_t suffix = needle.suffix;
+		size_t period = needle.period;
+		if (count > length) {
+			return npos;
+		}
+		if (count == 0) {
+			return 0;
+		}
+
+		// The number of characters of the left half known to match.
+		size_t memory = 0;
+		size_t j = 0;
+		while (j <= length - count) {
+			// Skip ahead if the character under the end cannot match.
+			size_t shift = needle.skip[key(haystack[j + count - 1])];
+			if (shift > 0) {
+				/* A periodic needle that matched up to its last period
+				 * cannot match again until after the mismatch. */
+				if (memory != 0 && shift < period) {
+					shift = count - period;
+				}
+				memory = 0;
+				j += shift;
+				continue;
+			}
+
+			// Match the right half from left to right...
+			size_t i = (suffix > memory) ? suffix : memory;
+			while (i < count && same(chars[i], haystack[i + j])) {
+				++i;
+			}
+			if (i < count) {
+				j += i - suffix + 1;
+				memory = 0;
+				continue;
+			}
+
+			// ...then the left half from right to left.
+			i = suffix;
+			while (i > memory && same(chars[i - 1], haystack[i - 1 + j])) {
+				--i;
+			}
+			if (i <= memory) {
+				return j;
+			}
+			j += period;
+			// Only a periodic needle remembers what it matched.
+			memory = needle.periodic ? count - period : 0;
+		}
+		return npos;
+	}
+
+	/** Gets the byte that the table of skips is keyed on. The last byte
+	 * of a character varies the most, even among related characters.
+	 * \param the character
+	 * \return the byte */
+	static unsigned char key(const onechar& ch)
+	{
+		return static_cast<unsigned char>(ch.internal[ch.size - 1]);
+	}
+
+	/** Parses the first characters of a run of UTF-8 bytes. A character
+	 * cut off by the end of the bytes is kept as it is, and so matches
+	 * nothing.
+	 * \param the characters to parse into
+	 * \param the most characters to parse
+	 * \param the bytes
+	 * \param the number of bytes
+	 * \param set to the number of bytes parsed
+	 * \return the number of characters parsed */
+	static size_t parse(onechar* chars, size_t limit, const char* bytes,
+						size_t len, size_t& used)
+	{
+		size_t count = 0;
+		used = 0;
+		while (count < limit && used < len) {
+			size_t size = onechar::evaluateLength(bytes + used);
+			if (size > len - used) {
+				size = len - used;
+			}
+			onechar& ch = chars[count++];
+			ch.size = size;
+			memcpy(ch.internal, bytes + used, size);
+			ch.internal[size] = '\0';
+			used += size;
+		}
+		return count;
+	}
+
+	/** Parses every character of a run of UTF-8 bytes.
+	 * \param the bytes
+	 * \param the number of bytes
+	 * \return the characters */
+	static std::vector<onechar> parse_all(const char* bytes, size_t len)
+	{
+		std::vector<onechar> chars(characters(bytes, len));
+		size_t used = 0;
+		parse(chars.data(), chars.size(), bytes, len, used);
+		return chars;
+	}
+
+	/** Tests whether a character is ASCII, so that its lead byte is the
+	 * whole of it, and no other character shares that byte.
+	 * \param the character
+	 * \return true if ASCII, else false */
+	static bool is_ascii(const onechar& ch)
+	{
+		unsigned char lead = static_cast<unsigned char>(ch.internal[0]);
+		return ch.size == 1 && lead < 0x80;
+	}
+
+	/** Tests if two characters are the same, rejecting most mismatches on
+	 * their lead bytes alone.
+	 * \param the first character
+	 * \param the second character
+	 * \return true if the same, else false */
+	static bool same(const onechar& lhs, const onechar& rhs)
+	{
+		return lhs.internal[0] == rhs.internal[0] && lhs.equals(rhs);
+	}
+
+	/** Finds the first occurrence of a needle by checking each position,
+	 * filtering on the lead bytes of its first and last characters.
+	 * \param the characters to search
+	 * \param the number of characters to search
+	 * \param the characters of the needle
+	 * \param the number of characters in the needle, at most the number
+	 * of characters to search
+	 * \return the position of the first occurrence, or npos */
+	template<typename Chars>
+	static size_t find_short(Chars haystack, size_t length, Chars chars,
+							 size_t count)
+	{
+		if (count == 0) {
+			return 0;
+		}
+		char first = chars[0].internal[0];
+		char last = chars[count - 1].internal[0];
+		for (size_t j = 0; j <= length - count; ++j) {
+			if (haystack[j].internal[0] != first ||
+				haystack[j + count - 1].internal[0] != last) {
+				continue;
+			}
+			size_t i = 0;
+			while (i < count && haystack[j + i].equals(chars[i])) {
+				++i;
+			}
+			if (i == count) {
+				return j;
+			}
+		}
+		return npos;
+	}
+
+	/** Finds the maximal suffix of a needle, by either the order of its
+	 * characters or the reverse.
+	 * \param the characters of the needle
+	 * \param the number of characters in the needle
+	 * \param true to use the reverse order
+	 * \param set to the period of the maximal suffix
+	 * \return the start of the maximal suffix */
+	template<typename Chars>
+	static size_t maximal_suffix(Chars chars, size_t count, bool reverse,
+								 size_t& period)
+	{
+		// Positions are offset by one, so that 0 stands for before the start.
+		size_t start = 0;
+		size_t j = 1;
+		size_t k = 1;
+		period = 1;
+		while (j + k <= count) {
+			int order = chars[j + k - 1].compare(chars[start + k - 1]);
+			if (reverse) {
+				order = -order;
+			}
+			if (order < 0) {
+				// The suffix so far is not maximal; it extends past here.
+				j += k;
+				k = 1;
+				period = j - start;
+			} else if (order == 0) {
+				// The suffix repeats; advance through the period.
+				if (k != period) {
+					++k;
+				} else {
+					j += period;
+					k = 1;
+				}
+			} else {
+				// A greater suffix starts here.
+				start = j++;
+				k = period = 1;
+			}
+		}
+		return start;
+	}
+
+	/** Finds a critical factorization of a needle, where it is split into
+	 * a left and right half whose local period is the period of the needle.
+	 * The later of the maximal suffixes by either order is always one.
+	 * \param the characters of the needle
+	 * \param the number of characters in the needle
+	 * \param set to the period of the needle, if it is periodic
+	 * \return the start of the right half */
+	template<typename Chars>
+	static size_t critical_factorization(Chars chars, size_t count,
+										 size_t& period)
+	{
+		size_t forward_period;
+		size_t reverse_period;
+		size_t forward = maximal_suffix(chars, count, false, forward_period);
+		size_t reverse = maximal_suffix(chars, count, true, reverse_period);
+		if (forward > reverse) {
+			period = forward_period;
+			return forward;
+		}
+		period = reverse_period;
+		return reverse;
+	}
+};
+
+#endif  // ONESTRING_ONESTRING_SEARCH_HPP
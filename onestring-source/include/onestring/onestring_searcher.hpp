@@ -0,0 +1,426 @@
+/** Onestring Searcher
+ * Version: 1.0
+ *
+ * Onestring Searcher prepares a needle once, to be found in any number of
+ * haystacks.
+ *
+ * Author(s): Jason C. McDonald
+ */
+
+/* LICENSE (BSD-3-Clause)
+ * Copyright (c) 2016-2021 MousePaw Media.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * CONTRIBUTING
+ * See https://www.mousepawmedia.com/developers for information
+ * on how to contribute to our projects.
+ */
+
+#ifndef ONESTRING_ONESTRING_SEARCHER_HPP
+#define ONESTRING_ONESTRING_SEARCHER_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+#include "onestring/onestring.hpp"
+#include "onestring/onestring_search.hpp"
+#include "onestring/onestring_view.hpp"
+
+/** Finds one needle in many haystacks. The needle is copied, and its
+ * critical factorization, period and table of skips are worked out once,
+ * in both directions, when the searcher is built, rather than on every
+ * search as onestring::find() must. None of the const members change
+ * the searcher, nor any cache within it, so one can be shared by any
+ * number of threads. */
+class onestring_searcher
+{
+public:
+	/// The result when the needle is not found.
+	inline static const size_t npos = -1;
+
+private:
+	/// The needle, which the patterns point into.
+	onestring _needle;
+
+	/// The needle, prepared for finding its first occurrence.
+	onestring_search::pattern _forward;
+
+	/// The needle, prepared for finding its last occurrence.
+	onestring_search::pattern _reverse;
+
+	/** Prepares both patterns from the needle. */
+	void prepare()
+	{
+		const onechar* chars = _needle.view().data();
+		onestring_search::prepare(_forward, chars, _needle.length());
+		onestring_search::prepare_reverse(_reverse, chars, _needle.length());
+	}
+
+	/** Points both patterns at the needle, after it has been copied.
+	 * Nothing else about them depends on where the needle is. */
+	void repoint()
+	{
+		const onechar* chars = _needle.view().data();
+		_forward.chars = chars;
+		_reverse.chars = chars;
+	}
+
+	/** Finds the first occurrence of the needle in a run of characters.
+	 * \param the characters to search
+	 * \param the number of characters to search
+	 * \return the position of the first occurrence, or npos */
+	size_t find_in(const onechar* haystack, size_t length) const
+	{
+		size_t count = _forward.length;
+		if (count == 1) {
+			return onestring_search::find(haystack, length, _forward.chars[0]);
+		}
+		/* The needle is already prepared, so unlike onestring::find(),
+		 * even a short haystack is worth searching with its skips. */
+		if (count < onestring_search::SHORT_NEEDLE) {
+			return onestring_search::find(haystack, length, _forward.chars,
+										  count);
+		}
+		return onestring_search::find(haystack, length, _forward);
+	}
+
+	/** Finds the last occurrence of the needle in a run of characters.
+	 * \param the characters to search
+	 * \param the number of characters to search
+	 * \return the position of the last occurrence, or npos */
+	size_t rfind_in(const onechar* haystack, size_t length) const
+	{
+		size_t count = _reverse.length;
+		if (count == 1) {
+			return onestring_search::rfind(haystack, length,
+										   _reverse.chars[0]);
+		}
+		if (count < onestring_search::SHORT_NEEDLE) {
+			return onestring_search::rfind(haystack, length, _reverse.chars,
+										   count);
+		}
+		return onestring_search::rfind(haystack, length, _reverse);
+	}
+
+public:
+	/** Walks over the occurrences of the needle in a haystack, finding
+	 * each one only when the walk reaches it. */
+	class iterator
+	{
+	private:
+		/// The searcher, or nullptr at the end.
+		const onestring_searcher* _searcher;
+
+		/// The haystack, which must outlive the iterator.
+		onestring_view _haystack;
+
+		/// How far past an occurrence to look for the next one.
+		size_t _step;
+
+		/// The position of the current occurrence, or npos at the end.
+		size_t _position;
+
+	public:
+		typedef std::forward_iterator_tag iterator_category;
+		typedef size_t value_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef const size_t* pointer;
+		typedef const size_t& reference;
+
+		/** Creates an iterator at the end of any walk. */
+		iterator()
+		: _searcher(nullptr), _haystack(), _step(0), _position(npos)
+		{
+		}
+
+		/** Creates an iterator at the first occurrence at or after a
+		 * position.
+		 * \param the searcher
+		 * \param the haystack, which must outlive the iterator
+		 * \param how far past an occurrence to look for the next one
+		 * \param the position to start at */
+		iterator(const onestring_searcher* searcher,
+				 onestring_view haystack,
+				 size_t step,
+				 size_t pos)
+		: _searcher(searcher), _haystack(haystack), _step(step),
+		  _position(searcher->find(haystack, pos))
+		{
+		}
+
+		/** Gets the position of the current occurrence.
+		 * \return the position */
+		reference operator*() const { return _position; }
+
+		/** Moves to the next occurrence.
+		 * \return a reference to the iterator */
+		iterator& operator++()
+		{
+			_position = _searcher->find(_haystack, _position + _step);
+			return *this;
+		}
+
+		/** Moves to the next occurrence.
+		 * \return the iterator as it was */
+		iterator operator++(int)
+		{
+			iterator previous = *this;
+			++*this;
+			return previous;
+		}
+
+		/** Tests whether two iterators of the same walk are at the same
+		 * occurrence. Every iterator at the end is equal.
+		 * \param the other iterator
+		 * \return true if equal, else false */
+		bool operator==(const iterator& other) const
+		{
+			return _position == other._position;
+		}
+
+		bool operator!=(const iterator& other) const
+		{
+			return _position != other._position;
+		}
+	};
+
+	/** The occurrences of the needle in a haystack, found lazily as they
+	 * are iterated over. */
+	class range
+	{
+	private:
+		iterator _begin;
+
+	public:
+		explicit range(iterator first) : _begin(first) {}
+
+		iterator begin() const { return _begin; }
+		iterator end() const { return iterator(); }
+
+		/** Tests whether there are no occurrences.
+		 * \return true if there are none, else false */
+		bool empty() const { return *_begin == npos; }
+	};
+
+	/** Builds a searcher for a needle.
+	 * \param the needle, which cannot be empty, or this throws
+	 * invalid_argument */
+	explicit onestring_searcher(const onestring& needle)
+	: _needle(needle), _forward(), _reverse()
+	{
+		if (_needle.empty()) {
+			throw std::invalid_argument(
+				"Onestring_searcher(): needle cannot be empty");
+		}
+		prepare();
+	}
+
+	/** Builds a searcher for a needle.
+	 * \param the needle, which cannot be empty, or this throws
+	 * invalid_argument */
+	explicit onestring_searcher(const onestring_view& needle)
+	: onestring_searcher(onestring(needle))
+	{
+	}
+
+	onestring_searcher(const onestring_searcher& other)
+	: _needle(other._needle), _forward(other._forward),
+	  _reverse(other._reverse)
+	{
+		repoint();
+	}
+
+	onestring_searcher& operator=(const onestring_searcher& other)
+	{
+		if (this != &other) {
+			_needle = other._needle;
+			_forward = other._forward;
+			_reverse = other._reverse;
+			repoint();
+		}
+		return *this;
+	}
+
+	/** Gets the needle, as a view, which caches nothing and so is as safe
+	 * to share between threads as the searcher.
+	 * \return a view of the needle, valid while the searcher is */
+	onestring_view needle() const { return _needle.view(); }
+
+	/** Gets the number of characters in the needle.
+	 * \return the number of characters */
+	size_t length() const { return _needle.length(); }
+
+	/** Finds the first occurrence of the needle.
+	 * \param the haystack to search
+	 * \param the position to start at, default 0
+	 * \return the position of the first occurrence, or npos if there is
+	 * none at or after the position */
+	size_t find(onestring_view haystack, size_t pos = 0) const
+	{
+		if (pos > haystack.length()) {
+			return npos;
+		}
+		size_t found =
+			find_in(haystack.data() + pos, haystack.length() - pos);
+		return (found == npos) ? npos : found + pos;
+	}
+
+	/** Finds the first occurrence of the needle.
+	 * \param the haystack to search
+	 * \param the position to start at, default 0
+	 * \return the position of the first occurrence, or npos if there is
+	 * none at or after the position */
+	size_t find(const onestring& haystack, size_t pos = 0) const
+	{
+		return find(haystack.view(), pos);
+	}
+
+	/** Finds the last occurrence of the needle.
+	 * \param the haystack to search
+	 * \param the last position the occurrence may start at, default npos
+	 * for anywhere
+	 * \return the position of the last occurrence, or npos if there is
+	 * none at or before the position */
+	size_t rfind(onestring_view haystack, size_t pos = npos) const
+	{
+		size_t count = _needle.length();
+		if (count > haystack.length()) {
+			return npos;
+		}
+		size_t end = haystack.length();
+		if (pos < end - count) {
+			end = pos + count;
+		}
+		return rfind_in(haystack.data(), end);
+	}
+
+	/** Finds the last occurrence of the needle.
+	 * \param the haystack to search
+	 * \param the last position the occurrence may start at, default npos
+	 * for anywhere
+	 * \return the position of the last occurrence, or npos if there is
+	 * none at or before the position */
+	size_t rfind(const onestring& haystack, size_t pos = npos) const
+	{
+		return rfind(haystack.view(), pos);
+	}
+
+	/** Walks over every occurrence of the needle, finding each only when
+	 * it is reached, so a walk that stops early does no more work.
+	 * \param the haystack to search, which must outlive the range
+	 * \param whether to include occurrences that overlap an earlier one,
+	 * default false
+	 * \param the position to start at, default 0
+	 * \return the occurrences, as a range to iterate over */
+	range occurrences(onestring_view haystack,
+					  bool overlapping = false,
+					  size_t pos = 0) const
+	{
+		size_t step = overlapping ? 1 : _needle.length();
+		return range(iterator(this, haystack, step, pos));
+	}
+
+	/** Walks over every occurrence of the needle, finding each only when
+	 * it is reached, so a walk that stops early does no more work.
+	 * \param the haystack to search, which must outlive the range
+	 * \param whether to include occurrences that overlap an earlier one,
+	 * default false
+	 * \param the position to start at, default 0
+	 * \return the occurrences, as a range to iterate over */
+	range occurrences(const onestring& haystack,
+					  bool overlapping = false,
+					  size_t pos = 0) const
+	{
+		return occurrences(haystack.view(), overlapping, pos);
+	}
+
+	/// A temporary haystack would be gone before the range is used.
+	range occurrences(onestring&& haystack,
+					  bool overlapping = false,
+					  size_t pos = 0) const = delete;
+
+	/** Finds every occurrence of the needle.
+	 * \param the haystack to search
+	 * \param whether to include occurrences that overlap an earlier one,
+	 * default false
+	 * \return the positions of the occurrences, in order */
+	std::vector<size_t> find_all(onestring_view haystack,
+								 bool overlapping = false) const
+	{
+		std::vector<size_t> found;
+		for (size_t pos : occurrences(haystack, overlapping)) {
+			found.push_back(pos);
+		}
+		return found;
+	}
+
+	/** Finds every occurrence of the needle.
+	 * \param the haystack to search
+	 * \param whether to include occurrences that overlap an earlier one,
+	 * default false
+	 * \return the positions of the occurrences, in order */
+	std::vector<size_t> find_all(const onestring& haystack,
+								 bool overlapping = false) const
+	{
+		return find_all(haystack.view(), overlapping);
+	}
+
+	/** Counts the occurrences of the needle.
+	 * \param the haystack to search
+	 * \param whether to count occurrences that overlap an earlier one,
+	 * default false
+	 * \return the number of occurrences */
+	size_t count(onestring_view haystack, bool overlapping = false) const
+	{
+		if (_needle.length() == 1) {
+			return onestring_search::count(haystack.data(), haystack.length(),
+										   _forward.chars[0]);
+		}
+		size_t total = 0;
+		for (iterator it = occurrences(haystack, overlapping).begin();
+			 it != iterator(); ++it) {
+			++total;
+		}
+		return total;
+	}
+
+	/** Counts the occurrences of the needle.
+	 * \param the haystack to search
+	 * \param whether to count occurrences that overlap an earlier one,
+	 * default false
+	 * \return the number of occurrences */
+	size_t count(const onestring& haystack, bool overlapping = false) const
+	{
+		return count(haystack.view(), overlapping);
+	}
+};
+
+#endif  // ONESTRING_ONESTRING_SEARCHER_HPP
@@ -0,0 +1,605 @@
+/** Onestring Segments
+ * Version: 1.0
+ *
+ * Onestring Segments splits text into the units that Unicode Standard
+ * Annex #29 defines, such as user-perceived characters (grapheme clusters),
+ * and iterates over them as Onestring Views, without copying.
+ *
+ * Author(s): Jason C. McDonald
+ */
+
+/* LICENSE (BSD-3-Clause)
+ * Copyright (c) 2016-2021 MousePaw Media.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * CONTRIBUTING
+ * See https://www.mousepawmedia.com/developers for information
+ * on how to contribute to our projects.
+ */
+
+#ifndef ONESTRING_ONESTRING_SEGMENTS_HPP
+#define ONESTRING_ONESTRING_SEGMENTS_HPP
+
+#include <cstddef>
+#include <iterator>
+
+#include "onestring/onechar.hpp"
+#include "onestring/onestring_view.hpp"
+#include "onestring/unicode/break_tables.hpp"
+
+/** The units that text can be segmented into. */
+enum class onestring_unit {
+	/// User-perceived characters (extended grapheme clusters), such as a
+	/// letter with its accents, or an emoji sequence.
+	GRAPHEME,
+	/// Words, and the spaces and punctuation between them, each of which is
+	/// a segment of its own.
+	WORD,
+	/// Sentences, including any spaces that follow them.
+	SENTENCE
+};
+
+/** The segments of a onestring_view, such as its grapheme clusters,
+ * words, or sentences, as defined by Unicode Standard Annex #29 */
+class onestring_segments
+{
+private:
+	using breaks = onestring_break_tables;
+	using grapheme_break = onestring_break_tables::grapheme_break;
+	using word_break = onestring_break_tables::word_break;
+	using sentence_break = onestring_break_tables::sentence_break;
+
+	/// The text being segmented
+	onestring_view _text;
+
+	/// The unit to segment it into
+	onestring_unit _unit;
+
+	/** Gets the Grapheme_Cluster_Break value of a character.
+	 * \param the character
+	 * \return the value */
+	static grapheme_break grapheme_of(const onechar& ch)
+	{
+		// ASCII is only ever CR, LF, Control, or Other.
+		if (ch.size == 1) {
+			unsigned char byte = static_cast<unsigned char>(ch.internal[0]);
+			if (byte >= 0x20 && byte != 0x7F) {
+				return grapheme_break::OTHER;
+			}
+			if (byte == '\r') {
+				return grapheme_break::CR;
+			}
+			return (byte == '\n') ? grapheme_break::LF : grapheme_break::CONTROL;
+		}
+		return breaks::lookup(ch.codepoint()).grapheme;
+	}
+
+	/** Finds the end of the grapheme cluster that starts at a position.
+	 * \param the text
+	 * \param the position of the first character in the cluster
+	 * \return the position after the last character in the cluster */
+	static size_t next_grapheme(onestring_view text, size_t pos)
+	{
+		size_t length = text.length();
+
+		// ASCII followed by ASCII is always a boundary, except CR LF.
+		if (pos + 1 < length && text[pos].size == 1 &&
+			text[pos + 1].size == 1 && text[pos].internal[0] != '\r') {
+			return pos + 1;
+		}
+
+		grapheme_break before = grapheme_of(text[pos]);
+		// Whether the cluster so far ends with Extended_Pictographic Extend*
+		bool pictographic = (before == grapheme_break::EXTENDED_PICTOGRAPHIC);
+		// Whether it ends with Extended_Pictographic Extend* ZWJ
+		bool joined = false;
+		// The number of regional indicators it ends with
+		size_t regional = (before == grapheme_break::REGIONAL_INDICATOR);
+
+		for (size_t i = pos + 1; i < length; ++i) {
+			grapheme_break after = grapheme_of(text[i]);
+			bool boundary = (breaks::GRAPHEME_PAIRS[static_cast<size_t>(before)] >>
+							 static_cast<size_t>(after)) &
+							1;
+
+			if (joined && after == grapheme_break::EXTENDED_PICTOGRAPHIC) {
+				// GB11: an emoji joined to the one before it
+				boundary = false;
+			} else if (regional > 0 &&
+					   after == grapheme_break::REGIONAL_INDICATOR) {
+				// GB12, GB13: regional indicators pair up into flags
+				boundary = (regional % 2 == 0);
+			}
+			if (boundary) {
+				return i;
+			}
+
+			joined = (pictographic && after == grapheme_break::ZWJ);
+			pictographic = (after == grapheme_break::EXTENDED_PICTOGRAPHIC) ||
+						   (pictographic && after == grapheme_break::EXTEND);
+			regional = (after == grapheme_break::REGIONAL_INDICATOR)
+						   ? regional + 1
+						   : 0;
+			before = after;
+		}
+		return length;
+	}
+
+	/** Gets the break properties of a character.
+	 * \param the character
+	 * \return the record of its properties */
+	static const breaks::record& record_of(const onechar& ch)
+	{
+		if (ch.size == 1) {
+			return breaks::lookup(static_cast<unsigned char>(ch.internal[0]));
+		}
+		return breaks::lookup(ch.codepoint());
+	}
+
+	/** Tests whether a character is an ASCII letter or digit.
+	 * \param the character
+	 * \return true if it is an ASCII letter or digit */
+	static bool is_ascii_alnum(const onechar& ch)
+	{
+		if (ch.size != 1) {
+			return false;
+		}
+		unsigned char byte = static_cast<unsigned char>(ch.internal[0]);
+		return (static_cast<unsigned char>((byte | 0x20) - 'a') < 26) ||
+			   (static_cast<unsigned char>(byte - '0') < 10);
+	}
+
+	/** Skips over a run of ASCII letters and digits, which are never split
+	 * into separate words or sentences.
+	 * \param the text
+	 * \param the position of a character that might continue the run
+	 * \return the position of the first character after the run, or the
+	 * same position if it doesn't continue one */
+	static size_t skip_ascii_run(onestring_view text, size_t pos)
+	{
+		if (!is_ascii_alnum(text[pos - 1])) {
+			return pos;
+		}
+		while (pos < text.length() && is_ascii_alnum(text[pos])) {
+			++pos;
+		}
+		return pos;
+	}
+
+	/** Tests whether a Word_Break value is ignored by the word rules
+	 * (WB4), as it is attached to the character before it.
+	 * \param the value
+	 * \return true if it is Extend, Format, or ZWJ */
+	static bool is_ignorable(word_break value)
+	{
+		return value == word_break::EXTEND || value == word_break::FORMAT ||
+			   value == word_break::ZWJ;
+	}
+
+	/** Tests whether a Word_Break value is ALetter or Hebrew_Letter.
+	 * \param the value
+	 * \return true if it is a letter */
+	static bool is_letter(word_break value)
+	{
+		return value == word_break::ALETTER ||
+			   value == word_break::HEBREW_LETTER;
+	}
+
+	/** Tests whether a Word_Break value is MidNumLet or Single_Quote.
+	 * \param the value
+	 * \return true if it can be within both words and numbers */
+	static bool is_mid_num_let(word_break value)
+	{
+		return value == word_break::MID_NUM_LET ||
+			   value == word_break::SINGLE_QUOTE;
+	}
+
+	/** Gets the Word_Break value of the first character after a position
+	 * that isn't ignored by the word rules.
+	 * \param the text
+	 * \param the position
+	 * \return the value, or Other at the end of the text */
+	static word_break following_word(onestring_view text, size_t pos)
+	{
+		for (size_t i = pos + 1; i < text.length(); ++i) {
+			word_break value = record_of(text[i]).word;
+			if (!is_ignorable(value)) {
+				return value;
+			}
+		}
+		return word_break::OTHER;
+	}
+
+	/** Finds the end of the word that starts at a position.
+	 * \param the text
+	 * \param the position of the first character in the word
+	 * \return the position after the last character in the word */
+	static size_t next_word(onestring_view text, size_t pos)
+	{
+		size_t length = text.length();
+
+		// The character before the candidate boundary
+		word_break last = record_of(text[pos]).word;
+		// The characters before that which aren't ignored (WB4)
+		word_break before = last;
+		word_break before2 = word_break::OTHER;
+		// The number of regional indicators the word ends with
+		size_t regional = (last == word_break::REGIONAL_INDICATOR);
+
+		for (size_t i = pos + 1; i < length; ++i) {
+			size_t run = skip_ascii_run(text, i);
+			if (run != i) {
+				if (run == length) {
+					return length;
+				}
+				i = run;
+				last = record_of(text[i - 1]).word;
+				before = last;
+				before2 = record_of(text[i - 2]).word;
+				regional = 0;
+			}
+
+			const breaks::record& record = record_of(text[i]);
+			word_break after = record.word;
+			bool boundary;
+
+			if (last == word_break::CR && after == word_break::LF) {
+				boundary = false;  // WB3
+			} else if (last == word_break::CR || last == word_break::LF ||
+					   last == word_break::NEWLINE ||
+					   after == word_break::CR || after == word_break::LF ||
+					   after == word_break::NEWLINE) {
+				boundary = true;  // WB3a, WB3b
+			} else if (last == word_break::ZWJ &&
+					   (record.flags & breaks::EXTENDED_PICTOGRAPHIC)) {
+				boundary = false;  // WB3c
+			} else if (last == word_break::WSEG_SPACE &&
+					   after == word_break::WSEG_SPACE) {
+				boundary = false;  // WB3d
+			} else if (is_ignorable(after)) {
+				boundary = false;  // WB4
+			} else if (is_letter(before) &&
+					   (after == word_break::MID_LETTER || is_mid_num_let(after)) &&
+					   is_letter(following_word(text, i))) {
+				boundary = false;  // WB6
+			} else if (is_letter(before2) &&
+					   (before == word_break::MID_LETTER ||
+						is_mid_num_let(before)) &&
+					   is_letter(after)) {
+				boundary = false;  // WB7
+			} else if (before == word_break::HEBREW_LETTER &&
+					   after == word_break::DOUBLE_QUOTE &&
+					   following_word(text, i) == word_break::HEBREW_LETTER) {
+				boundary = false;  // WB7b
+			} else if (before2 == word_break::HEBREW_LETTER &&
+					   before == word_break::DOUBLE_QUOTE &&
+					   after == word_break::HEBREW_LETTER) {
+				boundary = false;  // WB7c
+			} else if (before2 == word_break::NUMERIC &&
+					   (before == word_break::MID_NUM || is_mid_num_let(before)) &&
+					   after == word_break::NUMERIC) {
+				boundary = false;  // WB11
+			} else if (before == word_break::NUMERIC &&
+					   (after == word_break::MID_NUM || is_mid_num_let(after)) &&
+					   following_word(text, i) == word_break::NUMERIC) {
+				boundary = false;  // WB12
+			} else if (after == word_break::REGIONAL_INDICATOR &&
+					   regional > 0) {
+				boundary = (regional % 2 == 0);  // WB15, WB16
+			} else {
+				// WB5, WB7a, WB8 to WB10, WB13 to WB13b, WB999
+				boundary = (breaks::WORD_PAIRS[static_cast<size_t>(before)] >>
+							static_cast<size_t>(after)) &
+						   1;
+			}
+			if (boundary) {
+				return i;
+			}
+
+			last = after;
+			if (!is_ignorable(after)) {
+				before2 = before;
+				before = after;
+				regional = (after == word_break::REGIONAL_INDICATOR)
+							   ? regional + 1
+							   : 0;
+			}
+		}
+		return length;
+	}
+
+	/** Tests whether a Sentence_Break value is Sep, CR, or LF.
+	 * \param the value
+	 * \return true if it separates paragraphs */
+	static bool is_paragraph_separator(sentence_break value)
+	{
+		return value == sentence_break::SEP || value == sentence_break::CR ||
+			   value == sentence_break::LF;
+	}
+
+	/** Tests whether a lowercase letter follows a position, before any
+	 * letter, paragraph separator, or sentence terminator (SB8).
+	 * \param the text
+	 * \param the position
+	 * \return true if a lowercase letter follows */
+	static bool lower_follows(onestring_view text, size_t pos)
+	{
+		for (size_t i = pos; i < text.length(); ++i) {
+			switch (record_of(text[i]).sentence) {
+				case sentence_break::LOWER:
+					return true;
+				case sentence_break::OLETTER:
+				case sentence_break::UPPER:
+				case sentence_break::SEP:
+				case sentence_break::CR:
+				case sentence_break::LF:
+				case sentence_break::ATERM:
+				case sentence_break::STERM:
+					return false;
+				default:
+					break;
+			}
+		}
+		return false;
+	}
+
+	/** Finds the end of the sentence that starts at a position.
+	 * \param the text
+	 * \param the position of the first character in the sentence
+	 * \return the position after the last character in the sentence */
+	static size_t next_sentence(onestring_view text, size_t pos)
+	{
+		/// How far the sentence is through a terminator, any closing
+		/// punctuation after it, and any spaces after that.
+		enum class terminator_state { NONE, CLOSE, SPACE };
+
+		size_t length = text.length();
+
+		// The character before the candidate boundary
+		sentence_break last = record_of(text[pos]).sentence;
+		// The characters before that which aren't ignored (SB5)
+		sentence_break before = last;
+		sentence_break before2 = sentence_break::OTHER;
+		// The last terminator, if the sentence ends with one, followed by
+		// Close* Sp*
+		sentence_break terminator = sentence_break::OTHER;
+		terminator_state state = terminator_state::NONE;
+		if (last == sentence_break::ATERM || last == sentence_break::STERM) {
+			terminator = last;
+			state = terminator_state::CLOSE;
+		}
+
+		for (size_t i = pos + 1; i < length; ++i) {
+			size_t run = skip_ascii_run(text, i);
+			if (run != i) {
+				if (run == length) {
+					return length;
+				}
+				i = run;
+				last = record_of(text[i - 1]).sentence;
+				before = last;
+				before2 = record_of(text[i - 2]).sentence;
+				state = terminator_state::NONE;
+			}
+
+			sentence_break after = record_of(text[i]).sentence;
+			bool boundary = false;
+
+			if (last == sentence_break::CR && after == sentence_break::LF) {
+				boundary = false;  // SB3
+			} else if (is_paragraph_separator(last)) {
+				boundary = true;  // SB4
+			} else if (after == sentence_break::EXTEND ||
+					   after == sentence_break::FORMAT) {
+				boundary = false;  // SB5
+			} else if (before == sentence_break::ATERM &&
+					   after == sentence_break::NUMERIC) {
+				boundary = false;  // SB6
+			} else if (before == sentence_break::ATERM &&
+					   after == sentence_break::UPPER &&
+					   (before2 == sentence_break::UPPER ||
+						before2 == sentence_break::LOWER)) {
+				boundary = false;  // SB7
+			} else if (state != terminator_state::NONE) {
+				if (after == sentence_break::SCONTINUE ||
+					after == sentence_break::ATERM ||
+					after == sentence_break::STERM) {
+					boundary = false;  // SB8a
+				} else if (state == terminator_state::CLOSE &&
+						   after == sentence_break::CLOSE) {
+					boundary = false;  // SB9
+				} else if (after == sentence_break::SP ||
+						   is_paragraph_separator(after)) {
+					boundary = false;  // SB9, SB10
+				} else {
+					// SB8, SB11
+					boundary = !(terminator == sentence_break::ATERM &&
+								 lower_follows(text, i));
+				}
+			}
+			if (boundary) {
+				return i;
+			}
+
+			last = after;
+			if (after == sentence_break::EXTEND ||
+				after == sentence_break::FORMAT) {
+				continue;
+			}
+			before2 = before;
+			before = after;
+			if (after == sentence_break::ATERM ||
+				after == sentence_break::STERM) {
+				terminator = after;
+				state = terminator_state::CLOSE;
+			} else if (after == sentence_break::SP &&
+					   state != terminator_state::NONE) {
+				state = terminator_state::SPACE;
+			} else if (after != sentence_break::CLOSE ||
+					   state != terminator_state::CLOSE) {
+				state = terminator_state::NONE;
+			}
+		}
+		return length;
+	}
+
+public:
+	/** Iterates over the segments, as onestring_views */
+	class iterator
+	{
+	private:
+		/// The text being segmented
+		onestring_view _text;
+
+		/// The unit to segment it into
+		onestring_unit _unit;
+
+		/// The position of the first character of the segment
+		size_t _start;
+
+		/// The position after the last character of the segment
+		size_t _end;
+
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = onestring_view;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const onestring_view*;
+		using reference = onestring_view;
+
+		/** Create an iterator at the segment starting at a position.
+		 * \param the text being segmented
+		 * \param the unit to segment it into
+		 * \param the position of a boundary */
+		iterator(onestring_view text, onestring_unit unit, size_t start)
+		: _text(text), _unit(unit), _start(start),
+		  _end(next_boundary(text, start, unit))
+		{
+		}
+
+		/** Gets the position of the segment's first character.
+		 * \return the position */
+		size_t position() const { return _start; }
+
+		onestring_view operator*() const
+		{
+			return onestring_view(_text.data() + _start, _end - _start);
+		}
+
+		iterator& operator++()
+		{
+			_start = _end;
+			_end = next_boundary(_text, _start, _unit);
+			return *this;
+		}
+
+		iterator operator++(int)
+		{
+			iterator r = *this;
+			++(*this);
+			return r;
+		}
+
+		bool operator==(const iterator& rhs) const
+		{
+			return _start == rhs._start;
+		}
+
+		bool operator!=(const iterator& rhs) const
+		{
+			return _start != rhs._start;
+		}
+	};
+
+	/** Create the segments of a view.
+	 * \param the text to segment
+	 * \param the unit to segment it into */
+	onestring_segments(onestring_view text, onestring_unit unit)
+	: _text(text), _unit(unit)
+	{
+	}
+
+	/** Finds the next boundary after a position.
+	 * \param the text
+	 * \param the position of a boundary
+	 * \param the unit to segment the text into
+	 * \return the position of the next boundary, or the length of the
+	 * text if the position is at or past the end */
+	static size_t next_boundary(onestring_view text,
+								size_t pos,
+								onestring_unit unit)
+	{
+		if (pos >= text.length()) {
+			return text.length();
+		}
+
+		switch (unit) {
+			case onestring_unit::WORD:
+				return next_word(text, pos);
+			case onestring_unit::SENTENCE:
+				return next_sentence(text, pos);
+			case onestring_unit::GRAPHEME:
+			default:
+				return next_grapheme(text, pos);
+		}
+	}
+
+	/** Tests whether a word segment is a word, rather than the spaces or
+	 * punctuation between words.
+	 * \param the segment
+	 * \return true if it contains a letter or number */
+	static bool is_word(onestring_view segment)
+	{
+		for (const onechar& ch : segment) {
+			if (is_ascii_alnum(ch) ||
+				(ch.size > 1 &&
+				 (record_of(ch).flags & breaks::WORD_LIKE))) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/** Counts the segments.
+	 * \return the number of segments */
+	size_t count() const
+	{
+		size_t segments = 0;
+		for (size_t pos = 0; pos < _text.length(); ++segments) {
+			pos = next_boundary(_text, pos, _unit);
+		}
+		return segments;
+	}
+
+	iterator begin() const { return iterator(_text, _unit, 0); }
+
+	iterator end() const { return iterator(_text, _unit, _text.length()); }
+};
+
+#endif  // ONESTRING_ONESTRING_SEGMENTS_HPP
@@ -0,0 +1,323 @@
+/** Onestring View
+ * Version: 1.0
+ *
+ * Onestring View is a read-only reference to a run of Onechars, such as part
+ * of a Onestring, which it neither owns nor copies. It stays valid only as
+ * long as the characters it refers to are unchanged.
+ *
+ * Author(s): Jason C. McDonald
+ */
+
+/* LICENSE (BSD-3-Clause)
+ * Copyright (c) 2016-2021 MousePaw Media.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * CONTRIBUTING
+ * See https://www.mousepawmedia.com/developers for information
+ * on how to contribute to our projects.
+ */
+
+#ifndef ONESTRING_ONESTRING_VIEW_HPP
+#define ONESTRING_ONESTRING_VIEW_HPP
+
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include "onestring/onechar.hpp"
+#include "onestring/unicode/width_tables.hpp"
+
+/** A read-only view of a run of onechars */
+class onestring_view
+{
+private:
+	/// The first character viewed
+	const onechar* _data;
+
+	/// The number of characters viewed
+	size_t _length;
+
+public:
+	/// The largest possible value of size_t
+	static const size_t npos = -1;
+
+	/** Create an empty onestring_view */
+	onestring_view() : _data(nullptr), _length(0) {}
+
+	/** Create a onestring_view of an array of onechars.
+	 * \param the first character to view
+	 * \param the number of characters to view */
+	onestring_view(const onechar* data, size_t length)
+	: _data(data), _length(length)
+	{
+	}
+
+	/** Returns a pointer to the first character viewed.
+	 * \return the pointer to the first onechar */
+	const onechar* data() const { return _data; }
+
+	/** Gets the number of characters viewed.
+	 * \return the number of onechars */
+	size_t length() const { return _length; }
+
+	/** Gets the byte size of the equivalent c-string, including the null
+	 * terminator, as with onestring::size().
+	 * \return the number of bytes */
+	size_t size() const
+	{
+		size_t bytes = 1;
+		for (size_t i = 0; i < _length; ++i) {
+			bytes += _data[i].size;
+		}
+		return bytes;
+	}
+
+	/** Hashes the viewed characters. A onestring or c-string with the same
+	 * characters has the same hash.
+	 * \return the hash */
+	size_t hash() const
+	{
+		onestring_hasher hasher;
+		for (size_t i = 0; i < _length; ++i) {
+			hasher.append_char(_data[i].internal, _data[i].size);
+		}
+		return static_cast<size_t>(hasher.finish());
+	}
+
+	/** Gets the number of terminal columns the viewed characters take, as
+	 * wcwidth() would count them, but also counting emoji sequences, such
+	 * as flags, skin tones, and people joined by U+200D, as one emoji.
+	 * East Asian wide characters and emoji are 2 columns, controls and
+	 * combining marks are 0, and everything else, including East Asian
+	 * ambiguous characters, is 1.
+	 * \return the number of columns */
+	size_t display_width() const
+	{
+		using widths = onestring_width_tables;
+
+		size_t width = 0;
+		// The width and flags of the last character that took columns.
+		uint8_t last_width = 0;
+		uint8_t last_flags = 0;
+		// Whether a U+200D follows an emoji, joining it to the next one.
+		bool joined = false;
+		// Whether the last character was the first of a flag's pair.
+		bool regional = false;
+
+		for (size_t i = 0; i < _length; ++i) {
+			const onechar& ch = _data[i];
+
+			// Printable ASCII is one column, and controls are none.
+			if (ch.size == 1) {
+				unsigned char byte = static_cast<unsigned char>(ch.internal[0]);
+				if (static_cast<unsigned char>(byte - 0x20) < 0x5F) {
+					++width;
+					last_width = 1;
+					// Digits, '#' and '*' begin keycap emoji.
+					last_flags = (static_cast<unsigned char>(byte - '0') < 10 ||
+								  byte == '#' || byte == '*')
+									 ? widths::EMOJI
+									 : 0;
+					joined = false;
+					regional = false;
+				}
+				continue;
+			}
+
+			char32_t cp = ch.codepoint();
+			const widths::record& record = widths::lookup(cp);
+
+			if (record.width == 0) {
+				if (cp == 0x200D) {
+					joined = (last_flags & widths::EXTENDED_PICTOGRAPHIC) != 0;
+				} else if (cp == 0xFE0F && (last_flags & widths::EMOJI) &&
+						   last_width == 1) {
+					// Emoji presentation widens a text-style emoji.
+					++width;
+					last_width = 2;
+				} else if (cp == 0xFE0E && (last_flags & widths::EMOJI) &&
+						   last_width == 2) {
+					// Text presentation narrows an emoji.
+					--width;
+					last_width = 1;
+				}
+				continue;
+			}
+
+			bool is_regional = (cp >= 0x1F1E6 && cp <= 0x1F1FF);
+			bool extends =
+				(joined && (record.flags & widths::EXTENDED_PICTOGRAPHIC)) ||
+				((record.flags & widths::EMOJI_MODIFIER) &&
+				 (last_flags & widths::EXTENDED_PICTOGRAPHIC)) ||
+				(is_regional && regional);
+
+			// Joined emoji, skin tones, and the second of a pair of regional
+			// indicators are drawn as part of the emoji before them.
+			if (!extends) {
+				width += record.width;
+				last_width = record.width;
+				last_flags = record.flags;
+			}
+			joined = false;
+			regional = is_regional && !regional;
+		}
+		return width;
+	}
+
+	/** Checks whether the view is empty.
+	 * \return true if empty, else false */
+	bool empty() const { return _length == 0; }
+
+	/** Gets a character without checking the position.
+	 * \param the position of the character
+	 * \return a reference to the onechar */
+	const onechar& operator[](size_t pos) const { return _data[pos]; }
+
+	/** Gets a character.
+	 * \param the position of the character
+	 * If this is not less than the length, it throws out_of_range
+	 * \return a reference to the onechar */
+	const onechar& at(size_t pos) const
+	{
+		if (pos >= _length) {
+			throw std::out_of_range(
+				"Onestring_view::at(): specified pos out of range");
+		}
+		return _data[pos];
+	}
+
+	/** Gets the first character.
+	 * WARNING: If the view is empty, this is undefined.
+	 * \return a reference to the onechar */
+	const onechar& front() const { return _data[0]; }
+
+	/** Gets the last character.
+	 * WARNING: If the view is empty, this is undefined.
+	 * \return a reference to the onechar */
+	const onechar& back() const { return _data[_length - 1]; }
+
+	/** Returns a pointer to the first character, for iteration.
+	 * \return the pointer to the first onechar */
+	const onechar* begin() const { return _data; }
+
+	/** Returns a pointer past the last character, for iteration.
+	 * \return the pointer past the last onechar */
+	const onechar* end() const { return _data + _length; }
+
+	/** Creates a view of part of this view, without copying.
+	 * \param the position of the first character
+	 * If this is greater than the length, it throws out_of_range
+	 * \param the number of characters, default to the end of the view
+	 * \return the new view */
+	onestring_view substr(size_t pos = 0, size_t len = npos) const
+	{
+		if (pos > _length) {
+			throw std::out_of_range(
+				"Onestring_view::substr(): specified pos out of range");
+		}
+		if (len > _length - pos) {
+			len = _length - pos;
+		}
+		return onestring_view(_data + pos, len);
+	}
+
+	/** Tests if the view is equivalent to another.
+	 * \param the view to compare against
+	 * \return true if equal, else false */
+	bool equals(const onestring_view& view) const
+	{
+		if (_length != view._length) {
+			return false;
+		}
+		for (size_t i = 0; i < _length; ++i) {
+			if (_data[i] != view._data[i]) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/** Tests if the view is equivalent to a c-string.
+	 * \param the c-string to compare against
+	 * \return true if equal, else false */
+	bool equals(const char* cstr) const
+	{
+		for (size_t i = 0; i < _length; ++i) {
+			// Stop at the null terminator, rather than read past it.
+			for (size_t b = 0; b < _data[i].size; ++b, ++cstr) {
+				if (*cstr == '\0' || *cstr != _data[i].internal[b]) {
+					return false;
+				}
+			}
+		}
+		return *cstr == '\0';
+	}
+
+	/** Tests if the view is equivalent to a std::string.
+	 * \param the std::string to compare against
+	 * \return true if equal, else false */
+	bool equals(const std::string& str) const { return equals(str.c_str()); }
+
+	/** Returns the viewed characters as a std::string.
+	 * \return the std::string */
+	std::string to_string() const
+	{
+		std::string r;
+		r.reserve(size() - 1);
+		for (size_t i = 0; i < _length; ++i) {
+			r.append(_data[i].internal, _data[i].size);
+		}
+		return r;
+	}
+
+	bool operator==(const onestring_view& view) const { return equals(view); }
+	bool operator==(const char* cstr) const { return equals(cstr); }
+	bool operator==(const std::string& str) const { return equals(str); }
+
+	bool operator!=(const onestring_view& view) const { return !equals(view); }
+	bool operator!=(const char* cstr) const { return !equals(cstr); }
+	bool operator!=(const std::string& str) const { return !equals(str); }
+
+	friend std::ostream& operator<<(std::ostream& os, const onestring_view& view)
+	{
+		for (size_t i = 0; i < view._length; ++i) {
+			os << view._data[i];
+		}
+		return os;
+	}
+};
+
+/** Hashes onestring_views, for use as the keys of unordered containers. */
+template<>
+struct std::hash<onestring_view>
+{
+	size_t operator()(const onestring_view& view) const { return view.hash(); }
+};
+
+#endif  // ONESTRING_ONESTRING_VIEW_HPP
@@ -0,0 +1,6074 @@
+/** Unicode 14.0.0 Data Tables
+ * Version: 1.0
+ *
+ * Generated by tools/generate_unicode_tables.pl. Do not edit.
+ */
+
+#ifndef ONESTRING_NORMALIZATION_TEST_DATA_HPP
+#define ONESTRING_NORMALIZATION_TEST_DATA_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+/** Normalization conformance tests: for each source string, its NFC, NFD,
+ * NFKC, and NFKD forms. Every code point not listed alone, other than a
+ * Hangul syllable, is already in all four forms. */
+static const char32_t* const NORMALIZATION_TESTS[6055][5] = {
+	{U"\u1E0A\u0323", U"\u1E0C\u0307", U"D\u0323\u0307", U"\u1E0C\u0307", U"D\u0323\u0307"},
+	{U"\u1E0C\u0307", U"\u1E0C\u0307", U"D\u0323\u0307", U"\u1E0C\u0307", U"D\u0323\u0307"},
+	{U"D\u0307\u0323", U"\u1E0C\u0307", U"D\u0323\u0307", U"\u1E0C\u0307", U"D\u0323\u0307"},
+	{U"D\u0323\u0307", U"\u1E0C\u0307", U"D\u0323\u0307", U"\u1E0C\u0307", U"D\u0323\u0307"},
+	{U"\u1E0A\u031B\u0323", U"\u1E0C\u031B\u0307", U"D\u031B\u0323\u0307", U"\u1E0C\u031B\u0307", U"D\u031B\u0323\u0307"},
+	{U"a\u05AE\u0300\u0315b", U"\u00E0\u05AE\u0315b", U"a\u05AE\u0300\u0315b", U"\u00E0\u05AE\u0315b", U"a\u05AE\u0300\u0315b"},
+	{U"a\u0315\u0300\u05AE\u0301b", U"\u00E0\u05AE\u0301\u0315b", U"a\u05AE\u0300\u0301\u0315b", U"\u00E0\u05AE\u0301\u0315b", U"a\u05AE\u0300\u0301\u0315b"},
+	{U"A\u0300\u0301", U"\u00C0\u0301", U"A\u0300\u0301", U"\u00C0\u0301", U"A\u0300\u0301"},
+	{U"A\u0301\u0300", U"\u00C1\u0300", U"A\u0301\u0300", U"\u00C1\u0300", U"A\u0301\u0300"},
+	{U"A\u0327\u0301", U"\u00C1\u0327", U"A\u0327\u0301", U"\u00C1\u0327", U"A\u0327\u0301"},
+	{U"e\u0304\u0300", U"\u1E15", U"e\u0304\u0300", U"\u1E15", U"e\u0304\u0300"},
+	{U"\u00C5\u0328", U"\u0104\u030A", U"A\u0328\u030A", U"\u0104\u030A", U"A\u0328\u030A"},
+	{U"\u212B\u0328", U"\u0104\u030A", U"A\u0328\u030A", U"\u0104\u030A", U"A\u0328\u030A"},
+	{U"A\u030A\u0328", U"\u0104\u030A", U"A\u0328\u030A", U"\u0104\u030A", U"A\u0328\u030A"},
+	{U"\u0958", U"\u0915\u093C", U"\u0915\u093C", U"\u0915\u093C", U"\u0915\u093C"},
+	{U"\u2126", U"\u03A9", U"\u03A9", U"\u03A9", U"\u03A9"},
+	{U"\u0344", U"\u0308\u0301", U"\u0308\u0301", U"\u0308\u0301", U"\u0308\u0301"},
+	{U"\u0F73", U"\u0F71\u0F72", U"\u0F71\u0F72", U"\u0F71\u0F72", U"\u0F71\u0F72"},
+	{U"\u2ADC", U"\u2ADD\u0338", U"\u2ADD\u0338", U"\u2ADD\u0338", U"\u2ADD\u0338"},
+	{U"\u0B47\u0B3E", U"\u0B4B", U"\u0B47\u0B3E", U"\u0B4B", U"\u0B47\u0B3E"},
+	{U"\u0B47\u0300\u0B3E", U"\u0B47\u0300\u0B3E", U"\u0B47\u0300\u0B3E", U"\u0B47\u0300\u0B3E", U"\u0B47\u0300\u0B3E"},
+	{U"\u09C7\u09BE", U"\u09CB", U"\u09C7\u09BE", U"\u09CB", U"\u09C7\u09BE"},
+	{U"\u1100\u1161", U"\uAC00", U"\u1100\u1161", U"\uAC00", U"\u1100\u1161"},
+	{U"\u1100\u1161\u11A8", U"\uAC01", U"\u1100\u1161\u11A8", U"\uAC01", U"\u1100\u1161\u11A8"},
+	{U"\uAC00\u11A8", U"\uAC01", U"\u1100\u1161\u11A8", U"\uAC01", U"\u1100\u1161\u11A8"},
+	{U"\uAC01\u11A8", U"\uAC01\u11A8", U"\u1100\u1161\u11A8\u11A8", U"\uAC01\u11A8", U"\u1100\u1161\u11A8\u11A8"},
+	{U"\u1100\u0300\u1161", U"\u1100\u0300\u1161", U"\u1100\u0300\u1161", U"\u1100\u0300\u1161", U"\u1100\u0300\u1161"},
+	{U"\uD4DB", U"\uD4DB", U"\u1111\u1171\u11B6", U"\uD4DB", U"\u1111\u1171\u11B6"},
+	{U"\uFB03", U"\uFB03", U"\uFB03", U"ffi", U"ffi"},
+	{U"\u1E9B\u0323", U"\u1E9B\u0323", U"\u017F\u0323\u0307", U"\u1E69", U"s\u0323\u0307"},
+	{U"\uFDFA", U"\uFDFA", U"\uFDFA", U"\u0635\u0644\u0649 \u0627\u0644\u0644\u0647 \u0639\u0644\u064A\u0647 \u0648\u0633\u0644\u0645", U"\u0635\u0644\u0649 \u0627\u0644\u0644\u0647 \u0639\u0644\u064A\u0647 \u0648\u0633\u0644\u0645"},
+	{U"\u3300", U"\u3300", U"\u3300", U"\u30A2\u30D1\u30FC\u30C8", U"\u30A2\u30CF\u309A\u30FC\u30C8"},
+	{U"\uFF76\uFF9E", U"\uFF76\uFF9E", U"\uFF76\uFF9E", U"\u30AC", U"\u30AB\u3099"},
+	{U"\u2460\u00BD", U"\u2460\u00BD", U"\u2460\u00BD", U"11\u20442", U"11\u20442"},
+	{U"\U0001D400\u2126", U"\U0001D400\u03A9", U"\U0001D400\u03A9", U"A\u03A9", U"A\u03A9"},
+	{U"Cafe\u0301 cr\u00E8me br\u00FBl\u00E9e", U"Caf\u00E9 cr\u00E8me br\u00FBl\u00E9e", U"Cafe\u0301 cre\u0300me bru\u0302le\u0301e", U"Caf\u00E9 cr\u00E8me br\u00FBl\u00E9e", U"Cafe\u0301 cre\u0300me bru\u0302le\u0301e"},
+	{U"\U0001F42D A\u0308\u0304\u0332 \u03D3", U"\U0001F42D \u01DE\u0332 \u03D3", U"\U0001F42D A\u0332\u0308\u0304 \u03D2\u0301", U"\U0001F42D \u01DE\u0332 \u038E", U"\U0001F42D A\u0332\u0308\u0304 \u03A5\u0301"},
+	{U"\u00A0", U"\u00A0", U"\u00A0", U" ", U" "},
+	{U"\u00A8", U"\u00A8", U"\u00A8", U" \u0308", U" \u0308"},
+	{U"\u00AA", U"\u00AA", U"\u00AA", U"a", U"a"},
+	{U"\u00AF", U"\u00AF", U"\u00AF", U" \u0304", U" \u0304"},
+	{U"\u00B2", U"\u00B2", U"\u00B2", U"2", U"2"},
+	{U"\u00B3", U"\u00B3", U"\u00B3", U"3", U"3"},
+	{U"\u00B4", U"\u00B4", U"\u00B4", U" \u0301", U" \u0301"},
+	{U"\u00B5", U"\u00B5", U"\u00B5", U"\u03BC", U"\u03BC"},
+	{U"\u00B8", U"\u00B8", U"\u00B8", U" \u0327", U" \u0327"},
+	{U"\u00B9", U"\u00B9", U"\u00B9", U"1", U"1"},
+	{U"\u00BA", U"\u00BA", U"\u00BA", U"o", U"o"},
+	{U"\u00BC", U"\u00BC", U"\u00BC", U"1\u20444", U"1\u20444"},
+	{U"\u00BD", U"\u00BD", U"\u00BD", U"1\u20442", U"1\u20442"},
+	{U"\u00BE", U"\u00BE", U"\u00BE", U"3\u20444", U"3\u20444"},
+	{U"\u00C0", U"\u00C0", U"A\u0300", U"\u00C0", U"A\u0300"},
+	{U"\u00C1", U"\u00C1", U"A\u0301", U"\u00C1", U"A\u0301"},
+	{U"\u00C2", U"\u00C2", U"A\u0302", U"\u00C2", U"A\u0302"},
+	{U"\u00C3", U"\u00C3", U"A\u0303", U"\u00C3", U"A\u0303"},
+	{U"\u00C4", U"\u00C4", U"A\u0308", U"\u00C4", U"A\u0308"},
+	{U"\u00C5", U"\u00C5", U"A\u030A", U"\u00C5", U"A\u030A"},
+	{U"\u00C7", U"\u00C7", U"C\u0327", U"\u00C7", U"C\u0327"},
+	{U"\u00C8", U"\u00C8", U"E\u0300", U"\u00C8", U"E\u0300"},
+	{U"\u00C9", U"\u00C9", U"E\u0301", U"\u00C9", U"E\u0301"},
+	{U"\u00CA", U"\u00CA", U"E\u0302", U"\u00CA", U"E\u0302"},
+	{U"\u00CB", U"\u00CB", U"E\u0308", U"\u00CB", U"E\u0308"},
+	{U"\u00CC", U"\u00CC", U"I\u0300", U"\u00CC", U"I\u0300"},
+	{U"\u00CD", U"\u00CD", U"I\u0301", U"\u00CD", U"I\u0301"},
+	{U"\u00CE", U"\u00CE", U"I\u0302", U"\u00CE", U"I\u0302"},
+	{U"\u00CF", U"\u00CF", U"I\u0308", U"\u00CF", U"I\u0308"},
+	{U"\u00D1", U"\u00D1", U"N\u0303", U"\u00D1", U"N\u0303"},
+	{U"\u00D2", U"\u00D2", U"O\u0300", U"\u00D2", U"O\u0300"},
+	{U"\u00D3", U"\u00D3", U"O\u0301", U"\u00D3", U"O\u0301"},
+	{U"\u00D4", U"\u00D4", U"O\u0302", U"\u00D4", U"O\u0302"},
+	{U"\u00D5", U"\u00D5", U"O\u0303", U"\u00D5", U"O\u0303"},
+	{U"\u00D6", U"\u00D6", U"O\u0308", U"\u00D6", U"O\u0308"},
+	{U"\u00D9", U"\u00D9", U"U\u0300", U"\u00D9", U"U\u0300"},
+	{U"\u00DA", U"\u00DA", U"U\u0301", U"\u00DA", U"U\u0301"},
+	{U"\u00DB", U"\u00DB", U"U\u0302", U"\u00DB", U"U\u0302"},
+	{U"\u00DC", U"\u00DC", U"U\u0308", U"\u00DC", U"U\u0308"},
+	{U"\u00DD", U"\u00DD", U"Y\u0301", U"\u00DD", U"Y\u0301"},
+	{U"\u00E0", U"\u00E0", U"a\u0300", U"\u00E0", U"a\u0300"},
+	{U"\u00E1", U"\u00E1", U"a\u0301", U"\u00E1", U"a\u0301"},
+	{U"\u00E2", U"\u00E2", U"a\u0302", U"\u00E2", U"a\u0302"},
+	{U"\u00E3", U"\u00E3", U"a\u0303", U"\u00E3", U"a\u0303"},
+	{U"\u00E4", U"\u00E4", U"a\u0308", U"\u00E4", U"a\u0308"},
+	{U"\u00E5", U"\u00E5", U"a\u030A", U"\u00E5", U"a\u030A"},
+	{U"\u00E7", U"\u00E7", U"c\u0327", U"\u00E7", U"c\u0327"},
+	{U"\u00E8", U"\u00E8", U"e\u0300", U"\u00E8", U"e\u0300"},
+	{U"\u00E9", U"\u00E9", U"e\u0301", U"\u00E9", U"e\u0301"},
+	{U"\u00EA", U"\u00EA", U"e\u0302", U"\u00EA", U"e\u0302"},
+	{U"\u00EB", U"\u00EB", U"e\u0308", U"\u00EB", U"e\u0308"},
+	{U"\u00EC", U"\u00EC", U"i\u0300", U"\u00EC", U"i\u0300"},
+	{U"\u00ED", U"\u00ED", U"i\u0301", U"\u00ED", U"i\u0301"},
+	{U"\u00EE", U"\u00EE", U"i\u0302", U"\u00EE", U"i\u0302"},
+	{U"\u00EF", U"\u00EF", U"i\u0308", U"\u00EF", U"i\u0308"},
+	{U"\u00F1", U"\u00F1", U"n\u0303", U"\u00F1", U"n\u0303"},
+	{U"\u00F2", U"\u00F2", U"o\u0300", U"\u00F2", U"o\u0300"},
+	{U"\u00F3", U"\u00F3", U"o\u0301", U"\u00F3", U"o\u0301"},
+	{U"\u00F4", U"\u00F4", U"o\u0302", U"\u00F4", U"o\u0302"},
+	{U"\u00F5", U"\u00F5", U"o\u0303", U"\u00F5", U"o\u0303"},
+	{U"\u00F6", U"\u00F6", U"o\u0308", U"\u00F6", U"o\u0308"},
+	{U"\u00F9", U"\u00F9", U"u\u0300", U"\u00F9", U"u\u0300"},
+	{U"\u00FA", U"\u00FA", U"u\u0301", U"\u00FA", U"u\u0301"},
+	{U"\u00FB", U"\u00FB", U"u\u0302", U"\u00FB", U"u\u0302"},
+	{U"\u00FC", U"\u00FC", U"u\u0308", U"\u00FC", U"u\u0308"},
+	{U"\u00FD", U"\u00FD", U"y\u0301", U"\u00FD", U"y\u0301"},
+	{U"\u00FF", U"\u00FF", U"y\u0308", U"\u00FF", U"y\u0308"},
+	{U"\u0100", U"\u0100", U"A\u0304", U"\u0100", U"A\u0304"},
+	{U"\u0101", U"\u0101", U"a\u0304", U"\u0101", U"a\u0304"},
+	{U"\u0102", U"\u0102", U"A\u0306", U"\u0102", U"A\u0306"},
+	{U"\u0103", U"\u0103", U"a\u0306", U"\u0103", U"a\u0306"},
+	{U"\u0104", U"\u0104", U"A\u0328", U"\u0104", U"A\u0328"},
+	{U"\u0105", U"\u0105", U"a\u0328", U"\u0105", U"a\u0328"},
+	{U"\u0106", U"\u0106", U"C\u0301", U"\u0106", U"C\u0301"},
+	{U"\u0107", U"\u0107", U"c\u0301", U"\u0107", U"c\u0301"},
+	{U"\u0108", U"\u0108", U"C\u0302", U"\u0108", U"C\u0302"},
+	{U"\u0109", U"\u0109", U"c\u0302", U"\u0109", U"c\u0302"},
+	{U"\u010A", U"\u010A", U"C\u0307", U"\u010A", U"C\u0307"},
+	{U"\u010B", U"\u010B", U"c\u0307", U"\u010B", U"c\u0307"},
+	{U"\u010C", U"\u010C", U"C\u030C", U"\u010C", U"C\u030C"},
+	{U"\u010D", U"\u010D", U"c\u030C", U"\u010D", U"c\u030C"},
+	{U"\u010E", U"\u010E", U"D\u030C", U"\u010E", U"D\u030C"},
+	{U"\u010F", U"\u010F", U"d\u030C", U"\u010F", U"d\u030C"},
+	{U"\u0112", U"\u0112", U"E\u0304", U"\u0112", U"E\u0304"},
+	{U"\u0113", U"\u0113", U"e\u0304", U"\u0113", U"e\u0304"},
+	{U"\u0114", U"\u0114", U"E\u0306", U"\u0114", U"E\u0306"},
+	{U"\u0115", U"\u0115", U"e\u0306", U"\u0115", U"e\u0306"},
+	{U"\u0116", U"\u0116", U"E\u0307", U"\u0116", U"E\u0307"},
+	{U"\u0117", U"\u0117", U"e\u0307", U"\u0117", U"e\u0307"},
+	{U"\u0118", U"\u0118", U"E\u0328", U"\u0118", U"E\u0328"},
+	{U"\u0119", U"\u0119", U"e\u0328", U"\u0119", U"e\u0328"},
+	{U"\u011A", U"\u011A", U"E\u030C", U"\u011A", U"E\u030C"},
+	{U"\u011B", U"\u011B", U"e\u030C", U"\u011B", U"e\u030C"},
+	{U"\u011C", U"\u011C", U"G\u0302", U"\u011C", U"G\u0302"},
+	{U"\u011D", U"\u011D", U"g\u0302", U"\u011D", U"g\u0302"},
+	{U"\u011E", U"\u011E", U"G\u0306", U"\u011E", U"G\u0306"},
+	{U"\u011F", U"\u011F", U"g\u0306", U"\u011F", U"g\u0306"},
+	{U"\u0120", U"\u0120", U"G\u0307", U"\u0120", U"G\u0307"},
+	{U"\u0121", U"\u0121", U"g\u0307", U"\u0121", U"g\u0307"},
+	{U"\u0122", U"\u0122", U"G\u0327", U"\u0122", U"G\u0327"},
+	{U"\u0123", U"\u0123", U"g\u0327", U"\u0123", U"g\u0327"},
+	{U"\u0124", U"\u0124", U"H\u0302", U"\u0124", U"H\u0302"},
+	{U"\u0125", U"\u0125", U"h\u0302", U"\u0125", U"h\u0302"},
+	{U"\u0128", U"\u0128", U"I\u0303", U"\u0128", U"I\u0303"},
+	{U"\u0129", U"\u0129", U"i\u0303", U"\u0129", U"i\u0303"},
+	{U"\u012A", U"\u012A", U"I\u0304", U"\u012A", U"I\u0304"},
+	{U"\u012B", U"\u012B", U"i\u0304", U"\u012B", U"i\u0304"},
+	{U"\u012C", U"\u012C", U"I\u0306", U"\u012C", U"I\u0306"},
+	{U"\u012D", U"\u012D", U"i\u0306", U"\u012D", U"i\u0306"},
+	{U"\u012E", U"\u012E", U"I\u0328", U"\u012E", U"I\u0328"},
+	{U"\u012F", U"\u012F", U"i\u0328", U"\u012F", U"i\u0328"},
+	{U"\u0130", U"\u0130", U"I\u0307", U"\u0130", U"I\u0307"},
+	{U"\u0132", U"\u0132", U"\u0132", U"IJ", U"IJ"},
+	{U"\u0133", U"\u0133", U"\u0133", U"ij", U"ij"},
+	{U"\u0134", U"\u0134", U"J\u0302", U"\u0134", U"J\u0302"},
+	{U"\u0135", U"\u0135", U"j\u0302", U"\u0135", U"j\u0302"},
+	{U"\u0136", U"\u0136", U"K\u0327", U"\u0136", U"K\u0327"},
+	{U"\u0137", U"\u0137", U"k\u0327", U"\u0137", U"k\u0327"},
+	{U"\u0139", U"\u0139", U"L\u0301", U"\u0139", U"L\u0301"},
+	{U"\u013A", U"\u013A", U"l\u0301", U"\u013A", U"l\u0301"},
+	{U"\u013B", U"\u013B", U"L\u0327", U"\u013B", U"L\u0327"},
+	{U"\u013C", U"\u013C", U"l\u0327", U"\u013C", U"l\u0327"},
+	{U"\u013D", U"\u013D", U"L\u030C", U"\u013D", U"L\u030C"},
+	{U"\u013E", U"\u013E", U"l\u030C", U"\u013E", U"l\u030C"},
+	{U"\u013F", U"\u013F", U"\u013F", U"L\u00B7", U"L\u00B7"},
+	{U"\u0140", U"\u0140", U"\u0140", U"l\u00B7", U"l\u00B7"},
+	{U"\u0143", U"\u0143", U"N\u0301", U"\u0143", U"N\u0301"},
+	{U"\u0144", U"\u0144", U"n\u0301", U"\u0144", U"n\u0301"},
+	{U"\u0145", U"\u0145", U"N\u0327", U"\u0145", U"N\u0327"},
+	{U"\u0146", U"\u0146", U"n\u0327", U"\u0146", U"n\u0327"},
+	{U"\u0147", U"\u0147", U"N\u030C", U"\u0147", U"N\u030C"},
+	{U"\u0148", U"\u0148", U"n\u030C", U"\u0148", U"n\u030C"},
+	{U"\u0149", U"\u0149", U"\u0149", U"\u02BCn", U"\u02BCn"},
+	{U"\u014C", U"\u014C", U"O\u0304", U"\u014C", U"O\u0304"},
+	{U"\u014D", U"\u014D", U"o\u0304", U"\u014D", U"o\u0304"},
+	{U"\u014E", U"\u014E", U"O\u0306", U"\u014E", U"O\u0306"},
+	{U"\u014F", U"\u014F", U"o\u0306", U"\u014F", U"o\u0306"},
+	{U"\u0150", U"\u0150", U"O\u030B", U"\u0150", U"O\u030B"},
+	{U"\u0151", U"\u0151", U"o\u030B", U"\u0151", U"o\u030B"},
+	{U"\u0154", U"\u0154", U"R\u0301", U"\u0154", U"R\u0301"},
+	{U"\u0155", U"\u0155", U"r\u0301", U"\u0155", U"r\u0301"},
+	{U"\u0156", U"\u0156", U"R\u0327", U"\u0156", U"R\u0327"},
+	{U"\u0157", U"\u0157", U"r\u0327", U"\u0157", U"r\u0327"},
+	{U"\u0158", U"\u0158", U"R\u030C", U"\u0158", U"R\u030C"},
+	{U"\u0159", U"\u0159", U"r\u030C", U"\u0159", U"r\u030C"},
+	{U"\u015A", U"\u015A", U"S\u0301", U"\u015A", U"S\u0301"},
+	{U"\u015B", U"\u015B", U"s\u0301", U"\u015B", U"s\u0301"},
+	{U"\u015C", U"\u015C", U"S\u0302", U"\u015C", U"S\u0302"},
+	{U"\u015D", U"\u015D", U"s\u0302", U"\u015D", U"s\u0302"},
+	{U"\u015E", U"\u015E", U"S\u0327", U"\u015E", U"S\u0327"},
+	{U"\u015F", U"\u015F", U"s\u0327", U"\u015F", U"s\u0327"},
+	{U"\u0160", U"\u0160", U"S\u030C", U"\u0160", U"S\u030C"},
+	{U"\u0161", U"\u0161", U"s\u030C", U"\u0161", U"s\u030C"},
+	{U"\u0162", U"\u0162", U"T\u0327", U"\u0162", U"T\u0327"},
+	{U"\u0163", U"\u0163", U"t\u0327", U"\u0163", U"t\u0327"},
+	{U"\u0164", U"\u0164", U"T\u030C", U"\u0164", U"T\u030C"},
+	{U"\u0165", U"\u0165", U"t\u030C", U"\u0165", U"t\u030C"},
+	{U"\u0168", U"\u0168", U"U\u0303", U"\u0168", U"U\u0303"},
+	{U"\u0169", U"\u0169", U"u\u0303", U"\u0169", U"u\u0303"},
+	{U"\u016A", U"\u016A", U"U\u0304", U"\u016A", U"U\u0304"},
+	{U"\u016B", U"\u016B", U"u\u0304", U"\u016B", U"u\u0304"},
+	{U"\u016C", U"\u016C", U"U\u0306", U"\u016C", U"U\u0306"},
+	{U"\u016D", U"\u016D", U"u\u0306", U"\u016D", U"u\u0306"},
+	{U"\u016E", U"\u016E", U"U\u030A", U"\u016E", U"U\u030A"},
+	{U"\u016F", U"\u016F", U"u\u030A", U"\u016F", U"u\u030A"},
+	{U"\u0170", U"\u0170", U"U\u030B", U"\u0170", U"U\u030B"},
+	{U"\u0171", U"\u0171", U"u\u030B", U"\u0171", U"u\u030B"},
+	{U"\u0172", U"\u0172", U"U\u0328", U"\u0172", U"U\u0328"},
+	{U"\u0173", U"\u0173", U"u\u0328", U"\u0173", U"u\u0328"},
+	{U"\u0174", U"\u0174", U"W\u0302", U"\u0174", U"W\u0302"},
+	{U"\u0175", U"\u0175", U"w\u0302", U"\u0175", U"w\u0302"},
+	{U"\u0176", U"\u0176", U"Y\u0302", U"\u0176", U"Y\u0302"},
+	{U"\u0177", U"\u0177", U"y\u0302", U"\u0177", U"y\u0302"},
+	{U"\u0178", U"\u0178", U"Y\u0308", U"\u0178", U"Y\u0308"},
+	{U"\u0179", U"\u0179", U"Z\u0301", U"\u0179", U"Z\u0301"},
+	{U"\u017A", U"\u017A", U"z\u0301", U"\u017A", U"z\u0301"},
+	{U"\u017B", U"\u017B", U"Z\u0307", U"\u017B", U"Z\u0307"},
+	{U"\u017C", U"\u017C", U"z\u0307", U"\u017C", U"z\u0307"},
+	{U"\u017D", U"\u017D", U"Z\u030C", U"\u017D", U"Z\u030C"},
+	{U"\u017E", U"\u017E", U"z\u030C", U"\u017E", U"z\u030C"},
+	{U"\u017F", U"\u017F", U"\u017F", U"s", U"s"},
+	{U"\u01A0", U"\u01A0", U"O\u031B", U"\u01A0", U"O\u031B"},
+	{U"\u01A1", U"\u01A1", U"o\u031B", U"\u01A1", U"o\u031B"},
+	{U"\u01AF", U"\u01AF", U"U\u031B", U"\u01AF", U"U\u031B"},
+	{U"\u01B0", U"\u01B0", U"u\u031B", U"\u01B0", U"u\u031B"},
+	{U"\u01C4", U"\u01C4", U"\u01C4", U"D\u017D", U"DZ\u030C"},
+	{U"\u01C5", U"\u01C5", U"\u01C5", U"D\u017E", U"Dz\u030C"},
+	{U"\u01C6", U"\u01C6", U"\u01C6", U"d\u017E", U"dz\u030C"},
+	{U"\u01C7", U"\u01C7", U"\u01C7", U"LJ", U"LJ"},
+	{U"\u01C8", U"\u01C8", U"\u01C8", U"Lj", U"Lj"},
+	{U"\u01C9", U"\u01C9", U"\u01C9", U"lj", U"lj"},
+	{U"\u01CA", U"\u01CA", U"\u01CA", U"NJ", U"NJ"},
+	{U"\u01CB", U"\u01CB", U"\u01CB", U"Nj", U"Nj"},
+	{U"\u01CC", U"\u01CC", U"\u01CC", U"nj", U"nj"},
+	{U"\u01CD", U"\u01CD", U"A\u030C", U"\u01CD", U"A\u030C"},
+	{U"\u01CE", U"\u01CE", U"a\u030C", U"\u01CE", U"a\u030C"},
+	{U"\u01CF", U"\u01CF", U"I\u030C", U"\u01CF", U"I\u030C"},
+	{U"\u01D0", U"\u01D0", U"i\u030C", U"\u01D0", U"i\u030C"},
+	{U"\u01D1", U"\u01D1", U"O\u030C", U"\u01D1", U"O\u030C"},
+	{U"\u01D2", U"\u01D2", U"o\u030C", U"\u01D2", U"o\u030C"},
+	{U"\u01D3", U"\u01D3", U"U\u030C", U"\u01D3", U"U\u030C"},
+	{U"\u01D4", U"\u01D4", U"u\u030C", U"\u01D4", U"u\u030C"},
+	{U"\u01D5", U"\u01D5", U"U\u0308\u0304", U"\u01D5", U"U\u0308\u0304"},
+	{U"\u01D6", U"\u01D6", U"u\u0308\u0304", U"\u01D6", U"u\u0308\u0304"},
+	{U"\u01D7", U"\u01D7", U"U\u0308\u0301", U"\u01D7", U"U\u0308\u0301"},
+	{U"\u01D8", U"\u01D8", U"u\u0308\u0301", U"\u01D8", U"u\u0308\u0301"},
+	{U"\u01D9", U"\u01D9", U"U\u0308\u030C", U"\u01D9", U"U\u0308\u030C"},
+	{U"\u01DA", U"\u01DA", U"u\u0308\u030C", U"\u01DA", U"u\u0308\u030C"},
+	{U"\u01DB", U"\u01DB", U"U\u0308\u0300", U"\u01DB", U"U\u0308\u0300"},
+	{U"\u01DC", U"\u01DC", U"u\u0308\u0300", U"\u01DC", U"u\u0308\u0300"},
+	{U"\u01DE", U"\u01DE", U"A\u0308\u0304", U"\u01DE", U"A\u0308\u0304"},
+	{U"\u01DF", U"\u01DF", U"a\u0308\u0304", U"\u01DF", U"a\u0308\u0304"},
+	{U"\u01E0", U"\u01E0", U"A\u0307\u0304", U"\u01E0", U"A\u0307\u0304"},
+	{U"\u01E1", U"\u01E1", U"a\u0307\u0304", U"\u01E1", U"a\u0307\u0304"},
+	{U"\u01E2", U"\u01E2", U"\u00C6\u0304", U"\u01E2", U"\u00C6\u0304"},
+	{U"\u01E3", U"\u01E3", U"\u00E6\u0304", U"\u01E3", U"\u00E6\u0304"},
+	{U"\u01E6", U"\u01E6", U"G\u030C", U"\u01E6", U"G\u030C"},
+	{U"\u01E7", U"\u01E7", U"g\u030C", U"\u01E7", U"g\u030C"},
+	{U"\u01E8", U"\u01E8", U"K\u030C", U"\u01E8", U"K\u030C"},
+	{U"\u01E9", U"\u01E9", U"k\u030C", U"\u01E9", U"k\u030C"},
+	{U"\u01EA", U"\u01EA", U"O\u0328", U"\u01EA", U"O\u0328"},
+	{U"\u01EB", U"\u01EB", U"o\u0328", U"\u01EB", U"o\u0328"},
+	{U"\u01EC", U"\u01EC", U"O\u0328\u0304", U"\u01EC", U"O\u0328\u0304"},
+	{U"\u01ED", U"\u01ED", U"o\u0328\u0304", U"\u01ED", U"o\u0328\u0304"},
+	{U"\u01EE", U"\u01EE", U"\u01B7\u030C", U"\u01EE", U"\u01B7\u030C"},
+	{U"\u01EF", U"\u01EF", U"\u0292\u030C", U"\u01EF", U"\u0292\u030C"},
+	{U"\u01F0", U"\u01F0", U"j\u030C", U"\u01F0", U"j\u030C"},
+	{U"\u01F1", U"\u01F1", U"\u01F1", U"DZ", U"DZ"},
+	{U"\u01F2", U"\u01F2", U"\u01F2", U"Dz", U"Dz"},
+	{U"\u01F3", U"\u01F3", U"\u01F3", U"dz", U"dz"},
+	{U"\u01F4", U"\u01F4", U"G\u0301", U"\u01F4", U"G\u0301"},
+	{U"\u01F5", U"\u01F5", U"g\u0301", U"\u01F5", U"g\u0301"},
+	{U"\u01F8", U"\u01F8", U"N\u0300", U"\u01F8", U"N\u0300"},
+	{U"\u01F9", U"\u01F9", U"n\u0300", U"\u01F9", U"n\u0300"},
+	{U"\u01FA", U"\u01FA", U"A\u030A\u0301", U"\u01FA", U"A\u030A\u0301"},
+	{U"\u01FB", U"\u01FB", U"a\u030A\u0301", U"\u01FB", U"a\u030A\u0301"},
+	{U"\u01FC", U"\u01FC", U"\u00C6\u0301", U"\u01FC", U"\u00C6\u0301"},
+	{U"\u01FD", U"\u01FD", U"\u00E6\u0301", U"\u01FD", U"\u00E6\u0301"},
+	{U"\u01FE", U"\u01FE", U"\u00D8\u0301", U"\u01FE", U"\u00D8\u0301"},
+	{U"\u01FF", U"\u01FF", U"\u00F8\u0301", U"\u01FF", U"\u00F8\u0301"},
+	{U"\u0200", U"\u0200", U"A\u030F", U"\u0200", U"A\u030F"},
+	{U"\u0201", U"\u0201", U"a\u030F", U"\u0201", U"a\u030F"},
+	{U"\u0202", U"\u0202", U"A\u0311", U"\u0202", U"A\u0311"},
+	{U"\u0203", U"\u0203", U"a\u0311", U"\u0203", U"a\u0311"},
+	{U"\u0204", U"\u0204", U"E\u030F", U"\u0204", U"E\u030F"},
+	{U"\u0205", U"\u0205", U"e\u030F", U"\u0205", U"e\u030F"},
+	{U"\u0206", U"\u0206", U"E\u0311", U"\u0206", U"E\u0311"},
+	{U"\u0207", U"\u0207", U"e\u0311", U"\u0207", U"e\u0311"},
+	{U"\u0208", U"\u0208", U"I\u030F", U"\u0208", U"I\u030F"},
+	{U"\u0209", U"\u0209", U"i\u030F", U"\u0209", U"i\u030F"},
+	{U"\u020A", U"\u020A", U"I\u0311", U"\u020A", U"I\u0311"},
+	{U"\u020B", U"\u020B", U"i\u0311", U"\u020B", U"i\u0311"},
+	{U"\u020C", U"\u020C", U"O\u030F", U"\u020C", U"O\u030F"},
+	{U"\u020D", U"\u020D", U"o\u030F", U"\u020D", U"o\u030F"},
+	{U"\u020E", U"\u020E", U"O\u0311", U"\u020E", U"O\u0311"},
+	{U"\u020F", U"\u020F", U"o\u0311", U"\u020F", U"o\u0311"},
+	{U"\u0210", U"\u0210", U"R\u030F", U"\u0210", U"R\u030F"},
+	{U"\u0211", U"\u0211", U"r\u030F", U"\u0211", U"r\u030F"},
+	{U"\u0212", U"\u0212", U"R\u0311", U"\u0212", U"R\u0311"},
+	{U"\u0213", U"\u0213", U"r\u0311", U"\u0213", U"r\u0311"},
+	{U"\u0214", U"\u0214", U"U\u030F", U"\u0214", U"U\u030F"},
+	{U"\u0215", U"\u0215", U"u\u030F", U"\u0215", U"u\u030F"},
+	{U"\u0216", U"\u0216", U"U\u0311", U"\u0216", U"U\u0311"},
+	{U"\u0217", U"\u0217", U"u\u0311", U"\u0217", U"u\u0311"},
+	{U"\u0218", U"\u0218", U"S\u0326", U"\u0218", U"S\u0326"},
+	{U"\u0219", U"\u0219", U"s\u0326", U"\u0219", U"s\u0326"},
+	{U"\u021A", U"\u021A", U"T\u0326", U"\u021A", U"T\u0326"},
+	{U"\u021B", U"\u021B", U"t\u0326", U"\u021B", U"t\u0326"},
+	{U"\u021E", U"\u021E", U"H\u030C", U"\u021E", U"H\u030C"},
+	{U"\u021F", U"\u021F", U"h\u030C", U"\u021F", U"h\u030C"},
+	{U"\u0226", U"\u0226", U"A\u0307", U"\u0226", U"A\u0307"},
+	{U"\u0227", U"\u0227", U"a\u0307", U"\u0227", U"a\u0307"},
+	{U"\u0228", U"\u0228", U"E\u0327", U"\u0228", U"E\u0327"},
+	{U"\u0229", U"\u0229", U"e\u0327", U"\u0229", U"e\u0327"},
+	{U"\u022A", U"\u022A", U"O\u0308\u0304", U"\u022A", U"O\u0308\u0304"},
+	{U"\u022B", U"\u022B", U"o\u0308\u0304", U"\u022B", U"o\u0308\u0304"},
+	{U"\u022C", U"\u022C", U"O\u0303\u0304", U"\u022C", U"O\u0303\u0304"},
+	{U"\u022D", U"\u022D", U"o\u0303\u0304", U"\u022D", U"o\u0303\u0304"},
+	{U"\u022E", U"\u022E", U"O\u0307", U"\u022E", U"O\u0307"},
+	{U"\u022F", U"\u022F", U"o\u0307", U"\u022F", U"o\u0307"},
+	{U"\u0230", U"\u0230", U"O\u0307\u0304", U"\u0230", U"O\u0307\u0304"},
+	{U"\u0231", U"\u0231", U"o\u0307\u0304", U"\u0231", U"o\u0307\u0304"},
+	{U"\u0232", U"\u0232", U"Y\u0304", U"\u0232", U"Y\u0304"},
+	{U"\u0233", U"\u0233", U"y\u0304", U"\u0233", U"y\u0304"},
+	{U"\u02B0", U"\u02B0", U"\u02B0", U"h", U"h"},
+	{U"\u02B1", U"\u02B1", U"\u02B1", U"\u0266", U"\u0266"},
+	{U"\u02B2", U"\u02B2", U"\u02B2", U"j", U"j"},
+	{U"\u02B3", U"\u02B3", U"\u02B3", U"r", U"r"},
+	{U"\u02B4", U"\u02B4", U"\u02B4", U"\u0279", U"\u0279"},
+	{U"\u02B5", U"\u02B5", U"\u02B5", U"\u027B", U"\u027B"},
+	{U"\u02B6", U"\u02B6", U"\u02B6", U"\u0281", U"\u0281"},
+	{U"\u02B7", U"\u02B7", U"\u02B7", U"w", U"w"},
+	{U"\u02B8", U"\u02B8", U"\u02B8", U"y", U"y"},
+	{U"\u02D8", U"\u02D8", U"\u02D8", U" \u0306", U" \u0306"},
+	{U"\u02D9", U"\u02D9", U"\u02D9", U" \u0307", U" \u0307"},
+	{U"\u02DA", U"\u02DA", U"\u02DA", U" \u030A", U" \u030A"},
+	{U"\u02DB", U"\u02DB", U"\u02DB", U" \u0328", U" \u0328"},
+	{U"\u02DC", U"\u02DC", U"\u02DC", U" \u0303", U" \u0303"},
+	{U"\u02DD", U"\u02DD", U"\u02DD", U" \u030B", U" \u030B"},
+	{U"\u02E0", U"\u02E0", U"\u02E0", U"\u0263", U"\u0263"},
+	{U"\u02E1", U"\u02E1", U"\u02E1", U"l", U"l"},
+	{U"\u02E2", U"\u02E2", U"\u02E2", U"s", U"s"},
+	{U"\u02E3", U"\u02E3", U"\u02E3", U"x", U"x"},
+	{U"\u02E4", U"\u02E4", U"\u02E4", U"\u0295", U"\u0295"},
+	{U"\u0300", U"\u0300", U"\u0300", U"\u0300", U"\u0300"},
+	{U"\u0301", U"\u0301", U"\u0301", U"\u0301", U"\u0301"},
+	{U"\u0302", U"\u0302", U"\u0302", U"\u0302", U"\u0302"},
+	{U"\u0303", U"\u0303", U"\u0303", U"\u0303", U"\u0303"},
+	{U"\u0304", U"\u0304", U"\u0304", U"\u0304", U"\u0304"},
+	{U"\u0306", U"\u0306", U"\u0306", U"\u0306", U"\u0306"},
+	{U"\u0307", U"\u0307", U"\u0307", U"\u0307", U"\u0307"},
+	{U"\u0308", U"\u0308", U"\u0308", U"\u0308", U"\u0308"},
+	{U"\u0309", U"\u0309", U"\u0309", U"\u0309", U"\u0309"},
+	{U"\u030A", U"\u030A", U"\u030A", U"\u030A", U"\u030A"},
+	{U"\u030B", U"\u030B", U"\u030B", U"\u030B", U"\u030B"},
+	{U"\u030C", U"\u030C", U"\u030C", U"\u030C", U"\u030C"},
+	{U"\u030F", U"\u030F", U"\u030F", U"\u030F", U"\u030F"},
+	{U"\u0311", U"\u0311", U"\u0311", U"\u0311", U"\u0311"},
+	{U"\u0313", U"\u0313", U"\u0313", U"\u0313", U"\u0313"},
+	{U"\u0314", U"\u0314", U"\u0314", U"\u0314", U"\u0314"},
+	{U"\u031B", U"\u031B", U"\u031B", U"\u031B", U"\u031B"},
+	{U"\u0323", U"\u0323", U"\u0323", U"\u0323", U"\u0323"},
+	{U"\u0324", U"\u0324", U"\u0324", U"\u0324", U"\u0324"},
+	{U"\u0325", U"\u0325", U"\u0325", U"\u0325", U"\u0325"},
+	{U"\u0326", U"\u0326", U"\u0326", U"\u0326", U"\u0326"},
+	{U"\u0327", U"\u0327", U"\u0327", U"\u0327", U"\u0327"},
+	{U"\u0328", U"\u0328", U"\u0328", U"\u0328", U"\u0328"},
+	{U"\u032D", U"\u032D", U"\u032D", U"\u032D", U"\u032D"},
+	{U"\u032E", U"\u032E", U"\u032E", U"\u032E", U"\u032E"},
+	{U"\u0330", U"\u0330", U"\u0330", U"\u0330", U"\u0330"},
+	{U"\u0331", U"\u0331", U"\u0331", U"\u0331", U"\u0331"},
+	{U"\u0338", U"\u0338", U"\u0338", U"\u0338", U"\u0338"},
+	{U"\u0340", U"\u0300", U"\u0300", U"\u0300", U"\u0300"},
+	{U"\u0341", U"\u0301", U"\u0301", U"\u0301", U"\u0301"},
+	{U"\u0342", U"\u0342", U"\u0342", U"\u0342", U"\u0342"},
+	{U"\u0343", U"\u0313", U"\u0313", U"\u0313", U"\u0313"},
+	{U"\u0344", U"\u0308\u0301", U"\u0308\u0301", U"\u0308\u0301", U"\u0308\u0301"},
+	{U"\u0345", U"\u0345", U"\u0345", U"\u0345", U"\u0345"},
+	{U"\u0374", U"\u02B9", U"\u02B9", U"\u02B9", U"\u02B9"},
+	{U"\u037A", U"\u037A", U"\u037A", U" \u0345", U" \u0345"},
+	{U"\u037E", U";", U";", U";", U";"},
+	{U"\u0384", U"\u0384", U"\u0384", U" \u0301", U" \u0301"},
+	{U"\u0385", U"\u0385", U"\u00A8\u0301", U" \u0308\u0301", U" \u0308\u0301"},
+	{U"\u0386", U"\u0386", U"\u0391\u0301", U"\u0386", U"\u0391\u0301"},
+	{U"\u0387", U"\u00B7", U"\u00B7", U"\u00B7", U"\u00B7"},
+	{U"\u0388", U"\u0388", U"\u0395\u0301", U"\u0388", U"\u0395\u0301"},
+	{U"\u0389", U"\u0389", U"\u0397\u0301", U"\u0389", U"\u0397\u0301"},
+	{U"\u038A", U"\u038A", U"\u0399\u0301", U"\u038A", U"\u0399\u0301"},
+	{U"\u038C", U"\u038C", U"\u039F\u0301", U"\u038C", U"\u039F\u0301"},
+	{U"\u038E", U"\u038E", U"\u03A5\u0301", U"\u038E", U"\u03A5\u0301"},
+	{U"\u038F", U"\u038F", U"\u03A9\u0301", U"\u038F", U"\u03A9\u0301"},
+	{U"\u0390", U"\u0390", U"\u03B9\u0308\u0301", U"\u0390", U"\u03B9\u0308\u0301"},
+	{U"\u03AA", U"\u03AA", U"\u0399\u0308", U"\u03AA", U"\u0399\u0308"},
+	{U"\u03AB", U"\u03AB", U"\u03A5\u0308", U"\u03AB", U"\u03A5\u0308"},
+	{U"\u03AC", U"\u03AC", U"\u03B1\u0301", U"\u03AC", U"\u03B1\u0301"},
+	{U"\u03AD", U"\u03AD", U"\u03B5\u0301", U"\u03AD", U"\u03B5\u0301"},
+	{U"\u03AE", U"\u03AE", U"\u03B7\u0301", U"\u03AE", U"\u03B7\u0301"},
+	{U"\u03AF", U"\u03AF", U"\u03B9\u0301", U"\u03AF", U"\u03B9\u0301"},
+	{U"\u03B0", U"\u03B0", U"\u03C5\u0308\u0301", U"\u03B0", U"\u03C5\u0308\u0301"},
+	{U"\u03CA", U"\u03CA", U"\u03B9\u0308", U"\u03CA", U"\u03B9\u0308"},
+	{U"\u03CB", U"\u03CB", U"\u03C5\u0308", U"\u03CB", U"\u03C5\u0308"},
+	{U"\u03CC", U"\u03CC", U"\u03BF\u0301", U"\u03CC", U"\u03BF\u0301"},
+	{U"\u03CD", U"\u03CD", U"\u03C5\u0301", U"\u03CD", U"\u03C5\u0301"},
+	{U"\u03CE", U"\u03CE", U"\u03C9\u0301", U"\u03CE", U"\u03C9\u0301"},
+	{U"\u03D0", U"\u03D0", U"\u03D0", U"\u03B2", U"\u03B2"},
+	{U"\u03D1", U"\u03D1", U"\u03D1", U"\u03B8", U"\u03B8"},
+	{U"\u03D2", U"\u03D2", U"\u03D2", U"\u03A5", U"\u03A5"},
+	{U"\u03D3", U"\u03D3", U"\u03D2\u0301", U"\u038E", U"\u03A5\u0301"},
+	{U"\u03D4", U"\u03D4", U"\u03D2\u0308", U"\u03AB", U"\u03A5\u0308"},
+	{U"\u03D5", U"\u03D5", U"\u03D5", U"\u03C6", U"\u03C6"},
+	{U"\u03D6", U"\u03D6", U"\u03D6", U"\u03C0", U"\u03C0"},
+	{U"\u03F0", U"\u03F0", U"\u03F0", U"\u03BA", U"\u03BA"},
+	{U"\u03F1", U"\u03F1", U"\u03F1", U"\u03C1", U"\u03C1"},
+	{U"\u03F2", U"\u03F2", U"\u03F2", U"\u03C2", U"\u03C2"},
+	{U"\u03F4", U"\u03F4", U"\u03F4", U"\u0398", U"\u0398"},
+	{U"\u03F5", U"\u03F5", U"\u03F5", U"\u03B5", U"\u03B5"},
+	{U"\u03F9", U"\u03F9", U"\u03F9", U"\u03A3", U"\u03A3"},
+	{U"\u0400", U"\u0400", U"\u0415\u0300", U"\u0400", U"\u0415\u0300"},
+	{U"\u0401", U"\u0401", U"\u0415\u0308", U"\u0401", U"\u0415\u0308"},
+	{U"\u0403", U"\u0403", U"\u0413\u0301", U"\u0403", U"\u0413\u0301"},
+	{U"\u0407", U"\u0407", U"\u0406\u0308", U"\u0407", U"\u0406\u0308"},
+	{U"\u040C", U"\u040C", U"\u041A\u0301", U"\u040C", U"\u041A\u0301"},
+	{U"\u040D", U"\u040D", U"\u0418\u0300", U"\u040D", U"\u0418\u0300"},
+	{U"\u040E", U"\u040E", U"\u0423\u0306", U"\u040E", U"\u0423\u0306"},
+	{U"\u0419", U"\u0419", U"\u0418\u0306", U"\u0419", U"\u0418\u0306"},
+	{U"\u0439", U"\u0439", U"\u0438\u0306", U"\u0439", U"\u0438\u0306"},
+	{U"\u0450", U"\u0450", U"\u0435\u0300", U"\u0450", U"\u0435\u0300"},
+	{U"\u0451", U"\u0451", U"\u0435\u0308", U"\u0451", U"\u0435\u0308"},
+	{U"\u0453", U"\u0453", U"\u0433\u0301", U"\u0453", U"\u0433\u0301"},
+	{U"\u0457", U"\u0457", U"\u0456\u0308", U"\u0457", U"\u0456\u0308"},
+	{U"\u045C", U"\u045C", U"\u043A\u0301", U"\u045C", U"\u043A\u0301"},
+	{U"\u045D", U"\u045D", U"\u0438\u0300", U"\u045D", U"\u0438\u0300"},
+	{U"\u045E", U"\u045E", U"\u0443\u0306", U"\u045E", U"\u0443\u0306"},
+	{U"\u0476", U"\u0476", U"\u0474\u030F", U"\u0476", U"\u0474\u030F"},
+	{U"\u0477", U"\u0477", U"\u0475\u030F", U"\u0477", U"\u0475\u030F"},
+	{U"\u04C1", U"\u04C1", U"\u0416\u0306", U"\u04C1", U"\u0416\u0306"},
+	{U"\u04C2", U"\u04C2", U"\u0436\u0306", U"\u04C2", U"\u0436\u0306"},
+	{U"\u04D0", U"\u04D0", U"\u0410\u0306", U"\u04D0", U"\u0410\u0306"},
+	{U"\u04D1", U"\u04D1", U"\u0430\u0306", U"\u04D1", U"\u0430\u0306"},
+	{U"\u04D2", U"\u04D2", U"\u0410\u0308", U"\u04D2", U"\u0410\u0308"},
+	{U"\u04D3", U"\u04D3", U"\u0430\u0308", U"\u04D3", U"\u0430\u0308"},
+	{U"\u04D6", U"\u04D6", U"\u0415\u0306", U"\u04D6", U"\u0415\u0306"},
+	{U"\u04D7", U"\u04D7", U"\u0435\u0306", U"\u04D7", U"\u0435\u0306"},
+	{U"\u04DA", U"\u04DA", U"\u04D8\u0308", U"\u04DA", U"\u04D8\u0308"},
+	{U"\u04DB", U"\u04DB", U"\u04D9\u0308", U"\u04DB", U"\u04D9\u0308"},
+	{U"\u04DC", U"\u04DC", U"\u0416\u0308", U"\u04DC", U"\u0416\u0308"},
+	{U"\u04DD", U"\u04DD", U"\u0436\u0308", U"\u04DD", U"\u0436\u0308"},
+	{U"\u04DE", U"\u04DE", U"\u0417\u0308", U"\u04DE", U"\u0417\u0308"},
+	{U"\u04DF", U"\u04DF", U"\u0437\u0308", U"\u04DF", U"\u0437\u0308"},
+	{U"\u04E2", U"\u04E2", U"\u0418\u0304", U"\u04E2", U"\u0418\u0304"},
+	{U"\u04E3", U"\u04E3", U"\u0438\u0304", U"\u04E3", U"\u0438\u0304"},
+	{U"\u04E4", U"\u04E4", U"\u0418\u0308", U"\u04E4", U"\u0418\u0308"},
+	{U"\u04E5", U"\u04E5", U"\u0438\u0308", U"\u04E5", U"\u0438\u0308"},
+	{U"\u04E6", U"\u04E6", U"\u041E\u0308", U"\u04E6", U"\u041E\u0308"},
+	{U"\u04E7", U"\u04E7", U"\u043E\u0308", U"\u04E7", U"\u043E\u0308"},
+	{U"\u04EA", U"\u04EA", U"\u04E8\u0308", U"\u04EA", U"\u04E8\u0308"},
+	{U"\u04EB", U"\u04EB", U"\u04E9\u0308", U"\u04EB", U"\u04E9\u0308"},
+	{U"\u04EC", U"\u04EC", U"\u042D\u0308", U"\u04EC", U"\u042D\u0308"},
+	{U"\u04ED", U"\u04ED", U"\u044D\u0308", U"\u04ED", U"\u044D\u0308"},
+	{U"\u04EE", U"\u04EE", U"\u0423\u0304", U"\u04EE", U"\u0423\u0304"},
+	{U"\u04EF", U"\u04EF", U"\u0443\u0304", U"\u04EF", U"\u0443\u0304"},
+	{U"\u04F0", U"\u04F0", U"\u0423\u0308", U"\u04F0", U"\u0423\u0308"},
+	{U"\u04F1", U"\u04F1", U"\u0443\u0308", U"\u04F1", U"\u0443\u0308"},
+	{U"\u04F2", U"\u04F2", U"\u0423\u030B", U"\u04F2", U"\u0423\u030B"},
+	{U"\u04F3", U"\u04F3", U"\u0443\u030B", U"\u04F3", U"\u0443\u030B"},
+	{U"\u04F4", U"\u04F4", U"\u0427\u0308", U"\u04F4", U"\u0427\u0308"},
+	{U"\u04F5", U"\u04F5", U"\u0447\u0308", U"\u04F5", U"\u0447\u0308"},
+	{U"\u04F8", U"\u04F8", U"\u042B\u0308", U"\u04F8", U"\u042B\u0308"},
+	{U"\u04F9", U"\u04F9", U"\u044B\u0308", U"\u04F9", U"\u044B\u0308"},
+	{U"\u0587", U"\u0587", U"\u0587", U"\u0565\u0582", U"\u0565\u0582"},
+	{U"\u0622", U"\u0622", U"\u0627\u0653", U"\u0622", U"\u0627\u0653"},
+	{U"\u0623", U"\u0623", U"\u0627\u0654", U"\u0623", U"\u0627\u0654"},
+	{U"\u0624", U"\u0624", U"\u0648\u0654", U"\u0624", U"\u0648\u0654"},
+	{U"\u0625", U"\u0625", U"\u0627\u0655", U"\u0625", U"\u0627\u0655"},
+	{U"\u0626", U"\u0626", U"\u064A\u0654", U"\u0626", U"\u064A\u0654"},
+	{U"\u0653", U"\u0653", U"\u0653", U"\u0653", U"\u0653"},
+	{U"\u0654", U"\u0654", U"\u0654", U"\u0654", U"\u0654"},
+	{U"\u0655", U"\u0655", U"\u0655", U"\u0655", U"\u0655"},
+	{U"\u0675", U"\u0675", U"\u0675", U"\u0627\u0674", U"\u0627\u0674"},
+	{U"\u0676", U"\u0676", U"\u0676", U"\u0648\u0674", U"\u0648\u0674"},
+	{U"\u0677", U"\u0677", U"\u0677", U"\u06C7\u0674", U"\u06C7\u0674"},
+	{U"\u0678", U"\u0678", U"\u0678", U"\u064A\u0674", U"\u064A\u0674"},
+	{U"\u06C0", U"\u06C0", U"\u06D5\u0654", U"\u06C0", U"\u06D5\u0654"},
+	{U"\u06C2", U"\u06C2", U"\u06C1\u0654", U"\u06C2", U"\u06C1\u0654"},
+	{U"\u06D3", U"\u06D3", U"\u06D2\u0654", U"\u06D3", U"\u06D2\u0654"},
+	{U"\u0929", U"\u0929", U"\u0928\u093C", U"\u0929", U"\u0928\u093C"},
+	{U"\u0931", U"\u0931", U"\u0930\u093C", U"\u0931", U"\u0930\u093C"},
+	{U"\u0934", U"\u0934", U"\u0933\u093C", U"\u0934", U"\u0933\u093C"},
+	{U"\u093C", U"\u093C", U"\u093C", U"\u093C", U"\u093C"},
+	{U"\u0958", U"\u0915\u093C", U"\u0915\u093C", U"\u0915\u093C", U"\u0915\u093C"},
+	{U"\u0959", U"\u0916\u093C", U"\u0916\u093C", U"\u0916\u093C", U"\u0916\u093C"},
+	{U"\u095A", U"\u0917\u093C", U"\u0917\u093C", U"\u0917\u093C", U"\u0917\u093C"},
+	{U"\u095B", U"\u091C\u093C", U"\u091C\u093C", U"\u091C\u093C", U"\u091C\u093C"},
+	{U"\u095C", U"\u0921\u093C", U"\u0921\u093C", U"\u0921\u093C", U"\u0921\u093C"},
+	{U"\u095D", U"\u0922\u093C", U"\u0922\u093C", U"\u0922\u093C", U"\u0922\u093C"},
+	{U"\u095E", U"\u092B\u093C", U"\u092B\u093C", U"\u092B\u093C", U"\u092B\u093C"},
+	{U"\u095F", U"\u092F\u093C", U"\u092F\u093C", U"\u092F\u093C", U"\u092F\u093C"},
+	{U"\u09BE", U"\u09BE", U"\u09BE", U"\u09BE", U"\u09BE"},
+	{U"\u09CB", U"\u09CB", U"\u09C7\u09BE", U"\u09CB", U"\u09C7\u09BE"},
+	{U"\u09CC", U"\u09CC", U"\u09C7\u09D7", U"\u09CC", U"\u09C7\u09D7"},
+	{U"\u09D7", U"\u09D7", U"\u09D7", U"\u09D7", U"\u09D7"},
+	{U"\u09DC", U"\u09A1\u09BC", U"\u09A1\u09BC", U"\u09A1\u09BC", U"\u09A1\u09BC"},
+	{U"\u09DD", U"\u09A2\u09BC", U"\u09A2\u09BC", U"\u09A2\u09BC", U"\u09A2\u09BC"},
+	{U"\u09DF", U"\u09AF\u09BC", U"\u09AF\u09BC", U"\u09AF\u09BC", U"\u09AF\u09BC"},
+	{U"\u0A33", U"\u0A32\u0A3C", U"\u0A32\u0A3C", U"\u0A32\u0A3C", U"\u0A32\u0A3C"},
+	{U"\u0A36", U"\u0A38\u0A3C", U"\u0A38\u0A3C", U"\u0A38\u0A3C", U"\u0A38\u0A3C"},
+	{U"\u0A59", U"\u0A16\u0A3C", U"\u0A16\u0A3C", U"\u0A16\u0A3C", U"\u0A16\u0A3C"},
+	{U"\u0A5A", U"\u0A17\u0A3C", U"\u0A17\u0A3C", U"\u0A17\u0A3C", U"\u0A17\u0A3C"},
+	{U"\u0A5B", U"\u0A1C\u0A3C", U"\u0A1C\u0A3C", U"\u0A1C\u0A3C", U"\u0A1C\u0A3C"},
+	{U"\u0A5E", U"\u0A2B\u0A3C", U"\u0A2B\u0A3C", U"\u0A2B\u0A3C", U"\u0A2B\u0A3C"},
+	{U"\u0B3E", U"\u0B3E", U"\u0B3E", U"\u0B3E", U"\u0B3E"},
+	{U"\u0B48", U"\u0B48", U"\u0B47\u0B56", U"\u0B48", U"\u0B47\u0B56"},
+	{U"\u0B4B", U"\u0B4B", U"\u0B47\u0B3E", U"\u0B4B", U"\u0B47\u0B3E"},
+	{U"\u0B4C", U"\u0B4C", U"\u0B47\u0B57", U"\u0B4C", U"\u0B47\u0B57"},
+	{U"\u0B56", U"\u0B56", U"\u0B56", U"\u0B56", U"\u0B56"},
+	{U"\u0B57", U"\u0B57", U"\u0B57", U"\u0B57", U"\u0B57"},
+	{U"\u0B5C", U"\u0B21\u0B3C", U"\u0B21\u0B3C", U"\u0B21\u0B3C", U"\u0B21\u0B3C"},
+	{U"\u0B5D", U"\u0B22\u0B3C", U"\u0B22\u0B3C", U"\u0B22\u0B3C", U"\u0B22\u0B3C"},
+	{U"\u0B94", U"\u0B94", U"\u0B92\u0BD7", U"\u0B94", U"\u0B92\u0BD7"},
+	{U"\u0BBE", U"\u0BBE", U"\u0BBE", U"\u0BBE", U"\u0BBE"},
+	{U"\u0BCA", U"\u0BCA", U"\u0BC6\u0BBE", U"\u0BCA", U"\u0BC6\u0BBE"},
+	{U"\u0BCB", U"\u0BCB", U"\u0BC7\u0BBE", U"\u0BCB", U"\u0BC7\u0BBE"},
+	{U"\u0BCC", U"\u0BCC", U"\u0BC6\u0BD7", U"\u0BCC", U"\u0BC6\u0BD7"},
+	{U"\u0BD7", U"\u0BD7", U"\u0BD7", U"\u0BD7", U"\u0BD7"},
+	{U"\u0C48", U"\u0C48", U"\u0C46\u0C56", U"\u0C48", U"\u0C46\u0C56"},
+	{U"\u0C56", U"\u0C56", U"\u0C56", U"\u0C56", U"\u0C56"},
+	{U"\u0CC0", U"\u0CC0", U"\u0CBF\u0CD5", U"\u0CC0", U"\u0CBF\u0CD5"},
+	{U"\u0CC2", U"\u0CC2", U"\u0CC2", U"\u0CC2", U"\u0CC2"},
+	{U"\u0CC7", U"\u0CC7", U"\u0CC6\u0CD5", U"\u0CC7", U"\u0CC6\u0CD5"},
+	{U"\u0CC8", U"\u0CC8", U"\u0CC6\u0CD6", U"\u0CC8", U"\u0CC6\u0CD6"},
+	{U"\u0CCA", U"\u0CCA", U"\u0CC6\u0CC2", U"\u0CCA", U"\u0CC6\u0CC2"},
+	{U"\u0CCB", U"\u0CCB", U"\u0CC6\u0CC2\u0CD5", U"\u0CCB", U"\u0CC6\u0CC2\u0CD5"},
+	{U"\u0CD5", U"\u0CD5", U"\u0CD5", U"\u0CD5", U"\u0CD5"},
+	{U"\u0CD6", U"\u0CD6", U"\u0CD6", U"\u0CD6", U"\u0CD6"},
+	{U"\u0D3E", U"\u0D3E", U"\u0D3E", U"\u0D3E", U"\u0D3E"},
+	{U"\u0D4A", U"\u0D4A", U"\u0D46\u0D3E", U"\u0D4A", U"\u0D46\u0D3E"},
+	{U"\u0D4B", U"\u0D4B", U"\u0D47\u0D3E", U"\u0D4B", U"\u0D47\u0D3E"},
+	{U"\u0D4C", U"\u0D4C", U"\u0D46\u0D57", U"\u0D4C", U"\u0D46\u0D57"},
+	{U"\u0D57", U"\u0D57", U"\u0D57", U"\u0D57", U"\u0D57"},
+	{U"\u0DCA", U"\u0DCA", U"\u0DCA", U"\u0DCA", U"\u0DCA"},
+	{U"\u0DCF", U"\u0DCF", U"\u0DCF", U"\u0DCF", U"\u0DCF"},
+	{U"\u0DDA", U"\u0DDA", U"\u0DD9\u0DCA", U"\u0DDA", U"\u0DD9\u0DCA"},
+	{U"\u0DDC", U"\u0DDC", U"\u0DD9\u0DCF", U"\u0DDC", U"\u0DD9\u0DCF"},
+	{U"\u0DDD", U"\u0DDD", U"\u0DD9\u0DCF\u0DCA", U"\u0DDD", U"\u0DD9\u0DCF\u0DCA"},
+	{U"\u0DDE", U"\u0DDE", U"\u0DD9\u0DDF", U"\u0DDE", U"\u0DD9\u0DDF"},
+	{U"\u0DDF", U"\u0DDF", U"\u0DDF", U"\u0DDF", U"\u0DDF"},
+	{U"\u0E33", U"\u0E33", U"\u0E33", U"\u0E4D\u0E32", U"\u0E4D\u0E32"},
+	{U"\u0EB3", U"\u0EB3", U"\u0EB3", U"\u0ECD\u0EB2", U"\u0ECD\u0EB2"},
+	{U"\u0EDC", U"\u0EDC", U"\u0EDC", U"\u0EAB\u0E99", U"\u0EAB\u0E99"},
+	{U"\u0EDD", U"\u0EDD", U"\u0EDD", U"\u0EAB\u0EA1", U"\u0EAB\u0EA1"},
+	{U"\u0F0C", U"\u0F0C", U"\u0F0C", U"\u0F0B", U"\u0F0B"},
+	{U"\u0F43", U"\u0F42\u0FB7", U"\u0F42\u0FB7", U"\u0F42\u0FB7", U"\u0F42\u0FB7"},
+	{U"\u0F4D", U"\u0F4C\u0FB7", U"\u0F4C\u0FB7", U"\u0F4C\u0FB7", U"\u0F4C\u0FB7"},
+	{U"\u0F52", U"\u0F51\u0FB7", U"\u0F51\u0FB7", U"\u0F51\u0FB7", U"\u0F51\u0FB7"},
+	{U"\u0F57", U"\u0F56\u0FB7", U"\u0F56\u0FB7", U"\u0F56\u0FB7", U"\u0F56\u0FB7"},
+	{U"\u0F5C", U"\u0F5B\u0FB7", U"\u0F5B\u0FB7", U"\u0F5B\u0FB7", U"\u0F5B\u0FB7"},
+	{U"\u0F69", U"\u0F40\u0FB5", U"\u0F40\u0FB5", U"\u0F40\u0FB5", U"\u0F40\u0FB5"},
+	{U"\u0F73", U"\u0F71\u0F72", U"\u0F71\u0F72", U"\u0F71\u0F72", U"\u0F71\u0F72"},
+	{U"\u0F75", U"\u0F71\u0F74", U"\u0F71\u0F74", U"\u0F71\u0F74", U"\u0F71\u0F74"},
+	{U"\u0F76", U"\u0FB2\u0F80", U"\u0FB2\u0F80", U"\u0FB2\u0F80", U"\u0FB2\u0F80"},
+	{U"\u0F77", U"\u0F77", U"\u0F77", U"\u0FB2\u0F71\u0F80", U"\u0FB2\u0F71\u0F80"},
+	{U"\u0F78", U"\u0FB3\u0F80", U"\u0FB3\u0F80", U"\u0FB3\u0F80", U"\u0FB3\u0F80"},
+	{U"\u0F79", U"\u0F79", U"\u0F79", U"\u0FB3\u0F71\u0F80", U"\u0FB3\u0F71\u0F80"},
+	{U"\u0F81", U"\u0F71\u0F80", U"\u0F71\u0F80", U"\u0F71\u0F80", U"\u0F71\u0F80"},
+	{U"\u0F93", U"\u0F92\u0FB7", U"\u0F92\u0FB7", U"\u0F92\u0FB7", U"\u0F92\u0FB7"},
+	{U"\u0F9D", U"\u0F9C\u0FB7", U"\u0F9C\u0FB7", U"\u0F9C\u0FB7", U"\u0F9C\u0FB7"},
+	{U"\u0FA2", U"\u0FA1\u0FB7", U"\u0FA1\u0FB7", U"\u0FA1\u0FB7", U"\u0FA1\u0FB7"},
+	{U"\u0FA7", U"\u0FA6\u0FB7", U"\u0FA6\u0FB7", U"\u0FA6\u0FB7", U"\u0FA6\u0FB7"},
+	{U"\u0FAC", U"\u0FAB\u0FB7", U"\u0FAB\u0FB7", U"\u0FAB\u0FB7", U"\u0FAB\u0FB7"},
+	{U"\u0FB9", U"\u0F90\u0FB5", U"\u0F90\u0FB5", U"\u0F90\u0FB5", U"\u0F90\u0FB5"},
+	{U"\u1026", U"\u1026", U"\u1025\u102E", U"\u1026", U"\u1025\u102E"},
+	{U"\u102E", U"\u102E", U"\u102E", U"\u102E", U"\u102E"},
+	{U"\u10FC", U"\u10FC", U"\u10FC", U"\u10DC", U"\u10DC"},
+	{U"\u1161", U"\u1161", U"\u1161", U"\u1161", U"\u1161"},
+	{U"\u1162", U"\u1162", U"\u1162", U"\u1162", U"\u1162"},
+	{U"\u1163", U"\u1163", U"\u1163", U"\u1163", U"\u1163"},
+	{U"\u1164", U"\u1164", U"\u1164", U"\u1164", U"\u1164"},
+	{U"\u1165", U"\u1165", U"\u1165", U"\u1165", U"\u1165"},
+	{U"\u1166", U"\u1166", U"\u1166", U"\u1166", U"\u1166"},
+	{U"\u1167", U"\u1167", U"\u1167", U"\u1167", U"\u1167"},
+	{U"\u1168", U"\u1168", U"\u1168", U"\u1168", U"\u1168"},
+	{U"\u1169", U"\u1169", U"\u1169", U"\u1169", U"\u1169"},
+	{U"\u116A", U"\u116A", U"\u116A", U"\u116A", U"\u116A"},
+	{U"\u116B", U"\u116B", U"\u116B", U"\u116B", U"\u116B"},
+	{U"\u116C", U"\u116C", U"\u116C", U"\u116C", U"\u116C"},
+	{U"\u116D", U"\u116D", U"\u116D", U"\u116D", U"\u116D"},
+	{U"\u116E", U"\u116E", U"\u116E", U"\u116E", U"\u116E"},
+	{U"\u116F", U"\u116F", U"\u116F", U"\u116F", U"\u116F"},
+	{U"\u1170", U"\u1170", U"\u1170", U"\u1170", U"\u1170"},
+	{U"\u1171", U"\u1171", U"\u1171", U"\u1171", U"\u1171"},
+	{U"\u1172", U"\u1172", U"\u1172", U"\u1172", U"\u1172"},
+	{U"\u1173", U"\u1173", U"\u1173", U"\u1173", U"\u1173"},
+	{U"\u1174", U"\u1174", U"\u1174", U"\u1174", U"\u1174"},
+	{U"\u1175", U"\u1175", U"\u1175", U"\u1175", U"\u1175"},
+	{U"\u11A8", U"\u11A8", U"\u11A8", U"\u11A8", U"\u11A8"},
+	{U"\u11A9", U"\u11A9", U"\u11A9", U"\u11A9", U"\u11A9"},
+	{U"\u11AA", U"\u11AA", U"\u11AA", U"\u11AA", U"\u11AA"},
+	{U"\u11AB", U"\u11AB", U"\u11AB", U"\u11AB", U"\u11AB"},
+	{U"\u11AC", U"\u11AC", U"\u11AC", U"\u11AC", U"\u11AC"},
+	{U"\u11AD", U"\u11AD", U"\u11AD", U"\u11AD", U"\u11AD"},
+	{U"\u11AE", U"\u11AE", U"\u11AE", U"\u11AE", U"\u11AE"},
+	{U"\u11AF", U"\u11AF", U"\u11AF", U"\u11AF", U"\u11AF"},
+	{U"\u11B0", U"\u11B0", U"\u11B0", U"\u11B0", U"\u11B0"},
+	{U"\u11B1", U"\u11B1", U"\u11B1", U"\u11B1", U"\u11B1"},
+	{U"\u11B2", U"\u11B2", U"\u11B2", U"\u11B2", U"\u11B2"},
+	{U"\u11B3", U"\u11B3", U"\u11B3", U"\u11B3", U"\u11B3"},
+	{U"\u11B4", U"\u11B4", U"\u11B4", U"\u11B4", U"\u11B4"},
+	{U"\u11B5", U"\u11B5", U"\u11B5", U"\u11B5", U"\u11B5"},
+	{U"\u11B6", U"\u11B6", U"\u11B6", U"\u11B6", U"\u11B6"},
+	{U"\u11B7", U"\u11B7", U"\u11B7", U"\u11B7", U"\u11B7"},
+	{U"\u11B8", U"\u11B8", U"\u11B8", U"\u11B8", U"\u11B8"},
+	{U"\u11B9", U"\u11B9", U"\u11B9", U"\u11B9", U"\u11B9"},
+	{U"\u11BA", U"\u11BA", U"\u11BA", U"\u11BA", U"\u11BA"},
+	{U"\u11BB", U"\u11BB", U"\u11BB", U"\u11BB", U"\u11BB"},
+	{U"\u11BC", U"\u11BC", U"\u11BC", U"\u11BC", U"\u11BC"},
+	{U"\u11BD", U"\u11BD", U"\u11BD", U"\u11BD", U"\u11BD"},
+	{U"\u11BE", U"\u11BE", U"\u11BE", U"\u11BE", U"\u11BE"},
+	{U"\u11BF", U"\u11BF", U"\u11BF", U"\u11BF", U"\u11BF"},
+	{U"\u11C0", U"\u11C0", U"\u11C0", U"\u11C0", U"\u11C0"},
+	{U"\u11C1", U"\u11C1", U"\u11C1", U"\u11C1", U"\u11C1"},
+	{U"\u11C2", U"\u11C2", U"\u11C2", U"\u11C2", U"\u11C2"},
+	{U"\u1B06", U"\u1B06", U"\u1B05\u1B35", U"\u1B06", U"\u1B05\u1B35"},
+	{U"\u1B08", U"\u1B08", U"\u1B07\u1B35", U"\u1B08", U"\u1B07\u1B35"},
+	{U"\u1B0A", U"\u1B0A", U"\u1B09\u1B35", U"\u1B0A", U"\u1B09\u1B35"},
+	{U"\u1B0C", U"\u1B0C", U"\u1B0B\u1B35", U"\u1B0C", U"\u1B0B\u1B35"},
+	{U"\u1B0E", U"\u1B0E", U"\u1B0D\u1B35", U"\u1B0E", U"\u1B0D\u1B35"},
+	{U"\u1B12", U"\u1B12", U"\u1B11\u1B35", U"\u1B12", U"\u1B11\u1B35"},
+	{U"\u1B35", U"\u1B35", U"\u1B35", U"\u1B35", U"\u1B35"},
+	{U"\u1B3B", U"\u1B3B", U"\u1B3A\u1B35", U"\u1B3B", U"\u1B3A\u1B35"},
+	{U"\u1B3D", U"\u1B3D", U"\u1B3C\u1B35", U"\u1B3D", U"\u1B3C\u1B35"},
+	{U"\u1B40", U"\u1B40", U"\u1B3E\u1B35", U"\u1B40", U"\u1B3E\u1B35"},
+	{U"\u1B41", U"\u1B41", U"\u1B3F\u1B35", U"\u1B41", U"\u1B3F\u1B35"},
+	{U"\u1B43", U"\u1B43", U"\u1B42\u1B35", U"\u1B43", U"\u1B42\u1B35"},
+	{U"\u1D2C", U"\u1D2C", U"\u1D2C", U"A", U"A"},
+	{U"\u1D2D", U"\u1D2D", U"\u1D2D", U"\u00C6", U"\u00C6"},
+	{U"\u1D2E", U"\u1D2E", U"\u1D2E", U"B", U"B"},
+	{U"\u1D30", U"\u1D30", U"\u1D30", U"D", U"D"},
+	{U"\u1D31", U"\u1D31", U"\u1D31", U"E", U"E"},
+	{U"\u1D32", U"\u1D32", U"\u1D32", U"\u018E", U"\u018E"},
+	{U"\u1D33", U"\u1D33", U"\u1D33", U"G", U"G"},
+	{U"\u1D34", U"\u1D34", U"\u1D34", U"H", U"H"},
+	{U"\u1D35", U"\u1D35", U"\u1D35", U"I", U"I"},
+	{U"\u1D36", U"\u1D36", U"\u1D36", U"J", U"J"},
+	{U"\u1D37", U"\u1D37", U"\u1D37", U"K", U"K"},
+	{U"\u1D38", U"\u1D38", U"\u1D38", U"L", U"L"},
+	{U"\u1D39", U"\u1D39", U"\u1D39", U"M", U"M"},
+	{U"\u1D3A", U"\u1D3A", U"\u1D3A", U"N", U"N"},
+	{U"\u1D3C", U"\u1D3C", U"\u1D3C", U"O", U"O"},
+	{U"\u1D3D", U"\u1D3D", U"\u1D3D", U"\u0222", U"\u0222"},
+	{U"\u1D3E", U"\u1D3E", U"\u1D3E", U"P", U"P"},
+	{U"\u1D3F", U"\u1D3F", U"\u1D3F", U"R", U"R"},
+	{U"\u1D40", U"\u1D40", U"\u1D40", U"T", U"T"},
+	{U"\u1D41", U"\u1D41", U"\u1D41", U"U", U"U"},
+	{U"\u1D42", U"\u1D42", U"\u1D42", U"W", U"W"},
+	{U"\u1D43", U"\u1D43", U"\u1D43", U"a", U"a"},
+	{U"\u1D44", U"\u1D44", U"\u1D44", U"\u0250", U"\u0250"},
+	{U"\u1D45", U"\u1D45", U"\u1D45", U"\u0251", U"\u0251"},
+	{U"\u1D46", U"\u1D46", U"\u1D46", U"\u1D02", U"\u1D02"},
+	{U"\u1D47", U"\u1D47", U"\u1D47", U"b", U"b"},
+	{U"\u1D48", U"\u1D48", U"\u1D48", U"d", U"d"},
+	{U"\u1D49", U"\u1D49", U"\u1D49", U"e", U"e"},
+	{U"\u1D4A", U"\u1D4A", U"\u1D4A", U"\u0259", U"\u0259"},
+	{U"\u1D4B", U"\u1D4B", U"\u1D4B", U"\u025B", U"\u025B"},
+	{U"\u1D4C", U"\u1D4C", U"\u1D4C", U"\u025C", U"\u025C"},
+	{U"\u1D4D", U"\u1D4D", U"\u1D4D", U"g", U"g"},
+	{U"\u1D4F", U"\u1D4F", U"\u1D4F", U"k", U"k"},
+	{U"\u1D50", U"\u1D50", U"\u1D50", U"m", U"m"},
+	{U"\u1D51", U"\u1D51", U"\u1D51", U"\u014B", U"\u014B"},
+	{U"\u1D52", U"\u1D52", U"\u1D52", U"o", U"o"},
+	{U"\u1D53", U"\u1D53", U"\u1D53", U"\u0254", U"\u0254"},
+	{U"\u1D54", U"\u1D54", U"\u1D54", U"\u1D16", U"\u1D16"},
+	{U"\u1D55", U"\u1D55", U"\u1D55", U"\u1D17", U"\u1D17"},
+	{U"\u1D56", U"\u1D56", U"\u1D56", U"p", U"p"},
+	{U"\u1D57", U"\u1D57", U"\u1D57", U"t", U"t"},
+	{U"\u1D58", U"\u1D58", U"\u1D58", U"u", U"u"},
+	{U"\u1D59", U"\u1D59", U"\u1D59", U"\u1D1D", U"\u1D1D"},
+	{U"\u1D5A", U"\u1D5A", U"\u1D5A", U"\u026F", U"\u026F"},
+	{U"\u1D5B", U"\u1D5B", U"\u1D5B", U"v", U"v"},
+	{U"\u1D5C", U"\u1D5C", U"\u1D5C", U"\u1D25", U"\u1D25"},
+	{U"\u1D5D", U"\u1D5D", U"\u1D5D", U"\u03B2", U"\u03B2"},
+	{U"\u1D5E", U"\u1D5E", U"\u1D5E", U"\u03B3", U"\u03B3"},
+	{U"\u1D5F", U"\u1D5F", U"\u1D5F", U"\u03B4", U"\u03B4"},
+	{U"\u1D60", U"\u1D60", U"\u1D60", U"\u03C6", U"\u03C6"},
+	{U"\u1D61", U"\u1D61", U"\u1D61", U"\u03C7", U"\u03C7"},
+	{U"\u1D62", U"\u1D62", U"\u1D62", U"i", U"i"},
+	{U"\u1D63", U"\u1D63", U"\u1D63", U"r", U"r"},
+	{U"\u1D64", U"\u1D64", U"\u1D64", U"u", U"u"},
+	{U"\u1D65", U"\u1D65", U"\u1D65", U"v", U"v"},
+	{U"\u1D66", U"\u1D66", U"\u1D66", U"\u03B2", U"\u03B2"},
+	{U"\u1D67", U"\u1D67", U"\u1D67", U"\u03B3", U"\u03B3"},
+	{U"\u1D68", U"\u1D68", U"\u1D68", U"\u03C1", U"\u03C1"},
+	{U"\u1D69", U"\u1D69", U"\u1D69", U"\u03C6", U"\u03C6"},
+	{U"\u1D6A", U"\u1D6A", U"\u1D6A", U"\u03C7", U"\u03C7"},
+	{U"\u1D78", U"\u1D78", U"\u1D78", U"\u043D", U"\u043D"},
+	{U"\u1D9B", U"\u1D9B", U"\u1D9B", U"\u0252", U"\u0252"},
+	{U"\u1D9C", U"\u1D9C", U"\u1D9C", U"c", U"c"},
+	{U"\u1D9D", U"\u1D9D", U"\u1D9D", U"\u0255", U"\u0255"},
+	{U"\u1D9E", U"\u1D9E", U"\u1D9E", U"\u00F0", U"\u00F0"},
+	{U"\u1D9F", U"\u1D9F", U"\u1D9F", U"\u025C", U"\u025C"},
+	{U"\u1DA0", U"\u1DA0", U"\u1DA0", U"f", U"f"},
+	{U"\u1DA1", U"\u1DA1", U"\u1DA1", U"\u025F", U"\u025F"},
+	{U"\u1DA2", U"\u1DA2", U"\u1DA2", U"\u0261", U"\u0261"},
+	{U"\u1DA3", U"\u1DA3", U"\u1DA3", U"\u0265", U"\u0265"},
+	{U"\u1DA4", U"\u1DA4", U"\u1DA4", U"\u0268", U"\u0268"},
+	{U"\u1DA5", U"\u1DA5", U"\u1DA5", U"\u0269", U"\u0269"},
+	{U"\u1DA6", U"\u1DA6", U"\u1DA6", U"\u026A", U"\u026A"},
+	{U"\u1DA7", U"\u1DA7", U"\u1DA7", U"\u1D7B", U"\u1D7B"},
+	{U"\u1DA8", U"\u1DA8", U"\u1DA8", U"\u029D", U"\u029D"},
+	{U"\u1DA9", U"\u1DA9", U"\u1DA9", U"\u026D", U"\u026D"},
+	{U"\u1DAA", U"\u1DAA", U"\u1DAA", U"\u1D85", U"\u1D85"},
+	{U"\u1DAB", U"\u1DAB", U"\u1DAB", U"\u029F", U"\u029F"},
+	{U"\u1DAC", U"\u1DAC", U"\u1DAC", U"\u0271", U"\u0271"},
+	{U"\u1DAD", U"\u1DAD", U"\u1DAD", U"\u0270", U"\u0270"},
+	{U"\u1DAE", U"\u1DAE", U"\u1DAE", U"\u0272", U"\u0272"},
+	{U"\u1DAF", U"\u1DAF", U"\u1DAF", U"\u0273", U"\u0273"},
+	{U"\u1DB0", U"\u1DB0", U"\u1DB0", U"\u0274", U"\u0274"},
+	{U"\u1DB1", U"\u1DB1", U"\u1DB1", U"\u0275", U"\u0275"},
+	{U"\u1DB2", U"\u1DB2", U"\u1DB2", U"\u0278", U"\u0278"},
+	{U"\u1DB3", U"\u1DB3", U"\u1DB3", U"\u0282", U"\u0282"},
+	{U"\u1DB4", U"\u1DB4", U"\u1DB4", U"\u0283", U"\u0283"},
+	{U"\u1DB5", U"\u1DB5", U"\u1DB5", U"\u01AB", U"\u01AB"},
+	{U"\u1DB6", U"\u1DB6", U"\u1DB6", U"\u0289", U"\u0289"},
+	{U"\u1DB7", U"\u1DB7", U"\u1DB7", U"\u028A", U"\u028A"},
+	{U"\u1DB8", U"\u1DB8", U"\u1DB8", U"\u1D1C", U"\u1D1C"},
+	{U"\u1DB9", U"\u1DB9", U"\u1DB9", U"\u028B", U"\u028B"},
+	{U"\u1DBA", U"\u1DBA", U"\u1DBA", U"\u028C", U"\u028C"},
+	{U"\u1DBB", U"\u1DBB", U"\u1DBB", U"z", U"z"},
+	{U"\u1DBC", U"\u1DBC", U"\u1DBC", U"\u0290", U"\u0290"},
+	{U"\u1DBD", U"\u1DBD", U"\u1DBD", U"\u0291", U"\u0291"},
+	{U"\u1DBE", U"\u1DBE", U"\u1DBE", U"\u0292", U"\u0292"},
+	{U"\u1DBF", U"\u1DBF", U"\u1DBF", U"\u03B8", U"\u03B8"},
+	{U"\u1E00", U"\u1E00", U"A\u0325", U"\u1E00", U"A\u0325"},
+	{U"\u1E01", U"\u1E01", U"a\u0325", U"\u1E01", U"a\u0325"},
+	{U"\u1E02", U"\u1E02", U"B\u0307", U"\u1E02", U"B\u0307"},
+	{U"\u1E03", U"\u1E03", U"b\u0307", U"\u1E03", U"b\u0307"},
+	{U"\u1E04", U"\u1E04", U"B\u0323", U"\u1E04", U"B\u0323"},
+	{U"\u1E05", U"\u1E05", U"b\u0323", U"\u1E05", U"b\u0323"},
+	{U"\u1E06", U"\u1E06", U"B\u0331", U"\u1E06", U"B\u0331"},
+	{U"\u1E07", U"\u1E07", U"b\u0331", U"\u1E07", U"b\u0331"},
+	{U"\u1E08", U"\u1E08", U"C\u0327\u0301", U"\u1E08", U"C\u0327\u0301"},
+	{U"\u1E09", U"\u1E09", U"c\u0327\u0301", U"\u1E09", U"c\u0327\u0301"},
+	{U"\u1E0A", U"\u1E0A", U"D\u0307", U"\u1E0A", U"D\u0307"},
+	{U"\u1E0B", U"\u1E0B", U"d\u0307", U"\u1E0B", U"d\u0307"},
+	{U"\u1E0C", U"\u1E0C", U"D\u0323", U"\u1E0C", U"D\u0323"},
+	{U"\u1E0D", U"\u1E0D", U"d\u0323", U"\u1E0D", U"d\u0323"},
+	{U"\u1E0E", U"\u1E0E", U"D\u0331", U"\u1E0E", U"D\u0331"},
+	{U"\u1E0F", U"\u1E0F", U"d\u0331", U"\u1E0F", U"d\u0331"},
+	{U"\u1E10", U"\u1E10", U"D\u0327", U"\u1E10", U"D\u0327"},
+	{U"\u1E11", U"\u1E11", U"d\u0327", U"\u1E11", U"d\u0327"},
+	{U"\u1E12", U"\u1E12", U"D\u032D", U"\u1E12", U"D\u032D"},
+	{U"\u1E13", U"\u1E13", U"d\u032D", U"\u1E13", U"d\u032D"},
+	{U"\u1E14", U"\u1E14", U"E\u0304\u0300", U"\u1E14", U"E\u0304\u0300"},
+	{U"\u1E15", U"\u1E15", U"e\u0304\u0300", U"\u1E15", U"e\u0304\u0300"},
+	{U"\u1E16", U"\u1E16", U"E\u0304\u0301", U"\u1E16", U"E\u0304\u0301"},
+	{U"\u1E17", U"\u1E17", U"e\u0304\u0301", U"\u1E17", U"e\u0304\u0301"},
+	{U"\u1E18", U"\u1E18", U"E\u032D", U"\u1E18", U"E\u032D"},
+	{U"\u1E19", U"\u1E19", U"e\u032D", U"\u1E19", U"e\u032D"},
+	{U"\u1E1A", U"\u1E1A", U"E\u0330", U"\u1E1A", U"E\u0330"},
+	{U"\u1E1B", U"\u1E1B", U"e\u0330", U"\u1E1B", U"e\u0330"},
+	{U"\u1E1C", U"\u1E1C", U"E\u0327\u0306", U"\u1E1C", U"E\u0327\u0306"},
+	{U"\u1E1D", U"\u1E1D", U"e\u0327\u0306", U"\u1E1D", U"e\u0327\u0306"},
+	{U"\u1E1E", U"\u1E1E", U"F\u0307", U"\u1E1E", U"F\u0307"},
+	{U"\u1E1F", U"\u1E1F", U"f\u0307", U"\u1E1F", U"f\u0307"},
+	{U"\u1E20", U"\u1E20", U"G\u0304", U"\u1E20", U"G\u0304"},
+	{U"\u1E21", U"\u1E21", U"g\u0304", U"\u1E21", U"g\u0304"},
+	{U"\u1E22", U"\u1E22", U"H\u0307", U"\u1E22", U"H\u0307"},
+	{U"\u1E23", U"\u1E23", U"h\u0307", U"\u1E23", U"h\u0307"},
+	{U"\u1E24", U"\u1E24", U"H\u0323", U"\u1E24", U"H\u0323"},
+	{U"\u1E25", U"\u1E25", U"h\u0323", U"\u1E25", U"h\u0323"},
+	{U"\u1E26", U"\u1E26", U"H\u0308", U"\u1E26", U"H\u0308"},
+	{U"\u1E27", U"\u1E27", U"h\u0308", U"\u1E27", U"h\u0308"},
+	{U"\u1E28", U"\u1E28", U"H\u0327", U"\u1E28", U"H\u0327"},
+	{U"\u1E29", U"\u1E29", U"h\u0327", U"\u1E29", U"h\u0327"},
+	{U"\u1E2A", U"\u1E2A", U"H\u032E", U"\u1E2A", U"H\u032E"},
+	{U"\u1E2B", U"\u1E2B", U"h\u032E", U"\u1E2B", U"h\u032E"},
+	{U"\u1E2C", U"\u1E2C", U"I\u0330", U"\u1E2C", U"I\u0330"},
+	{U"\u1E2D", U"\u1E2D", U"i\u0330", U"\u1E2D", U"i\u0330"},
+	{U"\u1E2E", U"\u1E2E", U"I\u0308\u0301", U"\u1E2E", U"I\u0308\u0301"},
+	{U"\u1E2F", U"\u1E2F", U"i\u0308\u0301", U"\u1E2F", U"i\u0308\u0301"},
+	{U"\u1E30", U"\u1E30", U"K\u0301", U"\u1E30", U"K\u0301"},
+	{U"\u1E31", U"\u1E31", U"k\u0301", U"\u1E31", U"k\u0301"},
+	{U"\u1E32", U"\u1E32", U"K\u0323", U"\u1E32", U"K\u0323"},
+	{U"\u1E33", U"\u1E33", U"k\u0323", U"\u1E33", U"k\u0323"},
+	{U"\u1E34", U"\u1E34", U"K\u0331", U"\u1E34", U"K\u0331"},
+	{U"\u1E35", U"\u1E35", U"k\u0331", U"\u1E35", U"k\u0331"},
+	{U"\u1E36", U"\u1E36", U"L\u0323", U"\u1E36", U"L\u0323"},
+	{U"\u1E37", U"\u1E37", U"l\u0323", U"\u1E37", U"l\u0323"},
+	{U"\u1E38", U"\u1E38", U"L\u0323\u0304", U"\u1E38", U"L\u0323\u0304"},
+	{U"\u1E39", U"\u1E39", U"l\u0323\u0304", U"\u1E39", U"l\u0323\u0304"},
+	{U"\u1E3A", U"\u1E3A", U"L\u0331", U"\u1E3A", U"L\u0331"},
+	{U"\u1E3B", U"\u1E3B", U"l\u0331", U"\u1E3B", U"l\u0331"},
+	{U"\u1E3C", U"\u1E3C", U"L\u032D", U"\u1E3C", U"L\u032D"},
+	{U"\u1E3D", U"\u1E3D", U"l\u032D", U"\u1E3D", U"l\u032D"},
+	{U"\u1E3E", U"\u1E3E", U"M\u0301", U"\u1E3E", U"M\u0301"},
+	{U"\u1E3F", U"\u1E3F", U"m\u0301", U"\u1E3F", U"m\u0301"},
+	{U"\u1E40", U"\u1E40", U"M\u0307", U"\u1E40", U"M\u0307"},
+	{U"\u1E41", U"\u1E41", U"m\u0307", U"\u1E41", U"m\u0307"},
+	{U"\u1E42", U"\u1E42", U"M\u0323", U"\u1E42", U"M\u0323"},
+	{U"\u1E43", U"\u1E43", U"m\u0323", U"\u1E43", U"m\u0323"},
+	{U"\u1E44", U"\u1E44", U"N\u0307", U"\u1E44", U"N\u0307"},
+	{U"\u1E45", U"\u1E45", U"n\u0307", U"\u1E45", U"n\u0307"},
+	{U"\u1E46", U"\u1E46", U"N\u0323", U"\u1E46", U"N\u0323"},
+	{U"\u1E47", U"\u1E47", U"n\u0323", U"\u1E47", U"n\u0323"},
+	{U"\u1E48", U"\u1E48", U"N\u0331", U"\u1E48", U"N\u0331"},
+	{U"\u1E49", U"\u1E49", U"n\u0331", U"\u1E49", U"n\u0331"},
+	{U"\u1E4A", U"\u1E4A", U"N\u032D", U"\u1E4A", U"N\u032D"},
+	{U"\u1E4B", U"\u1E4B", U"n\u032D", U"\u1E4B", U"n\u032D"},
+	{U"\u1E4C", U"\u1E4C", U"O\u0303\u0301", U"\u1E4C", U"O\u0303\u0301"},
+	{U"\u1E4D", U"\u1E4D", U"o\u0303\u0301", U"\u1E4D", U"o\u0303\u0301"},
+	{U"\u1E4E", U"\u1E4E", U"O\u0303\u0308", U"\u1E4E", U"O\u0303\u0308"},
+	{U"\u1E4F", U"\u1E4F", U"o\u0303\u0308", U"\u1E4F", U"o\u0303\u0308"},
+	{U"\u1E50", U"\u1E50", U"O\u0304\u0300", U"\u1E50", U"O\u0304\u0300"},
+	{U"\u1E51", U"\u1E51", U"o\u0304\u0300", U"\u1E51", U"o\u0304\u0300"},
+	{U"\u1E52", U"\u1E52", U"O\u0304\u0301", U"\u1E52", U"O\u0304\u0301"},
+	{U"\u1E53", U"\u1E53", U"o\u0304\u0301", U"\u1E53", U"o\u0304\u0301"},
+	{U"\u1E54", U"\u1E54", U"P\u0301", U"\u1E54", U"P\u0301"},
+	{U"\u1E55", U"\u1E55", U"p\u0301", U"\u1E55", U"p\u0301"},
+	{U"\u1E56", U"\u1E56", U"P\u0307", U"\u1E56", U"P\u0307"},
+	{U"\u1E57", U"\u1E57", U"p\u0307", U"\u1E57", U"p\u0307"},
+	{U"\u1E58", U"\u1E58", U"R\u0307", U"\u1E58", U"R\u0307"},
+	{U"\u1E59", U"\u1E59", U"r\u0307", U"\u1E59", U"r\u0307"},
+	{U"\u1E5A", U"\u1E5A", U"R\u0323", U"\u1E5A", U"R\u0323"},
+	{U"\u1E5B", U"\u1E5B", U"r\u0323", U"\u1E5B", U"r\u0323"},
+	{U"\u1E5C", U"\u1E5C", U"R\u0323\u0304", U"\u1E5C", U"R\u0323\u0304"},
+	{U"\u1E5D", U"\u1E5D", U"r\u0323\u0304", U"\u1E5D", U"r\u0323\u0304"},
+	{U"\u1E5E", U"\u1E5E", U"R\u0331", U"\u1E5E", U"R\u0331"},
+	{U"\u1E5F", U"\u1E5F", U"r\u0331", U"\u1E5F", U"r\u0331"},
+	{U"\u1E60", U"\u1E60", U"S\u0307", U"\u1E60", U"S\u0307"},
+	{U"\u1E61", U"\u1E61", U"s\u0307", U"\u1E61", U"s\u0307"},
+	{U"\u1E62", U"\u1E62", U"S\u0323", U"\u1E62", U"S\u0323"},
+	{U"\u1E63", U"\u1E63", U"s\u0323", U"\u1E63", U"s\u0323"},
+	{U"\u1E64", U"\u1E64", U"S\u0301\u0307", U"\u1E64", U"S\u0301\u0307"},
+	{U"\u1E65", U"\u1E65", U"s\u0301\u0307", U"\u1E65", U"s\u0301\u0307"},
+	{U"\u1E66", U"\u1E66", U"S\u030C\u0307", U"\u1E66", U"S\u030C\u0307"},
+	{U"\u1E67", U"\u1E67", U"s\u030C\u0307", U"\u1E67", U"s\u030C\u0307"},
+	{U"\u1E68", U"\u1E68", U"S\u0323\u0307", U"\u1E68", U"S\u0323\u0307"},
+	{U"\u1E69", U"\u1E69", U"s\u0323\u0307", U"\u1E69", U"s\u0323\u0307"},
+	{U"\u1E6A", U"\u1E6A", U"T\u0307", U"\u1E6A", U"T\u0307"},
+	{U"\u1E6B", U"\u1E6B", U"t\u0307", U"\u1E6B", U"t\u0307"},
+	{U"\u1E6C", U"\u1E6C", U"T\u0323", U"\u1E6C", U"T\u0323"},
+	{U"\u1E6D", U"\u1E6D", U"t\u0323", U"\u1E6D", U"t\u0323"},
+	{U"\u1E6E", U"\u1E6E", U"T\u0331", U"\u1E6E", U"T\u0331"},
+	{U"\u1E6F", U"\u1E6F", U"t\u0331", U"\u1E6F", U"t\u0331"},
+	{U"\u1E70", U"\u1E70", U"T\u032D", U"\u1E70", U"T\u032D"},
+	{U"\u1E71", U"\u1E71", U"t\u032D", U"\u1E71", U"t\u032D"},
+	{U"\u1E72", U"\u1E72", U"U\u0324", U"\u1E72", U"U\u0324"},
+	{U"\u1E73", U"\u1E73", U"u\u0324", U"\u1E73", U"u\u0324"},
+	{U"\u1E74", U"\u1E74", U"U\u0330", U"\u1E74", U"U\u0330"},
+	{U"\u1E75", U"\u1E75", U"u\u0330", U"\u1E75", U"u\u0330"},
+	{U"\u1E76", U"\u1E76", U"U\u032D", U"\u1E76", U"U\u032D"},
+	{U"\u1E77", U"\u1E77", U"u\u032D", U"\u1E77", U"u\u032D"},
+	{U"\u1E78", U"\u1E78", U"U\u0303\u0301", U"\u1E78", U"U\u0303\u0301"},
+	{U"\u1E79", U"\u1E79", U"u\u0303\u0301", U"\u1E79", U"u\u0303\u0301"},
+	{U"\u1E7A", U"\u1E7A", U"U\u0304\u0308", U"\u1E7A", U"U\u0304\u0308"},
+	{U"\u1E7B", U"\u1E7B", U"u\u0304\u0308", U"\u1E7B", U"u\u0304\u0308"},
+	{U"\u1E7C", U"\u1E7C", U"V\u0303", U"\u1E7C", U"V\u0303"},
+	{U"\u1E7D", U"\u1E7D", U"v\u0303", U"\u1E7D", U"v\u0303"},
+	{U"\u1E7E", U"\u1E7E", U"V\u0323", U"\u1E7E", U"V\u0323"},
+	{U"\u1E7F", U"\u1E7F", U"v\u0323", U"\u1E7F", U"v\u0323"},
+	{U"\u1E80", U"\u1E80", U"W\u0300", U"\u1E80", U"W\u0300"},
+	{U"\u1E81", U"\u1E81", U"w\u0300", U"\u1E81", U"w\u0300"},
+	{U"\u1E82", U"\u1E82", U"W\u0301", U"\u1E82", U"W\u0301"},
+	{U"\u1E83", U"\u1E83", U"w\u0301", U"\u1E83", U"w\u0301"},
+	{U"\u1E84", U"\u1E84", U"W\u0308", U"\u1E84", U"W\u0308"},
+	{U"\u1E85", U"\u1E85", U"w\u0308", U"\u1E85", U"w\u0308"},
+	{U"\u1E86", U"\u1E86", U"W\u0307", U"\u1E86", U"W\u0307"},
+	{U"\u1E87", U"\u1E87", U"w\u0307", U"\u1E87", U"w\u0307"},
+	{U"\u1E88", U"\u1E88", U"W\u0323", U"\u1E88", U"W\u0323"},
+	{U"\u1E89", U"\u1E89", U"w\u0323", U"\u1E89", U"w\u0323"},
+	{U"\u1E8A", U"\u1E8A", U"X\u0307", U"\u1E8A", U"X\u0307"},
+	{U"\u1E8B", U"\u1E8B", U"x\u0307", U"\u1E8B", U"x\u0307"},
+	{U"\u1E8C", U"\u1E8C", U"X\u0308", U"\u1E8C", U"X\u0308"},
+	{U"\u1E8D", U"\u1E8D", U"x\u0308", U"\u1E8D", U"x\u0308"},
+	{U"\u1E8E", U"\u1E8E", U"Y\u0307", U"\u1E8E", U"Y\u0307"},
+	{U"\u1E8F", U"\u1E8F", U"y\u0307", U"\u1E8F", U"y\u0307"},
+	{U"\u1E90", U"\u1E90", U"Z\u0302", U"\u1E90", U"Z\u0302"},
+	{U"\u1E91", U"\u1E91", U"z\u0302", U"\u1E91", U"z\u0302"},
+	{U"\u1E92", U"\u1E92", U"Z\u0323", U"\u1E92", U"Z\u0323"},
+	{U"\u1E93", U"\u1E93", U"z\u0323", U"\u1E93", U"z\u0323"},
+	{U"\u1E94", U"\u1E94", U"Z\u0331", U"\u1E94", U"Z\u0331"},
+	{U"\u1E95", U"\u1E95", U"z\u0331", U"\u1E95", U"z\u0331"},
+	{U"\u1E96", U"\u1E96", U"h\u0331", U"\u1E96", U"h\u0331"},
+	{U"\u1E97", U"\u1E97", U"t\u0308", U"\u1E97", U"t\u0308"},
+	{U"\u1E98", U"\u1E98", U"w\u030A", U"\u1E98", U"w\u030A"},
+	{U"\u1E99", U"\u1E99", U"y\u030A", U"\u1E99", U"y\u030A"},
+	{U"\u1E9A", U"\u1E9A", U"\u1E9A", U"a\u02BE", U"a\u02BE"},
+	{U"\u1E9B", U"\u1E9B", U"\u017F\u0307", U"\u1E61", U"s\u0307"},
+	{U"\u1EA0", U"\u1EA0", U"A\u0323", U"\u1EA0", U"A\u0323"},
+	{U"\u1EA1", U"\u1EA1", U"a\u0323", U"\u1EA1", U"a\u0323"},
+	{U"\u1EA2", U"\u1EA2", U"A\u0309", U"\u1EA2", U"A\u0309"},
+	{U"\u1EA3", U"\u1EA3", U"a\u0309", U"\u1EA3", U"a\u0309"},
+	{U"\u1EA4", U"\u1EA4", U"A\u0302\u0301", U"\u1EA4", U"A\u0302\u0301"},
+	{U"\u1EA5", U"\u1EA5", U"a\u0302\u0301", U"\u1EA5", U"a\u0302\u0301"},
+	{U"\u1EA6", U"\u1EA6", U"A\u0302\u0300", U"\u1EA6", U"A\u0302\u0300"},
+	{U"\u1EA7", U"\u1EA7", U"a\u0302\u0300", U"\u1EA7", U"a\u0302\u0300"},
+	{U"\u1EA8", U"\u1EA8", U"A\u0302\u0309", U"\u1EA8", U"A\u0302\u0309"},
+	{U"\u1EA9", U"\u1EA9", U"a\u0302\u0309", U"\u1EA9", U"a\u0302\u0309"},
+	{U"\u1EAA", U"\u1EAA", U"A\u0302\u0303", U"\u1EAA", U"A\u0302\u0303"},
+	{U"\u1EAB", U"\u1EAB", U"a\u0302\u0303", U"\u1EAB", U"a\u0302\u0303"},
+	{U"\u1EAC", U"\u1EAC", U"A\u0323\u0302", U"\u1EAC", U"A\u0323\u0302"},
+	{U"\u1EAD", U"\u1EAD", U"a\u0323\u0302", U"\u1EAD", U"a\u0323\u0302"},
+	{U"\u1EAE", U"\u1EAE", U"A\u0306\u0301", U"\u1EAE", U"A\u0306\u0301"},
+	{U"\u1EAF", U"\u1EAF", U"a\u0306\u0301", U"\u1EAF", U"a\u0306\u0301"},
+	{U"\u1EB0", U"\u1EB0", U"A\u0306\u0300", U"\u1EB0", U"A\u0306\u0300"},
+	{U"\u1EB1", U"\u1EB1", U"a\u0306\u0300", U"\u1EB1", U"a\u0306\u0300"},
+	{U"\u1EB2", U"\u1EB2", U"A\u0306\u0309", U"\u1EB2", U"A\u0306\u0309"},
+	{U"\u1EB3", U"\u1EB3", U"a\u0306\u0309", U"\u1EB3", U"a\u0306\u0309"},
+	{U"\u1EB4", U"\u1EB4", U"A\u0306\u0303", U"\u1EB4", U"A\u0306\u0303"},
+	{U"\u1EB5", U"\u1EB5", U"a\u0306\u0303", U"\u1EB5", U"a\u0306\u0303"},
+	{U"\u1EB6", U"\u1EB6", U"A\u0323\u0306", U"\u1EB6", U"A\u0323\u0306"},
+	{U"\u1EB7", U"\u1EB7", U"a\u0323\u0306", U"\u1EB7", U"a\u0323\u0306"},
+	{U"\u1EB8", U"\u1EB8", U"E\u0323", U"\u1EB8", U"E\u0323"},
+	{U"\u1EB9", U"\u1EB9", U"e\u0323", U"\u1EB9", U"e\u0323"},
+	{U"\u1EBA", U"\u1EBA", U"E\u0309", U"\u1EBA", U"E\u0309"},
+	{U"\u1EBB", U"\u1EBB", U"e\u0309", U"\u1EBB", U"e\u0309"},
+	{U"\u1EBC", U"\u1EBC", U"E\u0303", U"\u1EBC", U"E\u0303"},
+	{U"\u1EBD", U"\u1EBD", U"e\u0303", U"\u1EBD", U"e\u0303"},
+	{U"\u1EBE", U"\u1EBE", U"E\u0302\u0301", U"\u1EBE", U"E\u0302\u0301"},
+	{U"\u1EBF", U"\u1EBF", U"e\u0302\u0301", U"\u1EBF", U"e\u0302\u0301"},
+	{U"\u1EC0", U"\u1EC0", U"E\u0302\u0300", U"\u1EC0", U"E\u0302\u0300"},
+	{U"\u1EC1", U"\u1EC1", U"e\u0302\u0300", U"\u1EC1", U"e\u0302\u0300"},
+	{U"\u1EC2", U"\u1EC2", U"E\u0302\u0309", U"\u1EC2", U"E\u0302\u0309"},
+	{U"\u1EC3", U"\u1EC3", U"e\u0302\u0309", U"\u1EC3", U"e\u0302\u0309"},
+	{U"\u1EC4", U"\u1EC4", U"E\u0302\u0303", U"\u1EC4", U"E\u0302\u0303"},
+	{U"\u1EC5", U"\u1EC5", U"e\u0302\u0303", U"\u1EC5", U"e\u0302\u0303"},
+	{U"\u1EC6", U"\u1EC6", U"E\u0323\u0302", U"\u1EC6", U"E\u0323\u0302"},
+	{U"\u1EC7", U"\u1EC7", U"e\u0323\u0302", U"\u1EC7", U"e\u0323\u0302"},
+	{U"\u1EC8", U"\u1EC8", U"I\u0309", U"\u1EC8", U"I\u0309"},
+	{U"\u1EC9", U"\u1EC9", U"i\u0309", U"\u1EC9", U"i\u0309"},
+	{U"\u1ECA", U"\u1ECA", U"I\u0323", U"\u1ECA", U"I\u0323"},
+	{U"\u1ECB", U"\u1ECB", U"i\u0323", U"\u1ECB", U"i\u0323"},
+	{U"\u1ECC", U"\u1ECC", U"O\u0323", U"\u1ECC", U"O\u0323"},
+	{U"\u1ECD", U"\u1ECD", U"o\u0323", U"\u1ECD", U"o\u0323"},
+	{U"\u1ECE", U"\u1ECE", U"O\u0309", U"\u1ECE", U"O\u0309"},
+	{U"\u1ECF", U"\u1ECF", U"o\u0309", U"\u1ECF", U"o\u0309"},
+	{U"\u1ED0", U"\u1ED0", U"O\u0302\u0301", U"\u1ED0", U"O\u0302\u0301"},
+	{U"\u1ED1", U"\u1ED1", U"o\u0302\u0301", U"\u1ED1", U"o\u0302\u0301"},
+	{U"\u1ED2", U"\u1ED2", U"O\u0302\u0300", U"\u1ED2", U"O\u0302\u0300"},
+	{U"\u1ED3", U"\u1ED3", U"o\u0302\u0300", U"\u1ED3", U"o\u0302\u0300"},
+	{U"\u1ED4", U"\u1ED4", U"O\u0302\u0309", U"\u1ED4", U"O\u0302\u0309"},
+	{U"\u1ED5", U"\u1ED5", U"o\u0302\u0309", U"\u1ED5", U"o\u0302\u0309"},
+	{U"\u1ED6", U"\u1ED6", U"O\u0302\u0303", U"\u1ED6", U"O\u0302\u0303"},
+	{U"\u1ED7", U"\u1ED7", U"o\u0302\u0303", U"\u1ED7", U"o\u0302\u0303"},
+	{U"\u1ED8", U"\u1ED8", U"O\u0323\u0302", U"\u1ED8", U"O\u0323\u0302"},
+	{U"\u1ED9", U"\u1ED9", U"o\u0323\u0302", U"\u1ED9", U"o\u0323\u0302"},
+	{U"\u1EDA", U"\u1EDA", U"O\u031B\u0301", U"\u1EDA", U"O\u031B\u0301"},
+	{U"\u1EDB", U"\u1EDB", U"o\u031B\u0301", U"\u1EDB", U"o\u031B\u0301"},
+	{U"\u1EDC", U"\u1EDC", U"O\u031B\u0300", U"\u1EDC", U"O\u031B\u0300"},
+	{U"\u1EDD", U"\u1EDD", U"o\u031B\u0300", U"\u1EDD", U"o\u031B\u0300"},
+	{U"\u1EDE", U"\u1EDE", U"O\u031B\u0309", U"\u1EDE", U"O\u031B\u0309"},
+	{U"\u1EDF", U"\u1EDF", U"o\u031B\u0309", U"\u1EDF", U"o\u031B\u0309"},
+	{U"\u1EE0", U"\u1EE0", U"O\u031B\u0303", U"\u1EE0", U"O\u031B\u0303"},
+	{U"\u1EE1", U"\u1EE1", U"o\u031B\u0303", U"\u1EE1", U"o\u031B\u0303"},
+	{U"\u1EE2", U"\u1EE2", U"O\u031B\u0323", U"\u1EE2", U"O\u031B\u0323"},
+	{U"\u1EE3", U"\u1EE3", U"o\u031B\u0323", U"\u1EE3", U"o\u031B\u0323"},
+	{U"\u1EE4", U"\u1EE4", U"U\u0323", U"\u1EE4", U"U\u0323"},
+	{U"\u1EE5", U"\u1EE5", U"u\u0323", U"\u1EE5", U"u\u0323"},
+	{U"\u1EE6", U"\u1EE6", U"U\u0309", U"\u1EE6", U"U\u0309"},
+	{U"\u1EE7", U"\u1EE7", U"u\u0309", U"\u1EE7", U"u\u0309"},
+	{U"\u1EE8", U"\u1EE8", U"U\u031B\u0301", U"\u1EE8", U"U\u031B\u0301"},
+	{U"\u1EE9", U"\u1EE9", U"u\u031B\u0301", U"\u1EE9", U"u\u031B\u0301"},
+	{U"\u1EEA", U"\u1EEA", U"U\u031B\u0300", U"\u1EEA", U"U\u031B\u0300"},
+	{U"\u1EEB", U"\u1EEB", U"u\u031B\u0300", U"\u1EEB", U"u\u031B\u0300"},
+	{U"\u1EEC", U"\u1EEC", U"U\u031B\u0309", U"\u1EEC", U"U\u031B\u0309"},
+	{U"\u1EED", U"\u1EED", U"u\u031B\u0309", U"\u1EED", U"u\u031B\u0309"},
+	{U"\u1EEE", U"\u1EEE", U"U\u031B\u0303", U"\u1EEE", U"U\u031B\u0303"},
+	{U"\u1EEF", U"\u1EEF", U"u\u031B\u0303", U"\u1EEF", U"u\u031B\u0303"},
+	{U"\u1EF0", U"\u1EF0", U"U\u031B\u0323", U"\u1EF0", U"U\u031B\u0323"},
+	{U"\u1EF1", U"\u1EF1", U"u\u031B\u0323", U"\u1EF1", U"u\u031B\u0323"},
+	{U"\u1EF2", U"\u1EF2", U"Y\u0300", U"\u1EF2", U"Y\u0300"},
+	{U"\u1EF3", U"\u1EF3", U"y\u0300", U"\u1EF3", U"y\u0300"},
+	{U"\u1EF4", U"\u1EF4", U"Y\u0323", U"\u1EF4", U"Y\u0323"},
+	{U"\u1EF5", U"\u1EF5", U"y\u0323", U"\u1EF5", U"y\u0323"},
+	{U"\u1EF6", U"\u1EF6", U"Y\u0309", U"\u1EF6", U"Y\u0309"},
+	{U"\u1EF7", U"\u1EF7", U"y\u0309", U"\u1EF7", U"y\u0309"},
+	{U"\u1EF8", U"\u1EF8", U"Y\u0303", U"\u1EF8", U"Y\u0303"},
+	{U"\u1EF9", U"\u1EF9", U"y\u0303", U"\u1EF9", U"y\u0303"},
+	{U"\u1F00", U"\u1F00", U"\u03B1\u0313", U"\u1F00", U"\u03B1\u0313"},
+	{U"\u1F01", U"\u1F01", U"\u03B1\u0314", U"\u1F01", U"\u03B1\u0314"},
+	{U"\u1F02", U"\u1F02", U"\u03B1\u0313\u0300", U"\u1F02", U"\u03B1\u0313\u0300"},
+	{U"\u1F03", U"\u1F03", U"\u03B1\u0314\u0300", U"\u1F03", U"\u03B1\u0314\u0300"},
+	{U"\u1F04", U"\u1F04", U"\u03B1\u0313\u0301", U"\u1F04", U"\u03B1\u0313\u0301"},
+	{U"\u1F05", U"\u1F05", U"\u03B1\u0314\u0301", U"\u1F05", U"\u03B1\u0314\u0301"},
+	{U"\u1F06", U"\u1F06", U"\u03B1\u0313\u0342", U"\u1F06", U"\u03B1\u0313\u0342"},
+	{U"\u1F07", U"\u1F07", U"\u03B1\u0314\u0342", U"\u1F07", U"\u03B1\u0314\u0342"},
+	{U"\u1F08", U"\u1F08", U"\u0391\u0313", U"\u1F08", U"\u0391\u0313"},
+	{U"\u1F09", U"\u1F09", U"\u0391\u0314", U"\u1F09", U"\u0391\u0314"},
+	{U"\u1F0A", U"\u1F0A", U"\u0391\u0313\u0300", U"\u1F0A", U"\u0391\u0313\u0300"},
+	{U"\u1F0B", U"\u1F0B", U"\u0391\u0314\u0300", U"\u1F0B", U"\u0391\u0314\u0300"},
+	{U"\u1F0C", U"\u1F0C", U"\u0391\u0313\u0301", U"\u1F0C", U"\u0391\u0313\u0301"},
+	{U"\u1F0D", U"\u1F0D", U"\u0391\u0314\u0301", U"\u1F0D", U"\u0391\u0314\u0301"},
+	{U"\u1F0E", U"\u1F0E", U"\u0391\u0313\u0342", U"\u1F0E", U"\u0391\u0313\u0342"},
+	{U"\u1F0F", U"\u1F0F", U"\u0391\u0314\u0342", U"\u1F0F", U"\u0391\u0314\u0342"},
+	{U"\u1F10", U"\u1F10", U"\u03B5\u0313", U"\u1F10", U"\u03B5\u0313"},
+	{U"\u1F11", U"\u1F11", U"\u03B5\u0314", U"\u1F11", U"\u03B5\u0314"},
+	{U"\u1F12", U"\u1F12", U"\u03B5\u0313\u0300", U"\u1F12", U"\u03B5\u0313\u0300"},
+	{U"\u1F13", U"\u1F13", U"\u03B5\u0314\u0300", U"\u1F13", U"\u03B5\u0314\u0300"},
+	{U"\u1F14", U"\u1F14", U"\u03B5\u0313\u0301", U"\u1F14", U"\u03B5\u0313\u0301"},
+	{U"\u1F15", U"\u1F15", U"\u03B5\u0314\u0301", U"\u1F15", U"\u03B5\u0314\u0301"},
+	{U"\u1F18", U"\u1F18", U"\u0395\u0313", U"\u1F18", U"\u0395\u0313"},
+	{U"\u1F19", U"\u1F19", U"\u0395\u0314", U"\u1F19", U"\u0395\u0314"},
+	{U"\u1F1A", U"\u1F1A", U"\u0395\u0313\u0300", U"\u1F1A", U"\u0395\u0313\u0300"},
+	{U"\u1F1B", U"\u1F1B", U"\u0395\u0314\u0300", U"\u1F1B", U"\u0395\u0314\u0300"},
+	{U"\u1F1C", U"\u1F1C", U"\u0395\u0313\u0301", U"\u1F1C", U"\u0395\u0313\u0301"},
+	{U"\u1F1D", U"\u1F1D", U"\u0395\u0314\u0301", U"\u1F1D", U"\u0395\u0314\u0301"},
+	{U"\u1F20", U"\u1F20", U"\u03B7\u0313", U"\u1F20", U"\u03B7\u0313"},
+	{U"\u1F21", U"\u1F21", U"\u03B7\u0314", U"\u1F21", U"\u03B7\u0314"},
+	{U"\u1F22", U"\u1F22", U"\u03B7\u0313\u0300", U"\u1F22", U"\u03B7\u0313\u0300"},
+	{U"\u1F23", U"\u1F23", U"\u03B7\u0314\u0300", U"\u1F23", U"\u03B7\u0314\u0300"},
+	{U"\u1F24", U"\u1F24", U"\u03B7\u0313\u0301", U"\u1F24", U"\u03B7\u0313\u0301"},
+	{U"\u1F25", U"\u1F25", U"\u03B7\u0314\u0301", U"\u1F25", U"\u03B7\u0314\u0301"},
+	{U"\u1F26", U"\u1F26", U"\u03B7\u0313\u0342", U"\u1F26", U"\u03B7\u0313\u0342"},
+	{U"\u1F27", U"\u1F27", U"\u03B7\u0314\u0342", U"\u1F27", U"\u03B7\u0314\u0342"},
+	{U"\u1F28", U"\u1F28", U"\u0397\u0313", U"\u1F28", U"\u0397\u0313"},
+	{U"\u1F29", U"\u1F29", U"\u0397\u0314", U"\u1F29", U"\u0397\u0314"},
+	{U"\u1F2A", U"\u1F2A", U"\u0397\u0313\u0300", U"\u1F2A", U"\u0397\u0313\u0300"},
+	{U"\u1F2B", U"\u1F2B", U"\u0397\u0314\u0300", U"\u1F2B", U"\u0397\u0314\u0300"},
+	{U"\u1F2C", U"\u1F2C", U"\u0397\u0313\u0301", U"\u1F2C", U"\u0397\u0313\u0301"},
+	{U"\u1F2D", U"\u1F2D", U"\u0397\u0314\u0301", U"\u1F2D", U"\u0397\u0314\u0301"},
+	{U"\u1F2E", U"\u1F2E", U"\u0397\u0313\u0342", U"\u1F2E", U"\u0397\u0313\u0342"},
+	{U"\u1F2F", U"\u1F2F", U"\u0397\u0314\u0342", U"\u1F2F", U"\u0397\u0314\u0342"},
+	{U"\u1F30", U"\u1F30", U"\u03B9\u0313", U"\u1F30", U"\u03B9\u0313"},
+	{U"\u1F31", U"\u1F31", U"\u03B9\u0314", U"\u1F31", U"\u03B9\u0314"},
+	{U"\u1F32", U"\u1F32", U"\u03B9\u0313\u0300", U"\u1F32", U"\u03B9\u0313\u0300"},
+	{U"\u1F33", U"\u1F33", U"\u03B9\u0314\u0300", U"\u1F33", U"\u03B9\u0314\u0300"},
+	{U"\u1F34", U"\u1F34", U"\u03B9\u0313\u0301", U"\u1F34", U"\u03B9\u0313\u0301"},
+	{U"\u1F35", U"\u1F35", U"\u03B9\u0314\u0301", U"\u1F35", U"\u03B9\u0314\u0301"},
+	{U"\u1F36", U"\u1F36", U"\u03B9\u0313\u0342", U"\u1F36", U"\u03B9\u0313\u0342"},
+	{U"\u1F37", U"\u1F37", U"\u03B9\u0314\u0342", U"\u1F37", U"\u03B9\u0314\u0342"},
+	{U"\u1F38", U"\u1F38", U"\u0399\u0313", U"\u1F38", U"\u0399\u0313"},
+	{U"\u1F39", U"\u1F39", U"\u0399\u0314", U"\u1F39", U"\u0399\u0314"},
+	{U"\u1F3A", U"\u1F3A", U"\u0399\u0313\u0300", U"\u1F3A", U"\u0399\u0313\u0300"},
+	{U"\u1F3B", U"\u1F3B", U"\u0399\u0314\u0300", U"\u1F3B", U"\u0399\u0314\u0300"},
+	{U"\u1F3C", U"\u1F3C", U"\u0399\u0313\u0301", U"\u1F3C", U"\u0399\u0313\u0301"},
+	{U"\u1F3D", U"\u1F3D", U"\u0399\u0314\u0301", U"\u1F3D", U"\u0399\u0314\u0301"},
+	{U"\u1F3E", U"\u1F3E", U"\u0399\u0313\u0342", U"\u1F3E", U"\u0399\u0313\u0342"},
+	{U"\u1F3F", U"\u1F3F", U"\u0399\u0314\u0342", U"\u1F3F", U"\u0399\u0314\u0342"},
+	{U"\u1F40", U"\u1F40", U"\u03BF\u0313", U"\u1F40", U"\u03BF\u0313"},
+	{U"\u1F41", U"\u1F41", U"\u03BF\u0314", U"\u1F41", U"\u03BF\u0314"},
+	{U"\u1F42", U"\u1F42", U"\u03BF\u0313\u0300", U"\u1F42", U"\u03BF\u0313\u0300"},
+	{U"\u1F43", U"\u1F43", U"\u03BF\u0314\u0300", U"\u1F43", U"\u03BF\u0314\u0300"},
+	{U"\u1F44", U"\u1F44", U"\u03BF\u0313\u0301", U"\u1F44", U"\u03BF\u0313\u0301"},
+	{U"\u1F45", U"\u1F45", U"\u03BF\u0314\u0301", U"\u1F45", U"\u03BF\u0314\u0301"},
+	{U"\u1F48", U"\u1F48", U"\u039F\u0313", U"\u1F48", U"\u039F\u0313"},
+	{U"\u1F49", U"\u1F49", U"\u039F\u0314", U"\u1F49", U"\u039F\u0314"},
+	{U"\u1F4A", U"\u1F4A", U"\u039F\u0313\u0300", U"\u1F4A", U"\u039F\u0313\u0300"},
+	{U"\u1F4B", U"\u1F4B", U"\u039F\u0314\u0300", U"\u1F4B", U"\u039F\u0314\u0300"},
+	{U"\u1F4C", U"\u1F4C", U"\u039F\u0313\u0301", U"\u1F4C", U"\u039F\u0313\u0301"},
+	{U"\u1F4D", U"\u1F4D", U"\u039F\u0314\u0301", U"\u1F4D", U"\u039F\u0314\u0301"},
+	{U"\u1F50", U"\u1F50", U"\u03C5\u0313", U"\u1F50", U"\u03C5\u0313"},
+	{U"\u1F51", U"\u1F51", U"\u03C5\u0314", U"\u1F51", U"\u03C5\u0314"},
+	{U"\u1F52", U"\u1F52", U"\u03C5\u0313\u0300", U"\u1F52", U"\u03C5\u0313\u0300"},
+	{U"\u1F53", U"\u1F53", U"\u03C5\u0314\u0300", U"\u1F53", U"\u03C5\u0314\u0300"},
+	{U"\u1F54", U"\u1F54", U"\u03C5\u0313\u0301", U"\u1F54", U"\u03C5\u0313\u0301"},
+	{U"\u1F55", U"\u1F55", U"\u03C5\u0314\u0301", U"\u1F55", U"\u03C5\u0314\u0301"},
+	{U"\u1F56", U"\u1F56", U"\u03C5\u0313\u0342", U"\u1F56", U"\u03C5\u0313\u0342"},
+	{U"\u1F57", U"\u1F57", U"\u03C5\u0314\u0342", U"\u1F57", U"\u03C5\u0314\u0342"},
+	{U"\u1F59", U"\u1F59", U"\u03A5\u0314", U"\u1F59", U"\u03A5\u0314"},
+	{U"\u1F5B", U"\u1F5B", U"\u03A5\u0314\u0300", U"\u1F5B", U"\u03A5\u0314\u0300"},
+	{U"\u1F5D", U"\u1F5D", U"\u03A5\u0314\u0301", U"\u1F5D", U"\u03A5\u0314\u0301"},
+	{U"\u1F5F", U"\u1F5F", U"\u03A5\u0314\u0342", U"\u1F5F", U"\u03A5\u0314\u0342"},
+	{U"\u1F60", U"\u1F60", U"\u03C9\u0313", U"\u1F60", U"\u03C9\u0313"},
+	{U"\u1F61", U"\u1F61", U"\u03C9\u0314", U"\u1F61", U"\u03C9\u0314"},
+	{U"\u1F62", U"\u1F62", U"\u03C9\u0313\u0300", U"\u1F62", U"\u03C9\u0313\u0300"},
+	{U"\u1F63", U"\u1F63", U"\u03C9\u0314\u0300", U"\u1F63", U"\u03C9\u0314\u0300"},
+	{U"\u1F64", U"\u1F64", U"\u03C9\u0313\u0301", U"\u1F64", U"\u03C9\u0313\u0301"},
+	{U"\u1F65", U"\u1F65", U"\u03C9\u0314\u0301", U"\u1F65", U"\u03C9\u0314\u0301"},
+	{U"\u1F66", U"\u1F66", U"\u03C9\u0313\u0342", U"\u1F66", U"\u03C9\u0313\u0342"},
+	{U"\u1F67", U"\u1F67", U"\u03C9\u0314\u0342", U"\u1F67", U"\u03C9\u0314\u0342"},
+	{U"\u1F68", U"\u1F68", U"\u03A9\u0313", U"\u1F68", U"\u03A9\u0313"},
+	{U"\u1F69", U"\u1F69", U"\u03A9\u0314", U"\u1F69", U"\u03A9\u0314"},
+	{U"\u1F6A", U"\u1F6A", U"\u03A9\u0313\u0300", U"\u1F6A", U"\u03A9\u0313\u0300"},
+	{U"\u1F6B", U"\u1F6B", U"\u03A9\u0314\u0300", U"\u1F6B", U"\u03A9\u0314\u0300"},
+	{U"\u1F6C", U"\u1F6C", U"\u03A9\u0313\u0301", U"\u1F6C", U"\u03A9\u0313\u0301"},
+	{U"\u1F6D", U"\u1F6D", U"\u03A9\u0314\u0301", U"\u1F6D", U"\u03A9\u0314\u0301"},
+	{U"\u1F6E", U"\u1F6E", U"\u03A9\u0313\u0342", U"\u1F6E", U"\u03A9\u0313\u0342"},
+	{U"\u1F6F", U"\u1F6F", U"\u03A9\u0314\u0342", U"\u1F6F", U"\u03A9\u0314\u0342"},
+	{U"\u1F70", U"\u1F70", U"\u03B1\u0300", U"\u1F70", U"\u03B1\u0300"},
+	{U"\u1F71", U"\u03AC", U"\u03B1\u0301", U"\u03AC", U"\u03B1\u0301"},
+	{U"\u1F72", U"\u1F72", U"\u03B5\u0300", U"\u1F72", U"\u03B5\u0300"},
+	{U"\u1F73", U"\u03AD", U"\u03B5\u0301", U"\u03AD", U"\u03B5\u0301"},
+	{U"\u1F74", U"\u1F74", U"\u03B7\u0300", U"\u1F74", U"\u03B7\u0300"},
+	{U"\u1F75", U"\u03AE", U"\u03B7\u0301", U"\u03AE", U"\u03B7\u0301"},
+	{U"\u1F76", U"\u1F76", U"\u03B9\u0300", U"\u1F76", U"\u03B9\u0300"},
+	{U"\u1F77", U"\u03AF", U"\u03B9\u0301", U"\u03AF", U"\u03B9\u0301"},
+	{U"\u1F78", U"\u1F78", U"\u03BF\u0300", U"\u1F78", U"\u03BF\u0300"},
+	{U"\u1F79", U"\u03CC", U"\u03BF\u0301", U"\u03CC", U"\u03BF\u0301"},
+	{U"\u1F7A", U"\u1F7A", U"\u03C5\u0300", U"\u1F7A", U"\u03C5\u0300"},
+	{U"\u1F7B", U"\u03CD", U"\u03C5\u0301", U"\u03CD", U"\u03C5\u0301"},
+	{U"\u1F7C", U"\u1F7C", U"\u03C9\u0300", U"\u1F7C", U"\u03C9\u0300"},
+	{U"\u1F7D", U"\u03CE", U"\u03C9\u0301", U"\u03CE", U"\u03C9\u0301"},
+	{U"\u1F80", U"\u1F80", U"\u03B1\u0313\u0345", U"\u1F80", U"\u03B1\u0313\u0345"},
+	{U"\u1F81", U"\u1F81", U"\u03B1\u0314\u0345", U"\u1F81", U"\u03B1\u0314\u0345"},
+	{U"\u1F82", U"\u1F82", U"\u03B1\u0313\u0300\u0345", U"\u1F82", U"\u03B1\u0313\u0300\u0345"},
+	{U"\u1F83", U"\u1F83", U"\u03B1\u0314\u0300\u0345", U"\u1F83", U"\u03B1\u0314\u0300\u0345"},
+	{U"\u1F84", U"\u1F84", U"\u03B1\u0313\u0301\u0345", U"\u1F84", U"\u03B1\u0313\u0301\u0345"},
+	{U"\u1F85", U"\u1F85", U"\u03B1\u0314\u0301\u0345", U"\u1F85", U"\u03B1\u0314\u0301\u0345"},
+	{U"\u1F86", U"\u1F86", U"\u03B1\u0313\u0342\u0345", U"\u1F86", U"\u03B1\u0313\u0342\u0345"},
+	{U"\u1F87", U"\u1F87", U"\u03B1\u0314\u0342\u0345", U"\u1F87", U"\u03B1\u0314\u0342\u0345"},
+	{U"\u1F88", U"\u1F88", U"\u0391\u0313\u0345", U"\u1F88", U"\u0391\u0313\u0345"},
+	{U"\u1F89", U"\u1F89", U"\u0391\u0314\u0345", U"\u1F89", U"\u0391\u0314\u0345"},
+	{U"\u1F8A", U"\u1F8A", U"\u0391\u0313\u0300\u0345", U"\u1F8A", U"\u0391\u0313\u0300\u0345"},
+	{U"\u1F8B", U"\u1F8B", U"\u0391\u0314\u0300\u0345", U"\u1F8B", U"\u0391\u0314\u0300\u0345"},
+	{U"\u1F8C", U"\u1F8C", U"\u0391\u0313\u0301\u0345", U"\u1F8C", U"\u0391\u0313\u0301\u0345"},
+	{U"\u1F8D", U"\u1F8D", U"\u0391\u0314\u0301\u0345", U"\u1F8D", U"\u0391\u0314\u0301\u0345"},
+	{U"\u1F8E", U"\u1F8E", U"\u0391\u0313\u0342\u0345", U"\u1F8E", U"\u0391\u0313\u0342\u0345"},
+	{U"\u1F8F", U"\u1F8F", U"\u0391\u0314\u0342\u0345", U"\u1F8F", U"\u0391\u0314\u0342\u0345"},
+	{U"\u1F90", U"\u1F90", U"\u03B7\u0313\u0345", U"\u1F90", U"\u03B7\u0313\u0345"},
+	{U"\u1F91", U"\u1F91", U"\u03B7\u0314\u0345", U"\u1F91", U"\u03B7\u0314\u0345"},
+	{U"\u1F92", U"\u1F92", U"\u03B7\u0313\u0300\u0345", U"\u1F92", U"\u03B7\u0313\u0300\u0345"},
+	{U"\u1F93", U"\u1F93", U"\u03B7\u0314\u0300\u0345", U"\u1F93", U"\u03B7\u0314\u0300\u0345"},
+	{U"\u1F94", U"\u1F94", U"\u03B7\u0313\u0301\u0345", U"\u1F94", U"\u03B7\u0313\u0301\u0345"},
+	{U"\u1F95", U"\u1F95", U"\u03B7\u0314\u0301\u0345", U"\u1F95", U"\u03B7\u0314\u0301\u0345"},
+	{U"\u1F96", U"\u1F96", U"\u03B7\u0313\u0342\u0345", U"\u1F96", U"\u03B7\u0313\u0342\u0345"},
+	{U"\u1F97", U"\u1F97", U"\u03B7\u0314\u0342\u0345", U"\u1F97", U"\u03B7\u0314\u0342\u0345"},
+	{U"\u1F98", U"\u1F98", U"\u0397\u0313\u0345", U"\u1F98", U"\u0397\u0313\u0345"},
+	{U"\u1F99", U"\u1F99", U"\u0397\u0314\u0345", U"\u1F99", U"\u0397\u0314\u0345"},
+	{U"\u1F9A", U"\u1F9A", U"\u0397\u0313\u0300\u0345", U"\u1F9A", U"\u0397\u0313\u0300\u0345"},
+	{U"\u1F9B", U"\u1F9B", U"\u0397\u0314\u0300\u0345", U"\u1F9B", U"\u0397\u0314\u0300\u0345"},
+	{U"\u1F9C", U"\u1F9C", U"\u0397\u0313\u0301\u0345", U"\u1F9C", U"\u0397\u0313\u0301\u0345"},
+	{U"\u1F9D", U"\u1F9D", U"\u0397\u0314\u0301\u0345", U"\u1F9D", U"\u0397\u0314\u0301\u0345"},
+	{U"\u1F9E", U"\u1F9E", U"\u0397\u0313\u0342\u0345", U"\u1F9E", U"\u0397\u0313\u0342\u0345"},
+	{U"\u1F9F", U"\u1F9F", U"\u0397\u0314\u0342\u0345", U"\u1F9F", U"\u0397\u0314\u0342\u0345"},
+	{U"\u1FA0", U"\u1FA0", U"\u03C9\u0313\u0345", U"\u1FA0", U"\u03C9\u0313\u0345"},
+	{U"\u1FA1", U"\u1FA1", U"\u03C9\u0314\u0345", U"\u1FA1", U"\u03C9\u0314\u0345"},
+	{U"\u1FA2", U"\u1FA2", U"\u03C9\u0313\u0300\u0345", U"\u1FA2", U"\u03C9\u0313\u0300\u0345"},
+	{U"\u1FA3", U"\u1FA3", U"\u03C9\u0314\u0300\u0345", U"\u1FA3", U"\u03C9\u0314\u0300\u0345"},
+	{U"\u1FA4", U"\u1FA4", U"\u03C9\u0313\u0301\u0345", U"\u1FA4", U"\u03C9\u0313\u0301\u0345"},
+	{U"\u1FA5", U"\u1FA5", U"\u03C9\u0314\u0301\u0345", U"\u1FA5", U"\u03C9\u0314\u0301\u0345"},
+	{U"\u1FA6", U"\u1FA6", U"\u03C9\u0313\u0342\u0345", U"\u1FA6", U"\u03C9\u0313\u0342\u0345"},
+	{U"\u1FA7", U"\u1FA7", U"\u03C9\u0314\u0342\u0345", U"\u1FA7", U"\u03C9\u0314\u0342\u0345"},
+	{U"\u1FA8", U"\u1FA8", U"\u03A9\u0313\u0345", U"\u1FA8", U"\u03A9\u0313\u0345"},
+	{U"\u1FA9", U"\u1FA9", U"\u03A9\u0314\u0345", U"\u1FA9", U"\u03A9\u0314\u0345"},
+	{U"\u1FAA", U"\u1FAA", U"\u03A9\u0313\u0300\u0345", U"\u1FAA", U"\u03A9\u0313\u0300\u0345"},
+	{U"\u1FAB", U"\u1FAB", U"\u03A9\u0314\u0300\u0345", U"\u1FAB", U"\u03A9\u0314\u0300\u0345"},
+	{U"\u1FAC", U"\u1FAC", U"\u03A9\u0313\u0301\u0345", U"\u1FAC", U"\u03A9\u0313\u0301\u0345"},
+	{U"\u1FAD", U"\u1FAD", U"\u03A9\u0314\u0301\u0345", U"\u1FAD", U"\u03A9\u0314\u0301\u0345"},
+	{U"\u1FAE", U"\u1FAE", U"\u03A9\u0313\u0342\u0345", U"\u1FAE", U"\u03A9\u0313\u0342\u0345"},
+	{U"\u1FAF", U"\u1FAF", U"\u03A9\u0314\u0342\u0345", U"\u1FAF", U"\u03A9\u0314\u0342\u0345"},
+	{U"\u1FB0", U"\u1FB0", U"\u03B1\u0306", U"\u1FB0", U"\u03B1\u0306"},
+	{U"\u1FB1", U"\u1FB1", U"\u03B1\u0304", U"\u1FB1", U"\u03B1\u0304"},
+	{U"\u1FB2", U"\u1FB2", U"\u03B1\u0300\u0345", U"\u1FB2", U"\u03B1\u0300\u0345"},
+	{U"\u1FB3", U"\u1FB3", U"\u03B1\u0345", U"\u1FB3", U"\u03B1\u0345"},
+	{U"\u1FB4", U"\u1FB4", U"\u03B1\u0301\u0345", U"\u1FB4", U"\u03B1\u0301\u0345"},
+	{U"\u1FB6", U"\u1FB6", U"\u03B1\u0342", U"\u1FB6", U"\u03B1\u0342"},
+	{U"\u1FB7", U"\u1FB7", U"\u03B1\u0342\u0345", U"\u1FB7", U"\u03B1\u0342\u0345"},
+	{U"\u1FB8", U"\u1FB8", U"\u0391\u0306", U"\u1FB8", U"\u0391\u0306"},
+	{U"\u1FB9", U"\u1FB9", U"\u0391\u0304", U"\u1FB9", U"\u0391\u0304"},
+	{U"\u1FBA", U"\u1FBA", U"\u0391\u0300", U"\u1FBA", U"\u0391\u0300"},
+	{U"\u1FBB", U"\u0386", U"\u0391\u0301", U"\u0386", U"\u0391\u0301"},
+	{U"\u1FBC", U"\u1FBC", U"\u0391\u0345", U"\u1FBC", U"\u0391\u0345"},
+	{U"\u1FBD", U"\u1FBD", U"\u1FBD", U" \u0313", U" \u0313"},
+	{U"\u1FBE", U"\u03B9", U"\u03B9", U"\u03B9", U"\u03B9"},
+	{U"\u1FBF", U"\u1FBF", U"\u1FBF", U" \u0313", U" \u0313"},
+	{U"\u1FC0", U"\u1FC0", U"\u1FC0", U" \u0342", U" \u0342"},
+	{U"\u1FC1", U"\u1FC1", U"\u00A8\u0342", U" \u0308\u0342", U" \u0308\u0342"},
+	{U"\u1FC2", U"\u1FC2", U"\u03B7\u0300\u0345", U"\u1FC2", U"\u03B7\u0300\u0345"},
+	{U"\u1FC3", U"\u1FC3", U"\u03B7\u0345", U"\u1FC3", U"\u03B7\u0345"},
+	{U"\u1FC4", U"\u1FC4", U"\u03B7\u0301\u0345", U"\u1FC4", U"\u03B7\u0301\u0345"},
+	{U"\u1FC6", U"\u1FC6", U"\u03B7\u0342", U"\u1FC6", U"\u03B7\u0342"},
+	{U"\u1FC7", U"\u1FC7", U"\u03B7\u0342\u0345", U"\u1FC7", U"\u03B7\u0342\u0345"},
+	{U"\u1FC8", U"\u1FC8", U"\u0395\u0300", U"\u1FC8", U"\u0395\u0300"},
+	{U"\u1FC9", U"\u0388", U"\u0395\u0301", U"\u0388", U"\u0395\u0301"},
+	{U"\u1FCA", U"\u1FCA", U"\u0397\u0300", U"\u1FCA", U"\u0397\u0300"},
+	{U"\u1FCB", U"\u0389", U"\u0397\u0301", U"\u0389", U"\u0397\u0301"},
+	{U"\u1FCC", U"\u1FCC", U"\u0397\u0345", U"\u1FCC", U"\u0397\u0345"},
+	{U"\u1FCD", U"\u1FCD", U"\u1FBF\u0300", U" \u0313\u0300", U" \u0313\u0300"},
+	{U"\u1FCE", U"\u1FCE", U"\u1FBF\u0301", U" \u0313\u0301", U" \u0313\u0301"},
+	{U"\u1FCF", U"\u1FCF", U"\u1FBF\u0342", U" \u0313\u0342", U" \u0313\u0342"},
+	{U"\u1FD0", U"\u1FD0", U"\u03B9\u0306", U"\u1FD0", U"\u03B9\u0306"},
+	{U"\u1FD1", U"\u1FD1", U"\u03B9\u0304", U"\u1FD1", U"\u03B9\u0304"},
+	{U"\u1FD2", U"\u1FD2", U"\u03B9\u0308\u0300", U"\u1FD2", U"\u03B9\u0308\u0300"},
+	{U"\u1FD3", U"\u0390", U"\u03B9\u0308\u0301", U"\u0390", U"\u03B9\u0308\u0301"},
+	{U"\u1FD6", U"\u1FD6", U"\u03B9\u0342", U"\u1FD6", U"\u03B9\u0342"},
+	{U"\u1FD7", U"\u1FD7", U"\u03B9\u0308\u0342", U"\u1FD7", U"\u03B9\u0308\u0342"},
+	{U"\u1FD8", U"\u1FD8", U"\u0399\u0306", U"\u1FD8", U"\u0399\u0306"},
+	{U"\u1FD9", U"\u1FD9", U"\u0399\u0304", U"\u1FD9", U"\u0399\u0304"},
+	{U"\u1FDA", U"\u1FDA", U"\u0399\u0300", U"\u1FDA", U"\u0399\u0300"},
+	{U"\u1FDB", U"\u038A", U"\u0399\u0301", U"\u038A", U"\u0399\u0301"},
+	{U"\u1FDD", U"\u1FDD", U"\u1FFE\u0300", U" \u0314\u0300", U" \u0314\u0300"},
+	{U"\u1FDE", U"\u1FDE", U"\u1FFE\u0301", U" \u0314\u0301", U" \u0314\u0301"},
+	{U"\u1FDF", U"\u1FDF", U"\u1FFE\u0342", U" \u0314\u0342", U" \u0314\u0342"},
+	{U"\u1FE0", U"\u1FE0", U"\u03C5\u0306", U"\u1FE0", U"\u03C5\u0306"},
+	{U"\u1FE1", U"\u1FE1", U"\u03C5\u0304", U"\u1FE1", U"\u03C5\u0304"},
+	{U"\u1FE2", U"\u1FE2", U"\u03C5\u0308\u0300", U"\u1FE2", U"\u03C5\u0308\u0300"},
+	{U"\u1FE3", U"\u03B0", U"\u03C5\u0308\u0301", U"\u03B0", U"\u03C5\u0308\u0301"},
+	{U"\u1FE4", U"\u1FE4", U"\u03C1\u0313", U"\u1FE4", U"\u03C1\u0313"},
+	{U"\u1FE5", U"\u1FE5", U"\u03C1\u0314", U"\u1FE5", U"\u03C1\u0314"},
+	{U"\u1FE6", U"\u1FE6", U"\u03C5\u0342", U"\u1FE6", U"\u03C5\u0342"},
+	{U"\u1FE7", U"\u1FE7", U"\u03C5\u0308\u0342", U"\u1FE7", U"\u03C5\u0308\u0342"},
+	{U"\u1FE8", U"\u1FE8", U"\u03A5\u0306", U"\u1FE8", U"\u03A5\u0306"},
+	{U"\u1FE9", U"\u1FE9", U"\u03A5\u0304", U"\u1FE9", U"\u03A5\u0304"},
+	{U"\u1FEA", U"\u1FEA", U"\u03A5\u0300", U"\u1FEA", U"\u03A5\u0300"},
+	{U"\u1FEB", U"\u038E", U"\u03A5\u0301", U"\u038E", U"\u03A5\u0301"},
+	{U"\u1FEC", U"\u1FEC", U"\u03A1\u0314", U"\u1FEC", U"\u03A1\u0314"},
+	{U"\u1FED", U"\u1FED", U"\u00A8\u0300", U" \u0308\u0300", U" \u0308\u0300"},
+	{U"\u1FEE", U"\u0385", U"\u00A8\u0301", U" \u0308\u0301", U" \u0308\u0301"},
+	{U"\u1FEF", U"`", U"`", U"`", U"`"},
+	{U"\u1FF2", U"\u1FF2", U"\u03C9\u0300\u0345", U"\u1FF2", U"\u03C9\u0300\u0345"},
+	{U"\u1FF3", U"\u1FF3", U"\u03C9\u0345", U"\u1FF3", U"\u03C9\u0345"},
+	{U"\u1FF4", U"\u1FF4", U"\u03C9\u0301\u0345", U"\u1FF4", U"\u03C9\u0301\u0345"},
+	{U"\u1FF6", U"\u1FF6", U"\u03C9\u0342", U"\u1FF6", U"\u03C9\u0342"},
+	{U"\u1FF7", U"\u1FF7", U"\u03C9\u0342\u0345", U"\u1FF7", U"\u03C9\u0342\u0345"},
+	{U"\u1FF8", U"\u1FF8", U"\u039F\u0300", U"\u1FF8", U"\u039F\u0300"},
+	{U"\u1FF9", U"\u038C", U"\u039F\u0301", U"\u038C", U"\u039F\u0301"},
+	{U"\u1FFA", U"\u1FFA", U"\u03A9\u0300", U"\u1FFA", U"\u03A9\u0300"},
+	{U"\u1FFB", U"\u038F", U"\u03A9\u0301", U"\u038F", U"\u03A9\u0301"},
+	{U"\u1FFC", U"\u1FFC", U"\u03A9\u0345", U"\u1FFC", U"\u03A9\u0345"},
+	{U"\u1FFD", U"\u00B4", U"\u00B4", U" \u0301", U" \u0301"},
+	{U"\u1FFE", U"\u1FFE", U"\u1FFE", U" \u0314", U" \u0314"},
+	{U"\u2000", U"\u2002", U"\u2002", U" ", U" "},
+	{U"\u2001", U"\u2003", U"\u2003", U" ", U" "},
+	{U"\u2002", U"\u2002", U"\u2002", U" ", U" "},
+	{U"\u2003", U"\u2003", U"\u2003", U" ", U" "},
+	{U"\u2004", U"\u2004", U"\u2004", U" ", U" "},
+	{U"\u2005", U"\u2005", U"\u2005", U" ", U" "},
+	{U"\u2006", U"\u2006", U"\u2006", U" ", U" "},
+	{U"\u2007", U"\u2007", U"\u2007", U" ", U" "},
+	{U"\u2008", U"\u2008", U"\u2008", U" ", U" "},
+	{U"\u2009", U"\u2009", U"\u2009", U" ", U" "},
+	{U"\u200A", U"\u200A", U"\u200A", U" ", U" "},
+	{U"\u2011", U"\u2011", U"\u2011", U"\u2010", U"\u2010"},
+	{U"\u2017", U"\u2017", U"\u2017", U" \u0333", U" \u0333"},
+	{U"\u2024", U"\u2024", U"\u2024", U".", U"."},
+	{U"\u2025", U"\u2025", U"\u2025", U"..", U".."},
+	{U"\u2026", U"\u2026", U"\u2026", U"...", U"..."},
+	{U"\u202F", U"\u202F", U"\u202F", U" ", U" "},
+	{U"\u2033", U"\u2033", U"\u2033", U"\u2032\u2032", U"\u2032\u2032"},
+	{U"\u2034", U"\u2034", U"\u2034", U"\u2032\u2032\u2032", U"\u2032\u2032\u2032"},
+	{U"\u2036", U"\u2036", U"\u2036", U"\u2035\u2035", U"\u2035\u2035"},
+	{U"\u2037", U"\u2037", U"\u2037", U"\u2035\u2035\u2035", U"\u2035\u2035\u2035"},
+	{U"\u203C", U"\u203C", U"\u203C", U"!!", U"!!"},
+	{U"\u203E", U"\u203E", U"\u203E", U" \u0305", U" \u0305"},
+	{U"\u2047", U"\u2047", U"\u2047", U"??", U"??"},
+	{U"\u2048", U"\u2048", U"\u2048", U"?!", U"?!"},
+	{U"\u2049", U"\u2049", U"\u2049", U"!?", U"!?"},
+	{U"\u2057", U"\u2057", U"\u2057", U"\u2032\u2032\u2032\u2032", U"\u2032\u2032\u2032\u2032"},
+	{U"\u205F", U"\u205F", U"\u205F", U" ", U" "},
+	{U"\u2070", U"\u2070", U"\u2070", U"0", U"0"},
+	{U"\u2071", U"\u2071", U"\u2071", U"i", U"i"},
+	{U"\u2074", U"\u2074", U"\u2074", U"4", U"4"},
+	{U"\u2075", U"\u2075", U"\u2075", U"5", U"5"},
+	{U"\u2076", U"\u2076", U"\u2076", U"6", U"6"},
+	{U"\u2077", U"\u2077", U"\u2077", U"7", U"7"},
+	{U"\u2078", U"\u2078", U"\u2078", U"8", U"8"},
+	{U"\u2079", U"\u2079", U"\u2079", U"9", U"9"},
+	{U"\u207A", U"\u207A", U"\u207A", U"+", U"+"},
+	{U"\u207B", U"\u207B", U"\u207B", U"\u2212", U"\u2212"},
+	{U"\u207C", U"\u207C", U"\u207C", U"=", U"="},
+	{U"\u207D", U"\u207D", U"\u207D", U"(", U"("},
+	{U"\u207E", U"\u207E", U"\u207E", U")", U")"},
+	{U"\u207F", U"\u207F", U"\u207F", U"n", U"n"},
+	{U"\u2080", U"\u2080", U"\u2080", U"0", U"0"},
+	{U"\u2081", U"\u2081", U"\u2081", U"1", U"1"},
+	{U"\u2082", U"\u2082", U"\u2082", U"2", U"2"},
+	{U"\u2083", U"\u2083", U"\u2083", U"3", U"3"},
+	{U"\u2084", U"\u2084", U"\u2084", U"4", U"4"},
+	{U"\u2085", U"\u2085", U"\u2085", U"5", U"5"},
+	{U"\u2086", U"\u2086", U"\u2086", U"6", U"6"},
+	{U"\u2087", U"\u2087", U"\u2087", U"7", U"7"},
+	{U"\u2088", U"\u2088", U"\u2088", U"8", U"8"},
+	{U"\u2089", U"\u2089", U"\u2089", U"9", U"9"},
+	{U"\u208A", U"\u208A", U"\u208A", U"+", U"+"},
+	{U"\u208B", U"\u208B", U"\u208B", U"\u2212", U"\u2212"},
+	{U"\u208C", U"\u208C", U"\u208C", U"=", U"="},
+	{U"\u208D", U"\u208D", U"\u208D", U"(", U"("},
+	{U"\u208E", U"\u208E", U"\u208E", U")", U")"},
+	{U"\u2090", U"\u2090", U"\u2090", U"a", U"a"},
+	{U"\u2091", U"\u2091", U"\u2091", U"e", U"e"},
+	{U"\u2092", U"\u2092", U"\u2092", U"o", U"o"},
+	{U"\u2093", U"\u2093", U"\u2093", U"x", U"x"},
+	{U"\u2094", U"\u2094", U"\u2094", U"\u0259", U"\u0259"},
+	{U"\u2095", U"\u2095", U"\u2095", U"h", U"h"},
+	{U"\u2096", U"\u2096", U"\u2096", U"k", U"k"},
+	{U"\u2097", U"\u2097", U"\u2097", U"l", U"l"},
+	{U"\u2098", U"\u2098", U"\u2098", U"m", U"m"},
+	{U"\u2099", U"\u2099", U"\u2099", U"n", U"n"},
+	{U"\u209A", U"\u209A", U"\u209A", U"p", U"p"},
+	{U"\u209B", U"\u209B", U"\u209B", U"s", U"s"},
+	{U"\u209C", U"\u209C", U"\u209C", U"t", U"t"},
+	{U"\u20A8", U"\u20A8", U"\u20A8", U"Rs", U"Rs"},
+	{U"\u2100", U"\u2100", U"\u2100", U"a/c", U"a/c"},
+	{U"\u2101", U"\u2101", U"\u2101", U"a/s", U"a/s"},
+	{U"\u2102", U"\u2102", U"\u2102", U"C", U"C"},
+	{U"\u2103", U"\u2103", U"\u2103", U"\u00B0C", U"\u00B0C"},
+	{U"\u2105", U"\u2105", U"\u2105", U"c/o", U"c/o"},
+	{U"\u2106", U"\u2106", U"\u2106", U"c/u", U"c/u"},
+	{U"\u2107", U"\u2107", U"\u2107", U"\u0190", U"\u0190"},
+	{U"\u2109", U"\u2109", U"\u2109", U"\u00B0F", U"\u00B0F"},
+	{U"\u210A", U"\u210A", U"\u210A", U"g", U"g"},
+	{U"\u210B", U"\u210B", U"\u210B", U"H", U"H"},
+	{U"\u210C", U"\u210C", U"\u210C", U"H", U"H"},
+	{U"\u210D", U"\u210D", U"\u210D", U"H", U"H"},
+	{U"\u210E", U"\u210E", U"\u210E", U"h", U"h"},
+	{U"\u210F", U"\u210F", U"\u210F", U"\u0127", U"\u0127"},
+	{U"\u2110", U"\u2110", U"\u2110", U"I", U"I"},
+	{U"\u2111", U"\u2111", U"\u2111", U"I", U"I"},
+	{U"\u2112", U"\u2112", U"\u2112", U"L", U"L"},
+	{U"\u2113", U"\u2113", U"\u2113", U"l", U"l"},
+	{U"\u2115", U"\u2115", U"\u2115", U"N", U"N"},
+	{U"\u2116", U"\u2116", U"\u2116", U"No", U"No"},
+	{U"\u2119", U"\u2119", U"\u2119", U"P", U"P"},
+	{U"\u211A", U"\u211A", U"\u211A", U"Q", U"Q"},
+	{U"\u211B", U"\u211B", U"\u211B", U"R", U"R"},
+	{U"\u211C", U"\u211C", U"\u211C", U"R", U"R"},
+	{U"\u211D", U"\u211D", U"\u211D", U"R", U"R"},
+	{U"\u2120", U"\u2120", U"\u2120", U"SM", U"SM"},
+	{U"\u2121", U"\u2121", U"\u2121", U"TEL", U"TEL"},
+	{U"\u2122", U"\u2122", U"\u2122", U"TM", U"TM"},
+	{U"\u2124", U"\u2124", U"\u2124", U"Z", U"Z"},
+	{U"\u2126", U"\u03A9", U"\u03A9", U"\u03A9", U"\u03A9"},
+	{U"\u2128", U"\u2128", U"\u2128", U"Z", U"Z"},
+	{U"\u212A", U"K", U"K", U"K", U"K"},
+	{U"\u212B", U"\u00C5", U"A\u030A", U"\u00C5", U"A\u030A"},
+	{U"\u212C", U"\u212C", U"\u212C", U"B", U"B"},
+	{U"\u212D", U"\u212D", U"\u212D", U"C", U"C"},
+	{U"\u212F", U"\u212F", U"\u212F", U"e", U"e"},
+	{U"\u2130", U"\u2130", U"\u2130", U"E", U"E"},
+	{U"\u2131", U"\u2131", U"\u2131", U"F", U"F"},
+	{U"\u2133", U"\u2133", U"\u2133", U"M", U"M"},
+	{U"\u2134", U"\u2134", U"\u2134", U"o", U"o"},
+	{U"\u2135", U"\u2135", U"\u2135", U"\u05D0", U"\u05D0"},
+	{U"\u2136", U"\u2136", U"\u2136", U"\u05D1", U"\u05D1"},
+	{U"\u2137", U"\u2137", U"\u2137", U"\u05D2", U"\u05D2"},
+	{U"\u2138", U"\u2138", U"\u2138", U"\u05D3", U"\u05D3"},
+	{U"\u2139", U"\u2139", U"\u2139", U"i", U"i"},
+	{U"\u213B", U"\u213B", U"\u213B", U"FAX", U"FAX"},
+	{U"\u213C", U"\u213C", U"\u213C", U"\u03C0", U"\u03C0"},
+	{U"\u213D", U"\u213D", U"\u213D", U"\u03B3", U"\u03B3"},
+	{U"\u213E", U"\u213E", U"\u213E", U"\u0393", U"\u0393"},
+	{U"\u213F", U"\u213F", U"\u213F", U"\u03A0", U"\u03A0"},
+	{U"\u2140", U"\u2140", U"\u2140", U"\u2211", U"\u2211"},
+	{U"\u2145", U"\u2145", U"\u2145", U"D", U"D"},
+	{U"\u2146", U"\u2146", U"\u2146", U"d", U"d"},
+	{U"\u2147", U"\u2147", U"\u2147", U"e", U"e"},
+	{U"\u2148", U"\u2148", U"\u2148", U"i", U"i"},
+	{U"\u2149", U"\u2149", U"\u2149", U"j", U"j"},
+	{U"\u2150", U"\u2150", U"\u2150", U"1\u20447", U"1\u20447"},
+	{U"\u2151", U"\u2151", U"\u2151", U"1\u20449", U"1\u20449"},
+	{U"\u2152", U"\u2152", U"\u2152", U"1\u204410", U"1\u204410"},
+	{U"\u2153", U"\u2153", U"\u2153", U"1\u20443", U"1\u20443"},
+	{U"\u2154", U"\u2154", U"\u2154", U"2\u20443", U"2\u20443"},
+	{U"\u2155", U"\u2155", U"\u2155", U"1\u20445", U"1\u20445"},
+	{U"\u2156", U"\u2156", U"\u2156", U"2\u20445", U"2\u20445"},
+	{U"\u2157", U"\u2157", U"\u2157", U"3\u20445", U"3\u20445"},
+	{U"\u2158", U"\u2158", U"\u2158", U"4\u20445", U"4\u20445"},
+	{U"\u2159", U"\u2159", U"\u2159", U"1\u20446", U"1\u20446"},
+	{U"\u215A", U"\u215A", U"\u215A", U"5\u20446", U"5\u20446"},
+	{U"\u215B", U"\u215B", U"\u215B", U"1\u20448", U"1\u20448"},
+	{U"\u215C", U"\u215C", U"\u215C", U"3\u20448", U"3\u20448"},
+	{U"\u215D", U"\u215D", U"\u215D", U"5\u20448", U"5\u20448"},
+	{U"\u215E", U"\u215E", U"\u215E", U"7\u20448", U"7\u20448"},
+	{U"\u215F", U"\u215F", U"\u215F", U"1\u2044", U"1\u2044"},
+	{U"\u2160", U"\u2160", U"\u2160", U"I", U"I"},
+	{U"\u2161", U"\u2161", U"\u2161", U"II", U"II"},
+	{U"\u2162", U"\u2162", U"\u2162", U"III", U"III"},
+	{U"\u2163", U"\u2163", U"\u2163", U"IV", U"IV"},
+	{U"\u2164", U"\u2164", U"\u2164", U"V", U"V"},
+	{U"\u2165", U"\u2165", U"\u2165", U"VI", U"VI"},
+	{U"\u2166", U"\u2166", U"\u2166", U"VII", U"VII"},
+	{U"\u2167", U"\u2167", U"\u2167", U"VIII", U"VIII"},
+	{U"\u2168", U"\u2168", U"\u2168", U"IX", U"IX"},
+	{U"\u2169", U"\u2169", U"\u2169", U"X", U"X"},
+	{U"\u216A", U"\u216A", U"\u216A", U"XI", U"XI"},
+	{U"\u216B", U"\u216B", U"\u216B", U"XII", U"XII"},
+	{U"\u216C", U"\u216C", U"\u216C", U"L", U"L"},
+	{U"\u216D", U"\u216D", U"\u216D", U"C", U"C"},
+	{U"\u216E", U"\u216E", U"\u216E", U"D", U"D"},
+	{U"\u216F", U"\u216F", U"\u216F", U"M", U"M"},
+	{U"\u2170", U"\u2170", U"\u2170", U"i", U"i"},
+	{U"\u2171", U"\u2171", U"\u2171", U"ii", U"ii"},
+	{U"\u2172", U"\u2172", U"\u2172", U"iii", U"iii"},
+	{U"\u2173", U"\u2173", U"\u2173", U"iv", U"iv"},
+	{U"\u2174", U"\u2174", U"\u2174", U"v", U"v"},
+	{U"\u2175", U"\u2175", U"\u2175", U"vi", U"vi"},
+	{U"\u2176", U"\u2176", U"\u2176", U"vii", U"vii"},
+	{U"\u2177", U"\u2177", U"\u2177", U"viii", U"viii"},
+	{U"\u2178", U"\u2178", U"\u2178", U"ix", U"ix"},
+	{U"\u2179", U"\u2179", U"\u2179", U"x", U"x"},
+	{U"\u217A", U"\u217A", U"\u217A", U"xi", U"xi"},
+	{U"\u217B", U"\u217B", U"\u217B", U"xii", U"xii"},
+	{U"\u217C", U"\u217C", U"\u217C", U"l", U"l"},
+	{U"\u217D", U"\u217D", U"\u217D", U"c", U"c"},
+	{U"\u217E", U"\u217E", U"\u217E", U"d", U"d"},
+	{U"\u217F", U"\u217F", U"\u217F", U"m", U"m"},
+	{U"\u2189", U"\u2189", U"\u2189", U"0\u20443", U"0\u20443"},
+	{U"\u219A", U"\u219A", U"\u2190\u0338", U"\u219A", U"\u2190\u0338"},
+	{U"\u219B", U"\u219B", U"\u2192\u0338", U"\u219B", U"\u2192\u0338"},
+	{U"\u21AE", U"\u21AE", U"\u2194\u0338", U"\u21AE", U"\u2194\u0338"},
+	{U"\u21CD", U"\u21CD", U"\u21D0\u0338", U"\u21CD", U"\u21D0\u0338"},
+	{U"\u21CE", U"\u21CE", U"\u21D4\u0338", U"\u21CE", U"\u21D4\u0338"},
+	{U"\u21CF", U"\u21CF", U"\u21D2\u0338", U"\u21CF", U"\u21D2\u0338"},
+	{U"\u2204", U"\u2204", U"\u2203\u0338", U"\u2204", U"\u2203\u0338"},
+	{U"\u2209", U"\u2209", U"\u2208\u0338", U"\u2209", U"\u2208\u0338"},
+	{U"\u220C", U"\u220C", U"\u220B\u0338", U"\u220C", U"\u220B\u0338"},
+	{U"\u2224", U"\u2224", U"\u2223\u0338", U"\u2224", U"\u2223\u0338"},
+	{U"\u2226", U"\u2226", U"\u2225\u0338", U"\u2226", U"\u2225\u0338"},
+	{U"\u222C", U"\u222C", U"\u222C", U"\u222B\u222B", U"\u222B\u222B"},
+	{U"\u222D", U"\u222D", U"\u222D", U"\u222B\u222B\u222B", U"\u222B\u222B\u222B"},
+	{U"\u222F", U"\u222F", U"\u222F", U"\u222E\u222E", U"\u222E\u222E"},
+	{U"\u2230", U"\u2230", U"\u2230", U"\u222E\u222E\u222E", U"\u222E\u222E\u222E"},
+	{U"\u2241", U"\u2241", U"\u223C\u0338", U"\u2241", U"\u223C\u0338"},
+	{U"\u2244", U"\u2244", U"\u2243\u0338", U"\u2244", U"\u2243\u0338"},
+	{U"\u2247", U"\u2247", U"\u2245\u0338", U"\u2247", U"\u2245\u0338"},
+	{U"\u2249", U"\u2249", U"\u2248\u0338", U"\u2249", U"\u2248\u0338"},
+	{U"\u2260", U"\u2260", U"=\u0338", U"\u2260", U"=\u0338"},
+	{U"\u2262", U"\u2262", U"\u2261\u0338", U"\u2262", U"\u2261\u0338"},
+	{U"\u226D", U"\u226D", U"\u224D\u0338", U"\u226D", U"\u224D\u0338"},
+	{U"\u226E", U"\u226E", U"<\u0338", U"\u226E", U"<\u0338"},
+	{U"\u226F", U"\u226F", U">\u0338", U"\u226F", U">\u0338"},
+	{U"\u2270", U"\u2270", U"\u2264\u0338", U"\u2270", U"\u2264\u0338"},
+	{U"\u2271", U"\u2271", U"\u2265\u0338", U"\u2271", U"\u2265\u0338"},
+	{U"\u2274", U"\u2274", U"\u2272\u0338", U"\u2274", U"\u2272\u0338"},
+	{U"\u2275", U"\u2275", U"\u2273\u0338", U"\u2275", U"\u2273\u0338"},
+	{U"\u2278", U"\u2278", U"\u2276\u0338", U"\u2278", U"\u2276\u0338"},
+	{U"\u2279", U"\u2279", U"\u2277\u0338", U"\u2279", U"\u2277\u0338"},
+	{U"\u2280", U"\u2280", U"\u227A\u0338", U"\u2280", U"\u227A\u0338"},
+	{U"\u2281", U"\u2281", U"\u227B\u0338", U"\u2281", U"\u227B\u0338"},
+	{U"\u2284", U"\u2284", U"\u2282\u0338", U"\u2284", U"\u2282\u0338"},
+	{U"\u2285", U"\u2285", U"\u2283\u0338", U"\u2285", U"\u2283\u0338"},
+	{U"\u2288", U"\u2288", U"\u2286\u0338", U"\u2288", U"\u2286\u0338"},
+	{U"\u2289", U"\u2289", U"\u2287\u0338", U"\u2289", U"\u2287\u0338"},
+	{U"\u22AC", U"\u22AC", U"\u22A2\u0338", U"\u22AC", U"\u22A2\u0338"},
+	{U"\u22AD", U"\u22AD", U"\u22A8\u0338", U"\u22AD", U"\u22A8\u0338"},
+	{U"\u22AE", U"\u22AE", U"\u22A9\u0338", U"\u22AE", U"\u22A9\u0338"},
+	{U"\u22AF", U"\u22AF", U"\u22AB\u0338", U"\u22AF", U"\u22AB\u0338"},
+	{U"\u22E0", U"\u22E0", U"\u227C\u0338", U"\u22E0", U"\u227C\u0338"},
+	{U"\u22E1", U"\u22E1", U"\u227D\u0338", U"\u22E1", U"\u227D\u0338"},
+	{U"\u22E2", U"\u22E2", U"\u2291\u0338", U"\u22E2", U"\u2291\u0338"},
+	{U"\u22E3", U"\u22E3", U"\u2292\u0338", U"\u22E3", U"\u2292\u0338"},
+	{U"\u22EA", U"\u22EA", U"\u22B2\u0338", U"\u22EA", U"\u22B2\u0338"},
+	{U"\u22EB", U"\u22EB", U"\u22B3\u0338", U"\u22EB", U"\u22B3\u0338"},
+	{U"\u22EC", U"\u22EC", U"\u22B4\u0338", U"\u22EC", U"\u22B4\u0338"},
+	{U"\u22ED", U"\u22ED", U"\u22B5\u0338", U"\u22ED", U"\u22B5\u0338"},
+	{U"\u2329", U"\u3008", U"\u3008", U"\u3008", U"\u3008"},
+	{U"\u232A", U"\u3009", U"\u3009", U"\u3009", U"\u3009"},
+	{U"\u2460", U"\u2460", U"\u2460", U"1", U"1"},
+	{U"\u2461", U"\u2461", U"\u2461", U"2", U"2"},
+	{U"\u2462", U"\u2462", U"\u2462", U"3", U"3"},
+	{U"\u2463", U"\u2463", U"\u2463", U"4", U"4"},
+	{U"\u2464", U"\u2464", U"\u2464", U"5", U"5"},
+	{U"\u2465", U"\u2465", U"\u2465", U"6", U"6"},
+	{U"\u2466", U"\u2466", U"\u2466", U"7", U"7"},
+	{U"\u2467", U"\u2467", U"\u2467", U"8", U"8"},
+	{U"\u2468", U"\u2468", U"\u2468", U"9", U"9"},
+	{U"\u2469", U"\u2469", U"\u2469", U"10", U"10"},
+	{U"\u246A", U"\u246A", U"\u246A", U"11", U"11"},
+	{U"\u246B", U"\u246B", U"\u246B", U"12", U"12"},
+	{U"\u246C", U"\u246C", U"\u246C", U"13", U"13"},
+	{U"\u246D", U"\u246D", U"\u246D", U"14", U"14"},
+	{U"\u246E", U"\u246E", U"\u246E", U"15", U"15"},
+	{U"\u246F", U"\u246F", U"\u246F", U"16", U"16"},
+	{U"\u2470", U"\u2470", U"\u2470", U"17", U"17"},
+	{U"\u2471", U"\u2471", U"\u2471", U"18", U"18"},
+	{U"\u2472", U"\u2472", U"\u2472", U"19", U"19"},
+	{U"\u2473", U"\u2473", U"\u2473", U"20", U"20"},
+	{U"\u2474", U"\u2474", U"\u2474", U"(1)", U"(1)"},
+	{U"\u2475", U"\u2475", U"\u2475", U"(2)", U"(2)"},
+	{U"\u2476", U"\u2476", U"\u2476", U"(3)", U"(3)"},
+	{U"\u2477", U"\u2477", U"\u2477", U"(4)", U"(4)"},
+	{U"\u2478", U"\u2478", U"\u2478", U"(5)", U"(5)"},
+	{U"\u2479", U"\u2479", U"\u2479", U"(6)", U"(6)"},
+	{U"\u247A", U"\u247A", U"\u247A", U"(7)", U"(7)"},
+	{U"\u247B", U"\u247B", U"\u247B", U"(8)", U"(8)"},
+	{U"\u247C", U"\u247C", U"\u247C", U"(9)", U"(9)"},
+	{U"\u247D", U"\u247D", U"\u247D", U"(10)", U"(10)"},
+	{U"\u247E", U"\u247E", U"\u247E", U"(11)", U"(11)"},
+	{U"\u247F", U"\u247F", U"\u247F", U"(12)", U"(12)"},
+	{U"\u2480", U"\u2480", U"\u2480", U"(13)", U"(13)"},
+	{U"\u2481", U"\u2481", U"\u2481", U"(14)", U"(14)"},
+	{U"\u2482", U"\u2482", U"\u2482", U"(15)", U"(15)"},
+	{U"\u2483", U"\u2483", U"\u2483", U"(16)", U"(16)"},
+	{U"\u2484", U"\u2484", U"\u2484", U"(17)", U"(17)"},
+	{U"\u2485", U"\u2485", U"\u2485", U"(18)", U"(18)"},
+	{U"\u2486", U"\u2486", U"\u2486", U"(19)", U"(19)"},
+	{U"\u2487", U"\u2487", U"\u2487", U"(20)", U"(20)"},
+	{U"\u2488", U"\u2488", U"\u2488", U"1.", U"1."},
+	{U"\u2489", U"\u2489", U"\u2489", U"2.", U"2."},
+	{U"\u248A", U"\u248A", U"\u248A", U"3.", U"3."},
+	{U"\u248B", U"\u248B", U"\u248B", U"4.", U"4."},
+	{U"\u248C", U"\u248C", U"\u248C", U"5.", U"5."},
+	{U"\u248D", U"\u248D", U"\u248D", U"6.", U"6."},
+	{U"\u248E", U"\u248E", U"\u248E", U"7.", U"7."},
+	{U"\u248F", U"\u248F", U"\u248F", U"8.", U"8."},
+	{U"\u2490", U"\u2490", U"\u2490", U"9.", U"9."},
+	{U"\u2491", U"\u2491", U"\u2491", U"10.", U"10."},
+	{U"\u2492", U"\u2492", U"\u2492", U"11.", U"11."},
+	{U"\u2493", U"\u2493", U"\u2493", U"12.", U"12."},
+	{U"\u2494", U"\u2494", U"\u2494", U"13.", U"13."},
+	{U"\u2495", U"\u2495", U"\u2495", U"14.", U"14."},
+	{U"\u2496", U"\u2496", U"\u2496", U"15.", U"15."},
+	{U"\u2497", U"\u2497", U"\u2497", U"16.", U"16."},
+	{U"\u2498", U"\u2498", U"\u2498", U"17.", U"17."},
+	{U"\u2499", U"\u2499", U"\u2499", U"18.", U"18."},
+	{U"\u249A", U"\u249A", U"\u249A", U"19.", U"19."},
+	{U"\u249B", U"\u249B", U"\u249B", U"20.", U"20."},
+	{U"\u249C", U"\u249C", U"\u249C", U"(a)", U"(a)"},
+	{U"\u249D", U"\u249D", U"\u249D", U"(b)", U"(b)"},
+	{U"\u249E", U"\u249E", U"\u249E", U"(c)", U"(c)"},
+	{U"\u249F", U"\u249F", U"\u249F", U"(d)", U"(d)"},
+	{U"\u24A0", U"\u24A0", U"\u24A0", U"(e)", U"(e)"},
+	{U"\u24A1", U"\u24A1", U"\u24A1", U"(f)", U"(f)"},
+	{U"\u24A2", U"\u24A2", U"\u24A2", U"(g)", U"(g)"},
+	{U"\u24A3", U"\u24A3", U"\u24A3", U"(h)", U"(h)"},
+	{U"\u24A4", U"\u24A4", U"\u24A4", U"(i)", U"(i)"},
+	{U"\u24A5", U"\u24A5", U"\u24A5", U"(j)", U"(j)"},
+	{U"\u24A6", U"\u24A6", U"\u24A6", U"(k)", U"(k)"},
+	{U"\u24A7", U"\u24A7", U"\u24A7", U"(l)", U"(l)"},
+	{U"\u24A8", U"\u24A8", U"\u24A8", U"(m)", U"(m)"},
+	{U"\u24A9", U"\u24A9", U"\u24A9", U"(n)", U"(n)"},
+	{U"\u24AA", U"\u24AA", U"\u24AA", U"(o)", U"(o)"},
+	{U"\u24AB", U"\u24AB", U"\u24AB", U"(p)", U"(p)"},
+	{U"\u24AC", U"\u24AC", U"\u24AC", U"(q)", U"(q)"},
+	{U"\u24AD", U"\u24AD", U"\u24AD", U"(r)", U"(r)"},
+	{U"\u24AE", U"\u24AE", U"\u24AE", U"(s)", U"(s)"},
+	{U"\u24AF", U"\u24AF", U"\u24AF", U"(t)", U"(t)"},
+	{U"\u24B0", U"\u24B0", U"\u24B0", U"(u)", U"(u)"},
+	{U"\u24B1", U"\u24B1", U"\u24B1", U"(v)", U"(v)"},
+	{U"\u24B2", U"\u24B2", U"\u24B2", U"(w)", U"(w)"},
+	{U"\u24B3", U"\u24B3", U"\u24B3", U"(x)", U"(x)"},
+	{U"\u24B4", U"\u24B4", U"\u24B4", U"(y)", U"(y)"},
+	{U"\u24B5", U"\u24B5", U"\u24B5", U"(z)", U"(z)"},
+	{U"\u24B6", U"\u24B6", U"\u24B6", U"A", U"A"},
+	{U"\u24B7", U"\u24B7", U"\u24B7", U"B", U"B"},
+	{U"\u24B8", U"\u24B8", U"\u24B8", U"C", U"C"},
+	{U"\u24B9", U"\u24B9", U"\u24B9", U"D", U"D"},
+	{U"\u24BA", U"\u24BA", U"\u24BA", U"E", U"E"},
+	{U"\u24BB", U"\u24BB", U"\u24BB", U"F", U"F"},
+	{U"\u24BC", U"\u24BC", U"\u24BC", U"G", U"G"},
+	{U"\u24BD", U"\u24BD", U"\u24BD", U"H", U"H"},
+	{U"\u24BE", U"\u24BE", U"\u24BE", U"I", U"I"},
+	{U"\u24BF", U"\u24BF", U"\u24BF", U"J", U"J"},
+	{U"\u24C0", U"\u24C0", U"\u24C0", U"K", U"K"},
+	{U"\u24C1", U"\u24C1", U"\u24C1", U"L", U"L"},
+	{U"\u24C2", U"\u24C2", U"\u24C2", U"M", U"M"},
+	{U"\u24C3", U"\u24C3", U"\u24C3", U"N", U"N"},
+	{U"\u24C4", U"\u24C4", U"\u24C4", U"O", U"O"},
+	{U"\u24C5", U"\u24C5", U"\u24C5", U"P", U"P"},
+	{U"\u24C6", U"\u24C6", U"\u24C6", U"Q", U"Q"},
+	{U"\u24C7", U"\u24C7", U"\u24C7", U"R", U"R"},
+	{U"\u24C8", U"\u24C8", U"\u24C8", U"S", U"S"},
+	{U"\u24C9", U"\u24C9", U"\u24C9", U"T", U"T"},
+	{U"\u24CA", U"\u24CA", U"\u24CA", U"U", U"U"},
+	{U"\u24CB", U"\u24CB", U"\u24CB", U"V", U"V"},
+	{U"\u24CC", U"\u24CC", U"\u24CC", U"W", U"W"},
+	{U"\u24CD", U"\u24CD", U"\u24CD", U"X", U"X"},
+	{U"\u24CE", U"\u24CE", U"\u24CE", U"Y", U"Y"},
+	{U"\u24CF", U"\u24CF", U"\u24CF", U"Z", U"Z"},
+	{U"\u24D0", U"\u24D0", U"\u24D0", U"a", U"a"},
+	{U"\u24D1", U"\u24D1", U"\u24D1", U"b", U"b"},
+	{U"\u24D2", U"\u24D2", U"\u24D2", U"c", U"c"},
+	{U"\u24D3", U"\u24D3", U"\u24D3", U"d", U"d"},
+	{U"\u24D4", U"\u24D4", U"\u24D4", U"e", U"e"},
+	{U"\u24D5", U"\u24D5", U"\u24D5", U"f", U"f"},
+	{U"\u24D6", U"\u24D6", U"\u24D6", U"g", U"g"},
+	{U"\u24D7", U"\u24D7", U"\u24D7", U"h", U"h"},
+	{U"\u24D8", U"\u24D8", U"\u24D8", U"i", U"i"},
+	{U"\u24D9", U"\u24D9", U"\u24D9", U"j", U"j"},
+	{U"\u24DA", U"\u24DA", U"\u24DA", U"k", U"k"},
+	{U"\u24DB", U"\u24DB", U"\u24DB", U"l", U"l"},
+	{U"\u24DC", U"\u24DC", U"\u24DC", U"m", U"m"},
+	{U"\u24DD", U"\u24DD", U"\u24DD", U"n", U"n"},
+	{U"\u24DE", U"\u24DE", U"\u24DE", U"o", U"o"},
+	{U"\u24DF", U"\u24DF", U"\u24DF", U"p", U"p"},
+	{U"\u24E0", U"\u24E0", U"\u24E0", U"q", U"q"},
+	{U"\u24E1", U"\u24E1", U"\u24E1", U"r", U"r"},
+	{U"\u24E2", U"\u24E2", U"\u24E2", U"s", U"s"},
+	{U"\u24E3", U"\u24E3", U"\u24E3", U"t", U"t"},
+	{U"\u24E4", U"\u24E4", U"\u24E4", U"u", U"u"},
+	{U"\u24E5", U"\u24E5", U"\u24E5", U"v", U"v"},
+	{U"\u24E6", U"\u24E6", U"\u24E6", U"w", U"w"},
+	{U"\u24E7", U"\u24E7", U"\u24E7", U"x", U"x"},
+	{U"\u24E8", U"\u24E8", U"\u24E8", U"y", U"y"},
+	{U"\u24E9", U"\u24E9", U"\u24E9", U"z", U"z"},
+	{U"\u24EA", U"\u24EA", U"\u24EA", U"0", U"0"},
+	{U"\u2A0C", U"\u2A0C", U"\u2A0C", U"\u222B\u222B\u222B\u222B", U"\u222B\u222B\u222B\u222B"},
+	{U"\u2A74", U"\u2A74", U"\u2A74", U"::=", U"::="},
+	{U"\u2A75", U"\u2A75", U"\u2A75", U"==", U"=="},
+	{U"\u2A76", U"\u2A76", U"\u2A76", U"===", U"==="},
+	{U"\u2ADC", U"\u2ADD\u0338", U"\u2ADD\u0338", U"\u2ADD\u0338", U"\u2ADD\u0338"},
+	{U"\u2C7C", U"\u2C7C", U"\u2C7C", U"j", U"j"},
+	{U"\u2C7D", U"\u2C7D", U"\u2C7D", U"V", U"V"},
+	{U"\u2D6F", U"\u2D6F", U"\u2D6F", U"\u2D61", U"\u2D61"},
+	{U"\u2E9F", U"\u2E9F", U"\u2E9F", U"\u6BCD", U"\u6BCD"},
+	{U"\u2EF3", U"\u2EF3", U"\u2EF3", U"\u9F9F", U"\u9F9F"},
+	{U"\u2F00", U"\u2F00", U"\u2F00", U"\u4E00", U"\u4E00"},
+	{U"\u2F01", U"\u2F01", U"\u2F01", U"\u4E28", U"\u4E28"},
+	{U"\u2F02", U"\u2F02", U"\u2F02", U"\u4E36", U"\u4E36"},
+	{U"\u2F03", U"\u2F03", U"\u2F03", U"\u4E3F", U"\u4E3F"},
+	{U"\u2F04", U"\u2F04", U"\u2F04", U"\u4E59", U"\u4E59"},
+	{U"\u2F05", U"\u2F05", U"\u2F05", U"\u4E85", U"\u4E85"},
+	{U"\u2F06", U"\u2F06", U"\u2F06", U"\u4E8C", U"\u4E8C"},
+	{U"\u2F07", U"\u2F07", U"\u2F07", U"\u4EA0", U"\u4EA0"},
+	{U"\u2F08", U"\u2F08", U"\u2F08", U"\u4EBA", U"\u4EBA"},
+	{U"\u2F09", U"\u2F09", U"\u2F09", U"\u513F", U"\u513F"},
+	{U"\u2F0A", U"\u2F0A", U"\u2F0A", U"\u5165", U"\u5165"},
+	{U"\u2F0B", U"\u2F0B", U"\u2F0B", U"\u516B", U"\u516B"},
+	{U"\u2F0C", U"\u2F0C", U"\u2F0C", U"\u5182", U"\u5182"},
+	{U"\u2F0D", U"\u2F0D", U"\u2F0D", U"\u5196", U"\u5196"},
+	{U"\u2F0E", U"\u2F0E", U"\u2F0E", U"\u51AB", U"\u51AB"},
+	{U"\u2F0F", U"\u2F0F", U"\u2F0F", U"\u51E0", U"\u51E0"},
+	{U"\u2F10", U"\u2F10", U"\u2F10", U"\u51F5", U"\u51F5"},
+	{U"\u2F11", U"\u2F11", U"\u2F11", U"\u5200", U"\u5200"},
+	{U"\u2F12", U"\u2F12", U"\u2F12", U"\u529B", U"\u529B"},
+	{U"\u2F13", U"\u2F13", U"\u2F13", U"\u52F9", U"\u52F9"},
+	{U"\u2F14", U"\u2F14", U"\u2F14", U"\u5315", U"\u5315"},
+	{U"\u2F15", U"\u2F15", U"\u2F15", U"\u531A", U"\u531A"},
+	{U"\u2F16", U"\u2F16", U"\u2F16", U"\u5338", U"\u5338"},
+	{U"\u2F17", U"\u2F17", U"\u2F17", U"\u5341", U"\u5341"},
+	{U"\u2F18", U"\u2F18", U"\u2F18", U"\u535C", U"\u535C"},
+	{U"\u2F19", U"\u2F19", U"\u2F19", U"\u5369", U"\u5369"},
+	{U"\u2F1A", U"\u2F1A", U"\u2F1A", U"\u5382", U"\u5382"},
+	{U"\u2F1B", U"\u2F1B", U"\u2F1B", U"\u53B6", U"\u53B6"},
+	{U"\u2F1C", U"\u2F1C", U"\u2F1C", U"\u53C8", U"\u53C8"},
+	{U"\u2F1D", U"\u2F1D", U"\u2F1D", U"\u53E3", U"\u53E3"},
+	{U"\u2F1E", U"\u2F1E", U"\u2F1E", U"\u56D7", U"\u56D7"},
+	{U"\u2F1F", U"\u2F1F", U"\u2F1F", U"\u571F", U"\u571F"},
+	{U"\u2F20", U"\u2F20", U"\u2F20", U"\u58EB", U"\u58EB"},
+	{U"\u2F21", U"\u2F21", U"\u2F21", U"\u5902", U"\u5902"},
+	{U"\u2F22", U"\u2F22", U"\u2F22", U"\u590A", U"\u590A"},
+	{U"\u2F23", U"\u2F23", U"\u2F23", U"\u5915", U"\u5915"},
+	{U"\u2F24", U"\u2F24", U"\u2F24", U"\u5927", U"\u5927"},
+	{U"\u2F25", U"\u2F25", U"\u2F25", U"\u5973", U"\u5973"},
+	{U"\u2F26", U"\u2F26", U"\u2F26", U"\u5B50", U"\u5B50"},
+	{U"\u2F27", U"\u2F27", U"\u2F27", U"\u5B80", U"\u5B80"},
+	{U"\u2F28", U"\u2F28", U"\u2F28", U"\u5BF8", U"\u5BF8"},
+	{U"\u2F29", U"\u2F29", U"\u2F29", U"\u5C0F", U"\u5C0F"},
+	{U"\u2F2A", U"\u2F2A", U"\u2F2A", U"\u5C22", U"\u5C22"},
+	{U"\u2F2B", U"\u2F2B", U"\u2F2B", U"\u5C38", U"\u5C38"},
+	{U"\u2F2C", U"\u2F2C", U"\u2F2C", U"\u5C6E", U"\u5C6E"},
+	{U"\u2F2D", U"\u2F2D", U"\u2F2D", U"\u5C71", U"\u5C71"},
+	{U"\u2F2E", U"\u2F2E", U"\u2F2E", U"\u5DDB", U"\u5DDB"},
+	{U"\u2F2F", U"\u2F2F", U"\u2F2F", U"\u5DE5", U"\u5DE5"},
+	{U"\u2F30", U"\u2F30", U"\u2F30", U"\u5DF1", U"\u5DF1"},
+	{U"\u2F31", U"\u2F31", U"\u2F31", U"\u5DFE", U"\u5DFE"},
+	{U"\u2F32", U"\u2F32", U"\u2F32", U"\u5E72", U"\u5E72"},
+	{U"\u2F33", U"\u2F33", U"\u2F33", U"\u5E7A", U"\u5E7A"},
+	{U"\u2F34", U"\u2F34", U"\u2F34", U"\u5E7F", U"\u5E7F"},
+	{U"\u2F35", U"\u2F35", U"\u2F35", U"\u5EF4", U"\u5EF4"},
+	{U"\u2F36", U"\u2F36", U"\u2F36", U"\u5EFE", U"\u5EFE"},
+	{U"\u2F37", U"\u2F37", U"\u2F37", U"\u5F0B", U"\u5F0B"},
+	{U"\u2F38", U"\u2F38", U"\u2F38", U"\u5F13", U"\u5F13"},
+	{U"\u2F39", U"\u2F39", U"\u2F39", U"\u5F50", U"\u5F50"},
+	{U"\u2F3A", U"\u2F3A", U"\u2F3A", U"\u5F61", U"\u5F61"},
+	{U"\u2F3B", U"\u2F3B", U"\u2F3B", U"\u5F73", U"\u5F73"},
+	{U"\u2F3C", U"\u2F3C", U"\u2F3C", U"\u5FC3", U"\u5FC3"},
+	{U"\u2F3D", U"\u2F3D", U"\u2F3D", U"\u6208", U"\u6208"},
+	{U"\u2F3E", U"\u2F3E", U"\u2F3E", U"\u6236", U"\u6236"},
+	{U"\u2F3F", U"\u2F3F", U"\u2F3F", U"\u624B", U"\u624B"},
+	{U"\u2F40", U"\u2F40", U"\u2F40", U"\u652F", U"\u652F"},
+	{U"\u2F41", U"\u2F41", U"\u2F41", U"\u6534", U"\u6534"},
+	{U"\u2F42", U"\u2F42", U"\u2F42", U"\u6587", U"\u6587"},
+	{U"\u2F43", U"\u2F43", U"\u2F43", U"\u6597", U"\u6597"},
+	{U"\u2F44", U"\u2F44", U"\u2F44", U"\u65A4", U"\u65A4"},
+	{U"\u2F45", U"\u2F45", U"\u2F45", U"\u65B9", U"\u65B9"},
+	{U"\u2F46", U"\u2F46", U"\u2F46", U"\u65E0", U"\u65E0"},
+	{U"\u2F47", U"\u2F47", U"\u2F47", U"\u65E5", U"\u65E5"},
+	{U"\u2F48", U"\u2F48", U"\u2F48", U"\u66F0", U"\u66F0"},
+	{U"\u2F49", U"\u2F49", U"\u2F49", U"\u6708", U"\u6708"},
+	{U"\u2F4A", U"\u2F4A", U"\u2F4A", U"\u6728", U"\u6728"},
+	{U"\u2F4B", U"\u2F4B", U"\u2F4B", U"\u6B20", U"\u6B20"},
+	{U"\u2F4C", U"\u2F4C", U"\u2F4C", U"\u6B62", U"\u6B62"},
+	{U"\u2F4D", U"\u2F4D", U"\u2F4D", U"\u6B79", U"\u6B79"},
+	{U"\u2F4E", U"\u2F4E", U"\u2F4E", U"\u6BB3", U"\u6BB3"},
+	{U"\u2F4F", U"\u2F4F", U"\u2F4F", U"\u6BCB", U"\u6BCB"},
+	{U"\u2F50", U"\u2F50", U"\u2F50", U"\u6BD4", U"\u6BD4"},
+	{U"\u2F51", U"\u2F51", U"\u2F51", U"\u6BDB", U"\u6BDB"},
+	{U"\u2F52", U"\u2F52", U"\u2F52", U"\u6C0F", U"\u6C0F"},
+	{U"\u2F53", U"\u2F53", U"\u2F53", U"\u6C14", U"\u6C14"},
+	{U"\u2F54", U"\u2F54", U"\u2F54", U"\u6C34", U"\u6C34"},
+	{U"\u2F55", U"\u2F55", U"\u2F55", U"\u706B", U"\u706B"},
+	{U"\u2F56", U"\u2F56", U"\u2F56", U"\u722A", U"\u722A"},
+	{U"\u2F57", U"\u2F57", U"\u2F57", U"\u7236", U"\u7236"},
+	{U"\u2F58", U"\u2F58", U"\u2F58", U"\u723B", U"\u723B"},
+	{U"\u2F59", U"\u2F59", U"\u2F59", U"\u723F", U"\u723F"},
+	{U"\u2F5A", U"\u2F5A", U"\u2F5A", U"\u7247", U"\u7247"},
+	{U"\u2F5B", U"\u2F5B", U"\u2F5B", U"\u7259", U"\u7259"},
+	{U"\u2F5C", U"\u2F5C", U"\u2F5C", U"\u725B", U"\u725B"},
+	{U"\u2F5D", U"\u2F5D", U"\u2F5D", U"\u72AC", U"\u72AC"},
+	{U"\u2F5E", U"\u2F5E", U"\u2F5E", U"\u7384", U"\u7384"},
+	{U"\u2F5F", U"\u2F5F", U"\u2F5F", U"\u7389", U"\u7389"},
+	{U"\u2F60", U"\u2F60", U"\u2F60", U"\u74DC", U"\u74DC"},
+	{U"\u2F61", U"\u2F61", U"\u2F61", U"\u74E6", U"\u74E6"},
+	{U"\u2F62", U"\u2F62", U"\u2F62", U"\u7518", U"\u7518"},
+	{U"\u2F63", U"\u2F63", U"\u2F63", U"\u751F", U"\u751F"},
+	{U"\u2F64", U"\u2F64", U"\u2F64", U"\u7528", U"\u7528"},
+	{U"\u2F65", U"\u2F65", U"\u2F65", U"\u7530", U"\u7530"},
+	{U"\u2F66", U"\u2F66", U"\u2F66", U"\u758B", U"\u758B"},
+	{U"\u2F67", U"\u2F67", U"\u2F67", U"\u7592", U"\u7592"},
+	{U"\u2F68", U"\u2F68", U"\u2F68", U"\u7676", U"\u7676"},
+	{U"\u2F69", U"\u2F69", U"\u2F69", U"\u767D", U"\u767D"},
+	{U"\u2F6A", U"\u2F6A", U"\u2F6A", U"\u76AE", U"\u76AE"},
+	{U"\u2F6B", U"\u2F6B", U"\u2F6B", U"\u76BF", U"\u76BF"},
+	{U"\u2F6C", U"\u2F6C", U"\u2F6C", U"\u76EE", U"\u76EE"},
+	{U"\u2F6D", U"\u2F6D", U"\u2F6D", U"\u77DB", U"\u77DB"},
+	{U"\u2F6E", U"\u2F6E", U"\u2F6E", U"\u77E2", U"\u77E2"},
+	{U"\u2F6F", U"\u2F6F", U"\u2F6F", U"\u77F3", U"\u77F3"},
+	{U"\u2F70", U"\u2F70", U"\u2F70", U"\u793A", U"\u793A"},
+	{U"\u2F71", U"\u2F71", U"\u2F71", U"\u79B8", U"\u79B8"},
+	{U"\u2F72", U"\u2F72", U"\u2F72", U"\u79BE", U"\u79BE"},
+	{U"\u2F73", U"\u2F73", U"\u2F73", U"\u7A74", U"\u7A74"},
+	{U"\u2F74", U"\u2F74", U"\u2F74", U"\u7ACB", U"\u7ACB"},
+	{U"\u2F75", U"\u2F75", U"\u2F75", U"\u7AF9", U"\u7AF9"},
+	{U"\u2F76", U"\u2F76", U"\u2F76", U"\u7C73", U"\u7C73"},
+	{U"\u2F77", U"\u2F77", U"\u2F77", U"\u7CF8", U"\u7CF8"},
+	{U"\u2F78", U"\u2F78", U"\u2F78", U"\u7F36", U"\u7F36"},
+	{U"\u2F79", U"\u2F79", U"\u2F79", U"\u7F51", U"\u7F51"},
+	{U"\u2F7A", U"\u2F7A", U"\u2F7A", U"\u7F8A", U"\u7F8A"},
+	{U"\u2F7B", U"\u2F7B", U"\u2F7B", U"\u7FBD", U"\u7FBD"},
+	{U"\u2F7C", U"\u2F7C", U"\u2F7C", U"\u8001", U"\u8001"},
+	{U"\u2F7D", U"\u2F7D", U"\u2F7D", U"\u800C", U"\u800C"},
+	{U"\u2F7E", U"\u2F7E", U"\u2F7E", U"\u8012", U"\u8012"},
+	{U"\u2F7F", U"\u2F7F", U"\u2F7F", U"\u8033", U"\u8033"},
+	{U"\u2F80", U"\u2F80", U"\u2F80", U"\u807F", U"\u807F"},
+	{U"\u2F81", U"\u2F81", U"\u2F81", U"\u8089", U"\u8089"},
+	{U"\u2F82", U"\u2F82", U"\u2F82", U"\u81E3", U"\u81E3"},
+	{U"\u2F83", U"\u2F83", U"\u2F83", U"\u81EA", U"\u81EA"},
+	{U"\u2F84", U"\u2F84", U"\u2F84", U"\u81F3", U"\u81F3"},
+	{U"\u2F85", U"\u2F85", U"\u2F85", U"\u81FC", U"\u81FC"},
+	{U"\u2F86", U"\u2F86", U"\u2F86", U"\u820C", U"\u820C"},
+	{U"\u2F87", U"\u2F87", U"\u2F87", U"\u821B", U"\u821B"},
+	{U"\u2F88", U"\u2F88", U"\u2F88", U"\u821F", U"\u821F"},
+	{U"\u2F89", U"\u2F89", U"\u2F89", U"\u826E", U"\u826E"},
+	{U"\u2F8A", U"\u2F8A", U"\u2F8A", U"\u8272", U"\u8272"},
+	{U"\u2F8B", U"\u2F8B", U"\u2F8B", U"\u8278", U"\u8278"},
+	{U"\u2F8C", U"\u2F8C", U"\u2F8C", U"\u864D", U"\u864D"},
+	{U"\u2F8D", U"\u2F8D", U"\u2F8D", U"\u866B", U"\u866B"},
+	{U"\u2F8E", U"\u2F8E", U"\u2F8E", U"\u8840", U"\u8840"},
+	{U"\u2F8F", U"\u2F8F", U"\u2F8F", U"\u884C", U"\u884C"},
+	{U"\u2F90", U"\u2F90", U"\u2F90", U"\u8863", U"\u8863"},
+	{U"\u2F91", U"\u2F91", U"\u2F91", U"\u897E", U"\u897E"},
+	{U"\u2F92", U"\u2F92", U"\u2F92", U"\u898B", U"\u898B"},
+	{U"\u2F93", U"\u2F93", U"\u2F93", U"\u89D2", U"\u89D2"},
+	{U"\u2F94", U"\u2F94", U"\u2F94", U"\u8A00", U"\u8A00"},
+	{U"\u2F95", U"\u2F95", U"\u2F95", U"\u8C37", U"\u8C37"},
+	{U"\u2F96", U"\u2F96", U"\u2F96", U"\u8C46", U"\u8C46"},
+	{U"\u2F97", U"\u2F97", U"\u2F97", U"\u8C55", U"\u8C55"},
+	{U"\u2F98", U"\u2F98", U"\u2F98", U"\u8C78", U"\u8C78"},
+	{U"\u2F99", U"\u2F99", U"\u2F99", U"\u8C9D", U"\u8C9D"},
+	{U"\u2F9A", U"\u2F9A", U"\u2F9A", U"\u8D64", U"\u8D64"},
+	{U"\u2F9B", U"\u2F9B", U"\u2F9B", U"\u8D70", U"\u8D70"},
+	{U"\u2F9C", U"\u2F9C", U"\u2F9C", U"\u8DB3", U"\u8DB3"},
+	{U"\u2F9D", U"\u2F9D", U"\u2F9D", U"\u8EAB", U"\u8EAB"},
+	{U"\u2F9E", U"\u2F9E", U"\u2F9E", U"\u8ECA", U"\u8ECA"},
+	{U"\u2F9F", U"\u2F9F", U"\u2F9F", U"\u8F9B", U"\u8F9B"},
+	{U"\u2FA0", U"\u2FA0", U"\u2FA0", U"\u8FB0", U"\u8FB0"},
+	{U"\u2FA1", U"\u2FA1", U"\u2FA1", U"\u8FB5", U"\u8FB5"},
+	{U"\u2FA2", U"\u2FA2", U"\u2FA2", U"\u9091", U"\u9091"},
+	{U"\u2FA3", U"\u2FA3", U"\u2FA3", U"\u9149", U"\u9149"},
+	{U"\u2FA4", U"\u2FA4", U"\u2FA4", U"\u91C6", U"\u91C6"},
+	{U"\u2FA5", U"\u2FA5", U"\u2FA5", U"\u91CC", U"\u91CC"},
+	{U"\u2FA6", U"\u2FA6", U"\u2FA6", U"\u91D1", U"\u91D1"},
+	{U"\u2FA7", U"\u2FA7", U"\u2FA7", U"\u9577", U"\u9577"},
+	{U"\u2FA8", U"\u2FA8", U"\u2FA8", U"\u9580", U"\u9580"},
+	{U"\u2FA9", U"\u2FA9", U"\u2FA9", U"\u961C", U"\u961C"},
+	{U"\u2FAA", U"\u2FAA", U"\u2FAA", U"\u96B6", U"\u96B6"},
+	{U"\u2FAB", U"\u2FAB", U"\u2FAB", U"\u96B9", U"\u96B9"},
+	{U"\u2FAC", U"\u2FAC", U"\u2FAC", U"\u96E8", U"\u96E8"},
+	{U"\u2FAD", U"\u2FAD", U"\u2FAD", U"\u9751", U"\u9751"},
+	{U"\u2FAE", U"\u2FAE", U"\u2FAE", U"\u975E", U"\u975E"},
+	{U"\u2FAF", U"\u2FAF", U"\u2FAF", U"\u9762", U"\u9762"},
+	{U"\u2FB0", U"\u2FB0", U"\u2FB0", U"\u9769", U"\u9769"},
+	{U"\u2FB1", U"\u2FB1", U"\u2FB1", U"\u97CB", U"\u97CB"},
+	{U"\u2FB2", U"\u2FB2", U"\u2FB2", U"\u97ED", U"\u97ED"},
+	{U"\u2FB3", U"\u2FB3", U"\u2FB3", U"\u97F3", U"\u97F3"},
+	{U"\u2FB4", U"\u2FB4", U"\u2FB4", U"\u9801", U"\u9801"},
+	{U"\u2FB5", U"\u2FB5", U"\u2FB5", U"\u98A8", U"\u98A8"},
+	{U"\u2FB6", U"\u2FB6", U"\u2FB6", U"\u98DB", U"\u98DB"},
+	{U"\u2FB7", U"\u2FB7", U"\u2FB7", U"\u98DF", U"\u98DF"},
+	{U"\u2FB8", U"\u2FB8", U"\u2FB8", U"\u9996", U"\u9996"},
+	{U"\u2FB9", U"\u2FB9", U"\u2FB9", U"\u9999", U"\u9999"},
+	{U"\u2FBA", U"\u2FBA", U"\u2FBA", U"\u99AC", U"\u99AC"},
+	{U"\u2FBB", U"\u2FBB", U"\u2FBB", U"\u9AA8", U"\u9AA8"},
+	{U"\u2FBC", U"\u2FBC", U"\u2FBC", U"\u9AD8", U"\u9AD8"},
+	{U"\u2FBD", U"\u2FBD", U"\u2FBD", U"\u9ADF", U"\u9ADF"},
+	{U"\u2FBE", U"\u2FBE", U"\u2FBE", U"\u9B25", U"\u9B25"},
+	{U"\u2FBF", U"\u2FBF", U"\u2FBF", U"\u9B2F", U"\u9B2F"},
+	{U"\u2FC0", U"\u2FC0", U"\u2FC0", U"\u9B32", U"\u9B32"},
+	{U"\u2FC1", U"\u2FC1", U"\u2FC1", U"\u9B3C", U"\u9B3C"},
+	{U"\u2FC2", U"\u2FC2", U"\u2FC2", U"\u9B5A", U"\u9B5A"},
+	{U"\u2FC3", U"\u2FC3", U"\u2FC3", U"\u9CE5", U"\u9CE5"},
+	{U"\u2FC4", U"\u2FC4", U"\u2FC4", U"\u9E75", U"\u9E75"},
+	{U"\u2FC5", U"\u2FC5", U"\u2FC5", U"\u9E7F", U"\u9E7F"},
+	{U"\u2FC6", U"\u2FC6", U"\u2FC6", U"\u9EA5", U"\u9EA5"},
+	{U"\u2FC7", U"\u2FC7", U"\u2FC7", U"\u9EBB", U"\u9EBB"},
+	{U"\u2FC8", U"\u2FC8", U"\u2FC8", U"\u9EC3", U"\u9EC3"},
+	{U"\u2FC9", U"\u2FC9", U"\u2FC9", U"\u9ECD", U"\u9ECD"},
+	{U"\u2FCA", U"\u2FCA", U"\u2FCA", U"\u9ED1", U"\u9ED1"},
+	{U"\u2FCB", U"\u2FCB", U"\u2FCB", U"\u9EF9", U"\u9EF9"},
+	{U"\u2FCC", U"\u2FCC", U"\u2FCC", U"\u9EFD", U"\u9EFD"},
+	{U"\u2FCD", U"\u2FCD", U"\u2FCD", U"\u9F0E", U"\u9F0E"},
+	{U"\u2FCE", U"\u2FCE", U"\u2FCE", U"\u9F13", U"\u9F13"},
+	{U"\u2FCF", U"\u2FCF", U"\u2FCF", U"\u9F20", U"\u9F20"},
+	{U"\u2FD0", U"\u2FD0", U"\u2FD0", U"\u9F3B", U"\u9F3B"},
+	{U"\u2FD1", U"\u2FD1", U"\u2FD1", U"\u9F4A", U"\u9F4A"},
+	{U"\u2FD2", U"\u2FD2", U"\u2FD2", U"\u9F52", U"\u9F52"},
+	{U"\u2FD3", U"\u2FD3", U"\u2FD3", U"\u9F8D", U"\u9F8D"},
+	{U"\u2FD4", U"\u2FD4", U"\u2FD4", U"\u9F9C", U"\u9F9C"},
+	{U"\u2FD5", U"\u2FD5", U"\u2FD5", U"\u9FA0", U"\u9FA0"},
+	{U"\u3000", U"\u3000", U"\u3000", U" ", U" "},
+	{U"\u3036", U"\u3036", U"\u3036", U"\u3012", U"\u3012"},
+	{U"\u3038", U"\u3038", U"\u3038", U"\u5341", U"\u5341"},
+	{U"\u3039", U"\u3039", U"\u3039", U"\u5344", U"\u5344"},
+	{U"\u303A", U"\u303A", U"\u303A", U"\u5345", U"\u5345"},
+	{U"\u304C", U"\u304C", U"\u304B\u3099", U"\u304C", U"\u304B\u3099"},
+	{U"\u304E", U"\u304E", U"\u304D\u3099", U"\u304E", U"\u304D\u3099"},
+	{U"\u3050", U"\u3050", U"\u304F\u3099", U"\u3050", U"\u304F\u3099"},
+	{U"\u3052", U"\u3052", U"\u3051\u3099", U"\u3052", U"\u3051\u3099"},
+	{U"\u3054", U"\u3054", U"\u3053\u3099", U"\u3054", U"\u3053\u3099"},
+	{U"\u3056", U"\u3056", U"\u3055\u3099", U"\u3056", U"\u3055\u3099"},
+	{U"\u3058", U"\u3058", U"\u3057\u3099", U"\u3058", U"\u3057\u3099"},
+	{U"\u305A", U"\u305A", U"\u3059\u3099", U"\u305A", U"\u3059\u3099"},
+	{U"\u305C", U"\u305C", U"\u305B\u3099", U"\u305C", U"\u305B\u3099"},
+	{U"\u305E", U"\u305E", U"\u305D\u3099", U"\u305E", U"\u305D\u3099"},
+	{U"\u3060", U"\u3060", U"\u305F\u3099", U"\u3060", U"\u305F\u3099"},
+	{U"\u3062", U"\u3062", U"\u3061\u3099", U"\u3062", U"\u3061\u3099"},
+	{U"\u3065", U"\u3065", U"\u3064\u3099", U"\u3065", U"\u3064\u3099"},
+	{U"\u3067", U"\u3067", U"\u3066\u3099", U"\u3067", U"\u3066\u3099"},
+	{U"\u3069", U"\u3069", U"\u3068\u3099", U"\u3069", U"\u3068\u3099"},
+	{U"\u3070", U"\u3070", U"\u306F\u3099", U"\u3070", U"\u306F\u3099"},
+	{U"\u3071", U"\u3071", U"\u306F\u309A", U"\u3071", U"\u306F\u309A"},
+	{U"\u3073", U"\u3073", U"\u3072\u3099", U"\u3073", U"\u3072\u3099"},
+	{U"\u3074", U"\u3074", U"\u3072\u309A", U"\u3074", U"\u3072\u309A"},
+	{U"\u3076", U"\u3076", U"\u3075\u3099", U"\u3076", U"\u3075\u3099"},
+	{U"\u3077", U"\u3077", U"\u3075\u309A", U"\u3077", U"\u3075\u309A"},
+	{U"\u3079", U"\u3079", U"\u3078\u3099", U"\u3079", U"\u3078\u3099"},
+	{U"\u307A", U"\u307A", U"\u3078\u309A", U"\u307A", U"\u3078\u309A"},
+	{U"\u307C", U"\u307C", U"\u307B\u3099", U"\u307C", U"\u307B\u3099"},
+	{U"\u307D", U"\u307D", U"\u307B\u309A", U"\u307D", U"\u307B\u309A"},
+	{U"\u3094", U"\u3094", U"\u3046\u3099", U"\u3094", U"\u3046\u3099"},
+	{U"\u3099", U"\u3099", U"\u3099", U"\u3099", U"\u3099"},
+	{U"\u309A", U"\u309A", U"\u309A", U"\u309A", U"\u309A"},
+	{U"\u309B", U"\u309B", U"\u309B", U" \u3099", U" \u3099"},
+	{U"\u309C", U"\u309C", U"\u309C", U" \u309A", U" \u309A"},
+	{U"\u309E", U"\u309E", U"\u309D\u3099", U"\u309E", U"\u309D\u3099"},
+	{U"\u309F", U"\u309F", U"\u309F", U"\u3088\u308A", U"\u3088\u308A"},
+	{U"\u30AC", U"\u30AC", U"\u30AB\u3099", U"\u30AC", U"\u30AB\u3099"},
+	{U"\u30AE", U"\u30AE", U"\u30AD\u3099", U"\u30AE", U"\u30AD\u3099"},
+	{U"\u30B0", U"\u30B0", U"\u30AF\u3099", U"\u30B0", U"\u30AF\u3099"},
+	{U"\u30B2", U"\u30B2", U"\u30B1\u3099", U"\u30B2", U"\u30B1\u3099"},
+	{U"\u30B4", U"\u30B4", U"\u30B3\u3099", U"\u30B4", U"\u30B3\u3099"},
+	{U"\u30B6", U"\u30B6", U"\u30B5\u3099", U"\u30B6", U"\u30B5\u3099"},
+	{U"\u30B8", U"\u30B8", U"\u30B7\u3099", U"\u30B8", U"\u30B7\u3099"},
+	{U"\u30BA", U"\u30BA", U"\u30B9\u3099", U"\u30BA", U"\u30B9\u3099"},
+	{U"\u30BC", U"\u30BC", U"\u30BB\u3099", U"\u30BC", U"\u30BB\u3099"},
+	{U"\u30BE", U"\u30BE", U"\u30BD\u3099", U"\u30BE", U"\u30BD\u3099"},
+	{U"\u30C0", U"\u30C0", U"\u30BF\u3099", U"\u30C0", U"\u30BF\u3099"},
+	{U"\u30C2", U"\u30C2", U"\u30C1\u3099", U"\u30C2", U"\u30C1\u3099"},
+	{U"\u30C5", U"\u30C5", U"\u30C4\u3099", U"\u30C5", U"\u30C4\u3099"},
+	{U"\u30C7", U"\u30C7", U"\u30C6\u3099", U"\u30C7", U"\u30C6\u3099"},
+	{U"\u30C9", U"\u30C9", U"\u30C8\u3099", U"\u30C9", U"\u30C8\u3099"},
+	{U"\u30D0", U"\u30D0", U"\u30CF\u3099", U"\u30D0", U"\u30CF\u3099"},
+	{U"\u30D1", U"\u30D1", U"\u30CF\u309A", U"\u30D1", U"\u30CF\u309A"},
+	{U"\u30D3", U"\u30D3", U"\u30D2\u3099", U"\u30D3", U"\u30D2\u3099"},
+	{U"\u30D4", U"\u30D4", U"\u30D2\u309A", U"\u30D4", U"\u30D2\u309A"},
+	{U"\u30D6", U"\u30D6", U"\u30D5\u3099", U"\u30D6", U"\u30D5\u3099"},
+	{U"\u30D7", U"\u30D7", U"\u30D5\u309A", U"\u30D7", U"\u30D5\u309A"},
+	{U"\u30D9", U"\u30D9", U"\u30D8\u3099", U"\u30D9", U"\u30D8\u3099"},
+	{U"\u30DA", U"\u30DA", U"\u30D8\u309A", U"\u30DA", U"\u30D8\u309A"},
+	{U"\u30DC", U"\u30DC", U"\u30DB\u3099", U"\u30DC", U"\u30DB\u3099"},
+	{U"\u30DD", U"\u30DD", U"\u30DB\u309A", U"\u30DD", U"\u30DB\u309A"},
+	{U"\u30F4", U"\u30F4", U"\u30A6\u3099", U"\u30F4", U"\u30A6\u3099"},
+	{U"\u30F7", U"\u30F7", U"\u30EF\u3099", U"\u30F7", U"\u30EF\u3099"},
+	{U"\u30F8", U"\u30F8", U"\u30F0\u3099", U"\u30F8", U"\u30F0\u3099"},
+	{U"\u30F9", U"\u30F9", U"\u30F1\u3099", U"\u30F9", U"\u30F1\u3099"},
+	{U"\u30FA", U"\u30FA", U"\u30F2\u3099", U"\u30FA", U"\u30F2\u3099"},
+	{U"\u30FE", U"\u30FE", U"\u30FD\u3099", U"\u30FE", U"\u30FD\u3099"},
+	{U"\u30FF", U"\u30FF", U"\u30FF", U"\u30B3\u30C8", U"\u30B3\u30C8"},
+	{U"\u3131", U"\u3131", U"\u3131", U"\u1100", U"\u1100"},
+	{U"\u3132", U"\u3132", U"\u3132", U"\u1101", U"\u1101"},
+	{U"\u3133", U"\u3133", U"\u3133", U"\u11AA", U"\u11AA"},
+	{U"\u3134", U"\u3134", U"\u3134", U"\u1102", U"\u1102"},
+	{U"\u3135", U"\u3135", U"\u3135", U"\u11AC", U"\u11AC"},
+	{U"\u3136", U"\u3136", U"\u3136", U"\u11AD", U"\u11AD"},
+	{U"\u3137", U"\u3137", U"\u3137", U"\u1103", U"\u1103"},
+	{U"\u3138", U"\u3138", U"\u3138", U"\u1104", U"\u1104"},
+	{U"\u3139", U"\u3139", U"\u3139", U"\u1105", U"\u1105"},
+	{U"\u313A", U"\u313A", U"\u313A", U"\u11B0", U"\u11B0"},
+	{U"\u313B", U"\u313B", U"\u313B", U"\u11B1", U"\u11B1"},
+	{U"\u313C", U"\u313C", U"\u313C", U"\u11B2", U"\u11B2"},
+	{U"\u313D", U"\u313D", U"\u313D", U"\u11B3", U"\u11B3"},
+	{U"\u313E", U"\u313E", U"\u313E", U"\u11B4", U"\u11B4"},
+	{U"\u313F", U"\u313F", U"\u313F", U"\u11B5", U"\u11B5"},
+	{U"\u3140", U"\u3140", U"\u3140", U"\u111A", U"\u111A"},
+	{U"\u3141", U"\u3141", U"\u3141", U"\u1106", U"\u1106"},
+	{U"\u3142", U"\u3142", U"\u3142", U"\u1107", U"\u1107"},
+	{U"\u3143", U"\u3143", U"\u3143", U"\u1108", U"\u1108"},
+	{U"\u3144", U"\u3144", U"\u3144", U"\u1121", U"\u1121"},
+	{U"\u3145", U"\u3145", U"\u3145", U"\u1109", U"\u1109"},
+	{U"\u3146", U"\u3146", U"\u3146", U"\u110A", U"\u110A"},
+	{U"\u3147", U"\u3147", U"\u3147", U"\u110B", U"\u110B"},
+	{U"\u3148", U"\u3148", U"\u3148", U"\u110C", U"\u110C"},
+	{U"\u3149", U"\u3149", U"\u3149", U"\u110D", U"\u110D"},
+	{U"\u314A", U"\u314A", U"\u314A", U"\u110E", U"\u110E"},
+	{U"\u314B", U"\u314B", U"\u314B", U"\u110F", U"\u110F"},
+	{U"\u314C", U"\u314C", U"\u314C", U"\u1110", U"\u1110"},
+	{U"\u314D", U"\u314D", U"\u314D", U"\u1111", U"\u1111"},
+	{U"\u314E", U"\u314E", U"\u314E", U"\u1112", U"\u1112"},
+	{U"\u314F", U"\u314F", U"\u314F", U"\u1161", U"\u1161"},
+	{U"\u3150", U"\u3150", U"\u3150", U"\u1162", U"\u1162"},
+	{U"\u3151", U"\u3151", U"\u3151", U"\u1163", U"\u1163"},
+	{U"\u3152", U"\u3152", U"\u3152", U"\u1164", U"\u1164"},
+	{U"\u3153", U"\u3153", U"\u3153", U"\u1165", U"\u1165"},
+	{U"\u3154", U"\u3154", U"\u3154", U"\u1166", U"\u1166"},
+	{U"\u3155", U"\u3155", U"\u3155", U"\u1167", U"\u1167"},
+	{U"\u3156", U"\u3156", U"\u3156", U"\u1168", U"\u1168"},
+	{U"\u3157", U"\u3157", U"\u3157", U"\u1169", U"\u1169"},
+	{U"\u3158", U"\u3158", U"\u3158", U"\u116A", U"\u116A"},
+	{U"\u3159", U"\u3159", U"\u3159", U"\u116B", U"\u116B"},
+	{U"\u315A", U"\u315A", U"\u315A", U"\u116C", U"\u116C"},
+	{U"\u315B", U"\u315B", U"\u315B", U"\u116D", U"\u116D"},
+	{U"\u315C", U"\u315C", U"\u315C", U"\u116E", U"\u116E"},
+	{U"\u315D", U"\u315D", U"\u315D", U"\u116F", U"\u116F"},
+	{U"\u315E", U"\u315E", U"\u315E", U"\u1170", U"\u1170"},
+	{U"\u315F", U"\u315F", U"\u315F", U"\u1171", U"\u1171"},
+	{U"\u3160", U"\u3160", U"\u3160", U"\u1172", U"\u1172"},
+	{U"\u3161", U"\u3161", U"\u3161", U"\u1173", U"\u1173"},
+	{U"\u3162", U"\u3162", U"\u3162", U"\u1174", U"\u1174"},
+	{U"\u3163", U"\u3163", U"\u3163", U"\u1175", U"\u1175"},
+	{U"\u3164", U"\u3164", U"\u3164", U"\u1160", U"\u1160"},
+	{U"\u3165", U"\u3165", U"\u3165", U"\u1114", U"\u1114"},
+	{U"\u3166", U"\u3166", U"\u3166", U"\u1115", U"\u1115"},
+	{U"\u3167", U"\u3167", U"\u3167", U"\u11C7", U"\u11C7"},
+	{U"\u3168", U"\u3168", U"\u3168", U"\u11C8", U"\u11C8"},
+	{U"\u3169", U"\u3169", U"\u3169", U"\u11CC", U"\u11CC"},
+	{U"\u316A", U"\u316A", U"\u316A", U"\u11CE", U"\u11CE"},
+	{U"\u316B", U"\u316B", U"\u316B", U"\u11D3", U"\u11D3"},
+	{U"\u316C", U"\u316C", U"\u316C", U"\u11D7", U"\u11D7"},
+	{U"\u316D", U"\u316D", U"\u316D", U"\u11D9", U"\u11D9"},
+	{U"\u316E", U"\u316E", U"\u316E", U"\u111C", U"\u111C"},
+	{U"\u316F", U"\u316F", U"\u316F", U"\u11DD", U"\u11DD"},
+	{U"\u3170", U"\u3170", U"\u3170", U"\u11DF", U"\u11DF"},
+	{U"\u3171", U"\u3171", U"\u3171", U"\u111D", U"\u111D"},
+	{U"\u3172", U"\u3172", U"\u3172", U"\u111E", U"\u111E"},
+	{U"\u3173", U"\u3173", U"\u3173", U"\u1120", U"\u1120"},
+	{U"\u3174", U"\u3174", U"\u3174", U"\u1122", U"\u1122"},
+	{U"\u3175", U"\u3175", U"\u3175", U"\u1123", U"\u1123"},
+	{U"\u3176", U"\u3176", U"\u3176", U"\u1127", U"\u1127"},
+	{U"\u3177", U"\u3177", U"\u3177", U"\u1129", U"\u1129"},
+	{U"\u3178", U"\u3178", U"\u3178", U"\u112B", U"\u112B"},
+	{U"\u3179", U"\u3179", U"\u3179", U"\u112C", U"\u112C"},
+	{U"\u317A", U"\u317A", U"\u317A", U"\u112D", U"\u112D"},
+	{U"\u317B", U"\u317B", U"\u317B", U"\u112E", U"\u112E"},
+	{U"\u317C", U"\u317C", U"\u317C", U"\u112F", U"\u112F"},
+	{U"\u317D", U"\u317D", U"\u317D", U"\u1132", U"\u1132"},
+	{U"\u317E", U"\u317E", U"\u317E", U"\u1136", U"\u1136"},
+	{U"\u317F", U"\u317F", U"\u317F", U"\u1140", U"\u1140"},
+	{U"\u3180", U"\u3180", U"\u3180", U"\u1147", U"\u1147"},
+	{U"\u3181", U"\u3181", U"\u3181", U"\u114C", U"\u114C"},
+	{U"\u3182", U"\u3182", U"\u3182", U"\u11F1", U"\u11F1"},
+	{U"\u3183", U"\u3183", U"\u3183", U"\u11F2", U"\u11F2"},
+	{U"\u3184", U"\u3184", U"\u3184", U"\u1157", U"\u1157"},
+	{U"\u3185", U"\u3185", U"\u3185", U"\u1158", U"\u1158"},
+	{U"\u3186", U"\u3186", U"\u3186", U"\u1159", U"\u1159"},
+	{U"\u3187", U"\u3187", U"\u3187", U"\u1184", U"\u1184"},
+	{U"\u3188", U"\u3188", U"\u3188", U"\u1185", U"\u1185"},
+	{U"\u3189", U"\u3189", U"\u3189", U"\u1188", U"\u1188"},
+	{U"\u318A", U"\u318A", U"\u318A", U"\u1191", U"\u1191"},
+	{U"\u318B", U"\u318B", U"\u318B", U"\u1192", U"\u1192"},
+	{U"\u318C", U"\u318C", U"\u318C", U"\u1194", U"\u1194"},
+	{U"\u318D", U"\u318D", U"\u318D", U"\u119E", U"\u119E"},
+	{U"\u318E", U"\u318E", U"\u318E", U"\u11A1", U"\u11A1"},
+	{U"\u3192", U"\u3192", U"\u3192", U"\u4E00", U"\u4E00"},
+	{U"\u3193", U"\u3193", U"\u3193", U"\u4E8C", U"\u4E8C"},
+	{U"\u3194", U"\u3194", U"\u3194", U"\u4E09", U"\u4E09"},
+	{U"\u3195", U"\u3195", U"\u3195", U"\u56DB", U"\u56DB"},
+	{U"\u3196", U"\u3196", U"\u3196", U"\u4E0A", U"\u4E0A"},
+	{U"\u3197", U"\u3197", U"\u3197", U"\u4E2D", U"\u4E2D"},
+	{U"\u3198", U"\u3198", U"\u3198", U"\u4E0B", U"\u4E0B"},
+	{U"\u3199", U"\u3199", U"\u3199", U"\u7532", U"\u7532"},
+	{U"\u319A", U"\u319A", U"\u319A", U"\u4E59", U"\u4E59"},
+	{U"\u319B", U"\u319B", U"\u319B", U"\u4E19", U"\u4E19"},
+	{U"\u319C", U"\u319C", U"\u319C", U"\u4E01", U"\u4E01"},
+	{U"\u319D", U"\u319D", U"\u319D", U"\u5929", U"\u5929"},
+	{U"\u319E", U"\u319E", U"\u319E", U"\u5730", U"\u5730"},
+	{U"\u319F", U"\u319F", U"\u319F", U"\u4EBA", U"\u4EBA"},
+	{U"\u3200", U"\u3200", U"\u3200", U"(\u1100)", U"(\u1100)"},
+	{U"\u3201", U"\u3201", U"\u3201", U"(\u1102)", U"(\u1102)"},
+	{U"\u3202", U"\u3202", U"\u3202", U"(\u1103)", U"(\u1103)"},
+	{U"\u3203", U"\u3203", U"\u3203", U"(\u1105)", U"(\u1105)"},
+	{U"\u3204", U"\u3204", U"\u3204", U"(\u1106)", U"(\u1106)"},
+	{U"\u3205", U"\u3205", U"\u3205", U"(\u1107)", U"(\u1107)"},
+	{U"\u3206", U"\u3206", U"\u3206", U"(\u1109)", U"(\u1109)"},
+	{U"\u3207", U"\u3207", U"\u3207", U"(\u110B)", U"(\u110B)"},
+	{U"\u3208", U"\u3208", U"\u3208", U"(\u110C)", U"(\u110C)"},
+	{U"\u3209", U"\u3209", U"\u3209", U"(\u110E)", U"(\u110E)"},
+	{U"\u320A", U"\u320A", U"\u320A", U"(\u110F)", U"(\u110F)"},
+	{U"\u320B", U"\u320B", U"\u320B", U"(\u1110)", U"(\u1110)"},
+	{U"\u320C", U"\u320C", U"\u320C", U"(\u1111)", U"(\u1111)"},
+	{U"\u320D", U"\u320D", U"\u320D", U"(\u1112)", U"(\u1112)"},
+	{U"\u320E", U"\u320E", U"\u320E", U"(\uAC00)", U"(\u1100\u1161)"},
+	{U"\u320F", U"\u320F", U"\u320F", U"(\uB098)", U"(\u1102\u1161)"},
+	{U"\u3210", U"\u3210", U"\u3210", U"(\uB2E4)", U"(\u1103\u1161)"},
+	{U"\u3211", U"\u3211", U"\u3211", U"(\uB77C)", U"(\u1105\u1161)"},
+	{U"\u3212", U"\u3212", U"\u3212", U"(\uB9C8)", U"(\u1106\u1161)"},
+	{U"\u3213", U"\u3213", U"\u3213", U"(\uBC14)", U"(\u1107\u1161)"},
+	{U"\u3214", U"\u3214", U"\u3214", U"(\uC0AC)", U"(\u1109\u1161)"},
+	{U"\u3215", U"\u3215", U"\u3215", U"(\uC544)", U"(\u110B\u1161)"},
+	{U"\u3216", U"\u3216", U"\u3216", U"(\uC790)", U"(\u110C\u1161)"},
+	{U"\u3217", U"\u3217", U"\u3217", U"(\uCC28)", U"(\u110E\u1161)"},
+	{U"\u3218", U"\u3218", U"\u3218", U"(\uCE74)", U"(\u110F\u1161)"},
+	{U"\u3219", U"\u3219", U"\u3219", U"(\uD0C0)", U"(\u1110\u1161)"},
+	{U"\u321A", U"\u321A", U"\u321A", U"(\uD30C)", U"(\u1111\u1161)"},
+	{U"\u321B", U"\u321B", U"\u321B", U"(\uD558)", U"(\u1112\u1161)"},
+	{U"\u321C", U"\u321C", U"\u321C", U"(\uC8FC)", U"(\u110C\u116E)"},
+	{U"\u321D", U"\u321D", U"\u321D", U"(\uC624\uC804)", U"(\u110B\u1169\u110C\u1165\u11AB)"},
+	{U"\u321E", U"\u321E", U"\u321E", U"(\uC624\uD6C4)", U"(\u110B\u1169\u1112\u116E)"},
+	{U"\u3220", U"\u3220", U"\u3220", U"(\u4E00)", U"(\u4E00)"},
+	{U"\u3221", U"\u3221", U"\u3221", U"(\u4E8C)", U"(\u4E8C)"},
+	{U"\u3222", U"\u3222", U"\u3222", U"(\u4E09)", U"(\u4E09)"},
+	{U"\u3223", U"\u3223", U"\u3223", U"(\u56DB)", U"(\u56DB)"},
+	{U"\u3224", U"\u3224", U"\u3224", U"(\u4E94)", U"(\u4E94)"},
+	{U"\u3225", U"\u3225", U"\u3225", U"(\u516D)", U"(\u516D)"},
+	{U"\u3226", U"\u3226", U"\u3226", U"(\u4E03)", U"(\u4E03)"},
+	{U"\u3227", U"\u3227", U"\u3227", U"(\u516B)", U"(\u516B)"},
+	{U"\u3228", U"\u3228", U"\u3228", U"(\u4E5D)", U"(\u4E5D)"},
+	{U"\u3229", U"\u3229", U"\u3229", U"(\u5341)", U"(\u5341)"},
+	{U"\u322A", U"\u322A", U"\u322A", U"(\u6708)", U"(\u6708)"},
+	{U"\u322B", U"\u322B", U"\u322B", U"(\u706B)", U"(\u706B)"},
+	{U"\u322C", U"\u322C", U"\u322C", U"(\u6C34)", U"(\u6C34)"},
+	{U"\u322D", U"\u322D", U"\u322D", U"(\u6728)", U"(\u6728)"},
+	{U"\u322E", U"\u322E", U"\u322E", U"(\u91D1)", U"(\u91D1)"},
+	{U"\u322F", U"\u322F", U"\u322F", U"(\u571F)", U"(\u571F)"},
+	{U"\u3230", U"\u3230", U"\u3230", U"(\u65E5)", U"(\u65E5)"},
+	{U"\u3231", U"\u3231", U"\u3231", U"(\u682A)", U"(\u682A)"},
+	{U"\u3232", U"\u3232", U"\u3232", U"(\u6709)", U"(\u6709)"},
+	{U"\u3233", U"\u3233", U"\u3233", U"(\u793E)", U"(\u793E)"},
+	{U"\u3234", U"\u3234", U"\u3234", U"(\u540D)", U"(\u540D)"},
+	{U"\u3235", U"\u3235", U"\u3235", U"(\u7279)", U"(\u7279)"},
+	{U"\u3236", U"\u3236", U"\u3236", U"(\u8CA1)", U"(\u8CA1)"},
+	{U"\u3237", U"\u3237", U"\u3237", U"(\u795D)", U"(\u795D)"},
+	{U"\u3238", U"\u3238", U"\u3238", U"(\u52B4)", U"(\u52B4)"},
+	{U"\u3239", U"\u3239", U"\u3239", U"(\u4EE3)", U"(\u4EE3)"},
+	{U"\u323A", U"\u323A", U"\u323A", U"(\u547C)", U"(\u547C)"},
+	{U"\u323B", U"\u323B", U"\u323B", U"(\u5B66)", U"(\u5B66)"},
+	{U"\u323C", U"\u323C", U"\u323C", U"(\u76E3)", U"(\u76E3)"},
+	{U"\u323D", U"\u323D", U"\u323D", U"(\u4F01)", U"(\u4F01)"},
+	{U"\u323E", U"\u323E", U"\u323E", U"(\u8CC7)", U"(\u8CC7)"},
+	{U"\u323F", U"\u323F", U"\u323F", U"(\u5354)", U"(\u5354)"},
+	{U"\u3240", U"\u3240", U"\u3240", U"(\u796D)", U"(\u796D)"},
+	{U"\u3241", U"\u3241", U"\u3241", U"(\u4F11)", U"(\u4F11)"},
+	{U"\u3242", U"\u3242", U"\u3242", U"(\u81EA)", U"(\u81EA)"},
+	{U"\u3243", U"\u3243", U"\u3243", U"(\u81F3)", U"(\u81F3)"},
+	{U"\u3244", U"\u3244", U"\u3244", U"\u554F", U"\u554F"},
+	{U"\u3245", U"\u3245", U"\u3245", U"\u5E7C", U"\u5E7C"},
+	{U"\u3246", U"\u3246", U"\u3246", U"\u6587", U"\u6587"},
+	{U"\u3247", U"\u3247", U"\u3247", U"\u7B8F", U"\u7B8F"},
+	{U"\u3250", U"\u3250", U"\u3250", U"PTE", U"PTE"},
+	{U"\u3251", U"\u3251", U"\u3251", U"21", U"21"},
+	{U"\u3252", U"\u3252", U"\u3252", U"22", U"22"},
+	{U"\u3253", U"\u3253", U"\u3253", U"23", U"23"},
+	{U"\u3254", U"\u3254", U"\u3254", U"24", U"24"},
+	{U"\u3255", U"\u3255", U"\u3255", U"25", U"25"},
+	{U"\u3256", U"\u3256", U"\u3256", U"26", U"26"},
+	{U"\u3257", U"\u3257", U"\u3257", U"27", U"27"},
+	{U"\u3258", U"\u3258", U"\u3258", U"28", U"28"},
+	{U"\u3259", U"\u3259", U"\u3259", U"29", U"29"},
+	{U"\u325A", U"\u325A", U"\u325A", U"30", U"30"},
+	{U"\u325B", U"\u325B", U"\u325B", U"31", U"31"},
+	{U"\u325C", U"\u325C", U"\u325C", U"32", U"32"},
+	{U"\u325D", U"\u325D", U"\u325D", U"33", U"33"},
+	{U"\u325E", U"\u325E", U"\u325E", U"34", U"34"},
+	{U"\u325F", U"\u325F", U"\u325F", U"35", U"35"},
+	{U"\u3260", U"\u3260", U"\u3260", U"\u1100", U"\u1100"},
+	{U"\u3261", U"\u3261", U"\u3261", U"\u1102", U"\u1102"},
+	{U"\u3262", U"\u3262", U"\u3262", U"\u1103", U"\u1103"},
+	{U"\u3263", U"\u3263", U"\u3263", U"\u1105", U"\u1105"},
+	{U"\u3264", U"\u3264", U"\u3264", U"\u1106", U"\u1106"},
+	{U"\u3265", U"\u3265", U"\u3265", U"\u1107", U"\u1107"},
+	{U"\u3266", U"\u3266", U"\u3266", U"\u1109", U"\u1109"},
+	{U"\u3267", U"\u3267", U"\u3267", U"\u110B", U"\u110B"},
+	{U"\u3268", U"\u3268", U"\u3268", U"\u110C", U"\u110C"},
+	{U"\u3269", U"\u3269", U"\u3269", U"\u110E", U"\u110E"},
+	{U"\u326A", U"\u326A", U"\u326A", U"\u110F", U"\u110F"},
+	{U"\u326B", U"\u326B", U"\u326B", U"\u1110", U"\u1110"},
+	{U"\u326C", U"\u326C", U"\u326C", U"\u1111", U"\u1111"},
+	{U"\u326D", U"\u326D", U"\u326D", U"\u1112", U"\u1112"},
+	{U"\u326E", U"\u326E", U"\u326E", U"\uAC00", U"\u1100\u1161"},
+	{U"\u326F", U"\u326F", U"\u326F", U"\uB098", U"\u1102\u1161"},
+	{U"\u3270", U"\u3270", U"\u3270", U"\uB2E4", U"\u1103\u1161"},
+	{U"\u3271", U"\u3271", U"\u3271", U"\uB77C", U"\u1105\u1161"},
+	{U"\u3272", U"\u3272", U"\u3272", U"\uB9C8", U"\u1106\u1161"},
+	{U"\u3273", U"\u3273", U"\u3273", U"\uBC14", U"\u1107\u1161"},
+	{U"\u3274", U"\u3274", U"\u3274", U"\uC0AC", U"\u1109\u1161"},
+	{U"\u3275", U"\u3275", U"\u3275", U"\uC544", U"\u110B\u1161"},
+	{U"\u3276", U"\u3276", U"\u3276", U"\uC790", U"\u110C\u1161"},
+	{U"\u3277", U"\u3277", U"\u3277", U"\uCC28", U"\u110E\u1161"},
+	{U"\u3278", U"\u3278", U"\u3278", U"\uCE74", U"\u110F\u1161"},
+	{U"\u3279", U"\u3279", U"\u3279", U"\uD0C0", U"\u1110\u1161"},
+	{U"\u327A", U"\u327A", U"\u327A", U"\uD30C", U"\u1111\u1161"},
+	{U"\u327B", U"\u327B", U"\u327B", U"\uD558", U"\u1112\u1161"},
+	{U"\u327C", U"\u327C", U"\u327C", U"\uCC38\uACE0", U"\u110E\u1161\u11B7\u1100\u1169"},
+	{U"\u327D", U"\u327D", U"\u327D", U"\uC8FC\uC758", U"\u110C\u116E\u110B\u1174"},
+	{U"\u327E", U"\u327E", U"\u327E", U"\uC6B0", U"\u110B\u116E"},
+	{U"\u3280", U"\u3280", U"\u3280", U"\u4E00", U"\u4E00"},
+	{U"\u3281", U"\u3281", U"\u3281", U"\u4E8C", U"\u4E8C"},
+	{U"\u3282", U"\u3282", U"\u3282", U"\u4E09", U"\u4E09"},
+	{U"\u3283", U"\u3283", U"\u3283", U"\u56DB", U"\u56DB"},
+	{U"\u3284", U"\u3284", U"\u3284", U"\u4E94", U"\u4E94"},
+	{U"\u3285", U"\u3285", U"\u3285", U"\u516D", U"\u516D"},
+	{U"\u3286", U"\u3286", U"\u3286", U"\u4E03", U"\u4E03"},
+	{U"\u3287", U"\u3287", U"\u3287", U"\u516B", U"\u516B"},
+	{U"\u3288", U"\u3288", U"\u3288", U"\u4E5D", U"\u4E5D"},
+	{U"\u3289", U"\u3289", U"\u3289", U"\u5341", U"\u5341"},
+	{U"\u328A", U"\u328A", U"\u328A", U"\u6708", U"\u6708"},
+	{U"\u328B", U"\u328B", U"\u328B", U"\u706B", U"\u706B"},
+	{U"\u328C", U"\u328C", U"\u328C", U"\u6C34", U"\u6C34"},
+	{U"\u328D", U"\u328D", U"\u328D", U"\u6728", U"\u6728"},
+	{U"\u328E", U"\u328E", U"\u328E", U"\u91D1", U"\u91D1"},
+	{U"\u328F", U"\u328F", U"\u328F", U"\u571F", U"\u571F"},
+	{U"\u3290", U"\u3290", U"\u3290", U"\u65E5", U"\u65E5"},
+	{U"\u3291", U"\u3291", U"\u3291", U"\u682A", U"\u682A"},
+	{U"\u3292", U"\u3292", U"\u3292", U"\u6709", U"\u6709"},
+	{U"\u3293", U"\u3293", U"\u3293", U"\u793E", U"\u793E"},
+	{U"\u3294", U"\u3294", U"\u3294", U"\u540D", U"\u540D"},
+	{U"\u3295", U"\u3295", U"\u3295", U"\u7279", U"\u7279"},
+	{U"\u3296", U"\u3296", U"\u3296", U"\u8CA1", U"\u8CA1"},
+	{U"\u3297", U"\u3297", U"\u3297", U"\u795D", U"\u795D"},
+	{U"\u3298", U"\u3298", U"\u3298", U"\u52B4", U"\u52B4"},
+	{U"\u3299", U"\u3299", U"\u3299", U"\u79D8", U"\u79D8"},
+	{U"\u329A", U"\u329A", U"\u329A", U"\u7537", U"\u7537"},
+	{U"\u329B", U"\u329B", U"\u329B", U"\u5973", U"\u5973"},
+	{U"\u329C", U"\u329C", U"\u329C", U"\u9069", U"\u9069"},
+	{U"\u329D", U"\u329D", U"\u329D", U"\u512A", U"\u512A"},
+	{U"\u329E", U"\u329E", U"\u329E", U"\u5370", U"\u5370"},
+	{U"\u329F", U"\u329F", U"\u329F", U"\u6CE8", U"\u6CE8"},
+	{U"\u32A0", U"\u32A0", U"\u32A0", U"\u9805", U"\u9805"},
+	{U"\u32A1", U"\u32A1", U"\u32A1", U"\u4F11", U"\u4F11"},
+	{U"\u32A2", U"\u32A2", U"\u32A2", U"\u5199", U"\u5199"},
+	{U"\u32A3", U"\u32A3", U"\u32A3", U"\u6B63", U"\u6B63"},
+	{U"\u32A4", U"\u32A4", U"\u32A4", U"\u4E0A", U"\u4E0A"},
+	{U"\u32A5", U"\u32A5", U"\u32A5", U"\u4E2D", U"\u4E2D"},
+	{U"\u32A6", U"\u32A6", U"\u32A6", U"\u4E0B", U"\u4E0B"},
+	{U"\u32A7", U"\u32A7", U"\u32A7", U"\u5DE6", U"\u5DE6"},
+	{U"\u32A8", U"\u32A8", U"\u32A8", U"\u53F3", U"\u53F3"},
+	{U"\u32A9", U"\u32A9", U"\u32A9", U"\u533B", U"\u533B"},
+	{U"\u32AA", U"\u32AA", U"\u32AA", U"\u5B97", U"\u5B97"},
+	{U"\u32AB", U"\u32AB", U"\u32AB", U"\u5B66", U"\u5B66"},
+	{U"\u32AC", U"\u32AC", U"\u32AC", U"\u76E3", U"\u76E3"},
+	{U"\u32AD", U"\u32AD", U"\u32AD", U"\u4F01", U"\u4F01"},
+	{U"\u32AE", U"\u32AE", U"\u32AE", U"\u8CC7", U"\u8CC7"},
+	{U"\u32AF", U"\u32AF", U"\u32AF", U"\u5354", U"\u5354"},
+	{U"\u32B0", U"\u32B0", U"\u32B0", U"\u591C", U"\u591C"},
+	{U"\u32B1", U"\u32B1", U"\u32B1", U"36", U"36"},
+	{U"\u32B2", U"\u32B2", U"\u32B2", U"37", U"37"},
+	{U"\u32B3", U"\u32B3", U"\u32B3", U"38", U"38"},
+	{U"\u32B4", U"\u32B4", U"\u32B4", U"39", U"39"},
+	{U"\u32B5", U"\u32B5", U"\u32B5", U"40", U"40"},
+	{U"\u32B6", U"\u32B6", U"\u32B6", U"41", U"41"},
+	{U"\u32B7", U"\u32B7", U"\u32B7", U"42", U"42"},
+	{U"\u32B8", U"\u32B8", U"\u32B8", U"43", U"43"},
+	{U"\u32B9", U"\u32B9", U"\u32B9", U"44", U"44"},
+	{U"\u32BA", U"\u32BA", U"\u32BA", U"45", U"45"},
+	{U"\u32BB", U"\u32BB", U"\u32BB", U"46", U"46"},
+	{U"\u32BC", U"\u32BC", U"\u32BC", U"47", U"47"},
+	{U"\u32BD", U"\u32BD", U"\u32BD", U"48", U"48"},
+	{U"\u32BE", U"\u32BE", U"\u32BE", U"49", U"49"},
+	{U"\u32BF", U"\u32BF", U"\u32BF", U"50", U"50"},
+	{U"\u32C0", U"\u32C0", U"\u32C0", U"1\u6708", U"1\u6708"},
+	{U"\u32C1", U"\u32C1", U"\u32C1", U"2\u6708", U"2\u6708"},
+	{U"\u32C2", U"\u32C2", U"\u32C2", U"3\u6708", U"3\u6708"},
+	{U"\u32C3", U"\u32C3", U"\u32C3", U"4\u6708", U"4\u6708"},
+	{U"\u32C4", U"\u32C4", U"\u32C4", U"5\u6708", U"5\u6708"},
+	{U"\u32C5", U"\u32C5", U"\u32C5", U"6\u6708", U"6\u6708"},
+	{U"\u32C6", U"\u32C6", U"\u32C6", U"7\u6708", U"7\u6708"},
+	{U"\u32C7", U"\u32C7", U"\u32C7", U"8\u6708", U"8\u6708"},
+	{U"\u32C8", U"\u32C8", U"\u32C8", U"9\u6708", U"9\u6708"},
+	{U"\u32C9", U"\u32C9", U"\u32C9", U"10\u6708", U"10\u6708"},
+	{U"\u32CA", U"\u32CA", U"\u32CA", U"11\u6708", U"11\u6708"},
+	{U"\u32CB", U"\u32CB", U"\u32CB", U"12\u6708", U"12\u6708"},
+	{U"\u32CC", U"\u32CC", U"\u32CC", U"Hg", U"Hg"},
+	{U"\u32CD", U"\u32CD", U"\u32CD", U"erg", U"erg"},
+	{U"\u32CE", U"\u32CE", U"\u32CE", U"eV", U"eV"},
+	{U"\u32CF", U"\u32CF", U"\u32CF", U"LTD", U"LTD"},
+	{U"\u32D0", U"\u32D0", U"\u32D0", U"\u30A2", U"\u30A2"},
+	{U"\u32D1", U"\u32D1", U"\u32D1", U"\u30A4", U"\u30A4"},
+	{U"\u32D2", U"\u32D2", U"\u32D2", U"\u30A6", U"\u30A6"},
+	{U"\u32D3", U"\u32D3", U"\u32D3", U"\u30A8", U"\u30A8"},
+	{U"\u32D4", U"\u32D4", U"\u32D4", U"\u30AA", U"\u30AA"},
+	{U"\u32D5", U"\u32D5", U"\u32D5", U"\u30AB", U"\u30AB"},
+	{U"\u32D6", U"\u32D6", U"\u32D6", U"\u30AD", U"\u30AD"},
+	{U"\u32D7", U"\u32D7", U"\u32D7", U"\u30AF", U"\u30AF"},
+	{U"\u32D8", U"\u32D8", U"\u32D8", U"\u30B1", U"\u30B1"},
+	{U"\u32D9", U"\u32D9", U"\u32D9", U"\u30B3", U"\u30B3"},
+	{U"\u32DA", U"\u32DA", U"\u32DA", U"\u30B5", U"\u30B5"},
+	{U"\u32DB", U"\u32DB", U"\u32DB", U"\u30B7", U"\u30B7"},
+	{U"\u32DC", U"\u32DC", U"\u32DC", U"\u30B9", U"\u30B9"},
+	{U"\u32DD", U"\u32DD", U"\u32DD", U"\u30BB", U"\u30BB"},
+	{U"\u32DE", U"\u32DE", U"\u32DE", U"\u30BD", U"\u30BD"},
+	{U"\u32DF", U"\u32DF", U"\u32DF", U"\u30BF", U"\u30BF"},
+	{U"\u32E0", U"\u32E0", U"\u32E0", U"\u30C1", U"\u30C1"},
+	{U"\u32E1", U"\u32E1", U"\u32E1", U"\u30C4", U"\u30C4"},
+	{U"\u32E2", U"\u32E2", U"\u32E2", U"\u30C6", U"\u30C6"},
+	{U"\u32E3", U"\u32E3", U"\u32E3", U"\u30C8", U"\u30C8"},
+	{U"\u32E4", U"\u32E4", U"\u32E4", U"\u30CA", U"\u30CA"},
+	{U"\u32E5", U"\u32E5", U"\u32E5", U"\u30CB", U"\u30CB"},
+	{U"\u32E6", U"\u32E6", U"\u32E6", U"\u30CC", U"\u30CC"},
+	{U"\u32E7", U"\u32E7", U"\u32E7", U"\u30CD", U"\u30CD"},
+	{U"\u32E8", U"\u32E8", U"\u32E8", U"\u30CE", U"\u30CE"},
+	{U"\u32E9", U"\u32E9", U"\u32E9", U"\u30CF", U"\u30CF"},
+	{U"\u32EA", U"\u32EA", U"\u32EA", U"\u30D2", U"\u30D2"},
+	{U"\u32EB", U"\u32EB", U"\u32EB", U"\u30D5", U"\u30D5"},
+	{U"\u32EC", U"\u32EC", U"\u32EC", U"\u30D8", U"\u30D8"},
+	{U"\u32ED", U"\u32ED", U"\u32ED", U"\u30DB", U"\u30DB"},
+	{U"\u32EE", U"\u32EE", U"\u32EE", U"\u30DE", U"\u30DE"},
+	{U"\u32EF", U"\u32EF", U"\u32EF", U"\u30DF", U"\u30DF"},
+	{U"\u32F0", U"\u32F0", U"\u32F0", U"\u30E0", U"\u30E0"},
+	{U"\u32F1", U"\u32F1", U"\u32F1", U"\u30E1", U"\u30E1"},
+	{U"\u32F2", U"\u32F2", U"\u32F2", U"\u30E2", U"\u30E2"},
+	{U"\u32F3", U"\u32F3", U"\u32F3", U"\u30E4", U"\u30E4"},
+	{U"\u32F4", U"\u32F4", U"\u32F4", U"\u30E6", U"\u30E6"},
+	{U"\u32F5", U"\u32F5", U"\u32F5", U"\u30E8", U"\u30E8"},
+	{U"\u32F6", U"\u32F6", U"\u32F6", U"\u30E9", U"\u30E9"},
+	{U"\u32F7", U"\u32F7", U"\u32F7", U"\u30EA", U"\u30EA"},
+	{U"\u32F8", U"\u32F8", U"\u32F8", U"\u30EB", U"\u30EB"},
+	{U"\u32F9", U"\u32F9", U"\u32F9", U"\u30EC", U"\u30EC"},
+	{U"\u32FA", U"\u32FA", U"\u32FA", U"\u30ED", U"\u30ED"},
+	{U"\u32FB", U"\u32FB", U"\u32FB", U"\u30EF", U"\u30EF"},
+	{U"\u32FC", U"\u32FC", U"\u32FC", U"\u30F0", U"\u30F0"},
+	{U"\u32FD", U"\u32FD", U"\u32FD", U"\u30F1", U"\u30F1"},
+	{U"\u32FE", U"\u32FE", U"\u32FE", U"\u30F2", U"\u30F2"},
+	{U"\u32FF", U"\u32FF", U"\u32FF", U"\u4EE4\u548C", U"\u4EE4\u548C"},
+	{U"\u3300", U"\u3300", U"\u3300", U"\u30A2\u30D1\u30FC\u30C8", U"\u30A2\u30CF\u309A\u30FC\u30C8"},
+	{U"\u3301", U"\u3301", U"\u3301", U"\u30A2\u30EB\u30D5\u30A1", U"\u30A2\u30EB\u30D5\u30A1"},
+	{U"\u3302", U"\u3302", U"\u3302", U"\u30A2\u30F3\u30DA\u30A2", U"\u30A2\u30F3\u30D8\u309A\u30A2"},
+	{U"\u3303", U"\u3303", U"\u3303", U"\u30A2\u30FC\u30EB", U"\u30A2\u30FC\u30EB"},
+	{U"\u3304", U"\u3304", U"\u3304", U"\u30A4\u30CB\u30F3\u30B0", U"\u30A4\u30CB\u30F3\u30AF\u3099"},
+	{U"\u3305", U"\u3305", U"\u3305", U"\u30A4\u30F3\u30C1", U"\u30A4\u30F3\u30C1"},
+	{U"\u3306", U"\u3306", U"\u3306", U"\u30A6\u30A9\u30F3", U"\u30A6\u30A9\u30F3"},
+	{U"\u3307", U"\u3307", U"\u3307", U"\u30A8\u30B9\u30AF\u30FC\u30C9", U"\u30A8\u30B9\u30AF\u30FC\u30C8\u3099"},
+	{U"\u3308", U"\u3308", U"\u3308", U"\u30A8\u30FC\u30AB\u30FC", U"\u30A8\u30FC\u30AB\u30FC"},
+	{U"\u3309", U"\u3309", U"\u3309", U"\u30AA\u30F3\u30B9", U"\u30AA\u30F3\u30B9"},
+	{U"\u330A", U"\u330A", U"\u330A", U"\u30AA\u30FC\u30E0", U"\u30AA\u30FC\u30E0"},
+	{U"\u330B", U"\u330B", U"\u330B", U"\u30AB\u30A4\u30EA", U"\u30AB\u30A4\u30EA"},
+	{U"\u330C", U"\u330C", U"\u330C", U"\u30AB\u30E9\u30C3\u30C8", U"\u30AB\u30E9\u30C3\u30C8"},
+	{U"\u330D", U"\u330D", U"\u330D", U"\u30AB\u30ED\u30EA\u30FC", U"\u30AB\u30ED\u30EA\u30FC"},
+	{U"\u330E", U"\u330E", U"\u330E", U"\u30AC\u30ED\u30F3", U"\u30AB\u3099\u30ED\u30F3"},
+	{U"\u330F", U"\u330F", U"\u330F", U"\u30AC\u30F3\u30DE", U"\u30AB\u3099\u30F3\u30DE"},
+	{U"\u3310", U"\u3310", U"\u3310", U"\u30AE\u30AC", U"\u30AD\u3099\u30AB\u3099"},
+	{U"\u3311", U"\u3311", U"\u3311", U"\u30AE\u30CB\u30FC", U"\u30AD\u3099\u30CB\u30FC"},
+	{U"\u3312", U"\u3312", U"\u3312", U"\u30AD\u30E5\u30EA\u30FC", U"\u30AD\u30E5\u30EA\u30FC"},
+	{U"\u3313", U"\u3313", U"\u3313", U"\u30AE\u30EB\u30C0\u30FC", U"\u30AD\u3099\u30EB\u30BF\u3099\u30FC"},
+	{U"\u3314", U"\u3314", U"\u3314", U"\u30AD\u30ED", U"\u30AD\u30ED"},
+	{U"\u3315", U"\u3315", U"\u3315", U"\u30AD\u30ED\u30B0\u30E9\u30E0", U"\u30AD\u30ED\u30AF\u3099\u30E9\u30E0"},
+	{U"\u3316", U"\u3316", U"\u3316", U"\u30AD\u30ED\u30E1\u30FC\u30C8\u30EB", U"\u30AD\u30ED\u30E1\u30FC\u30C8\u30EB"},
+	{U"\u3317", U"\u3317", U"\u3317", U"\u30AD\u30ED\u30EF\u30C3\u30C8", U"\u30AD\u30ED\u30EF\u30C3\u30C8"},
+	{U"\u3318", U"\u3318", U"\u3318", U"\u30B0\u30E9\u30E0", U"\u30AF\u3099\u30E9\u30E0"},
+	{U"\u3319", U"\u3319", U"\u3319", U"\u30B0\u30E9\u30E0\u30C8\u30F3", U"\u30AF\u3099\u30E9\u30E0\u30C8\u30F3"},
+	{U"\u331A", U"\u331A", U"\u331A", U"\u30AF\u30EB\u30BC\u30A4\u30ED", U"\u30AF\u30EB\u30BB\u3099\u30A4\u30ED"},
+	{U"\u331B", U"\u331B", U"\u331B", U"\u30AF\u30ED\u30FC\u30CD", U"\u30AF\u30ED\u30FC\u30CD"},
+	{U"\u331C", U"\u331C", U"\u331C", U"\u30B1\u30FC\u30B9", U"\u30B1\u30FC\u30B9"},
+	{U"\u331D", U"\u331D", U"\u331D", U"\u30B3\u30EB\u30CA", U"\u30B3\u30EB\u30CA"},
+	{U"\u331E", U"\u331E", U"\u331E", U"\u30B3\u30FC\u30DD", U"\u30B3\u30FC\u30DB\u309A"},
+	{U"\u331F", U"\u331F", U"\u331F", U"\u30B5\u30A4\u30AF\u30EB", U"\u30B5\u30A4\u30AF\u30EB"},
+	{U"\u3320", U"\u3320", U"\u3320", U"\u30B5\u30F3\u30C1\u30FC\u30E0", U"\u30B5\u30F3\u30C1\u30FC\u30E0"},
+	{U"\u3321", U"\u3321", U"\u3321", U"\u30B7\u30EA\u30F3\u30B0", U"\u30B7\u30EA\u30F3\u30AF\u3099"},
+	{U"\u3322", U"\u3322", U"\u3322", U"\u30BB\u30F3\u30C1", U"\u30BB\u30F3\u30C1"},
+	{U"\u3323", U"\u3323", U"\u3323", U"\u30BB\u30F3\u30C8", U"\u30BB\u30F3\u30C8"},
+	{U"\u3324", U"\u3324", U"\u3324", U"\u30C0\u30FC\u30B9", U"\u30BF\u3099\u30FC\u30B9"},
+	{U"\u3325", U"\u3325", U"\u3325", U"\u30C7\u30B7", U"\u30C6\u3099\u30B7"},
+	{U"\u3326", U"\u3326", U"\u3326", U"\u30C9\u30EB", U"\u30C8\u3099\u30EB"},
+	{U"\u3327", U"\u3327", U"\u3327", U"\u30C8\u30F3", U"\u30C8\u30F3"},
+	{U"\u3328", U"\u3328", U"\u3328", U"\u30CA\u30CE", U"\u30CA\u30CE"},
+	{U"\u3329", U"\u3329", U"\u3329", U"\u30CE\u30C3\u30C8", U"\u30CE\u30C3\u30C8"},
+	{U"\u332A", U"\u332A", U"\u332A", U"\u30CF\u30A4\u30C4", U"\u30CF\u30A4\u30C4"},
+	{U"\u332B", U"\u332B", U"\u332B", U"\u30D1\u30FC\u30BB\u30F3\u30C8", U"\u30CF\u309A\u30FC\u30BB\u30F3\u30C8"},
+	{U"\u332C", U"\u332C", U"\u332C", U"\u30D1\u30FC\u30C4", U"\u30CF\u309A\u30FC\u30C4"},
+	{U"\u332D", U"\u332D", U"\u332D", U"\u30D0\u30FC\u30EC\u30EB", U"\u30CF\u3099\u30FC\u30EC\u30EB"},
+	{U"\u332E", U"\u332E", U"\u332E", U"\u30D4\u30A2\u30B9\u30C8\u30EB", U"\u30D2\u309A\u30A2\u30B9\u30C8\u30EB"},
+	{U"\u332F", U"\u332F", U"\u332F", U"\u30D4\u30AF\u30EB", U"\u30D2\u309A\u30AF\u30EB"},
+	{U"\u3330", U"\u3330", U"\u3330", U"\u30D4\u30B3", U"\u30D2\u309A\u30B3"},
+	{U"\u3331", U"\u3331", U"\u3331", U"\u30D3\u30EB", U"\u30D2\u3099\u30EB"},
+	{U"\u3332", U"\u3332", U"\u3332", U"\u30D5\u30A1\u30E9\u30C3\u30C9", U"\u30D5\u30A1\u30E9\u30C3\u30C8\u3099"},
+	{U"\u3333", U"\u3333", U"\u3333", U"\u30D5\u30A3\u30FC\u30C8", U"\u30D5\u30A3\u30FC\u30C8"},
+	{U"\u3334", U"\u3334", U"\u3334", U"\u30D6\u30C3\u30B7\u30A7\u30EB", U"\u30D5\u3099\u30C3\u30B7\u30A7\u30EB"},
+	{U"\u3335", U"\u3335", U"\u3335", U"\u30D5\u30E9\u30F3", U"\u30D5\u30E9\u30F3"},
+	{U"\u3336", U"\u3336", U"\u3336", U"\u30D8\u30AF\u30BF\u30FC\u30EB", U"\u30D8\u30AF\u30BF\u30FC\u30EB"},
+	{U"\u3337", U"\u3337", U"\u3337", U"\u30DA\u30BD", U"\u30D8\u309A\u30BD"},
+	{U"\u3338", U"\u3338", U"\u3338", U"\u30DA\u30CB\u30D2", U"\u30D8\u309A\u30CB\u30D2"},
+	{U"\u3339", U"\u3339", U"\u3339", U"\u30D8\u30EB\u30C4", U"\u30D8\u30EB\u30C4"},
+	{U"\u333A", U"\u333A", U"\u333A", U"\u30DA\u30F3\u30B9", U"\u30D8\u309A\u30F3\u30B9"},
+	{U"\u333B", U"\u333B", U"\u333B", U"\u30DA\u30FC\u30B8", U"\u30D8\u309A\u30FC\u30B7\u3099"},
+	{U"\u333C", U"\u333C", U"\u333C", U"\u30D9\u30FC\u30BF", U"\u30D8\u3099\u30FC\u30BF"},
+	{U"\u333D", U"\u333D", U"\u333D", U"\u30DD\u30A4\u30F3\u30C8", U"\u30DB\u309A\u30A4\u30F3\u30C8"},
+	{U"\u333E", U"\u333E", U"\u333E", U"\u30DC\u30EB\u30C8", U"\u30DB\u3099\u30EB\u30C8"},
+	{U"\u333F", U"\u333F", U"\u333F", U"\u30DB\u30F3", U"\u30DB\u30F3"},
+	{U"\u3340", U"\u3340", U"\u3340", U"\u30DD\u30F3\u30C9", U"\u30DB\u309A\u30F3\u30C8\u3099"},
+	{U"\u3341", U"\u3341", U"\u3341", U"\u30DB\u30FC\u30EB", U"\u30DB\u30FC\u30EB"},
+	{U"\u3342", U"\u3342", U"\u3342", U"\u30DB\u30FC\u30F3", U"\u30DB\u30FC\u30F3"},
+	{U"\u3343", U"\u3343", U"\u3343", U"\u30DE\u30A4\u30AF\u30ED", U"\u30DE\u30A4\u30AF\u30ED"},
+	{U"\u3344", U"\u3344", U"\u3344", U"\u30DE\u30A4\u30EB", U"\u30DE\u30A4\u30EB"},
+	{U"\u3345", U"\u3345", U"\u3345", U"\u30DE\u30C3\u30CF", U"\u30DE\u30C3\u30CF"},
+	{U"\u3346", U"\u3346", U"\u3346", U"\u30DE\u30EB\u30AF", U"\u30DE\u30EB\u30AF"},
+	{U"\u3347", U"\u3347", U"\u3347", U"\u30DE\u30F3\u30B7\u30E7\u30F3", U"\u30DE\u30F3\u30B7\u30E7\u30F3"},
+	{U"\u3348", U"\u3348", U"\u3348", U"\u30DF\u30AF\u30ED\u30F3", U"\u30DF\u30AF\u30ED\u30F3"},
+	{U"\u3349", U"\u3349", U"\u3349", U"\u30DF\u30EA", U"\u30DF\u30EA"},
+	{U"\u334A", U"\u334A", U"\u334A", U"\u30DF\u30EA\u30D0\u30FC\u30EB", U"\u30DF\u30EA\u30CF\u3099\u30FC\u30EB"},
+	{U"\u334B", U"\u334B", U"\u334B", U"\u30E1\u30AC", U"\u30E1\u30AB\u3099"},
+	{U"\u334C", U"\u334C", U"\u334C", U"\u30E1\u30AC\u30C8\u30F3", U"\u30E1\u30AB\u3099\u30C8\u30F3"},
+	{U"\u334D", U"\u334D", U"\u334D", U"\u30E1\u30FC\u30C8\u30EB", U"\u30E1\u30FC\u30C8\u30EB"},
+	{U"\u334E", U"\u334E", U"\u334E", U"\u30E4\u30FC\u30C9", U"\u30E4\u30FC\u30C8\u3099"},
+	{U"\u334F", U"\u334F", U"\u334F", U"\u30E4\u30FC\u30EB", U"\u30E4\u30FC\u30EB"},
+	{U"\u3350", U"\u3350", U"\u3350", U"\u30E6\u30A2\u30F3", U"\u30E6\u30A2\u30F3"},
+	{U"\u3351", U"\u3351", U"\u3351", U"\u30EA\u30C3\u30C8\u30EB", U"\u30EA\u30C3\u30C8\u30EB"},
+	{U"\u3352", U"\u3352", U"\u3352", U"\u30EA\u30E9", U"\u30EA\u30E9"},
+	{U"\u3353", U"\u3353", U"\u3353", U"\u30EB\u30D4\u30FC", U"\u30EB\u30D2\u309A\u30FC"},
+	{U"\u3354", U"\u3354", U"\u3354", U"\u30EB\u30FC\u30D6\u30EB", U"\u30EB\u30FC\u30D5\u3099\u30EB"},
+	{U"\u3355", U"\u3355", U"\u3355", U"\u30EC\u30E0", U"\u30EC\u30E0"},
+	{U"\u3356", U"\u3356", U"\u3356", U"\u30EC\u30F3\u30C8\u30B2\u30F3", U"\u30EC\u30F3\u30C8\u30B1\u3099\u30F3"},
+	{U"\u3357", U"\u3357", U"\u3357", U"\u30EF\u30C3\u30C8", U"\u30EF\u30C3\u30C8"},
+	{U"\u3358", U"\u3358", U"\u3358", U"0\u70B9", U"0\u70B9"},
+	{U"\u3359", U"\u3359", U"\u3359", U"1\u70B9", U"1\u70B9"},
+	{U"\u335A", U"\u335A", U"\u335A", U"2\u70B9", U"2\u70B9"},
+	{U"\u335B", U"\u335B", U"\u335B", U"3\u70B9", U"3\u70B9"},
+	{U"\u335C", U"\u335C", U"\u335C", U"4\u70B9", U"4\u70B9"},
+	{U"\u335D", U"\u335D", U"\u335D", U"5\u70B9", U"5\u70B9"},
+	{U"\u335E", U"\u335E", U"\u335E", U"6\u70B9", U"6\u70B9"},
+	{U"\u335F", U"\u335F", U"\u335F", U"7\u70B9", U"7\u70B9"},
+	{U"\u3360", U"\u3360", U"\u3360", U"8\u70B9", U"8\u70B9"},
+	{U"\u3361", U"\u3361", U"\u3361", U"9\u70B9", U"9\u70B9"},
+	{U"\u3362", U"\u3362", U"\u3362", U"10\u70B9", U"10\u70B9"},
+	{U"\u3363", U"\u3363", U"\u3363", U"11\u70B9", U"11\u70B9"},
+	{U"\u3364", U"\u3364", U"\u3364", U"12\u70B9", U"12\u70B9"},
+	{U"\u3365", U"\u3365", U"\u3365", U"13\u70B9", U"13\u70B9"},
+	{U"\u3366", U"\u3366", U"\u3366", U"14\u70B9", U"14\u70B9"},
+	{U"\u3367", U"\u3367", U"\u3367", U"15\u70B9", U"15\u70B9"},
+	{U"\u3368", U"\u3368", U"\u3368", U"16\u70B9", U"16\u70B9"},
+	{U"\u3369", U"\u3369", U"\u3369", U"17\u70B9", U"17\u70B9"},
+	{U"\u336A", U"\u336A", U"\u336A", U"18\u70B9", U"18\u70B9"},
+	{U"\u336B", U"\u336B", U"\u336B", U"19\u70B9", U"19\u70B9"},
+	{U"\u336C", U"\u336C", U"\u336C", U"20\u70B9", U"20\u70B9"},
+	{U"\u336D", U"\u336D", U"\u336D", U"21\u70B9", U"21\u70B9"},
+	{U"\u336E", U"\u336E", U"\u336E", U"22\u70B9", U"22\u70B9"},
+	{U"\u336F", U"\u336F", U"\u336F", U"23\u70B9", U"23\u70B9"},
+	{U"\u3370", U"\u3370", U"\u3370", U"24\u70B9", U"24\u70B9"},
+	{U"\u3371", U"\u3371", U"\u3371", U"hPa", U"hPa"},
+	{U"\u3372", U"\u3372", U"\u3372", U"da", U"da"},
+	{U"\u3373", U"\u3373", U"\u3373", U"AU", U"AU"},
+	{U"\u3374", U"\u3374", U"\u3374", U"bar", U"bar"},
+	{U"\u3375", U"\u3375", U"\u3375", U"oV", U"oV"},
+	{U"\u3376", U"\u3376", U"\u3376", U"pc", U"pc"},
+	{U"\u3377", U"\u3377", U"\u3377", U"dm", U"dm"},
+	{U"\u3378", U"\u3378", U"\u3378", U"dm2", U"dm2"},
+	{U"\u3379", U"\u3379", U"\u3379", U"dm3", U"dm3"},
+	{U"\u337A", U"\u337A", U"\u337A", U"IU", U"IU"},
+	{U"\u337B", U"\u337B", U"\u337B", U"\u5E73\u6210", U"\u5E73\u6210"},
+	{U"\u337C", U"\u337C", U"\u337C", U"\u662D\u548C", U"\u662D\u548C"},
+	{U"\u337D", U"\u337D", U"\u337D", U"\u5927\u6B63", U"\u5927\u6B63"},
+	{U"\u337E", U"\u337E", U"\u337E", U"\u660E\u6CBB", U"\u660E\u6CBB"},
+	{U"\u337F", U"\u337F", U"\u337F", U"\u682A\u5F0F\u4F1A\u793E", U"\u682A\u5F0F\u4F1A\u793E"},
+	{U"\u3380", U"\u3380", U"\u3380", U"pA", U"pA"},
+	{U"\u3381", U"\u3381", U"\u3381", U"nA", U"nA"},
+	{U"\u3382", U"\u3382", U"\u3382", U"\u03BCA", U"\u03BCA"},
+	{U"\u3383", U"\u3383", U"\u3383", U"mA", U"mA"},
+	{U"\u3384", U"\u3384", U"\u3384", U"kA", U"kA"},
+	{U"\u3385", U"\u3385", U"\u3385", U"KB", U"KB"},
+	{U"\u3386", U"\u3386", U"\u3386", U"MB", U"MB"},
+	{U"\u3387", U"\u3387", U"\u3387", U"GB", U"GB"},
+	{U"\u3388", U"\u3388", U"\u3388", U"cal", U"cal"},
+	{U"\u3389", U"\u3389", U"\u3389", U"kcal", U"kcal"},
+	{U"\u338A", U"\u338A", U"\u338A", U"pF", U"pF"},
+	{U"\u338B", U"\u338B", U"\u338B", U"nF", U"nF"},
+	{U"\u338C", U"\u338C", U"\u338C", U"\u03BCF", U"\u03BCF"},
+	{U"\u338D", U"\u338D", U"\u338D", U"\u03BCg", U"\u03BCg"},
+	{U"\u338E", U"\u338E", U"\u338E", U"mg", U"mg"},
+	{U"\u338F", U"\u338F", U"\u338F", U"kg", U"kg"},
+	{U"\u3390", U"\u3390", U"\u3390", U"Hz", U"Hz"},
+	{U"\u3391", U"\u3391", U"\u3391", U"kHz", U"kHz"},
+	{U"\u3392", U"\u3392", U"\u3392", U"MHz", U"MHz"},
+	{U"\u3393", U"\u3393", U"\u3393", U"GHz", U"GHz"},
+	{U"\u3394", U"\u3394", U"\u3394", U"THz", U"THz"},
+	{U"\u3395", U"\u3395", U"\u3395", U"\u03BCl", U"\u03BCl"},
+	{U"\u3396", U"\u3396", U"\u3396", U"ml", U"ml"},
+	{U"\u3397", U"\u3397", U"\u3397", U"dl", U"dl"},
+	{U"\u3398", U"\u3398", U"\u3398", U"kl", U"kl"},
+	{U"\u3399", U"\u3399", U"\u3399", U"fm", U"fm"},
+	{U"\u339A", U"\u339A", U"\u339A", U"nm", U"nm"},
+	{U"\u339B", U"\u339B", U"\u339B", U"\u03BCm", U"\u03BCm"},
+	{U"\u339C", U"\u339C", U"\u339C", U"mm", U"mm"},
+	{U"\u339D", U"\u339D", U"\u339D", U"cm", U"cm"},
+	{U"\u339E", U"\u339E", U"\u339E", U"km", U"km"},
+	{U"\u339F", U"\u339F", U"\u339F", U"mm2", U"mm2"},
+	{U"\u33A0", U"\u33A0", U"\u33A0", U"cm2", U"cm2"},
+	{U"\u33A1", U"\u33A1", U"\u33A1", U"m2", U"m2"},
+	{U"\u33A2", U"\u33A2", U"\u33A2", U"km2", U"km2"},
+	{U"\u33A3", U"\u33A3", U"\u33A3", U"mm3", U"mm3"},
+	{U"\u33A4", U"\u33A4", U"\u33A4", U"cm3", U"cm3"},
+	{U"\u33A5", U"\u33A5", U"\u33A5", U"m3", U"m3"},
+	{U"\u33A6", U"\u33A6", U"\u33A6", U"km3", U"km3"},
+	{U"\u33A7", U"\u33A7", U"\u33A7", U"m\u2215s", U"m\u2215s"},
+	{U"\u33A8", U"\u33A8", U"\u33A8", U"m\u2215s2", U"m\u2215s2"},
+	{U"\u33A9", U"\u33A9", U"\u33A9", U"Pa", U"Pa"},
+	{U"\u33AA", U"\u33AA", U"\u33AA", U"kPa", U"kPa"},
+	{U"\u33AB", U"\u33AB", U"\u33AB", U"MPa", U"MPa"},
+	{U"\u33AC", U"\u33AC", U"\u33AC", U"GPa", U"GPa"},
+	{U"\u33AD", U"\u33AD", U"\u33AD", U"rad", U"rad"},
+	{U"\u33AE", U"\u33AE", U"\u33AE", U"rad\u2215s", U"rad\u2215s"},
+	{U"\u33AF", U"\u33AF", U"\u33AF", U"rad\u2215s2", U"rad\u2215s2"},
+	{U"\u33B0", U"\u33B0", U"\u33B0", U"ps", U"ps"},
+	{U"\u33B1", U"\u33B1", U"\u33B1", U"ns", U"ns"},
+	{U"\u33B2", U"\u33B2", U"\u33B2", U"\u03BCs", U"\u03BCs"},
+	{U"\u33B3", U"\u33B3", U"\u33B3", U"ms", U"ms"},
+	{U"\u33B4", U"\u33B4", U"\u33B4", U"pV", U"pV"},
+	{U"\u33B5", U"\u33B5", U"\u33B5", U"nV", U"nV"},
+	{U"\u33B6", U"\u33B6", U"\u33B6", U"\u03BCV", U"\u03BCV"},
+	{U"\u33B7", U"\u33B7", U"\u33B7", U"mV", U"mV"},
+	{U"\u33B8", U"\u33B8", U"\u33B8", U"kV", U"kV"},
+	{U"\u33B9", U"\u33B9", U"\u33B9", U"MV", U"MV"},
+	{U"\u33BA", U"\u33BA", U"\u33BA", U"pW", U"pW"},
+	{U"\u33BB", U"\u33BB", U"\u33BB", U"nW", U"nW"},
+	{U"\u33BC", U"\u33BC", U"\u33BC", U"\u03BCW", U"\u03BCW"},
+	{U"\u33BD", U"\u33BD", U"\u33BD", U"mW", U"mW"},
+	{U"\u33BE", U"\u33BE", U"\u33BE", U"kW", U"kW"},
+	{U"\u33BF", U"\u33BF", U"\u33BF", U"MW", U"MW"},
+	{U"\u33C0", U"\u33C0", U"\u33C0", U"k\u03A9", U"k\u03A9"},
+	{U"\u33C1", U"\u33C1", U"\u33C1", U"M\u03A9", U"M\u03A9"},
+	{U"\u33C2", U"\u33C2", U"\u33C2", U"a.m.", U"a.m."},
+	{U"\u33C3", U"\u33C3", U"\u33C3", U"Bq", U"Bq"},
+	{U"\u33C4", U"\u33C4", U"\u33C4", U"cc", U"cc"},
+	{U"\u33C5", U"\u33C5", U"\u33C5", U"cd", U"cd"},
+	{U"\u33C6", U"\u33C6", U"\u33C6", U"C\u2215kg", U"C\u2215kg"},
+	{U"\u33C7", U"\u33C7", U"\u33C7", U"Co.", U"Co."},
+	{U"\u33C8", U"\u33C8", U"\u33C8", U"dB", U"dB"},
+	{U"\u33C9", U"\u33C9", U"\u33C9", U"Gy", U"Gy"},
+	{U"\u33CA", U"\u33CA", U"\u33CA", U"ha", U"ha"},
+	{U"\u33CB", U"\u33CB", U"\u33CB", U"HP", U"HP"},
+	{U"\u33CC", U"\u33CC", U"\u33CC", U"in", U"in"},
+	{U"\u33CD", U"\u33CD", U"\u33CD", U"KK", U"KK"},
+	{U"\u33CE", U"\u33CE", U"\u33CE", U"KM", U"KM"},
+	{U"\u33CF", U"\u33CF", U"\u33CF", U"kt", U"kt"},
+	{U"\u33D0", U"\u33D0", U"\u33D0", U"lm", U"lm"},
+	{U"\u33D1", U"\u33D1", U"\u33D1", U"ln", U"ln"},
+	{U"\u33D2", U"\u33D2", U"\u33D2", U"log", U"log"},
+	{U"\u33D3", U"\u33D3", U"\u33D3", U"lx", U"lx"},
+	{U"\u33D4", U"\u33D4", U"\u33D4", U"mb", U"mb"},
+	{U"\u33D5", U"\u33D5", U"\u33D5", U"mil", U"mil"},
+	{U"\u33D6", U"\u33D6", U"\u33D6", U"mol", U"mol"},
+	{U"\u33D7", U"\u33D7", U"\u33D7", U"PH", U"PH"},
+	{U"\u33D8", U"\u33D8", U"\u33D8", U"p.m.", U"p.m."},
+	{U"\u33D9", U"\u33D9", U"\u33D9", U"PPM", U"PPM"},
+	{U"\u33DA", U"\u33DA", U"\u33DA", U"PR", U"PR"},
+	{U"\u33DB", U"\u33DB", U"\u33DB", U"sr", U"sr"},
+	{U"\u33DC", U"\u33DC", U"\u33DC", U"Sv", U"Sv"},
+	{U"\u33DD", U"\u33DD", U"\u33DD", U"Wb", U"Wb"},
+	{U"\u33DE", U"\u33DE", U"\u33DE", U"V\u2215m", U"V\u2215m"},
+	{U"\u33DF", U"\u33DF", U"\u33DF", U"A\u2215m", U"A\u2215m"},
+	{U"\u33E0", U"\u33E0", U"\u33E0", U"1\u65E5", U"1\u65E5"},
+	{U"\u33E1", U"\u33E1", U"\u33E1", U"2\u65E5", U"2\u65E5"},
+	{U"\u33E2", U"\u33E2", U"\u33E2", U"3\u65E5", U"3\u65E5"},
+	{U"\u33E3", U"\u33E3", U"\u33E3", U"4\u65E5", U"4\u65E5"},
+	{U"\u33E4", U"\u33E4", U"\u33E4", U"5\u65E5", U"5\u65E5"},
+	{U"\u33E5", U"\u33E5", U"\u33E5", U"6\u65E5", U"6\u65E5"},
+	{U"\u33E6", U"\u33E6", U"\u33E6", U"7\u65E5", U"7\u65E5"},
+	{U"\u33E7", U"\u33E7", U"\u33E7", U"8\u65E5", U"8\u65E5"},
+	{U"\u33E8", U"\u33E8", U"\u33E8", U"9\u65E5", U"9\u65E5"},
+	{U"\u33E9", U"\u33E9", U"\u33E9", U"10\u65E5", U"10\u65E5"},
+	{U"\u33EA", U"\u33EA", U"\u33EA", U"11\u65E5", U"11\u65E5"},
+	{U"\u33EB", U"\u33EB", U"\u33EB", U"12\u65E5", U"12\u65E5"},
+	{U"\u33EC", U"\u33EC", U"\u33EC", U"13\u65E5", U"13\u65E5"},
+	{U"\u33ED", U"\u33ED", U"\u33ED", U"14\u65E5", U"14\u65E5"},
+	{U"\u33EE", U"\u33EE", U"\u33EE", U"15\u65E5", U"15\u65E5"},
+	{U"\u33EF", U"\u33EF", U"\u33EF", U"16\u65E5", U"16\u65E5"},
+	{U"\u33F0", U"\u33F0", U"\u33F0", U"17\u65E5", U"17\u65E5"},
+	{U"\u33F1", U"\u33F1", U"\u33F1", U"18\u65E5", U"18\u65E5"},
+	{U"\u33F2", U"\u33F2", U"\u33F2", U"19\u65E5", U"19\u65E5"},
+	{U"\u33F3", U"\u33F3", U"\u33F3", U"20\u65E5", U"20\u65E5"},
+	{U"\u33F4", U"\u33F4", U"\u33F4", U"21\u65E5", U"21\u65E5"},
+	{U"\u33F5", U"\u33F5", U"\u33F5", U"22\u65E5", U"22\u65E5"},
+	{U"\u33F6", U"\u33F6", U"\u33F6", U"23\u65E5", U"23\u65E5"},
+	{U"\u33F7", U"\u33F7", U"\u33F7", U"24\u65E5", U"24\u65E5"},
+	{U"\u33F8", U"\u33F8", U"\u33F8", U"25\u65E5", U"25\u65E5"},
+	{U"\u33F9", U"\u33F9", U"\u33F9", U"26\u65E5", U"26\u65E5"},
+	{U"\u33FA", U"\u33FA", U"\u33FA", U"27\u65E5", U"27\u65E5"},
+	{U"\u33FB", U"\u33FB", U"\u33FB", U"28\u65E5", U"28\u65E5"},
+	{U"\u33FC", U"\u33FC", U"\u33FC", U"29\u65E5", U"29\u65E5"},
+	{U"\u33FD", U"\u33FD", U"\u33FD", U"30\u65E5", U"30\u65E5"},
+	{U"\u33FE", U"\u33FE", U"\u33FE", U"31\u65E5", U"31\u65E5"},
+	{U"\u33FF", U"\u33FF", U"\u33FF", U"gal", U"gal"},
+	{U"\uA69C", U"\uA69C", U"\uA69C", U"\u044A", U"\u044A"},
+	{U"\uA69D", U"\uA69D", U"\uA69D", U"\u044C", U"\u044C"},
+	{U"\uA770", U"\uA770", U"\uA770", U"\uA76F", U"\uA76F"},
+	{U"\uA7F2", U"\uA7F2", U"\uA7F2", U"C", U"C"},
+	{U"\uA7F3", U"\uA7F3", U"\uA7F3", U"F", U"F"},
+	{U"\uA7F4", U"\uA7F4", U"\uA7F4", U"Q", U"Q"},
+	{U"\uA7F8", U"\uA7F8", U"\uA7F8", U"\u0126", U"\u0126"},
+	{U"\uA7F9", U"\uA7F9", U"\uA7F9", U"\u0153", U"\u0153"},
+	{U"\uAB5C", U"\uAB5C", U"\uAB5C", U"\uA727", U"\uA727"},
+	{U"\uAB5D", U"\uAB5D", U"\uAB5D", U"\uAB37", U"\uAB37"},
+	{U"\uAB5E", U"\uAB5E", U"\uAB5E", U"\u026B", U"\u026B"},
+	{U"\uAB5F", U"\uAB5F", U"\uAB5F", U"\uAB52", U"\uAB52"},
+	{U"\uAB69", U"\uAB69", U"\uAB69", U"\u028D", U"\u028D"},
+	{U"\uAC00", U"\uAC00", U"\u1100\u1161", U"\uAC00", U"\u1100\u1161"},
+	{U"\uAC64", U"\uAC64", U"\u1100\u1164\u11B7", U"\uAC64", U"\u1100\u1164\u11B7"},
+	{U"\uACC8", U"\uACC8", U"\u1100\u1168\u11AB", U"\uACC8", U"\u1100\u1168\u11AB"},
+	{U"\uAD2C", U"\uAD2C", U"\u1100\u116B\u11BB", U"\uAD2C", U"\u1100\u116B\u11BB"},
+	{U"\uAD90", U"\uAD90", U"\u1100\u116F\u11AF", U"\uAD90", U"\u1100\u116F\u11AF"},
+	{U"\uADF4", U"\uADF4", U"\u1100\u1172\u11BF", U"\uADF4", U"\u1100\u1172\u11BF"},
+	{U"\uAE58", U"\uAE58", U"\u1101\u1161\u11B3", U"\uAE58", U"\u1101\u1161\u11B3"},
+	{U"\uAEBC", U"\uAEBC", U"\u1101\u1165", U"\uAEBC", U"\u1101\u1165"},
+	{U"\uAF20", U"\uAF20", U"\u1101\u1168\u11B7", U"\uAF20", U"\u1101\u1168\u11B7"},
+	{U"\uAF84", U"\uAF84", U"\u1101\u116C\u11AB", U"\uAF84", U"\u1101\u116C\u11AB"},
+	{U"\uAFE8", U"\uAFE8", U"\u1101\u116F\u11BB", U"\uAFE8", U"\u1101\u116F\u11BB"},
+	{U"\uB04C", U"\uB04C", U"\u1101\u1173\u11AF", U"\uB04C", U"\u1101\u1173\u11AF"},
+	{U"\uB0B0", U"\uB0B0", U"\u1102\u1161\u11BF", U"\uB0B0", U"\u1102\u1161\u11BF"},
+	{U"\uB114", U"\uB114", U"\u1102\u1165\u11B3", U"\uB114", U"\u1102\u1165\u11B3"},
+	{U"\uB178", U"\uB178", U"\u1102\u1169", U"\uB178", U"\u1102\u1169"},
+	{U"\uB1DC", U"\uB1DC", U"\u1102\u116C\u11B7", U"\uB1DC", U"\u1102\u116C\u11B7"},
+	{U"\uB240", U"\uB240", U"\u1102\u1170\u11AB", U"\uB240", U"\u1102\u1170\u11AB"},
+	{U"\uB2A4", U"\uB2A4", U"\u1102\u1173\u11BB", U"\uB2A4", U"\u1102\u1173\u11BB"},
+	{U"\uB308", U"\uB308", U"\u1103\u1162\u11AF", U"\uB308", U"\u1103\u1162\u11AF"},
+	{U"\uB36C", U"\uB36C", U"\u1103\u1165\u11BF", U"\uB36C", U"\u1103\u1165\u11BF"},
+	{U"\uB3D0", U"\uB3D0", U"\u1103\u1169\u11B3", U"\uB3D0", U"\u1103\u1169\u11B3"},
+	{U"\uB434", U"\uB434", U"\u1103\u116D", U"\uB434", U"\u1103\u116D"},
+	{U"\uB498", U"\uB498", U"\u1103\u1170\u11B7", U"\uB498", U"\u1103\u1170\u11B7"},
+	{U"\uB4FC", U"\uB4FC", U"\u1103\u1174\u11AB", U"\uB4FC", U"\u1103\u1174\u11AB"},
+	{U"\uB560", U"\uB560", U"\u1104\u1162\u11BB", U"\uB560", U"\u1104\u1162\u11BB"},
+	{U"\uB5C4", U"\uB5C4", U"\u1104\u1166\u11AF", U"\uB5C4", U"\u1104\u1166\u11AF"},
+	{U"\uB628", U"\uB628", U"\u1104\u1169\u11BF", U"\uB628", U"\u1104\u1169\u11BF"},
+	{U"\uB68C", U"\uB68C", U"\u1104\u116D\u11B3", U"\uB68C", U"\u1104\u116D\u11B3"},
+	{U"\uB6F0", U"\uB6F0", U"\u1104\u1171", U"\uB6F0", U"\u1104\u1171"},
+	{U"\uB754", U"\uB754", U"\u1104\u1174\u11B7", U"\uB754", U"\u1104\u1174\u11B7"},
+	{U"\uB7B8", U"\uB7B8", U"\u1105\u1163\u11AB", U"\uB7B8", U"\u1105\u1163\u11AB"},
+	{U"\uB81C", U"\uB81C", U"\u1105\u1166\u11BB", U"\uB81C", U"\u1105\u1166\u11BB"},
+	{U"\uB880", U"\uB880", U"\u1105\u116A\u11AF", U"\uB880", U"\u1105\u116A\u11AF"},
+	{U"\uB8E4", U"\uB8E4", U"\u1105\u116D\u11BF", U"\uB8E4", U"\u1105\u116D\u11BF"},
+	{U"\uB948", U"\uB948", U"\u1105\u1171\u11B3", U"\uB948", U"\u1105\u1171\u11B3"},
+	{U"\uB9AC", U"\uB9AC", U"\u1105\u1175", U"\uB9AC", U"\u1105\u1175"},
+	{U"\uBA10", U"\uBA10", U"\u1106\u1163\u11B7", U"\uBA10", U"\u1106\u1163\u11B7"},
+	{U"\uBA74", U"\uBA74", U"\u1106\u1167\u11AB", U"\uBA74", U"\u1106\u1167\u11AB"},
+	{U"\uBAD8", U"\uBAD8", U"\u1106\u116A\u11BB", U"\uBAD8", U"\u1106\u116A\u11BB"},
+	{U"\uBB3C", U"\uBB3C", U"\u1106\u116E\u11AF", U"\uBB3C", U"\u1106\u116E\u11AF"},
+	{U"\uBBA0", U"\uBBA0", U"\u1106\u1171\u11BF", U"\uBBA0", U"\u1106\u1171\u11BF"},
+	{U"\uBC04", U"\uBC04", U"\u1106\u1175\u11B3", U"\uBC04", U"\u1106\u1175\u11B3"},
+	{U"\uBC68", U"\uBC68", U"\u1107\u1164", U"\uBC68", U"\u1107\u1164"},
+	{U"\uBCCC", U"\uBCCC", U"\u1107\u1167\u11B7", U"\uBCCC", U"\u1107\u1167\u11B7"},
+	{U"\uBD30", U"\uBD30", U"\u1107\u116B\u11AB", U"\uBD30", U"\u1107\u116B\u11AB"},
+	{U"\uBD94", U"\uBD94", U"\u1107\u116E\u11BB", U"\uBD94", U"\u1107\u116E\u11BB"},
+	{U"\uBDF8", U"\uBDF8", U"\u1107\u1172\u11AF", U"\uBDF8", U"\u1107\u1172\u11AF"},
+	{U"\uBE5C", U"\uBE5C", U"\u1107\u1175\u11BF", U"\uBE5C", U"\u1107\u1175\u11BF"},
+	{U"\uBEC0", U"\uBEC0", U"\u1108\u1164\u11B3", U"\uBEC0", U"\u1108\u1164\u11B3"},
+	{U"\uBF24", U"\uBF24", U"\u1108\u1168", U"\uBF24", U"\u1108\u1168"},
+	{U"\uBF88", U"\uBF88", U"\u1108\u116B\u11B7", U"\uBF88", U"\u1108\u116B\u11B7"},
+	{U"\uBFEC", U"\uBFEC", U"\u1108\u116F\u11AB", U"\uBFEC", U"\u1108\u116F\u11AB"},
+	{U"\uC050", U"\uC050", U"\u1108\u1172\u11BB", U"\uC050", U"\u1108\u1172\u11BB"},
+	{U"\uC0B4", U"\uC0B4", U"\u1109\u1161\u11AF", U"\uC0B4", U"\u1109\u1161\u11AF"},
+	{U"\uC118", U"\uC118", U"\u1109\u1164\u11BF", U"\uC118", U"\u1109\u1164\u11BF"},
+	{U"\uC17C", U"\uC17C", U"\u1109\u1168\u11B3", U"\uC17C", U"\u1109\u1168\u11B3"},
+	{U"\uC1E0", U"\uC1E0", U"\u1109\u116C", U"\uC1E0", U"\u1109\u116C"},
+	{U"\uC244", U"\uC244", U"\u1109\u116F\u11B7", U"\uC244", U"\u1109\u116F\u11B7"},
+	{U"\uC2A8", U"\uC2A8", U"\u1109\u1173\u11AB", U"\uC2A8", U"\u1109\u1173\u11AB"},
+	{U"\uC30C", U"\uC30C", U"\u110A\u1161\u11BB", U"\uC30C", U"\u110A\u1161\u11BB"},
+	{U"\uC370", U"\uC370", U"\u110A\u1165\u11AF", U"\uC370", U"\u110A\u1165\u11AF"},
+	{U"\uC3D4", U"\uC3D4", U"\u110A\u1168\u11BF", U"\uC3D4", U"\u110A\u1168\u11BF"},
+	{U"\uC438", U"\uC438", U"\u110A\u116C\u11B3", U"\uC438", U"\u110A\u116C\u11B3"},
+	{U"\uC49C", U"\uC49C", U"\u110A\u1170", U"\uC49C", U"\u110A\u1170"},
+	{U"\uC500", U"\uC500", U"\u110A\u1173\u11B7", U"\uC500", U"\u110A\u1173\u11B7"},
+	{U"\uC564", U"\uC564", U"\u110B\u1162\u11AB", U"\uC564", U"\u110B\u1162\u11AB"},
+	{U"\uC5C8", U"\uC5C8", U"\u110B\u1165\u11BB", U"\uC5C8", U"\u110B\u1165\u11BB"},
+	{U"\uC62C", U"\uC62C", U"\u110B\u1169\u11AF", U"\uC62C", U"\u110B\u1169\u11AF"},
+	{U"\uC690", U"\uC690", U"\u110B\u116C\u11BF", U"\uC690", U"\u110B\u116C\u11BF"},
+	{U"\uC6F4", U"\uC6F4", U"\u110B\u1170\u11B3", U"\uC6F4", U"\u110B\u1170\u11B3"},
+	{U"\uC758", U"\uC758", U"\u110B\u1174", U"\uC758", U"\u110B\u1174"},
+	{U"\uC7BC", U"\uC7BC", U"\u110C\u1162\u11B7", U"\uC7BC", U"\u110C\u1162\u11B7"},
+	{U"\uC820", U"\uC820", U"\u110C\u1166\u11AB", U"\uC820", U"\u110C\u1166\u11AB"},
+	{U"\uC884", U"\uC884", U"\u110C\u1169\u11BB", U"\uC884", U"\u110C\u1169\u11BB"},
+	{U"\uC8E8", U"\uC8E8", U"\u110C\u116D\u11AF", U"\uC8E8", U"\u110C\u116D\u11AF"},
+	{U"\uC94C", U"\uC94C", U"\u110C\u1170\u11BF", U"\uC94C", U"\u110C\u1170\u11BF"},
+	{U"\uC9B0", U"\uC9B0", U"\u110C\u1174\u11B3", U"\uC9B0", U"\u110C\u1174\u11B3"},
+	{U"\uCA14", U"\uCA14", U"\u110D\u1163", U"\uCA14", U"\u110D\u1163"},
+	{U"\uCA78", U"\uCA78", U"\u110D\u1166\u11B7", U"\uCA78", U"\u110D\u1166\u11B7"},
+	{U"\uCADC", U"\uCADC", U"\u110D\u116A\u11AB", U"\uCADC", U"\u110D\u116A\u11AB"},
+	{U"\uCB40", U"\uCB40", U"\u110D\u116D\u11BB", U"\uCB40", U"\u110D\u116D\u11BB"},
+	{U"\uCBA4", U"\uCBA4", U"\u110D\u1171\u11AF", U"\uCBA4", U"\u110D\u1171\u11AF"},
+	{U"\uCC08", U"\uCC08", U"\u110D\u1174\u11BF", U"\uCC08", U"\u110D\u1174\u11BF"},
+	{U"\uCC6C", U"\uCC6C", U"\u110E\u1163\u11B3", U"\uCC6C", U"\u110E\u1163\u11B3"},
+	{U"\uCCD0", U"\uCCD0", U"\u110E\u1167", U"\uCCD0", U"\u110E\u1167"},
+	{U"\uCD34", U"\uCD34", U"\u110E\u116A\u11B7", U"\uCD34", U"\u110E\u116A\u11B7"},
+	{U"\uCD98", U"\uCD98", U"\u110E\u116E\u11AB", U"\uCD98", U"\u110E\u116E\u11AB"},
+	{U"\uCDFC", U"\uCDFC", U"\u110E\u1171\u11BB", U"\uCDFC", U"\u110E\u1171\u11BB"},
+	{U"\uCE60", U"\uCE60", U"\u110E\u1175\u11AF", U"\uCE60", U"\u110E\u1175\u11AF"},
+	{U"\uCEC4", U"\uCEC4", U"\u110F\u1163\u11BF", U"\uCEC4", U"\u110F\u1163\u11BF"},
+	{U"\uCF28", U"\uCF28", U"\u110F\u1167\u11B3", U"\uCF28", U"\u110F\u1167\u11B3"},
+	{U"\uCF8C", U"\uCF8C", U"\u110F\u116B", U"\uCF8C", U"\u110F\u116B"},
+	{U"\uCFF0", U"\uCFF0", U"\u110F\u116E\u11B7", U"\uCFF0", U"\u110F\u116E\u11B7"},
+	{U"\uD054", U"\uD054", U"\u110F\u1172\u11AB", U"\uD054", U"\u110F\u1172\u11AB"},
+	{U"\uD0B8", U"\uD0B8", U"\u110F\u1175\u11BB", U"\uD0B8", U"\u110F\u1175\u11BB"},
+	{U"\uD11C", U"\uD11C", U"\u1110\u1164\u11AF", U"\uD11C", U"\u1110\u1164\u11AF"},
+	{U"\uD180", U"\uD180", U"\u1110\u1167\u11BF", U"\uD180", U"\u1110\u1167\u11BF"},
+	{U"\uD1E4", U"\uD1E4", U"\u1110\u116B\u11B3", U"\uD1E4", U"\u1110\u116B\u11B3"},
+	{U"\uD248", U"\uD248", U"\u1110\u116F", U"\uD248", U"\u1110\u116F"},
+	{U"\uD2AC", U"\uD2AC", U"\u1110\u1172\u11B7", U"\uD2AC", U"\u1110\u1172\u11B7"},
+	{U"\uD310", U"\uD310", U"\u1111\u1161\u11AB", U"\uD310", U"\u1111\u1161\u11AB"},
+	{U"\uD374", U"\uD374", U"\u1111\u1164\u11BB", U"\uD374", U"\u1111\u1164\u11BB"},
+	{U"\uD3D8", U"\uD3D8", U"\u1111\u1168\u11AF", U"\uD3D8", U"\u1111\u1168\u11AF"},
+	{U"\uD43C", U"\uD43C", U"\u1111\u116B\u11BF", U"\uD43C", U"\u1111\u116B\u11BF"},
+	{U"\uD4A0", U"\uD4A0", U"\u1111\u116F\u11B3", U"\uD4A0", U"\u1111\u116F\u11B3"},
+	{U"\uD504", U"\uD504", U"\u1111\u1173", U"\uD504", U"\u1111\u1173"},
+	{U"\uD568", U"\uD568", U"\u1112\u1161\u11B7", U"\uD568", U"\u1112\u1161\u11B7"},
+	{U"\uD5CC", U"\uD5CC", U"\u1112\u1165\u11AB", U"\uD5CC", U"\u1112\u1165\u11AB"},
+	{U"\uD630", U"\uD630", U"\u1112\u1168\u11BB", U"\uD630", U"\u1112\u1168\u11BB"},
+	{U"\uD694", U"\uD694", U"\u1112\u116C\u11AF", U"\uD694", U"\u1112\u116C\u11AF"},
+	{U"\uD6F8", U"\uD6F8", U"\u1112\u116F\u11BF", U"\uD6F8", U"\u1112\u116F\u11BF"},
+	{U"\uD75C", U"\uD75C", U"\u1112\u1173\u11B3", U"\uD75C", U"\u1112\u1173\u11B3"},
+	{U"\uF900", U"\u8C48", U"\u8C48", U"\u8C48", U"\u8C48"},
+	{U"\uF901", U"\u66F4", U"\u66F4", U"\u66F4", U"\u66F4"},
+	{U"\uF902", U"\u8ECA", U"\u8ECA", U"\u8ECA", U"\u8ECA"},
+	{U"\uF903", U"\u8CC8", U"\u8CC8", U"\u8CC8", U"\u8CC8"},
+	{U"\uF904", U"\u6ED1", U"\u6ED1", U"\u6ED1", U"\u6ED1"},
+	{U"\uF905", U"\u4E32", U"\u4E32", U"\u4E32", U"\u4E32"},
+	{U"\uF906", U"\u53E5", U"\u53E5", U"\u53E5", U"\u53E5"},
+	{U"\uF907", U"\u9F9C", U"\u9F9C", U"\u9F9C", U"\u9F9C"},
+	{U"\uF908", U"\u9F9C", U"\u9F9C", U"\u9F9C", U"\u9F9C"},
+	{U"\uF909", U"\u5951", U"\u5951", U"\u5951", U"\u5951"},
+	{U"\uF90A", U"\u91D1", U"\u91D1", U"\u91D1", U"\u91D1"},
+	{U"\uF90B", U"\u5587", U"\u5587", U"\u5587", U"\u5587"},
+	{U"\uF90C", U"\u5948", U"\u5948", U"\u5948", U"\u5948"},
+	{U"\uF90D", U"\u61F6", U"\u61F6", U"\u61F6", U"\u61F6"},
+	{U"\uF90E", U"\u7669", U"\u7669", U"\u7669", U"\u7669"},
+	{U"\uF90F", U"\u7F85", U"\u7F85", U"\u7F85", U"\u7F85"},
+	{U"\uF910", U"\u863F", U"\u863F", U"\u863F", U"\u863F"},
+	{U"\uF911", U"\u87BA", U"\u87BA", U"\u87BA", U"\u87BA"},
+	{U"\uF912", U"\u88F8", U"\u88F8", U"\u88F8", U"\u88F8"},
+	{U"\uF913", U"\u908F", U"\u908F", U"\u908F", U"\u908F"},
+	{U"\uF914", U"\u6A02", U"\u6A02", U"\u6A02", U"\u6A02"},
+	{U"\uF915", U"\u6D1B", U"\u6D1B", U"\u6D1B", U"\u6D1B"},
+	{U"\uF916", U"\u70D9", U"\u70D9", U"\u70D9", U"\u70D9"},
+	{U"\uF917", U"\u73DE", U"\u73DE", U"\u73DE", U"\u73DE"},
+	{U"\uF918", U"\u843D", U"\u843D", U"\u843D", U"\u843D"},
+	{U"\uF919", U"\u916A", U"\u916A", U"\u916A", U"\u916A"},
+	{U"\uF91A", U"\u99F1", U"\u99F1", U"\u99F1", U"\u99F1"},
+	{U"\uF91B", U"\u4E82", U"\u4E82", U"\u4E82", U"\u4E82"},
+	{U"\uF91C", U"\u5375", U"\u5375", U"\u5375", U"\u5375"},
+	{U"\uF91D", U"\u6B04", U"\u6B04", U"\u6B04", U"\u6B04"},
+	{U"\uF91E", U"\u721B", U"\u721B", U"\u721B", U"\u721B"},
+	{U"\uF91F", U"\u862D", U"\u862D", U"\u862D", U"\u862D"},
+	{U"\uF920", U"\u9E1E", U"\u9E1E", U"\u9E1E", U"\u9E1E"},
+	{U"\uF921", U"\u5D50", U"\u5D50", U"\u5D50", U"\u5D50"},
+	{U"\uF922", U"\u6FEB", U"\u6FEB", U"\u6FEB", U"\u6FEB"},
+	{U"\uF923", U"\u85CD", U"\u85CD", U"\u85CD", U"\u85CD"},
+	{U"\uF924", U"\u8964", U"\u8964", U"\u8964", U"\u8964"},
+	{U"\uF925", U"\u62C9", U"\u62C9", U"\u62C9", U"\u62C9"},
+	{U"\uF926", U"\u81D8", U"\u81D8", U"\u81D8", U"\u81D8"},
+	{U"\uF927", U"\u881F", U"\u881F", U"\u881F", U"\u881F"},
+	{U"\uF928", U"\u5ECA", U"\u5ECA", U"\u5ECA", U"\u5ECA"},
+	{U"\uF929", U"\u6717", U"\u6717", U"\u6717", U"\u6717"},
+	{U"\uF92A", U"\u6D6A", U"\u6D6A", U"\u6D6A", U"\u6D6A"},
+	{U"\uF92B", U"\u72FC", U"\u72FC", U"\u72FC", U"\u72FC"},
+	{U"\uF92C", U"\u90CE", U"\u90CE", U"\u90CE", U"\u90CE"},
+	{U"\uF92D", U"\u4F86", U"\u4F86", U"\u4F86", U"\u4F86"},
+	{U"\uF92E", U"\u51B7", U"\u51B7", U"\u51B7", U"\u51B7"},
+	{U"\uF92F", U"\u52DE", U"\u52DE", U"\u52DE", U"\u52DE"},
+	{U"\uF930", U"\u64C4", U"\u64C4", U"\u64C4", U"\u64C4"},
+	{U"\uF931", U"\u6AD3", U"\u6AD3", U"\u6AD3", U"\u6AD3"},
+	{U"\uF932", U"\u7210", U"\u7210", U"\u7210", U"\u7210"},
+	{U"\uF933", U"\u76E7", U"\u76E7", U"\u76E7", U"\u76E7"},
+	{U"\uF934", U"\u8001", U"\u8001", U"\u8001", U"\u8001"},
+	{U"\uF935", U"\u8606", U"\u8606", U"\u8606", U"\u8606"},
+	{U"\uF936", U"\u865C", U"\u865C", U"\u865C", U"\u865C"},
+	{U"\uF937", U"\u8DEF", U"\u8DEF", U"\u8DEF", U"\u8DEF"},
+	{U"\uF938", U"\u9732", U"\u9732", U"\u9732", U"\u9732"},
+	{U"\uF939", U"\u9B6F", U"\u9B6F", U"\u9B6F", U"\u9B6F"},
+	{U"\uF93A", U"\u9DFA", U"\u9DFA", U"\u9DFA", U"\u9DFA"},
+	{U"\uF93B", U"\u788C", U"\u788C", U"\u788C", U"\u788C"},
+	{U"\uF93C", U"\u797F", U"\u797F", U"\u797F", U"\u797F"},
+	{U"\uF93D", U"\u7DA0", U"\u7DA0", U"\u7DA0", U"\u7DA0"},
+	{U"\uF93E", U"\u83C9", U"\u83C9", U"\u83C9", U"\u83C9"},
+	{U"\uF93F", U"\u9304", U"\u9304", U"\u9304", U"\u9304"},
+	{U"\uF940", U"\u9E7F", U"\u9E7F", U"\u9E7F", U"\u9E7F"},
+	{U"\uF941", U"\u8AD6", U"\u8AD6", U"\u8AD6", U"\u8AD6"},
+	{U"\uF942", U"\u58DF", U"\u58DF", U"\u58DF", U"\u58DF"},
+	{U"\uF943", U"\u5F04", U"\u5F04", U"\u5F04", U"\u5F04"},
+	{U"\uF944", U"\u7C60", U"\u7C60", U"\u7C60", U"\u7C60"},
+	{U"\uF945", U"\u807E", U"\u807E", U"\u807E", U"\u807E"},
+	{U"\uF946", U"\u7262", U"\u7262", U"\u7262", U"\u7262"},
+	{U"\uF947", U"\u78CA", U"\u78CA", U"\u78CA", U"\u78CA"},
+	{U"\uF948", U"\u8CC2", U"\u8CC2", U"\u8CC2", U"\u8CC2"},
+	{U"\uF949", U"\u96F7", U"\u96F7", U"\u96F7", U"\u96F7"},
+	{U"\uF94A", U"\u58D8", U"\u58D8", U"\u58D8", U"\u58D8"},
+	{U"\uF94B", U"\u5C62", U"\u5C62", U"\u5C62", U"\u5C62"},
+	{U"\uF94C", U"\u6A13", U"\u6A13", U"\u6A13", U"\u6A13"},
+	{U"\uF94D", U"\u6DDA", U"\u6DDA", U"\u6DDA", U"\u6DDA"},
+	{U"\uF94E", U"\u6F0F", U"\u6F0F", U"\u6F0F", U"\u6F0F"},
+	{U"\uF94F", U"\u7D2F", U"\u7D2F", U"\u7D2F", U"\u7D2F"},
+	{U"\uF950", U"\u7E37", U"\u7E37", U"\u7E37", U"\u7E37"},
+	{U"\uF951", U"\u964B", U"\u964B", U"\u964B", U"\u964B"},
+	{U"\uF952", U"\u52D2", U"\u52D2", U"\u52D2", U"\u52D2"},
+	{U"\uF953", U"\u808B", U"\u808B", U"\u808B", U"\u808B"},
+	{U"\uF954", U"\u51DC", U"\u51DC", U"\u51DC", U"\u51DC"},
+	{U"\uF955", U"\u51CC", U"\u51CC", U"\u51CC", U"\u51CC"},
+	{U"\uF956", U"\u7A1C", U"\u7A1C", U"\u7A1C", U"\u7A1C"},
+	{U"\uF957", U"\u7DBE", U"\u7DBE", U"\u7DBE", U"\u7DBE"},
+	{U"\uF958", U"\u83F1", U"\u83F1", U"\u83F1", U"\u83F1"},
+	{U"\uF959", U"\u9675", U"\u9675", U"\u9675", U"\u9675"},
+	{U"\uF95A", U"\u8B80", U"\u8B80", U"\u8B80", U"\u8B80"},
+	{U"\uF95B", U"\u62CF", U"\u62CF", U"\u62CF", U"\u62CF"},
+	{U"\uF95C", U"\u6A02", U"\u6A02", U"\u6A02", U"\u6A02"},
+	{U"\uF95D", U"\u8AFE", U"\u8AFE", U"\u8AFE", U"\u8AFE"},
+	{U"\uF95E", U"\u4E39", U"\u4E39", U"\u4E39", U"\u4E39"},
+	{U"\uF95F", U"\u5BE7", U"\u5BE7", U"\u5BE7", U"\u5BE7"},
+	{U"\uF960", U"\u6012", U"\u6012", U"\u6012", U"\u6012"},
+	{U"\uF961", U"\u7387", U"\u7387", U"\u7387", U"\u7387"},
+	{U"\uF962", U"\u7570", U"\u7570", U"\u7570", U"\u7570"},
+	{U"\uF963", U"\u5317", U"\u5317", U"\u5317", U"\u5317"},
+	{U"\uF964", U"\u78FB", U"\u78FB", U"\u78FB", U"\u78FB"},
+	{U"\uF965", U"\u4FBF", U"\u4FBF", U"\u4FBF", U"\u4FBF"},
+	{U"\uF966", U"\u5FA9", U"\u5FA9", U"\u5FA9", U"\u5FA9"},
+	{U"\uF967", U"\u4E0D", U"\u4E0D", U"\u4E0D", U"\u4E0D"},
+	{U"\uF968", U"\u6CCC", U"\u6CCC", U"\u6CCC", U"\u6CCC"},
+	{U"\uF969", U"\u6578", U"\u6578", U"\u6578", U"\u6578"},
+	{U"\uF96A", U"\u7D22", U"\u7D22", U"\u7D22", U"\u7D22"},
+	{U"\uF96B", U"\u53C3", U"\u53C3", U"\u53C3", U"\u53C3"},
+	{U"\uF96C", U"\u585E", U"\u585E", U"\u585E", U"\u585E"},
+	{U"\uF96D", U"\u7701", U"\u7701", U"\u7701", U"\u7701"},
+	{U"\uF96E", U"\u8449", U"\u8449", U"\u8449", U"\u8449"},
+	{U"\uF96F", U"\u8AAA", U"\u8AAA", U"\u8AAA", U"\u8AAA"},
+	{U"\uF970", U"\u6BBA", U"\u6BBA", U"\u6BBA", U"\u6BBA"},
+	{U"\uF971", U"\u8FB0", U"\u8FB0", U"\u8FB0", U"\u8FB0"},
+	{U"\uF972", U"\u6C88", U"\u6C88", U"\u6C88", U"\u6C88"},
+	{U"\uF973", U"\u62FE", U"\u62FE", U"\u62FE", U"\u62FE"},
+	{U"\uF974", U"\u82E5", U"\u82E5", U"\u82E5", U"\u82E5"},
+	{U"\uF975", U"\u63A0", U"\u63A0", U"\u63A0", U"\u63A0"},
+	{U"\uF976", U"\u7565", U"\u7565", U"\u7565", U"\u7565"},
+	{U"\uF977", U"\u4EAE", U"\u4EAE", U"\u4EAE", U"\u4EAE"},
+	{U"\uF978", U"\u5169", U"\u5169", U"\u5169", U"\u5169"},
+	{U"\uF979", U"\u51C9", U"\u51C9", U"\u51C9", U"\u51C9"},
+	{U"\uF97A", U"\u6881", U"\u6881", U"\u6881", U"\u6881"},
+	{U"\uF97B", U"\u7CE7", U"\u7CE7", U"\u7CE7", U"\u7CE7"},
+	{U"\uF97C", U"\u826F", U"\u826F", U"\u826F", U"\u826F"},
+	{U"\uF97D", U"\u8AD2", U"\u8AD2", U"\u8AD2", U"\u8AD2"},
+	{U"\uF97E", U"\u91CF", U"\u91CF", U"\u91CF", U"\u91CF"},
+	{U"\uF97F", U"\u52F5", U"\u52F5", U"\u52F5", U"\u52F5"},
+	{U"\uF980", U"\u5442", U"\u5442", U"\u5442", U"\u5442"},
+	{U"\uF981", U"\u5973", U"\u5973", U"\u5973", U"\u5973"},
+	{U"\uF982", U"\u5EEC", U"\u5EEC", U"\u5EEC", U"\u5EEC"},
+	{U"\uF983", U"\u65C5", U"\u65C5", U"\u65C5", U"\u65C5"},
+	{U"\uF984", U"\u6FFE", U"\u6FFE", U"\u6FFE", U"\u6FFE"},
+	{U"\uF985", U"\u792A", U"\u792A", U"\u792A", U"\u792A"},
+	{U"\uF986", U"\u95AD", U"\u95AD", U"\u95AD", U"\u95AD"},
+	{U"\uF987", U"\u9A6A", U"\u9A6A", U"\u9A6A", U"\u9A6A"},
+	{U"\uF988", U"\u9E97", U"\u9E97", U"\u9E97", U"\u9E97"},
+	{U"\uF989", U"\u9ECE", U"\u9ECE", U"\u9ECE", U"\u9ECE"},
+	{U"\uF98A", U"\u529B", U"\u529B", U"\u529B", U"\u529B"},
+	{U"\uF98B", U"\u66C6", U"\u66C6", U"\u66C6", U"\u66C6"},
+	{U"\uF98C", U"\u6B77", U"\u6B77", U"\u6B77", U"\u6B77"},
+	{U"\uF98D", U"\u8F62", U"\u8F62", U"\u8F62", U"\u8F62"},
+	{U"\uF98E", U"\u5E74", U"\u5E74", U"\u5E74", U"\u5E74"},
+	{U"\uF98F", U"\u6190", U"\u6190", U"\u6190", U"\u6190"},
+	{U"\uF990", U"\u6200", U"\u6200", U"\u6200", U"\u6200"},
+	{U"\uF991", U"\u649A", U"\u649A", U"\u649A", U"\u649A"},
+	{U"\uF992", U"\u6F23", U"\u6F23", U"\u6F23", U"\u6F23"},
+	{U"\uF993", U"\u7149", U"\u7149", U"\u7149", U"\u7149"},
+	{U"\uF994", U"\u7489", U"\u7489", U"\u7489", U"\u7489"},
+	{U"\uF995", U"\u79CA", U"\u79CA", U"\u79CA", U"\u79CA"},
+	{U"\uF996", U"\u7DF4", U"\u7DF4", U"\u7DF4", U"\u7DF4"},
+	{U"\uF997", U"\u806F", U"\u806F", U"\u806F", U"\u806F"},
+	{U"\uF998", U"\u8F26", U"\u8F26", U"\u8F26", U"\u8F26"},
+	{U"\uF999", U"\u84EE", U"\u84EE", U"\u84EE", U"\u84EE"},
+	{U"\uF99A", U"\u9023", U"\u9023", U"\u9023", U"\u9023"},
+	{U"\uF99B", U"\u934A", U"\u934A", U"\u934A", U"\u934A"},
+	{U"\uF99C", U"\u5217", U"\u5217", U"\u5217", U"\u5217"},
+	{U"\uF99D", U"\u52A3", U"\u52A3", U"\u52A3", U"\u52A3"},
+	{U"\uF99E", U"\u54BD", U"\u54BD", U"\u54BD", U"\u54BD"},
+	{U"\uF99F", U"\u70C8", U"\u70C8", U"\u70C8", U"\u70C8"},
+	{U"\uF9A0", U"\u88C2", U"\u88C2", U"\u88C2", U"\u88C2"},
+	{U"\uF9A1", U"\u8AAA", U"\u8AAA", U"\u8AAA", U"\u8AAA"},
+	{U"\uF9A2", U"\u5EC9", U"\u5EC9", U"\u5EC9", U"\u5EC9"},
+	{U"\uF9A3", U"\u5FF5", U"\u5FF5", U"\u5FF5", U"\u5FF5"},
+	{U"\uF9A4", U"\u637B", U"\u637B", U"\u637B", U"\u637B"},
+	{U"\uF9A5", U"\u6BAE", U"\u6BAE", U"\u6BAE", U"\u6BAE"},
+	{U"\uF9A6", U"\u7C3E", U"\u7C3E", U"\u7C3E", U"\u7C3E"},
+	{U"\uF9A7", U"\u7375", U"\u7375", U"\u7375", U"\u7375"},
+	{U"\uF9A8", U"\u4EE4", U"\u4EE4", U"\u4EE4", U"\u4EE4"},
+	{U"\uF9A9", U"\u56F9", U"\u56F9", U"\u56F9", U"\u56F9"},
+	{U"\uF9AA", U"\u5BE7", U"\u5BE7", U"\u5BE7", U"\u5BE7"},
+	{U"\uF9AB", U"\u5DBA", U"\u5DBA", U"\u5DBA", U"\u5DBA"},
+	{U"\uF9AC", U"\u601C", U"\u601C", U"\u601C", U"\u601C"},
+	{U"\uF9AD", U"\u73B2", U"\u73B2", U"\u73B2", U"\u73B2"},
+	{U"\uF9AE", U"\u7469", U"\u7469", U"\u7469", U"\u7469"},
+	{U"\uF9AF", U"\u7F9A", U"\u7F9A", U"\u7F9A", U"\u7F9A"},
+	{U"\uF9B0", U"\u8046", U"\u8046", U"\u8046", U"\u8046"},
+	{U"\uF9B1", U"\u9234", U"\u9234", U"\u9234", U"\u9234"},
+	{U"\uF9B2", U"\u96F6", U"\u96F6", U"\u96F6", U"\u96F6"},
+	{U"\uF9B3", U"\u9748", U"\u9748", U"\u9748", U"\u9748"},
+	{U"\uF9B4", U"\u9818", U"\u9818", U"\u9818", U"\u9818"},
+	{U"\uF9B5", U"\u4F8B", U"\u4F8B", U"\u4F8B", U"\u4F8B"},
+	{U"\uF9B6", U"\u79AE", U"\u79AE", U"\u79AE", U"\u79AE"},
+	{U"\uF9B7", U"\u91B4", U"\u91B4", U"\u91B4", U"\u91B4"},
+	{U"\uF9B8", U"\u96B8", U"\u96B8", U"\u96B8", U"\u96B8"},
+	{U"\uF9B9", U"\u60E1", U"\u60E1", U"\u60E1", U"\u60E1"},
+	{U"\uF9BA", U"\u4E86", U"\u4E86", U"\u4E86", U"\u4E86"},
+	{U"\uF9BB", U"\u50DA", U"\u50DA", U"\u50DA", U"\u50DA"},
+	{U"\uF9BC", U"\u5BEE", U"\u5BEE", U"\u5BEE", U"\u5BEE"},
+	{U"\uF9BD", U"\u5C3F", U"\u5C3F", U"\u5C3F", U"\u5C3F"},
+	{U"\uF9BE", U"\u6599", U"\u6599", U"\u6599", U"\u6599"},
+	{U"\uF9BF", U"\u6A02", U"\u6A02", U"\u6A02", U"\u6A02"},
+	{U"\uF9C0", U"\u71CE", U"\u71CE", U"\u71CE", U"\u71CE"},
+	{U"\uF9C1", U"\u7642", U"\u7642", U"\u7642", U"\u7642"},
+	{U"\uF9C2", U"\u84FC", U"\u84FC", U"\u84FC", U"\u84FC"},
+	{U"\uF9C3", U"\u907C", U"\u907C", U"\u907C", U"\u907C"},
+	{U"\uF9C4", U"\u9F8D", U"\u9F8D", U"\u9F8D", U"\u9F8D"},
+	{U"\uF9C5", U"\u6688", U"\u6688", U"\u6688", U"\u6688"},
+	{U"\uF9C6", U"\u962E", U"\u962E", U"\u962E", U"\u962E"},
+	{U"\uF9C7", U"\u5289", U"\u5289", U"\u5289", U"\u5289"},
+	{U"\uF9C8", U"\u677B", U"\u677B", U"\u677B", U"\u677B"},
+	{U"\uF9C9", U"\u67F3", U"\u67F3", U"\u67F3", U"\u67F3"},
+	{U"\uF9CA", U"\u6D41", U"\u6D41", U"\u6D41", U"\u6D41"},
+	{U"\uF9CB", U"\u6E9C", U"\u6E9C", U"\u6E9C", U"\u6E9C"},
+	{U"\uF9CC", U"\u7409", U"\u7409", U"\u7409", U"\u7409"},
+	{U"\uF9CD", U"\u7559", U"\u7559", U"\u7559", U"\u7559"},
+	{U"\uF9CE", U"\u786B", U"\u786B", U"\u786B", U"\u786B"},
+	{U"\uF9CF", U"\u7D10", U"\u7D10", U"\u7D10", U"\u7D10"},
+	{U"\uF9D0", U"\u985E", U"\u985E", U"\u985E", U"\u985E"},
+	{U"\uF9D1", U"\u516D", U"\u516D", U"\u516D", U"\u516D"},
+	{U"\uF9D2", U"\u622E", U"\u622E", U"\u622E", U"\u622E"},
+	{U"\uF9D3", U"\u9678", U"\u9678", U"\u9678", U"\u9678"},
+	{U"\uF9D4", U"\u502B", U"\u502B", U"\u502B", U"\u502B"},
+	{U"\uF9D5", U"\u5D19", U"\u5D19", U"\u5D19", U"\u5D19"},
+	{U"\uF9D6", U"\u6DEA", U"\u6DEA", U"\u6DEA", U"\u6DEA"},
+	{U"\uF9D7", U"\u8F2A", U"\u8F2A", U"\u8F2A", U"\u8F2A"},
+	{U"\uF9D8", U"\u5F8B", U"\u5F8B", U"\u5F8B", U"\u5F8B"},
+	{U"\uF9D9", U"\u6144", U"\u6144", U"\u6144", U"\u6144"},
+	{U"\uF9DA", U"\u6817", U"\u6817", U"\u6817", U"\u6817"},
+	{U"\uF9DB", U"\u7387", U"\u7387", U"\u7387", U"\u7387"},
+	{U"\uF9DC", U"\u9686", U"\u9686", U"\u9686", U"\u9686"},
+	{U"\uF9DD", U"\u5229", U"\u5229", U"\u5229", U"\u5229"},
+	{U"\uF9DE", U"\u540F", U"\u540F", U"\u540F", U"\u540F"},
+	{U"\uF9DF", U"\u5C65", U"\u5C65", U"\u5C65", U"\u5C65"},
+	{U"\uF9E0", U"\u6613", U"\u6613", U"\u6613", U"\u6613"},
+	{U"\uF9E1", U"\u674E", U"\u674E", U"\u674E", U"\u674E"},
+	{U"\uF9E2", U"\u68A8", U"\u68A8", U"\u68A8", U"\u68A8"},
+	{U"\uF9E3", U"\u6CE5", U"\u6CE5", U"\u6CE5", U"\u6CE5"},
+	{U"\uF9E4", U"\u7406", U"\u7406", U"\u7406", U"\u7406"},
+	{U"\uF9E5", U"\u75E2", U"\u75E2", U"\u75E2", U"\u75E2"},
+	{U"\uF9E6", U"\u7F79", U"\u7F79", U"\u7F79", U"\u7F79"},
+	{U"\uF9E7", U"\u88CF", U"\u88CF", U"\u88CF", U"\u88CF"},
+	{U"\uF9E8", U"\u88E1", U"\u88E1", U"\u88E1", U"\u88E1"},
+	{U"\uF9E9", U"\u91CC", U"\u91CC", U"\u91CC", U"\u91CC"},
+	{U"\uF9EA", U"\u96E2", U"\u96E2", U"\u96E2", U"\u96E2"},
+	{U"\uF9EB", U"\u533F", U"\u533F", U"\u533F", U"\u533F"},
+	{U"\uF9EC", U"\u6EBA", U"\u6EBA", U"\u6EBA", U"\u6EBA"},
+	{U"\uF9ED", U"\u541D", U"\u541D", U"\u541D", U"\u541D"},
+	{U"\uF9EE", U"\u71D0", U"\u71D0", U"\u71D0", U"\u71D0"},
+	{U"\uF9EF", U"\u7498", U"\u7498", U"\u7498", U"\u7498"},
+	{U"\uF9F0", U"\u85FA", U"\u85FA", U"\u85FA", U"\u85FA"},
+	{U"\uF9F1", U"\u96A3", U"\u96A3", U"\u96A3", U"\u96A3"},
+	{U"\uF9F2", U"\u9C57", U"\u9C57", U"\u9C57", U"\u9C57"},
+	{U"\uF9F3", U"\u9E9F", U"\u9E9F", U"\u9E9F", U"\u9E9F"},
+	{U"\uF9F4", U"\u6797", U"\u6797", U"\u6797", U"\u6797"},
+	{U"\uF9F5", U"\u6DCB", U"\u6DCB", U"\u6DCB", U"\u6DCB"},
+	{U"\uF9F6", U"\u81E8", U"\u81E8", U"\u81E8", U"\u81E8"},
+	{U"\uF9F7", U"\u7ACB", U"\u7ACB", U"\u7ACB", U"\u7ACB"},
+	{U"\uF9F8", U"\u7B20", U"\u7B20", U"\u7B20", U"\u7B20"},
+	{U"\uF9F9", U"\u7C92", U"\u7C92", U"\u7C92", U"\u7C92"},
+	{U"\uF9FA", U"\u72C0", U"\u72C0", U"\u72C0", U"\u72C0"},
+	{U"\uF9FB", U"\u7099", U"\u7099", U"\u7099", U"\u7099"},
+	{U"\uF9FC", U"\u8B58", U"\u8B58", U"\u8B58", U"\u8B58"},
+	{U"\uF9FD", U"\u4EC0", U"\u4EC0", U"\u4EC0", U"\u4EC0"},
+	{U"\uF9FE", U"\u8336", U"\u8336", U"\u8336", U"\u8336"},
+	{U"\uF9FF", U"\u523A", U"\u523A", U"\u523A", U"\u523A"},
+	{U"\uFA00", U"\u5207", U"\u5207", U"\u5207", U"\u5207"},
+	{U"\uFA01", U"\u5EA6", U"\u5EA6", U"\u5EA6", U"\u5EA6"},
+	{U"\uFA02", U"\u62D3", U"\u62D3", U"\u62D3", U"\u62D3"},
+	{U"\uFA03", U"\u7CD6", U"\u7CD6", U"\u7CD6", U"\u7CD6"},
+	{U"\uFA04", U"\u5B85", U"\u5B85", U"\u5B85", U"\u5B85"},
+	{U"\uFA05", U"\u6D1E", U"\u6D1E", U"\u6D1E", U"\u6D1E"},
+	{U"\uFA06", U"\u66B4", U"\u66B4", U"\u66B4", U"\u66B4"},
+	{U"\uFA07", U"\u8F3B", U"\u8F3B", U"\u8F3B", U"\u8F3B"},
+	{U"\uFA08", U"\u884C", U"\u884C", U"\u884C", U"\u884C"},
+	{U"\uFA09", U"\u964D", U"\u964D", U"\u964D", U"\u964D"},
+	{U"\uFA0A", U"\u898B", U"\u898B", U"\u898B", U"\u898B"},
+	{U"\uFA0B", U"\u5ED3", U"\u5ED3", U"\u5ED3", U"\u5ED3"},
+	{U"\uFA0C", U"\u5140", U"\u5140", U"\u5140", U"\u5140"},
+	{U"\uFA0D", U"\u55C0", U"\u55C0", U"\u55C0", U"\u55C0"},
+	{U"\uFA10", U"\u585A", U"\u585A", U"\u585A", U"\u585A"},
+	{U"\uFA12", U"\u6674", U"\u6674", U"\u6674", U"\u6674"},
+	{U"\uFA15", U"\u51DE", U"\u51DE", U"\u51DE", U"\u51DE"},
+	{U"\uFA16", U"\u732A", U"\u732A", U"\u732A", U"\u732A"},
+	{U"\uFA17", U"\u76CA", U"\u76CA", U"\u76CA", U"\u76CA"},
+	{U"\uFA18", U"\u793C", U"\u793C", U"\u793C", U"\u793C"},
+	{U"\uFA19", U"\u795E", U"\u795E", U"\u795E", U"\u795E"},
+	{U"\uFA1A", U"\u7965", U"\u7965", U"\u7965", U"\u7965"},
+	{U"\uFA1B", U"\u798F", U"\u798F", U"\u798F", U"\u798F"},
+	{U"\uFA1C", U"\u9756", U"\u9756", U"\u9756", U"\u9756"},
+	{U"\uFA1D", U"\u7CBE", U"\u7CBE", U"\u7CBE", U"\u7CBE"},
+	{U"\uFA1E", U"\u7FBD", U"\u7FBD", U"\u7FBD", U"\u7FBD"},
+	{U"\uFA20", U"\u8612", U"\u8612", U"\u8612", U"\u8612"},
+	{U"\uFA22", U"\u8AF8", U"\u8AF8", U"\u8AF8", U"\u8AF8"},
+	{U"\uFA25", U"\u9038", U"\u9038", U"\u9038", U"\u9038"},
+	{U"\uFA26", U"\u90FD", U"\u90FD", U"\u90FD", U"\u90FD"},
+	{U"\uFA2A", U"\u98EF", U"\u98EF", U"\u98EF", U"\u98EF"},
+	{U"\uFA2B", U"\u98FC", U"\u98FC", U"\u98FC", U"\u98FC"},
+	{U"\uFA2C", U"\u9928", U"\u9928", U"\u9928", U"\u9928"},
+	{U"\uFA2D", U"\u9DB4", U"\u9DB4", U"\u9DB4", U"\u9DB4"},
+	{U"\uFA2E", U"\u90DE", U"\u90DE", U"\u90DE", U"\u90DE"},
+	{U"\uFA2F", U"\u96B7", U"\u96B7", U"\u96B7", U"\u96B7"},
+	{U"\uFA30", U"\u4FAE", U"\u4FAE", U"\u4FAE", U"\u4FAE"},
+	{U"\uFA31", U"\u50E7", U"\u50E7", U"\u50E7", U"\u50E7"},
+	{U"\uFA32", U"\u514D", U"\u514D", U"\u514D", U"\u514D"},
+	{U"\uFA33", U"\u52C9", U"\u52C9", U"\u52C9", U"\u52C9"},
+	{U"\uFA34", U"\u52E4", U"\u52E4", U"\u52E4", U"\u52E4"},
+	{U"\uFA35", U"\u5351", U"\u5351", U"\u5351", U"\u5351"},
+	{U"\uFA36", U"\u559D", U"\u559D", U"\u559D", U"\u559D"},
+	{U"\uFA37", U"\u5606", U"\u5606", U"\u5606", U"\u5606"},
+	{U"\uFA38", U"\u5668", U"\u5668", U"\u5668", U"\u5668"},
+	{U"\uFA39", U"\u5840", U"\u5840", U"\u5840", U"\u5840"},
+	{U"\uFA3A", U"\u58A8", U"\u58A8", U"\u58A8", U"\u58A8"},
+	{U"\uFA3B", U"\u5C64", U"\u5C64", U"\u5C64", U"\u5C64"},
+	{U"\uFA3C", U"\u5C6E", U"\u5C6E", U"\u5C6E", U"\u5C6E"},
+	{U"\uFA3D", U"\u6094", U"\u6094", U"\u6094", U"\u6094"},
+	{U"\uFA3E", U"\u6168", U"\u6168", U"\u6168", U"\u6168"},
+	{U"\uFA3F", U"\u618E", U"\u618E", U"\u618E", U"\u618E"},
+	{U"\uFA40", U"\u61F2", U"\u61F2", U"\u61F2", U"\u61F2"},
+	{U"\uFA41", U"\u654F", U"\u654F", U"\u654F", U"\u654F"},
+	{U"\uFA42", U"\u65E2", U"\u65E2", U"\u65E2", U"\u65E2"},
+	{U"\uFA43", U"\u6691", U"\u6691", U"\u6691", U"\u6691"},
+	{U"\uFA44", U"\u6885", U"\u6885", U"\u6885", U"\u6885"},
+	{U"\uFA45", U"\u6D77", U"\u6D77", U"\u6D77", U"\u6D77"},
+	{U"\uFA46", U"\u6E1A", U"\u6E1A", U"\u6E1A", U"\u6E1A"},
+	{U"\uFA47", U"\u6F22", U"\u6F22", U"\u6F22", U"\u6F22"},
+	{U"\uFA48", U"\u716E", U"\u716E", U"\u716E", U"\u716E"},
+	{U"\uFA49", U"\u722B", U"\u722B", U"\u722B", U"\u722B"},
+	{U"\uFA4A", U"\u7422", U"\u7422", U"\u7422", U"\u7422"},
+	{U"\uFA4B", U"\u7891", U"\u7891", U"\u7891", U"\u7891"},
+	{U"\uFA4C", U"\u793E", U"\u793E", U"\u793E", U"\u793E"},
+	{U"\uFA4D", U"\u7949", U"\u7949", U"\u7949", U"\u7949"},
+	{U"\uFA4E", U"\u7948", U"\u7948", U"\u7948", U"\u7948"},
+	{U"\uFA4F", U"\u7950", U"\u7950", U"\u7950", U"\u7950"},
+	{U"\uFA50", U"\u7956", U"\u7956", U"\u7956", U"\u7956"},
+	{U"\uFA51", U"\u795D", U"\u795D", U"\u795D", U"\u795D"},
+	{U"\uFA52", U"\u798D", U"\u798D", U"\u798D", U"\u798D"},
+	{U"\uFA53", U"\u798E", U"\u798E", U"\u798E", U"\u798E"},
+	{U"\uFA54", U"\u7A40", U"\u7A40", U"\u7A40", U"\u7A40"},
+	{U"\uFA55", U"\u7A81", U"\u7A81", U"\u7A81", U"\u7A81"},
+	{U"\uFA56", U"\u7BC0", U"\u7BC0", U"\u7BC0", U"\u7BC0"},
+	{U"\uFA57", U"\u7DF4", U"\u7DF4", U"\u7DF4", U"\u7DF4"},
+	{U"\uFA58", U"\u7E09", U"\u7E09", U"\u7E09", U"\u7E09"},
+	{U"\uFA59", U"\u7E41", U"\u7E41", U"\u7E41", U"\u7E41"},
+	{U"\uFA5A", U"\u7F72", U"\u7F72", U"\u7F72", U"\u7F72"},
+	{U"\uFA5B", U"\u8005", U"\u8005", U"\u8005", U"\u8005"},
+	{U"\uFA5C", U"\u81ED", U"\u81ED", U"\u81ED", U"\u81ED"},
+	{U"\uFA5D", U"\u8279", U"\u8279", U"\u8279", U"\u8279"},
+	{U"\uFA5E", U"\u8279", U"\u8279", U"\u8279", U"\u8279"},
+	{U"\uFA5F", U"\u8457", U"\u8457", U"\u8457", U"\u8457"},
+	{U"\uFA60", U"\u8910", U"\u8910", U"\u8910", U"\u8910"},
+	{U"\uFA61", U"\u8996", U"\u8996", U"\u8996", U"\u8996"},
+	{U"\uFA62", U"\u8B01", U"\u8B01", U"\u8B01", U"\u8B01"},
+	{U"\uFA63", U"\u8B39", U"\u8B39", U"\u8B39", U"\u8B39"},
+	{U"\uFA64", U"\u8CD3", U"\u8CD3", U"\u8CD3", U"\u8CD3"},
+	{U"\uFA65", U"\u8D08", U"\u8D08", U"\u8D08", U"\u8D08"},
+	{U"\uFA66", U"\u8FB6", U"\u8FB6", U"\u8FB6", U"\u8FB6"},
+	{U"\uFA67", U"\u9038", U"\u9038", U"\u9038", U"\u9038"},
+	{U"\uFA68", U"\u96E3", U"\u96E3", U"\u96E3", U"\u96E3"},
+	{U"\uFA69", U"\u97FF", U"\u97FF", U"\u97FF", U"\u97FF"},
+	{U"\uFA6A", U"\u983B", U"\u983B", U"\u983B", U"\u983B"},
+	{U"\uFA6B", U"\u6075", U"\u6075", U"\u6075", U"\u6075"},
+	{U"\uFA6C", U"\U000242EE", U"\U000242EE", U"\U000242EE", U"\U000242EE"},
+	{U"\uFA6D", U"\u8218", U"\u8218", U"\u8218", U"\u8218"},
+	{U"\uFA70", U"\u4E26", U"\u4E26", U"\u4E26", U"\u4E26"},
+	{U"\uFA71", U"\u51B5", U"\u51B5", U"\u51B5", U"\u51B5"},
+	{U"\uFA72", U"\u5168", U"\u5168", U"\u5168", U"\u5168"},
+	{U"\uFA73", U"\u4F80", U"\u4F80", U"\u4F80", U"\u4F80"},
+	{U"\uFA74", U"\u5145", U"\u5145", U"\u5145", U"\u5145"},
+	{U"\uFA75", U"\u5180", U"\u5180", U"\u5180", U"\u5180"},
+	{U"\uFA76", U"\u52C7", U"\u52C7", U"\u52C7", U"\u52C7"},
+	{U"\uFA77", U"\u52FA", U"\u52FA", U"\u52FA", U"\u52FA"},
+	{U"\uFA78", U"\u559D", U"\u559D", U"\u559D", U"\u559D"},
+	{U"\uFA79", U"\u5555", U"\u5555", U"\u5555", U"\u5555"},
+	{U"\uFA7A", U"\u5599", U"\u5599", U"\u5599", U"\u5599"},
+	{U"\uFA7B", U"\u55E2", U"\u55E2", U"\u55E2", U"\u55E2"},
+	{U"\uFA7C", U"\u585A", U"\u585A", U"\u585A", U"\u585A"},
+	{U"\uFA7D", U"\u58B3", U"\u58B3", U"\u58B3", U"\u58B3"},
+	{U"\uFA7E", U"\u5944", U"\u5944", U"\u5944", U"\u5944"},
+	{U"\uFA7F", U"\u5954", U"\u5954", U"\u5954", U"\u5954"},
+	{U"\uFA80", U"\u5A62", U"\u5A62", U"\u5A62", U"\u5A62"},
+	{U"\uFA81", U"\u5B28", U"\u5B28", U"\u5B28", U"\u5B28"},
+	{U"\uFA82", U"\u5ED2", U"\u5ED2", U"\u5ED2", U"\u5ED2"},
+	{U"\uFA83", U"\u5ED9", U"\u5ED9", U"\u5ED9", U"\u5ED9"},
+	{U"\uFA84", U"\u5F69", U"\u5F69", U"\u5F69", U"\u5F69"},
+	{U"\uFA85", U"\u5FAD", U"\u5FAD", U"\u5FAD", U"\u5FAD"},
+	{U"\uFA86", U"\u60D8", U"\u60D8", U"\u60D8", U"\u60D8"},
+	{U"\uFA87", U"\u614E", U"\u614E", U"\u614E", U"\u614E"},
+	{U"\uFA88", U"\u6108", U"\u6108", U"\u6108", U"\u6108"},
+	{U"\uFA89", U"\u618E", U"\u618E", U"\u618E", U"\u618E"},
+	{U"\uFA8A", U"\u6160", U"\u6160", U"\u6160", U"\u6160"},
+	{U"\uFA8B", U"\u61F2", U"\u61F2", U"\u61F2", U"\u61F2"},
+	{U"\uFA8C", U"\u6234", U"\u6234", U"\u6234", U"\u6234"},
+	{U"\uFA8D", U"\u63C4", U"\u63C4", U"\u63C4", U"\u63C4"},
+	{U"\uFA8E", U"\u641C", U"\u641C", U"\u641C", U"\u641C"},
+	{U"\uFA8F", U"\u6452", U"\u6452", U"\u6452", U"\u6452"},
+	{U"\uFA90", U"\u6556", U"\u6556", U"\u6556", U"\u6556"},
+	{U"\uFA91", U"\u6674", U"\u6674", U"\u6674", U"\u6674"},
+	{U"\uFA92", U"\u6717", U"\u6717", U"\u6717", U"\u6717"},
+	{U"\uFA93", U"\u671B", U"\u671B", U"\u671B", U"\u671B"},
+	{U"\uFA94", U"\u6756", U"\u6756", U"\u6756", U"\u6756"},
+	{U"\uFA95", U"\u6B79", U"\u6B79", U"\u6B79", U"\u6B79"},
+	{U"\uFA96", U"\u6BBA", U"\u6BBA", U"\u6BBA", U"\u6BBA"},
+	{U"\uFA97", U"\u6D41", U"\u6D41", U"\u6D41", U"\u6D41"},
+	{U"\uFA98", U"\u6EDB", U"\u6EDB", U"\u6EDB", U"\u6EDB"},
+	{U"\uFA99", U"\u6ECB", U"\u6ECB", U"\u6ECB", U"\u6ECB"},
+	{U"\uFA9A", U"\u6F22", U"\u6F22", U"\u6F22", U"\u6F22"},
+	{U"\uFA9B", U"\u701E", U"\u701E", U"\u701E", U"\u701E"},
+	{U"\uFA9C", U"\u716E", U"\u716E", U"\u716E", U"\u716E"},
+	{U"\uFA9D", U"\u77A7", U"\u77A7", U"\u77A7", U"\u77A7"},
+	{U"\uFA9E", U"\u7235", U"\u7235", U"\u7235", U"\u7235"},
+	{U"\uFA9F", U"\u72AF", U"\u72AF", U"\u72AF", U"\u72AF"},
+	{U"\uFAA0", U"\u732A", U"\u732A", U"\u732A", U"\u732A"},
+	{U"\uFAA1", U"\u7471", U"\u7471", U"\u7471", U"\u7471"},
+	{U"\uFAA2", U"\u7506", U"\u7506", U"\u7506", U"\u7506"},
+	{U"\uFAA3", U"\u753B", U"\u753B", U"\u753B", U"\u753B"},
+	{U"\uFAA4", U"\u761D", U"\u761D", U"\u761D", U"\u761D"},
+	{U"\uFAA5", U"\u761F", U"\u761F", U"\u761F", U"\u761F"},
+	{U"\uFAA6", U"\u76CA", U"\u76CA", U"\u76CA", U"\u76CA"},
+	{U"\uFAA7", U"\u76DB", U"\u76DB", U"\u76DB", U"\u76DB"},
+	{U"\uFAA8", U"\u76F4", U"\u76F4", U"\u76F4", U"\u76F4"},
+	{U"\uFAA9", U"\u774A", U"\u774A", U"\u774A", U"\u774A"},
+	{U"\uFAAA", U"\u7740", U"\u7740", U"\u7740", U"\u7740"},
+	{U"\uFAAB", U"\u78CC", U"\u78CC", U"\u78CC", U"\u78CC"},
+	{U"\uFAAC", U"\u7AB1", U"\u7AB1", U"\u7AB1", U"\u7AB1"},
+	{U"\uFAAD", U"\u7BC0", U"\u7BC0", U"\u7BC0", U"\u7BC0"},
+	{U"\uFAAE", U"\u7C7B", U"\u7C7B", U"\u7C7B", U"\u7C7B"},
+	{U"\uFAAF", U"\u7D5B", U"\u7D5B", U"\u7D5B", U"\u7D5B"},
+	{U"\uFAB0", U"\u7DF4", U"\u7DF4", U"\u7DF4", U"\u7DF4"},
+	{U"\uFAB1", U"\u7F3E", U"\u7F3E", U"\u7F3E", U"\u7F3E"},
+	{U"\uFAB2", U"\u8005", U"\u8005", U"\u8005", U"\u8005"},
+	{U"\uFAB3", U"\u8352", U"\u8352", U"\u8352", U"\u8352"},
+	{U"\uFAB4", U"\u83EF", U"\u83EF", U"\u83EF", U"\u83EF"},
+	{U"\uFAB5", U"\u8779", U"\u8779", U"\u8779", U"\u8779"},
+	{U"\uFAB6", U"\u8941", U"\u8941", U"\u8941", U"\u8941"},
+	{U"\uFAB7", U"\u8986", U"\u8986", U"\u8986", U"\u8986"},
+	{U"\uFAB8", U"\u8996", U"\u8996", U"\u8996", U"\u8996"},
+	{U"\uFAB9", U"\u8ABF", U"\u8ABF", U"\u8ABF", U"\u8ABF"},
+	{U"\uFABA", U"\u8AF8", U"\u8AF8", U"\u8AF8", U"\u8AF8"},
+	{U"\uFABB", U"\u8ACB", U"\u8ACB", U"\u8ACB", U"\u8ACB"},
+	{U"\uFABC", U"\u8B01", U"\u8B01", U"\u8B01", U"\u8B01"},
+	{U"\uFABD", U"\u8AFE", U"\u8AFE", U"\u8AFE", U"\u8AFE"},
+	{U"\uFABE", U"\u8AED", U"\u8AED", U"\u8AED", U"\u8AED"},
+	{U"\uFABF", U"\u8B39", U"\u8B39", U"\u8B39", U"\u8B39"},
+	{U"\uFAC0", U"\u8B8A", U"\u8B8A", U"\u8B8A", U"\u8B8A"},
+	{U"\uFAC1", U"\u8D08", U"\u8D08", U"\u8D08", U"\u8D08"},
+	{U"\uFAC2", U"\u8F38", U"\u8F38", U"\u8F38", U"\u8F38"},
+	{U"\uFAC3", U"\u9072", U"\u9072", U"\u9072", U"\u9072"},
+	{U"\uFAC4", U"\u9199", U"\u9199", U"\u9199", U"\u9199"},
+	{U"\uFAC5", U"\u9276", U"\u9276", U"\u9276", U"\u9276"},
+	{U"\uFAC6", U"\u967C", U"\u967C", U"\u967C", U"\u967C"},
+	{U"\uFAC7", U"\u96E3", U"\u96E3", U"\u96E3", U"\u96E3"},
+	{U"\uFAC8", U"\u9756", U"\u9756", U"\u9756", U"\u9756"},
+	{U"\uFAC9", U"\u97DB", U"\u97DB", U"\u97DB", U"\u97DB"},
+	{U"\uFACA", U"\u97FF", U"\u97FF", U"\u97FF", U"\u97FF"},
+	{U"\uFACB", U"\u980B", U"\u980B", U"\u980B", U"\u980B"},
+	{U"\uFACC", U"\u983B", U"\u983B", U"\u983B", U"\u983B"},
+	{U"\uFACD", U"\u9B12", U"\u9B12", U"\u9B12", U"\u9B12"},
+	{U"\uFACE", U"\u9F9C", U"\u9F9C", U"\u9F9C", U"\u9F9C"},
+	{U"\uFACF", U"\U0002284A", U"\U0002284A", U"\U0002284A", U"\U0002284A"},
+	{U"\uFAD0", U"\U00022844", U"\U00022844", U"\U00022844", U"\U00022844"},
+	{U"\uFAD1", U"\U000233D5", U"\U000233D5", U"\U000233D5", U"\U000233D5"},
+	{U"\uFAD2", U"\u3B9D", U"\u3B9D", U"\u3B9D", U"\u3B9D"},
+	{U"\uFAD3", U"\u4018", U"\u4018", U"\u4018", U"\u4018"},
+	{U"\uFAD4", U"\u4039", U"\u4039", U"\u4039", U"\u4039"},
+	{U"\uFAD5", U"\U00025249", U"\U00025249", U"\U00025249", U"\U00025249"},
+	{U"\uFAD6", U"\U00025CD0", U"\U00025CD0", U"\U00025CD0", U"\U00025CD0"},
+	{U"\uFAD7", U"\U00027ED3", U"\U00027ED3", U"\U00027ED3", U"\U00027ED3"},
+	{U"\uFAD8", U"\u9F43", U"\u9F43", U"\u9F43", U"\u9F43"},
+	{U"\uFAD9", U"\u9F8E", U"\u9F8E", U"\u9F8E", U"\u9F8E"},
+	{U"\uFB00", U"\uFB00", U"\uFB00", U"ff", U"ff"},
+	{U"\uFB01", U"\uFB01", U"\uFB01", U"fi", U"fi"},
+	{U"\uFB02", U"\uFB02", U"\uFB02", U"fl", U"fl"},
+	{U"\uFB03", U"\uFB03", U"\uFB03", U"ffi", U"ffi"},
+	{U"\uFB04", U"\uFB04", U"\uFB04", U"ffl", U"ffl"},
+	{U"\uFB05", U"\uFB05", U"\uFB05", U"st", U"st"},
+	{U"\uFB06", U"\uFB06", U"\uFB06", U"st", U"st"},
+	{U"\uFB13", U"\uFB13", U"\uFB13", U"\u0574\u0576", U"\u0574\u0576"},
+	{U"\uFB14", U"\uFB14", U"\uFB14", U"\u0574\u0565", U"\u0574\u0565"},
+	{U"\uFB15", U"\uFB15", U"\uFB15", U"\u0574\u056B", U"\u0574\u056B"},
+	{U"\uFB16", U"\uFB16", U"\uFB16", U"\u057E\u0576", U"\u057E\u0576"},
+	{U"\uFB17", U"\uFB17", U"\uFB17", U"\u0574\u056D", U"\u0574\u056D"},
+	{U"\uFB1D", U"\u05D9\u05B4", U"\u05D9\u05B4", U"\u05D9\u05B4", U"\u05D9\u05B4"},
+	{U"\uFB1F", U"\u05F2\u05B7", U"\u05F2\u05B7", U"\u05F2\u05B7", U"\u05F2\u05B7"},
+	{U"\uFB20", U"\uFB20", U"\uFB20", U"\u05E2", U"\u05E2"},
+	{U"\uFB21", U"\uFB21", U"\uFB21", U"\u05D0", U"\u05D0"},
+	{U"\uFB22", U"\uFB22", U"\uFB22", U"\u05D3", U"\u05D3"},
+	{U"\uFB23", U"\uFB23", U"\uFB23", U"\u05D4", U"\u05D4"},
+	{U"\uFB24", U"\uFB24", U"\uFB24", U"\u05DB", U"\u05DB"},
+	{U"\uFB25", U"\uFB25", U"\uFB25", U"\u05DC", U"\u05DC"},
+	{U"\uFB26", U"\uFB26", U"\uFB26", U"\u05DD", U"\u05DD"},
+	{U"\uFB27", U"\uFB27", U"\uFB27", U"\u05E8", U"\u05E8"},
+	{U"\uFB28", U"\uFB28", U"\uFB28", U"\u05EA", U"\u05EA"},
+	{U"\uFB29", U"\uFB29", U"\uFB29", U"+", U"+"},
+	{U"\uFB2A", U"\u05E9\u05C1", U"\u05E9\u05C1", U"\u05E9\u05C1", U"\u05E9\u05C1"},
+	{U"\uFB2B", U"\u05E9\u05C2", U"\u05E9\u05C2", U"\u05E9\u05C2", U"\u05E9\u05C2"},
+	{U"\uFB2C", U"\u05E9\u05BC\u05C1", U"\u05E9\u05BC\u05C1", U"\u05E9\u05BC\u05C1", U"\u05E9\u05BC\u05C1"},
+	{U"\uFB2D", U"\u05E9\u05BC\u05C2", U"\u05E9\u05BC\u05C2", U"\u05E9\u05BC\u05C2", U"\u05E9\u05BC\u05C2"},
+	{U"\uFB2E", U"\u05D0\u05B7", U"\u05D0\u05B7", U"\u05D0\u05B7", U"\u05D0\u05B7"},
+	{U"\uFB2F", U"\u05D0\u05B8", U"\u05D0\u05B8", U"\u05D0\u05B8", U"\u05D0\u05B8"},
+	{U"\uFB30", U"\u05D0\u05BC", U"\u05D0\u05BC", U"\u05D0\u05BC", U"\u05D0\u05BC"},
+	{U"\uFB31", U"\u05D1\u05BC", U"\u05D1\u05BC", U"\u05D1\u05BC", U"\u05D1\u05BC"},
+	{U"\uFB32", U"\u05D2\u05BC", U"\u05D2\u05BC", U"\u05D2\u05BC", U"\u05D2\u05BC"},
+	{U"\uFB33", U"\u05D3\u05BC", U"\u05D3\u05BC", U"\u05D3\u05BC", U"\u05D3\u05BC"},
+	{U"\uFB34", U"\u05D4\u05BC", U"\u05D4\u05BC", U"\u05D4\u05BC", U"\u05D4\u05BC"},
+	{U"\uFB35", U"\u05D5\u05BC", U"\u05D5\u05BC", U"\u05D5\u05BC", U"\u05D5\u05BC"},
+	{U"\uFB36", U"\u05D6\u05BC", U"\u05D6\u05BC", U"\u05D6\u05BC", U"\u05D6\u05BC"},
+	{U"\uFB38", U"\u05D8\u05BC", U"\u05D8\u05BC", U"\u05D8\u05BC", U"\u05D8\u05BC"},
+	{U"\uFB39", U"\u05D9\u05BC", U"\u05D9\u05BC", U"\u05D9\u05BC", U"\u05D9\u05BC"},
+	{U"\uFB3A", U"\u05DA\u05BC", U"\u05DA\u05BC", U"\u05DA\u05BC", U"\u05DA\u05BC"},
+	{U"\uFB3B", U"\u05DB\u05BC", U"\u05DB\u05BC", U"\u05DB\u05BC", U"\u05DB\u05BC"},
+	{U"\uFB3C", U"\u05DC\u05BC", U"\u05DC\u05BC", U"\u05DC\u05BC", U"\u05DC\u05BC"},
+	{U"\uFB3E", U"\u05DE\u05BC", U"\u05DE\u05BC", U"\u05DE\u05BC", U"\u05DE\u05BC"},
+	{U"\uFB40", U"\u05E0\u05BC", U"\u05E0\u05BC", U"\u05E0\u05BC", U"\u05E0\u05BC"},
+	{U"\uFB41", U"\u05E1\u05BC", U"\u05E1\u05BC", U"\u05E1\u05BC", U"\u05E1\u05BC"},
+	{U"\uFB43", U"\u05E3\u05BC", U"\u05E3\u05BC", U"\u05E3\u05BC", U"\u05E3\u05BC"},
+	{U"\uFB44", U"\u05E4\u05BC", U"\u05E4\u05BC", U"\u05E4\u05BC", U"\u05E4\u05BC"},
+	{U"\uFB46", U"\u05E6\u05BC", U"\u05E6\u05BC", U"\u05E6\u05BC", U"\u05E6\u05BC"},
+	{U"\uFB47", U"\u05E7\u05BC", U"\u05E7\u05BC", U"\u05E7\u05BC", U"\u05E7\u05BC"},
+	{U"\uFB48", U"\u05E8\u05BC", U"\u05E8\u05BC", U"\u05E8\u05BC", U"\u05E8\u05BC"},
+	{U"\uFB49", U"\u05E9\u05BC", U"\u05E9\u05BC", U"\u05E9\u05BC", U"\u05E9\u05BC"},
+	{U"\uFB4A", U"\u05EA\u05BC", U"\u05EA\u05BC", U"\u05EA\u05BC", U"\u05EA\u05BC"},
+	{U"\uFB4B", U"\u05D5\u05B9", U"\u05D5\u05B9", U"\u05D5\u05B9", U"\u05D5\u05B9"},
+	{U"\uFB4C", U"\u05D1\u05BF", U"\u05D1\u05BF", U"\u05D1\u05BF", U"\u05D1\u05BF"},
+	{U"\uFB4D", U"\u05DB\u05BF", U"\u05DB\u05BF", U"\u05DB\u05BF", U"\u05DB\u05BF"},
+	{U"\uFB4E", U"\u05E4\u05BF", U"\u05E4\u05BF", U"\u05E4\u05BF", U"\u05E4\u05BF"},
+	{U"\uFB4F", U"\uFB4F", U"\uFB4F", U"\u05D0\u05DC", U"\u05D0\u05DC"},
+	{U"\uFB50", U"\uFB50", U"\uFB50", U"\u0671", U"\u0671"},
+	{U"\uFB51", U"\uFB51", U"\uFB51", U"\u0671", U"\u0671"},
+	{U"\uFB52", U"\uFB52", U"\uFB52", U"\u067B", U"\u067B"},
+	{U"\uFB53", U"\uFB53", U"\uFB53", U"\u067B", U"\u067B"},
+	{U"\uFB54", U"\uFB54", U"\uFB54", U"\u067B", U"\u067B"},
+	{U"\uFB55", U"\uFB55", U"\uFB55", U"\u067B", U"\u067B"},
+	{U"\uFB56", U"\uFB56", U"\uFB56", U"\u067E", U"\u067E"},
+	{U"\uFB57", U"\uFB57", U"\uFB57", U"\u067E", U"\u067E"},
+	{U"\uFB58", U"\uFB58", U"\uFB58", U"\u067E", U"\u067E"},
+	{U"\uFB59", U"\uFB59", U"\uFB59", U"\u067E", U"\u067E"},
+	{U"\uFB5A", U"\uFB5A", U"\uFB5A", U"\u0680", U"\u0680"},
+	{U"\uFB5B", U"\uFB5B", U"\uFB5B", U"\u0680", U"\u0680"},
+	{U"\uFB5C", U"\uFB5C", U"\uFB5C", U"\u0680", U"\u0680"},
+	{U"\uFB5D", U"\uFB5D", U"\uFB5D", U"\u0680", U"\u0680"},
+	{U"\uFB5E", U"\uFB5E", U"\uFB5E", U"\u067A", U"\u067A"},
+	{U"\uFB5F", U"\uFB5F", U"\uFB5F", U"\u067A", U"\u067A"},
+	{U"\uFB60", U"\uFB60", U"\uFB60", U"\u067A", U"\u067A"},
+	{U"\uFB61", U"\uFB61", U"\uFB61", U"\u067A", U"\u067A"},
+	{U"\uFB62", U"\uFB62", U"\uFB62", U"\u067F", U"\u067F"},
+	{U"\uFB63", U"\uFB63", U"\uFB63", U"\u067F", U"\u067F"},
+	{U"\uFB64", U"\uFB64", U"\uFB64", U"\u067F", U"\u067F"},
+	{U"\uFB65", U"\uFB65", U"\uFB65", U"\u067F", U"\u067F"},
+	{U"\uFB66", U"\uFB66", U"\uFB66", U"\u0679", U"\u0679"},
+	{U"\uFB67", U"\uFB67", U"\uFB67", U"\u0679", U"\u0679"},
+	{U"\uFB68", U"\uFB68", U"\uFB68", U"\u0679", U"\u0679"},
+	{U"\uFB69", U"\uFB69", U"\uFB69", U"\u0679", U"\u0679"},
+	{U"\uFB6A", U"\uFB6A", U"\uFB6A", U"\u06A4", U"\u06A4"},
+	{U"\uFB6B", U"\uFB6B", U"\uFB6B", U"\u06A4", U"\u06A4"},
+	{U"\uFB6C", U"\uFB6C", U"\uFB6C", U"\u06A4", U"\u06A4"},
+	{U"\uFB6D", U"\uFB6D", U"\uFB6D", U"\u06A4", U"\u06A4"},
+	{U"\uFB6E", U"\uFB6E", U"\uFB6E", U"\u06A6", U"\u06A6"},
+	{U"\uFB6F", U"\uFB6F", U"\uFB6F", U"\u06A6", U"\u06A6"},
+	{U"\uFB70", U"\uFB70", U"\uFB70", U"\u06A6", U"\u06A6"},
+	{U"\uFB71", U"\uFB71", U"\uFB71", U"\u06A6", U"\u06A6"},
+	{U"\uFB72", U"\uFB72", U"\uFB72", U"\u0684", U"\u0684"},
+	{U"\uFB73", U"\uFB73", U"\uFB73", U"\u0684", U"\u0684"},
+	{U"\uFB74", U"\uFB74", U"\uFB74", U"\u0684", U"\u0684"},
+	{U"\uFB75", U"\uFB75", U"\uFB75", U"\u0684", U"\u0684"},
+	{U"\uFB76", U"\uFB76", U"\uFB76", U"\u0683", U"\u0683"},
+	{U"\uFB77", U"\uFB77", U"\uFB77", U"\u0683", U"\u0683"},
+	{U"\uFB78", U"\uFB78", U"\uFB78", U"\u0683", U"\u0683"},
+	{U"\uFB79", U"\uFB79", U"\uFB79", U"\u0683", U"\u0683"},
+	{U"\uFB7A", U"\uFB7A", U"\uFB7A", U"\u0686", U"\u0686"},
+	{U"\uFB7B", U"\uFB7B", U"\uFB7B", U"\u0686", U"\u0686"},
+	{U"\uFB7C", U"\uFB7C", U"\uFB7C", U"\u0686", U"\u0686"},
+	{U"\uFB7D", U"\uFB7D", U"\uFB7D", U"\u0686", U"\u0686"},
+	{U"\uFB7E", U"\uFB7E", U"\uFB7E", U"\u0687", U"\u0687"},
+	{U"\uFB7F", U"\uFB7F", U"\uFB7F", U"\u0687", U"\u0687"},
+	{U"\uFB80", U"\uFB80", U"\uFB80", U"\u0687", U"\u0687"},
+	{U"\uFB81", U"\uFB81", U"\uFB81", U"\u0687", U"\u0687"},
+	{U"\uFB82", U"\uFB82", U"\uFB82", U"\u068D", U"\u068D"},
+	{U"\uFB83", U"\uFB83", U"\uFB83", U"\u068D", U"\u068D"},
+	{U"\uFB84", U"\uFB84", U"\uFB84", U"\u068C", U"\u068C"},
+	{U"\uFB85", U"\uFB85", U"\uFB85", U"\u068C", U"\u068C"},
+	{U"\uFB86", U"\uFB86", U"\uFB86", U"\u068E", U"\u068E"},
+	{U"\uFB87", U"\uFB87", U"\uFB87", U"\u068E", U"\u068E"},
+	{U"\uFB88", U"\uFB88", U"\uFB88", U"\u0688", U"\u0688"},
+	{U"\uFB89", U"\uFB89", U"\uFB89", U"\u0688", U"\u0688"},
+	{U"\uFB8A", U"\uFB8A", U"\uFB8A", U"\u0698", U"\u0698"},
+	{U"\uFB8B", U"\uFB8B", U"\uFB8B", U"\u0698", U"\u0698"},
+	{U"\uFB8C", U"\uFB8C", U"\uFB8C", U"\u0691", U"\u0691"},
+	{U"\uFB8D", U"\uFB8D", U"\uFB8D", U"\u0691", U"\u0691"},
+	{U"\uFB8E", U"\uFB8E", U"\uFB8E", U"\u06A9", U"\u06A9"},
+	{U"\uFB8F", U"\uFB8F", U"\uFB8F", U"\u06A9", U"\u06A9"},
+	{U"\uFB90", U"\uFB90", U"\uFB90", U"\u06A9", U"\u06A9"},
+	{U"\uFB91", U"\uFB91", U"\uFB91", U"\u06A9", U"\u06A9"},
+	{U"\uFB92", U"\uFB92", U"\uFB92", U"\u06AF", U"\u06AF"},
+	{U"\uFB93", U"\uFB93", U"\uFB93", U"\u06AF", U"\u06AF"},
+	{U"\uFB94", U"\uFB94", U"\uFB94", U"\u06AF", U"\u06AF"},
+	{U"\uFB95", U"\uFB95", U"\uFB95", U"\u06AF", U"\u06AF"},
+	{U"\uFB96", U"\uFB96", U"\uFB96", U"\u06B3", U"\u06B3"},
+	{U"\uFB97", U"\uFB97", U"\uFB97", U"\u06B3", U"\u06B3"},
+	{U"\uFB98", U"\uFB98", U"\uFB98", U"\u06B3", U"\u06B3"},
+	{U"\uFB99", U"\uFB99", U"\uFB99", U"\u06B3", U"\u06B3"},
+	{U"\uFB9A", U"\uFB9A", U"\uFB9A", U"\u06B1", U"\u06B1"},
+	{U"\uFB9B", U"\uFB9B", U"\uFB9B", U"\u06B1", U"\u06B1"},
+	{U"\uFB9C", U"\uFB9C", U"\uFB9C", U"\u06B1", U"\u06B1"},
+	{U"\uFB9D", U"\uFB9D", U"\uFB9D", U"\u06B1", U"\u06B1"},
+	{U"\uFB9E", U"\uFB9E", U"\uFB9E", U"\u06BA", U"\u06BA"},
+	{U"\uFB9F", U"\uFB9F", U"\uFB9F", U"\u06BA", U"\u06BA"},
+	{U"\uFBA0", U"\uFBA0", U"\uFBA0", U"\u06BB", U"\u06BB"},
+	{U"\uFBA1", U"\uFBA1", U"\uFBA1", U"\u06BB", U"\u06BB"},
+	{U"\uFBA2", U"\uFBA2", U"\uFBA2", U"\u06BB", U"\u06BB"},
+	{U"\uFBA3", U"\uFBA3", U"\uFBA3", U"\u06BB", U"\u06BB"},
+	{U"\uFBA4", U"\uFBA4", U"\uFBA4", U"\u06C0", U"\u06D5\u0654"},
+	{U"\uFBA5", U"\uFBA5", U"\uFBA5", U"\u06C0", U"\u06D5\u0654"},
+	{U"\uFBA6", U"\uFBA6", U"\uFBA6", U"\u06C1", U"\u06C1"},
+	{U"\uFBA7", U"\uFBA7", U"\uFBA7", U"\u06C1", U"\u06C1"},
+	{U"\uFBA8", U"\uFBA8", U"\uFBA8", U"\u06C1", U"\u06C1"},
+	{U"\uFBA9", U"\uFBA9", U"\uFBA9", U"\u06C1", U"\u06C1"},
+	{U"\uFBAA", U"\uFBAA", U"\uFBAA", U"\u06BE", U"\u06BE"},
+	{U"\uFBAB", U"\uFBAB", U"\uFBAB", U"\u06BE", U"\u06BE"},
+	{U"\uFBAC", U"\uFBAC", U"\uFBAC", U"\u06BE", U"\u06BE"},
+	{U"\uFBAD", U"\uFBAD", U"\uFBAD", U"\u06BE", U"\u06BE"},
+	{U"\uFBAE", U"\uFBAE", U"\uFBAE", U"\u06D2", U"\u06D2"},
+	{U"\uFBAF", U"\uFBAF", U"\uFBAF", U"\u06D2", U"\u06D2"},
+	{U"\uFBB0", U"\uFBB0", U"\uFBB0", U"\u06D3", U"\u06D2\u0654"},
+	{U"\uFBB1", U"\uFBB1", U"\uFBB1", U"\u06D3", U"\u06D2\u0654"},
+	{U"\uFBD3", U"\uFBD3", U"\uFBD3", U"\u06AD", U"\u06AD"},
+	{U"\uFBD4", U"\uFBD4", U"\uFBD4", U"\u06AD", U"\u06AD"},
+	{U"\uFBD5", U"\uFBD5", U"\uFBD5", U"\u06AD", U"\u06AD"},
+	{U"\uFBD6", U"\uFBD6", U"\uFBD6", U"\u06AD", U"\u06AD"},
+	{U"\uFBD7", U"\uFBD7", U"\uFBD7", U"\u06C7", U"\u06C7"},
+	{U"\uFBD8", U"\uFBD8", U"\uFBD8", U"\u06C7", U"\u06C7"},
+	{U"\uFBD9", U"\uFBD9", U"\uFBD9", U"\u06C6", U"\u06C6"},
+	{U"\uFBDA", U"\uFBDA", U"\uFBDA", U"\u06C6", U"\u06C6"},
+	{U"\uFBDB", U"\uFBDB", U"\uFBDB", U"\u06C8", U"\u06C8"},
+	{U"\uFBDC", U"\uFBDC", U"\uFBDC", U"\u06C8", U"\u06C8"},
+	{U"\uFBDD", U"\uFBDD", U"\uFBDD", U"\u06C7\u0674", U"\u06C7\u0674"},
+	{U"\uFBDE", U"\uFBDE", U"\uFBDE", U"\u06CB", U"\u06CB"},
+	{U"\uFBDF", U"\uFBDF", U"\uFBDF", U"\u06CB", U"\u06CB"},
+	{U"\uFBE0", U"\uFBE0", U"\uFBE0", U"\u06C5", U"\u06C5"},
+	{U"\uFBE1", U"\uFBE1", U"\uFBE1", U"\u06C5", U"\u06C5"},
+	{U"\uFBE2", U"\uFBE2", U"\uFBE2", U"\u06C9", U"\u06C9"},
+	{U"\uFBE3", U"\uFBE3", U"\uFBE3", U"\u06C9", U"\u06C9"},
+	{U"\uFBE4", U"\uFBE4", U"\uFBE4", U"\u06D0", U"\u06D0"},
+	{U"\uFBE5", U"\uFBE5", U"\uFBE5", U"\u06D0", U"\u06D0"},
+	{U"\uFBE6", U"\uFBE6", U"\uFBE6", U"\u06D0", U"\u06D0"},
+	{U"\uFBE7", U"\uFBE7", U"\uFBE7", U"\u06D0", U"\u06D0"},
+	{U"\uFBE8", U"\uFBE8", U"\uFBE8", U"\u0649", U"\u0649"},
+	{U"\uFBE9", U"\uFBE9", U"\uFBE9", U"\u0649", U"\u0649"},
+	{U"\uFBEA", U"\uFBEA", U"\uFBEA", U"\u0626\u0627", U"\u064A\u0654\u0627"},
+	{U"\uFBEB", U"\uFBEB", U"\uFBEB", U"\u0626\u0627", U"\u064A\u0654\u0627"},
+	{U"\uFBEC", U"\uFBEC", U"\uFBEC", U"\u0626\u06D5", U"\u064A\u0654\u06D5"},
+	{U"\uFBED", U"\uFBED", U"\uFBED", U"\u0626\u06D5", U"\u064A\u0654\u06D5"},
+	{U"\uFBEE", U"\uFBEE", U"\uFBEE", U"\u0626\u0648", U"\u064A\u0654\u0648"},
+	{U"\uFBEF", U"\uFBEF", U"\uFBEF", U"\u0626\u0648", U"\u064A\u0654\u0648"},
+	{U"\uFBF0", U"\uFBF0", U"\uFBF0", U"\u0626\u06C7", U"\u064A\u0654\u06C7"},
+	{U"\uFBF1", U"\uFBF1", U"\uFBF1", U"\u0626\u06C7", U"\u064A\u0654\u06C7"},
+	{U"\uFBF2", U"\uFBF2", U"\uFBF2", U"\u0626\u06C6", U"\u064A\u0654\u06C6"},
+	{U"\uFBF3", U"\uFBF3", U"\uFBF3", U"\u0626\u06C6", U"\u064A\u0654\u06C6"},
+	{U"\uFBF4", U"\uFBF4", U"\uFBF4", U"\u0626\u06C8", U"\u064A\u0654\u06C8"},
+	{U"\uFBF5", U"\uFBF5", U"\uFBF5", U"\u0626\u06C8", U"\u064A\u0654\u06C8"},
+	{U"\uFBF6", U"\uFBF6", U"\uFBF6", U"\u0626\u06D0", U"\u064A\u0654\u06D0"},
+	{U"\uFBF7", U"\uFBF7", U"\uFBF7", U"\u0626\u06D0", U"\u064A\u0654\u06D0"},
+	{U"\uFBF8", U"\uFBF8", U"\uFBF8", U"\u0626\u06D0", U"\u064A\u0654\u06D0"},
+	{U"\uFBF9", U"\uFBF9", U"\uFBF9", U"\u0626\u0649", U"\u064A\u0654\u0649"},
+	{U"\uFBFA", U"\uFBFA", U"\uFBFA", U"\u0626\u0649", U"\u064A\u0654\u0649"},
+	{U"\uFBFB", U"\uFBFB", U"\uFBFB", U"\u0626\u0649", U"\u064A\u0654\u0649"},
+	{U"\uFBFC", U"\uFBFC", U"\uFBFC", U"\u06CC", U"\u06CC"},
+	{U"\uFBFD", U"\uFBFD", U"\uFBFD", U"\u06CC", U"\u06CC"},
+	{U"\uFBFE", U"\uFBFE", U"\uFBFE", U"\u06CC", U"\u06CC"},
+	{U"\uFBFF", U"\uFBFF", U"\uFBFF", U"\u06CC", U"\u06CC"},
+	{U"\uFC00", U"\uFC00", U"\uFC00", U"\u0626\u062C", U"\u064A\u0654\u062C"},
+	{U"\uFC01", U"\uFC01", U"\uFC01", U"\u0626\u062D", U"\u064A\u0654\u062D"},
+	{U"\uFC02", U"\uFC02", U"\uFC02", U"\u0626\u0645", U"\u064A\u0654\u0645"},
+	{U"\uFC03", U"\uFC03", U"\uFC03", U"\u0626\u0649", U"\u064A\u0654\u0649"},
+	{U"\uFC04", U"\uFC04", U"\uFC04", U"\u0626\u064A", U"\u064A\u0654\u064A"},
+	{U"\uFC05", U"\uFC05", U"\uFC05", U"\u0628\u062C", U"\u0628\u062C"},
+	{U"\uFC06", U"\uFC06", U"\uFC06", U"\u0628\u062D", U"\u0628\u062D"},
+	{U"\uFC07", U"\uFC07", U"\uFC07", U"\u0628\u062E", U"\u0628\u062E"},
+	{U"\uFC08", U"\uFC08", U"\uFC08", U"\u0628\u0645", U"\u0628\u0645"},
+	{U"\uFC09", U"\uFC09", U"\uFC09", U"\u0628\u0649", U"\u0628\u0649"},
+	{U"\uFC0A", U"\uFC0A", U"\uFC0A", U"\u0628\u064A", U"\u0628\u064A"},
+	{U"\uFC0B", U"\uFC0B", U"\uFC0B", U"\u062A\u062C", U"\u062A\u062C"},
+	{U"\uFC0C", U"\uFC0C", U"\uFC0C", U"\u062A\u062D", U"\u062A\u062D"},
+	{U"\uFC0D", U"\uFC0D", U"\uFC0D", U"\u062A\u062E", U"\u062A\u062E"},
+	{U"\uFC0E", U"\uFC0E", U"\uFC0E", U"\u062A\u0645", U"\u062A\u0645"},
+	{U"\uFC0F", U"\uFC0F", U"\uFC0F", U"\u062A\u0649", U"\u062A\u0649"},
+	{U"\uFC10", U"\uFC10", U"\uFC10", U"\u062A\u064A", U"\u062A\u064A"},
+	{U"\uFC11", U"\uFC11", U"\uFC11", U"\u062B\u062C", U"\u062B\u062C"},
+	{U"\uFC12", U"\uFC12", U"\uFC12", U"\u062B\u0645", U"\u062B\u0645"},
+	{U"\uFC13", U"\uFC13", U"\uFC13", U"\u062B\u0649", U"\u062B\u0649"},
+	{U"\uFC14", U"\uFC14", U"\uFC14", U"\u062B\u064A", U"\u062B\u064A"},
+	{U"\uFC15", U"\uFC15", U"\uFC15", U"\u062C\u062D", U"\u062C\u062D"},
+	{U"\uFC16", U"\uFC16", U"\uFC16", U"\u062C\u0645", U"\u062C\u0645"},
+	{U"\uFC17", U"\uFC17", U"\uFC17", U"\u062D\u062C", U"\u062D\u062C"},
+	{U"\uFC18", U"\uFC18", U"\uFC18", U"\u062D\u0645", U"\u062D\u0645"},
+	{U"\uFC19", U"\uFC19", U"\uFC19", U"\u062E\u062C", U"\u062E\u062C"},
+	{U"\uFC1A", U"\uFC1A", U"\uFC1A", U"\u062E\u062D", U"\u062E\u062D"},
+	{U"\uFC1B", U"\uFC1B", U"\uFC1B", U"\u062E\u0645", U"\u062E\u0645"},
+	{U"\uFC1C", U"\uFC1C", U"\uFC1C", U"\u0633\u062C", U"\u0633\u062C"},
+	{U"\uFC1D", U"\uFC1D", U"\uFC1D", U"\u0633\u062D", U"\u0633\u062D"},
+	{U"\uFC1E", U"\uFC1E", U"\uFC1E", U"\u0633\u062E", U"\u0633\u062E"},
+	{U"\uFC1F", U"\uFC1F", U"\uFC1F", U"\u0633\u0645", U"\u0633\u0645"},
+	{U"\uFC20", U"\uFC20", U"\uFC20", U"\u0635\u062D", U"\u0635\u062D"},
+	{U"\uFC21", U"\uFC21", U"\uFC21", U"\u0635\u0645", U"\u0635\u0645"},
+	{U"\uFC22", U"\uFC22", U"\uFC22", U"\u0636\u062C", U"\u0636\u062C"},
+	{U"\uFC23", U"\uFC23", U"\uFC23", U"\u0636\u062D", U"\u0636\u062D"},
+	{U"\uFC24", U"\uFC24", U"\uFC24", U"\u0636\u062E", U"\u0636\u062E"},
+	{U"\uFC25", U"\uFC25", U"\uFC25", U"\u0636\u0645", U"\u0636\u0645"},
+	{U"\uFC26", U"\uFC26", U"\uFC26", U"\u0637\u062D", U"\u0637\u062D"},
+	{U"\uFC27", U"\uFC27", U"\uFC27", U"\u0637\u0645", U"\u0637\u0645"},
+	{U"\uFC28", U"\uFC28", U"\uFC28", U"\u0638\u0645", U"\u0638\u0645"},
+	{U"\uFC29", U"\uFC29", U"\uFC29", U"\u0639\u062C", U"\u0639\u062C"},
+	{U"\uFC2A", U"\uFC2A", U"\uFC2A", U"\u0639\u0645", U"\u0639\u0645"},
+	{U"\uFC2B", U"\uFC2B", U"\uFC2B", U"\u063A\u062C", U"\u063A\u062C"},
+	{U"\uFC2C", U"\uFC2C", U"\uFC2C", U"\u063A\u0645", U"\u063A\u0645"},
+	{U"\uFC2D", U"\uFC2D", U"\uFC2D", U"\u0641\u062C", U"\u0641\u062C"},
+	{U"\uFC2E", U"\uFC2E", U"\uFC2E", U"\u0641\u062D", U"\u0641\u062D"},
+	{U"\uFC2F", U"\uFC2F", U"\uFC2F", U"\u0641\u062E", U"\u0641\u062E"},
+	{U"\uFC30", U"\uFC30", U"\uFC30", U"\u0641\u0645", U"\u0641\u0645"},
+	{U"\uFC31", U"\uFC31", U"\uFC31", U"\u0641\u0649", U"\u0641\u0649"},
+	{U"\uFC32", U"\uFC32", U"\uFC32", U"\u0641\u064A", U"\u0641\u064A"},
+	{U"\uFC33", U"\uFC33", U"\uFC33", U"\u0642\u062D", U"\u0642\u062D"},
+	{U"\uFC34", U"\uFC34", U"\uFC34", U"\u0642\u0645", U"\u0642\u0645"},
+	{U"\uFC35", U"\uFC35", U"\uFC35", U"\u0642\u0649", U"\u0642\u0649"},
+	{U"\uFC36", U"\uFC36", U"\uFC36", U"\u0642\u064A", U"\u0642\u064A"},
+	{U"\uFC37", U"\uFC37", U"\uFC37", U"\u0643\u0627", U"\u0643\u0627"},
+	{U"\uFC38", U"\uFC38", U"\uFC38", U"\u0643\u062C", U"\u0643\u062C"},
+	{U"\uFC39", U"\uFC39", U"\uFC39", U"\u0643\u062D", U"\u0643\u062D"},
+	{U"\uFC3A", U"\uFC3A", U"\uFC3A", U"\u0643\u062E", U"\u0643\u062E"},
+	{U"\uFC3B", U"\uFC3B", U"\uFC3B", U"\u0643\u0644", U"\u0643\u0644"},
+	{U"\uFC3C", U"\uFC3C", U"\uFC3C", U"\u0643\u0645", U"\u0643\u0645"},
+	{U"\uFC3D", U"\uFC3D", U"\uFC3D", U"\u0643\u0649", U"\u0643\u0649"},
+	{U"\uFC3E", U"\uFC3E", U"\uFC3E", U"\u0643\u064A", U"\u0643\u064A"},
+	{U"\uFC3F", U"\uFC3F", U"\uFC3F", U"\u0644\u062C", U"\u0644\u062C"},
+	{U"\uFC40", U"\uFC40", U"\uFC40", U"\u0644\u062D", U"\u0644\u062D"},
+	{U"\uFC41", U"\uFC41", U"\uFC41", U"\u0644\u062E", U"\u0644\u062E"},
+	{U"\uFC42", U"\uFC42", U"\uFC42", U"\u0644\u0645", U"\u0644\u0645"},
+	{U"\uFC43", U"\uFC43", U"\uFC43", U"\u0644\u0649", U"\u0644\u0649"},
+	{U"\uFC44", U"\uFC44", U"\uFC44", U"\u0644\u064A", U"\u0644\u064A"},
+	{U"\uFC45", U"\uFC45", U"\uFC45", U"\u0645\u062C", U"\u0645\u062C"},
+	{U"\uFC46", U"\uFC46", U"\uFC46", U"\u0645\u062D", U"\u0645\u062D"},
+	{U"\uFC47", U"\uFC47", U"\uFC47", U"\u0645\u062E", U"\u0645\u062E"},
+	{U"\uFC48", U"\uFC48", U"\uFC48", U"\u0645\u0645", U"\u0645\u0645"},
+	{U"\uFC49", U"\uFC49", U"\uFC49", U"\u0645\u0649", U"\u0645\u0649"},
+	{U"\uFC4A", U"\uFC4A", U"\uFC4A", U"\u0645\u064A", U"\u0645\u064A"},
+	{U"\uFC4B", U"\uFC4B", U"\uFC4B", U"\u0646\u062C", U"\u0646\u062C"},
+	{U"\uFC4C", U"\uFC4C", U"\uFC4C", U"\u0646\u062D", U"\u0646\u062D"},
+	{U"\uFC4D", U"\uFC4D", U"\uFC4D", U"\u0646\u062E", U"\u0646\u062E"},
+	{U"\uFC4E", U"\uFC4E", U"\uFC4E", U"\u0646\u0645", U"\u0646\u0645"},
+	{U"\uFC4F", U"\uFC4F", U"\uFC4F", U"\u0646\u0649", U"\u0646\u0649"},
+	{U"\uFC50", U"\uFC50", U"\uFC50", U"\u0646\u064A", U"\u0646\u064A"},
+	{U"\uFC51", U"\uFC51", U"\uFC51", U"\u0647\u062C", U"\u0647\u062C"},
+	{U"\uFC52", U"\uFC52", U"\uFC52", U"\u0647\u0645", U"\u0647\u0645"},
+	{U"\uFC53", U"\uFC53", U"\uFC53", U"\u0647\u0649", U"\u0647\u0649"},
+	{U"\uFC54", U"\uFC54", U"\uFC54", U"\u0647\u064A", U"\u0647\u064A"},
+	{U"\uFC55", U"\uFC55", U"\uFC55", U"\u064A\u062C", U"\u064A\u062C"},
+	{U"\uFC56", U"\uFC56", U"\uFC56", U"\u064A\u062D", U"\u064A\u062D"},
+	{U"\uFC57", U"\uFC57", U"\uFC57", U"\u064A\u062E", U"\u064A\u062E"},
+	{U"\uFC58", U"\uFC58", U"\uFC58", U"\u064A\u0645", U"\u064A\u0645"},
+	{U"\uFC59", U"\uFC59", U"\uFC59", U"\u064A\u0649", U"\u064A\u0649"},
+	{U"\uFC5A", U"\uFC5A", U"\uFC5A", U"\u064A\u064A", U"\u064A\u064A"},
+	{U"\uFC5B", U"\uFC5B", U"\uFC5B", U"\u0630\u0670", U"\u0630\u0670"},
+	{U"\uFC5C", U"\uFC5C", U"\uFC5C", U"\u0631\u0670", U"\u0631\u0670"},
+	{U"\uFC5D", U"\uFC5D", U"\uFC5D", U"\u0649\u0670", U"\u0649\u0670"},
+	{U"\uFC5E", U"\uFC5E", U"\uFC5E", U" \u064C\u0651", U" \u064C\u0651"},
+	{U"\uFC5F", U"\uFC5F", U"\uFC5F", U" \u064D\u0651", U" \u064D\u0651"},
+	{U"\uFC60", U"\uFC60", U"\uFC60", U" \u064E\u0651", U" \u064E\u0651"},
+	{U"\uFC61", U"\uFC61", U"\uFC61", U" \u064F\u0651", U" \u064F\u0651"},
+	{U"\uFC62", U"\uFC62", U"\uFC62", U" \u0650\u0651", U" \u0650\u0651"},
+	{U"\uFC63", U"\uFC63", U"\uFC63", U" \u0651\u0670", U" \u0651\u0670"},
+	{U"\uFC64", U"\uFC64", U"\uFC64", U"\u0626\u0631", U"\u064A\u0654\u0631"},
+	{U"\uFC65", U"\uFC65", U"\uFC65", U"\u0626\u0632", U"\u064A\u0654\u0632"},
+	{U"\uFC66", U"\uFC66", U"\uFC66", U"\u0626\u0645", U"\u064A\u0654\u0645"},
+	{U"\uFC67", U"\uFC67", U"\uFC67", U"\u0626\u0646", U"\u064A\u0654\u0646"},
+	{U"\uFC68", U"\uFC68", U"\uFC68", U"\u0626\u0649", U"\u064A\u0654\u0649"},
+	{U"\uFC69", U"\uFC69", U"\uFC69", U"\u0626\u064A", U"\u064A\u0654\u064A"},
+	{U"\uFC6A", U"\uFC6A", U"\uFC6A", U"\u0628\u0631", U"\u0628\u0631"},
+	{U"\uFC6B", U"\uFC6B", U"\uFC6B", U"\u0628\u0632", U"\u0628\u0632"},
+	{U"\uFC6C", U"\uFC6C", U"\uFC6C", U"\u0628\u0645", U"\u0628\u0645"},
+	{U"\uFC6D", U"\uFC6D", U"\uFC6D", U"\u0628\u0646", U"\u0628\u0646"},
+	{U"\uFC6E", U"\uFC6E", U"\uFC6E", U"\u0628\u0649", U"\u0628\u0649"},
+	{U"\uFC6F", U"\uFC6F", U"\uFC6F", U"\u0628\u064A", U"\u0628\u064A"},
+	{U"\uFC70", U"\uFC70", U"\uFC70", U"\u062A\u0631", U"\u062A\u0631"},
+	{U"\uFC71", U"\uFC71", U"\uFC71", U"\u062A\u0632", U"\u062A\u0632"},
+	{U"\uFC72", U"\uFC72", U"\uFC72", U"\u062A\u0645", U"\u062A\u0645"},
+	{U"\uFC73", U"\uFC73", U"\uFC73", U"\u062A\u0646", U"\u062A\u0646"},
+	{U"\uFC74", U"\uFC74", U"\uFC74", U"\u062A\u0649", U"\u062A\u0649"},
+	{U"\uFC75", U"\uFC75", U"\uFC75", U"\u062A\u064A", U"\u062A\u064A"},
+	{U"\uFC76", U"\uFC76", U"\uFC76", U"\u062B\u0631", U"\u062B\u0631"},
+	{U"\uFC77", U"\uFC77", U"\uFC77", U"\u062B\u0632", U"\u062B\u0632"},
+	{U"\uFC78", U"\uFC78", U"\uFC78", U"\u062B\u0645", U"\u062B\u0645"},
+	{U"\uFC79", U"\uFC79", U"\uFC79", U"\u062B\u0646", U"\u062B\u0646"},
+	{U"\uFC7A", U"\uFC7A", U"\uFC7A", U"\u062B\u0649", U"\u062B\u0649"},
+	{U"\uFC7B", U"\uFC7B", U"\uFC7B", U"\u062B\u064A", U"\u062B\u064A"},
+	{U"\uFC7C", U"\uFC7C", U"\uFC7C", U"\u0641\u0649", U"\u0641\u0649"},
+	{U"\uFC7D", U"\uFC7D", U"\uFC7D", U"\u0641\u064A", U"\u0641\u064A"},
+	{U"\uFC7E", U"\uFC7E", U"\uFC7E", U"\u0642\u0649", U"\u0642\u0649"},
+	{U"\uFC7F", U"\uFC7F", U"\uFC7F", U"\u0642\u064A", U"\u0642\u064A"},
+	{U"\uFC80", U"\uFC80", U"\uFC80", U"\u0643\u0627", U"\u0643\u0627"},
+	{U"\uFC81", U"\uFC81", U"\uFC81", U"\u0643\u0644", U"\u0643\u0644"},
+	{U"\uFC82", U"\uFC82", U"\uFC82", U"\u0643\u0645", U"\u0643\u0645"},
+	{U"\uFC83", U"\uFC83", U"\uFC83", U"\u0643\u0649", U"\u0643\u0649"},
+	{U"\uFC84", U"\uFC84", U"\uFC84", U"\u0643\u064A", U"\u0643\u064A"},
+	{U"\uFC85", U"\uFC85", U"\uFC85", U"\u0644\u0645", U"\u0644\u0645"},
+	{U"\uFC86", U"\uFC86", U"\uFC86", U"\u0644\u0649", U"\u0644\u0649"},
+	{U"\uFC87", U"\uFC87", U"\uFC87", U"\u0644\u064A", U"\u0644\u064A"},
+	{U"\uFC88", U"\uFC88", U"\uFC88", U"\u0645\u0627", U"\u0645\u0627"},
+	{U"\uFC89", U"\uFC89", U"\uFC89", U"\u0645\u0645", U"\u0645\u0645"},
+	{U"\uFC8A", U"\uFC8A", U"\uFC8A", U"\u0646\u0631", U"\u0646\u0631"},
+	{U"\uFC8B", U"\uFC8B", U"\uFC8B", U"\u0646\u0632", U"\u0646\u0632"},
+	{U"\uFC8C", U"\uFC8C", U"\uFC8C", U"\u0646\u0645", U"\u0646\u0645"},
+	{U"\uFC8D", U"\uFC8D", U"\uFC8D", U"\u0646\u0646", U"\u0646\u0646"},
+	{U"\uFC8E", U"\uFC8E", U"\uFC8E", U"\u0646\u0649", U"\u0646\u0649"},
+	{U"\uFC8F", U"\uFC8F", U"\uFC8F", U"\u0646\u064A", U"\u0646\u064A"},
+	{U"\uFC90", U"\uFC90", U"\uFC90", U"\u0649\u0670", U"\u0649\u0670"},
+	{U"\uFC91", U"\uFC91", U"\uFC91", U"\u064A\u0631", U"\u064A\u0631"},
+	{U"\uFC92", U"\uFC92", U"\uFC92", U"\u064A\u0632", U"\u064A\u0632"},
+	{U"\uFC93", U"\uFC93", U"\uFC93", U"\u064A\u0645", U"\u064A\u0645"},
+	{U"\uFC94", U"\uFC94", U"\uFC94", U"\u064A\u0646", U"\u064A\u0646"},
+	{U"\uFC95", U"\uFC95", U"\uFC95", U"\u064A\u0649", U"\u064A\u0649"},
+	{U"\uFC96", U"\uFC96", U"\uFC96", U"\u064A\u064A", U"\u064A\u064A"},
+	{U"\uFC97", U"\uFC97", U"\uFC97", U"\u0626\u062C", U"\u064A\u0654\u062C"},
+	{U"\uFC98", U"\uFC98", U"\uFC98", U"\u0626\u062D", U"\u064A\u0654\u062D"},
+	{U"\uFC99", U"\uFC99", U"\uFC99", U"\u0626\u062E", U"\u064A\u0654\u062E"},
+	{U"\uFC9A", U"\uFC9A", U"\uFC9A", U"\u0626\u0645", U"\u064A\u0654\u0645"},
+	{U"\uFC9B", U"\uFC9B", U"\uFC9B", U"\u0626\u0647", U"\u064A\u0654\u0647"},
+	{U"\uFC9C", U"\uFC9C", U"\uFC9C", U"\u0628\u062C", U"\u0628\u062C"},
+	{U"\uFC9D", U"\uFC9D", U"\uFC9D", U"\u0628\u062D", U"\u0628\u062D"},
+	{U"\uFC9E", U"\uFC9E", U"\uFC9E", U"\u0628\u062E", U"\u0628\u062E"},
+	{U"\uFC9F", U"\uFC9F", U"\uFC9F", U"\u0628\u0645", U"\u0628\u0645"},
+	{U"\uFCA0", U"\uFCA0", U"\uFCA0", U"\u0628\u0647", U"\u0628\u0647"},
+	{U"\uFCA1", U"\uFCA1", U"\uFCA1", U"\u062A\u062C", U"\u062A\u062C"},
+	{U"\uFCA2", U"\uFCA2", U"\uFCA2", U"\u062A\u062D", U"\u062A\u062D"},
+	{U"\uFCA3", U"\uFCA3", U"\uFCA3", U"\u062A\u062E", U"\u062A\u062E"},
+	{U"\uFCA4", U"\uFCA4", U"\uFCA4", U"\u062A\u0645", U"\u062A\u0645"},
+	{U"\uFCA5", U"\uFCA5", U"\uFCA5", U"\u062A\u0647", U"\u062A\u0647"},
+	{U"\uFCA6", U"\uFCA6", U"\uFCA6", U"\u062B\u0645", U"\u062B\u0645"},
+	{U"\uFCA7", U"\uFCA7", U"\uFCA7", U"\u062C\u062D", U"\u062C\u062D"},
+	{U"\uFCA8", U"\uFCA8", U"\uFCA8", U"\u062C\u0645", U"\u062C\u0645"},
+	{U"\uFCA9", U"\uFCA9", U"\uFCA9", U"\u062D\u062C", U"\u062D\u062C"},
+	{U"\uFCAA", U"\uFCAA", U"\uFCAA", U"\u062D\u0645", U"\u062D\u0645"},
+	{U"\uFCAB", U"\uFCAB", U"\uFCAB", U"\u062E\u062C", U"\u062E\u062C"},
+	{U"\uFCAC", U"\uFCAC", U"\uFCAC", U"\u062E\u0645", U"\u062E\u0645"},
+	{U"\uFCAD", U"\uFCAD", U"\uFCAD", U"\u0633\u062C", U"\u0633\u062C"},
+	{U"\uFCAE", U"\uFCAE", U"\uFCAE", U"\u0633\u062D", U"\u0633\u062D"},
+	{U"\uFCAF", U"\uFCAF", U"\uFCAF", U"\u0633\u062E", U"\u0633\u062E"},
+	{U"\uFCB0", U"\uFCB0", U"\uFCB0", U"\u0633\u0645", U"\u0633\u0645"},
+	{U"\uFCB1", U"\uFCB1", U"\uFCB1", U"\u0635\u062D", U"\u0635\u062D"},
+	{U"\uFCB2", U"\uFCB2", U"\uFCB2", U"\u0635\u062E", U"\u0635\u062E"},
+	{U"\uFCB3", U"\uFCB3", U"\uFCB3", U"\u0635\u0645", U"\u0635\u0645"},
+	{U"\uFCB4", U"\uFCB4", U"\uFCB4", U"\u0636\u062C", U"\u0636\u062C"},
+	{U"\uFCB5", U"\uFCB5", U"\uFCB5", U"\u0636\u062D", U"\u0636\u062D"},
+	{U"\uFCB6", U"\uFCB6", U"\uFCB6", U"\u0636\u062E", U"\u0636\u062E"},
+	{U"\uFCB7", U"\uFCB7", U"\uFCB7", U"\u0636\u0645", U"\u0636\u0645"},
+	{U"\uFCB8", U"\uFCB8", U"\uFCB8", U"\u0637\u062D", U"\u0637\u062D"},
+	{U"\uFCB9", U"\uFCB9", U"\uFCB9", U"\u0638\u0645", U"\u0638\u0645"},
+	{U"\uFCBA", U"\uFCBA", U"\uFCBA", U"\u0639\u062C", U"\u0639\u062C"},
+	{U"\uFCBB", U"\uFCBB", U"\uFCBB", U"\u0639\u0645", U"\u0639\u0645"},
+	{U"\uFCBC", U"\uFCBC", U"\uFCBC", U"\u063A\u062C", U"\u063A\u062C"},
+	{U"\uFCBD", U"\uFCBD", U"\uFCBD", U"\u063A\u0645", U"\u063A\u0645"},
+	{U"\uFCBE", U"\uFCBE", U"\uFCBE", U"\u0641\u062C", U"\u0641\u062C"},
+	{U"\uFCBF", U"\uFCBF", U"\uFCBF", U"\u0641\u062D", U"\u0641\u062D"},
+	{U"\uFCC0", U"\uFCC0", U"\uFCC0", U"\u0641\u062E", U"\u0641\u062E"},
+	{U"\uFCC1", U"\uFCC1", U"\uFCC1", U"\u0641\u0645", U"\u0641\u0645"},
+	{U"\uFCC2", U"\uFCC2", U"\uFCC2", U"\u0642\u062D", U"\u0642\u062D"},
+	{U"\uFCC3", U"\uFCC3", U"\uFCC3", U"\u0642\u0645", U"\u0642\u0645"},
+	{U"\uFCC4", U"\uFCC4", U"\uFCC4", U"\u0643\u062C", U"\u0643\u062C"},
+	{U"\uFCC5", U"\uFCC5", U"\uFCC5", U"\u0643\u062D", U"\u0643\u062D"},
+	{U"\uFCC6", U"\uFCC6", U"\uFCC6", U"\u0643\u062E", U"\u0643\u062E"},
+	{U"\uFCC7", U"\uFCC7", U"\uFCC7", U"\u0643\u0644", U"\u0643\u0644"},
+	{U"\uFCC8", U"\uFCC8", U"\uFCC8", U"\u0643\u0645", U"\u0643\u0645"},
+	{U"\uFCC9", U"\uFCC9", U"\uFCC9", U"\u0644\u062C", U"\u0644\u062C"},
+	{U"\uFCCA", U"\uFCCA", U"\uFCCA", U"\u0644\u062D", U"\u0644\u062D"},
+	{U"\uFCCB", U"\uFCCB", U"\uFCCB", U"\u0644\u062E", U"\u0644\u062E"},
+	{U"\uFCCC", U"\uFCCC", U"\uFCCC", U"\u0644\u0645", U"\u0644\u0645"},
+	{U"\uFCCD", U"\uFCCD", U"\uFCCD", U"\u0644\u0647", U"\u0644\u0647"},
+	{U"\uFCCE", U"\uFCCE", U"\uFCCE", U"\u0645\u062C", U"\u0645\u062C"},
+	{U"\uFCCF", U"\uFCCF", U"\uFCCF", U"\u0645\u062D", U"\u0645\u062D"},
+	{U"\uFCD0", U"\uFCD0", U"\uFCD0", U"\u0645\u062E", U"\u0645\u062E"},
+	{U"\uFCD1", U"\uFCD1", U"\uFCD1", U"\u0645\u0645", U"\u0645\u0645"},
+	{U"\uFCD2", U"\uFCD2", U"\uFCD2", U"\u0646\u062C", U"\u0646\u062C"},
+	{U"\uFCD3", U"\uFCD3", U"\uFCD3", U"\u0646\u062D", U"\u0646\u062D"},
+	{U"\uFCD4", U"\uFCD4", U"\uFCD4", U"\u0646\u062E", U"\u0646\u062E"},
+	{U"\uFCD5", U"\uFCD5", U"\uFCD5", U"\u0646\u0645", U"\u0646\u0645"},
+	{U"\uFCD6", U"\uFCD6", U"\uFCD6", U"\u0646\u0647", U"\u0646\u0647"},
+	{U"\uFCD7", U"\uFCD7", U"\uFCD7", U"\u0647\u062C", U"\u0647\u062C"},
+	{U"\uFCD8", U"\uFCD8", U"\uFCD8", U"\u0647\u0645", U"\u0647\u0645"},
+	{U"\uFCD9", U"\uFCD9", U"\uFCD9", U"\u0647\u0670", U"\u0647\u0670"},
+	{U"\uFCDA", U"\uFCDA", U"\uFCDA", U"\u064A\u062C", U"\u064A\u062C"},
+	{U"\uFCDB", U"\uFCDB", U"\uFCDB", U"\u064A\u062D", U"\u064A\u062D"},
+	{U"\uFCDC", U"\uFCDC", U"\uFCDC", U"\u064A\u062E", U"\u064A\u062E"},
+	{U"\uFCDD", U"\uFCDD", U"\uFCDD", U"\u064A\u0645", U"\u064A\u0645"},
+	{U"\uFCDE", U"\uFCDE", U"\uFCDE", U"\u064A\u0647", U"\u064A\u0647"},
+	{U"\uFCDF", U"\uFCDF", U"\uFCDF", U"\u0626\u0645", U"\u064A\u0654\u0645"},
+	{U"\uFCE0", U"\uFCE0", U"\uFCE0", U"\u0626\u0647", U"\u064A\u0654\u0647"},
+	{U"\uFCE1", U"\uFCE1", U"\uFCE1", U"\u0628\u0645", U"\u0628\u0645"},
+	{U"\uFCE2", U"\uFCE2", U"\uFCE2", U"\u0628\u0647", U"\u0628\u0647"},
+	{U"\uFCE3", U"\uFCE3", U"\uFCE3", U"\u062A\u0645", U"\u062A\u0645"},
+	{U"\uFCE4", U"\uFCE4", U"\uFCE4", U"\u062A\u0647", U"\u062A\u0647"},
+	{U"\uFCE5", U"\uFCE5", U"\uFCE5", U"\u062B\u0645", U"\u062B\u0645"},
+	{U"\uFCE6", U"\uFCE6", U"\uFCE6", U"\u062B\u0647", U"\u062B\u0647"},
+	{U"\uFCE7", U"\uFCE7", U"\uFCE7", U"\u0633\u0645", U"\u0633\u0645"},
+	{U"\uFCE8", U"\uFCE8", U"\uFCE8", U"\u0633\u0647", U"\u0633\u0647"},
+	{U"\uFCE9", U"\uFCE9", U"\uFCE9", U"\u0634\u0645", U"\u0634\u0645"},
+	{U"\uFCEA", U"\uFCEA", U"\uFCEA", U"\u0634\u0647", U"\u0634\u0647"},
+	{U"\uFCEB", U"\uFCEB", U"\uFCEB", U"\u0643\u0644", U"\u0643\u0644"},
+	{U"\uFCEC", U"\uFCEC", U"\uFCEC", U"\u0643\u0645", U"\u0643\u0645"},
+	{U"\uFCED", U"\uFCED", U"\uFCED", U"\u0644\u0645", U"\u0644\u0645"},
+	{U"\uFCEE", U"\uFCEE", U"\uFCEE", U"\u0646\u0645", U"\u0646\u0645"},
+	{U"\uFCEF", U"\uFCEF", U"\uFCEF", U"\u0646\u0647", U"\u0646\u0647"},
+	{U"\uFCF0", U"\uFCF0", U"\uFCF0", U"\u064A\u0645", U"\u064A\u0645"},
+	{U"\uFCF1", U"\uFCF1", U"\uFCF1", U"\u064A\u0647", U"\u064A\u0647"},
+	{U"\uFCF2", U"\uFCF2", U"\uFCF2", U"\u0640\u064E\u0651", U"\u0640\u064E\u0651"},
+	{U"\uFCF3", U"\uFCF3", U"\uFCF3", U"\u0640\u064F\u0651", U"\u0640\u064F\u0651"},
+	{U"\uFCF4", U"\uFCF4", U"\uFCF4", U"\u0640\u0650\u0651", U"\u0640\u0650\u0651"},
+	{U"\uFCF5", U"\uFCF5", U"\uFCF5", U"\u0637\u0649", U"\u0637\u0649"},
+	{U"\uFCF6", U"\uFCF6", U"\uFCF6", U"\u0637\u064A", U"\u0637\u064A"},
+	{U"\uFCF7", U"\uFCF7", U"\uFCF7", U"\u0639\u0649", U"\u0639\u0649"},
+	{U"\uFCF8", U"\uFCF8", U"\uFCF8", U"\u0639\u064A", U"\u0639\u064A"},
+	{U"\uFCF9", U"\uFCF9", U"\uFCF9", U"\u063A\u0649", U"\u063A\u0649"},
+	{U"\uFCFA", U"\uFCFA", U"\uFCFA", U"\u063A\u064A", U"\u063A\u064A"},
+	{U"\uFCFB", U"\uFCFB", U"\uFCFB", U"\u0633\u0649", U"\u0633\u0649"},
+	{U"\uFCFC", U"\uFCFC", U"\uFCFC", U"\u0633\u064A", U"\u0633\u064A"},
+	{U"\uFCFD", U"\uFCFD", U"\uFCFD", U"\u0634\u0649", U"\u0634\u0649"},
+	{U"\uFCFE", U"\uFCFE", U"\uFCFE", U"\u0634\u064A", U"\u0634\u064A"},
+	{U"\uFCFF", U"\uFCFF", U"\uFCFF", U"\u062D\u0649", U"\u062D\u0649"},
+	{U"\uFD00", U"\uFD00", U"\uFD00", U"\u062D\u064A", U"\u062D\u064A"},
+	{U"\uFD01", U"\uFD01", U"\uFD01", U"\u062C\u0649", U"\u062C\u0649"},
+	{U"\uFD02", U"\uFD02", U"\uFD02", U"\u062C\u064A", U"\u062C\u064A"},
+	{U"\uFD03", U"\uFD03", U"\uFD03", U"\u062E\u0649", U"\u062E\u0649"},
+	{U"\uFD04", U"\uFD04", U"\uFD04", U"\u062E\u064A", U"\u062E\u064A"},
+	{U"\uFD05", U"\uFD05", U"\uFD05", U"\u0635\u0649", U"\u0635\u0649"},
+	{U"\uFD06", U"\uFD06", U"\uFD06", U"\u0635\u064A", U"\u0635\u064A"},
+	{U"\uFD07", U"\uFD07", U"\uFD07", U"\u0636\u0649", U"\u0636\u0649"},
+	{U"\uFD08", U"\uFD08", U"\uFD08", U"\u0636\u064A", U"\u0636\u064A"},
+	{U"\uFD09", U"\uFD09", U"\uFD09", U"\u0634\u062C", U"\u0634\u062C"},
+	{U"\uFD0A", U"\uFD0A", U"\uFD0A", U"\u0634\u062D", U"\u0634\u062D"},
+	{U"\uFD0B", U"\uFD0B", U"\uFD0B", U"\u0634\u062E", U"\u0634\u062E"},
+	{U"\uFD0C", U"\uFD0C", U"\uFD0C", U"\u0634\u0645", U"\u0634\u0645"},
+	{U"\uFD0D", U"\uFD0D", U"\uFD0D", U"\u0634\u0631", U"\u0634\u0631"},
+	{U"\uFD0E", U"\uFD0E", U"\uFD0E", U"\u0633\u0631", U"\u0633\u0631"},
+	{U"\uFD0F", U"\uFD0F", U"\uFD0F", U"\u0635\u0631", U"\u0635\u0631"},
+	{U"\uFD10", U"\uFD10", U"\uFD10", U"\u0636\u0631", U"\u0636\u0631"},
+	{U"\uFD11", U"\uFD11", U"\uFD11", U"\u0637\u0649", U"\u0637\u0649"},
+	{U"\uFD12", U"\uFD12", U"\uFD12", U"\u0637\u064A", U"\u0637\u064A"},
+	{U"\uFD13", U"\uFD13", U"\uFD13", U"\u0639\u0649", U"\u0639\u0649"},
+	{U"\uFD14", U"\uFD14", U"\uFD14", U"\u0639\u064A", U"\u0639\u064A"},
+	{U"\uFD15", U"\uFD15", U"\uFD15", U"\u063A\u0649", U"\u063A\u0649"},
+	{U"\uFD16", U"\uFD16", U"\uFD16", U"\u063A\u064A", U"\u063A\u064A"},
+	{U"\uFD17", U"\uFD17", U"\uFD17", U"\u0633\u0649", U"\u0633\u0649"},
+	{U"\uFD18", U"\uFD18", U"\uFD18", U"\u0633\u064A", U"\u0633\u064A"},
+	{U"\uFD19", U"\uFD19", U"\uFD19", U"\u0634\u0649", U"\u0634\u0649"},
+	{U"\uFD1A", U"\uFD1A", U"\uFD1A", U"\u0634\u064A", U"\u0634\u064A"},
+	{U"\uFD1B", U"\uFD1B", U"\uFD1B", U"\u062D\u0649", U"\u062D\u0649"},
+	{U"\uFD1C", U"\uFD1C", U"\uFD1C", U"\u062D\u064A", U"\u062D\u064A"},
+	{U"\uFD1D", U"\uFD1D", U"\uFD1D", U"\u062C\u0649", U"\u062C\u0649"},
+	{U"\uFD1E", U"\uFD1E", U"\uFD1E", U"\u062C\u064A", U"\u062C\u064A"},
+	{U"\uFD1F", U"\uFD1F", U"\uFD1F", U"\u062E\u0649", U"\u062E\u0649"},
+	{U"\uFD20", U"\uFD20", U"\uFD20", U"\u062E\u064A", U"\u062E\u064A"},
+	{U"\uFD21", U"\uFD21", U"\uFD21", U"\u0635\u0649", U"\u0635\u0649"},
+	{U"\uFD22", U"\uFD22", U"\uFD22", U"\u0635\u064A", U"\u0635\u064A"},
+	{U"\uFD23", U"\uFD23", U"\uFD23", U"\u0636\u0649", U"\u0636\u0649"},
+	{U"\uFD24", U"\uFD24", U"\uFD24", U"\u0636\u064A", U"\u0636\u064A"},
+	{U"\uFD25", U"\uFD25", U"\uFD25", U"\u0634\u062C", U"\u0634\u062C"},
+	{U"\uFD26", U"\uFD26", U"\uFD26", U"\u0634\u062D", U"\u0634\u062D"},
+	{U"\uFD27", U"\uFD27", U"\uFD27", U"\u0634\u062E", U"\u0634\u062E"},
+	{U"\uFD28", U"\uFD28", U"\uFD28", U"\u0634\u0645", U"\u0634\u0645"},
+	{U"\uFD29", U"\uFD29", U"\uFD29", U"\u0634\u0631", U"\u0634\u0631"},
+	{U"\uFD2A", U"\uFD2A", U"\uFD2A", U"\u0633\u0631", U"\u0633\u0631"},
+	{U"\uFD2B", U"\uFD2B", U"\uFD2B", U"\u0635\u0631", U"\u0635\u0631"},
+	{U"\uFD2C", U"\uFD2C", U"\uFD2C", U"\u0636\u0631", U"\u0636\u0631"},
+	{U"\uFD2D", U"\uFD2D", U"\uFD2D", U"\u0634\u062C", U"\u0634\u062C"},
+	{U"\uFD2E", U"\uFD2E", U"\uFD2E", U"\u0634\u062D", U"\u0634\u062D"},
+	{U"\uFD2F", U"\uFD2F", U"\uFD2F", U"\u0634\u062E", U"\u0634\u062E"},
+	{U"\uFD30", U"\uFD30", U"\uFD30", U"\u0634\u0645", U"\u0634\u0645"},
+	{U"\uFD31", U"\uFD31", U"\uFD31", U"\u0633\u0647", U"\u0633\u0647"},
+	{U"\uFD32", U"\uFD32", U"\uFD32", U"\u0634\u0647", U"\u0634\u0647"},
+	{U"\uFD33", U"\uFD33", U"\uFD33", U"\u0637\u0645", U"\u0637\u0645"},
+	{U"\uFD34", U"\uFD34", U"\uFD34", U"\u0633\u062C", U"\u0633\u062C"},
+	{U"\uFD35", U"\uFD35", U"\uFD35", U"\u0633\u062D", U"\u0633\u062D"},
+	{U"\uFD36", U"\uFD36", U"\uFD36", U"\u0633\u062E", U"\u0633\u062E"},
+	{U"\uFD37", U"\uFD37", U"\uFD37", U"\u0634\u062C", U"\u0634\u062C"},
+	{U"\uFD38", U"\uFD38", U"\uFD38", U"\u0634\u062D", U"\u0634\u062D"},
+	{U"\uFD39", U"\uFD39", U"\uFD39", U"\u0634\u062E", U"\u0634\u062E"},
+	{U"\uFD3A", U"\uFD3A", U"\uFD3A", U"\u0637\u0645", U"\u0637\u0645"},
+	{U"\uFD3B", U"\uFD3B", U"\uFD3B", U"\u0638\u0645", U"\u0638\u0645"},
+	{U"\uFD3C", U"\uFD3C", U"\uFD3C", U"\u0627\u064B", U"\u0627\u064B"},
+	{U"\uFD3D", U"\uFD3D", U"\uFD3D", U"\u0627\u064B", U"\u0627\u064B"},
+	{U"\uFD50", U"\uFD50", U"\uFD50", U"\u062A\u062C\u0645", U"\u062A\u062C\u0645"},
+	{U"\uFD51", U"\uFD51", U"\uFD51", U"\u062A\u062D\u062C", U"\u062A\u062D\u062C"},
+	{U"\uFD52", U"\uFD52", U"\uFD52", U"\u062A\u062D\u062C", U"\u062A\u062D\u062C"},
+	{U"\uFD53", U"\uFD53", U"\uFD53", U"\u062A\u062D\u0645", U"\u062A\u062D\u0645"},
+	{U"\uFD54", U"\uFD54", U"\uFD54", U"\u062A\u062E\u0645", U"\u062A\u062E\u0645"},
+	{U"\uFD55", U"\uFD55", U"\uFD55", U"\u062A\u0645\u062C", U"\u062A\u0645\u062C"},
+	{U"\uFD56", U"\uFD56", U"\uFD56", U"\u062A\u0645\u062D", U"\u062A\u0645\u062D"},
+	{U"\uFD57", U"\uFD57", U"\uFD57", U"\u062A\u0645\u062E", U"\u062A\u0645\u062E"},
+	{U"\uFD58", U"\uFD58", U"\uFD58", U"\u062C\u0645\u062D", U"\u062C\u0645\u062D"},
+	{U"\uFD59", U"\uFD59", U"\uFD59", U"\u062C\u0645\u062D", U"\u062C\u0645\u062D"},
+	{U"\uFD5A", U"\uFD5A", U"\uFD5A", U"\u062D\u0645\u064A", U"\u062D\u0645\u064A"},
+	{U"\uFD5B", U"\uFD5B", U"\uFD5B", U"\u062D\u0645\u0649", U"\u062D\u0645\u0649"},
+	{U"\uFD5C", U"\uFD5C", U"\uFD5C", U"\u0633\u062D\u062C", U"\u0633\u062D\u062C"},
+	{U"\uFD5D", U"\uFD5D", U"\uFD5D", U"\u0633\u062C\u062D", U"\u0633\u062C\u062D"},
+	{U"\uFD5E", U"\uFD5E", U"\uFD5E", U"\u0633\u062C\u0649", U"\u0633\u062C\u0649"},
+	{U"\uFD5F", U"\uFD5F", U"\uFD5F", U"\u0633\u0645\u062D", U"\u0633\u0645\u062D"},
+	{U"\uFD60", U"\uFD60", U"\uFD60", U"\u0633\u0645\u062D", U"\u0633\u0645\u062D"},
+	{U"\uFD61", U"\uFD61", U"\uFD61", U"\u0633\u0645\u062C", U"\u0633\u0645\u062C"},
+	{U"\uFD62", U"\uFD62", U"\uFD62", U"\u0633\u0645\u0645", U"\u0633\u0645\u0645"},
+	{U"\uFD63", U"\uFD63", U"\uFD63", U"\u0633\u0645\u0645", U"\u0633\u0645\u0645"},
+	{U"\uFD64", U"\uFD64", U"\uFD64", U"\u0635\u062D\u062D", U"\u0635\u062D\u062D"},
+	{U"\uFD65", U"\uFD65", U"\uFD65", U"\u0635\u062D\u062D", U"\u0635\u062D\u062D"},
+	{U"\uFD66", U"\uFD66", U"\uFD66", U"\u0635\u0645\u0645", U"\u0635\u0645\u0645"},
+	{U"\uFD67", U"\uFD67", U"\uFD67", U"\u0634\u062D\u0645", U"\u0634\u062D\u0645"},
+	{U"\uFD68", U"\uFD68", U"\uFD68", U"\u0634\u062D\u0645", U"\u0634\u062D\u0645"},
+	{U"\uFD69", U"\uFD69", U"\uFD69", U"\u0634\u062C\u064A", U"\u0634\u062C\u064A"},
+	{U"\uFD6A", U"\uFD6A", U"\uFD6A", U"\u0634\u0645\u062E", U"\u0634\u0645\u062E"},
+	{U"\uFD6B", U"\uFD6B", U"\uFD6B", U"\u0634\u0645\u062E", U"\u0634\u0645\u062E"},
+	{U"\uFD6C", U"\uFD6C", U"\uFD6C", U"\u0634\u0645\u0645", U"\u0634\u0645\u0645"},
+	{U"\uFD6D", U"\uFD6D", U"\uFD6D", U"\u0634\u0645\u0645", U"\u0634\u0645\u0645"},
+	{U"\uFD6E", U"\uFD6E", U"\uFD6E", U"\u0636\u062D\u0649", U"\u0636\u062D\u0649"},
+	{U"\uFD6F", U"\uFD6F", U"\uFD6F", U"\u0636\u062E\u0645", U"\u0636\u062E\u0645"},
+	{U"\uFD70", U"\uFD70", U"\uFD70", U"\u0636\u062E\u0645", U"\u0636\u062E\u0645"},
+	{U"\uFD71", U"\uFD71", U"\uFD71", U"\u0637\u0645\u062D", U"\u0637\u0645\u062D"},
+	{U"\uFD72", U"\uFD72", U"\uFD72", U"\u0637\u0645\u062D", U"\u0637\u0645\u062D"},
+	{U"\uFD73", U"\uFD73", U"\uFD73", U"\u0637\u0645\u0645", U"\u0637\u0645\u0645"},
+	{U"\uFD74", U"\uFD74", U"\uFD74", U"\u0637\u0645\u064A", U"\u0637\u0645\u064A"},
+	{U"\uFD75", U"\uFD75", U"\uFD75", U"\u0639\u062C\u0645", U"\u0639\u062C\u0645"},
+	{U"\uFD76", U"\uFD76", U"\uFD76", U"\u0639\u0645\u0645", U"\u0639\u0645\u0645"},
+	{U"\uFD77", U"\uFD77", U"\uFD77", U"\u0639\u0645\u0645", U"\u0639\u0645\u0645"},
+	{U"\uFD78", U"\uFD78", U"\uFD78", U"\u0639\u0645\u0649", U"\u0639\u0645\u0649"},
+	{U"\uFD79", U"\uFD79", U"\uFD79", U"\u063A\u0645\u0645", U"\u063A\u0645\u0645"},
+	{U"\uFD7A", U"\uFD7A", U"\uFD7A", U"\u063A\u0645\u064A", U"\u063A\u0645\u064A"},
+	{U"\uFD7B", U"\uFD7B", U"\uFD7B", U"\u063A\u0645\u0649", U"\u063A\u0645\u0649"},
+	{U"\uFD7C", U"\uFD7C", U"\uFD7C", U"\u0641\u062E\u0645", U"\u0641\u062E\u0645"},
+	{U"\uFD7D", U"\uFD7D", U"\uFD7D", U"\u0641\u062E\u0645", U"\u0641\u062E\u0645"},
+	{U"\uFD7E", U"\uFD7E", U"\uFD7E", U"\u0642\u0645\u062D", U"\u0642\u0645\u062D"},
+	{U"\uFD7F", U"\uFD7F", U"\uFD7F", U"\u0642\u0645\u0645", U"\u0642\u0645\u0645"},
+	{U"\uFD80", U"\uFD80", U"\uFD80", U"\u0644\u062D\u0645", U"\u0644\u062D\u0645"},
+	{U"\uFD81", U"\uFD81", U"\uFD81", U"\u0644\u062D\u064A", U"\u0644\u062D\u064A"},
+	{U"\uFD82", U"\uFD82", U"\uFD82", U"\u0644\u062D\u0649", U"\u0644\u062D\u0649"},
+	{U"\uFD83", U"\uFD83", U"\uFD83", U"\u0644\u062C\u062C", U"\u0644\u062C\u062C"},
+	{U"\uFD84", U"\uFD84", U"\uFD84", U"\u0644\u062C\u062C", U"\u0644\u062C\u062C"},
+	{U"\uFD85", U"\uFD85", U"\uFD85", U"\u0644\u062E\u0645", U"\u0644\u062E\u0645"},
+	{U"\uFD86", U"\uFD86", U"\uFD86", U"\u0644\u062E\u0645", U"\u0644\u062E\u0645"},
+	{U"\uFD87", U"\uFD87", U"\uFD87", U"\u0644\u0645\u062D", U"\u0644\u0645\u062D"},
+	{U"\uFD88", U"\uFD88", U"\uFD88", U"\u0644\u0645\u062D", U"\u0644\u0645\u062D"},
+	{U"\uFD89", U"\uFD89", U"\uFD89", U"\u0645\u062D\u062C", U"\u0645\u062D\u062C"},
+	{U"\uFD8A", U"\uFD8A", U"\uFD8A", U"\u0645\u062D\u0645", U"\u0645\u062D\u0645"},
+	{U"\uFD8B", U"\uFD8B", U"\uFD8B", U"\u0645\u062D\u064A", U"\u0645\u062D\u064A"},
+	{U"\uFD8C", U"\uFD8C", U"\uFD8C", U"\u0645\u062C\u062D", U"\u0645\u062C\u062D"},
+	{U"\uFD8D", U"\uFD8D", U"\uFD8D", U"\u0645\u062C\u0645", U"\u0645\u062C\u0645"},
+	{U"\uFD8E", U"\uFD8E", U"\uFD8E", U"\u0645\u062E\u062C", U"\u0645\u062E\u062C"},
+	{U"\uFD8F", U"\uFD8F", U"\uFD8F", U"\u0645\u062E\u0645", U"\u0645\u062E\u0645"},
+	{U"\uFD92", U"\uFD92", U"\uFD92", U"\u0645\u062C\u062E", U"\u0645\u062C\u062E"},
+	{U"\uFD93", U"\uFD93", U"\uFD93", U"\u0647\u0645\u062C", U"\u0647\u0645\u062C"},
+	{U"\uFD94", U"\uFD94", U"\uFD94", U"\u0647\u0645\u0645", U"\u0647\u0645\u0645"},
+	{U"\uFD95", U"\uFD95", U"\uFD95", U"\u0646\u062D\u0645", U"\u0646\u062D\u0645"},
+	{U"\uFD96", U"\uFD96", U"\uFD96", U"\u0646\u062D\u0649", U"\u0646\u062D\u0649"},
+	{U"\uFD97", U"\uFD97", U"\uFD97", U"\u0646\u062C\u0645", U"\u0646\u062C\u0645"},
+	{U"\uFD98", U"\uFD98", U"\uFD98", U"\u0646\u062C\u0645", U"\u0646\u062C\u0645"},
+	{U"\uFD99", U"\uFD99", U"\uFD99", U"\u0646\u062C\u0649", U"\u0646\u062C\u0649"},
+	{U"\uFD9A", U"\uFD9A", U"\uFD9A", U"\u0646\u0645\u064A", U"\u0646\u0645\u064A"},
+	{U"\uFD9B", U"\uFD9B", U"\uFD9B", U"\u0646\u0645\u0649", U"\u0646\u0645\u0649"},
+	{U"\uFD9C", U"\uFD9C", U"\uFD9C", U"\u064A\u0645\u0645", U"\u064A\u0645\u0645"},
+	{U"\uFD9D", U"\uFD9D", U"\uFD9D", U"\u064A\u0645\u0645", U"\u064A\u0645\u0645"},
+	{U"\uFD9E", U"\uFD9E", U"\uFD9E", U"\u0628\u062E\u064A", U"\u0628\u062E\u064A"},
+	{U"\uFD9F", U"\uFD9F", U"\uFD9F", U"\u062A\u062C\u064A", U"\u062A\u062C\u064A"},
+	{U"\uFDA0", U"\uFDA0", U"\uFDA0", U"\u062A\u062C\u0649", U"\u062A\u062C\u0649"},
+	{U"\uFDA1", U"\uFDA1", U"\uFDA1", U"\u062A\u062E\u064A", U"\u062A\u062E\u064A"},
+	{U"\uFDA2", U"\uFDA2", U"\uFDA2", U"\u062A\u062E\u0649", U"\u062A\u062E\u0649"},
+	{U"\uFDA3", U"\uFDA3", U"\uFDA3", U"\u062A\u0645\u064A", U"\u062A\u0645\u064A"},
+	{U"\uFDA4", U"\uFDA4", U"\uFDA4", U"\u062A\u0645\u0649", U"\u062A\u0645\u0649"},
+	{U"\uFDA5", U"\uFDA5", U"\uFDA5", U"\u062C\u0645\u064A", U"\u062C\u0645\u064A"},
+	{U"\uFDA6", U"\uFDA6", U"\uFDA6", U"\u062C\u062D\u0649", U"\u062C\u062D\u0649"},
+	{U"\uFDA7", U"\uFDA7", U"\uFDA7", U"\u062C\u0645\u0649", U"\u062C\u0645\u0649"},
+	{U"\uFDA8", U"\uFDA8", U"\uFDA8", U"\u0633\u062E\u0649", U"\u0633\u062E\u0649"},
+	{U"\uFDA9", U"\uFDA9", U"\uFDA9", U"\u0635\u062D\u064A", U"\u0635\u062D\u064A"},
+	{U"\uFDAA", U"\uFDAA", U"\uFDAA", U"\u0634\u062D\u064A", U"\u0634\u062D\u064A"},
+	{U"\uFDAB", U"\uFDAB", U"\uFDAB", U"\u0636\u062D\u064A", U"\u0636\u062D\u064A"},
+	{U"\uFDAC", U"\uFDAC", U"\uFDAC", U"\u0644\u062C\u064A", U"\u0644\u062C\u064A"},
+	{U"\uFDAD", U"\uFDAD", U"\uFDAD", U"\u0644\u0645\u064A", U"\u0644\u0645\u064A"},
+	{U"\uFDAE", U"\uFDAE", U"\uFDAE", U"\u064A\u062D\u064A", U"\u064A\u062D\u064A"},
+	{U"\uFDAF", U"\uFDAF", U"\uFDAF", U"\u064A\u062C\u064A", U"\u064A\u062C\u064A"},
+	{U"\uFDB0", U"\uFDB0", U"\uFDB0", U"\u064A\u0645\u064A", U"\u064A\u0645\u064A"},
+	{U"\uFDB1", U"\uFDB1", U"\uFDB1", U"\u0645\u0645\u064A", U"\u0645\u0645\u064A"},
+	{U"\uFDB2", U"\uFDB2", U"\uFDB2", U"\u0642\u0645\u064A", U"\u0642\u0645\u064A"},
+	{U"\uFDB3", U"\uFDB3", U"\uFDB3", U"\u0646\u062D\u064A", U"\u0646\u062D\u064A"},
+	{U"\uFDB4", U"\uFDB4", U"\uFDB4", U"\u0642\u0645\u062D", U"\u0642\u0645\u062D"},
+	{U"\uFDB5", U"\uFDB5", U"\uFDB5", U"\u0644\u062D\u0645", U"\u0644\u062D\u0645"},
+	{U"\uFDB6", U"\uFDB6", U"\uFDB6", U"\u0639\u0645\u064A", U"\u0639\u0645\u064A"},
+	{U"\uFDB7", U"\uFDB7", U"\uFDB7", U"\u0643\u0645\u064A", U"\u0643\u0645\u064A"},
+	{U"\uFDB8", U"\uFDB8", U"\uFDB8", U"\u0646\u062C\u062D", U"\u0646\u062C\u062D"},
+	{U"\uFDB9", U"\uFDB9", U"\uFDB9", U"\u0645\u062E\u064A", U"\u0645\u062E\u064A"},
+	{U"\uFDBA", U"\uFDBA", U"\uFDBA", U"\u0644\u062C\u0645", U"\u0644\u062C\u0645"},
+	{U"\uFDBB", U"\uFDBB", U"\uFDBB", U"\u0643\u0645\u0645", U"\u0643\u0645\u0645"},
+	{U"\uFDBC", U"\uFDBC", U"\uFDBC", U"\u0644\u062C\u0645", U"\u0644\u062C\u0645"},
+	{U"\uFDBD", U"\uFDBD", U"\uFDBD", U"\u0646\u062C\u062D", U"\u0646\u062C\u062D"},
+	{U"\uFDBE", U"\uFDBE", U"\uFDBE", U"\u062C\u062D\u064A", U"\u062C\u062D\u064A"},
+	{U"\uFDBF", U"\uFDBF", U"\uFDBF", U"\u062D\u062C\u064A", U"\u062D\u062C\u064A"},
+	{U"\uFDC0", U"\uFDC0", U"\uFDC0", U"\u0645\u062C\u064A", U"\u0645\u062C\u064A"},
+	{U"\uFDC1", U"\uFDC1", U"\uFDC1", U"\u0641\u0645\u064A", U"\u0641\u0645\u064A"},
+	{U"\uFDC2", U"\uFDC2", U"\uFDC2", U"\u0628\u062D\u064A", U"\u0628\u062D\u064A"},
+	{U"\uFDC3", U"\uFDC3", U"\uFDC3", U"\u0643\u0645\u0645", U"\u0643\u0645\u0645"},
+	{U"\uFDC4", U"\uFDC4", U"\uFDC4", U"\u0639\u062C\u0645", U"\u0639\u062C\u0645"},
+	{U"\uFDC5", U"\uFDC5", U"\uFDC5", U"\u0635\u0645\u0645", U"\u0635\u0645\u0645"},
+	{U"\uFDC6", U"\uFDC6", U"\uFDC6", U"\u0633\u062E\u064A", U"\u0633\u062E\u064A"},
+	{U"\uFDC7", U"\uFDC7", U"\uFDC7", U"\u0646\u062C\u064A", U"\u0646\u062C\u064A"},
+	{U"\uFDF0", U"\uFDF0", U"\uFDF0", U"\u0635\u0644\u06D2", U"\u0635\u0644\u06D2"},
+	{U"\uFDF1", U"\uFDF1", U"\uFDF1", U"\u0642\u0644\u06D2", U"\u0642\u0644\u06D2"},
+	{U"\uFDF2", U"\uFDF2", U"\uFDF2", U"\u0627\u0644\u0644\u0647", U"\u0627\u0644\u0644\u0647"},
+	{U"\uFDF3", U"\uFDF3", U"\uFDF3", U"\u0627\u0643\u0628\u0631", U"\u0627\u0643\u0628\u0631"},
+	{U"\uFDF4", U"\uFDF4", U"\uFDF4", U"\u0645\u062D\u0645\u062F", U"\u0645\u062D\u0645\u062F"},
+	{U"\uFDF5", U"\uFDF5", U"\uFDF5", U"\u0635\u0644\u0639\u0645", U"\u0635\u0644\u0639\u0645"},
+	{U"\uFDF6", U"\uFDF6", U"\uFDF6", U"\u0631\u0633\u0648\u0644", U"\u0631\u0633\u0648\u0644"},
+	{U"\uFDF7", U"\uFDF7", U"\uFDF7", U"\u0639\u0644\u064A\u0647", U"\u0639\u0644\u064A\u0647"},
+	{U"\uFDF8", U"\uFDF8", U"\uFDF8", U"\u0648\u0633\u0644\u0645", U"\u0648\u0633\u0644\u0645"},
+	{U"\uFDF9", U"\uFDF9", U"\uFDF9", U"\u0635\u0644\u0649", U"\u0635\u0644\u0649"},
+	{U"\uFDFA", U"\uFDFA", U"\uFDFA", U"\u0635\u0644\u0649 \u0627\u0644\u0644\u0647 \u0639\u0644\u064A\u0647 \u0648\u0633\u0644\u0645", U"\u0635\u0644\u0649 \u0627\u0644\u0644\u0647 \u0639\u0644\u064A\u0647 \u0648\u0633\u0644\u0645"},
+	{U"\uFDFB", U"\uFDFB", U"\uFDFB", U"\u062C\u0644 \u062C\u0644\u0627\u0644\u0647", U"\u062C\u0644 \u062C\u0644\u0627\u0644\u0647"},
+	{U"\uFDFC", U"\uFDFC", U"\uFDFC", U"\u0631\u06CC\u0627\u0644", U"\u0631\u06CC\u0627\u0644"},
+	{U"\uFE10", U"\uFE10", U"\uFE10", U",", U","},
+	{U"\uFE11", U"\uFE11", U"\uFE11", U"\u3001", U"\u3001"},
+	{U"\uFE12", U"\uFE12", U"\uFE12", U"\u3002", U"\u3002"},
+	{U"\uFE13", U"\uFE13", U"\uFE13", U":", U":"},
+	{U"\uFE14", U"\uFE14", U"\uFE14", U";", U";"},
+	{U"\uFE15", U"\uFE15", U"\uFE15", U"!", U"!"},
+	{U"\uFE16", U"\uFE16", U"\uFE16", U"?", U"?"},
+	{U"\uFE17", U"\uFE17", U"\uFE17", U"\u3016", U"\u3016"},
+	{U"\uFE18", U"\uFE18", U"\uFE18", U"\u3017", U"\u3017"},
+	{U"\uFE19", U"\uFE19", U"\uFE19", U"...", U"..."},
+	{U"\uFE30", U"\uFE30", U"\uFE30", U"..", U".."},
+	{U"\uFE31", U"\uFE31", U"\uFE31", U"\u2014", U"\u2014"},
+	{U"\uFE32", U"\uFE32", U"\uFE32", U"\u2013", U"\u2013"},
+	{U"\uFE33", U"\uFE33", U"\uFE33", U"_", U"_"},
+	{U"\uFE34", U"\uFE34", U"\uFE34", U"_", U"_"},
+	{U"\uFE35", U"\uFE35", U"\uFE35", U"(", U"("},
+	{U"\uFE36", U"\uFE36", U"\uFE36", U")", U")"},
+	{U"\uFE37", U"\uFE37", U"\uFE37", U"{", U"{"},
+	{U"\uFE38", U"\uFE38", U"\uFE38", U"}", U"}"},
+	{U"\uFE39", U"\uFE39", U"\uFE39", U"\u3014", U"\u3014"},
+	{U"\uFE3A", U"\uFE3A", U"\uFE3A", U"\u3015", U"\u3015"},
+	{U"\uFE3B", U"\uFE3B", U"\uFE3B", U"\u3010", U"\u3010"},
+	{U"\uFE3C", U"\uFE3C", U"\uFE3C", U"\u3011", U"\u3011"},
+	{U"\uFE3D", U"\uFE3D", U"\uFE3D", U"\u300A", U"\u300A"},
+	{U"\uFE3E", U"\uFE3E", U"\uFE3E", U"\u300B", U"\u300B"},
+	{U"\uFE3F", U"\uFE3F", U"\uFE3F", U"\u3008", U"\u3008"},
+	{U"\uFE40", U"\uFE40", U"\uFE40", U"\u3009", U"\u3009"},
+	{U"\uFE41", U"\uFE41", U"\uFE41", U"\u300C", U"\u300C"},
+	{U"\uFE42", U"\uFE42", U"\uFE42", U"\u300D", U"\u300D"},
+	{U"\uFE43", U"\uFE43", U"\uFE43", U"\u300E", U"\u300E"},
+	{U"\uFE44", U"\uFE44", U"\uFE44", U"\u300F", U"\u300F"},
+	{U"\uFE47", U"\uFE47", U"\uFE47", U"[", U"["},
+	{U"\uFE48", U"\uFE48", U"\uFE48", U"]", U"]"},
+	{U"\uFE49", U"\uFE49", U"\uFE49", U" \u0305", U" \u0305"},
+	{U"\uFE4A", U"\uFE4A", U"\uFE4A", U" \u0305", U" \u0305"},
+	{U"\uFE4B", U"\uFE4B", U"\uFE4B", U" \u0305", U" \u0305"},
+	{U"\uFE4C", U"\uFE4C", U"\uFE4C", U" \u0305", U" \u0305"},
+	{U"\uFE4D", U"\uFE4D", U"\uFE4D", U"_", U"_"},
+	{U"\uFE4E", U"\uFE4E", U"\uFE4E", U"_", U"_"},
+	{U"\uFE4F", U"\uFE4F", U"\uFE4F", U"_", U"_"},
+	{U"\uFE50", U"\uFE50", U"\uFE50", U",", U","},
+	{U"\uFE51", U"\uFE51", U"\uFE51", U"\u3001", U"\u3001"},
+	{U"\uFE52", U"\uFE52", U"\uFE52", U".", U"."},
+	{U"\uFE54", U"\uFE54", U"\uFE54", U";", U";"},
+	{U"\uFE55", U"\uFE55", U"\uFE55", U":", U":"},
+	{U"\uFE56", U"\uFE56", U"\uFE56", U"?", U"?"},
+	{U"\uFE57", U"\uFE57", U"\uFE57", U"!", U"!"},
+	{U"\uFE58", U"\uFE58", U"\uFE58", U"\u2014", U"\u2014"},
+	{U"\uFE59", U"\uFE59", U"\uFE59", U"(", U"("},
+	{U"\uFE5A", U"\uFE5A", U"\uFE5A", U")", U")"},
+	{U"\uFE5B", U"\uFE5B", U"\uFE5B", U"{", U"{"},
+	{U"\uFE5C", U"\uFE5C", U"\uFE5C", U"}", U"}"},
+	{U"\uFE5D", U"\uFE5D", U"\uFE5D", U"\u3014", U"\u3014"},
+	{U"\uFE5E", U"\uFE5E", U"\uFE5E", U"\u3015", U"\u3015"},
+	{U"\uFE5F", U"\uFE5F", U"\uFE5F", U"#", U"#"},
+	{U"\uFE60", U"\uFE60", U"\uFE60", U"&", U"&"},
+	{U"\uFE61", U"\uFE61", U"\uFE61", U"*", U"*"},
+	{U"\uFE62", U"\uFE62", U"\uFE62", U"+", U"+"},
+	{U"\uFE63", U"\uFE63", U"\uFE63", U"-", U"-"},
+	{U"\uFE64", U"\uFE64", U"\uFE64", U"<", U"<"},
+	{U"\uFE65", U"\uFE65", U"\uFE65", U">", U">"},
+	{U"\uFE66", U"\uFE66", U"\uFE66", U"=", U"="},
+	{U"\uFE68", U"\uFE68", U"\uFE68", U"\u005C", U"\u005C"},
+	{U"\uFE69", U"\uFE69", U"\uFE69", U"$", U"$"},
+	{U"\uFE6A", U"\uFE6A", U"\uFE6A", U"%", U"%"},
+	{U"\uFE6B", U"\uFE6B", U"\uFE6B", U"@", U"@"},
+	{U"\uFE70", U"\uFE70", U"\uFE70", U" \u064B", U" \u064B"},
+	{U"\uFE71", U"\uFE71", U"\uFE71", U"\u0640\u064B", U"\u0640\u064B"},
+	{U"\uFE72", U"\uFE72", U"\uFE72", U" \u064C", U" \u064C"},
+	{U"\uFE74", U"\uFE74", U"\uFE74", U" \u064D", U" \u064D"},
+	{U"\uFE76", U"\uFE76", U"\uFE76", U" \u064E", U" \u064E"},
+	{U"\uFE77", U"\uFE77", U"\uFE77", U"\u0640\u064E", U"\u0640\u064E"},
+	{U"\uFE78", U"\uFE78", U"\uFE78", U" \u064F", U" \u064F"},
+	{U"\uFE79", U"\uFE79", U"\uFE79", U"\u0640\u064F", U"\u0640\u064F"},
+	{U"\uFE7A", U"\uFE7A", U"\uFE7A", U" \u0650", U" \u0650"},
+	{U"\uFE7B", U"\uFE7B", U"\uFE7B", U"\u0640\u0650", U"\u0640\u0650"},
+	{U"\uFE7C", U"\uFE7C", U"\uFE7C", U" \u0651", U" \u0651"},
+	{U"\uFE7D", U"\uFE7D", U"\uFE7D", U"\u0640\u0651", U"\u0640\u0651"},
+	{U"\uFE7E", U"\uFE7E", U"\uFE7E", U" \u0652", U" \u0652"},
+	{U"\uFE7F", U"\uFE7F", U"\uFE7F", U"\u0640\u0652", U"\u0640\u0652"},
+	{U"\uFE80", U"\uFE80", U"\uFE80", U"\u0621", U"\u0621"},
+	{U"\uFE81", U"\uFE81", U"\uFE81", U"\u0622", U"\u0627\u0653"},
+	{U"\uFE82", U"\uFE82", U"\uFE82", U"\u0622", U"\u0627\u0653"},
+	{U"\uFE83", U"\uFE83", U"\uFE83", U"\u0623", U"\u0627\u0654"},
+	{U"\uFE84", U"\uFE84", U"\uFE84", U"\u0623", U"\u0627\u0654"},
+	{U"\uFE85", U"\uFE85", U"\uFE85", U"\u0624", U"\u0648\u0654"},
+	{U"\uFE86", U"\uFE86", U"\uFE86", U"\u0624", U"\u0648\u0654"},
+	{U"\uFE87", U"\uFE87", U"\uFE87", U"\u0625", U"\u0627\u0655"},
+	{U"\uFE88", U"\uFE88", U"\uFE88", U"\u0625", U"\u0627\u0655"},
+	{U"\uFE89", U"\uFE89", U"\uFE89", U"\u0626", U"\u064A\u0654"},
+	{U"\uFE8A", U"\uFE8A", U"\uFE8A", U"\u0626", U"\u064A\u0654"},
+	{U"\uFE8B", U"\uFE8B", U"\uFE8B", U"\u0626", U"\u064A\u0654"},
+	{U"\uFE8C", U"\uFE8C", U"\uFE8C", U"\u0626", U"\u064A\u0654"},
+	{U"\uFE8D", U"\uFE8D", U"\uFE8D", U"\u0627", U"\u0627"},
+	{U"\uFE8E", U"\uFE8E", U"\uFE8E", U"\u0627", U"\u0627"},
+	{U"\uFE8F", U"\uFE8F", U"\uFE8F", U"\u0628", U"\u0628"},
+	{U"\uFE90", U"\uFE90", U"\uFE90", U"\u0628", U"\u0628"},
+	{U"\uFE91", U"\uFE91", U"\uFE91", U"\u0628", U"\u0628"},
+	{U"\uFE92", U"\uFE92", U"\uFE92", U"\u0628", U"\u0628"},
+	{U"\uFE93", U"\uFE93", U"\uFE93", U"\u0629", U"\u0629"},
+	{U"\uFE94", U"\uFE94", U"\uFE94", U"\u0629", U"\u0629"},
+	{U"\uFE95", U"\uFE95", U"\uFE95", U"\u062A", U"\u062A"},
+	{U"\uFE96", U"\uFE96", U"\uFE96", U"\u062A", U"\u062A"},
+	{U"\uFE97", U"\uFE97", U"\uFE97", U"\u062A", U"\u062A"},
+	{U"\uFE98", U"\uFE98", U"\uFE98", U"\u062A", U"\u062A"},
+	{U"\uFE99", U"\uFE99", U"\uFE99", U"\u062B", U"\u062B"},
+	{U"\uFE9A", U"\uFE9A", U"\uFE9A", U"\u062B", U"\u062B"},
+	{U"\uFE9B", U"\uFE9B", U"\uFE9B", U"\u062B", U"\u062B"},
+	{U"\uFE9C", U"\uFE9C", U"\uFE9C", U"\u062B", U"\u062B"},
+	{U"\uFE9D", U"\uFE9D", U"\uFE9D", U"\u062C", U"\u062C"},
+	{U"\uFE9E", U"\uFE9E", U"\uFE9E", U"\u062C", U"\u062C"},
+	{U"\uFE9F", U"\uFE9F", U"\uFE9F", U"\u062C", U"\u062C"},
+	{U"\uFEA0", U"\uFEA0", U"\uFEA0", U"\u062C", U"\u062C"},
+	{U"\uFEA1", U"\uFEA1", U"\uFEA1", U"\u062D", U"\u062D"},
+	{U"\uFEA2", U"\uFEA2", U"\uFEA2", U"\u062D", U"\u062D"},
+	{U"\uFEA3", U"\uFEA3", U"\uFEA3", U"\u062D", U"\u062D"},
+	{U"\uFEA4", U"\uFEA4", U"\uFEA4", U"\u062D", U"\u062D"},
+	{U"\uFEA5", U"\uFEA5", U"\uFEA5", U"\u062E", U"\u062E"},
+	{U"\uFEA6", U"\uFEA6", U"\uFEA6", U"\u062E", U"\u062E"},
+	{U"\uFEA7", U"\uFEA7", U"\uFEA7", U"\u062E", U"\u062E"},
+	{U"\uFEA8", U"\uFEA8", U"\uFEA8", U"\u062E", U"\u062E"},
+	{U"\uFEA9", U"\uFEA9", U"\uFEA9", U"\u062F", U"\u062F"},
+	{U"\uFEAA", U"\uFEAA", U"\uFEAA", U"\u062F", U"\u062F"},
+	{U"\uFEAB", U"\uFEAB", U"\uFEAB", U"\u0630", U"\u0630"},
+	{U"\uFEAC", U"\uFEAC", U"\uFEAC", U"\u0630", U"\u0630"},
+	{U"\uFEAD", U"\uFEAD", U"\uFEAD", U"\u0631", U"\u0631"},
+	{U"\uFEAE", U"\uFEAE", U"\uFEAE", U"\u0631", U"\u0631"},
+	{U"\uFEAF", U"\uFEAF", U"\uFEAF", U"\u0632", U"\u0632"},
+	{U"\uFEB0", U"\uFEB0", U"\uFEB0", U"\u0632", U"\u0632"},
+	{U"\uFEB1", U"\uFEB1", U"\uFEB1", U"\u0633", U"\u0633"},
+	{U"\uFEB2", U"\uFEB2", U"\uFEB2", U"\u0633", U"\u0633"},
+	{U"\uFEB3", U"\uFEB3", U"\uFEB3", U"\u0633", U"\u0633"},
+	{U"\uFEB4", U"\uFEB4", U"\uFEB4", U"\u0633", U"\u0633"},
+	{U"\uFEB5", U"\uFEB5", U"\uFEB5", U"\u0634", U"\u0634"},
+	{U"\uFEB6", U"\uFEB6", U"\uFEB6", U"\u0634", U"\u0634"},
+	{U"\uFEB7", U"\uFEB7", U"\uFEB7", U"\u0634", U"\u0634"},
+	{U"\uFEB8", U"\uFEB8", U"\uFEB8", U"\u0634", U"\u0634"},
+	{U"\uFEB9", U"\uFEB9", U"\uFEB9", U"\u0635", U"\u0635"},
+	{U"\uFEBA", U"\uFEBA", U"\uFEBA", U"\u0635", U"\u0635"},
+	{U"\uFEBB", U"\uFEBB", U"\uFEBB", U"\u0635", U"\u0635"},
+	{U"\uFEBC", U"\uFEBC", U"\uFEBC", U"\u0635", U"\u0635"},
+	{U"\uFEBD", U"\uFEBD", U"\uFEBD", U"\u0636", U"\u0636"},
+	{U"\uFEBE", U"\uFEBE", U"\uFEBE", U"\u0636", U"\u0636"},
+	{U"\uFEBF", U"\uFEBF", U"\uFEBF", U"\u0636", U"\u0636"},
+	{U"\uFEC0", U"\uFEC0", U"\uFEC0", U"\u0636", U"\u0636"},
+	{U"\uFEC1", U"\uFEC1", U"\uFEC1", U"\u0637", U"\u0637"},
+	{U"\uFEC2", U"\uFEC2", U"\uFEC2", U"\u0637", U"\u0637"},
+	{U"\uFEC3", U"\uFEC3", U"\uFEC3", U"\u0637", U"\u0637"},
+	{U"\uFEC4", U"\uFEC4", U"\uFEC4", U"\u0637", U"\u0637"},
+	{U"\uFEC5", U"\uFEC5", U"\uFEC5", U"\u0638", U"\u0638"},
+	{U"\uFEC6", U"\uFEC6", U"\uFEC6", U"\u0638", U"\u0638"},
+	{U"\uFEC7", U"\uFEC7", U"\uFEC7", U"\u0638", U"\u0638"},
+	{U"\uFEC8", U"\uFEC8", U"\uFEC8", U"\u0638", U"\u0638"},
+	{U"\uFEC9", U"\uFEC9", U"\uFEC9", U"\u0639", U"\u0639"},
+	{U"\uFECA", U"\uFECA", U"\uFECA", U"\u0639", U"\u0639"},
+	{U"\uFECB", U"\uFECB", U"\uFECB", U"\u0639", U"\u0639"},
+	{U"\uFECC", U"\uFECC", U"\uFECC", U"\u0639", U"\u0639"},
+	{U"\uFECD", U"\uFECD", U"\uFECD", U"\u063A", U"\u063A"},
+	{U"\uFECE", U"\uFECE", U"\uFECE", U"\u063A", U"\u063A"},
+	{U"\uFECF", U"\uFECF", U"\uFECF", U"\u063A", U"\u063A"},
+	{U"\uFED0", U"\uFED0", U"\uFED0", U"\u063A", U"\u063A"},
+	{U"\uFED1", U"\uFED1", U"\uFED1", U"\u0641", U"\u0641"},
+	{U"\uFED2", U"\uFED2", U"\uFED2", U"\u0641", U"\u0641"},
+	{U"\uFED3", U"\uFED3", U"\uFED3", U"\u0641", U"\u0641"},
+	{U"\uFED4", U"\uFED4", U"\uFED4", U"\u0641", U"\u0641"},
+	{U"\uFED5", U"\uFED5", U"\uFED5", U"\u0642", U"\u0642"},
+	{U"\uFED6", U"\uFED6", U"\uFED6", U"\u0642", U"\u0642"},
+	{U"\uFED7", U"\uFED7", U"\uFED7", U"\u0642", U"\u0642"},
+	{U"\uFED8", U"\uFED8", U"\uFED8", U"\u0642", U"\u0642"},
+	{U"\uFED9", U"\uFED9", U"\uFED9", U"\u0643", U"\u0643"},
+	{U"\uFEDA", U"\uFEDA", U"\uFEDA", U"\u0643", U"\u0643"},
+	{U"\uFEDB", U"\uFEDB", U"\uFEDB", U"\u0643", U"\u0643"},
+	{U"\uFEDC", U"\uFEDC", U"\uFEDC", U"\u0643", U"\u0643"},
+	{U"\uFEDD", U"\uFEDD", U"\uFEDD", U"\u0644", U"\u0644"},
+	{U"\uFEDE", U"\uFEDE", U"\uFEDE", U"\u0644", U"\u0644"},
+	{U"\uFEDF", U"\uFEDF", U"\uFEDF", U"\u0644", U"\u0644"},
+	{U"\uFEE0", U"\uFEE0", U"\uFEE0", U"\u0644", U"\u0644"},
+	{U"\uFEE1", U"\uFEE1", U"\uFEE1", U"\u0645", U"\u0645"},
+	{U"\uFEE2", U"\uFEE2", U"\uFEE2", U"\u0645", U"\u0645"},
+	{U"\uFEE3", U"\uFEE3", U"\uFEE3", U"\u0645", U"\u0645"},
+	{U"\uFEE4", U"\uFEE4", U"\uFEE4", U"\u0645", U"\u0645"},
+	{U"\uFEE5", U"\uFEE5", U"\uFEE5", U"\u0646", U"\u0646"},
+	{U"\uFEE6", U"\uFEE6", U"\uFEE6", U"\u0646", U"\u0646"},
+	{U"\uFEE7", U"\uFEE7", U"\uFEE7", U"\u0646", U"\u0646"},
+	{U"\uFEE8", U"\uFEE8", U"\uFEE8", U"\u0646", U"\u0646"},
+	{U"\uFEE9", U"\uFEE9", U"\uFEE9", U"\u0647", U"\u0647"},
+	{U"\uFEEA", U"\uFEEA", U"\uFEEA", U"\u0647", U"\u0647"},
+	{U"\uFEEB", U"\uFEEB", U"\uFEEB", U"\u0647", U"\u0647"},
+	{U"\uFEEC", U"\uFEEC", U"\uFEEC", U"\u0647", U"\u0647"},
+	{U"\uFEED", U"\uFEED", U"\uFEED", U"\u0648", U"\u0648"},
+	{U"\uFEEE", U"\uFEEE", U"\uFEEE", U"\u0648", U"\u0648"},
+	{U"\uFEEF", U"\uFEEF", U"\uFEEF", U"\u0649", U"\u0649"},
+	{U"\uFEF0", U"\uFEF0", U"\uFEF0", U"\u0649", U"\u0649"},
+	{U"\uFEF1", U"\uFEF1", U"\uFEF1", U"\u064A", U"\u064A"},
+	{U"\uFEF2", U"\uFEF2", U"\uFEF2", U"\u064A", U"\u064A"},
+	{U"\uFEF3", U"\uFEF3", U"\uFEF3", U"\u064A", U"\u064A"},
+	{U"\uFEF4", U"\uFEF4", U"\uFEF4", U"\u064A", U"\u064A"},
+	{U"\uFEF5", U"\uFEF5", U"\uFEF5", U"\u0644\u0622", U"\u0644\u0627\u0653"},
+	{U"\uFEF6", U"\uFEF6", U"\uFEF6", U"\u0644\u0622", U"\u0644\u0627\u0653"},
+	{U"\uFEF7", U"\uFEF7", U"\uFEF7", U"\u0644\u0623", U"\u0644\u0627\u0654"},
+	{U"\uFEF8", U"\uFEF8", U"\uFEF8", U"\u0644\u0623", U"\u0644\u0627\u0654"},
+	{U"\uFEF9", U"\uFEF9", U"\uFEF9", U"\u0644\u0625", U"\u0644\u0627\u0655"},
+	{U"\uFEFA", U"\uFEFA", U"\uFEFA", U"\u0644\u0625", U"\u0644\u0627\u0655"},
+	{U"\uFEFB", U"\uFEFB", U"\uFEFB", U"\u0644\u0627", U"\u0644\u0627"},
+	{U"\uFEFC", U"\uFEFC", U"\uFEFC", U"\u0644\u0627", U"\u0644\u0627"},
+	{U"\uFF01", U"\uFF01", U"\uFF01", U"!", U"!"},
+	{U"\uFF02", U"\uFF02", U"\uFF02", U"\u0022", U"\u0022"},
+	{U"\uFF03", U"\uFF03", U"\uFF03", U"#", U"#"},
+	{U"\uFF04", U"\uFF04", U"\uFF04", U"$", U"$"},
+	{U"\uFF05", U"\uFF05", U"\uFF05", U"%", U"%"},
+	{U"\uFF06", U"\uFF06", U"\uFF06", U"&", U"&"},
+	{U"\uFF07", U"\uFF07", U"\uFF07", U"'", U"'"},
+	{U"\uFF08", U"\uFF08", U"\uFF08", U"(", U"("},
+	{U"\uFF09", U"\uFF09", U"\uFF09", U")", U")"},
+	{U"\uFF0A", U"\uFF0A", U"\uFF0A", U"*", U"*"},
+	{U"\uFF0B", U"\uFF0B", U"\uFF0B", U"+", U"+"},
+	{U"\uFF0C", U"\uFF0C", U"\uFF0C", U",", U","},
+	{U"\uFF0D", U"\uFF0D", U"\uFF0D", U"-", U"-"},
+	{U"\uFF0E", U"\uFF0E", U"\uFF0E", U".", U"."},
+	{U"\uFF0F", U"\uFF0F", U"\uFF0F", U"/", U"/"},
+	{U"\uFF10", U"\uFF10", U"\uFF10", U"0", U"0"},
+	{U"\uFF11", U"\uFF11", U"\uFF11", U"1", U"1"},
+	{U"\uFF12", U"\uFF12", U"\uFF12", U"2", U"2"},
+	{U"\uFF13", U"\uFF13", U"\uFF13", U"3", U"3"},
+	{U"\uFF14", U"\uFF14", U"\uFF14", U"4", U"4"},
+	{U"\uFF15", U"\uFF15", U"\uFF15", U"5", U"5"},
+	{U"\uFF16", U"\uFF16", U"\uFF16", U"6", U"6"},
+	{U"\uFF17", U"\uFF17", U"\uFF17", U"7", U"7"},
+	{U"\uFF18", U"\uFF18", U"\uFF18", U"8", U"8"},
+	{U"\uFF19", U"\uFF19", U"\uFF19", U"9", U"9"},
+	{U"\uFF1A", U"\uFF1A", U"\uFF1A", U":", U":"},
+	{U"\uFF1B", U"\uFF1B", U"\uFF1B", U";", U";"},
+	{U"\uFF1C", U"\uFF1C", U"\uFF1C", U"<", U"<"},
+	{U"\uFF1D", U"\uFF1D", U"\uFF1D", U"=", U"="},
+	{U"\uFF1E", U"\uFF1E", U"\uFF1E", U">", U">"},
+	{U"\uFF1F", U"\uFF1F", U"\uFF1F", U"?", U"?"},
+	{U"\uFF20", U"\uFF20", U"\uFF20", U"@", U"@"},
+	{U"\uFF21", U"\uFF21", U"\uFF21", U"A", U"A"},
+	{U"\uFF22", U"\uFF22", U"\uFF22", U"B", U"B"},
+	{U"\uFF23", U"\uFF23", U"\uFF23", U"C", U"C"},
+	{U"\uFF24", U"\uFF24", U"\uFF24", U"D", U"D"},
+	{U"\uFF25", U"\uFF25", U"\uFF25", U"E", U"E"},
+	{U"\uFF26", U"\uFF26", U"\uFF26", U"F", U"F"},
+	{U"\uFF27", U"\uFF27", U"\uFF27", U"G", U"G"},
+	{U"\uFF28", U"\uFF28", U"\uFF28", U"H", U"H"},
+	{U"\uFF29", U"\uFF29", U"\uFF29", U"I", U"I"},
+	{U"\uFF2A", U"\uFF2A", U"\uFF2A", U"J", U"J"},
+	{U"\uFF2B", U"\uFF2B", U"\uFF2B", U"K", U"K"},
+	{U"\uFF2C", U"\uFF2C", U"\uFF2C", U"L", U"L"},
+	{U"\uFF2D", U"\uFF2D", U"\uFF2D", U"M", U"M"},
+	{U"\uFF2E", U"\uFF2E", U"\uFF2E", U"N", U"N"},
+	{U"\uFF2F", U"\uFF2F", U"\uFF2F", U"O", U"O"},
+	{U"\uFF30", U"\uFF30", U"\uFF30", U"P", U"P"},
+	{U"\uFF31", U"\uFF31", U"\uFF31", U"Q", U"Q"},
+	{U"\uFF32", U"\uFF32", U"\uFF32", U"R", U"R"},
+	{U"\uFF33", U"\uFF33", U"\uFF33", U"S", U"S"},
+	{U"\uFF34", U"\uFF34", U"\uFF34", U"T", U"T"},
+	{U"\uFF35", U"\uFF35", U"\uFF35", U"U", U"U"},
+	{U"\uFF36", U"\uFF36", U"\uFF36", U"V", U"V"},
+	{U"\uFF37", U"\uFF37", U"\uFF37", U"W", U"W"},
+	{U"\uFF38", U"\uFF38", U"\uFF38", U"X", U"X"},
+	{U"\uFF39", U"\uFF39", U"\uFF39", U"Y", U"Y"},
+	{U"\uFF3A", U"\uFF3A", U"\uFF3A", U"Z", U"Z"},
+	{U"\uFF3B", U"\uFF3B", U"\uFF3B", U"[", U"["},
+	{U"\uFF3C", U"\uFF3C", U"\uFF3C", U"\u005C", U"\u005C"},
+	{U"\uFF3D", U"\uFF3D", U"\uFF3D", U"]", U"]"},
+	{U"\uFF3E", U"\uFF3E", U"\uFF3E", U"^", U"^"},
+	{U"\uFF3F", U"\uFF3F", U"\uFF3F", U"_", U"_"},
+	{U"\uFF40", U"\uFF40", U"\uFF40", U"`", U"`"},
+	{U"\uFF41", U"\uFF41", U"\uFF41", U"a", U"a"},
+	{U"\uFF42", U"\uFF42", U"\uFF42", U"b", U"b"},
+	{U"\uFF43", U"\uFF43", U"\uFF43", U"c", U"c"},
+	{U"\uFF44", U"\uFF44", U"\uFF44", U"d", U"d"},
+	{U"\uFF45", U"\uFF45", U"\uFF45", U"e", U"e"},
+	{U"\uFF46", U"\uFF46", U"\uFF46", U"f", U"f"},
+	{U"\uFF47", U"\uFF47", U"\uFF47", U"g", U"g"},
+	{U"\uFF48", U"\uFF48", U"\uFF48", U"h", U"h"},
+	{U"\uFF49", U"\uFF49", U"\uFF49", U"i", U"i"},
+	{U"\uFF4A", U"\uFF4A", U"\uFF4A", U"j", U"j"},
+	{U"\uFF4B", U"\uFF4B", U"\uFF4B", U"k", U"k"},
+	{U"\uFF4C", U"\uFF4C", U"\uFF4C", U"l", U"l"},
+	{U"\uFF4D", U"\uFF4D", U"\uFF4D", U"m", U"m"},
+	{U"\uFF4E", U"\uFF4E", U"\uFF4E", U"n", U"n"},
+	{U"\uFF4F", U"\uFF4F", U"\uFF4F", U"o", U"o"},
+	{U"\uFF50", U"\uFF50", U"\uFF50", U"p", U"p"},
+	{U"\uFF51", U"\uFF51", U"\uFF51", U"q", U"q"},
+	{U"\uFF52", U"\uFF52", U"\uFF52", U"r", U"r"},
+	{U"\uFF53", U"\uFF53", U"\uFF53", U"s", U"s"},
+	{U"\uFF54", U"\uFF54", U"\uFF54", U"t", U"t"},
+	{U"\uFF55", U"\uFF55", U"\uFF55", U"u", U"u"},
+	{U"\uFF56", U"\uFF56", U"\uFF56", U"v", U"v"},
+	{U"\uFF57", U"\uFF57", U"\uFF57", U"w", U"w"},
+	{U"\uFF58", U"\uFF58", U"\uFF58", U"x", U"x"},
+	{U"\uFF59", U"\uFF59", U"\uFF59", U"y", U"y"},
+	{U"\uFF5A", U"\uFF5A", U"\uFF5A", U"z", U"z"},
+	{U"\uFF5B", U"\uFF5B", U"\uFF5B", U"{", U"{"},
+	{U"\uFF5C", U"\uFF5C", U"\uFF5C", U"|", U"|"},
+	{U"\uFF5D", U"\uFF5D", U"\uFF5D", U"}", U"}"},
+	{U"\uFF5E", U"\uFF5E", U"\uFF5E", U"~", U"~"},
+	{U"\uFF5F", U"\uFF5F", U"\uFF5F", U"\u2985", U"\u2985"},
+	{U"\uFF60", U"\uFF60", U"\uFF60", U"\u2986", U"\u2986"},
+	{U"\uFF61", U"\uFF61", U"\uFF61", U"\u3002", U"\u3002"},
+	{U"\uFF62", U"\uFF62", U"\uFF62", U"\u300C", U"\u300C"},
+	{U"\uFF63", U"\uFF63", U"\uFF63", U"\u300D", U"\u300D"},
+	{U"\uFF64", U"\uFF64", U"\uFF64", U"\u3001", U"\u3001"},
+	{U"\uFF65", U"\uFF65", U"\uFF65", U"\u30FB", U"\u30FB"},
+	{U"\uFF66", U"\uFF66", U"\uFF66", U"\u30F2", U"\u30F2"},
+	{U"\uFF67", U"\uFF67", U"\uFF67", U"\u30A1", U"\u30A1"},
+	{U"\uFF68", U"\uFF68", U"\uFF68", U"\u30A3", U"\u30A3"},
+	{U"\uFF69", U"\uFF69", U"\uFF69", U"\u30A5", U"\u30A5"},
+	{U"\uFF6A", U"\uFF6A", U"\uFF6A", U"\u30A7", U"\u30A7"},
+	{U"\uFF6B", U"\uFF6B", U"\uFF6B", U"\u30A9", U"\u30A9"},
+	{U"\uFF6C", U"\uFF6C", U"\uFF6C", U"\u30E3", U"\u30E3"},
+	{U"\uFF6D", U"\uFF6D", U"\uFF6D", U"\u30E5", U"\u30E5"},
+	{U"\uFF6E", U"\uFF6E", U"\uFF6E", U"\u30E7", U"\u30E7"},
+	{U"\uFF6F", U"\uFF6F", U"\uFF6F", U"\u30C3", U"\u30C3"},
+	{U"\uFF70", U"\uFF70", U"\uFF70", U"\u30FC", U"\u30FC"},
+	{U"\uFF71", U"\uFF71", U"\uFF71", U"\u30A2", U"\u30A2"},
+	{U"\uFF72", U"\uFF72", U"\uFF72", U"\u30A4", U"\u30A4"},
+	{U"\uFF73", U"\uFF73", U"\uFF73", U"\u30A6", U"\u30A6"},
+	{U"\uFF74", U"\uFF74", U"\uFF74", U"\u30A8", U"\u30A8"},
+	{U"\uFF75", U"\uFF75", U"\uFF75", U"\u30AA", U"\u30AA"},
+	{U"\uFF76", U"\uFF76", U"\uFF76", U"\u30AB", U"\u30AB"},
+	{U"\uFF77", U"\uFF77", U"\uFF77", U"\u30AD", U"\u30AD"},
+	{U"\uFF78", U"\uFF78", U"\uFF78", U"\u30AF", U"\u30AF"},
+	{U"\uFF79", U"\uFF79", U"\uFF79", U"\u30B1", U"\u30B1"},
+	{U"\uFF7A", U"\uFF7A", U"\uFF7A", U"\u30B3", U"\u30B3"},
+	{U"\uFF7B", U"\uFF7B", U"\uFF7B", U"\u30B5", U"\u30B5"},
+	{U"\uFF7C", U"\uFF7C", U"\uFF7C", U"\u30B7", U"\u30B7"},
+	{U"\uFF7D", U"\uFF7D", U"\uFF7D", U"\u30B9", U"\u30B9"},
+	{U"\uFF7E", U"\uFF7E", U"\uFF7E", U"\u30BB", U"\u30BB"},
+	{U"\uFF7F", U"\uFF7F", U"\uFF7F", U"\u30BD", U"\u30BD"},
+	{U"\uFF80", U"\uFF80", U"\uFF80", U"\u30BF", U"\u30BF"},
+	{U"\uFF81", U"\uFF81", U"\uFF81", U"\u30C1", U"\u30C1"},
+	{U"\uFF82", U"\uFF82", U"\uFF82", U"\u30C4", U"\u30C4"},
+	{U"\uFF83", U"\uFF83", U"\uFF83", U"\u30C6", U"\u30C6"},
+	{U"\uFF84", U"\uFF84", U"\uFF84", U"\u30C8", U"\u30C8"},
+	{U"\uFF85", U"\uFF85", U"\uFF85", U"\u30CA", U"\u30CA"},
+	{U"\uFF86", U"\uFF86", U"\uFF86", U"\u30CB", U"\u30CB"},
+	{U"\uFF87", U"\uFF87", U"\uFF87", U"\u30CC", U"\u30CC"},
+	{U"\uFF88", U"\uFF88", U"\uFF88", U"\u30CD", U"\u30CD"},
+	{U"\uFF89", U"\uFF89", U"\uFF89", U"\u30CE", U"\u30CE"},
+	{U"\uFF8A", U"\uFF8A", U"\uFF8A", U"\u30CF", U"\u30CF"},
+	{U"\uFF8B", U"\uFF8B", U"\uFF8B", U"\u30D2", U"\u30D2"},
+	{U"\uFF8C", U"\uFF8C", U"\uFF8C", U"\u30D5", U"\u30D5"},
+	{U"\uFF8D", U"\uFF8D", U"\uFF8D", U"\u30D8", U"\u30D8"},
+	{U"\uFF8E", U"\uFF8E", U"\uFF8E", U"\u30DB", U"\u30DB"},
+	{U"\uFF8F", U"\uFF8F", U"\uFF8F", U"\u30DE", U"\u30DE"},
+	{U"\uFF90", U"\uFF90", U"\uFF90", U"\u30DF", U"\u30DF"},
+	{U"\uFF91", U"\uFF91", U"\uFF91", U"\u30E0", U"\u30E0"},
+	{U"\uFF92", U"\uFF92", U"\uFF92", U"\u30E1", U"\u30E1"},
+	{U"\uFF93", U"\uFF93", U"\uFF93", U"\u30E2", U"\u30E2"},
+	{U"\uFF94", U"\uFF94", U"\uFF94", U"\u30E4", U"\u30E4"},
+	{U"\uFF95", U"\uFF95", U"\uFF95", U"\u30E6", U"\u30E6"},
+	{U"\uFF96", U"\uFF96", U"\uFF96", U"\u30E8", U"\u30E8"},
+	{U"\uFF97", U"\uFF97", U"\uFF97", U"\u30E9", U"\u30E9"},
+	{U"\uFF98", U"\uFF98", U"\uFF98", U"\u30EA", U"\u30EA"},
+	{U"\uFF99", U"\uFF99", U"\uFF99", U"\u30EB", U"\u30EB"},
+	{U"\uFF9A", U"\uFF9A", U"\uFF9A", U"\u30EC", U"\u30EC"},
+	{U"\uFF9B", U"\uFF9B", U"\uFF9B", U"\u30ED", U"\u30ED"},
+	{U"\uFF9C", U"\uFF9C", U"\uFF9C", U"\u30EF", U"\u30EF"},
+	{U"\uFF9D", U"\uFF9D", U"\uFF9D", U"\u30F3", U"\u30F3"},
+	{U"\uFF9E", U"\uFF9E", U"\uFF9E", U"\u3099", U"\u3099"},
+	{U"\uFF9F", U"\uFF9F", U"\uFF9F", U"\u309A", U"\u309A"},
+	{U"\uFFA0", U"\uFFA0", U"\uFFA0", U"\u1160", U"\u1160"},
+	{U"\uFFA1", U"\uFFA1", U"\uFFA1", U"\u1100", U"\u1100"},
+	{U"\uFFA2", U"\uFFA2", U"\uFFA2", U"\u1101", U"\u1101"},
+	{U"\uFFA3", U"\uFFA3", U"\uFFA3", U"\u11AA", U"\u11AA"},
+	{U"\uFFA4", U"\uFFA4", U"\uFFA4", U"\u1102", U"\u1102"},
+	{U"\uFFA5", U"\uFFA5", U"\uFFA5", U"\u11AC", U"\u11AC"},
+	{U"\uFFA6", U"\uFFA6", U"\uFFA6", U"\u11AD", U"\u11AD"},
+	{U"\uFFA7", U"\uFFA7", U"\uFFA7", U"\u1103", U"\u1103"},
+	{U"\uFFA8", U"\uFFA8", U"\uFFA8", U"\u1104", U"\u1104"},
+	{U"\uFFA9", U"\uFFA9", U"\uFFA9", U"\u1105", U"\u1105"},
+	{U"\uFFAA", U"\uFFAA", U"\uFFAA", U"\u11B0", U"\u11B0"},
+	{U"\uFFAB", U"\uFFAB", U"\uFFAB", U"\u11B1", U"\u11B1"},
+	{U"\uFFAC", U"\uFFAC", U"\uFFAC", U"\u11B2", U"\u11B2"},
+	{U"\uFFAD", U"\uFFAD", U"\uFFAD", U"\u11B3", U"\u11B3"},
+	{U"\uFFAE", U"\uFFAE", U"\uFFAE", U"\u11B4", U"\u11B4"},
+	{U"\uFFAF", U"\uFFAF", U"\uFFAF", U"\u11B5", U"\u11B5"},
+	{U"\uFFB0", U"\uFFB0", U"\uFFB0", U"\u111A", U"\u111A"},
+	{U"\uFFB1", U"\uFFB1", U"\uFFB1", U"\u1106", U"\u1106"},
+	{U"\uFFB2", U"\uFFB2", U"\uFFB2", U"\u1107", U"\u1107"},
+	{U"\uFFB3", U"\uFFB3", U"\uFFB3", U"\u1108", U"\u1108"},
+	{U"\uFFB4", U"\uFFB4", U"\uFFB4", U"\u1121", U"\u1121"},
+	{U"\uFFB5", U"\uFFB5", U"\uFFB5", U"\u1109", U"\u1109"},
+	{U"\uFFB6", U"\uFFB6", U"\uFFB6", U"\u110A", U"\u110A"},
+	{U"\uFFB7", U"\uFFB7", U"\uFFB7", U"\u110B", U"\u110B"},
+	{U"\uFFB8", U"\uFFB8", U"\uFFB8", U"\u110C", U"\u110C"},
+	{U"\uFFB9", U"\uFFB9", U"\uFFB9", U"\u110D", U"\u110D"},
+	{U"\uFFBA", U"\uFFBA", U"\uFFBA", U"\u110E", U"\u110E"},
+	{U"\uFFBB", U"\uFFBB", U"\uFFBB", U"\u110F", U"\u110F"},
+	{U"\uFFBC", U"\uFFBC", U"\uFFBC", U"\u1110", U"\u1110"},
+	{U"\uFFBD", U"\uFFBD", U"\uFFBD", U"\u1111", U"\u1111"},
+	{U"\uFFBE", U"\uFFBE", U"\uFFBE", U"\u1112", U"\u1112"},
+	{U"\uFFC2", U"\uFFC2", U"\uFFC2", U"\u1161", U"\u1161"},
+	{U"\uFFC3", U"\uFFC3", U"\uFFC3", U"\u1162", U"\u1162"},
+	{U"\uFFC4", U"\uFFC4", U"\uFFC4", U"\u1163", U"\u1163"},
+	{U"\uFFC5", U"\uFFC5", U"\uFFC5", U"\u1164", U"\u1164"},
+	{U"\uFFC6", U"\uFFC6", U"\uFFC6", U"\u1165", U"\u1165"},
+	{U"\uFFC7", U"\uFFC7", U"\uFFC7", U"\u1166", U"\u1166"},
+	{U"\uFFCA", U"\uFFCA", U"\uFFCA", U"\u1167", U"\u1167"},
+	{U"\uFFCB", U"\uFFCB", U"\uFFCB", U"\u1168", U"\u1168"},
+	{U"\uFFCC", U"\uFFCC", U"\uFFCC", U"\u1169", U"\u1169"},
+	{U"\uFFCD", U"\uFFCD", U"\uFFCD", U"\u116A", U"\u116A"},
+	{U"\uFFCE", U"\uFFCE", U"\uFFCE", U"\u116B", U"\u116B"},
+	{U"\uFFCF", U"\uFFCF", U"\uFFCF", U"\u116C", U"\u116C"},
+	{U"\uFFD2", U"\uFFD2", U"\uFFD2", U"\u116D", U"\u116D"},
+	{U"\uFFD3", U"\uFFD3", U"\uFFD3", U"\u116E", U"\u116E"},
+	{U"\uFFD4", U"\uFFD4", U"\uFFD4", U"\u116F", U"\u116F"},
+	{U"\uFFD5", U"\uFFD5", U"\uFFD5", U"\u1170", U"\u1170"},
+	{U"\uFFD6", U"\uFFD6", U"\uFFD6", U"\u1171", U"\u1171"},
+	{U"\uFFD7", U"\uFFD7", U"\uFFD7", U"\u1172", U"\u1172"},
+	{U"\uFFDA", U"\uFFDA", U"\uFFDA", U"\u1173", U"\u1173"},
+	{U"\uFFDB", U"\uFFDB", U"\uFFDB", U"\u1174", U"\u1174"},
+	{U"\uFFDC", U"\uFFDC", U"\uFFDC", U"\u1175", U"\u1175"},
+	{U"\uFFE0", U"\uFFE0", U"\uFFE0", U"\u00A2", U"\u00A2"},
+	{U"\uFFE1", U"\uFFE1", U"\uFFE1", U"\u00A3", U"\u00A3"},
+	{U"\uFFE2", U"\uFFE2", U"\uFFE2", U"\u00AC", U"\u00AC"},
+	{U"\uFFE3", U"\uFFE3", U"\uFFE3", U" \u0304", U" \u0304"},
+	{U"\uFFE4", U"\uFFE4", U"\uFFE4", U"\u00A6", U"\u00A6"},
+	{U"\uFFE5", U"\uFFE5", U"\uFFE5", U"\u00A5", U"\u00A5"},
+	{U"\uFFE6", U"\uFFE6", U"\uFFE6", U"\u20A9", U"\u20A9"},
+	{U"\uFFE8", U"\uFFE8", U"\uFFE8", U"\u2502", U"\u2502"},
+	{U"\uFFE9", U"\uFFE9", U"\uFFE9", U"\u2190", U"\u2190"},
+	{U"\uFFEA", U"\uFFEA", U"\uFFEA", U"\u2191", U"\u2191"},
+	{U"\uFFEB", U"\uFFEB", U"\uFFEB", U"\u2192", U"\u2192"},
+	{U"\uFFEC", U"\uFFEC", U"\uFFEC", U"\u2193", U"\u2193"},
+	{U"\uFFED", U"\uFFED", U"\uFFED", U"\u25A0", U"\u25A0"},
+	{U"\uFFEE", U"\uFFEE", U"\uFFEE", U"\u25CB", U"\u25CB"},
+	{U"\U00010781", U"\U00010781", U"\U00010781", U"\u02D0", U"\u02D0"},
+	{U"\U00010782", U"\U00010782", U"\U00010782", U"\u02D1", U"\u02D1"},
+	{U"\U00010783", U"\U00010783", U"\U00010783", U"\u00E6", U"\u00E6"},
+	{U"\U00010784", U"\U00010784", U"\U00010784", U"\u0299", U"\u0299"},
+	{U"\U00010785", U"\U00010785", U"\U00010785", U"\u0253", U"\u0253"},
+	{U"\U00010787", U"\U00010787", U"\U00010787", U"\u02A3", U"\u02A3"},
+	{U"\U00010788", U"\U00010788", U"\U00010788", U"\uAB66", U"\uAB66"},
+	{U"\U00010789", U"\U00010789", U"\U00010789", U"\u02A5", U"\u02A5"},
+	{U"\U0001078A", U"\U0001078A", U"\U0001078A", U"\u02A4", U"\u02A4"},
+	{U"\U0001078B", U"\U0001078B", U"\U0001078B", U"\u0256", U"\u0256"},
+	{U"\U0001078C", U"\U0001078C", U"\U0001078C", U"\u0257", U"\u0257"},
+	{U"\U0001078D", U"\U0001078D", U"\U0001078D", U"\u1D91", U"\u1D91"},
+	{U"\U0001078E", U"\U0001078E", U"\U0001078E", U"\u0258", U"\u0258"},
+	{U"\U0001078F", U"\U0001078F", U"\U0001078F", U"\u025E", U"\u025E"},
+	{U"\U00010790", U"\U00010790", U"\U00010790", U"\u02A9", U"\u02A9"},
+	{U"\U00010791", U"\U00010791", U"\U00010791", U"\u0264", U"\u0264"},
+	{U"\U00010792", U"\U00010792", U"\U00010792", U"\u0262", U"\u0262"},
+	{U"\U00010793", U"\U00010793", U"\U00010793", U"\u0260", U"\u0260"},
+	{U"\U00010794", U"\U00010794", U"\U00010794", U"\u029B", U"\u029B"},
+	{U"\U00010795", U"\U00010795", U"\U00010795", U"\u0127", U"\u0127"},
+	{U"\U00010796", U"\U00010796", U"\U00010796", U"\u029C", U"\u029C"},
+	{U"\U00010797", U"\U00010797", U"\U00010797", U"\u0267", U"\u0267"},
+	{U"\U00010798", U"\U00010798", U"\U00010798", U"\u0284", U"\u0284"},
+	{U"\U00010799", U"\U00010799", U"\U00010799", U"\u02AA", U"\u02AA"},
+	{U"\U0001079A", U"\U0001079A", U"\U0001079A", U"\u02AB", U"\u02AB"},
+	{U"\U0001079B", U"\U0001079B", U"\U0001079B", U"\u026C", U"\u026C"},
+	{U"\U0001079C", U"\U0001079C", U"\U0001079C", U"\U0001DF04", U"\U0001DF04"},
+	{U"\U0001079D", U"\U0001079D", U"\U0001079D", U"\uA78E", U"\uA78E"},
+	{U"\U0001079E", U"\U0001079E", U"\U0001079E", U"\u026E", U"\u026E"},
+	{U"\U0001079F", U"\U0001079F", U"\U0001079F", U"\U0001DF05", U"\U0001DF05"},
+	{U"\U000107A0", U"\U000107A0", U"\U000107A0", U"\u028E", U"\u028E"},
+	{U"\U000107A1", U"\U000107A1", U"\U000107A1", U"\U0001DF06", U"\U0001DF06"},
+	{U"\U000107A2", U"\U000107A2", U"\U000107A2", U"\u00F8", U"\u00F8"},
+	{U"\U000107A3", U"\U000107A3", U"\U000107A3", U"\u0276", U"\u0276"},
+	{U"\U000107A4", U"\U000107A4", U"\U000107A4", U"\u0277", U"\u0277"},
+	{U"\U000107A5", U"\U000107A5", U"\U000107A5", U"q", U"q"},
+	{U"\U000107A6", U"\U000107A6", U"\U000107A6", U"\u027A", U"\u027A"},
+	{U"\U000107A7", U"\U000107A7", U"\U000107A7", U"\U0001DF08", U"\U0001DF08"},
+	{U"\U000107A8", U"\U000107A8", U"\U000107A8", U"\u027D", U"\u027D"},
+	{U"\U000107A9", U"\U000107A9", U"\U000107A9", U"\u027E", U"\u027E"},
+	{U"\U000107AA", U"\U000107AA", U"\U000107AA", U"\u0280", U"\u0280"},
+	{U"\U000107AB", U"\U000107AB", U"\U000107AB", U"\u02A8", U"\u02A8"},
+	{U"\U000107AC", U"\U000107AC", U"\U000107AC", U"\u02A6", U"\u02A6"},
+	{U"\U000107AD", U"\U000107AD", U"\U000107AD", U"\uAB67", U"\uAB67"},
+	{U"\U000107AE", U"\U000107AE", U"\U000107AE", U"\u02A7", U"\u02A7"},
+	{U"\U000107AF", U"\U000107AF", U"\U000107AF", U"\u0288", U"\u0288"},
+	{U"\U000107B0", U"\U000107B0", U"\U000107B0", U"\u2C71", U"\u2C71"},
+	{U"\U000107B2", U"\U000107B2", U"\U000107B2", U"\u028F", U"\u028F"},
+	{U"\U000107B3", U"\U000107B3", U"\U000107B3", U"\u02A1", U"\u02A1"},
+	{U"\U000107B4", U"\U000107B4", U"\U000107B4", U"\u02A2", U"\u02A2"},
+	{U"\U000107B5", U"\U000107B5", U"\U000107B5", U"\u0298", U"\u0298"},
+	{U"\U000107B6", U"\U000107B6", U"\U000107B6", U"\u01C0", U"\u01C0"},
+	{U"\U000107B7", U"\U000107B7", U"\U000107B7", U"\u01C1", U"\u01C1"},
+	{U"\U000107B8", U"\U000107B8", U"\U000107B8", U"\u01C2", U"\u01C2"},
+	{U"\U000107B9", U"\U000107B9", U"\U000107B9", U"\U0001DF0A", U"\U0001DF0A"},
+	{U"\U000107BA", U"\U000107BA", U"\U000107BA", U"\U0001DF1E", U"\U0001DF1E"},
+	{U"\U0001109A", U"\U0001109A", U"\U00011099\U000110BA", U"\U0001109A", U"\U00011099\U000110BA"},
+	{U"\U0001109C", U"\U0001109C", U"\U0001109B\U000110BA", U"\U0001109C", U"\U0001109B\U000110BA"},
+	{U"\U000110AB", U"\U000110AB", U"\U000110A5\U000110BA", U"\U000110AB", U"\U000110A5\U000110BA"},
+	{U"\U000110BA", U"\U000110BA", U"\U000110BA", U"\U000110BA", U"\U000110BA"},
+	{U"\U00011127", U"\U00011127", U"\U00011127", U"\U00011127", U"\U00011127"},
+	{U"\U0001112E", U"\U0001112E", U"\U00011131\U00011127", U"\U0001112E", U"\U00011131\U00011127"},
+	{U"\U0001112F", U"\U0001112F", U"\U00011132\U00011127", U"\U0001112F", U"\U00011132\U00011127"},
+	{U"\U0001133E", U"\U0001133E", U"\U0001133E", U"\U0001133E", U"\U0001133E"},
+	{U"\U0001134B", U"\U0001134B", U"\U00011347\U0001133E", U"\U0001134B", U"\U00011347\U0001133E"},
+	{U"\U0001134C", U"\U0001134C", U"\U00011347\U00011357", U"\U0001134C", U"\U00011347\U00011357"},
+	{U"\U00011357", U"\U00011357", U"\U00011357", U"\U00011357", U"\U00011357"},
+	{U"\U000114B0", U"\U000114B0", U"\U000114B0", U"\U000114B0", U"\U000114B0"},
+	{U"\U000114BA", U"\U000114BA", U"\U000114BA", U"\U000114BA", U"\U000114BA"},
+	{U"\U000114BB", U"\U000114BB", U"\U000114B9\U000114BA", U"\U000114BB", U"\U000114B9\U000114BA"},
+	{U"\U000114BC", U"\U000114BC", U"\U000114B9\U000114B0", U"\U000114BC", U"\U000114B9\U000114B0"},
+	{U"\U000114BD", U"\U000114BD", U"\U000114BD", U"\U000114BD", U"\U000114BD"},
+	{U"\U000114BE", U"\U000114BE", U"\U000114B9\U000114BD", U"\U000114BE", U"\U000114B9\U000114BD"},
+	{U"\U000115AF", U"\U000115AF", U"\U000115AF", U"\U000115AF", U"\U000115AF"},
+	{U"\U000115BA", U"\U000115BA", U"\U000115B8\U000115AF", U"\U000115BA", U"\U000115B8\U000115AF"},
+	{U"\U000115BB", U"\U000115BB", U"\U000115B9\U000115AF", U"\U000115BB", U"\U000115B9\U000115AF"},
+	{U"\U00011930", U"\U00011930", U"\U00011930", U"\U00011930", U"\U00011930"},
+	{U"\U00011938", U"\U00011938", U"\U00011935\U00011930", U"\U00011938", U"\U00011935\U00011930"},
+	{U"\U0001D15E", U"\U0001D157\U0001D165", U"\U0001D157\U0001D165", U"\U0001D157\U0001D165", U"\U0001D157\U0001D165"},
+	{U"\U0001D15F", U"\U0001D158\U0001D165", U"\U0001D158\U0001D165", U"\U0001D158\U0001D165", U"\U0001D158\U0001D165"},
+	{U"\U0001D160", U"\U0001D158\U0001D165\U0001D16E", U"\U0001D158\U0001D165\U0001D16E", U"\U0001D158\U0001D165\U0001D16E", U"\U0001D158\U0001D165\U0001D16E"},
+	{U"\U0001D161", U"\U0001D158\U0001D165\U0001D16F", U"\U0001D158\U0001D165\U0001D16F", U"\U0001D158\U0001D165\U0001D16F", U"\U0001D158\U0001D165\U0001D16F"},
+	{U"\U0001D162", U"\U0001D158\U0001D165\U0001D170", U"\U0001D158\U0001D165\U0001D170", U"\U0001D158\U0001D165\U0001D170", U"\U0001D158\U0001D165\U0001D170"},
+	{U"\U0001D163", U"\U0001D158\U0001D165\U0001D171", U"\U0001D158\U0001D165\U0001D171", U"\U0001D158\U0001D165\U0001D171", U"\U0001D158\U0001D165\U0001D171"},
+	{U"\U0001D164", U"\U0001D158\U0001D165\U0001D172", U"\U0001D158\U0001D165\U0001D172", U"\U0001D158\U0001D165\U0001D172", U"\U0001D158\U0001D165\U0001D172"},
+	{U"\U0001D1BB", U"\U0001D1B9\U0001D165", U"\U0001D1B9\U0001D165", U"\U0001D1B9\U0001D165", U"\U0001D1B9\U0001D165"},
+	{U"\U0001D1BC", U"\U0001D1BA\U0001D165", U"\U0001D1BA\U0001D165", U"\U0001D1BA\U0001D165", U"\U0001D1BA\U0001D165"},
+	{U"\U0001D1BD", U"\U0001D1B9\U0001D165\U0001D16E", U"\U0001D1B9\U0001D165\U0001D16E", U"\U0001D1B9\U0001D165\U0001D16E", U"\U0001D1B9\U0001D165\U0001D16E"},
+	{U"\U0001D1BE", U"\U0001D1BA\U0001D165\U0001D16E", U"\U0001D1BA\U0001D165\U0001D16E", U"\U0001D1BA\U0001D165\U0001D16E", U"\U0001D1BA\U0001D165\U0001D16E"},
+	{U"\U0001D1BF", U"\U0001D1B9\U0001D165\U0001D16F", U"\U0001D1B9\U0001D165\U0001D16F", U"\U0001D1B9\U0001D165\U0001D16F", U"\U0001D1B9\U0001D165\U0001D16F"},
+	{U"\U0001D1C0", U"\U0001D1BA\U0001D165\U0001D16F", U"\U0001D1BA\U0001D165\U0001D16F", U"\U0001D1BA\U0001D165\U0001D16F", U"\U0001D1BA\U0001D165\U0001D16F"},
+	{U"\U0001D400", U"\U0001D400", U"\U0001D400", U"A", U"A"},
+	{U"\U0001D401", U"\U0001D401", U"\U0001D401", U"B", U"B"},
+	{U"\U0001D402", U"\U0001D402", U"\U0001D402", U"C", U"C"},
+	{U"\U0001D403", U"\U0001D403", U"\U0001D403", U"D", U"D"},
+	{U"\U0001D404", U"\U0001D404", U"\U0001D404", U"E", U"E"},
+	{U"\U0001D405", U"\U0001D405", U"\U0001D405", U"F", U"F"},
+	{U"\U0001D406", U"\U0001D406", U"\U0001D406", U"G", U"G"},
+	{U"\U0001D407", U"\U0001D407", U"\U0001D407", U"H", U"H"},
+	{U"\U0001D408", U"\U0001D408", U"\U0001D408", U"I", U"I"},
+	{U"\U0001D409", U"\U0001D409", U"\U0001D409", U"J", U"J"},
+	{U"\U0001D40A", U"\U0001D40A", U"\U0001D40A", U"K", U"K"},
+	{U"\U0001D40B", U"\U0001D40B", U"\U0001D40B", U"L", U"L"},
+	{U"\U0001D40C", U"\U0001D40C", U"\U0001D40C", U"M", U"M"},
+	{U"\U0001D40D", U"\U0001D40D", U"\U0001D40D", U"N", U"N"},
+	{U"\U0001D40E", U"\U0001D40E", U"\U0001D40E", U"O", U"O"},
+	{U"\U0001D40F", U"\U0001D40F", U"\U0001D40F", U"P", U"P"},
+	{U"\U0001D410", U"\U0001D410", U"\U0001D410", U"Q", U"Q"},
+	{U"\U0001D411", U"\U0001D411", U"\U0001D411", U"R", U"R"},
+	{U"\U0001D412", U"\U0001D412", U"\U0001D412", U"S", U"S"},
+	{U"\U0001D413", U"\U0001D413", U"\U0001D413", U"T", U"T"},
+	{U"\U0001D414", U"\U0001D414", U"\U0001D414", U"U", U"U"},
+	{U"\U0001D415", U"\U0001D415", U"\U0001D415", U"V", U"V"},
+	{U"\U0001D416", U"\U0001D416", U"\U0001D416", U"W", U"W"},
+	{U"\U0001D417", U"\U0001D417", U"\U0001D417", U"X", U"X"},
+	{U"\U0001D418", U"\U0001D418", U"\U0001D418", U"Y", U"Y"},
+	{U"\U0001D419", U"\U0001D419", U"\U0001D419", U"Z", U"Z"},
+	{U"\U0001D41A", U"\U0001D41A", U"\U0001D41A", U"a", U"a"},
+	{U"\U0001D41B", U"\U0001D41B", U"\U0001D41B", U"b", U"b"},
+	{U"\U0001D41C", U"\U0001D41C", U"\U0001D41C", U"c", U"c"},
+	{U"\U0001D41D", U"\U0001D41D", U"\U0001D41D", U"d", U"d"},
+	{U"\U0001D41E", U"\U0001D41E", U"\U0001D41E", U"e", U"e"},
+	{U"\U0001D41F", U"\U0001D41F", U"\U0001D41F", U"f", U"f"},
+	{U"\U0001D420", U"\U0001D420", U"\U0001D420", U"g", U"g"},
+	{U"\U0001D421", U"\U0001D421", U"\U0001D421", U"h", U"h"},
+	{U"\U0001D422", U"\U0001D422", U"\U0001D422", U"i", U"i"},
+	{U"\U0001D423", U"\U0001D423", U"\U0001D423", U"j", U"j"},
+	{U"\U0001D424", U"\U0001D424", U"\U0001D424", U"k", U"k"},
+	{U"\U0001D425", U"\U0001D425", U"\U0001D425", U"l", U"l"},
+	{U"\U0001D426", U"\U0001D426", U"\U0001D426", U"m", U"m"},
+	{U"\U0001D427", U"\U0001D427", U"\U0001D427", U"n", U"n"},
+	{U"\U0001D428", U"\U0001D428", U"\U0001D428", U"o", U"o"},
+	{U"\U0001D429", U"\U0001D429", U"\U0001D429", U"p", U"p"},
+	{U"\U0001D42A", U"\U0001D42A", U"\U0001D42A", U"q", U"q"},
+	{U"\U0001D42B", U"\U0001D42B", U"\U0001D42B", U"r", U"r"},
+	{U"\U0001D42C", U"\U0001D42C", U"\U0001D42C", U"s", U"s"},
+	{U"\U0001D42D", U"\U0001D42D", U"\U0001D42D", U"t", U"t"},
+	{U"\U0001D42E", U"\U0001D42E", U"\U0001D42E", U"u", U"u"},
+	{U"\U0001D42F", U"\U0001D42F", U"\U0001D42F", U"v", U"v"},
+	{U"\U0001D430", U"\U0001D430", U"\U0001D430", U"w", U"w"},
+	{U"\U0001D431", U"\U0001D431", U"\U0001D431", U"x", U"x"},
+	{U"\U0001D432", U"\U0001D432", U"\U0001D432", U"y", U"y"},
+	{U"\U0001D433", U"\U0001D433", U"\U0001D433", U"z", U"z"},
+	{U"\U0001D434", U"\U0001D434", U"\U0001D434", U"A", U"A"},
+	{U"\U0001D435", U"\U0001D435", U"\U0001D435", U"B", U"B"},
+	{U"\U0001D436", U"\U0001D436", U"\U0001D436", U"C", U"C"},
+	{U"\U0001D437", U"\U0001D437", U"\U0001D437", U"D", U"D"},
+	{U"\U0001D438", U"\U0001D438", U"\U0001D438", U"E", U"E"},
+	{U"\U0001D439", U"\U0001D439", U"\U0001D439", U"F", U"F"},
+	{U"\U0001D43A", U"\U0001D43A", U"\U0001D43A", U"G", U"G"},
+	{U"\U0001D43B", U"\U0001D43B", U"\U0001D43B", U"H", U"H"},
+	{U"\U0001D43C", U"\U0001D43C", U"\U0001D43C", U"I", U"I"},
+	{U"\U0001D43D", U"\U0001D43D", U"\U0001D43D", U"J", U"J"},
+	{U"\U0001D43E", U"\U0001D43E", U"\U0001D43E", U"K", U"K"},
+	{U"\U0001D43F", U"\U0001D43F", U"\U0001D43F", U"L", U"L"},
+	{U"\U0001D440", U"\U0001D440", U"\U0001D440", U"M", U"M"},
+	{U"\U0001D441", U"\U0001D441", U"\U0001D441", U"N", U"N"},
+	{U"\U0001D442", U"\U0001D442", U"\U0001D442", U"O", U"O"},
+	{U"\U0001D443", U"\U0001D443", U"\U0001D443", U"P", U"P"},
+	{U"\U0001D444", U"\U0001D444", U"\U0001D444", U"Q", U"Q"},
+	{U"\U0001D445", U"\U0001D445", U"\U0001D445", U"R", U"R"},
+	{U"\U0001D446", U"\U0001D446", U"\U0001D446", U"S", U"S"},
+	{U"\U0001D447", U"\U0001D447", U"\U0001D447", U"T", U"T"},
+	{U"\U0001D448", U"\U0001D448", U"\U0001D448", U"U", U"U"},
+	{U"\U0001D449", U"\U0001D449", U"\U0001D449", U"V", U"V"},
+	{U"\U0001D44A", U"\U0001D44A", U"\U0001D44A", U"W", U"W"},
+	{U"\U0001D44B", U"\U0001D44B", U"\U0001D44B", U"X", U"X"},
+	{U"\U0001D44C", U"\U0001D44C", U"\U0001D44C", U"Y", U"Y"},
+	{U"\U0001D44D", U"\U0001D44D", U"\U0001D44D", U"Z", U"Z"},
+	{U"\U0001D44E", U"\U0001D44E", U"\U0001D44E", U"a", U"a"},
+	{U"\U0001D44F", U"\U0001D44F", U"\U0001D44F", U"b", U"b"},
+	{U"\U0001D450", U"\U0001D450", U"\U0001D450", U"c", U"c"},
+	{U"\U0001D451", U"\U0001D451", U"\U0001D451", U"d", U"d"},
+	{U"\U0001D452", U"\U0001D452", U"\U0001D452", U"e", U"e"},
+	{U"\U0001D453", U"\U0001D453", U"\U0001D453", U"f", U"f"},
+	{U"\U0001D454", U"\U0001D454", U"\U0001D454", U"g", U"g"},
+	{U"\U0001D456", U"\U0001D456", U"\U0001D456", U"i", U"i"},
+	{U"\U0001D457", U"\U0001D457", U"\U0001D457", U"j", U"j"},
+	{U"\U0001D458", U"\U0001D458", U"\U0001D458", U"k", U"k"},
+	{U"\U0001D459", U"\U0001D459", U"\U0001D459", U"l", U"l"},
+	{U"\U0001D45A", U"\U0001D45A", U"\U0001D45A", U"m", U"m"},
+	{U"\U0001D45B", U"\U0001D45B", U"\U0001D45B", U"n", U"n"},
+	{U"\U0001D45C", U"\U0001D45C", U"\U0001D45C", U"o", U"o"},
+	{U"\U0001D45D", U"\U0001D45D", U"\U0001D45D", U"p", U"p"},
+	{U"\U0001D45E", U"\U0001D45E", U"\U0001D45E", U"q", U"q"},
+	{U"\U0001D45F", U"\U0001D45F", U"\U0001D45F", U"r", U"r"},
+	{U"\U0001D460", U"\U0001D460", U"\U0001D460", U"s", U"s"},
+	{U"\U0001D461", U"\U0001D461", U"\U0001D461", U"t", U"t"},
+	{U"\U0001D462", U"\U0001D462", U"\U0001D462", U"u", U"u"},
+	{U"\U0001D463", U"\U0001D463", U"\U0001D463", U"v", U"v"},
+	{U"\U0001D464", U"\U0001D464", U"\U0001D464", U"w", U"w"},
+	{U"\U0001D465", U"\U0001D465", U"\U0001D465", U"x", U"x"},
+	{U"\U0001D466", U"\U0001D466", U"\U0001D466", U"y", U"y"},
+	{U"\U0001D467", U"\U0001D467", U"\U0001D467", U"z", U"z"},
+	{U"\U0001D468", U"\U0001D468", U"\U0001D468", U"A", U"A"},
+	{U"\U0001D469", U"\U0001D469", U"\U0001D469", U"B", U"B"},
+	{U"\U0001D46A", U"\U0001D46A", U"\U0001D46A", U"C", U"C"},
+	{U"\U0001D46B", U"\U0001D46B", U"\U0001D46B", U"D", U"D"},
+	{U"\U0001D46C", U"\U0001D46C", U"\U0001D46C", U"E", U"E"},
+	{U"\U0001D46D", U"\U0001D46D", U"\U0001D46D", U"F", U"F"},
+	{U"\U0001D46E", U"\U0001D46E", U"\U0001D46E", U"G", U"G"},
+	{U"\U0001D46F", U"\U0001D46F", U"\U0001D46F", U"H", U"H"},
+	{U"\U0001D470", U"\U0001D470", U"\U0001D470", U"I", U"I"},
+	{U"\U0001D471", U"\U0001D471", U"\U0001D471", U"J", U"J"},
+	{U"\U0001D472", U"\U0001D472", U"\U0001D472", U"K", U"K"},
+	{U"\U0001D473", U"\U0001D473", U"\U0001D473", U"L", U"L"},
+	{U"\U0001D474", U"\U0001D474", U"\U0001D474", U"M", U"M"},
+	{U"\U0001D475", U"\U0001D475", U"\U0001D475", U"N", U"N"},
+	{U"\U0001D476", U"\U0001D476", U"\U0001D476", U"O", U"O"},
+	{U"\U0001D477", U"\U0001D477", U"\U0001D477", U"P", U"P"},
+	{U"\U0001D478", U"\U0001D478", U"\U0001D478", U"Q", U"Q"},
+	{U"\U0001D479", U"\U0001D479", U"\U0001D479", U"R", U"R"},
+	{U"\U0001D47A", U"\U0001D47A", U"\U0001D47A", U"S", U"S"},
+	{U"\U0001D47B", U"\U0001D47B", U"\U0001D47B", U"T", U"T"},
+	{U"\U0001D47C", U"\U0001D47C", U"\U0001D47C", U"U", U"U"},
+	{U"\U0001D47D", U"\U0001D47D", U"\U0001D47D", U"V", U"V"},
+	{U"\U0001D47E", U"\U0001D47E", U"\U0001D47E", U"W", U"W"},
+	{U"\U0001D47F", U"\U0001D47F", U"\U0001D47F", U"X", U"X"},
+	{U"\U0001D480", U"\U0001D480", U"\U0001D480", U"Y", U"Y"},
+	{U"\U0001D481", U"\U0001D481", U"\U0001D481", U"Z", U"Z"},
+	{U"\U0001D482", U"\U0001D482", U"\U0001D482", U"a", U"a"},
+	{U"\U0001D483", U"\U0001D483", U"\U0001D483", U"b", U"b"},
+	{U"\U0001D484", U"\U0001D484", U"\U0001D484", U"c", U"c"},
+	{U"\U0001D485", U"\U0001D485", U"\U0001D485", U"d", U"d"},
+	{U"\U0001D486", U"\U0001D486", U"\U0001D486", U"e", U"e"},
+	{U"\U0001D487", U"\U0001D487", U"\U0001D487", U"f", U"f"},
+	{U"\U0001D488", U"\U0001D488", U"\U0001D488", U"g", U"g"},
+	{U"\U0001D489", U"\U0001D489", U"\U0001D489", U"h", U"h"},
+	{U"\U0001D48A", U"\U0001D48A", U"\U0001D48A", U"i", U"i"},
+	{U"\U0001D48B", U"\U0001D48B", U"\U0001D48B", U"j", U"j"},
+	{U"\U0001D48C", U"\U0001D48C", U"\U0001D48C", U"k", U"k"},
+	{U"\U0001D48D", U"\U0001D48D", U"\U0001D48D", U"l", U"l"},
+	{U"\U0001D48E", U"\U0001D48E", U"\U0001D48E", U"m", U"m"},
+	{U"\U0001D48F", U"\U0001D48F", U"\U0001D48F", U"n", U"n"},
+	{U"\U0001D490", U"\U0001D490", U"\U0001D490", U"o", U"o"},
+	{U"\U0001D491", U"\U0001D491", U"\U0001D491", U"p", U"p"},
+	{U"\U0001D492", U"\U0001D492", U"\U0001D492", U"q", U"q"},
+	{U"\U0001D493", U"\U0001D493", U"\U0001D493", U"r", U"r"},
+	{U"\U0001D494", U"\U0001D494", U"\U0001D494", U"s", U"s"},
+	{U"\U0001D495", U"\U0001D495", U"\U0001D495", U"t", U"t"},
+	{U"\U0001D496", U"\U0001D496", U"\U0001D496", U"u", U"u"},
+	{U"\U0001D497", U"\U0001D497", U"\U0001D497", U"v", U"v"},
+	{U"\U0001D498", U"\U0001D498", U"\U0001D498", U"w", U"w"},
+	{U"\U0001D499", U"\U0001D499", U"\U0001D499", U"x", U"x"},
+	{U"\U0001D49A", U"\U0001D49A", U"\U0001D49A", U"y", U"y"},
+	{U"\U0001D49B", U"\U0001D49B", U"\U0001D49B", U"z", U"z"},
+	{U"\U0001D49C", U"\U0001D49C", U"\U0001D49C", U"A", U"A"},
+	{U"\U0001D49E", U"\U0001D49E", U"\U0001D49E", U"C", U"C"},
+	{U"\U0001D49F", U"\U0001D49F", U"\U0001D49F", U"D", U"D"},
+	{U"\U0001D4A2", U"\U0001D4A2", U"\U0001D4A2", U"G", U"G"},
+	{U"\U0001D4A5", U"\U0001D4A5", U"\U0001D4A5", U"J", U"J"},
+	{U"\U0001D4A6", U"\U0001D4A6", U"\U0001D4A6", U"K", U"K"},
+	{U"\U0001D4A9", U"\U0001D4A9", U"\U0001D4A9", U"N", U"N"},
+	{U"\U0001D4AA", U"\U0001D4AA", U"\U0001D4AA", U"O", U"O"},
+	{U"\U0001D4AB", U"\U0001D4AB", U"\U0001D4AB", U"P", U"P"},
+	{U"\U0001D4AC", U"\U0001D4AC", U"\U0001D4AC", U"Q", U"Q"},
+	{U"\U0001D4AE", U"\U0001D4AE", U"\U0001D4AE", U"S", U"S"},
+	{U"\U0001D4AF", U"\U0001D4AF", U"\U0001D4AF", U"T", U"T"},
+	{U"\U0001D4B0", U"\U0001D4B0", U"\U0001D4B0", U"U", U"U"},
+	{U"\U0001D4B1", U"\U0001D4B1", U"\U0001D4B1", U"V", U"V"},
+	{U"\U0001D4B2", U"\U0001D4B2", U"\U0001D4B2", U"W", U"W"},
+	{U"\U0001D4B3", U"\U0001D4B3", U"\U0001D4B3", U"X", U"X"},
+	{U"\U0001D4B4", U"\U0001D4B4", U"\U0001D4B4", U"Y", U"Y"},
+	{U"\U0001D4B5", U"\U0001D4B5", U"\U0001D4B5", U"Z", U"Z"},
+	{U"\U0001D4B6", U"\U0001D4B6", U"\U0001D4B6", U"a", U"a"},
+	{U"\U0001D4B7", U"\U0001D4B7", U"\U0001D4B7", U"b", U"b"},
+	{U"\U0001D4B8", U"\U0001D4B8", U"\U0001D4B8", U"c", U"c"},
+	{U"\U0001D4B9", U"\U0001D4B9", U"\U0001D4B9", U"d", U"d"},
+	{U"\U0001D4BB", U"\U0001D4BB", U"\U0001D4BB", U"f", U"f"},
+	{U"\U0001D4BD", U"\U0001D4BD", U"\U0001D4BD", U"h", U"h"},
+	{U"\U0001D4BE", U"\U0001D4BE", U"\U0001D4BE", U"i", U"i"},
+	{U"\U0001D4BF", U"\U0001D4BF", U"\U0001D4BF", U"j", U"j"},
+	{U"\U0001D4C0", U"\U0001D4C0", U"\U0001D4C0", U"k", U"k"},
+	{U"\U0001D4C1", U"\U0001D4C1", U"\U0001D4C1", U"l", U"l"},
+	{U"\U0001D4C2", U"\U0001D4C2", U"\U0001D4C2", U"m", U"m"},
+	{U"\U0001D4C3", U"\U0001D4C3", U"\U0001D4C3", U"n", U"n"},
+	{U"\U0001D4C5", U"\U0001D4C5", U"\U0001D4C5", U"p", U"p"},
+	{U"\U0001D4C6", U"\U0001D4C6", U"\U0001D4C6", U"q", U"q"},
+	{U"\U0001D4C7", U"\U0001D4C7", U"\U0001D4C7", U"r", U"r"},
+	{U"\U0001D4C8", U"\U0001D4C8", U"\U0001D4C8", U"s", U"s"},
+	{U"\U0001D4C9", U"\U0001D4C9", U"\U0001D4C9", U"t", U"t"},
+	{U"\U0001D4CA", U"\U0001D4CA", U"\U0001D4CA", U"u", U"u"},
+	{U"\U0001D4CB", U"\U0001D4CB", U"\U0001D4CB", U"v", U"v"},
+	{U"\U0001D4CC", U"\U0001D4CC", U"\U0001D4CC", U"w", U"w"},
+	{U"\U0001D4CD", U"\U0001D4CD", U"\U0001D4CD", U"x", U"x"},
+	{U"\U0001D4CE", U"\U0001D4CE", U"\U0001D4CE", U"y", U"y"},
+	{U"\U0001D4CF", U"\U0001D4CF", U"\U0001D4CF", U"z", U"z"},
+	{U"\U0001D4D0", U"\U0001D4D0", U"\U0001D4D0", U"A", U"A"},
+	{U"\U0001D4D1", U"\U0001D4D1", U"\U0001D4D1", U"B", U"B"},
+	{U"\U0001D4D2", U"\U0001D4D2", U"\U0001D4D2", U"C", U"C"},
+	{U"\U0001D4D3", U"\U0001D4D3", U"\U0001D4D3", U"D", U"D"},
+	{U"\U0001D4D4", U"\U0001D4D4", U"\U0001D4D4", U"E", U"E"},
+	{U"\U0001D4D5", U"\U0001D4D5", U"\U0001D4D5", U"F", U"F"},
+	{U"\U0001D4D6", U"\U0001D4D6", U"\U0001D4D6", U"G", U"G"},
+	{U"\U0001D4D7", U"\U0001D4D7", U"\U0001D4D7", U"H", U"H"},
+	{U"\U0001D4D8", U"\U0001D4D8", U"\U0001D4D8", U"I", U"I"},
+	{U"\U0001D4D9", U"\U0001D4D9", U"\U0001D4D9", U"J", U"J"},
+	{U"\U0001D4DA", U"\U0001D4DA", U"\U0001D4DA", U"K", U"K"},
+	{U"\U0001D4DB", U"\U0001D4DB", U"\U0001D4DB", U"L", U"L"},
+	{U"\U0001D4DC", U"\U0001D4DC", U"\U0001D4DC", U"M", U"M"},
+	{U"\U0001D4DD", U"\U0001D4DD", U"\U0001D4DD", U"N", U"N"},
+	{U"\U0001D4DE", U"\U0001D4DE", U"\U0001D4DE", U"O", U"O"},
+	{U"\U0001D4DF", U"\U0001D4DF", U"\U0001D4DF", U"P", U"P"},
+	{U"\U0001D4E0", U"\U0001D4E0", U"\U0001D4E0", U"Q", U"Q"},
+	{U"\U0001D4E1", U"\U0001D4E1", U"\U0001D4E1", U"R", U"R"},
+	{U"\U0001D4E2", U"\U0001D4E2", U"\U0001D4E2", U"S", U"S"},
+	{U"\U0001D4E3", U"\U0001D4E3", U"\U0001D4E3", U"T", U"T"},
+	{U"\U0001D4E4", U"\U0001D4E4", U"\U0001D4E4", U"U", U"U"},
+	{U"\U0001D4E5", U"\U0001D4E5", U"\U0001D4E5", U"V", U"V"},
+	{U"\U0001D4E6", U"\U0001D4E6", U"\U0001D4E6", U"W", U"W"},
+	{U"\U0001D4E7", U"\U0001D4E7", U"\U0001D4E7", U"X", U"X"},
+	{U"\U0001D4E8", U"\U0001D4E8", U"\U0001D4E8", U"Y", U"Y"},
+	{U"\U0001D4E9", U"\U0001D4E9", U"\U0001D4E9", U"Z", U"Z"},
+	{U"\U0001D4EA", U"\U0001D4EA", U"\U0001D4EA", U"a", U"a"},
+	{U"\U0001D4EB", U"\U0001D4EB", U"\U0001D4EB", U"b", U"b"},
+	{U"\U0001D4EC", U"\U0001D4EC", U"\U0001D4EC", U"c", U"c"},
+	{U"\U0001D4ED", U"\U0001D4ED", U"\U0001D4ED", U"d", U"d"},
+	{U"\U0001D4EE", U"\U0001D4EE", U"\U0001D4EE", U"e", U"e"},
+	{U"\U0001D4EF", U"\U0001D4EF", U"\U0001D4EF", U"f", U"f"},
+	{U"\U0001D4F0", U"\U0001D4F0", U"\U0001D4F0", U"g", U"g"},
+	{U"\U0001D4F1", U"\U0001D4F1", U"\U0001D4F1", U"h", U"h"},
+	{U"\U0001D4F2", U"\U0001D4F2", U"\U0001D4F2", U"i", U"i"},
+	{U"\U0001D4F3", U"\U0001D4F3", U"\U0001D4F3", U"j", U"j"},
+	{U"\U0001D4F4", U"\U0001D4F4", U"\U0001D4F4", U"k", U"k"},
+	{U"\U0001D4F5", U"\U0001D4F5", U"\U0001D4F5", U"l", U"l"},
+	{U"\U0001D4F6", U"\U0001D4F6", U"\U0001D4F6", U"m", U"m"},
+	{U"\U0001D4F7", U"\U0001D4F7", U"\U0001D4F7", U"n", U"n"},
+	{U"\U0001D4F8", U"\U0001D4F8", U"\U0001D4F8", U"o", U"o"},
+	{U"\U0001D4F9", U"\U0001D4F9", U"\U0001D4F9", U"p", U"p"},
+	{U"\U0001D4FA", U"\U0001D4FA", U"\U0001D4FA", U"q", U"q"},
+	{U"\U0001D4FB", U"\U0001D4FB", U"\U0001D4FB", U"r", U"r"},
+	{U"\U0001D4FC", U"\U0001D4FC", U"\U0001D4FC", U"s", U"s"},
+	{U"\U0001D4FD", U"\U0001D4FD", U"\U0001D4FD", U"t", U"t"},
+	{U"\U0001D4FE", U"\U0001D4FE", U"\U0001D4FE", U"u", U"u"},
+	{U"\U0001D4FF", U"\U0001D4FF", U"\U0001D4FF", U"v", U"v"},
+	{U"\U0001D500", U"\U0001D500", U"\U0001D500", U"w", U"w"},
+	{U"\U0001D501", U"\U0001D501", U"\U0001D501", U"x", U"x"},
+	{U"\U0001D502", U"\U0001D502", U"\U0001D502", U"y", U"y"},
+	{U"\U0001D503", U"\U0001D503", U"\U0001D503", U"z", U"z"},
+	{U"\U0001D504", U"\U0001D504", U"\U0001D504", U"A", U"A"},
+	{U"\U0001D505", U"\U0001D505", U"\U0001D505", U"B", U"B"},
+	{U"\U0001D507", U"\U0001D507", U"\U0001D507", U"D", U"D"},
+	{U"\U0001D508", U"\U0001D508", U"\U0001D508", U"E", U"E"},
+	{U"\U0001D509", U"\U0001D509", U"\U0001D509", U"F", U"F"},
+	{U"\U0001D50A", U"\U0001D50A", U"\U0001D50A", U"G", U"G"},
+	{U"\U0001D50D", U"\U0001D50D", U"\U0001D50D", U"J", U"J"},
+	{U"\U0001D50E", U"\U0001D50E", U"\U0001D50E", U"K", U"K"},
+	{U"\U0001D50F", U"\U0001D50F", U"\U0001D50F", U"L", U"L"},
+	{U"\U0001D510", U"\U0001D510", U"\U0001D510", U"M", U"M"},
+	{U"\U0001D511", U"\U0001D511", U"\U0001D511", U"N", U"N"},
+	{U"\U0001D512", U"\U0001D512", U"\U0001D512", U"O", U"O"},
+	{U"\U0001D513", U"\U0001D513", U"\U0001D513", U"P", U"P"},
+	{U"\U0001D514", U"\U0001D514", U"\U0001D514", U"Q", U"Q"},
+	{U"\U0001D516", U"\U0001D516", U"\U0001D516", U"S", U"S"},
+	{U"\U0001D517", U"\U0001D517", U"\U0001D517", U"T", U"T"},
+	{U"\U0001D518", U"\U0001D518", U"\U0001D518", U"U", U"U"},
+	{U"\U0001D519", U"\U0001D519", U"\U0001D519", U"V", U"V"},
+	{U"\U0001D51A", U"\U0001D51A", U"\U0001D51A", U"W", U"W"},
+	{U"\U0001D51B", U"\U0001D51B", U"\U0001D51B", U"X", U"X"},
+	{U"\U0001D51C", U"\U0001D51C", U"\U0001D51C", U"Y", U"Y"},
+	{U"\U0001D51E", U"\U0001D51E", U"\U0001D51E", U"a", U"a"},
+	{U"\U0001D51F", U"\U0001D51F", U"\U0001D51F", U"b", U"b"},
+	{U"\U0001D520", U"\U0001D520", U"\U0001D520", U"c", U"c"},
+	{U"\U0001D521", U"\U0001D521", U"\U0001D521", U"d", U"d"},
+	{U"\U0001D522", U"\U0001D522", U"\U0001D522", U"e", U"e"},
+	{U"\U0001D523", U"\U0001D523", U"\U0001D523", U"f", U"f"},
+	{U"\U0001D524", U"\U0001D524", U"\U0001D524", U"g", U"g"},
+	{U"\U0001D525", U"\U0001D525", U"\U0001D525", U"h", U"h"},
+	{U"\U0001D526", U"\U0001D526", U"\U0001D526", U"i", U"i"},
+	{U"\U0001D527", U"\U0001D527", U"\U0001D527", U"j", U"j"},
+	{U"\U0001D528", U"\U0001D528", U"\U0001D528", U"k", U"k"},
+	{U"\U0001D529", U"\U0001D529", U"\U0001D529", U"l", U"l"},
+	{U"\U0001D52A", U"\U0001D52A", U"\U0001D52A", U"m", U"m"},
+	{U"\U0001D52B", U"\U0001D52B", U"\U0001D52B", U"n", U"n"},
+	{U"\U0001D52C", U"\U0001D52C", U"\U0001D52C", U"o", U"o"},
+	{U"\U0001D52D", U"\U0001D52D", U"\U0001D52D", U"p", U"p"},
+	{U"\U0001D52E", U"\U0001D52E", U"\U0001D52E", U"q", U"q"},
+	{U"\U0001D52F", U"\U0001D52F", U"\U0001D52F", U"r", U"r"},
+	{U"\U0001D530", U"\U0001D530", U"\U0001D530", U"s", U"s"},
+	{U"\U0001D531", U"\U0001D531", U"\U0001D531", U"t", U"t"},
+	{U"\U0001D532", U"\U0001D532", U"\U0001D532", U"u", U"u"},
+	{U"\U0001D533", U"\U0001D533", U"\U0001D533", U"v", U"v"},
+	{U"\U0001D534", U"\U0001D534", U"\U0001D534", U"w", U"w"},
+	{U"\U0001D535", U"\U0001D535", U"\U0001D535", U"x", U"x"},
+	{U"\U0001D536", U"\U0001D536", U"\U0001D536", U"y", U"y"},
+	{U"\U0001D537", U"\U0001D537", U"\U0001D537", U"z", U"z"},
+	{U"\U0001D538", U"\U0001D538", U"\U0001D538", U"A", U"A"},
+	{U"\U0001D539", U"\U0001D539", U"\U0001D539", U"B", U"B"},
+	{U"\U0001D53B", U"\U0001D53B", U"\U0001D53B", U"D", U"D"},
+	{U"\U0001D53C", U"\U0001D53C", U"\U0001D53C", U"E", U"E"},
+	{U"\U0001D53D", U"\U0001D53D", U"\U0001D53D", U"F", U"F"},
+	{U"\U0001D53E", U"\U0001D53E", U"\U0001D53E", U"G", U"G"},
+	{U"\U0001D540", U"\U0001D540", U"\U0001D540", U"I", U"I"},
+	{U"\U0001D541", U"\U0001D541", U"\U0001D541", U"J", U"J"},
+	{U"\U0001D542", U"\U0001D542", U"\U0001D542", U"K", U"K"},
+	{U"\U0001D543", U"\U0001D543", U"\U0001D543", U"L", U"L"},
+	{U"\U0001D544", U"\U0001D544", U"\U0001D544", U"M", U"M"},
+	{U"\U0001D546", U"\U0001D546", U"\U0001D546", U"O", U"O"},
+	{U"\U0001D54A", U"\U0001D54A", U"\U0001D54A", U"S", U"S"},
+	{U"\U0001D54B", U"\U0001D54B", U"\U0001D54B", U"T", U"T"},
+	{U"\U0001D54C", U"\U0001D54C", U"\U0001D54C", U"U", U"U"},
+	{U"\U0001D54D", U"\U0001D54D", U"\U0001D54D", U"V", U"V"},
+	{U"\U0001D54E", U"\U0001D54E", U"\U0001D54E", U"W", U"W"},
+	{U"\U0001D54F", U"\U0001D54F", U"\U0001D54F", U"X", U"X"},
+	{U"\U0001D550", U"\U0001D550", U"\U0001D550", U"Y", U"Y"},
+	{U"\U0001D552", U"\U0001D552", U"\U0001D552", U"a", U"a"},
+	{U"\U0001D553", U"\U0001D553", U"\U0001D553", U"b", U"b"},
+	{U"\U0001D554", U"\U0001D554", U"\U0001D554", U"c", U"c"},
+	{U"\U0001D555", U"\U0001D555", U"\U0001D555", U"d", U"d"},
+	{U"\U0001D556", U"\U0001D556", U"\U0001D556", U"e", U"e"},
+	{U"\U0001D557", U"\U0001D557", U"\U0001D557", U"f", U"f"},
+	{U"\U0001D558", U"\U0001D558", U"\U0001D558", U"g", U"g"},
+	{U"\U0001D559", U"\U0001D559", U"\U0001D559", U"h", U"h"},
+	{U"\U0001D55A", U"\U0001D55A", U"\U0001D55A", U"i", U"i"},
+	{U"\U0001D55B", U"\U0001D55B", U"\U0001D55B", U"j", U"j"},
+	{U"\U0001D55C", U"\U0001D55C", U"\U0001D55C", U"k", U"k"},
+	{U"\U0001D55D", U"\U0001D55D", U"\U0001D55D", U"l", U"l"},
+	{U"\U0001D55E", U"\U0001D55E", U"\U0001D55E", U"m", U"m"},
+	{U"\U0001D55F", U"\U0001D55F", U"\U0001D55F", U"n", U"n"},
+	{U"\U0001D560", U"\U0001D560", U"\U0001D560", U"o", U"o"},
+	{U"\U0001D561", U"\U0001D561", U"\U0001D561", U"p", U"p"},
+	{U"\U0001D562", U"\U0001D562", U"\U0001D562", U"q", U"q"},
+	{U"\U0001D563", U"\U0001D563", U"\U0001D563", U"r", U"r"},
+	{U"\U0001D564", U"\U0001D564", U"\U0001D564", U"s", U"s"},
+	{U"\U0001D565", U"\U0001D565", U"\U0001D565", U"t", U"t"},
+	{U"\U0001D566", U"\U0001D566", U"\U0001D566", U"u", U"u"},
+	{U"\U0001D567", U"\U0001D567", U"\U0001D567", U"v", U"v"},
+	{U"\U0001D568", U"\U0001D568", U"\U0001D568", U"w", U"w"},
+	{U"\U0001D569", U"\U0001D569", U"\U0001D569", U"x", U"x"},
+	{U"\U0001D56A", U"\U0001D56A", U"\U0001D56A", U"y", U"y"},
+	{U"\U0001D56B", U"\U0001D56B", U"\U0001D56B", U"z", U"z"},
+	{U"\U0001D56C", U"\U0001D56C", U"\U0001D56C", U"A", U"A"},
+	{U"\U0001D56D", U"\U0001D56D", U"\U0001D56D", U"B", U"B"},
+	{U"\U0001D56E", U"\U0001D56E", U"\U0001D56E", U"C", U"C"},
+	{U"\U0001D56F", U"\U0001D56F", U"\U0001D56F", U"D", U"D"},
+	{U"\U0001D570", U"\U0001D570", U"\U0001D570", U"E", U"E"},
+	{U"\U0001D571", U"\U0001D571", U"\U0001D571", U"F", U"F"},
+	{U"\U0001D572", U"\U0001D572", U"\U0001D572", U"G", U"G"},
+	{U"\U0001D573", U"\U0001D573", U"\U0001D573", U"H", U"H"},
+	{U"\U0001D574", U"\U0001D574", U"\U0001D574", U"I", U"I"},
+	{U"\U0001D575", U"\U0001D575", U"\U0001D575", U"J", U"J"},
+	{U"\U0001D576", U"\U0001D576", U"\U0001D576", U"K", U"K"},
+	{U"\U0001D577", U"\U0001D577", U"\U0001D577", U"L", U"L"},
+	{U"\U0001D578", U"\U0001D578", U"\U0001D578", U"M", U"M"},
+	{U"\U0001D579", U"\U0001D579", U"\U0001D579", U"N", U"N"},
+	{U"\U0001D57A", U"\U0001D57A", U"\U0001D57A", U"O", U"O"},
+	{U"\U0001D57B", U"\U0001D57B", U"\U0001D57B", U"P", U"P"},
+	{U"\U0001D57C", U"\U0001D57C", U"\U0001D57C", U"Q", U"Q"},
+	{U"\U0001D57D", U"\U0001D57D", U"\U0001D57D", U"R", U"R"},
+	{U"\U0001D57E", U"\U0001D57E", U"\U0001D57E", U"S", U"S"},
+	{U"\U0001D57F", U"\U0001D57F", U"\U0001D57F", U"T", U"T"},
+	{U"\U0001D580", U"\U0001D580", U"\U0001D580", U"U", U"U"},
+	{U"\U0001D581", U"\U0001D581", U"\U0001D581", U"V", U"V"},
+	{U"\U0001D582", U"\U0001D582", U"\U0001D582", U"W", U"W"},
+	{U"\U0001D583", U"\U0001D583", U"\U0001D583", U"X", U"X"},
+	{U"\U0001D584", U"\U0001D584", U"\U0001D584", U"Y", U"Y"},
+	{U"\U0001D585", U"\U0001D585", U"\U0001D585", U"Z", U"Z"},
+	{U"\U0001D586", U"\U0001D586", U"\U0001D586", U"a", U"a"},
+	{U"\U0001D587", U"\U0001D587", U"\U0001D587", U"b", U"b"},
+	{U"\U0001D588", U"\U0001D588", U"\U0001D588", U"c", U"c"},
+	{U"\U0001D589", U"\U0001D589", U"\U0001D589", U"d", U"d"},
+	{U"\U0001D58A", U"\U0001D58A", U"\U0001D58A", U"e", U"e"},
+	{U"\U0001D58B", U"\U0001D58B", U"\U0001D58B", U"f", U"f"},
+	{U"\U0001D58C", U"\U0001D58C", U"\U0001D58C", U"g", U"g"},
+	{U"\U0001D58D", U"\U0001D58D", U"\U0001D58D", U"h", U"h"},
+	{U"\U0001D58E", U"\U0001D58E", U"\U0001D58E", U"i", U"i"},
+	{U"\U0001D58F", U"\U0001D58F", U"\U0001D58F", U"j", U"j"},
+	{U"\U0001D590", U"\U0001D590", U"\U0001D590", U"k", U"k"},
+	{U"\U0001D591", U"\U0001D591", U"\U0001D591", U"l", U"l"},
+	{U"\U0001D592", U"\U0001D592", U"\U0001D592", U"m", U"m"},
+	{U"\U0001D593", U"\U0001D593", U"\U0001D593", U"n", U"n"},
+	{U"\U0001D594", U"\U0001D594", U"\U0001D594", U"o", U"o"},
+	{U"\U0001D595", U"\U0001D595", U"\U0001D595", U"p", U"p"},
+	{U"\U0001D596", U"\U0001D596", U"\U0001D596", U"q", U"q"},
+	{U"\U0001D597", U"\U0001D597", U"\U0001D597", U"r", U"r"},
+	{U"\U0001D598", U"\U0001D598", U"\U0001D598", U"s", U"s"},
+	{U"\U0001D599", U"\U0001D599", U"\U0001D599", U"t", U"t"},
+	{U"\U0001D59A", U"\U0001D59A", U"\U0001D59A", U"u", U"u"},
+	{U"\U0001D59B", U"\U0001D59B", U"\U0001D59B", U"v", U"v"},
+	{U"\U0001D59C", U"\U0001D59C", U"\U0001D59C", U"w", U"w"},
+	{U"\U0001D59D", U"\U0001D59D", U"\U0001D59D", U"x", U"x"},
+	{U"\U0001D59E", U"\U0001D59E", U"\U0001D59E", U"y", U"y"},
+	{U"\U0001D59F", U"\U0001D59F", U"\U0001D59F", U"z", U"z"},
+	{U"\U0001D5A0", U"\U0001D5A0", U"\U0001D5A0", U"A", U"A"},
+	{U"\U0001D5A1", U"\U0001D5A1", U"\U0001D5A1", U"B", U"B"},
+	{U"\U0001D5A2", U"\U0001D5A2", U"\U0001D5A2", U"C", U"C"},
+	{U"\U0001D5A3", U"\U0001D5A3", U"\U0001D5A3", U"D", U"D"},
+	{U"\U0001D5A4", U"\U0001D5A4", U"\U0001D5A4", U"E", U"E"},
+	{U"\U0001D5A5", U"\U0001D5A5", U"\U0001D5A5", U"F", U"F"},
+	{U"\U0001D5A6", U"\U0001D5A6", U"\U0001D5A6", U"G", U"G"},
+	{U"\U0001D5A7", U"\U0001D5A7", U"\U0001D5A7", U"H", U"H"},
+	{U"\U0001D5A8", U"\U0001D5A8", U"\U0001D5A8", U"I", U"I"},
+	{U"\U0001D5A9", U"\U0001D5A9", U"\U0001D5A9", U"J", U"J"},
+	{U"\U0001D5AA", U"\U0001D5AA", U"\U0001D5AA", U"K", U"K"},
+	{U"\U0001D5AB", U"\U0001D5AB", U"\U0001D5AB", U"L", U"L"},
+	{U"\U0001D5AC", U"\U0001D5AC", U"\U0001D5AC", U"M", U"M"},
+	{U"\U0001D5AD", U"\U0001D5AD", U"\U0001D5AD", U"N", U"N"},
+	{U"\U0001D5AE", U"\U0001D5AE", U"\U0001D5AE", U"O", U"O"},
+	{U"\U0001D5AF", U"\U0001D5AF", U"\U0001D5AF", U"P", U"P"},
+	{U"\U0001D5B0", U"\U0001D5B0", U"\U0001D5B0", U"Q", U"Q"},
+	{U"\U0001D5B1", U"\U0001D5B1", U"\U0001D5B1", U"R", U"R"},
+	{U"\U0001D5B2", U"\U0001D5B2", U"\U0001D5B2", U"S", U"S"},
+	{U"\U0001D5B3", U"\U0001D5B3", U"\U0001D5B3", U"T", U"T"},
+	{U"\U0001D5B4", U"\U0001D5B4", U"\U0001D5B4", U"U", U"U"},
+	{U"\U0001D5B5", U"\U0001D5B5", U"\U0001D5B5", U"V", U"V"},
+	{U"\U0001D5B6", U"\U0001D5B6", U"\U0001D5B6", U"W", U"W"},
+	{U"\U0001D5B7", U"\U0001D5B7", U"\U0001D5B7", U"X", U"X"},
+	{U"\U0001D5B8", U"\U0001D5B8", U"\U0001D5B8", U"Y", U"Y"},
+	{U"\U0001D5B9", U"\U0001D5B9", U"\U0001D5B9", U"Z", U"Z"},
+	{U"\U0001D5BA", U"\U0001D5BA", U"\U0001D5BA", U"a", U"a"},
+	{U"\U0001D5BB", U"\U0001D5BB", U"\U0001D5BB", U"b", U"b"},
+	{U"\U0001D5BC", U"\U0001D5BC", U"\U0001D5BC", U"c", U"c"},
+	{U"\U0001D5BD", U"\U0001D5BD", U"\U0001D5BD", U"d", U"d"},
+	{U"\U0001D5BE", U"\U0001D5BE", U"\U0001D5BE", U"e", U"e"},
+	{U"\U0001D5BF", U"\U0001D5BF", U"\U0001D5BF", U"f", U"f"},
+	{U"\U0001D5C0", U"\U0001D5C0", U"\U0001D5C0", U"g", U"g"},
+	{U"\U0001D5C1", U"\U0001D5C1", U"\U0001D5C1", U"h", U"h"},
+	{U"\U0001D5C2", U"\U0001D5C2", U"\U0001D5C2", U"i", U"i"},
+	{U"\U0001D5C3", U"\U0001D5C3", U"\U0001D5C3", U"j", U"j"},
+	{U"\U0001D5C4", U"\U0001D5C4", U"\U0001D5C4", U"k", U"k"},
+	{U"\U0001D5C5", U"\U0001D5C5", U"\U0001D5C5", U"l", U"l"},
+	{U"\U0001D5C6", U"\U0001D5C6", U"\U0001D5C6", U"m", U"m"},
+	{U"\U0001D5C7", U"\U0001D5C7", U"\U0001D5C7", U"n", U"n"},
+	{U"\U0001D5C8", U"\U0001D5C8", U"\U0001D5C8", U"o", U"o"},
+	{U"\U0001D5C9", U"\U0001D5C9", U"\U0001D5C9", U"p", U"p"},
+	{U"\U0001D5CA", U"\U0001D5CA", U"\U0001D5CA", U"q", U"q"},
+	{U"\U0001D5CB", U"\U0001D5CB", U"\U0001D5CB", U"r", U"r"},
+	{U"\U0001D5CC", U"\U0001D5CC", U"\U0001D5CC", U"s", U"s"},
+	{U"\U0001D5CD", U"\U0001D5CD", U"\U0001D5CD", U"t", U"t"},
+	{U"\U0001D5CE", U"\U0001D5CE", U"\U0001D5CE", U"u", U"u"},
+	{U"\U0001D5CF", U"\U0001D5CF", U"\U0001D5CF", U"v", U"v"},
+	{U"\U0001D5D0", U"\U0001D5D0", U"\U0001D5D0", U"w", U"w"},
+	{U"\U0001D5D1", U"\U0001D5D1", U"\U0001D5D1", U"x", U"x"},
+	{U"\U0001D5D2", U"\U0001D5D2", U"\U0001D5D2", U"y", U"y"},
+	{U"\U0001D5D3", U"\U0001D5D3", U"\U0001D5D3", U"z", U"z"},
+	{U"\U0001D5D4", U"\U0001D5D4", U"\U0001D5D4", U"A", U"A"},
+	{U"\U0001D5D5", U"\U0001D5D5", U"\U0001D5D5", U"B", U"B"},
+	{U"\U0001D5D6", U"\U0001D5D6", U"\U0001D5D6", U"C", U"C"},
+	{U"\U0001D5D7", U"\U0001D5D7", U"\U0001D5D7", U"D", U"D"},
+	{U"\U0001D5D8", U"\U0001D5D8", U"\U0001D5D8", U"E", U"E"},
+	{U"\U0001D5D9", U"\U0001D5D9", U"\U0001D5D9", U"F", U"F"},
+	{U"\U0001D5DA", U"\U0001D5DA", U"\U0001D5DA", U"G", U"G"},
+	{U"\U0001D5DB", U"\U0001D5DB", U"\U0001D5DB", U"H", U"H"},
+	{U"\U0001D5DC", U"\U0001D5DC", U"\U0001D5DC", U"I", U"I"},
+	{U"\U0001D5DD", U"\U0001D5DD", U"\U0001D5DD", U"J", U"J"},
+	{U"\U0001D5DE", U"\U0001D5DE", U"\U0001D5DE", U"K", U"K"},
+	{U"\U0001D5DF", U"\U0001D5DF", U"\U0001D5DF", U"L", U"L"},
+	{U"\U0001D5E0", U"\U0001D5E0", U"\U0001D5E0", U"M", U"M"},
+	{U"\U0001D5E1", U"\U0001D5E1", U"\U0001D5E1", U"N", U"N"},
+	{U"\U0001D5E2", U"\U0001D5E2", U"\U0001D5E2", U"O", U"O"},
+	{U"\U0001D5E3", U"\U0001D5E3", U"\U0001D5E3", U"P", U"P"},
+	{U"\U0001D5E4", U"\U0001D5E4", U"\U0001D5E4", U"Q", U"Q"},
+	{U"\U0001D5E5", U"\U0001D5E5", U"\U0001D5E5", U"R", U"R"},
+	{U"\U0001D5E6", U"\U0001D5E6", U"\U0001D5E6", U"S", U"S"},
+	{U"\U0001D5E7", U"\U0001D5E7", U"\U0001D5E7", U"T", U"T"},
+	{U"\U0001D5E8", U"\U0001D5E8", U"\U0001D5E8", U"U", U"U"},
+	{U"\U0001D5E9", U"\U0001D5E9", U"\U0001D5E9", U"V", U"V"},
+	{U"\U0001D5EA", U"\U0001D5EA", U"\U0001D5EA", U"W", U"W"},
+	{U"\U0001D5EB", U"\U0001D5EB", U"\U0001D5EB", U"X", U"X"},
+	{U"\U0001D5EC", U"\U0001D5EC", U"\U0001D5EC", U"Y", U"Y"},
+	{U"\U0001D5ED", U"\U0001D5ED", U"\U0001D5ED", U"Z", U"Z"},
+	{U"\U0001D5EE", U"\U0001D5EE", U"\U0001D5EE", U"a", U"a"},
+	{U"\U0001D5EF", U"\U0001D5EF", U"\U0001D5EF", U"b", U"b"},
+	{U"\U0001D5F0", U"\U0001D5F0", U"\U0001D5F0", U"c", U"c"},
+	{U"\U0001D5F1", U"\U0001D5F1", U"\U0001D5F1", U"d", U"d"},
+	{U"\U0001D5F2", U"\U0001D5F2", U"\U0001D5F2", U"e", U"e"},
+	{U"\U0001D5F3", U"\U0001D5F3", U"\U0001D5F3", U"f", U"f"},
+	{U"\U0001D5F4", U"\U0001D5F4", U"\U0001D5F4", U"g", U"g"},
+	{U"\U0001D5F5", U"\U0001D5F5", U"\U0001D5F5", U"h", U"h"},
+	{U"\U0001D5F6", U"\U0001D5F6", U"\U0001D5F6", U"i", U"i"},
+	{U"\U0001D5F7", U"\U0001D5F7", U"\U0001D5F7", U"j", U"j"},
+	{U"\U0001D5F8", U"\U0001D5F8", U"\U0001D5F8", U"k", U"k"},
+	{U"\U0001D5F9", U"\U0001D5F9", U"\U0001D5F9", U"l", U"l"},
+	{U"\U0001D5FA", U"\U0001D5FA", U"\U0001D5FA", U"m", U"m"},
+	{U"\U0001D5FB", U"\U0001D5FB", U"\U0001D5FB", U"n", U"n"},
+	{U"\U0001D5FC", U"\U0001D5FC", U"\U0001D5FC", U"o", U"o"},
+	{U"\U0001D5FD", U"\U0001D5FD", U"\U0001D5FD", U"p", U"p"},
+	{U"\U0001D5FE", U"\U0001D5FE", U"\U0001D5FE", U"q", U"q"},
+	{U"\U0001D5FF", U"\U0001D5FF", U"\U0001D5FF", U"r", U"r"},
+	{U"\U0001D600", U"\U0001D600", U"\U0001D600", U"s", U"s"},
+	{U"\U0001D601", U"\U0001D601", U"\U0001D601", U"t", U"t"},
+	{U"\U0001D602", U"\U0001D602", U"\U0001D602", U"u", U"u"},
+	{U"\U0001D603", U"\U0001D603", U"\U0001D603", U"v", U"v"},
+	{U"\U0001D604", U"\U0001D604", U"\U0001D604", U"w", U"w"},
+	{U"\U0001D605", U"\U0001D605", U"\U0001D605", U"x", U"x"},
+	{U"\U0001D606", U"\U0001D606", U"\U0001D606", U"y", U"y"},
+	{U"\U0001D607", U"\U0001D607", U"\U0001D607", U"z", U"z"},
+	{U"\U0001D608", U"\U0001D608", U"\U0001D608", U"A", U"A"},
+	{U"\U0001D609", U"\U0001D609", U"\U0001D609", U"B", U"B"},
+	{U"\U0001D60A", U"\U0001D60A", U"\U0001D60A", U"C", U"C"},
+	{U"\U0001D60B", U"\U0001D60B", U"\U0001D60B", U"D", U"D"},
+	{U"\U0001D60C", U"\U0001D60C", U"\U0001D60C", U"E", U"E"},
+	{U"\U0001D60D", U"\U0001D60D", U"\U0001D60D", U"F", U"F"},
+	{U"\U0001D60E", U"\U0001D60E", U"\U0001D60E", U"G", U"G"},
+	{U"\U0001D60F", U"\U0001D60F", U"\U0001D60F", U"H", U"H"},
+	{U"\U0001D610", U"\U0001D610", U"\U0001D610", U"I", U"I"},
+	{U"\U0001D611", U"\U0001D611", U"\U0001D611", U"J", U"J"},
+	{U"\U0001D612", U"\U0001D612", U"\U0001D612", U"K", U"K"},
+	{U"\U0001D613", U"\U0001D613", U"\U0001D613", U"L", U"L"},
+	{U"\U0001D614", U"\U0001D614", U"\U0001D614", U"M", U"M"},
+	{U"\U0001D615", U"\U0001D615", U"\U0001D615", U"N", U"N"},
+	{U"\U0001D616", U"\U0001D616", U"\U0001D616", U"O", U"O"},
+	{U"\U0001D617", U"\U0001D617", U"\U0001D617", U"P", U"P"},
+	{U"\U0001D618", U"\U0001D618", U"\U0001D618", U"Q", U"Q"},
+	{U"\U0001D619", U"\U0001D619", U"\U0001D619", U"R", U"R"},
+	{U"\U0001D61A", U"\U0001D61A", U"\U0001D61A", U"S", U"S"},
+	{U"\U0001D61B", U"\U0001D61B", U"\U0001D61B", U"T", U"T"},
+	{U"\U0001D61C", U"\U0001D61C", U"\U0001D61C", U"U", U"U"},
+	{U"\U0001D61D", U"\U0001D61D", U"\U0001D61D", U"V", U"V"},
+	{U"\U0001D61E", U"\U0001D61E", U"\U0001D61E", U"W", U"W"},
+	{U"\U0001D61F", U"\U0001D61F", U"\U0001D61F", U"X", U"X"},
+	{U"\U0001D620", U"\U0001D620", U"\U0001D620", U"Y", U"Y"},
+	{U"\U0001D621", U"\U0001D621", U"\U0001D621", U"Z", U"Z"},
+	{U"\U0001D622", U"\U0001D622", U"\U0001D622", U"a", U"a"},
+	{U"\U0001D623", U"\U0001D623", U"\U0001D623", U"b", U"b"},
+	{U"\U0001D624", U"\U0001D624", U"\U0001D624", U"c", U"c"},
+	{U"\U0001D625", U"\U0001D625", U"\U0001D625", U"d", U"d"},
+	{U"\U0001D626", U"\U0001D626", U"\U0001D626", U"e", U"e"},
+	{U"\U0001D627", U"\U0001D627", U"\U0001D627", U"f", U"f"},
+	{U"\U0001D628", U"\U0001D628", U"\U0001D628", U"g", U"g"},
+	{U"\U0001D629", U"\U0001D629", U"\U0001D629", U"h", U"h"},
+	{U"\U0001D62A", U"\U0001D62A", U"\U0001D62A", U"i", U"i"},
+	{U"\U0001D62B", U"\U0001D62B", U"\U0001D62B", U"j", U"j"},
+	{U"\U0001D62C", U"\U0001D62C", U"\U0001D62C", U"k", U"k"},
+	{U"\U0001D62D", U"\U0001D62D", U"\U0001D62D", U"l", U"l"},
+	{U"\U0001D62E", U"\U0001D62E", U"\U0001D62E", U"m", U"m"},
+	{U"\U0001D62F", U"\U0001D62F", U"\U0001D62F", U"n", U"n"},
+	{U"\U0001D630", U"\U0001D630", U"\U0001D630", U"o", U"o"},
+	{U"\U0001D631", U"\U0001D631", U"\U0001D631", U"p", U"p"},
+	{U"\U0001D632", U"\U0001D632", U"\U0001D632", U"q", U"q"},
+	{U"\U0001D633", U"\U0001D633", U"\U0001D633", U"r", U"r"},
+	{U"\U0001D634", U"\U0001D634", U"\U0001D634", U"s", U"s"},
+	{U"\U0001D635", U"\U0001D635", U"\U0001D635", U"t", U"t"},
+	{U"\U0001D636", U"\U0001D636", U"\U0001D636", U"u", U"u"},
+	{U"\U0001D637", U"\U0001D637", U"\U0001D637", U"v", U"v"},
+	{U"\U0001D638", U"\U0001D638", U"\U0001D638", U"w", U"w"},
+	{U"\U0001D639", U"\U0001D639", U"\U0001D639", U"x", U"x"},
+	{U"\U0001D63A", U"\U0001D63A", U"\U0001D63A", U"y", U"y"},
+	{U"\U0001D63B", U"\U0001D63B", U"\U0001D63B", U"z", U"z"},
+	{U"\U0001D63C", U"\U0001D63C", U"\U0001D63C", U"A", U"A"},
+	{U"\U0001D63D", U"\U0001D63D", U"\U0001D63D", U"B", U"B"},
+	{U"\U0001D63E", U"\U0001D63E", U"\U0001D63E", U"C", U"C"},
+	{U"\U0001D63F", U"\U0001D63F", U"\U0001D63F", U"D", U"D"},
+	{U"\U0001D640", U"\U0001D640", U"\U0001D640", U"E", U"E"},
+	{U"\U0001D641", U"\U0001D641", U"\U0001D641", U"F", U"F"},
+	{U"\U0001D642", U"\U0001D642", U"\U0001D642", U"G", U"G"},
+	{U"\U0001D643", U"\U0001D643", U"\U0001D643", U"H", U"H"},
+	{U"\U0001D644", U"\U0001D644", U"\U0001D644", U"I", U"I"},
+	{U"\U0001D645", U"\U0001D645", U"\U0001D645", U"J", U"J"},
+	{U"\U0001D646", U"\U0001D646", U"\U0001D646", U"K", U"K"},
+	{U"\U0001D647", U"\U0001D647", U"\U0001D647", U"L", U"L"},
+	{U"\U0001D648", U"\U0001D648", U"\U0001D648", U"M", U"M"},
+	{U"\U0001D649", U"\U0001D649", U"\U0001D649", U"N", U"N"},
+	{U"\U0001D64A", U"\U0001D64A", U"\U0001D64A", U"O", U"O"},
+	{U"\U0001D64B", U"\U0001D64B", U"\U0001D64B", U"P", U"P"},
+	{U"\U0001D64C", U"\U0001D64C", U"\U0001D64C", U"Q", U"Q"},
+	{U"\U0001D64D", U"\U0001D64D", U"\U0001D64D", U"R", U"R"},
+	{U"\U0001D64E", U"\U0001D64E", U"\U0001D64E", U"S", U"S"},
+	{U"\U0001D64F", U"\U0001D64F", U"\U0001D64F", U"T", U"T"},
+	{U"\U0001D650", U"\U0001D650", U"\U0001D650", U"U", U"U"},
+	{U"\U0001D651", U"\U0001D651", U"\U0001D651", U"V", U"V"},
+	{U"\U0001D652", U"\U0001D652", U"\U0001D652", U"W", U"W"},
+	{U"\U0001D653", U"\U0001D653", U"\U0001D653", U"X", U"X"},
+	{U"\U0001D654", U"\U0001D654", U"\U0001D654", U"Y", U"Y"},
+	{U"\U0001D655", U"\U0001D655", U"\U0001D655", U"Z", U"Z"},
+	{U"\U0001D656", U"\U0001D656", U"\U0001D656", U"a", U"a"},
+	{U"\U0001D657", U"\U0001D657", U"\U0001D657", U"b", U"b"},
+	{U"\U0001D658", U"\U0001D658", U"\U0001D658", U"c", U"c"},
+	{U"\U0001D659", U"\U0001D659", U"\U0001D659", U"d", U"d"},
+	{U"\U0001D65A", U"\U0001D65A", U"\U0001D65A", U"e", U"e"},
+	{U"\U0001D65B", U"\U0001D65B", U"\U0001D65B", U"f", U"f"},
+	{U"\U0001D65C", U"\U0001D65C", U"\U0001D65C", U"g", U"g"},
+	{U"\U0001D65D", U"\U0001D65D", U"\U0001D65D", U"h", U"h"},
+	{U"\U0001D65E", U"\U0001D65E", U"\U0001D65E", U"i", U"i"},
+	{U"\U0001D65F", U"\U0001D65F", U"\U0001D65F", U"j", U"j"},
+	{U"\U0001D660", U"\U0001D660", U"\U0001D660", U"k", U"k"},
+	{U"\U0001D661", U"\U0001D661", U"\U0001D661", U"l", U"l"},
+	{U"\U0001D662", U"\U0001D662", U"\U0001D662", U"m", U"m"},
+	{U"\U0001D663", U"\U0001D663", U"\U0001D663", U"n", U"n"},
+	{U"\U0001D664", U"\U0001D664", U"\U0001D664", U"o", U"o"},
+	{U"\U0001D665", U"\U0001D665", U"\U0001D665", U"p", U"p"},
+	{U"\U0001D666", U"\U0001D666", U"\U0001D666", U"q", U"q"},
+	{U"\U0001D667", U"\U0001D667", U"\U0001D667", U"r", U"r"},
+	{U"\U0001D668", U"\U0001D668", U"\U0001D668", U"s", U"s"},
+	{U"\U0001D669", U"\U0001D669", U"\U0001D669", U"t", U"t"},
+	{U"\U0001D66A", U"\U0001D66A", U"\U0001D66A", U"u", U"u"},
+	{U"\U0001D66B", U"\U0001D66B", U"\U0001D66B", U"v", U"v"},
+	{U"\U0001D66C", U"\U0001D66C", U"\U0001D66C", U"w", U"w"},
+	{U"\U0001D66D", U"\U0001D66D", U"\U0001D66D", U"x", U"x"},
+	{U"\U0001D66E", U"\U0001D66E", U"\U0001D66E", U"y", U"y"},
+	{U"\U0001D66F", U"\U0001D66F", U"\U0001D66F", U"z", U"z"},
+	{U"\U0001D670", U"\U0001D670", U"\U0001D670", U"A", U"A"},
+	{U"\U0001D671", U"\U0001D671", U"\U0001D671", U"B", U"B"},
+	{U"\U0001D672", U"\U0001D672", U"\U0001D672", U"C", U"C"},
+	{U"\U0001D673", U"\U0001D673", U"\U0001D673", U"D", U"D"},
+	{U"\U0001D674", U"\U0001D674", U"\U0001D674", U"E", U"E"},
+	{U"\U0001D675", U"\U0001D675", U"\U0001D675", U"F", U"F"},
+	{U"\U0001D676", U"\U0001D676", U"\U0001D676", U"G", U"G"},
+	{U"\U0001D677", U"\U0001D677", U"\U0001D677", U"H", U"H"},
+	{U"\U0001D678", U"\U0001D678", U"\U0001D678", U"I", U"I"},
+	{U"\U0001D679", U"\U0001D679", U"\U0001D679", U"J", U"J"},
+	{U"\U0001D67A", U"\U0001D67A", U"\U0001D67A", U"K", U"K"},
+	{U"\U0001D67B", U"\U0001D67B", U"\U0001D67B", U"L", U"L"},
+	{U"\U0001D67C", U"\U0001D67C", U"\U0001D67C", U"M", U"M"},
+	{U"\U0001D67D", U"\U0001D67D", U"\U0001D67D", U"N", U"N"},
+	{U"\U0001D67E", U"\U0001D67E", U"\U0001D67E", U"O", U"O"},
+	{U"\U0001D67F", U"\U0001D67F", U"\U0001D67F", U"P", U"P"},
+	{U"\U0001D680", U"\U0001D680", U"\U0001D680", U"Q", U"Q"},
+	{U"\U0001D681", U"\U0001D681", U"\U0001D681", U"R", U"R"},
+	{U"\U0001D682", U"\U0001D682", U"\U0001D682", U"S", U"S"},
+	{U"\U0001D683", U"\U0001D683", U"\U0001D683", U"T", U"T"},
+	{U"\U0001D684", U"\U0001D684", U"\U0001D684", U"U", U"U"},
+	{U"\U0001D685", U"\U0001D685", U"\U0001D685", U"V", U"V"},
+	{U"\U0001D686", U"\U0001D686", U"\U0001D686", U"W", U"W"},
+	{U"\U0001D687", U"\U0001D687", U"\U0001D687", U"X", U"X"},
+	{U"\U0001D688", U"\U0001D688", U"\U0001D688", U"Y", U"Y"},
+	{U"\U0001D689", U"\U0001D689", U"\U0001D689", U"Z", U"Z"},
+	{U"\U0001D68A", U"\U0001D68A", U"\U0001D68A", U"a", U"a"},
+	{U"\U0001D68B", U"\U0001D68B", U"\U0001D68B", U"b", U"b"},
+	{U"\U0001D68C", U"\U0001D68C", U"\U0001D68C", U"c", U"c"},
+	{U"\U0001D68D", U"\U0001D68D", U"\U0001D68D", U"d", U"d"},
+	{U"\U0001D68E", U"\U0001D68E", U"\U0001D68E", U"e", U"e"},
+	{U"\U0001D68F", U"\U0001D68F", U"\U0001D68F", U"f", U"f"},
+	{U"\U0001D690", U"\U0001D690", U"\U0001D690", U"g", U"g"},
+	{U"\U0001D691", U"\U0001D691", U"\U0001D691", U"h", U"h"},
+	{U"\U0001D692", U"\U0001D692", U"\U0001D692", U"i", U"i"},
+	{U"\U0001D693", U"\U0001D693", U"\U0001D693", U"j", U"j"},
+	{U"\U0001D694", U"\U0001D694", U"\U0001D694", U"k", U"k"},
+	{U"\U0001D695", U"\U0001D695", U"\U0001D695", U"l", U"l"},
+	{U"\U0001D696", U"\U0001D696", U"\U0001D696", U"m", U"m"},
+	{U"\U0001D697", U"\U0001D697", U"\U0001D697", U"n", U"n"},
+	{U"\U0001D698", U"\U0001D698", U"\U0001D698", U"o", U"o"},
+	{U"\U0001D699", U"\U0001D699", U"\U0001D699", U"p", U"p"},
+	{U"\U0001D69A", U"\U0001D69A", U"\U0001D69A", U"q", U"q"},
+	{U"\U0001D69B", U"\U0001D69B", U"\U0001D69B", U"r", U"r"},
+	{U"\U0001D69C", U"\U0001D69C", U"\U0001D69C", U"s", U"s"},
+	{U"\U0001D69D", U"\U0001D69D", U"\U0001D69D", U"t", U"t"},
+	{U"\U0001D69E", U"\U0001D69E", U"\U0001D69E", U"u", U"u"},
+	{U"\U0001D69F", U"\U0001D69F", U"\U0001D69F", U"v", U"v"},
+	{U"\U0001D6A0", U"\U0001D6A0", U"\U0001D6A0", U"w", U"w"},
+	{U"\U0001D6A1", U"\U0001D6A1", U"\U0001D6A1", U"x", U"x"},
+	{U"\U0001D6A2", U"\U0001D6A2", U"\U0001D6A2", U"y", U"y"},
+	{U"\U0001D6A3", U"\U0001D6A3", U"\U0001D6A3", U"z", U"z"},
+	{U"\U0001D6A4", U"\U0001D6A4", U"\U0001D6A4", U"\u0131", U"\u0131"},
+	{U"\U0001D6A5", U"\U0001D6A5", U"\U0001D6A5", U"\u0237", U"\u0237"},
+	{U"\U0001D6A8", U"\U0001D6A8", U"\U0001D6A8", U"\u0391", U"\u0391"},
+	{U"\U0001D6A9", U"\U0001D6A9", U"\U0001D6A9", U"\u0392", U"\u0392"},
+	{U"\U0001D6AA", U"\U0001D6AA", U"\U0001D6AA", U"\u0393", U"\u0393"},
+	{U"\U0001D6AB", U"\U0001D6AB", U"\U0001D6AB", U"\u0394", U"\u0394"},
+	{U"\U0001D6AC", U"\U0001D6AC", U"\U0001D6AC", U"\u0395", U"\u0395"},
+	{U"\U0001D6AD", U"\U0001D6AD", U"\U0001D6AD", U"\u0396", U"\u0396"},
+	{U"\U0001D6AE", U"\U0001D6AE", U"\U0001D6AE", U"\u0397", U"\u0397"},
+	{U"\U0001D6AF", U"\U0001D6AF", U"\U0001D6AF", U"\u0398", U"\u0398"},
+	{U"\U0001D6B0", U"\U0001D6B0", U"\U0001D6B0", U"\u0399", U"\u0399"},
+	{U"\U0001D6B1", U"\U0001D6B1", U"\U0001D6B1", U"\u039A", U"\u039A"},
+	{U"\U0001D6B2", U"\U0001D6B2", U"\U0001D6B2", U"\u039B", U"\u039B"},
+	{U"\U0001D6B3", U"\U0001D6B3", U"\U0001D6B3", U"\u039C", U"\u039C"},
+	{U"\U0001D6B4", U"\U0001D6B4", U"\U0001D6B4", U"\u039D", U"\u039D"},
+	{U"\U0001D6B5", U"\U0001D6B5", U"\U0001D6B5", U"\u039E", U"\u039E"},
+	{U"\U0001D6B6", U"\U0001D6B6", U"\U0001D6B6", U"\u039F", U"\u039F"},
+	{U"\U0001D6B7", U"\U0001D6B7", U"\U0001D6B7", U"\u03A0", U"\u03A0"},
+	{U"\U0001D6B8", U"\U0001D6B8", U"\U0001D6B8", U"\u03A1", U"\u03A1"},
+	{U"\U0001D6B9", U"\U0001D6B9", U"\U0001D6B9", U"\u0398", U"\u0398"},
+	{U"\U0001D6BA", U"\U0001D6BA", U"\U0001D6BA", U"\u03A3", U"\u03A3"},
+	{U"\U0001D6BB", U"\U0001D6BB", U"\U0001D6BB", U"\u03A4", U"\u03A4"},
+	{U"\U0001D6BC", U"\U0001D6BC", U"\U0001D6BC", U"\u03A5", U"\u03A5"},
+	{U"\U0001D6BD", U"\U0001D6BD", U"\U0001D6BD", U"\u03A6", U"\u03A6"},
+	{U"\U0001D6BE", U"\U0001D6BE", U"\U0001D6BE", U"\u03A7", U"\u03A7"},
+	{U"\U0001D6BF", U"\U0001D6BF", U"\U0001D6BF", U"\u03A8", U"\u03A8"},
+	{U"\U0001D6C0", U"\U0001D6C0", U"\U0001D6C0", U"\u03A9", U"\u03A9"},
+	{U"\U0001D6C1", U"\U0001D6C1", U"\U0001D6C1", U"\u2207", U"\u2207"},
+	{U"\U0001D6C2", U"\U0001D6C2", U"\U0001D6C2", U"\u03B1", U"\u03B1"},
+	{U"\U0001D6C3", U"\U0001D6C3", U"\U0001D6C3", U"\u03B2", U"\u03B2"},
+	{U"\U0001D6C4", U"\U0001D6C4", U"\U0001D6C4", U"\u03B3", U"\u03B3"},
+	{U"\U0001D6C5", U"\U0001D6C5", U"\U0001D6C5", U"\u03B4", U"\u03B4"},
+	{U"\U0001D6C6", U"\U0001D6C6", U"\U0001D6C6", U"\u03B5", U"\u03B5"},
+	{U"\U0001D6C7", U"\U0001D6C7", U"\U0001D6C7", U"\u03B6", U"\u03B6"},
+	{U"\U0001D6C8", U"\U0001D6C8", U"\U0001D6C8", U"\u03B7", U"\u03B7"},
+	{U"\U0001D6C9", U"\U0001D6C9", U"\U0001D6C9", U"\u03B8", U"\u03B8"},
+	{U"\U0001D6CA", U"\U0001D6CA", U"\U0001D6CA", U"\u03B9", U"\u03B9"},
+	{U"\U0001D6CB", U"\U0001D6CB", U"\U0001D6CB", U"\u03BA", U"\u03BA"},
+	{U"\U0001D6CC", U"\U0001D6CC", U"\U0001D6CC", U"\u03BB", U"\u03BB"},
+	{U"\U0001D6CD", U"\U0001D6CD", U"\U0001D6CD", U"\u03BC", U"\u03BC"},
+	{U"\U0001D6CE", U"\U0001D6CE", U"\U0001D6CE", U"\u03BD", U"\u03BD"},
+	{U"\U0001D6CF", U"\U0001D6CF", U"\U0001D6CF", U"\u03BE", U"\u03BE"},
+	{U"\U0001D6D0", U"\U0001D6D0", U"\U0001D6D0", U"\u03BF", U"\u03BF"},
+	{U"\U0001D6D1", U"\U0001D6D1", U"\U0001D6D1", U"\u03C0", U"\u03C0"},
+	{U"\U0001D6D2", U"\U0001D6D2", U"\U0001D6D2", U"\u03C1", U"\u03C1"},
+	{U"\U0001D6D3", U"\U0001D6D3", U"\U0001D6D3", U"\u03C2", U"\u03C2"},
+	{U"\U0001D6D4", U"\U0001D6D4", U"\U0001D6D4", U"\u03C3", U"\u03C3"},
+	{U"\U0001D6D5", U"\U0001D6D5", U"\U0001D6D5", U"\u03C4", U"\u03C4"},
+	{U"\U0001D6D6", U"\U0001D6D6", U"\U0001D6D6", U"\u03C5", U"\u03C5"},
+	{U"\U0001D6D7", U"\U0001D6D7", U"\U0001D6D7", U"\u03C6", U"\u03C6"},
+	{U"\U0001D6D8", U"\U0001D6D8", U"\U0001D6D8", U"\u03C7", U"\u03C7"},
+	{U"\U0001D6D9", U"\U0001D6D9", U"\U0001D6D9", U"\u03C8", U"\u03C8"},
+	{U"\U0001D6DA", U"\U0001D6DA", U"\U0001D6DA", U"\u03C9", U"\u03C9"},
+	{U"\U0001D6DB", U"\U0001D6DB", U"\U0001D6DB", U"\u2202", U"\u2202"},
+	{U"\U0001D6DC", U"\U0001D6DC", U"\U0001D6DC", U"\u03B5", U"\u03B5"},
+	{U"\U0001D6DD", U"\U0001D6DD", U"\U0001D6DD", U"\u03B8", U"\u03B8"},
+	{U"\U0001D6DE", U"\U0001D6DE", U"\U0001D6DE", U"\u03BA", U"\u03BA"},
+	{U"\U0001D6DF", U"\U0001D6DF", U"\U0001D6DF", U"\u03C6", U"\u03C6"},
+	{U"\U0001D6E0", U"\U0001D6E0", U"\U0001D6E0", U"\u03C1", U"\u03C1"},
+	{U"\U0001D6E1", U"\U0001D6E1", U"\U0001D6E1", U"\u03C0", U"\u03C0"},
+	{U"\U0001D6E2", U"\U0001D6E2", U"\U0001D6E2", U"\u0391", U"\u0391"},
+	{U"\U0001D6E3", U"\U0001D6E3", U"\U0001D6E3", U"\u0392", U"\u0392"},
+	{U"\U0001D6E4", U"\U0001D6E4", U"\U0001D6E4", U"\u0393", U"\u0393"},
+	{U"\U0001D6E5", U"\U0001D6E5", U"\U0001D6E5", U"\u0394", U"\u0394"},
+	{U"\U0001D6E6", U"\U0001D6E6", U"\U0001D6E6", U"\u0395", U"\u0395"},
+	{U"\U0001D6E7", U"\U0001D6E7", U"\U0001D6E7", U"\u0396", U"\u0396"},
+	{U"\U0001D6E8", U"\U0001D6E8", U"\U0001D6E8", U"\u0397", U"\u0397"},
+	{U"\U0001D6E9", U"\U0001D6E9", U"\U0001D6E9", U"\u0398", U"\u0398"},
+	{U"\U0001D6EA", U"\U0001D6EA", U"\U0001D6EA", U"\u0399", U"\u0399"},
+	{U"\U0001D6EB", U"\U0001D6EB", U"\U0001D6EB", U"\u039A", U"\u039A"},
+	{U"\U0001D6EC", U"\U0001D6EC", U"\U0001D6EC", U"\u039B", U"\u039B"},
+	{U"\U0001D6ED", U"\U0001D6ED", U"\U0001D6ED", U"\u039C", U"\u039C"},
+	{U"\U0001D6EE", U"\U0001D6EE", U"\U0001D6EE", U"\u039D", U"\u039D"},
+	{U"\U0001D6EF", U"\U0001D6EF", U"\U0001D6EF", U"\u039E", U"\u039E"},
+	{U"\U0001D6F0", U"\U0001D6F0", U"\U0001D6F0", U"\u039F", U"\u039F"},
+	{U"\U0001D6F1", U"\U0001D6F1", U"\U0001D6F1", U"\u03A0", U"\u03A0"},
+	{U"\U0001D6F2", U"\U0001D6F2", U"\U0001D6F2", U"\u03A1", U"\u03A1"},
+	{U"\U0001D6F3", U"\U0001D6F3", U"\U0001D6F3", U"\u0398", U"\u0398"},
+	{U"\U0001D6F4", U"\U0001D6F4", U"\U0001D6F4", U"\u03A3", U"\u03A3"},
+	{U"\U0001D6F5", U"\U0001D6F5", U"\U0001D6F5", U"\u03A4", U"\u03A4"},
+	{U"\U0001D6F6", U"\U0001D6F6", U"\U0001D6F6", U"\u03A5", U"\u03A5"},
+	{U"\U0001D6F7", U"\U0001D6F7", U"\U0001D6F7", U"\u03A6", U"\u03A6"},
+	{U"\U0001D6F8", U"\U0001D6F8", U"\U0001D6F8", U"\u03A7", U"\u03A7"},
+	{U"\U0001D6F9", U"\U0001D6F9", U"\U0001D6F9", U"\u03A8", U"\u03A8"},
+	{U"\U0001D6FA", U"\U0001D6FA", U"\U0001D6FA", U"\u03A9", U"\u03A9"},
+	{U"\U0001D6FB", U"\U0001D6FB", U"\U0001D6FB", U"\u2207", U"\u2207"},
+	{U"\U0001D6FC", U"\U0001D6FC", U"\U0001D6FC", U"\u03B1", U"\u03B1"},
+	{U"\U0001D6FD", U"\U0001D6FD", U"\U0001D6FD", U"\u03B2", U"\u03B2"},
+	{U"\U0001D6FE", U"\U0001D6FE", U"\U0001D6FE", U"\u03B3", U"\u03B3"},
+	{U"\U0001D6FF", U"\U0001D6FF", U"\U0001D6FF", U"\u03B4", U"\u03B4"},
+	{U"\U0001D700", U"\U0001D700", U"\U0001D700", U"\u03B5", U"\u03B5"},
+	{U"\U0001D701", U"\U0001D701", U"\U0001D701", U"\u03B6", U"\u03B6"},
+	{U"\U0001D702", U"\U0001D702", U"\U0001D702", U"\u03B7", U"\u03B7"},
+	{U"\U0001D703", U"\U0001D703", U"\U0001D703", U"\u03B8", U"\u03B8"},
+	{U"\U0001D704", U"\U0001D704", U"\U0001D704", U"\u03B9", U"\u03B9"},
+	{U"\U0001D705", U"\U0001D705", U"\U0001D705", U"\u03BA", U"\u03BA"},
+	{U"\U0001D706", U"\U0001D706", U"\U0001D706", U"\u03BB", U"\u03BB"},
+	{U"\U0001D707", U"\U0001D707", U"\U0001D707", U"\u03BC", U"\u03BC"},
+	{U"\U0001D708", U"\U0001D708", U"\U0001D708", U"\u03BD", U"\u03BD"},
+	{U"\U0001D709", U"\U0001D709", U"\U0001D709", U"\u03BE", U"\u03BE"},
+	{U"\U0001D70A", U"\U0001D70A", U"\U0001D70A", U"\u03BF", U"\u03BF"},
+	{U"\U0001D70B", U"\U0001D70B", U"\U0001D70B", U"\u03C0", U"\u03C0"},
+	{U"\U0001D70C", U"\U0001D70C", U"\U0001D70C", U"\u03C1", U"\u03C1"},
+	{U"\U0001D70D", U"\U0001D70D", U"\U0001D70D", U"\u03C2", U"\u03C2"},
+	{U"\U0001D70E", U"\U0001D70E", U"\U0001D70E", U"\u03C3", U"\u03C3"},
+	{U"\U0001D70F", U"\U0001D70F", U"\U0001D70F", U"\u03C4", U"\u03C4"},
+	{U"\U0001D710", U"\U0001D710", U"\U0001D710", U"\u03C5", U"\u03C5"},
+	{U"\U0001D711", U"\U0001D711", U"\U0001D711", U"\u03C6", U"\u03C6"},
+	{U"\U0001D712", U"\U0001D712", U"\U0001D712", U"\u03C7", U"\u03C7"},
+	{U"\U0001D713", U"\U0001D713", U"\U0001D713", U"\u03C8", U"\u03C8"},
+	{U"\U0001D714", U"\U0001D714", U"\U0001D714", U"\u03C9", U"\u03C9"},
+	{U"\U0001D715", U"\U0001D715", U"\U0001D715", U"\u2202", U"\u2202"},
+	{U"\U0001D716", U"\U0001D716", U"\U0001D716", U"\u03B5", U"\u03B5"},
+	{U"\U0001D717", U"\U0001D717", U"\U0001D717", U"\u03B8", U"\u03B8"},
+	{U"\U0001D718", U"\U0001D718", U"\U0001D718", U"\u03BA", U"\u03BA"},
+	{U"\U0001D719", U"\U0001D719", U"\U0001D719", U"\u03C6", U"\u03C6"},
+	{U"\U0001D71A", U"\U0001D71A", U"\U0001D71A", U"\u03C1", U"\u03C1"},
+	{U"\U0001D71B", U"\U0001D71B", U"\U0001D71B", U"\u03C0", U"\u03C0"},
+	{U"\U0001D71C", U"\U0001D71C", U"\U0001D71C", U"\u0391", U"\u0391"},
+	{U"\U0001D71D", U"\U0001D71D", U"\U0001D71D", U"\u0392", U"\u0392"},
+	{U"\U0001D71E", U"\U0001D71E", U"\U0001D71E", U"\u0393", U"\u0393"},
+	{U"\U0001D71F", U"\U0001D71F", U"\U0001D71F", U"\u0394", U"\u0394"},
+	{U"\U0001D720", U"\U0001D720", U"\U0001D720", U"\u0395", U"\u0395"},
+	{U"\U0001D721", U"\U0001D721", U"\U0001D721", U"\u0396", U"\u0396"},
+	{U"\U0001D722", U"\U0001D722", U"\U0001D722", U"\u0397", U"\u0397"},
+	{U"\U0001D723", U"\U0001D723", U"\U0001D723", U"\u0398", U"\u0398"},
+	{U"\U0001D724", U"\U0001D724", U"\U0001D724", U"\u0399", U"\u0399"},
+	{U"\U0001D725", U"\U0001D725", U"\U0001D725", U"\u039A", U"\u039A"},
+	{U"\U0001D726", U"\U0001D726", U"\U0001D726", U"\u039B", U"\u039B"},
+	{U"\U0001D727", U"\U0001D727", U"\U0001D727", U"\u039C", U"\u039C"},
+	{U"\U0001D728", U"\U0001D728", U"\U0001D728", U"\u039D", U"\u039D"},
+	{U"\U0001D729", U"\U0001D729", U"\U0001D729", U"\u039E", U"\u039E"},
+	{U"\U0001D72A", U"\U0001D72A", U"\U0001D72A", U"\u039F", U"\u039F"},
+	{U"\U0001D72B", U"\U0001D72B", U"\U0001D72B", U"\u03A0", U"\u03A0"},
+	{U"\U0001D72C", U"\U0001D72C", U"\U0001D72C", U"\u03A1", U"\u03A1"},
+	{U"\U0001D72D", U"\U0001D72D", U"\U0001D72D", U"\u0398", U"\u0398"},
+	{U"\U0001D72E", U"\U0001D72E", U"\U0001D72E", U"\u03A3", U"\u03A3"},
+	{U"\U0001D72F", U"\U0001D72F", U"\U0001D72F", U"\u03A4", U"\u03A4"},
+	{U"\U0001D730", U"\U0001D730", U"\U0001D730", U"\u03A5", U"\u03A5"},
+	{U"\U0001D731", U"\U0001D731", U"\U0001D731", U"\u03A6", U"\u03A6"},
+	{U"\U0001D732", U"\U0001D732", U"\U0001D732", U"\u03A7", U"\u03A7"},
+	{U"\U0001D733", U"\U0001D733", U"\U0001D733", U"\u03A8", U"\u03A8"},
+	{U"\U0001D734", U"\U0001D734", U"\U0001D734", U"\u03A9", U"\u03A9"},
+	{U"\U0001D735", U"\U0001D735", U"\U0001D735", U"\u2207", U"\u2207"},
+	{U"\U0001D736", U"\U0001D736", U"\U0001D736", U"\u03B1", U"\u03B1"},
+	{U"\U0001D737", U"\U0001D737", U"\U0001D737", U"\u03B2", U"\u03B2"},
+	{U"\U0001D738", U"\U0001D738", U"\U0001D738", U"\u03B3", U"\u03B3"},
+	{U"\U0001D739", U"\U0001D739", U"\U0001D739", U"\u03B4", U"\u03B4"},
+	{U"\U0001D73A", U"\U0001D73A", U"\U0001D73A", U"\u03B5", U"\u03B5"},
+	{U"\U0001D73B", U"\U0001D73B", U"\U0001D73B", U"\u03B6", U"\u03B6"},
+	{U"\U0001D73C", U"\U0001D73C", U"\U0001D73C", U"\u03B7", U"\u03B7"},
+	{U"\U0001D73D", U"\U0001D73D", U"\U0001D73D", U"\u03B8", U"\u03B8"},
+	{U"\U0001D73E", U"\U0001D73E", U"\U0001D73E", U"\u03B9", U"\u03B9"},
+	{U"\U0001D73F", U"\U0001D73F", U"\U0001D73F", U"\u03BA", U"\u03BA"},
+	{U"\U0001D740", U"\U0001D740", U"\U0001D740", U"\u03BB", U"\u03BB"},
+	{U"\U0001D741", U"\U0001D741", U"\U0001D741", U"\u03BC", U"\u03BC"},
+	{U"\U0001D742", U"\U0001D742", U"\U0001D742", U"\u03BD", U"\u03BD"},
+	{U"\U0001D743", U"\U0001D743", U"\U0001D743", U"\u03BE", U"\u03BE"},
+	{U"\U0001D744", U"\U0001D744", U"\U0001D744", U"\u03BF", U"\u03BF"},
+	{U"\U0001D745", U"\U0001D745", U"\U0001D745", U"\u03C0", U"\u03C0"},
+	{U"\U0001D746", U"\U0001D746", U"\U0001D746", U"\u03C1", U"\u03C1"},
+	{U"\U0001D747", U"\U0001D747", U"\U0001D747", U"\u03C2", U"\u03C2"},
+	{U"\U0001D748", U"\U0001D748", U"\U0001D748", U"\u03C3", U"\u03C3"},
+	{U"\U0001D749", U"\U0001D749", U"\U0001D749", U"\u03C4", U"\u03C4"},
+	{U"\U0001D74A", U"\U0001D74A", U"\U0001D74A", U"\u03C5", U"\u03C5"},
+	{U"\U0001D74B", U"\U0001D74B", U"\U0001D74B", U"\u03C6", U"\u03C6"},
+	{U"\U0001D74C", U"\U0001D74C", U"\U0001D74C", U"\u03C7", U"\u03C7"},
+	{U"\U0001D74D", U"\U0001D74D", U"\U0001D74D", U"\u03C8", U"\u03C8"},
+	{U"\U0001D74E", U"\U0001D74E", U"\U0001D74E", U"\u03C9", U"\u03C9"},
+	{U"\U0001D74F", U"\U0001D74F", U"\U0001D74F", U"\u2202", U"\u2202"},
+	{U"\U0001D750", U"\U0001D750", U"\U0001D750", U"\u03B5", U"\u03B5"},
+	{U"\U0001D751", U"\U0001D751", U"\U0001D751", U"\u03B8", U"\u03B8"},
+	{U"\U0001D752", U"\U0001D752", U"\U0001D752", U"\u03BA", U"\u03BA"},
+	{U"\U0001D753", U"\U0001D753", U"\U0001D753", U"\u03C6", U"\u03C6"},
+	{U"\U0001D754", U"\U0001D754", U"\U0001D754", U"\u03C1", U"\u03C1"},
+	{U"\U0001D755", U"\U0001D755", U"\U0001D755", U"\u03C0", U"\u03C0"},
+	{U"\U0001D756", U"\U0001D756", U"\U0001D756", U"\u0391", U"\u0391"},
+	{U"\U0001D757", U"\U0001D757", U"\U0001D757", U"\u0392", U"\u0392"},
+	{U"\U0001D758", U"\U0001D758", U"\U0001D758", U"\u0393", U"\u0393"},
+	{U"\U0001D759", U"\U0001D759", U"\U0001D759", U"\u0394", U"\u0394"},
+	{U"\U0001D75A", U"\U0001D75A", U"\U0001D75A", U"\u0395", U"\u0395"},
+	{U"\U0001D75B", U"\U0001D75B", U"\U0001D75B", U"\u0396", U"\u0396"},
+	{U"\U0001D75C", U"\U0001D75C", U"\U0001D75C", U"\u0397", U"\u0397"},
+	{U"\U0001D75D", U"\U0001D75D", U"\U0001D75D", U"\u0398", U"\u0398"},
+	{U"\U0001D75E", U"\U0001D75E", U"\U0001D75E", U"\u0399", U"\u0399"},
+	{U"\U0001D75F", U"\U0001D75F", U"\U0001D75F", U"\u039A", U"\u039A"},
+	{U"\U0001D760", U"\U0001D760", U"\U0001D760", U"\u039B", U"\u039B"},
+	{U"\U0001D761", U"\U0001D761", U"\U0001D761", U"\u039C", U"\u039C"},
+	{U"\U0001D762", U"\U0001D762", U"\U0001D762", U"\u039D", U"\u039D"},
+	{U"\U0001D763", U"\U0001D763", U"\U0001D763", U"\u039E", U"\u039E"},
+	{U"\U0001D764", U"\U0001D764", U"\U0001D764", U"\u039F", U"\u039F"},
+	{U"\U0001D765", U"\U0001D765", U"\U0001D765", U"\u03A0", U"\u03A0"},
+	{U"\U0001D766", U"\U0001D766", U"\U0001D766", U"\u03A1", U"\u03A1"},
+	{U"\U0001D767", U"\U0001D767", U"\U0001D767", U"\u0398", U"\u0398"},
+	{U"\U0001D768", U"\U0001D768", U"\U0001D768", U"\u03A3", U"\u03A3"},
+	{U"\U0001D769", U"\U0001D769", U"\U0001D769", U"\u03A4", U"\u03A4"},
+	{U"\U0001D76A", U"\U0001D76A", U"\U0001D76A", U"\u03A5", U"\u03A5"},
+	{U"\U0001D76B", U"\U0001D76B", U"\U0001D76B", U"\u03A6", U"\u03A6"},
+	{U"\U0001D76C", U"\U0001D76C", U"\U0001D76C", U"\u03A7", U"\u03A7"},
+	{U"\U0001D76D", U"\U0001D76D", U"\U0001D76D", U"\u03A8", U"\u03A8"},
+	{U"\U0001D76E", U"\U0001D76E", U"\U0001D76E", U"\u03A9", U"\u03A9"},
+	{U"\U0001D76F", U"\U0001D76F", U"\U0001D76F", U"\u2207", U"\u2207"},
+	{U"\U0001D770", U"\U0001D770", U"\U0001D770", U"\u03B1", U"\u03B1"},
+	{U"\U0001D771", U"\U0001D771", U"\U0001D771", U"\u03B2", U"\u03B2"},
+	{U"\U0001D772", U"\U0001D772", U"\U0001D772", U"\u03B3", U"\u03B3"},
+	{U"\U0001D773", U"\U0001D773", U"\U0001D773", U"\u03B4", U"\u03B4"},
+	{U"\U0001D774", U"\U0001D774", U"\U0001D774", U"\u03B5", U"\u03B5"},
+	{U"\U0001D775", U"\U0001D775", U"\U0001D775", U"\u03B6", U"\u03B6"},
+	{U"\U0001D776", U"\U0001D776", U"\U0001D776", U"\u03B7", U"\u03B7"},
+	{U"\U0001D777", U"\U0001D777", U"\U0001D777", U"\u03B8", U"\u03B8"},
+	{U"\U0001D778", U"\U0001D778", U"\U0001D778", U"\u03B9", U"\u03B9"},
+	{U"\U0001D779", U"\U0001D779", U"\U0001D779", U"\u03BA", U"\u03BA"},
+	{U"\U0001D77A", U"\U0001D77A", U"\U0001D77A", U"\u03BB", U"\u03BB"},
+	{U"\U0001D77B", U"\U0001D77B", U"\U0001D77B", U"\u03BC", U"\u03BC"},
+	{U"\U0001D77C", U"\U0001D77C", U"\U0001D77C", U"\u03BD", U"\u03BD"},
+	{U"\U0001D77D", U"\U0001D77D", U"\U0001D77D", U"\u03BE", U"\u03BE"},
+	{U"\U0001D77E", U"\U0001D77E", U"\U0001D77E", U"\u03BF", U"\u03BF"},
+	{U"\U0001D77F", U"\U0001D77F", U"\U0001D77F", U"\u03C0", U"\u03C0"},
+	{U"\U0001D780", U"\U0001D780", U"\U0001D780", U"\u03C1", U"\u03C1"},
+	{U"\U0001D781", U"\U0001D781", U"\U0001D781", U"\u03C2", U"\u03C2"},
+	{U"\U0001D782", U"\U0001D782", U"\U0001D782", U"\u03C3", U"\u03C3"},
+	{U"\U0001D783", U"\U0001D783", U"\U0001D783", U"\u03C4", U"\u03C4"},
+	{U"\U0001D784", U"\U0001D784", U"\U0001D784", U"\u03C5", U"\u03C5"},
+	{U"\U0001D785", U"\U0001D785", U"\U0001D785", U"\u03C6", U"\u03C6"},
+	{U"\U0001D786", U"\U0001D786", U"\U0001D786", U"\u03C7", U"\u03C7"},
+	{U"\U0001D787", U"\U0001D787", U"\U0001D787", U"\u03C8", U"\u03C8"},
+	{U"\U0001D788", U"\U0001D788", U"\U0001D788", U"\u03C9", U"\u03C9"},
+	{U"\U0001D789", U"\U0001D789", U"\U0001D789", U"\u2202", U"\u2202"},
+	{U"\U0001D78A", U"\U0001D78A", U"\U0001D78A", U"\u03B5", U"\u03B5"},
+	{U"\U0001D78B", U"\U0001D78B", U"\U0001D78B", U"\u03B8", U"\u03B8"},
+	{U"\U0001D78C", U"\U0001D78C", U"\U0001D78C", U"\u03BA", U"\u03BA"},
+	{U"\U0001D78D", U"\U0001D78D", U"\U0001D78D", U"\u03C6", U"\u03C6"},
+	{U"\U0001D78E", U"\U0001D78E", U"\U0001D78E", U"\u03C1", U"\u03C1"},
+	{U"\U0001D78F", U"\U0001D78F", U"\U0001D78F", U"\u03C0", U"\u03C0"},
+	{U"\U0001D790", U"\U0001D790", U"\U0001D790", U"\u0391", U"\u0391"},
+	{U"\U0001D791", U"\U0001D791", U"\U0001D791", U"\u0392", U"\u0392"},
+	{U"\U0001D792", U"\U0001D792", U"\U0001D792", U"\u0393", U"\u0393"},
+	{U"\U0001D793", U"\U0001D793", U"\U0001D793", U"\u0394", U"\u0394"},
+	{U"\U0001D794", U"\U0001D794", U"\U0001D794", U"\u0395", U"\u0395"},
+	{U"\U0001D795", U"\U0001D795", U"\U0001D795", U"\u0396", U"\u0396"},
+	{U"\U0001D796", U"\U0001D796", U"\U0001D796", U"\u0397", U"\u0397"},
+	{U"\U0001D797", U"\U0001D797", U"\U0001D797", U"\u0398", U"\u0398"},
+	{U"\U0001D798", U"\U0001D798", U"\U0001D798", U"\u0399", U"\u0399"},
+	{U"\U0001D799", U"\U0001D799", U"\U0001D799", U"\u039A", U"\u039A"},
+	{U"\U0001D79A", U"\U0001D79A", U"\U0001D79A", U"\u039B", U"\u039B"},
+	{U"\U0001D79B", U"\U0001D79B", U"\U0001D79B", U"\u039C", U"\u039C"},
+	{U"\U0001D79C", U"\U0001D79C", U"\U0001D79C", U"\u039D", U"\u039D"},
+	{U"\U0001D79D", U"\U0001D79D", U"\U0001D79D", U"\u039E", U"\u039E"},
+	{U"\U0001D79E", U"\U0001D79E", U"\U0001D79E", U"\u039F", U"\u039F"},
+	{U"\U0001D79F", U"\U0001D79F", U"\U0001D79F", U"\u03A0", U"\u03A0"},
+	{U"\U0001D7A0", U"\U0001D7A0", U"\U0001D7A0", U"\u03A1", U"\u03A1"},
+	{U"\U0001D7A1", U"\U0001D7A1", U"\U0001D7A1", U"\u0398", U"\u0398"},
+	{U"\U0001D7A2", U"\U0001D7A2", U"\U0001D7A2", U"\u03A3", U"\u03A3"},
+	{U"\U0001D7A3", U"\U0001D7A3", U"\U0001D7A3", U"\u03A4", U"\u03A4"},
+	{U"\U0001D7A4", U"\U0001D7A4", U"\U0001D7A4", U"\u03A5", U"\u03A5"},
+	{U"\U0001D7A5", U"\U0001D7A5", U"\U0001D7A5", U"\u03A6", U"\u03A6"},
+	{U"\U0001D7A6", U"\U0001D7A6", U"\U0001D7A6", U"\u03A7", U"\u03A7"},
+	{U"\U0001D7A7", U"\U0001D7A7", U"\U0001D7A7", U"\u03A8", U"\u03A8"},
+	{U"\U0001D7A8", U"\U0001D7A8", U"\U0001D7A8", U"\u03A9", U"\u03A9"},
+	{U"\U0001D7A9", U"\U0001D7A9", U"\U0001D7A9", U"\u2207", U"\u2207"},
+	{U"\U0001D7AA", U"\U0001D7AA", U"\U0001D7AA", U"\u03B1", U"\u03B1"},
+	{U"\U0001D7AB", U"\U0001D7AB", U"\U0001D7AB", U"\u03B2", U"\u03B2"},
+	{U"\U0001D7AC", U"\U0001D7AC", U"\U0001D7AC", U"\u03B3", U"\u03B3"},
+	{U"\U0001D7AD", U"\U0001D7AD", U"\U0001D7AD", U"\u03B4", U"\u03B4"},
+	{U"\U0001D7AE", U"\U0001D7AE", U"\U0001D7AE", U"\u03B5", U"\u03B5"},
+	{U"\U0001D7AF", U"\U0001D7AF", U"\U0001D7AF", U"\u03B6", U"\u03B6"},
+	{U"\U0001D7B0", U"\U0001D7B0", U"\U0001D7B0", U"\u03B7", U"\u03B7"},
+	{U"\U0001D7B1", U"\U0001D7B1", U"\U0001D7B1", U"\u03B8", U"\u03B8"},
+	{U"\U0001D7B2", U"\U0001D7B2", U"\U0001D7B2", U"\u03B9", U"\u03B9"},
+	{U"\U0001D7B3", U"\U0001D7B3", U"\U0001D7B3", U"\u03BA", U"\u03BA"},
+	{U"\U0001D7B4", U"\U0001D7B4", U"\U0001D7B4", U"\u03BB", U"\u03BB"},
+	{U"\U0001D7B5", U"\U0001D7B5", U"\U0001D7B5", U"\u03BC", U"\u03BC"},
+	{U"\U0001D7B6", U"\U0001D7B6", U"\U0001D7B6", U"\u03BD", U"\u03BD"},
+	{U"\U0001D7B7", U"\U0001D7B7", U"\U0001D7B7", U"\u03BE", U"\u03BE"},
+	{U"\U0001D7B8", U"\U0001D7B8", U"\U0001D7B8", U"\u03BF", U"\u03BF"},
+	{U"\U0001D7B9", U"\U0001D7B9", U"\U0001D7B9", U"\u03C0", U"\u03C0"},
+	{U"\U0001D7BA", U"\U0001D7BA", U"\U0001D7BA", U"\u03C1", U"\u03C1"},
+	{U"\U0001D7BB", U"\U0001D7BB", U"\U0001D7BB", U"\u03C2", U"\u03C2"},
+	{U"\U0001D7BC", U"\U0001D7BC", U"\U0001D7BC", U"\u03C3", U"\u03C3"},
+	{U"\U0001D7BD", U"\U0001D7BD", U"\U0001D7BD", U"\u03C4", U"\u03C4"},
+	{U"\U0001D7BE", U"\U0001D7BE", U"\U0001D7BE", U"\u03C5", U"\u03C5"},
+	{U"\U0001D7BF", U"\U0001D7BF", U"\U0001D7BF", U"\u03C6", U"\u03C6"},
+	{U"\U0001D7C0", U"\U0001D7C0", U"\U0001D7C0", U"\u03C7", U"\u03C7"},
+	{U"\U0001D7C1", U"\U0001D7C1", U"\U0001D7C1", U"\u03C8", U"\u03C8"},
+	{U"\U0001D7C2", U"\U0001D7C2", U"\U0001D7C2", U"\u03C9", U"\u03C9"},
+	{U"\U0001D7C3", U"\U0001D7C3", U"\U0001D7C3", U"\u2202", U"\u2202"},
+	{U"\U0001D7C4", U"\U0001D7C4", U"\U0001D7C4", U"\u03B5", U"\u03B5"},
+	{U"\U0001D7C5", U"\U0001D7C5", U"\U0001D7C5", U"\u03B8", U"\u03B8"},
+	{U"\U0001D7C6", U"\U0001D7C6", U"\U0001D7C6", U"\u03BA", U"\u03BA"},
+	{U"\U0001D7C7", U"\U0001D7C7", U"\U0001D7C7", U"\u03C6", U"\u03C6"},
+	{U"\U0001D7C8", U"\U0001D7C8", U"\U0001D7C8", U"\u03C1", U"\u03C1"},
+	{U"\U0001D7C9", U"\U0001D7C9", U"\U0001D7C9", U"\u03C0", U"\u03C0"},
+	{U"\U0001D7CA", U"\U0001D7CA", U"\U0001D7CA", U"\u03DC", U"\u03DC"},
+	{U"\U0001D7CB", U"\U0001D7CB", U"\U0001D7CB", U"\u03DD", U"\u03DD"},
+	{U"\U0001D7CE", U"\U0001D7CE", U"\U0001D7CE", U"0", U"0"},
+	{U"\U0001D7CF", U"\U0001D7CF", U"\U0001D7CF", U"1", U"1"},
+	{U"\U0001D7D0", U"\U0001D7D0", U"\U0001D7D0", U"2", U"2"},
+	{U"\U0001D7D1", U"\U0001D7D1", U"\U0001D7D1", U"3", U"3"},
+	{U"\U0001D7D2", U"\U0001D7D2", U"\U0001D7D2", U"4", U"4"},
+	{U"\U0001D7D3", U"\U0001D7D3", U"\U0001D7D3", U"5", U"5"},
+	{U"\U0001D7D4", U"\U0001D7D4", U"\U0001D7D4", U"6", U"6"},
+	{U"\U0001D7D5", U"\U0001D7D5", U"\U0001D7D5", U"7", U"7"},
+	{U"\U0001D7D6", U"\U0001D7D6", U"\U0001D7D6", U"8", U"8"},
+	{U"\U0001D7D7", U"\U0001D7D7", U"\U0001D7D7", U"9", U"9"},
+	{U"\U0001D7D8", U"\U0001D7D8", U"\U0001D7D8", U"0", U"0"},
+	{U"\U0001D7D9", U"\U0001D7D9", U"\U0001D7D9", U"1", U"1"},
+	{U"\U0001D7DA", U"\U0001D7DA", U"\U0001D7DA", U"2", U"2"},
+	{U"\U0001D7DB", U"\U0001D7DB", U"\U0001D7DB", U"3", U"3"},
+	{U"\U0001D7DC", U"\U0001D7DC", U"\U0001D7DC", U"4", U"4"},
+	{U"\U0001D7DD", U"\U0001D7DD", U"\U0001D7DD", U"5", U"5"},
+	{U"\U0001D7DE", U"\U0001D7DE", U"\U0001D7DE", U"6", U"6"},
+	{U"\U0001D7DF", U"\U0001D7DF", U"\U0001D7DF", U"7", U"7"},
+	{U"\U0001D7E0", U"\U0001D7E0", U"\U0001D7E0", U"8", U"8"},
+	{U"\U0001D7E1", U"\U0001D7E1", U"\U0001D7E1", U"9", U"9"},
+	{U"\U0001D7E2", U"\U0001D7E2", U"\U0001D7E2", U"0", U"0"},
+	{U"\U0001D7E3", U"\U0001D7E3", U"\U0001D7E3", U"1", U"1"},
+	{U"\U0001D7E4", U"\U0001D7E4", U"\U0001D7E4", U"2", U"2"},
+	{U"\U0001D7E5", U"\U0001D7E5", U"\U0001D7E5", U"3", U"3"},
+	{U"\U0001D7E6", U"\U0001D7E6", U"\U0001D7E6", U"4", U"4"},
+	{U"\U0001D7E7", U"\U0001D7E7", U"\U0001D7E7", U"5", U"5"},
+	{U"\U0001D7E8", U"\U0001D7E8", U"\U0001D7E8", U"6", U"6"},
+	{U"\U0001D7E9", U"\U0001D7E9", U"\U0001D7E9", U"7", U"7"},
+	{U"\U0001D7EA", U"\U0001D7EA", U"\U0001D7EA", U"8", U"8"},
+	{U"\U0001D7EB", U"\U0001D7EB", U"\U0001D7EB", U"9", U"9"},
+	{U"\U0001D7EC", U"\U0001D7EC", U"\U0001D7EC", U"0", U"0"},
+	{U"\U0001D7ED", U"\U0001D7ED", U"\U0001D7ED", U"1", U"1"},
+	{U"\U0001D7EE", U"\U0001D7EE", U"\U0001D7EE", U"2", U"2"},
+	{U"\U0001D7EF", U"\U0001D7EF", U"\U0001D7EF", U"3", U"3"},
+	{U"\U0001D7F0", U"\U0001D7F0", U"\U0001D7F0", U"4", U"4"},
+	{U"\U0001D7F1", U"\U0001D7F1", U"\U0001D7F1", U"5", U"5"},
+	{U"\U0001D7F2", U"\U0001D7F2", U"\U0001D7F2", U"6", U"6"},
+	{U"\U0001D7F3", U"\U0001D7F3", U"\U0001D7F3", U"7", U"7"},
+	{U"\U0001D7F4", U"\U0001D7F4", U"\U0001D7F4", U"8", U"8"},
+	{U"\U0001D7F5", U"\U0001D7F5", U"\U0001D7F5", U"9", U"9"},
+	{U"\U0001D7F6", U"\U0001D7F6", U"\U0001D7F6", U"0", U"0"},
+	{U"\U0001D7F7", U"\U0001D7F7", U"\U0001D7F7", U"1", U"1"},
+	{U"\U0001D7F8", U"\U0001D7F8", U"\U0001D7F8", U"2", U"2"},
+	{U"\U0001D7F9", U"\U0001D7F9", U"\U0001D7F9", U"3", U"3"},
+	{U"\U0001D7FA", U"\U0001D7FA", U"\U0001D7FA", U"4", U"4"},
+	{U"\U0001D7FB", U"\U0001D7FB", U"\U0001D7FB", U"5", U"5"},
+	{U"\U0001D7FC", U"\U0001D7FC", U"\U0001D7FC", U"6", U"6"},
+	{U"\U0001D7FD", U"\U0001D7FD", U"\U0001D7FD", U"7", U"7"},
+	{U"\U0001D7FE", U"\U0001D7FE", U"\U0001D7FE", U"8", U"8"},
+	{U"\U0001D7FF", U"\U0001D7FF", U"\U0001D7FF", U"9", U"9"},
+	{U"\U0001EE00", U"\U0001EE00", U"\U0001EE00", U"\u0627", U"\u0627"},
+	{U"\U0001EE01", U"\U0001EE01", U"\U0001EE01", U"\u0628", U"\u0628"},
+	{U"\U0001EE02", U"\U0001EE02", U"\U0001EE02", U"\u062C", U"\u062C"},
+	{U"\U0001EE03", U"\U0001EE03", U"\U0001EE03", U"\u062F", U"\u062F"},
+	{U"\U0001EE05", U"\U0001EE05", U"\U0001EE05", U"\u0648", U"\u0648"},
+	{U"\U0001EE06", U"\U0001EE06", U"\U0001EE06", U"\u0632", U"\u0632"},
+	{U"\U0001EE07", U"\U0001EE07", U"\U0001EE07", U"\u062D", U"\u062D"},
+	{U"\U0001EE08", U"\U0001EE08", U"\U0001EE08", U"\u0637", U"\u0637"},
+	{U"\U0001EE09", U"\U0001EE09", U"\U0001EE09", U"\u064A", U"\u064A"},
+	{U"\U0001EE0A", U"\U0001EE0A", U"\U0001EE0A", U"\u0643", U"\u0643"},
+	{U"\U0001EE0B", U"\U0001EE0B", U"\U0001EE0B", U"\u0644", U"\u0644"},
+	{U"\U0001EE0C", U"\U0001EE0C", U"\U0001EE0C", U"\u0645", U"\u0645"},
+	{U"\U0001EE0D", U"\U0001EE0D", U"\U0001EE0D", U"\u0646", U"\u0646"},
+	{U"\U0001EE0E", U"\U0001EE0E", U"\U0001EE0E", U"\u0633", U"\u0633"},
+	{U"\U0001EE0F", U"\U0001EE0F", U"\U0001EE0F", U"\u0639", U"\u0639"},
+	{U"\U0001EE10", U"\U0001EE10", U"\U0001EE10", U"\u0641", U"\u0641"},
+	{U"\U0001EE11", U"\U0001EE11", U"\U0001EE11", U"\u0635", U"\u0635"},
+	{U"\U0001EE12", U"\U0001EE12", U"\U0001EE12", U"\u0642", U"\u0642"},
+	{U"\U0001EE13", U"\U0001EE13", U"\U0001EE13", U"\u0631", U"\u0631"},
+	{U"\U0001EE14", U"\U0001EE14", U"\U0001EE14", U"\u0634", U"\u0634"},
+	{U"\U0001EE15", U"\U0001EE15", U"\U0001EE15", U"\u062A", U"\u062A"},
+	{U"\U0001EE16", U"\U0001EE16", U"\U0001EE16", U"\u062B", U"\u062B"},
+	{U"\U0001EE17", U"\U0001EE17", U"\U0001EE17", U"\u062E", U"\u062E"},
+	{U"\U0001EE18", U"\U0001EE18", U"\U0001EE18", U"\u0630", U"\u0630"},
+	{U"\U0001EE19", U"\U0001EE19", U"\U0001EE19", U"\u0636", U"\u0636"},
+	{U"\U0001EE1A", U"\U0001EE1A", U"\U0001EE1A", U"\u0638", U"\u0638"},
+	{U"\U0001EE1B", U"\U0001EE1B", U"\U0001EE1B", U"\u063A", U"\u063A"},
+	{U"\U0001EE1C", U"\U0001EE1C", U"\U0001EE1C", U"\u066E", U"\u066E"},
+	{U"\U0001EE1D", U"\U0001EE1D", U"\U0001EE1D", U"\u06BA", U"\u06BA"},
+	{U"\U0001EE1E", U"\U0001EE1E", U"\U0001EE1E", U"\u06A1", U"\u06A1"},
+	{U"\U0001EE1F", U"\U0001EE1F", U"\U0001EE1F", U"\u066F", U"\u066F"},
+	{U"\U0001EE21", U"\U0001EE21", U"\U0001EE21", U"\u0628", U"\u0628"},
+	{U"\U0001EE22", U"\U0001EE22", U"\U0001EE22", U"\u062C", U"\u062C"},
+	{U"\U0001EE24", U"\U0001EE24", U"\U0001EE24", U"\u0647", U"\u0647"},
+	{U"\U0001EE27", U"\U0001EE27", U"\U0001EE27", U"\u062D", U"\u062D"},
+	{U"\U0001EE29", U"\U0001EE29", U"\U0001EE29", U"\u064A", U"\u064A"},
+	{U"\U0001EE2A", U"\U0001EE2A", U"\U0001EE2A", U"\u0643", U"\u0643"},
+	{U"\U0001EE2B", U"\U0001EE2B", U"\U0001EE2B", U"\u0644", U"\u0644"},
+	{U"\U0001EE2C", U"\U0001EE2C", U"\U0001EE2C", U"\u0645", U"\u0645"},
+	{U"\U0001EE2D", U"\U0001EE2D", U"\U0001EE2D", U"\u0646", U"\u0646"},
+	{U"\U0001EE2E", U"\U0001EE2E", U"\U0001EE2E", U"\u0633", U"\u0633"},
+	{U"\U0001EE2F", U"\U0001EE2F", U"\U0001EE2F", U"\u0639", U"\u0639"},
+	{U"\U0001EE30", U"\U0001EE30", U"\U0001EE30", U"\u0641", U"\u0641"},
+	{U"\U0001EE31", U"\U0001EE31", U"\U0001EE31", U"\u0635", U"\u0635"},
+	{U"\U0001EE32", U"\U0001EE32", U"\U0001EE32", U"\u0642", U"\u0642"},
+	{U"\U0001EE34", U"\U0001EE34", U"\U0001EE34", U"\u0634", U"\u0634"},
+	{U"\U0001EE35", U"\U0001EE35", U"\U0001EE35", U"\u062A", U"\u062A"},
+	{U"\U0001EE36", U"\U0001EE36", U"\U0001EE36", U"\u062B", U"\u062B"},
+	{U"\U0001EE37", U"\U0001EE37", U"\U0001EE37", U"\u062E", U"\u062E"},
+	{U"\U0001EE39", U"\U0001EE39", U"\U0001EE39", U"\u0636", U"\u0636"},
+	{U"\U0001EE3B", U"\U0001EE3B", U"\U0001EE3B", U"\u063A", U"\u063A"},
+	{U"\U0001EE42", U"\U0001EE42", U"\U0001EE42", U"\u062C", U"\u062C"},
+	{U"\U0001EE47", U"\U0001EE47", U"\U0001EE47", U"\u062D", U"\u062D"},
+	{U"\U0001EE49", U"\U0001EE49", U"\U0001EE49", U"\u064A", U"\u064A"},
+	{U"\U0001EE4B", U"\U0001EE4B", U"\U0001EE4B", U"\u0644", U"\u0644"},
+	{U"\U0001EE4D", U"\U0001EE4D", U"\U0001EE4D", U"\u0646", U"\u0646"},
+	{U"\U0001EE4E", U"\U0001EE4E", U"\U0001EE4E", U"\u0633", U"\u0633"},
+	{U"\U0001EE4F", U"\U0001EE4F", U"\U0001EE4F", U"\u0639", U"\u0639"},
+	{U"\U0001EE51", U"\U0001EE51", U"\U0001EE51", U"\u0635", U"\u0635"},
+	{U"\U0001EE52", U"\U0001EE52", U"\U0001EE52", U"\u0642", U"\u0642"},
+	{U"\U0001EE54", U"\U0001EE54", U"\U0001EE54", U"\u0634", U"\u0634"},
+	{U"\U0001EE57", U"\U0001EE57", U"\U0001EE57", U"\u062E", U"\u062E"},
+	{U"\U0001EE59", U"\U0001EE59", U"\U0001EE59", U"\u0636", U"\u0636"},
+	{U"\U0001EE5B", U"\U0001EE5B", U"\U0001EE5B", U"\u063A", U"\u063A"},
+	{U"\U0001EE5D", U"\U0001EE5D", U"\U0001EE5D", U"\u06BA", U"\u06BA"},
+	{U"\U0001EE5F", U"\U0001EE5F", U"\U0001EE5F", U"\u066F", U"\u066F"},
+	{U"\U0001EE61", U"\U0001EE61", U"\U0001EE61", U"\u0628", U"\u0628"},
+	{U"\U0001EE62", U"\U0001EE62", U"\U0001EE62", U"\u062C", U"\u062C"},
+	{U"\U0001EE64", U"\U0001EE64", U"\U0001EE64", U"\u0647", U"\u0647"},
+	{U"\U0001EE67", U"\U0001EE67", U"\U0001EE67", U"\u062D", U"\u062D"},
+	{U"\U0001EE68", U"\U0001EE68", U"\U0001EE68", U"\u0637", U"\u0637"},
+	{U"\U0001EE69", U"\U0001EE69", U"\U0001EE69", U"\u064A", U"\u064A"},
+	{U"\U0001EE6A", U"\U0001EE6A", U"\U0001EE6A", U"\u0643", U"\u0643"},
+	{U"\U0001EE6C", U"\U0001EE6C", U"\U0001EE6C", U"\u0645", U"\u0645"},
+	{U"\U0001EE6D", U"\U0001EE6D", U"\U0001EE6D", U"\u0646", U"\u0646"},
+	{U"\U0001EE6E", U"\U0001EE6E", U"\U0001EE6E", U"\u0633", U"\u0633"},
+	{U"\U0001EE6F", U"\U0001EE6F", U"\U0001EE6F", U"\u0639", U"\u0639"},
+	{U"\U0001EE70", U"\U0001EE70", U"\U0001EE70", U"\u0641", U"\u0641"},
+	{U"\U0001EE71", U"\U0001EE71", U"\U0001EE71", U"\u0635", U"\u0635"},
+	{U"\U0001EE72", U"\U0001EE72", U"\U0001EE72", U"\u0642", U"\u0642"},
+	{U"\U0001EE74", U"\U0001EE74", U"\U0001EE74", U"\u0634", U"\u0634"},
+	{U"\U0001EE75", U"\U0001EE75", U"\U0001EE75", U"\u062A", U"\u062A"},
+	{U"\U0001EE76", U"\U0001EE76", U"\U0001EE76", U"\u062B", U"\u062B"},
+	{U"\U0001EE77", U"\U0001EE77", U"\U0001EE77", U"\u062E", U"\u062E"},
+	{U"\U0001EE79", U"\U0001EE79", U"\U0001EE79", U"\u0636", U"\u0636"},
+	{U"\U0001EE7A", U"\U0001EE7A", U"\U0001EE7A", U"\u0638", U"\u0638"},
+	{U"\U0001EE7B", U"\U0001EE7B", U"\U0001EE7B", U"\u063A", U"\u063A"},
+	{U"\U0001EE7C", U"\U0001EE7C", U"\U0001EE7C", U"\u066E", U"\u066E"},
+	{U"\U0001EE7E", U"\U0001EE7E", U"\U0001EE7E", U"\u06A1", U"\u06A1"},
+	{U"\U0001EE80", U"\U0001EE80", U"\U0001EE80", U"\u0627", U"\u0627"},
+	{U"\U0001EE81", U"\U0001EE81", U"\U0001EE81", U"\u0628", U"\u0628"},
+	{U"\U0001EE82", U"\U0001EE82", U"\U0001EE82", U"\u062C", U"\u062C"},
+	{U"\U0001EE83", U"\U0001EE83", U"\U0001EE83", U"\u062F", U"\u062F"},
+	{U"\U0001EE84", U"\U0001EE84", U"\U0001EE84", U"\u0647", U"\u0647"},
+	{U"\U0001EE85", U"\U0001EE85", U"\U0001EE85", U"\u0648", U"\u0648"},
+	{U"\U0001EE86", U"\U0001EE86", U"\U0001EE86", U"\u0632", U"\u0632"},
+	{U"\U0001EE87", U"\U0001EE87", U"\U0001EE87", U"\u062D", U"\u062D"},
+	{U"\U0001EE88", U"\U0001EE88", U"\U0001EE88", U"\u0637", U"\u0637"},
+	{U"\U0001EE89", U"\U0001EE89", U"\U0001EE89", U"\u064A", U"\u064A"},
+	{U"\U0001EE8B", U"\U0001EE8B", U"\U0001EE8B", U"\u0644", U"\u0644"},
+	{U"\U0001EE8C", U"\U0001EE8C", U"\U0001EE8C", U"\u0645", U"\u0645"},
+	{U"\U0001EE8D", U"\U0001EE8D", U"\U0001EE8D", U"\u0646", U"\u0646"},
+	{U"\U0001EE8E", U"\U0001EE8E", U"\U0001EE8E", U"\u0633", U"\u0633"},
+	{U"\U0001EE8F", U"\U0001EE8F", U"\U0001EE8F", U"\u0639", U"\u0639"},
+	{U"\U0001EE90", U"\U0001EE90", U"\U0001EE90", U"\u0641", U"\u0641"},
+	{U"\U0001EE91", U"\U0001EE91", U"\U0001EE91", U"\u0635", U"\u0635"},
+	{U"\U0001EE92", U"\U0001EE92", U"\U0001EE92", U"\u0642", U"\u0642"},
+	{U"\U0001EE93", U"\U0001EE93", U"\U0001EE93", U"\u0631", U"\u0631"},
+	{U"\U0001EE94", U"\U0001EE94", U"\U0001EE94", U"\u0634", U"\u0634"},
+	{U"\U0001EE95", U"\U0001EE95", U"\U0001EE95", U"\u062A", U"\u062A"},
+	{U"\U0001EE96", U"\U0001EE96", U"\U0001EE96", U"\u062B", U"\u062B"},
+	{U"\U0001EE97", U"\U0001EE97", U"\U0001EE97", U"\u062E", U"\u062E"},
+	{U"\U0001EE98", U"\U0001EE98", U"\U0001EE98", U"\u0630", U"\u0630"},
+	{U"\U0001EE99", U"\U0001EE99", U"\U0001EE99", U"\u0636", U"\u0636"},
+	{U"\U0001EE9A", U"\U0001EE9A", U"\U0001EE9A", U"\u0638", U"\u0638"},
+	{U"\U0001EE9B", U"\U0001EE9B", U"\U0001EE9B", U"\u063A", U"\u063A"},
+	{U"\U0001EEA1", U"\U0001EEA1", U"\U0001EEA1", U"\u0628", U"\u0628"},
+	{U"\U0001EEA2", U"\U0001EEA2", U"\U0001EEA2", U"\u062C", U"\u062C"},
+	{U"\U0001EEA3", U"\U0001EEA3", U"\U0001EEA3", U"\u062F", U"\u062F"},
+	{U"\U0001EEA5", U"\U0001EEA5", U"\U0001EEA5", U"\u0648", U"\u0648"},
+	{U"\U0001EEA6", U"\U0001EEA6", U"\U0001EEA6", U"\u0632", U"\u0632"},
+	{U"\U0001EEA7", U"\U0001EEA7", U"\U0001EEA7", U"\u062D", U"\u062D"},
+	{U"\U0001EEA8", U"\U0001EEA8", U"\U0001EEA8", U"\u0637", U"\u0637"},
+	{U"\U0001EEA9", U"\U0001EEA9", U"\U0001EEA9", U"\u064A", U"\u064A"},
+	{U"\U0001EEAB", U"\U0001EEAB", U"\U0001EEAB", U"\u0644", U"\u0644"},
+	{U"\U0001EEAC", U"\U0001EEAC", U"\U0001EEAC", U"\u0645", U"\u0645"},
+	{U"\U0001EEAD", U"\U0001EEAD", U"\U0001EEAD", U"\u0646", U"\u0646"},
+	{U"\U0001EEAE", U"\U0001EEAE", U"\U0001EEAE", U"\u0633", U"\u0633"},
+	{U"\U0001EEAF", U"\U0001EEAF", U"\U0001EEAF", U"\u0639", U"\u0639"},
+	{U"\U0001EEB0", U"\U0001EEB0", U"\U0001EEB0", U"\u0641", U"\u0641"},
+	{U"\U0001EEB1", U"\U0001EEB1", U"\U0001EEB1", U"\u0635", U"\u0635"},
+	{U"\U0001EEB2", U"\U0001EEB2", U"\U0001EEB2", U"\u0642", U"\u0642"},
+	{U"\U0001EEB3", U"\U0001EEB3", U"\U0001EEB3", U"\u0631", U"\u0631"},
+	{U"\U0001EEB4", U"\U0001EEB4", U"\U0001EEB4", U"\u0634", U"\u0634"},
+	{U"\U0001EEB5", U"\U0001EEB5", U"\U0001EEB5", U"\u062A", U"\u062A"},
+	{U"\U0001EEB6", U"\U0001EEB6", U"\U0001EEB6", U"\u062B", U"\u062B"},
+	{U"\U0001EEB7", U"\U0001EEB7", U"\U0001EEB7", U"\u062E", U"\u062E"},
+	{U"\U0001EEB8", U"\U0001EEB8", U"\U0001EEB8", U"\u0630", U"\u0630"},
+	{U"\U0001EEB9", U"\U0001EEB9", U"\U0001EEB9", U"\u0636", U"\u0636"},
+	{U"\U0001EEBA", U"\U0001EEBA", U"\U0001EEBA", U"\u0638", U"\u0638"},
+	{U"\U0001EEBB", U"\U0001EEBB", U"\U0001EEBB", U"\u063A", U"\u063A"},
+	{U"\U0001F100", U"\U0001F100", U"\U0001F100", U"0.", U"0."},
+	{U"\U0001F101", U"\U0001F101", U"\U0001F101", U"0,", U"0,"},
+	{U"\U0001F102", U"\U0001F102", U"\U0001F102", U"1,", U"1,"},
+	{U"\U0001F103", U"\U0001F103", U"\U0001F103", U"2,", U"2,"},
+	{U"\U0001F104", U"\U0001F104", U"\U0001F104", U"3,", U"3,"},
+	{U"\U0001F105", U"\U0001F105", U"\U0001F105", U"4,", U"4,"},
+	{U"\U0001F106", U"\U0001F106", U"\U0001F106", U"5,", U"5,"},
+	{U"\U0001F107", U"\U0001F107", U"\U0001F107", U"6,", U"6,"},
+	{U"\U0001F108", U"\U0001F108", U"\U0001F108", U"7,", U"7,"},
+	{U"\U0001F109", U"\U0001F109", U"\U0001F109", U"8,", U"8,"},
+	{U"\U0001F10A", U"\U0001F10A", U"\U0001F10A", U"9,", U"9,"},
+	{U"\U0001F110", U"\U0001F110", U"\U0001F110", U"(A)", U"(A)"},
+	{U"\U0001F111", U"\U0001F111", U"\U0001F111", U"(B)", U"(B)"},
+	{U"\U0001F112", U"\U0001F112", U"\U0001F112", U"(C)", U"(C)"},
+	{U"\U0001F113", U"\U0001F113", U"\U0001F113", U"(D)", U"(D)"},
+	{U"\U0001F114", U"\U0001F114", U"\U0001F114", U"(E)", U"(E)"},
+	{U"\U0001F115", U"\U0001F115", U"\U0001F115", U"(F)", U"(F)"},
+	{U"\U0001F116", U"\U0001F116", U"\U0001F116", U"(G)", U"(G)"},
+	{U"\U0001F117", U"\U0001F117", U"\U0001F117", U"(H)", U"(H)"},
+	{U"\U0001F118", U"\U0001F118", U"\U0001F118", U"(I)", U"(I)"},
+	{U"\U0001F119", U"\U0001F119", U"\U0001F119", U"(J)", U"(J)"},
+	{U"\U0001F11A", U"\U0001F11A", U"\U0001F11A", U"(K)", U"(K)"},
+	{U"\U0001F11B", U"\U0001F11B", U"\U0001F11B", U"(L)", U"(L)"},
+	{U"\U0001F11C", U"\U0001F11C", U"\U0001F11C", U"(M)", U"(M)"},
+	{U"\U0001F11D", U"\U0001F11D", U"\U0001F11D", U"(N)", U"(N)"},
+	{U"\U0001F11E", U"\U0001F11E", U"\U0001F11E", U"(O)", U"(O)"},
+	{U"\U0001F11F", U"\U0001F11F", U"\U0001F11F", U"(P)", U"(P)"},
+	{U"\U0001F120", U"\U0001F120", U"\U0001F120", U"(Q)", U"(Q)"},
+	{U"\U0001F121", U"\U0001F121", U"\U0001F121", U"(R)", U"(R)"},
+	{U"\U0001F122", U"\U0001F122", U"\U0001F122", U"(S)", U"(S)"},
+	{U"\U0001F123", U"\U0001F123", U"\U0001F123", U"(T)", U"(T)"},
+	{U"\U0001F124", U"\U0001F124", U"\U0001F124", U"(U)", U"(U)"},
+	{U"\U0001F125", U"\U0001F125", U"\U0001F125", U"(V)", U"(V)"},
+	{U"\U0001F126", U"\U0001F126", U"\U0001F126", U"(W)", U"(W)"},
+	{U"\U0001F127", U"\U0001F127", U"\U0001F127", U"(X)", U"(X)"},
+	{U"\U0001F128", U"\U0001F128", U"\U0001F128", U"(Y)", U"(Y)"},
+	{U"\U0001F129", U"\U0001F129", U"\U0001F129", U"(Z)", U"(Z)"},
+	{U"\U0001F12A", U"\U0001F12A", U"\U0001F12A", U"\u3014S\u3015", U"\u3014S\u3015"},
+	{U"\U0001F12B", U"\U0001F12B", U"\U0001F12B", U"C", U"C"},
+	{U"\U0001F12C", U"\U0001F12C", U"\U0001F12C", U"R", U"R"},
+	{U"\U0001F12D", U"\U0001F12D", U"\U0001F12D", U"CD", U"CD"},
+	{U"\U0001F12E", U"\U0001F12E", U"\U0001F12E", U"WZ", U"WZ"},
+	{U"\U0001F130", U"\U0001F130", U"\U0001F130", U"A", U"A"},
+	{U"\U0001F131", U"\U0001F131", U"\U0001F131", U"B", U"B"},
+	{U"\U0001F132", U"\U0001F132", U"\U0001F132", U"C", U"C"},
+	{U"\U0001F133", U"\U0001F133", U"\U0001F133", U"D", U"D"},
+	{U"\U0001F134", U"\U0001F134", U"\U0001F134", U"E", U"E"},
+	{U"\U0001F135", U"\U0001F135", U"\U0001F135", U"F", U"F"},
+	{U"\U0001F136", U"\U0001F136", U"\U0001F136", U"G", U"G"},
+	{U"\U0001F137", U"\U0001F137", U"\U0001F137", U"H", U"H"},
+	{U"\U0001F138", U"\U0001F138", U"\U0001F138", U"I", U"I"},
+	{U"\U0001F139", U"\U0001F139", U"\U0001F139", U"J", U"J"},
+	{U"\U0001F13A", U"\U0001F13A", U"\U0001F13A", U"K", U"K"},
+	{U"\U0001F13B", U"\U0001F13B", U"\U0001F13B", U"L", U"L"},
+	{U"\U0001F13C", U"\U0001F13C", U"\U0001F13C", U"M", U"M"},
+	{U"\U0001F13D", U"\U0001F13D", U"\U0001F13D", U"N", U"N"},
+	{U"\U0001F13E", U"\U0001F13E", U"\U0001F13E", U"O", U"O"},
+	{U"\U0001F13F", U"\U0001F13F", U"\U0001F13F", U"P", U"P"},
+	{U"\U0001F140", U"\U0001F140", U"\U0001F140", U"Q", U"Q"},
+	{U"\U0001F141", U"\U0001F141", U"\U0001F141", U"R", U"R"},
+	{U"\U0001F142", U"\U0001F142", U"\U0001F142", U"S", U"S"},
+	{U"\U0001F143", U"\U0001F143", U"\U0001F143", U"T", U"T"},
+	{U"\U0001F144", U"\U0001F144", U"\U0001F144", U"U", U"U"},
+	{U"\U0001F145", U"\U0001F145", U"\U0001F145", U"V", U"V"},
+	{U"\U0001F146", U"\U0001F146", U"\U0001F146", U"W", U"W"},
+	{U"\U0001F147", U"\U0001F147", U"\U0001F147", U"X", U"X"},
+	{U"\U0001F148", U"\U0001F148", U"\U0001F148", U"Y", U"Y"},
+	{U"\U0001F149", U"\U0001F149", U"\U0001F149", U"Z", U"Z"},
+	{U"\U0001F14A", U"\U0001F14A", U"\U0001F14A", U"HV", U"HV"},
+	{U"\U0001F14B", U"\U0001F14B", U"\U0001F14B", U"MV", U"MV"},
+	{U"\U0001F14C", U"\U0001F14C", U"\U0001F14C", U"SD", U"SD"},
+	{U"\U0001F14D", U"\U0001F14D", U"\U0001F14D", U"SS", U"SS"},
+	{U"\U0001F14E", U"\U0001F14E", U"\U0001F14E", U"PPV", U"PPV"},
+	{U"\U0001F14F", U"\U0001F14F", U"\U0001F14F", U"WC", U"WC"},
+	{U"\U0001F16A", U"\U0001F16A", U"\U0001F16A", U"MC", U"MC"},
+	{U"\U0001F16B", U"\U0001F16B", U"\U0001F16B", U"MD", U"MD"},
+	{U"\U0001F16C", U"\U0001F16C", U"\U0001F16C", U"MR", U"MR"},
+	{U"\U0001F190", U"\U0001F190", U"\U0001F190", U"DJ", U"DJ"},
+	{U"\U0001F200", U"\U0001F200", U"\U0001F200", U"\u307B\u304B", U"\u307B\u304B"},
+	{U"\U0001F201", U"\U0001F201", U"\U0001F201", U"\u30B3\u30B3", U"\u30B3\u30B3"},
+	{U"\U0001F202", U"\U0001F202", U"\U0001F202", U"\u30B5", U"\u30B5"},
+	{U"\U0001F210", U"\U0001F210", U"\U0001F210", U"\u624B", U"\u624B"},
+	{U"\U0001F211", U"\U0001F211", U"\U0001F211", U"\u5B57", U"\u5B57"},
+	{U"\U0001F212", U"\U0001F212", U"\U0001F212", U"\u53CC", U"\u53CC"},
+	{U"\U0001F213", U"\U0001F213", U"\U0001F213", U"\u30C7", U"\u30C6\u3099"},
+	{U"\U0001F214", U"\U0001F214", U"\U0001F214", U"\u4E8C", U"\u4E8C"},
+	{U"\U0001F215", U"\U0001F215", U"\U0001F215", U"\u591A", U"\u591A"},
+	{U"\U0001F216", U"\U0001F216", U"\U0001F216", U"\u89E3", U"\u89E3"},
+	{U"\U0001F217", U"\U0001F217", U"\U0001F217", U"\u5929", U"\u5929"},
+	{U"\U0001F218", U"\U0001F218", U"\U0001F218", U"\u4EA4", U"\u4EA4"},
+	{U"\U0001F219", U"\U0001F219", U"\U0001F219", U"\u6620", U"\u6620"},
+	{U"\U0001F21A", U"\U0001F21A", U"\U0001F21A", U"\u7121", U"\u7121"},
+	{U"\U0001F21B", U"\U0001F21B", U"\U0001F21B", U"\u6599", U"\u6599"},
+	{U"\U0001F21C", U"\U0001F21C", U"\U0001F21C", U"\u524D", U"\u524D"},
+	{U"\U0001F21D", U"\U0001F21D", U"\U0001F21D", U"\u5F8C", U"\u5F8C"},
+	{U"\U0001F21E", U"\U0001F21E", U"\U0001F21E", U"\u518D", U"\u518D"},
+	{U"\U0001F21F", U"\U0001F21F", U"\U0001F21F", U"\u65B0", U"\u65B0"},
+	{U"\U0001F220", U"\U0001F220", U"\U0001F220", U"\u521D", U"\u521D"},
+	{U"\U0001F221", U"\U0001F221", U"\U0001F221", U"\u7D42", U"\u7D42"},
+	{U"\U0001F222", U"\U0001F222", U"\U0001F222", U"\u751F", U"\u751F"},
+	{U"\U0001F223", U"\U0001F223", U"\U0001F223", U"\u8CA9", U"\u8CA9"},
+	{U"\U0001F224", U"\U0001F224", U"\U0001F224", U"\u58F0", U"\u58F0"},
+	{U"\U0001F225", U"\U0001F225", U"\U0001F225", U"\u5439", U"\u5439"},
+	{U"\U0001F226", U"\U0001F226", U"\U0001F226", U"\u6F14", U"\u6F14"},
+	{U"\U0001F227", U"\U0001F227", U"\U0001F227", U"\u6295", U"\u6295"},
+	{U"\U0001F228", U"\U0001F228", U"\U0001F228", U"\u6355", U"\u6355"},
+	{U"\U0001F229", U"\U0001F229", U"\U0001F229", U"\u4E00", U"\u4E00"},
+	{U"\U0001F22A", U"\U0001F22A", U"\U0001F22A", U"\u4E09", U"\u4E09"},
+	{U"\U0001F22B", U"\U0001F22B", U"\U0001F22B", U"\u904A", U"\u904A"},
+	{U"\U0001F22C", U"\U0001F22C", U"\U0001F22C", U"\u5DE6", U"\u5DE6"},
+	{U"\U0001F22D", U"\U0001F22D", U"\U0001F22D", U"\u4E2D", U"\u4E2D"},
+	{U"\U0001F22E", U"\U0001F22E", U"\U0001F22E", U"\u53F3", U"\u53F3"},
+	{U"\U0001F22F", U"\U0001F22F", U"\U0001F22F", U"\u6307", U"\u6307"},
+	{U"\U0001F230", U"\U0001F230", U"\U0001F230", U"\u8D70", U"\u8D70"},
+	{U"\U0001F231", U"\U0001F231", U"\U0001F231", U"\u6253", U"\u6253"},
+	{U"\U0001F232", U"\U0001F232", U"\U0001F232", U"\u7981", U"\u7981"},
+	{U"\U0001F233", U"\U0001F233", U"\U0001F233", U"\u7A7A", U"\u7A7A"},
+	{U"\U0001F234", U"\U0001F234", U"\U0001F234", U"\u5408", U"\u5408"},
+	{U"\U0001F235", U"\U0001F235", U"\U0001F235", U"\u6E80", U"\u6E80"},
+	{U"\U0001F236", U"\U0001F236", U"\U0001F236", U"\u6709", U"\u6709"},
+	{U"\U0001F237", U"\U0001F237", U"\U0001F237", U"\u6708", U"\u6708"},
+	{U"\U0001F238", U"\U0001F238", U"\U0001F238", U"\u7533", U"\u7533"},
+	{U"\U0001F239", U"\U0001F239", U"\U0001F239", U"\u5272", U"\u5272"},
+	{U"\U0001F23A", U"\U0001F23A", U"\U0001F23A", U"\u55B6", U"\u55B6"},
+	{U"\U0001F23B", U"\U0001F23B", U"\U0001F23B", U"\u914D", U"\u914D"},
+	{U"\U0001F240", U"\U0001F240", U"\U0001F240", U"\u3014\u672C\u3015", U"\u3014\u672C\u3015"},
+	{U"\U0001F241", U"\U0001F241", U"\U0001F241", U"\u3014\u4E09\u3015", U"\u3014\u4E09\u3015"},
+	{U"\U0001F242", U"\U0001F242", U"\U0001F242", U"\u3014\u4E8C\u3015", U"\u3014\u4E8C\u3015"},
+	{U"\U0001F243", U"\U0001F243", U"\U0001F243", U"\u3014\u5B89\u3015", U"\u3014\u5B89\u3015"},
+	{U"\U0001F244", U"\U0001F244", U"\U0001F244", U"\u3014\u70B9\u3015", U"\u3014\u70B9\u3015"},
+	{U"\U0001F245", U"\U0001F245", U"\U0001F245", U"\u3014\u6253\u3015", U"\u3014\u6253\u3015"},
+	{U"\U0001F246", U"\U0001F246", U"\U0001F246", U"\u3014\u76D7\u3015", U"\u3014\u76D7\u3015"},
+	{U"\U0001F247", U"\U0001F247", U"\U0001F247", U"\u3014\u52DD\u3015", U"\u3014\u52DD\u3015"},
+	{U"\U0001F248", U"\U0001F248", U"\U0001F248", U"\u3014\u6557\u3015", U"\u3014\u6557\u3015"},
+	{U"\U0001F250", U"\U0001F250", U"\U0001F250", U"\u5F97", U"\u5F97"},
+	{U"\U0001F251", U"\U0001F251", U"\U0001F251", U"\u53EF", U"\u53EF"},
+	{U"\U0001FBF0", U"\U0001FBF0", U"\U0001FBF0", U"0", U"0"},
+	{U"\U0001FBF1", U"\U0001FBF1", U"\U0001FBF1", U"1", U"1"},
+	{U"\U0001FBF2", U"\U0001FBF2", U"\U0001FBF2", U"2", U"2"},
+	{U"\U0001FBF3", U"\U0001FBF3", U"\U0001FBF3", U"3", U"3"},
+	{U"\U0001FBF4", U"\U0001FBF4", U"\U0001FBF4", U"4", U"4"},
+	{U"\U0001FBF5", U"\U0001FBF5", U"\U0001FBF5", U"5", U"5"},
+	{U"\U0001FBF6", U"\U0001FBF6", U"\U0001FBF6", U"6", U"6"},
+	{U"\U0001FBF7", U"\U0001FBF7", U"\U0001FBF7", U"7", U"7"},
+	{U"\U0001FBF8", U"\U0001FBF8", U"\U0001FBF8", U"8", U"8"},
+	{U"\U0001FBF9", U"\U0001FBF9", U"\U0001FBF9", U"9", U"9"},
+	{U"\U0002F800", U"\u4E3D", U"\u4E3D", U"\u4E3D", U"\u4E3D"},
+	{U"\U0002F801", U"\u4E38", U"\u4E38", U"\u4E38", U"\u4E38"},
+	{U"\U0002F802", U"\u4E41", U"\u4E41", U"\u4E41", U"\u4E41"},
+	{U"\U0002F803", U"\U00020122", U"\U00020122", U"\U00020122", U"\U00020122"},
+	{U"\U0002F804", U"\u4F60", U"\u4F60", U"\u4F60", U"\u4F60"},
+	{U"\U0002F805", U"\u4FAE", U"\u4FAE", U"\u4FAE", U"\u4FAE"},
+	{U"\U0002F806", U"\u4FBB", U"\u4FBB", U"\u4FBB", U"\u4FBB"},
+	{U"\U0002F807", U"\u5002", U"\u5002", U"\u5002", U"\u5002"},
+	{U"\U0002F808", U"\u507A", U"\u507A", U"\u507A", U"\u507A"},
+	{U"\U0002F809", U"\u5099", U"\u5099", U"\u5099", U"\u5099"},
+	{U"\U0002F80A", U"\u50E7", U"\u50E7", U"\u50E7", U"\u50E7"},
+	{U"\U0002F80B", U"\u50CF", U"\u50CF", U"\u50CF", U"\u50CF"},
+	{U"\U0002F80C", U"\u349E", U"\u349E", U"\u349E", U"\u349E"},
+	{U"\U0002F80D", U"\U0002063A", U"\U0002063A", U"\U0002063A", U"\U0002063A"},
+	{U"\U0002F80E", U"\u514D", U"\u514D", U"\u514D", U"\u514D"},
+	{U"\U0002F80F", U"\u5154", U"\u5154", U"\u5154", U"\u5154"},
+	{U"\U0002F810", U"\u5164", U"\u5164", U"\u5164", U"\u5164"},
+	{U"\U0002F811", U"\u5177", U"\u5177", U"\u5177", U"\u5177"},
+	{U"\U0002F812", U"\U0002051C", U"\U0002051C", U"\U0002051C", U"\U0002051C"},
+	{U"\U0002F813", U"\u34B9", U"\u34B9", U"\u34B9", U"\u34B9"},
+	{U"\U0002F814", U"\u5167", U"\u5167", U"\u5167", U"\u5167"},
+	{U"\U0002F815", U"\u518D", U"\u518D", U"\u518D", U"\u518D"},
+	{U"\U0002F816", U"\U0002054B", U"\U0002054B", U"\U0002054B", U"\U0002054B"},
+	{U"\U0002F817", U"\u5197", U"\u5197", U"\u5197", U"\u5197"},
+	{U"\U0002F818", U"\u51A4", U"\u51A4", U"\u51A4", U"\u51A4"},
+	{U"\U0002F819", U"\u4ECC", U"\u4ECC", U"\u4ECC", U"\u4ECC"},
+	{U"\U0002F81A", U"\u51AC", U"\u51AC", U"\u51AC", U"\u51AC"},
+	{U"\U0002F81B", U"\u51B5", U"\u51B5", U"\u51B5", U"\u51B5"},
+	{U"\U0002F81C", U"\U000291DF", U"\U000291DF", U"\U000291DF", U"\U000291DF"},
+	{U"\U0002F81D", U"\u51F5", U"\u51F5", U"\u51F5", U"\u51F5"},
+	{U"\U0002F81E", U"\u5203", U"\u5203", U"\u5203", U"\u5203"},
+	{U"\U0002F81F", U"\u34DF", U"\u34DF", U"\u34DF", U"\u34DF"},
+	{U"\U0002F820", U"\u523B", U"\u523B", U"\u523B", U"\u523B"},
+	{U"\U0002F821", U"\u5246", U"\u5246", U"\u5246", U"\u5246"},
+	{U"\U0002F822", U"\u5272", U"\u5272", U"\u5272", U"\u5272"},
+	{U"\U0002F823", U"\u5277", U"\u5277", U"\u5277", U"\u5277"},
+	{U"\U0002F824", U"\u3515", U"\u3515", U"\u3515", U"\u3515"},
+	{U"\U0002F825", U"\u52C7", U"\u52C7", U"\u52C7", U"\u52C7"},
+	{U"\U0002F826", U"\u52C9", U"\u52C9", U"\u52C9", U"\u52C9"},
+	{U"\U0002F827", U"\u52E4", U"\u52E4", U"\u52E4", U"\u52E4"},
+	{U"\U0002F828", U"\u52FA", U"\u52FA", U"\u52FA", U"\u52FA"},
+	{U"\U0002F829", U"\u5305", U"\u5305", U"\u5305", U"\u5305"},
+	{U"\U0002F82A", U"\u5306", U"\u5306", U"\u5306", U"\u5306"},
+	{U"\U0002F82B", U"\u5317", U"\u5317", U"\u5317", U"\u5317"},
+	{U"\U0002F82C", U"\u5349", U"\u5349", U"\u5349", U"\u5349"},
+	{U"\U0002F82D", U"\u5351", U"\u5351", U"\u5351", U"\u5351"},
+	{U"\U0002F82E", U"\u535A", U"\u535A", U"\u535A", U"\u535A"},
+	{U"\U0002F82F", U"\u5373", U"\u5373", U"\u5373", U"\u5373"},
+	{U"\U0002F830", U"\u537D", U"\u537D", U"\u537D", U"\u537D"},
+	{U"\U0002F831", U"\u537F", U"\u537F", U"\u537F", U"\u537F"},
+	{U"\U0002F832", U"\u537F", U"\u537F", U"\u537F", U"\u537F"},
+	{U"\U0002F833", U"\u537F", U"\u537F", U"\u537F", U"\u537F"},
+	{U"\U0002F834", U"\U00020A2C", U"\U00020A2C", U"\U00020A2C", U"\U00020A2C"},
+	{U"\U0002F835", U"\u7070", U"\u7070", U"\u7070", U"\u7070"},
+	{U"\U0002F836", U"\u53CA", U"\u53CA", U"\u53CA", U"\u53CA"},
+	{U"\U0002F837", U"\u53DF", U"\u53DF", U"\u53DF", U"\u53DF"},
+	{U"\U0002F838", U"\U00020B63", U"\U00020B63", U"\U00020B63", U"\U00020B63"},
+	{U"\U0002F839", U"\u53EB", U"\u53EB", U"\u53EB", U"\u53EB"},
+	{U"\U0002F83A", U"\u53F1", U"\u53F1", U"\u53F1", U"\u53F1"},
+	{U"\U0002F83B", U"\u5406", U"\u5406", U"\u5406", U"\u5406"},
+	{U"\U0002F83C", U"\u549E", U"\u549E", U"\u549E", U"\u549E"},
+	{U"\U0002F83D", U"\u5438", U"\u5438", U"\u5438", U"\u5438"},
+	{U"\U0002F83E", U"\u5448", U"\u5448", U"\u5448", U"\u5448"},
+	{U"\U0002F83F", U"\u5468", U"\u5468", U"\u5468", U"\u5468"},
+	{U"\U0002F840", U"\u54A2", U"\u54A2", U"\u54A2", U"\u54A2"},
+	{U"\U0002F841", U"\u54F6", U"\u54F6", U"\u54F6", U"\u54F6"},
+	{U"\U0002F842", U"\u5510", U"\u5510", U"\u5510", U"\u5510"},
+	{U"\U0002F843", U"\u5553", U"\u5553", U"\u5553", U"\u5553"},
+	{U"\U0002F844", U"\u5563", U"\u5563", U"\u5563", U"\u5563"},
+	{U"\U0002F845", U"\u5584", U"\u5584", U"\u5584", U"\u5584"},
+	{U"\U0002F846", U"\u5584", U"\u5584", U"\u5584", U"\u5584"},
+	{U"\U0002F847", U"\u5599", U"\u5599", U"\u5599", U"\u5599"},
+	{U"\U0002F848", U"\u55AB", U"\u55AB", U"\u55AB", U"\u55AB"},
+	{U"\U0002F849", U"\u55B3", U"\u55B3", U"\u55B3", U"\u55B3"},
+	{U"\U0002F84A", U"\u55C2", U"\u55C2", U"\u55C2", U"\u55C2"},
+	{U"\U0002F84B", U"\u5716", U"\u5716", U"\u5716", U"\u5716"},
+	{U"\U0002F84C", U"\u5606", U"\u5606", U"\u5606", U"\u5606"},
+	{U"\U0002F84D", U"\u5717", U"\u5717", U"\u5717", U"\u5717"},
+	{U"\U0002F84E", U"\u5651", U"\u5651", U"\u5651", U"\u5651"},
+	{U"\U0002F84F", U"\u5674", U"\u5674", U"\u5674", U"\u5674"},
+	{U"\U0002F850", U"\u5207", U"\u5207", U"\u5207", U"\u5207"},
+	{U"\U0002F851", U"\u58EE", U"\u58EE", U"\u58EE", U"\u58EE"},
+	{U"\U0002F852", U"\u57CE", U"\u57CE", U"\u57CE", U"\u57CE"},
+	{U"\U0002F853", U"\u57F4", U"\u57F4", U"\u57F4", U"\u57F4"},
+	{U"\U0002F854", U"\u580D", U"\u580D", U"\u580D", U"\u580D"},
+	{U"\U0002F855", U"\u578B", U"\u578B", U"\u578B", U"\u578B"},
+	{U"\U0002F856", U"\u5832", U"\u5832", U"\u5832", U"\u5832"},
+	{U"\U0002F857", U"\u5831", U"\u5831", U"\u5831", U"\u5831"},
+	{U"\U0002F858", U"\u58AC", U"\u58AC", U"\u58AC", U"\u58AC"},
+	{U"\U0002F859", U"\U000214E4", U"\U000214E4", U"\U000214E4", U"\U000214E4"},
+	{U"\U0002F85A", U"\u58F2", U"\u58F2", U"\u58F2", U"\u58F2"},
+	{U"\U0002F85B", U"\u58F7", U"\u58F7", U"\u58F7", U"\u58F7"},
+	{U"\U0002F85C", U"\u5906", U"\u5906", U"\u5906", U"\u5906"},
+	{U"\U0002F85D", U"\u591A", U"\u591A", U"\u591A", U"\u591A"},
+	{U"\U0002F85E", U"\u5922", U"\u5922", U"\u5922", U"\u5922"},
+	{U"\U0002F85F", U"\u5962", U"\u5962", U"\u5962", U"\u5962"},
+	{U"\U0002F860", U"\U000216A8", U"\U000216A8", U"\U000216A8", U"\U000216A8"},
+	{U"\U0002F861", U"\U000216EA", U"\U000216EA", U"\U000216EA", U"\U000216EA"},
+	{U"\U0002F862", U"\u59EC", U"\u59EC", U"\u59EC", U"\u59EC"},
+	{U"\U0002F863", U"\u5A1B", U"\u5A1B", U"\u5A1B", U"\u5A1B"},
+	{U"\U0002F864", U"\u5A27", U"\u5A27", U"\u5A27", U"\u5A27"},
+	{U"\U0002F865", U"\u59D8", U"\u59D8", U"\u59D8", U"\u59D8"},
+	{U"\U0002F866", U"\u5A66", U"\u5A66", U"\u5A66", U"\u5A66"},
+	{U"\U0002F867", U"\u36EE", U"\u36EE", U"\u36EE", U"\u36EE"},
+	{U"\U0002F868", U"\u36FC", U"\u36FC", U"\u36FC", U"\u36FC"},
+	{U"\U0002F869", U"\u5B08", U"\u5B08", U"\u5B08", U"\u5B08"},
+	{U"\U0002F86A", U"\u5B3E", U"\u5B3E", U"\u5B3E", U"\u5B3E"},
+	{U"\U0002F86B", U"\u5B3E", U"\u5B3E", U"\u5B3E", U"\u5B3E"},
+	{U"\U0002F86C", U"\U000219C8", U"\U000219C8", U"\U000219C8", U"\U000219C8"},
+	{U"\U0002F86D", U"\u5BC3", U"\u5BC3", U"\u5BC3", U"\u5BC3"},
+	{U"\U0002F86E", U"\u5BD8", U"\u5BD8", U"\u5BD8", U"\u5BD8"},
+	{U"\U0002F86F", U"\u5BE7", U"\u5BE7", U"\u5BE7", U"\u5BE7"},
+	{U"\U0002F870", U"\u5BF3", U"\u5BF3", U"\u5BF3", U"\u5BF3"},
+	{U"\U0002F871", U"\U00021B18", U"\U00021B18", U"\U00021B18", U"\U00021B18"},
+	{U"\U0002F872", U"\u5BFF", U"\u5BFF", U"\u5BFF", U"\u5BFF"},
+	{U"\U0002F873", U"\u5C06", U"\u5C06", U"\u5C06", U"\u5C06"},
+	{U"\U0002F874", U"\u5F53", U"\u5F53", U"\u5F53", U"\u5F53"},
+	{U"\U0002F875", U"\u5C22", U"\u5C22", U"\u5C22", U"\u5C22"},
+	{U"\U0002F876", U"\u3781", U"\u3781", U"\u3781", U"\u3781"},
+	{U"\U0002F877", U"\u5C60", U"\u5C60", U"\u5C60", U"\u5C60"},
+	{U"\U0002F878", U"\u5C6E", U"\u5C6E", U"\u5C6E", U"\u5C6E"},
+	{U"\U0002F879", U"\u5CC0", U"\u5CC0", U"\u5CC0", U"\u5CC0"},
+	{U"\U0002F87A", U"\u5C8D", U"\u5C8D", U"\u5C8D", U"\u5C8D"},
+	{U"\U0002F87B", U"\U00021DE4", U"\U00021DE4", U"\U00021DE4", U"\U00021DE4"},
+	{U"\U0002F87C", U"\u5D43", U"\u5D43", U"\u5D43", U"\u5D43"},
+	{U"\U0002F87D", U"\U00021DE6", U"\U00021DE6", U"\U00021DE6", U"\U00021DE6"},
+	{U"\U0002F87E", U"\u5D6E", U"\u5D6E", U"\u5D6E", U"\u5D6E"},
+	{U"\U0002F87F", U"\u5D6B", U"\u5D6B", U"\u5D6B", U"\u5D6B"},
+	{U"\U0002F880", U"\u5D7C", U"\u5D7C", U"\u5D7C", U"\u5D7C"},
+	{U"\U0002F881", U"\u5DE1", U"\u5DE1", U"\u5DE1", U"\u5DE1"},
+	{U"\U0002F882", U"\u5DE2", U"\u5DE2", U"\u5DE2", U"\u5DE2"},
+	{U"\U0002F883", U"\u382F", U"\u382F", U"\u382F", U"\u382F"},
+	{U"\U0002F884", U"\u5DFD", U"\u5DFD", U"\u5DFD", U"\u5DFD"},
+	{U"\U0002F885", U"\u5E28", U"\u5E28", U"\u5E28", U"\u5E28"},
+	{U"\U0002F886", U"\u5E3D", U"\u5E3D", U"\u5E3D", U"\u5E3D"},
+	{U"\U0002F887", U"\u5E69", U"\u5E69", U"\u5E69", U"\u5E69"},
+	{U"\U0002F888", U"\u3862", U"\u3862", U"\u3862", U"\u3862"},
+	{U"\U0002F889", U"\U00022183", U"\U00022183", U"\U00022183", U"\U00022183"},
+	{U"\U0002F88A", U"\u387C", U"\u387C", U"\u387C", U"\u387C"},
+	{U"\U0002F88B", U"\u5EB0", U"\u5EB0", U"\u5EB0", U"\u5EB0"},
+	{U"\U0002F88C", U"\u5EB3", U"\u5EB3", U"\u5EB3", U"\u5EB3"},
+	{U"\U0002F88D", U"\u5EB6", U"\u5EB6", U"\u5EB6", U"\u5EB6"},
+	{U"\U0002F88E", U"\u5ECA", U"\u5ECA", U"\u5ECA", U"\u5ECA"},
+	{U"\U0002F88F", U"\U0002A392", U"\U0002A392", U"\U0002A392", U"\U0002A392"},
+	{U"\U0002F890", U"\u5EFE", U"\u5EFE", U"\u5EFE", U"\u5EFE"},
+	{U"\U0002F891", U"\U00022331", U"\U00022331", U"\U00022331", U"\U00022331"},
+	{U"\U0002F892", U"\U00022331", U"\U00022331", U"\U00022331", U"\U00022331"},
+	{U"\U0002F893", U"\u8201", U"\u8201", U"\u8201", U"\u8201"},
+	{U"\U0002F894", U"\u5F22", U"\u5F22", U"\u5F22", U"\u5F22"},
+	{U"\U0002F895", U"\u5F22", U"\u5F22", U"\u5F22", U"\u5F22"},
+	{U"\U0002F896", U"\u38C7", U"\u38C7", U"\u38C7", U"\u38C7"},
+	{U"\U0002F897", U"\U000232B8", U"\U000232B8", U"\U000232B8", U"\U000232B8"},
+	{U"\U0002F898", U"\U000261DA", U"\U000261DA", U"\U000261DA", U"\U000261DA"},
+	{U"\U0002F899", U"\u5F62", U"\u5F62", U"\u5F62", U"\u5F62"},
+	{U"\U0002F89A", U"\u5F6B", U"\u5F6B", U"\u5F6B", U"\u5F6B"},
+	{U"\U0002F89B", U"\u38E3", U"\u38E3", U"\u38E3", U"\u38E3"},
+	{U"\U0002F89C", U"\u5F9A", U"\u5F9A", U"\u5F9A", U"\u5F9A"},
+	{U"\U0002F89D", U"\u5FCD", U"\u5FCD", U"\u5FCD", U"\u5FCD"},
+	{U"\U0002F89E", U"\u5FD7", U"\u5FD7", U"\u5FD7", U"\u5FD7"},
+	{U"\U0002F89F", U"\u5FF9", U"\u5FF9", U"\u5FF9", U"\u5FF9"},
+	{U"\U0002F8A0", U"\u6081", U"\u6081", U"\u6081", U"\u6081"},
+	{U"\U0002F8A1", U"\u393A", U"\u393A", U"\u393A", U"\u393A"},
+	{U"\U0002F8A2", U"\u391C", U"\u391C", U"\u391C", U"\u391C"},
+	{U"\U0002F8A3", U"\u6094", U"\u6094", U"\u6094", U"\u6094"},
+	{U"\U0002F8A4", U"\U000226D4", U"\U000226D4", U"\U000226D4", U"\U000226D4"},
+	{U"\U0002F8A5", U"\u60C7", U"\u60C7", U"\u60C7", U"\u60C7"},
+	{U"\U0002F8A6", U"\u6148", U"\u6148", U"\u6148", U"\u6148"},
+	{U"\U0002F8A7", U"\u614C", U"\u614C", U"\u614C", U"\u614C"},
+	{U"\U0002F8A8", U"\u614E", U"\u614E", U"\u614E", U"\u614E"},
+	{U"\U0002F8A9", U"\u614C", U"\u614C", U"\u614C", U"\u614C"},
+	{U"\U0002F8AA", U"\u617A", U"\u617A", U"\u617A", U"\u617A"},
+	{U"\U0002F8AB", U"\u618E", U"\u618E", U"\u618E", U"\u618E"},
+	{U"\U0002F8AC", U"\u61B2", U"\u61B2", U"\u61B2", U"\u61B2"},
+	{U"\U0002F8AD", U"\u61A4", U"\u61A4", U"\u61A4", U"\u61A4"},
+	{U"\U0002F8AE", U"\u61AF", U"\u61AF", U"\u61AF", U"\u61AF"},
+	{U"\U0002F8AF", U"\u61DE", U"\u61DE", U"\u61DE", U"\u61DE"},
+	{U"\U0002F8B0", U"\u61F2", U"\u61F2", U"\u61F2", U"\u61F2"},
+	{U"\U0002F8B1", U"\u61F6", U"\u61F6", U"\u61F6", U"\u61F6"},
+	{U"\U0002F8B2", U"\u6210", U"\u6210", U"\u6210", U"\u6210"},
+	{U"\U0002F8B3", U"\u621B", U"\u621B", U"\u621B", U"\u621B"},
+	{U"\U0002F8B4", U"\u625D", U"\u625D", U"\u625D", U"\u625D"},
+	{U"\U0002F8B5", U"\u62B1", U"\u62B1", U"\u62B1", U"\u62B1"},
+	{U"\U0002F8B6", U"\u62D4", U"\u62D4", U"\u62D4", U"\u62D4"},
+	{U"\U0002F8B7", U"\u6350", U"\u6350", U"\u6350", U"\u6350"},
+	{U"\U0002F8B8", U"\U00022B0C", U"\U00022B0C", U"\U00022B0C", U"\U00022B0C"},
+	{U"\U0002F8B9", U"\u633D", U"\u633D", U"\u633D", U"\u633D"},
+	{U"\U0002F8BA", U"\u62FC", U"\u62FC", U"\u62FC", U"\u62FC"},
+	{U"\U0002F8BB", U"\u6368", U"\u6368", U"\u6368", U"\u6368"},
+	{U"\U0002F8BC", U"\u6383", U"\u6383", U"\u6383", U"\u6383"},
+	{U"\U0002F8BD", U"\u63E4", U"\u63E4", U"\u63E4", U"\u63E4"},
+	{U"\U0002F8BE", U"\U00022BF1", U"\U00022BF1", U"\U00022BF1", U"\U00022BF1"},
+	{U"\U0002F8BF", U"\u6422", U"\u6422", U"\u6422", U"\u6422"},
+	{U"\U0002F8C0", U"\u63C5", U"\u63C5", U"\u63C5", U"\u63C5"},
+	{U"\U0002F8C1", U"\u63A9", U"\u63A9", U"\u63A9", U"\u63A9"},
+	{U"\U0002F8C2", U"\u3A2E", U"\u3A2E", U"\u3A2E", U"\u3A2E"},
+	{U"\U0002F8C3", U"\u6469", U"\u6469", U"\u6469", U"\u6469"},
+	{U"\U0002F8C4", U"\u647E", U"\u647E", U"\u647E", U"\u647E"},
+	{U"\U0002F8C5", U"\u649D", U"\u649D", U"\u649D", U"\u649D"},
+	{U"\U0002F8C6", U"\u6477", U"\u6477", U"\u6477", U"\u6477"},
+	{U"\U0002F8C7", U"\u3A6C", U"\u3A6C", U"\u3A6C", U"\u3A6C"},
+	{U"\U0002F8C8", U"\u654F", U"\u654F", U"\u654F", U"\u654F"},
+	{U"\U0002F8C9", U"\u656C", U"\u656C", U"\u656C", U"\u656C"},
+	{U"\U0002F8CA", U"\U0002300A", U"\U0002300A", U"\U0002300A", U"\U0002300A"},
+	{U"\U0002F8CB", U"\u65E3", U"\u65E3", U"\u65E3", U"\u65E3"},
+	{U"\U0002F8CC", U"\u66F8", U"\u66F8", U"\u66F8", U"\u66F8"},
+	{U"\U0002F8CD", U"\u6649", U"\u6649", U"\u6649", U"\u6649"},
+	{U"\U0002F8CE", U"\u3B19", U"\u3B19", U"\u3B19", U"\u3B19"},
+	{U"\U0002F8CF", U"\u6691", U"\u6691", U"\u6691", U"\u6691"},
+	{U"\U0002F8D0", U"\u3B08", U"\u3B08", U"\u3B08", U"\u3B08"},
+	{U"\U0002F8D1", U"\u3AE4", U"\u3AE4", U"\u3AE4", U"\u3AE4"},
+	{U"\U0002F8D2", U"\u5192", U"\u5192", U"\u5192", U"\u5192"},
+	{U"\U0002F8D3", U"\u5195", U"\u5195", U"\u5195", U"\u5195"},
+	{U"\U0002F8D4", U"\u6700", U"\u6700", U"\u6700", U"\u6700"},
+	{U"\U0002F8D5", U"\u669C", U"\u669C", U"\u669C", U"\u669C"},
+	{U"\U0002F8D6", U"\u80AD", U"\u80AD", U"\u80AD", U"\u80AD"},
+	{U"\U0002F8D7", U"\u43D9", U"\u43D9", U"\u43D9", U"\u43D9"},
+	{U"\U0002F8D8", U"\u6717", U"\u6717", U"\u6717", U"\u6717"},
+	{U"\U0002F8D9", U"\u671B", U"\u671B", U"\u671B", U"\u671B"},
+	{U"\U0002F8DA", U"\u6721", U"\u6721", U"\u6721", U"\u6721"},
+	{U"\U0002F8DB", U"\u675E", U"\u675E", U"\u675E", U"\u675E"},
+	{U"\U0002F8DC", U"\u6753", U"\u6753", U"\u6753", U"\u6753"},
+	{U"\U0002F8DD", U"\U000233C3", U"\U000233C3", U"\U000233C3", U"\U000233C3"},
+	{U"\U0002F8DE", U"\u3B49", U"\u3B49", U"\u3B49", U"\u3B49"},
+	{U"\U0002F8DF", U"\u67FA", U"\u67FA", U"\u67FA", U"\u67FA"},
+	{U"\U0002F8E0", U"\u6785", U"\u6785", U"\u6785", U"\u6785"},
+	{U"\U0002F8E1", U"\u6852", U"\u6852", U"\u6852", U"\u6852"},
+	{U"\U0002F8E2", U"\u6885", U"\u6885", U"\u6885", U"\u6885"},
+	{U"\U0002F8E3", U"\U0002346D", U"\U0002346D", U"\U0002346D", U"\U0002346D"},
+	{U"\U0002F8E4", U"\u688E", U"\u688E", U"\u688E", U"\u688E"},
+	{U"\U0002F8E5", U"\u681F", U"\u681F", U"\u681F", U"\u681F"},
+	{U"\U0002F8E6", U"\u6914", U"\u6914", U"\u6914", U"\u6914"},
+	{U"\U0002F8E7", U"\u3B9D", U"\u3B9D", U"\u3B9D", U"\u3B9D"},
+	{U"\U0002F8E8", U"\u6942", U"\u6942", U"\u6942", U"\u6942"},
+	{U"\U0002F8E9", U"\u69A3", U"\u69A3", U"\u69A3", U"\u69A3"},
+	{U"\U0002F8EA", U"\u69EA", U"\u69EA", U"\u69EA", U"\u69EA"},
+	{U"\U0002F8EB", U"\u6AA8", U"\u6AA8", U"\u6AA8", U"\u6AA8"},
+	{U"\U0002F8EC", U"\U000236A3", U"\U000236A3", U"\U000236A3", U"\U000236A3"},
+	{U"\U0002F8ED", U"\u6ADB", U"\u6ADB", U"\u6ADB", U"\u6ADB"},
+	{U"\U0002F8EE", U"\u3C18", U"\u3C18", U"\u3C18", U"\u3C18"},
+	{U"\U0002F8EF", U"\u6B21", U"\u6B21", U"\u6B21", U"\u6B21"},
+	{U"\U0002F8F0", U"\U000238A7", U"\U000238A7", U"\U000238A7", U"\U000238A7"},
+	{U"\U0002F8F1", U"\u6B54", U"\u6B54", U"\u6B54", U"\u6B54"},
+	{U"\U0002F8F2", U"\u3C4E", U"\u3C4E", U"\u3C4E", U"\u3C4E"},
+	{U"\U0002F8F3", U"\u6B72", U"\u6B72", U"\u6B72", U"\u6B72"},
+	{U"\U0002F8F4", U"\u6B9F", U"\u6B9F", U"\u6B9F", U"\u6B9F"},
+	{U"\U0002F8F5", U"\u6BBA", U"\u6BBA", U"\u6BBA", U"\u6BBA"},
+	{U"\U0002F8F6", U"\u6BBB", U"\u6BBB", U"\u6BBB", U"\u6BBB"},
+	{U"\U0002F8F7", U"\U00023A8D", U"\U00023A8D", U"\U00023A8D", U"\U00023A8D"},
+	{U"\U0002F8F8", U"\U00021D0B", U"\U00021D0B", U"\U00021D0B", U"\U00021D0B"},
+	{U"\U0002F8F9", U"\U00023AFA", U"\U00023AFA", U"\U00023AFA", U"\U00023AFA"},
+	{U"\U0002F8FA", U"\u6C4E", U"\u6C4E", U"\u6C4E", U"\u6C4E"},
+	{U"\U0002F8FB", U"\U00023CBC", U"\U00023CBC", U"\U00023CBC", U"\U00023CBC"},
+	{U"\U0002F8FC", U"\u6CBF", U"\u6CBF", U"\u6CBF", U"\u6CBF"},
+	{U"\U0002F8FD", U"\u6CCD", U"\u6CCD", U"\u6CCD", U"\u6CCD"},
+	{U"\U0002F8FE", U"\u6C67", U"\u6C67", U"\u6C67", U"\u6C67"},
+	{U"\U0002F8FF", U"\u6D16", U"\u6D16", U"\u6D16", U"\u6D16"},
+	{U"\U0002F900", U"\u6D3E", U"\u6D3E", U"\u6D3E", U"\u6D3E"},
+	{U"\U0002F901", U"\u6D77", U"\u6D77", U"\u6D77", U"\u6D77"},
+	{U"\U0002F902", U"\u6D41", U"\u6D41", U"\u6D41", U"\u6D41"},
+	{U"\U0002F903", U"\u6D69", U"\u6D69", U"\u6D69", U"\u6D69"},
+	{U"\U0002F904", U"\u6D78", U"\u6D78", U"\u6D78", U"\u6D78"},
+	{U"\U0002F905", U"\u6D85", U"\u6D85", U"\u6D85", U"\u6D85"},
+	{U"\U0002F906", U"\U00023D1E", U"\U00023D1E", U"\U00023D1E", U"\U00023D1E"},
+	{U"\U0002F907", U"\u6D34", U"\u6D34", U"\u6D34", U"\u6D34"},
+	{U"\U0002F908", U"\u6E2F", U"\u6E2F", U"\u6E2F", U"\u6E2F"},
+	{U"\U0002F909", U"\u6E6E", U"\u6E6E", U"\u6E6E", U"\u6E6E"},
+	{U"\U0002F90A", U"\u3D33", U"\u3D33", U"\u3D33", U"\u3D33"},
+	{U"\U0002F90B", U"\u6ECB", U"\u6ECB", U"\u6ECB", U"\u6ECB"},
+	{U"\U0002F90C", U"\u6EC7", U"\u6EC7", U"\u6EC7", U"\u6EC7"},
+	{U"\U0002F90D", U"\U00023ED1", U"\U00023ED1", U"\U00023ED1", U"\U00023ED1"},
+	{U"\U0002F90E", U"\u6DF9", U"\u6DF9", U"\u6DF9", U"\u6DF9"},
+	{U"\U0002F90F", U"\u6F6E", U"\u6F6E", U"\u6F6E", U"\u6F6E"},
+	{U"\U0002F910", U"\U00023F5E", U"\U00023F5E", U"\U00023F5E", U"\U00023F5E"},
+	{U"\U0002F911", U"\U00023F8E", U"\U00023F8E", U"\U00023F8E", U"\U00023F8E"},
+	{U"\U0002F912", U"\u6FC6", U"\u6FC6", U"\u6FC6", U"\u6FC6"},
+	{U"\U0002F913", U"\u7039", U"\u7039", U"\u7039", U"\u7039"},
+	{U"\U0002F914", U"\u701E", U"\u701E", U"\u701E", U"\u701E"},
+	{U"\U0002F915", U"\u701B", U"\u701B", U"\u701B", U"\u701B"},
+	{U"\U0002F916", U"\u3D96", U"\u3D96", U"\u3D96", U"\u3D96"},
+	{U"\U0002F917", U"\u704A", U"\u704A", U"\u704A", U"\u704A"},
+	{U"\U0002F918", U"\u707D", U"\u707D", U"\u707D", U"\u707D"},
+	{U"\U0002F919", U"\u7077", U"\u7077", U"\u7077", U"\u7077"},
+	{U"\U0002F91A", U"\u70AD", U"\u70AD", U"\u70AD", U"\u70AD"},
+	{U"\U0002F91B", U"\U00020525", U"\U00020525", U"\U00020525", U"\U00020525"},
+	{U"\U0002F91C", U"\u7145", U"\u7145", U"\u7145", U"\u7145"},
+	{U"\U0002F91D", U"\U00024263", U"\U00024263", U"\U00024263", U"\U00024263"},
+	{U"\U0002F91E", U"\u719C", U"\u719C", U"\u719C", U"\u719C"},
+	{U"\U0002F91F", U"\U000243AB", U"\U000243AB", U"\U000243AB", U"\U000243AB"},
+	{U"\U0002F920", U"\u7228", U"\u7228", U"\u7228", U"\u7228"},
+	{U"\U0002F921", U"\u7235", U"\u7235", U"\u7235", U"\u7235"},
+	{U"\U0002F922", U"\u7250", U"\u7250", U"\u7250", U"\u7250"},
+	{U"\U0002F923", U"\U00024608", U"\U00024608", U"\U00024608", U"\U00024608"},
+	{U"\U0002F924", U"\u7280", U"\u7280", U"\u7280", U"\u7280"},
+	{U"\U0002F925", U"\u7295", U"\u7295", U"\u7295", U"\u7295"},
+	{U"\U0002F926", U"\U00024735", U"\U00024735", U"\U00024735", U"\U00024735"},
+	{U"\U0002F927", U"\U00024814", U"\U00024814", U"\U00024814", U"\U00024814"},
+	{U"\U0002F928", U"\u737A", U"\u737A", U"\u737A", U"\u737A"},
+	{U"\U0002F929", U"\u738B", U"\u738B", U"\u738B", U"\u738B"},
+	{U"\U0002F92A", U"\u3EAC", U"\u3EAC", U"\u3EAC", U"\u3EAC"},
+	{U"\U0002F92B", U"\u73A5", U"\u73A5", U"\u73A5", U"\u73A5"},
+	{U"\U0002F92C", U"\u3EB8", U"\u3EB8", U"\u3EB8", U"\u3EB8"},
+	{U"\U0002F92D", U"\u3EB8", U"\u3EB8", U"\u3EB8", U"\u3EB8"},
+	{U"\U0002F92E", U"\u7447", U"\u7447", U"\u7447", U"\u7447"},
+	{U"\U0002F92F", U"\u745C", U"\u745C", U"\u745C", U"\u745C"},
+	{U"\U0002F930", U"\u7471", U"\u7471", U"\u7471", U"\u7471"},
+	{U"\U0002F931", U"\u7485", U"\u7485", U"\u7485", U"\u7485"},
+	{U"\U0002F932", U"\u74CA", U"\u74CA", U"\u74CA", U"\u74CA"},
+	{U"\U0002F933", U"\u3F1B", U"\u3F1B", U"\u3F1B", U"\u3F1B"},
+	{U"\U0002F934", U"\u7524", U"\u7524", U"\u7524", U"\u7524"},
+	{U"\U0002F935", U"\U00024C36", U"\U00024C36", U"\U00024C36", U"\U00024C36"},
+	{U"\U0002F936", U"\u753E", U"\u753E", U"\u753E", U"\u753E"},
+	{U"\U0002F937", U"\U00024C92", U"\U00024C92", U"\U00024C92", U"\U00024C92"},
+	{U"\U0002F938", U"\u7570", U"\u7570", U"\u7570", U"\u7570"},
+	{U"\U0002F939", U"\U0002219F", U"\U0002219F", U"\U0002219F", U"\U0002219F"},
+	{U"\U0002F93A", U"\u7610", U"\u7610", U"\u7610", U"\u7610"},
+	{U"\U0002F93B", U"\U00024FA1", U"\U00024FA1", U"\U00024FA1", U"\U00024FA1"},
+	{U"\U0002F93C", U"\U00024FB8", U"\U00024FB8", U"\U00024FB8", U"\U00024FB8"},
+	{U"\U0002F93D", U"\U00025044", U"\U00025044", U"\U00025044", U"\U00025044"},
+	{U"\U0002F93E", U"\u3FFC", U"\u3FFC", U"\u3FFC", U"\u3FFC"},
+	{U"\U0002F93F", U"\u4008", U"\u4008", U"\u4008", U"\u4008"},
+	{U"\U0002F940", U"\u76F4", U"\u76F4", U"\u76F4", U"\u76F4"},
+	{U"\U0002F941", U"\U000250F3", U"\U000250F3", U"\U000250F3", U"\U000250F3"},
+	{U"\U0002F942", U"\U000250F2", U"\U000250F2", U"\U000250F2", U"\U000250F2"},
+	{U"\U0002F943", U"\U00025119", U"\U00025119", U"\U00025119", U"\U00025119"},
+	{U"\U0002F944", U"\U00025133", U"\U00025133", U"\U00025133", U"\U00025133"},
+	{U"\U0002F945", U"\u771E", U"\u771E", U"\u771E", U"\u771E"},
+	{U"\U0002F946", U"\u771F", U"\u771F", U"\u771F", U"\u771F"},
+	{U"\U0002F947", U"\u771F", U"\u771F", U"\u771F", U"\u771F"},
+	{U"\U0002F948", U"\u774A", U"\u774A", U"\u774A", U"\u774A"},
+	{U"\U0002F949", U"\u4039", U"\u4039", U"\u4039", U"\u4039"},
+	{U"\U0002F94A", U"\u778B", U"\u778B", U"\u778B", U"\u778B"},
+	{U"\U0002F94B", U"\u4046", U"\u4046", U"\u4046", U"\u4046"},
+	{U"\U0002F94C", U"\u4096", U"\u4096", U"\u4096", U"\u4096"},
+	{U"\U0002F94D", U"\U0002541D", U"\U0002541D", U"\U0002541D", U"\U0002541D"},
+	{U"\U0002F94E", U"\u784E", U"\u784E", U"\u784E", U"\u784E"},
+	{U"\U0002F94F", U"\u788C", U"\u788C", U"\u788C", U"\u788C"},
+	{U"\U0002F950", U"\u78CC", U"\u78CC", U"\u78CC", U"\u78CC"},
+	{U"\U0002F951", U"\u40E3", U"\u40E3", U"\u40E3", U"\u40E3"},
+	{U"\U0002F952", U"\U00025626", U"\U00025626", U"\U00025626", U"\U00025626"},
+	{U"\U0002F953", U"\u7956", U"\u7956", U"\u7956", U"\u7956"},
+	{U"\U0002F954", U"\U0002569A", U"\U0002569A", U"\U0002569A", U"\U0002569A"},
+	{U"\U0002F955", U"\U000256C5", U"\U000256C5", U"\U000256C5", U"\U000256C5"},
+	{U"\U0002F956", U"\u798F", U"\u798F", U"\u798F", U"\u798F"},
+	{U"\U0002F957", U"\u79EB", U"\u79EB", U"\u79EB", U"\u79EB"},
+	{U"\U0002F958", U"\u412F", U"\u412F", U"\u412F", U"\u412F"},
+	{U"\U0002F959", U"\u7A40", U"\u7A40", U"\u7A40", U"\u7A40"},
+	{U"\U0002F95A", U"\u7A4A", U"\u7A4A", U"\u7A4A", U"\u7A4A"},
+	{U"\U0002F95B", U"\u7A4F", U"\u7A4F", U"\u7A4F", U"\u7A4F"},
+	{U"\U0002F95C", U"\U0002597C", U"\U0002597C", U"\U0002597C", U"\U0002597C"},
+	{U"\U0002F95D", U"\U00025AA7", U"\U00025AA7", U"\U00025AA7", U"\U00025AA7"},
+	{U"\U0002F95E", U"\U00025AA7", U"\U00025AA7", U"\U00025AA7", U"\U00025AA7"},
+	{U"\U0002F95F", U"\u7AEE", U"\u7AEE", U"\u7AEE", U"\u7AEE"},
+	{U"\U0002F960", U"\u4202", U"\u4202", U"\u4202", U"\u4202"},
+	{U"\U0002F961", U"\U00025BAB", U"\U00025BAB", U"\U00025BAB", U"\U00025BAB"},
+	{U"\U0002F962", U"\u7BC6", U"\u7BC6", U"\u7BC6", U"\u7BC6"},
+	{U"\U0002F963", U"\u7BC9", U"\u7BC9", U"\u7BC9", U"\u7BC9"},
+	{U"\U0002F964", U"\u4227", U"\u4227", U"\u4227", U"\u4227"},
+	{U"\U0002F965", U"\U00025C80", U"\U00025C80", U"\U00025C80", U"\U00025C80"},
+	{U"\U0002F966", U"\u7CD2", U"\u7CD2", U"\u7CD2", U"\u7CD2"},
+	{U"\U0002F967", U"\u42A0", U"\u42A0", U"\u42A0", U"\u42A0"},
+	{U"\U0002F968", U"\u7CE8", U"\u7CE8", U"\u7CE8", U"\u7CE8"},
+	{U"\U0002F969", U"\u7CE3", U"\u7CE3", U"\u7CE3", U"\u7CE3"},
+	{U"\U0002F96A", U"\u7D00", U"\u7D00", U"\u7D00", U"\u7D00"},
+	{U"\U0002F96B", U"\U00025F86", U"\U00025F86", U"\U00025F86", U"\U00025F86"},
+	{U"\U0002F96C", U"\u7D63", U"\u7D63", U"\u7D63", U"\u7D63"},
+	{U"\U0002F96D", U"\u4301", U"\u4301", U"\u4301", U"\u4301"},
+	{U"\U0002F96E", U"\u7DC7", U"\u7DC7", U"\u7DC7", U"\u7DC7"},
+	{U"\U0002F96F", U"\u7E02", U"\u7E02", U"\u7E02", U"\u7E02"},
+	{U"\U0002F970", U"\u7E45", U"\u7E45", U"\u7E45", U"\u7E45"},
+	{U"\U0002F971", U"\u4334", U"\u4334", U"\u4334", U"\u4334"},
+	{U"\U0002F972", U"\U00026228", U"\U00026228", U"\U00026228", U"\U00026228"},
+	{U"\U0002F973", U"\U00026247", U"\U00026247", U"\U00026247", U"\U00026247"},
+	{U"\U0002F974", U"\u4359", U"\u4359", U"\u4359", U"\u4359"},
+	{U"\U0002F975", U"\U000262D9", U"\U000262D9", U"\U000262D9", U"\U000262D9"},
+	{U"\U0002F976", U"\u7F7A", U"\u7F7A", U"\u7F7A", U"\u7F7A"},
+	{U"\U0002F977", U"\U0002633E", U"\U0002633E", U"\U0002633E", U"\U0002633E"},
+	{U"\U0002F978", U"\u7F95", U"\u7F95", U"\u7F95", U"\u7F95"},
+	{U"\U0002F979", U"\u7FFA", U"\u7FFA", U"\u7FFA", U"\u7FFA"},
+	{U"\U0002F97A", U"\u8005", U"\u8005", U"\u8005", U"\u8005"},
+	{U"\U0002F97B", U"\U000264DA", U"\U000264DA", U"\U000264DA", U"\U000264DA"},
+	{U"\U0002F97C", U"\U00026523", U"\U00026523", U"\U00026523", U"\U00026523"},
+	{U"\U0002F97D", U"\u8060", U"\u8060", U"\u8060", U"\u8060"},
+	{U"\U0002F97E", U"\U000265A8", U"\U000265A8", U"\U000265A8", U"\U000265A8"},
+	{U"\U0002F97F", U"\u8070", U"\u8070", U"\u8070", U"\u8070"},
+	{U"\U0002F980", U"\U0002335F", U"\U0002335F", U"\U0002335F", U"\U0002335F"},
+	{U"\U0002F981", U"\u43D5", U"\u43D5", U"\u43D5", U"\u43D5"},
+	{U"\U0002F982", U"\u80B2", U"\u80B2", U"\u80B2", U"\u80B2"},
+	{U"\U0002F983", U"\u8103", U"\u8103", U"\u8103", U"\u8103"},
+	{U"\U0002F984", U"\u440B", U"\u440B", U"\u440B", U"\u440B"},
+	{U"\U0002F985", U"\u813E", U"\u813E", U"\u813E", U"\u813E"},
+	{U"\U0002F986", U"\u5AB5", U"\u5AB5", U"\u5AB5", U"\u5AB5"},
+	{U"\U0002F987", U"\U000267A7", U"\U000267A7", U"\U000267A7", U"\U000267A7"},
+	{U"\U0002F988", U"\U000267B5", U"\U000267B5", U"\U000267B5", U"\U000267B5"},
+	{U"\U0002F989", U"\U00023393", U"\U00023393", U"\U00023393", U"\U00023393"},
+	{U"\U0002F98A", U"\U0002339C", U"\U0002339C", U"\U0002339C", U"\U0002339C"},
+	{U"\U0002F98B", U"\u8201", U"\u8201", U"\u8201", U"\u8201"},
+	{U"\U0002F98C", U"\u8204", U"\u8204", U"\u8204", U"\u8204"},
+	{U"\U0002F98D", U"\u8F9E", U"\u8F9E", U"\u8F9E", U"\u8F9E"},
+	{U"\U0002F98E", U"\u446B", U"\u446B", U"\u446B", U"\u446B"},
+	{U"\U0002F98F", U"\u8291", U"\u8291", U"\u8291", U"\u8291"},
+	{U"\U0002F990", U"\u828B", U"\u828B", U"\u828B", U"\u828B"},
+	{U"\U0002F991", U"\u829D", U"\u829D", U"\u829D", U"\u829D"},
+	{U"\U0002F992", U"\u52B3", U"\u52B3", U"\u52B3", U"\u52B3"},
+	{U"\U0002F993", U"\u82B1", U"\u82B1", U"\u82B1", U"\u82B1"},
+	{U"\U0002F994", U"\u82B3", U"\u82B3", U"\u82B3", U"\u82B3"},
+	{U"\U0002F995", U"\u82BD", U"\u82BD", U"\u82BD", U"\u82BD"},
+	{U"\U0002F996", U"\u82E6", U"\u82E6", U"\u82E6", U"\u82E6"},
+	{U"\U0002F997", U"\U00026B3C", U"\U00026B3C", U"\U00026B3C", U"\U00026B3C"},
+	{U"\U0002F998", U"\u82E5", U"\u82E5", U"\u82E5", U"\u82E5"},
+	{U"\U0002F999", U"\u831D", U"\u831D", U"\u831D", U"\u831D"},
+	{U"\U0002F99A", U"\u8363", U"\u8363", U"\u8363", U"\u8363"},
+	{U"\U0002F99B", U"\u83AD", U"\u83AD", U"\u83AD", U"\u83AD"},
+	{U"\U0002F99C", U"\u8323", U"\u8323", U"\u8323", U"\u8323"},
+	{U"\U0002F99D", U"\u83BD", U"\u83BD", U"\u83BD", U"\u83BD"},
+	{U"\U0002F99E", U"\u83E7", U"\u83E7", U"\u83E7", U"\u83E7"},
+	{U"\U0002F99F", U"\u8457", U"\u8457", U"\u8457", U"\u8457"},
+	{U"\U0002F9A0", U"\u8353", U"\u8353", U"\u8353", U"\u8353"},
+	{U"\U0002F9A1", U"\u83CA", U"\u83CA", U"\u83CA", U"\u83CA"},
+	{U"\U0002F9A2", U"\u83CC", U"\u83CC", U"\u83CC", U"\u83CC"},
+	{U"\U0002F9A3", U"\u83DC", U"\u83DC", U"\u83DC", U"\u83DC"},
+	{U"\U0002F9A4", U"\U00026C36", U"\U00026C36", U"\U00026C36", U"\U00026C36"},
+	{U"\U0002F9A5", U"\U00026D6B", U"\U00026D6B", U"\U00026D6B", U"\U00026D6B"},
+	{U"\U0002F9A6", U"\U00026CD5", U"\U00026CD5", U"\U00026CD5", U"\U00026CD5"},
+	{U"\U0002F9A7", U"\u452B", U"\u452B", U"\u452B", U"\u452B"},
+	{U"\U0002F9A8", U"\u84F1", U"\u84F1", U"\u84F1", U"\u84F1"},
+	{U"\U0002F9A9", U"\u84F3", U"\u84F3", U"\u84F3", U"\u84F3"},
+	{U"\U0002F9AA", U"\u8516", U"\u8516", U"\u8516", U"\u8516"},
+	{U"\U0002F9AB", U"\U000273CA", U"\U000273CA", U"\U000273CA", U"\U000273CA"},
+	{U"\U0002F9AC", U"\u8564", U"\u8564", U"\u8564", U"\u8564"},
+	{U"\U0002F9AD", U"\U00026F2C", U"\U00026F2C", U"\U00026F2C", U"\U00026F2C"},
+	{U"\U0002F9AE", U"\u455D", U"\u455D", U"\u455D", U"\u455D"},
+	{U"\U0002F9AF", U"\u4561", U"\u4561", U"\u4561", U"\u4561"},
+	{U"\U0002F9B0", U"\U00026FB1", U"\U00026FB1", U"\U00026FB1", U"\U00026FB1"},
+	{U"\U0002F9B1", U"\U000270D2", U"\U000270D2", U"\U000270D2", U"\U000270D2"},
+	{U"\U0002F9B2", U"\u456B", U"\u456B", U"\u456B", U"\u456B"},
+	{U"\U0002F9B3", U"\u8650", U"\u8650", U"\u8650", U"\u8650"},
+	{U"\U0002F9B4", U"\u865C", U"\u865C", U"\u865C", U"\u865C"},
+	{U"\U0002F9B5", U"\u8667", U"\u8667", U"\u8667", U"\u8667"},
+	{U"\U0002F9B6", U"\u8669", U"\u8669", U"\u8669", U"\u8669"},
+	{U"\U0002F9B7", U"\u86A9", U"\u86A9", U"\u86A9", U"\u86A9"},
+	{U"\U0002F9B8", U"\u8688", U"\u8688", U"\u8688", U"\u8688"},
+	{U"\U0002F9B9", U"\u870E", U"\u870E", U"\u870E", U"\u870E"},
+	{U"\U0002F9BA", U"\u86E2", U"\u86E2", U"\u86E2", U"\u86E2"},
+	{U"\U0002F9BB", U"\u8779", U"\u8779", U"\u8779", U"\u8779"},
+	{U"\U0002F9BC", U"\u8728", U"\u8728", U"\u8728", U"\u8728"},
+	{U"\U0002F9BD", U"\u876B", U"\u876B", U"\u876B", U"\u876B"},
+	{U"\U0002F9BE", U"\u8786", U"\u8786", U"\u8786", U"\u8786"},
+	{U"\U0002F9BF", U"\u45D7", U"\u45D7", U"\u45D7", U"\u45D7"},
+	{U"\U0002F9C0", U"\u87E1", U"\u87E1", U"\u87E1", U"\u87E1"},
+	{U"\U0002F9C1", U"\u8801", U"\u8801", U"\u8801", U"\u8801"},
+	{U"\U0002F9C2", U"\u45F9", U"\u45F9", U"\u45F9", U"\u45F9"},
+	{U"\U0002F9C3", U"\u8860", U"\u8860", U"\u8860", U"\u8860"},
+	{U"\U0002F9C4", U"\u8863", U"\u8863", U"\u8863", U"\u8863"},
+	{U"\U0002F9C5", U"\U00027667", U"\U00027667", U"\U00027667", U"\U00027667"},
+	{U"\U0002F9C6", U"\u88D7", U"\u88D7", U"\u88D7", U"\u88D7"},
+	{U"\U0002F9C7", U"\u88DE", U"\u88DE", U"\u88DE", U"\u88DE"},
+	{U"\U0002F9C8", U"\u4635", U"\u4635", U"\u4635", U"\u4635"},
+	{U"\U0002F9C9", U"\u88FA", U"\u88FA", U"\u88FA", U"\u88FA"},
+	{U"\U0002F9CA", U"\u34BB", U"\u34BB", U"\u34BB", U"\u34BB"},
+	{U"\U0002F9CB", U"\U000278AE", U"\U000278AE", U"\U000278AE", U"\U000278AE"},
+	{U"\U0002F9CC", U"\U00027966", U"\U00027966", U"\U00027966", U"\U00027966"},
+	{U"\U0002F9CD", U"\u46BE", U"\u46BE", U"\u46BE", U"\u46BE"},
+	{U"\U0002F9CE", U"\u46C7", U"\u46C7", U"\u46C7", U"\u46C7"},
+	{U"\U0002F9CF", U"\u8AA0", U"\u8AA0", U"\u8AA0", U"\u8AA0"},
+	{U"\U0002F9D0", U"\u8AED", U"\u8AED", U"\u8AED", U"\u8AED"},
+	{U"\U0002F9D1", U"\u8B8A", U"\u8B8A", U"\u8B8A", U"\u8B8A"},
+	{U"\U0002F9D2", U"\u8C55", U"\u8C55", U"\u8C55", U"\u8C55"},
+	{U"\U0002F9D3", U"\U00027CA8", U"\U00027CA8", U"\U00027CA8", U"\U00027CA8"},
+	{U"\U0002F9D4", U"\u8CAB", U"\u8CAB", U"\u8CAB", U"\u8CAB"},
+	{U"\U0002F9D5", U"\u8CC1", U"\u8CC1", U"\u8CC1", U"\u8CC1"},
+	{U"\U0002F9D6", U"\u8D1B", U"\u8D1B", U"\u8D1B", U"\u8D1B"},
+	{U"\U0002F9D7", U"\u8D77", U"\u8D77", U"\u8D77", U"\u8D77"},
+	{U"\U0002F9D8", U"\U00027F2F", U"\U00027F2F", U"\U00027F2F", U"\U00027F2F"},
+	{U"\U0002F9D9", U"\U00020804", U"\U00020804", U"\U00020804", U"\U00020804"},
+	{U"\U0002F9DA", U"\u8DCB", U"\u8DCB", U"\u8DCB", U"\u8DCB"},
+	{U"\U0002F9DB", U"\u8DBC", U"\u8DBC", U"\u8DBC", U"\u8DBC"},
+	{U"\U0002F9DC", U"\u8DF0", U"\u8DF0", U"\u8DF0", U"\u8DF0"},
+	{U"\U0002F9DD", U"\U000208DE", U"\U000208DE", U"\U000208DE", U"\U000208DE"},
+	{U"\U0002F9DE", U"\u8ED4", U"\u8ED4", U"\u8ED4", U"\u8ED4"},
+	{U"\U0002F9DF", U"\u8F38", U"\u8F38", U"\u8F38", U"\u8F38"},
+	{U"\U0002F9E0", U"\U000285D2", U"\U000285D2", U"\U000285D2", U"\U000285D2"},
+	{U"\U0002F9E1", U"\U000285ED", U"\U000285ED", U"\U000285ED", U"\U000285ED"},
+	{U"\U0002F9E2", U"\u9094", U"\u9094", U"\u9094", U"\u9094"},
+	{U"\U0002F9E3", U"\u90F1", U"\u90F1", U"\u90F1", U"\u90F1"},
+	{U"\U0002F9E4", U"\u9111", U"\u9111", U"\u9111", U"\u9111"},
+	{U"\U0002F9E5", U"\U0002872E", U"\U0002872E", U"\U0002872E", U"\U0002872E"},
+	{U"\U0002F9E6", U"\u911B", U"\u911B", U"\u911B", U"\u911B"},
+	{U"\U0002F9E7", U"\u9238", U"\u9238", U"\u9238", U"\u9238"},
+	{U"\U0002F9E8", U"\u92D7", U"\u92D7", U"\u92D7", U"\u92D7"},
+	{U"\U0002F9E9", U"\u92D8", U"\u92D8", U"\u92D8", U"\u92D8"},
+	{U"\U0002F9EA", U"\u927C", U"\u927C", U"\u927C", U"\u927C"},
+	{U"\U0002F9EB", U"\u93F9", U"\u93F9", U"\u93F9", U"\u93F9"},
+	{U"\U0002F9EC", U"\u9415", U"\u9415", U"\u9415", U"\u9415"},
+	{U"\U0002F9ED", U"\U00028BFA", U"\U00028BFA", U"\U00028BFA", U"\U00028BFA"},
+	{U"\U0002F9EE", U"\u958B", U"\u958B", U"\u958B", U"\u958B"},
+	{U"\U0002F9EF", U"\u4995", U"\u4995", U"\u4995", U"\u4995"},
+	{U"\U0002F9F0", U"\u95B7", U"\u95B7", U"\u95B7", U"\u95B7"},
+	{U"\U0002F9F1", U"\U00028D77", U"\U00028D77", U"\U00028D77", U"\U00028D77"},
+	{U"\U0002F9F2", U"\u49E6", U"\u49E6", U"\u49E6", U"\u49E6"},
+	{U"\U0002F9F3", U"\u96C3", U"\u96C3", U"\u96C3", U"\u96C3"},
+	{U"\U0002F9F4", U"\u5DB2", U"\u5DB2", U"\u5DB2", U"\u5DB2"},
+	{U"\U0002F9F5", U"\u9723", U"\u9723", U"\u9723", U"\u9723"},
+	{U"\U0002F9F6", U"\U00029145", U"\U00029145", U"\U00029145", U"\U00029145"},
+	{U"\U0002F9F7", U"\U0002921A", U"\U0002921A", U"\U0002921A", U"\U0002921A"},
+	{U"\U0002F9F8", U"\u4A6E", U"\u4A6E", U"\u4A6E", U"\u4A6E"},
+	{U"\U0002F9F9", U"\u4A76", U"\u4A76", U"\u4A76", U"\u4A76"},
+	{U"\U0002F9FA", U"\u97E0", U"\u97E0", U"\u97E0", U"\u97E0"},
+	{U"\U0002F9FB", U"\U0002940A", U"\U0002940A", U"\U0002940A", U"\U0002940A"},
+	{U"\U0002F9FC", U"\u4AB2", U"\u4AB2", U"\u4AB2", U"\u4AB2"},
+	{U"\U0002F9FD", U"\U00029496", U"\U00029496", U"\U00029496", U"\U00029496"},
+	{U"\U0002F9FE", U"\u980B", U"\u980B", U"\u980B", U"\u980B"},
+	{U"\U0002F9FF", U"\u980B", U"\u980B", U"\u980B", U"\u980B"},
+	{U"\U0002FA00", U"\u9829", U"\u9829", U"\u9829", U"\u9829"},
+	{U"\U0002FA01", U"\U000295B6", U"\U000295B6", U"\U000295B6", U"\U000295B6"},
+	{U"\U0002FA02", U"\u98E2", U"\u98E2", U"\u98E2", U"\u98E2"},
+	{U"\U0002FA03", U"\u4B33", U"\u4B33", U"\u4B33", U"\u4B33"},
+	{U"\U0002FA04", U"\u9929", U"\u9929", U"\u9929", U"\u9929"},
+	{U"\U0002FA05", U"\u99A7", U"\u99A7", U"\u99A7", U"\u99A7"},
+	{U"\U0002FA06", U"\u99C2", U"\u99C2", U"\u99C2", U"\u99C2"},
+	{U"\U0002FA07", U"\u99FE", U"\u99FE", U"\u99FE", U"\u99FE"},
+	{U"\U0002FA08", U"\u4BCE", U"\u4BCE", U"\u4BCE", U"\u4BCE"},
+	{U"\U0002FA09", U"\U00029B30", U"\U00029B30", U"\U00029B30", U"\U00029B30"},
+	{U"\U0002FA0A", U"\u9B12", U"\u9B12", U"\u9B12", U"\u9B12"},
+	{U"\U0002FA0B", U"\u9C40", U"\u9C40", U"\u9C40", U"\u9C40"},
+	{U"\U0002FA0C", U"\u9CFD", U"\u9CFD", U"\u9CFD", U"\u9CFD"},
+	{U"\U0002FA0D", U"\u4CCE", U"\u4CCE", U"\u4CCE", U"\u4CCE"},
+	{U"\U0002FA0E", U"\u4CED", U"\u4CED", U"\u4CED", U"\u4CED"},
+	{U"\U0002FA0F", U"\u9D67", U"\u9D67", U"\u9D67", U"\u9D67"},
+	{U"\U0002FA10", U"\U0002A0CE", U"\U0002A0CE", U"\U0002A0CE", U"\U0002A0CE"},
+	{U"\U0002FA11", U"\u4CF8", U"\u4CF8", U"\u4CF8", U"\u4CF8"},
+	{U"\U0002FA12", U"\U0002A105", U"\U0002A105", U"\U0002A105", U"\U0002A105"},
+	{U"\U0002FA13", U"\U0002A20E", U"\U0002A20E", U"\U0002A20E", U"\U0002A20E"},
+	{U"\U0002FA14", U"\U0002A291", U"\U0002A291", U"\U0002A291", U"\U0002A291"},
+	{U"\U0002FA15", U"\u9EBB", U"\u9EBB", U"\u9EBB", U"\u9EBB"},
+	{U"\U0002FA16", U"\u4D56", U"\u4D56", U"\u4D56", U"\u4D56"},
+	{U"\U0002FA17", U"\u9EF9", U"\u9EF9", U"\u9EF9", U"\u9EF9"},
+	{U"\U0002FA18", U"\u9EFE", U"\u9EFE", U"\u9EFE", U"\u9EFE"},
+	{U"\U0002FA19", U"\u9F05", U"\u9F05", U"\u9F05", U"\u9F05"},
+	{U"\U0002FA1A", U"\u9F0F", U"\u9F0F", U"\u9F0F", U"\u9F0F"},
+	{U"\U0002FA1B", U"\u9F16", U"\u9F16", U"\u9F16", U"\u9F16"},
+	{U"\U0002FA1C", U"\u9F3B", U"\u9F3B", U"\u9F3B", U"\u9F3B"},
+	{U"\U0002FA1D", U"\U0002A600", U"\U0002A600", U"\U0002A600", U"\U0002A600"},
+};
+
+#endif  // ONESTRING_NORMALIZATION_TEST_DATA_HPP
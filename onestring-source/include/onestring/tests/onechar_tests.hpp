@@ -42,7 +42,10 @@
 #ifndef ONECHAR_TESTS_HPP
 #define ONECHAR_TESTS_HPP
 
+#include <unordered_set>
+
 #include "onestring/onestring.hpp"
+#include "onestring/tests/onestring_tests.hpp"
 
 #include "goldilocks/goldilocks.hpp"
 #include "goldilocks/assertions.hpp"
@@ -842,6 +845,480 @@ public:
 	}
 };
 
+// O-tB112
+class TestOnechar_EvaluateCodepoint : public Test
+{
+public:
+	TestOnechar_EvaluateCodepoint() {}
+
+	testdoc_t get_title() override { return "Onechar: Evaluate Codepoint"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test that the onechar::evaluateCodepoint() function works "
+			   "correctly.";
+	}
+
+	bool run() override
+	{
+		PL_ASSERT_EQUAL(onechar::evaluateCodepoint("M"), U'M');
+		PL_ASSERT_EQUAL(onechar::evaluateCodepoint("©"), U'©');
+		PL_ASSERT_EQUAL(onechar::evaluateCodepoint("‽"), U'‽');
+		PL_ASSERT_EQUAL(onechar::evaluateCodepoint("🐭"), U'🐭');
+		// Only the first character should be decoded.
+		PL_ASSERT_EQUAL(onechar::evaluateCodepoint("界🐭"), U'界');
+		PL_ASSERT_EQUAL(onechar::evaluateCodepoint("\x7F"), U'\x7F');
+		PL_ASSERT_EQUAL(onechar::evaluateCodepoint("\xF4\x8F\xBF\xBF"),
+						U'\U0010FFFF');
+		return true;
+	}
+
+	~TestOnechar_EvaluateCodepoint() {}
+};
+
+// O-tB113
+class TestOnechar_Validate : public Test
+{
+public:
+	TestOnechar_Validate() {}
+
+	testdoc_t get_title() override { return "Onechar: Validate"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test that the onechar::validate() function accepts "
+			   "well-formed UTF-8 and rejects malformed UTF-8.";
+	}
+
+	bool run() override
+	{
+		size_t len = 0;
+		PL_ASSERT_TRUE(onechar::validate("M", len));
+		PL_ASSERT_EQUAL(len, 1u);
+		PL_ASSERT_TRUE(onechar::validate("©", len));
+		PL_ASSERT_EQUAL(len, 2u);
+		PL_ASSERT_TRUE(onechar::validate("‽", len));
+		PL_ASSERT_EQUAL(len, 3u);
+		PL_ASSERT_TRUE(onechar::validate("🐭", len));
+		PL_ASSERT_EQUAL(len, 4u);
+
+		// Stray continuation byte
+		PL_ASSERT_FALSE(onechar::validate("\x80", len));
+		PL_ASSERT_EQUAL(len, 1u);
+		// Overlong encodings
+		PL_ASSERT_FALSE(onechar::validate("\xC0\xAF", len));
+		PL_ASSERT_EQUAL(len, 1u);
+		PL_ASSERT_FALSE(onechar::validate("\xE0\x80\xAF", len));
+		PL_ASSERT_EQUAL(len, 1u);
+		// Surrogate
+		PL_ASSERT_FALSE(onechar::validate("\xED\xA0\x80", len));
+		PL_ASSERT_EQUAL(len, 1u);
+		// Above U+10FFFF
+		PL_ASSERT_FALSE(onechar::validate("\xF4\x90\x80\x80", len));
+		PL_ASSERT_EQUAL(len, 1u);
+		// Truncated by the null terminator
+		PL_ASSERT_FALSE(onechar::validate("\xF0\x9F\x90", len));
+		PL_ASSERT_EQUAL(len, 3u);
+		// Truncated by the end of the available bytes
+		PL_ASSERT_FALSE(onechar::validate("🐭", len, 2));
+		PL_ASSERT_EQUAL(len, 2u);
+		return true;
+	}
+
+	~TestOnechar_Validate() {}
+};
+
+/* Mixed Latin, CJK, and emoji characters in random order, so the byte length
+ * of each character is unpredictable to the branch predictor. */
+class TestOnechar_MixedCorpus : public Test
+{
+protected:
+	std::string corpus;
+	size_t expected = 0;
+
+public:
+	TestOnechar_MixedCorpus() {}
+
+	bool pre() override
+	{
+		const char* samples[] = {"a", "b", " ", "é", "ï", "日", "界", "🐭",
+								 "🦊", "©", "‽", "x"};
+		corpus.clear();
+		expected = 0;
+		build_corpus(samples, 65536, [this](const char* sample, size_t) {
+			corpus += sample;
+			expected += onestring::characterCount(sample);
+			return corpus.size();
+		});
+		return true;
+	}
+
+	virtual testdoc_t get_title() override = 0;
+	virtual testdoc_t get_docs() override = 0;
+};
+
+// O-tP101
+class TestOnechar_EvaluateLengthMixed : public TestOnechar_MixedCorpus
+{
+public:
+	TestOnechar_EvaluateLengthMixed() {}
+
+	testdoc_t get_title() override
+	{
+		return "Onechar: Evaluate Length (Mixed Script)";
+	}
+
+	testdoc_t get_docs() override
+	{
+		return "Count the characters in mixed Latin, CJK, and emoji text "
+			   "with onechar::evaluateLength().";
+	}
+
+	bool run() override
+	{
+		const char* cstr = corpus.c_str();
+		size_t index = 0;
+		size_t count = 0;
+		while (cstr[index] != '\0') {
+			index += onechar::evaluateLength(cstr + index);
+			++count;
+		}
+		PL_ASSERT_EQUAL(count, expected);
+		return true;
+	}
+};
+
+// O-tP101 (comparative)
+class TestOnechar_EvaluateLengthMixedSwitch : public TestOnechar_MixedCorpus
+{
+	/// The former branching implementation of onechar::evaluateLength().
+	static size_t evaluateLengthSwitch(const char* cstr)
+	{
+		switch (cstr[0] & 0xF0) {
+			case 0xF0: {
+				return 4;
+			}
+			case 0xE0: {
+				return 3;
+			}
+			case 0xD0:
+			case 0xC0: {
+				return 2;
+			}
+			default: {
+				return 1;
+			}
+		}
+	}
+
+public:
+	TestOnechar_EvaluateLengthMixedSwitch() {}
+
+	testdoc_t get_title() override
+	{
+		return "Onechar: Evaluate Length (Mixed Script, Switch)";
+	}
+
+	testdoc_t get_docs() override
+	{
+		return "Count the characters in mixed Latin, CJK, and emoji text "
+			   "with a switch on the lead byte.";
+	}
+
+	bool run() override
+	{
+		const char* cstr = corpus.c_str();
+		size_t index = 0;
+		size_t count = 0;
+		while (cstr[index] != '\0') {
+			index += evaluateLengthSwitch(cstr + index);
+			++count;
+		}
+		PL_ASSERT_EQUAL(count, expected);
+		return true;
+	}
+};
+
+// O-tB114
+class TestOnechar_Codepoint : public Test
+{
+public:
+	TestOnechar_Codepoint() {}
+
+	testdoc_t get_title() override { return "Onechar: Code Points"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test converting onechars to and from Unicode code points.";
+	}
+
+	bool run() override
+	{
+		PL_ASSERT_EQUAL(onechar("M").codepoint(), U'M');
+		PL_ASSERT_EQUAL(onechar("©").codepoint(), U'\u00A9');
+		PL_ASSERT_EQUAL(onechar("‽").codepoint(), U'\u203D');
+		PL_ASSERT_EQUAL(onechar("🐭").codepoint(), U'\U0001F42D');
+
+		PL_ASSERT_EQUAL(onechar(U'M'), "M");
+		PL_ASSERT_EQUAL(onechar(U'\u00A9'), "©");
+		PL_ASSERT_EQUAL(onechar::from_codepoint(0x203D), "‽");
+		PL_ASSERT_EQUAL(onechar::from_codepoint(0x1F42D), "🐭");
+
+		// Code points that cannot be encoded
+		PL_ASSERT_EQUAL(onechar::from_codepoint(0xD800), "\uFFFD");
+		PL_ASSERT_EQUAL(onechar::from_codepoint(0x110000), "\uFFFD");
+
+		// Every scalar value survives the round trip
+		for (char32_t cp = 0; cp <= 0x10FFFF; ++cp) {
+			if (onechar::isCodepoint(cp)) {
+				PL_ASSERT_EQUAL(onechar::from_codepoint(cp).codepoint(), cp);
+			}
+		}
+		return true;
+	}
+};
+
+// O-tB115
+class TestOnechar_Case : public Test
+{
+public:
+	TestOnechar_Case() {}
+
+	testdoc_t get_title() override { return "Onechar: Case Mapping"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test the simple and full Unicode case mappings.";
+	}
+
+	bool run() override
+	{
+		onechar ch = 'M';
+		PL_ASSERT_EQUAL(ch.to_lower(), 'm');
+		PL_ASSERT_EQUAL(ch.to_upper(), 'M');
+		ch = '@';
+		PL_ASSERT_EQUAL(ch.to_lower(), '@');
+		ch = "Ω";
+		PL_ASSERT_EQUAL(ch.to_lower(), "ω");
+		ch = "ж";
+		PL_ASSERT_EQUAL(ch.to_upper(), "Ж");
+		// The Kelvin sign lowercases to ASCII.
+		ch = "\u212A";
+		PL_ASSERT_EQUAL(ch.to_lower(), 'k');
+		// "ß" has no single uppercase character.
+		ch = "ß";
+		PL_ASSERT_EQUAL(ch.to_upper(), "ß");
+		ch = "🐭";
+		PL_ASSERT_EQUAL(ch.to_upper(), "🐭");
+
+		char32_t mapping[3];
+		PL_ASSERT_EQUAL(onechar::fullUpper(U'ß', mapping), 2u);
+		PL_ASSERT_EQUAL(mapping[0], U'S');
+		PL_ASSERT_EQUAL(mapping[1], U'S');
+		PL_ASSERT_EQUAL(onechar::fullUpper(0x0390, mapping), 3u);
+		PL_ASSERT_EQUAL(mapping[2], U'\u0301');
+		PL_ASSERT_EQUAL(onechar::fullLower(0x0130, mapping), 2u);
+		PL_ASSERT_EQUAL(mapping[0], U'i');
+		PL_ASSERT_EQUAL(mapping[1], U'\u0307');
+		PL_ASSERT_EQUAL(onechar::simpleLower(0x0130), U'i');
+		PL_ASSERT_EQUAL(onechar::fullLower(U'A', mapping), 1u);
+		PL_ASSERT_EQUAL(mapping[0], U'a');
+		// Adlam, outside the Basic Multilingual Plane
+		PL_ASSERT_EQUAL(onechar::simpleLower(0x1E900), U'\U0001E922');
+		PL_ASSERT_EQUAL(onechar::simpleUpper(0x10FFFF), U'\U0010FFFF');
+		return true;
+	}
+};
+
+// O-tB116
+class TestOnechar_CaseFold : public Test
+{
+public:
+	TestOnechar_CaseFold() {}
+
+	testdoc_t get_title() override { return "Onechar: Case Folding"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test the simple and full Unicode case folding.";
+	}
+
+	bool run() override
+	{
+		onechar ch = 'Q';
+		PL_ASSERT_EQUAL(ch.fold_case(), 'q');
+		ch = "Σ";
+		PL_ASSERT_EQUAL(ch.fold_case(), "σ");
+		// Final sigma folds the same as sigma, unlike lowercasing.
+		ch = "ς";
+		PL_ASSERT_EQUAL(ch.fold_case(), "σ");
+		// Cherokee folds to uppercase.
+		ch = "\uAB70";
+		PL_ASSERT_EQUAL(ch.fold_case(), "\u13A0");
+
+		PL_ASSERT_EQUAL(onechar::simpleFold(0x1E9E), U'ß');
+		PL_ASSERT_EQUAL(onechar::simpleFold(0x212A), U'k');
+		PL_ASSERT_EQUAL(onechar::simpleFold(U'🐭'), U'🐭');
+
+		char32_t mapping[3];
+		PL_ASSERT_EQUAL(onechar::fullFold(U'ß', mapping), 2u);
+		PL_ASSERT_EQUAL(mapping[0], U's');
+		PL_ASSERT_EQUAL(mapping[1], U's');
+		PL_ASSERT_EQUAL(onechar::fullFold(0x1E9E, mapping), 2u);
+		PL_ASSERT_EQUAL(mapping[0], U's');
+		PL_ASSERT_EQUAL(onechar::fullFold(0x0390, mapping), 3u);
+		PL_ASSERT_EQUAL(mapping[0], U'ι');
+		PL_ASSERT_EQUAL(onechar::fullFold(U'Ω', mapping), 1u);
+		PL_ASSERT_EQUAL(mapping[0], U'ω');
+		return true;
+	}
+};
+
+// O-tB117
+class TestOnechar_Properties : public Test
+{
+public:
+	TestOnechar_Properties() {}
+
+	testdoc_t get_title() override { return "Onechar: Character Properties"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test the General_Category, Script, and character classes of "
+			   "onechars.";
+	}
+
+	bool run() override
+	{
+		onechar ch = 'A';
+		PL_ASSERT_TRUE(ch.general_category() ==
+					   onestring_category::UPPERCASE_LETTER);
+		PL_ASSERT_TRUE(ch.script() == onestring_script::LATIN);
+		PL_ASSERT_TRUE(ch.is_letter());
+		PL_ASSERT_TRUE(ch.is_alphabetic());
+		PL_ASSERT_FALSE(ch.is_digit());
+
+		ch = "ж";
+		PL_ASSERT_TRUE(ch.general_category() ==
+					   onestring_category::LOWERCASE_LETTER);
+		PL_ASSERT_TRUE(ch.script() == onestring_script::CYRILLIC);
+
+		// Arabic-Indic digit seven
+		ch = "\u0667";
+		PL_ASSERT_TRUE(ch.is_digit());
+		PL_ASSERT_TRUE(ch.is_numeric());
+		PL_ASSERT_FALSE(ch.is_letter());
+		PL_ASSERT_TRUE(ch.script() == onestring_script::ARABIC);
+
+		// Roman numeral twelve is alphabetic and numeric, but not a digit.
+		ch = "Ⅻ";
+		PL_ASSERT_TRUE(ch.is_alphabetic());
+		PL_ASSERT_TRUE(ch.is_numeric());
+		PL_ASSERT_FALSE(ch.is_digit());
+		PL_ASSERT_FALSE(ch.is_letter());
+
+		ch = "\u3000";
+		PL_ASSERT_TRUE(ch.is_whitespace());
+		PL_ASSERT_TRUE(ch.general_category() ==
+					   onestring_category::SPACE_SEPARATOR);
+		ch = '\t';
+		PL_ASSERT_TRUE(ch.is_whitespace());
+		PL_ASSERT_TRUE(ch.general_category() == onestring_category::CONTROL);
+		// The zero width space is not White_Space.
+		ch = "\u200B";
+		PL_ASSERT_FALSE(ch.is_whitespace());
+
+		ch = "¿";
+		PL_ASSERT_TRUE(ch.is_punctuation());
+		ch = "🐭";
+		PL_ASSERT_TRUE(ch.general_category() ==
+					   onestring_category::OTHER_SYMBOL);
+		PL_ASSERT_FALSE(ch.is_class(onestring_class::PUNCTUATION));
+
+		// Combining marks inherit the script of their base.
+		ch = "\u0301";
+		PL_ASSERT_TRUE(ch.script() == onestring_script::INHERITED);
+		PL_ASSERT_TRUE(ch.general_category() ==
+					   onestring_category::NONSPACING_MARK);
+
+		ch = "\U000E0080";
+		PL_ASSERT_TRUE(ch.general_category() ==
+					   onestring_category::UNASSIGNED);
+		PL_ASSERT_TRUE(ch.script() == onestring_script::UNKNOWN);
+		ch = "\U0010FFFD";
+		PL_ASSERT_TRUE(ch.general_category() ==
+					   onestring_category::PRIVATE_USE);
+		return true;
+	}
+};
+
+// O-tB118
+class TestOnechar_DisplayWidth : public Test
+{
+public:
+	TestOnechar_DisplayWidth() {}
+
+	testdoc_t get_title() override { return "Onechar: Display Width"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test the number of terminal columns each onechar takes.";
+	}
+
+	bool run() override
+	{
+		PL_ASSERT_EQUAL(onechar('a').display_width(), 1u);
+		PL_ASSERT_EQUAL(onechar('\n').display_width(), 0u);
+		PL_ASSERT_EQUAL(onechar("é").display_width(), 1u);
+		PL_ASSERT_EQUAL(onechar("日").display_width(), 2u);
+		PL_ASSERT_EQUAL(onechar("\u3000").display_width(), 2u);
+		PL_ASSERT_EQUAL(onechar("🐭").display_width(), 2u);
+		PL_ASSERT_EQUAL(onechar("\u0301").display_width(), 0u);
+		PL_ASSERT_EQUAL(onechar("\u200B").display_width(), 0u);
+		// The soft hyphen, and East Asian ambiguous characters, are narrow.
+		PL_ASSERT_EQUAL(onechar("\u00AD").display_width(), 1u);
+		PL_ASSERT_EQUAL(onechar("Ω").display_width(), 1u);
+		// Arabic number signs are drawn over the digits after them.
+		PL_ASSERT_EQUAL(onechar("\u0600").display_width(), 1u);
+		return true;
+	}
+};
+
+// O-tB119
+class TestOnechar_Hash : public Test
+{
+public:
+	TestOnechar_Hash() {}
+
+	testdoc_t get_title() override { return "Onechar: Hash"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test hash() and std::hash<onechar>, and using onechars as "
+			   "the keys of an unordered container.";
+	}
+
+	bool run() override
+	{
+		PL_ASSERT_EQUAL(onechar("é").hash(), onechar("é").hash());
+		PL_ASSERT_EQUAL(onechar('a').hash(), std::hash<onechar>()('a'));
+		PL_ANTIASSERT_EQUAL(onechar('a').hash(), onechar('b').hash());
+		PL_ANTIASSERT_EQUAL(onechar("🐭").hash(), onechar("🐁").hash());
+		PL_ASSERT_EQUAL(onechar("日").hash(), onestring("日").hash());
+
+		// Bytes left over from a longer character are not hashed.
+		onechar test = "🐭";
+		test = 'a';
+		PL_ASSERT_EQUAL(test.hash(), onechar('a').hash());
+
+		std::unordered_set<onechar> set = {'a', "é", "日", "🐭"};
+		PL_ASSERT_EQUAL(set.size(), 4u);
+		PL_ASSERT_EQUAL(set.count(onechar("日")), 1u);
+		PL_ASSERT_EQUAL(set.count(onechar("本")), 0u);
+		return true;
+	}
+};
+
 class TestSuite_Onechar : public TestSuite
 {
 public:
@@ -963,6 +1440,20 @@ public:
 		register_test("O-tB111d",
 					  new TestOnechar_OpGreaterEqual(
 						  TestOnechar::TestCharType::ONECHAR));
+
+		register_test("O-tB112", new TestOnechar_EvaluateCodepoint());
+		register_test("O-tB113", new TestOnechar_Validate());
+		register_test("O-tB114", new TestOnechar_Codepoint());
+		register_test("O-tB115", new TestOnechar_Case());
+		register_test("O-tB116", new TestOnechar_CaseFold());
+		register_test("O-tB117", new TestOnechar_Properties());
+		register_test("O-tB118", new TestOnechar_DisplayWidth());
+		register_test("O-tB119", new TestOnechar_Hash());
+
+		register_test("O-tP101",
+					  new TestOnechar_EvaluateLengthMixed(),
+					  true,
+					  new TestOnechar_EvaluateLengthMixedSwitch());
 	}
 };
 
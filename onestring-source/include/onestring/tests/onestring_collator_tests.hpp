@@ -0,0 +1,411 @@
+/** Tests for Onestring Collator
+ * Version: 1.0
+ *
+ * Author(s): Jason C. McDonald
+ */
+
+/* LICENSE (BSD-3-Clause)
+ * Copyright (c) 2016-2021 MousePaw Media.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * CONTRIBUTING
+ * See https://www.mousepawmedia.com/developers for information
+ * on how to contribute to our projects.
+ */
+
+#ifndef ONESTRING_COLLATOR_TESTS_HPP
+#define ONESTRING_COLLATOR_TESTS_HPP
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "onestring/onestring_collator.hpp"
+#include "onestring/tests/onestring_tests.hpp"
+
+#include "goldilocks/goldilocks.hpp"
+#include "goldilocks/assertions.hpp"
+#include "iosqueak/channel.hpp"
+
+// O-tB601
+class TestOnestringCollator_Compare : public Test
+{
+public:
+	TestOnestringCollator_Compare() {}
+
+	testdoc_t get_title() override { return "Onestring Collator: Compare"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test that compare() orders by letters, then accents, then "
+			   "case, at each strength.";
+	}
+
+	bool run() override
+	{
+		onestring_collator collator;
+		PL_ASSERT_LESS(collator.compare("a", "A"), 0);
+		PL_ASSERT_LESS(collator.compare("A", "á"), 0);
+		PL_ASSERT_LESS(collator.compare("á", "b"), 0);
+		PL_ASSERT_LESS(collator.compare("resume", "résumé"), 0);
+		PL_ASSERT_LESS(collator.compare("résumé", "resumes"), 0);
+		PL_ASSERT_LESS(collator.compare("9", "a"), 0);
+		PL_ASSERT_LESS(collator.compare("ångström", "Zebra"), 0);
+		PL_ASSERT_GREATER(collator.compare("b", "á"), 0);
+		PL_ASSERT_EQUAL(collator.compare("Größe", "Größe"), 0);
+		PL_ASSERT_TRUE(collator("apple", "Banana"));
+		PL_ASSERT_FALSE(collator("Banana", "apple"));
+
+		onestring_collator primary(onestring_strength::PRIMARY);
+		PL_ASSERT_EQUAL(primary.compare("résumé", "RESUME"), 0);
+		PL_ASSERT_LESS(primary.compare("resume", "resumes"), 0);
+
+		onestring_collator secondary(onestring_strength::SECONDARY);
+		PL_ASSERT_EQUAL(secondary.compare("Résumé", "résumé"), 0);
+		PL_ASSERT_LESS(secondary.compare("resume", "résumé"), 0);
+		return true;
+	}
+};
+
+// O-tB602
+class TestOnestringCollator_SortKey : public Test
+{
+public:
+	TestOnestringCollator_SortKey() {}
+
+	testdoc_t get_title() override { return "Onestring Collator: Sort Keys"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test that sort keys compare with memcmp() as compare() does.";
+	}
+
+	bool run() override
+	{
+		onestring_collator collator;
+		std::vector<onestring> words = {"peach", "Péché", "péché", "pêche",
+										"peché", "PEACH", "pea", "Pech",
+										"日本", "가나", "Ελλάδα", "Москва",
+										"co-op", "coop", "", "zoo"};
+
+		for (const onestring& lhs : words) {
+			std::string lhs_key = collator.sort_key(lhs);
+			for (const onestring& rhs : words) {
+				std::string rhs_key = collator.sort_key(rhs);
+				int expected = collator.compare(lhs, rhs);
+				int actual = memcmp(lhs_key.data(),
+									rhs_key.data(),
+									std::min(lhs_key.size(), rhs_key.size()));
+				if (actual == 0) {
+					actual = static_cast<int>(lhs_key.size()) -
+							 static_cast<int>(rhs_key.size());
+				}
+				PL_ASSERT_EQUAL(expected < 0, actual < 0);
+				PL_ASSERT_EQUAL(expected == 0, actual == 0);
+			}
+		}
+
+		std::sort(words.begin(), words.end(), collator);
+		PL_ASSERT_EQUAL(words[0], "");
+		PL_ASSERT_EQUAL(words[1], "co-op");
+		PL_ASSERT_EQUAL(words[2], "coop");
+		PL_ASSERT_EQUAL(words[3], "pea");
+		PL_ASSERT_EQUAL(words[4], "peach");
+		PL_ASSERT_EQUAL(words[5], "PEACH");
+		PL_ASSERT_EQUAL(words[6], "Pech");
+		PL_ASSERT_EQUAL(words[7], "peché");
+		PL_ASSERT_EQUAL(words[8], "péché");
+		PL_ASSERT_EQUAL(words[9], "Péché");
+		PL_ASSERT_EQUAL(words[10], "pêche");
+		PL_ASSERT_EQUAL(words[11], "zoo");
+		PL_ASSERT_EQUAL(words[12], "Ελλάδα");
+		PL_ASSERT_EQUAL(words[13], "Москва");
+		PL_ASSERT_EQUAL(words[14], "가나");
+		PL_ASSERT_EQUAL(words[15], "日本");
+
+		// The key buffer is replaced, not appended to.
+		std::string key = "leftover";
+		collator.sort_key(onestring("pea").view(), key);
+		PL_ASSERT_EQUAL(key, collator.sort_key("pea"));
+		return true;
+	}
+};
+
+// O-tB603
+class TestOnestringCollator_Alternate : public Test
+{
+public:
+	TestOnestringCollator_Alternate() {}
+
+	testdoc_t get_title() override
+	{
+		return "Onestring Collator: Alternate Weighting";
+	}
+
+	testdoc_t get_docs() override
+	{
+		return "Test that spaces and punctuation can be shifted to the "
+			   "quaternary level.";
+	}
+
+	bool run() override
+	{
+		onestring_collator collator;
+		PL_ASSERT_LESS(collator.compare("de luge", "de-luge"), 0);
+		PL_ASSERT_LESS(collator.compare("de-luge", "deluge"), 0);
+		PL_ASSERT_LESS(collator.compare("de Luge", "de-luge"), 0);
+
+		onestring_collator shifted(onestring_strength::TERTIARY,
+								   onestring_alternate::SHIFTED);
+		PL_ASSERT_EQUAL(shifted.compare("de luge", "de-luge"), 0);
+		PL_ASSERT_EQUAL(shifted.compare("de-luge", "deluge"), 0);
+		PL_ASSERT_LESS(shifted.compare("deluge", "de Luge"), 0);
+
+		onestring_collator quaternary(onestring_strength::QUATERNARY,
+									  onestring_alternate::SHIFTED);
+		PL_ASSERT_LESS(quaternary.compare("de luge", "de-luge"), 0);
+		PL_ASSERT_LESS(quaternary.compare("de-luge", "deluge"), 0);
+		PL_ASSERT_LESS(quaternary.compare("deluge", "de Luge"), 0);
+		return true;
+	}
+};
+
+// O-tB604
+class TestOnestringCollator_Unicode : public Test
+{
+public:
+	TestOnestringCollator_Unicode() {}
+
+	testdoc_t get_title() override
+	{
+		return "Onestring Collator: Contractions and Implicit Weights";
+	}
+
+	testdoc_t get_docs() override
+	{
+		return "Test contractions, canonical equivalence, Hangul, and the "
+			   "implicit weights of ideographs.";
+	}
+
+	bool run() override
+	{
+		onestring_collator collator;
+		// Canonically equivalent text is equal.
+		PL_ASSERT_EQUAL(collator.compare("Cr\u00E8me", "Cre\u0300me"), 0);
+		PL_ASSERT_EQUAL(collator.compare("\uAC00", "\u1100\u1161"), 0);
+		PL_ASSERT_EQUAL(collator.compare("q\u0323\u0307", "q\u0307\u0323"), 0);
+
+		// "й" is a letter of its own, after every word beginning with "и".
+		PL_ASSERT_LESS(collator.compare("ия", "\u0439"), 0);
+		PL_ASSERT_EQUAL(collator.compare("\u0439", "\u0438\u0306"), 0);
+		// The breve still contracts with a mark of another class between.
+		PL_ASSERT_LESS(collator.compare("ия", "\u0439\u0328"), 0);
+		PL_ASSERT_LESS(collator.compare("\u0438\u0328я", "\u0439\u0328"), 0);
+
+		// Ideographs sort by code point, after other scripts.
+		PL_ASSERT_LESS(collator.compare("一", "丁"), 0);
+		PL_ASSERT_LESS(collator.compare("가", "一"), 0);
+		PL_ASSERT_LESS(collator.compare("丁", "\U00020000"), 0);
+		PL_ASSERT_LESS(collator.compare("\U00020000", "\U000E0080"), 0);
+
+		// Control characters are ignored.
+		PL_ASSERT_EQUAL(collator.compare("ab", "a\u0001b"), 0);
+		return true;
+	}
+};
+
+// O-tB605
+class TestOnestringCollator_Tailor : public Test
+{
+public:
+	TestOnestringCollator_Tailor() {}
+
+	testdoc_t get_title() override { return "Onestring Collator: Tailoring"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test tailoring the collation order for a language.";
+	}
+
+	bool run() override
+	{
+		onestring_collator swedish;
+		PL_ASSERT_LESS(swedish.compare("äpple", "zebra"), 0);
+		swedish.tailor("z", "å", onestring_strength::PRIMARY)
+			.tailor("z", "ä", onestring_strength::PRIMARY)
+			.tailor("ä", "ö", onestring_strength::PRIMARY)
+			.tailor("å", "Å", onestring_strength::TERTIARY);
+		PL_ASSERT_GREATER(swedish.compare("äpple", "zebra"), 0);
+		PL_ASSERT_LESS(swedish.compare("zzz", "å"), 0);
+		PL_ASSERT_LESS(swedish.compare("åsna", "äpple"), 0);
+		PL_ASSERT_LESS(swedish.compare("äpple", "öl"), 0);
+		PL_ASSERT_LESS(swedish.compare("å", "Å"), 0);
+		PL_ASSERT_LESS(swedish.compare("Å", "åa"), 0);
+		PL_ASSERT_LESS(swedish.compare("Åsa", "äpple"), 0);
+		PL_ASSERT_LESS(swedish.compare("Bo", "ål"), 0);
+
+		onestring_collator slovak;
+		slovak.tailor("h", "ch", onestring_strength::PRIMARY);
+		PL_ASSERT_LESS(slovak.compare("hrad", "chlieb"), 0);
+		PL_ASSERT_LESS(slovak.compare("chlieb", "izba"), 0);
+		PL_ASSERT_LESS(slovak.compare("cibuľa", "hrad"), 0);
+
+		bool thrown = false;
+		try {
+			slovak.tailor("\u0001", "x", onestring_strength::PRIMARY);
+		} catch (const std::invalid_argument&) {
+			thrown = true;
+		}
+		PL_ASSERT_TRUE(thrown);
+		return true;
+	}
+};
+
+/* A list of names in several scripts, with accents, case, and punctuation,
+ * as a contact list might hold. */
+class TestOnestringCollator_Corpus : public Test
+{
+protected:
+	std::vector<onestring> names;
+	onestring_collator collator;
+
+public:
+	TestOnestringCollator_Corpus() {}
+
+	bool pre() override
+	{
+		const char* syllables[] = {"ka", "Ka", "ká", "ré", "su", "Mé", "zo",
+								   "ä", "ch", "-", " ", "ия", "Йо", "日",
+								   "本", "가", "나", "λα", "Ω", "ß"};
+		names.clear();
+		// Names run from two to six syllables, in turn.
+		onestring name;
+		size_t count = 0;
+		build_corpus(syllables, 2000, [&](const char* syllable, size_t) {
+			name.append(syllable);
+			if (++count == 2 + names.size() % 5) {
+				names.push_back(name);
+				name.clear();
+				count = 0;
+			}
+			return names.size();
+		});
+		return true;
+	}
+
+	virtual testdoc_t get_title() override = 0;
+	virtual testdoc_t get_docs() override = 0;
+};
+
+// O-tP601
+class TestOnestringCollator_SortKeys : public TestOnestringCollator_Corpus
+{
+public:
+	TestOnestringCollator_SortKeys() {}
+
+	testdoc_t get_title() override
+	{
+		return "Onestring Collator: Sort by Sort Keys";
+	}
+
+	testdoc_t get_docs() override
+	{
+		return "Sort names by making the sort key of each once, and "
+			   "comparing the keys.";
+	}
+
+	bool run() override
+	{
+		std::vector<std::pair<std::string, size_t>> keys(names.size());
+		for (size_t i = 0; i < names.size(); ++i) {
+			collator.sort_key(names[i].view(), keys[i].first);
+			keys[i].second = i;
+		}
+		std::sort(keys.begin(), keys.end());
+
+		std::vector<onestring> sorted;
+		sorted.reserve(names.size());
+		for (const auto& key : keys) {
+			sorted.push_back(names[key.second]);
+		}
+		PL_ASSERT_EQUAL(sorted.size(), names.size());
+		return true;
+	}
+};
+
+// O-tP601 (comparative)
+class TestOnestringCollator_SortCompare : public TestOnestringCollator_Corpus
+{
+public:
+	TestOnestringCollator_SortCompare() {}
+
+	testdoc_t get_title() override
+	{
+		return "Onestring Collator: Sort by Comparison";
+	}
+
+	testdoc_t get_docs() override
+	{
+		return "Sort names with the collator as the comparison, which makes "
+			   "the keys of both names at every comparison.";
+	}
+
+	bool run() override
+	{
+		std::vector<onestring> sorted = names;
+		std::sort(sorted.begin(), sorted.end(), collator);
+		PL_ASSERT_EQUAL(sorted.size(), names.size());
+		return true;
+	}
+};
+
+class TestSuite_OnestringCollator : public TestSuite
+{
+public:
+	explicit TestSuite_OnestringCollator() {}
+
+	testdoc_t get_title() override { return "Onestring Collator Tests"; }
+
+	void load_tests() override
+	{
+		register_test("O-tB601", new TestOnestringCollator_Compare());
+		register_test("O-tB602", new TestOnestringCollator_SortKey());
+		register_test("O-tB603", new TestOnestringCollator_Alternate());
+		register_test("O-tB604", new TestOnestringCollator_Unicode());
+		register_test("O-tB605", new TestOnestringCollator_Tailor());
+
+		register_test("O-tP601",
+					  new TestOnestringCollator_SortKeys(),
+					  true,
+					  new TestOnestringCollator_SortCompare());
+	}
+};
+
+#endif  // ONESTRING_COLLATOR_TESTS_HPP
@@ -0,0 +1,419 @@
+/** Tests for Onestring Decoder
+ * Version: 1.0
+ *
+ * Author(s): Jason C. McDonald
+ */
+
+/* LICENSE (BSD-3-Clause)
+ * Copyright (c) 2016-2021 MousePaw Media.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * CONTRIBUTING
+ * See https://www.mousepawmedia.com/developers for information
+ * on how to contribute to our projects.
+ */
+
+#ifndef ONESTRING_DECODER_TESTS_HPP
+#define ONESTRING_DECODER_TESTS_HPP
+
+#include <string>
+
+#include "onestring/onestring_decoder.hpp"
+
+#include "goldilocks/goldilocks.hpp"
+#include "goldilocks/assertions.hpp"
+#include "iosqueak/channel.hpp"
+
+// O-tB301
+class TestOnestringDecoder_Whole : public Test
+{
+protected:
+	std::string start = "The quick brown 🦊 jumped over the lazy 🐶.";
+	onestring test;
+
+public:
+	TestOnestringDecoder_Whole() {}
+
+	testdoc_t get_title() override { return "Onestring Decoder: Whole Chunk"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test decoding a chunk containing only complete characters.";
+	}
+
+	bool janitor() override
+	{
+		test.clear();
+		return true;
+	}
+
+	bool run() override
+	{
+		onestring_decoder decoder;
+		PL_ASSERT_EQUAL(decoder.decode(start, test), 41u);
+		PL_ASSERT_EQUAL(decoder.pending(), 0u);
+		PL_ASSERT_EQUAL(decoder.flush(), 0u);
+		PL_ASSERT_EQUAL(test, start);
+		return true;
+	}
+};
+
+// O-tB302
+class TestOnestringDecoder_Split : public Test
+{
+protected:
+	std::string start = "🐭 ©‽ 🦊";
+	onestring test;
+
+public:
+	TestOnestringDecoder_Split() {}
+
+	testdoc_t get_title() override { return "Onestring Decoder: Split Chunks"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test decoding data split at every possible byte offset, "
+			   "including inside multibyte characters.";
+	}
+
+	bool janitor() override
+	{
+		test.clear();
+		return true;
+	}
+
+	bool run() override
+	{
+		for (size_t split = 0; split <= start.size(); ++split) {
+			onestring_decoder decoder;
+			test.clear();
+			decoder.decode(start.data(), split, test);
+			decoder.decode(start.data() + split, start.size() - split, test);
+			PL_ASSERT_EQUAL(decoder.flush(), 0u);
+			PL_ASSERT_EQUAL(test, start);
+		}
+		return true;
+	}
+};
+
+// O-tB303
+class TestOnestringDecoder_ByteByByte : public Test
+{
+protected:
+	std::string start = "🐭🦊 ⛰ The Matterhorn ⛰";
+	onestring test;
+
+public:
+	TestOnestringDecoder_ByteByByte() {}
+
+	testdoc_t get_title() override
+	{
+		return "Onestring Decoder: Byte-By-Byte";
+	}
+
+	testdoc_t get_docs() override
+	{
+		return "Test decoding data delivered one byte at a time.";
+	}
+
+	bool janitor() override
+	{
+		test.clear();
+		return true;
+	}
+
+	bool run() override
+	{
+		onestring_decoder decoder;
+		// The first three bytes of the mouse are held, not appended.
+		for (size_t i = 0; i < 3; ++i) {
+			PL_ASSERT_EQUAL(decoder.decode(start.data() + i, 1, test), 0u);
+			PL_ASSERT_EQUAL(decoder.pending(), i + 1);
+		}
+		PL_ASSERT_EQUAL(decoder.decode(start.data() + 3, 1, test), 1u);
+		PL_ASSERT_EQUAL(decoder.pending(), 0u);
+
+		for (size_t i = 4; i < start.size(); ++i) {
+			decoder.decode(start.data() + i, 1, test);
+		}
+		PL_ASSERT_EQUAL(decoder.flush(), 0u);
+		PL_ASSERT_EQUAL(test, start);
+		return true;
+	}
+};
+
+// O-tB304
+class TestOnestringDecoder_Flush : public Test
+{
+protected:
+	onestring test;
+
+public:
+	TestOnestringDecoder_Flush() {}
+
+	testdoc_t get_title() override { return "Onestring Decoder: Flush"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test that flush() reports and discards a dangling partial "
+			   "character.";
+	}
+
+	bool janitor() override
+	{
+		test.clear();
+		return true;
+	}
+
+	bool run() override
+	{
+		onestring_decoder decoder;
+		// "M" followed by the first two bytes of "‽"
+		decoder.decode("M\xE2\x80", 3, test);
+		PL_ASSERT_EQUAL(test, "M");
+		PL_ASSERT_EQUAL(decoder.pending(), 2u);
+		PL_ASSERT_EQUAL(decoder.flush(), 2u);
+		PL_ASSERT_EQUAL(decoder.pending(), 0u);
+
+		// The decoder should be ready for a new stream.
+		decoder.decode("©", 2, test);
+		PL_ASSERT_EQUAL(test, "M©");
+		PL_ASSERT_EQUAL(decoder.flush(), 0u);
+		return true;
+	}
+};
+
+// O-tB305
+class TestOnestringDecoder_Null : public Test
+{
+protected:
+	onestring test;
+
+public:
+	TestOnestringDecoder_Null() {}
+
+	testdoc_t get_title() override { return "Onestring Decoder: Null Bytes"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test that null bytes in a chunk are decoded as characters.";
+	}
+
+	bool janitor() override
+	{
+		test.clear();
+		return true;
+	}
+
+	bool run() override
+	{
+		onestring_decoder decoder;
+		PL_ASSERT_EQUAL(decoder.decode("a\0b", 3, test), 3u);
+		PL_ASSERT_EQUAL(test.length(), 3u);
+		PL_ASSERT_EQUAL(test[1], '\0');
+		PL_ASSERT_EQUAL(test[2], 'b');
+		return true;
+	}
+};
+
+// O-tB306
+class TestOnestringDecoder_Policy : public Test
+{
+protected:
+	onestring test;
+
+public:
+	TestOnestringDecoder_Policy() {}
+
+	testdoc_t get_title() override { return "Onestring Decoder: Policies"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test decoding malformed data split across chunks with the "
+			   "REPLACE and STRICT policies.";
+	}
+
+	bool janitor() override
+	{
+		test.clear();
+		return true;
+	}
+
+	bool run() override
+	{
+		onestring_decoder decoder;
+		// The first two bytes of "‽" are held, even when validating.
+		decoder.decode<onestring_policy::REPLACE>("M\xE2\x80", 3, test);
+		PL_ASSERT_EQUAL(test, "M");
+		PL_ASSERT_EQUAL(decoder.pending(), 2u);
+		// "A" cannot continue "‽", so the held bytes are replaced.
+		decoder.decode<onestring_policy::REPLACE>("A\x80©", 4, test);
+		PL_ASSERT_EQUAL(test, "M\uFFFDA\uFFFD©");
+		PL_ASSERT_EQUAL(decoder.flush(), 0u);
+
+		bool thrown = false;
+		try {
+			decoder.decode<onestring_policy::STRICT>("\xF0\x9F", 2, test);
+			decoder.decode<onestring_policy::STRICT>("!", 1, test);
+		} catch (const std::invalid_argument&) {
+			thrown = true;
+		}
+		PL_ASSERT_TRUE(thrown);
+		return true;
+	}
+};
+
+// O-tB307
+class TestOnestringDecoder_InvalidEnd : public Test
+{
+protected:
+	onestring test;
+
+public:
+	TestOnestringDecoder_InvalidEnd() {}
+
+	testdoc_t get_title() override
+	{
+		return "Onestring Decoder: Invalid Byte at End";
+	}
+
+	testdoc_t get_docs() override
+	{
+		return "Test that bytes at the end of a chunk which no later bytes "
+			   "could complete are handled by that chunk's policy at once.";
+	}
+
+	bool janitor() override
+	{
+		test.clear();
+		return true;
+	}
+
+	bool run() override
+	{
+		onestring_decoder decoder;
+		// A lone continuation byte can never start a character.
+		decoder.decode<onestring_policy::REPLACE>("ab\x80", 3, test);
+		PL_ASSERT_EQUAL(test, "ab\uFFFD");
+		PL_ASSERT_EQUAL(decoder.pending(), 0u);
+		// Nor can a lead byte that is never valid.
+		decoder.decode<onestring_policy::REPLACE>("c\xF8", 2, test);
+		PL_ASSERT_EQUAL(test, "ab\uFFFDc\uFFFD");
+		PL_ASSERT_EQUAL(decoder.pending(), 0u);
+		PL_ASSERT_EQUAL(decoder.flush(), 0u);
+
+		// STRICT reports the byte on the chunk that holds it.
+		bool thrown = false;
+		try {
+			decoder.decode<onestring_policy::STRICT>("ab\x80", 3, test);
+		} catch (const std::invalid_argument&) {
+			thrown = true;
+		}
+		PL_ASSERT_TRUE(thrown);
+		PL_ASSERT_EQUAL(decoder.pending(), 0u);
+		return true;
+	}
+};
+
+// O-tB308
+class TestOnestringDecoder_StrictUnchanged : public Test
+{
+protected:
+	onestring test;
+
+public:
+	TestOnestringDecoder_StrictUnchanged() {}
+
+	testdoc_t get_title() override
+	{
+		return "Onestring Decoder: STRICT Failure Leaves State Unchanged";
+	}
+
+	testdoc_t get_docs() override
+	{
+		return "Test that a STRICT decode which throws appends nothing and "
+			   "keeps the bytes held from the previous chunk.";
+	}
+
+	bool janitor() override
+	{
+		test.clear();
+		return true;
+	}
+
+	bool run() override
+	{
+		onestring_decoder decoder;
+		// Hold the first two bytes of U+203D.
+		decoder.decode<onestring_policy::REPLACE>("M\xE2\x80", 3, test);
+		PL_ASSERT_EQUAL(test, "M");
+		PL_ASSERT_EQUAL(decoder.pending(), 2u);
+
+		// Complete the held character, then hit a malformed byte.
+		bool thrown = false;
+		try {
+			decoder.decode<onestring_policy::STRICT>("\xBD" "ab\x80" "c", 5,
+													 test);
+		} catch (const std::invalid_argument&) {
+			thrown = true;
+		}
+		PL_ASSERT_TRUE(thrown);
+		PL_ASSERT_EQUAL(test, "M");
+		PL_ASSERT_EQUAL(test.length(), 1u);
+		PL_ASSERT_EQUAL(decoder.pending(), 2u);
+
+		// The held bytes can still be completed afterwards.
+		decoder.decode<onestring_policy::STRICT>("\xBD!", 2, test);
+		PL_ASSERT_EQUAL(test, "M\u203D!");
+		PL_ASSERT_EQUAL(decoder.pending(), 0u);
+		return true;
+	}
+};
+
+class TestSuite_OnestringDecoder : public TestSuite
+{
+public:
+	explicit TestSuite_OnestringDecoder() {}
+
+	testdoc_t get_title() override { return "Onestring Decoder Tests"; }
+
+	void load_tests() override
+	{
+		register_test("O-tB301", new TestOnestringDecoder_Whole());
+		register_test("O-tB302", new TestOnestringDecoder_Split());
+		register_test("O-tB303", new TestOnestringDecoder_ByteByByte());
+		register_test("O-tB304", new TestOnestringDecoder_Flush());
+		register_test("O-tB305", new TestOnestringDecoder_Null());
+		register_test("O-tB306", new TestOnestringDecoder_Policy());
+		register_test("O-tB307", new TestOnestringDecoder_InvalidEnd());
+		register_test("O-tB308", new TestOnestringDecoder_StrictUnchanged());
+	}
+};
+
+#endif  // ONESTRING_DECODER_TESTS_HPP
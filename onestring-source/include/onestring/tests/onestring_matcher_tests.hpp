@@ -0,0 +1,283 @@
+/** Tests for Onestring Matcher
+ * Version: 1.0
+ *
+ * Author(s): Jason C. McDonald
+ */
+
+/* LICENSE (BSD-3-Clause)
+ * Copyright (c) 2016-2021 MousePaw Media.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * CONTRIBUTING
+ * See https://www.mousepawmedia.com/developers for information
+ * on how to contribute to our projects.
+ */
+
+#ifndef ONESTRING_MATCHER_TESTS_HPP
+#define ONESTRING_MATCHER_TESTS_HPP
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "onestring/onestring_matcher.hpp"
+#include "onestring/tests/onestring_tests.hpp"
+
+#include "goldilocks/goldilocks.hpp"
+#include "goldilocks/assertions.hpp"
+#include "iosqueak/channel.hpp"
+
+// O-tB701
+class TestOnestringMatcher_FindAll : public Test
+{
+public:
+	TestOnestringMatcher_FindAll() {}
+
+	testdoc_t get_title() override { return "Onestring Matcher: Find All"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test that find_all() reports every occurrence of every "
+			   "pattern, including overlapping ones.";
+	}
+
+	bool run() override
+	{
+		onestring_matcher matcher({"he", "she", "his", "hers"});
+		PL_ASSERT_EQUAL(matcher.size(), 4u);
+		PL_ASSERT_FALSE(matcher.folds_case());
+
+		using match = onestring_matcher::match;
+		std::vector<match> found = matcher.find_all("ushers");
+		std::vector<match> expected = {{1, 3, 1}, {2, 2, 0}, {2, 4, 3}};
+		PL_ASSERT_TRUE(found == expected);
+
+		found = matcher.find_all(onestring("this is his"));
+		expected = {{1, 3, 2}, {8, 3, 2}};
+		PL_ASSERT_TRUE(found == expected);
+		PL_ASSERT_TRUE(matcher.find_all("").empty());
+		PL_ASSERT_TRUE(matcher.find_all("nothing to see").empty());
+
+		// A pattern inside another is found at both.
+		onestring_matcher nested({"a", "aa", "aaa"});
+		PL_ASSERT_EQUAL(nested.find_all("aaaa").size(), 9u);
+
+		// Patterns with the same text are each reported, in order.
+		onestring_matcher same({"ab", "b", "ab"});
+		found = same.find_all("xab");
+		expected = {{1, 2, 0}, {1, 2, 2}, {2, 1, 1}};
+		PL_ASSERT_TRUE(found == expected);
+
+		bool thrown = false;
+		try {
+			onestring_matcher empty({"a", ""});
+		} catch (const std::invalid_argument&) {
+			thrown = true;
+		}
+		PL_ASSERT_TRUE(thrown);
+		return true;
+	}
+};
+
+// O-tB702
+class TestOnestringMatcher_Unicode : public Test
+{
+public:
+	TestOnestringMatcher_Unicode() {}
+
+	testdoc_t get_title() override { return "Onestring Matcher: Unicode"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test that matches are reported at character positions, and "
+			   "that a case-folded matcher ignores case.";
+	}
+
+	bool run() override
+	{
+		using match = onestring_matcher::match;
+		onestring_matcher matcher({"日本", "本語", "🐭", "été"});
+		onestring text = "🐭 日本語 Été été";
+		std::vector<match> found = matcher.find_all(text);
+		std::vector<match> expected = {
+			{0, 1, 2}, {2, 2, 0}, {3, 2, 1}, {10, 3, 3}};
+		PL_ASSERT_TRUE(found == expected);
+		// A view is searched in place, at positions within the view.
+		found = matcher.find_all(text.view(2, 3));
+		expected = {{0, 2, 0}, {1, 2, 1}};
+		PL_ASSERT_TRUE(found == expected);
+
+		onestring_matcher folded({"ÉTÉ", "straße", "Ω"}, true);
+		PL_ASSERT_TRUE(folded.folds_case());
+		found = folded.find_all("été, Été, STRASSE, Straße, ω, Ω");
+		expected = {
+			{0, 3, 0}, {5, 3, 0}, {19, 6, 1}, {27, 1, 2}, {30, 1, 2}};
+		PL_ASSERT_TRUE(found == expected);
+
+		// The callback sees each match as it is found.
+		size_t total = 0;
+		matcher.scan(text, [&total](const match& m) { total += m.length; });
+		PL_ASSERT_EQUAL(total, 8u);
+		return true;
+	}
+};
+
+/* Messages to scan for many keywords at once. */
+class TestOnestringMatcher_Corpus : public Test
+{
+protected:
+	onestring log;
+	std::vector<onestring> keywords;
+	size_t expected = 0;
+
+public:
+	TestOnestringMatcher_Corpus() {}
+
+	bool pre() override
+	{
+		const char* found[] = {"disk", "日本語", "card", "token", "alice",
+							   "user", "über", "🐭", "10.0.0"};
+		keywords.clear();
+		for (const char* keyword : found) {
+			keywords.push_back(keyword);
+		}
+		// Most keywords, like most markers, are never seen.
+		while (keywords.size() < 200) {
+			keywords.push_back(
+				onestring("marker-" + std::to_string(keywords.size())));
+		}
+
+		log.clear();
+		std::string std_log;
+		build_corpus(LOG_SAMPLES, 16384, [&](const char* line, size_t) {
+			log.append(line);
+			std_log += line;
+			return log.length();
+		});
+
+		expected = 0;
+		for (const char* keyword : found) {
+			size_t pos = std_log.find(keyword);
+			while (pos != std::string::npos) {
+				++expected;
+				pos = std_log.find(keyword, pos + 1);
+			}
+		}
+		return true;
+	}
+
+	virtual testdoc_t get_title() override = 0;
+	virtual testdoc_t get_docs() override = 0;
+};
+
+// O-tP701
+class TestOnestringMatcher_Keywords : public TestOnestringMatcher_Corpus
+{
+public:
+	TestOnestringMatcher_Keywords() {}
+
+	testdoc_t get_title() override
+	{
+		return "Onestring Matcher: Scan for Keywords";
+	}
+
+	testdoc_t get_docs() override
+	{
+		return "Find 200 keywords in a log in one pass with "
+			   "onestring_matcher.";
+	}
+
+	bool run() override
+	{
+		onestring_matcher matcher(keywords);
+		size_t total = 0;
+		matcher.scan(log, [&total](const onestring_matcher::match&) {
+			++total;
+		});
+		PL_ASSERT_EQUAL(total, expected);
+		return true;
+	}
+};
+
+// O-tP701 (comparative)
+class TestOnestringMatcher_KeywordsFind : public TestOnestringMatcher_Corpus
+{
+public:
+	TestOnestringMatcher_KeywordsFind() {}
+
+	testdoc_t get_title() override
+	{
+		return "Onestring Matcher: Scan for Keywords (find)";
+	}
+
+	testdoc_t get_docs() override
+	{
+		return "Find 200 keywords in a log with a pass of onestring::find() "
+			   "for each.";
+	}
+
+	bool run() override
+	{
+		size_t total = 0;
+		for (const onestring& keyword : keywords) {
+			size_t pos = 0;
+			while (pos < log.length()) {
+				int found = log.find(keyword, pos);
+				if (found < 0) {
+					break;
+				}
+				++total;
+				pos = static_cast<size_t>(found) + 1;
+			}
+		}
+		PL_ASSERT_EQUAL(total, expected);
+		return true;
+	}
+};
+
+class TestSuite_OnestringMatcher : public TestSuite
+{
+public:
+	explicit TestSuite_OnestringMatcher() {}
+
+	testdoc_t get_title() override { return "Onestring Matcher Tests"; }
+
+	void load_tests() override
+	{
+		register_test("O-tB701", new TestOnestringMatcher_FindAll());
+		register_test("O-tB702", new TestOnestringMatcher_Unicode());
+
+		register_test("O-tP701",
+					  new TestOnestringMatcher_Keywords(),
+					  true,
+					  new TestOnestringMatcher_KeywordsFind());
+	}
+};
+
+#endif  // ONESTRING_MATCHER_TESTS_HPP
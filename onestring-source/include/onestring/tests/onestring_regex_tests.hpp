@@ -0,0 +1,389 @@
+/** Tests for Onestring Regex
+ * Version: 1.0
+ *
+ * Author(s): Jason C. McDonald
+ */
+
+/* LICENSE (BSD-3-Clause)
+ * Copyright (c) 2016-2021 MousePaw Media.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * CONTRIBUTING
+ * See https://www.mousepawmedia.com/developers for information
+ * on how to contribute to our projects.
+ */
+
+#ifndef ONESTRING_REGEX_TESTS_HPP
+#define ONESTRING_REGEX_TESTS_HPP
+
+#include <regex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "onestring/onestring_regex.hpp"
+#include "onestring/tests/onestring_tests.hpp"
+
+#include "goldilocks/goldilocks.hpp"
+#include "goldilocks/assertions.hpp"
+#include "iosqueak/channel.hpp"
+
+// O-tB801
+class TestOnestringRegex_Match : public Test
+{
+public:
+	TestOnestringRegex_Match() {}
+
+	testdoc_t get_title() override { return "Onestring Regex: Match"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test that matches() tests the whole text, and search() tests "
+			   "for a match anywhere in it.";
+	}
+
+	bool run() override
+	{
+		onestring_regex number("-?\\d+(\\.\\d+)?");
+		PL_ASSERT_EQUAL(number.groups(), 1u);
+		PL_ASSERT_TRUE(number.matches("-12.5"));
+		PL_ASSERT_TRUE(number.matches("42"));
+		PL_ASSERT_FALSE(number.matches("4."));
+		PL_ASSERT_FALSE(number.matches("x42"));
+		PL_ASSERT_TRUE(number.search("x42"));
+		PL_ASSERT_FALSE(number.search("none"));
+
+		onestring_regex anchored("^ab|cd$");
+		PL_ASSERT_TRUE(anchored.search("abxx"));
+		PL_ASSERT_FALSE(anchored.search("xab"));
+		PL_ASSERT_TRUE(anchored.search("xxcd"));
+		PL_ASSERT_FALSE(anchored.search("cdx"));
+
+		onestring_regex counted("a{2,3}b");
+		PL_ASSERT_TRUE(counted.matches("aab"));
+		PL_ASSERT_TRUE(counted.matches("aaab"));
+		PL_ASSERT_FALSE(counted.matches("ab"));
+		PL_ASSERT_FALSE(counted.matches("aaaab"));
+
+		onestring_regex empty("");
+		PL_ASSERT_TRUE(empty.matches(""));
+		PL_ASSERT_TRUE(empty.search("abc"));
+		PL_ASSERT_FALSE(empty.matches("a"));
+
+		// A dot is one character, however many bytes, but not a line feed.
+		onestring_regex dot("a.c");
+		PL_ASSERT_TRUE(dot.matches("a🐭c"));
+		PL_ASSERT_FALSE(dot.matches("a\nc"));
+		return true;
+	}
+};
+
+// O-tB802
+class TestOnestringRegex_Captures : public Test
+{
+public:
+	TestOnestringRegex_Captures() {}
+
+	testdoc_t get_title() override { return "Onestring Regex: Captures"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test that find() reports the leftmost match and its capture "
+			   "groups, and find_all() every match that does not overlap.";
+	}
+
+	bool run() override
+	{
+		onestring_regex pair("(\\w+)=(\\w+)?");
+		onestring_regex::match found;
+		PL_ASSERT_TRUE(pair.find("set key=value now", found));
+		PL_ASSERT_EQUAL(found.groups(), 2u);
+		PL_ASSERT_EQUAL(found.position(), 4u);
+		PL_ASSERT_EQUAL(found.length(), 9u);
+		PL_ASSERT_EQUAL(found.end(), 13u);
+		PL_ASSERT_EQUAL(found.position(1), 4u);
+		PL_ASSERT_EQUAL(found.length(1), 3u);
+		PL_ASSERT_EQUAL(found.position(2), 8u);
+		PL_ASSERT_EQUAL(found.length(2), 5u);
+
+		// A group that takes no part in the match has no position.
+		PL_ASSERT_TRUE(pair.find("flag= on", found));
+		PL_ASSERT_EQUAL(found.length(), 5u);
+		PL_ASSERT_FALSE(found.matched(2));
+		PL_ASSERT_EQUAL(found.position(2), onestring_regex::npos);
+
+		onestring_regex greedy("<(.+)>");
+		onestring_regex lazy("<(.+?)>");
+		PL_ASSERT_TRUE(greedy.find("<a><b>", found));
+		PL_ASSERT_EQUAL(found.length(1), 4u);
+		PL_ASSERT_TRUE(lazy.find("<a><b>", found));
+		PL_ASSERT_EQUAL(found.length(1), 1u);
+
+		// The earlier alternative is preferred, as in Perl.
+		onestring_regex alternate("(a|ab)(c|bcd)");
+		PL_ASSERT_TRUE(alternate.find("abcd", found));
+		PL_ASSERT_EQUAL(found.length(1), 1u);
+		PL_ASSERT_EQUAL(found.length(2), 3u);
+
+		onestring_regex digits("\\d+");
+		PL_ASSERT_TRUE(digits.find("a1b22c333", found, 2));
+		PL_ASSERT_EQUAL(found.position(), 3u);
+		PL_ASSERT_EQUAL(found.length(), 2u);
+		PL_ASSERT_FALSE(digits.find("a1b22c333", found, 9));
+		PL_ASSERT_FALSE(found.matched());
+
+		std::vector<onestring_regex::match> all = digits.find_all("a1b22c333");
+		PL_ASSERT_EQUAL(all.size(), 3u);
+		PL_ASSERT_EQUAL(all[0].position(), 1u);
+		PL_ASSERT_EQUAL(all[1].position(), 3u);
+		PL_ASSERT_EQUAL(all[2].position(), 6u);
+
+		// After an empty match, the search moves on a character.
+		onestring_regex star("x*");
+		all = star.find_all("axxb");
+		PL_ASSERT_EQUAL(all.size(), 4u);
+		PL_ASSERT_EQUAL(all[1].position(), 1u);
+		PL_ASSERT_EQUAL(all[1].length(), 2u);
+		PL_ASSERT_EQUAL(all[3].position(), 4u);
+
+		bool thrown = false;
+		try {
+			digits.find("a1b22c333", found, 10);
+		} catch (const std::out_of_range&) {
+			thrown = true;
+		}
+		PL_ASSERT_TRUE(thrown);
+
+		thrown = false;
+		try {
+			pair.find("k=v", found);
+			found.position(3);
+		} catch (const std::out_of_range&) {
+			thrown = true;
+		}
+		PL_ASSERT_TRUE(thrown);
+		return true;
+	}
+};
+
+// O-tB803
+class TestOnestringRegex_Unicode : public Test
+{
+public:
+	TestOnestringRegex_Unicode() {}
+
+	testdoc_t get_title() override { return "Onestring Regex: Unicode"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test that classes match by code point and Unicode property, "
+			   "and that positions are in characters.";
+	}
+
+	bool run() override
+	{
+		onestring_regex word("\\w+");
+		std::vector<onestring_regex::match> all =
+			word.find_all("🐭 naïve 日本語 ٣٤");
+		PL_ASSERT_EQUAL(all.size(), 3u);
+		PL_ASSERT_EQUAL(all[0].position(), 2u);
+		PL_ASSERT_EQUAL(all[0].length(), 5u);
+		PL_ASSERT_EQUAL(all[1].position(), 8u);
+		PL_ASSERT_EQUAL(all[2].position(), 12u);
+		PL_ASSERT_EQUAL(all[2].length(), 2u);
+
+		onestring_regex title("\\p{Lu}\\p{Ll}*");
+		all = title.find_all("Été über Ωmega");
+		PL_ASSERT_EQUAL(all.size(), 2u);
+		PL_ASSERT_EQUAL(all[0].length(), 3u);
+		PL_ASSERT_EQUAL(all[1].position(), 9u);
+		PL_ASSERT_EQUAL(all[1].length(), 5u);
+
+		onestring_regex hiragana("[ぁ-ゖ]+");
+		onestring_regex::match found;
+		PL_ASSERT_TRUE(hiragana.find("カタカナとひらがな", found));
+		PL_ASSERT_EQUAL(found.position(), 4u);
+		PL_ASSERT_EQUAL(found.length(), 5u);
+
+		onestring_regex letters("[^\\s\\d]+");
+		PL_ASSERT_TRUE(letters.matches("日本"));
+		PL_ASSERT_FALSE(letters.matches("日 本"));
+		PL_ASSERT_FALSE(letters.matches("日٣"));
+
+		PL_ASSERT_TRUE(onestring_regex("\\x{1F42D}").search("a 🐭"));
+		PL_ASSERT_TRUE(onestring_regex("\\D").matches("x"));
+		PL_ASSERT_TRUE(onestring_regex("\\P{L}").matches("٣"));
+		return true;
+	}
+};
+
+// O-tB804
+class TestOnestringRegex_Errors : public Test
+{
+public:
+	TestOnestringRegex_Errors() {}
+
+	testdoc_t get_title() override { return "Onestring Regex: Errors"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test that invalid patterns throw, and that patterns which "
+			   "backtrack badly elsewhere take linear time.";
+	}
+
+	bool run() override
+	{
+		const char* invalid[] = {"(a", "a)", "*a", "a{3,2}", "[a",
+								 "\\q", "a{1001}", "\\p{Xx}", "(?=a)"};
+		for (const char* pattern : invalid) {
+			bool thrown = false;
+			try {
+				onestring_regex regex(pattern);
+			} catch (const std::invalid_argument&) {
+				thrown = true;
+			}
+			PL_ASSERT_TRUE(thrown);
+		}
+
+		// A backtracking engine tries every way to split the run of a's.
+		onestring_regex nested("(a*)*b");
+		onestring text(std::string(5000, 'a'));
+		onestring_regex::match found;
+		PL_ASSERT_FALSE(nested.search(text));
+		PL_ASSERT_FALSE(nested.find(text, found));
+		text.append("b");
+		PL_ASSERT_TRUE(nested.find(text, found));
+		PL_ASSERT_EQUAL(found.length(), 5001u);
+		return true;
+	}
+};
+
+/* A log to search with a regular expression. */
+class TestOnestringRegex_Corpus : public Test
+{
+protected:
+	onestring log;
+	std::string std_log;
+	size_t expected = 0;
+
+public:
+	TestOnestringRegex_Corpus() {}
+
+	bool pre() override
+	{
+		log.clear();
+		std_log.clear();
+		expected = 0;
+		build_corpus(LOG_SAMPLES, 16384, [this](const char* line, size_t i) {
+			log.append(line);
+			std_log += line;
+			expected += (i == 3) ? 1 : 0;
+			return log.length();
+		});
+		return true;
+	}
+
+	virtual testdoc_t get_title() override = 0;
+	virtual testdoc_t get_docs() override = 0;
+};
+
+// O-tP801
+class TestOnestringRegex_FindAll : public TestOnestringRegex_Corpus
+{
+public:
+	TestOnestringRegex_FindAll() {}
+
+	testdoc_t get_title() override
+	{
+		return "Onestring Regex: Find All in a Log";
+	}
+
+	testdoc_t get_docs() override
+	{
+		return "Find every match of a pattern in a log with onestring_regex.";
+	}
+
+	bool run() override
+	{
+		onestring_regex regex("disk full on /(\\w+)");
+		PL_ASSERT_EQUAL(regex.find_all(log).size(), expected);
+		return true;
+	}
+};
+
+// O-tP801 (comparative)
+class TestOnestringRegex_FindAllStd : public TestOnestringRegex_Corpus
+{
+public:
+	TestOnestringRegex_FindAllStd() {}
+
+	testdoc_t get_title() override
+	{
+		return "Onestring Regex: Find All in a Log (std::regex)";
+	}
+
+	testdoc_t get_docs() override
+	{
+		return "Find every match of a pattern in a log with std::regex.";
+	}
+
+	bool run() override
+	{
+		std::regex regex("disk full on /(\\w+)");
+		auto begin =
+			std::sregex_iterator(std_log.begin(), std_log.end(), regex);
+		auto found = static_cast<size_t>(
+			std::distance(begin, std::sregex_iterator()));
+		PL_ASSERT_EQUAL(found, expected);
+		return true;
+	}
+};
+
+class TestSuite_OnestringRegex : public TestSuite
+{
+public:
+	explicit TestSuite_OnestringRegex() {}
+
+	testdoc_t get_title() override { return "Onestring Regex Tests"; }
+
+	void load_tests() override
+	{
+		register_test("O-tB801", new TestOnestringRegex_Match());
+		register_test("O-tB802", new TestOnestringRegex_Captures());
+		register_test("O-tB803", new TestOnestringRegex_Unicode());
+		register_test("O-tB804", new TestOnestringRegex_Errors());
+
+		register_test("O-tP801",
+					  new TestOnestringRegex_FindAll(),
+					  true,
+					  new TestOnestringRegex_FindAllStd());
+	}
+};
+
+#endif  // ONESTRING_REGEX_TESTS_HPP
@@ -0,0 +1,403 @@
+/** Tests for Onestring Searcher
+ * Version: 1.0
+ *
+ * Author(s): Jason C. McDonald
+ */
+
+/* LICENSE (BSD-3-Clause)
+ * Copyright (c) 2016-2021 MousePaw Media.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * CONTRIBUTING
+ * See https://www.mousepawmedia.com/developers for information
+ * on how to contribute to our projects.
+ */
+
+#ifndef ONESTRING_SEARCHER_TESTS_HPP
+#define ONESTRING_SEARCHER_TESTS_HPP
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "onestring/onestring_searcher.hpp"
+#include "onestring/tests/onestring_tests.hpp"
+
+#include "goldilocks/goldilocks.hpp"
+#include "goldilocks/assertions.hpp"
+#include "iosqueak/channel.hpp"
+
+// O-tB901
+class TestOnestringSearcher_Find : public Test
+{
+public:
+	TestOnestringSearcher_Find() {}
+
+	testdoc_t get_title() override { return "Onestring Searcher: Find"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test that find() and rfind() find the first and last "
+			   "occurrences of the needle, at character positions.";
+	}
+
+	bool run() override
+	{
+		onestring_searcher searcher("日本");
+		PL_ASSERT_EQUAL(searcher.length(), 2u);
+		PL_ASSERT_TRUE(searcher.needle() == "日本");
+		PL_ASSERT_EQUAL(searcher.needle().length(), 2u);
+
+		onestring text = "🐭 日本語 and 日本";
+		PL_ASSERT_EQUAL(searcher.find(text), 2u);
+		PL_ASSERT_EQUAL(searcher.find(text, 3), 10u);
+		PL_ASSERT_EQUAL(searcher.find(text, 11), onestring_searcher::npos);
+		// Past the end is not an error; there is just nothing to find.
+		PL_ASSERT_EQUAL(searcher.find(text, 20), onestring_searcher::npos);
+		PL_ASSERT_EQUAL(searcher.rfind(text), 10u);
+		PL_ASSERT_EQUAL(searcher.rfind(text, 9), 2u);
+		PL_ASSERT_EQUAL(searcher.rfind(text, 1), onestring_searcher::npos);
+
+		// A view is searched in place, at positions within the view.
+		PL_ASSERT_EQUAL(searcher.find(text.view(5)), 5u);
+		PL_ASSERT_EQUAL(searcher.find("日"), onestring_searcher::npos);
+
+		// A long haystack is searched with the prepared needle.
+		onestring_searcher word("needle");
+		onestring hay(std::string(200, 'x') + "needle" + std::string(50, 'x'));
+		PL_ASSERT_EQUAL(word.find(hay), 200u);
+		PL_ASSERT_EQUAL(word.rfind(hay), 200u);
+
+		// A copy owns its own needle.
+		onestring_searcher copy = word;
+		word = searcher;
+		PL_ASSERT_EQUAL(copy.find(hay), 200u);
+		PL_ASSERT_EQUAL(word.find(text), 2u);
+
+		bool thrown = false;
+		try {
+			onestring_searcher empty("");
+		} catch (const std::invalid_argument&) {
+			thrown = true;
+		}
+		PL_ASSERT_TRUE(thrown);
+		return true;
+	}
+};
+
+// O-tB902
+class TestOnestringSearcher_FindAll : public Test
+{
+public:
+	TestOnestringSearcher_FindAll() {}
+
+	testdoc_t get_title() override
+	{
+		return "Onestring Searcher: Find All and Count";
+	}
+
+	testdoc_t get_docs() override
+	{
+		return "Test that find_all() and count() find every occurrence, "
+			   "with or without those that overlap.";
+	}
+
+	bool run() override
+	{
+		onestring_searcher searcher("aba");
+		onestring text = "ababa xaba ababa";
+		std::vector<size_t> found = searcher.find_all(text);
+		std::vector<size_t> expected = {0, 7, 11};
+		PL_ASSERT_TRUE(found == expected);
+		found = searcher.find_all(text, true);
+		expected = {0, 2, 7, 11, 13};
+		PL_ASSERT_TRUE(found == expected);
+		PL_ASSERT_EQUAL(searcher.count(text), 3u);
+		PL_ASSERT_EQUAL(searcher.count(text, true), 5u);
+		PL_ASSERT_EQUAL(searcher.count(""), 0u);
+
+		onestring_searcher mouse("🐭");
+		PL_ASSERT_EQUAL(mouse.count("🐭a🐭🐭"), 3u);
+		found = mouse.find_all("🐭a🐭🐭");
+		expected = {0, 2, 3};
+		PL_ASSERT_TRUE(found == expected);
+		return true;
+	}
+};
+
+// O-tB903
+class TestOnestringSearcher_Occurrences : public Test
+{
+public:
+	TestOnestringSearcher_Occurrences() {}
+
+	testdoc_t get_title() override
+	{
+		return "Onestring Searcher: Occurrences";
+	}
+
+	testdoc_t get_docs() override
+	{
+		return "Test that occurrences() walks over every occurrence in order, "
+			   "and can be used to redact a string.";
+	}
+
+	bool run() override
+	{
+		onestring_searcher searcher("aba");
+		onestring text = "ababa xaba ababa";
+		std::vector<size_t> found;
+		for (size_t pos : searcher.occurrences(text)) {
+			found.push_back(pos);
+		}
+		std::vector<size_t> expected = {0, 7, 11};
+		PL_ASSERT_TRUE(found == expected);
+
+		found.clear();
+		for (size_t pos : searcher.occurrences(text, true, 1)) {
+			found.push_back(pos);
+		}
+		expected = {2, 7, 11, 13};
+		PL_ASSERT_TRUE(found == expected);
+
+		onestring empty;
+		PL_ASSERT_TRUE(searcher.occurrences(empty).empty());
+		PL_ASSERT_FALSE(searcher.occurrences(text).empty());
+
+		// A walk stopped early finds nothing past where it stopped.
+		onestring_searcher::range all = searcher.occurrences(text);
+		onestring_searcher::iterator it = all.begin();
+		PL_ASSERT_EQUAL(*it++, 0u);
+		PL_ASSERT_EQUAL(*it, 7u);
+		PL_ASSERT_TRUE(it != all.end());
+
+		onestring_searcher card("4111");
+		onestring message = "card 4111 then 4111 again";
+		onestring redacted;
+		size_t last = 0;
+		for (size_t pos : card.occurrences(message)) {
+			redacted.append(message.substr(last, pos - last));
+			redacted.append("****");
+			last = pos + card.length();
+		}
+		redacted.append(message.substr(last));
+		PL_ASSERT_TRUE(redacted == "card **** then **** again");
+		return true;
+	}
+};
+
+/* Records of a log, each to be searched for the same needle. */
+class TestOnestringSearcher_Corpus : public Test
+{
+protected:
+	std::vector<onestring> records;
+	size_t expected = 0;
+	size_t users = 0;
+
+public:
+	TestOnestringSearcher_Corpus() {}
+
+	bool pre() override
+	{
+		records.clear();
+		expected = 0;
+		users = 0;
+		// Each record holds a few lines, as a batch of messages would.
+		onestring record;
+		size_t count = 0;
+		bool found = false;
+		build_corpus(LOG_SAMPLES, 1024, [&](const char* line, size_t i) {
+			record.append(line);
+			found = found || (i == 3);
+			users += (i == 4 || i == 5) ? 1 : 0;
+			if (++count % 4 == 0) {
+				records.push_back(record);
+				expected += found ? 1 : 0;
+				record.clear();
+				found = false;
+			}
+			return records.size();
+		});
+		return true;
+	}
+
+	virtual testdoc_t get_title() override = 0;
+	virtual testdoc_t get_docs() override = 0;
+};
+
+// O-tP901
+class TestOnestringSearcher_Filter : public TestOnestringSearcher_Corpus
+{
+public:
+	TestOnestringSearcher_Filter() {}
+
+	testdoc_t get_title() override
+	{
+		return "Onestring Searcher: Filter Records";
+	}
+
+	testdoc_t get_docs() override
+	{
+		return "Find the records of a log that hold a needle, with one "
+			   "onestring_searcher.";
+	}
+
+	bool run() override
+	{
+		onestring_searcher searcher("disk full on /var");
+		size_t found = 0;
+		for (const onestring& record : records) {
+			found += (searcher.find(record) != onestring_searcher::npos);
+		}
+		PL_ASSERT_EQUAL(found, expected);
+		return true;
+	}
+};
+
+// O-tP901 (comparative)
+class TestOnestringSearcher_FilterFind : public TestOnestringSearcher_Corpus
+{
+public:
+	TestOnestringSearcher_FilterFind() {}
+
+	testdoc_t get_title() override
+	{
+		return "Onestring Searcher: Filter Records (find)";
+	}
+
+	testdoc_t get_docs() override
+	{
+		return "Find the records of a log that hold a needle, with "
+			   "onestring::find().";
+	}
+
+	bool run() override
+	{
+		onestring needle = "disk full on /var";
+		size_t found = 0;
+		for (const onestring& record : records) {
+			found += (record.find(needle) >= 0);
+		}
+		PL_ASSERT_EQUAL(found, expected);
+		return true;
+	}
+};
+
+// O-tP902
+class TestOnestringSearcher_Count : public TestOnestringSearcher_Corpus
+{
+public:
+	TestOnestringSearcher_Count() {}
+
+	testdoc_t get_title() override
+	{
+		return "Onestring Searcher: Count Occurrences";
+	}
+
+	testdoc_t get_docs() override
+	{
+		return "Count the occurrences of a needle in each record of a log, "
+			   "with onestring_searcher::count().";
+	}
+
+	bool run() override
+	{
+		onestring_searcher searcher("user");
+		size_t found = 0;
+		for (const onestring& record : records) {
+			found += searcher.count(record);
+		}
+		PL_ASSERT_EQUAL(found, users);
+		return true;
+	}
+};
+
+// O-tP902 (comparative)
+class TestOnestringSearcher_CountFind : public TestOnestringSearcher_Corpus
+{
+public:
+	TestOnestringSearcher_CountFind() {}
+
+	testdoc_t get_title() override
+	{
+		return "Onestring Searcher: Count Occurrences (find)";
+	}
+
+	testdoc_t get_docs() override
+	{
+		return "Count the occurrences of a needle in each record of a log, "
+			   "by calling onestring::find() past each one.";
+	}
+
+	bool run() override
+	{
+		onestring needle = "user";
+		size_t found = 0;
+		for (const onestring& record : records) {
+			// find() throws if it starts at the end, so stop before it.
+			size_t pos = 0;
+			while (pos < record.length()) {
+				int at = record.find(needle, pos);
+				if (at < 0) {
+					break;
+				}
+				++found;
+				pos = static_cast<size_t>(at) + needle.length();
+			}
+		}
+		PL_ASSERT_EQUAL(found, users);
+		return true;
+	}
+};
+
+class TestSuite_OnestringSearcher : public TestSuite
+{
+public:
+	explicit TestSuite_OnestringSearcher() {}
+
+	testdoc_t get_title() override { return "Onestring Searcher Tests"; }
+
+	void load_tests() override
+	{
+		register_test("O-tB901", new TestOnestringSearcher_Find());
+		register_test("O-tB902", new TestOnestringSearcher_FindAll());
+		register_test("O-tB903", new TestOnestringSearcher_Occurrences());
+
+		register_test("O-tP901",
+					  new TestOnestringSearcher_Filter(),
+					  true,
+					  new TestOnestringSearcher_FilterFind());
+		register_test("O-tP902",
+					  new TestOnestringSearcher_Count(),
+					  true,
+					  new TestOnestringSearcher_CountFind());
+	}
+};
+
+#endif  // ONESTRING_SEARCHER_TESTS_HPP
@@ -0,0 +1,246 @@
+/** Tests for Onestring Segments
+ * Version: 1.0
+ *
+ * Author(s): Jason C. McDonald
+ */
+
+/* LICENSE (BSD-3-Clause)
+ * Copyright (c) 2016-2021 MousePaw Media.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * CONTRIBUTING
+ * See https://www.mousepawmedia.com/developers for information
+ * on how to contribute to our projects.
+ */
+
+#ifndef ONESTRING_SEGMENTS_TESTS_HPP
+#define ONESTRING_SEGMENTS_TESTS_HPP
+
+#include <string>
+#include <vector>
+
+#include "onestring/onestring.hpp"
+#include "onestring/onestring_segments.hpp"
+
+#include "goldilocks/goldilocks.hpp"
+#include "goldilocks/assertions.hpp"
+#include "iosqueak/channel.hpp"
+
+/** Segments a string and checks each segment against a list.
+ * \param the segments
+ * \param the expected segments
+ * \return true if they match, else false */
+inline bool segments_are(const onestring_segments& segments,
+						 const std::vector<std::string>& expected)
+{
+	size_t i = 0;
+	for (const onestring_view& segment : segments) {
+		if (i >= expected.size() || segment != expected[i++]) {
+			return false;
+		}
+	}
+	return i == expected.size() && segments.count() == expected.size();
+}
+
+// O-tB501
+class TestOnestringSegments_Graphemes : public Test
+{
+public:
+	TestOnestringSegments_Graphemes() {}
+
+	testdoc_t get_title() override { return "Onestring Segments: Graphemes"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test splitting text into extended grapheme clusters.";
+	}
+
+	bool run() override
+	{
+		// ASCII, with CR LF as one cluster
+		PL_ASSERT_TRUE(segments_are(onestring("ab\r\nc").graphemes(),
+									{"a", "b", "\r\n", "c"}));
+		// Combining marks stay with their base
+		PL_ASSERT_TRUE(segments_are(onestring("e\u0301e\u0301\u0323").graphemes(),
+									{"e\u0301", "e\u0301\u0323"}));
+		// Emoji ZWJ sequences and skin tone modifiers
+		PL_ASSERT_TRUE(segments_are(onestring("👨‍👩‍👧👍🏽!").graphemes(),
+									{"👨‍👩‍👧", "👍🏽", "!"}));
+		// A ZWJ after a letter does not join the emoji that follows
+		PL_ASSERT_TRUE(segments_are(onestring("a\u200D🐭").graphemes(),
+									{"a\u200D", "🐭"}));
+		// Regional indicators pair up into flags
+		PL_ASSERT_TRUE(segments_are(onestring("🇺🇸🇫🇷🇩").graphemes(),
+									{"🇺🇸", "🇫🇷", "🇩"}));
+		// Hangul jamo form syllables
+		PL_ASSERT_TRUE(segments_are(onestring("\u1100\u1161\u11A8\uAC00\u11A8").graphemes(),
+									{"\u1100\u1161\u11A8", "\uAC00\u11A8"}));
+		// Spacing marks and prepended characters
+		PL_ASSERT_TRUE(segments_are(onestring("क्षि\u0600१").graphemes(),
+									{"क्", "षि", "\u0600१"}));
+		PL_ASSERT_TRUE(segments_are(onestring("").graphemes(), {}));
+		return true;
+	}
+};
+
+// O-tB502
+class TestOnestringSegments_Onestring : public Test
+{
+protected:
+	onestring start = "Cafe\u0301 👨‍👩‍👧 🇫🇷!";
+
+public:
+	TestOnestringSegments_Onestring() {}
+
+	testdoc_t get_title() override
+	{
+		return "Onestring Segments: Grapheme Functions";
+	}
+
+	testdoc_t get_docs() override
+	{
+		return "Test the grapheme-aware length, substr, and reverse functions "
+			   "of onestring.";
+	}
+
+	bool run() override
+	{
+		PL_ASSERT_EQUAL(start.length(), 15u);
+		PL_ASSERT_EQUAL(start.grapheme_length(), 9u);
+
+		PL_ASSERT_EQUAL(start.grapheme_substr(3, 3), "e\u0301 👨‍👩‍👧");
+		PL_ASSERT_EQUAL(start.grapheme_substr(7), "🇫🇷!");
+		PL_ASSERT_EQUAL(start.grapheme_substr(9), "");
+		bool thrown = false;
+		try {
+			start.grapheme_substr(10);
+		} catch (const std::out_of_range&) {
+			thrown = true;
+		}
+		PL_ASSERT_TRUE(thrown);
+
+		onestring test = start;
+		PL_ASSERT_EQUAL(test.grapheme_reverse(), "!🇫🇷 👨‍👩‍👧 e\u0301faC");
+		PL_ASSERT_EQUAL(test.grapheme_reverse(), start);
+
+		test = "";
+		PL_ASSERT_EQUAL(test.grapheme_reverse(), "");
+		PL_ASSERT_EQUAL(test.grapheme_length(), 0u);
+		return true;
+	}
+};
+
+// O-tB503
+class TestOnestringSegments_Words : public Test
+{
+public:
+	TestOnestringSegments_Words() {}
+
+	testdoc_t get_title() override { return "Onestring Segments: Words"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test splitting text into words, and the spaces and punctuation "
+			   "between them.";
+	}
+
+	bool run() override
+	{
+		PL_ASSERT_TRUE(segments_are(onestring("The quick (\"brown\") fox").words(),
+									{"The", " ", "quick", " ", "(", "\"",
+									 "brown", "\"", ")", " ", "fox"}));
+		// Apostrophes and periods within words, and separators within numbers
+		PL_ASSERT_TRUE(segments_are(onestring("can't e.g. 3.14 1,000.5 a1b2").words(),
+									{"can't", " ", "e.g", ".", " ", "3.14", " ",
+									 "1,000.5", " ", "a1b2"}));
+		// Connector punctuation, Katakana, and Hebrew quotes
+		PL_ASSERT_TRUE(segments_are(onestring("snake_case カタカナ צה\"ל").words(),
+									{"snake_case", " ", "カタカナ", " ", "צה\"ל"}));
+		// Accents, emoji sequences, flags, and runs of spaces
+		PL_ASSERT_TRUE(segments_are(onestring("cafe\u0301  👨‍👩‍👧🇺🇸🇫🇷\r\n").words(),
+									{"cafe\u0301", "  ", "👨‍👩‍👧", "🇺🇸", "🇫🇷", "\r\n"}));
+		PL_ASSERT_TRUE(segments_are(onestring("").words(), {}));
+
+		PL_ASSERT_TRUE(onestring_segments::is_word(onestring("can't").view()));
+		PL_ASSERT_TRUE(onestring_segments::is_word(onestring("été").view()));
+		PL_ASSERT_FALSE(onestring_segments::is_word(onestring(" ").view()));
+		PL_ASSERT_FALSE(onestring_segments::is_word(onestring("_").view()));
+		return true;
+	}
+};
+
+// O-tB504
+class TestOnestringSegments_Sentences : public Test
+{
+public:
+	TestOnestringSegments_Sentences() {}
+
+	testdoc_t get_title() override { return "Onestring Segments: Sentences"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test splitting text into sentences.";
+	}
+
+	bool run() override
+	{
+		PL_ASSERT_TRUE(segments_are(onestring("Hi there! How are you? Fine.").sentences(),
+									{"Hi there! ", "How are you? ", "Fine."}));
+		// Abbreviations, decimals, and initials
+		PL_ASSERT_TRUE(segments_are(onestring("See e.g. the U.S.A. list. It costs 3.50 now.").sentences(),
+									{"See e.g. the U.S.A. list. ",
+									 "It costs 3.50 now."}));
+		// Closing punctuation stays with the sentence
+		PL_ASSERT_TRUE(segments_are(onestring("\"Stop.\") Go (now!) ok").sentences(),
+									{"\"Stop.\") ", "Go (now!) ", "ok"}));
+		// Paragraph separators end a sentence
+		PL_ASSERT_TRUE(segments_are(onestring("one\r\ntwo\u2029三。四").sentences(),
+									{"one\r\n", "two\u2029", "三。", "四"}));
+		PL_ASSERT_TRUE(segments_are(onestring("").sentences(), {}));
+		return true;
+	}
+};
+
+class TestSuite_OnestringSegments : public TestSuite
+{
+public:
+	explicit TestSuite_OnestringSegments() {}
+
+	testdoc_t get_title() override { return "Onestring Segments Tests"; }
+
+	void load_tests() override
+	{
+		register_test("O-tB501", new TestOnestringSegments_Graphemes());
+		register_test("O-tB502", new TestOnestringSegments_Onestring());
+		register_test("O-tB503", new TestOnestringSegments_Words());
+		register_test("O-tB504", new TestOnestringSegments_Sentences());
+	}
+};
+
+#endif  // ONESTRING_SEGMENTS_TESTS_HPP
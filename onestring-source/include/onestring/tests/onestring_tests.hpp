@@ -42,9 +42,19 @@
 #ifndef ONESTRING_TESTS_HPP
 #define ONESTRING_TESTS_HPP
 
+#include <algorithm>
+#include <clocale>
+#include <cstring>
+#include <cwchar>
+#include <sstream>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "onestring/onestring.hpp"
+#include "onestring/tests/allocation_counter.hpp"
+#include "onestring/tests/normalization_test_data.hpp"
 
 #include "goldilocks/goldilocks.hpp"
 #include "goldilocks/assertions.hpp"
@@ -656,8 +666,8 @@ public:
 				std::string eq = "🐭abc🐭";
 				std::string lt = "🐭abc🐁";
 				std::string gt = "🐭abc🦊";
-				std::string shorter = "ab";
-				std::string longer = "abcabc";
+				std::string shorter = "🐭ab";
+				std::string longer = "🐭abc🦊🦊";
 
 				test = eq;
 				PL_ASSERT_EQUAL(test.compare(eq.c_str()), 0);
@@ -893,8 +903,8 @@ public:
 				std::string eq = "🐭abc🐭";
 				std::string lt = "🐭abc🐁";
 				std::string gt = "🐭abc🦊";
-				std::string shorter = "ab";
-				std::string longer = "abcabc";
+				std::string shorter = "🐭ab";
+				std::string longer = "🐭abc🦊🦊";
 
 				test = eq;
 				PL_ASSERT_TRUE(test < gt.c_str());
@@ -1103,8 +1113,8 @@ public:
 				std::string eq = "🐭abc🐭";
 				std::string lt = "🐭abc🐁";
 				std::string gt = "🐭abc🦊";
-				std::string shorter = "ab";
-				std::string longer = "abcabc";
+				std::string shorter = "🐭ab";
+				std::string longer = "🐭abc🦊🦊";
 
 				test = eq;
 				PL_ASSERT_TRUE(test <= gt.c_str());
@@ -1312,8 +1322,8 @@ public:
 				std::string eq = "🐭abc🐭";
 				std::string lt = "🐭abc🐁";
 				std::string gt = "🐭abc🦊";
-				std::string shorter = "ab";
-				std::string longer = "abcabc";
+				std::string shorter = "🐭ab";
+				std::string longer = "🐭abc🦊🦊";
 
 				test = eq;
 				PL_ASSERT_TRUE(test > lt.c_str());
@@ -1522,8 +1532,8 @@ public:
 				std::string eq = "🐭abc🐭";
 				std::string lt = "🐭abc🐁";
 				std::string gt = "🐭abc🦊";
-				std::string shorter = "ab";
-				std::string longer = "abcabc";
+				std::string shorter = "🐭ab";
+				std::string longer = "🐭abc🦊🦊";
 
 				test = eq;
 				PL_ASSERT_TRUE(test >= lt.c_str());
@@ -2893,230 +2903,1989 @@ public:
 	}
 };
 
-class TestSuite_Onestring : public TestSuite
+// O-tB242
+class TestOnestring_UTF16 : public Test
 {
+protected:
+	onestring start = "The quick brown 🦊 jumped over the lazy 🐶.";
+	std::u16string result = u"The quick brown 🦊 jumped over the lazy 🐶.";
+
 public:
-	explicit TestSuite_Onestring() {}
+	explicit TestOnestring_UTF16() {}
 
-	testdoc_t get_title() override { return "Onestring Tests"; }
+	testdoc_t get_title() override { return "Onestring: UTF-16"; }
 
-	void load_tests() override
+	testdoc_t get_docs() override
 	{
-		register_test("O-tB201a",
-					  new TestOnestring_Assign(
-						  TestOnestring::TestStringType::CHAR));
-		register_test("O-tB201b",
-					  new TestOnestring_Assign(
-						  TestOnestring::TestStringType::OCHAR_ASCII));
-		register_test("O-tB201c",
-					  new TestOnestring_Assign(
-						  TestOnestring::TestStringType::OCHAR_UNICODE));
-		register_test("O-tB201d",
-					  new TestOnestring_Assign(
-						  TestOnestring::TestStringType::CSTR_ASCII));
-		register_test("O-tB201e",
-					  new TestOnestring_Assign(
-						  TestOnestring::TestStringType::CSTR_UNICODE));
-		register_test("O-tB201f",
-					  new TestOnestring_Assign(
-						  TestOnestring::TestStringType::STR_ASCII));
-		register_test("O-tB201g",
-					  new TestOnestring_Assign(
-						  TestOnestring::TestStringType::STR_UNICODE));
-		register_test("O-tB201h",
-					  new TestOnestring_Assign(
-						  TestOnestring::TestStringType::OSTR_ASCII));
-		register_test("O-tB201i",
-					  new TestOnestring_Assign(
-						  TestOnestring::TestStringType::OSTR_UNICODE));
+		return "Test converting a Onestring to and from UTF-16.";
+	}
 
-		register_test("O-tB202a",
-					  new TestOnestring_Equals(
-						  TestOnestring::TestStringType::CHAR));
-		register_test("O-tB202b",
-					  new TestOnestring_Equals(
-						  TestOnestring::TestStringType::OCHAR_ASCII));
-		register_test("O-tB202c",
-					  new TestOnestring_Equals(
-						  TestOnestring::TestStringType::OCHAR_UNICODE));
-		register_test("O-tB202d",
-					  new TestOnestring_Equals(
-						  TestOnestring::TestStringType::CSTR_ASCII));
-		register_test("O-tB202e",
-					  new TestOnestring_Equals(
-						  TestOnestring::TestStringType::CSTR_UNICODE));
-		register_test("O-tB202f",
-					  new TestOnestring_Equals(
-						  TestOnestring::TestStringType::STR_ASCII));
-		register_test("O-tB202g",
-					  new TestOnestring_Equals(
-						  TestOnestring::TestStringType::STR_UNICODE));
-		register_test("O-tB202h",
-					  new TestOnestring_Equals(
-						  TestOnestring::TestStringType::OSTR_ASCII));
-		register_test("O-tB202i",
-					  new TestOnestring_Equals(
-						  TestOnestring::TestStringType::OSTR_UNICODE));
+	bool run() override
+	{
+		// std::u16string and char16_t* to onestring
+		onestring test = result;
+		PL_ASSERT_EQUAL(test, start);
+		PL_ASSERT_EQUAL(test.length(), 41u);
+		test = u"⛰ Matterhorn";
+		PL_ASSERT_EQUAL(test, "⛰ Matterhorn");
+		test.append(u"🐭", 2);
+		PL_ASSERT_EQUAL(test, "⛰ Matterhorn🐭🐭");
+
+		// onestring to std::u16string
+		PL_ASSERT_TRUE(start.to_u16string() == result);
+		PL_ASSERT_TRUE(static_cast<std::u16string>(start) == result);
+		PL_ASSERT_TRUE(start == result);
+
+		// Unpaired surrogates are replaced with U+FFFD.
+		const char16_t unpaired[] = {u'a', 0xD83E, u'b', 0xDD8A, 0};
+		test = unpaired;
+		PL_ASSERT_EQUAL(test, "a\uFFFDb\uFFFD");
+		return true;
+	}
+};
 
-		register_test("O-tB203a",
-					  new TestOnestring_OpEquals(
-						  TestOnestring::TestStringType::CHAR));
-		register_test("O-tB203b",
-					  new TestOnestring_OpEquals(
-						  TestOnestring::TestStringType::OCHAR_ASCII));
-		register_test("O-tB203c",
-					  new TestOnestring_OpEquals(
-						  TestOnestring::TestStringType::OCHAR_UNICODE));
-		register_test("O-tB203d",
-					  new TestOnestring_OpEquals(
-						  TestOnestring::TestStringType::CSTR_ASCII));
-		register_test("O-tB203e",
-					  new TestOnestring_OpEquals(
-						  TestOnestring::TestStringType::CSTR_UNICODE));
-		register_test("O-tB203f",
-					  new TestOnestring_OpEquals(
-						  TestOnestring::TestStringType::STR_ASCII));
-		register_test("O-tB203g",
-					  new TestOnestring_OpEquals(
-						  TestOnestring::TestStringType::STR_UNICODE));
-		register_test("O-tB203h",
-					  new TestOnestring_OpEquals(
-						  TestOnestring::TestStringType::OSTR_ASCII));
-		register_test("O-tB203i",
-					  new TestOnestring_OpEquals(
-						  TestOnestring::TestStringType::OSTR_UNICODE));
+// O-tB243
+class TestOnestring_UTF32 : public Test
+{
+protected:
+	onestring start = "The quick brown 🦊 jumped over the lazy 🐶.";
+	std::u32string result = U"The quick brown 🦊 jumped over the lazy 🐶.";
 
-		register_test("O-tB204a",
-					  new TestOnestring_OpNotEquals(
-						  TestOnestring::TestStringType::CHAR));
-		register_test("O-tB204b",
-					  new TestOnestring_OpNotEquals(
-						  TestOnestring::TestStringType::OCHAR_ASCII));
-		register_test("O-tB204c",
-					  new TestOnestring_OpNotEquals(
-						  TestOnestring::TestStringType::OCHAR_UNICODE));
-		register_test("O-tB204d",
-					  new TestOnestring_OpNotEquals(
-						  TestOnestring::TestStringType::CSTR_ASCII));
-		register_test("O-tB204e",
-					  new TestOnestring_OpNotEquals(
-						  TestOnestring::TestStringType::CSTR_UNICODE));
-		register_test("O-tB204f",
-					  new TestOnestring_OpNotEquals(
-						  TestOnestring::TestStringType::STR_ASCII));
-		register_test("O-tB204g",
-					  new TestOnestring_OpNotEquals(
-						  TestOnestring::TestStringType::STR_UNICODE));
-		register_test("O-tB204h",
-					  new TestOnestring_OpNotEquals(
-						  TestOnestring::TestStringType::OSTR_ASCII));
-		register_test("O-tB204i",
-					  new TestOnestring_OpNotEquals(
-						  TestOnestring::TestStringType::OSTR_UNICODE));
+public:
+	explicit TestOnestring_UTF32() {}
 
-		register_test("O-tB205a",
-					  new TestOnestring_Compare(
-						  TestOnestring::TestStringType::CHAR));
-		register_test("O-tB205b",
-					  new TestOnestring_Compare(
-						  TestOnestring::TestStringType::OCHAR_ASCII));
-		register_test("O-tB205c",
-					  new TestOnestring_Compare(
-						  TestOnestring::TestStringType::OCHAR_UNICODE));
-		register_test("O-tB205d",
-					  new TestOnestring_Compare(
-						  TestOnestring::TestStringType::CSTR_ASCII));
-		register_test("O-tB205e",
-					  new TestOnestring_Compare(
-						  TestOnestring::TestStringType::CSTR_UNICODE));
-		register_test("O-tB205f",
-					  new TestOnestring_Compare(
-						  TestOnestring::TestStringType::STR_ASCII));
-		register_test("O-tB205g",
-					  new TestOnestring_Compare(
-						  TestOnestring::TestStringType::STR_UNICODE));
-		register_test("O-tB205h",
-					  new TestOnestring_Compare(
-						  TestOnestring::TestStringType::OSTR_ASCII));
-		register_test("O-tB205i",
-					  new TestOnestring_Compare(
-						  TestOnestring::TestStringType::OSTR_UNICODE));
+	testdoc_t get_title() override { return "Onestring: UTF-32"; }
 
-		register_test("O-tB206a",
-					  new TestOnestring_OpLess(
-						  TestOnestring::TestStringType::CHAR));
-		register_test("O-tB206b",
-					  new TestOnestring_OpLess(
-						  TestOnestring::TestStringType::OCHAR_ASCII));
-		register_test("O-tB206c",
-					  new TestOnestring_OpLess(
-						  TestOnestring::TestStringType::OCHAR_UNICODE));
-		register_test("O-tB206d",
-					  new TestOnestring_OpLess(
-						  TestOnestring::TestStringType::CSTR_ASCII));
-		register_test("O-tB206e",
-					  new TestOnestring_OpLess(
-						  TestOnestring::TestStringType::CSTR_UNICODE));
-		register_test("O-tB206f",
-					  new TestOnestring_OpLess(
-						  TestOnestring::TestStringType::STR_ASCII));
-		register_test("O-tB206g",
-					  new TestOnestring_OpLess(
-						  TestOnestring::TestStringType::STR_UNICODE));
-		register_test("O-tB206h",
-					  new TestOnestring_OpLess(
-						  TestOnestring::TestStringType::OSTR_ASCII));
-		register_test("O-tB206i",
-					  new TestOnestring_OpLess(
-						  TestOnestring::TestStringType::OSTR_UNICODE));
+	testdoc_t get_docs() override
+	{
+		return "Test converting a Onestring to and from UTF-32.";
+	}
 
-		register_test("O-tB207a",
-					  new TestOnestring_OpLessEqual(
-						  TestOnestring::TestStringType::CHAR));
-		register_test("O-tB207b",
-					  new TestOnestring_OpLessEqual(
-						  TestOnestring::TestStringType::OCHAR_ASCII));
-		register_test("O-tB207c",
-					  new TestOnestring_OpLessEqual(
-						  TestOnestring::TestStringType::OCHAR_UNICODE));
-		register_test("O-tB207d",
-					  new TestOnestring_OpLessEqual(
-						  TestOnestring::TestStringType::CSTR_ASCII));
-		register_test("O-tB207e",
-					  new TestOnestring_OpLessEqual(
-						  TestOnestring::TestStringType::CSTR_UNICODE));
-		register_test("O-tB207f",
-					  new TestOnestring_OpLessEqual(
-						  TestOnestring::TestStringType::STR_ASCII));
-		register_test("O-tB207g",
-					  new TestOnestring_OpLessEqual(
-						  TestOnestring::TestStringType::STR_UNICODE));
-		register_test("O-tB207h",
-					  new TestOnestring_OpLessEqual(
-						  TestOnestring::TestStringType::OSTR_ASCII));
-		register_test("O-tB207i",
-					  new TestOnestring_OpLessEqual(
-						  TestOnestring::TestStringType::OSTR_UNICODE));
+	bool run() override
+	{
+		// std::u32string and char32_t* to onestring
+		onestring test = result;
+		PL_ASSERT_EQUAL(test, start);
+		test = U"©‽";
+		PL_ASSERT_EQUAL(test, "©‽");
+		test += U"🐭";
+		PL_ASSERT_EQUAL(test, "©‽🐭");
+
+		// onestring to std::u32string
+		PL_ASSERT_TRUE(start.to_u32string() == result);
+		PL_ASSERT_TRUE(static_cast<std::u32string>(start) == result);
+		PL_ASSERT_EQUAL(start.compare(result), 0);
+
+		// Surrogates and values above U+10FFFF are replaced with U+FFFD.
+		const char32_t invalid[] = {U'a', 0xD800, 0x110000, 0};
+		test = invalid;
+		PL_ASSERT_EQUAL(test, "a\uFFFD\uFFFD");
+		return true;
+	}
+};
 
-		register_test("O-tB208a",
-					  new TestOnestring_OpGreater(
-						  TestOnestring::TestStringType::CHAR));
-		register_test("O-tB208b",
-					  new TestOnestring_OpGreater(
-						  TestOnestring::TestStringType::OCHAR_ASCII));
-		register_test("O-tB208c",
-					  new TestOnestring_OpGreater(
-						  TestOnestring::TestStringType::OCHAR_UNICODE));
-		register_test("O-tB208d",
-					  new TestOnestring_OpGreater(
-						  TestOnestring::TestStringType::CSTR_ASCII));
-		register_test("O-tB208e",
-					  new TestOnestring_OpGreater(
-						  TestOnestring::TestStringType::CSTR_UNICODE));
-		register_test("O-tB208f",
-					  new TestOnestring_OpGreater(
-						  TestOnestring::TestStringType::STR_ASCII));
-		register_test("O-tB208g",
+// O-tB244
+class TestOnestring_Policy : public Test
+{
+protected:
+	// "M", a stray continuation byte, "©", an overlong "/", and a cut-off "‽"
+	const char* malformed = "M\x80©\xC0\xAF\xE2\x80";
+	const char* wellformed = "The quick brown 🦊 jumped over the lazy 🐶.";
+
+public:
+	explicit TestOnestring_Policy() {}
+
+	testdoc_t get_title() override { return "Onestring: Malformed Policies"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test the TRUSTED, REPLACE, and STRICT policies for "
+			   "malformed UTF-8 input.";
+	}
+
+	bool run() override
+	{
+		PL_ASSERT_EQUAL(onestring::validate(wellformed), onestring::npos);
+		PL_ASSERT_EQUAL(onestring::validate(malformed), 1u);
+
+		onestring test;
+		test.assign<onestring_policy::TRUSTED>(wellformed);
+		PL_ASSERT_EQUAL(test, wellformed);
+
+		test.assign<onestring_policy::REPLACE>(malformed);
+		PL_ASSERT_EQUAL(test, "M\uFFFD©\uFFFD\uFFFD\uFFFD");
+		test.append<onestring_policy::REPLACE>(wellformed);
+		PL_ASSERT_EQUAL(test.length(), 47u);
+
+		test = "unchanged";
+		bool thrown = false;
+		try {
+			test.assign<onestring_policy::STRICT>(malformed);
+		} catch (const std::invalid_argument&) {
+			thrown = true;
+		}
+		PL_ASSERT_TRUE(thrown);
+		PL_ASSERT_EQUAL(test, "unchanged");
+
+		test.assign<onestring_policy::STRICT>(wellformed);
+		PL_ASSERT_EQUAL(test, wellformed);
+		return true;
+	}
+};
+
+// O-tB245
+class TestOnestring_Codepoints : public Test
+{
+protected:
+	const char32_t codepoints[6] = {U'M', 0xA9, 0x203D, 0x1F42D, 0xD800, U'!'};
+
+public:
+	explicit TestOnestring_Codepoints() {}
+
+	testdoc_t get_title() override { return "Onestring: Code Point Buffers"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test appending, assigning, and copying code point buffers.";
+	}
+
+	bool run() override
+	{
+		onestring test;
+		test.assign_codepoints(codepoints, 6);
+		PL_ASSERT_EQUAL(test, "M©‽🐭\uFFFD!");
+		test.append_codepoints(codepoints, 2);
+		PL_ASSERT_EQUAL(test, "M©‽🐭\uFFFD!M©");
+
+		char32_t buffer[8] = {0};
+		PL_ASSERT_EQUAL(test.copy_codepoints(buffer, 8), 8u);
+		PL_ASSERT_EQUAL(buffer[3], U'\U0001F42D');
+		PL_ASSERT_EQUAL(buffer[4], U'\uFFFD');
+		PL_ASSERT_EQUAL(buffer[7], U'\u00A9');
+
+		// Limited by the buffer, then by the requested length
+		PL_ASSERT_EQUAL(test.copy_codepoints(buffer, 2, 0, 2), 2u);
+		PL_ASSERT_EQUAL(buffer[0], U'\u203D');
+		PL_ASSERT_EQUAL(buffer[1], U'\U0001F42D');
+		PL_ASSERT_EQUAL(test.copy_codepoints(buffer, 8, 1, 5), 1u);
+		PL_ASSERT_EQUAL(buffer[0], U'!');
+		PL_ASSERT_EQUAL(test.copy_codepoints(buffer, 8, 0, 8), 0u);
+		return true;
+	}
+};
+
+// O-tB246
+class TestOnestring_Case : public Test
+{
+public:
+	explicit TestOnestring_Case() {}
+
+	testdoc_t get_title() override { return "Onestring: Case Mapping"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test to_lower() and to_upper(), including mappings that "
+			   "change the length of the string.";
+	}
+
+	bool run() override
+	{
+		onestring test = "The Quick Brown 🦊 Jumped!";
+		PL_ASSERT_EQUAL(test.to_lower(), "the quick brown 🦊 jumped!");
+		PL_ASSERT_EQUAL(test.to_upper(), "THE QUICK BROWN 🦊 JUMPED!");
+
+		test = "Größe ΣΊΣΥΦΟΣ";
+		PL_ASSERT_EQUAL(test.to_upper(), "GRÖSSE ΣΊΣΥΦΟΣ");
+		PL_ASSERT_EQUAL(test.length(), 14u);
+		// Only the sigma that ends the word becomes a final sigma.
+		PL_ASSERT_EQUAL(test.to_lower(), "grösse σίσυφος");
+
+		// The apostrophe is case-ignorable, so it does not end the word.
+		test = "ΑΣ. Σ ΑΣ'Σ";
+		PL_ASSERT_EQUAL(test.to_lower(), "ας. σ ασ'ς");
+
+		// İ lowercases to two code points in the middle of a string.
+		test = "İSTANBUL";
+		PL_ASSERT_EQUAL(test.to_lower(), "i\u0307stanbul");
+		PL_ASSERT_EQUAL(test.length(), 9u);
+
+		test = "ﬃ ŉ";
+		PL_ASSERT_EQUAL(test.to_upper(), "FFI ʼN");
+
+		test = "";
+		PL_ASSERT_EQUAL(test.to_upper(), "");
+		return true;
+	}
+};
+
+// O-tB247
+class TestOnestring_Normalize : public Test
+{
+public:
+	explicit TestOnestring_Normalize() {}
+
+	testdoc_t get_title() override { return "Onestring: Normalize"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test converting to each normalization form, and checking "
+			   "whether a onestring is already in one.";
+	}
+
+	bool run() override
+	{
+		onestring composed = "Crème brûlée 🐭";
+		onestring decomposed = "Cre\u0300me bru\u0302le\u0301e 🐭";
+		PL_ASSERT_NOT_EQUAL(composed, decomposed);
+		PL_ASSERT_TRUE(composed.is_normalized());
+		PL_ASSERT_FALSE(decomposed.is_normalized());
+		PL_ASSERT_FALSE(composed.is_normalized(onestring_form::NFD));
+		PL_ASSERT_TRUE(decomposed.is_normalized(onestring_form::NFD));
+
+		onestring test = decomposed;
+		PL_ASSERT_EQUAL(test.normalize(), composed);
+		PL_ASSERT_EQUAL(test.normalize(onestring_form::NFD), decomposed);
+
+		// Combining marks are put in canonical order.
+		test = "q\u0307\u0323";
+		PL_ASSERT_EQUAL(test.normalize(onestring_form::NFD), "q\u0323\u0307");
+		PL_ASSERT_FALSE(onestring("q\u0307\u0323").is_normalized());
+
+		// Hangul syllables compose algorithmically.
+		test = "\u1100\u1161\u11A8";
+		PL_ASSERT_EQUAL(test.normalize(), "\uAC01");
+		PL_ASSERT_EQUAL(test.normalize(onestring_form::NFD), "\u1100\u1161\u11A8");
+
+		// Compatibility forms fold ligatures and width variants.
+		test = "ﬁ ｶﾞ";
+		PL_ASSERT_TRUE(test.is_normalized());
+		PL_ASSERT_FALSE(test.is_normalized(onestring_form::NFKC));
+		PL_ASSERT_EQUAL(test.normalize(onestring_form::NFKC), "fi ガ");
+		PL_ASSERT_EQUAL(test.normalize(onestring_form::NFKD), "fi \u30AB\u3099");
+
+		test = "";
+		PL_ASSERT_EQUAL(test.normalize(), "");
+		return true;
+	}
+};
+
+// O-tB248
+class TestOnestring_NormalizeConformance : public Test
+{
+protected:
+	const onestring_form forms[4] = {onestring_form::NFC,
+									 onestring_form::NFD,
+									 onestring_form::NFKC,
+									 onestring_form::NFKD};
+
+public:
+	explicit TestOnestring_NormalizeConformance() {}
+
+	testdoc_t get_title() override
+	{
+		return "Onestring: Normalization Conformance";
+	}
+
+	testdoc_t get_docs() override
+	{
+		return "Test every normalization form against the conformance data, "
+			   "and test that every other code point is unchanged.";
+	}
+
+	bool run() override
+	{
+		// The expected form of each column, for each form.
+		const size_t expected[4][5] = {
+			{1, 1, 1, 3, 3}, {2, 2, 2, 4, 4}, {3, 3, 3, 3, 3}, {4, 4, 4, 4, 4}};
+
+		std::vector<bool> listed(0x110000, false);
+		for (const auto& row : NORMALIZATION_TESTS) {
+			if (std::char_traits<char32_t>::length(row[0]) == 1) {
+				listed[row[0][0]] = true;
+			}
+
+			for (size_t f = 0; f < 4; ++f) {
+				for (size_t c = 0; c < 5; ++c) {
+					onestring test = row[c];
+					PL_ASSERT_EQUAL(test.is_normalized(forms[f]),
+									test == row[expected[f][c]]);
+					PL_ASSERT_EQUAL(test.normalize(forms[f]),
+									onestring(row[expected[f][c]]));
+				}
+			}
+		}
+
+		for (char32_t cp = 0; cp <= 0x10FFFF; ++cp) {
+			if (listed[cp] || !onechar::isCodepoint(cp) ||
+				(cp >= 0xAC00 && cp <= 0xD7A3)) {
+				continue;
+			}
+
+			onestring test;
+			test.assign_codepoints(&cp, 1);
+			for (size_t f = 0; f < 4; ++f) {
+				PL_ASSERT_TRUE(test.is_normalized(forms[f]));
+			}
+		}
+		return true;
+	}
+};
+
+// O-tB249
+class TestOnestring_CaseFold : public Test
+{
+public:
+	explicit TestOnestring_CaseFold() {}
+
+	testdoc_t get_title() override
+	{
+		return "Onestring: Case-Insensitive Comparison";
+	}
+
+	testdoc_t get_docs() override
+	{
+		return "Test fold_case(), compare_icase(), equals_icase(), and "
+			   "hash_icase().";
+	}
+
+	bool run() override
+	{
+		onestring test = "Straße ΣΊΣΥΦΟΣ";
+		PL_ASSERT_EQUAL(test.fold_case(), "strasse σίσυφοσ");
+		PL_ASSERT_EQUAL(test.length(), 15u);
+
+		onestring street = "Straße";
+		PL_ASSERT_TRUE(street.equals_icase(onestring("STRASSE")));
+		PL_ASSERT_TRUE(street.equals_icase("strasse"));
+		PL_ASSERT_TRUE(street.equals_icase(std::string("sTrAßE")));
+		PL_ASSERT_TRUE(street.equals_icase(onestring("Die Straße").view(4)));
+		PL_ASSERT_FALSE(street.equals_icase("strass"));
+		PL_ASSERT_FALSE(street.equals_icase("strasses"));
+
+		onestring word = "HeLLo 🐭";
+		PL_ASSERT_TRUE(word.equals_icase(onestring("hello 🐭")));
+		PL_ASSERT_FALSE(word.equals_icase(onestring("hellO 🐮")));
+		// The Kelvin sign folds to "k", and long s folds to "s".
+		PL_ASSERT_TRUE(onestring("\u212Aiss").equals_icase("kiſs"));
+
+		PL_ASSERT_EQUAL(street.compare_icase("STRASSE"), 0);
+		PL_ASSERT_LESS(street.compare_icase("STRASSEN"), 0);
+		PL_ASSERT_GREATER(street.compare_icase("STRASS"), 0);
+		PL_ASSERT_LESS(onestring("apple").compare_icase(onestring("Banana")), 0);
+		PL_ASSERT_GREATER(onestring("Zebra").compare_icase("apple"), 0);
+		PL_ASSERT_EQUAL(onestring("").compare_icase(""), 0);
+
+		PL_ASSERT_EQUAL(street.hash_icase(), onestring("STRASSE").hash_icase());
+		PL_ASSERT_EQUAL(onestring("ΣΊΣΥΦΟΣ").hash_icase(),
+						onestring("σίσυφος").hash_icase());
+
+		std::unordered_set<onestring, onestring_icase_hash, onestring_icase_equal>
+			keys = {"Straße", "Hello"};
+		PL_ASSERT_EQUAL(keys.size(), 2u);
+		PL_ASSERT_EQUAL(keys.count("STRASSE"), 1u);
+		PL_ASSERT_EQUAL(keys.count("HELLO"), 1u);
+		PL_ASSERT_EQUAL(keys.count("Goodbye"), 0u);
+		return true;
+	}
+};
+
+// O-tB250
+class TestOnestring_Classify : public Test
+{
+public:
+	explicit TestOnestring_Classify() {}
+
+	testdoc_t get_title() override { return "Onestring: Classify"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test classify(), and that operator>> splits words at Unicode "
+			   "whitespace.";
+	}
+
+	bool run() override
+	{
+		onestring test = "Año 2024: ½ Ⅻ\u3000🐭!";
+		PL_ASSERT_EQUAL(test.classify(onestring_class::LETTER)[0], 0x7ull);
+		PL_ASSERT_EQUAL(test.classify(onestring_class::DIGIT)[0], 0xF0ull);
+		PL_ASSERT_EQUAL(test.classify(onestring_class::NUMERIC)[0], 0x14F0ull);
+		PL_ASSERT_EQUAL(test.classify(onestring_class::ALPHABETIC)[0], 0x1007ull);
+		PL_ASSERT_EQUAL(test.classify(onestring_class::WHITESPACE)[0], 0x2A08ull);
+		PL_ASSERT_EQUAL(test.classify(onestring_class::PUNCTUATION)[0], 0x8100ull);
+
+		// More than one word of bits
+		test = "";
+		test.append("a", 70);
+		test[64] = "1";
+		test[69] = "٣";
+		std::vector<uint64_t> digits = test.classify(onestring_class::DIGIT);
+		PL_ASSERT_EQUAL(digits.size(), 2u);
+		PL_ASSERT_EQUAL(digits[0], 0ull);
+		PL_ASSERT_EQUAL(digits[1], 0x21ull);
+
+		PL_ASSERT_EQUAL(onestring().classify(onestring_class::LETTER).size(), 0u);
+
+		std::istringstream input("Größe\u3000naïve\u2003🐭 end");
+		onestring word;
+		input >> word;
+		PL_ASSERT_EQUAL(word, "Größe");
+		input >> word;
+		PL_ASSERT_EQUAL(word, "naïve");
+		input >> word;
+		PL_ASSERT_EQUAL(word, "🐭");
+		input >> word;
+		PL_ASSERT_EQUAL(word, "end");
+		return true;
+	}
+};
+
+// O-tB251
+class TestOnestring_DisplayWidth : public Test
+{
+public:
+	explicit TestOnestring_DisplayWidth() {}
+
+	testdoc_t get_title() override { return "Onestring: Display Width"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test display_width() and truncate_width() with wide, "
+			   "combining, and emoji characters.";
+	}
+
+	bool run() override
+	{
+		PL_ASSERT_EQUAL(onestring("hello").display_width(), 5u);
+		PL_ASSERT_EQUAL(onestring("日本語").display_width(), 6u);
+		PL_ASSERT_EQUAL(onestring("ＡＢ").display_width(), 4u);
+		PL_ASSERT_EQUAL(onestring("e\u0301").display_width(), 1u);
+		PL_ASSERT_EQUAL(onestring("a\tb\n").display_width(), 2u);
+		// Hangul syllables, decomposed into jamo, are still 2 columns.
+		PL_ASSERT_EQUAL(onestring("\u1100\u1161\u11A8").display_width(), 2u);
+		PL_ASSERT_EQUAL(onestring().display_width(), 0u);
+
+		// Emoji sequences are one emoji wide.
+		PL_ASSERT_EQUAL(onestring("🐭").display_width(), 2u);
+		PL_ASSERT_EQUAL(onestring("👋🏽").display_width(), 2u);
+		PL_ASSERT_EQUAL(onestring("👨‍👩‍👧").display_width(), 2u);
+		PL_ASSERT_EQUAL(onestring("🇯🇵🇺🇦").display_width(), 4u);
+		// Variation selectors choose emoji or text presentation.
+		PL_ASSERT_EQUAL(onestring("©").display_width(), 1u);
+		PL_ASSERT_EQUAL(onestring("©\uFE0F").display_width(), 2u);
+		PL_ASSERT_EQUAL(onestring("😀\uFE0E").display_width(), 1u);
+		PL_ASSERT_EQUAL(onestring("1\uFE0F\u20E3").display_width(), 2u);
+
+		onestring test = "ab日本語";
+		PL_ASSERT_EQUAL(test.view(1, 2).display_width(), 3u);
+		test.truncate_width(5);
+		PL_ASSERT_EQUAL(test, "ab日");
+		// A cluster that does not fit is removed whole.
+		test = "née👨‍👩‍👧!";
+		test.truncate_width(4);
+		PL_ASSERT_EQUAL(test, "née");
+		test = "née👨‍👩‍👧!";
+		test.truncate_width(5);
+		PL_ASSERT_EQUAL(test, "née👨‍👩‍👧");
+		test.truncate_width(100);
+		PL_ASSERT_EQUAL(test, "née👨‍👩‍👧");
+		test.truncate_width(0);
+		PL_ASSERT_EQUAL(test, "");
+		return true;
+	}
+};
+
+/** Builds the corpus for a benchmark from samples picked in a fixed linear
+ * congruential sequence, so that runs are comparable.
+ * \param the samples to pick from
+ * \param the size to build the corpus up to, in whatever unit the
+ * function adding a sample counts
+ * \param the function to add a sample to the corpus, called with the
+ * sample and its index, which returns the size of the corpus so far */
+template<typename Sample, size_t N, typename Append>
+void build_corpus(const Sample (&samples)[N], size_t target, Append append)
+{
+	uint32_t seed = 12345;
+	size_t size = 0;
+	while (size < target) {
+		seed = seed * 1103515245 + 12345;
+		size_t index = (seed >> 16) % N;
+		size = append(samples[index], index);
+	}
+}
+
+/* Mixed Latin, Cyrillic, CJK, Hangul, Arabic, and emoji text, as a terminal
+ * table might hold. */
+class TestOnestring_WidthCorpus : public Test
+{
+protected:
+	onestring corpus;
+	size_t expected = 0;
+
+public:
+	TestOnestring_WidthCorpus() {}
+
+	bool pre() override
+	{
+		struct sample
+		{
+			const char* text;
+			size_t width;
+		};
+		const sample samples[] = {{"hello ", 6},  {"Привет ", 7},
+								  {"日本語", 6},  {"한국어 ", 7},
+								  {"مرحبا ", 6},  {"café ", 5},
+								  {"e\u0301", 1}, {"👋🏽", 2},
+								  {"👨‍👩‍👧", 2},    {"🇯🇵", 2}};
+		corpus.clear();
+		expected = 0;
+		build_corpus(samples, 65536, [this](const sample& next, size_t) {
+			corpus.append(next.text);
+			expected += next.width;
+			return corpus.length();
+		});
+		return true;
+	}
+
+	virtual testdoc_t get_title() override = 0;
+	virtual testdoc_t get_docs() override = 0;
+};
+
+// O-tP201
+class TestOnestring_DisplayWidthMixed : public TestOnestring_WidthCorpus
+{
+public:
+	TestOnestring_DisplayWidthMixed() {}
+
+	testdoc_t get_title() override
+	{
+		return "Onestring: Display Width (Mixed Script)";
+	}
+
+	testdoc_t get_docs() override
+	{
+		return "Measure mixed-script text with onestring::display_width().";
+	}
+
+	bool run() override
+	{
+		PL_ASSERT_EQUAL(corpus.display_width(), expected);
+		return true;
+	}
+};
+
+// O-tP201 (comparative)
+class TestOnestring_DisplayWidthMixedWcwidth : public TestOnestring_WidthCorpus
+{
+	/// The locale to restore after the test.
+	std::string locale;
+
+public:
+	TestOnestring_DisplayWidthMixedWcwidth() {}
+
+	testdoc_t get_title() override
+	{
+		return "Onestring: Display Width (Mixed Script, wcwidth)";
+	}
+
+	testdoc_t get_docs() override
+	{
+		return "Measure mixed-script text by calling wcwidth() on each "
+			   "character.";
+	}
+
+	bool pre() override
+	{
+		locale = setlocale(LC_CTYPE, nullptr);
+		setlocale(LC_CTYPE, "C.UTF-8");
+		return TestOnestring_WidthCorpus::pre();
+	}
+
+	bool run() override
+	{
+		size_t width = 0;
+		for (size_t i = 0; i < corpus.length(); ++i) {
+			int columns = wcwidth(static_cast<wchar_t>(corpus[i].codepoint()));
+			width += (columns > 0) ? columns : 0;
+		}
+		// wcwidth() counts every part of an emoji sequence.
+		PL_ASSERT_GREATER(width, expected);
+		return true;
+	}
+
+	bool post() override
+	{
+		setlocale(LC_CTYPE, locale.c_str());
+		return true;
+	}
+};
+
+// O-tB252
+class TestOnestring_CompareOrder : public Test
+{
+public:
+	explicit TestOnestring_CompareOrder() {}
+
+	testdoc_t get_title() override { return "Onestring: Compare Order"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test that compare() orders strings lexicographically by code "
+			   "point, the same as std::string orders their UTF-8 bytes.";
+	}
+
+	static int sign(int r) { return (r > 0) - (r < 0); }
+
+	bool run() override
+	{
+		// A shorter string can sort after a longer one.
+		PL_ASSERT_GREATER(onestring("b").compare(onestring("aa")), 0);
+		PL_ASSERT_LESS(onestring("aa").compare("b"), 0);
+		PL_ASSERT_TRUE(onestring("ab") < onestring("b"));
+		PL_ASSERT_GREATER(onestring("ab").compare('a'), 0);
+		PL_ASSERT_LESS(onestring("ab").compare('b'), 0);
+		PL_ASSERT_LESS(onestring().compare('a'), 0);
+		PL_ASSERT_GREATER(onestring("🐭a").compare(onechar("🐁")), 0);
+		// A prefix sorts first.
+		PL_ASSERT_LESS(onestring("🐭ab").compare("🐭abc"), 0);
+		PL_ASSERT_GREATER(onestring("🐭abc").compare("🐭ab"), 0);
+		PL_ASSERT_EQUAL(onestring().compare(""), 0);
+
+		const char* samples[] = {"", "a", "aa", "ab", "b", "z",
+								 "A", "\x7F", "é", "éa", "ea", "ÿ",
+								 "Ā", "日", "日本", "🐭", "🐁", "a🐭"};
+		for (const char* lhs : samples) {
+			for (const char* rhs : samples) {
+				int expected = sign(std::string(lhs).compare(rhs));
+				PL_ASSERT_EQUAL(sign(onestring(lhs).compare(onestring(rhs))),
+								expected);
+				PL_ASSERT_EQUAL(sign(onestring(lhs).compare(rhs)), expected);
+				PL_ASSERT_EQUAL(sign(onestring(lhs).compare(std::string(rhs))),
+								expected);
+			}
+		}
+		return true;
+	}
+};
+
+// O-tB253
+class TestOnestring_EqualsLength : public Test
+{
+public:
+	explicit TestOnestring_EqualsLength() {}
+
+	testdoc_t get_title() override
+	{
+		return "Onestring: Equals and Compare (Length)";
+	}
+
+	testdoc_t get_docs() override
+	{
+		return "Test equals() and compare() against strings of known length, "
+			   "and against std::string_view.";
+	}
+
+	bool run() override
+	{
+		onestring test = "🐭abc日";
+		const char* text = "🐭abc日本";
+		PL_ASSERT_TRUE(test.equals(text, 10));
+		PL_ASSERT_FALSE(test.equals(text, 9));
+		PL_ASSERT_FALSE(test.equals(text, 13));
+		PL_ASSERT_EQUAL(test.compare(text, 10), 0);
+		// Ending partway through a character is a shorter string.
+		PL_ASSERT_GREATER(test.compare(text, 9), 0);
+		PL_ASSERT_LESS(test.compare(text, 13), 0);
+		PL_ASSERT_LESS(test.compare("🐭b", 5), 0);
+		PL_ASSERT_TRUE(onestring().equals(text, 0));
+		PL_ASSERT_EQUAL(onestring().compare(text, 0), 0);
+
+		// The string need not end at a null terminator, or at all.
+		const char unterminated[] = {'a', 'b', 'c'};
+		PL_ASSERT_TRUE(onestring("abc").equals(unterminated, 3));
+		PL_ASSERT_TRUE(onestring("ab").equals(unterminated, 2));
+		PL_ASSERT_FALSE(onestring("abcd").equals(unterminated, 3));
+
+		// Strings with an embedded null are compared in full.
+		std::string nulled("a\0b", 3);
+		onestring ostr_nulled = "a";
+		ostr_nulled.append('\0');
+		ostr_nulled.append('b');
+		PL_ASSERT_EQUAL(ostr_nulled.length(), 3u);
+		PL_ASSERT_TRUE(ostr_nulled == nulled);
+		PL_ASSERT_EQUAL(ostr_nulled.compare(nulled), 0);
+		PL_ASSERT_FALSE(ostr_nulled == "a");
+		PL_ASSERT_GREATER(ostr_nulled.compare("a"), 0);
+		PL_ASSERT_FALSE(onestring("a") == nulled);
+
+		std::string_view view = "🐭abc日本";
+		PL_ASSERT_TRUE(test == view.substr(0, 10));
+		PL_ASSERT_TRUE(view.substr(0, 10) == test);
+		PL_ASSERT_TRUE(test != view);
+		PL_ASSERT_TRUE(view != test);
+		PL_ASSERT_LESS(test.compare(view), 0);
+		PL_ASSERT_TRUE(test.equals(view.substr(0, 10)));
+		return true;
+	}
+};
+
+/* Commands as a dispatcher might receive them, to be matched against
+ * string literals. */
+class TestOnestring_DispatchCorpus : public Test
+{
+protected:
+	std::vector<onestring> commands;
+	std::vector<std::string> std_commands;
+	size_t expected = 0;
+
+public:
+	TestOnestring_DispatchCorpus() {}
+
+	bool pre() override
+	{
+		const char* samples[] = {"get", "set",	  "delete", "list",
+								 "déjà", "über", "日本語", "🐭"};
+		commands.clear();
+		std_commands.clear();
+		expected = 0;
+		build_corpus(samples, 4096, [this](const char* next, size_t) {
+			commands.push_back(onestring(next));
+			std_commands.push_back(std::string(next));
+			expected += dispatch(next);
+			return commands.size();
+		});
+		return true;
+	}
+
+	/// Match a command the way the tests do, to find the expected result.
+	static size_t dispatch(const std::string& command)
+	{
+		if (command == "delete") {
+			return 1;
+		} else if (command == "déjà") {
+			return 2;
+		} else if (command == "日本語") {
+			return 3;
+		}
+		return 0;
+	}
+
+	virtual testdoc_t get_title() override = 0;
+	virtual testdoc_t get_docs() override = 0;
+};
+
+// O-tP202
+class TestOnestring_EqualsLiteral : public TestOnestring_DispatchCorpus
+{
+public:
+	TestOnestring_EqualsLiteral() {}
+
+	testdoc_t get_title() override
+	{
+		return "Onestring: Equals (Literal Dispatch)";
+	}
+
+	testdoc_t get_docs() override
+	{
+		return "Match onestring commands against string literals with ==.";
+	}
+
+	bool run() override
+	{
+		size_t total = 0;
+		for (const onestring& command : commands) {
+			if (command == "delete") {
+				total += 1;
+			} else if (command == "déjà") {
+				total += 2;
+			} else if (command == "日本語") {
+				total += 3;
+			}
+		}
+		PL_ASSERT_EQUAL(total, expected);
+		return true;
+	}
+};
+
+// O-tP202 (comparative)
+class TestOnestring_EqualsLiteralStd : public TestOnestring_DispatchCorpus
+{
+public:
+	TestOnestring_EqualsLiteralStd() {}
+
+	testdoc_t get_title() override
+	{
+		return "Onestring: Equals (Literal Dispatch, std::string)";
+	}
+
+	testdoc_t get_docs() override
+	{
+		return "Match std::string commands against string literals with ==.";
+	}
+
+	bool run() override
+	{
+		size_t total = 0;
+		for (const std::string& command : std_commands) {
+			total += dispatch(command);
+		}
+		PL_ASSERT_EQUAL(total, expected);
+		return true;
+	}
+};
+
+// O-tB254
+class TestOnestring_Hash : public Test
+{
+public:
+	explicit TestOnestring_Hash() {}
+
+	testdoc_t get_title() override { return "Onestring: Hash"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test hash(), std::hash<onestring>, and the cached hash.";
+	}
+
+	bool run() override
+	{
+		std::hash<onestring> hasher;
+		onestring test = "🐭abc日本語, and then some more text";
+		std::string str = "🐭abc日本語, and then some more text";
+		PL_ASSERT_EQUAL(test.hash(), hasher(test));
+		PL_ASSERT_EQUAL(hasher(test), hasher(str));
+		PL_ASSERT_EQUAL(hasher(test), hasher(str.c_str()));
+		PL_ASSERT_EQUAL(hasher(test), hasher(std::string_view(str)));
+		PL_ASSERT_EQUAL(hasher(test), hasher(test.view()));
+		PL_ASSERT_EQUAL(hasher(test.view(1, 3)), hasher("abc"));
+		PL_ASSERT_EQUAL(hasher(onestring()), hasher(""));
+		PL_ANTIASSERT_EQUAL(hasher("ab"), hasher("ba"));
+		PL_ANTIASSERT_EQUAL(hasher(""), hasher(std::string(1, '\0')));
+
+		// The cached hash follows every change to the string.
+		PL_ASSERT_FALSE(test.hash_cached());
+		test.cache_hash();
+		PL_ASSERT_TRUE(test.hash_cached());
+		PL_ASSERT_EQUAL(test.hash(), hasher(str));
+		test.append("!");
+		PL_ASSERT_EQUAL(test.hash(), hasher(str + "!"));
+		test[0] = 'X';
+		PL_ASSERT_EQUAL(test.hash(), hasher("Xabc日本語, and then some more text!"));
+		test.front() = "🐭";
+		test.back() = "?";
+		PL_ASSERT_EQUAL(test.hash(), hasher(str + "?"));
+		test.pop_back();
+		PL_ASSERT_EQUAL(test.hash(), hasher(str));
+		onestring copy = test;
+		PL_ASSERT_TRUE(copy.hash_cached());
+		PL_ASSERT_EQUAL(copy.hash(), test.hash());
+		copy = "other";
+		PL_ASSERT_EQUAL(copy.hash(), hasher("other"));
+		test.cache_hash(false);
+		PL_ASSERT_FALSE(test.hash_cached());
+		PL_ASSERT_EQUAL(test.hash(), hasher(str));
+
+		std::unordered_set<onestring> set = {"get", "set", "日本", "🐭"};
+		PL_ASSERT_EQUAL(set.size(), 4u);
+		PL_ASSERT_EQUAL(set.count("日本"), 1u);
+		PL_ASSERT_EQUAL(set.count("日"), 0u);
+		return true;
+	}
+};
+
+// O-tP203
+class TestOnestring_HashLookup : public TestOnestring_DispatchCorpus
+{
+protected:
+	std::unordered_map<onestring, size_t> table;
+
+public:
+	TestOnestring_HashLookup() {}
+
+	bool pre() override
+	{
+		table = {{"delete", 1}, {"déjà", 2}, {"日本語", 3}};
+		return TestOnestring_DispatchCorpus::pre();
+	}
+
+	testdoc_t get_title() override { return "Onestring: Hash (Lookup)"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Look up onestring commands in a std::unordered_map.";
+	}
+
+	bool run() override
+	{
+		size_t total = 0;
+		for (const onestring& command : commands) {
+			auto found = table.find(command);
+			if (found != table.end()) {
+				total += found->second;
+			}
+		}
+		PL_ASSERT_EQUAL(total, expected);
+		return true;
+	}
+};
+
+// O-tP203 (comparative)
+class TestOnestring_HashLookupStd : public TestOnestring_DispatchCorpus
+{
+protected:
+	std::unordered_map<std::string, size_t> table;
+
+public:
+	TestOnestring_HashLookupStd() {}
+
+	bool pre() override
+	{
+		table = {{"delete", 1}, {"déjà", 2}, {"日本語", 3}};
+		return TestOnestring_DispatchCorpus::pre();
+	}
+
+	testdoc_t get_title() override
+	{
+		return "Onestring: Hash (Lookup, std::string)";
+	}
+
+	testdoc_t get_docs() override
+	{
+		return "Look up std::string commands in a std::unordered_map.";
+	}
+
+	bool run() override
+	{
+		size_t total = 0;
+		for (const std::string& command : std_commands) {
+			auto found = table.find(command);
+			if (found != table.end()) {
+				total += found->second;
+			}
+		}
+		PL_ASSERT_EQUAL(total, expected);
+		return true;
+	}
+};
+
+// O-tB255
+class TestOnestring_FindSubstring : public Test
+{
+public:
+	explicit TestOnestring_FindSubstring() {}
+
+	testdoc_t get_title() override { return "Onestring: Find (Substring)"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test find() against short, long, periodic, and Unicode "
+			   "substrings.";
+	}
+
+	bool run() override
+	{
+		onestring test = "🐭abc日本abc日本語abcab";
+		PL_ASSERT_EQUAL(test.find("abc"), 1);
+		PL_ASSERT_EQUAL(test.find("abc", 2), 6);
+		PL_ASSERT_EQUAL(test.find(onestring("日本語")), 9);
+		PL_ASSERT_EQUAL(test.find(std::string("cab")), 14);
+		PL_ASSERT_EQUAL(test.find("🐭"), 0);
+		PL_ASSERT_EQUAL(test.find("本abc日"), 5);
+		PL_ASSERT_EQUAL(test.find(test.view(9, 3)), 9);
+		PL_ASSERT_EQUAL(test.find(""), 0);
+		PL_ASSERT_EQUAL(test.find("", 4), 4);
+		// A needle running past the end of the string does not match.
+		PL_ASSERT_EQUAL(test.find("abcabc"), -1);
+		PL_ASSERT_EQUAL(test.find("abd"), -1);
+		PL_ASSERT_EQUAL(test.find("日本語", 10), -1);
+		bool thrown = false;
+		try {
+			test.find("abc", 17);
+		} catch (const std::out_of_range&) {
+			thrown = true;
+		}
+		PL_ASSERT_TRUE(thrown);
+
+		// Characters sharing a last byte must still be told apart.
+		PL_ASSERT_EQUAL(onestring("\u00e9\u0129").find("\u0129"), 1);
+		PL_ASSERT_EQUAL(onestring("x\u00e9").find("\u0129"), -1);
+
+		// A partial match must not carry over into the next attempt.
+		PL_ASSERT_EQUAL(onestring("aab").find("ab"), 1);
+		PL_ASSERT_EQUAL(onestring("ababac").find("abac"), 2);
+
+		// Long haystacks use the Two-Way search.
+		onestring hay;
+		std::string std_hay;
+		for (size_t i = 0; i < 200; ++i) {
+			hay.append("ab日");
+			std_hay += "ab日";
+		}
+		hay.append("ab日ab🐭");
+		std_hay += "ab日ab🐭";
+		PL_ASSERT_EQUAL(hay.find("ab日ab🐭"), 600);
+		PL_ASSERT_EQUAL(hay.find("日ab日ab日"), 2);
+		PL_ASSERT_EQUAL(hay.find("日ab日ab日", 590), 590);
+		PL_ASSERT_EQUAL(hay.find("日ab日ab日", 597), -1);
+		PL_ASSERT_EQUAL(hay.find("b日ab🐭"), 601);
+		PL_ASSERT_EQUAL(hay.find(hay), 0);
+		PL_ASSERT_EQUAL(hay.find(hay.view(1, hay.length() - 1)), 1);
+		onestring aperiodic = "ab日xyzzy🐭";
+		PL_ASSERT_EQUAL(hay.find(aperiodic), -1);
+		hay.insert(300, aperiodic);
+		PL_ASSERT_EQUAL(hay.find(aperiodic), 300);
+
+		// Every result agrees with a naive search.
+		for (size_t len = 1; len < 8; ++len) {
+			for (size_t start = 0; start + len <= hay.length(); start += 37) {
+				onestring needle = hay.substr(start, len);
+				int expected = -1;
+				for (size_t i = 0; i + len <= hay.length(); ++i) {
+					if (hay.substr(i, len) == needle) {
+						expected = static_cast<int>(i);
+						break;
+					}
+				}
+				PL_ASSERT_EQUAL(hay.find(needle), expected);
+			}
+		}
+		return true;
+	}
+};
+
+/// Lines of a log, for the benchmarks that scan one to build it from.
+inline const char* const LOG_SAMPLES[] = {
+	"INFO: request served in 4ms\n",
+	"WARN: cache miss for 日本語\n",
+	"DEBUG: déjà vu in worker 3\n",
+	"ERROR: disk full on /var 🐭\n",
+	"INFO: user über logged in from 10.0.0.1\n",
+	"AUDIT: card 4111 seen for user alice\n",
+	"INFO: token abc123 refreshed\n",
+	"DEBUG: retrying request\n"};
+
+/* A log to scan for a message, the way a monitor might. */
+class TestOnestring_LogCorpus : public Test
+{
+protected:
+	onestring log;
+	std::string std_log;
+	size_t expected = 0;
+	size_t lines = 0;
+
+public:
+	TestOnestring_LogCorpus() {}
+
+	bool pre() override
+	{
+		log.clear();
+		std_log.clear();
+		expected = 0;
+		lines = 0;
+		build_corpus(LOG_SAMPLES, 65536, [this](const char* line, size_t i) {
+			log.append(line);
+			std_log += line;
+			expected += (i == 3) ? 1 : 0;
+			++lines;
+			return log.length();
+		});
+		return true;
+	}
+
+	virtual testdoc_t get_title() override = 0;
+	virtual testdoc_t get_docs() override = 0;
+};
+
+// O-tP204
+class TestOnestring_FindLog : public TestOnestring_LogCorpus
+{
+public:
+	TestOnestring_FindLog() {}
+
+	testdoc_t get_title() override { return "Onestring: Find (Log Scan)"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Count the occurrences of a message in a log with "
+			   "onestring::find().";
+	}
+
+	bool run() override
+	{
+		onestring needle = "disk full on /var";
+		size_t total = 0;
+		size_t pos = 0;
+		while (pos < log.length()) {
+			int found = log.find(needle, pos);
+			if (found < 0) {
+				break;
+			}
+			++total;
+			pos = static_cast<size_t>(found) + needle.length();
+		}
+		PL_ASSERT_EQUAL(total, expected);
+		return true;
+	}
+};
+
+// O-tP204 (comparative)
+class TestOnestring_FindLogStd : public TestOnestring_LogCorpus
+{
+public:
+	TestOnestring_FindLogStd() {}
+
+	testdoc_t get_title() override
+	{
+		return "Onestring: Find (Log Scan, std::string)";
+	}
+
+	testdoc_t get_docs() override
+	{
+		return "Count the occurrences of a message in a log with "
+			   "std::string::find().";
+	}
+
+	bool run() override
+	{
+		std::string needle = "disk full on /var";
+		size_t total = 0;
+		size_t pos = std_log.find(needle);
+		while (pos != std::string::npos) {
+			++total;
+			pos = std_log.find(needle, pos + needle.length());
+		}
+		PL_ASSERT_EQUAL(total, expected);
+		return true;
+	}
+};
+
+// O-tB256
+class TestOnestring_RfindSubstring : public Test
+{
+public:
+	explicit TestOnestring_RfindSubstring() {}
+
+	testdoc_t get_title() override { return "Onestring: Rfind (Substring)"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test rfind() against short, long, overlapping, and Unicode "
+			   "substrings, and its position bound.";
+	}
+
+	bool run() override
+	{
+		onestring test = "🐭abc日本abc日本語abcab";
+		PL_ASSERT_EQUAL(test.rfind("abc"), 12);
+		PL_ASSERT_EQUAL(test.rfind("abc", 11), 6);
+		PL_ASSERT_EQUAL(test.rfind("abc", 6), 6);
+		PL_ASSERT_EQUAL(test.rfind("abc", 5), 1);
+		PL_ASSERT_EQUAL(test.rfind(onestring("日本")), 9);
+		PL_ASSERT_EQUAL(test.rfind(std::string("ab")), 15);
+		PL_ASSERT_EQUAL(test.rfind("🐭"), 0);
+		PL_ASSERT_EQUAL(test.rfind(test.view(4, 2)), 9);
+		PL_ASSERT_EQUAL(test.rfind("b", 16), 16);
+		// Without a position, the whole string is searched.
+		PL_ASSERT_EQUAL(test.rfind(""), 16);
+		PL_ASSERT_EQUAL(test.rfind("", 4), 4);
+		PL_ASSERT_EQUAL(test.rfind("abcabc"), -1);
+		PL_ASSERT_EQUAL(test.rfind("abc", 1), 1);
+		PL_ASSERT_EQUAL(test.rfind("🐭a", 3), 0);
+		bool thrown = false;
+		try {
+			test.rfind("abc", 17);
+		} catch (const std::out_of_range&) {
+			thrown = true;
+		}
+		PL_ASSERT_TRUE(thrown);
+
+		// Overlapping occurrences are found from the last.
+		PL_ASSERT_EQUAL(onestring("aaaa").rfind("aa"), 2);
+		PL_ASSERT_EQUAL(onestring("ababab").rfind("abab"), 2);
+		PL_ASSERT_EQUAL(onestring("\u00e9\u0129").rfind("\u00e9"), 0);
+
+		// Long haystacks use the reverse Two-Way search.
+		onestring hay = "🐭ab日ab";
+		for (size_t i = 0; i < 200; ++i) {
+			hay.append("ab日");
+		}
+		PL_ASSERT_EQUAL(hay.rfind("🐭ab日ab"), 0);
+		PL_ASSERT_EQUAL(hay.rfind("日ab日ab日"), 599);
+		PL_ASSERT_EQUAL(hay.rfind("日ab日ab日", 10), 8);
+		PL_ASSERT_EQUAL(hay.rfind("b日ab日ab日ab"), 595);
+		PL_ASSERT_EQUAL(hay.rfind(hay), 0);
+		PL_ASSERT_EQUAL(hay.rfind(hay.view(0, hay.length() - 1)), 0);
+		onestring aperiodic = "ab日xyzzy🐭";
+		PL_ASSERT_EQUAL(hay.rfind(aperiodic), -1);
+		hay.insert(300, aperiodic);
+		hay.insert(100, aperiodic);
+		PL_ASSERT_EQUAL(hay.rfind(aperiodic), 309);
+		PL_ASSERT_EQUAL(hay.rfind(aperiodic, 308), 100);
+
+		// Every result agrees with a naive search.
+		for (size_t len = 1; len < 8; ++len) {
+			for (size_t start = 0; start + len <= hay.length(); start += 37) {
+				onestring needle = hay.substr(start, len);
+				int expected = -1;
+				for (size_t i = 0; i + len <= hay.length(); ++i) {
+					if (hay.substr(i, len) == needle) {
+						expected = static_cast<int>(i);
+					}
+				}
+				PL_ASSERT_EQUAL(hay.rfind(needle), expected);
+			}
+		}
+		return true;
+	}
+};
+
+// O-tP205
+class TestOnestring_RfindLog : public TestOnestring_LogCorpus
+{
+public:
+	TestOnestring_RfindLog() {}
+
+	testdoc_t get_title() override { return "Onestring: Rfind (Log Scan)"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Count the occurrences of a message in a log, from the end, "
+			   "with onestring::rfind().";
+	}
+
+	bool run() override
+	{
+		onestring needle = "disk full on /var";
+		size_t total = 0;
+		int found = log.rfind(needle);
+		// A position of 0 would search the whole log again.
+		while (found > 1) {
+			++total;
+			found = log.rfind(needle, static_cast<size_t>(found) - 1);
+		}
+		PL_ASSERT_EQUAL(total, expected);
+		return true;
+	}
+};
+
+// O-tP205 (comparative)
+class TestOnestring_RfindLogStd : public TestOnestring_LogCorpus
+{
+public:
+	TestOnestring_RfindLogStd() {}
+
+	testdoc_t get_title() override
+	{
+		return "Onestring: Rfind (Log Scan, std::string)";
+	}
+
+	testdoc_t get_docs() override
+	{
+		return "Count the occurrences of a message in a log, from the end, "
+			   "with std::string::rfind().";
+	}
+
+	bool run() override
+	{
+		std::string needle = "disk full on /var";
+		size_t total = 0;
+		size_t pos = std_log.rfind(needle);
+		while (pos != std::string::npos && pos > 0) {
+			++total;
+			pos = std_log.rfind(needle, pos - 1);
+		}
+		PL_ASSERT_EQUAL(total, expected);
+		return true;
+	}
+};
+
+// O-tB257
+class TestOnestring_FindCharset : public Test
+{
+public:
+	explicit TestOnestring_FindCharset() {}
+
+	testdoc_t get_title() override { return "Onestring: Find (Character Set)"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test find_first_of(), find_last_of(), find_first_not_of(), and "
+			   "find_last_not_of() against ASCII and Unicode sets.";
+	}
+
+	bool run() override
+	{
+		onestring test = "key: 日本, 🐭; déjà vu.";
+		PL_ASSERT_EQUAL(test.find_first_of(",;."), 7);
+		PL_ASSERT_EQUAL(test.find_first_of(std::string(",;."), 8), 10);
+		PL_ASSERT_EQUAL(test.find_last_of(",;."), 19);
+		PL_ASSERT_EQUAL(test.find_last_of(",;.", 18), 10);
+		PL_ASSERT_EQUAL(test.find_first_of("🐭本"), 6);
+		PL_ASSERT_EQUAL(test.find_last_of(onestring("à本")), 15);
+		PL_ASSERT_EQUAL(test.find_first_not_of("key:"), 4);
+		PL_ASSERT_EQUAL(test.find_first_not_of("日本 ", 3), 3);
+		PL_ASSERT_EQUAL(test.find_first_not_of(" 日本", 4), 7);
+		PL_ASSERT_EQUAL(test.find_last_not_of("uv. "), 15);
+		PL_ASSERT_EQUAL(test.find_last_not_of("ejd", 16), 16);
+		PL_ASSERT_EQUAL(test.find_last_not_of("àjé", 15), 12);
+		PL_ASSERT_EQUAL(test.find_first_of(test.view(9, 1)), 9);
+		PL_ASSERT_EQUAL(test.find_first_of("xqz"), -1);
+		PL_ASSERT_EQUAL(test.find_first_not_of(test), -1);
+		PL_ASSERT_EQUAL(test.find_last_not_of(test), -1);
+
+		// An empty set matches nothing, so every character is outside it.
+		PL_ASSERT_EQUAL(test.find_first_of(""), -1);
+		PL_ASSERT_EQUAL(test.find_last_of(""), -1);
+		PL_ASSERT_EQUAL(test.find_first_not_of("", 5), 5);
+		PL_ASSERT_EQUAL(test.find_last_not_of(""), 19);
+
+		// Sets may hold null characters, and be reused.
+		onestring nulled = "a";
+		nulled.append('\0');
+		nulled.append('b');
+		PL_ASSERT_EQUAL(nulled.find_first_of(std::string("\0", 1)), 1);
+		onestring_charset set(",;.");
+		PL_ASSERT_TRUE(set.contains(','));
+		PL_ASSERT_FALSE(set.contains("日"));
+		PL_ASSERT_FALSE(set.empty());
+		PL_ASSERT_TRUE(onestring_charset().empty());
+		set.insert("日");
+		PL_ASSERT_TRUE(set.contains("日"));
+		PL_ASSERT_FALSE(set.contains("本"));
+		PL_ASSERT_EQUAL(test.find_first_of(set), 5);
+		PL_ASSERT_EQUAL(test.find_last_of(set, 9), 7);
+
+		bool thrown = false;
+		try {
+			test.find_last_of(set, 20);
+		} catch (const std::out_of_range&) {
+			thrown = true;
+		}
+		PL_ASSERT_TRUE(thrown);
+		return true;
+	}
+};
+
+/* A log to split into tokens at punctuation and whitespace. */
+class TestOnestring_TokenCorpus : public TestOnestring_LogCorpus
+{
+protected:
+	/// The characters that separate tokens.
+	inline static const char* DELIMITERS = " :/\n";
+
+	size_t tokens = 0;
+
+public:
+	TestOnestring_TokenCorpus() {}
+
+	bool pre() override
+	{
+		TestOnestring_LogCorpus::pre();
+		// Every delimiter is ASCII, so the tokens can be counted by byte.
+		tokens = 0;
+		bool inside = false;
+		for (char byte : std_log) {
+			bool delimiter = strchr(DELIMITERS, byte) != nullptr;
+			if (!delimiter && !inside) {
+				++tokens;
+			}
+			inside = !delimiter;
+		}
+		return true;
+	}
+
+	virtual testdoc_t get_title() override = 0;
+	virtual testdoc_t get_docs() override = 0;
+};
+
+// O-tP206
+class TestOnestring_Tokenize : public TestOnestring_TokenCorpus
+{
+public:
+	TestOnestring_Tokenize() {}
+
+	testdoc_t get_title() override { return "Onestring: Find (Tokenize)"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Split a log into tokens with onestring::find_first_of() and "
+			   "find_first_not_of().";
+	}
+
+	bool run() override
+	{
+		onestring_charset delimiters(DELIMITERS);
+		size_t total = 0;
+		int start = log.find_first_not_of(delimiters);
+		while (start >= 0) {
+			++total;
+			int end = log.find_first_of(delimiters, start);
+			if (end < 0) {
+				break;
+			}
+			start = log.find_first_not_of(delimiters, end);
+		}
+		PL_ASSERT_EQUAL(total, tokens);
+		return true;
+	}
+};
+
+// O-tP206 (comparative)
+class TestOnestring_TokenizeStd : public TestOnestring_TokenCorpus
+{
+public:
+	TestOnestring_TokenizeStd() {}
+
+	testdoc_t get_title() override
+	{
+		return "Onestring: Find (Tokenize, std::string)";
+	}
+
+	testdoc_t get_docs() override
+	{
+		return "Split a log into tokens with std::string::find_first_of() and "
+			   "find_first_not_of().";
+	}
+
+	bool run() override
+	{
+		size_t total = 0;
+		size_t start = std_log.find_first_not_of(DELIMITERS);
+		while (start != std::string::npos) {
+			++total;
+			size_t end = std_log.find_first_of(DELIMITERS, start);
+			if (end == std::string::npos) {
+				break;
+			}
+			start = std_log.find_first_not_of(DELIMITERS, end);
+		}
+		PL_ASSERT_EQUAL(total, tokens);
+		return true;
+	}
+};
+
+// O-tB258
+class TestOnestring_FindChar : public Test
+{
+public:
+	explicit TestOnestring_FindChar() {}
+
+	testdoc_t get_title() override { return "Onestring: Find (Character)"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test find(), rfind(), and count() for a single character.";
+	}
+
+	bool run() override
+	{
+		onestring test = "a,🐭,日本,é,\u00e9\u0129🐭\n";
+		PL_ASSERT_EQUAL(test.find(','), 1);
+		PL_ASSERT_EQUAL(test.find(',', 2), 3);
+		PL_ASSERT_EQUAL(test.find(onechar("🐭")), 2);
+		PL_ASSERT_EQUAL(test.find(onechar("🐭"), 3), 11);
+		PL_ASSERT_EQUAL(test.find(onechar("\u0129")), 10);
+		PL_ASSERT_EQUAL(test.find('\n'), 12);
+		PL_ASSERT_EQUAL(test.find('x'), -1);
+		PL_ASSERT_EQUAL(test.rfind(','), 8);
+		PL_ASSERT_EQUAL(test.rfind(',', 5), 3);
+		PL_ASSERT_EQUAL(test.rfind(onechar("🐭")), 11);
+		PL_ASSERT_EQUAL(test.rfind(onechar("🐭"), 10), 2);
+		PL_ASSERT_EQUAL(test.rfind(onechar("é")), 9);
+		PL_ASSERT_EQUAL(test.rfind('a'), 0);
+		PL_ASSERT_EQUAL(test.rfind(onechar("本"), 4), -1);
+		PL_ASSERT_EQUAL(test.count(','), 4u);
+		PL_ASSERT_EQUAL(test.count(onechar("🐭")), 2u);
+		PL_ASSERT_EQUAL(test.count(onechar("é")), 2u);
+		PL_ASSERT_EQUAL(test.count(onechar("\u0129")), 1u);
+		PL_ASSERT_EQUAL(test.count('x'), 0u);
+		PL_ASSERT_EQUAL(onestring().count('x'), 0u);
+
+		bool thrown = false;
+		try {
+			test.find(',', 13);
+		} catch (const std::out_of_range&) {
+			thrown = true;
+		}
+		PL_ASSERT_TRUE(thrown);
+		return true;
+	}
+};
+
+// O-tP207
+class TestOnestring_CountLines : public TestOnestring_LogCorpus
+{
+public:
+	TestOnestring_CountLines() {}
+
+	testdoc_t get_title() override { return "Onestring: Count (Lines)"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Count the line breaks in a log with onestring::count().";
+	}
+
+	bool run() override
+	{
+		PL_ASSERT_EQUAL(log.count('\n'), lines);
+		return true;
+	}
+};
+
+// O-tP207 (comparative)
+class TestOnestring_CountLinesStd : public TestOnestring_LogCorpus
+{
+public:
+	TestOnestring_CountLinesStd() {}
+
+	testdoc_t get_title() override
+	{
+		return "Onestring: Count (Lines, std::string)";
+	}
+
+	testdoc_t get_docs() override
+	{
+		return "Count the line breaks in a log with std::count() on a "
+			   "std::string.";
+	}
+
+	bool run() override
+	{
+		size_t total = std::count(std_log.begin(), std_log.end(), '\n');
+		PL_ASSERT_EQUAL(total, lines);
+		return true;
+	}
+};
+
+// O-tB259
+class TestOnestring_FindBytes : public Test
+{
+public:
+	explicit TestOnestring_FindBytes() {}
+
+	testdoc_t get_title() override { return "Onestring: Find (UTF-8 Bytes)"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test find() and rfind() against c-strings, std::string, and "
+			   "std::string_view, where short needles are searched without "
+			   "allocating.";
+	}
+
+	bool run() override
+	{
+		onestring test = "🐭abc日本abc日本語abcab";
+		std::string_view needle = "abc日本語";
+		size_t before = allocation_count();
+		PL_ASSERT_EQUAL(test.find(needle), 6);
+		PL_ASSERT_EQUAL(test.find(needle.substr(0, 3), 2), 6);
+		PL_ASSERT_EQUAL(test.rfind(needle.substr(0, 6)), 6);
+		PL_ASSERT_EQUAL(test.rfind(needle.substr(0, 3), 11), 6);
+		PL_ASSERT_EQUAL(test.find("日本語"), 9);
+		PL_ASSERT_EQUAL(test.rfind("日本"), 9);
+		PL_ASSERT_EQUAL(test.find(std::string_view()), 0);
+		PL_ASSERT_EQUAL(test.rfind(std::string_view()), 16);
+		// Ending partway through a character matches nothing.
+		PL_ASSERT_EQUAL(test.find(needle.substr(0, 5)), -1);
+		PL_ASSERT_EQUAL(test.rfind(needle.substr(0, 8)), -1);
+		PL_ASSERT_EQUAL(test.find_first_of(needle.substr(3, 3)), 4);
+		PL_ASSERT_EQUAL(test.find_last_not_of(needle.substr(0, 3)), 11);
+		PL_ASSERT_EQUAL(allocation_count(), before);
+
+		// Strings with an embedded null are searched in full.
+		onestring nulled = "a";
+		nulled.append('\0');
+		nulled.append('b');
+		nulled.append('\0');
+		PL_ASSERT_EQUAL(nulled.find(std::string("\0b", 2)), 1);
+		PL_ASSERT_EQUAL(nulled.rfind(std::string("\0", 1)), 3);
+
+		// Needles longer than the stack holds are parsed in full.
+		onestring hay;
+		std::string long_needle;
+		for (size_t i = 0; i < 20; ++i) {
+			hay.append("日本ab");
+		}
+		for (size_t i = 0; i < 12; ++i) {
+			long_needle += "日本ab";
+		}
+		hay.append("🐭");
+		std::string ending = long_needle + "🐭";
+		std::string extra_start = "本" + long_needle;
+		std::string extra_end = long_needle + "b";
+		PL_ASSERT_EQUAL(hay.find(long_needle), 0);
+		PL_ASSERT_EQUAL(hay.find(long_needle, 1), 4);
+		PL_ASSERT_EQUAL(hay.rfind(long_needle), 32);
+		PL_ASSERT_EQUAL(hay.rfind(long_needle, 31), 28);
+		PL_ASSERT_EQUAL(hay.find(ending), 32);
+		PL_ASSERT_EQUAL(hay.rfind(ending), 32);
+		PL_ASSERT_EQUAL(hay.find(extra_start), -1);
+		PL_ASSERT_EQUAL(hay.rfind(extra_end), -1);
+		return true;
+	}
+};
+
+// O-tP208
+class TestOnestring_FindLiteral : public TestOnestring_LogCorpus
+{
+public:
+	TestOnestring_FindLiteral() {}
+
+	testdoc_t get_title() override
+	{
+		return "Onestring: Find (Literal, No Allocation)";
+	}
+
+	testdoc_t get_docs() override
+	{
+		return "Count the occurrences of a string literal in a log with "
+			   "onestring::find(), allocating nothing.";
+	}
+
+	bool run() override
+	{
+		size_t before = allocation_count();
+		size_t total = 0;
+		size_t pos = 0;
+		while (pos < log.length()) {
+			int found = log.find("disk full on /var", pos);
+			if (found < 0) {
+				break;
+			}
+			++total;
+			pos = static_cast<size_t>(found) + 1;
+		}
+		PL_ASSERT_EQUAL(allocation_count(), before);
+		PL_ASSERT_EQUAL(total, expected);
+		return true;
+	}
+};
+
+// O-tP208 (comparative)
+class TestOnestring_FindLiteralStd : public TestOnestring_LogCorpus
+{
+public:
+	TestOnestring_FindLiteralStd() {}
+
+	testdoc_t get_title() override
+	{
+		return "Onestring: Find (Literal, No Allocation, std::string)";
+	}
+
+	testdoc_t get_docs() override
+	{
+		return "Count the occurrences of a string literal in a log with "
+			   "std::string::find().";
+	}
+
+	bool run() override
+	{
+		size_t before = allocation_count();
+		size_t total = 0;
+		size_t pos = std_log.find("disk full on /var");
+		while (pos != std::string::npos) {
+			++total;
+			pos = std_log.find("disk full on /var", pos + 1);
+		}
+		PL_ASSERT_EQUAL(allocation_count(), before);
+		PL_ASSERT_EQUAL(total, expected);
+		return true;
+	}
+};
+
+// O-tB260
+class TestOnestring_ReadNull : public Test
+{
+public:
+	explicit TestOnestring_ReadNull() {}
+
+	testdoc_t get_title() override { return "Onestring: Read Null Bytes"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test that operator>> keeps a null byte in a word as a "
+			   "character, and replaces a character cut off by the stream.";
+	}
+
+	bool run() override
+	{
+		std::istringstream input(std::string("abcd\0xy z", 9));
+		onestring word;
+		input >> word;
+		PL_ASSERT_EQUAL(word.length(), 7u);
+		PL_ASSERT_TRUE(word[4] == '\0');
+		PL_ASSERT_TRUE(word.substr(5) == "xy");
+		input >> word;
+		PL_ASSERT_EQUAL(word, "z");
+
+		std::istringstream cut("a\xE2" "b c");
+		cut >> word;
+		PL_ASSERT_EQUAL(word, "a\uFFFDb");
+		return true;
+	}
+};
+
+// O-tB261
+class TestOnestring_FindBytesPeriodic : public Test
+{
+public:
+	explicit TestOnestring_FindBytesPeriodic() {}
+
+	testdoc_t get_title() override
+	{
+		return "Onestring: Find (Long UTF-8 Needle, Periodic Haystack)";
+	}
+
+	testdoc_t get_docs() override
+	{
+		return "Test find() and rfind() with a UTF-8 needle longer than the "
+			   "stack holds, on a haystack where every position matches all "
+			   "but the end of the needle, which must not take quadratic "
+			   "time.";
+	}
+
+	bool run() override
+	{
+		const size_t length = 200000;
+		const size_t count = 4000;
+		onestring hay = std::string(length, 'a');
+		std::string needle = std::string(count, 'a') + "b";
+		std::string missing = std::string(count, 'a') + "c";
+		PL_ASSERT_EQUAL(hay.find(needle), -1);
+		PL_ASSERT_EQUAL(hay.rfind(needle), -1);
+
+		hay.append('b');
+		PL_ASSERT_EQUAL(hay.find(needle), static_cast<int>(length - count));
+		PL_ASSERT_EQUAL(hay.rfind(needle), static_cast<int>(length - count));
+		PL_ASSERT_EQUAL(hay.find(missing), -1);
+		PL_ASSERT_EQUAL(hay.rfind(missing), -1);
+		return true;
+	}
+};
+
+class TestSuite_Onestring : public TestSuite
+{
+public:
+	explicit TestSuite_Onestring() {}
+
+	testdoc_t get_title() override { return "Onestring Tests"; }
+
+	void load_tests() override
+	{
+		register_test("O-tB201a",
+					  new TestOnestring_Assign(
+						  TestOnestring::TestStringType::CHAR));
+		register_test("O-tB201b",
+					  new TestOnestring_Assign(
+						  TestOnestring::TestStringType::OCHAR_ASCII));
+		register_test("O-tB201c",
+					  new TestOnestring_Assign(
+						  TestOnestring::TestStringType::OCHAR_UNICODE));
+		register_test("O-tB201d",
+					  new TestOnestring_Assign(
+						  TestOnestring::TestStringType::CSTR_ASCII));
+		register_test("O-tB201e",
+					  new TestOnestring_Assign(
+						  TestOnestring::TestStringType::CSTR_UNICODE));
+		register_test("O-tB201f",
+					  new TestOnestring_Assign(
+						  TestOnestring::TestStringType::STR_ASCII));
+		register_test("O-tB201g",
+					  new TestOnestring_Assign(
+						  TestOnestring::TestStringType::STR_UNICODE));
+		register_test("O-tB201h",
+					  new TestOnestring_Assign(
+						  TestOnestring::TestStringType::OSTR_ASCII));
+		register_test("O-tB201i",
+					  new TestOnestring_Assign(
+						  TestOnestring::TestStringType::OSTR_UNICODE));
+
+		register_test("O-tB202a",
+					  new TestOnestring_Equals(
+						  TestOnestring::TestStringType::CHAR));
+		register_test("O-tB202b",
+					  new TestOnestring_Equals(
+						  TestOnestring::TestStringType::OCHAR_ASCII));
+		register_test("O-tB202c",
+					  new TestOnestring_Equals(
+						  TestOnestring::TestStringType::OCHAR_UNICODE));
+		register_test("O-tB202d",
+					  new TestOnestring_Equals(
+						  TestOnestring::TestStringType::CSTR_ASCII));
+		register_test("O-tB202e",
+					  new TestOnestring_Equals(
+						  TestOnestring::TestStringType::CSTR_UNICODE));
+		register_test("O-tB202f",
+					  new TestOnestring_Equals(
+						  TestOnestring::TestStringType::STR_ASCII));
+		register_test("O-tB202g",
+					  new TestOnestring_Equals(
+						  TestOnestring::TestStringType::STR_UNICODE));
+		register_test("O-tB202h",
+					  new TestOnestring_Equals(
+						  TestOnestring::TestStringType::OSTR_ASCII));
+		register_test("O-tB202i",
+					  new TestOnestring_Equals(
+						  TestOnestring::TestStringType::OSTR_UNICODE));
+
+		register_test("O-tB203a",
+					  new TestOnestring_OpEquals(
+						  TestOnestring::TestStringType::CHAR));
+		register_test("O-tB203b",
+					  new TestOnestring_OpEquals(
+						  TestOnestring::TestStringType::OCHAR_ASCII));
+		register_test("O-tB203c",
+					  new TestOnestring_OpEquals(
+						  TestOnestring::TestStringType::OCHAR_UNICODE));
+		register_test("O-tB203d",
+					  new TestOnestring_OpEquals(
+						  TestOnestring::TestStringType::CSTR_ASCII));
+		register_test("O-tB203e",
+					  new TestOnestring_OpEquals(
+						  TestOnestring::TestStringType::CSTR_UNICODE));
+		register_test("O-tB203f",
+					  new TestOnestring_OpEquals(
+						  TestOnestring::TestStringType::STR_ASCII));
+		register_test("O-tB203g",
+					  new TestOnestring_OpEquals(
+						  TestOnestring::TestStringType::STR_UNICODE));
+		register_test("O-tB203h",
+					  new TestOnestring_OpEquals(
+						  TestOnestring::TestStringType::OSTR_ASCII));
+		register_test("O-tB203i",
+					  new TestOnestring_OpEquals(
+						  TestOnestring::TestStringType::OSTR_UNICODE));
+
+		register_test("O-tB204a",
+					  new TestOnestring_OpNotEquals(
+						  TestOnestring::TestStringType::CHAR));
+		register_test("O-tB204b",
+					  new TestOnestring_OpNotEquals(
+						  TestOnestring::TestStringType::OCHAR_ASCII));
+		register_test("O-tB204c",
+					  new TestOnestring_OpNotEquals(
+						  TestOnestring::TestStringType::OCHAR_UNICODE));
+		register_test("O-tB204d",
+					  new TestOnestring_OpNotEquals(
+						  TestOnestring::TestStringType::CSTR_ASCII));
+		register_test("O-tB204e",
+					  new TestOnestring_OpNotEquals(
+						  TestOnestring::TestStringType::CSTR_UNICODE));
+		register_test("O-tB204f",
+					  new TestOnestring_OpNotEquals(
+						  TestOnestring::TestStringType::STR_ASCII));
+		register_test("O-tB204g",
+					  new TestOnestring_OpNotEquals(
+						  TestOnestring::TestStringType::STR_UNICODE));
+		register_test("O-tB204h",
+					  new TestOnestring_OpNotEquals(
+						  TestOnestring::TestStringType::OSTR_ASCII));
+		register_test("O-tB204i",
+					  new TestOnestring_OpNotEquals(
+						  TestOnestring::TestStringType::OSTR_UNICODE));
+
+		register_test("O-tB205a",
+					  new TestOnestring_Compare(
+						  TestOnestring::TestStringType::CHAR));
+		register_test("O-tB205b",
+					  new TestOnestring_Compare(
+						  TestOnestring::TestStringType::OCHAR_ASCII));
+		register_test("O-tB205c",
+					  new TestOnestring_Compare(
+						  TestOnestring::TestStringType::OCHAR_UNICODE));
+		register_test("O-tB205d",
+					  new TestOnestring_Compare(
+						  TestOnestring::TestStringType::CSTR_ASCII));
+		register_test("O-tB205e",
+					  new TestOnestring_Compare(
+						  TestOnestring::TestStringType::CSTR_UNICODE));
+		register_test("O-tB205f",
+					  new TestOnestring_Compare(
+						  TestOnestring::TestStringType::STR_ASCII));
+		register_test("O-tB205g",
+					  new TestOnestring_Compare(
+						  TestOnestring::TestStringType::STR_UNICODE));
+		register_test("O-tB205h",
+					  new TestOnestring_Compare(
+						  TestOnestring::TestStringType::OSTR_ASCII));
+		register_test("O-tB205i",
+					  new TestOnestring_Compare(
+						  TestOnestring::TestStringType::OSTR_UNICODE));
+
+		register_test("O-tB206a",
+					  new TestOnestring_OpLess(
+						  TestOnestring::TestStringType::CHAR));
+		register_test("O-tB206b",
+					  new TestOnestring_OpLess(
+						  TestOnestring::TestStringType::OCHAR_ASCII));
+		register_test("O-tB206c",
+					  new TestOnestring_OpLess(
+						  TestOnestring::TestStringType::OCHAR_UNICODE));
+		register_test("O-tB206d",
+					  new TestOnestring_OpLess(
+						  TestOnestring::TestStringType::CSTR_ASCII));
+		register_test("O-tB206e",
+					  new TestOnestring_OpLess(
+						  TestOnestring::TestStringType::CSTR_UNICODE));
+		register_test("O-tB206f",
+					  new TestOnestring_OpLess(
+						  TestOnestring::TestStringType::STR_ASCII));
+		register_test("O-tB206g",
+					  new TestOnestring_OpLess(
+						  TestOnestring::TestStringType::STR_UNICODE));
+		register_test("O-tB206h",
+					  new TestOnestring_OpLess(
+						  TestOnestring::TestStringType::OSTR_ASCII));
+		register_test("O-tB206i",
+					  new TestOnestring_OpLess(
+						  TestOnestring::TestStringType::OSTR_UNICODE));
+
+		register_test("O-tB207a",
+					  new TestOnestring_OpLessEqual(
+						  TestOnestring::TestStringType::CHAR));
+		register_test("O-tB207b",
+					  new TestOnestring_OpLessEqual(
+						  TestOnestring::TestStringType::OCHAR_ASCII));
+		register_test("O-tB207c",
+					  new TestOnestring_OpLessEqual(
+						  TestOnestring::TestStringType::OCHAR_UNICODE));
+		register_test("O-tB207d",
+					  new TestOnestring_OpLessEqual(
+						  TestOnestring::TestStringType::CSTR_ASCII));
+		register_test("O-tB207e",
+					  new TestOnestring_OpLessEqual(
+						  TestOnestring::TestStringType::CSTR_UNICODE));
+		register_test("O-tB207f",
+					  new TestOnestring_OpLessEqual(
+						  TestOnestring::TestStringType::STR_ASCII));
+		register_test("O-tB207g",
+					  new TestOnestring_OpLessEqual(
+						  TestOnestring::TestStringType::STR_UNICODE));
+		register_test("O-tB207h",
+					  new TestOnestring_OpLessEqual(
+						  TestOnestring::TestStringType::OSTR_ASCII));
+		register_test("O-tB207i",
+					  new TestOnestring_OpLessEqual(
+						  TestOnestring::TestStringType::OSTR_UNICODE));
+
+		register_test("O-tB208a",
+					  new TestOnestring_OpGreater(
+						  TestOnestring::TestStringType::CHAR));
+		register_test("O-tB208b",
+					  new TestOnestring_OpGreater(
+						  TestOnestring::TestStringType::OCHAR_ASCII));
+		register_test("O-tB208c",
+					  new TestOnestring_OpGreater(
+						  TestOnestring::TestStringType::OCHAR_UNICODE));
+		register_test("O-tB208d",
+					  new TestOnestring_OpGreater(
+						  TestOnestring::TestStringType::CSTR_ASCII));
+		register_test("O-tB208e",
+					  new TestOnestring_OpGreater(
+						  TestOnestring::TestStringType::CSTR_UNICODE));
+		register_test("O-tB208f",
+					  new TestOnestring_OpGreater(
+						  TestOnestring::TestStringType::STR_ASCII));
+		register_test("O-tB208g",
 					  new TestOnestring_OpGreater(
 						  TestOnestring::TestStringType::STR_UNICODE));
 		register_test("O-tB208h",
@@ -3315,12 +5084,59 @@ public:
 						  TestOnestring::TestStringType::OSTR_UNICODE));
 
 		register_test("O-tB241", new TestOnestring_Cast());
-
-		// tB4035: find
-		// tB4036: find_first_not_of
-		// tB4037: find_first_of
-		// tB4038: find_last_not_of
-		// tB4039: rfind
+		register_test("O-tB242", new TestOnestring_UTF16());
+		register_test("O-tB243", new TestOnestring_UTF32());
+		register_test("O-tB244", new TestOnestring_Policy());
+		register_test("O-tB245", new TestOnestring_Codepoints());
+		register_test("O-tB246", new TestOnestring_Case());
+		register_test("O-tB247", new TestOnestring_Normalize());
+		register_test("O-tB248", new TestOnestring_NormalizeConformance());
+		register_test("O-tB249", new TestOnestring_CaseFold());
+		register_test("O-tB250", new TestOnestring_Classify());
+		register_test("O-tB251", new TestOnestring_DisplayWidth());
+		register_test("O-tB252", new TestOnestring_CompareOrder());
+		register_test("O-tB253", new TestOnestring_EqualsLength());
+		register_test("O-tB254", new TestOnestring_Hash());
+		register_test("O-tB255", new TestOnestring_FindSubstring());
+		register_test("O-tB256", new TestOnestring_RfindSubstring());
+		register_test("O-tB257", new TestOnestring_FindCharset());
+		register_test("O-tB258", new TestOnestring_FindChar());
+		register_test("O-tB259", new TestOnestring_FindBytes());
+		register_test("O-tB260", new TestOnestring_ReadNull());
+		register_test("O-tB261", new TestOnestring_FindBytesPeriodic());
+
+		register_test("O-tP201",
+					  new TestOnestring_DisplayWidthMixed(),
+					  true,
+					  new TestOnestring_DisplayWidthMixedWcwidth());
+		register_test("O-tP202",
+					  new TestOnestring_EqualsLiteral(),
+					  true,
+					  new TestOnestring_EqualsLiteralStd());
+		register_test("O-tP203",
+					  new TestOnestring_HashLookup(),
+					  true,
+					  new TestOnestring_HashLookupStd());
+		register_test("O-tP204",
+					  new TestOnestring_FindLog(),
+					  true,
+					  new TestOnestring_FindLogStd());
+		register_test("O-tP205",
+					  new TestOnestring_RfindLog(),
+					  true,
+					  new TestOnestring_RfindLogStd());
+		register_test("O-tP206",
+					  new TestOnestring_Tokenize(),
+					  true,
+					  new TestOnestring_TokenizeStd());
+		register_test("O-tP207",
+					  new TestOnestring_CountLines(),
+					  true,
+					  new TestOnestring_CountLinesStd());
+		register_test("O-tP208",
+					  new TestOnestring_FindLiteral(),
+					  true,
+					  new TestOnestring_FindLiteralStd());
 
 		// TODO: Comparative tests against std::string
 	}
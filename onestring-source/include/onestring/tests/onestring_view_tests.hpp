@@ -0,0 +1,191 @@
+/** Tests for Onestring View
+ * Version: 1.0
+ *
+ * Author(s): Jason C. McDonald
+ */
+
+/* LICENSE (BSD-3-Clause)
+ * Copyright (c) 2016-2021 MousePaw Media.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * CONTRIBUTING
+ * See https://www.mousepawmedia.com/developers for information
+ * on how to contribute to our projects.
+ */
+
+#ifndef ONESTRING_VIEW_TESTS_HPP
+#define ONESTRING_VIEW_TESTS_HPP
+
+#include <string>
+
+#include "onestring/onestring.hpp"
+#include "onestring/onestring_view.hpp"
+
+#include "goldilocks/goldilocks.hpp"
+#include "goldilocks/assertions.hpp"
+#include "iosqueak/channel.hpp"
+
+// O-tB401
+class TestOnestringView_Access : public Test
+{
+protected:
+	onestring start = "The quick brown 🦊 jumped over the lazy 🐶.";
+
+public:
+	TestOnestringView_Access() {}
+
+	testdoc_t get_title() override { return "Onestring View: Access"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test accessing the characters of a view, and views of views.";
+	}
+
+	bool run() override
+	{
+		onestring_view view = start.view();
+		PL_ASSERT_EQUAL(view.length(), 41u);
+		PL_ASSERT_EQUAL(view.size(), start.size());
+		PL_ASSERT_EQUAL(view.data(), &start[0]);
+		PL_ASSERT_EQUAL(view[16], "🦊");
+		PL_ASSERT_EQUAL(view.at(40), '.');
+		PL_ASSERT_EQUAL(view.front(), 'T');
+		PL_ASSERT_EQUAL(view.back(), '.');
+
+		bool thrown = false;
+		try {
+			view.at(41);
+		} catch (const std::out_of_range&) {
+			thrown = true;
+		}
+		PL_ASSERT_TRUE(thrown);
+
+		onestring_view fox = view.substr(10, 7);
+		PL_ASSERT_EQUAL(fox, "brown 🦊");
+		PL_ASSERT_EQUAL(fox.substr(6), "🦊");
+		PL_ASSERT_TRUE(fox.substr(7).empty());
+		PL_ASSERT_EQUAL(fox.to_string(), std::string("brown 🦊"));
+
+		size_t count = 0;
+		for (const onechar& ch : fox) {
+			PL_ASSERT_EQUAL(ch, start[10 + count++]);
+		}
+		PL_ASSERT_EQUAL(count, 7u);
+		return true;
+	}
+};
+
+// O-tB402
+class TestOnestringView_Equals : public Test
+{
+protected:
+	onestring start = "🦊 and 🐶";
+
+public:
+	TestOnestringView_Equals() {}
+
+	testdoc_t get_title() override { return "Onestring View: Equals"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test comparing views to c-strings, std::strings, and views.";
+	}
+
+	bool run() override
+	{
+		onestring_view view = start.view();
+		PL_ASSERT_EQUAL(view, "🦊 and 🐶");
+		PL_ASSERT_EQUAL(view, std::string("🦊 and 🐶"));
+		PL_ASSERT_NOT_EQUAL(view, "🦊 and");
+		PL_ASSERT_NOT_EQUAL(view, "🦊 and 🐶🐶");
+		PL_ASSERT_NOT_EQUAL(view, "🦊 and \xF0");
+		PL_ASSERT_EQUAL(view.substr(0, 0), "");
+
+		onestring other = "🐶 and 🦊";
+		PL_ASSERT_EQUAL(view.substr(1, 5), other.view(1, 5));
+		PL_ASSERT_NOT_EQUAL(view, other.view());
+		return true;
+	}
+};
+
+// O-tB403
+class TestOnestringView_Onestring : public Test
+{
+protected:
+	onestring start = "The quick brown 🦊 jumped over the lazy 🐶.";
+
+public:
+	TestOnestringView_Onestring() {}
+
+	testdoc_t get_title() override { return "Onestring View: Onestring"; }
+
+	testdoc_t get_docs() override
+	{
+		return "Test creating onestrings from views, and views of onestrings.";
+	}
+
+	bool run() override
+	{
+		onestring test = start.view(4, 5);
+		PL_ASSERT_EQUAL(test, "quick");
+		test.append(start.view(15, 2), 2);
+		PL_ASSERT_EQUAL(test, "quick 🦊 🦊");
+		test.assign(start.view(40));
+		PL_ASSERT_EQUAL(test, ".");
+
+		PL_ASSERT_EQUAL(start.view(16, 100), "🦊 jumped over the lazy 🐶.");
+		PL_ASSERT_TRUE(start.view(41).empty());
+
+		bool thrown = false;
+		try {
+			start.view(42);
+		} catch (const std::out_of_range&) {
+			thrown = true;
+		}
+		PL_ASSERT_TRUE(thrown);
+		return true;
+	}
+};
+
+class TestSuite_OnestringView : public TestSuite
+{
+public:
+	explicit TestSuite_OnestringView() {}
+
+	testdoc_t get_title() override { return "Onestring View Tests"; }
+
+	void load_tests() override
+	{
+		register_test("O-tB401", new TestOnestringView_Access());
+		register_test("O-tB402", new TestOnestringView_Equals());
+		register_test("O-tB403", new TestOnestringView_Onestring());
+	}
+};
+
+#endif  // ONESTRING_VIEW_TESTS_HPP
@@ -0,0 +1,7025 @@
+/** Unicode 14.0.0 Data Tables
+ * Version: 1.0
+ *
+ * Generated by tools/generate_unicode_tables.pl. Do not edit.
+ */
+
+#ifndef ONESTRING_UNICODE_COLLATION_TABLES_HPP
+#define ONESTRING_UNICODE_COLLATION_TABLES_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+/** The Default Unicode Collation Element Table (DUCET) 13.0.0, for the
+ * Unicode Collation Algorithm, leaving out characters that are not in NFD.
+ *
+ * A collation element is packed into 32 bits: bit 30 is set for variable
+ * elements, bits 14 to 29 are the primary weight, bits 5 to 13 are the
+ * secondary weight, and bits 0 to 4 are the tertiary weight.
+ *
+ * The STAGE2 value of a code point with a single collation element is that
+ * element, with DIRECT set. Otherwise, bits 6 and up are the offset of its
+ * collation elements in EXPANSIONS, and bits 0 to 4 are their count; the
+ * CONTRACTION bit is set if the code point begins any contractions. A value
+ * of 0 means the code point is not listed, and has implicit weights. */
+struct onestring_collation_tables
+{
+	/// The STAGE2 value is a collation element.
+	inline static constexpr uint32_t DIRECT = 0x80000000;
+	/// The code point begins a contraction.
+	inline static constexpr uint32_t CONTRACTION = 0x20;
+	/// The bits of a STAGE2 value that count its collation elements.
+	inline static constexpr uint32_t COUNT_MASK = 0x1F;
+	/// The shift of the offset in a STAGE2 value.
+	inline static constexpr unsigned OFFSET_SHIFT = 6;
+	/// The collation element is variable, such as for spaces and punctuation.
+	inline static constexpr uint32_t VARIABLE = 0x40000000;
+
+	/** A sequence of up to three code points with its own collation
+	 * elements. Unused code points in the sequence are zero. */
+	struct contraction
+	{
+		char32_t sequence[3];
+		uint32_t offset;
+		uint8_t count;
+	};
+
+	/** A range of code points with implicit weights. The first collation
+	 * element has the primary weight base + ((cp - origin) >> 15), and the
+	 * second has the primary weight ((cp - origin) & 0x7FFF) | 0x8000. */
+	struct implicit_range
+	{
+		char32_t first;
+		char32_t last;
+		uint16_t base;
+		char32_t origin;
+	};
+
+	/// The number of low code point bits that index a block of STAGE2.
+	inline static constexpr unsigned BLOCK_SHIFT = 7;
+
+	/// The block of STAGE2 for each block of code points.
+	inline static constexpr uint16_t STAGE1[7172] = {
+		0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+		16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+		32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+		48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 60, 62,
+		63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78,
+		79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94,
+		95, 96, 97, 98, 99, 100, 101, 102, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 103, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+		120, 121, 122, 123, 124, 125, 126, 127, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 128,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 129, 60, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139,
+		140, 141, 142, 143, 60, 144, 145, 146, 147, 148, 149, 60, 150, 151, 152, 60,
+		153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 60, 164, 165, 166, 167,
+		168, 169, 170, 171, 172, 173, 174, 60, 175, 176, 60, 177, 178, 179, 180, 60,
+		181, 182, 183, 184, 185, 186, 60, 60, 187, 188, 189, 190, 60, 191, 60, 192,
+		193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		204, 205, 206, 207, 208, 209, 210, 211, 212, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 213, 214, 215, 216, 217, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		218, 219, 220, 221, 222, 223, 224, 225, 60, 60, 60, 60, 226, 227, 228, 229,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		230, 231, 232, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 233, 234, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		235, 236, 237, 238, 239, 240, 241, 60, 242, 243, 244, 245, 246, 247, 248, 249,
+		250, 251, 252, 253, 254, 255, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		256, 60, 257, 60, 60, 258, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		259, 260, 261, 60, 60, 60, 60, 60, 262, 263, 264, 60, 265, 266, 60, 60,
+		267, 268, 269, 270, 271, 60, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281,
+		282, 283, 284, 285, 286, 287, 288, 289, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+		290, 60, 291, 292,
+	};
+
+	/// The value of each code point in a block.
+	inline static constexpr uint32_t STAGE2[37504] = {
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0xC0804402, 0xC0808402, 0xC080C402, 0xC0810402, 0xC0814402, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0xC0824402, 0xC099C402, 0xC0C74402, 0xC0EB0402, 0x87D90402, 0xC0EB4402, 0xC0EA4402, 0xC0C58402,
+		0xC0CA0402, 0xC0CA4402, 0xC0E84402, 0xC1998402, 0xC088C402, 0xC0834402, 0xC09F8402, 0xC0E98402,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0xC0900402, 0xC08E8402, 0xC19A8402, 0xC19AC402, 0xC19B0402, 0xC09B4402,
+		0xC0E80402, 0x87E88408, 0x87EF0408, 0x87F58408, 0x87FAC408, 0x8801C408, 0x88108408, 0x88144408,
+		0x881D4408, 0x88240408, 0x882AC408, 0x88310408, 0x000314E1, 0x88424408, 0x88460408, 0x884F0408,
+		0x885AC408, 0x88600408, 0x8864C408, 0x88748408, 0x887DC408, 0x8885C408, 0x8891C408, 0x88964408,
+		0x88990408, 0x889C0408, 0x88A18408, 0xC0CA8402, 0xC0E9C402, 0xC0CAC402, 0xC12DC402, 0xC082C402,
+		0xC12D0402, 0x87E88402, 0x87EF0402, 0x87F58402, 0x87FAC402, 0x8801C402, 0x88108402, 0x88144402,
+		0x881D4402, 0x88240402, 0x882AC402, 0x88310402, 0x000134A1, 0x88424402, 0x88460402, 0x884F0402,
+		0x885AC402, 0x88600402, 0x8864C402, 0x88748402, 0x887DC402, 0x8885C402, 0x8891C402, 0x88964402,
+		0x88990402, 0x889C0402, 0x88A18402, 0xC0CB0402, 0xC19B8402, 0xC0CB4402, 0xC19C0402, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0xC0818402, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0xC082441B, 0xC09A0402, 0x87D8C402, 0x87D94402, 0x87D88402, 0x87D98402, 0xC19BC402, 0xC0E68402,
+		0xC12EC402, 0xC1748402, 0x87E88414, 0xC0C98402, 0xC19B4402, 0x80000000, 0xC1750402, 0xC12E0402,
+		0xC14A8402, 0xC199C402, 0x87E68414, 0x87E6C414, 0xC12D4402, 0x88CC0404, 0xC0E70402, 0xC0A4C402,
+		0xC12F8402, 0x87E64414, 0x884F0414, 0xC0C9C402, 0x000212C3, 0x0000F943, 0x00012883, 0xC09B8402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0001FF43, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x0003CA42, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xC19A4402,
+		0x00049682, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x88AD4408, 0x0001D8C3,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00044EC3, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00041A42, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xC19A0402,
+		0x00044842, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x88AD4402, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x0001EB82, 0x0000B202, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00025882, 0x00026742,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x88250402, 0x0000AF82, 0x0001F482, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8863C402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00023EC2,
+		0x00015B42, 0x00003582, 0x000349C2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x0003E982, 0x884DC408, 0x884DC402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x0002B8C3, 0x00041103, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x887F0408, 0x887F0402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000085C2,
+		0x87F10402, 0x87F34408, 0x87F44408, 0x87F44402, 0x88B58408, 0x88B58402, 0x8853C408, 0x87F84408,
+		0x87F84402, 0x87FD0408, 0x87FE0408, 0x87FF4408, 0x87FF4402, 0x0001FE42, 0x88054408, 0x88068408,
+		0x8807C408, 0x8812C408, 0x8812C402, 0x8818C408, 0x881B4408, 0x881F4402, 0x88298408, 0x8827C408,
+		0x88328408, 0x88328402, 0x88384402, 0x88404402, 0x888E0408, 0x8848C408, 0x8849C402, 0x88570408,
+		0x00000000, 0x00000000, 0x881C4408, 0x881C4402, 0x885D0408, 0x885D0402, 0x88660408, 0x88B38408,
+		0x88B38402, 0x88790408, 0x887A8402, 0x88808402, 0x88818408, 0x88818402, 0x88828408, 0x00000000,
+		0x00000000, 0x88908408, 0x88938408, 0x889F0408, 0x889F0402, 0x88A2C408, 0x88A2C402, 0x88A8C408,
+		0x88AA0408, 0x88AA0402, 0x88AB4402, 0x88B1C402, 0x88B48408, 0x88B48402, 0x0000AC42, 0x88AEC402,
+		0x88BF8402, 0x88C08402, 0x88C18402, 0x88C28402, 0x00021C83, 0x0000F683, 0x00022603, 0x00028602,
+		0x0001CDC2, 0x0003BF02, 0x00035642, 0x000011C2, 0x00030382, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x88054402, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x88178408, 0x88178402, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00028BC2, 0x0000E782, 0x000246C2, 0x00000000, 0x00000000, 0x881F4408, 0x88AEC408,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x88A08408, 0x88A08402, 0x00000000, 0x00000000,
+		0x8849C408, 0x88004402, 0x88598408, 0x88598402, 0x88A44408, 0x88A44402, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x883DC402, 0x884C4402, 0x88838402, 0x882BC402,
+		0x0002C742, 0x00012802, 0x87E9C408, 0x87F6C408, 0x87F6C402, 0x88384408, 0x88800408, 0x88778402,
+		0x88A74402, 0x88B78408, 0x88B78402, 0x87F10408, 0x88888408, 0x88954408, 0x88038408, 0x88038402,
+		0x882D0408, 0x882D0402, 0x8862C408, 0x8862C402, 0x8867C408, 0x8867C402, 0x889E0408, 0x889E0402,
+		0x87EB4402, 0x87EC4402, 0x87EDC402, 0x87F34402, 0x8853C402, 0x87F94402, 0x87FD0402, 0x87FE0402,
+		0x88090402, 0x88068402, 0x880A0402, 0x8807C402, 0x880B0402, 0x880C8402, 0x880D8402, 0x882F0402,
+		0x8818C402, 0x88154402, 0x88168402, 0x881B4402, 0x880F8402, 0x888B0402, 0x88208402, 0x88228402,
+		0x8827C402, 0x88298402, 0x88260402, 0x88398402, 0x883B0402, 0x883C8402, 0x883F0402, 0x888E0402,
+		0x888F8402, 0x88440402, 0x8848C402, 0x884B4402, 0x88470402, 0x88570402, 0x8850C402, 0x88584402,
+		0x885EC402, 0x88690402, 0x886A4402, 0x886B8402, 0x886CC402, 0x886DC402, 0x886F0402, 0x88704402,
+		0x88660402, 0x88728402, 0x88768402, 0x88790402, 0x88300402, 0x887B8402, 0x887CC402, 0x8884C402,
+		0x88828402, 0x88888402, 0x88908402, 0x88938402, 0x88954402, 0x88980402, 0x88414402, 0x889D0402,
+		0x88A54402, 0x88A64402, 0x88A8C402, 0x88AC4402, 0x88B68402, 0x88BA4402, 0x88BE8402, 0x88C38402,
+		0x88C48402, 0x87F00402, 0x880E8402, 0x8819C402, 0x881E4402, 0x882E0402, 0x88348402, 0x88368402,
+		0x8861C402, 0x88BC8402, 0x88BD8402, 0x00027902, 0x00006182, 0x00019882, 0x00005742, 0x00046F02,
+		0x00001FC2, 0x00033D02, 0x0003EDC2, 0x0001D0C2, 0x88C58402, 0x88C68402, 0x888C0402, 0x888D0402,
+		0x881D4414, 0x88208414, 0x882AC414, 0x8864C414, 0x88690414, 0x886B8414, 0x88728414, 0x88964414,
+		0x889C0414, 0xC1314402, 0xC131C402, 0x88238402, 0x88B8C402, 0x8823C402, 0x88B94402, 0x88BB4402,
+		0x88B88402, 0x88BB8402, 0xC1320402, 0xC1324402, 0xC1328402, 0xC132C402, 0xC1330402, 0xC1334402,
+		0xC1338402, 0xC133C402, 0xC1340402, 0xC1344402, 0xC1348402, 0xC134C402, 0xC1350402, 0xC1354402,
+		0x87D18402, 0x87D1C402, 0xC1358402, 0xC135C402, 0xC1360402, 0xC1364402, 0xC1370402, 0xC1374402,
+		0xC12E4402, 0xC12E8402, 0xC12F0402, 0xC12FC402, 0xC12D8402, 0xC12F4402, 0xC1378402, 0xC137C402,
+		0x881B4414, 0x88358414, 0x88748414, 0x88990414, 0x88BA4414, 0xC1380402, 0xC1384402, 0xC1388402,
+		0xC138C402, 0xC1390402, 0xC1394402, 0xC1398402, 0xC139C402, 0xC13A0402, 0x88B90402, 0xC13A4402,
+		0xC13A8402, 0xC13AC402, 0xC13B0402, 0xC13B4402, 0xC13B8402, 0xC13BC402, 0xC13C0402, 0xC13C4402,
+		0xC13C8402, 0xC13CC402, 0xC13D0402, 0xC13D4402, 0xC13D8402, 0xC13DC402, 0xC13E0402, 0xC13E4402,
+		0x800004A2, 0x80000482, 0x800004E2, 0x800005A2, 0x80000642, 0x80000742, 0x800004C2, 0x800005C2,
+		0x80000562, 0x80000762, 0x80000522, 0x80000582, 0x80000502, 0x80000662, 0x80000662, 0x80000782,
+		0x800007A2, 0x800007C2, 0x80000662, 0x80000442, 0x80000462, 0x80000662, 0x80000682, 0x80000682,
+		0x80000682, 0x80000682, 0x80000662, 0x800007E2, 0x80000682, 0x80000682, 0x80000682, 0x80000682,
+		0x80000682, 0x80000802, 0x80000822, 0x80000842, 0x80000862, 0x80000882, 0x800008A2, 0x80000602,
+		0x80000622, 0x80000682, 0x80000682, 0x80000682, 0x80000682, 0x800008C2, 0x800008E2, 0x80000682,
+		0x80000902, 0x80000922, 0x80000422, 0x80000682, 0x80000942, 0x80000722, 0x800006A2, 0x800006A2,
+		0x800005E2, 0x80000962, 0x80000682, 0x80000682, 0x80000682, 0x80000662, 0x80000662, 0x80000662,
+		0x00000000, 0x00000000, 0x80000542, 0x00000000, 0x00000000, 0x80000982, 0x80000662, 0x80000682,
+		0x80000682, 0x80000682, 0x80000662, 0x80000662, 0x80000662, 0x80000682, 0x80000682, 0x80000000,
+		0x80000662, 0x80000662, 0x80000662, 0x80000682, 0x80000682, 0x80000682, 0x80000682, 0x80000662,
+		0x800009A2, 0x80000682, 0x80000682, 0x80000662, 0x80000682, 0x80000662, 0x80000662, 0x80000682,
+		0x800009C2, 0x800009E2, 0x80000682, 0x87E88404, 0x8801C404, 0x88240404, 0x884F0404, 0x8885C404,
+		0x87F58404, 0x87FAC404, 0x881D4404, 0x88424404, 0x8864C404, 0x887DC404, 0x8891C404, 0x88990404,
+		0x88CA0408, 0x88CA0402, 0x88D24408, 0x88D24402, 0x00000000, 0xC1318402, 0x88C94408, 0x88C94402,
+		0x00000000, 0x00000000, 0x88CAC404, 0x88CF8402, 0x88CF4402, 0x88CFC402, 0x00000000, 0x88CB0408,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xC12D4402, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x88C78408, 0x88C7C408, 0x88C80408, 0x88C88408, 0x88C8C408, 0x88C9C408, 0x88CA4408,
+		0x88CA8408, 0x88CAC408, 0x88CB4408, 0x88CB8408, 0x88CC0408, 0x88CC4408, 0x88CC8408, 0x88CCC408,
+		0x88CD0408, 0x88CE4408, 0x00000000, 0x88CF0408, 0x88D00408, 0x88D04408, 0x88D08408, 0x88D0C408,
+		0x88D10408, 0x88D18408, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x88C78402, 0x88C7C402, 0x88C80402, 0x88C88402, 0x88C8C402, 0x88C9C402, 0x88CA4402,
+		0x88CA8402, 0x88CAC402, 0x88CB4402, 0x88CB8402, 0x88CC0402, 0x88CC4402, 0x88CC8402, 0x88CCC402,
+		0x88CD0402, 0x88CE4402, 0x88CF0419, 0x88CF0402, 0x88D00402, 0x88D04402, 0x88D08402, 0x88D0C402,
+		0x88D10402, 0x88D18402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00040243,
+		0x88C7C404, 0x88CA8404, 0x88D0440A, 0x00000000, 0x00000000, 0x88D08404, 0x88CD0404, 0x0000B8C3,
+		0x88CE0408, 0x88CE0402, 0x88C98408, 0x88C98402, 0x88C90408, 0x88C90402, 0x88CDC408, 0x88CDC402,
+		0x88D20408, 0x88D20402, 0x88DA8408, 0x88DA8402, 0x88DBC408, 0x88DBC402, 0x88DC0408, 0x88DC0402,
+		0x88DCC408, 0x88DCC402, 0x88DE8408, 0x88DE8402, 0x88DF4408, 0x88DF4402, 0x88E04408, 0x88E04402,
+		0x88CB4404, 0x88CE4404, 0x88CF0404, 0x88CB0402, 0x88CA840A, 0x88C8C404, 0xC1984402, 0x88D28408,
+		0x88D28402, 0x88CF040A, 0x88CD8408, 0x88CD8402, 0x88CEC402, 0x88CF8408, 0x88CF4408, 0x88CFC408,
+		0x00000000, 0x00000000, 0x88ED4408, 0x00000000, 0x88F0C408, 0x88F64408, 0x88FB4408, 0x00000000,
+		0x88FD8408, 0x89084408, 0x8911C408, 0x891F8408, 0x00000000, 0x00000000, 0x00000000, 0x89390408,
+		0x88E1C408, 0x88E4C408, 0x88E5C408, 0x88E6C408, 0x88EBC408, 0x88EFC408, 0x88F1C408, 0x88F44408,
+		0x0003B1A1, 0x00000000, 0x88FEC408, 0x89054408, 0x890A0408, 0x890C4408, 0x89130408, 0x89150408,
+		0x89184408, 0x891A8408, 0x891CC408, 0x89208408, 0x8924C408, 0x8925C408, 0x892F8408, 0x89324408,
+		0x893A0408, 0x893B4408, 0x893D0408, 0x893E4408, 0x893F4408, 0x89428408, 0x89438408, 0x89450408,
+		0x88E1C402, 0x88E4C402, 0x88E5C402, 0x88E6C402, 0x88EBC402, 0x88EFC402, 0x88F1C402, 0x88F44402,
+		0x00023921, 0x00000000, 0x88FEC402, 0x89054402, 0x890A0402, 0x890C4402, 0x89130402, 0x89150402,
+		0x89184402, 0x891A8402, 0x891CC402, 0x89208402, 0x8924C402, 0x8925C402, 0x892F8402, 0x89324402,
+		0x893A0402, 0x893B4402, 0x893D0402, 0x893E4402, 0x893F4402, 0x89428402, 0x89438402, 0x89450402,
+		0x00000000, 0x00000000, 0x88ED4402, 0x00000000, 0x88F0C402, 0x88F64402, 0x88FB4402, 0x00000000,
+		0x88FD8402, 0x89084402, 0x8911C402, 0x891F8402, 0x00000000, 0x00000000, 0x00000000, 0x89390402,
+		0x892B4408, 0x892B4402, 0x89414408, 0x89414402, 0x89464408, 0x89464402, 0x89474408, 0x89474402,
+		0x8949C408, 0x8949C402, 0x89488408, 0x89488402, 0x894B0408, 0x894B0402, 0x894C0408, 0x894C0402,
+		0x894D0408, 0x894D0402, 0x894E0408, 0x894E0402, 0x894F0408, 0x894F0402, 0x00000000, 0x00000000,
+		0x8923C408, 0x8923C402, 0x892E8408, 0x892E8402, 0x892D8408, 0x892D8402, 0x892C4408, 0x892C4402,
+		0x89174408, 0x89174402, 0xC14AC402, 0x80000A02, 0x80000662, 0x80000462, 0x80000442, 0x80000662,
+		0x80000000, 0x80000000, 0x88FA4408, 0x88FA4402, 0x89404408, 0x89404402, 0x89194408, 0x89194402,
+		0x00034DC2, 0x0004BD42, 0x88E7C408, 0x88E7C402, 0x88E9C408, 0x88E9C402, 0x88F34408, 0x88F34402,
+		0x88EEC408, 0x88EEC402, 0x88FFC408, 0x88FFC402, 0x8903C408, 0x8903C402, 0x8902C408, 0x8902C402,
+		0x8901C408, 0x8901C402, 0x890E8408, 0x890E8402, 0x8910C408, 0x8910C402, 0x89164408, 0x89164402,
+		0x89504408, 0x89504402, 0x891BC408, 0x891BC402, 0x891E4408, 0x891E4402, 0x89218408, 0x89218402,
+		0x89228408, 0x89228402, 0x8928C408, 0x8928C402, 0x89310408, 0x89310402, 0x8933C408, 0x8933C402,
+		0x8935C408, 0x8935C402, 0x8929C408, 0x8929C402, 0x89370408, 0x89370402, 0x89380408, 0x89380402,
+		0x89518408, 0x00000000, 0x00000000, 0x8900C408, 0x8900C402, 0x89068408, 0x89068402, 0x890F8408,
+		0x890F8402, 0x890D8408, 0x890D8402, 0x8934C408, 0x8934C402, 0x890B0408, 0x890B0402, 0x89518402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x88E3C408, 0x88E3C402, 0x00000000, 0x00000000,
+		0x88E2C408, 0x88E2C402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x88F78408, 0x88F78402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x89140408, 0x89140402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x88EAC408, 0x88EAC402,
+		0x00000000, 0x00000000, 0x88E8C408, 0x88E8C402, 0x8926C408, 0x8926C402, 0x8927C408, 0x8927C402,
+		0x88ECC408, 0x88ECC402, 0x88EE8408, 0x88EE8402, 0x88F58408, 0x88F58402, 0x88F8C408, 0x88F8C402,
+		0x89098408, 0x89098402, 0x8912C408, 0x8912C402, 0x891B8408, 0x891B8402, 0x891E0408, 0x891E0402,
+		0x88F5C408, 0x88F5C402, 0x8907C408, 0x8907C402, 0x8909C408, 0x8909C402, 0x891A4408, 0x891A4402,
+		0x89460408, 0x89460402, 0x89050408, 0x89050402, 0x89514408, 0x89514402, 0x8904C408, 0x8904C402,
+		0x89080408, 0x89080402, 0x89108408, 0x89108402, 0x89160408, 0x89160402, 0x892AC408, 0x892AC402,
+		0x890D4408, 0x890D4402, 0x88F2C408, 0x88F2C402, 0x89334408, 0x89334402, 0x89078408, 0x89078402,
+		0x00000000, 0x897D4408, 0x897DC408, 0x897E0408, 0x897E4408, 0x897E8408, 0x897EC408, 0x897F0408,
+		0x897F4408, 0x897F8408, 0x897FC408, 0x89800408, 0x89804408, 0x89808408, 0x8980C408, 0x89810408,
+		0x89814408, 0x89818408, 0x8981C408, 0x89820408, 0x89824408, 0x89828408, 0x89830408, 0x89834408,
+		0x89838408, 0x8983C408, 0x89840408, 0x89844408, 0x89848408, 0x8984C408, 0x89850408, 0x89854408,
+		0x89858408, 0x8985C408, 0x89860408, 0x89864408, 0x89868408, 0x8986C408, 0x89870408, 0x00000000,
+		0x00000000, 0x89874402, 0xC0F90402, 0xC0F94402, 0xC09A4402, 0xC08A8402, 0xC09C0402, 0xC0F98402,
+		0x897D8402, 0x897D4402, 0x897DC402, 0x897E0402, 0x897E4402, 0x897E8402, 0x897EC402, 0x897F0402,
+		0x897F4402, 0x897F8402, 0x897FC402, 0x89800402, 0x89804402, 0x89808402, 0x8980C402, 0x89810402,
+		0x89814402, 0x89818402, 0x8981C402, 0x89820402, 0x89824402, 0x89828402, 0x89830402, 0x89834402,
+		0x89838402, 0x8983C402, 0x89840402, 0x89844402, 0x89848402, 0x8984C402, 0x89850402, 0x89854402,
+		0x89858402, 0x8985C402, 0x89860402, 0x89864402, 0x89868402, 0x8986C402, 0x89870402, 0x00038902,
+		0x8982C402, 0xC0904402, 0xC0838402, 0x00000000, 0x00000000, 0xC14B0402, 0xC14B4402, 0x87D9C402,
+		0x00000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000A42, 0x80000A62, 0x80000A82, 0x80000AA2, 0x80000AC2, 0x80000AE2, 0x80000B02, 0x80000B22,
+		0x80000B42, 0x80000B62, 0x80000B62, 0x80000B82, 0x80000BE2, 0x80000000, 0xC0F9C402, 0x80000C02,
+		0xC0FA0402, 0x80000BC2, 0x80000BA2, 0xC0FA4402, 0x80000000, 0x80000000, 0xC0FA8402, 0x80000B42,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x89878402, 0x8987C402, 0x89880402, 0x89884402, 0x89888402, 0x8988C402, 0x89890402, 0x89894402,
+		0x89898402, 0x8989C402, 0x898A0419, 0x898A0402, 0x898A4402, 0x898A8419, 0x898A8402, 0x898AC419,
+		0x898AC402, 0x898B0402, 0x898B4402, 0x898B8419, 0x898B8402, 0x898BC419, 0x898BC402, 0x898C0402,
+		0x898C4402, 0x898C8402, 0x898CC402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0003F604,
+		0x0001CC82, 0x0000DA42, 0x0002C602, 0xC0FAC402, 0xC0FB0402, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0xC19F4402, 0xC19FC402,
+		0xC14B8402, 0xC0EC0402, 0xC0EC8402, 0x87DA0402, 0xC08AC402, 0xC08B0402, 0xC14C4402, 0xC14C8402,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0xC08EC402, 0x80000000, 0x00000000, 0xC0908402, 0xC09C4402,
+		0x89D00402, 0x89990402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00021221,
+		0x899D0402, 0x89A10402, 0x89A14402, 0x89A18402, 0x89A3C402, 0x89A64402, 0x89A68402, 0x89A90402,
+		0x89A94402, 0x89ACC402, 0x89AD0402, 0x89B18402, 0x89B1C402, 0x89B44402, 0x89B48402, 0x89B5C402,
+		0x89B60402, 0x89B6C402, 0x89B70402, 0x89C1C402, 0x89C20402, 0x89CF4402, 0x89CF8402, 0x89CFC402,
+		0x80000000, 0x89B90402, 0x89BC0402, 0x89BD8402, 0x89C30402, 0x89C50402, 0x89C60402, 0x89C88402,
+		0x0002C6A1, 0x89CD8402, 0x000138A1, 0x80000DA2, 0x80000E02, 0x80000E62, 0x80000EC2, 0x80000F42,
+		0x80000FA2, 0x80001002, 0x80001022, 0x80001042, 0x80001062, 0x80001082, 0x800010C2, 0x800010E2,
+		0x80001102, 0x80001142, 0x80001162, 0x80001182, 0x800011A2, 0x800011C2, 0x800011E2, 0x800010A2,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0xC0EB8402, 0xC08B4402, 0xC08B8402, 0xC0E90402, 0x899CC402, 0x89BBC402,
+		0x80001302, 0x899A0402, 0x8999C402, 0x899AC402, 0x89990404, 0x0000F102, 0x00022C82, 0x00028942,
+		0x0001C982, 0x89A1C402, 0x89A20402, 0x899D4402, 0x89A24402, 0x89A28402, 0x899D8402, 0x89A2C402,
+		0x899DC402, 0x89A6C402, 0x89A70402, 0x89A40402, 0x89A44402, 0x89A74402, 0x89A48402, 0x89A50402,
+		0x89A98402, 0x89A9C402, 0x89AA0402, 0x89AA4402, 0x89AA8402, 0x89AAC402, 0x89AB4402, 0x89AB8402,
+		0x89ABC402, 0x89AD4402, 0x89AD8402, 0x89ADC402, 0x89AE0402, 0x89AE4402, 0x89AE8402, 0x89AEC402,
+		0x89AF0402, 0x89AF4402, 0x89B20402, 0x89B24402, 0x89B28402, 0x89B4C402, 0x89B54402, 0x89B64402,
+		0x89B74402, 0x89B94402, 0x89B98402, 0x89BA0402, 0x89BA4402, 0x89BAC402, 0x89BB0402, 0x89BC4402,
+		0x89BCC402, 0x89BDC402, 0x89BE0402, 0x89BE4402, 0x89BE8402, 0x89BF0402, 0x89BF4402, 0x89BFC402,
+		0x89C04402, 0x89C08402, 0x89C0C402, 0x89C10402, 0x89C14402, 0x89C34402, 0x89C38402, 0x89C3C402,
+		0x89C40402, 0x89C78402, 0x89C64402, 0x89C6C402, 0x89C70402, 0x89C74402, 0x89C8C402, 0x89A4C402,
+		0x00000000, 0x89C90402, 0x00000000, 0x89C94402, 0x89CA4402, 0x89CA8402, 0x89CAC402, 0x89CB0402,
+		0x89CB4402, 0x89CB8402, 0x89CBC402, 0x89CC0402, 0x89CE0402, 0x89CE4402, 0x89CE8402, 0x89CC8402,
+		0x89CEC402, 0x89CF0402, 0x89D14402, 0x00000000, 0xC0A00402, 0x89C9C402, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0xC14CC402, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x89CA0404, 0x89CDC404, 0x80000000,
+		0x80000000, 0xC14D0402, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x89AC0402, 0x89AF8402,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0x89B2C402, 0x89B58402, 0x89B7C402, 0x0002A5C2, 0x00027EC2, 0x89C98402,
+		0xC0B34402, 0xC0A04402, 0xC0A08402, 0xC090C402, 0xC0910402, 0xC0914402, 0xC0918402, 0xC091C402,
+		0xC0920402, 0xC09C8402, 0xC0FB4402, 0xC0FB8402, 0xC0FBC402, 0xC0FC0402, 0x00000000, 0x80000000,
+		0x89D20402, 0x80001322, 0x89D24402, 0x89D28402, 0x00019082, 0x89D30402, 0x89D2C402, 0x89D34402,
+		0x89D38402, 0x89D3C402, 0x89D44402, 0x89D48402, 0x00027082, 0x89D4C402, 0x89D50402, 0x89D54402,
+		0x89D5C402, 0x89D60402, 0x89D64402, 0x89D68402, 0x89D68419, 0x89D6C402, 0x89D70402, 0x0002C2C2,
+		0x89D78402, 0x89D7C402, 0x89D80402, 0x89D84402, 0x89D88402, 0x00044482, 0x00046682, 0x00047942,
+		0x80001342, 0x80001362, 0x80001382, 0x800013A2, 0x800013C2, 0x800013E2, 0x80001402, 0x80001422,
+		0x80001442, 0x80001462, 0x80001482, 0x800014A2, 0x800014C2, 0x800014E2, 0x80001502, 0x80001522,
+		0x80000000, 0x80000662, 0x80000682, 0x80000000, 0x80000000, 0x80000662, 0x80000682, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x00000000, 0x00000000, 0x89D40402, 0x89D58402, 0x89D74402,
+		0x899E0402, 0x899E4402, 0x899E8402, 0x899EC402, 0x899F0402, 0x899F4402, 0x899FC402, 0x89A78402,
+		0x89A7C402, 0x89AC4402, 0x89AC8402, 0x89AFC402, 0x89B30402, 0x89B80402, 0x89B84402, 0x89B88402,
+		0x89BB4402, 0x89BB8402, 0x89C18402, 0x89C24402, 0x89C28402, 0x89C54402, 0x89C58402, 0x89C7C402,
+		0x89C80402, 0x89C84402, 0x89C44402, 0x89B00402, 0x89B04402, 0x89B34402, 0x89A80402, 0x89A84402,
+		0x89B38402, 0x89B08402, 0x89A88402, 0x899B0402, 0x899B4402, 0x89D04402, 0x89D08402, 0x89D0C402,
+		0x89CCC402, 0x89CD0402, 0x89D18402, 0x89D1C402, 0x89A8C402, 0x89B3C402, 0x89B40402, 0x89BEC402,
+		0x89E1C402, 0x89E28402, 0x89E2C402, 0x89E30402, 0x89E38402, 0x89E3C402, 0x89E40402, 0x89E44402,
+		0x89E50402, 0x89E58402, 0x89E5C402, 0x89E60402, 0x89E68402, 0x89E78402, 0x89E7C402, 0x89E84402,
+		0x89E88402, 0x89E98402, 0x89E9C402, 0x89EA0402, 0x89EA4402, 0x89EA8402, 0x89EAC402, 0x89EB0402,
+		0x89E6C402, 0x89E20402, 0x89E24402, 0x89E64402, 0x89E34402, 0x89E8C402, 0x89E90402, 0x89E94402,
+		0x89E70402, 0x89E74402, 0x89E48402, 0x89E4C402, 0x89E80402, 0x89E54402, 0x89EB8402, 0x89EBC402,
+		0x89EC0402, 0x89EC4402, 0x89EC8402, 0x89ECC402, 0x89ED0402, 0x89ED4402, 0x89ED8402, 0x89EDC402,
+		0x89EE0402, 0x89EB4402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0x89EE4402, 0x89EE8402, 0x89EEC402, 0x89EF0402, 0x89EF4402, 0x89EF8402,
+		0x89EFC402, 0x89F00402, 0x89F04402, 0x89F08402, 0x89F0C402, 0x89F10402, 0x89F14402, 0x89F18402,
+		0x89F1C402, 0x89F20402, 0x89F24402, 0x89F28402, 0x89F2C402, 0x89F30402, 0x89F34402, 0x89F38402,
+		0x89F3C402, 0x89F40402, 0x89F44402, 0x89F48402, 0x89F4C402, 0x89F50402, 0x89F54402, 0x89F58402,
+		0x00049902, 0x0001C602, 0x0000A842, 0x80001542, 0x80001562, 0x80001582, 0x800015A2, 0x800015C2,
+		0x800015E2, 0x80001602, 0x80001622, 0x80001642, 0x89F5C402, 0x89F60402, 0xC1518402, 0xC0B38402,
+		0xC08BC402, 0xC09A8402, 0x80000000, 0x00000000, 0x00000000, 0x80000682, 0x87DA4402, 0x87DA8402,
+		0x89928402, 0x8992C402, 0x89930402, 0x89934402, 0x89938402, 0x8993C402, 0x89940402, 0x89944402,
+		0x89948402, 0x8994C402, 0x89950402, 0x89954402, 0x89958402, 0x8995C402, 0x89960402, 0x89964402,
+		0x89968402, 0x8996C402, 0x89970402, 0x89974402, 0x89978402, 0x8997C402, 0x89980402, 0x89984402,
+		0x80000D42, 0x80000D62, 0x89988402, 0x8998C402, 0x80000C42, 0x80000C42, 0x80000C62, 0x80000C62,
+		0x80000C62, 0x80000C82, 0x80000C82, 0x80000C82, 0x80000CA2, 0x80000CA2, 0x80000CC2, 0x80000CC2,
+		0x80000CE2, 0x80000CE2, 0x80000CE2, 0x80000D02, 0x80000D22, 0x80000D82, 0x00000000, 0x00000000,
+		0xC0924402, 0xC0928402, 0xC092C402, 0xC0930402, 0xC0934402, 0xC0938402, 0xC093C402, 0xC0940402,
+		0xC0944402, 0xC0948402, 0xC094C402, 0xC0950402, 0xC0954402, 0xC0958402, 0xC095C402, 0x00000000,
+		0x89DB8402, 0x89DBC402, 0x89DC0402, 0x89DC4402, 0x89DC8402, 0x89DCC402, 0x89DD0402, 0x89DD4402,
+		0x89DD8402, 0x89DDC402, 0x89DE0402, 0x89DE4402, 0x89DE8402, 0x89DEC402, 0x89DF0402, 0x89DF4402,
+		0x89DF8402, 0x89DFC402, 0x89E00402, 0x89E04402, 0x89E08402, 0x89E0C402, 0x89E10402, 0x89E14402,
+		0x89E18402, 0x80000682, 0x80000682, 0x80000682, 0x00000000, 0x00000000, 0xC0FC4402, 0x00000000,
+		0x89D8C402, 0x89D90402, 0x89D94402, 0x89D98402, 0x89D9C402, 0x89DA0402, 0x89DA4402, 0x89DA8402,
+		0x89DAC402, 0x89DB0402, 0x89DB4402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x899F8402, 0x89A04402, 0x89A54402, 0x89B68402, 0x89BA8402, 0x89BD4402, 0x89C48402, 0x89C5C402,
+		0x899BC402, 0x899C0402, 0x89B0C402, 0x89CD4402, 0x899C4402, 0x899C8404, 0x89AB0402, 0x89B50402,
+		0x89C00402, 0x89CC4402, 0x89B10402, 0x89B8C402, 0x89BF8402, 0x00000000, 0x89A08402, 0x89A0C402,
+		0x89A30402, 0x89B14402, 0x89D10402, 0x89B9C402, 0x89BC8402, 0x89C68402, 0x89A00402, 0x89A34402,
+		0x89A38402, 0x89A58402, 0x89C2C402, 0x89B78402, 0x89BD0402, 0x89A5C402, 0x89A60402, 0x89C4C402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80001202, 0x80000EE2, 0x80000F62, 0x80000FC2, 0x80000DE2,
+		0x80000E42, 0x80000EA2, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000DC2, 0x80000E22, 0x80000E82, 0x80000000, 0x80000F02, 0x80000F22, 0x80000FE2, 0x80001222,
+		0x80001242, 0x800012C2, 0x800012E2, 0x80001282, 0x800012A2, 0x80001262, 0x80000F82, 0x80001122,
+		0x80001862, 0x80001862, 0x80001882, 0x800018A2, 0x8A768402, 0x8A76C402, 0x8A770402, 0x8A788402,
+		0x8A78C402, 0x8A790402, 0x8A794402, 0x8A798402, 0x8A7A0402, 0x8A7A8402, 0x8A7AC402, 0x8A7B0402,
+		0x8A7B4402, 0x8A7BC402, 0x8A7C0402, 0x8A7C4402, 0x8A7C8402, 0x8A7CC402, 0x8A7D0402, 0x8A7D4402,
+		0x8A7DC402, 0x8A7E0402, 0x8A7E4402, 0x8A7E8402, 0x8A7EC402, 0x8A7F8402, 0x8A7FC402, 0x8A800402,
+		0x8A804402, 0x8A80C402, 0x8A814402, 0x8A818402, 0x8A81C402, 0x8A820402, 0x8A824402, 0x8A828402,
+		0x8A82C402, 0x00000000, 0x8A830402, 0x8A834402, 0x8A838402, 0x8A840402, 0x8A844402, 0x8A848402,
+		0x8A850402, 0x00000000, 0x8A854402, 0x8A858402, 0x00000000, 0x8A85C402, 0x8A860402, 0x8A864402,
+		0x8A868402, 0x8A86C402, 0x8A890402, 0x8A894402, 0x80001842, 0x8A870402, 0x8A88C402, 0x8A8A4402,
+		0x8A8A8402, 0x8A8AC402, 0x8A8B0402, 0x8A8B4402, 0x8A8B8402, 0x8A8C4402, 0x8A8CC402, 0x8A8D0402,
+		0x8A8D8402, 0x8A8E0402, 0x8A8E4402, 0x8A8E8402, 0x8A8EC402, 0x8A8F0402, 0x8A8D4402, 0x8A898402,
+		0x8A75C402, 0x80000000, 0x80000000, 0x800004A2, 0x80000482, 0x8A8C8402, 0x8A89C402, 0x8A8A0402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8A79C402, 0x8A7A4402, 0x8A8BC402, 0x8A8C0402, 0xC0A58402, 0xC0A5C402, 0x87E60402, 0x87E64402,
+		0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402, 0x87E80402, 0x87E84402,
+		0xC1000402, 0x87D20402, 0x8A764402, 0x8A774402, 0x8A778402, 0x8A77C402, 0x8A780402, 0x8A784402,
+		0x8A808402, 0x8A7F0402, 0x8A84C402, 0x8A7D8402, 0x8A7F4402, 0x8A874402, 0x8A810402, 0x8A83C402,
+		0x8A8F4402, 0x80001862, 0x80001882, 0x800018A2, 0x00000000, 0x8A8F8402, 0x8A8FC402, 0x8A900402,
+		0x8A904402, 0x8A908402, 0x8A90C402, 0x8A910402, 0x8A918402, 0x00000000, 0x00000000, 0x8A920402,
+		0x8A924402, 0x00000000, 0x00000000, 0x8A928402, 0x8A92C402, 0x8A930402, 0x8A934402, 0x8A938402,
+		0x8A93C402, 0x8A940402, 0x8A944402, 0x8A948402, 0x8A94C402, 0x8A950402, 0x8A954402, 0x8A958402,
+		0x8A95C402, 0x8A960402, 0x8A964402, 0x8A968402, 0x8A96C402, 0x8A970402, 0x8A974402, 0x8A978402,
+		0x8A97C402, 0x00000000, 0x8A980402, 0x8A984402, 0x8A988402, 0x8A98C402, 0x8A990402, 0x8A994402,
+		0x8A998402, 0x00000000, 0x8A9A0402, 0x00000000, 0x00000000, 0x00000000, 0x8A9A8402, 0x8A9AC402,
+		0x8A9B0402, 0x8A9B4402, 0x00000000, 0x00000000, 0x80001842, 0x8A9B8402, 0x8A9BC402, 0x8A9C0402,
+		0x8A9C4402, 0x8A9C8402, 0x8A9CC402, 0x8A9D0402, 0x8A9D4402, 0x00000000, 0x00000000, 0x000415E1,
+		0x8A9E4402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8A9F0402, 0x0002F982, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8A9F4402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8A914402, 0x8A91C402, 0x8A9D8402, 0x8A9DC402, 0x00000000, 0x00000000, 0x87E60402, 0x87E64402,
+		0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402, 0x87E80402, 0x87E84402,
+		0x8A99C402, 0x8A9A4402, 0x87DAC402, 0x87DB0402, 0xC7558402, 0xC755C402, 0xC7560402, 0xC7564402,
+		0xC7568402, 0xC756C402, 0xC151C402, 0x87DB4402, 0x8A9F8402, 0xC1014402, 0x800018C2, 0x00000000,
+		0x00000000, 0x80001862, 0x80001882, 0x800018A2, 0x00000000, 0x8AA10402, 0x8AA14402, 0x8AA24402,
+		0x8AA28402, 0x8AA04402, 0x8AA08402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8AA2C402,
+		0x8AA18402, 0x00000000, 0x00000000, 0x8AA0C402, 0x8AA1C402, 0x8AA3C402, 0x8AA40402, 0x8AA44402,
+		0x8AA48402, 0x8AA4C402, 0x8AA50402, 0x8AA54402, 0x8AA58402, 0x8AA5C402, 0x8AA60402, 0x8AA64402,
+		0x8AA68402, 0x8AA6C402, 0x8AA70402, 0x8AA74402, 0x8AA78402, 0x8AA7C402, 0x8AA80402, 0x8AA84402,
+		0x8AA88402, 0x00000000, 0x8AA8C402, 0x8AA90402, 0x8AA94402, 0x8AA98402, 0x8AA9C402, 0x8AAA0402,
+		0x8AAA8402, 0x00000000, 0x8AAAC402, 0x00000000, 0x00000000, 0x8AAB0402, 0x00000000, 0x00000000,
+		0x8AA30402, 0x8AA34402, 0x00000000, 0x00000000, 0x80001842, 0x00000000, 0x8AAB8402, 0x8AABC402,
+		0x8AAC0402, 0x8AAC4402, 0x8AAC8402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8AACC402,
+		0x8AAD0402, 0x00000000, 0x00000000, 0x8AAD4402, 0x8AAD8402, 0x8AADC402, 0x00000000, 0x00000000,
+		0x00000000, 0x8AA38402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8AAB4402, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x87E60402, 0x87E64402,
+		0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402, 0x87E80402, 0x87E84402,
+		0x800018E2, 0x80001902, 0x8AA20402, 0x8AA00402, 0x8A9FC402, 0x8AAA4402, 0xC1018402, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x80001862, 0x80001882, 0x800018A2, 0x00000000, 0x8AAE4402, 0x8AAE8402, 0x8AAEC402,
+		0x8AAF0402, 0x8AAF4402, 0x8AAF8402, 0x8AAFC402, 0x8AB04402, 0x8AB0C402, 0x00000000, 0x8AB10402,
+		0x8AB14402, 0x8AB18402, 0x00000000, 0x8AB1C402, 0x8AB20402, 0x8AB24402, 0x8AB28402, 0x8AB2C402,
+		0x8AB30402, 0x8AB34402, 0x8AB38402, 0x8AB3C402, 0x8AB40402, 0x8AB48402, 0x8AB4C402, 0x8AB50402,
+		0x8AB54402, 0x8AB58402, 0x8AB5C402, 0x8AB60402, 0x8AB64402, 0x8AB68402, 0x8AB6C402, 0x8AB70402,
+		0x8AB74402, 0x00000000, 0x8AB78402, 0x8AB7C402, 0x8AB80402, 0x8AB84402, 0x8AB88402, 0x8AB8C402,
+		0x8AB90402, 0x00000000, 0x8AB94402, 0x8ABAC402, 0x00000000, 0x8AB98402, 0x8AB9C402, 0x8ABA0402,
+		0x8ABA4402, 0x8ABA8402, 0x00000000, 0x00000000, 0x80001842, 0x8ABB0402, 0x8ABB4402, 0x8ABB8402,
+		0x8ABBC402, 0x8ABC0402, 0x8ABC4402, 0x8ABC8402, 0x8ABCC402, 0x8ABD8402, 0x00000000, 0x8ABDC402,
+		0x8ABE0402, 0x8ABE4402, 0x00000000, 0x8ABE8402, 0x8ABEC402, 0x8ABF0402, 0x00000000, 0x00000000,
+		0x8AAE0402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8AB00402, 0x8AB08402, 0x8ABD0402, 0x8ABD4402, 0x00000000, 0x00000000, 0x87E60402, 0x87E64402,
+		0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402, 0x87E80402, 0x87E84402,
+		0xC101C402, 0x87DB8402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x8AB44402, 0x80001022, 0x80001002, 0x80001042, 0x80001842, 0x80001842, 0x80001842,
+		0x00000000, 0x80001862, 0x80001882, 0x800018A2, 0x00000000, 0x8ABF4402, 0x8ABF8402, 0x8ABFC402,
+		0x8AC00402, 0x8AC04402, 0x8AC08402, 0x8AC0C402, 0x8AC14402, 0x00000000, 0x00000000, 0x8AC1C402,
+		0x8AC20402, 0x00000000, 0x00000000, 0x8AC24402, 0x8AC28402, 0x8AC2C402, 0x8AC30402, 0x8AC34402,
+		0x8AC38402, 0x8AC3C402, 0x8AC40402, 0x8AC44402, 0x8AC48402, 0x8AC4C402, 0x8AC50402, 0x8AC54402,
+		0x8AC58402, 0x8AC5C402, 0x8AC60402, 0x8AC64402, 0x8AC68402, 0x8AC6C402, 0x8AC70402, 0x8AC74402,
+		0x8AC78402, 0x00000000, 0x8AC7C402, 0x8AC80402, 0x8AC84402, 0x8AC88402, 0x8AC8C402, 0x8AC90402,
+		0x8AC98402, 0x00000000, 0x8AC9C402, 0x8ACA0402, 0x00000000, 0x8ACA4402, 0x8ACAC402, 0x8ACB0402,
+		0x8ACB4402, 0x8ACB8402, 0x00000000, 0x00000000, 0x80001842, 0x8ACBC402, 0x8ACC0402, 0x8ACC4402,
+		0x8ACC8402, 0x8ACCC402, 0x8ACD0402, 0x8ACD4402, 0x8ACD8402, 0x00000000, 0x00000000, 0x00035161,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8ACF4402, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80000662, 0x8ACF8402, 0x8ACFC402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8AC94402,
+		0x8AC10402, 0x8AC18402, 0x8ACDC402, 0x8ACE0402, 0x00000000, 0x00000000, 0x87E60402, 0x87E64402,
+		0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402, 0x87E80402, 0x87E84402,
+		0xC1520402, 0x8ACA8402, 0xC7570402, 0xC7574402, 0xC7578402, 0xC757C402, 0xC7580402, 0xC7584402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x80001882, 0x8AD34402, 0x00000000, 0x8AD04402, 0x8AD08402, 0x8AD0C402,
+		0x8AD10402, 0x8AD14402, 0x8AD18402, 0x00000000, 0x00000000, 0x00000000, 0x8AD1C402, 0x8AD20402,
+		0x8AD24402, 0x00000000, 0x00048BE1, 0x8AD2C402, 0x00000000, 0x8AD38402, 0x00000000, 0x00000000,
+		0x00000000, 0x8AD3C402, 0x8AD40402, 0x00000000, 0x8AD80402, 0x00000000, 0x8AD44402, 0x8AD48402,
+		0x00000000, 0x00000000, 0x00000000, 0x8AD4C402, 0x8AD50402, 0x00000000, 0x00000000, 0x00000000,
+		0x8AD54402, 0x8AD7C402, 0x8AD58402, 0x00000000, 0x00000000, 0x00000000, 0x8AD5C402, 0x8AD60402,
+		0x8AD64402, 0x8AD78402, 0x8AD68402, 0x8AD74402, 0x8AD70402, 0x8AD6C402, 0x8AD84402, 0x8AD88402,
+		0x8AD8C402, 0x8AD90402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8AD94402, 0x8AD98402,
+		0x8AD9C402, 0x8ADA0402, 0x8ADA4402, 0x00000000, 0x00000000, 0x00000000, 0x00019561, 0x00031DA1,
+		0x8ADB0402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8ADC0402, 0x00000000, 0x00000000,
+		0x8AD00402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8ADC4402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x87E60402, 0x87E64402,
+		0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402, 0x87E80402, 0x87E84402,
+		0xC75A0402, 0xC75A4402, 0xC75A8402, 0xC1524402, 0xC1528402, 0xC152C402, 0xC1530402, 0xC1534402,
+		0xC1538402, 0x87DC0402, 0xC153C402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x80001862, 0x80001862, 0x80001882, 0x800018A2, 0x80001882, 0x8ADC8402, 0x8ADCC402, 0x8ADD0402,
+		0x8ADD4402, 0x8ADD8402, 0x8ADDC402, 0x8ADE0402, 0x8ADE8402, 0x00000000, 0x8ADF0402, 0x8ADF4402,
+		0x8ADF8402, 0x00000000, 0x8ADFC402, 0x8AE00402, 0x8AE04402, 0x8AE08402, 0x8AE0C402, 0x8AE10402,
+		0x8AE14402, 0x8AE18402, 0x8AE1C402, 0x8AE24402, 0x8AE28402, 0x8AE30402, 0x8AE34402, 0x8AE38402,
+		0x8AE3C402, 0x8AE40402, 0x8AE44402, 0x8AE48402, 0x8AE4C402, 0x8AE50402, 0x8AE54402, 0x8AE58402,
+		0x8AE5C402, 0x00000000, 0x8AE60402, 0x8AE64402, 0x8AE68402, 0x8AE6C402, 0x8AE70402, 0x8AE74402,
+		0x8AE78402, 0x8AE7C402, 0x8AE80402, 0x8AE98402, 0x8AE9C402, 0x8AE84402, 0x8AE88402, 0x8AE8C402,
+		0x8AE90402, 0x8AE94402, 0x00000000, 0x00000000, 0x00000000, 0x8AEA4402, 0x8AEA8402, 0x8AEAC402,
+		0x8AEB0402, 0x8AEB4402, 0x8AEB8402, 0x8AEBC402, 0x8AEC0402, 0x00000000, 0x00035361, 0x8AED0402,
+		0x00000000, 0x00000000, 0x8AED8402, 0x8AEDC402, 0x8AEE0402, 0x8AEE4402, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8AEE8402, 0x8AEEC402, 0x00000000,
+		0x8AE20402, 0x8AE2C402, 0x8AEA0402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8ADE4402, 0x8ADEC402, 0x8AEC4402, 0x8AEC8402, 0x00000000, 0x00000000, 0x87E60402, 0x87E64402,
+		0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402, 0x87E80402, 0x87E84402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xC1020402,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E64402, 0x87E68402, 0x87E6C402, 0xC15A4402,
+		0x8AFCC402, 0x80001862, 0x80001882, 0x800018A2, 0xC1024402, 0x8AEF0402, 0x8AEF4402, 0x8AEF8402,
+		0x8AEFC402, 0x8AF00402, 0x8AF04402, 0x8AF08402, 0x8AF10402, 0x00000000, 0x8AF18402, 0x8AF1C402,
+		0x8AF20402, 0x00000000, 0x8AF24402, 0x8AF28402, 0x8AF2C402, 0x8AF30402, 0x8AF34402, 0x8AF38402,
+		0x8AF3C402, 0x8AF40402, 0x8AF44402, 0x8AF48402, 0x8AF4C402, 0x8AF50402, 0x8AF54402, 0x8AF58402,
+		0x8AF5C402, 0x8AF60402, 0x8AF64402, 0x8AF68402, 0x8AF6C402, 0x8AF70402, 0x8AF74402, 0x8AF78402,
+		0x8AF7C402, 0x00000000, 0x8AF80402, 0x8AF84402, 0x8AF88402, 0x8AF8C402, 0x8AF90402, 0x8AF94402,
+		0x8AF98402, 0x8AF9C402, 0x8AFA0402, 0x8AFB8402, 0x00000000, 0x8AFA4402, 0x8AFA8402, 0x8AFAC402,
+		0x8AFB0402, 0x8AFB4402, 0x00000000, 0x00000000, 0x80001842, 0x8AFC0402, 0x8AFD0402, 0x0004A921,
+		0x00000000, 0x8AFDC402, 0x8AFE0402, 0x8AFE4402, 0x8AFE8402, 0x00000000, 0x00033BE1, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8B008402, 0x8B00C402, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8B010402, 0x8B014402, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8AFBC402, 0x00000000,
+		0x8AF0C402, 0x8AF14402, 0x8AFEC402, 0x8AFF0402, 0x00000000, 0x00000000, 0x87E60402, 0x87E64402,
+		0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402, 0x87E80402, 0x87E84402,
+		0x00000000, 0x8AFC4402, 0x8AFC8402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x80001882, 0x80001862, 0x80001882, 0x800018A2, 0x8B0F8402, 0x8B018402, 0x8B01C402, 0x8B020402,
+		0x8B024402, 0x8B02C402, 0x8B030402, 0x8B034402, 0x8B03C402, 0x00000000, 0x8B044402, 0x8B048402,
+		0x8B04C402, 0x00000000, 0x8B050402, 0x8B054402, 0x8B058402, 0x8B05C402, 0x8B060402, 0x8B064402,
+		0x8B068402, 0x8B06C402, 0x8B070402, 0x8B074402, 0x8B078402, 0x8B07C402, 0x8B080402, 0x8B084402,
+		0x8B088402, 0x8B08C402, 0x8B090402, 0x8B094402, 0x8B098402, 0x8B09C402, 0x8B0A0402, 0x8B0A4402,
+		0x8B0A8402, 0x8B0AC402, 0x8B0B0402, 0x8B0B4402, 0x8B0B8402, 0x8B0BC402, 0x8B0C0402, 0x8B0C4402,
+		0x8B0C8402, 0x8B0EC402, 0x8B0CC402, 0x8B0E4402, 0x8B0E8402, 0x8B0D0402, 0x8B0D4402, 0x8B0D8402,
+		0x8B0DC402, 0x8B0E0402, 0x8B0F0402, 0x8B13C404, 0x8B13C404, 0x8B0F4402, 0x8B0FC402, 0x8B100402,
+		0x8B104402, 0x8B108402, 0x8B10C402, 0x8B110402, 0x8B114402, 0x00000000, 0x000094A1, 0x00043A21,
+		0x8B128402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8B13C402, 0x0002E002, 0xC15A8402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00010D82, 0x00023F42, 0x00012DC2, 0x8B138402,
+		0xC7600402, 0xC7604402, 0xC7608402, 0xC760C402, 0xC7610402, 0xC7614402, 0xC7618402, 0x8B028402,
+		0x8B038402, 0x8B040402, 0x8B118402, 0x8B11C402, 0x00000000, 0x00000000, 0x87E60402, 0x87E64402,
+		0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402, 0x87E80402, 0x87E84402,
+		0xC761C402, 0xC7620402, 0xC7624402, 0xC7628402, 0xC762C402, 0xC7630402, 0xC7634402, 0xC7638402,
+		0xC763C402, 0xC15AC402, 0x0000CE42, 0x0002DB82, 0x000124C2, 0x0001E882, 0x00021142, 0x000209C2,
+		0x00000000, 0x80001862, 0x80001882, 0x800018A2, 0x00000000, 0x8B140402, 0x8B144402, 0x8B148402,
+		0x8B14C402, 0x8B150402, 0x8B154402, 0x8B158402, 0x8B15C402, 0x8B160402, 0x8B164402, 0x8B168402,
+		0x8B16C402, 0x8B170402, 0x8B174402, 0x8B178402, 0x8B17C402, 0x8B180402, 0x8B184402, 0x00000000,
+		0x00000000, 0x00000000, 0x8B188402, 0x8B18C402, 0x8B190402, 0x8B194402, 0x8B198402, 0x8B19C402,
+		0x8B1A0402, 0x8B1A4402, 0x8B1A8402, 0x8B1AC402, 0x8B1B0402, 0x8B1B4402, 0x8B1B8402, 0x8B1BC402,
+		0x8B1C0402, 0x8B1C4402, 0x8B1C8402, 0x8B1CC402, 0x8B1D0402, 0x8B1D4402, 0x8B1D8402, 0x8B1DC402,
+		0x8B1E0402, 0x8B1E4402, 0x00000000, 0x8B1E8402, 0x8B1EC402, 0x8B1F0402, 0x8B1F4402, 0x8B1F8402,
+		0x8B1FC402, 0x8B200402, 0x8B204402, 0x8B208402, 0x00000000, 0x8B20C402, 0x00000000, 0x00000000,
+		0x8B210402, 0x8B214402, 0x8B218402, 0x8B21C402, 0x8B220402, 0x8B224402, 0x8B228402, 0x00000000,
+		0x00000000, 0x00000000, 0x8B270402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8B22C402,
+		0x8B230402, 0x8B234402, 0x8B238402, 0x8B23C402, 0x8B240402, 0x00000000, 0x8B244402, 0x00000000,
+		0x8B248402, 0x0000E761, 0x00000000, 0x8B260402, 0x00000000, 0x00000000, 0x00000000, 0x8B250402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x87E60402, 0x87E64402,
+		0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402, 0x87E80402, 0x87E84402,
+		0x00000000, 0x00000000, 0x8B24C402, 0x8B254402, 0xC1028402, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x8C85C402, 0x8C860402, 0x8C864402, 0x8C868402, 0x8C86C402, 0x8C870402, 0x8C874402,
+		0x8C878402, 0x8C87C402, 0x8C880402, 0x8C884402, 0x8C888402, 0x8C88C402, 0x8C890402, 0x8C894402,
+		0x8C898402, 0x8C89C402, 0x8C8A0402, 0x8C8A4402, 0x8C8A8402, 0x8C8AC402, 0x8C8B0402, 0x8C8B4402,
+		0x8C8B8402, 0x8C8BC402, 0x8C8C0402, 0x8C8C4402, 0x8C8C8402, 0x8C8CC402, 0x8C8D0402, 0x8C8D4402,
+		0x8C8D8402, 0x8C8DC402, 0x8C8E0402, 0x8C8E4402, 0x8C8E8402, 0x8C8EC402, 0x8C8F0402, 0x8C8F4402,
+		0x8C8F8402, 0x8C8FC402, 0x8C900402, 0x8C904402, 0x8C908402, 0x8C90C402, 0x8C910402, 0x8C914402,
+		0x8C918402, 0x8C91C402, 0x8C920402, 0x8C924402, 0x8C928402, 0x8C92C402, 0x8C930402, 0x8C934402,
+		0x8C938402, 0x8C93C402, 0x8C940402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x87DD4402,
+		0x000138E1, 0x00004021, 0x00035621, 0x0004BD21, 0x000211E1, 0x8C958402, 0x87D24402, 0x80001A82,
+		0x80001AA2, 0x80001AC2, 0x80001AE2, 0x80001B02, 0x80001B22, 0x00043C21, 0x80001A62, 0xC102C402,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0xC1030402, 0xC1034402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x8C960402, 0x8C964402, 0x00000000, 0x8C968402, 0x00000000, 0x8C96C402, 0x8C970402,
+		0x8C974402, 0x8C978402, 0x8C980402, 0x00000000, 0x8C984402, 0x8C990402, 0x8C988402, 0x8C994402,
+		0x8C998402, 0x8C99C402, 0x8C9A0402, 0x8C9A4402, 0x8C9A8402, 0x8C9AC402, 0x8C9B0402, 0x8C9B4402,
+		0x8C9B8402, 0x8C9BC402, 0x8C9C0402, 0x8C9C4402, 0x8C9C8402, 0x8C9CC402, 0x8C9D0402, 0x8C9D4402,
+		0x8C9D8402, 0x8C9DC402, 0x8C9E0402, 0x8C9E4402, 0x00000000, 0x8C9E8402, 0x00000000, 0x8C9EC402,
+		0x8C9F0402, 0x8C9F4402, 0x8C97C402, 0x8C9F8402, 0x8C9FC402, 0x8CA00402, 0x8CA04402, 0x8CA08402,
+		0x8CA0C402, 0x8CA10402, 0x8CA14402, 0x8CA18402, 0x8CA1C402, 0x8CA20402, 0x8CA24402, 0x8CA28402,
+		0x8CA2C402, 0x8CA30402, 0x8CA34402, 0x8CA38402, 0x8CA3C402, 0x8CA40402, 0x00000000, 0x00000000,
+		0x0001AE21, 0x000068E1, 0x00033EA1, 0x00044361, 0x00022761, 0x00000000, 0x87D28402, 0x00000000,
+		0x80001B62, 0x80001B82, 0x80001BA2, 0x80001BC2, 0x80001BE2, 0x0004BF61, 0x00000000, 0x00000000,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0x00000000, 0x00000000, 0x0000D8C2, 0x00023382, 0x8C95C402, 0x8C98C402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00031F83, 0xC15CC402, 0xC15D0402, 0xC15D4402, 0xC1040402, 0xC1044402, 0xC1048402, 0xC104C402,
+		0xC1050402, 0xC1054402, 0xC1058402, 0xC1064402, 0xC106441B, 0xC1068402, 0xC106C402, 0xC1070402,
+		0xC1074402, 0xC1078402, 0xC107C402, 0xC15D8402, 0xC097C402, 0xC15DC402, 0xC15E0402, 0xC15E4402,
+		0x80000000, 0x80000000, 0xC15E8402, 0xC15EC402, 0xC15F0402, 0xC15F4402, 0xC15F8402, 0xC15FC402,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0x87E64404, 0x87E68404, 0x87E6C404, 0x87E70404, 0x87E74404, 0x87E78404,
+		0x87E7C404, 0x87E80404, 0x87E84404, 0x87E60404, 0xC1600402, 0x80000000, 0xC1604402, 0x80000000,
+		0xC1608402, 0x80001C62, 0xC0CB8402, 0xC0CBC402, 0xC0CC0402, 0xC0CC4402, 0x80000000, 0x80000000,
+		0x8CB64402, 0x8CB70402, 0x8CB78402, 0x00000000, 0x8CB80402, 0x8CB88402, 0x8CB90402, 0x8CB98402,
+		0x00000000, 0x8CBA0402, 0x8CBA8402, 0x8CBB0402, 0x8CBB8402, 0x00000000, 0x8CBC0402, 0x8CBC8402,
+		0x8CBD0402, 0x8CBD8402, 0x00000000, 0x8CBE0402, 0x8CBE8402, 0x8CBF0402, 0x8CBF8402, 0x00000000,
+		0x8CC00402, 0x8CC08402, 0x8CC10402, 0x8CC18402, 0x00000000, 0x8CC20402, 0x8CC28402, 0x8CC30402,
+		0x8CC38402, 0x8CC40402, 0x8CC48402, 0x8CC54402, 0x8CC5C402, 0x8CC64402, 0x8CC6C402, 0x8CC74402,
+		0x8CC7C402, 0x00000000, 0x00046C82, 0x8CB6C402, 0x8CC50402, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x0001AFE1, 0x8CCA8402, 0x00000000, 0x8CCB8402, 0x00000000, 0x00000000, 0x8CCC4402,
+		0x00000000, 0x8CCCC402, 0x8CCD0402, 0x8CCD4402, 0x8CCD8402, 0x8CCDC402, 0x80001882, 0x800018A2,
+		0x8CCB0402, 0x00000000, 0x80000000, 0x80000000, 0x8CCE0402, 0xC1080402, 0x80000000, 0x80000000,
+		0x8CC84402, 0x8CC8C402, 0x8CC9C402, 0x8CCA0402, 0x8CC94402, 0x8CC88402, 0x8CC90402, 0x8CC98402,
+		0x8CB68402, 0x8CB74402, 0x8CB7C402, 0x00000000, 0x8CB84402, 0x8CB8C402, 0x8CB94402, 0x8CB9C402,
+		0x00000000, 0x8CBA4402, 0x8CBAC402, 0x8CBB4402, 0x8CBBC402, 0x00000000, 0x8CBC4402, 0x8CBCC402,
+		0x8CBD4402, 0x8CBDC402, 0x00000000, 0x8CBE4402, 0x8CBEC402, 0x8CBF4402, 0x8CBFC402, 0x00000000,
+		0x8CC04402, 0x8CC0C402, 0x8CC14402, 0x8CC1C402, 0x00000000, 0x8CC24402, 0x8CC2C402, 0x8CC34402,
+		0x8CC3C402, 0x8CC44402, 0x00042CA1, 0x0002C921, 0x8CC60402, 0x8CC68402, 0x8CC70402, 0x8CC78402,
+		0x8CC80402, 0x00000000, 0x00039CC2, 0x00021C02, 0x0003F702, 0x00000000, 0xC160C402, 0xC1610402,
+		0xC1614402, 0xC1618402, 0xC161C402, 0xC1620402, 0xC1624402, 0xC1628402, 0x80000000, 0xC162C402,
+		0xC1630402, 0xC1634402, 0xC1638402, 0xC163C402, 0xC1640402, 0x00000000, 0xC1644402, 0xC1648402,
+		0xC105C402, 0xC1060402, 0xC1084402, 0xC1088402, 0xC108C402, 0xC164C402, 0xC1650402, 0xC1654402,
+		0xC1658402, 0xC1090402, 0xC1094402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8D5B0402, 0x8D5B8402, 0x8D5C0402, 0x8D5D0402, 0x8D5DC402, 0x8D5E4402, 0x8D5F0402, 0x8D600402,
+		0x8D614402, 0x8D630402, 0x8D640402, 0x8D644402, 0x8D64C402, 0x8D654402, 0x8D660402, 0x8D66C402,
+		0x8D67C402, 0x8D680402, 0x8D684402, 0x8D690402, 0x8D69C402, 0x8D6AC402, 0x8D6B0402, 0x8D6C8402,
+		0x8D6D4402, 0x8D6E0402, 0x8D6E8402, 0x8D6F0402, 0x8D700402, 0x8D708402, 0x8D724402, 0x8D72C402,
+		0x8D744402, 0x8D760402, 0x8D764402, 0x8D768402, 0x8D76C402, 0x00042DE1, 0x00000000, 0x8D788402,
+		0x8D78C402, 0x8D790402, 0x8D794402, 0x8D798404, 0x8D798402, 0x8D7A8402, 0x8D7B0402, 0x8D7B8402,
+		0x8D7C4402, 0x8D7D8402, 0x8D7E8402, 0x8D7B4402, 0x8D7F0402, 0x8D7E0402, 0x80001882, 0x80001CE2,
+		0x800018A2, 0x8D808402, 0x8D80C402, 0x8D6EC402, 0x8D6FC402, 0x8D70C402, 0x8D738402, 0x0002E303,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0xC0A84402, 0xC0A88402, 0xC10EC402, 0xC10F0402, 0xC10F4402, 0xC10F8402,
+		0x8D718402, 0x8D71C402, 0x8D778402, 0x8D77C402, 0x8D780402, 0x8D784402, 0x8D7C8402, 0x8D7CC402,
+		0x8D7D0402, 0x8D7D4402, 0x8D5E0402, 0x8D618402, 0x8D74C402, 0x8D750402, 0x8D6A8402, 0x8D6E4402,
+		0x8D704402, 0x8D628402, 0x8D7F4402, 0x8D810402, 0x8D814402, 0x8D720402, 0x8D75C402, 0x8D7F8402,
+		0x8D7FC402, 0x8D818402, 0x8D81C402, 0x8D820402, 0x8D824402, 0x8D828402, 0x8D670402, 0x8D754402,
+		0x8D758402, 0x8D7AC402, 0x8D7A0402, 0x8D7BC402, 0x8D7C0402, 0x8D5B4402, 0x8D5BC402, 0x8D5C4402,
+		0x8D5E8402, 0x8D60C402, 0x8D634402, 0x8D688402, 0x8D6A0402, 0x8D6B4402, 0x8D6B8402, 0x8D6CC402,
+		0x8D714402, 0x8D730402, 0x8D710402, 0x8D79C402, 0x8D7DC402, 0x8D7E4402, 0x8D804402, 0x8D82C402,
+		0x8D834402, 0x8D840402, 0x8D844402, 0x8D830402, 0x8D838402, 0x8D83C402, 0x8D6C0402, 0x8D848402,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0x8D84C402, 0x8D850402, 0x8D7A4402, 0x8D7EC402, 0xC1664402, 0xC1668402,
+		0x89680408, 0x89688408, 0x89690408, 0x89698408, 0x896A0408, 0x896A8408, 0x896B0408, 0x896C0408,
+		0x896C8408, 0x896D0408, 0x896D8408, 0x896E0408, 0x896E8408, 0x896F8408, 0x89700408, 0x89708408,
+		0x89710408, 0x89718408, 0x89720408, 0x89730408, 0x89738408, 0x89740408, 0x89748408, 0x89750408,
+		0x89758408, 0x89760408, 0x89768408, 0x89770408, 0x89778408, 0x89780408, 0x89788408, 0x89798408,
+		0x897A0408, 0x896B8408, 0x896F0408, 0x89728408, 0x89790408, 0x897A8408, 0x00000000, 0x897B4408,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x897C8408, 0x00000000, 0x00000000,
+		0x8967C402, 0x89684402, 0x8968C402, 0x89694402, 0x8969C402, 0x896A4402, 0x896AC402, 0x896BC402,
+		0x896C4402, 0x896CC402, 0x896D4402, 0x896DC402, 0x896E4402, 0x896F4402, 0x896FC402, 0x89704402,
+		0x8970C402, 0x89714402, 0x8971C402, 0x8972C402, 0x89734402, 0x8973C402, 0x89744402, 0x8974C402,
+		0x89754402, 0x8975C402, 0x89764402, 0x8976C402, 0x89774402, 0x8977C402, 0x89784402, 0x89794402,
+		0x8979C402, 0x896B4402, 0x896EC402, 0x89724402, 0x8978C402, 0x897A4402, 0x897AC402, 0x897B0402,
+		0x897B8402, 0x897BC402, 0x897C0402, 0xC0B3C402, 0x896E4414, 0x897C4402, 0x897CC402, 0x897D0402,
+		0x905D4402, 0x905D8402, 0x905DC402, 0x905E0402, 0x905E4402, 0x905E8402, 0x905EC402, 0x905F0402,
+		0x905F4402, 0x905F8402, 0x905FC402, 0x90600402, 0x90604402, 0x90608402, 0x9060C402, 0x90610402,
+		0x90614402, 0x90618402, 0x9061C402, 0x90620402, 0x90624402, 0x90628402, 0x9062C402, 0x90630402,
+		0x90634402, 0x90638402, 0x9063C402, 0x90640402, 0x90644402, 0x90648402, 0x9064C402, 0x90650402,
+		0x90654402, 0x90658402, 0x9065C402, 0x90660402, 0x90664402, 0x90668402, 0x9066C402, 0x90670402,
+		0x90674402, 0x90678402, 0x9067C402, 0x90680402, 0x90684402, 0x90688402, 0x9068C402, 0x90690402,
+		0x90694402, 0x90698402, 0x9069C402, 0x906A0402, 0x906A4402, 0x906A8402, 0x906AC402, 0x906B0402,
+		0x906B4402, 0x906B8402, 0x906BC402, 0x906C0402, 0x906C4402, 0x906C8402, 0x906CC402, 0x906D0402,
+		0x906D4402, 0x906D8402, 0x906DC402, 0x906E0402, 0x906E4402, 0x906E8402, 0x906EC402, 0x906F0402,
+		0x906F4402, 0x906F8402, 0x906FC402, 0x90700402, 0x90704402, 0x90708402, 0x9070C402, 0x90710402,
+		0x90714402, 0x90718402, 0x9071C402, 0x90720402, 0x90724402, 0x90728402, 0x9072C402, 0x90730402,
+		0x90734402, 0x90738402, 0x9073C402, 0x90740402, 0x90744402, 0x90748402, 0x9074C402, 0x907C4402,
+		0x907C8402, 0x907CC402, 0x907D0402, 0x907D4402, 0x907D8402, 0x907DC402, 0x907E0402, 0x907E4402,
+		0x907E8402, 0x907EC402, 0x907F0402, 0x907F4402, 0x907F8402, 0x907FC402, 0x90800402, 0x90804402,
+		0x90808402, 0x9080C402, 0x90810402, 0x90814402, 0x90818402, 0x9081C402, 0x90820402, 0x90824402,
+		0x90828402, 0x9082C402, 0x90830402, 0x90834402, 0x90838402, 0x9083C402, 0x90840402, 0x90844402,
+		0x90848402, 0x9084C402, 0x90850402, 0x90854402, 0x90858402, 0x9085C402, 0x90860402, 0x90864402,
+		0x90868402, 0x9086C402, 0x90870402, 0x90874402, 0x90878402, 0x9087C402, 0x90880402, 0x90884402,
+		0x90888402, 0x9088C402, 0x90890402, 0x90894402, 0x90898402, 0x9089C402, 0x908A0402, 0x908A4402,
+		0x908A8402, 0x908AC402, 0x908B0402, 0x908B4402, 0x908B8402, 0x908BC402, 0x908C0402, 0x908C4402,
+		0x908C8402, 0x908CC402, 0x908D0402, 0x908D4402, 0x908D8402, 0x908DC402, 0x908E0402, 0x908E4402,
+		0x90944402, 0x90948402, 0x9094C402, 0x90950402, 0x90954402, 0x90958402, 0x9095C402, 0x90960402,
+		0x90964402, 0x90968402, 0x9096C402, 0x90970402, 0x90974402, 0x90978402, 0x9097C402, 0x90980402,
+		0x90984402, 0x90988402, 0x9098C402, 0x90990402, 0x90994402, 0x90998402, 0x9099C402, 0x909A0402,
+		0x909A4402, 0x909A8402, 0x909AC402, 0x909B0402, 0x909B4402, 0x909B8402, 0x909BC402, 0x909C0402,
+		0x909C4402, 0x909C8402, 0x909CC402, 0x909D0402, 0x909D4402, 0x909D8402, 0x909DC402, 0x909E0402,
+		0x909E4402, 0x909E8402, 0x909EC402, 0x909F0402, 0x909F4402, 0x909F8402, 0x909FC402, 0x90A00402,
+		0x90A04402, 0x90A08402, 0x90A0C402, 0x90A10402, 0x90A14402, 0x90A18402, 0x90A1C402, 0x90A20402,
+		0x90A24402, 0x90A28402, 0x90A2C402, 0x90A30402, 0x90A34402, 0x90A38402, 0x90A3C402, 0x90A40402,
+		0x90A44402, 0x90A48402, 0x90A4C402, 0x90A50402, 0x90A54402, 0x90A58402, 0x90A5C402, 0x90A60402,
+		0x90A64402, 0x90A68402, 0x90A6C402, 0x90A70402, 0x90A74402, 0x90A78402, 0x90A7C402, 0x90A80402,
+		0x90A84402, 0x90A88402, 0x90A8C402, 0x90A90402, 0x90A94402, 0x90A98402, 0x90A9C402, 0x90AA0402,
+		0x8A048402, 0x8A04C402, 0x8A050402, 0x8A054402, 0x8A058402, 0x8A05C402, 0x8A060402, 0x8A064402,
+		0x8A068402, 0x8A06C402, 0x8A070402, 0x8A074402, 0x8A078402, 0x8A07C402, 0x8A080402, 0x8A084402,
+		0x8A08C402, 0x8A090402, 0x8A094402, 0x8A098402, 0x8A09C402, 0x8A0A0402, 0x8A0A4402, 0x8A0A8402,
+		0x8A0AC402, 0x8A0B0402, 0x8A0B4402, 0x8A0B8402, 0x8A0BC402, 0x8A0C0402, 0x8A0C4402, 0x8A0C8402,
+		0x8A0E0402, 0x8A0E4402, 0x8A0E8402, 0x8A0EC402, 0x8A0F0402, 0x8A0F4402, 0x8A0F8402, 0x8A0FC402,
+		0x8A100402, 0x8A104402, 0x8A108402, 0x8A10C402, 0x8A110402, 0x8A114402, 0x8A118402, 0x8A11C402,
+		0x8A124402, 0x8A128402, 0x8A12C402, 0x8A130402, 0x8A134402, 0x8A138402, 0x8A13C402, 0x8A140402,
+		0x8A160402, 0x8A164402, 0x8A168402, 0x8A16C402, 0x8A170402, 0x8A174402, 0x8A178402, 0x8A17C402,
+		0x8A184402, 0x8A188402, 0x8A18C402, 0x8A190402, 0x8A194402, 0x8A198402, 0x8A19C402, 0x8A1A0402,
+		0x8A1A4402, 0x00000000, 0x8A1A8402, 0x8A1AC402, 0x8A1B0402, 0x8A1B4402, 0x00000000, 0x00000000,
+		0x8A1B8402, 0x8A1BC402, 0x8A1C0402, 0x8A1C4402, 0x8A1C8402, 0x8A1CC402, 0x8A1D0402, 0x00000000,
+		0x8A1D4402, 0x00000000, 0x8A1D8402, 0x8A1DC402, 0x8A1E0402, 0x8A1E4402, 0x00000000, 0x00000000,
+		0x8A1E8402, 0x8A1EC402, 0x8A1F0402, 0x8A1F4402, 0x8A1F8402, 0x8A1FC402, 0x8A200402, 0x8A204402,
+		0x8A21C402, 0x8A220402, 0x8A224402, 0x8A228402, 0x8A22C402, 0x8A230402, 0x8A234402, 0x8A238402,
+		0x8A23C402, 0x8A240402, 0x8A244402, 0x8A248402, 0x8A24C402, 0x8A250402, 0x8A254402, 0x8A258402,
+		0x8A260402, 0x8A264402, 0x8A268402, 0x8A26C402, 0x8A270402, 0x8A274402, 0x8A278402, 0x8A27C402,
+		0x8A284402, 0x8A288402, 0x8A28C402, 0x8A290402, 0x8A294402, 0x8A298402, 0x8A29C402, 0x8A2A0402,
+		0x8A2A4402, 0x00000000, 0x8A2A8402, 0x8A2AC402, 0x8A2B0402, 0x8A2B4402, 0x00000000, 0x00000000,
+		0x8A2B8402, 0x8A2BC402, 0x8A2C0402, 0x8A2C4402, 0x8A2C8402, 0x8A2CC402, 0x8A2D0402, 0x8A2D4402,
+		0x8A2DC402, 0x8A2E0402, 0x8A2E4402, 0x8A2E8402, 0x8A2EC402, 0x8A2F0402, 0x8A2F4402, 0x8A2F8402,
+		0x8A300402, 0x8A304402, 0x8A308402, 0x8A30C402, 0x8A310402, 0x8A314402, 0x8A318402, 0x8A31C402,
+		0x8A324402, 0x8A328402, 0x8A32C402, 0x8A330402, 0x8A334402, 0x8A338402, 0x8A33C402, 0x8A340402,
+		0x8A344402, 0x00000000, 0x8A348402, 0x8A34C402, 0x8A350402, 0x8A354402, 0x00000000, 0x00000000,
+		0x8A358402, 0x8A35C402, 0x8A360402, 0x8A364402, 0x8A368402, 0x8A36C402, 0x8A370402, 0x00000000,
+		0x8A374402, 0x00000000, 0x8A378402, 0x8A37C402, 0x8A380402, 0x8A384402, 0x00000000, 0x00000000,
+		0x8A388402, 0x8A38C402, 0x8A390402, 0x8A394402, 0x8A398402, 0x8A39C402, 0x8A3A0402, 0x8A3A4402,
+		0x8A3A8402, 0x8A3AC402, 0x8A3B0402, 0x8A3B4402, 0x8A3B8402, 0x8A3BC402, 0x8A3C0402, 0x00000000,
+		0x8A3C4402, 0x8A3C8402, 0x8A3CC402, 0x8A3D0402, 0x8A3D4402, 0x8A3D8402, 0x8A3DC402, 0x8A3E0402,
+		0x8A400402, 0x8A404402, 0x8A408402, 0x8A40C402, 0x8A410402, 0x8A414402, 0x8A418402, 0x8A41C402,
+		0x8A420402, 0x8A424402, 0x8A428402, 0x8A42C402, 0x8A430402, 0x8A434402, 0x8A438402, 0x8A43C402,
+		0x8A440402, 0x8A444402, 0x8A448402, 0x8A44C402, 0x8A450402, 0x8A454402, 0x8A458402, 0x8A45C402,
+		0x8A47C402, 0x8A480402, 0x8A484402, 0x8A488402, 0x8A48C402, 0x8A490402, 0x8A494402, 0x8A498402,
+		0x8A4A0402, 0x8A4A4402, 0x8A4A8402, 0x8A4AC402, 0x8A4B0402, 0x8A4B4402, 0x8A4B8402, 0x8A4BC402,
+		0x8A4C4402, 0x8A4C8402, 0x8A4CC402, 0x8A4D0402, 0x8A4D4402, 0x8A4D8402, 0x8A4DC402, 0x8A4E0402,
+		0x8A4E4402, 0x00000000, 0x8A4E8402, 0x8A4EC402, 0x8A4F0402, 0x8A4F4402, 0x00000000, 0x00000000,
+		0x8A4F8402, 0x8A4FC402, 0x8A500402, 0x8A504402, 0x8A508402, 0x8A50C402, 0x8A510402, 0x8A514402,
+		0x8A528402, 0x8A52C402, 0x8A530402, 0x8A534402, 0x8A538402, 0x8A53C402, 0x8A540402, 0x8A544402,
+		0x8A54C402, 0x8A550402, 0x8A554402, 0x8A558402, 0x8A55C402, 0x8A560402, 0x8A564402, 0x8A568402,
+		0x8A58C402, 0x8A590402, 0x8A594402, 0x8A598402, 0x8A59C402, 0x8A5A0402, 0x8A5A4402, 0x8A5A8402,
+		0x8A5B0402, 0x8A5B4402, 0x8A5B8402, 0x8A5BC402, 0x8A5C0402, 0x8A5C4402, 0x8A5C8402, 0x8A5CC402,
+		0x8A5EC402, 0x8A5F0402, 0x8A5F4402, 0x8A5F8402, 0x8A5FC402, 0x8A600402, 0x8A604402, 0x8A608402,
+		0x8A60C402, 0x8A610402, 0x8A614402, 0x8A618402, 0x8A61C402, 0x8A620402, 0x8A624402, 0x8A628402,
+		0x8A63C402, 0x8A640402, 0x8A644402, 0x8A648402, 0x8A64C402, 0x8A650402, 0x8A654402, 0x8A658402,
+		0x8A670402, 0x8A674402, 0x8A678402, 0x00000000, 0x00000000, 0x800016A2, 0x80001682, 0x80001662,
+		0xC0B40402, 0xC0960402, 0xC0A0C402, 0xC0964402, 0xC0968402, 0xC096C402, 0xC0970402, 0xC09CC402,
+		0xC0B44402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0xC7640402, 0xC7644402, 0xC7648402, 0xC764C402, 0xC7650402, 0xC7654402,
+		0xC7658402, 0xC765C402, 0xC7660402, 0xC7664402, 0xC7668402, 0x00000000, 0x00000000, 0x00000000,
+		0x8A0CC402, 0x8A0D0402, 0x8A0D4402, 0x8A0D8402, 0x8A208402, 0x8A20C402, 0x8A210402, 0x8A214402,
+		0x8A62C402, 0x8A630402, 0x8A634402, 0x8A638402, 0x8A65C402, 0x8A660402, 0x8A664402, 0x8A668402,
+		0xC13E8402, 0xC13EC402, 0xC13F0402, 0xC13F4402, 0xC13F8402, 0xC13FC402, 0xC1400402, 0xC1404402,
+		0xC1408402, 0xC140C402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8E378408, 0x8E37C408, 0x8E380408, 0x8E384408, 0x8E388408, 0x8E38C408, 0x8E390408, 0x8E394408,
+		0x8E398408, 0x8E39C408, 0x8E3A0408, 0x8E3A4408, 0x8E3A8408, 0x8E3AC408, 0x8E3B0408, 0x8E3B4408,
+		0x8E3B8408, 0x8E3BC408, 0x8E3C0408, 0x8E3C4408, 0x8E3C8408, 0x8E3CC408, 0x8E3D0408, 0x8E3D4408,
+		0x8E3D8408, 0x8E3DC408, 0x8E3E0408, 0x8E3E4408, 0x8E3E8408, 0x8E3EC408, 0x8E3F0408, 0x8E3F4408,
+		0x8E3F8408, 0x8E3FC408, 0x8E400408, 0x8E404408, 0x8E408408, 0x8E40C408, 0x8E410408, 0x8E414408,
+		0x8E418408, 0x8E41C408, 0x8E420408, 0x8E424408, 0x8E428408, 0x8E42C408, 0x8E430408, 0x8E434408,
+		0x8E438408, 0x8E43C408, 0x8E440408, 0x8E444408, 0x8E448408, 0x8E44C408, 0x8E450408, 0x8E454408,
+		0x8E458408, 0x8E45C408, 0x8E460408, 0x8E464408, 0x8E468408, 0x8E46C408, 0x8E470408, 0x8E474408,
+		0x8E478408, 0x8E47C408, 0x8E480408, 0x8E484408, 0x8E488408, 0x8E48C408, 0x8E490408, 0x8E494408,
+		0x8E498408, 0x8E49C408, 0x8E4A0408, 0x8E4A4408, 0x8E4A8408, 0x8E4AC408, 0x8E4B0408, 0x8E4B4408,
+		0x8E4B8408, 0x8E4BC408, 0x8E4C0408, 0x8E4C4408, 0x8E4C8408, 0x8E4CC408, 0x00000000, 0x00000000,
+		0x8E4B8402, 0x8E4BC402, 0x8E4C0402, 0x8E4C4402, 0x8E4C8402, 0x8E4CC402, 0x00000000, 0x00000000,
+		0xC083C402, 0x8E560402, 0x8E564402, 0x8E568402, 0x8E56C402, 0x8E570402, 0x8E574402, 0x8E578402,
+		0x8E57C402, 0x8E580402, 0x8E584402, 0x8E588402, 0x8E58C402, 0x8E590402, 0x8E594402, 0x8E598402,
+		0x8E59C402, 0x8E5A0402, 0x8E5A4402, 0x8E5A8402, 0x8E5AC402, 0x8E5B0402, 0x8E5B4402, 0x8E5B8402,
+		0x8E5BC402, 0x8E5C0402, 0x8E5C4402, 0x8E5C8402, 0x8E5CC402, 0x8E5D0402, 0x8E5D4402, 0x8E5D8402,
+		0x8E5DC402, 0x8E5E0402, 0x8E5E4402, 0x8E5E8402, 0x8E5EC402, 0x8E5F0402, 0x8E5F4402, 0x8E5F8402,
+		0x8E5FC402, 0x8E600402, 0x8E604402, 0x8E608402, 0x8E60C402, 0x8E610402, 0x8E614402, 0x8E618402,
+		0x8E61C402, 0x8E620402, 0x8E624402, 0x8E628402, 0x8E62C402, 0x8E630402, 0x8E634402, 0x8E638402,
+		0x8E63C402, 0x8E640402, 0x8E644402, 0x8E648402, 0x8E64C402, 0x8E650402, 0x8E654402, 0x8E658402,
+		0x8E65C402, 0x8E660402, 0x8E664402, 0x8E668402, 0x8E66C402, 0x8E670402, 0x8E674402, 0x8E678402,
+		0x8E67C402, 0x8E680402, 0x8E684402, 0x8E688402, 0x8E68C402, 0x8E690402, 0x8E694402, 0x8E698402,
+		0x8E69C402, 0x8E6A0402, 0x8E6A4402, 0x8E6A8402, 0x8E6AC402, 0x8E6B0402, 0x8E6B4402, 0x8E6B8402,
+		0x8E6BC402, 0x8E6C0402, 0x8E6C4402, 0x8E6C8402, 0x8E6CC402, 0x8E6D0402, 0x8E6D4402, 0x8E6D8402,
+		0x8E6DC402, 0x8E6E0402, 0x8E6E4402, 0x8E6E8402, 0x8E6EC402, 0x8E6F0402, 0x8E6F4402, 0x8E6F8402,
+		0x8E6FC402, 0x8E700402, 0x8E704402, 0x8E708402, 0x8E70C402, 0x8E710402, 0x8E714402, 0x8E718402,
+		0x8E71C402, 0x8E720402, 0x8E724402, 0x8E728402, 0x8E72C402, 0x8E730402, 0x8E734402, 0x8E738402,
+		0x8E73C402, 0x8E740402, 0x8E744402, 0x8E748402, 0x8E74C402, 0x8E750402, 0x8E754402, 0x8E758402,
+		0x8E75C402, 0x8E760402, 0x8E764402, 0x8E768402, 0x8E76C402, 0x8E770402, 0x8E774402, 0x8E778402,
+		0x8E77C402, 0x8E780402, 0x8E784402, 0x8E788402, 0x8E78C402, 0x8E790402, 0x8E794402, 0x8E798402,
+		0x8E79C402, 0x8E7A0402, 0x8E7A4402, 0x8E7A8402, 0x8E7AC402, 0x8E7B0402, 0x8E7B4402, 0x8E7B8402,
+		0x8E7BC402, 0x8E7C0402, 0x8E7C4402, 0x8E7C8402, 0x8E7CC402, 0x8E7D0402, 0x8E7D4402, 0x8E7D8402,
+		0x8E7DC402, 0x8E7E0402, 0x8E7E4402, 0x8E7E8402, 0x8E7EC402, 0x8E7F0402, 0x8E7F4402, 0x8E7F8402,
+		0x8E7FC402, 0x8E800402, 0x8E804402, 0x8E808402, 0x8E80C402, 0x8E810402, 0x8E814402, 0x8E818402,
+		0x8E81C402, 0x8E820402, 0x8E824402, 0x8E828402, 0x8E82C402, 0x8E830402, 0x8E834402, 0x8E838402,
+		0x8E83C402, 0x8E840402, 0x8E844402, 0x8E848402, 0x8E84C402, 0x8E850402, 0x8E854402, 0x8E858402,
+		0x8E85C402, 0x8E860402, 0x8E864402, 0x8E868402, 0x8E86C402, 0x8E870402, 0x8E874402, 0x8E878402,
+		0x8E87C402, 0x8E880402, 0x8E884402, 0x8E888402, 0x8E88C402, 0x8E890402, 0x8E894402, 0x8E898402,
+		0x8E89C402, 0x8E8A0402, 0x8E8A4402, 0x8E8A8402, 0x8E8AC402, 0x8E8B0402, 0x8E8B4402, 0x8E8B8402,
+		0x8E8BC402, 0x8E8C0402, 0x8E8C4402, 0x8E8C8402, 0x8E8CC402, 0x8E8D0402, 0x8E8D4402, 0x8E8D8402,
+		0x8E8DC402, 0x8E8E0402, 0x8E8E4402, 0x8E8E8402, 0x8E8EC402, 0x8E8F0402, 0x8E8F4402, 0x8E8F8402,
+		0x8E8FC402, 0x8E900402, 0x8E904402, 0x8E908402, 0x8E90C402, 0x8E910402, 0x8E914402, 0x8E918402,
+		0x8E91C402, 0x8E920402, 0x8E924402, 0x8E928402, 0x8E92C402, 0x8E930402, 0x8E934402, 0x8E938402,
+		0x8E93C402, 0x8E940402, 0x8E944402, 0x8E948402, 0x8E94C402, 0x8E950402, 0x8E954402, 0x8E958402,
+		0x8E95C402, 0x8E960402, 0x8E964402, 0x8E968402, 0x8E96C402, 0x8E970402, 0x8E974402, 0x8E978402,
+		0x8E97C402, 0x8E980402, 0x8E984402, 0x8E988402, 0x8E98C402, 0x8E990402, 0x8E994402, 0x8E998402,
+		0x8E99C402, 0x8E9A0402, 0x8E9A4402, 0x8E9A8402, 0x8E9AC402, 0x8E9B0402, 0x8E9B4402, 0x8E9B8402,
+		0x8E9BC402, 0x8E9C0402, 0x8E9C4402, 0x8E9C8402, 0x8E9CC402, 0x8E9D0402, 0x8E9D4402, 0x8E9D8402,
+		0x8E9DC402, 0x8E9E0402, 0x8E9E4402, 0x8E9E8402, 0x8E9EC402, 0x8E9F0402, 0x8E9F4402, 0x8E9F8402,
+		0x8E9FC402, 0x8EA00402, 0x8EA04402, 0x8EA08402, 0x8EA0C402, 0x8EA10402, 0x8EA14402, 0x8EA18402,
+		0x8EA1C402, 0x8EA20402, 0x8EA24402, 0x8EA28402, 0x8EA2C402, 0x8EA30402, 0x8EA34402, 0x8EA38402,
+		0x8EA3C402, 0x8EA40402, 0x8EA44402, 0x8EA48402, 0x8EA4C402, 0x8EA50402, 0x8EA54402, 0x8EA58402,
+		0x8EA5C402, 0x8EA60402, 0x8EA64402, 0x8EA68402, 0x8EA6C402, 0x8EA70402, 0x8EA74402, 0x8EA78402,
+		0x8EA7C402, 0x8EA80402, 0x8EA84402, 0x8EA88402, 0x8EA8C402, 0x8EA90402, 0x8EA94402, 0x8EA98402,
+		0x8EA9C402, 0x8EAA0402, 0x8EAA4402, 0x8EAA8402, 0x8EAAC402, 0x8EAB0402, 0x8EAB4402, 0x8EAB8402,
+		0x8EABC402, 0x8EAC0402, 0x8EAC4402, 0x8EAC8402, 0x8EACC402, 0x8EAD0402, 0x8EAD4402, 0x8EAD8402,
+		0x8EADC402, 0x8EAE0402, 0x8EAE4402, 0x8EAE8402, 0x8EAEC402, 0x8EAF0402, 0x8EAF4402, 0x8EAF8402,
+		0x8EAFC402, 0x8EB00402, 0x8EB04402, 0x8EB08402, 0x8EB0C402, 0x8EB10402, 0x8EB14402, 0x8EB18402,
+		0x8EB1C402, 0x8EB20402, 0x8EB24402, 0x8EB28402, 0x8EB2C402, 0x8EB30402, 0x8EB34402, 0x8EB38402,
+		0x8EB3C402, 0x8EB40402, 0x8EB44402, 0x8EB48402, 0x8EC14402, 0x8EB4C402, 0x8EB54402, 0x8EB58402,
+		0x8EB5C402, 0x8EB60402, 0x8EB64402, 0x8EB68402, 0x8EB6C402, 0x8EB70402, 0x8EB74402, 0x8EB78402,
+		0x8EB7C402, 0x8EB80402, 0x8EB84402, 0x8EB88402, 0x8EB8C402, 0x8EB90402, 0x8EB98402, 0x8EB9C402,
+		0x8EBA0402, 0x8EBA4402, 0x8EBA8402, 0x8EBAC402, 0x8EBB0402, 0x8EBB4402, 0x8EBD0402, 0x8EBD4402,
+		0x8EBD8402, 0x8EBDC402, 0x8EBE0402, 0x8EBE4402, 0x8EBE8402, 0x8EBEC402, 0x8EBF0402, 0x8EBF4402,
+		0x8EBF8402, 0x8EBFC402, 0x8EC00402, 0x8EC04402, 0x8EC08402, 0x8EC0C402, 0x8EC10402, 0x8EC18402,
+		0x8EC1C402, 0x8EC20402, 0x8EC24402, 0x8EC28402, 0x8EC2C402, 0x8EC30402, 0x8EC34402, 0x8EC38402,
+		0x8EC3C402, 0x8EC40402, 0x8EC44402, 0x8EC48402, 0x8EC4C402, 0x8EC50402, 0x8EC54402, 0x8EC58402,
+		0x8EC5C402, 0x8EC60402, 0x8EC64402, 0x8EC68402, 0x8EC6C402, 0x8EC70402, 0x8EC74402, 0x8EC78402,
+		0x8EC7C402, 0x8EC80402, 0x8EC84402, 0x8EC88402, 0x8EC8C402, 0x8EC90402, 0x8EC94402, 0x8EC98402,
+		0x8EC9C402, 0x8ECA0402, 0x8ECA4402, 0x8ECA8402, 0x8ECAC402, 0x8ECB0402, 0x8ECB4402, 0x8ECB8402,
+		0x8ECBC402, 0x8ECC0402, 0x8ECC4402, 0x8ECC8402, 0x8ECCC402, 0x8ECD0402, 0x8ECD4402, 0x8ECD8402,
+		0x8ECDC402, 0x8ECE0402, 0x8ECE4402, 0x8ECE8402, 0x8ECEC402, 0x8ECF0402, 0x8ECF4402, 0x8ECF8402,
+		0x8ECFC402, 0x8ED00402, 0x8ED04402, 0x8ED08402, 0x8ED0C402, 0x8ED10402, 0x8ED14402, 0x8ED18402,
+		0x8ED1C402, 0x8ED20402, 0x8ED24402, 0x8ED28402, 0x8ED2C402, 0x8ED30402, 0x8ED34402, 0x8ED38402,
+		0x8ED3C402, 0x8ED40402, 0x8ED44402, 0x8ED48402, 0x8ED4C402, 0x8ED50402, 0x8ED54402, 0x8ED58402,
+		0x8ED5C402, 0x8ED60402, 0x8ED64402, 0x8ED68402, 0x8ED6C402, 0x8ED70402, 0x8ED74402, 0x8ED78402,
+		0x8ED7C402, 0x8ED80402, 0x8ED84402, 0x8ED88402, 0x8ED8C402, 0x8ED90402, 0x8ED94402, 0x8ED98402,
+		0x8ED9C402, 0x8EDA0402, 0x8EDA4402, 0x8EDA8402, 0x8EDAC402, 0x8EDB0402, 0x8EDB4402, 0x8EDB8402,
+		0x8EDBC402, 0x8EDC0402, 0x8EDC4402, 0x8EDC8402, 0x8EDCC402, 0x8EDD0402, 0x8EDD4402, 0x8EDD8402,
+		0x8EDDC402, 0x8EDE0402, 0x8EDE4402, 0x8EDE8402, 0x8EDEC402, 0x8EDF0402, 0x8EDF4402, 0x8EDF8402,
+		0x8EDFC402, 0x8EE00402, 0x8EE04402, 0x8EE08402, 0x8EE0C402, 0x8EE10402, 0x8EE14402, 0x8EE18402,
+		0x8EE1C402, 0x8EE20402, 0x8EE24402, 0x8EE28402, 0x8EE2C402, 0x8EE30402, 0x8EE34402, 0x8EE38402,
+		0x8EE3C402, 0x8EE40402, 0x8EE44402, 0x8EE48402, 0x8EE4C402, 0x8EE50402, 0x8EE54402, 0x8EE58402,
+		0x8EE5C402, 0x8EE60402, 0x8EE64402, 0x8EE68402, 0x8EE6C402, 0x8EE70402, 0x8EE74402, 0x8EE78402,
+		0x8EE7C402, 0x8EE80402, 0x8EE84402, 0x8EE88402, 0x8EE8C402, 0x8EE90402, 0x8EE94402, 0x8EE98402,
+		0x8EE9C402, 0x8EEA0402, 0x8EEA4402, 0x8EEA8402, 0x8EEAC402, 0x8EEB0402, 0x8EEB4402, 0x8EEB8402,
+		0x8EEBC402, 0x8EEC0402, 0x8EEC4402, 0x8EEC8402, 0x8EECC402, 0x8EED0402, 0x8EED4402, 0x8EED8402,
+		0x8EEDC402, 0x8EEE0402, 0x8EEE4402, 0x8EEE8402, 0x8EEEC402, 0x8EEF0402, 0x8EEF4402, 0x8EEF8402,
+		0x8EEFC402, 0x8EF00402, 0x8EF04402, 0x8EF08402, 0x8EF0C402, 0x8EF10402, 0x8EF14402, 0x8EF18402,
+		0x8EF1C402, 0x8EF20402, 0x8EF24402, 0x8EF28402, 0x8EF2C402, 0xC165C402, 0xC0A18402, 0x8EB50402,
+		0x8EB94402, 0x8EBB8402, 0x8EBBC402, 0x8EBC0402, 0x8EBC4402, 0x8EBC8402, 0x8EBCC402, 0x8EF30402,
+		0x8EF34402, 0x8EF38402, 0x8EF3C402, 0x8EF40402, 0x8EF44402, 0x8EF48402, 0x8EF4C402, 0x8EF50402,
+		0xC0824404, 0x8F06C402, 0x8F070402, 0x8F074402, 0x8F078402, 0x8F07C402, 0x8F080402, 0x8F084402,
+		0x8F088402, 0x8F08C402, 0x8F090402, 0x8F094402, 0x8F098402, 0x8F09C402, 0x8F0A0402, 0x8F0A4402,
+		0x8F0A8402, 0x8F0AC402, 0x8F0B0402, 0x8F0B4402, 0x8F0B8402, 0x8F0BC402, 0x8F0C0402, 0x8F0C4402,
+		0x8F0C8402, 0x8F0CC402, 0x8F0D0402, 0xC0CC8402, 0xC0CCC402, 0x00000000, 0x00000000, 0x00000000,
+		0x8F0D4402, 0x00008D82, 0x8F0D8402, 0x8F168402, 0x00026082, 0x00012E42, 0x8F0DC402, 0x00027C42,
+		0x8F0E0402, 0x0003A9C2, 0x8F158402, 0x8F160402, 0x00033D82, 0x00048A42, 0x0004B202, 0x8F0E8402,
+		0x8F0EC402, 0x8F0F0402, 0x8F0F4402, 0x0000B702, 0x00035902, 0x00049042, 0x00034D42, 0x8F0FC402,
+		0x8F174402, 0x8F100402, 0x8F104402, 0x00039C42, 0x0001DBC2, 0x00013002, 0x8F108402, 0x0000FFC2,
+		0x00015BC2, 0x8F10C402, 0x00038182, 0x8F114402, 0x0001E282, 0x8F118402, 0x0001CA82, 0x8F11C402,
+		0x8F120402, 0x8F124402, 0x8F128402, 0x000051C2, 0x00036442, 0x00046802, 0x00044382, 0x8F130402,
+		0x00038FC2, 0x00029742, 0x8F134402, 0x00026002, 0x00047102, 0x00033FC2, 0x8F138402, 0x8F140402,
+		0x0004B782, 0x00019982, 0x8F144402, 0x0002D5C2, 0x8F148402, 0x0001DCC2, 0x8F14C402, 0x8F150402,
+		0x8F16C402, 0x8F17C402, 0x8F180402, 0x8F170402, 0x8F178402, 0x8F184402, 0x8F188402, 0x000097C2,
+		0x000491C2, 0x0001C002, 0x0000AD82, 0xC098C402, 0xC0990402, 0xC0994402, 0x0001E082, 0x0001DAC4,
+		0x0003E7C2, 0x8F0F8402, 0x8F12C402, 0x8F154402, 0x8F0E4402, 0x8F110402, 0x8F13C402, 0x8F15C402,
+		0x8F164402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8D218402, 0x8D21C402, 0x8D220402, 0x8D224402, 0x8D228402, 0x8D22C402, 0x8D230402, 0x8D234402,
+		0x8D238402, 0x8D23C402, 0x8D240402, 0x8D244402, 0x8D248402, 0x00000000, 0x8D24C402, 0x8D250402,
+		0x8D254402, 0x8D258402, 0x8D25C402, 0x8D260402, 0x8D264402, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8D268402, 0x8D26C402, 0x8D270402, 0x8D274402, 0x8D278402, 0x8D27C402, 0x8D280402, 0x8D284402,
+		0x8D288402, 0x8D28C402, 0x8D290402, 0x8D294402, 0x8D298402, 0x8D29C402, 0x8D2A0402, 0x8D2A4402,
+		0x8D2A8402, 0x8D2AC402, 0x8D2B0402, 0x8D2B4402, 0x8D2B8402, 0xC0A78402, 0xC0A7C402, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8D2BC402, 0x8D2C0402, 0x8D2C4402, 0x8D2C8402, 0x8D2CC402, 0x8D2D0402, 0x8D2D4402, 0x8D2D8402,
+		0x8D2DC402, 0x8D2E0402, 0x8D2E4402, 0x8D2E8402, 0x8D2EC402, 0x8D2F0402, 0x8D2F4402, 0x8D2F8402,
+		0x8D2FC402, 0x8D300402, 0x8D304402, 0x8D308402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8D30C402, 0x8D310402, 0x8D314402, 0x8D318402, 0x8D31C402, 0x8D320402, 0x8D324402, 0x8D328402,
+		0x8D32C402, 0x8D330402, 0x8D334402, 0x8D338402, 0x8D33C402, 0x00000000, 0x8D340402, 0x8D344402,
+		0x8D348402, 0x00000000, 0x8D34C402, 0x8D350402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8D9D4402, 0x8D9D8402, 0x8D9DC402, 0x8D9E0402, 0x8D9E4402, 0x8D9E8402, 0x8D9EC402, 0x8D9F0402,
+		0x8D9F4402, 0x8D9F8402, 0x8D9FC402, 0x8DA00402, 0x8DA04402, 0x8DA08402, 0x8DA0C402, 0x8DA10402,
+		0x8DA14402, 0x8DA18402, 0x8DA1C402, 0x8DA20402, 0x8DA24402, 0x8DA28402, 0x8DA2C402, 0x8DA30402,
+		0x8DA34402, 0x8DA38402, 0x8DA3C402, 0x8DA40402, 0x8DA44402, 0x8DA48402, 0x8DA4C402, 0x8DA50402,
+		0x8DA54402, 0x8DA58402, 0x8DA5C402, 0x8DA64402, 0x8DA68402, 0x8DA6C402, 0x8DA70402, 0x8DA74402,
+		0x8DA78402, 0x8DA7C402, 0x8DA80402, 0x8DA84402, 0x8DA88402, 0x8DA8C402, 0x8DA90402, 0x8DA94402,
+		0x8DA98402, 0x8DA9C402, 0x8DAA0402, 0x8DAA4402, 0x80000000, 0x80000000, 0x8DAA8402, 0x8DAAC402,
+		0x8DAB0402, 0x8DAB4402, 0x8DAB8402, 0x8DABC402, 0x8DAC0402, 0x8DAC4402, 0x8DAC8402, 0x8DACC402,
+		0x8DAD0402, 0x8DAD4402, 0x8DAD8402, 0x8DADC402, 0x8DAE0402, 0x8DAE4402, 0x80001882, 0x800018A2,
+		0x80001D02, 0x80001D22, 0x80001D42, 0x80000662, 0x80000662, 0x80000662, 0x80000662, 0x80000662,
+		0x80000662, 0x80000662, 0x8DAE8402, 0x80000000, 0xC0A8C402, 0xC0A90402, 0xC0980402, 0x87D2C402,
+		0xC10FC402, 0xC1100402, 0xC1104402, 0x87DD8402, 0x8DA60402, 0x80000662, 0x00000000, 0x00000000,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xC0FC8402, 0xC09FC402, 0xC08C0402, 0xC0A10402, 0xC0974402, 0xC0978402, 0xC0844402, 0xC0848402,
+		0xC08C4402, 0xC0A14402, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x00000000,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8E0F8402, 0x8E100402, 0x8E10C402, 0x8E124402, 0x8E12C402, 0x8E138402, 0x8E140402, 0x8E14C402,
+		0x8E150402, 0x8E154402, 0x8E168402, 0x8E170402, 0x8E17C402, 0x8E184402, 0x8E198402, 0x8E1A0402,
+		0x8E1A4402, 0x8E1A8402, 0x8E1C4402, 0x8E1D0402, 0x8E1DC402, 0x8E1F4402, 0x8E204402, 0x8E210402,
+		0x8E218402, 0x8E220402, 0x8E22C402, 0x8E240402, 0x8E244402, 0x8E250402, 0x8E260402, 0x8E26C402,
+		0x8E270402, 0x8E274402, 0x8E278402, 0x8E0F4402, 0x8E104402, 0x8E110402, 0x8E128402, 0x8E130402,
+		0x8E13C402, 0x8E144402, 0x8E158402, 0x8E16C402, 0x8E174402, 0x8E180402, 0x8E188402, 0x8E19C402,
+		0x8E1C8402, 0x8E1D4402, 0x8E1E0402, 0x8E1F8402, 0x8E248402, 0x8E208402, 0x8E21C402, 0x8E230402,
+		0x8E258402, 0x8E264402, 0x8E27C402, 0x8E280402, 0x8E1EC402, 0x8E108402, 0x8E114402, 0x8E120402,
+		0x8E148402, 0x8E134402, 0x8E15C402, 0x8E234402, 0x8E18C402, 0x8E194402, 0x8E178402, 0x8E1AC402,
+		0x8E1CC402, 0x8E1D8402, 0x8E1FC402, 0x8E224402, 0x8E25C402, 0x8E268402, 0x8E24C402, 0x8E254402,
+		0x8E284402, 0x8E1E4402, 0x8E20C402, 0x8E118402, 0x8E238402, 0x8E214402, 0x8E228402, 0x8E200402,
+		0x8E1E8402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8E0D8402, 0x8E0DC402, 0x8E0E0402, 0x8E0E4402, 0x8E0E8402, 0x8E0EC402, 0x8E0F0402, 0x8E0FC402,
+		0x8E11C402, 0x8E23C402, 0x8E160402, 0x8E1F0402, 0x8E288402, 0x8E290402, 0x8E294402, 0x8E29C402,
+		0x8E2A0402, 0x8E2AC402, 0x8E2B4402, 0x8E2B8402, 0x8E2C0402, 0x8E2C8402, 0x8E2D0402, 0x8E2D4402,
+		0x8E2A4402, 0x8E2CC402, 0x8E190402, 0x8E164402, 0x8E1B0402, 0x8E1B4402, 0x8E28C402, 0x8E298402,
+		0x8E2A8402, 0x8E2B0402, 0x8E1B8402, 0x8E2C4402, 0x8E1BC402, 0x8E1C0402, 0x8E2D8402, 0x8E2DC402,
+		0x8E2BC402, 0x8E2E4402, 0x8E2E0402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8EF54402, 0x8EF58402, 0x8EF5C402, 0x8EF60402, 0x8EF64402, 0x8EF68402, 0x8EF6C402, 0x8EF70402,
+		0x8EF74402, 0x8EF78402, 0x8EF7C402, 0x8EF80402, 0x8EF84402, 0x8EF88402, 0x8EF8C402, 0x8EF90402,
+		0x8EF94402, 0x8EF98402, 0x8EF9C402, 0x8EFA0402, 0x8EFA4402, 0x8EFA8402, 0x8EFAC402, 0x8EFB0402,
+		0x8EFB4402, 0x8EFB8402, 0x8EFBC402, 0x8EFC0402, 0x8EFC4402, 0x8EFC8402, 0x8EFCC402, 0x8EFD0402,
+		0x8EFD4402, 0x8EFD8402, 0x8EFDC402, 0x8EFE0402, 0x8EFE4402, 0x8EFE8402, 0x8EFEC402, 0x8EFF0402,
+		0x8EFF4402, 0x8EFF8402, 0x8EFFC402, 0x8F000402, 0x8F004402, 0x8F008402, 0x8F00C402, 0x8F010402,
+		0x8F014402, 0x8F018402, 0x8F01C402, 0x8F020402, 0x8F024402, 0x8F028402, 0x8F02C402, 0x8F030402,
+		0x8F034402, 0x8F038402, 0x8F03C402, 0x8F040402, 0x8F044402, 0x8F048402, 0x8F04C402, 0x8F050402,
+		0x8F054402, 0x8F058402, 0x8F05C402, 0x8F060402, 0x8F064402, 0x8F068402, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8D150402, 0x8D154402, 0x8D158402, 0x8D15C402, 0x8D160402, 0x8D164402, 0x8D168402, 0x8D16C402,
+		0x8D170402, 0x8D174402, 0x8D178402, 0x8D17C402, 0x8D180402, 0x8D184402, 0x8D188402, 0x8D18C402,
+		0x8D190402, 0x8D194402, 0x8D198402, 0x8D19C402, 0x8D1A0402, 0x8D1A4402, 0x8D1A8402, 0x8D1AC402,
+		0x8D1B0402, 0x8D1B4402, 0x8D1B8402, 0x8D1BC402, 0x8D1C0402, 0x0001E382, 0x00020C42, 0x00000000,
+		0x8D1C4402, 0x8D1C8402, 0x8D1CC402, 0x8D1D0402, 0x8D1D4402, 0x8D1D8402, 0x8D1DC402, 0x8D1E0402,
+		0x8D1E4402, 0x8D1E8402, 0x8D1EC402, 0x8D1F0402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8D1F4402, 0x8D1F8402, 0x8D1FC402, 0x8D200402, 0x8D204402, 0x8D208402, 0x8D20C402, 0x8D210402,
+		0x8D214402, 0x80001E62, 0x80001E82, 0x80001EA2, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xC1660402, 0x00000000, 0x00000000, 0x00000000, 0xC09AC402, 0xC09D0402, 0x87E60402, 0x87E64402,
+		0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402, 0x87E80402, 0x87E84402,
+		0x8DAEC402, 0x8DAF0402, 0x8DAF4402, 0x8DAF8402, 0x8DAFC402, 0x8DB00402, 0x8DB04402, 0x8DB08402,
+		0x8DB0C402, 0x8DB10402, 0x8DB14402, 0x8DB18402, 0x8DB1C402, 0x8DB20402, 0x8DB24402, 0x8DB28402,
+		0x8DB2C402, 0x8DB30402, 0x8DB34402, 0x8DB38402, 0x8DB3C402, 0x8DB40402, 0x8DB44402, 0x8DB48402,
+		0x8DB4C402, 0x8DB50402, 0x8DB54402, 0x8DB58402, 0x8DB5C402, 0x8DB60402, 0x00000000, 0x00000000,
+		0x8DB64402, 0x8DB68402, 0x8DB6C402, 0x8DB70402, 0x8DB74402, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8DB78402, 0x8DB7C402, 0x8DB80402, 0x8DB84402, 0x8DB88402, 0x8DB8C402, 0x8DB90402, 0x8DB94402,
+		0x8DB98402, 0x8DB9C402, 0x8DBA0402, 0x8DBA4402, 0x8DBA8402, 0x8DBAC402, 0x8DBB0402, 0x8DBB4402,
+		0x8DBB8402, 0x8DBBC402, 0x8DBC0402, 0x8DBC4402, 0x8DBC8402, 0x8DBCC402, 0x8DBD0402, 0x8DBD4402,
+		0x8DBD8402, 0x8DBDC402, 0x8DBE0402, 0x8DBE4402, 0x8DBE8402, 0x8DBEC402, 0x8DBF0402, 0x8DBF4402,
+		0x8DBF8402, 0x8DBFC402, 0x8DC00402, 0x8DC04402, 0x8DC08402, 0x8DC0C402, 0x8DC10402, 0x8DC14402,
+		0x8DC18402, 0x8DC1C402, 0x8DC20402, 0x8DC24402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8DC28402, 0x8DC2C402, 0x8DC30402, 0x8DC34402, 0x8DC38402, 0x00016721, 0x00004461, 0x00048161,
+		0x8DC48402, 0x8DC4C402, 0x0003CF21, 0x8DC54402, 0x8DC58402, 0x8DC5C402, 0x8DC60402, 0x8DC64402,
+		0x8DC68402, 0x8DC6C402, 0x8DC70402, 0x8DC74402, 0x8DC78402, 0x8DC7C402, 0x8DC80402, 0x8DC84402,
+		0x8DC88402, 0x8DC8C402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0x87E64402, 0x00000000, 0x00000000, 0x00000000, 0x0003ED42, 0x0003DAC3,
+		0xC167C402, 0xC1680402, 0xC1684402, 0xC1688402, 0xC168C402, 0xC1690402, 0xC1694402, 0xC1698402,
+		0xC169C402, 0xC16A0402, 0xC16A4402, 0xC16A8402, 0xC16AC402, 0xC16B0402, 0xC16B4402, 0xC16B8402,
+		0xC16BC402, 0xC16C0402, 0xC16C4402, 0xC16C8402, 0xC16CC402, 0xC16D0402, 0xC16D4402, 0xC16D8402,
+		0xC16DC402, 0xC16E0402, 0xC16E4402, 0xC16E8402, 0xC16EC402, 0xC16F0402, 0xC16F4402, 0xC16F8402,
+		0x8D354402, 0x8D358402, 0x8D35C402, 0x8D360402, 0x8D364402, 0x8D368402, 0x8D36C402, 0x8D370402,
+		0x8D374402, 0x8D378402, 0x8D37C402, 0x8D380402, 0x8D384402, 0x8D388402, 0x8D38C402, 0x8D390402,
+		0x8D394402, 0x8D398402, 0x8D39C402, 0x8D3A0402, 0x8D3A4402, 0x8D3A8402, 0x8D3AC402, 0x8D3B0402,
+		0x8D3B4402, 0x8D3B8402, 0x8D3BC402, 0x8D3C0402, 0x00000000, 0x00000000, 0xC0B48402, 0xC0B4C402,
+		0x8DC90402, 0x8DC94402, 0x8DC98402, 0x8DC9C402, 0x8DCA0402, 0x8DCA4402, 0x8DCA8402, 0x8DCAC402,
+		0x8DCB0402, 0x8DCB4402, 0x8DCB8402, 0x8DCBC402, 0x8DCC0402, 0x8DCC4402, 0x8DCC8402, 0x8DCCC402,
+		0x8DCD0402, 0x8DCD4402, 0x8DCD8402, 0x8DCDC402, 0x8DCE0402, 0x8DCE4402, 0x8DCE8402, 0x8DCEC402,
+		0x8DCF0402, 0x8DCF4402, 0x8DCF8402, 0x8DCFC402, 0x8DD00402, 0x8DD04402, 0x8DD08402, 0x8DD0C402,
+		0x8DD10402, 0x8DD14402, 0x8DD18402, 0x8DD1C402, 0x8DD20402, 0x8DD24402, 0x8DD28402, 0x8DD2C402,
+		0x8DD30402, 0x8DD34402, 0x8DD38402, 0x8DD3C402, 0x8DD40402, 0x8DD64402, 0x8DD68402, 0x8DD6C402,
+		0x8DD70402, 0x8DD74402, 0x8DD78402, 0x8DD44402, 0x0003B443, 0x8DD4C402, 0x8DD50402, 0x8DD54402,
+		0x8DCA8404, 0x8DCA8404, 0x8DCFC404, 0x8DCFC404, 0x8DD58402, 0x8DD5C402, 0x8DD60402, 0x00000000,
+		0x8DDC0402, 0x8DD7C402, 0x8DD84402, 0x8DD88402, 0x8DD88404, 0x8DD8C402, 0x8DD90402, 0x8DD94402,
+		0x8DD98402, 0x8DD9C402, 0x8DDA0402, 0x8DD48402, 0x8DD80402, 0x8DDBC402, 0x8DDA4402, 0x8DDA8402,
+		0x8DDB0402, 0x8DDB4402, 0x8DDB8402, 0x8DDAC402, 0x80001882, 0x80001D62, 0x80001D82, 0x80001DA2,
+		0x80001DC2, 0x80001DE2, 0x80001E02, 0x80001E22, 0x80001E42, 0x00000000, 0x00000000, 0x80000000,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xC1108402, 0xC110C402, 0xC1110402, 0xC1114402, 0xC1118402, 0xC111C402, 0xC1120402, 0x87D30402,
+		0xC0A94402, 0xC0A98402, 0xC0A9C402, 0xC0AA0402, 0xC1124402, 0xC1128402, 0x00000000, 0x00000000,
+		0x80000662, 0x80000662, 0x80000662, 0x80000662, 0x80000662, 0x80000682, 0x80000682, 0x80000682,
+		0x80000682, 0x80000682, 0x80000682, 0x80000662, 0x80000662, 0x80000682, 0x800006C2, 0x88964404,
+		0x88980404, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x80001862, 0x80001862, 0x80001882, 0x80001922, 0x800018A2, 0x00036DE1, 0x00000000, 0x00000C21,
+		0x00000000, 0x00013BE1, 0x00000000, 0x0002A9E1, 0x00000000, 0x00021DE1, 0x00000000, 0x8DF00402,
+		0x8DF04402, 0x0004BE61, 0x00000000, 0x8DF10402, 0x8DF1C402, 0x8DF20402, 0x8DF24402, 0x8DF28402,
+		0x8DF2C402, 0x8DF30402, 0x8DF34402, 0x8DF38402, 0x8DF3C402, 0x8DF40402, 0x8DF44402, 0x8DF48402,
+		0x8DF4C402, 0x8DF50402, 0x8DF54402, 0x8DF5C402, 0x8DF60402, 0x8DF64402, 0x8DF68402, 0x8DF6C402,
+		0x8DF74402, 0x8DF78402, 0x8DF7C402, 0x8DF80402, 0x8DF84402, 0x8DF88402, 0x8DF8C402, 0x8DF90402,
+		0x8DF98402, 0x8DF9C402, 0x8DFA0402, 0x8DFAC402, 0x80001842, 0x8DFB0402, 0x8DFB4402, 0x8DFB8402,
+		0x8DFBC402, 0x8DFC0402, 0x00043FE1, 0x00000000, 0x000482E1, 0x00000000, 0x0002FAA1, 0x00030B21,
+		0x00000000, 0x00000000, 0x0001EFA1, 0x00000000, 0x8DFEC402, 0x8DF14402, 0x8DF18402, 0x8DF58402,
+		0x8DF70402, 0x8DF94402, 0x8DFA4402, 0x8DFA8402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0xC0B50402, 0xC0B54402, 0xC0A1C402, 0xC0984402, 0xC0AA4402, 0xC0AA8402,
+		0xC0840402, 0xC16FC402, 0xC1700402, 0xC1704402, 0xC1708402, 0xC170C402, 0xC1710402, 0xC1714402,
+		0xC1718402, 0xC171C402, 0xC1720402, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0xC1724402, 0xC1728402, 0xC172C402, 0xC1730402,
+		0xC1734402, 0xC1738402, 0xC173C402, 0xC1740402, 0xC1744402, 0x00000000, 0x00000000, 0x00000000,
+		0x80001882, 0x80001962, 0x800018A2, 0x8C4E8402, 0x8C4EC402, 0x8C4F0402, 0x8C4F4402, 0x8C4F8402,
+		0x8C4FC402, 0x8C500402, 0x8C504402, 0x8C50C402, 0x8C510402, 0x8C514402, 0x8C518402, 0x8C51C402,
+		0x8C520402, 0x8C524402, 0x8C528402, 0x8C52C402, 0x8C530402, 0x8C534402, 0x8C538402, 0x8C53C402,
+		0x8C540402, 0x8C548402, 0x8C550402, 0x8C558402, 0x8C564402, 0x8C570402, 0x8C578402, 0x8C57C402,
+		0x8C584402, 0x8C554402, 0x8C55C402, 0x8C568402, 0x8C588402, 0x8C58C402, 0x8C590402, 0x8C594402,
+		0x8C598402, 0x8C59C402, 0x8C5A0402, 0x8C5A4402, 0x8C54C402, 0x8C574402, 0x8C508402, 0x8C580402,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0x8C4E8404, 0x8C560402, 0x8C56C402, 0x8C544402, 0x8C504419, 0x8C548419,
+		0x8D420402, 0x8D420404, 0x8D424402, 0x8D424404, 0x8D424404, 0x8D428402, 0x8D428404, 0x8D42C402,
+		0x8D42C404, 0x8D430402, 0x8D430404, 0x8D434402, 0x8D434404, 0x8D434404, 0x8D438402, 0x8D438404,
+		0x8D43C402, 0x8D440402, 0x8D444402, 0x8D444404, 0x8D448402, 0x8D448404, 0x8D44C402, 0x8D44C404,
+		0x8D450402, 0x8D450404, 0x8D450404, 0x8D454402, 0x8D454404, 0x8D458402, 0x8D45C402, 0x8D45C404,
+		0x8D460402, 0x8D464402, 0x8D468402, 0x8D46C402, 0x8D470402, 0x8D474402, 0x80001842, 0x8D478402,
+		0x8D478404, 0x8D47C402, 0x8D480402, 0x8D480404, 0x8D484402, 0x8D484404, 0x8D488402, 0x8D488404,
+		0x8D48C402, 0x8D490402, 0x8D494402, 0x8D498402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xC1158402, 0xC115C402, 0xC1160402, 0xC1164402,
+		0x8CF98402, 0x8CF9C402, 0x8CFA0402, 0x8CFA4402, 0x8CFA8402, 0x8CFAC402, 0x8CFB0402, 0x8CFB4402,
+		0x8CFB8402, 0x8CFBC402, 0x8CFCC402, 0x8CFD0402, 0x8CFD4402, 0x8CFD8402, 0x8CFDC402, 0x8CFE0402,
+		0x8CFE4402, 0x8CFE8402, 0x8CFEC402, 0x8CFF0402, 0x8CFF4402, 0x8CFF8402, 0x8CFFC402, 0x8D000402,
+		0x8D004402, 0x8D008402, 0x8D00C402, 0x8D014402, 0x8D01C402, 0x8D020402, 0x8D024402, 0x8D028402,
+		0x8D02C402, 0x8D030402, 0x8D034402, 0x8D038402, 0x8D010402, 0x8D018402, 0x8D040402, 0x8D044402,
+		0x8D048402, 0x8D04C402, 0x8D050402, 0x8D054402, 0x8D058402, 0x8D05C402, 0x8D060402, 0x8D064402,
+		0x8D068402, 0x8D06C402, 0x8D070402, 0x8D074402, 0x8D078402, 0x8D07C402, 0x8D03C402, 0x80001842,
+		0x00000000, 0x00000000, 0x00000000, 0xC0A68402, 0xC0A6C402, 0xC10E0402, 0xC10E4402, 0xC10E8402,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0x00000000, 0x00000000, 0x00000000, 0x8CFC0402, 0x8CFC4402, 0x8CFC8402,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0x8E2E8402, 0x8E2EC402, 0x8E2F0402, 0x8E2F4402, 0x8E2F8402, 0x8E2FC402,
+		0x8E300402, 0x8E304402, 0x8E308402, 0x8E30C402, 0x8E310402, 0x8E314402, 0x8E318402, 0x8E31C402,
+		0x8E320402, 0x8E324402, 0x8E328402, 0x8E32C402, 0x8E330402, 0x8E334402, 0x8E338402, 0x8E33C402,
+		0x8E340402, 0x8E344402, 0x8E348402, 0x8E34C402, 0x8E350402, 0x8E354402, 0x8E358402, 0x8E35C402,
+		0x8E360402, 0x8E364402, 0x8E368402, 0x8E36C402, 0x8E370402, 0x8E374402, 0xC0B2C402, 0xC0B30402,
+		0x88E5C404, 0x88EBC404, 0x89130404, 0x891A8404, 0x891CC404, 0x891CC404, 0x893D0404, 0x89414404,
+		0x89238404, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8967C408, 0x89684408, 0x8968C408, 0x89694408, 0x8969C408, 0x896A4408, 0x896AC408, 0x896BC408,
+		0x896C4408, 0x896CC408, 0x896D4408, 0x896DC408, 0x896E4408, 0x896F4408, 0x896FC408, 0x89704408,
+		0x8970C408, 0x89714408, 0x8971C408, 0x8972C408, 0x89734408, 0x8973C408, 0x89744408, 0x8974C408,
+		0x89754408, 0x8975C408, 0x89764408, 0x8976C408, 0x89774408, 0x8977C408, 0x89784408, 0x89794408,
+		0x8979C408, 0x896B4408, 0x896EC408, 0x89724408, 0x8978C408, 0x897A4408, 0x897AC408, 0x897B0408,
+		0x897B8408, 0x897BC408, 0x897C0408, 0x00000000, 0x00000000, 0x897C4408, 0x897CC408, 0x897D0408,
+		0xC112C402, 0xC1130402, 0xC1134402, 0xC1138402, 0xC113C402, 0xC1140402, 0xC1144402, 0xC1148402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x8A878402, 0x8A878404, 0x8A878404, 0x8A878404, 0x80001882, 0x8A878404, 0x8A878404,
+		0x8A878404, 0x8A878404, 0x800018A2, 0x800018A2, 0x80000000, 0x8A87C402, 0x8A880402, 0x80000000,
+		0x80000000, 0x80000000, 0x8A878404, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x87E98402, 0x87EA8402, 0x87EAC402, 0x87F24402, 0x87F68402, 0x87FBC402, 0x87FC0402, 0x8802C402,
+		0x880C4402, 0x88278402, 0x882CC402, 0x88320402, 0x8837C402, 0x88434402, 0x88484402, 0x88500402,
+		0x8854C402, 0x88504402, 0x88550402, 0x88534402, 0x8851C402, 0x885A8402, 0x88564402, 0x88568402,
+		0x885BC402, 0x88678402, 0x886A0402, 0x887EC402, 0x8886C402, 0x88874402, 0x88878402, 0x888F4402,
+		0x8892C402, 0x88974402, 0x88A28402, 0x88A9C402, 0x88BBC402, 0x88BC0402, 0x88C84402, 0x88CBC402,
+		0x88CD4402, 0x88CE8402, 0x88D14402, 0x89064402, 0x87E8841D, 0x00024C43, 0x87EF041D, 0x87F20402,
+		0x87FAC41D, 0x8801C41D, 0x8805441D, 0x8814441D, 0x881D441D, 0x8824041D, 0x882AC41D, 0x8831041D,
+		0x8835841D, 0x8842441D, 0x8846041D, 0x88480402, 0x884F041D, 0x8859841D, 0x885AC41D, 0x8864C41D,
+		0x887DC41D, 0x8885C41D, 0x8896441D, 0x87E88414, 0x87EB4414, 0x87EC4414, 0x87EAC414, 0x87EF0414,
+		0x87FAC414, 0x8801C414, 0x88068414, 0x8807C414, 0x880C4414, 0x88144414, 0x88278414, 0x88310414,
+		0x88424414, 0x884DC414, 0x884F0414, 0x8853C414, 0x88564414, 0x88568414, 0x885AC414, 0x887DC414,
+		0x8885C414, 0x88874414, 0x888E0414, 0x8891C414, 0x88BC0414, 0x88C7C414, 0x88C80414, 0x88C88414,
+		0x88D08414, 0x88D0C414, 0x88240415, 0x8864C415, 0x8885C415, 0x8891C415, 0x88C7C415, 0x88C80415,
+		0x88CE4415, 0x88D08415, 0x88D0C415, 0x8887C402, 0x87F28402, 0x87FC8402, 0x88124402, 0x88438402,
+		0x88488402, 0x885C8402, 0x8868C402, 0x88700402, 0x88760402, 0x88804402, 0x88A3C402, 0x881AC402,
+		0x890C4414, 0x00033202, 0x0003DF83, 0x8828C402, 0x882A8402, 0x885C0402, 0x888A0402, 0x88918402,
+		0x87F30402, 0x87FCC402, 0x88128402, 0x88188402, 0x88324402, 0x883C4402, 0x8843C402, 0x884B0402,
+		0x885CC402, 0x886B4402, 0x88764402, 0x887A4402, 0x88934402, 0x889A0402, 0x88A40402, 0x87EA0402,
+		0x87ED8402, 0x87FF0402, 0x88048402, 0x8808C402, 0x880C0402, 0x88078402, 0x88290402, 0x88558402,
+		0x887C8402, 0x888A4402, 0x88AB0402, 0x87EDC414, 0x87F58414, 0x87F94414, 0x00002282, 0x880B0414,
+		0x88108414, 0x882F0414, 0x88154414, 0x888B0414, 0x8827C414, 0x88298414, 0x88260414, 0x8828C414,
+		0x882E0414, 0x883C8414, 0x883C4414, 0x88368414, 0x88440414, 0x888F8414, 0x8848C414, 0x884B4414,
+		0x88470414, 0x88570414, 0x885EC414, 0x88768414, 0x88790414, 0x88808414, 0x88888414, 0x88908414,
+		0x8886C414, 0x88938414, 0x88954414, 0x88A18414, 0x88A54414, 0x88A64414, 0x88A8C414, 0x88CA8414,
+		0x80000662, 0x80000662, 0x80000682, 0x80000662, 0x80000662, 0x80000662, 0x80000662, 0x80000662,
+		0x80000662, 0x80000662, 0x8864C404, 0x80000662, 0x80000662, 0x80000662, 0x80000662, 0x80000682,
+		0x80000682, 0x80000662, 0x88B14404, 0x00042F82, 0x00021803, 0x0000E902, 0x00023542, 0x00029282,
+		0x0001D242, 0x0003C642, 0x88144404, 0x88168404, 0x88310404, 0x88358404, 0x88368404, 0x88434404,
+		0x88460404, 0x88470404, 0x88660404, 0x88674404, 0x88748404, 0x00011FC2, 0x88A18404, 0x87EC4404,
+		0x87EF0404, 0x87F54404, 0x88068404, 0x88108404, 0x883A8404, 0x000480C2, 0x885AC404, 0x88790404,
+		0x000178C2, 0x88964404, 0x00037982, 0x00047E82, 0x0001C7C2, 0x80000662, 0x80000662, 0x80000662,
+		0x80000662, 0x80000682, 0x00000000, 0x80000662, 0x80000682, 0x80000682, 0x80000662, 0x80000682,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x000100C2, 0x00000000, 0x88788402, 0x8878C402, 0x00021583, 0x88018402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x0003E502, 0x0001CB82, 0x88950408, 0x88950402, 0x88A00408, 0x88A00402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xC1300402, 0x00000000, 0xC1300402,
+		0xC1308402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xC1304402, 0x00000000,
+		0x00000000, 0x00000000, 0xC0824404, 0xC0824404, 0xC0824404, 0xC0824404, 0xC0824404, 0xC082441B,
+		0xC0824404, 0xC0824404, 0xC0824404, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0xC084C402, 0xC084C41B, 0xC0850402, 0xC0854402, 0xC0858402, 0xC085C402, 0xC0E50402, 0xC0830402,
+		0xC0C5C402, 0xC0C60402, 0xC0C64402, 0xC0C68402, 0xC0C78402, 0xC0C7C402, 0xC0C80402, 0xC0C84402,
+		0xC0ECC402, 0xC0ED0402, 0xC0EE4402, 0xC0EE8402, 0xC09F8404, 0x00024342, 0x00012A43, 0xC0EEC402,
+		0xC081C402, 0xC0820402, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0xC082441B,
+		0xC0EBC402, 0xC0EC4402, 0xC0EFC402, 0x0000C942, 0x00037083, 0xC0F00402, 0x00038702, 0x00013FC3,
+		0xC0F0C402, 0xC0C6C402, 0xC0C70402, 0xC0F10402, 0x0001ED82, 0xC09F0402, 0xC0828402, 0xC0F14402,
+		0xC0F1C402, 0xC0F24402, 0xC0F28402, 0xC0EF0402, 0xC19D8402, 0xC0CD0402, 0xC0CD4402, 0x0003F0C2,
+		0x00011742, 0x0002B7C2, 0xC0EA8402, 0xC0E74402, 0xC0EF4402, 0xC0EF8402, 0xC0E88402, 0xC08F0402,
+		0xC0F20402, 0xC0E8C402, 0xC19C8402, 0xC0868402, 0xC0F18402, 0xC0BE4402, 0xC0BE8402, 0x00048744,
+		0xC0BEC402, 0xC0BF0402, 0xC0BF4402, 0xC0BF8402, 0xC0BFC402, 0xC0C00402, 0xC0C04402, 0xC0824404,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x00000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x87E60414, 0x88240414, 0x00000000, 0x00000000, 0x87E70414, 0x87E74414, 0x87E78414, 0x87E7C414,
+		0x87E80414, 0x87E84414, 0xC1998414, 0xC19C4414, 0xC19AC414, 0xC0CA0414, 0xC0CA4414, 0x88460414,
+		0x87E60415, 0x87E64415, 0x87E68415, 0x87E6C415, 0x87E70415, 0x87E74415, 0x87E78415, 0x87E7C415,
+		0x87E80415, 0x87E84415, 0xC1998415, 0xC19C4415, 0xC19AC415, 0xC0CA0415, 0xC0CA4415, 0x00000000,
+		0x87E88415, 0x8801C415, 0x884F0415, 0x88990415, 0x88068415, 0x881D4415, 0x88310415, 0x88358415,
+		0x88424415, 0x88460415, 0x885AC415, 0x88748415, 0x887DC415, 0x00000000, 0x00000000, 0x00000000,
+		0x87DE0402, 0x87DE4402, 0x87DE8402, 0x87DEC402, 0x87DF0402, 0x87DF4402, 0x87DF8402, 0x87DFC402,
+		0x00010F82, 0x87E00402, 0x87E04402, 0x87E08402, 0x87E0C402, 0x87E10402, 0x87E14402, 0x87E18402,
+		0x87E1C402, 0x87E20402, 0x87E24402, 0x87E28402, 0x87E2C402, 0x87E30402, 0x87E34402, 0x87E38402,
+		0x87E3C402, 0x87E40402, 0x87E48402, 0x87E4C402, 0x87E50402, 0x87E54402, 0x87E58402, 0x87E5C402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x80002122, 0x80002142, 0x80002162, 0x80002162, 0x80002182, 0x800021A2, 0x800021C2, 0x800021E2,
+		0x800006A2, 0x800006A2, 0x800006A2, 0x80002202, 0x80002222, 0x800006C2, 0x800006C2, 0x800006C2,
+		0x800006C2, 0x80002242, 0x800006C2, 0x800006C2, 0x800006C2, 0x800006A2, 0x80002262, 0x80002282,
+		0x800022A2, 0x800022C2, 0x800006A2, 0x800006A2, 0x80000682, 0x80000682, 0x80000682, 0x80000682,
+		0x80000662, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x000189C3, 0x000092C3, 0x87F5840B, 0x00046702, 0xC1758402, 0x00012B83, 0x000244C3, 0x8807C40A,
+		0xC175C402, 0x0003B602, 0x88144405, 0x881D440B, 0x881D440B, 0x881D440B, 0x881D4405, 0x0004B682,
+		0x8824040B, 0x8824040B, 0x8835840B, 0x88358405, 0xC1760402, 0x8846040B, 0x00009842, 0xC1764402,
+		0xC1768402, 0x885AC40B, 0x8860040B, 0x8864C40B, 0x8864C40B, 0x8864C40B, 0xC176C402, 0xC1770402,
+		0x00002F82, 0x000153C3, 0x0004C182, 0xC1774402, 0x88A1840B, 0xC1778402, 0x00000000, 0xC177C402,
+		0x88A1840B, 0xC1780402, 0x00000000, 0x00000000, 0x87EF040B, 0x87F5840B, 0xC1784402, 0x8801C405,
+		0x8801C40B, 0x8810840B, 0x8813C408, 0x8842440B, 0x884F0405, 0x89878404, 0x8987C404, 0x89880404,
+		0x89884404, 0x88240405, 0xC1788402, 0x0003E443, 0x88CD0405, 0x88C80405, 0x88C8040B, 0x88CD040B,
+		0xC1994405, 0xC178C402, 0xC1790402, 0xC1794402, 0xC1798402, 0x87FAC40B, 0x87FAC405, 0x8801C405,
+		0x88240405, 0x882AC405, 0xC179C402, 0xC1C04402, 0xC17A0402, 0x00037EC3, 0x8813C402, 0xC17A4402,
+		0x00011043, 0x00022803, 0x0003CFC4, 0x00028483, 0x00006983, 0x0001A383, 0x00004D03, 0x00046283,
+		0x00001683, 0x00033303, 0x0003E1C3, 0x0001C843, 0x0003B0C3, 0x0002EA03, 0x0002C7C3, 0x0002D242,
+		0x8824040A, 0x000348C2, 0x00003603, 0x00013A02, 0x8891C40A, 0x0002B6C2, 0x00040603, 0x0000CEC4,
+		0x0003A102, 0x8899040A, 0x00006902, 0x00031383, 0x8835840A, 0x87F5840A, 0x87FAC40A, 0x8842440A,
+		0x88240404, 0x0002F882, 0x00007783, 0x00018D42, 0x8891C404, 0x00026EC2, 0x0003A283, 0x00010E84,
+		0x0003E302, 0x88990404, 0x00001582, 0x00035543, 0x88358404, 0x87F58404, 0x87FAC404, 0x88424404,
+		0xC766C402, 0xC7670402, 0xC7674402, 0x87FA4408, 0x87FA4402, 0x87E78402, 0xC7678402, 0xC767C402,
+		0xC7680402, 0x00001103, 0xC17A8402, 0xC17AC402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xC17B0402, 0xC17B8402, 0xC17B4402, 0xC17BC402, 0xC17C0402, 0xC17C4402, 0xC17C8402, 0xC17CC402,
+		0xC17D0402, 0xC17D4402, 0x00000000, 0x00000000, 0xC17D8402, 0xC17DC402, 0xC17E0402, 0xC17E4402,
+		0xC17E8402, 0xC17EC402, 0xC17F0402, 0xC17F4402, 0xC17F8402, 0xC17FC402, 0xC1800402, 0xC1804402,
+		0xC1808402, 0xC180C402, 0xC1810402, 0xC1814402, 0xC1818402, 0xC181C402, 0x00000000, 0xC1820402,
+		0xC1824402, 0xC1828402, 0xC182C402, 0xC1830402, 0xC1834402, 0xC1838402, 0xC183C402, 0xC1840402,
+		0xC1844402, 0xC1848402, 0xC184C402, 0xC1850402, 0xC1854402, 0xC1858402, 0xC185C402, 0xC1860402,
+		0xC1864402, 0xC1868402, 0xC186C402, 0xC1870402, 0xC1874402, 0xC1878402, 0xC187C402, 0xC1880402,
+		0xC1884402, 0xC1888402, 0xC188C402, 0xC1890402, 0xC1894402, 0x00000000, 0x00000000, 0x00000000,
+		0xC1898402, 0xC189C402, 0xC18A0402, 0xC18A4402, 0xC18A8402, 0xC18AC402, 0xC18B0402, 0xC18B4402,
+		0xC18B8402, 0xC18BC402, 0xC18C0402, 0xC18C4402, 0xC18C8402, 0xC18CC402, 0xC18D0402, 0xC18D4402,
+		0xC18D8402, 0xC18DC402, 0xC18E0402, 0xC18E4402, 0xC18E8402, 0xC18EC402, 0xC18F0402, 0xC18F4402,
+		0xC18F8402, 0xC18FC402, 0xC1900402, 0xC1904402, 0xC1908402, 0xC190C402, 0xC1910402, 0xC1914402,
+		0xC1918402, 0xC191C402, 0xC1920402, 0xC1924402, 0xC1928402, 0xC192C402, 0xC1930402, 0xC1934402,
+		0xC1938402, 0xC193C402, 0xC1940402, 0xC1944402, 0xC1948402, 0xC194C402, 0xC1950402, 0xC1954402,
+		0xC1958402, 0xC195C402, 0xC1960402, 0xC1964402, 0x00000000, 0xC1968402, 0xC196C402, 0xC1970402,
+		0xC1974402, 0x00000000, 0xC1978402, 0xC197C402, 0x00000000, 0xC1980402, 0xC1988402, 0xC198C402,
+		0xC1990402, 0xC1994402, 0xC19C4402, 0xC19CC402, 0xC19D0402, 0xC19D4402, 0xC19DC402, 0xC19E0402,
+		0xC19E4402, 0xC19E8402, 0xC19EC402, 0xC19F0402, 0xC19F8402, 0xC1A00402, 0xC1A04402, 0xC1A08402,
+		0xC1A0C402, 0xC1A10402, 0xC1A14402, 0xC1A18402, 0x00000000, 0xC1A1C402, 0x00000000, 0xC1A20402,
+		0xC1A24402, 0xC1A28402, 0xC1A2C402, 0xC1A30402, 0x00029382, 0x0003DE03, 0xC1A34402, 0x00041682,
+		0x00049303, 0xC1A38402, 0xC1A3C402, 0xC1A40402, 0xC1A44402, 0xC1A48402, 0xC1A4C402, 0xC1A50402,
+		0xC1A54402, 0xC1A58402, 0xC1A5C402, 0xC1A60402, 0xC1A64402, 0xC1A68402, 0xC1A6C402, 0xC1A70402,
+		0xC1A74402, 0x00000000, 0xC1A78402, 0xC1A7C402, 0x00000000, 0xC1A80402, 0xC1A84402, 0x00000000,
+		0xC1A88402, 0x00000000, 0xC1A8C402, 0xC1A90402, 0xC1A94402, 0xC1A98402, 0xC1A9C402, 0xC1AA0402,
+		0xC1AA4402, 0xC1AA8402, 0xC1AAC402, 0xC1AB0402, 0xC1AB4402, 0xC1AB8402, 0xC1ABC402, 0xC1AC0402,
+		0xC1AC4402, 0xC1AC8402, 0xC1ACC402, 0xC1AD0402, 0xC1AD4402, 0xC1AD8402, 0xC1ADC402, 0xC1AE0402,
+		0x00000000, 0xC1AE4402, 0x00000000, 0xC1AE8402, 0xC1AEC402, 0xC1AF0402, 0xC1AF4402, 0xC1AF8402,
+		0xC1AFC402, 0xC1B00402, 0xC1B04402, 0xC1B08402, 0xC1B0C402, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0xC1B10402, 0xC1B14402, 0x00000000, 0x00000000, 0xC1B18402, 0xC1B1C402,
+		0x00000000, 0x00000000, 0xC1B20402, 0xC1B24402, 0xC1B28402, 0xC1B2C402, 0xC1B30402, 0xC1B34402,
+		0x00000000, 0x00000000, 0xC1B38402, 0xC1B3C402, 0x00000000, 0x00000000, 0xC1B40402, 0xC1B44402,
+		0x00000000, 0x00000000, 0xC1B48402, 0xC1B4C402, 0xC1B50402, 0xC1B54402, 0xC1B58402, 0xC1B5C402,
+		0xC1B60402, 0xC1B64402, 0xC1B68402, 0xC1B6C402, 0xC1B70402, 0xC1B74402, 0xC1B78402, 0xC1B7C402,
+		0xC1B80402, 0xC1B84402, 0xC1B88402, 0xC1B8C402, 0xC1B90402, 0xC1B94402, 0xC1B98402, 0xC1B9C402,
+		0xC1BA0402, 0xC1BA4402, 0xC1BA8402, 0xC1BAC402, 0xC1BB0402, 0xC1BB4402, 0xC1BB8402, 0xC1BBC402,
+		0xC1BC0402, 0xC1BC4402, 0xC1BC8402, 0xC1BCC402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xC1BD0402, 0xC1BD4402, 0xC1BD8402, 0xC1BDC402, 0xC1BE0402, 0xC1BE4402, 0xC1BE8402, 0xC1BEC402,
+		0xC1BF0402, 0xC1BF4402, 0xC1BF8402, 0xC1BFC402, 0xC1C00402, 0xC1C08402, 0xC1C0C402, 0xC1C10402,
+		0xC1C14402, 0xC1C18402, 0xC1C1C402, 0xC1C20402, 0xC1C24402, 0xC1C28402, 0xC1C2C402, 0xC1C30402,
+		0xC1C34402, 0xC1C38402, 0xC1C3C402, 0xC1C40402, 0xC1C44402, 0xC1C48402, 0xC1C4C402, 0xC1C50402,
+		0xC1C54402, 0xC1C58402, 0xC1C5C402, 0xC1C60402, 0xC1C64402, 0xC1C68402, 0xC1C6C402, 0xC1C70402,
+		0xC1C74402, 0xC1C78402, 0xC1C7C402, 0xC1C80402, 0xC1C84402, 0xC1C88402, 0xC1C8C402, 0xC1C90402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xC1C94402, 0xC1C98402, 0xC1C9C402, 0xC1CA0402,
+		0xC1CA4402, 0xC1CA8402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xC1CAC402, 0xC1CB0402,
+		0xC1CB4402, 0xC1CB8402, 0xC1CBC402, 0xC1CC0402, 0xC1CC4402, 0xC1CC8402, 0xC1CCC402, 0xC1CD0402,
+		0xC1CD4402, 0xC1CD8402, 0xC1CDC402, 0xC1CE0402, 0xC1CE4402, 0xC1CE8402, 0xC1CEC402, 0xC1CF0402,
+		0xC1CF4402, 0xC1CF8402, 0xC1CFC402, 0xC1D00402, 0xC1D04402, 0xC1D08402, 0xC1D0C402, 0xC1D10402,
+		0xC0CD8402, 0xC0CDC402, 0xC0CE0402, 0xC0CE4402, 0xC1D14402, 0xC1D18402, 0xC1D1C402, 0xC1D20402,
+		0xC1D24402, 0xC1D28402, 0xC1D2C402, 0xC1D30402, 0xC1D34402, 0xC1D38402, 0xC1D3C402, 0xC1D40402,
+		0xC1D44402, 0xC1D48402, 0xC1D4C402, 0xC1D50402, 0xC1D54402, 0xC1D58402, 0xC1D5C402, 0xC1D60402,
+		0xC1D64402, 0xC1D68402, 0xC1D6C402, 0xC1D70402, 0xC1D74402, 0xC1D78402, 0xC1D7C402, 0xC1D80402,
+		0xC1D84402, 0x00000000, 0x00000000, 0xC1D88402, 0xC1D8C402, 0xC1D90402, 0xC1D94402, 0xC1D98402,
+		0xC1D9C402, 0xC1DA0402, 0xC1DA4402, 0xC1DA8402, 0xC1DAC402, 0xC1DB0402, 0xC1DB4402, 0xC1DB8402,
+		0xC1DBC402, 0xC1DC0402, 0xC1DC4402, 0xC1DC8402, 0xC1DCC402, 0xC1DD0402, 0xC1DD4402, 0xC1DD8402,
+		0xC1DDC402, 0xC1DE0402, 0xC1DE4402, 0xC1DE8402, 0xC1DEC402, 0xC1DF0402, 0xC1DF4402, 0xC1DF8402,
+		0xC1DFC402, 0xC1E00402, 0xC1E04402, 0xC1E08402, 0xC1E0C402, 0xC1E10402, 0xC1E14402, 0xC1E18402,
+		0xC1E1C402, 0xC1E20402, 0xC1E24402, 0xC1E28402, 0xC1E2C402, 0xC1E30402, 0xC1E34402, 0xC1E38402,
+		0xC1E3C402, 0xC1E40402, 0xC1E44402, 0xC1E48402, 0xC1E4C402, 0xC1E50402, 0xC1E54402, 0xC1E58402,
+		0xC1E5C402, 0xC1E60402, 0xC1E64402, 0xC1E68402, 0xC1E6C402, 0xC1E70402, 0xC1E74402, 0xC1E78402,
+		0xC1E7C402, 0xC1E80402, 0xC1E84402, 0xC1E88402, 0xC1E8C402, 0xC1E90402, 0xC1E94402, 0xC1E98402,
+		0xC1E9C402, 0xC1EA0402, 0xC1EA4402, 0xC1EA8402, 0xC1EAC402, 0xC1EB0402, 0xC1EB4402, 0xC1EB8402,
+		0xC1EBC402, 0xC1EC0402, 0xC1EC4402, 0xC1EC8402, 0xC1ECC402, 0xC1ED0402, 0xC1ED4402, 0xC1ED8402,
+		0xC1EDC402, 0xC1EE0402, 0xC1EE4402, 0xC1EE8402, 0xC1EEC402, 0xC1EF0402, 0xC1EF4402, 0xC1EF8402,
+		0xC1EFC402, 0xC1F00402, 0xC1F04402, 0xC1F08402, 0xC1F0C402, 0xC1F10402, 0xC1F14402, 0xC1F18402,
+		0xC1F1C402, 0xC1F20402, 0xC1F24402, 0xC1F28402, 0xC1F2C402, 0xC1F30402, 0xC1F34402, 0xC1F38402,
+		0xC1F3C402, 0xC1F40402, 0xC1F44402, 0xC1F48402, 0xC1F4C402, 0xC1F50402, 0xC1F54402, 0xC1F58402,
+		0xC1F5C402, 0xC1F60402, 0xC1F64402, 0xC1F68402, 0xC1F6C402, 0xC1F70402, 0xC1F74402, 0xC1F78402,
+		0xC1F7C402, 0xC1F80402, 0xC1F84402, 0xC1F88402, 0xC1F8C402, 0xC1F90402, 0xC1F94402, 0xC1F98402,
+		0xC1F9C402, 0xC1FA0402, 0xC1FA4402, 0xC1FA8402, 0xC1FAC402, 0xC1FB0402, 0xC1FB4402, 0xC1FB8402,
+		0xC1FBC402, 0xC1FC0402, 0xC1FC4402, 0xC1FC8402, 0xC1FCC402, 0xC1FD0402, 0xC1FD4402, 0xC1FD8402,
+		0xC1FDC402, 0xC1FE0402, 0xC1FE4402, 0xC1FE8402, 0xC1FEC402, 0xC1FF0402, 0xC1FF4402, 0xC1FF8402,
+		0xC1FFC402, 0xC2000402, 0xC2004402, 0xC2008402, 0xC200C402, 0xC2010402, 0xC2014402, 0xC2018402,
+		0xC201C402, 0xC2020402, 0xC2024402, 0xC2028402, 0xC202C402, 0xC2030402, 0xC2034402, 0xC2038402,
+		0xC203C402, 0xC2040402, 0xC2044402, 0xC2048402, 0xC204C402, 0xC2050402, 0xC2054402, 0xC2058402,
+		0xC205C402, 0xC2060402, 0xC2064402, 0xC2068402, 0xC206C402, 0xC2070402, 0xC2074402, 0xC2078402,
+		0xC207C402, 0xC2080402, 0xC2084402, 0xC2088402, 0xC208C402, 0xC2090402, 0xC2094402, 0xC2098402,
+		0xC209C402, 0xC20A0402, 0xC20A4402, 0xC20A8402, 0xC20AC402, 0xC20B0402, 0xC20B4402, 0xC20B8402,
+		0xC20BC402, 0xC20C0402, 0xC20C4402, 0xC20C8402, 0xC20CC402, 0xC20D0402, 0xC20D4402, 0xC20D8402,
+		0xC20DC402, 0xC20E0402, 0xC20E4402, 0xC20E8402, 0xC20EC402, 0xC20F0402, 0xC20F4402, 0xC20F8402,
+		0xC20FC402, 0xC2100402, 0xC2104402, 0xC2108402, 0xC210C402, 0xC2110402, 0xC2114402, 0xC2118402,
+		0xC211C402, 0xC2120402, 0xC2124402, 0xC2128402, 0xC212C402, 0xC2130402, 0xC2134402, 0xC2138402,
+		0xC213C402, 0xC2140402, 0xC2144402, 0xC2148402, 0xC214C402, 0xC2150402, 0xC2154402, 0xC2158402,
+		0xC215C402, 0xC2160402, 0xC2164402, 0xC2168402, 0xC216C402, 0xC2170402, 0xC2174402, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xC2178402, 0xC217C402, 0xC2180402, 0xC2184402, 0xC2188402, 0xC218C402, 0xC2190402, 0xC2194402,
+		0xC2198402, 0xC219C402, 0xC21A0402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x87E64406, 0x87E68406, 0x87E6C406, 0x87E70406, 0x87E74406, 0x87E78406, 0x87E7C406, 0x87E80406,
+		0x87E84406, 0x00049E02, 0x00027802, 0x000104C2, 0x0002BD82, 0x0003BCC2, 0x00039302, 0x00039A02,
+		0x00026102, 0x0000F742, 0x00028E02, 0x00038EC2, 0x00018483, 0x00005043, 0x0001A683, 0x00032AC3,
+		0x00013D43, 0x00045883, 0x0002D003, 0x0000BEC3, 0x000267C3, 0x00041884, 0x0003EA04, 0x0003E044,
+		0x00000784, 0x000177C4, 0x00049784, 0x00038004, 0x0000D484, 0x00020644, 0x0000CA44, 0x00040304,
+		0x00012F82, 0x0002CEC2, 0x00045B82, 0x0001AE42, 0x0004AF82, 0x00031942, 0x00033C02, 0x00033402,
+		0x00046582, 0x0002FB43, 0x00007403, 0x00018BC3, 0x0003A043, 0x00026B83, 0x0003AC03, 0x000115C3,
+		0x0003DEC3, 0x00023B43, 0x000017C3, 0x00035EC3, 0x00005F03, 0x00015D43, 0x000136C3, 0x00013C83,
+		0x000289C3, 0x0003AAC3, 0x00025483, 0x00010843, 0x00031803, 0x00044683, 0x0002FC83, 0x0001BF43,
+		0x000356C3, 0x00008943, 0x0001CD03, 0x0003E8C3, 0x00023403, 0x0000D603, 0x0000B483, 0x0000BA83,
+		0x00013E03, 0x00004503, 0x00036903, 0x0004B5C3, 0x00020303, 0x0000DE03, 0x87E8840C, 0x87EF040C,
+		0x87F5840C, 0x87FAC40C, 0x8801C40C, 0x8810840C, 0x8814440C, 0x881D440C, 0x8824040C, 0x882AC40C,
+		0x8831040C, 0x8835840C, 0x8842440C, 0x8846040C, 0x884F040C, 0x885AC40C, 0x8860040C, 0x8864C40C,
+		0x8874840C, 0x887DC40C, 0x8885C40C, 0x8891C40C, 0x8896440C, 0x8899040C, 0x889C040C, 0x88A1840C,
+		0x87E88406, 0x87EF0406, 0x87F58406, 0x87FAC406, 0x8801C406, 0x88108406, 0x88144406, 0x881D4406,
+		0x88240406, 0x882AC406, 0x88310406, 0x88358406, 0x88424406, 0x88460406, 0x884F0406, 0x885AC406,
+		0x88600406, 0x8864C406, 0x88748406, 0x887DC406, 0x8885C406, 0x8891C406, 0x88964406, 0x88990406,
+		0x889C0406, 0x88A18406, 0x87E60406, 0x00016742, 0x00046882, 0x000362C2, 0x000385C2, 0x00037E42,
+		0x00002F02, 0x00014EC2, 0x0004B0C2, 0x00036182, 0x0000BDC2, 0x87E64406, 0x87E68406, 0x87E6C406,
+		0x87E70406, 0x87E74406, 0x87E78406, 0x87E7C406, 0x87E80406, 0x87E84406, 0x00030C42, 0x87E60406,
+		0xC21A4402, 0xC21A8402, 0xC21AC402, 0xC21B0402, 0xC21B4402, 0xC21B8402, 0xC21BC402, 0xC21C0402,
+		0xC21C4402, 0xC21C8402, 0xC21CC402, 0xC21D0402, 0xC21D4402, 0xC21D8402, 0xC21DC402, 0xC21E0402,
+		0xC21E4402, 0xC21E8402, 0xC21EC402, 0xC21F0402, 0xC21F4402, 0xC21F8402, 0xC21FC402, 0xC2200402,
+		0xC2204402, 0xC2208402, 0xC220C402, 0xC2210402, 0xC2214402, 0xC2218402, 0xC221C402, 0xC2220402,
+		0xC2224402, 0xC2228402, 0xC222C402, 0xC2230402, 0xC2234402, 0xC2238402, 0xC223C402, 0xC2240402,
+		0xC2244402, 0xC2248402, 0xC224C402, 0xC2250402, 0xC2254402, 0xC2258402, 0xC225C402, 0xC2260402,
+		0xC2264402, 0xC2268402, 0xC226C402, 0xC2270402, 0xC2274402, 0xC2278402, 0xC227C402, 0xC2280402,
+		0xC2284402, 0xC2288402, 0xC228C402, 0xC2290402, 0xC2294402, 0xC2298402, 0xC229C402, 0xC22A0402,
+		0xC22A4402, 0xC22A8402, 0xC22AC402, 0xC22B0402, 0xC22B4402, 0xC22B8402, 0xC22BC402, 0xC22C0402,
+		0xC22C4402, 0xC22C8402, 0xC22CC402, 0xC22D0402, 0xC22D4402, 0xC22D8402, 0xC22DC402, 0xC22E0402,
+		0xC22E4402, 0xC22E8402, 0xC22EC402, 0xC22F0402, 0xC22F4402, 0xC22F8402, 0xC22FC402, 0xC2300402,
+		0xC2304402, 0xC2308402, 0xC230C402, 0xC2310402, 0xC2314402, 0xC2318402, 0xC231C402, 0xC2320402,
+		0xC2324402, 0xC2328402, 0xC232C402, 0xC2330402, 0xC2334402, 0xC2338402, 0xC233C402, 0xC2340402,
+		0xC2344402, 0xC2348402, 0xC234C402, 0xC2350402, 0xC2354402, 0xC2358402, 0xC235C402, 0xC2360402,
+		0xC2364402, 0xC2368402, 0xC236C402, 0xC2370402, 0xC2374402, 0xC2378402, 0xC237C402, 0xC2380402,
+		0xC2384402, 0xC2388402, 0xC238C402, 0xC2390402, 0xC2394402, 0xC2398402, 0xC239C402, 0xC23A0402,
+		0xC23A4402, 0xC23A8402, 0xC23AC402, 0xC23B0402, 0xC23B4402, 0xC23B8402, 0xC23BC402, 0xC23C0402,
+		0xC23C4402, 0xC23C8402, 0xC23CC402, 0xC23D0402, 0xC23D4402, 0xC23D8402, 0xC23DC402, 0xC23E0402,
+		0xC23E4402, 0xC23E8402, 0xC23EC402, 0xC23F0402, 0xC23F4402, 0xC23F8402, 0xC23FC402, 0xC2400402,
+		0xC2404402, 0xC2408402, 0xC240C402, 0xC2410402, 0xC2414402, 0xC2418402, 0xC241C402, 0xC2420402,
+		0xC2424402, 0xC2428402, 0xC242C402, 0xC2430402, 0xC2434402, 0xC2438402, 0xC243C402, 0xC2440402,
+		0xC2444402, 0xC2448402, 0xC244C402, 0xC2450402, 0xC2454402, 0xC2458402, 0xC245C402, 0xC2460402,
+		0xC2464402, 0xC2468402, 0xC246C402, 0xC2470402, 0xC2474402, 0xC2478402, 0xC247C402, 0xC2480402,
+		0xC2484402, 0xC2488402, 0xC248C402, 0xC2490402, 0xC2494402, 0xC2498402, 0xC249C402, 0xC24A0402,
+		0xC24A4402, 0xC24A8402, 0xC24AC402, 0xC24B0402, 0xC24B4402, 0xC24B8402, 0xC24BC402, 0xC24C0402,
+		0xC24C4402, 0xC24C8402, 0xC24CC402, 0xC24D0402, 0xC24D4402, 0xC24D8402, 0xC24DC402, 0xC24E0402,
+		0xC24E4402, 0xC24E8402, 0xC24EC402, 0xC24F0402, 0xC24F4402, 0xC24F8402, 0xC24FC402, 0xC2500402,
+		0xC2504402, 0xC2508402, 0xC250C402, 0xC2510402, 0xC2514402, 0xC2518402, 0xC251C402, 0xC2520402,
+		0xC2524402, 0xC2528402, 0xC252C402, 0xC2530402, 0xC2534402, 0xC2538402, 0xC253C402, 0xC2540402,
+		0xC2544402, 0xC2548402, 0xC254C402, 0xC2550402, 0xC2554402, 0xC2558402, 0xC255C402, 0xC2560402,
+		0xC2564402, 0xC2568402, 0xC256C402, 0xC2570402, 0xC2574402, 0xC2578402, 0xC257C402, 0xC2580402,
+		0xC2584402, 0xC2588402, 0xC258C402, 0xC2590402, 0xC2594402, 0xC2598402, 0xC259C402, 0xC25A0402,
+		0xC28CC402, 0xC28D0402, 0xC28D4402, 0xC28D8402, 0xC28DC402, 0xC28E0402, 0xC28E4402, 0xC28E8402,
+		0xC28EC402, 0xC28F0402, 0xC28F4402, 0xC28F8402, 0xC28FC402, 0xC2900402, 0xC2904402, 0xC2908402,
+		0xC290C402, 0xC2910402, 0xC2914402, 0xC2918402, 0xC291C402, 0xC2920402, 0xC2924402, 0xC2928402,
+		0xC292C402, 0xC2930402, 0xC2934402, 0xC2938402, 0xC293C402, 0xC2940402, 0xC2944402, 0xC2948402,
+		0xC294C402, 0xC2950402, 0xC2954402, 0xC2958402, 0xC295C402, 0xC2960402, 0xC2964402, 0xC2968402,
+		0xC296C402, 0xC2970402, 0xC2974402, 0xC2978402, 0xC297C402, 0xC2980402, 0xC2984402, 0xC2988402,
+		0xC3FB8402, 0xC3FBC402, 0xC3FC0402, 0xC3FC4402, 0xC3FC8402, 0xC3FCC402, 0xC3FD0402, 0xC3FD4402,
+		0xC298C402, 0xC2990402, 0xC2994402, 0xC2998402, 0xC299C402, 0xC29A0402, 0xC29A4402, 0xC29A8402,
+		0xC29AC402, 0xC29B0402, 0xC29B4402, 0xC29B8402, 0xC29BC402, 0xC29C0402, 0xC29C4402, 0xC29C8402,
+		0xC29CC402, 0xC29D0402, 0xC29D4402, 0xC29D8402, 0xC29DC402, 0xC29E0402, 0xC29E4402, 0xC29E8402,
+		0xC29EC402, 0xC29F0402, 0xC29F4402, 0xC29F8402, 0xC29FC402, 0xC2A00402, 0xC2A04402, 0xC2A08402,
+		0xC2A0C402, 0xC2A10402, 0xC2A14402, 0xC2A18402, 0xC2A1C402, 0xC2A20402, 0xC2A24402, 0xC2A28402,
+		0xC2A2C402, 0xC2A30402, 0xC2A34402, 0xC2A38402, 0xC2A3C402, 0xC2A40402, 0xC2A44402, 0xC2A48402,
+		0xC2A4C402, 0xC2A50402, 0xC2A54402, 0xC2A58402, 0xC2A5C402, 0xC4904402, 0xC4908402, 0xC490C402,
+		0xC2A60402, 0xC2A64402, 0xC2A68402, 0xC2A6C402, 0xC2A70402, 0xC2A74402, 0xC2A78402, 0xC2A7C402,
+		0xC2A80402, 0xC2A84402, 0xC2A88402, 0xC2A8C402, 0xC2A90402, 0xC2A94402, 0xC2A98402, 0xC2A9C402,
+		0xC2AA0402, 0xC2AA4402, 0xC2AA8402, 0xC2AAC402, 0xC2AB0402, 0xC2AB4402, 0xC2AB8402, 0xC2ABC402,
+		0xC2AC0402, 0xC2AC4402, 0xC3FA0402, 0xC3FA4402, 0xC3FA8402, 0xC3FAC402, 0xC3FB0402, 0xC3FB4402,
+		0xC2AC8402, 0xC2ACC402, 0xC2AD0402, 0xC2AD4402, 0xC2AD8402, 0xC2ADC402, 0xC2AE0402, 0xC2AE4402,
+		0xC2AE8402, 0xC2AEC402, 0xC2AF0402, 0xC2AF4402, 0xC2AF8402, 0xC2AFC402, 0xC2B00402, 0xC2B04402,
+		0xC2B08402, 0xC2B0C402, 0xC2B10402, 0xC2B14402, 0xC2B18402, 0xC2B1C402, 0xC2B20402, 0xC2B24402,
+		0xC2B28402, 0xC2B2C402, 0xC2B30402, 0xC2B34402, 0xC2B38402, 0xC2B3C402, 0xC2B40402, 0xC2B44402,
+		0xC2B48402, 0xC2B4C402, 0xC2B50402, 0xC2B54402, 0xC2B58402, 0xC2B5C402, 0xC2B60402, 0xC2B64402,
+		0xC2B68402, 0xC2B6C402, 0xC2B70402, 0xC2B74402, 0xC2B78402, 0xC2B7C402, 0xC2B80402, 0xC2B84402,
+		0xC2B88402, 0xC2B8C402, 0xC2B90402, 0xC2B94402, 0xC2B98402, 0xC2B9C402, 0xC2BA0402, 0xC2BA4402,
+		0xC2BA8402, 0xC2BAC402, 0xC2BB0402, 0xC2BB4402, 0xC2BB8402, 0xC2BBC402, 0xC2BC0402, 0xC2BC4402,
+		0xC2BC8402, 0xC2BCC402, 0xC2BD0402, 0xC2BD4402, 0xC2BD8402, 0xC2BDC402, 0xC2BE0402, 0xC2BE4402,
+		0xC2BE8402, 0xC2BEC402, 0xC2BF0402, 0xC2BF4402, 0xC2BF8402, 0xC2BFC402, 0xC2C00402, 0xC2C04402,
+		0xC2C08402, 0xC2C0C402, 0xC2C10402, 0xC2C14402, 0xC2C18402, 0xC2C1C402, 0xC2C20402, 0xC2C24402,
+		0xC2C28402, 0xC2C2C402, 0xC2C30402, 0xC2C34402, 0xC2C38402, 0xC2C3C402, 0xC2C40402, 0xC2C44402,
+		0xC2C48402, 0xC2C4C402, 0xC2C50402, 0xC2C54402, 0xC2C58402, 0xC2C5C402, 0xC2C60402, 0xC2C64402,
+		0xC2C68402, 0xC2C6C402, 0xC2C70402, 0xC2C74402, 0xC2C78402, 0xC2C7C402, 0xC2C80402, 0xC2C84402,
+		0xC2CF0402, 0xC2CF4402, 0xC2CF8402, 0xC2CFC402, 0xC2D00402, 0xC2D04402, 0xC2D08402, 0xC2D0C402,
+		0xC2D10402, 0xC2D14402, 0xC2D18402, 0xC2D1C402, 0xC2D20402, 0xC2D24402, 0xC2D28402, 0xC2D2C402,
+		0xC2D30402, 0xC2D34402, 0xC2D38402, 0xC2D3C402, 0xC2D40402, 0xC2D44402, 0xC2D48402, 0xC2D4C402,
+		0xC2D50402, 0xC2D54402, 0xC2D58402, 0xC2D5C402, 0xC2D60402, 0xC2D64402, 0xC2D68402, 0xC2D6C402,
+		0xC2D70402, 0xC2D7C402, 0xC2D80402, 0xC2D84402, 0xC2D88402, 0xC2D8C402, 0xC2D90402, 0xC2D94402,
+		0xC2D98402, 0xC2D9C402, 0xC2DA0402, 0xC2DA4402, 0xC2DA8402, 0xC2DAC402, 0xC2DB0402, 0xC2DB4402,
+		0xC2DB8402, 0xC2DBC402, 0xC2DC0402, 0xC2DC4402, 0xC2DC8402, 0xC2DCC402, 0xC2DD0402, 0xC2DD4402,
+		0xC2DD8402, 0xC2DDC402, 0xC2DE0402, 0xC2DE4402, 0xC2DE8402, 0xC2DEC402, 0xC2DF0402, 0xC2DF4402,
+		0xC2DF8402, 0xC2DFC402, 0xC2E00402, 0xC2E04402, 0xC2E08402, 0xC2E0C402, 0xC2E10402, 0xC2E14402,
+		0xC2E18402, 0xC2E1C402, 0xC2E20402, 0xC2E24402, 0xC2E28402, 0xC2E2C402, 0xC2E30402, 0xC2E34402,
+		0xC2E38402, 0xC2E3C402, 0xC2E40402, 0xC2E44402, 0xC2E48402, 0xC2E4C402, 0xC2E50402, 0xC2E54402,
+		0xC2E58402, 0xC2E5C402, 0xC2E60402, 0xC2E64402, 0xC2E68402, 0xC2E6C402, 0xC2E70402, 0xC2E74402,
+		0xC2E78402, 0xC2E7C402, 0xC2E80402, 0xC2E84402, 0xC2E88402, 0xC2E8C402, 0xC2E90402, 0xC2E94402,
+		0xC0D78402, 0xC0D7C402, 0xC0D80402, 0xC0D84402, 0xC0D88402, 0xC0D8C402, 0xC0D90402, 0xC0D94402,
+		0xC0D98402, 0xC0D9C402, 0xC0DA0402, 0xC0DA4402, 0xC0DA8402, 0xC0DAC402, 0x87E64406, 0x87E68406,
+		0x87E6C406, 0x87E70406, 0x87E74406, 0x87E78406, 0x87E7C406, 0x87E80406, 0x87E84406, 0x0001A082,
+		0x87E64406, 0x87E68406, 0x87E6C406, 0x87E70406, 0x87E74406, 0x87E78406, 0x87E7C406, 0x87E80406,
+		0x87E84406, 0x00005342, 0x87E64406, 0x87E68406, 0x87E6C406, 0x87E70406, 0x87E74406, 0x87E78406,
+		0x87E7C406, 0x87E80406, 0x87E84406, 0x0003F902, 0xC2E98402, 0xC2E9C402, 0xC2EA0402, 0xC2EA4402,
+		0xC2EA8402, 0xC2EAC402, 0xC2EB0402, 0xC2EB4402, 0xC2EB8402, 0xC2EBC402, 0xC2EC0402, 0xC2EC4402,
+		0xC2EC8402, 0xC2ECC402, 0xC2ED0402, 0xC2ED4402, 0xC2ED8402, 0xC2EDC402, 0xC2EE0402, 0xC2EE4402,
+		0xC2EE8402, 0xC2EEC402, 0xC2EF0402, 0xC2EF4402, 0xC2EF8402, 0xC2EFC402, 0xC2F00402, 0xC2F04402,
+		0xC2F08402, 0xC2F0C402, 0xC2F10402, 0xC2F14402, 0xC2F18402, 0xC2F1C402, 0xC2F20402, 0xC2F24402,
+		0xC2F28402, 0xC2F2C402, 0xC2F30402, 0xC2F34402, 0xC2F38402, 0xC2F3C402, 0xC2F40402, 0xC2F44402,
+		0xC2F48402, 0xC2F4C402, 0xC2F50402, 0xC2F54402, 0xC2F58402, 0xC0D48402, 0xC0D4C402, 0xC2F5C402,
+		0xC2F60402, 0xC2F64402, 0xC2F68402, 0xC2F6C402, 0xC2F70402, 0xC2F74402, 0xC2F78402, 0xC2F7C402,
+		0xC2F80402, 0xC2F84402, 0xC2F88402, 0xC2F8C402, 0xC2F90402, 0xC2F94402, 0xC2F98402, 0xC2F9C402,
+		0xC2FA0402, 0xC2FA4402, 0xC2FA8402, 0xC2FAC402, 0xC2FB0402, 0xC2FB4402, 0xC2FB8402, 0xC2FBC402,
+		0xC2FC0402, 0xC2FC4402, 0xC2FC8402, 0xC2FCC402, 0xC2FD0402, 0xC2FD4402, 0xC0D50402, 0xC0D54402,
+		0xC0D58402, 0xC0D5C402, 0xC0D60402, 0xC0D64402, 0xC0D68402, 0xC0D6C402, 0xC0D70402, 0xC0D74402,
+		0xC2FD8402, 0xC2FDC402, 0xC2FE0402, 0xC2FE4402, 0xC2FE8402, 0xC2FEC402, 0xC2FF0402, 0xC2FF4402,
+		0xC2FF8402, 0xC2FFC402, 0xC3000402, 0xC3004402, 0xC3008402, 0xC300C402, 0xC3010402, 0xC3014402,
+		0xC3BA0402, 0xC3BA4402, 0xC3BA8402, 0xC3BAC402, 0xC3BB0402, 0xC3BB4402, 0xC3BB8402, 0xC3BBC402,
+		0xC3BC0402, 0xC3BC4402, 0xC3BC8402, 0xC3BCC402, 0xC3BD0402, 0xC3BD4402, 0xC3BD8402, 0xC3BDC402,
+		0xC3BE0402, 0xC3BE4402, 0xC3BE8402, 0xC3BEC402, 0xC3BF0402, 0xC3BF4402, 0xC3BF8402, 0xC3BFC402,
+		0xC3C00402, 0xC3C04402, 0xC3C08402, 0xC3C0C402, 0xC3C10402, 0xC3C14402, 0xC3C18402, 0xC3C1C402,
+		0xC3C20402, 0xC3C24402, 0xC3C28402, 0xC3C2C402, 0xC3C30402, 0xC3C34402, 0xC3C38402, 0xC3C3C402,
+		0xC3C40402, 0xC3C44402, 0xC3C48402, 0xC3C4C402, 0xC3C50402, 0xC3C54402, 0xC3C58402, 0xC3C5C402,
+		0xC3C60402, 0xC3C64402, 0xC3C68402, 0xC3C6C402, 0xC3C70402, 0xC3C74402, 0xC3C78402, 0xC3C7C402,
+		0xC3C80402, 0xC3C84402, 0xC3C88402, 0xC3C8C402, 0xC3C90402, 0xC3C94402, 0xC3C98402, 0xC3C9C402,
+		0xC3CA0402, 0xC3CA4402, 0xC3CA8402, 0xC3CAC402, 0xC3CB0402, 0xC3CB4402, 0xC3CB8402, 0xC3CBC402,
+		0xC3CC0402, 0xC3CC4402, 0xC3CC8402, 0xC3CCC402, 0xC3CD0402, 0xC3CD4402, 0xC3CD8402, 0xC3CDC402,
+		0xC3CE0402, 0xC3CE4402, 0xC3CE8402, 0xC3CEC402, 0xC3CF0402, 0xC3CF4402, 0xC3CF8402, 0xC3CFC402,
+		0xC3D00402, 0xC3D04402, 0xC3D08402, 0xC3D0C402, 0xC3D10402, 0xC3D14402, 0xC3D18402, 0xC3D1C402,
+		0xC3D20402, 0xC3D24402, 0xC3D28402, 0xC3D2C402, 0xC3D30402, 0xC3D34402, 0xC3D38402, 0xC3D3C402,
+		0xC3D40402, 0xC3D44402, 0xC3D48402, 0xC3D4C402, 0xC3D50402, 0xC3D54402, 0xC3D58402, 0xC3D5C402,
+		0xC3D60402, 0xC3D64402, 0xC3D68402, 0xC3D6C402, 0xC3D70402, 0xC3D74402, 0xC3D78402, 0xC3D7C402,
+		0xC3D80402, 0xC3D84402, 0xC3D88402, 0xC3D8C402, 0xC3D90402, 0xC3D94402, 0xC3D98402, 0xC3D9C402,
+		0xC3DA0402, 0xC3DA4402, 0xC3DA8402, 0xC3DAC402, 0xC3DB0402, 0xC3DB4402, 0xC3DB8402, 0xC3DBC402,
+		0xC3DC0402, 0xC3DC4402, 0xC3DC8402, 0xC3DCC402, 0xC3DD0402, 0xC3DD4402, 0xC3DD8402, 0xC3DDC402,
+		0xC3DE0402, 0xC3DE4402, 0xC3DE8402, 0xC3DEC402, 0xC3DF0402, 0xC3DF4402, 0xC3DF8402, 0xC3DFC402,
+		0xC3E00402, 0xC3E04402, 0xC3E08402, 0xC3E0C402, 0xC3E10402, 0xC3E14402, 0xC3E18402, 0xC3E1C402,
+		0xC3E20402, 0xC3E24402, 0xC3E28402, 0xC3E2C402, 0xC3E30402, 0xC3E34402, 0xC3E38402, 0xC3E3C402,
+		0xC3E40402, 0xC3E44402, 0xC3E48402, 0xC3E4C402, 0xC3E50402, 0xC3E54402, 0xC3E58402, 0xC3E5C402,
+		0xC3E60402, 0xC3E64402, 0xC3E68402, 0xC3E6C402, 0xC3E70402, 0xC3E74402, 0xC3E78402, 0xC3E7C402,
+		0xC3E80402, 0xC3E84402, 0xC3E88402, 0xC3E8C402, 0xC3E90402, 0xC3E94402, 0xC3E98402, 0xC3E9C402,
+		0xC3EA0402, 0xC3EA4402, 0xC3EA8402, 0xC3EAC402, 0xC3EB0402, 0xC3EB4402, 0xC3EB8402, 0xC3EBC402,
+		0xC3EC0402, 0xC3EC4402, 0xC3EC8402, 0xC3ECC402, 0xC3ED0402, 0xC3ED4402, 0xC3ED8402, 0xC3EDC402,
+		0xC3EE0402, 0xC3EE4402, 0xC3EE8402, 0xC3EEC402, 0xC3EF0402, 0xC3EF4402, 0xC3EF8402, 0xC3EFC402,
+		0xC3F00402, 0xC3F04402, 0xC3F08402, 0xC3F0C402, 0xC3F10402, 0xC3F14402, 0xC3F18402, 0xC3F1C402,
+		0xC3F20402, 0xC3F24402, 0xC3F28402, 0xC3F2C402, 0xC3F30402, 0xC3F34402, 0xC3F38402, 0xC3F3C402,
+		0xC3F40402, 0xC3F44402, 0xC3F48402, 0xC3F4C402, 0xC3F50402, 0xC3F54402, 0xC3F58402, 0xC3F5C402,
+		0xC3F60402, 0xC3F64402, 0xC3F68402, 0xC3F6C402, 0xC3F70402, 0xC3F74402, 0xC3F78402, 0xC3F7C402,
+		0xC3F80402, 0xC3F84402, 0xC3F88402, 0xC3F8C402, 0xC3F90402, 0xC3F94402, 0xC3F98402, 0xC3F9C402,
+		0xC3018402, 0xC301C402, 0xC3020402, 0xC3024402, 0xC3028402, 0xC302C402, 0xC3030402, 0xC3034402,
+		0xC3038402, 0xC303C402, 0xC3040402, 0xC3044402, 0xC3048402, 0xC304C402, 0xC3050402, 0xC3054402,
+		0xC3058402, 0xC305C402, 0xC3060402, 0xC3064402, 0xC3068402, 0xC306C402, 0xC3070402, 0xC3074402,
+		0xC3078402, 0xC307C402, 0xC3080402, 0xC3084402, 0xC3088402, 0xC308C402, 0xC3090402, 0xC3094402,
+		0xC3098402, 0xC309C402, 0xC30A0402, 0xC30A4402, 0xC30A8402, 0xC30AC402, 0xC30B0402, 0xC30B4402,
+		0xC30B8402, 0xC30BC402, 0xC30C0402, 0xC30C4402, 0xC30C8402, 0xC30CC402, 0xC30D0402, 0xC30D4402,
+		0xC30D8402, 0xC30DC402, 0xC30E0402, 0xC30E4402, 0xC30E8402, 0xC30EC402, 0xC30F0402, 0xC30F4402,
+		0xC30F8402, 0xC30FC402, 0xC3100402, 0xC3104402, 0xC3108402, 0xC310C402, 0xC3110402, 0xC3114402,
+		0xC3118402, 0xC311C402, 0xC3120402, 0xC3124402, 0xC3128402, 0xC312C402, 0xC3130402, 0xC3134402,
+		0xC3138402, 0xC313C402, 0xC3140402, 0xC3144402, 0xC3148402, 0xC314C402, 0xC3150402, 0xC3154402,
+		0xC3158402, 0xC315C402, 0xC3160402, 0xC3164402, 0xC3168402, 0xC316C402, 0xC3170402, 0xC3174402,
+		0xC3178402, 0xC317C402, 0xC3180402, 0xC3184402, 0xC3188402, 0xC318C402, 0xC3190402, 0xC3194402,
+		0xC3198402, 0xC319C402, 0xC31A0402, 0xC31A4402, 0xC31A8402, 0xC31AC402, 0xC31B0402, 0xC31B4402,
+		0xC31B8402, 0xC31BC402, 0xC31C0402, 0xC31C4402, 0xC31C8402, 0xC31CC402, 0xC31D0402, 0xC31D4402,
+		0xC31D8402, 0xC31DC402, 0xC31E0402, 0xC31E4402, 0xC31E8402, 0xC31EC402, 0xC31F0402, 0xC31F4402,
+		0xC31F8402, 0xC31FC402, 0xC3200402, 0xC3204402, 0xC3208402, 0xC320C402, 0xC3210402, 0xC3214402,
+		0xC3218402, 0xC321C402, 0xC3220402, 0xC0CF0402, 0xC0CF4402, 0xC0CF8402, 0xC0CFC402, 0xC0D00402,
+		0xC0D04402, 0xC0D08402, 0xC0D0C402, 0xC0D10402, 0xC0D14402, 0xC0D18402, 0xC0D1C402, 0xC0D20402,
+		0xC0D24402, 0xC0D28402, 0xC0D2C402, 0xC0D30402, 0xC0D34402, 0xC0D38402, 0xC0D3C402, 0xC0D40402,
+		0xC0D44402, 0xC3224402, 0xC3228402, 0xC322C402, 0xC3230402, 0xC3234402, 0xC3238402, 0xC323C402,
+		0xC3240402, 0xC3244402, 0xC3248402, 0xC324C402, 0xC3250402, 0xC3254402, 0xC3258402, 0xC325C402,
+		0xC3260402, 0xC3264402, 0xC3268402, 0xC326C402, 0xC3270402, 0xC3274402, 0xC3278402, 0xC327C402,
+		0xC3280402, 0xC3284402, 0xC3288402, 0xC328C402, 0xC3290402, 0xC3294402, 0xC3298402, 0xC329C402,
+		0xC32A0402, 0xC32A4402, 0xC32A8402, 0xC32AC402, 0xC32B0402, 0xC32B4402, 0xC32B8402, 0xC32BC402,
+		0xC32C0402, 0xC32C4402, 0xC32C8402, 0xC32CC402, 0xC32D0402, 0xC32D4402, 0xC32D8402, 0xC32DC402,
+		0xC32E0402, 0xC32E4402, 0xC32E8402, 0xC32EC402, 0xC32F0402, 0xC32F4402, 0xC32F8402, 0xC32FC402,
+		0xC3300402, 0xC3304402, 0xC3308402, 0xC330C402, 0xC3310402, 0xC3314402, 0xC3318402, 0xC331C402,
+		0xC0E58402, 0xC0E5C402, 0xC0E60402, 0xC0E64402, 0xC3320402, 0xC3324402, 0xC3328402, 0xC332C402,
+		0xC3330402, 0xC3334402, 0xC3338402, 0xC333C402, 0xC3340402, 0xC3344402, 0xC3348402, 0xC334C402,
+		0xC3350402, 0xC3354402, 0xC3358402, 0xC335C402, 0xC3360402, 0xC3364402, 0xC3368402, 0xC336C402,
+		0xC3370402, 0xC3374402, 0xC3378402, 0xC337C402, 0xC3380402, 0xC3384402, 0xC3388402, 0xC338C402,
+		0xC3390402, 0xC3394402, 0xC3398402, 0xC339C402, 0xC0CE8402, 0xC0CEC402, 0xC33A0402, 0xC33A4402,
+		0xC33A8402, 0xC33AC402, 0xC33B0402, 0xC33B4402, 0xC33B8402, 0xC33BC402, 0xC33C0402, 0xC33C4402,
+		0xC33C8402, 0xC33CC402, 0xC33D0402, 0xC33D4402, 0x000412C4, 0xC33D8402, 0xC33DC402, 0xC33E0402,
+		0xC33E4402, 0xC33E8402, 0xC33EC402, 0xC33F0402, 0xC33F4402, 0xC33F8402, 0xC33FC402, 0xC3400402,
+		0xC3404402, 0xC3408402, 0xC340C402, 0xC3410402, 0xC3414402, 0xC3418402, 0xC341C402, 0xC3420402,
+		0xC3424402, 0xC3428402, 0xC342C402, 0xC3430402, 0xC3434402, 0xC3438402, 0xC343C402, 0xC3440402,
+		0xC3444402, 0xC3448402, 0xC344C402, 0xC3450402, 0xC3454402, 0xC3458402, 0xC345C402, 0xC3460402,
+		0xC3464402, 0xC3468402, 0xC346C402, 0xC3470402, 0xC3474402, 0xC3478402, 0xC347C402, 0xC3480402,
+		0xC3484402, 0xC3488402, 0xC348C402, 0xC3490402, 0xC3494402, 0xC3498402, 0xC349C402, 0xC34A0402,
+		0xC34A4402, 0xC34A8402, 0xC34AC402, 0xC34B0402, 0xC34B4402, 0xC34B8402, 0xC34BC402, 0xC34C0402,
+		0xC34C4402, 0xC34C8402, 0xC34CC402, 0xC34D0402, 0xC34D4402, 0xC34D8402, 0xC34DC402, 0xC34E0402,
+		0xC34E4402, 0xC34E8402, 0xC34EC402, 0xC34F0402, 0xC34F4402, 0xC34F8402, 0xC34FC402, 0xC3500402,
+		0xC3504402, 0xC3508402, 0xC350C402, 0xC3510402, 0xC3514402, 0xC3518402, 0xC351C402, 0xC3520402,
+		0xC3524402, 0xC3528402, 0xC352C402, 0xC3530402, 0xC3534402, 0xC3538402, 0xC353C402, 0xC3540402,
+		0xC3544402, 0xC3548402, 0xC354C402, 0xC3550402, 0xC3554402, 0xC3558402, 0xC355C402, 0xC3560402,
+		0xC3564402, 0xC3568402, 0xC356C402, 0xC3570402, 0x000366C3, 0x00049982, 0x00034283, 0xC3574402,
+		0xC3578402, 0xC357C402, 0xC3580402, 0xC3584402, 0xC3588402, 0xC358C402, 0xC3590402, 0xC3594402,
+		0xC3598402, 0xC359C402, 0xC35A0402, 0xC35A4402, 0xC35A8402, 0xC35AC402, 0xC35B0402, 0xC35B4402,
+		0xC35B8402, 0xC35BC402, 0xC35C0402, 0xC35C4402, 0xC35C8402, 0xC35CC402, 0xC35D0402, 0xC35D4402,
+		0xC35D8402, 0xC35DC402, 0xC35E0402, 0xC35E4402, 0xC35E8402, 0xC35EC402, 0xC35F0402, 0xC35F4402,
+		0xC35F8402, 0xC35FC402, 0xC3600402, 0xC3604402, 0xC3608402, 0xC360C402, 0xC3610402, 0xC3614402,
+		0xC3618402, 0xC361C402, 0xC3620402, 0xC3624402, 0xC3628402, 0xC362C402, 0xC3630402, 0xC3634402,
+		0xC3638402, 0xC363C402, 0xC3640402, 0xC3644402, 0xC3648402, 0xC364C402, 0xC3650402, 0xC3654402,
+		0xC3658402, 0xC365C402, 0xC3660402, 0xC3664402, 0xC3668402, 0xC366C402, 0xC3670402, 0xC3674402,
+		0xC3678402, 0xC367C402, 0xC3680402, 0xC3684402, 0xC3688402, 0xC368C402, 0xC3690402, 0xC3694402,
+		0xC3698402, 0xC369C402, 0xC36A0402, 0xC36A4402, 0xC36A8402, 0xC36AC402, 0xC36B0402, 0xC36B4402,
+		0xC36B8402, 0xC36BC402, 0xC36C0402, 0xC36C4402, 0xC36C8402, 0xC36CC402, 0xC36D0402, 0xC36D4402,
+		0xC36D8402, 0xC36DC402, 0xC36E0402, 0xC36E4402, 0xC36E8402, 0xC36EC402, 0xC36F0402, 0xC36F4402,
+		0xC36F8402, 0xC36FC402, 0xC3700402, 0xC3704402, 0x00000000, 0xC3708402, 0xC370C402, 0xC3710402,
+		0xC3714402, 0xC3718402, 0xC371C402, 0xC3720402, 0xC3724402, 0xC3728402, 0xC372C402, 0xC3730402,
+		0xC3734402, 0xC3738402, 0xC373C402, 0xC3740402, 0xC3744402, 0xC3748402, 0xC374C402, 0xC3750402,
+		0xC3754402, 0xC3758402, 0xC375C402, 0xC3760402, 0xC3764402, 0xC3768402, 0xC376C402, 0xC3770402,
+		0xC3774402, 0xC3778402, 0xC377C402, 0xC3780402, 0xC3784402, 0xC3788402, 0xC378C402, 0xC3790402,
+		0xC3794402, 0xC3798402, 0xC379C402, 0xC37A0402, 0xC37A4402, 0xC37A8402, 0xC37AC402, 0xC37B0402,
+		0xC37B4402, 0xC37B8402, 0xC37BC402, 0xC37C0402, 0xC37C4402, 0xC37C8402, 0xC37CC402, 0xC37D0402,
+		0xC37D4402, 0xC37D8402, 0xC37DC402, 0xC37E0402, 0xC37E4402, 0xC37E8402, 0xC37EC402, 0xC37F0402,
+		0xC37F4402, 0xC37F8402, 0xC37FC402, 0xC3800402, 0xC3804402, 0xC3808402, 0xC380C402, 0xC3810402,
+		0xC3814402, 0xC3818402, 0xC381C402, 0xC3820402, 0xC3824402, 0xC3828402, 0xC382C402, 0xC3830402,
+		0xC3834402, 0xC3838402, 0xC383C402, 0xC3840402, 0xC3844402, 0xC3848402, 0xC384C402, 0xC3850402,
+		0xC3854402, 0xC3858402, 0xC385C402, 0xC3860402, 0xC3864402, 0xC3868402, 0xC386C402, 0xC3870402,
+		0xC3874402, 0xC3878402, 0xC387C402, 0xC3880402, 0xC3884402, 0xC3888402, 0xC388C402, 0xC3890402,
+		0xC3894402, 0xC3898402, 0xC389C402, 0xC38A0402, 0xC38A4402, 0xC38A8402, 0xC38AC402, 0xC38B0402,
+		0xC38B4402, 0xC38B8402, 0xC38BC402, 0xC38C0402, 0xC38C4402, 0xC38C8402, 0xC38CC402, 0xC38D0402,
+		0xC38D4402, 0xC38D8402, 0xC38DC402, 0xC38E0402, 0xC38E4402, 0xC38E8402, 0xC38EC402, 0xC38F0402,
+		0xC38F4402, 0xC38F8402, 0xC38FC402, 0xC3900402, 0xC3904402, 0xC3908402, 0xC390C402, 0xC3910402,
+		0xC3914402, 0xC3918402, 0xC391C402, 0xC3920402, 0xC3924402, 0xC3928402, 0xC392C402, 0xC3930402,
+		0xC3934402, 0xC3938402, 0xC393C402, 0xC3940402, 0xC3944402, 0xC3948402, 0xC394C402, 0xC3950402,
+		0xC3954402, 0xC3958402, 0xC395C402, 0xC3960402, 0x00000000, 0x00000000, 0xC3964402, 0xC3968402,
+		0xC396C402, 0xC3970402, 0xC3974402, 0xC3978402, 0xC397C402, 0xC3980402, 0xC3984402, 0xC3988402,
+		0xC398C402, 0xC3990402, 0xC3994402, 0xC3998402, 0xC399C402, 0xC39A0402, 0xC39A4402, 0xC39A8402,
+		0xC39AC402, 0xC39B0402, 0xC39B4402, 0xC39B8402, 0xC39BC402, 0xC39C0402, 0xC39C4402, 0xC39C8402,
+		0xC39CC402, 0xC39D0402, 0xC39D4402, 0xC39D8402, 0xC39DC402, 0xC39E0402, 0x00000000, 0xC39E4402,
+		0xC39E8402, 0xC39EC402, 0xC39F0402, 0xC39F4402, 0xC39F8402, 0xC39FC402, 0xC3A00402, 0xC3A04402,
+		0xC3A08402, 0xC3A0C402, 0xC3A10402, 0xC3A14402, 0xC3A18402, 0xC3A1C402, 0xC3A20402, 0xC3A24402,
+		0xC3A28402, 0xC3A2C402, 0xC3A30402, 0xC3A34402, 0xC3A38402, 0xC3A3C402, 0xC3A40402, 0xC3A44402,
+		0xC3A48402, 0xC3A4C402, 0xC3A50402, 0xC3A54402, 0xC3A58402, 0xC3A5C402, 0xC3A60402, 0xC3A64402,
+		0xC3A68402, 0xC3A6C402, 0xC3A70402, 0xC3A74402, 0xC3A78402, 0xC3A7C402, 0xC3A80402, 0xC3A84402,
+		0xC3A88402, 0xC3A8C402, 0xC3A90402, 0xC3A94402, 0xC3A98402, 0xC3A9C402, 0xC3AA0402, 0xC3AA4402,
+		0xC3AA8402, 0xC3AAC402, 0xC3AB0402, 0xC3AB4402, 0xC3AB8402, 0xC3ABC402, 0xC3AC0402, 0xC3AC4402,
+		0xC3AC8402, 0xC3ACC402, 0xC3AD0402, 0xC3AD4402, 0xC3AD8402, 0xC3ADC402, 0xC3AE0402, 0xC3AE4402,
+		0xC3AE8402, 0xC3AEC402, 0xC3AF0402, 0xC3AF4402, 0xC3AF8402, 0xC3AFC402, 0xC3B00402, 0xC3B04402,
+		0xC3B08402, 0xC3B0C402, 0xC3B10402, 0xC3B14402, 0xC3B18402, 0xC3B1C402, 0xC3B20402, 0xC3B24402,
+		0xC3B28402, 0xC3B2C402, 0xC3B30402, 0xC3B34402, 0xC3B38402, 0xC3B3C402, 0xC3B40402, 0xC3B44402,
+		0xC3B48402, 0xC3B4C402, 0xC3B50402, 0xC3B54402, 0xC3B58402, 0xC3B5C402, 0xC3B60402, 0xC3B64402,
+		0xC3B68402, 0xC3B6C402, 0xC3B70402, 0xC3B74402, 0xC3B78402, 0xC3B7C402, 0xC3B80402, 0xC3B84402,
+		0x89528408, 0x8952C408, 0x89530408, 0x89534408, 0x89538408, 0x8953C408, 0x89540408, 0x89544408,
+		0x89548408, 0x8954C408, 0x89550408, 0x89554408, 0x89558408, 0x8955C408, 0x89560408, 0x89564408,
+		0x89568408, 0x8956C408, 0x89570408, 0x89574408, 0x89578408, 0x8957C408, 0x89580408, 0x89584408,
+		0x89588408, 0x8958C408, 0x89590408, 0x89594408, 0x89598408, 0x8959C408, 0x895A0408, 0x895A4408,
+		0x895A8408, 0x895AC408, 0x895B0408, 0x895B4408, 0x895B8408, 0x895BC408, 0x895C0408, 0x895C4408,
+		0x895C8408, 0x895CC408, 0x895D0408, 0x895D4408, 0x895D8408, 0x895DC408, 0x895E0408, 0x00000000,
+		0x89528402, 0x8952C402, 0x89530402, 0x89534402, 0x89538402, 0x8953C402, 0x89540402, 0x89544402,
+		0x89548402, 0x8954C402, 0x89550402, 0x89554402, 0x89558402, 0x8955C402, 0x89560402, 0x89564402,
+		0x89568402, 0x8956C402, 0x89570402, 0x89574402, 0x89578402, 0x8957C402, 0x89580402, 0x89584402,
+		0x89588402, 0x8958C402, 0x89590402, 0x89594402, 0x89598402, 0x8959C402, 0x895A0402, 0x895A4402,
+		0x895A8402, 0x895AC402, 0x895B0402, 0x895B4402, 0x895B8402, 0x895BC402, 0x895C0402, 0x895C4402,
+		0x895C8402, 0x895CC402, 0x895D0402, 0x895D4402, 0x895D8402, 0x895DC402, 0x895E0402, 0x00000000,
+		0x88394408, 0x88394402, 0x88398408, 0x885C0408, 0x886DC408, 0x87E9C402, 0x88800402, 0x88218408,
+		0x88218402, 0x88338408, 0x88338402, 0x88A84408, 0x88A84402, 0x87EC4408, 0x88440408, 0x87EB4408,
+		0x87EDC408, 0x88948402, 0x8897C408, 0x8897C402, 0x8894C402, 0x8821C408, 0x8821C402, 0x885FC402,
+		0x88050402, 0x886C8402, 0x8856C402, 0x88064402, 0x882AC415, 0x8891C41D, 0x88778408, 0x88A74408,
+		0x88D2C408, 0x88D2C402, 0x88D30408, 0x88D30402, 0x88D34408, 0x88D34402, 0x88D38408, 0x88D38402,
+		0x88D3C408, 0x88D3C402, 0x88D44408, 0x88D44402, 0x88D48408, 0x88D48402, 0x88D4C408, 0x88D4C402,
+		0x88D50408, 0x88D50402, 0x88D54408, 0x88D54402, 0x88D58408, 0x88D58402, 0x88D60408, 0x88D60402,
+		0x88D64408, 0x88D64402, 0x88D68408, 0x88D68402, 0x88D74408, 0x88D74402, 0x88D78408, 0x88D78402,
+		0x88D7C408, 0x88D7C402, 0x88D80408, 0x88D80402, 0x88D84408, 0x88D84402, 0x88D88408, 0x88D88402,
+		0x88D8C408, 0x88D8C402, 0x88D90408, 0x88D90402, 0x88D94408, 0x88D94402, 0x88D98408, 0x88D98402,
+		0x88D9C408, 0x88D9C402, 0x88E08408, 0x88E08402, 0x88E0C408, 0x88E0C402, 0x88D40408, 0x88D40402,
+		0x88D5C408, 0x88D5C402, 0x88D6C408, 0x88D6C402, 0x88D70408, 0x88D70402, 0x88DA0408, 0x88DA0402,
+		0x88DA4408, 0x88DA4402, 0x88DB0408, 0x88DB0402, 0x88DB4408, 0x88DB4402, 0x88DB8408, 0x88DB8402,
+		0x88DC8408, 0x88DC8402, 0x88DD0408, 0x88DD0402, 0x88DD4408, 0x88DD4402, 0x88DD8408, 0x88DD8402,
+		0x88DDC408, 0x88DDC402, 0x88DE0408, 0x88DE0402, 0x88DE4408, 0x88DE4402, 0x88DF0408, 0x88DF0402,
+		0x88DF8408, 0x88DF8402, 0x88DFC408, 0x88DFC402, 0x88E00408, 0x88E00402, 0x88E10408, 0x88E10402,
+		0x88E14408, 0x88E14402, 0x88E18408, 0x88E18402, 0x00022943, 0xC3B88402, 0xC3B8C402, 0xC3B90402,
+		0xC3B94402, 0xC3B98402, 0xC3B9C402, 0x88DAC408, 0x88DAC402, 0x88DEC408, 0x88DEC402, 0x80000662,
+		0x80000462, 0x80000442, 0x88DC4408, 0x88DC4402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0xC0A20402, 0xC09D4402, 0xC09D8402, 0xC0C1C402, 0xC76DC402, 0xC0A24402, 0xC0C20402,
+		0x89680402, 0x89688402, 0x89690402, 0x89698402, 0x896A0402, 0x896A8402, 0x896B0402, 0x896C0402,
+		0x896C8402, 0x896D0402, 0x896D8402, 0x896E0402, 0x896E8402, 0x896F8402, 0x89700402, 0x89708402,
+		0x89710402, 0x89718402, 0x89720402, 0x89730402, 0x89738402, 0x89740402, 0x89748402, 0x89750402,
+		0x89758402, 0x89760402, 0x89768402, 0x89770402, 0x89778402, 0x89780402, 0x89788402, 0x89798402,
+		0x897A0402, 0x896B8402, 0x896F0402, 0x89728402, 0x89790402, 0x897A8402, 0x00000000, 0x897B4402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x897C8402, 0x00000000, 0x00000000,
+		0x89F64402, 0x89F68402, 0x89F6C402, 0x89F70402, 0x89F74402, 0x89F78402, 0x89F7C402, 0x89F80402,
+		0x89F84402, 0x89F88402, 0x89F8C402, 0x89F90402, 0x89F98402, 0x89F9C402, 0x89FA0402, 0x89FA4402,
+		0x89FA8402, 0x89FAC402, 0x89FB0402, 0x89FB4402, 0x89FB8402, 0x89FBC402, 0x89FC0402, 0x89FC4402,
+		0x89FC8402, 0x89FCC402, 0x89FD0402, 0x89FD4402, 0x89FD8402, 0x89FDC402, 0x89FE0402, 0x89FE4402,
+		0x89FE8402, 0x89FEC402, 0x89FF0402, 0x89FF4402, 0x89FFC402, 0x8A000402, 0x8A004402, 0x8A008402,
+		0x8A00C402, 0x8A010402, 0x8A014402, 0x8A018402, 0x8A01C402, 0x8A020402, 0x8A024402, 0x8A028402,
+		0x8A02C402, 0x8A030402, 0x8A034402, 0x8A038402, 0x8A03C402, 0x8A040402, 0x89F94402, 0x89FF8402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8A044402,
+		0xC114C402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80000000,
+		0x8A088402, 0x8A0DC402, 0x8A120402, 0x8A144402, 0x8A180402, 0x8A218402, 0x8A25C402, 0x8A280402,
+		0x8A2D8402, 0x8A2FC402, 0x8A320402, 0x8A3E4402, 0x8A460402, 0x8A49C402, 0x8A4C0402, 0x8A548402,
+		0x8A56C402, 0x8A5AC402, 0x8A66C402, 0x8A518402, 0x8A51C402, 0x8A520402, 0x8A524402, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8A67C402, 0x8A680402, 0x8A684402, 0x8A688402, 0x8A68C402, 0x8A690402, 0x8A694402, 0x00000000,
+		0x8A698402, 0x8A69C402, 0x8A6A0402, 0x8A6A4402, 0x8A6A8402, 0x8A6AC402, 0x8A6B0402, 0x00000000,
+		0x8A6B4402, 0x8A6B8402, 0x8A6BC402, 0x8A6C0402, 0x8A6C4402, 0x8A6C8402, 0x8A6CC402, 0x00000000,
+		0x8A6D0402, 0x8A6D4402, 0x8A6D8402, 0x8A6DC402, 0x8A6E0402, 0x8A6E4402, 0x8A6E8402, 0x00000000,
+		0x8A6EC402, 0x8A6F0402, 0x8A6F4402, 0x8A6F8402, 0x8A6FC402, 0x8A700402, 0x8A704402, 0x00000000,
+		0x8A708402, 0x8A70C402, 0x8A710402, 0x8A714402, 0x8A718402, 0x8A71C402, 0x8A720402, 0x00000000,
+		0x8A724402, 0x8A728402, 0x8A72C402, 0x8A730402, 0x8A734402, 0x8A738402, 0x8A73C402, 0x00000000,
+		0x8A740402, 0x8A744402, 0x8A748402, 0x8A74C402, 0x8A750402, 0x8A754402, 0x8A758402, 0x00000000,
+		0x88E4C404, 0x88E5C404, 0x88E6C404, 0x88EBC404, 0x88F1C404, 0x88F44404, 0x88FEC404, 0x89054404,
+		0x890A0404, 0x890C4404, 0x89130404, 0x89150404, 0x89184404, 0x891A8404, 0x891CC404, 0x8925C404,
+		0x892F8404, 0x89324404, 0x893A0404, 0x893B4404, 0x894E0404, 0x000273C2, 0x88E1C404, 0x88EFC404,
+		0x88FE8404, 0x89238404, 0x89414404, 0x89438404, 0x8944C404, 0x89474404, 0x89488404, 0x894B0404,
+		0xC0F2C402, 0xC0F30402, 0xC0DB0402, 0xC0DB4402, 0xC0DB8402, 0xC0DBC402, 0xC0F34402, 0xC0F38402,
+		0xC0F3C402, 0xC0DC0402, 0xC0DC4402, 0xC0F40402, 0xC0DC8402, 0xC0DCC402, 0xC0F44402, 0xC0F48402,
+		0xC0F4C402, 0xC0F50402, 0xC0F54402, 0xC0F58402, 0xC0F5C402, 0xC0F60402, 0xC0F64402, 0xC0870402,
+		0xC09F4402, 0xC0C24402, 0xC0F68402, 0xC0F6C402, 0xC0DD0402, 0xC0DD4402, 0xC0F70402, 0xC0F74402,
+		0xC0DD8402, 0xC0DDC402, 0xC0DE0402, 0xC0DE4402, 0xC0DE8402, 0xC0DEC402, 0xC0DF0402, 0xC0DF4402,
+		0xC0DF8402, 0xC0DFC402, 0xC0C08402, 0xC0C0C402, 0xC0C10402, 0xC0C14402, 0xC09BC402, 0x893C8402,
+		0xC0A28402, 0xC0A50402, 0xC0894402, 0xC0A54402, 0xC0890402, 0xC08F4402, 0xC0ED4402, 0xC0ED8402,
+		0xC0EDC402, 0xC0E6C402, 0xC0860402, 0xC0864402, 0xC0A2C402, 0xC0C18402, 0xC0E54402, 0xC0E7C402,
+		0xC0874402, 0xC0898402, 0xC0C88402, 0xC086C402, 0xC0F78402, 0xC0F7C402, 0xC0F80402, 0xC0F84402,
+		0xC0F88402, 0xC08FC402, 0xC0EA0402, 0xC0EE0402, 0xC089C402, 0xC0E78402, 0xC08A0402, 0xC08A4402,
+		0xC2D74402, 0xC2D78402, 0xC0EAC402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x0002CF43, 0x00041BC3, 0x0001D142, 0x0000C202, 0x000373C3, 0x00049E82, 0x00038D83, 0x00014243,
+		0x000326C3, 0x00000982, 0x00025E43, 0x0003D6C3, 0x0001F743, 0x0000EDC3, 0x00011C83, 0x00010E02,
+		0x00023DC2, 0x0000FE03, 0x00029A82, 0x0003B502, 0x00019C02, 0x00006F03, 0x00017EC2, 0x00032EC3,
+		0x00014DC2, 0x00046782, 0x00000000, 0x00009D02, 0x00027F43, 0x00042343, 0x0003FBC3, 0x00040A42,
+		0x00008A02, 0x00017F42, 0x00045242, 0x000307C2, 0x0000EF82, 0x00022043, 0x0000FC02, 0x0003BA83,
+		0x0000A4C2, 0x00028B03, 0x00048C83, 0x00014583, 0x00043843, 0x00037342, 0x00034543, 0x00034FC2,
+		0x00040942, 0x0002DF02, 0x0000A982, 0x0001EC03, 0x0004A243, 0x00036B83, 0x0004BE83, 0x00000C43,
+		0x00045802, 0x00013C02, 0x00013242, 0x0002AB03, 0x0000C383, 0x00021E83, 0x000243C2, 0x00023C03,
+		0x00001903, 0x000163C2, 0x00047B02, 0x00037702, 0x0000D182, 0x0001F802, 0x0000D9C2, 0x0003E383,
+		0x00010B82, 0x0002AF82, 0x00046BC3, 0x0001BC42, 0x0004AC02, 0x0002F7C3, 0x000319C3, 0x00032603,
+		0x0002A202, 0x00039882, 0x00023802, 0x0000F082, 0x00030842, 0x000435C3, 0x00030E42, 0x0001A983,
+		0x00034182, 0x00007302, 0x0001E002, 0x0003FC82, 0x00021F42, 0x0000C282, 0x00009C43, 0x0000AAC2,
+		0x00027CC2, 0x0003C503, 0x00022382, 0x00011683, 0x00031CC3, 0x00045702, 0x00033902, 0x00018A83,
+		0x00037B02, 0x00005FC2, 0x00020DC2, 0x00042A43, 0x00023942, 0x0000ACC3, 0x0000D302, 0x0000C583,
+		0x0002E082, 0x0003DD43, 0x0001F683, 0x0000B002, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00049602, 0x00037782, 0x00000B82, 0x00016202, 0x00040E02, 0x0002D8C2, 0x00042702, 0x0000A742,
+		0x0003CAC2, 0x0001D482, 0x00009402, 0x00033602, 0x000029C2, 0x00019002, 0x0001B002, 0x0001AAC2,
+		0x0002BE02, 0x00042E02, 0x0001E182, 0x0000D582, 0x00038102, 0x0004AF02, 0x00037902, 0x00015802,
+		0x00033582, 0x00001C82, 0x00024F42, 0x0003C9C2, 0x00020742, 0x00010742, 0x00012D42, 0x00012942,
+		0x00033682, 0x00043982, 0x0001B442, 0x000055C2, 0x00026602, 0x00039682, 0x00028082, 0x00024942,
+		0x0002BF02, 0x00012242, 0x00015242, 0x00049702, 0x00018042, 0x00003482, 0x00000E02, 0x00000302,
+		0x0000DD02, 0x0001CFC2, 0x00040F02, 0x0002B742, 0x00000D02, 0x00013B42, 0x00001602, 0x0004A1C2,
+		0x00004E82, 0x00036E02, 0x0003AE02, 0x00022C02, 0x0003F042, 0x00028842, 0x00026202, 0x00026CC2,
+		0x00037D02, 0x00047B82, 0x00016342, 0x00000FC2, 0x0002B982, 0x0003F242, 0x0002C4C2, 0x0001EFC2,
+		0x00026A02, 0x0000C8C2, 0x000193C2, 0x00043F42, 0x00013EC2, 0x00007702, 0x00005482, 0x00005E02,
+		0x0002E3C2, 0x0003E282, 0x0001F0C2, 0x0000ABC2, 0x00034A42, 0x000484C2, 0x00035382, 0x00015C42,
+		0x0002FAC2, 0x00002C82, 0x00022782, 0x0003A342, 0x0001D042, 0x000114C2, 0x0000EB42, 0x0000F8C2,
+		0x0001AD82, 0x00006842, 0x00033E02, 0x000442C2, 0x000226C2, 0x000103C2, 0x00021E02, 0x0002A742,
+		0x0001E902, 0x0003D642, 0x00034942, 0x00000902, 0x00030DC2, 0x0004BF82, 0x00049A02, 0x00048E42,
+		0x00015F42, 0x00001502, 0x00037F82, 0x00049882, 0x0001E102, 0x0000BE42, 0x0001C742, 0x0002E202,
+		0x000228C2, 0x000422C2, 0x0002FA02, 0x00004FC2, 0x00036082, 0x00046D02, 0x000440C2, 0x00044AC2,
+		0x00010342, 0x000240C2, 0x00038F42, 0x00028D82, 0x00007E82, 0x0001AF42, 0x00008E02, 0x00043382,
+		0x00002A42, 0x0002F4C2, 0x00042402, 0x000207C2, 0x0003C942, 0x0002B1C2, 0x0002D3C2, 0x0002DD42,
+		0x00041702, 0x0002CC02, 0x0000E4C2, 0x0001DE82, 0x00048B42, 0x00035F82, 0x00048442, 0x00004782,
+		0x00044B42, 0x00017BC2, 0x0000EE82, 0x00026C42, 0x0000B542, 0x00025F02, 0x00023682, 0x00022A82,
+		0x00038542, 0x00048182, 0x00016AC2, 0x00000602, 0x0002B082, 0x0003E842, 0x0002CDC2, 0x0001FAC2,
+		0x00027102, 0x0000D202, 0x00019C82, 0x00044602, 0x00013782, 0x00007FC2, 0x00006042, 0x000052C2,
+		0x00022B02, 0x000113C2, 0x00026582, 0x0003C7C2, 0x0001B542, 0x00007B82, 0x0001BE42, 0x0002FE42,
+		0x00016102, 0x00043102, 0x0002E742, 0x0000DD82, 0x00029402, 0x0003DC42, 0x00041082, 0x00041782,
+		0x00031502, 0x00045F82, 0x00018B42, 0x000074C2, 0x00028D02, 0x0003BD42, 0x0002AD02, 0x00022302,
+		0x0002DCC2, 0x0000F282, 0x00017A02, 0x0004C202, 0x0001AB42, 0x00000702, 0x00003082, 0x00002942,
+		0x0000E302, 0x0001D602, 0x00041AC2, 0x0002B3C2, 0x00000682, 0x00013642, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xC746C402, 0xC7470402, 0xC7474402, 0xC7478402, 0xC747C402, 0xC7480402, 0xC7484402, 0xC7488402,
+		0xC748C402, 0xC7490402, 0xC7494402, 0xC7498402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xC0824403, 0xC08D8402, 0xC0A48402, 0xC0F04402, 0xC752C402, 0x87D5C402, 0x00046182, 0x87E60402,
+		0xC0E00402, 0xC0E04402, 0xC0E08402, 0xC0E0C402, 0xC0E10402, 0xC0E14402, 0xC0E18402, 0xC0E1C402,
+		0xC0E20402, 0xC0E24402, 0xC7530402, 0xC7534402, 0xC0E28402, 0xC0E2C402, 0xC0E30402, 0xC0E34402,
+		0xC0E38402, 0xC0E3C402, 0xC0E40402, 0xC0E44402, 0xC0878402, 0xC0C8C402, 0xC0C90402, 0xC0C94402,
+		0xC7538402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0x80002022, 0x80002042, 0x80002062, 0x80002082, 0x800020A2, 0x800020C2,
+		0xC087C402, 0x87D70402, 0x00046B42, 0x87D74402, 0x00010982, 0x87D78402, 0xC7530404, 0xC753C402,
+		0x0000B782, 0x0002A2C2, 0x00047A82, 0x87D60402, 0x00044582, 0xC0F08402, 0xC7540402, 0xC7544402,
+		0x00000000, 0x90B6840D, 0x90B6840E, 0x90B6C40D, 0x90B6C40E, 0x90B7040D, 0x90B7040E, 0x90B7840D,
+		0x90B7840E, 0x90B7C40D, 0x90B7C40E, 0x90B8040E, 0x00000000, 0x90B8440E, 0x00000000, 0x90B8840E,
+		0x00000000, 0x90B8C40E, 0x00000000, 0x90B9040E, 0x00000000, 0x90B9440E, 0x00000000, 0x90B9840E,
+		0x00000000, 0x90B9C40E, 0x00000000, 0x90BA040E, 0x00000000, 0x90BA440E, 0x00000000, 0x90BA840E,
+		0x00000000, 0x90BAC40E, 0x00000000, 0x90BB040D, 0x90BB040E, 0x00000000, 0x90BB440E, 0x00000000,
+		0x90BB840E, 0x00000000, 0x90BBC40E, 0x90BC040E, 0x90BC440E, 0x90BC840E, 0x90BCC40E, 0x90BD040E,
+		0x00000000, 0x00000000, 0x90BD440E, 0x00000000, 0x00000000, 0x90BD840E, 0x00000000, 0x00000000,
+		0x90BDC40E, 0x00000000, 0x00000000, 0x90BE040E, 0x00000000, 0x00000000, 0x90BE440E, 0x90BE840E,
+		0x90BEC40E, 0x90BF040E, 0x90BF440E, 0x90BF840D, 0x90BF840E, 0x90BFC40D, 0x90BFC40E, 0x90C0040D,
+		0x90C0040E, 0x90C0440E, 0x90C0840E, 0x90C0C40E, 0x90C1040E, 0x90C1440E, 0x90C1840D, 0x90C1840E,
+		0x90C1C40E, 0x90C2040E, 0x90C2440E, 0x90C2840E, 0x00000000, 0x90B8040D, 0x90B8C40D, 0x00000000,
+		0x00000000, 0x800006E2, 0x80000702, 0xC130C402, 0xC1310402, 0x87D7C402, 0x00000000, 0x000134C2,
+		0xC0880402, 0x90B6840F, 0x90B68411, 0x90B6C40F, 0x90B6C411, 0x90B7040F, 0x90B70411, 0x90B7840F,
+		0x90B78411, 0x90B7C40F, 0x90B7C411, 0x90B80411, 0x00000000, 0x90B84411, 0x00000000, 0x90B88411,
+		0x00000000, 0x90B8C411, 0x00000000, 0x90B90411, 0x00000000, 0x90B94411, 0x00000000, 0x90B98411,
+		0x00000000, 0x90B9C411, 0x00000000, 0x90BA0411, 0x00000000, 0x90BA4411, 0x00000000, 0x90BA8411,
+		0x00000000, 0x90BAC411, 0x00000000, 0x90BB040F, 0x90BB0411, 0x00000000, 0x90BB4411, 0x00000000,
+		0x90BB8411, 0x00000000, 0x90BBC411, 0x90BC0411, 0x90BC4411, 0x90BC8411, 0x90BCC411, 0x90BD0411,
+		0x00000000, 0x00000000, 0x90BD4411, 0x00000000, 0x00000000, 0x90BD8411, 0x00000000, 0x00000000,
+		0x90BDC411, 0x00000000, 0x00000000, 0x90BE0411, 0x00000000, 0x00000000, 0x90BE4411, 0x90BE8411,
+		0x90BEC411, 0x90BF0411, 0x90BF4411, 0x90BF840F, 0x90BF8411, 0x90BFC40F, 0x90BFC411, 0x90C0040F,
+		0x90C00411, 0x90C04411, 0x90C08411, 0x90C0C411, 0x90C10411, 0x90C14411, 0x90C1840F, 0x90C18411,
+		0x90C1C411, 0x90C20411, 0x90C24411, 0x90C28411, 0x00000000, 0x90B8040F, 0x90B8C40F, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0xC0884402, 0x87D80402, 0x87D84402, 0x00000000, 0x00030BC2,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x910A4402, 0x910A8402, 0x910AC402,
+		0x910B4402, 0x910BC402, 0x910C0402, 0x910C4402, 0x910CC402, 0x910D0402, 0x910D4402, 0x910E0402,
+		0x910E4402, 0x910E8402, 0x910EC402, 0x910FC402, 0x91100402, 0x91104402, 0x91108402, 0x9110C402,
+		0x91110402, 0x91114402, 0x91124402, 0x91128402, 0x91130402, 0x91134402, 0x9113C402, 0x91140402,
+		0x91144402, 0x91148402, 0x9114C402, 0x91150402, 0x91154402, 0x9115C402, 0x91168402, 0x9116C402,
+		0x91170402, 0x91174402, 0x910B8402, 0x910D8402, 0x910F0402, 0x91178402, 0x91130404, 0x910C8402,
+		0x00000000, 0x905D4404, 0x905D8404, 0x9094C404, 0x905DC404, 0x90954404, 0x90958404, 0x905E0404,
+		0x905E4404, 0x905E8404, 0x90964404, 0x90968404, 0x9096C404, 0x90970404, 0x90974404, 0x90978404,
+		0x9063C404, 0x905EC404, 0x905F0404, 0x905F4404, 0x90658404, 0x905F8404, 0x905FC404, 0x90600404,
+		0x90604404, 0x90608404, 0x9060C404, 0x90610404, 0x90614404, 0x90618404, 0x9061C404, 0x907CC404,
+		0x907D0404, 0x907D4404, 0x907D8404, 0x907DC404, 0x907E0404, 0x907E4404, 0x907E8404, 0x907EC404,
+		0x907F0404, 0x907F4404, 0x907F8404, 0x907FC404, 0x90800404, 0x90804404, 0x90808404, 0x9080C404,
+		0x90810404, 0x90814404, 0x90818404, 0x9081C404, 0x907C8404, 0x90624404, 0x90628404, 0x909C0404,
+		0x909C4404, 0x909D4404, 0x909DC404, 0x909F0404, 0x90A00404, 0x90A08404, 0x90644404, 0x90A18404,
+		0x90A20404, 0x90648404, 0x9064C404, 0x90654404, 0x9065C404, 0x90660404, 0x90670404, 0x90678404,
+		0x90680404, 0x90684404, 0x90688404, 0x9068C404, 0x90690404, 0x9069C404, 0x906AC404, 0x906D4404,
+		0x906F0404, 0x90704404, 0x90A68404, 0x90A6C404, 0x90730404, 0x90734404, 0x90738404, 0x90858404,
+		0x9085C404, 0x90868404, 0x9088C404, 0x90890404, 0x90898404, 0x908C0404, 0x908CC404, 0x00000000,
+		0xC7548402, 0xC754C402, 0x00001882, 0x00017B42, 0x00042942, 0x0002F442, 0x000411C2, 0x0000B402,
+		0x0003D202, 0x0001DF02, 0x000071C2, 0x00031BC2, 0x00004A02, 0x00019802, 0x0001BEC2, 0x0001C402,
+		0x0002C242, 0x00040E82, 0x0001CE42, 0x0000D282, 0x91138402, 0x0004AE82, 0x9112C402, 0x00013402,
+		0x000322C2, 0x00000582, 0x000250C2, 0x0003CE82, 0x910B0402, 0x910DC402, 0x00011542, 0x00011EC2,
+		0x91160402, 0x91164402, 0x91158402, 0x00043202, 0x910A8419, 0x910C0419, 0x910D4419, 0x910E0419,
+		0x91118402, 0x9111C402, 0x91120402, 0x910D0419, 0x910F4402, 0x910F8402, 0x9117C402, 0x91180402,
+		0xC749C402, 0xC74A0402, 0xC74A4402, 0xC74A8402, 0xC74AC402, 0xC74B0402, 0xC74B4402, 0xC74B8402,
+		0xC74BC402, 0xC74C0402, 0xC74C4402, 0xC74C8402, 0xC74CC402, 0xC74D0402, 0xC74D4402, 0xC74D8402,
+		0xC74DC402, 0xC74E0402, 0xC74E4402, 0xC74E8402, 0xC74EC402, 0xC74F0402, 0xC74F4402, 0xC74F8402,
+		0xC74FC402, 0xC7500402, 0xC7504402, 0xC7508402, 0xC750C402, 0xC7510402, 0xC7514402, 0xC7518402,
+		0xC751C402, 0xC7520402, 0xC7524402, 0xC7528402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x90B8840F, 0x90B9840F, 0x90B9C40F, 0x90BB840F, 0x90BC440F, 0x90BD040F, 0x90BD440F, 0x90BD840F,
+		0x90BDC40F, 0x90BE040F, 0x90BEC40F, 0x90C0440F, 0x90C0840F, 0x90C0C40F, 0x90C1040F, 0x90C1440F,
+		0x00030A43, 0x00047883, 0x00019B43, 0x000083C3, 0x000299C3, 0x0003CD43, 0x000291C3, 0x000232C3,
+		0x0002ED03, 0x00010603, 0x00016A03, 0x0004AB43, 0x0001BCC3, 0x00001DC3, 0x000045C4, 0x00003AC4,
+		0x0003B344, 0x000290C4, 0x0000F504, 0x00023FC4, 0x00044F84, 0x00031DC4, 0x00046D84, 0x00005844,
+		0x0004AA44, 0x00018DC4, 0x0000E204, 0x0002EC04, 0x00010C84, 0x0001D707, 0x0001FBC6, 0x00000000,
+		0x0004A944, 0x00036784, 0x00004904, 0x00014B44, 0x00040144, 0x0002C3C4, 0x0003F144, 0x0000E544,
+		0x0003B244, 0x00020F04, 0x00005D04, 0x00030944, 0x00001A84, 0x0001C084, 0x0001A184, 0x00019444,
+		0x00023A44, 0x0000FEC4, 0x00029C84, 0x0003B704, 0x00019F04, 0x00006D04, 0x00017DC4, 0x00032F84,
+		0x00014C44, 0x00046904, 0x0002B2C4, 0x00009E84, 0x00027DC4, 0x00042484, 0x0003FA04, 0x00040C84,
+		0x00045344, 0x00030F84, 0x00008844, 0x0001A284, 0x0003BA02, 0x00028002, 0x00039602, 0x00012C42,
+		0x0003F802, 0x00025382, 0x00000282, 0x00034842, 0x00007042, 0x00016C02, 0x00014A02, 0x00015482,
+		0x0003C243, 0x00027BC2, 0x00012542, 0x00022F82, 0x000448C2, 0x00031202, 0x00043282, 0x00008C02,
+		0x000488C2, 0x0001B7C2, 0x0000A642, 0x0002B4C2, 0x00010A82, 0x00020482, 0x0001D982, 0x0001E402,
+		0x905D4406, 0x905DC406, 0x905E0406, 0x905E8406, 0x905EC406, 0x905F0406, 0x905F8406, 0x90600406,
+		0x90604406, 0x9060C406, 0x90610406, 0x90614406, 0x90618406, 0x9061C406, 0x00030582, 0x0002F542,
+		0x00008E82, 0x00018702, 0x00045142, 0x00030302, 0x0000F602, 0x00021D42, 0x00010042, 0x0003C082,
+		0x00009D82, 0x00028682, 0x000490C2, 0x00014E42, 0x00043AC5, 0x00037144, 0x00034102, 0xC7550402,
+		0x0001CA02, 0x0000D7C2, 0x0002C882, 0x00042C02, 0x000174C2, 0x00004C02, 0x00015CC2, 0x000354C2,
+		0x0001BBC2, 0x00048F42, 0x000287C2, 0x00010B02, 0x0002EDC2, 0x0003ACC2, 0x0003D0C2, 0x0003D5C2,
+		0x0002AA02, 0x00039D42, 0x00024742, 0x0000E882, 0x0002FC02, 0x00043182, 0x000318C2, 0x0001B3C2,
+		0x00034C42, 0x00007C02, 0x0001E682, 0x000409C2, 0x00021982, 0x0000CBC2, 0x0000AB42, 0x00009BC2,
+		0x00046002, 0x00031582, 0x00009382, 0x00019582, 0x0003AB82, 0x00027502, 0x0003A182, 0x00013142,
+		0x00040582, 0x00025C02, 0x00000B02, 0x00035042, 0x00006742, 0x00017542, 0x000156C2, 0x000146C2,
+		0x00009E02, 0x00020142, 0x0003FE82, 0x0002F3C2, 0x00004A82, 0x00017C42, 0x00002C02, 0x00048DC2,
+		0x00008F02, 0x00036002, 0x0003BC42, 0x00023CC2, 0x000428C2, 0x00027782, 0x00029F42, 0x0002ABC2,
+		0x00048203, 0x00038643, 0x00002703, 0x00017403, 0x00041F83, 0x0002E8C3, 0x00041983, 0x0000BBC3,
+		0x0003D783, 0x0001E984, 0x00007A84, 0x00032784, 0x00003A42, 0x0001A5C3, 0x0001C582, 0x0001BD83,
+		0x90B68413, 0x90B6C413, 0x90B70413, 0x90B78413, 0x90B7C413, 0x90B80413, 0x90B84413, 0x90B88413,
+		0x90B8C413, 0x90B90413, 0x90B94413, 0x90B98413, 0x90B9C413, 0x90BA0413, 0x90BA4413, 0x90BA8413,
+		0x90BAC413, 0x90BB0413, 0x90BB4413, 0x90BB8413, 0x90BBC413, 0x90BC0413, 0x90BC4413, 0x90BC8413,
+		0x90BCC413, 0x90BD0413, 0x90BD4413, 0x90BD8413, 0x90BDC413, 0x90BE0413, 0x90BE4413, 0x90BE8413,
+		0x90BEC413, 0x90BF0413, 0x90BF4413, 0x90BF8413, 0x90BFC413, 0x90C00413, 0x90C04413, 0x90C08413,
+		0x90C0C413, 0x90C10413, 0x90C14413, 0x90C18413, 0x90C1C413, 0x90C20413, 0x90C24413, 0x0003A8C4,
+		0x00049F05, 0x00035BC4, 0x00003E45, 0x00015743, 0x00040B45, 0x0002CD03, 0x0003E603, 0x0000DEC6,
+		0x0003A644, 0x000203C3, 0x000053C3, 0x00030043, 0x00002304, 0x0001B644, 0x00019604, 0x00019D04,
+		0x0002E104, 0x0003D9C4, 0x0001F384, 0x0000AE06, 0x00034BC2, 0x000485C6, 0x00035986, 0x00015E05,
+		0x0002FEC4, 0x00002D06, 0x00022486, 0x0003A4C4, 0x0001D2C3, 0x00011103, 0x0000ECC4, 0x0000F384,
+		0x00030105, 0x00046A05, 0x00019283, 0x00008F83, 0x0002A8C4, 0x0003D303, 0x00028C43, 0x00022A02,
+		0x0002E282, 0x0000FA83, 0x00016283, 0x0004A046, 0x0001C484, 0x00001345, 0x00003846, 0x00004804,
+		0x0000A8C3, 0x00020B83, 0x000407C6, 0x0002E7C4, 0x00003BC6, 0x00017343, 0x00003105, 0x00049243,
+		0x00009AC4, 0x000369C3, 0x0003C404, 0x00024585, 0x00042144, 0x000282C5, 0x0002AD84, 0x00029C02,
+		0x00035205, 0x0004C0C3, 0x000150C3, 0x000036C4, 0x0002E5C3, 0x00041E43, 0x0002DE43, 0x0001E485,
+		0x0002A4C4, 0x0000B982, 0x0001B086, 0x00045E43, 0x00017185, 0x00006AC4, 0x00009144, 0x000086C3,
+		0x0002BCC3, 0x00042B04, 0x0001E202, 0x0000D6C4, 0x00038205, 0x0004B302, 0x00037B86, 0x00015A03,
+		0x00033AC3, 0x00001D03, 0x00024B83, 0x0003CC03, 0x00020A43, 0x00010543, 0x00012EC3, 0x00012403,
+		0x00019A03, 0x000078C3, 0x0002F5C4, 0x00045A04, 0x00024D04, 0x000118C4, 0x00025644, 0x00026884,
+		0x0001EA84, 0x000390C4, 0x00038444, 0x00004104, 0x00032884, 0x00047D84, 0x00049B84, 0x0004A804,
+		0x00015884, 0x00003243, 0x00034B42, 0x00049D02, 0x0001F2C3, 0x0000C302, 0x00021242, 0x0002BE82,
+		0x00024883, 0x0003EC03, 0x00033C82, 0x000099C4, 0x00037504, 0x00043744, 0x00045C04, 0x00044BC8,
+		0x00011842, 0x00022F02, 0x0003D942, 0x00027B42, 0x00006382, 0x00019AC2, 0x00005A02, 0x000473C2,
+		0x00002483, 0x00033EC4, 0x0003EB02, 0x0001D382, 0x0003A442, 0x0002F342, 0x0002D0C2, 0x0002CA82,
+		0x0003FD82, 0x0002DA43, 0x0000A003, 0x0001F903, 0x0004AC83, 0x00037682, 0x0004B382, 0x00000382,
+		0x00044DC2, 0x00013382, 0x00012CC2, 0x00029EC2, 0x0000CFC2, 0x00021702, 0x00023702, 0x000249C3,
+		0x00034683, 0x0004B702, 0x000148C3, 0x000046C3, 0x0002F103, 0x00042602, 0x0002D803, 0x0001DD43,
+		0x000297C4, 0x0000B282, 0x0001AC43, 0x00045583, 0x00017943, 0x00006403, 0x00008485, 0x000094C6,
+		0x00024A82, 0x000106C2, 0x0002A7C2, 0x0003AA42, 0x00019342, 0x00006602, 0x00018802, 0x00033502,
+		0x00015982, 0x00047582, 0x0002B842, 0x0000A6C2, 0x00027342, 0x00042D42, 0x00040742, 0x0003FE02,
+		0x00031C42, 0x00043D82, 0x0001BAC4, 0x00006E82, 0x00027D42, 0x0003B802, 0x00026304, 0x00025143,
+		0x0002CA02, 0x000129C2, 0x000135C2, 0x00047A02, 0x00019E02, 0x00004342, 0x00001742, 0x00002202,
+		0x0000A2C2, 0x00020282, 0x0003FB03, 0x0002EFC2, 0x00004482, 0x00017A83, 0x00002AC3, 0x00048942,
+		0x00008C84, 0x00035B03, 0x0003BDC2, 0x00023782, 0x00042682, 0x00027AC2, 0x00029E03, 0x0002AC43,
+		0x0000D0C3, 0x0001E5C3, 0x00042803, 0x0002C543, 0x000019C3, 0x00014A83, 0x00000F03, 0x0004C003,
+		0x00006C43, 0x00038784, 0x00039DC4, 0x00022104, 0x00040044, 0x0002A344, 0x00028104, 0x00027244,
+		0x0000EBC4, 0x00025544, 0x0003A7C4, 0x0002A644, 0x000098C4, 0x0001C304, 0x00007984, 0x000441C4,
+		0x00003D44, 0x00030CC4, 0x000413C4, 0x0001F504, 0x0003D844, 0x0002C144, 0x0002E444, 0x0002EB43,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xC3FD8402, 0xC3FDC402, 0xC3FE0402, 0xC3FE4402, 0xC3FE8402, 0xC3FEC402, 0xC3FF0402, 0xC3FF4402,
+		0xC3FF8402, 0xC3FFC402, 0xC4000402, 0xC4004402, 0xC4008402, 0xC400C402, 0xC4010402, 0xC4014402,
+		0xC4018402, 0xC401C402, 0xC4020402, 0xC4024402, 0xC4028402, 0xC402C402, 0xC4030402, 0xC4034402,
+		0xC4038402, 0xC403C402, 0xC4040402, 0xC4044402, 0xC4048402, 0xC404C402, 0xC4050402, 0xC4054402,
+		0xC4058402, 0xC405C402, 0xC4060402, 0xC4064402, 0xC4068402, 0xC406C402, 0xC4070402, 0xC4074402,
+		0xC4078402, 0xC407C402, 0xC4080402, 0xC4084402, 0xC4088402, 0xC408C402, 0xC4090402, 0xC4094402,
+		0xC4098402, 0xC409C402, 0xC40A0402, 0xC40A4402, 0xC40A8402, 0xC40AC402, 0xC40B0402, 0xC40B4402,
+		0xC40B8402, 0xC40BC402, 0xC40C0402, 0xC40C4402, 0xC40C8402, 0xC40CC402, 0xC40D0402, 0xC40D4402,
+		0x91184402, 0x91188402, 0x9118C402, 0x91190402, 0x91194402, 0x91198402, 0x9119C402, 0x911A0402,
+		0x911A4402, 0x911A8402, 0x911AC402, 0x911B0402, 0x911B4402, 0x911B8402, 0x911BC402, 0x911C0402,
+		0x911C4402, 0x911C8402, 0x911CC402, 0x911D0402, 0x911D4402, 0x911D8402, 0x911DC402, 0x911E0402,
+		0x911E4402, 0x911E8402, 0x911EC402, 0x911F0402, 0x911F4402, 0x911F8402, 0x911FC402, 0x91200402,
+		0x91204402, 0x91208402, 0x9120C402, 0x91210402, 0x91214402, 0x91218402, 0x9121C402, 0x91220402,
+		0x91224402, 0x91228402, 0x9122C402, 0x91230402, 0x91234402, 0x91238402, 0x9123C402, 0x91240402,
+		0x91244402, 0x91248402, 0x9124C402, 0x91250402, 0x91254402, 0x91258402, 0x9125C402, 0x91260402,
+		0x91264402, 0x91268402, 0x9126C402, 0x91270402, 0x91274402, 0x91278402, 0x9127C402, 0x91280402,
+		0x91284402, 0x91288402, 0x9128C402, 0x91290402, 0x91294402, 0x91298402, 0x9129C402, 0x912A0402,
+		0x912A4402, 0x912A8402, 0x912AC402, 0x912B0402, 0x912B4402, 0x912B8402, 0x912BC402, 0x912C0402,
+		0x912C4402, 0x912C8402, 0x912CC402, 0x912D0402, 0x912D4402, 0x912D8402, 0x912DC402, 0x912E0402,
+		0x912E4402, 0x912E8402, 0x912EC402, 0x912F0402, 0x912F4402, 0x912F8402, 0x912FC402, 0x91300402,
+		0x91304402, 0x91308402, 0x9130C402, 0x91310402, 0x91314402, 0x91318402, 0x9131C402, 0x91320402,
+		0x91324402, 0x91328402, 0x9132C402, 0x91330402, 0x91334402, 0x91338402, 0x9133C402, 0x91340402,
+		0x91344402, 0x91348402, 0x9134C402, 0x91350402, 0x91354402, 0x91358402, 0x9135C402, 0x91360402,
+		0x91364402, 0x91368402, 0x9136C402, 0x91370402, 0x91374402, 0x91378402, 0x9137C402, 0x91380402,
+		0x91384402, 0x91388402, 0x9138C402, 0x91390402, 0x91394402, 0x91398402, 0x9139C402, 0x913A0402,
+		0x913A4402, 0x913A8402, 0x913AC402, 0x913B0402, 0x913B4402, 0x913B8402, 0x913BC402, 0x913C0402,
+		0x913C4402, 0x913C8402, 0x913CC402, 0x913D0402, 0x913D4402, 0x913D8402, 0x913DC402, 0x913E0402,
+		0x913E4402, 0x913E8402, 0x913EC402, 0x913F0402, 0x913F4402, 0x913F8402, 0x913FC402, 0x91400402,
+		0x91404402, 0x91408402, 0x9140C402, 0x91410402, 0x91414402, 0x91418402, 0x9141C402, 0x91420402,
+		0x91424402, 0x91428402, 0x9142C402, 0x91430402, 0x91434402, 0x91438402, 0x9143C402, 0x91440402,
+		0x91444402, 0x91448402, 0x9144C402, 0x91450402, 0x91454402, 0x91458402, 0x9145C402, 0x91460402,
+		0x91464402, 0x91468402, 0x9146C402, 0x91470402, 0x91474402, 0x91478402, 0x9147C402, 0x91480402,
+		0x91484402, 0x91488402, 0x9148C402, 0x91490402, 0x91494402, 0x91498402, 0x9149C402, 0x914A0402,
+		0x914A4402, 0x914A8402, 0x914AC402, 0x914B0402, 0x914B4402, 0x914B8402, 0x914BC402, 0x914C0402,
+		0x914C4402, 0x914C8402, 0x914CC402, 0x914D0402, 0x914D4402, 0x914D8402, 0x914DC402, 0x914E0402,
+		0x914E4402, 0x914E8402, 0x914EC402, 0x914F0402, 0x914F4402, 0x914F8402, 0x914FC402, 0x91500402,
+		0x91504402, 0x91508402, 0x9150C402, 0x91510402, 0x91514402, 0x91518402, 0x9151C402, 0x91520402,
+		0x91524402, 0x91528402, 0x9152C402, 0x91530402, 0x91534402, 0x91538402, 0x9153C402, 0x91540402,
+		0x91544402, 0x91548402, 0x9154C402, 0x91550402, 0x91554402, 0x91558402, 0x9155C402, 0x91560402,
+		0x91564402, 0x91568402, 0x9156C402, 0x91570402, 0x91574402, 0x91578402, 0x9157C402, 0x91580402,
+		0x91584402, 0x91588402, 0x9158C402, 0x91590402, 0x91594402, 0x91598402, 0x9159C402, 0x915A0402,
+		0x915A4402, 0x915A8402, 0x915AC402, 0x915B0402, 0x915B4402, 0x915B8402, 0x915BC402, 0x915C0402,
+		0x915C4402, 0x915C8402, 0x915CC402, 0x915D0402, 0x915D4402, 0x915D8402, 0x915DC402, 0x915E0402,
+		0x915E4402, 0x915E8402, 0x915EC402, 0x915F0402, 0x915F4402, 0x915F8402, 0x915FC402, 0x91600402,
+		0x91604402, 0x91608402, 0x9160C402, 0x91610402, 0x91614402, 0x91618402, 0x9161C402, 0x91620402,
+		0x91624402, 0x91628402, 0x9162C402, 0x91630402, 0x91634402, 0x91638402, 0x9163C402, 0x91640402,
+		0x91644402, 0x91648402, 0x9164C402, 0x91650402, 0x91654402, 0x91658402, 0x9165C402, 0x91660402,
+		0x91664402, 0x91668402, 0x9166C402, 0x91670402, 0x91674402, 0x91678402, 0x9167C402, 0x91680402,
+		0x91684402, 0x91688402, 0x9168C402, 0x91690402, 0x91694402, 0x91698402, 0x9169C402, 0x916A0402,
+		0x916A4402, 0x916A8402, 0x916AC402, 0x916B0402, 0x916B4402, 0x916B8402, 0x916BC402, 0x916C0402,
+		0x916C4402, 0x916C8402, 0x916CC402, 0x916D0402, 0x916D4402, 0x916D8402, 0x916DC402, 0x916E0402,
+		0x916E4402, 0x916E8402, 0x916EC402, 0x916F0402, 0x916F4402, 0x916F8402, 0x916FC402, 0x91700402,
+		0x91704402, 0x91708402, 0x9170C402, 0x91710402, 0x91714402, 0x91718402, 0x9171C402, 0x91720402,
+		0x91724402, 0x91728402, 0x9172C402, 0x91730402, 0x91734402, 0x91738402, 0x9173C402, 0x91740402,
+		0x91744402, 0x91748402, 0x9174C402, 0x91750402, 0x91754402, 0x91758402, 0x9175C402, 0x91760402,
+		0x91764402, 0x91768402, 0x9176C402, 0x91770402, 0x91774402, 0x91778402, 0x9177C402, 0x91780402,
+		0x91784402, 0x91788402, 0x9178C402, 0x91790402, 0x91794402, 0x91798402, 0x9179C402, 0x917A0402,
+		0x917A4402, 0x917A8402, 0x917AC402, 0x917B0402, 0x917B4402, 0x917B8402, 0x917BC402, 0x917C0402,
+		0x917C4402, 0x917C8402, 0x917CC402, 0x917D0402, 0x917D4402, 0x917D8402, 0x917DC402, 0x917E0402,
+		0x917E4402, 0x917E8402, 0x917EC402, 0x917F0402, 0x917F4402, 0x917F8402, 0x917FC402, 0x91800402,
+		0x91804402, 0x91808402, 0x9180C402, 0x91810402, 0x91814402, 0x91818402, 0x9181C402, 0x91820402,
+		0x91824402, 0x91828402, 0x9182C402, 0x91830402, 0x91834402, 0x91838402, 0x9183C402, 0x91840402,
+		0x91844402, 0x91848402, 0x9184C402, 0x91850402, 0x91854402, 0x91858402, 0x9185C402, 0x91860402,
+		0x91864402, 0x91868402, 0x9186C402, 0x91870402, 0x91874402, 0x91878402, 0x9187C402, 0x91880402,
+		0x91884402, 0x91888402, 0x9188C402, 0x91890402, 0x91894402, 0x91898402, 0x9189C402, 0x918A0402,
+		0x918A4402, 0x918A8402, 0x918AC402, 0x918B0402, 0x918B4402, 0x918B8402, 0x918BC402, 0x918C0402,
+		0x918C4402, 0x918C8402, 0x918CC402, 0x918D0402, 0x918D4402, 0x918D8402, 0x918DC402, 0x918E0402,
+		0x918E4402, 0x918E8402, 0x918EC402, 0x918F0402, 0x918F4402, 0x918F8402, 0x918FC402, 0x91900402,
+		0x91904402, 0x91908402, 0x9190C402, 0x91910402, 0x91914402, 0x91918402, 0x9191C402, 0x91920402,
+		0x91924402, 0x91928402, 0x9192C402, 0x91930402, 0x91934402, 0x91938402, 0x9193C402, 0x91940402,
+		0x91944402, 0x91948402, 0x9194C402, 0x91950402, 0x91954402, 0x91958402, 0x9195C402, 0x91960402,
+		0x91964402, 0x91968402, 0x9196C402, 0x91970402, 0x91974402, 0x91978402, 0x9197C402, 0x91980402,
+		0x91984402, 0x91988402, 0x9198C402, 0x91990402, 0x91994402, 0x91998402, 0x9199C402, 0x919A0402,
+		0x919A4402, 0x919A8402, 0x919AC402, 0x919B0402, 0x919B4402, 0x919B8402, 0x919BC402, 0x919C0402,
+		0x919C4402, 0x919C8402, 0x919CC402, 0x919D0402, 0x919D4402, 0x919D8402, 0x919DC402, 0x919E0402,
+		0x919E4402, 0x919E8402, 0x919EC402, 0x919F0402, 0x919F4402, 0x919F8402, 0x919FC402, 0x91A00402,
+		0x91A04402, 0x91A08402, 0x91A0C402, 0x91A10402, 0x91A14402, 0x91A18402, 0x91A1C402, 0x91A20402,
+		0x91A24402, 0x91A28402, 0x91A2C402, 0x91A30402, 0x91A34402, 0x91A38402, 0x91A3C402, 0x91A40402,
+		0x91A44402, 0x91A48402, 0x91A4C402, 0x91A50402, 0x91A54402, 0x91A58402, 0x91A5C402, 0x91A60402,
+		0x91A64402, 0x91A68402, 0x91A6C402, 0x91A70402, 0x91A74402, 0x91A78402, 0x91A7C402, 0x91A80402,
+		0x91A84402, 0x91A88402, 0x91A8C402, 0x91A90402, 0x91A94402, 0x91A98402, 0x91A9C402, 0x91AA0402,
+		0x91AA4402, 0x91AA8402, 0x91AAC402, 0x91AB0402, 0x91AB4402, 0x91AB8402, 0x91ABC402, 0x91AC0402,
+		0x91AC4402, 0x91AC8402, 0x91ACC402, 0x91AD0402, 0x91AD4402, 0x91AD8402, 0x91ADC402, 0x91AE0402,
+		0x91AE4402, 0x91AE8402, 0x91AEC402, 0x91AF0402, 0x91AF4402, 0x91AF8402, 0x91AFC402, 0x91B00402,
+		0x91B04402, 0x91B08402, 0x91B0C402, 0x91B10402, 0x91B14402, 0x91B18402, 0x91B1C402, 0x91B20402,
+		0x91B24402, 0x91B28402, 0x91B2C402, 0x91B30402, 0x91B34402, 0x91B38402, 0x91B3C402, 0x91B40402,
+		0x91B44402, 0x91B48402, 0x91B4C402, 0x91B50402, 0x91B54402, 0x91B58402, 0x91B5C402, 0x91B60402,
+		0x91B64402, 0x91B68402, 0x91B6C402, 0x91B70402, 0x91B74402, 0x91B78402, 0x91B7C402, 0x91B80402,
+		0x91B84402, 0x91B88402, 0x91B8C402, 0x91B90402, 0x91B94402, 0x91B98402, 0x91B9C402, 0x91BA0402,
+		0x91BA4402, 0x91BA8402, 0x91BAC402, 0x91BB0402, 0x91BB4402, 0x91BB8402, 0x91BBC402, 0x91BC0402,
+		0x91BC4402, 0x91BC8402, 0x91BCC402, 0x91BD0402, 0x91BD4402, 0x91BD8402, 0x91BDC402, 0x91BE0402,
+		0x91BE4402, 0x91BE8402, 0x91BEC402, 0x91BF0402, 0x91BF4402, 0x91BF8402, 0x91BFC402, 0x91C00402,
+		0x91C04402, 0x91C08402, 0x91C0C402, 0x91C10402, 0x91C14402, 0x91C18402, 0x91C1C402, 0x91C20402,
+		0x91C24402, 0x91C28402, 0x91C2C402, 0x91C30402, 0x91C34402, 0x91C38402, 0x91C3C402, 0x91C40402,
+		0x91C44402, 0x91C48402, 0x91C4C402, 0x91C50402, 0x91C54402, 0x91C58402, 0x91C5C402, 0x91C60402,
+		0x91C64402, 0x91C68402, 0x91C6C402, 0x91C70402, 0x91C74402, 0x91C78402, 0x91C7C402, 0x91C80402,
+		0x91C84402, 0x91C88402, 0x91C8C402, 0x91C90402, 0x91C94402, 0x91C98402, 0x91C9C402, 0x91CA0402,
+		0x91CA4402, 0x91CA8402, 0x91CAC402, 0x91CB0402, 0x91CB4402, 0x91CB8402, 0x91CBC402, 0x91CC0402,
+		0x91CC4402, 0x91CC8402, 0x91CCC402, 0x91CD0402, 0x91CD4402, 0x91CD8402, 0x91CDC402, 0x91CE0402,
+		0x91CE4402, 0x91CE8402, 0x91CEC402, 0x91CF0402, 0x91CF4402, 0x91CF8402, 0x91CFC402, 0x91D00402,
+		0x91D04402, 0x91D08402, 0x91D0C402, 0x91D10402, 0x91D14402, 0x91D18402, 0x91D1C402, 0x91D20402,
+		0x91D24402, 0x91D28402, 0x91D2C402, 0x91D30402, 0x91D34402, 0x91D38402, 0x91D3C402, 0x91D40402,
+		0x91D44402, 0x91D48402, 0x91D4C402, 0x91D50402, 0x91D54402, 0x91D58402, 0x91D5C402, 0x91D60402,
+		0x91D64402, 0x91D68402, 0x91D6C402, 0x91D70402, 0x91D74402, 0x91D78402, 0x91D7C402, 0x91D80402,
+		0x91D84402, 0x91D88402, 0x91D8C402, 0x91D90402, 0x91D94402, 0x91D98402, 0x91D9C402, 0x91DA0402,
+		0x91DA4402, 0x91DA8402, 0x91DAC402, 0x91DB0402, 0x91DB4402, 0x91DB8402, 0x91DBC402, 0x91DC0402,
+		0x91DC4402, 0x91DC8402, 0x91DCC402, 0x91DD0402, 0x91DD4402, 0x91DD8402, 0x91DDC402, 0x91DE0402,
+		0x91DE4402, 0x91DE8402, 0x91DEC402, 0x91DF0402, 0x91DF4402, 0x91DF8402, 0x91DFC402, 0x91E00402,
+		0x91E04402, 0x91E08402, 0x91E0C402, 0x91E10402, 0x91E14402, 0x91E18402, 0x91E1C402, 0x91E20402,
+		0x91E24402, 0x91E28402, 0x91E2C402, 0x91E30402, 0x91E34402, 0x91E38402, 0x91E3C402, 0x91E40402,
+		0x91E44402, 0x91E48402, 0x91E4C402, 0x91E50402, 0x91E54402, 0x91E58402, 0x91E5C402, 0x91E60402,
+		0x91E64402, 0x91E68402, 0x91E6C402, 0x91E70402, 0x91E74402, 0x91E78402, 0x91E7C402, 0x91E80402,
+		0x91E84402, 0x91E88402, 0x91E8C402, 0x91E90402, 0x91E94402, 0x91E98402, 0x91E9C402, 0x91EA0402,
+		0x91EA4402, 0x91EA8402, 0x91EAC402, 0x91EB0402, 0x91EB4402, 0x91EB8402, 0x91EBC402, 0x91EC0402,
+		0x91EC4402, 0x91EC8402, 0x91ECC402, 0x91ED0402, 0x91ED4402, 0x91ED8402, 0x91EDC402, 0x91EE0402,
+		0x91EE4402, 0x91EE8402, 0x91EEC402, 0x91EF0402, 0x91EF4402, 0x91EF8402, 0x91EFC402, 0x91F00402,
+		0x91F04402, 0x91F08402, 0x91F0C402, 0x91F10402, 0x91F14402, 0x91F18402, 0x91F1C402, 0x91F20402,
+		0x91F24402, 0x91F28402, 0x91F2C402, 0x91F30402, 0x91F34402, 0x91F38402, 0x91F3C402, 0x91F40402,
+		0x91F44402, 0x91F48402, 0x91F4C402, 0x91F50402, 0x91F54402, 0x91F58402, 0x91F5C402, 0x91F60402,
+		0x91F64402, 0x91F68402, 0x91F6C402, 0x91F70402, 0x91F74402, 0x91F78402, 0x91F7C402, 0x91F80402,
+		0x91F84402, 0x91F88402, 0x91F8C402, 0x91F90402, 0x91F94402, 0x91F98402, 0x91F9C402, 0x91FA0402,
+		0x91FA4402, 0x91FA8402, 0x91FAC402, 0x91FB0402, 0x91FB4402, 0x91FB8402, 0x91FBC402, 0x91FC0402,
+		0x91FC4402, 0x91FC8402, 0x91FCC402, 0x91FD0402, 0x91FD4402, 0x91FD8402, 0x91FDC402, 0x91FE0402,
+		0x91FE4402, 0x91FE8402, 0x91FEC402, 0x91FF0402, 0x91FF4402, 0x91FF8402, 0x91FFC402, 0x92000402,
+		0x92004402, 0x92008402, 0x9200C402, 0x92010402, 0x92014402, 0x92018402, 0x9201C402, 0x92020402,
+		0x92024402, 0x92028402, 0x9202C402, 0x92030402, 0x92034402, 0x92038402, 0x9203C402, 0x92040402,
+		0x92044402, 0x92048402, 0x9204C402, 0x92050402, 0x92054402, 0x92058402, 0x9205C402, 0x92060402,
+		0x92064402, 0x92068402, 0x9206C402, 0x92070402, 0x92074402, 0x92078402, 0x9207C402, 0x92080402,
+		0x92084402, 0x92088402, 0x9208C402, 0x92090402, 0x92094402, 0x92098402, 0x9209C402, 0x920A0402,
+		0x920A4402, 0x920A8402, 0x920AC402, 0x920B0402, 0x920B4402, 0x920B8402, 0x920BC402, 0x920C0402,
+		0x920C4402, 0x920C8402, 0x920CC402, 0x920D0402, 0x920D4402, 0x920D8402, 0x920DC402, 0x920E0402,
+		0x920E4402, 0x920E8402, 0x920EC402, 0x920F0402, 0x920F4402, 0x920F8402, 0x920FC402, 0x92100402,
+		0x92104402, 0x92108402, 0x9210C402, 0x92110402, 0x92114402, 0x92118402, 0x9211C402, 0x92120402,
+		0x92124402, 0x92128402, 0x9212C402, 0x92130402, 0x92134402, 0x92138402, 0x9213C402, 0x92140402,
+		0x92144402, 0x92148402, 0x9214C402, 0x92150402, 0x92154402, 0x92158402, 0x9215C402, 0x92160402,
+		0x92164402, 0x92168402, 0x9216C402, 0x92170402, 0x92174402, 0x92178402, 0x9217C402, 0x92180402,
+		0x92184402, 0x92188402, 0x9218C402, 0x92190402, 0x92194402, 0x92198402, 0x9219C402, 0x921A0402,
+		0x921A4402, 0x921A8402, 0x921AC402, 0x921B0402, 0x921B4402, 0x921B8402, 0x921BC402, 0x921C0402,
+		0x921C4402, 0x921C8402, 0x921CC402, 0x921D0402, 0x921D4402, 0x921D8402, 0x921DC402, 0x921E0402,
+		0x921E4402, 0x921E8402, 0x921EC402, 0x921F0402, 0x921F4402, 0x921F8402, 0x921FC402, 0x92200402,
+		0x92204402, 0x92208402, 0x9220C402, 0x92210402, 0x92214402, 0x92218402, 0x9221C402, 0x92220402,
+		0x92224402, 0x92228402, 0x9222C402, 0x92230402, 0x92234402, 0x92238402, 0x9223C402, 0x92240402,
+		0x92244402, 0x92248402, 0x9224C402, 0x92250402, 0x92254402, 0x92258402, 0x9225C402, 0x92260402,
+		0x92264402, 0x92268402, 0x9226C402, 0x92270402, 0x92274402, 0x92278402, 0x9227C402, 0x92280402,
+		0x92284402, 0x92288402, 0x9228C402, 0x92290402, 0x92294402, 0x92298402, 0x9229C402, 0x922A0402,
+		0x922A4402, 0x922A8402, 0x922AC402, 0x922B0402, 0x922B4402, 0x922B8402, 0x922BC402, 0x922C0402,
+		0x922C4402, 0x922C8402, 0x922CC402, 0x922D0402, 0x922D4402, 0x922D8402, 0x922DC402, 0x922E0402,
+		0x922E4402, 0x922E8402, 0x922EC402, 0x922F0402, 0x922F4402, 0x922F8402, 0x922FC402, 0x92300402,
+		0x92304402, 0x92308402, 0x9230C402, 0x92310402, 0x92314402, 0x92318402, 0x9231C402, 0x92320402,
+		0x92324402, 0x92328402, 0x9232C402, 0x92330402, 0x92334402, 0x92338402, 0x9233C402, 0x92340402,
+		0x92344402, 0x92348402, 0x9234C402, 0x92350402, 0x92354402, 0x92358402, 0x9235C402, 0x92360402,
+		0x92364402, 0x92368402, 0x9236C402, 0x92370402, 0x92374402, 0x92378402, 0x9237C402, 0x92380402,
+		0x92384402, 0x92388402, 0x9238C402, 0x92390402, 0x92394402, 0x92398402, 0x9239C402, 0x923A0402,
+		0x923A4402, 0x923A8402, 0x923AC402, 0x923B0402, 0x923B4402, 0x00000000, 0x00000000, 0x00000000,
+		0xC4234402, 0xC4238402, 0xC423C402, 0xC4240402, 0xC4244402, 0xC4248402, 0xC424C402, 0xC4250402,
+		0xC4254402, 0xC4258402, 0xC425C402, 0xC4260402, 0xC4264402, 0xC4268402, 0xC426C402, 0xC4270402,
+		0xC4274402, 0xC4278402, 0xC427C402, 0xC4280402, 0xC4284402, 0xC4288402, 0xC428C402, 0xC4290402,
+		0xC4294402, 0xC4298402, 0xC429C402, 0xC42A0402, 0xC42A4402, 0xC42A8402, 0xC42AC402, 0xC42B0402,
+		0xC42B4402, 0xC42B8402, 0xC42BC402, 0xC42C0402, 0xC42C4402, 0xC42C8402, 0xC42CC402, 0xC42D0402,
+		0xC42D4402, 0xC42D8402, 0xC42DC402, 0xC42E0402, 0xC42E4402, 0xC42E8402, 0xC42EC402, 0xC42F0402,
+		0xC42F4402, 0xC42F8402, 0xC42FC402, 0xC4300402, 0xC4304402, 0xC4308402, 0xC430C402, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x923D0402, 0x923D4402, 0x923D8402, 0x923DC402, 0x923E0402, 0x923E4402, 0x923E8402, 0x923EC402,
+		0x923F0402, 0x923F4402, 0x923F8402, 0x923FC402, 0x92400402, 0x92404402, 0x92408402, 0x9240C402,
+		0x92410402, 0x92414402, 0x92418402, 0x9241C402, 0x92420402, 0x92424402, 0x92428402, 0x9242C402,
+		0x92430402, 0x92434402, 0x92440402, 0x92438402, 0x92444402, 0x9243C402, 0x9244C402, 0x92450402,
+		0x92454402, 0x92458402, 0x9245C402, 0x92460402, 0x92464402, 0x92468402, 0x9246C402, 0x92470402,
+		0x923B8402, 0x923BC402, 0x923C0402, 0x923C4402, 0x923CC402, 0x923C8402, 0xC08C8402, 0xC0A30402,
+		0x8F2E4402, 0x8F2E8402, 0x8F2EC402, 0x8F2F0402, 0x8F2F4402, 0x8F2F8402, 0x8F2FC402, 0x8F300402,
+		0x8F304402, 0x8F308402, 0x8F30C402, 0x8F310402, 0x8F314402, 0x8F318402, 0x8F31C402, 0x8F320402,
+		0x8F324402, 0x8F328402, 0x8F32C402, 0x8F330402, 0x8F334402, 0x8F338402, 0x8F33C402, 0x8F340402,
+		0x8F344402, 0x8F348402, 0x8F34C402, 0x8F350402, 0x8F354402, 0x8F358402, 0x8F35C402, 0x8F360402,
+		0x8F364402, 0x8F368402, 0x8F36C402, 0x8F370402, 0x8F374402, 0x8F378402, 0x8F37C402, 0x8F380402,
+		0x8F384402, 0x8F388402, 0x8F38C402, 0x8F390402, 0x8F394402, 0x8F398402, 0x8F39C402, 0x8F3A0402,
+		0x8F3A4402, 0x8F3A8402, 0x8F3AC402, 0x8F3B0402, 0x8F3B4402, 0x8F3B8402, 0x8F3BC402, 0x8F3C0402,
+		0x8F3C4402, 0x8F3C8402, 0x8F3CC402, 0x8F3D0402, 0x8F3D4402, 0x8F3D8402, 0x8F3DC402, 0x8F3E0402,
+		0x8F3E4402, 0x8F3E8402, 0x8F3EC402, 0x8F3F0402, 0x8F3F4402, 0x8F3F8402, 0x8F3FC402, 0x8F400402,
+		0x8F404402, 0x8F408402, 0x8F40C402, 0x8F410402, 0x8F414402, 0x8F418402, 0x8F41C402, 0x8F420402,
+		0x8F424402, 0x8F428402, 0x8F42C402, 0x8F430402, 0x8F434402, 0x8F438402, 0x8F43C402, 0x8F440402,
+		0x8F444402, 0x8F448402, 0x8F44C402, 0x8F450402, 0x8F454402, 0x8F458402, 0x8F45C402, 0x8F460402,
+		0x8F464402, 0x8F468402, 0x8F46C402, 0x8F470402, 0x8F474402, 0x8F478402, 0x8F47C402, 0x8F480402,
+		0x8F484402, 0x8F488402, 0x8F48C402, 0x8F490402, 0x8F494402, 0x8F498402, 0x8F49C402, 0x8F4A0402,
+		0x8F4A4402, 0x8F4A8402, 0x8F4AC402, 0x8F4B0402, 0x8F4B4402, 0x8F4B8402, 0x8F4BC402, 0x8F4C0402,
+		0x8F4C4402, 0x8F4C8402, 0x8F4CC402, 0x8F4D0402, 0x8F4D4402, 0x8F4D8402, 0x8F4DC402, 0x8F4E0402,
+		0x8F4E4402, 0x8F4E8402, 0x8F4EC402, 0x8F4F0402, 0x8F4F4402, 0x8F4F8402, 0x8F4FC402, 0x8F500402,
+		0x8F504402, 0x8F508402, 0x8F50C402, 0x8F510402, 0x8F514402, 0x8F518402, 0x8F51C402, 0x8F520402,
+		0x8F524402, 0x8F528402, 0x8F52C402, 0x8F530402, 0x8F534402, 0x8F538402, 0x8F53C402, 0x8F540402,
+		0x8F544402, 0x8F548402, 0x8F54C402, 0x8F550402, 0x8F554402, 0x8F558402, 0x8F55C402, 0x8F560402,
+		0x8F564402, 0x8F568402, 0x8F56C402, 0x8F570402, 0x8F574402, 0x8F578402, 0x8F57C402, 0x8F580402,
+		0x8F584402, 0x8F588402, 0x8F58C402, 0x8F590402, 0x8F594402, 0x8F598402, 0x8F59C402, 0x8F5A0402,
+		0x8F5A4402, 0x8F5A8402, 0x8F5AC402, 0x8F5B0402, 0x8F5B4402, 0x8F5B8402, 0x8F5BC402, 0x8F5C0402,
+		0x8F5C4402, 0x8F5C8402, 0x8F5CC402, 0x8F5D0402, 0x8F5D4402, 0x8F5D8402, 0x8F5DC402, 0x8F5E0402,
+		0x8F5E4402, 0x8F5E8402, 0x8F5EC402, 0x8F5F0402, 0x8F5F4402, 0x8F5F8402, 0x8F5FC402, 0x8F600402,
+		0x8F604402, 0x8F608402, 0x8F60C402, 0x8F610402, 0x8F614402, 0x8F618402, 0x8F61C402, 0x8F620402,
+		0x8F624402, 0x8F628402, 0x8F62C402, 0x8F630402, 0x8F634402, 0x8F638402, 0x8F63C402, 0x8F640402,
+		0x8F644402, 0x8F648402, 0x8F64C402, 0x8F650402, 0x8F654402, 0x8F658402, 0x8F65C402, 0x8F660402,
+		0x8F664402, 0x8F668402, 0x8F66C402, 0x8F670402, 0x8F674402, 0x8F678402, 0x8F67C402, 0x8F680402,
+		0x8F684402, 0x8F688402, 0x8F68C402, 0x8F690402, 0x8F694402, 0x8F698402, 0x8F69C402, 0x8F6A0402,
+		0x8F6A4402, 0x8F6A8402, 0x8F6AC402, 0x8F6B0402, 0x8F6B4402, 0x8F6B8402, 0x8F6BC402, 0x8F6C0402,
+		0x8F6C4402, 0x8F6C8402, 0x8F6CC402, 0x8F6D0402, 0x8F6D4402, 0x8F6D8402, 0x8F6DC402, 0x8F6E0402,
+		0x8F6E4402, 0x8F6E8402, 0x8F6EC402, 0x8F6F0402, 0x8F6F4402, 0x8F6F8402, 0x8F6FC402, 0x8F700402,
+		0x8F704402, 0x8F708402, 0x8F70C402, 0x8F710402, 0x8F714402, 0xC08CC402, 0xC0A34402, 0xC09DC402,
+		0x8F444404, 0x8F48C404, 0x8F500404, 0x00037242, 0x0000C102, 0x0001F042, 0x0000E042, 0x0003EB82,
+		0x00011DC2, 0x0002BC42, 0x00047342, 0x0001C202, 0x00049A82, 0x00030B42, 0x00032A42, 0x00032242,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0x8F49C404, 0x8F628404, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x88F54408, 0x88F54402, 0x88F60408, 0x88F60402, 0x88F74408, 0x88F74402, 0x88FC4408, 0x88FC4402,
+		0x88FE8408, 0x88FE8402, 0x89238408, 0x89238402, 0x892D4408, 0x892D4402, 0x893C4408, 0x893C4402,
+		0x893E0408, 0x893E0402, 0x89424408, 0x89424402, 0x89448408, 0x89448402, 0x8944C408, 0x8944C402,
+		0x89484408, 0x89484402, 0x89498408, 0x89498402, 0x894AC408, 0x894AC402, 0x89500408, 0x89500402,
+		0x89308408, 0x89308402, 0x88EE4408, 0x88EE4402, 0x89094408, 0x89094402, 0x890C0408, 0x890C0402,
+		0x8913040A, 0x89130404, 0x8913040A, 0x89130404, 0x8913040A, 0x89130404, 0x89130404, 0x80000A22,
+		0x80000000, 0x80000000, 0x80000000, 0xC0E94402, 0x88F0C404, 0x88F94404, 0x00048FC2, 0x89208404,
+		0x893D0404, 0x893E4404, 0x893F4404, 0x892B4404, 0x80000662, 0x80000662, 0xC0F8C402, 0x893CC402,
+		0x88ED0408, 0x88ED0402, 0x88F90408, 0x88F90402, 0x88F30408, 0x88F30402, 0x8936C408, 0x8936C402,
+		0x88F88408, 0x88F88402, 0x891F4408, 0x891F4402, 0x891DC408, 0x891DC402, 0x8930C408, 0x8930C402,
+		0x89320408, 0x89320402, 0x89338408, 0x89338402, 0x892B0408, 0x892B0402, 0x893B0408, 0x893B0402,
+		0x8913040A, 0x89130404, 0x8913040A, 0x89130404, 0x893D0414, 0x893F4414, 0x8924C404, 0x89464404,
+		0x8F718402, 0x8F71C402, 0x8F720402, 0x8F724402, 0x8F728402, 0x8F72C402, 0x8F730402, 0x8F734402,
+		0x8F738402, 0x8F73C402, 0x8F740402, 0x8F744402, 0x8F748402, 0x8F74C402, 0x8F750402, 0x8F754402,
+		0x8F758402, 0x8F75C402, 0x8F760402, 0x8F764402, 0x8F768402, 0x8F76C402, 0x8F770402, 0x8F774402,
+		0x8F778402, 0x8F77C402, 0x8F780402, 0x8F784402, 0x8F788402, 0x8F78C402, 0x8F790402, 0x8F794402,
+		0x8F798402, 0x8F79C402, 0x8F7A0402, 0x8F7A4402, 0x8F7A8402, 0x8F7AC402, 0x8F7B0402, 0x8F7B4402,
+		0x8F7B8402, 0x8F7BC402, 0x8F7C0402, 0x8F7C4402, 0x8F7C8402, 0x8F7CC402, 0x8F7D0402, 0x8F7D4402,
+		0x8F7D8402, 0x8F7DC402, 0x8F7E0402, 0x8F7E4402, 0x8F7E8402, 0x8F7EC402, 0x8F7F0402, 0x8F7F4402,
+		0x8F7F8402, 0x8F7FC402, 0x8F800402, 0x8F804402, 0x8F808402, 0x8F80C402, 0x8F810402, 0x8F814402,
+		0x8F818402, 0x8F81C402, 0x8F820402, 0x8F824402, 0x8F828402, 0x8F82C402, 0x8F830402, 0x8F834402,
+		0x8F838402, 0x8F83C402, 0x8F840402, 0x8F844402, 0x8F848402, 0x8F84C402, 0x8F850402, 0x8F854402,
+		0x800016C2, 0x800016E2, 0xC0B80402, 0xC0A38402, 0xC0998402, 0xC08D0402, 0xC08F8402, 0xC09E0402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xC1410402, 0xC1414402, 0xC1418402, 0xC141C402, 0xC1420402, 0xC1424402, 0xC1428402, 0xC142C402,
+		0xC1430402, 0xC1434402, 0xC1438402, 0xC143C402, 0xC1440402, 0xC1444402, 0xC1448402, 0xC144C402,
+		0xC1450402, 0xC1454402, 0xC1458402, 0xC145C402, 0xC1460402, 0xC1464402, 0xC1468402, 0xC146C402,
+		0xC1470402, 0xC1474402, 0xC1478402, 0xC147C402, 0xC1480402, 0xC1484402, 0xC1488402, 0xC148C402,
+		0xC1490402, 0xC1494402, 0x88B98408, 0x88B98402, 0x88BC4408, 0x88BC4402, 0x88224408, 0x88224402,
+		0x0004B402, 0x00019782, 0x88B2C408, 0x88B2C402, 0x88B30408, 0x88B30402, 0x88B34408, 0x88B34402,
+		0x88118402, 0x88758402, 0x000363C2, 0x0004B282, 0x00020942, 0x0000D942, 0x00020002, 0x0002D142,
+		0x00025DC2, 0x00040482, 0x00032983, 0x00008183, 0x000383C2, 0x00044502, 0x87FA8408, 0x87FA8402,
+		0x8833C408, 0x8833C402, 0x88340408, 0x88340402, 0x88344408, 0x88344402, 0x88378408, 0x88378402,
+		0x88380408, 0x88380402, 0x88580408, 0x88580402, 0x88560408, 0x88560402, 0x00025F82, 0x00025902,
+		0x885C4408, 0x885C4402, 0x885E0408, 0x885E0402, 0x885E4408, 0x885E4402, 0x88614408, 0x88614402,
+		0x88618408, 0x88618402, 0x88674408, 0x88674402, 0x88744408, 0x88744402, 0x88930408, 0x88930402,
+		0x0000FD82, 0x00023D42, 0x88A88408, 0x88A88402, 0x88AE4408, 0x88AE4402, 0x88AE8408, 0x88AE8402,
+		0x88AFC408, 0x88AFC402, 0x88B0C408, 0x88B0C402, 0x88B10408, 0x88B10402, 0x88B14408, 0x88B14402,
+		0x88B14414, 0x88014402, 0x883EC402, 0x8845C402, 0x884D8402, 0x8873C402, 0x88740402, 0x88848402,
+		0x88B18402, 0x00034EC2, 0x0003D282, 0x00025B42, 0x00041242, 0x00026D42, 0x881B0408, 0x881B0402,
+		0x88400408, 0x88400402, 0x00033A42, 0x00043EC2, 0x00022D02, 0x0000FD02, 0x00022202, 0x0002AE82,
+		0xC1498402, 0xC149C402, 0xC14A0402, 0x88B9C408, 0x88B9C402, 0x888B0408, 0x883D8402, 0x88BA0402,
+		0x884AC408, 0x884AC402, 0x87F7C408, 0x87F7C402, 0x87F80402, 0x88204402, 0x87F2C408, 0x87F2C402,
+		0x88120408, 0x88120402, 0x0001B942, 0x00046342, 0x000164C2, 0x00005642, 0x00007542, 0x000082C2,
+		0x0003E142, 0x0002E542, 0x0000B682, 0x000210C2, 0x0004BC82, 0x00038A02, 0x00049B02, 0x00001242,
+		0x00046602, 0x00014D42, 0x88208408, 0x880B0408, 0x88154408, 0x883B0408, 0x88260408, 0x88610402,
+		0x88348408, 0x8884C408, 0x882E0408, 0x889B4408, 0x87F54408, 0x87F54402, 0x88594408, 0x88594402,
+		0x8889C408, 0x8889C402, 0x87EA4408, 0x87EA4402, 0x88294408, 0x88294402, 0x888AC408, 0x888AC402,
+		0x00000000, 0x00000000, 0x88978408, 0x88978402, 0x87F80408, 0x88768408, 0x88A40408, 0x87FC4408,
+		0x87FC4402, 0x8875C408, 0x8875C402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x88220408, 0x88220402, 0x88274402,
+		0x00020B02, 0x0003AD43, 0x888F0402, 0x88140402, 0x885E8402, 0x88454402, 0x88270402, 0x88458402,
+		0x8B370402, 0x8B374402, 0x8B378402, 0x8B37C402, 0x8B380402, 0x8B384402, 0x8B388402, 0x8B390402,
+		0x8B394402, 0x8B398402, 0x8B39C402, 0x80001882, 0x8B3A0402, 0x8B3A4402, 0x8B3A8402, 0x8B3AC402,
+		0x8B3B0402, 0x8B3B4402, 0x8B3B8402, 0x8B3BC402, 0x8B3C0402, 0x8B3C4402, 0x8B3C8402, 0x8B3CC402,
+		0x8B3D0402, 0x8B3D4402, 0x8B3D8402, 0x8B3DC402, 0x8B3E0402, 0x8B3E4402, 0x8B3E8402, 0x8B3EC402,
+		0x8B3F0402, 0x8B3F4402, 0x8B3F8402, 0x8B3FC402, 0x8B400402, 0x8B404402, 0x8B408402, 0x8B40C402,
+		0xC15B0402, 0xC15B4402, 0xC15B8402, 0xC15BC402, 0x8B38C402, 0x00000000, 0x00000000, 0x00000000,
+		0xC7588402, 0xC758C402, 0xC7590402, 0xC7594402, 0xC7598402, 0xC759C402, 0xC15C0402, 0xC15C4402,
+		0x87DBC402, 0xC15C8402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8D080402, 0x8D084402, 0x8D088402, 0x8D08C402, 0x8D090402, 0x8D094402, 0x8D098402, 0x8D09C402,
+		0x8D0B0402, 0x8D0B4402, 0x8D0B8402, 0x8D0BC402, 0x8D0C0402, 0x8D0C4402, 0x8D0C8402, 0x8D0CC402,
+		0x8D0D0402, 0x8D0D4402, 0x8D0D8402, 0x8D0DC402, 0x8D0E4402, 0x8D0E8402, 0x8D0EC402, 0x8D0F0402,
+		0x8D0FC402, 0x8D108402, 0x8D10C402, 0x8D114402, 0x8D118402, 0x8D124402, 0x8D138402, 0x8D13C402,
+		0x8D140402, 0x8D144402, 0x8D128402, 0x8D12C402, 0x8D130402, 0x8D134402, 0x8D148402, 0x8D0E0402,
+		0x8D0F4402, 0x8D0A0402, 0x8D0A4402, 0x8D0A8402, 0x8D0AC402, 0x8D0F8402, 0x8D110402, 0x8D11C402,
+		0x8D120402, 0x8D100402, 0x8D104402, 0x8D14C402, 0xC1150402, 0xC1154402, 0xC0A70402, 0xC0A74402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x80001882, 0x800018A2, 0x8B410402, 0x8B414402, 0x8B418402, 0x8B41C402, 0x8B420402, 0x8B424402,
+		0x8B428402, 0x8B42C402, 0x8B430402, 0x8B434402, 0x8B438402, 0x8B43C402, 0x8B440402, 0x8B444402,
+		0x8B448402, 0x8B44C402, 0x8B450402, 0x8B454402, 0x8B458402, 0x8B45C402, 0x8B460402, 0x8B464402,
+		0x8B468402, 0x8B46C402, 0x8B470402, 0x8B474402, 0x8B478402, 0x8B47C402, 0x8B480402, 0x8B484402,
+		0x8B488402, 0x8B48C402, 0x8B490402, 0x8B494402, 0x8B498402, 0x8B49C402, 0x8B4A0402, 0x8B4A4402,
+		0x8B4A8402, 0x8B4AC402, 0x8B4B0402, 0x8B4B4402, 0x8B4B8402, 0x8B4BC402, 0x8B4C0402, 0x8B4C4402,
+		0x8B4C8402, 0x8B4CC402, 0x8B4D0402, 0x8B4D4402, 0x8B4D8402, 0x8B4DC402, 0x8B4E0402, 0x8B4E4402,
+		0x8B4E8402, 0x8B4EC402, 0x8B4F0402, 0x8B4F4402, 0x8B4F8402, 0x8B4FC402, 0x8B500402, 0x8B504402,
+		0x8B508402, 0x8B50C402, 0x8B510402, 0x8B514402, 0x8B518402, 0x80001862, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xC0A60402, 0xC0A64402,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x8A884402, 0x8A884404, 0x8A884404, 0x8A884404, 0x8A884404, 0x8A884404,
+		0xC1004402, 0xC1008402, 0xC100C402, 0x8A888402, 0xC1010402, 0x8A760402, 0x8A7B8402, 0x8A8DC402,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0x8D52C402, 0x8D530402, 0x8D534402, 0x8D538402, 0x8D53C402, 0x8D540402,
+		0x8D544402, 0x8D548402, 0x8D54C402, 0x8D550402, 0x8D554402, 0x8D558402, 0x8D55C402, 0x8D560402,
+		0x8D564402, 0x8D568402, 0x8D56C402, 0x8D570402, 0x8D574402, 0x8D578402, 0x8D57C402, 0x8D580402,
+		0x8D584402, 0x8D588402, 0x8D58C402, 0x8D590402, 0x8D594402, 0x8D598402, 0x8D59C402, 0x8D5A0402,
+		0x8D5A4402, 0x8D5A8402, 0x8D5AC402, 0x80001C82, 0x80001CA2, 0x80001CC2, 0xC1168402, 0xC0A80402,
+		0x8D49C402, 0x8D4A0402, 0x8D4A4402, 0x8D4A8402, 0x8D4AC402, 0x8D4B0402, 0x8D4B4402, 0x8D4B8402,
+		0x8D4BC402, 0x8D4C0402, 0x8D4C4402, 0x8D4C8402, 0x8D4CC402, 0x8D4D0402, 0x8D4D4402, 0x8D4D8402,
+		0x8D4DC402, 0x8D4E0402, 0x8D4E4402, 0x8D4E8402, 0x8D4EC402, 0x8D4F0402, 0x8D4F4402, 0x8D4F8402,
+		0x8D4FC402, 0x8D500402, 0x8D504402, 0x8D508402, 0x8D50C402, 0x8D510402, 0x8D514402, 0x8D518402,
+		0x8D51C402, 0x8D520402, 0x8D524402, 0x8D528402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xC0B84402,
+		0x90750402, 0x90754402, 0x90758402, 0x9075C402, 0x90760402, 0x90764402, 0x90768402, 0x9076C402,
+		0x90770402, 0x90774402, 0x90778402, 0x9077C402, 0x90780402, 0x90784402, 0x90788402, 0x9078C402,
+		0x90790402, 0x90794402, 0x90798402, 0x9079C402, 0x907A0402, 0x907A4402, 0x907A8402, 0x907AC402,
+		0x907B0402, 0x907B4402, 0x907B8402, 0x907BC402, 0x907C0402, 0x00000000, 0x00000000, 0x00000000,
+		0x80001862, 0x80001882, 0x80001942, 0x800018A2, 0x8DFF0402, 0x8DFF4402, 0x8DFF8402, 0x8DFFC402,
+		0x8E000402, 0x8E004402, 0x8E008402, 0x8E00C402, 0x8E010402, 0x8E014402, 0x8E018402, 0x8E01C402,
+		0x8E020402, 0x8E024402, 0x8E028402, 0x8E02C402, 0x8E030402, 0x8E034402, 0x8E038402, 0x8E03C402,
+		0x8E040402, 0x8E044402, 0x8E048402, 0x8E04C402, 0x8E050402, 0x8E054402, 0x8E058402, 0x8E05C402,
+		0x8E060402, 0x8E064402, 0x8E068402, 0x8E06C402, 0x8E070402, 0x8E074402, 0x8E078402, 0x8E07C402,
+		0x8E080402, 0x8E084402, 0x8E088402, 0x8E090402, 0x8E090404, 0x8E098402, 0x8E09C402, 0x8E0A0402,
+		0x8E0A4402, 0x8E0A8402, 0x8E0AC402, 0x80001842, 0x8E0B0402, 0x8E0B0404, 0x8E0B8402, 0x8E0BC402,
+		0x8E0C0402, 0x8E0C4402, 0x8E0CC402, 0x8E0D0402, 0x8E0B4402, 0x8E0C8402, 0x8E08C402, 0x8E094402,
+		0x8E0D4402, 0xC0B58402, 0xC0B5C402, 0xC0B60402, 0xC0B64402, 0xC0B68402, 0xC0B6C402, 0xC0988402,
+		0xC0AAC402, 0xC0AB0402, 0xC0B70402, 0xC0B74402, 0xC0B78402, 0xC0B7C402, 0x00000000, 0x87D34402,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xC116C402, 0xC1170402,
+		0x8D5D4402, 0x8D5F4402, 0x8D61C402, 0x8D674402, 0x8D6D8402, 0x8D800402, 0x87D38402, 0x8D63C402,
+		0x8D6C4402, 0x8D5CC402, 0x8D5D8402, 0x8D608402, 0x8D624402, 0x8D65C402, 0x8D668402, 0x8D678402,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0x8D748402, 0x8D68C402, 0x8D698402, 0x8D6D0402, 0x8D6DC402, 0x00000000,
+		0x8DDC4402, 0x8DDC8402, 0x8DDCC402, 0x8DDD0402, 0x8DDD4402, 0x8DDD8402, 0x8DDDC402, 0x8DDE0402,
+		0x8DDE4402, 0x8DDE8402, 0x8DDEC402, 0x8DDF0402, 0x8DDF4402, 0x8DDF8402, 0x8DDFC402, 0x8DE00402,
+		0x8DE04402, 0x8DE08402, 0x8DE0C402, 0x8DE10402, 0x8DE14402, 0x8DE18402, 0x8DE1C402, 0x8DE20402,
+		0x8DE24402, 0x8DE28402, 0x8DE2C402, 0x8DE30402, 0x8DE34402, 0x8DE38402, 0x8DE3C402, 0x8DE40402,
+		0x8DE44402, 0x8DE48402, 0x8DE4C402, 0x8DE50402, 0x8DE54402, 0x8DE58402, 0x8DE5C402, 0x8DE60402,
+		0x8DE64402, 0x8DE78402, 0x8DE7C402, 0x8DE80402, 0x8DE84402, 0x8DE88402, 0x8DE8C402, 0x8DE90402,
+		0x8DE94402, 0x8DE98402, 0x8DE9C402, 0x8DE68402, 0x8DE6C402, 0x8DE70402, 0x8DE74402, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8DEA0402, 0x8DEA4402, 0x8DEA8402, 0x8DEAC402, 0x8DEB0402, 0x8DEB4402, 0x8DEB8402, 0x8DEBC402,
+		0x8DEC0402, 0x8DEC4402, 0x8DEC8402, 0x8DECC402, 0x8DED0402, 0x8DED4402, 0x00000000, 0x00000000,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0x00000000, 0x00000000, 0xC1174402, 0xC0AB4402, 0xC0AB8402, 0xC0ABC402,
+		0x8D5C8402, 0x8D5EC402, 0x8D5F8402, 0x8D604402, 0x8D620402, 0x8D638402, 0x8D648402, 0x8D650402,
+		0x8D658402, 0x8D664402, 0x8D694402, 0x8D6A4402, 0x8D728402, 0x8D734402, 0x8D73C402, 0x8D6BC402,
+		0x87D3C402, 0x8D740402, 0x8D610402, 0x8D6F4402, 0x8D860402, 0x8D864402, 0x8D868402, 0xC166C402,
+		0xC1670402, 0xC1674402, 0x8D6F8402, 0x8D854402, 0x8D858402, 0x8D85C402, 0x8D5FC402, 0x8D62C402,
+		0x8CA58402, 0x8CA5C402, 0x8CA60402, 0x8CA64402, 0x8CA68402, 0x8CA6C402, 0x8CA70402, 0x8CA74402,
+		0x8CA78402, 0x8CA7C402, 0x8CA80402, 0x8CA84402, 0x8CA88402, 0x8CA8C402, 0x8CA90402, 0x8CA94402,
+		0x8CA98402, 0x8CA9C402, 0x8CAA0402, 0x8CAA4402, 0x8CAA8402, 0x8CAAC402, 0x8CAB0402, 0x8CAB4402,
+		0x8CAB8402, 0x8CABC402, 0x8CAC0402, 0x8CAC4402, 0x8CAC8402, 0x8CACC402, 0x8CAD0402, 0x8CAD4402,
+		0x8CAD8402, 0x8CADC402, 0x8CAE0402, 0x8CAE4402, 0x8CAE8402, 0x8CAEC402, 0x8CAF0402, 0x8CAF4402,
+		0x8CAF8402, 0x8CAFC402, 0x8CB00402, 0x8CB04402, 0x8CB08402, 0x8CB0C402, 0x8CB10402, 0x8CB14402,
+		0x8CB18402, 0x8CB1C402, 0x8CB20402, 0x8CB24402, 0x8CB28402, 0x000066A1, 0x000189A1, 0x8CB34402,
+		0x8CB38402, 0x000479E1, 0x8CB40402, 0x0000AAA1, 0x000274E1, 0x8CB4C402, 0x8CB50402, 0x80001C22,
+		0x8CB54402, 0x80001C42, 0x8CB58402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x8CB5C402, 0x8CB60402, 0x87D40402, 0xC1038402, 0xC103C402,
+		0x8B2E4402, 0x8B2E8402, 0x8B2EC402, 0x8B2F0402, 0x8B2F4402, 0x8B2F8402, 0x8B2FC402, 0x8B300402,
+		0x8B304402, 0x8B308402, 0x8B30C402, 0x8B330402, 0x8B334402, 0x8B338402, 0x8B33C402, 0x8B340402,
+		0xC0AC0402, 0xC09E4402, 0x8B274402, 0x87D44402, 0x87D48402, 0x8B344402, 0x8B36C402, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x8A148402, 0x8A14C402, 0x8A150402, 0x8A154402, 0x8A158402, 0x8A15C402, 0x00000000,
+		0x00000000, 0x8A464402, 0x8A468402, 0x8A46C402, 0x8A470402, 0x8A474402, 0x8A478402, 0x00000000,
+		0x00000000, 0x8A3E8402, 0x8A3EC402, 0x8A3F0402, 0x8A3F4402, 0x8A3F8402, 0x8A3FC402, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8A570402, 0x8A574402, 0x8A578402, 0x8A57C402, 0x8A580402, 0x8A584402, 0x8A588402, 0x00000000,
+		0x8A5D0402, 0x8A5D4402, 0x8A5D8402, 0x8A5DC402, 0x8A5E0402, 0x8A5E4402, 0x8A5E8402, 0x00000000,
+		0x87ED4402, 0x87EB0402, 0x88030402, 0x88034402, 0x8804C402, 0x8811C402, 0x88164402, 0x883C0402,
+		0x883A8402, 0x883AC402, 0x88450402, 0x884D4402, 0x884EC402, 0x88508402, 0x88538402, 0x88554402,
+		0x88528402, 0x88520402, 0x88524402, 0x8852C402, 0x88530402, 0x8865C402, 0x88670402, 0x88714402,
+		0x88718402, 0x886EC402, 0x8871C402, 0x88720402, 0x88724402, 0x887A0402, 0x88870402, 0x88898402,
+		0x88880402, 0x88884402, 0x888A8402, 0x889B4402, 0x889B8402, 0x889BC402, 0x889A4402, 0x889A8402,
+		0x889AC402, 0x889B0402, 0x88A04402, 0xC14A4402, 0x88224414, 0x883C0414, 0x88398414, 0x888A8414,
+		0x88B00402, 0x88B04402, 0x8855C402, 0x88B08402, 0x87EEC402, 0x88D1C402, 0x0000C642, 0x0003FF02,
+		0x88738402, 0x88980414, 0xC1368402, 0xC136C402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8E378402, 0x8E37C402, 0x8E380402, 0x8E384402, 0x8E388402, 0x8E38C402, 0x8E390402, 0x8E394402,
+		0x8E398402, 0x8E39C402, 0x8E3A0402, 0x8E3A4402, 0x8E3A8402, 0x8E3AC402, 0x8E3B0402, 0x8E3B4402,
+		0x8E3B8402, 0x8E3BC402, 0x8E3C0402, 0x8E3C4402, 0x8E3C8402, 0x8E3CC402, 0x8E3D0402, 0x8E3D4402,
+		0x8E3D8402, 0x8E3DC402, 0x8E3E0402, 0x8E3E4402, 0x8E3E8402, 0x8E3EC402, 0x8E3F0402, 0x8E3F4402,
+		0x8E3F8402, 0x8E3FC402, 0x8E400402, 0x8E404402, 0x8E408402, 0x8E40C402, 0x8E410402, 0x8E414402,
+		0x8E418402, 0x8E41C402, 0x8E420402, 0x8E424402, 0x8E428402, 0x8E42C402, 0x8E430402, 0x8E434402,
+		0x8E438402, 0x8E43C402, 0x8E440402, 0x8E444402, 0x8E448402, 0x8E44C402, 0x8E450402, 0x8E454402,
+		0x8E458402, 0x8E45C402, 0x8E460402, 0x8E464402, 0x8E468402, 0x8E46C402, 0x8E470402, 0x8E474402,
+		0x8E478402, 0x8E47C402, 0x8E480402, 0x8E484402, 0x8E488402, 0x8E48C402, 0x8E490402, 0x8E494402,
+		0x8E498402, 0x8E49C402, 0x8E4A0402, 0x8E4A4402, 0x8E4A8402, 0x8E4AC402, 0x8E4B0402, 0x8E4B4402,
+		0x8B278402, 0x8B27C402, 0x8B280402, 0x8B284402, 0x8B288402, 0x8B28C402, 0x8B290402, 0x8B294402,
+		0x8B298402, 0x8B29C402, 0x8B2A0402, 0x8B2A4402, 0x8B2A8402, 0x8B2AC402, 0x8B2B0402, 0x8B2B4402,
+		0x8B2B8402, 0x8B2BC402, 0x8B2C0402, 0x8B2C4402, 0x8B2C8402, 0x8B2CC402, 0x8B2D0402, 0x8B2D4402,
+		0x8B2D8402, 0x8B2DC402, 0x8B2E0402, 0x8B348402, 0x8B34C402, 0x8B350402, 0x8B354402, 0x8B358402,
+		0x8B35C402, 0x8B360402, 0x8B364402, 0x8B310402, 0x8B314402, 0x8B318402, 0x8B31C402, 0x8B320402,
+		0x8B324402, 0x8B328402, 0x8B32C402, 0xC0AC4402, 0x80001982, 0x8B368402, 0x00000000, 0x00000000,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x908E8402, 0x908EC402, 0x908F0402, 0x908F4402, 0x908F8402, 0x908FC402, 0x90900402, 0x90904402,
+		0x90908402, 0x9090C402, 0x90910402, 0x90914402, 0x90918402, 0x9091C402, 0x90920402, 0x90924402,
+		0x90928402, 0x9092C402, 0x90930402, 0x90934402, 0x90938402, 0x9093C402, 0x90940402, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x90AA4402, 0x90AA8402, 0x90AAC402, 0x90AB0402, 0x90AB4402,
+		0x90AB8402, 0x90ABC402, 0x90AC0402, 0x90AC4402, 0x90AC8402, 0x90ACC402, 0x90AD0402, 0x90AD4402,
+		0x90AD8402, 0x90ADC402, 0x90AE0402, 0x90AE4402, 0x90AE8402, 0x90AEC402, 0x90AF0402, 0x90AF4402,
+		0x90AF8402, 0x90AFC402, 0x90B00402, 0x90B04402, 0x90B08402, 0x90B0C402, 0x90B10402, 0x90B14402,
+		0x90B18402, 0x90B1C402, 0x90B20402, 0x90B24402, 0x90B28402, 0x90B2C402, 0x90B30402, 0x90B34402,
+		0x90B38402, 0x90B3C402, 0x90B40402, 0x90B44402, 0x90B48402, 0x90B4C402, 0x90B50402, 0x90B54402,
+		0x90B58402, 0x90B5C402, 0x90B60402, 0x90B64402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0003AF02, 0x0003B582,
+		0x00000000, 0x00013902, 0x00000000, 0x00034CC2, 0x0000B102, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00030402,
+		0x00000000, 0x00025402, 0x00000000, 0x0002AA82, 0x00009242, 0x00000000, 0x00000000, 0x00043D02,
+		0x00003F82, 0x00031082, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00012382, 0x00021502, 0x0003C302, 0x00027183, 0x00005B43, 0x00018F43, 0x00006282, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00044742, 0x000234C2, 0x000107C2, 0x00021A02, 0x0002A082,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80000C22, 0x00000000,
+		0x898B4405, 0x89878405, 0x89884405, 0x89888405, 0x898A0405, 0x898A4405, 0x898A8405, 0x898C4405,
+		0x898CC405, 0xC1998405, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000414C2,
+		0x899A041A, 0x899A0419, 0x899D441A, 0x899D4419, 0x899D4417, 0x899D4418, 0x899D841A, 0x899D8419,
+		0x899D8417, 0x899D8418, 0x899DC41A, 0x899DC419, 0x899DC417, 0x899DC418, 0x89A2041A, 0x89A20419,
+		0x89A20417, 0x89A20418, 0x89A2C41A, 0x89A2C419, 0x89A2C417, 0x89A2C418, 0x89A1C41A, 0x89A1C419,
+		0x89A1C417, 0x89A1C418, 0x89BA441A, 0x89BA4419, 0x89BA4417, 0x89BA4418, 0x89BB041A, 0x89BB0419,
+		0x89BB0417, 0x89BB0418, 0x89A4441A, 0x89A44419, 0x89A44417, 0x89A44418, 0x89A4041A, 0x89A40419,
+		0x89A40417, 0x89A40418, 0x89A4841A, 0x89A48419, 0x89A48417, 0x89A48418, 0x89A5041A, 0x89A50419,
+		0x89A50417, 0x89A50418, 0x89AAC41A, 0x89AAC419, 0x89AA841A, 0x89AA8419, 0x89AB441A, 0x89AB4419,
+		0x89A9841A, 0x89A98419, 0x89AF041A, 0x89AF0419, 0x89AD441A, 0x89AD4419, 0x89BDC41A, 0x89BDC419,
+		0x89BDC417, 0x89BDC418, 0x89BFC41A, 0x89BFC419, 0x89BFC417, 0x89BFC418, 0x89C1041A, 0x89C10419,
+		0x89C10417, 0x89C10418, 0x89C0841A, 0x89C08419, 0x89C08417, 0x89C08418, 0x89C6441A, 0x89C64419,
+		0x89C6C41A, 0x89C6C419, 0x89C6C417, 0x89C6C418, 0x0001AEC2, 0x00007E02, 0x89C9041A, 0x89C90419,
+		0x89C90417, 0x89C90418, 0x89C8C41A, 0x89C8C419, 0x89C8C417, 0x89C8C418, 0x89D1441A, 0x89D14419,
+		0x00038D02, 0x00048542, 0xC14D8402, 0xC14DC402, 0xC14E0402, 0xC14E4402, 0xC14E8402, 0xC14EC402,
+		0xC14F0402, 0xC14F4402, 0xC14F8402, 0xC14FC402, 0xC1500402, 0xC1504402, 0xC1508402, 0xC150C402,
+		0xC1510402, 0xC1514402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x89BF041A, 0x89BF0419, 0x89BF0417, 0x89BF0418, 0x89CB041A,
+		0x89CB0419, 0x89CAC41A, 0x89CAC419, 0x89CB441A, 0x89CB4419, 0x00013542, 0x89CC041A, 0x89CC0419,
+		0x89CA841A, 0x89CA8419, 0x89CB841A, 0x89CB8419, 0x89CEC41A, 0x89CEC419, 0x89CEC417, 0x89CEC418,
+		0x89CD8417, 0x89CD8418, 0x00001C02, 0x00036342, 0x00005242, 0x000167C2, 0x00014482, 0x00013802,
+		0x00048AC2, 0x00036CC2, 0x00000402, 0x00016982, 0x00041802, 0x0002DF82, 0x000420C2, 0x0000A1C2,
+		0x0003C382, 0x0001CEC2, 0x00008342, 0x00033082, 0x89CE041A, 0x89CE0419, 0x89CE0417, 0x89CE0418,
+		0x0003B902, 0x00029602, 0x0000F182, 0x00023882, 0x00045442, 0x00031A82, 0x00047642, 0x00005E82,
+		0x0004A582, 0x00018882, 0x0000E642, 0x0002F2C2, 0x00011242, 0x0001D402, 0x0001F882, 0x0001EF02,
+		0x000306C2, 0x00047242, 0x0001A442, 0x00008B02, 0x000298C2, 0x0003CF42, 0x00028F02, 0x00022D82,
+		0x0002F242, 0x00010A02, 0x00016682, 0x0004A502, 0x0001B842, 0x00002402, 0x00004B82, 0x000043C2,
+		0x0002F1C2, 0x0003EFC2, 0x0001F9C2, 0x0000A142, 0x000347C2, 0x00047D02, 0x00036A82, 0x00016902,
+		0x00030502, 0x00003002, 0x000231C2, 0x0003B882, 0x0001CF42, 0x000117C2, 0x0000F302, 0x0000E6C2,
+		0x00008A82, 0x00017FC2, 0x000452C2, 0x00030742, 0x0000EF02, 0x00021FC2, 0x0000FC82, 0x0003BB42,
+		0x0000A542, 0x00028A82, 0x00048C02, 0x00014642, 0x00043902, 0x000372C2, 0x00034602, 0x00034F42,
+		0x00029D82, 0x00039482, 0x000239C2, 0x0000F202, 0x000308C2, 0x00043A42, 0x00031182, 0x0001AA42,
+		0x000343C2, 0x00007382, 0x0001DC42, 0x0003FD02, 0x00022402, 0x0000C082, 0x0000A242, 0x0000A7C2,
+		0x00033482, 0x00043542, 0x0001A742, 0x000056C2, 0x00026E42, 0x00039982, 0x00027682, 0x00023E42,
+		0x0002AF02, 0x00010C02, 0x00014F42, 0x00048EC2, 0x00018EC2, 0x00002B82, 0x00000002, 0x00000882,
+		0x0001FD42, 0x0000BF82, 0x0002EEC2, 0x0003F882, 0x00014FC2, 0x00001482, 0x00014382, 0x00038E42,
+		0x0001A102, 0x0004BDC2, 0x00026F42, 0x0000F842, 0x0002CB02, 0x0003D442, 0x0003B1C2, 0x0003A3C2,
+		0x000241C2, 0x00010142, 0x00029942, 0x0003B042, 0x0001A4C2, 0x00006A42, 0x00018602, 0x00033182,
+		0x000147C2, 0x00046202, 0x0002B642, 0x0000A442, 0x00028402, 0x00041F02, 0x0003F782, 0x00040502,
+		0x000012C2, 0x00016182, 0x00048042, 0x00037A82, 0x0000CCC2, 0x0001FDC2, 0x0000D402, 0x0003DCC2,
+		0x000111C2, 0x0002B542, 0x00046502, 0x0001B742, 0x0004A602, 0x0002FFC2, 0x00032042, 0x00032CC2,
+		0x00045DC2, 0x00031602, 0x00009642, 0x00019702, 0x0003AE82, 0x00027442, 0x00039FC2, 0x000131C2,
+		0x00040402, 0x00025D42, 0x00000D82, 0x000350C2, 0x000066C2, 0x000175C2, 0x00015582, 0x00014742,
+		0x0002A842, 0x00039EC2, 0x00024B02, 0x0000EAC2, 0x0002FDC2, 0x00043002, 0x00031782, 0x0001B4C2,
+		0x00034AC2, 0x00007C82, 0x0001E702, 0x00040D82, 0x00021782, 0x0000CD42, 0x0000AA02, 0x00009F82,
+		0x00014982, 0x00002842, 0x00034742, 0x0004AD42, 0x0001FA42, 0x0000D382, 0x00020502, 0x0002B002,
+		0x000242C2, 0x0003E742, 0x00032E42, 0x00008642, 0x00037882, 0x00043302, 0x00045782, 0x00045F02,
+		0x0002CC82, 0x00041602, 0x0001D682, 0x0000C6C2, 0x00036F42, 0x0004A482, 0x00038982, 0x00013F42,
+		0x00032D42, 0x00000E82, 0x00025A02, 0x0003D4C2, 0x0001EE82, 0x0000F482, 0x000121C2, 0x000112C2,
+		0x000090C2, 0x00018782, 0x00046102, 0x0002FD42, 0x0000E802, 0x00021A82, 0x00010902, 0x0003C5C2,
+		0x0000B082, 0x00029302, 0x00049142, 0x00015502, 0x00043082, 0x00037A02, 0x00035182, 0x000344C2,
+		0x000067C2, 0x0001ABC2, 0x00042E82, 0x00032342, 0x00011E42, 0x00024442, 0x00012B02, 0x00039402,
+		0x0000C182, 0x00026282, 0x0004B542, 0x00016C82, 0x00046082, 0x00034342, 0x00036D42, 0x00037802,
+		0x00004C82, 0x000141C2, 0x0004A682, 0x00034202, 0x0000A3C2, 0x0001C902, 0x0000C002, 0x00041B42,
+		0x0000F002, 0x0002DB02, 0x00044A42, 0x0001A542, 0x00047FC2, 0x00032502, 0x00030482, 0x0002F742,
+		0x00020842, 0x0000A342, 0x0002D642, 0x0003ECC2, 0x00014302, 0x00000A82, 0x00015042, 0x00037482,
+		0x000180C2, 0x00049C82, 0x00027602, 0x000101C2, 0x0002C042, 0x0003BBC2, 0x00039382, 0x00039902,
+		0x000027C2, 0x00014842, 0x0004B802, 0x00036B02, 0x0000BC82, 0x0001E782, 0x0000A0C2, 0x00042042,
+		0x00010242, 0x0002EAC2, 0x00042F02, 0x00018142, 0x00049582, 0x00033282, 0x00031102, 0x00031682,
+		0x000102C2, 0x00024242, 0x00039042, 0x00028E82, 0x00008102, 0x0001AD02, 0x00008B82, 0x00043402,
+		0x000028C2, 0x0002F6C2, 0x00042582, 0x000208C2, 0x0003C842, 0x0002B242, 0x0002D2C2, 0x0002DDC2,
+		0x00036102, 0x0004A702, 0x00014402, 0x00002E82, 0x0002D6C2, 0x00041542, 0x0002EE42, 0x0001D1C2,
+		0x00029482, 0x0000B182, 0x0001C182, 0x000472C2, 0x00016082, 0x00005C82, 0xC0E48402, 0xC0E4C402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00002143, 0x00016843, 0x00048383, 0x00036FC3, 0x0000C803, 0x0001ECC3, 0x0000E403, 0x0003F343,
+		0x00011BC3, 0x0002BA03, 0x00047743, 0x0001C683, 0x0004A303, 0x00030243, 0x000323C3, 0x00031B03,
+		0x00039703, 0x00029FC3, 0x0000FB43, 0x00025A83, 0x000474C3, 0x00033843, 0x00045643, 0x000064C3,
+		0x0004B143, 0x000191C3, 0x0000C743, 0x0002D743, 0x00013083, 0x0001DA03, 0x000201C3, 0x00020E43,
+		0x0003EE43, 0x0002F043, 0x0000BD03, 0x00020583, 0x0004B883, 0x00037D83, 0x0004ADC3, 0x00002643,
+		0x00046F83, 0x00015603, 0x00012043, 0x00029683, 0x0000DC43, 0x00023003, 0x00025C83, 0x00025203,
+		0x00033703, 0x00043683, 0x0001B303, 0x00005503, 0x00026403, 0x000397C3, 0x00028203, 0x000247C3,
+		0x0002BF83, 0x00012103, 0x00015183, 0x000494C3, 0x000181C3, 0x000033C3, 0x00001043, 0x00000103,
+		0x00000000, 0x00000000, 0x00035403, 0x0004BBC3, 0x00021003, 0x0000E0C3, 0x0001F143, 0x0002C943,
+		0x000252C3, 0x0003F543, 0x000320C3, 0x000075C3, 0x00038BC3, 0x00043E03, 0x000463C3, 0x00047043,
+		0x0000B803, 0x0001F203, 0x0003DB83, 0x0002DC03, 0x00003303, 0x000165C3, 0x00004043, 0x00047F03,
+		0x00007243, 0x00034043, 0x0003D143, 0x00025743, 0x00041C83, 0x000264C3, 0x00028703, 0x00028F83,
+		0x00047183, 0x00030603, 0x00008043, 0x00018543, 0x00039243, 0x00026683, 0x0003AF83, 0x00011A43,
+		0x0003EF03, 0x00024E03, 0x00001E83, 0x00036203, 0x00004F03, 0x00016B43, 0x00014083, 0x00013A83,
+		0x000125C3, 0x00021643, 0x0003C103, 0x00026FC3, 0x00005943, 0x00018C83, 0x000060C3, 0x00045083,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00030EC3, 0x000454C3, 0x00018284, 0x00007D04, 0x00029504, 0x0003C6C4, 0x0002A104, 0x00021B04,
+		0x0002D4C4, 0x0000EA03, 0x00016D12, 0x0004B948, 0x0001B204, 0xC14D4402, 0x00000000, 0x00000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0xC088C416, 0xC08D8416, 0xC0A48416, 0xC0900416, 0xC08E8416, 0xC099C416, 0xC09B4416, 0xC0E30416,
+		0xC0E34416, 0x00045D03, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x800009E2, 0x80000000, 0x800009C2, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000682,
+		0x80000000, 0x800009C2, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000A02, 0x80000000,
+		0x00039502, 0xC0858416, 0xC0854416, 0xC082C416, 0xC082C416, 0xC0CA0416, 0xC0CA4416, 0xC0CB0416,
+		0xC0CB4416, 0xC0E28416, 0xC0E2C416, 0xC0E20416, 0xC0E24416, 0xC0E08416, 0xC0E0C416, 0xC0E00416,
+		0xC0E04416, 0xC0E10416, 0xC0E14416, 0xC0E18416, 0xC0E1C416, 0xC08DC402, 0xC08E0402, 0xC0CA8416,
+		0xC0CAC416, 0xC0828404, 0xC0828404, 0xC0828404, 0xC0828404, 0xC082C404, 0xC082C404, 0xC082C404,
+		0xC088C40F, 0xC08D840F, 0xC09F840F, 0x00000000, 0xC08E840F, 0xC090040F, 0xC09B440F, 0xC099C40F,
+		0xC085840F, 0xC0CA040F, 0xC0CA440F, 0xC0CB040F, 0xC0CB440F, 0xC0E2840F, 0xC0E2C40F, 0xC0EB040F,
+		0xC0EA440F, 0xC0E8440F, 0xC199840F, 0xC083440F, 0xC19A840F, 0xC19B040F, 0xC19AC40F, 0x00000000,
+		0xC0E9C40F, 0x87D9040F, 0xC0EB440F, 0xC0E8040F, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x80000DBA, 0x80000DB8, 0x80000E1A, 0x80000000, 0x80000E7A, 0x00000000, 0x80000EDA, 0x80000ED8,
+		0x80000F5A, 0x80000F58, 0x80000FBA, 0x80000FB8, 0x8000101A, 0x80001018, 0x8000103A, 0x80001038,
+		0x8999041A, 0x8999441A, 0x89994419, 0x8999841A, 0x89998419, 0x899A441A, 0x899A4419, 0x899A841A,
+		0x899A8419, 0x899B841A, 0x899B8419, 0x899B8417, 0x899B8418, 0x899C841A, 0x899C8419, 0x899D041A,
+		0x899D0419, 0x899D0417, 0x899D0418, 0x89A1041A, 0x89A10419, 0x89A1441A, 0x89A14419, 0x89A14417,
+		0x89A14418, 0x89A1841A, 0x89A18419, 0x89A18417, 0x89A18418, 0x89A3C41A, 0x89A3C419, 0x89A3C417,
+		0x89A3C418, 0x89A6441A, 0x89A64419, 0x89A64417, 0x89A64418, 0x89A6841A, 0x89A68419, 0x89A68417,
+		0x89A68418, 0x89A9041A, 0x89A90419, 0x89A9441A, 0x89A94419, 0x89ACC41A, 0x89ACC419, 0x89AD041A,
+		0x89AD0419, 0x89B1841A, 0x89B18419, 0x89B18417, 0x89B18418, 0x89B1C41A, 0x89B1C419, 0x89B1C417,
+		0x89B1C418, 0x89B4441A, 0x89B44419, 0x89B44417, 0x89B44418, 0x89B4841A, 0x89B48419, 0x89B48417,
+		0x89B48418, 0x89B5C41A, 0x89B5C419, 0x89B5C417, 0x89B5C418, 0x89B6041A, 0x89B60419, 0x89B60417,
+		0x89B60418, 0x89B6C41A, 0x89B6C419, 0x89B6C417, 0x89B6C418, 0x89B7041A, 0x89B70419, 0x89B70417,
+		0x89B70418, 0x89B9041A, 0x89B90419, 0x89B90417, 0x89B90418, 0x89BC041A, 0x89BC0419, 0x89BC0417,
+		0x89BC0418, 0x89BD841A, 0x89BD8419, 0x89BD8417, 0x89BD8418, 0x89C3041A, 0x89C30419, 0x89C30417,
+		0x89C30418, 0x89C5041A, 0x89C50419, 0x89C50417, 0x89C50418, 0x89C6041A, 0x89C60419, 0x89C60417,
+		0x89C60418, 0x89C8841A, 0x89C88419, 0x89C88417, 0x89C88418, 0x89CA041A, 0x89CA0419, 0x89CD841A,
+		0x89CD8419, 0x89CDC41A, 0x89CDC419, 0x89CDC417, 0x89CDC418, 0x00038342, 0x0004A782, 0x00001F42,
+		0x00047802, 0x00015AC2, 0x00011B02, 0x00029042, 0x0000D842, 0x00000000, 0x00000000, 0x80000000,
+		0x00000000, 0xC099C403, 0xC0C74403, 0xC0EB0403, 0x87D90403, 0xC0EB4403, 0xC0EA4403, 0xC0C58403,
+		0xC0CA0403, 0xC0CA4403, 0xC0E84403, 0xC1998403, 0xC088C403, 0xC0834403, 0xC09F8403, 0xC0E98403,
+		0x87E60403, 0x87E64403, 0x87E68403, 0x87E6C403, 0x87E70403, 0x87E74403, 0x87E78403, 0x87E7C403,
+		0x87E80403, 0x87E84403, 0xC0900403, 0xC08E8403, 0xC19A8403, 0xC19AC403, 0xC19B0403, 0xC09B4403,
+		0xC0E80403, 0x87E88409, 0x87EF0409, 0x87F58409, 0x87FAC409, 0x8801C409, 0x88108409, 0x88144409,
+		0x881D4409, 0x88240409, 0x882AC409, 0x88310409, 0x88358409, 0x88424409, 0x88460409, 0x884F0409,
+		0x885AC409, 0x88600409, 0x8864C409, 0x88748409, 0x887DC409, 0x8885C409, 0x8891C409, 0x88964409,
+		0x88990409, 0x889C0409, 0x88A18409, 0xC0CA8403, 0xC0E9C403, 0xC0CAC403, 0xC12DC403, 0xC082C403,
+		0xC12D0403, 0x87E88403, 0x87EF0403, 0x87F58403, 0x87FAC403, 0x8801C403, 0x88108403, 0x88144403,
+		0x881D4403, 0x88240403, 0x882AC403, 0x88310403, 0x88358403, 0x88424403, 0x88460403, 0x884F0403,
+		0x885AC403, 0x88600403, 0x8864C403, 0x88748403, 0x887DC403, 0x8885C403, 0x8891C403, 0x88964403,
+		0x88990403, 0x889C0403, 0x88A18403, 0xC0CB0403, 0xC19B8403, 0xC0CB4403, 0xC19C0403, 0xC0CF8403,
+		0xC0CFC403, 0xC0A48412, 0xC0E10412, 0xC0E14412, 0xC08D8412, 0xC0884412, 0x90C24412, 0x90B68410,
+		0x90B6C410, 0x90B70410, 0x90B78410, 0x90B7C410, 0x90BF8410, 0x90BFC410, 0x90C00410, 0x90BB0410,
+		0x87D80412, 0x90B68412, 0x90B6C412, 0x90B70412, 0x90B78412, 0x90B7C412, 0x90B80412, 0x90B84412,
+		0x90B88412, 0x90B8C412, 0x90B90412, 0x90B94412, 0x90B98412, 0x90B9C412, 0x90BA0412, 0x90BA4412,
+		0x90BA8412, 0x90BAC412, 0x90BB0412, 0x90BB4412, 0x90BB8412, 0x90BBC412, 0x90BC0412, 0x90BC4412,
+		0x90BC8412, 0x90BCC412, 0x90BD0412, 0x90BD4412, 0x90BD8412, 0x90BDC412, 0x90BE0412, 0x90BE4412,
+		0x90BE8412, 0x90BEC412, 0x90BF0412, 0x90BF4412, 0x90BF8412, 0x90BFC412, 0x90C00412, 0x90C04412,
+		0x90C08412, 0x90C0C412, 0x90C10412, 0x90C14412, 0x90C18412, 0x90C28412, 0x800006F2, 0x80000712,
+		0x907C8412, 0x905D4412, 0x905D8412, 0x9094C412, 0x905DC412, 0x90954412, 0x90958412, 0x905E0412,
+		0x905E4412, 0x905E8412, 0x90964412, 0x90968412, 0x9096C412, 0x90970412, 0x90974412, 0x90978412,
+		0x9063C412, 0x905EC412, 0x905F0412, 0x905F4412, 0x90658412, 0x905F8412, 0x905FC412, 0x90600412,
+		0x90604412, 0x90608412, 0x9060C412, 0x90610412, 0x90614412, 0x90618412, 0x9061C412, 0x00000000,
+		0x00000000, 0x00000000, 0x907CC412, 0x907D0412, 0x907D4412, 0x907D8412, 0x907DC412, 0x907E0412,
+		0x00000000, 0x00000000, 0x907E4412, 0x907E8412, 0x907EC412, 0x907F0412, 0x907F4412, 0x907F8412,
+		0x00000000, 0x00000000, 0x907FC412, 0x90800412, 0x90804412, 0x90808412, 0x9080C412, 0x90810412,
+		0x00000000, 0x00000000, 0x90814412, 0x90818412, 0x9081C412, 0x00000000, 0x00000000, 0x00000000,
+		0x87D8C403, 0x87D94403, 0xC19B4403, 0xC12E0403, 0xC19BC403, 0x87D98403, 0x87E00403, 0x00000000,
+		0xC21AC412, 0xC17B0412, 0xC17B8412, 0xC17B4412, 0xC17BC412, 0xC2424412, 0xC24D0412, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x80000000, 0x80000000, 0x80000000, 0xC7554402, 0xBFFF4402, 0x00000000, 0x00000000,
+		0x933F0402, 0x933F4402, 0x933F8402, 0x933FC402, 0x93400402, 0x93404402, 0x93408402, 0x9340C402,
+		0x93410402, 0x93414402, 0x93418402, 0x9341C402, 0x00000000, 0x93420402, 0x93424402, 0x93428402,
+		0x9342C402, 0x93430402, 0x93434402, 0x93438402, 0x9343C402, 0x93440402, 0x93444402, 0x93448402,
+		0x9344C402, 0x93450402, 0x93454402, 0x93458402, 0x9345C402, 0x93460402, 0x93464402, 0x93468402,
+		0x9346C402, 0x93470402, 0x93474402, 0x93478402, 0x9347C402, 0x93480402, 0x93484402, 0x00000000,
+		0x93488402, 0x9348C402, 0x93490402, 0x93494402, 0x93498402, 0x9349C402, 0x934A0402, 0x934A4402,
+		0x934A8402, 0x934AC402, 0x934B0402, 0x934B4402, 0x934B8402, 0x934BC402, 0x934C0402, 0x934C4402,
+		0x934C8402, 0x934CC402, 0x934D0402, 0x00000000, 0x934D4402, 0x934D8402, 0x00000000, 0x934DC402,
+		0x934E0402, 0x934E4402, 0x934E8402, 0x934EC402, 0x934F0402, 0x934F4402, 0x934F8402, 0x934FC402,
+		0x93500402, 0x93504402, 0x93508402, 0x9350C402, 0x93510402, 0x93514402, 0x00000000, 0x00000000,
+		0x93518402, 0x9351C402, 0x93520402, 0x93524402, 0x93528402, 0x9352C402, 0x93530402, 0x93534402,
+		0x93538402, 0x9353C402, 0x93540402, 0x93544402, 0x93548402, 0x9354C402, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x93550402, 0x93554402, 0x93558402, 0x9355C402, 0x93560402, 0x93564402, 0x93568402, 0x9356C402,
+		0x93570402, 0x93574402, 0x93578402, 0x9357C402, 0x93580402, 0x93584402, 0x93588402, 0x9358C402,
+		0x93590402, 0x93594402, 0x93598402, 0x9359C402, 0x935A0402, 0x935A4402, 0x935A8402, 0x935AC402,
+		0x935B0402, 0x935B4402, 0x935B8402, 0x935BC402, 0x935C0402, 0x935C4402, 0x935C8402, 0x935CC402,
+		0x935D0402, 0x935D4402, 0x935D8402, 0x935DC402, 0x935E0402, 0x935E4402, 0x935E8402, 0x935EC402,
+		0x935F0402, 0x935F4402, 0x935F8402, 0x935FC402, 0x93600402, 0x93604402, 0x93608402, 0x9360C402,
+		0x93610402, 0x93614402, 0x93618402, 0x9361C402, 0x93620402, 0x93624402, 0x93628402, 0x9362C402,
+		0x93630402, 0x93634402, 0x93638402, 0x9363C402, 0x93640402, 0x93644402, 0x93648402, 0x9364C402,
+		0x93650402, 0x93654402, 0x93658402, 0x9365C402, 0x93660402, 0x93664402, 0x93668402, 0x9366C402,
+		0x93670402, 0x93674402, 0x93678402, 0x9367C402, 0x93680402, 0x93684402, 0x93688402, 0x9368C402,
+		0x93690402, 0x93694402, 0x93698402, 0x9369C402, 0x936A0402, 0x936A4402, 0x936A8402, 0x936AC402,
+		0x936B0402, 0x936B4402, 0x936B8402, 0x936BC402, 0x936C0402, 0x936C4402, 0x936C8402, 0x936CC402,
+		0x936D0402, 0x936D4402, 0x936D8402, 0x936DC402, 0x936E0402, 0x936E4402, 0x936E8402, 0x936EC402,
+		0x936F0402, 0x936F4402, 0x936F8402, 0x936FC402, 0x93700402, 0x93704402, 0x93708402, 0x9370C402,
+		0x93710402, 0x93714402, 0x93718402, 0x9371C402, 0x93720402, 0x93724402, 0x93728402, 0x9372C402,
+		0x93730402, 0x93734402, 0x93738402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xC0C2C402, 0xC0C30402, 0xC0C34402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x87E64402,
+		0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402, 0x87E80402, 0x87E84402,
+		0xC76F8402, 0xC76FC402, 0xC7700402, 0xC7704402, 0xC7708402, 0xC770C402, 0xC7710402, 0xC7714402,
+		0xC7718402, 0xC771C402, 0xC7720402, 0xC7724402, 0xC7728402, 0xC772C402, 0xC7730402, 0xC7734402,
+		0xC7738402, 0xC773C402, 0xC7740402, 0xC7744402, 0xC7748402, 0xC774C402, 0xC7750402, 0xC7754402,
+		0xC7758402, 0xC775C402, 0xC7760402, 0xC7764402, 0xC7768402, 0xC776C402, 0xC7770402, 0xC7774402,
+		0xC7778402, 0xC777C402, 0xC7780402, 0xC7784402, 0x00000000, 0x00000000, 0x00000000, 0xC4310402,
+		0xC4314402, 0xC4318402, 0xC431C402, 0xC4320402, 0xC4324402, 0xC4328402, 0xC432C402, 0xC4330402,
+		0xC7788402, 0xC778C402, 0x87E64402, 0x87E74402, 0xC7790402, 0xC7794402, 0xC7798402, 0xC779C402,
+		0x87E74402, 0xC77A0402, 0xC77A4402, 0xC77A8402, 0xC77AC402, 0xC77B0402, 0xC77B4402, 0x87E74402,
+		0xC77B8402, 0xC77BC402, 0xC77C0402, 0xC77C4402, 0xC77C8402, 0xC77CC402, 0xC77D0402, 0xC77D4402,
+		0x87E64402, 0x87E64402, 0x87E64402, 0x87E68402, 0x87E68402, 0x87E68402, 0x87E68402, 0x87E74402,
+		0xC77D8402, 0xC77DC402, 0xC77E0402, 0xC77E4402, 0xC77E8402, 0xC77EC402, 0xC77F0402, 0xC77F4402,
+		0xC77F8402, 0xC77FC402, 0xC7800402, 0xC7804402, 0xC7808402, 0xC780C402, 0xC7810402, 0xC7814402,
+		0xC7818402, 0xC781C402, 0xC7820402, 0x87E74402, 0xC7824402, 0xC7828402, 0xC782C402, 0xC7830402,
+		0xC7834402, 0xC4334402, 0xC4338402, 0xC433C402, 0xC4340402, 0xC4344402, 0xC4348402, 0xC434C402,
+		0xC4350402, 0xC4354402, 0xC4358402, 0xC435C402, 0xC4360402, 0xC4364402, 0xC4368402, 0xC436C402,
+		0xC4370402, 0xC4374402, 0x87E60402, 0xC7838402, 0xC4378402, 0xC437C402, 0xC4380402, 0x00000000,
+		0xC4384402, 0xC4388402, 0xC438C402, 0xC4390402, 0xC4394402, 0xC4398402, 0xC439C402, 0xC43A0402,
+		0xC43A4402, 0xC43A8402, 0xC43AC402, 0xC43B0402, 0xC43B4402, 0x00000000, 0x00000000, 0x00000000,
+		0xC43B8402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xC43BC402, 0xC43C0402, 0xC43C4402, 0xC43C8402, 0xC43CC402, 0xC43D0402, 0xC43D4402, 0xC43D8402,
+		0xC43DC402, 0xC43E0402, 0xC43E4402, 0xC43E8402, 0xC43EC402, 0xC43F0402, 0xC43F4402, 0xC43F8402,
+		0xC43FC402, 0xC4400402, 0xC4404402, 0xC4408402, 0xC440C402, 0xC4410402, 0xC4414402, 0xC4418402,
+		0xC441C402, 0xC4420402, 0xC4424402, 0xC4428402, 0xC442C402, 0xC4430402, 0xC4434402, 0xC4438402,
+		0xC443C402, 0xC4440402, 0xC4444402, 0xC4448402, 0xC444C402, 0xC4450402, 0xC4454402, 0xC4458402,
+		0xC445C402, 0xC4460402, 0xC4464402, 0xC4468402, 0xC446C402, 0x800022E2, 0x00000000, 0x00000000,
+		0x92B04402, 0x92B08402, 0x92B0C402, 0x92B10402, 0x92B14402, 0x92B18402, 0x92B1C402, 0x92B20402,
+		0x92B24402, 0x92B28402, 0x92B2C402, 0x92B30402, 0x92B34402, 0x92B38402, 0x92B3C402, 0x92B40402,
+		0x92B44402, 0x92B48402, 0x92B4C402, 0x92B50402, 0x92B54402, 0x92B58402, 0x92B5C402, 0x92B60402,
+		0x92B64402, 0x92B68402, 0x92B6C402, 0x92B70402, 0x92B74402, 0x00000000, 0x00000000, 0x00000000,
+		0x92B78402, 0x92B7C402, 0x92B80402, 0x92B84402, 0x92B88402, 0x92B8C402, 0x92B90402, 0x92B94402,
+		0x92B98402, 0x92B9C402, 0x92BA0402, 0x92BA4402, 0x92BA8402, 0x92BAC402, 0x92BB0402, 0x92BB4402,
+		0x92BB8402, 0x92BBC402, 0x92BC0402, 0x92BC4402, 0x92BC8402, 0x92BCC402, 0x92BD0402, 0x92BD4402,
+		0x92BD8402, 0x92BDC402, 0x92BE0402, 0x92BE4402, 0x92BE8402, 0x92BEC402, 0x92BF0402, 0x92BF4402,
+		0x92BF8402, 0x92BFC402, 0x92C00402, 0x92C04402, 0x92C08402, 0x92C0C402, 0x92C10402, 0x92C14402,
+		0x92C18402, 0x92C1C402, 0x92C20402, 0x92C24402, 0x92C28402, 0x92C2C402, 0x92C30402, 0x92C34402,
+		0x92C38402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x80000000, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0xC783C402, 0xC7840402, 0xC7844402, 0xC7848402, 0xC784C402, 0xC7850402,
+		0xC7854402, 0xC7858402, 0xC785C402, 0xC7860402, 0xC7864402, 0xC7868402, 0xC786C402, 0xC7870402,
+		0xC7874402, 0xC7878402, 0xC787C402, 0xC7880402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x92CA4402, 0x92CA8402, 0x92CAC402, 0x92CB0402, 0x92CB4402, 0x92CB8402, 0x92CBC402, 0x92CC0402,
+		0x92CC4402, 0x92CC8402, 0x92CCC402, 0x92CD0402, 0x92CD4402, 0x92CD8402, 0x92CDC402, 0x92CE4402,
+		0x92CE8402, 0x92CEC402, 0x92CF0402, 0x92CF4402, 0x92CF8402, 0x92CFC402, 0x92D00402, 0x92D04402,
+		0x92D08402, 0x92D0C402, 0x92D10402, 0x92D14402, 0x92D18402, 0x92D1C402, 0x92D20402, 0x92CE0402,
+		0x87E64402, 0x87E74402, 0xC76E0402, 0xC76E4402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x92D24402, 0x92D28402, 0x92D2C402,
+		0x92D30402, 0x92D34402, 0x92D38402, 0x92D3C402, 0x92D40402, 0x92D44402, 0x92D48402, 0x92D4C402,
+		0x92D50402, 0x92D54402, 0x92D58402, 0x92D5C402, 0x92D60402, 0x92D64402, 0x92D68402, 0x92D6C402,
+		0x92D70402, 0x92D74402, 0x92D78402, 0x92D7C402, 0x92D80402, 0x92D84402, 0x92D88402, 0x92D8C402,
+		0x92D90402, 0x92D94402, 0x92D98402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x895E4402, 0x895E8402, 0x895EC402, 0x895F0402, 0x895F4402, 0x895F8402, 0x895FC402, 0x89600402,
+		0x89604402, 0x89608402, 0x8960C402, 0x89610402, 0x89614402, 0x89618402, 0x8961C402, 0x89620402,
+		0x89624402, 0x89628402, 0x8962C402, 0x89630402, 0x89634402, 0x89638402, 0x8963C402, 0x89640402,
+		0x89644402, 0x89648402, 0x8964C402, 0x89650402, 0x89654402, 0x89658402, 0x8965C402, 0x89660402,
+		0x89664402, 0x89668402, 0x8966C402, 0x89670402, 0x89674402, 0x89678402, 0x895E4404, 0x895F0404,
+		0x89600404, 0x89618404, 0x89628404, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x943FC402, 0x94400402, 0x94404402, 0x94408402, 0x9440C402, 0x94410402, 0x94414402, 0x94418402,
+		0x9441C402, 0x94420402, 0x94424402, 0x94428402, 0x9442C402, 0x94430402, 0x94434402, 0x94438402,
+		0x9443C402, 0x94440402, 0x94444402, 0x94448402, 0x9444C402, 0x94450402, 0x94454402, 0x94458402,
+		0x9445C402, 0x94460402, 0x94464402, 0x94468402, 0x9446C402, 0x94470402, 0x00000000, 0xC0C38402,
+		0x94474402, 0x94478402, 0x9447C402, 0x94480402, 0x94484402, 0x94488402, 0x9448C402, 0x94490402,
+		0x94494402, 0x94498402, 0x9449C402, 0x944A0402, 0x944A4402, 0x944A8402, 0x944AC402, 0x944B0402,
+		0x944B4402, 0x944B8402, 0x944BC402, 0x944C0402, 0x944C4402, 0x944C8402, 0x944CC402, 0x944D0402,
+		0x944D4402, 0x944D8402, 0x944DC402, 0x944E0402, 0x944E4402, 0x944E8402, 0x944EC402, 0x944F0402,
+		0x944F4402, 0x944F8402, 0x944FC402, 0x94500402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x94504402, 0x94508402, 0x9450C402, 0x94510402, 0x94514402, 0x94518402, 0x9451C402, 0x94520402,
+		0xC0C3C402, 0x87E64402, 0x87E68402, 0xC7884402, 0xC7888402, 0xC788C402, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x92D9C408, 0x92DA0408, 0x92DA4408, 0x92DA8408, 0x92DAC408, 0x92DB0408, 0x92DB4408, 0x92DB8408,
+		0x92DBC408, 0x92DC0408, 0x92DC4408, 0x92DC8408, 0x92DCC408, 0x92DD0408, 0x92DD4408, 0x92DD8408,
+		0x92DDC408, 0x92DE0408, 0x92DE4408, 0x92DE8408, 0x92DEC408, 0x92DF0408, 0x92DF4408, 0x92DF8408,
+		0x92DFC408, 0x92E00408, 0x92E04408, 0x92E08408, 0x92E0C408, 0x92E10408, 0x92E14408, 0x92E18408,
+		0x92E1C408, 0x92E20408, 0x92E24408, 0x92E28408, 0x92E2C408, 0x92E30408, 0x92E34408, 0x92E38408,
+		0x92D9C402, 0x92DA0402, 0x92DA4402, 0x92DA8402, 0x92DAC402, 0x92DB0402, 0x92DB4402, 0x92DB8402,
+		0x92DBC402, 0x92DC0402, 0x92DC4402, 0x92DC8402, 0x92DCC402, 0x92DD0402, 0x92DD4402, 0x92DD8402,
+		0x92DDC402, 0x92DE0402, 0x92DE4402, 0x92DE8402, 0x92DEC402, 0x92DF0402, 0x92DF4402, 0x92DF8402,
+		0x92DFC402, 0x92E00402, 0x92E04402, 0x92E08402, 0x92E0C402, 0x92E10402, 0x92E14402, 0x92E18402,
+		0x92E1C402, 0x92E20402, 0x92E24402, 0x92E28402, 0x92E2C402, 0x92E30402, 0x92E34402, 0x92E38402,
+		0x92E3C402, 0x92E40402, 0x92E44402, 0x92E48402, 0x92E4C402, 0x92E50402, 0x92E54402, 0x92E58402,
+		0x92E5C402, 0x92E60402, 0x92E64402, 0x92E68402, 0x92E6C402, 0x92E70402, 0x92E74402, 0x92E78402,
+		0x92E7C402, 0x92E80402, 0x92E84402, 0x92E88402, 0x92E8C402, 0x92E90402, 0x92E94402, 0x92E98402,
+		0x92E9C402, 0x92EA0402, 0x92EA4402, 0x92EA8402, 0x92EAC402, 0x92EB0402, 0x92EB4402, 0x92EB8402,
+		0x92EBC402, 0x92EC0402, 0x92EC4402, 0x92EC8402, 0x92ECC402, 0x92ED0402, 0x92ED4402, 0x92ED8402,
+		0x92EDC402, 0x92EE0402, 0x92EE4402, 0x92EE8402, 0x92EEC402, 0x92EF0402, 0x92EF4402, 0x92EF8402,
+		0x93128402, 0x9312C402, 0x93130402, 0x93134402, 0x93138402, 0x9313C402, 0x93140402, 0x93144402,
+		0x93148402, 0x9314C402, 0x93150402, 0x93154402, 0x93158402, 0x9315C402, 0x93160402, 0x93164402,
+		0x93168402, 0x9316C402, 0x93170402, 0x93174402, 0x93178402, 0x9317C402, 0x93180402, 0x93184402,
+		0x93188402, 0x9318C402, 0x93190402, 0x93194402, 0x93198402, 0x9319C402, 0x00000000, 0x00000000,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8E4D0408, 0x8E4D4408, 0x8E4D8408, 0x8E4DC408, 0x8E4E0408, 0x8E4E4408, 0x8E4E8408, 0x8E4EC408,
+		0x8E4F0408, 0x8E4F4408, 0x8E4F8408, 0x8E4FC408, 0x8E500408, 0x8E504408, 0x8E508408, 0x8E50C408,
+		0x8E510408, 0x8E514408, 0x8E518408, 0x8E51C408, 0x8E520408, 0x8E524408, 0x8E528408, 0x8E52C408,
+		0x8E530408, 0x8E534408, 0x8E538408, 0x8E53C408, 0x8E540408, 0x8E544408, 0x8E548408, 0x8E54C408,
+		0x8E550408, 0x8E554408, 0x8E558408, 0x8E55C408, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8E4D0402, 0x8E4D4402, 0x8E4D8402, 0x8E4DC402, 0x8E4E0402, 0x8E4E4402, 0x8E4E8402, 0x8E4EC402,
+		0x8E4F0402, 0x8E4F4402, 0x8E4F8402, 0x8E4FC402, 0x8E500402, 0x8E504402, 0x8E508402, 0x8E50C402,
+		0x8E510402, 0x8E514402, 0x8E518402, 0x8E51C402, 0x8E520402, 0x8E524402, 0x8E528402, 0x8E52C402,
+		0x8E530402, 0x8E534402, 0x8E538402, 0x8E53C402, 0x8E540402, 0x8E544402, 0x8E548402, 0x8E54C402,
+		0x8E550402, 0x8E554402, 0x8E558402, 0x8E55C402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x931A0402, 0x931A4402, 0x931A8402, 0x931AC402, 0x931B0402, 0x931B4402, 0x931B8402, 0x931BC402,
+		0x931C0402, 0x931C4402, 0x931C8402, 0x931CC402, 0x931D0402, 0x931D4402, 0x931D8402, 0x931DC402,
+		0x931E0402, 0x931E4402, 0x931E8402, 0x931EC402, 0x931F0402, 0x931F4402, 0x931F8402, 0x931FC402,
+		0x93200402, 0x93204402, 0x93208402, 0x9320C402, 0x93210402, 0x93214402, 0x93218402, 0x9321C402,
+		0x93220402, 0x93224402, 0x93228402, 0x9322C402, 0x93230402, 0x93234402, 0x93238402, 0x9323C402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x93240402, 0x93244402, 0x93248402, 0x9324C402, 0x93250402, 0x93254402, 0x93258402, 0x9325C402,
+		0x93260402, 0x93264402, 0x93268402, 0x9326C402, 0x93270402, 0x93274402, 0x93278402, 0x9327C402,
+		0x93280402, 0x93284402, 0x93288402, 0x9328C402, 0x93290402, 0x93294402, 0x93298402, 0x9329C402,
+		0x932A0402, 0x932A4402, 0x932A8402, 0x932AC402, 0x932B0402, 0x932B4402, 0x932B8402, 0x932BC402,
+		0x932C0402, 0x932C4402, 0x932C8402, 0x932CC402, 0x932D0402, 0x932D4402, 0x932D8402, 0x932DC402,
+		0x932E0402, 0x932E4402, 0x932E8402, 0x932EC402, 0x932F0402, 0x932F4402, 0x932F8402, 0x932FC402,
+		0x93300402, 0x93304402, 0x93308402, 0x9330C402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xC1178402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x9373C402, 0x93740402, 0x93744402, 0x93748402, 0x9374C402, 0x93750402, 0x93754402, 0x93758402,
+		0x9375C402, 0x93760402, 0x93764402, 0x93768402, 0x9376C402, 0x93770402, 0x93774402, 0x93778402,
+		0x9377C402, 0x93780402, 0x93784402, 0x93788402, 0x9378C402, 0x93790402, 0x93794402, 0x93798402,
+		0x9379C402, 0x937A0402, 0x937A4402, 0x937A8402, 0x937AC402, 0x937B0402, 0x937B4402, 0x937B8402,
+		0x937BC402, 0x937C0402, 0x937C4402, 0x937C8402, 0x937CC402, 0x937D0402, 0x937D4402, 0x937D8402,
+		0x937DC402, 0x937E0402, 0x937E4402, 0x937E8402, 0x937EC402, 0x937F0402, 0x937F4402, 0x937F8402,
+		0x937FC402, 0x93800402, 0x93804402, 0x93808402, 0x9380C402, 0x93810402, 0x93814402, 0x93818402,
+		0x9381C402, 0x93820402, 0x93824402, 0x93828402, 0x9382C402, 0x93830402, 0x93834402, 0x93838402,
+		0x9383C402, 0x93840402, 0x93844402, 0x93848402, 0x9384C402, 0x93850402, 0x93854402, 0x93858402,
+		0x9385C402, 0x93860402, 0x93864402, 0x93868402, 0x9386C402, 0x93870402, 0x93874402, 0x93878402,
+		0x9387C402, 0x93880402, 0x93884402, 0x93888402, 0x9388C402, 0x93890402, 0x93894402, 0x93898402,
+		0x9389C402, 0x938A0402, 0x938A4402, 0x938A8402, 0x938AC402, 0x938B0402, 0x938B4402, 0x938B8402,
+		0x938BC402, 0x938C0402, 0x938C4402, 0x938C8402, 0x938CC402, 0x938D0402, 0x938D4402, 0x938D8402,
+		0x938DC402, 0x938E0402, 0x938E4402, 0x938E8402, 0x938EC402, 0x938F0402, 0x938F4402, 0x938F8402,
+		0x938FC402, 0x93900402, 0x93904402, 0x93908402, 0x9390C402, 0x93910402, 0x93914402, 0x93918402,
+		0x9391C402, 0x93920402, 0x93924402, 0x93928402, 0x9392C402, 0x93930402, 0x93934402, 0x93938402,
+		0x9393C402, 0x93940402, 0x93944402, 0x93948402, 0x9394C402, 0x93950402, 0x93954402, 0x93958402,
+		0x9395C402, 0x93960402, 0x93964402, 0x93968402, 0x9396C402, 0x93970402, 0x93974402, 0x93978402,
+		0x9397C402, 0x93980402, 0x93984402, 0x93988402, 0x9398C402, 0x93990402, 0x93994402, 0x93998402,
+		0x9399C402, 0x939A0402, 0x939A4402, 0x939A8402, 0x939AC402, 0x939B0402, 0x939B4402, 0x939B8402,
+		0x939BC402, 0x939C0402, 0x939C4402, 0x939C8402, 0x939CC402, 0x939D0402, 0x939D4402, 0x939D8402,
+		0x939DC402, 0x939E0402, 0x939E4402, 0x939E8402, 0x939EC402, 0x939F0402, 0x939F4402, 0x939F8402,
+		0x939FC402, 0x93A00402, 0x93A04402, 0x93A08402, 0x93A0C402, 0x93A10402, 0x93A14402, 0x93A18402,
+		0x93A1C402, 0x93A20402, 0x93A24402, 0x93A28402, 0x93A2C402, 0x93A30402, 0x93A34402, 0x93A38402,
+		0x93A3C402, 0x93A40402, 0x93A44402, 0x93A48402, 0x93A4C402, 0x93A50402, 0x93A54402, 0x93A58402,
+		0x93A5C402, 0x93A60402, 0x93A64402, 0x93A68402, 0x93A6C402, 0x93A70402, 0x93A74402, 0x93A78402,
+		0x93A7C402, 0x93A80402, 0x93A84402, 0x93A88402, 0x93A8C402, 0x93A90402, 0x93A94402, 0x93A98402,
+		0x93A9C402, 0x93AA0402, 0x93AA4402, 0x93AA8402, 0x93AAC402, 0x93AB0402, 0x93AB4402, 0x93AB8402,
+		0x93ABC402, 0x93AC0402, 0x93AC4402, 0x93AC8402, 0x93ACC402, 0x93AD0402, 0x93AD4402, 0x93AD8402,
+		0x93ADC402, 0x93AE0402, 0x93AE4402, 0x93AE8402, 0x93AEC402, 0x93AF0402, 0x93AF4402, 0x93AF8402,
+		0x93AFC402, 0x93B00402, 0x93B04402, 0x93B08402, 0x93B0C402, 0x93B10402, 0x93B14402, 0x93B18402,
+		0x93B1C402, 0x93B20402, 0x93B24402, 0x93B28402, 0x93B2C402, 0x93B30402, 0x93B34402, 0x93B38402,
+		0x93B3C402, 0x93B40402, 0x93B44402, 0x93B48402, 0x93B4C402, 0x93B50402, 0x93B54402, 0x93B58402,
+		0x93B5C402, 0x93B60402, 0x93B64402, 0x93B68402, 0x93B6C402, 0x93B70402, 0x93B74402, 0x93B78402,
+		0x93B7C402, 0x93B80402, 0x93B84402, 0x93B88402, 0x93B8C402, 0x93B90402, 0x93B94402, 0x93B98402,
+		0x93B9C402, 0x93BA0402, 0x93BA4402, 0x93BA8402, 0x93BAC402, 0x93BB0402, 0x93BB4402, 0x93BB8402,
+		0x93BBC402, 0x93BC0402, 0x93BC4402, 0x93BC8402, 0x93BCC402, 0x93BD0402, 0x93BD4402, 0x93BD8402,
+		0x93BDC402, 0x93BE0402, 0x93BE4402, 0x93BE8402, 0x93BEC402, 0x93BF0402, 0x93BF4402, 0x93BF8402,
+		0x93BFC402, 0x93C00402, 0x93C04402, 0x93C08402, 0x93C0C402, 0x93C10402, 0x93C14402, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x93C18402, 0x93C1C402, 0x93C20402, 0x93C24402, 0x93C28402, 0x93C2C402, 0x93C30402, 0x93C34402,
+		0x93C38402, 0x93C3C402, 0x93C40402, 0x93C44402, 0x93C48402, 0x93C4C402, 0x93C50402, 0x93C54402,
+		0x93C58402, 0x93C5C402, 0x93C60402, 0x93C64402, 0x93C68402, 0x93C6C402, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x93C70402, 0x93C74402, 0x93C78402, 0x93C7C402, 0x93C80402, 0x93C84402, 0x93C88402, 0x93C8C402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x93C90402, 0x93C94402, 0x93C98402, 0x93C9C402, 0x93CA0402, 0x93CA4402, 0x00000000, 0x00000000,
+		0x93CA8402, 0x00000000, 0x93CAC402, 0x93CB0402, 0x93CB4402, 0x93CB8402, 0x93CBC402, 0x93CC0402,
+		0x93CC4402, 0x93CC8402, 0x93CCC402, 0x93CD0402, 0x93CD4402, 0x93CD8402, 0x93CDC402, 0x93CE0402,
+		0x93CE4402, 0x93CE8402, 0x93CEC402, 0x93CF0402, 0x93CF4402, 0x93CF8402, 0x93CFC402, 0x93D00402,
+		0x93D04402, 0x93D08402, 0x93D0C402, 0x93D10402, 0x93D14402, 0x93D18402, 0x93D1C402, 0x93D20402,
+		0x93D24402, 0x93D28402, 0x93D2C402, 0x93D30402, 0x93D34402, 0x93D38402, 0x93D3C402, 0x93D40402,
+		0x93D44402, 0x93D48402, 0x93D4C402, 0x93D50402, 0x93D54402, 0x93D58402, 0x00000000, 0x93D5C402,
+		0x93D60402, 0x00000000, 0x00000000, 0x00000000, 0x93D64402, 0x00000000, 0x00000000, 0x93D68402,
+		0x9402C402, 0x94030402, 0x94034402, 0x94038402, 0x9403C402, 0x94040402, 0x94044402, 0x94048402,
+		0x9404C402, 0x94050402, 0x94054402, 0x94058402, 0x9405C402, 0x94060402, 0x94064402, 0x94068402,
+		0x9406C402, 0x94070402, 0x94074402, 0x94078402, 0x9407C402, 0x94080402, 0x00000000, 0xC0B88402,
+		0x87E64402, 0x87E68402, 0x87E6C402, 0xC78CC402, 0xC78D0402, 0xC78D4402, 0xC78D8402, 0xC78DC402,
+		0x93F28402, 0x93F2C402, 0x93F30402, 0x93F34402, 0x93F38402, 0x93F3C402, 0x93F40402, 0x93F44402,
+		0x93F48402, 0x93F4C402, 0x93F50402, 0x93F54402, 0x93F58402, 0x93F5C419, 0x93F5C402, 0x93F60402,
+		0x93F64402, 0x93F68402, 0x93F6C402, 0x93F70402, 0x93F74402, 0x93F78402, 0x93F7C402, 0xC4470402,
+		0xC4474402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0xC7890402, 0xC7894402,
+		0x93F80419, 0x93F80402, 0x93F84419, 0x93F84402, 0x93F88402, 0x93F8C402, 0x93F90419, 0x93F90402,
+		0x93F94402, 0x93F98402, 0x93F9C402, 0x93FA0402, 0x93FA4419, 0x93FA4402, 0x93FA8419, 0x93FA8402,
+		0x93FAC419, 0x93FAC402, 0x93FB0419, 0x93FB0402, 0x93FB4419, 0x93FB4402, 0x93FB8402, 0x93FBC402,
+		0x93FC0402, 0x93FC4402, 0x93FC8402, 0x93FCC402, 0x93FD0419, 0x93FD0402, 0x93FD4402, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x87E64402,
+		0x87E68402, 0x87E6C402, 0x87E70402, 0x87E70402, 0x87E74402, 0xC7898402, 0xC789C402, 0xC78A0402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x93FD8402, 0x93FDC402, 0x93FE0402, 0x93FE4402, 0x93FE8402, 0x93FEC402, 0x93FF0402, 0x93FF4402,
+		0x93FF8402, 0x93FFC402, 0x94000402, 0x94004402, 0x94008402, 0x9400C402, 0x94010402, 0x94014402,
+		0x94018402, 0x9401C402, 0x94020402, 0x00000000, 0x94024402, 0x94028402, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x87E64402, 0x87E74402, 0xC78A4402, 0xC78A8402, 0xC78AC402,
+		0x898D0402, 0x898D4402, 0x898D8402, 0x898DC402, 0x898E0402, 0x898E4402, 0x898E8402, 0x898EC402,
+		0x898F0402, 0x898F4402, 0x898F8402, 0x898FC402, 0x89900402, 0x89904402, 0x89908402, 0x8990C402,
+		0x89910402, 0x89914402, 0x89918402, 0x8991C402, 0x89920402, 0x89924402, 0x87E64402, 0xC78C0402,
+		0xC78C4402, 0xC78C8402, 0x87E68402, 0x87E6C402, 0x00000000, 0x00000000, 0x00000000, 0xC0C40402,
+		0x92C3C402, 0x92C40402, 0x92C44402, 0x92C48402, 0x92C4C402, 0x92C50402, 0x92C54402, 0x92C58402,
+		0x92C5C402, 0x92C60402, 0x92C64402, 0x92C68402, 0x92C6C402, 0x92C70402, 0x92C74402, 0x92C78402,
+		0x92C7C402, 0x92C80402, 0x92C84402, 0x92C88402, 0x92C8C402, 0x92C90402, 0x92C94402, 0x92C98402,
+		0x92C9C402, 0x92CA0402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xC0C28402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00041D42, 0x00011D42, 0x00032482, 0x0000CB42, 0x0001F602, 0x00031702, 0x00038C82, 0x00039F42,
+		0x0002BAC2, 0x0002B5C2, 0x00019E82, 0x000489C2, 0x0002D442, 0x0000DAC2, 0x0001E302, 0x0003C8C2,
+		0x00022282, 0x0002BBC2, 0x00000A02, 0x00026A82, 0x00039582, 0x00004B02, 0x000070C2, 0x0001FEC2,
+		0x00011F42, 0x00011342, 0x0004BB42, 0x0001B5C2, 0x0000E982, 0x00027882, 0x967BC402, 0x967C0402,
+		0x96758402, 0x9675C402, 0x96760402, 0x96764402, 0x96768402, 0x9676C402, 0x96770402, 0x96774402,
+		0x96778402, 0x9677C402, 0x96780402, 0x96784402, 0x96788402, 0x9678C402, 0x96790402, 0x96794402,
+		0x00038882, 0x96798402, 0x9679C402, 0x967A0402, 0x967A4402, 0x967A8402, 0x967AC402, 0x967B0402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xC7CAC402, 0xC7C80402, 0x967B4402, 0x967B8402,
+		0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402, 0x87E80402,
+		0x87E84402, 0xC7BD4402, 0xC7BD8402, 0xC7BDC402, 0xC7BE0402, 0xC7BE4402, 0xC7BE8402, 0xC7BEC402,
+		0x00000000, 0x00000000, 0xC7BF0402, 0xC7BF4402, 0xC7BF8402, 0xC7BFC402, 0xC7C00402, 0xC7C04402,
+		0xC7C08402, 0xC7C0C402, 0xC7C10402, 0xC7C14402, 0xC7C18402, 0xC7C1C402, 0xC7C20402, 0xC7C24402,
+		0xC7C28402, 0xC7C2C402, 0xC7C30402, 0xC7C34402, 0xC7C38402, 0xC7C3C402, 0xC7C40402, 0xC7C44402,
+		0xC7C48402, 0xC7C4C402, 0xC7C50402, 0xC7C54402, 0xC7C58402, 0xC7C5C402, 0xC7C60402, 0xC7C64402,
+		0xC7C68402, 0xC7C6C402, 0xC7C70402, 0xC7C74402, 0xC7C78402, 0xC7C7C402, 0xC7C84402, 0xC7C88402,
+		0xC7C8C402, 0xC7C90402, 0xC7C94402, 0xC7C98402, 0xC7C9C402, 0xC7CA0402, 0xC7CA4402, 0xC7CA8402,
+		0x8C6BC402, 0x8C6C0402, 0x8C6C4402, 0x8C6C8402, 0x00000000, 0x8C6CC402, 0x8C6D0402, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8C6D4402, 0x80000682, 0x80001882, 0x800018A2,
+		0x8C6D8402, 0x8C6E0402, 0x8C6E4402, 0x8C6E8402, 0x00000000, 0x8C6EC402, 0x8C6F0402, 0x8C6F4402,
+		0x00000000, 0x8C6F8402, 0x8C6FC402, 0x8C704402, 0x8C70C402, 0x8C710402, 0x8C714402, 0x8C718402,
+		0x8C71C402, 0x8C720402, 0x8C724402, 0x8C728402, 0x8C72C402, 0x8C730402, 0x8C734402, 0x8C738402,
+		0x8C73C402, 0x8C740402, 0x8C744402, 0x8C748402, 0x8C74C402, 0x8C754402, 0x8C758402, 0x8C75C402,
+		0x8C760402, 0x8C764402, 0x8C6DC402, 0x8C708402, 0x8C700402, 0x8C750402, 0x00000000, 0x00000000,
+		0x800019A2, 0x800019C2, 0x800019E2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8C768402,
+		0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0xC7978402, 0xC797C402, 0xC7980402, 0xC7984402,
+		0xC7988402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xC1190402, 0xC1194402, 0xC1198402, 0xC119C402, 0xC11A0402, 0xC11A4402, 0xC0AC8402, 0xC0ACC402,
+		0xC11A8402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x93D6C402, 0x93D70402, 0x93D74402, 0x93D78402, 0x93D7C402, 0x93D80402, 0x93D84402, 0x93D88402,
+		0x93D8C402, 0x93D90402, 0x93D94402, 0x93D98402, 0x93D9C402, 0x93DA0402, 0x93DA4402, 0x93DA8402,
+		0x93DAC402, 0x93DB0402, 0x93DB4402, 0x93DB8402, 0x93DBC402, 0x93DC0402, 0x93DC4402, 0x93DC8402,
+		0x93DCC402, 0x93DD0402, 0x93DD4402, 0x93DD8402, 0x93DDC402, 0x87E64402, 0xC78B0402, 0xC78B4402,
+		0x93DE0402, 0x93DE4402, 0x93DE8402, 0x93DEC402, 0x93DF0402, 0x93DF4402, 0x93DF8402, 0x93DFC402,
+		0x93E00402, 0x93E04402, 0x93E08402, 0x93E0C402, 0x93E10402, 0x93E14402, 0x93E18402, 0x93E1C402,
+		0x93E20402, 0x93E24402, 0x93E28402, 0x93E2C402, 0x93E30402, 0x93E34402, 0x93E38402, 0x93E3C402,
+		0x93E40402, 0x93E44402, 0x93E48402, 0x93E4C402, 0x93E50402, 0x87E64402, 0xC78B8402, 0xC78BC402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x941C8402, 0x941CC402, 0x941D0402, 0x941D4402, 0x941D8402, 0x941DC402, 0x941E0402, 0x941E4402,
+		0x0000FA02, 0x941E8402, 0x941EC402, 0x941F0402, 0x941F4402, 0x941F8402, 0x941FC402, 0x94200402,
+		0x94204402, 0x94208402, 0x9420C402, 0x94210402, 0x94214402, 0x94218402, 0x9421C402, 0x94220402,
+		0x94224402, 0x94228402, 0x9422C402, 0x94230402, 0x94234402, 0x94238402, 0x9423C402, 0x94240402,
+		0x94244402, 0x94248402, 0x9424C402, 0x94250402, 0x94254402, 0x80000662, 0x80000682, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x87E64402, 0x87E74402, 0xC78E0402, 0xC78E4402, 0xC78E8402,
+		0xC11BC402, 0xC11C0402, 0xC11C4402, 0xC11C8402, 0xC11CC402, 0xC11D0402, 0xC11D4402, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x93E54402, 0x93E58402, 0x93E5C402, 0x93E60402, 0x93E64402, 0x93E68402, 0x93E6C402, 0x93E70402,
+		0x93E74402, 0x93E78402, 0x93E7C402, 0x93E80402, 0x93E84402, 0x93E88402, 0x93E8C402, 0x93E90402,
+		0x93E94402, 0x93E98402, 0x93E9C402, 0x93EA0402, 0x93EA4402, 0x93EA8402, 0x93EAC402, 0x93EB0402,
+		0x93EB4402, 0x93EB8402, 0x93EBC402, 0x93EC0402, 0x93EC4402, 0x93EC8402, 0x93ECC402, 0x93ED0402,
+		0x93ED4402, 0x93ED8402, 0x93EDC402, 0x93EE0402, 0x93EE4402, 0x93EE8402, 0x93EEC402, 0x93EF0402,
+		0x93EF4402, 0x93EF8402, 0x93EFC402, 0x93F00402, 0x93F04402, 0x93F08402, 0x00000502, 0x93F0C402,
+		0x93F10402, 0x93F14402, 0x93F18402, 0x93F1C402, 0x93F20402, 0x93F24402, 0x00000000, 0x00000000,
+		0x00000000, 0xC11B8402, 0xC0B8C402, 0xC0B90402, 0xC0B94402, 0xC0B98402, 0xC0B9C402, 0xC0BA0402,
+		0x94084402, 0x94088402, 0x9408C402, 0x94090402, 0x94094402, 0x94098402, 0x9409C402, 0x940A0402,
+		0x940A4402, 0x940A8402, 0x940AC402, 0x940B0402, 0x940B4402, 0x940B8402, 0x940BC402, 0x940C0402,
+		0x940C4402, 0x940C8402, 0x940CC402, 0x940D0402, 0x940D4402, 0x940D8402, 0x00000000, 0x00000000,
+		0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0xC78EC402, 0xC78F0402, 0xC78F4402, 0xC78F8402,
+		0x940DC402, 0x940E0402, 0x940E4402, 0x940E8402, 0x940EC402, 0x940F0402, 0x940F4402, 0x940F8402,
+		0x940FC402, 0x94100402, 0x94104402, 0x94108402, 0x9410C402, 0x94110402, 0x94114402, 0x94118402,
+		0x9411C402, 0x94120402, 0x94124402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0xC78FC402, 0xC7900402, 0xC7904402, 0xC7908402,
+		0x94128402, 0x9412C402, 0x94130402, 0x94134402, 0x94138402, 0x9413C402, 0x94140402, 0x94144402,
+		0x94148402, 0x9414C402, 0x94150402, 0x94154402, 0x94158402, 0x9415C402, 0x94160402, 0x94164402,
+		0x94168402, 0x9416C402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0xC11D8402, 0xC11DC402, 0xC11E0402, 0xC11E4402, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0xC790C402, 0xC7910402, 0xC7914402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8F230402, 0x00024EC2, 0x8F234402, 0x8F238402, 0x0000C442, 0x8F23C402, 0x8F240402, 0x8F244402,
+		0x0003F4C2, 0x8F248402, 0x00006BC2, 0x8F24C402, 0x00040F82, 0x8F250402, 0x0000BA02, 0x8F254402,
+		0x000406C2, 0x8F258402, 0x00031302, 0x8F25C402, 0x8F260402, 0x00032DC2, 0x8F264402, 0x0003D542,
+		0x8F268402, 0x0002E982, 0x8F26C402, 0x00049D82, 0x8F270402, 0x0000A5C2, 0x8F274402, 0x0003B982,
+		0x8F278402, 0x8F27C402, 0x8F280402, 0x8F284402, 0x8F288402, 0x000057C2, 0x8F28C402, 0x000230C2,
+		0x8F290402, 0x0000B382, 0x8F294402, 0x00013982, 0x8F298402, 0x8F29C402, 0x0003F2C2, 0x8F2A0402,
+		0x8F2A4402, 0x8F2A8402, 0x8F2AC402, 0x0003F982, 0x8F2B0402, 0x0001A882, 0x8F2B4402, 0x00012782,
+		0x8F2B8402, 0x00020D42, 0x8F2BC402, 0x00003502, 0x8F2C0402, 0x8F2C4402, 0x8F2C8402, 0x8F2CC402,
+		0x00035E42, 0x8F2D0402, 0x0003A742, 0x8F2D4402, 0x00002542, 0x8F2D8402, 0x0003E582, 0x8F2DC402,
+		0x8F2E0402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8F18C408, 0x00015342, 0x8F190408, 0x8F194408, 0x8F198408, 0x8F19C408, 0x8F1A0408, 0x8F1A4408,
+		0x8F1A8408, 0x8F1AC408, 0x0000D042, 0x000288C2, 0x8F1B0408, 0x8F1B4408, 0x8F1B8408, 0x8F1BC408,
+		0x8F1C0408, 0x00046E82, 0x8F1C4408, 0x8F1C8408, 0x8F1CC408, 0x8F1D0408, 0x8F1D4408, 0x8F1D8408,
+		0x8F1DC408, 0x8F1E0408, 0x8F1E4408, 0x8F1E8408, 0x000172C2, 0x8F1EC408, 0x00034E42, 0x00009042,
+		0x8F1F0408, 0x8F1F4408, 0x8F1F8408, 0x00026B02, 0x8F1FC408, 0x8F200408, 0x8F204408, 0x8F208408,
+		0x8F20C408, 0x8F210408, 0x8F214408, 0x0001BA42, 0x8F218408, 0x00027982, 0x8F21C408, 0x8F220408,
+		0x8F224408, 0x8F228408, 0x8F22C408, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8F18C402, 0x00027702, 0x8F190402, 0x8F194402, 0x8F198402, 0x8F19C402, 0x8F1A0402, 0x8F1A4402,
+		0x8F1A8402, 0x8F1AC402, 0x00044E42, 0x00016442, 0x8F1B0402, 0x8F1B4402, 0x8F1B8402, 0x8F1BC402,
+		0x8F1C0402, 0x000429C2, 0x8F1C4402, 0x8F1C8402, 0x8F1CC402, 0x8F1D0402, 0x8F1D4402, 0x8F1D8402,
+		0x8F1DC402, 0x8F1E0402, 0x8F1E4402, 0x8F1E8402, 0x00025802, 0x8F1EC402, 0x00026DC2, 0x0000E182,
+		0x8F1F0402, 0x8F1F4402, 0x8F1F8402, 0x0003B682, 0x8F1FC402, 0x8F200402, 0x8F204402, 0x8F208402,
+		0x8F20C402, 0x8F210402, 0x8F214402, 0x00007682, 0x8F218402, 0x000391C2, 0x8F21C402, 0x8F220402,
+		0x8F224402, 0x8F228402, 0x8F22C402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x87E64402, 0x87E74402, 0xC76E8402, 0xC76EC402, 0xC76F0402, 0xC76F4402,
+		0x8D86C402, 0x8D884402, 0x8D888402, 0x8D88C402, 0x8D890402, 0x8D894402, 0x8D898402, 0x8D89C402,
+		0x8D8A0402, 0x8D8A4402, 0x8D8A8402, 0x8D8AC402, 0x8D8B0402, 0x8D8B4402, 0x8D8B8402, 0x8D8BC402,
+		0x8D8C0402, 0x8D8C4402, 0x8D8C8402, 0x8D8CC402, 0x8D8D0402, 0x8D8D4402, 0x8D8D8402, 0x8D8DC402,
+		0x8D8E0402, 0x8D8E4402, 0x8D8E8402, 0x8D8EC402, 0x8D8F0402, 0x8D870402, 0x8D874402, 0x8D878402,
+		0x8D87C402, 0x8D880402, 0x8D8F4402, 0x8D8F8402, 0x80000662, 0x80000662, 0x80000662, 0x80000662,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402, 0x87E80402,
+		0x87E84402, 0xC7684402, 0xC7688402, 0xC768C402, 0xC7690402, 0xC7694402, 0xC7698402, 0xC769C402,
+		0xC76A0402, 0xC76A4402, 0xC76A8402, 0xC76AC402, 0xC76B0402, 0xC76B4402, 0xC76B8402, 0xC76BC402,
+		0xC76C0402, 0xC76C4402, 0xC76C8402, 0xC76CC402, 0xC76D0402, 0xC76D4402, 0xC76D8402, 0x00000000,
+		0x942F8402, 0x942FC402, 0x94300402, 0x94304402, 0x94308402, 0x9430C402, 0x94310402, 0x94314402,
+		0x94318402, 0x9431C402, 0x94320402, 0x94324402, 0x94328402, 0x9432C402, 0x94330402, 0x94334402,
+		0x94338402, 0x9433C402, 0x94340402, 0x94344402, 0x94348402, 0x9434C402, 0x94350402, 0x94354402,
+		0x94358402, 0x9435C402, 0x94360402, 0x94364402, 0x94368402, 0x9436C402, 0x94370402, 0x94374402,
+		0x94378402, 0x94380402, 0x94384402, 0x94388402, 0x9438C402, 0x94390402, 0x94394402, 0x94398402,
+		0x9439C402, 0x943A4402, 0x00000000, 0x80001062, 0x80001042, 0xC0888402, 0x00000000, 0x00000000,
+		0x9437C402, 0x943A0402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x94258402, 0x94258419, 0x9425C402, 0x9425C419, 0x94260402, 0x94264402, 0x94264419, 0x94268402,
+		0x9426C402, 0x94270402, 0x94274402, 0x94278402, 0x9427C402, 0x94280402, 0x94284402, 0x94284419,
+		0x00017742, 0x94288402, 0x9428C402, 0x00038A82, 0x94290402, 0x94294402, 0x94294419, 0x0001A002,
+		0x94298402, 0x9429C402, 0x942A0402, 0x942A0419, 0x00004202, 0x87E64402, 0x87E68402, 0x87E6C402,
+		0x87E70402, 0x87E74402, 0xC7918402, 0xC791C402, 0xC7920402, 0xC7924402, 0xC7928402, 0x000476C2,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x942A4402, 0x942A8402, 0x942AC402, 0x942B0402, 0x942B4402, 0x942B8402, 0x942BC402, 0x942C0402,
+		0x942C4402, 0x942C8402, 0x942CC402, 0x942D0402, 0x942D4402, 0x942D8402, 0x942DC402, 0x942E0402,
+		0x942E4402, 0x942E8402, 0x942EC402, 0x942F0402, 0x942F4402, 0x00018382, 0x80000682, 0x80000682,
+		0x80000662, 0x80000662, 0x80000662, 0x80000682, 0x80000662, 0x80000682, 0x80000682, 0x80000682,
+		0x80000682, 0x87E64402, 0xC792C402, 0xC7930402, 0xC7934402, 0xC0BA4402, 0xC0BA8402, 0xC0BAC402,
+		0xC0BB0402, 0xC0BB4402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x943A8402, 0x943AC402, 0x943B0402, 0x943B4402, 0x943B8402, 0x943BC402, 0x943C0402, 0x943C4402,
+		0x943C8402, 0x943CC402, 0x943D0402, 0x943D4402, 0x943D8402, 0x943DC402, 0x943E0402, 0x943E4402,
+		0x943E8402, 0x943EC402, 0x943F0402, 0x943F4402, 0x943F8402, 0x87E64402, 0x87E68402, 0x87E6C402,
+		0x87E70402, 0xC7938402, 0xC793C402, 0xC7940402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x94170402, 0x94174402, 0x94178402, 0x9417C402, 0x94180402, 0x94184402, 0x94188402, 0x9418C402,
+		0x94190402, 0x94194402, 0x94198402, 0x9419C402, 0x941A0402, 0x941A4402, 0x941A8402, 0x941AC402,
+		0x941B0402, 0x941B4402, 0x941B8402, 0x941BC402, 0x941C0402, 0x941C4402, 0x0003C1C2, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x80001862, 0x80001882, 0x800018A2, 0x8C664402, 0x8C668402, 0x8C5A8402, 0x8C5AC402, 0x8C5B0402,
+		0x8C5B4402, 0x8C5B8402, 0x8C5BC402, 0x8C5C0402, 0x8C5C4402, 0x8C5C8402, 0x8C5CC402, 0x8C5D0402,
+		0x8C5D4402, 0x8C5D8402, 0x8C5DC402, 0x8C5E0402, 0x8C5E4402, 0x8C5E8402, 0x8C5EC402, 0x8C5F0402,
+		0x8C5F4402, 0x8C5F8402, 0x8C5FC402, 0x8C600402, 0x8C604402, 0x8C608402, 0x8C60C402, 0x8C610402,
+		0x8C614402, 0x8C618402, 0x8C61C402, 0x8C620402, 0x8C624402, 0x8C628402, 0x8C62C402, 0x8C630402,
+		0x8C634402, 0x8C638402, 0x8C63C402, 0x8C640402, 0x8C644402, 0x8C648402, 0x8C64C402, 0x8C650402,
+		0x8C654402, 0x8C658402, 0x8C65C402, 0x8C660402, 0x8C66C402, 0x8C670402, 0x8C674402, 0x8C678402,
+		0x8C67C402, 0x8C680402, 0x8C684402, 0x8C688402, 0x8C68C402, 0x8C690402, 0x8C694402, 0x8C698402,
+		0x8C69C402, 0x8C6A0402, 0x8C6A4402, 0x8C6A8402, 0x8C6AC402, 0x8C6B0402, 0x8C6B4402, 0xC0AD0402,
+		0xC0AD4402, 0xC117C402, 0xC1180402, 0xC1184402, 0xC1188402, 0xC118C402, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402,
+		0x87E7C402, 0x87E80402, 0x87E84402, 0xC794C402, 0xC7950402, 0xC7954402, 0xC7958402, 0xC795C402,
+		0xC7960402, 0xC7964402, 0xC7968402, 0xC796C402, 0xC7970402, 0xC7974402, 0x87E60402, 0x87E64402,
+		0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402, 0x87E80402, 0x87E84402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8C6B8402,
+		0x80001862, 0x80001882, 0x800018A2, 0x8B51C402, 0x8B520402, 0x8B524402, 0x8B528402, 0x8B52C402,
+		0x8B530402, 0x8B534402, 0x8B538402, 0x8B53C402, 0x8B540402, 0x8B544402, 0x8B548402, 0x8B54C402,
+		0x8B550402, 0x8B554402, 0x8B558402, 0x8B55C402, 0x8B560402, 0x8B564402, 0x8B568402, 0x8B56C402,
+		0x8B570402, 0x8B574402, 0x00000000, 0x8B578402, 0x00000000, 0x8B57C402, 0x8B580402, 0x8B584402,
+		0x8B588402, 0x8B58C402, 0x8B590402, 0x8B594402, 0x8B598402, 0x8B59C402, 0x8B5A0402, 0x8B5A4402,
+		0x8B5A8402, 0x8B5AC402, 0x8B5B0402, 0x00000000, 0x8B5B4402, 0x8B5B8402, 0x8B5BC402, 0x8B5C0402,
+		0x8B5C4402, 0x8B5C8402, 0x8B5CC402, 0x8B5D0402, 0x8B5D4402, 0x8B5D8402, 0x8B5DC402, 0x8B5E0402,
+		0x8B5E4402, 0x8B5E8402, 0x80001842, 0xC11E8402, 0xC11EC402, 0x80000000, 0xC0BB8402, 0xC0BBC402,
+		0xC0AD8402, 0xC0ADC402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80000000, 0x00000000, 0x00000000,
+		0x93310402, 0x93314402, 0x93318402, 0x9331C402, 0x93320402, 0x93324402, 0x93328402, 0x9332C402,
+		0x93330402, 0x93334402, 0x93338402, 0x9333C402, 0x93340402, 0x93344402, 0x93348402, 0x9334C402,
+		0x93350402, 0x93354402, 0x93358402, 0x9335C402, 0x93360402, 0x93364402, 0x93368402, 0x9336C402,
+		0x93370402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x80001862, 0x80001882, 0x800018A2, 0x8D8FC402, 0x8D900402, 0x8D904402, 0x8D908402, 0x8D90C402,
+		0x8D910402, 0x8D914402, 0x8D918402, 0x8D91C402, 0x8D920402, 0x8D924402, 0x8D928402, 0x8D92C402,
+		0x8D930402, 0x8D934402, 0x8D938402, 0x8D93C402, 0x8D940402, 0x8D944402, 0x8D948402, 0x8D94C402,
+		0x8D950402, 0x8D954402, 0x8D958402, 0x8D95C402, 0x8D960402, 0x8D964402, 0x8D968402, 0x8D96C402,
+		0x8D970402, 0x8D974402, 0x8D978402, 0x8D97C402, 0x8D984402, 0x8D988402, 0x8D98C402, 0x8D994402,
+		0x8D998402, 0x8D99C402, 0x8D9A0402, 0x8D9A4402, 0x8D9A8402, 0x8D9AC402, 0x00000000, 0x00000000,
+		0x8D9B8402, 0x00047621, 0x00025BE1, 0x8D9CC402, 0x8D9D0402, 0x00000000, 0x87E60402, 0x87E64402,
+		0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402, 0x87E80402, 0x87E84402,
+		0xC0BC0402, 0xC0AE0402, 0xC0AE4402, 0xC09E8402, 0x8D990402, 0x8D9C4402, 0x8D9C8402, 0x8D980402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8B5EC402, 0x8B5F0402, 0x8B5F4402, 0x8B5F8402, 0x8B5FC402, 0x8B600402, 0x8B604402, 0x8B608402,
+		0x8B60C402, 0x8B610402, 0x8B614402, 0x8B618402, 0x8B61C402, 0x8B620402, 0x8B624402, 0x8B628402,
+		0x8B62C402, 0x8B630402, 0x8B634402, 0x8B638402, 0x8B63C402, 0x8B640402, 0x8B644402, 0x8B648402,
+		0x8B64C402, 0x8B650402, 0x8B654402, 0x8B658402, 0x8B65C402, 0x8B660402, 0x8B664402, 0x8B668402,
+		0x8B670402, 0x8B674402, 0x8B678402, 0x80001842, 0xC11F0402, 0xC11F4402, 0x8B66C402, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x80001862, 0x80001882, 0x800018A2, 0x8B684402, 0x8B688402, 0x8B68C402, 0x8B690402, 0x8B694402,
+		0x8B698402, 0x8B69C402, 0x8B6A0402, 0x8B6A4402, 0x8B6A8402, 0x8B6AC402, 0x8B6B0402, 0x8B6B4402,
+		0x8B6B8402, 0x8B6BC402, 0x8B6C0402, 0x8B6C4402, 0x8B6C8402, 0x8B6CC402, 0x8B6D0402, 0x8B6D4402,
+		0x8B6D8402, 0x8B6DC402, 0x8B6E0402, 0x8B6E4402, 0x8B6E8402, 0x8B6EC402, 0x8B6F0402, 0x8B6F4402,
+		0x8B6F8402, 0x8B6FC402, 0x8B700402, 0x8B704402, 0x8B708402, 0x8B70C402, 0x8B710402, 0x8B714402,
+		0x8B718402, 0x8B71C402, 0x8B720402, 0x8B724402, 0x8B728402, 0x8B72C402, 0x8B730402, 0x8B734402,
+		0x8B738402, 0x8B73C402, 0x8B740402, 0x8B754402, 0x8B758402, 0x8B75C402, 0x8B760402, 0x8B764402,
+		0x8B768402, 0x8B76C402, 0x8B770402, 0x8B774402, 0x8B778402, 0x8B780402, 0x8B784402, 0x8B788402,
+		0x8B78C402, 0x8B744402, 0x8B748402, 0x8B74C402, 0x8B67C402, 0xC0AE8402, 0xC0AEC402, 0xC11FC402,
+		0xC0BC4402, 0x800018C2, 0x80001842, 0x80001A02, 0x80001A22, 0xC11F8402, 0x8B77C402, 0x80001862,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0x8B680402, 0xC1200402, 0x8B750402, 0xC1204402, 0xC0BC8402, 0xC0BCC402,
+		0x00000000, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0xC79B4402, 0xC79B8402, 0xC79BC402, 0xC79C0402, 0xC79C4402, 0xC79C8402,
+		0xC79CC402, 0xC79D0402, 0xC79D4402, 0xC79D8402, 0xC79DC402, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8B790402, 0x8B794402, 0x8B798402, 0x8B79C402, 0x8B7A0402, 0x8B7A4402, 0x8B7A8402, 0x8B7AC402,
+		0x8B7B0402, 0x8B7B4402, 0x8B7B8402, 0x8B7BC402, 0x8B7C0402, 0x8B7C4402, 0x8B7C8402, 0x8B7CC402,
+		0x8B7D0402, 0x8B7D4402, 0x00000000, 0x8B7D8402, 0x8B7DC402, 0x8B7E0402, 0x8B7E4402, 0x8B7E8402,
+		0x8B7EC402, 0x8B7F0402, 0x8B7F4402, 0x8B7F8402, 0x8B7FC402, 0x8B800402, 0x8B804402, 0x8B808402,
+		0x8B80C402, 0x8B810402, 0x8B814402, 0x8B818402, 0x8B81C402, 0x8B820402, 0x8B824402, 0x8B828402,
+		0x8B82C402, 0x8B830402, 0x8B834402, 0x8B838402, 0x8B83C402, 0x8B840402, 0x8B844402, 0x8B848402,
+		0x8B84C402, 0x8B850402, 0x8B854402, 0x8B858402, 0x80001882, 0x8B85C402, 0x80001842, 0x80001002,
+		0xC0AF0402, 0xC0AF4402, 0xC1208402, 0xC120C402, 0xC1210402, 0xC1214402, 0x80001022, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8B944402, 0x8B948402, 0x8B94C402, 0x8B950402, 0x8B95C402, 0x8B960402, 0x8B964402, 0x00000000,
+		0x8B968402, 0x00000000, 0x8B96C402, 0x8B970402, 0x8B974402, 0x8B978402, 0x00000000, 0x8B97C402,
+		0x8B980402, 0x8B984402, 0x8B988402, 0x8B98C402, 0x8B990402, 0x8B994402, 0x8B998402, 0x8B99C402,
+		0x8B9A0402, 0x8B9A4402, 0x8B9A8402, 0x8B9AC402, 0x8B9B0402, 0x8B9B4402, 0x00000000, 0x8B9B8402,
+		0x8B9BC402, 0x8B9C0402, 0x8B9C4402, 0x8B9C8402, 0x8B9CC402, 0x8B954402, 0x8B958402, 0x8B9D0402,
+		0x8B9D4402, 0xC0BD0402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8B860402, 0x8B864402, 0x8B868402, 0x8B86C402, 0x8B870402, 0x8B874402, 0x8B878402, 0x8B87C402,
+		0x8B880402, 0x8B884402, 0x8B888402, 0x8B88C402, 0x8B890402, 0x8B894402, 0x8B898402, 0x8B89C402,
+		0x8B8A0402, 0x8B8A4402, 0x8B8A8402, 0x8B8AC402, 0x8B8B0402, 0x8B8B4402, 0x8B8B8402, 0x8B8BC402,
+		0x8B8C0402, 0x8B8C4402, 0x8B8C8402, 0x8B8CC402, 0x8B8D0402, 0x8B8D4402, 0x8B8D8402, 0x8B8DC402,
+		0x8B8E0402, 0x8B8E4402, 0x8B8E8402, 0x8B8EC402, 0x8B8F0402, 0x8B8F4402, 0x8B8F8402, 0x8B8FC402,
+		0x8B900402, 0x8B904402, 0x8B908402, 0x8B90C402, 0x8B910402, 0x8B914402, 0x8B918402, 0x80001882,
+		0x8B91C402, 0x8B920402, 0x8B924402, 0x8B928402, 0x8B92C402, 0x8B930402, 0x8B934402, 0x8B938402,
+		0x8B93C402, 0x80001842, 0x8B940402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x80001882, 0x80001862, 0x80001882, 0x800018A2, 0x00000000, 0x8B9DC402, 0x8B9E0402, 0x8B9E4402,
+		0x8B9E8402, 0x8B9EC402, 0x8B9F0402, 0x8B9F4402, 0x8B9FC402, 0x00000000, 0x00000000, 0x8BA04402,
+		0x8BA08402, 0x00000000, 0x00000000, 0x8BA0C402, 0x8BA10402, 0x8BA14402, 0x8BA18402, 0x8BA1C402,
+		0x8BA20402, 0x8BA24402, 0x8BA28402, 0x8BA2C402, 0x8BA30402, 0x8BA34402, 0x8BA38402, 0x8BA3C402,
+		0x8BA40402, 0x8BA44402, 0x8BA48402, 0x8BA4C402, 0x8BA50402, 0x8BA54402, 0x8BA58402, 0x8BA5C402,
+		0x8BA60402, 0x00000000, 0x8BA64402, 0x8BA68402, 0x8BA6C402, 0x8BA70402, 0x8BA74402, 0x8BA78402,
+		0x8BA7C402, 0x00000000, 0x8BA80402, 0x8BA84402, 0x00000000, 0x8BA88402, 0x8BA8C402, 0x8BA90402,
+		0x8BA94402, 0x8BA98402, 0x00000000, 0x80001842, 0x80001842, 0x8BA9C402, 0x8BAA8402, 0x8BAAC402,
+		0x8BAB0402, 0x8BAB4402, 0x8BAB8402, 0x8BABC402, 0x8BAC0402, 0x00000000, 0x00000000, 0x00011021,
+		0x8BAD0402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8BADC402, 0x00000000, 0x00000000,
+		0x8B9D8402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8BAE0402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8BAE4402, 0x8BAA0402, 0x8BAA4402,
+		0x8B9F8402, 0x8BA00402, 0x8BAC4402, 0x8BAC8402, 0x00000000, 0x00000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x00000000, 0x00000000, 0x00000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8BAF0402, 0x8BAF4402, 0x8BAF8402, 0x8BAFC402, 0x8BB00402, 0x8BB04402, 0x8BB08402, 0x8BB0C402,
+		0x8BB10402, 0x8BB14402, 0x8BB18402, 0x8BB1C402, 0x8BB20402, 0x8BB24402, 0x8BB28402, 0x8BB2C402,
+		0x8BB30402, 0x8BB34402, 0x8BB38402, 0x8BB3C402, 0x8BB40402, 0x8BB44402, 0x8BB48402, 0x8BB4C402,
+		0x8BB50402, 0x8BB54402, 0x8BB58402, 0x8BB5C402, 0x8BB60402, 0x8BB64402, 0x8BB68402, 0x8BB6C402,
+		0x8BB70402, 0x8BB74402, 0x8BB78402, 0x8BB7C402, 0x8BB80402, 0x8BB84402, 0x8BB88402, 0x8BB8C402,
+		0x8BB90402, 0x8BB94402, 0x8BB98402, 0x8BB9C402, 0x8BBA0402, 0x8BBA4402, 0x8BBA8402, 0x8BBAC402,
+		0x8BBB0402, 0x8BBB4402, 0x8BBB8402, 0x8BBBC402, 0x8BBC0402, 0x8BBD8402, 0x8BBDC402, 0x8BBE0402,
+		0x8BBE4402, 0x8BBE8402, 0x8BBEC402, 0x8BBF0402, 0x8BBF4402, 0x8BBF8402, 0x8BBFC402, 0x8BC00402,
+		0x8BC04402, 0x8BC08402, 0x8BC0C402, 0x80001862, 0x80001882, 0x800018A2, 0x80001842, 0x8BBC4402,
+		0x8BBD0402, 0x8BAE8402, 0x8BAEC402, 0xC0AF8402, 0xC0AFC402, 0xC1218402, 0xC1220402, 0xC1224402,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0xC121C402, 0xC1228402, 0x00000000, 0xC122C402, 0x800018C2, 0x8BBD4402,
+		0x8BBC8402, 0x8BBCC402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8BC14402, 0x8BC18402, 0x8BC1C402, 0x8BC20402, 0x8BC24402, 0x8BC28402, 0x8BC2C402, 0x8BC30402,
+		0x8BC34402, 0x8BC38402, 0x8BC3C402, 0x8BC40402, 0x8BC44402, 0x8BC48402, 0x8BC4C402, 0x8BC50402,
+		0x8BC54402, 0x8BC58402, 0x8BC5C402, 0x8BC60402, 0x8BC64402, 0x8BC68402, 0x8BC6C402, 0x8BC70402,
+		0x8BC74402, 0x8BC78402, 0x8BC7C402, 0x8BC80402, 0x8BC84402, 0x8BC88402, 0x8BC8C402, 0x8BC90402,
+		0x8BC94402, 0x8BC98402, 0x8BC9C402, 0x8BCA0402, 0x8BCA4402, 0x8BCA8402, 0x8BCAC402, 0x8BCB0402,
+		0x8BCB4402, 0x8BCB8402, 0x8BCBC402, 0x8BCC0402, 0x8BCC4402, 0x8BCC8402, 0x8BCCC402, 0x8BCD0402,
+		0x8BCDC402, 0x8BCE0402, 0x8BCE4402, 0x8BCE8402, 0x8BCEC402, 0x8BCF0402, 0x8BCF4402, 0x8BCF8402,
+		0x8BCFC402, 0x0002A2A1, 0x8BD04402, 0x00000000, 0x00000000, 0x8BD10402, 0x00000000, 0x80001862,
+		0x80001882, 0x800018A2, 0x8BD18402, 0x80001842, 0x8BCD4402, 0x8BCD8402, 0xC1230402, 0x8BC10402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8BD1C402, 0x8BD20402, 0x8BD24402, 0x8BD28402, 0x8BD2C402, 0x8BD30402, 0x8BD34402, 0x8BD38402,
+		0x8BD3C402, 0x8BD40402, 0x8BD44402, 0x8BD48402, 0x8BD4C402, 0x8BD50402, 0x8BD54402, 0x8BD58402,
+		0x8BD5C402, 0x8BD60402, 0x8BD64402, 0x8BD68402, 0x8BD6C402, 0x8BD70402, 0x8BD74402, 0x8BD78402,
+		0x8BD7C402, 0x8BD80402, 0x8BD84402, 0x8BD88402, 0x8BD8C402, 0x8BD90402, 0x8BD94402, 0x8BD98402,
+		0x8BD9C402, 0x8BDA0402, 0x8BDA4402, 0x8BDA8402, 0x8BDAC402, 0x8BDB0402, 0x8BDB4402, 0x8BDB8402,
+		0x8BDBC402, 0x8BDC0402, 0x8BDC4402, 0x8BDC8402, 0x8BDCC402, 0x8BDD0402, 0x8BDD4402, 0x8BDD8402,
+		0x8BDDC402, 0x8BDE0402, 0x8BDE4402, 0x8BDE8402, 0x8BDEC402, 0x8BDF0402, 0x00000000, 0x00000000,
+		0x00033BA1, 0x000333E1, 0x00000000, 0x00000000, 0x80001862, 0x80001882, 0x800018A2, 0x8BE04402,
+		0x80001842, 0xC1234402, 0xC0B00402, 0xC0B04402, 0xC1238402, 0xC123C402, 0xC1240402, 0xC1244402,
+		0xC1248402, 0xC124C402, 0xC1250402, 0xC1254402, 0xC1258402, 0xC125C402, 0xC1260402, 0xC1264402,
+		0xC1268402, 0xC126C402, 0xC1270402, 0xC1274402, 0xC1278402, 0xC127C402, 0xC1280402, 0xC1284402,
+		0x00018902, 0x00018402, 0x0002D1C2, 0x00010442, 0x0001A902, 0x00046482, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8BE08402, 0x8BE0C402, 0x8BE10402, 0x8BE14402, 0x8BE18402, 0x8BE1C402, 0x8BE20402, 0x8BE24402,
+		0x8BE28402, 0x8BE2C402, 0x8BE30402, 0x8BE34402, 0x8BE38402, 0x8BE3C402, 0x8BE40402, 0x8BE44402,
+		0x8BE48402, 0x8BE4C402, 0x8BE50402, 0x8BE54402, 0x8BE58402, 0x8BE5C402, 0x8BE60402, 0x8BE64402,
+		0x8BE68402, 0x8BE6C402, 0x8BE70402, 0x8BE74402, 0x8BE78402, 0x8BE7C402, 0x8BE80402, 0x8BE84402,
+		0x8BE88402, 0x8BE8C402, 0x8BE90402, 0x8BE94402, 0x8BE98402, 0x8BE9C402, 0x8BEA0402, 0x8BEA4402,
+		0x8BEA8402, 0x8BEAC402, 0x8BEB0402, 0x8BEB4402, 0x8BEB8402, 0x8BEBC402, 0x8BEC0402, 0x8BEC4402,
+		0x8BEC8402, 0x8BECC402, 0x8BED0402, 0x8BED4402, 0x8BED8402, 0x8BEDC402, 0x8BEE0402, 0x8BEE4402,
+		0x8BEE8402, 0x8BEEC402, 0x8BEF0402, 0x8BEF4402, 0x8BEF8402, 0x80001882, 0x800018A2, 0x8BEFC402,
+		0x80001862, 0xC0B08402, 0xC0B0C402, 0xC1288402, 0x8BF00402, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xC0FCC402, 0xC0FD0402, 0xC0FD4402, 0xC0FD8402, 0xC0FDC402, 0xC0FE0402, 0xC0FE4402, 0xC0FE8402,
+		0xC0FEC402, 0xC0FF0402, 0xC0FF4402, 0xC0FF8402, 0xC0FFC402, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8BF04402, 0x8BF08402, 0x8BF0C402, 0x8BF10402, 0x8BF14402, 0x8BF18402, 0x8BF1C402, 0x8BF20402,
+		0x8BF24402, 0x8BF28402, 0x8BF38402, 0x8BF3C402, 0x8BF44402, 0x8BF48402, 0x8BF4C402, 0x8BF50402,
+		0x8BF54402, 0x8BF58402, 0x8BF5C402, 0x8BF60402, 0x8BF64402, 0x8BF68402, 0x8BF6C402, 0x8BF70402,
+		0x8BF74402, 0x8BF78402, 0x8BF7C402, 0x8BF80402, 0x8BF84402, 0x8BF88402, 0x8BF8C402, 0x8BF90402,
+		0x8BF94402, 0x8BF98402, 0x8BF9C402, 0x8BFA0402, 0x8BFA4402, 0x8BFA8402, 0x8BFAC402, 0x8BF30402,
+		0x8BF2C402, 0x8BF34402, 0x8BFB0402, 0x80001882, 0x800018A2, 0x8BFB4402, 0x8BFB8402, 0x8BFBC402,
+		0x8BFC0402, 0x8BFC4402, 0x8BFC8402, 0x8BFCC402, 0x8BFD0402, 0x8BFD4402, 0x8BFD8402, 0x80001842,
+		0x8BF40402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8C294402, 0x8C298402, 0x8C29C402, 0x8C2A0402, 0x8C2A4402, 0x00006FC2, 0x8C2A8402, 0x8C2AC402,
+		0x8C2B0402, 0x8C2B4402, 0x8C2B8402, 0x8C2BC402, 0x8C2C0402, 0x8C2C4402, 0x8C2C8402, 0x8C2CC402,
+		0x8C2D0402, 0x8C2D4402, 0x8C2D8402, 0x8C2DC402, 0x8C2E0402, 0x8C2E4402, 0x00014142, 0x8C2E8402,
+		0x8C2EC402, 0x8C2F0402, 0x00032582, 0x00000000, 0x00000000, 0x8C324402, 0x8C328402, 0x8C32C402,
+		0x8C2F4402, 0x8C2F8402, 0x8C2FC402, 0x8C300402, 0x8C304402, 0x8C308402, 0x8C30C402, 0x8C310402,
+		0x8C314402, 0x8C318402, 0x8C31C402, 0x8C320402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0xC7944402, 0xC7948402, 0xC0B10402, 0xC0B14402, 0xC0BD4402, 0xC1678402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8C1B4402, 0x8C1B8402, 0x8C1BC402, 0x8C1C0402, 0x8C1C4402, 0x8C1C8402, 0x8C1CC402, 0x8C1D0402,
+		0x8C1D4402, 0x8C1D8402, 0x8C1DC402, 0x8C1E0402, 0x8C1E4402, 0x8C1E8402, 0x8C1EC402, 0x8C1F0402,
+		0x8C1F4402, 0x8C1F8402, 0x8C1FC402, 0x8C200402, 0x8C204402, 0x8C208402, 0x8C20C402, 0x8C210402,
+		0x8C214402, 0x8C218402, 0x8C21C402, 0x8C220402, 0x8C224402, 0x8C228402, 0x8C22C402, 0x8C230402,
+		0x8C234402, 0x8C238402, 0x8C23C402, 0x8C240402, 0x8C244402, 0x8C248402, 0x8C24C402, 0x8C250402,
+		0x8C254402, 0x8C258402, 0x8C25C402, 0x8C260402, 0x8C264402, 0x8C268402, 0x8C26C402, 0x8C270402,
+		0x8C274402, 0x8C278402, 0x8C27C402, 0x8C280402, 0x8C284402, 0x8C288402, 0x8C28C402, 0x80001882,
+		0x800018A2, 0x8C290402, 0x80001842, 0xC128C402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x926BC408, 0x926C0408, 0x926C4408, 0x926C8408, 0x926CC408, 0x926D0408, 0x926D4408, 0x926D8408,
+		0x926DC408, 0x926E0408, 0x926E4408, 0x926E8408, 0x926EC408, 0x926F0408, 0x926F4408, 0x926F8408,
+		0x926FC408, 0x92700408, 0x92704408, 0x92708408, 0x9270C408, 0x92710408, 0x92714408, 0x92718408,
+		0x9271C408, 0x92720408, 0x92724408, 0x92728408, 0x9272C408, 0x92730408, 0x92734408, 0x92738408,
+		0x926BC402, 0x926C0402, 0x926C4402, 0x926C8402, 0x926CC402, 0x926D0402, 0x926D4402, 0x926D8402,
+		0x926DC402, 0x926E0402, 0x926E4402, 0x926E8402, 0x926EC402, 0x926F0402, 0x926F4402, 0x926F8402,
+		0x926FC402, 0x92700402, 0x92704402, 0x92708402, 0x9270C402, 0x92710402, 0x92714402, 0x92718402,
+		0x9271C402, 0x92720402, 0x92724402, 0x92728402, 0x9272C402, 0x92730402, 0x92734402, 0x92738402,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0xC79E0402, 0xC79E4402, 0xC79E8402, 0xC79EC402, 0xC79F0402, 0xC79F4402,
+		0xC79F8402, 0xC79FC402, 0xC7A00402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x926B8402,
+		0x8BFDC402, 0x8BFE0402, 0x8BFE4402, 0x8BFE8402, 0x8BFEC402, 0x8BFF0402, 0x8BFF4402, 0x00000000,
+		0x00000000, 0x8BFF8402, 0x00000000, 0x00000000, 0x8BFFC402, 0x8C000402, 0x8C004402, 0x8C008402,
+		0x8C00C402, 0x8C014402, 0x8C018402, 0x8C01C402, 0x00000000, 0x8C020402, 0x8C024402, 0x00000000,
+		0x8C028402, 0x8C02C402, 0x8C030402, 0x8C034402, 0x8C038402, 0x8C03C402, 0x8C040402, 0x8C044402,
+		0x8C048402, 0x8C04C402, 0x8C050402, 0x8C054402, 0x8C058402, 0x8C05C402, 0x8C064402, 0x8C06C402,
+		0x8C074402, 0x8C078402, 0x8C07C402, 0x8C080402, 0x8C084402, 0x8C088402, 0x8C08C402, 0x8C090402,
+		0x8C094402, 0x8C098402, 0x8C09C402, 0x8C0A0402, 0x8C0A4402, 0x00011BA1, 0x00000000, 0x8C0AC402,
+		0x00000000, 0x00000000, 0x00000000, 0x80001882, 0x80001862, 0x8C0B4402, 0x8C0B8402, 0x8C010402,
+		0x8C060402, 0x8C068402, 0x8C070402, 0x80001842, 0xC0B18402, 0xC1290402, 0xC0BD8402, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8C0BC402, 0x8C0C0402, 0x8C0C4402, 0x8C0C8402, 0x8C0CC402, 0x8C0D0402, 0x8C0D4402, 0x8C0D8402,
+		0x00000000, 0x00000000, 0x8C0DC402, 0x8C0E0402, 0x8C0E4402, 0x8C0E8402, 0x8C0EC402, 0x8C0F0402,
+		0x8C0F4402, 0x8C0F8402, 0x8C0FC402, 0x8C100402, 0x8C104402, 0x8C108402, 0x8C10C402, 0x8C110402,
+		0x8C114402, 0x8C118402, 0x8C11C402, 0x8C120402, 0x8C124402, 0x8C128402, 0x8C12C402, 0x8C130402,
+		0x8C134402, 0x8C138402, 0x8C13C402, 0x8C140402, 0x8C144402, 0x8C148402, 0x8C14C402, 0x8C150402,
+		0x8C154402, 0x8C158402, 0x8C15C402, 0x8C160402, 0x8C164402, 0x8C168402, 0x8C16C402, 0x8C170402,
+		0x8C174402, 0x8C180402, 0x8C184402, 0x8C188402, 0x8C18C402, 0x8C190402, 0x8C194402, 0x8C198402,
+		0x00000000, 0x00000000, 0x8C19C402, 0x8C1A4402, 0x8C1A8402, 0x8C1AC402, 0x80001882, 0x800018A2,
+		0x8C1B0402, 0x8C178402, 0xC1294402, 0x8C17C402, 0x8C1A0402, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8CD84402, 0x8CD88402, 0x8CD8C402, 0x8CD90402, 0x8CD94402, 0x8CD98402, 0x8CD9C402, 0x8CDA0402,
+		0x8CDA4402, 0x8CDA8402, 0x8CDAC402, 0x8CCE4402, 0x8CCEC402, 0x8CCF0402, 0x8CCF4402, 0x8CCF8402,
+		0x8CCFC402, 0x8CD00402, 0x8CD04402, 0x8CD08402, 0x8CD0C402, 0x8CD10402, 0x8CD14402, 0x8CD18402,
+		0x8CD1C402, 0x8CD20402, 0x8CD24402, 0x8CD28402, 0x8CD2C402, 0x8CD30402, 0x8CD34402, 0x8CD38402,
+		0x8CD3C402, 0x8CD40402, 0x8CD44402, 0x8CD48402, 0x8CD4C402, 0x8CD50402, 0x8CD54402, 0x8CD58402,
+		0x8CD5C402, 0x8CD60402, 0x8CD64402, 0x8CD68402, 0x8CD6C402, 0x8CD70402, 0x8CD74402, 0x8CD78402,
+		0x8CD7C402, 0x8CD80402, 0x8CCE8402, 0x80001842, 0x8CDB0402, 0x80001862, 0x80001862, 0x80001862,
+		0x80001882, 0x800018A2, 0x8CD68417, 0x8CD64419, 0x8CD68419, 0x8CD6C419, 0x8CD70419, 0xC1098402,
+		0xC109C402, 0xC10A0402, 0xC10A4402, 0xC10A8402, 0xC10AC402, 0xC10B0402, 0xC10B4402, 0x8CDB4402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8CDB8402, 0x8CDBC402, 0x8CDC0402, 0x8CDC4402, 0x8CDD0402, 0x8CDD8402, 0x8CDD4402, 0x8CDDC402,
+		0x8CDE0402, 0x8CDC8402, 0x8CDCC402, 0x8CDE4402, 0x8CDE8402, 0x8CDF0402, 0x8CDF4402, 0x8CDF8402,
+		0x8CDFC402, 0x8CE00402, 0x8CE04402, 0x8CE08402, 0x8CE0C402, 0x8CE10402, 0x8CE14402, 0x8CE18402,
+		0x8CE1C402, 0x8CE20402, 0x8CE24402, 0x8CE28402, 0x8CE2C402, 0x8CE30402, 0x8CE34402, 0x8CE38402,
+		0x8CE3C402, 0x8CE40402, 0x8CE44402, 0x8CE48402, 0x8CE4C402, 0x8CE50402, 0x8CE54402, 0x8CE58402,
+		0x8CE5C402, 0x8CE60402, 0x8CE64402, 0x8CE68402, 0x8CE6C402, 0x8CE70402, 0x8CE74402, 0x8CE78402,
+		0x8CE7C402, 0x8CE80402, 0x8CE84402, 0x8CDEC402, 0x8CE88402, 0x8CE8C402, 0x8CE6C417, 0x8CE70417,
+		0x8CE78417, 0x8CE80417, 0x8CDE8419, 0x8CDF0419, 0x8CDFC419, 0x8CE28419, 0x8CE38419, 0x8CE3C419,
+		0x8CE4C419, 0x8CE6C419, 0x8CE70419, 0x8CE78419, 0x8CE80419, 0x8CE64419, 0x80001882, 0x800018A2,
+		0x80001A42, 0x8CE90402, 0xC10B8402, 0xC10BC402, 0xC10C0402, 0x8CE94402, 0xC10C4402, 0xC10C8402,
+		0xC10CC402, 0xC10D0402, 0xC10D4402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x92758402, 0x9275C402, 0x92760402, 0x92764402, 0x92768402, 0x9276C402, 0x92770402, 0x92774402,
+		0x92778402, 0x9277C402, 0x92780402, 0x92784402, 0x92788402, 0x9278C402, 0x92790402, 0x92794402,
+		0x92798402, 0x9279C402, 0x927A0402, 0x927A4402, 0x927A8402, 0x9273C402, 0x92740402, 0x92744402,
+		0x92748402, 0x9274C402, 0x92750402, 0x92754402, 0x927AC402, 0x927B0402, 0x927C8402, 0x927B4402,
+		0x927B8402, 0x927BC402, 0x927C0402, 0x927C4402, 0x927CC402, 0x927E4402, 0x927DC402, 0x92814402,
+		0x927E8402, 0x927E0402, 0x92818402, 0x92804402, 0x927FC402, 0x92808402, 0x92800402, 0x927D0402,
+		0x9281C402, 0x927D8402, 0x927D4402, 0x927F4402, 0x927EC402, 0x9280C402, 0x927F8402, 0x927F0402,
+		0x92810402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8C76C402, 0x8C770402, 0x8C774402, 0x8C778402, 0x8C77C402, 0x8C780402, 0x8C784402, 0x8C788402,
+		0x8C78C402, 0x00000000, 0x8C790402, 0x8C794402, 0x8C798402, 0x8C79C402, 0x8C7A0402, 0x8C7A4402,
+		0x8C7A8402, 0x8C7AC402, 0x8C7B0402, 0x8C7B4402, 0x8C7B8402, 0x8C7BC402, 0x8C7C0402, 0x8C7C4402,
+		0x8C7C8402, 0x8C7CC402, 0x8C7D0402, 0x8C7D4402, 0x8C7D8402, 0x8C7DC402, 0x8C7E0402, 0x8C7E4402,
+		0x8C7E8402, 0x8C7EC402, 0x8C7F0402, 0x8C7F4402, 0x8C7F8402, 0x8C7FC402, 0x8C800402, 0x8C804402,
+		0x8C808402, 0x8C80C402, 0x8C810402, 0x8C814402, 0x8C818402, 0x8C81C402, 0x8C820402, 0x8C828402,
+		0x8C82C402, 0x8C830402, 0x8C834402, 0x8C838402, 0x8C83C402, 0x8C840402, 0x8C844402, 0x00000000,
+		0x8C848402, 0x8C84C402, 0x8C850402, 0x8C854402, 0x80001862, 0x80001882, 0x800018A2, 0x8C858402,
+		0x8C824402, 0xC0B1C402, 0xC0B20402, 0xC11AC402, 0xC11B0402, 0xC11B4402, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402,
+		0x87E7C402, 0x87E80402, 0x87E84402, 0xC798C402, 0xC7990402, 0xC7994402, 0xC7998402, 0xC799C402,
+		0xC79A0402, 0xC79A4402, 0xC79A8402, 0xC79AC402, 0xC79B0402, 0x00000000, 0x00000000, 0x00000000,
+		0xC10D8402, 0xC10DC402, 0x8CE98402, 0x8CEA0402, 0x8CEA8402, 0x8CEB0402, 0x8CEB8402, 0x8CEC0402,
+		0x8CEC8402, 0x8CED0402, 0x8CED8402, 0x8CEE0402, 0x8CEE8402, 0x8CEF0402, 0x8CEF8402, 0x8CF00402,
+		0x8CF08402, 0x8CF10402, 0x8CF18402, 0x8CF20402, 0x8CF28402, 0x8CF30402, 0x8CF38402, 0x8CF40402,
+		0x8CF48402, 0x8CF4C402, 0x8CF54402, 0x8CF5C402, 0x8CF64402, 0x8CF6C402, 0x8CF74402, 0x8CF7C402,
+		0x00000000, 0x00000000, 0x8CE9C402, 0x8CEA4402, 0x8CEAC402, 0x8CEB4402, 0x8CEBC402, 0x8CEC4402,
+		0x8CECC402, 0x8CED4402, 0x8CEDC402, 0x8CEE4402, 0x8CEEC402, 0x8CEF4402, 0x8CEFC402, 0x8CF04402,
+		0x8CF0C402, 0x8CF14402, 0x8CF1C402, 0x8CF24402, 0x8CF2C402, 0x8CF34402, 0x8CF3C402, 0x8CF44402,
+		0x00000000, 0x8CF50402, 0x8CF58402, 0x8CF60402, 0x8CF68402, 0x8CF70402, 0x8CF78402, 0x8CF80402,
+		0x8CF84402, 0x8CF88402, 0x8CF8C402, 0x8CF90402, 0x8CF94402, 0x80001882, 0x80001862, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8C330402, 0x8C334402, 0x8C338402, 0x8C33C402, 0x8C340402, 0x8C344402, 0x8C348402, 0x00000000,
+		0x8C34C402, 0x8C350402, 0x00000000, 0x8C354402, 0x8C358402, 0x8C35C402, 0x8C360402, 0x8C364402,
+		0x8C368402, 0x8C36C402, 0x8C370402, 0x8C374402, 0x8C378402, 0x8C37C402, 0x8C380402, 0x8C384402,
+		0x8C388402, 0x8C38C402, 0x8C390402, 0x8C394402, 0x8C398402, 0x8C39C402, 0x8C3A0402, 0x8C3A4402,
+		0x8C3A8402, 0x8C3AC402, 0x8C3B0402, 0x8C3B4402, 0x8C3B8402, 0x8C3BC402, 0x8C3C0402, 0x8C3C4402,
+		0x8C3C8402, 0x8C3CC402, 0x8C3D0402, 0x8C3D4402, 0x8C3D8402, 0x8C3DC402, 0x8C3E0402, 0x8C3E4402,
+		0x8C3E8402, 0x8C3EC402, 0x8C3F0402, 0x8C3F4402, 0x8C3F8402, 0x8C3FC402, 0x8C400402, 0x00000000,
+		0x00000000, 0x00000000, 0x8C404402, 0x00000000, 0x8C408402, 0x8C40C402, 0x00000000, 0x8C410402,
+		0x80001882, 0x800018A2, 0x80001842, 0x80001862, 0x8C414402, 0x8C418402, 0x8C3C0417, 0x8C3C0419,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8C420402, 0x8C424402, 0x8C428402, 0x8C42C402, 0x8C430402, 0x8C434402, 0x00000000, 0x8C438402,
+		0x8C43C402, 0x00000000, 0x8C440402, 0x8C444402, 0x8C448402, 0x8C44C402, 0x8C450402, 0x8C454402,
+		0x8C458402, 0x8C45C402, 0x8C460402, 0x8C464402, 0x8C468402, 0x8C46C402, 0x8C470402, 0x8C474402,
+		0x8C478402, 0x8C47C402, 0x8C480402, 0x8C484402, 0x8C488402, 0x8C48C402, 0x8C490402, 0x8C494402,
+		0x8C498402, 0x8C49C402, 0x8C4A0402, 0x8C4A4402, 0x8C4A8402, 0x8C4AC402, 0x8C4B0402, 0x8C4B4402,
+		0x8C4B8402, 0x8C4BC402, 0x8C4C0402, 0x8C4C4402, 0x8C4C8402, 0x8C4CC402, 0x8C4D0402, 0x00000000,
+		0x8C4D4402, 0x8C4D8402, 0x00000000, 0x8C4DC402, 0x8C4E0402, 0x80001882, 0x800018A2, 0x8C4E4402,
+		0x8C41C402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8D3C4402, 0x8D3C8402, 0x8D3CC402, 0x8D3D0402, 0x8D3D4402, 0x8D3D8402, 0x8D3DC402, 0x8D3E0402,
+		0x8D3E4402, 0x8D3E8402, 0x8D3EC402, 0x8D3F0402, 0x8D3F4402, 0x8D3F8402, 0x8D3FC402, 0x8D400402,
+		0x8D404402, 0x8D408402, 0x8D40C402, 0x8D410402, 0x8D414402, 0x8D418402, 0x8D41C402, 0xC0BDC402,
+		0xC0BE0402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x92448402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xC75AC402, 0xC75B0402, 0xC75B4402, 0xC75B8402, 0xC75BC402, 0xC75C0402, 0xC75C4402, 0xC75C8402,
+		0xC75CC402, 0xC75D0402, 0xC75D4402, 0xC75D8402, 0xC75DC402, 0xC75E0402, 0xC75E4402, 0xC75E8402,
+		0xC75EC402, 0xC75F0402, 0xC75F4402, 0xC75F8402, 0xC75FC402, 0xC1540402, 0xC1544402, 0xC1548402,
+		0xC154C402, 0xC1550402, 0xC1554402, 0xC1558402, 0xC155C402, 0x87DC4402, 0x87DC8402, 0x87DCC402,
+		0x87DD0402, 0xC1560402, 0xC1564402, 0xC1568402, 0xC156C402, 0xC1570402, 0xC1574402, 0xC1578402,
+		0xC157C402, 0xC1580402, 0xC1584402, 0xC1588402, 0xC158C402, 0xC1590402, 0xC1594402, 0xC1598402,
+		0xC159C402, 0xC15A0402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xC1298402,
+		0x94524402, 0x94528402, 0x9452C402, 0x94530402, 0x94534402, 0x94538402, 0x9453C402, 0x94540402,
+		0x94544402, 0x94548402, 0x9454C402, 0x94550402, 0x94554402, 0x94558402, 0x9455C402, 0x94560402,
+		0x94564402, 0x94568402, 0x9456C402, 0x94570402, 0x94574402, 0x94578402, 0x9457C402, 0x94580402,
+		0x94584402, 0x94588402, 0x9458C402, 0x94590402, 0x94594402, 0x94598402, 0x9459C402, 0x945A0402,
+		0x945A4402, 0x945A8402, 0x945AC402, 0x945B0402, 0x945B4402, 0x945B8402, 0x945BC402, 0x945C0402,
+		0x945C4402, 0x945C8402, 0x945CC402, 0x945D0402, 0x945D4402, 0x945D8402, 0x945DC402, 0x945E0402,
+		0x945E4402, 0x945E8402, 0x945EC402, 0x945F0402, 0x945F4402, 0x945F8402, 0x945FC402, 0x94600402,
+		0x94604402, 0x94608402, 0x9460C402, 0x94610402, 0x94614402, 0x94618402, 0x9461C402, 0x94620402,
+		0x94624402, 0x94628402, 0x9462C402, 0x94630402, 0x94634402, 0x94638402, 0x9463C402, 0x94640402,
+		0x94644402, 0x94648402, 0x9464C402, 0x94650402, 0x94654402, 0x94658402, 0x9465C402, 0x94660402,
+		0x94664402, 0x94668402, 0x9466C402, 0x94670402, 0x94674402, 0x94678402, 0x9467C402, 0x94680402,
+		0x94684402, 0x94688402, 0x9468C402, 0x94690402, 0x94694402, 0x94698402, 0x9469C402, 0x946A0402,
+		0x946A4402, 0x946A8402, 0x946AC402, 0x946B0402, 0x946B4402, 0x946B8402, 0x946BC402, 0x946C0402,
+		0x946C4402, 0x946C8402, 0x946CC402, 0x946D0402, 0x946D4402, 0x946D8402, 0x946DC402, 0x946E0402,
+		0x946E4402, 0x946E8402, 0x946EC402, 0x946F0402, 0x946F4402, 0x946F8402, 0x946FC402, 0x94700402,
+		0x94704402, 0x94708402, 0x9470C402, 0x94710402, 0x94714402, 0x94718402, 0x9471C402, 0x94720402,
+		0x94724402, 0x94728402, 0x9472C402, 0x94730402, 0x94734402, 0x94738402, 0x9473C402, 0x94740402,
+		0x94744402, 0x94748402, 0x9474C402, 0x94750402, 0x94754402, 0x94758402, 0x9475C402, 0x94760402,
+		0x94764402, 0x94768402, 0x9476C402, 0x94770402, 0x94774402, 0x94778402, 0x9477C402, 0x94780402,
+		0x94784402, 0x94788402, 0x9478C402, 0x94790402, 0x94794402, 0x94798402, 0x9479C402, 0x947A0402,
+		0x947A4402, 0x947A8402, 0x947AC402, 0x947B0402, 0x947B4402, 0x947B8402, 0x947BC402, 0x947C0402,
+		0x947C4402, 0x947C8402, 0x947CC402, 0x947D0402, 0x947D4402, 0x947D8402, 0x947DC402, 0x947E0402,
+		0x947E4402, 0x947E8402, 0x947EC402, 0x947F0402, 0x947F4402, 0x947F8402, 0x947FC402, 0x94800402,
+		0x94804402, 0x94808402, 0x9480C402, 0x94810402, 0x94814402, 0x94818402, 0x9481C402, 0x94820402,
+		0x94824402, 0x94828402, 0x9482C402, 0x94830402, 0x94834402, 0x94838402, 0x9483C402, 0x94840402,
+		0x94844402, 0x94848402, 0x9484C402, 0x94850402, 0x94854402, 0x94858402, 0x9485C402, 0x94860402,
+		0x94864402, 0x94868402, 0x9486C402, 0x94870402, 0x94874402, 0x94878402, 0x9487C402, 0x94880402,
+		0x94884402, 0x94888402, 0x9488C402, 0x94890402, 0x94894402, 0x94898402, 0x9489C402, 0x948A0402,
+		0x948A4402, 0x948A8402, 0x948AC402, 0x948B0402, 0x948B4402, 0x948B8402, 0x948BC402, 0x948C0402,
+		0x948C4402, 0x948C8402, 0x948CC402, 0x948D0402, 0x948D4402, 0x948D8402, 0x948DC402, 0x948E0402,
+		0x948E4402, 0x948E8402, 0x948EC402, 0x948F0402, 0x948F4402, 0x948F8402, 0x948FC402, 0x94900402,
+		0x94904402, 0x94908402, 0x9490C402, 0x94910402, 0x94914402, 0x94918402, 0x9491C402, 0x94920402,
+		0x94924402, 0x94928402, 0x9492C402, 0x94930402, 0x94934402, 0x94938402, 0x9493C402, 0x94940402,
+		0x94944402, 0x94948402, 0x9494C402, 0x94950402, 0x94954402, 0x94958402, 0x9495C402, 0x94960402,
+		0x94964402, 0x94968402, 0x9496C402, 0x94970402, 0x94974402, 0x94978402, 0x9497C402, 0x94980402,
+		0x94984402, 0x94988402, 0x9498C402, 0x94990402, 0x94994402, 0x94998402, 0x9499C402, 0x949A0402,
+		0x949A4402, 0x949A8402, 0x949AC402, 0x949B0402, 0x949B4402, 0x949B8402, 0x949BC402, 0x949C0402,
+		0x949C4402, 0x949C8402, 0x949CC402, 0x949D0402, 0x949D4402, 0x949D8402, 0x949DC402, 0x949E0402,
+		0x949E4402, 0x949E8402, 0x949EC402, 0x949F0402, 0x949F4402, 0x949F8402, 0x949FC402, 0x94A00402,
+		0x94A04402, 0x94A08402, 0x94A0C402, 0x94A10402, 0x94A14402, 0x94A18402, 0x94A1C402, 0x94A20402,
+		0x94A24402, 0x94A28402, 0x94A2C402, 0x94A30402, 0x94A34402, 0x94A38402, 0x94A3C402, 0x94A40402,
+		0x94A44402, 0x94A48402, 0x94A4C402, 0x94A50402, 0x94A54402, 0x94A58402, 0x94A5C402, 0x94A60402,
+		0x94A64402, 0x94A68402, 0x94A6C402, 0x94A70402, 0x94A74402, 0x94A78402, 0x94A7C402, 0x94A80402,
+		0x94A84402, 0x94A88402, 0x94A8C402, 0x94A90402, 0x94A94402, 0x94A98402, 0x94A9C402, 0x94AA0402,
+		0x94AA4402, 0x94AA8402, 0x94AAC402, 0x94AB0402, 0x94AB4402, 0x94AB8402, 0x94ABC402, 0x94AC0402,
+		0x94AC4402, 0x94AC8402, 0x94ACC402, 0x94AD0402, 0x94AD4402, 0x94AD8402, 0x94ADC402, 0x94AE0402,
+		0x94AE4402, 0x94AE8402, 0x94AEC402, 0x94AF0402, 0x94AF4402, 0x94AF8402, 0x94AFC402, 0x94B00402,
+		0x94B04402, 0x94B08402, 0x94B0C402, 0x94B10402, 0x94B14402, 0x94B18402, 0x94B1C402, 0x94B20402,
+		0x94B24402, 0x94B28402, 0x94B2C402, 0x94B30402, 0x94B34402, 0x94B38402, 0x94B3C402, 0x94B40402,
+		0x94B44402, 0x94B48402, 0x94B4C402, 0x94B50402, 0x94B54402, 0x94B58402, 0x94B5C402, 0x94B60402,
+		0x94B64402, 0x94B68402, 0x94B6C402, 0x94B70402, 0x94B74402, 0x94B78402, 0x94B7C402, 0x94B80402,
+		0x94B84402, 0x94B88402, 0x94B8C402, 0x94B90402, 0x94B94402, 0x94B98402, 0x94B9C402, 0x94BA0402,
+		0x94BA4402, 0x94BA8402, 0x94BAC402, 0x94BB0402, 0x94BB4402, 0x94BB8402, 0x94BBC402, 0x94BC0402,
+		0x94BC4402, 0x94BC8402, 0x94BCC402, 0x94BD0402, 0x94BD4402, 0x94BD8402, 0x94BDC402, 0x94BE0402,
+		0x94BE4402, 0x94BE8402, 0x94BEC402, 0x94BF0402, 0x94BF4402, 0x94BF8402, 0x94BFC402, 0x94C00402,
+		0x94C04402, 0x94C08402, 0x94C0C402, 0x94C10402, 0x94C14402, 0x94C18402, 0x94C1C402, 0x94C20402,
+		0x94C24402, 0x94C28402, 0x94C2C402, 0x94C30402, 0x94C34402, 0x94C38402, 0x94C3C402, 0x94C40402,
+		0x94C44402, 0x94C48402, 0x94C4C402, 0x94C50402, 0x94C54402, 0x94C58402, 0x94C5C402, 0x94C60402,
+		0x94C64402, 0x94C68402, 0x94C6C402, 0x94C70402, 0x94C74402, 0x94C78402, 0x94C7C402, 0x94C80402,
+		0x94C84402, 0x94C88402, 0x94C8C402, 0x94C90402, 0x94C94402, 0x94C98402, 0x94C9C402, 0x94CA0402,
+		0x94CA4402, 0x94CA8402, 0x94CAC402, 0x94CB0402, 0x94CB4402, 0x94CB8402, 0x94CBC402, 0x94CC0402,
+		0x94CC4402, 0x94CC8402, 0x94CCC402, 0x94CD0402, 0x94CD4402, 0x94CD8402, 0x94CDC402, 0x94CE0402,
+		0x94CE4402, 0x94CE8402, 0x94CEC402, 0x94CF0402, 0x94CF4402, 0x94CF8402, 0x94CFC402, 0x94D00402,
+		0x94D04402, 0x94D08402, 0x94D0C402, 0x94D10402, 0x94D14402, 0x94D18402, 0x94D1C402, 0x94D20402,
+		0x94D24402, 0x94D28402, 0x94D2C402, 0x94D30402, 0x94D34402, 0x94D38402, 0x94D3C402, 0x94D40402,
+		0x94D44402, 0x94D48402, 0x94D4C402, 0x94D50402, 0x94D54402, 0x94D58402, 0x94D5C402, 0x94D60402,
+		0x94D64402, 0x94D68402, 0x94D6C402, 0x94D70402, 0x94D74402, 0x94D78402, 0x94D7C402, 0x94D80402,
+		0x94D84402, 0x94D88402, 0x94D8C402, 0x94D90402, 0x94D94402, 0x94D98402, 0x94D9C402, 0x94DA0402,
+		0x94DA4402, 0x94DA8402, 0x94DAC402, 0x94DB0402, 0x94DB4402, 0x94DB8402, 0x94DBC402, 0x94DC0402,
+		0x94DC4402, 0x94DC8402, 0x94DCC402, 0x94DD0402, 0x94DD4402, 0x94DD8402, 0x94DDC402, 0x94DE0402,
+		0x94DE4402, 0x94DE8402, 0x94DEC402, 0x94DF0402, 0x94DF4402, 0x94DF8402, 0x94DFC402, 0x94E00402,
+		0x94E04402, 0x94E08402, 0x94E0C402, 0x94E10402, 0x94E14402, 0x94E18402, 0x94E1C402, 0x94E20402,
+		0x94E24402, 0x94E28402, 0x94E2C402, 0x94E30402, 0x94E34402, 0x94E38402, 0x94E3C402, 0x94E40402,
+		0x94E44402, 0x94E48402, 0x94E4C402, 0x94E50402, 0x94E54402, 0x94E58402, 0x94E5C402, 0x94E60402,
+		0x94E64402, 0x94E68402, 0x94E6C402, 0x94E70402, 0x94E74402, 0x94E78402, 0x94E7C402, 0x94E80402,
+		0x94E84402, 0x94E88402, 0x94E8C402, 0x94E90402, 0x94E94402, 0x94E98402, 0x94E9C402, 0x94EA0402,
+		0x94EA4402, 0x94EA8402, 0x94EAC402, 0x94EB8402, 0x94EBC402, 0x94EC0402, 0x94EC4402, 0x94EC8402,
+		0x94ECC402, 0x94ED0402, 0x94ED4402, 0x94ED8402, 0x94EDC402, 0x94EE0402, 0x94EE4402, 0x94EE8402,
+		0x94EEC402, 0x94EF0402, 0x94EF4402, 0x94EF8402, 0x94EFC402, 0x94F00402, 0x94F04402, 0x94F08402,
+		0x94F0C402, 0x94F10402, 0x94F14402, 0x94F18402, 0x94F1C402, 0x94F20402, 0x94F24402, 0x94F28402,
+		0x94F2C402, 0x94F30402, 0x94F34402, 0x94F38402, 0x94F3C402, 0x94F40402, 0x94F44402, 0x94F48402,
+		0x94F4C402, 0x94F50402, 0x94F54402, 0x94F58402, 0x94F5C402, 0x94F60402, 0x94F64402, 0x94F68402,
+		0x94F6C402, 0x94F70402, 0x94F74402, 0x94F78402, 0x94F7C402, 0x94F80402, 0x94F84402, 0x94F88402,
+		0x94F8C402, 0x94F90402, 0x94F94402, 0x94F98402, 0x94F9C402, 0x94FA0402, 0x94FA4402, 0x94FA8402,
+		0x94FAC402, 0x94FB0402, 0x94FB4402, 0x94FB8402, 0x94FBC402, 0x94FC0402, 0x94FC4402, 0x94FC8402,
+		0x94FCC402, 0x94FD0402, 0x94FD4402, 0x94FD8402, 0x94FDC402, 0x94FE0402, 0x94FE4402, 0x94FE8402,
+		0x94FEC402, 0x94FF0402, 0x94FF4402, 0x94FF8402, 0x94FFC402, 0x95000402, 0x95004402, 0x95008402,
+		0x9500C402, 0x95010402, 0x95014402, 0x95018402, 0x9501C402, 0x95020402, 0x95024402, 0x95028402,
+		0x9502C402, 0x95030402, 0x95034402, 0x95038402, 0x9503C402, 0x95040402, 0x95044402, 0x95048402,
+		0x9504C402, 0x95050402, 0x95054402, 0x95058402, 0x9505C402, 0x95060402, 0x95064402, 0x95068402,
+		0x9506C402, 0x95070402, 0x95074402, 0x95078402, 0x94EB0402, 0x94EB4402, 0x9507C402, 0x95080402,
+		0x95084402, 0x95088402, 0x9508C402, 0x95090402, 0x95094402, 0x95098402, 0x9509C402, 0x950A0402,
+		0x950A4402, 0x950A8402, 0x950AC402, 0x950B0402, 0x950B4402, 0x950B8402, 0x950BC402, 0x950C0402,
+		0x950C4402, 0x950C8402, 0x950CC402, 0x950D0402, 0x950D4402, 0x950D8402, 0x950DC402, 0x950E0402,
+		0x950E4402, 0x950E8402, 0x950EC402, 0x950F0402, 0x950F4402, 0x950F8402, 0x950FC402, 0x95100402,
+		0x95104402, 0x95108402, 0x9510C402, 0x95110402, 0x95114402, 0x95118402, 0x9511C402, 0x95120402,
+		0x95124402, 0x95128402, 0x9512C402, 0x95130402, 0x95134402, 0x95138402, 0x9513C402, 0x95140402,
+		0x95144402, 0x95148402, 0x9514C402, 0x95150402, 0x95154402, 0x95158402, 0x9515C402, 0x95160402,
+		0x95164402, 0x95168402, 0x9516C402, 0x95170402, 0x95174402, 0x95178402, 0x9517C402, 0x95180402,
+		0x95184402, 0x95188402, 0x9518C402, 0x95190402, 0x95194402, 0x95198402, 0x9519C402, 0x951A0402,
+		0x951A4402, 0x951A8402, 0x951AC402, 0x951B0402, 0x951B4402, 0x951B8402, 0x951BC402, 0x951C0402,
+		0x951C4402, 0x951C8402, 0x951CC402, 0x951D0402, 0x951D4402, 0x951D8402, 0x951DC402, 0x951E0402,
+		0x951E4402, 0x951E8402, 0x951EC402, 0x951F0402, 0x951F4402, 0x951F8402, 0x951FC402, 0x95200402,
+		0x95204402, 0x95208402, 0x9520C402, 0x95210402, 0x95214402, 0x95218402, 0x9521C402, 0x95220402,
+		0x95224402, 0x95228402, 0x9522C402, 0x95230402, 0x95234402, 0x95238402, 0x9523C402, 0x95240402,
+		0x95244402, 0x95248402, 0x9524C402, 0x95250402, 0x95254402, 0x95258402, 0x9525C402, 0x95260402,
+		0x95264402, 0x95268402, 0x9526C402, 0x95270402, 0x95274402, 0x95278402, 0x9527C402, 0x95280402,
+		0x95284402, 0x95288402, 0x9528C402, 0x95290402, 0x95294402, 0x95298402, 0x9529C402, 0x952A0402,
+		0x952A4402, 0x952A8402, 0x952AC402, 0x952B0402, 0x952B4402, 0x952B8402, 0x952BC402, 0x952C0402,
+		0x952C4402, 0x952C8402, 0x952CC402, 0x952D0402, 0x952D4402, 0x952D8402, 0x952DC402, 0x952E0402,
+		0x952E4402, 0x952E8402, 0x952EC402, 0x952F0402, 0x952F4402, 0x952F8402, 0x952FC402, 0x95300402,
+		0x95304402, 0x95308402, 0x9530C402, 0x95310402, 0x95314402, 0x95318402, 0x9531C402, 0x95320402,
+		0x95324402, 0x95328402, 0x9532C402, 0x95330402, 0x95334402, 0x95338402, 0x9533C402, 0x95340402,
+		0x95344402, 0x95348402, 0x9534C402, 0x95350402, 0x95354402, 0x95358402, 0x9535C402, 0x95360402,
+		0x95364402, 0x95368402, 0x9536C402, 0x95370402, 0x95374402, 0x95378402, 0x9537C402, 0x95380402,
+		0x95384402, 0x95388402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402, 0x87E80402, 0x87E84402,
+		0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402, 0x87E80402, 0x87E84402, 0x87E70402,
+		0x87E74402, 0x87E78402, 0x87E7C402, 0x87E80402, 0x87E84402, 0x87E64402, 0x87E68402, 0x87E6C402,
+		0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402, 0x87E80402, 0x87E84402, 0x87E64402, 0x87E68402,
+		0x87E6C402, 0x87E70402, 0x87E74402, 0x87E68402, 0x87E6C402, 0x87E6C402, 0x87E70402, 0x87E74402,
+		0x87E78402, 0x87E7C402, 0x87E80402, 0x87E84402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E6C402,
+		0x87E70402, 0x87E74402, 0xC7CB0402, 0xC7CB4402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E6C402,
+		0x87E70402, 0x87E74402, 0x87E6C402, 0x87E6C402, 0x87E70402, 0x87E70402, 0x87E70402, 0x87E70402,
+		0x87E78402, 0x87E7C402, 0x87E7C402, 0x87E7C402, 0x87E80402, 0x87E80402, 0x87E84402, 0x87E84402,
+		0x87E84402, 0x87E84402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E64402,
+		0x87E68402, 0x87E6C402, 0x87E70402, 0x87E70402, 0x87E74402, 0x87E74402, 0x87E68402, 0x87E6C402,
+		0x87E64402, 0x87E68402, 0xC7CB8402, 0xC7CBC402, 0xC7CC0402, 0xC7CC4402, 0xC7CC8402, 0xC7CCC402,
+		0xC7CD0402, 0xC7CD4402, 0xC7CD8402, 0xC7CDC402, 0xC7CE0402, 0xC7CE4402, 0xC7CE8402, 0xC7CEC402,
+		0xC7CF0402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402, 0x87E80402, 0x87E84402, 0x00000000,
+		0xC0C44402, 0xC0C48402, 0xC0C4C402, 0xC0C50402, 0xC0C54402, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x9538C402, 0x95390402, 0x95394402, 0x95398402, 0x9539C402, 0x953A0402, 0x953A4402, 0x953A8402,
+		0x953AC402, 0x953B0402, 0x953B4402, 0x953B8402, 0x953BC402, 0x953C0402, 0x953C4402, 0x953C8402,
+		0x953CC402, 0x953D0402, 0x953D4402, 0x953D8402, 0x953DC402, 0x953E0402, 0x953E4402, 0x953E8402,
+		0x953EC402, 0x953F0402, 0x953F4402, 0x953F8402, 0x953FC402, 0x95400402, 0x95404402, 0x95408402,
+		0x9540C402, 0x95410402, 0x95414402, 0x95418402, 0x9541C402, 0x95420402, 0x95424402, 0x95428402,
+		0x9542C402, 0x95430402, 0x95434402, 0x95438402, 0x9543C402, 0x95440402, 0x95444402, 0x95448402,
+		0x9544C402, 0x95450402, 0x95454402, 0x95458402, 0x9545C402, 0x95460402, 0x95464402, 0x95468402,
+		0x9546C402, 0x95470402, 0x95474402, 0x95478402, 0x9547C402, 0x95480402, 0x95484402, 0x95488402,
+		0x9548C402, 0x95490402, 0x95494402, 0x95498402, 0x9549C402, 0x954A0402, 0x954A4402, 0x954A8402,
+		0x954AC402, 0x954B0402, 0x954B4402, 0x954B8402, 0x954BC402, 0x954C0402, 0x954C4402, 0x954C8402,
+		0x954CC402, 0x954D0402, 0x954D4402, 0x954D8402, 0x954DC402, 0x954E0402, 0x954E4402, 0x954E8402,
+		0x954EC402, 0x954F0402, 0x954F4402, 0x954F8402, 0x954FC402, 0x95500402, 0x95504402, 0x95508402,
+		0x9550C402, 0x95510402, 0x95514402, 0x95518402, 0x9551C402, 0x95520402, 0x95524402, 0x95528402,
+		0x9552C402, 0x95530402, 0x95534402, 0x95538402, 0x9553C402, 0x95540402, 0x95544402, 0x95548402,
+		0x9554C402, 0x95550402, 0x95554402, 0x95558402, 0x9555C402, 0x95560402, 0x95564402, 0x95568402,
+		0x9556C402, 0x95570402, 0x95574402, 0x95578402, 0x9557C402, 0x95580402, 0x95584402, 0x95588402,
+		0x9558C402, 0x95590402, 0x95594402, 0x95598402, 0x9559C402, 0x955A0402, 0x955A4402, 0x955A8402,
+		0x955AC402, 0x955B0402, 0x955B4402, 0x955B8402, 0x955BC402, 0x955C0402, 0x955C4402, 0x955C8402,
+		0x955CC402, 0x955D0402, 0x955D4402, 0x955D8402, 0x955DC402, 0x955E0402, 0x955E4402, 0x955E8402,
+		0x955EC402, 0x955F0402, 0x955F4402, 0x955F8402, 0x955FC402, 0x95600402, 0x95604402, 0x95608402,
+		0x9560C402, 0x95610402, 0x95614402, 0x95618402, 0x9561C402, 0x95620402, 0x95624402, 0x95628402,
+		0x9562C402, 0x95630402, 0x95634402, 0x95638402, 0x9563C402, 0x95640402, 0x95644402, 0x95648402,
+		0x9564C402, 0x95650402, 0x95654402, 0x95658402, 0x9565C402, 0x95660402, 0x95664402, 0x95668402,
+		0x9566C402, 0x95670402, 0x95674402, 0x95678402, 0x9567C402, 0x95680402, 0x95684402, 0x95688402,
+		0x9568C402, 0x95690402, 0x95694402, 0x95698402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x9569C402, 0x956A0402, 0x956A4402, 0x956A8402, 0x956AC402, 0x956B0402, 0x956B4402, 0x956B8402,
+		0x956BC402, 0x956C0402, 0x956C4402, 0x956C8402, 0x956CC402, 0x956D0402, 0x956D4402, 0x956D8402,
+		0x956DC402, 0x956E0402, 0x956E4402, 0x956E8402, 0x956EC402, 0x956F0402, 0x956F4402, 0x956F8402,
+		0x956FC402, 0x95700402, 0x95704402, 0x95708402, 0x9570C402, 0x95710402, 0x95714402, 0x95718402,
+		0x9571C402, 0x95720402, 0x95724402, 0x95728402, 0x9572C402, 0x95730402, 0x95734402, 0x95738402,
+		0x9573C402, 0x95740402, 0x95744402, 0x95748402, 0x9574C402, 0x95750402, 0x95754402, 0x95758402,
+		0x9575C402, 0x95760402, 0x95764402, 0x95768402, 0x9576C402, 0x95770402, 0x95774402, 0x95778402,
+		0x9577C402, 0x95780402, 0x95784402, 0x95788402, 0x9578C402, 0x95790402, 0x95794402, 0x95798402,
+		0x9579C402, 0x957A0402, 0x957A4402, 0x957A8402, 0x957AC402, 0x957B0402, 0x957B4402, 0x957B8402,
+		0x957BC402, 0x957C0402, 0x957C4402, 0x957C8402, 0x957CC402, 0x957D0402, 0x957D4402, 0x957D8402,
+		0x957DC402, 0x957E0402, 0x957E4402, 0x957E8402, 0x957EC402, 0x957F0402, 0x957F4402, 0x957F8402,
+		0x957FC402, 0x95800402, 0x95804402, 0x95808402, 0x9580C402, 0x95810402, 0x95814402, 0x95818402,
+		0x9581C402, 0x95820402, 0x95824402, 0x95828402, 0x9582C402, 0x95830402, 0x95834402, 0x95838402,
+		0x9583C402, 0x95840402, 0x95844402, 0x95848402, 0x9584C402, 0x95850402, 0x95854402, 0x95858402,
+		0x9585C402, 0x95860402, 0x95864402, 0x95868402, 0x9586C402, 0x95870402, 0x95874402, 0x95878402,
+		0x9587C402, 0x95880402, 0x95884402, 0x95888402, 0x9588C402, 0x95890402, 0x95894402, 0x95898402,
+		0x9589C402, 0x958A0402, 0x958A4402, 0x958A8402, 0x958AC402, 0x958B0402, 0x958B4402, 0x958B8402,
+		0x958BC402, 0x958C0402, 0x958C4402, 0x958C8402, 0x958CC402, 0x958D0402, 0x958D4402, 0x958D8402,
+		0x958DC402, 0x958E0402, 0x958E4402, 0x958E8402, 0x958EC402, 0x958F0402, 0x958F4402, 0x958F8402,
+		0x958FC402, 0x95900402, 0x95904402, 0x95908402, 0x9590C402, 0x95910402, 0x95914402, 0x95918402,
+		0x9591C402, 0x95920402, 0x95924402, 0x95928402, 0x9592C402, 0x95930402, 0x95934402, 0x95938402,
+		0x9593C402, 0x95940402, 0x95944402, 0x95948402, 0x9594C402, 0x95950402, 0x95954402, 0x95958402,
+		0x9595C402, 0x95960402, 0x95964402, 0x95968402, 0x9596C402, 0x95970402, 0x95974402, 0x95978402,
+		0x9597C402, 0x95980402, 0x95984402, 0x95988402, 0x9598C402, 0x95990402, 0x95994402, 0x95998402,
+		0x9599C402, 0x959A0402, 0x959A4402, 0x959A8402, 0x959AC402, 0x959B0402, 0x959B4402, 0x959B8402,
+		0x959BC402, 0x959C0402, 0x959C4402, 0x959C8402, 0x959CC402, 0x959D0402, 0x959D4402, 0x959D8402,
+		0x959DC402, 0x959E0402, 0x959E4402, 0x959E8402, 0x959EC402, 0x959F0402, 0x959F4402, 0x959F8402,
+		0x959FC402, 0x95A00402, 0x95A04402, 0x95A08402, 0x95A0C402, 0x95A10402, 0x95A14402, 0x95A18402,
+		0x95A1C402, 0x95A20402, 0x95A24402, 0x95A28402, 0x95A2C402, 0x95A30402, 0x95A34402, 0x95A38402,
+		0x95A3C402, 0x95A40402, 0x95A44402, 0x95A48402, 0x95A4C402, 0x95A50402, 0x95A54402, 0x95A58402,
+		0x95A5C402, 0x95A60402, 0x95A64402, 0x95A68402, 0x95A6C402, 0x95A70402, 0x95A74402, 0x95A78402,
+		0x95A7C402, 0x95A80402, 0x95A84402, 0x95A88402, 0x95A8C402, 0x95A90402, 0x95A94402, 0x95A98402,
+		0x95A9C402, 0x95AA0402, 0x95AA4402, 0x95AA8402, 0x95AAC402, 0x95AB0402, 0x95AB4402, 0x95AB8402,
+		0x95ABC402, 0x95AC0402, 0x95AC4402, 0x95AC8402, 0x95ACC402, 0x95AD0402, 0x95AD4402, 0x95AD8402,
+		0x95ADC402, 0x95AE0402, 0x95AE4402, 0x95AE8402, 0x95AEC402, 0x95AF0402, 0x95AF4402, 0x95AF8402,
+		0x95AFC402, 0x95B00402, 0x95B04402, 0x95B08402, 0x95B0C402, 0x95B10402, 0x95B14402, 0x95B18402,
+		0x95B1C402, 0x95B20402, 0x95B24402, 0x95B28402, 0x95B2C402, 0x95B30402, 0x95B34402, 0x95B38402,
+		0x95B3C402, 0x95B40402, 0x95B44402, 0x95B48402, 0x95B4C402, 0x95B50402, 0x95B54402, 0x95B58402,
+		0x95B5C402, 0x95B60402, 0x95B64402, 0x95B68402, 0x95B6C402, 0x95B70402, 0x95B74402, 0x95B78402,
+		0x95B7C402, 0x95B80402, 0x95B84402, 0x95B88402, 0x95B8C402, 0x95B90402, 0x95B94402, 0x95B98402,
+		0x95B9C402, 0x95BA0402, 0x95BA4402, 0x95BA8402, 0x95BAC402, 0x95BB0402, 0x95BB4402, 0x95BB8402,
+		0x95BBC402, 0x95BC0402, 0x95BC4402, 0x95BC8402, 0x95BCC402, 0x95BD0402, 0x95BD4402, 0x95BD8402,
+		0x95BDC402, 0x95BE0402, 0x95BE4402, 0x95BE8402, 0x95BEC402, 0x95BF0402, 0x95BF4402, 0x95BF8402,
+		0x95BFC402, 0x95C00402, 0x95C04402, 0x95C08402, 0x95C0C402, 0x95C10402, 0x95C14402, 0x95C18402,
+		0x95C1C402, 0x95C20402, 0x95C24402, 0x95C28402, 0x95C2C402, 0x95C30402, 0x95C34402, 0x95C38402,
+		0x95C3C402, 0x95C40402, 0x95C44402, 0x95C48402, 0x95C4C402, 0x95C50402, 0x95C54402, 0x95C58402,
+		0x95C5C402, 0x95C60402, 0x95C64402, 0x95C68402, 0x95C6C402, 0x95C70402, 0x95C74402, 0x95C78402,
+		0x95C7C402, 0x95C80402, 0x95C84402, 0x95C88402, 0x95C8C402, 0x95C90402, 0x95C94402, 0x95C98402,
+		0x95C9C402, 0x95CA0402, 0x95CA4402, 0x95CA8402, 0x95CAC402, 0x95CB0402, 0x95CB4402, 0x95CB8402,
+		0x95CBC402, 0x95CC0402, 0x95CC4402, 0x95CC8402, 0x95CCC402, 0x95CD0402, 0x95CD4402, 0x95CD8402,
+		0x95CDC402, 0x95CE0402, 0x95CE4402, 0x95CE8402, 0x95CEC402, 0x95CF0402, 0x95CF4402, 0x95CF8402,
+		0x95CFC402, 0x95D00402, 0x95D04402, 0x95D08402, 0x95D0C402, 0x95D10402, 0x95D14402, 0x95D18402,
+		0x95D1C402, 0x95D20402, 0x95D24402, 0x95D28402, 0x95D2C402, 0x95D30402, 0x95D34402, 0x95D38402,
+		0x95D3C402, 0x95D40402, 0x95D44402, 0x95D48402, 0x95D4C402, 0x95D50402, 0x95D54402, 0x95D58402,
+		0x95D5C402, 0x95D60402, 0x95D64402, 0x95D68402, 0x95D6C402, 0x95D70402, 0x95D74402, 0x95D78402,
+		0x95D7C402, 0x95D80402, 0x95D84402, 0x95D88402, 0x95D8C402, 0x95D90402, 0x95D94402, 0x95D98402,
+		0x95D9C402, 0x95DA0402, 0x95DA4402, 0x95DA8402, 0x95DAC402, 0x95DB0402, 0x95DB4402, 0x95DB8402,
+		0x95DBC402, 0x95DC0402, 0x95DC4402, 0x95DC8402, 0x95DCC402, 0x95DD0402, 0x95DD4402, 0x95DD8402,
+		0x95DDC402, 0x95DE0402, 0x95DE4402, 0x95DE8402, 0x95DEC402, 0x95DF0402, 0x95DF4402, 0x95DF8402,
+		0x95DFC402, 0x95E00402, 0x95E04402, 0x95E08402, 0x95E0C402, 0x95E10402, 0x95E14402, 0x95E18402,
+		0x95E1C402, 0x95E20402, 0x95E24402, 0x95E28402, 0x95E2C402, 0x95E30402, 0x95E34402, 0x95E38402,
+		0x95E3C402, 0x95E40402, 0x95E44402, 0x95E48402, 0x95E4C402, 0x95E50402, 0x95E54402, 0x95E58402,
+		0x95E5C402, 0x95E60402, 0x95E64402, 0x95E68402, 0x95E6C402, 0x95E70402, 0x95E74402, 0x95E78402,
+		0x95E7C402, 0x95E80402, 0x95E84402, 0x95E88402, 0x95E8C402, 0x95E90402, 0x95E94402, 0x95E98402,
+		0x95E9C402, 0x95EA0402, 0x95EA4402, 0x95EA8402, 0x95EAC402, 0x95EB0402, 0x95EB4402, 0x95EB8402,
+		0x95EBC402, 0x95EC0402, 0x95EC4402, 0x95EC8402, 0x95ECC402, 0x95ED0402, 0x95ED4402, 0x95ED8402,
+		0x95EDC402, 0x95EE0402, 0x95EE4402, 0x95EE8402, 0x95EEC402, 0x95EF0402, 0x95EF4402, 0x95EF8402,
+		0x95EFC402, 0x95F00402, 0x95F04402, 0x95F08402, 0x95F0C402, 0x95F10402, 0x95F14402, 0x95F18402,
+		0x95F1C402, 0x95F20402, 0x95F24402, 0x95F28402, 0x95F2C402, 0x95F30402, 0x95F34402, 0x95F38402,
+		0x95F3C402, 0x95F40402, 0x95F44402, 0x95F48402, 0x95F4C402, 0x95F50402, 0x95F54402, 0x95F58402,
+		0x95F5C402, 0x95F60402, 0x95F64402, 0x95F68402, 0x95F6C402, 0x95F70402, 0x95F74402, 0x95F78402,
+		0x95F7C402, 0x95F80402, 0x95F84402, 0x95F88402, 0x95F8C402, 0x95F90402, 0x95F94402, 0x95F98402,
+		0x95F9C402, 0x95FA0402, 0x95FA4402, 0x95FA8402, 0x95FAC402, 0x95FB0402, 0x95FB4402, 0x95FB8402,
+		0x95FBC402, 0x95FC0402, 0x95FC4402, 0x95FC8402, 0x95FCC402, 0x95FD0402, 0x95FD4402, 0x95FD8402,
+		0x95FDC402, 0x95FE0402, 0x95FE4402, 0x95FE8402, 0x95FEC402, 0x95FF0402, 0x95FF4402, 0x95FF8402,
+		0x95FFC402, 0x96000402, 0x96004402, 0x96008402, 0x9600C402, 0x96010402, 0x96014402, 0x96018402,
+		0x9601C402, 0x96020402, 0x96024402, 0x96028402, 0x9602C402, 0x96030402, 0x96034402, 0x96038402,
+		0x9603C402, 0x96040402, 0x96044402, 0x96048402, 0x9604C402, 0x96050402, 0x96054402, 0x96058402,
+		0x9605C402, 0x96060402, 0x96064402, 0x96068402, 0x9606C402, 0x96070402, 0x96074402, 0x96078402,
+		0x9607C402, 0x96080402, 0x96084402, 0x96088402, 0x9608C402, 0x96090402, 0x96094402, 0x96098402,
+		0x9609C402, 0x960A0402, 0x960A4402, 0x960A8402, 0x960AC402, 0x960B0402, 0x960B4402, 0x960B8402,
+		0x960BC402, 0x960C0402, 0x960C4402, 0x960C8402, 0x960CC402, 0x960D0402, 0x960D4402, 0x960D8402,
+		0x960DC402, 0x960E0402, 0x960E4402, 0x960E8402, 0x960EC402, 0x960F0402, 0x960F4402, 0x960F8402,
+		0x960FC402, 0x96100402, 0x96104402, 0x96108402, 0x9610C402, 0x96110402, 0x96114402, 0x96118402,
+		0x9611C402, 0x96120402, 0x96124402, 0x96128402, 0x9612C402, 0x96130402, 0x96134402, 0x96138402,
+		0x9613C402, 0x96140402, 0x96144402, 0x96148402, 0x9614C402, 0x96150402, 0x96154402, 0x96158402,
+		0x9615C402, 0x96160402, 0x96164402, 0x96168402, 0x9616C402, 0x96170402, 0x96174402, 0x96178402,
+		0x9617C402, 0x96180402, 0x96184402, 0x96188402, 0x9618C402, 0x96190402, 0x96194402, 0x96198402,
+		0x9619C402, 0x961A0402, 0x961A4402, 0x961A8402, 0x961AC402, 0x961B0402, 0x961B4402, 0x961B8402,
+		0x961BC402, 0x961C0402, 0x961C4402, 0x961C8402, 0x961CC402, 0x961D0402, 0x961D4402, 0x961D8402,
+		0x961DC402, 0x961E0402, 0x961E4402, 0x961E8402, 0x961EC402, 0x961F0402, 0x961F4402, 0x961F8402,
+		0x961FC402, 0x96200402, 0x96204402, 0x96208402, 0x9620C402, 0x96210402, 0x96214402, 0x96218402,
+		0x9621C402, 0x96220402, 0x96224402, 0x96228402, 0x9622C402, 0x96230402, 0x96234402, 0x96238402,
+		0x9623C402, 0x96240402, 0x96244402, 0x96248402, 0x9624C402, 0x96250402, 0x96254402, 0x96258402,
+		0x9625C402, 0x96260402, 0x96264402, 0x96268402, 0x9626C402, 0x96270402, 0x96274402, 0x96278402,
+		0x9627C402, 0x96280402, 0x96284402, 0x96288402, 0x9628C402, 0x96290402, 0x96294402, 0x96298402,
+		0x9629C402, 0x962A0402, 0x962A4402, 0x962A8402, 0x962AC402, 0x962B0402, 0x962B4402, 0x962B8402,
+		0x962BC402, 0x962C0402, 0x962C4402, 0x962C8402, 0x962CC402, 0x962D0402, 0x962D4402, 0x962D8402,
+		0x962DC402, 0x962E0402, 0x962E4402, 0x962E8402, 0x962EC402, 0x962F0402, 0x962F4402, 0x962F8402,
+		0x962FC402, 0x96300402, 0x96304402, 0x96308402, 0x9630C402, 0x96310402, 0x96314402, 0x96318402,
+		0x9631C402, 0x96320402, 0x96324402, 0x96328402, 0x9632C402, 0x96330402, 0x96334402, 0x96338402,
+		0x9633C402, 0x96340402, 0x96344402, 0x96348402, 0x9634C402, 0x96350402, 0x96354402, 0x96358402,
+		0x9635C402, 0x96360402, 0x96364402, 0x96368402, 0x9636C402, 0x96370402, 0x96374402, 0x96378402,
+		0x9637C402, 0x96380402, 0x96384402, 0x96388402, 0x9638C402, 0x96390402, 0x96394402, 0x96398402,
+		0x9639C402, 0x963A0402, 0x963A4402, 0x963A8402, 0x963AC402, 0x963B0402, 0x963B4402, 0x963B8402,
+		0x963BC402, 0x963C0402, 0x963C4402, 0x963C8402, 0x963CC402, 0x963D0402, 0x963D4402, 0x963D8402,
+		0x963DC402, 0x963E0402, 0x963E4402, 0x963E8402, 0x963EC402, 0x963F0402, 0x963F4402, 0x963F8402,
+		0x963FC402, 0x96400402, 0x96404402, 0x96408402, 0x9640C402, 0x96410402, 0x96414402, 0x96418402,
+		0x9641C402, 0x96420402, 0x96424402, 0x96428402, 0x9642C402, 0x96430402, 0x96434402, 0x96438402,
+		0x9643C402, 0x96440402, 0x96444402, 0x96448402, 0x9644C402, 0x96450402, 0x96454402, 0x96458402,
+		0x9645C402, 0x96460402, 0x96464402, 0x96468402, 0x9646C402, 0x96470402, 0x96474402, 0x96478402,
+		0x9647C402, 0x96480402, 0x96484402, 0x96488402, 0x9648C402, 0x96490402, 0x96494402, 0x96498402,
+		0x9649C402, 0x964A0402, 0x964A4402, 0x964A8402, 0x964AC402, 0x964B0402, 0x964B4402, 0x964B8402,
+		0x964BC402, 0x964C0402, 0x964C4402, 0x964C8402, 0x964CC402, 0x964D0402, 0x964D4402, 0x964D8402,
+		0x964DC402, 0x964E0402, 0x964E4402, 0x964E8402, 0x964EC402, 0x964F0402, 0x964F4402, 0x964F8402,
+		0x964FC402, 0x96500402, 0x96504402, 0x96508402, 0x9650C402, 0x96510402, 0x96514402, 0x96518402,
+		0x9651C402, 0x96520402, 0x96524402, 0x96528402, 0x9652C402, 0x96530402, 0x96534402, 0x96538402,
+		0x9653C402, 0x96540402, 0x96544402, 0x96548402, 0x9654C402, 0x96550402, 0x96554402, 0x96558402,
+		0x9655C402, 0x96560402, 0x96564402, 0x96568402, 0x9656C402, 0x96570402, 0x96574402, 0x96578402,
+		0x9657C402, 0x96580402, 0x96584402, 0x96588402, 0x9658C402, 0x96590402, 0x96594402, 0x96598402,
+		0x9659C402, 0x965A0402, 0x965A4402, 0x965A8402, 0x965AC402, 0x965B0402, 0x965B4402, 0x965B8402,
+		0x965BC402, 0x965C0402, 0x965C4402, 0x965C8402, 0x965CC402, 0x965D0402, 0x965D4402, 0x965D8402,
+		0x965DC402, 0x965E0402, 0x965E4402, 0x965E8402, 0x965EC402, 0x965F0402, 0x965F4402, 0x965F8402,
+		0x965FC402, 0x96600402, 0x96604402, 0x96608402, 0x9660C402, 0x96610402, 0x96614402, 0x96618402,
+		0x9661C402, 0x96620402, 0x96624402, 0x96628402, 0x9662C402, 0x96630402, 0x96634402, 0x96638402,
+		0x9663C402, 0x96640402, 0x96644402, 0x96648402, 0x9664C402, 0x96650402, 0x96654402, 0x96658402,
+		0x9665C402, 0x96660402, 0x96664402, 0x96668402, 0x9666C402, 0x96670402, 0x96674402, 0x96678402,
+		0x9667C402, 0x96680402, 0x96684402, 0x96688402, 0x9668C402, 0x96690402, 0x96694402, 0x96698402,
+		0x9669C402, 0x966A0402, 0x966A4402, 0x966A8402, 0x966AC402, 0x966B0402, 0x966B4402, 0x966B8402,
+		0x966BC402, 0x966C0402, 0x966C4402, 0x966C8402, 0x966CC402, 0x966D0402, 0x966D4402, 0x966D8402,
+		0x966DC402, 0x966E0402, 0x966E4402, 0x966E8402, 0x966EC402, 0x966F0402, 0x966F4402, 0x966F8402,
+		0x966FC402, 0x96700402, 0x96704402, 0x96708402, 0x9670C402, 0x96710402, 0x96714402, 0x96718402,
+		0x9671C402, 0x96720402, 0x96724402, 0x96728402, 0x9672C402, 0x96730402, 0x96734402, 0x96738402,
+		0x9673C402, 0x96740402, 0x96744402, 0x96748402, 0x9674C402, 0x96750402, 0x96754402, 0x00000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x967C4402, 0x967C8402, 0x967CC402, 0x967D0402, 0x967D4402, 0x967D8402, 0x967DC402, 0x967E0402,
+		0x967E4402, 0x967E8402, 0x967EC402, 0x967F0402, 0x967F4402, 0x967F8402, 0x967FC402, 0x96800402,
+		0x96804402, 0x96808402, 0x9680C402, 0x96810402, 0x96814402, 0x96818402, 0x9681C402, 0x96820402,
+		0x96824402, 0x96828402, 0x9682C402, 0x96830402, 0x96834402, 0x96838402, 0x9683C402, 0x96840402,
+		0x96844402, 0x96848402, 0x9684C402, 0x96850402, 0x96854402, 0x96858402, 0x9685C402, 0x96860402,
+		0x96864402, 0x96868402, 0x9686C402, 0x96870402, 0x96874402, 0x96878402, 0x9687C402, 0x96880402,
+		0x96884402, 0x96888402, 0x9688C402, 0x96890402, 0x96894402, 0x96898402, 0x9689C402, 0x968A0402,
+		0x968A4402, 0x968A8402, 0x968AC402, 0x968B0402, 0x968B4402, 0x968B8402, 0x968BC402, 0x968C0402,
+		0x968C4402, 0x968C8402, 0x968CC402, 0x968D0402, 0x968D4402, 0x968D8402, 0x968DC402, 0x968E0402,
+		0x968E4402, 0x968E8402, 0x968EC402, 0x968F0402, 0x968F4402, 0x968F8402, 0x968FC402, 0x96900402,
+		0x96904402, 0x96908402, 0x9690C402, 0x96910402, 0x96914402, 0x96918402, 0x9691C402, 0x96920402,
+		0x96924402, 0x96928402, 0x9692C402, 0x96930402, 0x96934402, 0x96938402, 0x9693C402, 0x96940402,
+		0x96944402, 0x96948402, 0x9694C402, 0x96950402, 0x96954402, 0x96958402, 0x9695C402, 0x96960402,
+		0x96964402, 0x96968402, 0x9696C402, 0x96970402, 0x96974402, 0x96978402, 0x9697C402, 0x96980402,
+		0x96984402, 0x96988402, 0x9698C402, 0x96990402, 0x96994402, 0x96998402, 0x9699C402, 0x969A0402,
+		0x969A4402, 0x969A8402, 0x969AC402, 0x969B0402, 0x969B4402, 0x969B8402, 0x969BC402, 0x969C0402,
+		0x969C4402, 0x969C8402, 0x969CC402, 0x969D0402, 0x969D4402, 0x969D8402, 0x969DC402, 0x969E0402,
+		0x969E4402, 0x969E8402, 0x969EC402, 0x969F0402, 0x969F4402, 0x969F8402, 0x969FC402, 0x96A00402,
+		0x96A04402, 0x96A08402, 0x96A0C402, 0x96A10402, 0x96A14402, 0x96A18402, 0x96A1C402, 0x96A20402,
+		0x96A24402, 0x96A28402, 0x96A2C402, 0x96A30402, 0x96A34402, 0x96A38402, 0x96A3C402, 0x96A40402,
+		0x96A44402, 0x96A48402, 0x96A4C402, 0x96A50402, 0x96A54402, 0x96A58402, 0x96A5C402, 0x96A60402,
+		0x96A64402, 0x96A68402, 0x96A6C402, 0x96A70402, 0x96A74402, 0x96A78402, 0x96A7C402, 0x96A80402,
+		0x96A84402, 0x96A88402, 0x96A8C402, 0x96A90402, 0x96A94402, 0x96A98402, 0x96A9C402, 0x96AA0402,
+		0x96AA4402, 0x96AA8402, 0x96AAC402, 0x96AB0402, 0x96AB4402, 0x96AB8402, 0x96ABC402, 0x96AC0402,
+		0x96AC4402, 0x96AC8402, 0x96ACC402, 0x96AD0402, 0x96AD4402, 0x96AD8402, 0x96ADC402, 0x96AE0402,
+		0x96AE4402, 0x96AE8402, 0x96AEC402, 0x96AF0402, 0x96AF4402, 0x96AF8402, 0x96AFC402, 0x96B00402,
+		0x96B04402, 0x96B08402, 0x96B0C402, 0x96B10402, 0x96B14402, 0x96B18402, 0x96B1C402, 0x96B20402,
+		0x96B24402, 0x96B28402, 0x96B2C402, 0x96B30402, 0x96B34402, 0x96B38402, 0x96B3C402, 0x96B40402,
+		0x96B44402, 0x96B48402, 0x96B4C402, 0x96B50402, 0x96B54402, 0x96B58402, 0x96B5C402, 0x96B60402,
+		0x96B64402, 0x96B68402, 0x96B6C402, 0x96B70402, 0x96B74402, 0x96B78402, 0x96B7C402, 0x96B80402,
+		0x96B84402, 0x96B88402, 0x96B8C402, 0x96B90402, 0x96B94402, 0x96B98402, 0x96B9C402, 0x96BA0402,
+		0x96BA4402, 0x96BA8402, 0x96BAC402, 0x96BB0402, 0x96BB4402, 0x96BB8402, 0x96BBC402, 0x96BC0402,
+		0x96BC4402, 0x96BC8402, 0x96BCC402, 0x96BD0402, 0x96BD4402, 0x96BD8402, 0x96BDC402, 0x96BE0402,
+		0x96BE4402, 0x96BE8402, 0x96BEC402, 0x96BF0402, 0x96BF4402, 0x96BF8402, 0x96BFC402, 0x96C00402,
+		0x96C04402, 0x96C08402, 0x96C0C402, 0x96C10402, 0x96C14402, 0x96C18402, 0x96C1C402, 0x96C20402,
+		0x96C24402, 0x96C28402, 0x96C2C402, 0x96C30402, 0x96C34402, 0x96C38402, 0x96C3C402, 0x96C40402,
+		0x96C44402, 0x96C48402, 0x96C4C402, 0x96C50402, 0x96C54402, 0x96C58402, 0x96C5C402, 0x96C60402,
+		0x96C64402, 0x96C68402, 0x96C6C402, 0x96C70402, 0x96C74402, 0x96C78402, 0x96C7C402, 0x96C80402,
+		0x96C84402, 0x96C88402, 0x96C8C402, 0x96C90402, 0x96C94402, 0x96C98402, 0x96C9C402, 0x96CA0402,
+		0x96CA4402, 0x96CA8402, 0x96CAC402, 0x96CB0402, 0x96CB4402, 0x96CB8402, 0x96CBC402, 0x96CC0402,
+		0x96CC4402, 0x96CC8402, 0x96CCC402, 0x96CD0402, 0x96CD4402, 0x96CD8402, 0x96CDC402, 0x96CE0402,
+		0x96CE4402, 0x96CE8402, 0x96CEC402, 0x96CF0402, 0x96CF4402, 0x96CF8402, 0x96CFC402, 0x96D00402,
+		0x96D04402, 0x96D08402, 0x96D0C402, 0x96D10402, 0x96D14402, 0x96D18402, 0x96D1C402, 0x96D20402,
+		0x96D24402, 0x96D28402, 0x96D2C402, 0x96D30402, 0x96D34402, 0x96D38402, 0x96D3C402, 0x96D40402,
+		0x96D44402, 0x96D48402, 0x96D4C402, 0x96D50402, 0x96D54402, 0x96D58402, 0x96D5C402, 0x96D60402,
+		0x96D64402, 0x96D68402, 0x96D6C402, 0x96D70402, 0x96D74402, 0x96D78402, 0x96D7C402, 0x96D80402,
+		0x96D84402, 0x96D88402, 0x96D8C402, 0x96D90402, 0x96D94402, 0x96D98402, 0x96D9C402, 0x96DA0402,
+		0x96DA4402, 0x96DA8402, 0x96DAC402, 0x96DB0402, 0x96DB4402, 0x96DB8402, 0x96DBC402, 0x96DC0402,
+		0x96DC4402, 0x96DC8402, 0x96DCC402, 0x96DD0402, 0x96DD4402, 0x96DD8402, 0x96DDC402, 0x96DE0402,
+		0x96DE4402, 0x96DE8402, 0x96DEC402, 0x96DF0402, 0x96DF4402, 0x96DF8402, 0x96DFC402, 0x96E00402,
+		0x96E04402, 0x96E08402, 0x96E0C402, 0x96E10402, 0x96E14402, 0x96E18402, 0x96E1C402, 0x96E20402,
+		0x96E24402, 0x96E28402, 0x96E2C402, 0x96E30402, 0x96E34402, 0x96E38402, 0x96E3C402, 0x96E40402,
+		0x96E44402, 0x96E48402, 0x96E4C402, 0x96E50402, 0x96E54402, 0x96E58402, 0x96E5C402, 0x96E60402,
+		0x96E64402, 0x96E68402, 0x96E6C402, 0x96E70402, 0x96E74402, 0x96E78402, 0x96E7C402, 0x96E80402,
+		0x96E84402, 0x96E88402, 0x96E8C402, 0x96E90402, 0x96E94402, 0x96E98402, 0x96E9C402, 0x96EA0402,
+		0x96EA4402, 0x96EA8402, 0x96EAC402, 0x96EB0402, 0x96EB4402, 0x96EB8402, 0x96EBC402, 0x96EC0402,
+		0x96EC4402, 0x96EC8402, 0x96ECC402, 0x96ED0402, 0x96ED4402, 0x96ED8402, 0x96EDC402, 0x96EE0402,
+		0x96EE4402, 0x96EE8402, 0x96EEC402, 0x96EF0402, 0x96EF4402, 0x96EF8402, 0x96EFC402, 0x96F00402,
+		0x96F04402, 0x96F08402, 0x96F0C402, 0x96F10402, 0x96F14402, 0x96F18402, 0x96F1C402, 0x96F20402,
+		0x96F24402, 0x96F28402, 0x96F2C402, 0x96F30402, 0x96F34402, 0x96F38402, 0x96F3C402, 0x96F40402,
+		0x96F44402, 0x96F48402, 0x96F4C402, 0x96F50402, 0x96F54402, 0x96F58402, 0x96F5C402, 0x96F60402,
+		0x96F64402, 0x96F68402, 0x96F6C402, 0x96F70402, 0x96F74402, 0x96F78402, 0x96F7C402, 0x96F80402,
+		0x96F84402, 0x96F88402, 0x96F8C402, 0x96F90402, 0x96F94402, 0x96F98402, 0x96F9C402, 0x96FA0402,
+		0x96FA4402, 0x96FA8402, 0x96FAC402, 0x96FB0402, 0x96FB4402, 0x96FB8402, 0x96FBC402, 0x96FC0402,
+		0x96FC4402, 0x96FC8402, 0x96FCC402, 0x96FD0402, 0x96FD4402, 0x96FD8402, 0x96FDC402, 0x96FE0402,
+		0x96FE4402, 0x96FE8402, 0x96FEC402, 0x96FF0402, 0x96FF4402, 0x96FF8402, 0x96FFC402, 0x97000402,
+		0x97004402, 0x97008402, 0x9700C402, 0x97010402, 0x97014402, 0x97018402, 0x9701C402, 0x97020402,
+		0x97024402, 0x97028402, 0x9702C402, 0x97030402, 0x97034402, 0x97038402, 0x9703C402, 0x97040402,
+		0x97044402, 0x97048402, 0x9704C402, 0x97050402, 0x97054402, 0x97058402, 0x9705C402, 0x97060402,
+		0x97064402, 0x97068402, 0x9706C402, 0x97070402, 0x97074402, 0x97078402, 0x9707C402, 0x97080402,
+		0x97084402, 0x97088402, 0x9708C402, 0x97090402, 0x97094402, 0x97098402, 0x9709C402, 0x970A0402,
+		0x970A4402, 0x970A8402, 0x970AC402, 0x970B0402, 0x970B4402, 0x970B8402, 0x970BC402, 0x970C0402,
+		0x970C4402, 0x970C8402, 0x970CC402, 0x970D0402, 0x970D4402, 0x970D8402, 0x970DC402, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x8F858402, 0x8F85C402, 0x8F860402, 0x8F864402, 0x8F868402, 0x8F86C402, 0x8F870402, 0x8F874402,
+		0x8F878402, 0x8F87C402, 0x8F880402, 0x8F884402, 0x8F888402, 0x8F88C402, 0x8F890402, 0x8F894402,
+		0x8F898402, 0x8F89C402, 0x8F8A0402, 0x8F8A4402, 0x8F8A8402, 0x8F8AC402, 0x8F8B0402, 0x8F8B4402,
+		0x8F8B8402, 0x8F8BC402, 0x8F8C0402, 0x8F8C4402, 0x8F8C8402, 0x8F8CC402, 0x8F8D0402, 0x8F8D4402,
+		0x8F8D8402, 0x8F8DC402, 0x8F8E0402, 0x8F8E4402, 0x8F8E8402, 0x8F8EC402, 0x8F8F0402, 0x8F8F4402,
+		0x8F8F8402, 0x8F8FC402, 0x8F900402, 0x8F904402, 0x8F908402, 0x8F90C402, 0x8F910402, 0x8F914402,
+		0x8F918402, 0x8F91C402, 0x8F920402, 0x8F924402, 0x8F928402, 0x8F92C402, 0x8F930402, 0x8F934402,
+		0x8F938402, 0x8F93C402, 0x8F940402, 0x8F944402, 0x8F948402, 0x8F94C402, 0x8F950402, 0x8F954402,
+		0x8F958402, 0x8F95C402, 0x8F960402, 0x8F964402, 0x8F968402, 0x8F96C402, 0x8F970402, 0x8F974402,
+		0x8F978402, 0x8F97C402, 0x8F980402, 0x8F984402, 0x8F988402, 0x8F98C402, 0x8F990402, 0x8F994402,
+		0x8F998402, 0x8F99C402, 0x8F9A0402, 0x8F9A4402, 0x8F9A8402, 0x8F9AC402, 0x8F9B0402, 0x8F9B4402,
+		0x8F9B8402, 0x8F9BC402, 0x8F9C0402, 0x8F9C4402, 0x8F9C8402, 0x8F9CC402, 0x8F9D0402, 0x8F9D4402,
+		0x8F9D8402, 0x8F9DC402, 0x8F9E0402, 0x8F9E4402, 0x8F9E8402, 0x8F9EC402, 0x8F9F0402, 0x8F9F4402,
+		0x8F9F8402, 0x8F9FC402, 0x8FA00402, 0x8FA04402, 0x8FA08402, 0x8FA0C402, 0x8FA10402, 0x8FA14402,
+		0x8FA18402, 0x8FA1C402, 0x8FA20402, 0x8FA24402, 0x8FA28402, 0x8FA2C402, 0x8FA30402, 0x8FA34402,
+		0x8FA38402, 0x8FA3C402, 0x8FA40402, 0x8FA44402, 0x8FA48402, 0x8FA4C402, 0x8FA50402, 0x8FA54402,
+		0x8FA58402, 0x8FA5C402, 0x8FA60402, 0x8FA64402, 0x8FA68402, 0x8FA6C402, 0x8FA70402, 0x8FA74402,
+		0x8FA78402, 0x8FA7C402, 0x8FA80402, 0x8FA84402, 0x8FA88402, 0x8FA8C402, 0x8FA90402, 0x8FA94402,
+		0x8FA98402, 0x8FA9C402, 0x8FAA0402, 0x8FAA4402, 0x8FAA8402, 0x8FAAC402, 0x8FAB0402, 0x8FAB4402,
+		0x8FAB8402, 0x8FABC402, 0x8FAC0402, 0x8FAC4402, 0x8FAC8402, 0x8FACC402, 0x8FAD0402, 0x8FAD4402,
+		0x8FAD8402, 0x8FADC402, 0x8FAE0402, 0x8FAE4402, 0x8FAE8402, 0x8FAEC402, 0x8FAF0402, 0x8FAF4402,
+		0x8FAF8402, 0x8FAFC402, 0x8FB00402, 0x8FB04402, 0x8FB08402, 0x8FB0C402, 0x8FB10402, 0x8FB14402,
+		0x8FB18402, 0x8FB1C402, 0x8FB20402, 0x8FB24402, 0x8FB28402, 0x8FB2C402, 0x8FB30402, 0x8FB34402,
+		0x8FB38402, 0x8FB3C402, 0x8FB40402, 0x8FB44402, 0x8FB48402, 0x8FB4C402, 0x8FB50402, 0x8FB54402,
+		0x8FB58402, 0x8FB5C402, 0x8FB60402, 0x8FB64402, 0x8FB68402, 0x8FB6C402, 0x8FB70402, 0x8FB74402,
+		0x8FB78402, 0x8FB7C402, 0x8FB80402, 0x8FB84402, 0x8FB88402, 0x8FB8C402, 0x8FB90402, 0x8FB94402,
+		0x8FB98402, 0x8FB9C402, 0x8FBA0402, 0x8FBA4402, 0x8FBA8402, 0x8FBAC402, 0x8FBB0402, 0x8FBB4402,
+		0x8FBB8402, 0x8FBBC402, 0x8FBC0402, 0x8FBC4402, 0x8FBC8402, 0x8FBCC402, 0x8FBD0402, 0x8FBD4402,
+		0x8FBD8402, 0x8FBDC402, 0x8FBE0402, 0x8FBE4402, 0x8FBE8402, 0x8FBEC402, 0x8FBF0402, 0x8FBF4402,
+		0x8FBF8402, 0x8FBFC402, 0x8FC00402, 0x8FC04402, 0x8FC08402, 0x8FC0C402, 0x8FC10402, 0x8FC14402,
+		0x8FC18402, 0x8FC1C402, 0x8FC20402, 0x8FC24402, 0x8FC28402, 0x8FC2C402, 0x8FC30402, 0x8FC34402,
+		0x8FC38402, 0x8FC3C402, 0x8FC40402, 0x8FC44402, 0x8FC48402, 0x8FC4C402, 0x8FC50402, 0x8FC54402,
+		0x8FC58402, 0x8FC5C402, 0x8FC60402, 0x8FC64402, 0x8FC68402, 0x8FC6C402, 0x8FC70402, 0x8FC74402,
+		0x8FC78402, 0x8FC7C402, 0x8FC80402, 0x8FC84402, 0x8FC88402, 0x8FC8C402, 0x8FC90402, 0x8FC94402,
+		0x8FC98402, 0x8FC9C402, 0x8FCA0402, 0x8FCA4402, 0x8FCA8402, 0x8FCAC402, 0x8FCB0402, 0x8FCB4402,
+		0x8FCB8402, 0x8FCBC402, 0x8FCC0402, 0x8FCC4402, 0x8FCC8402, 0x8FCCC402, 0x8FCD0402, 0x8FCD4402,
+		0x8FCD8402, 0x8FCDC402, 0x8FCE0402, 0x8FCE4402, 0x8FCE8402, 0x8FCEC402, 0x8FCF0402, 0x8FCF4402,
+		0x8FCF8402, 0x8FCFC402, 0x8FD00402, 0x8FD04402, 0x8FD08402, 0x8FD0C402, 0x8FD10402, 0x8FD14402,
+		0x8FD18402, 0x8FD1C402, 0x8FD20402, 0x8FD24402, 0x8FD28402, 0x8FD2C402, 0x8FD30402, 0x8FD34402,
+		0x8FD38402, 0x8FD3C402, 0x8FD40402, 0x8FD44402, 0x8FD48402, 0x8FD4C402, 0x8FD50402, 0x8FD54402,
+		0x8FD58402, 0x8FD5C402, 0x8FD60402, 0x8FD64402, 0x8FD68402, 0x8FD6C402, 0x8FD70402, 0x8FD74402,
+		0x8FD78402, 0x8FD7C402, 0x8FD80402, 0x8FD84402, 0x8FD88402, 0x8FD8C402, 0x8FD90402, 0x8FD94402,
+		0x8FD98402, 0x8FD9C402, 0x8FDA0402, 0x8FDA4402, 0x8FDA8402, 0x8FDAC402, 0x8FDB0402, 0x8FDB4402,
+		0x8FDB8402, 0x8FDBC402, 0x8FDC0402, 0x8FDC4402, 0x8FDC8402, 0x8FDCC402, 0x8FDD0402, 0x8FDD4402,
+		0x8FDD8402, 0x8FDDC402, 0x8FDE0402, 0x8FDE4402, 0x8FDE8402, 0x8FDEC402, 0x8FDF0402, 0x8FDF4402,
+		0x8FDF8402, 0x8FDFC402, 0x8FE00402, 0x8FE04402, 0x8FE08402, 0x8FE0C402, 0x8FE10402, 0x8FE14402,
+		0x8FE18402, 0x8FE1C402, 0x8FE20402, 0x8FE24402, 0x8FE28402, 0x8FE2C402, 0x8FE30402, 0x8FE34402,
+		0x8FE38402, 0x8FE3C402, 0x8FE40402, 0x8FE44402, 0x8FE48402, 0x8FE4C402, 0x8FE50402, 0x8FE54402,
+		0x8FE58402, 0x8FE5C402, 0x8FE60402, 0x8FE64402, 0x8FE68402, 0x8FE6C402, 0x8FE70402, 0x8FE74402,
+		0x8FE78402, 0x8FE7C402, 0x8FE80402, 0x8FE84402, 0x8FE88402, 0x8FE8C402, 0x8FE90402, 0x8FE94402,
+		0x8FE98402, 0x8FE9C402, 0x8FEA0402, 0x8FEA4402, 0x8FEA8402, 0x8FEAC402, 0x8FEB0402, 0x8FEB4402,
+		0x8FEB8402, 0x8FEBC402, 0x8FEC0402, 0x8FEC4402, 0x8FEC8402, 0x8FECC402, 0x8FED0402, 0x8FED4402,
+		0x8FED8402, 0x8FEDC402, 0x8FEE0402, 0x8FEE4402, 0x8FEE8402, 0x8FEEC402, 0x8FEF0402, 0x8FEF4402,
+		0x8FEF8402, 0x8FEFC402, 0x8FF00402, 0x8FF04402, 0x8FF08402, 0x8FF0C402, 0x8FF10402, 0x8FF14402,
+		0x8FF18402, 0x8FF1C402, 0x8FF20402, 0x8FF24402, 0x8FF28402, 0x8FF2C402, 0x8FF30402, 0x8FF34402,
+		0x8FF38402, 0x8FF3C402, 0x8FF40402, 0x8FF44402, 0x8FF48402, 0x8FF4C402, 0x8FF50402, 0x8FF54402,
+		0x8FF58402, 0x8FF5C402, 0x8FF60402, 0x8FF64402, 0x8FF68402, 0x8FF6C402, 0x8FF70402, 0x8FF74402,
+		0x8FF78402, 0x8FF7C402, 0x8FF80402, 0x8FF84402, 0x8FF88402, 0x8FF8C402, 0x8FF90402, 0x8FF94402,
+		0x8FF98402, 0x8FF9C402, 0x8FFA0402, 0x8FFA4402, 0x8FFA8402, 0x8FFAC402, 0x8FFB0402, 0x8FFB4402,
+		0x8FFB8402, 0x8FFBC402, 0x8FFC0402, 0x8FFC4402, 0x8FFC8402, 0x8FFCC402, 0x8FFD0402, 0x8FFD4402,
+		0x8FFD8402, 0x8FFDC402, 0x8FFE0402, 0x8FFE4402, 0x8FFE8402, 0x8FFEC402, 0x8FFF0402, 0x8FFF4402,
+		0x8FFF8402, 0x8FFFC402, 0x90000402, 0x90004402, 0x90008402, 0x9000C402, 0x90010402, 0x90014402,
+		0x90018402, 0x9001C402, 0x90020402, 0x90024402, 0x90028402, 0x9002C402, 0x90030402, 0x90034402,
+		0x90038402, 0x9003C402, 0x90040402, 0x90044402, 0x90048402, 0x9004C402, 0x90050402, 0x90054402,
+		0x90058402, 0x9005C402, 0x90060402, 0x90064402, 0x90068402, 0x9006C402, 0x90070402, 0x90074402,
+		0x90078402, 0x9007C402, 0x90080402, 0x90084402, 0x90088402, 0x9008C402, 0x90090402, 0x90094402,
+		0x90098402, 0x9009C402, 0x900A0402, 0x900A4402, 0x900A8402, 0x900AC402, 0x900B0402, 0x900B4402,
+		0x900B8402, 0x900BC402, 0x900C0402, 0x900C4402, 0x900C8402, 0x900CC402, 0x900D0402, 0x900D4402,
+		0x900D8402, 0x900DC402, 0x900E0402, 0x900E4402, 0x900E8402, 0x900EC402, 0x900F0402, 0x900F4402,
+		0x900F8402, 0x900FC402, 0x90100402, 0x90104402, 0x90108402, 0x9010C402, 0x90110402, 0x90114402,
+		0x90118402, 0x9011C402, 0x90120402, 0x90124402, 0x90128402, 0x9012C402, 0x90130402, 0x90134402,
+		0x90138402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x93374402, 0x93378402, 0x9337C402, 0x93380402, 0x93384402, 0x93388402, 0x9338C402, 0x93390402,
+		0x93394402, 0x93398402, 0x9339C402, 0x933A0402, 0x933A4402, 0x933A8402, 0x933AC402, 0x933B0402,
+		0x933B4402, 0x933B8402, 0x933BC402, 0x933C0402, 0x933C4402, 0x933C8402, 0x933CC402, 0x933D0402,
+		0x933D4402, 0x933D8402, 0x933DC402, 0x933E0402, 0x933E4402, 0x933E8402, 0x933EC402, 0x00000000,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xC0B24402, 0xC0B28402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x9013C402, 0x90140402, 0x90144402, 0x90148402, 0x9014C402, 0x90150402, 0x90154402, 0x90158402,
+		0x9015C402, 0x90160402, 0x90164402, 0x90168402, 0x9016C402, 0x90170402, 0x90174402, 0x90178402,
+		0x9017C402, 0x90180402, 0x90184402, 0x90188402, 0x9018C402, 0x90190402, 0x90194402, 0x90198402,
+		0x9019C402, 0x901A0402, 0x901A4402, 0x901A8402, 0x901AC402, 0x901B0402, 0x00000000, 0x00000000,
+		0x80001702, 0x80001722, 0x80001742, 0x80001762, 0x80001782, 0xC0A3C402, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x92820402, 0x92824402, 0x92828402, 0x9282C402, 0x92830402, 0x92834402, 0x92838402, 0x9283C402,
+		0x92840402, 0x92844402, 0x92848402, 0x9284C402, 0x92850402, 0x92854402, 0x92858402, 0x9285C402,
+		0x92860402, 0x92864402, 0x92868402, 0x9286C402, 0x92870402, 0x92874402, 0x92878402, 0x9287C402,
+		0x92880402, 0x92884402, 0x92888402, 0x9288C402, 0x92890402, 0x92894402, 0x92898402, 0x9289C402,
+		0x928A0402, 0x928A4402, 0x928A8402, 0x928AC402, 0x928B0402, 0x928B4402, 0x928B8402, 0x928BC402,
+		0x928C0402, 0x928C4402, 0x928C8402, 0x928CC402, 0x928D0402, 0x928D4402, 0x928D8402, 0x928DC402,
+		0x80001EC2, 0x80001EE2, 0x80001F02, 0x80001F22, 0x80001F42, 0x80001F62, 0x80001F82, 0xC129C402,
+		0xC12A0402, 0xC12A4402, 0xC12A8402, 0xC12AC402, 0xC4478402, 0xC447C402, 0xC4480402, 0xC4484402,
+		0x928E0402, 0x928E4402, 0x87D4C402, 0x87D50402, 0xC12B0402, 0xC4488402, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0x00000000, 0xC7A04402, 0xC7A08402, 0xC7A0C402, 0xC7A10402, 0xC7A14402,
+		0xC7A18402, 0xC7A1C402, 0x00000000, 0x928E8402, 0x928EC402, 0x928F0402, 0x928F4402, 0x928F8402,
+		0x928FC402, 0x92900402, 0x92904402, 0x92908402, 0x9290C402, 0x92910402, 0x92914402, 0x92918402,
+		0x9291C402, 0x92920402, 0x92924402, 0x92928402, 0x9292C402, 0x92930402, 0x92934402, 0x92938402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x9293C402, 0x92940402, 0x92944402,
+		0x92948402, 0x9294C402, 0x92950402, 0x92954402, 0x92958402, 0x9295C402, 0x92960402, 0x92964402,
+		0x92968402, 0x9296C402, 0x92970402, 0x92974402, 0x92978402, 0x9297C402, 0x92980402, 0x92984402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x904C8408, 0x904CC408, 0x904D0408, 0x904D4408, 0x904D8408, 0x904DC408, 0x904E0408, 0x904E4408,
+		0x904E8408, 0x904EC408, 0x904F0408, 0x904F4408, 0x904F8408, 0x904FC408, 0x90500408, 0x90504408,
+		0x90508408, 0x9050C408, 0x90510408, 0x90514408, 0x90518408, 0x9051C408, 0x90520408, 0x90524408,
+		0x90528408, 0x9052C408, 0x90530408, 0x90534408, 0x90538408, 0x9053C408, 0x90540408, 0x90544408,
+		0x904C8402, 0x904CC402, 0x904D0402, 0x904D4402, 0x904D8402, 0x904DC402, 0x904E0402, 0x904E4402,
+		0x904E8402, 0x904EC402, 0x904F0402, 0x904F4402, 0x904F8402, 0x904FC402, 0x90500402, 0x90504402,
+		0x90508402, 0x9050C402, 0x90510402, 0x90514402, 0x90518402, 0x9051C402, 0x90520402, 0x90524402,
+		0x90528402, 0x9052C402, 0x90530402, 0x90534402, 0x90538402, 0x9053C402, 0x90540402, 0x90544402,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0xC7A20402, 0xC7A24402, 0xC7A28402, 0xC7A2C402, 0xC7A30402, 0xC7A34402,
+		0xC7A38402, 0xC7A3C402, 0xC7A40402, 0xC7A44402, 0x0003D3C2, 0x00000082, 0x00007142, 0xC08D4402,
+		0xC0A40402, 0xC12B4402, 0xC12B8402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x92474402, 0x92478402, 0x9247C402, 0x92480402, 0x92488402, 0x9248C402, 0x92488404, 0x92490402,
+		0x92494402, 0x92498402, 0x9249C402, 0x924A0402, 0x924A4402, 0x924A8402, 0x924B0402, 0x924B4402,
+		0x924BC402, 0x924C0402, 0x924C4402, 0x924BC404, 0x924C8402, 0x924CC402, 0x924D0402, 0x924D4402,
+		0x924D8402, 0x924DC402, 0x924E0402, 0x924E4402, 0x924E8402, 0x924EC402, 0x924F0402, 0x924F4402,
+		0x924F8402, 0x924FC402, 0x92500402, 0x92504402, 0x92508402, 0x92504404, 0x9250C402, 0x92510402,
+		0x92514402, 0x92518402, 0x9251C402, 0x92520402, 0x92524402, 0x92528402, 0x9252C402, 0x92530402,
+		0x92534402, 0x92538402, 0x9253C402, 0x92544402, 0x9254C402, 0x92550402, 0x92554402, 0x92558402,
+		0x9255C402, 0x92560402, 0x92568402, 0x9256C402, 0x92570402, 0x92574402, 0x92578402, 0x92574404,
+		0x9257C402, 0x92580402, 0x92584402, 0x92588402, 0x9258C402, 0x92484402, 0x92548402, 0x92540402,
+		0x924AC402, 0x92564402, 0x924B8402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x925A0402,
+		0x92590402, 0x92594402, 0x92598402, 0x9259C402, 0x925A4402, 0x925A8402, 0x925AC402, 0x925B0402,
+		0x925B4402, 0x925BC402, 0x925C0402, 0x925C4402, 0x925C8402, 0x925D0402, 0x925D4402, 0x925D8402,
+		0x925DC402, 0x925E4402, 0x925E8402, 0x925EC402, 0x925F0402, 0x925F4402, 0x925FC402, 0x92600402,
+		0x92604402, 0x92608402, 0x9260C402, 0x92610402, 0x92614402, 0x92618402, 0x92624402, 0x92628402,
+		0x9262C402, 0x92630402, 0x92634402, 0x9263C402, 0x92640402, 0x9264C402, 0x92650402, 0x92654402,
+		0x92658402, 0x9265C402, 0x92660402, 0x92664402, 0x92668402, 0x9266C402, 0x92670402, 0x9261C402,
+		0x92638402, 0x925B8402, 0x92648402, 0x925CC402, 0x925E0402, 0x92644402, 0x925F8402, 0x92620402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x92674402,
+		0x92678402, 0x9267C402, 0x92680402, 0x92684402, 0x92688402, 0x9268C402, 0x92690402, 0x92694402,
+		0x92698402, 0x9269C402, 0x926A0402, 0x926A4402, 0x926A8402, 0x926AC402, 0x926B0402, 0x926B4402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x87D64402, 0x87D68402, 0xC08E4402, 0x87D6C402, 0x80000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x800020E2, 0x80002102, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x90B74411, 0x90C60402, 0x90C2C402, 0x90C30402, 0x90C34402, 0x90C38402, 0x90C3C402, 0x90C40402,
+		0x90C44402, 0x90C48402, 0x90C4C402, 0x90C50402, 0x90C54402, 0x90C58402, 0x90C5C402, 0x90C64402,
+		0x90C68402, 0x90C6C402, 0x90C70402, 0x90C74402, 0x90C78402, 0x90C7C402, 0x90C80402, 0x90C84402,
+		0x90C88402, 0x90C8C402, 0x90C90402, 0x90C94402, 0x90C98402, 0x90C9C402, 0x90CA0402, 0x90CA4402,
+		0x90CA8402, 0x90CAC402, 0x90CB0402, 0x90CB4402, 0x90CB8402, 0x90CBC402, 0x90CC0402, 0x90CC4402,
+		0x90CC8402, 0x90CCC402, 0x90CD0402, 0x90CD4402, 0x90CD8402, 0x90CDC402, 0x90CE0402, 0x90CE4402,
+		0x90CE8402, 0x90CEC402, 0x90CF0402, 0x90CF4402, 0x90CF8402, 0x90CFC402, 0x90D00402, 0x90D04402,
+		0x90D08402, 0x90D0C402, 0x90D10402, 0x90D14402, 0x90D18402, 0x90D1C402, 0x90D20402, 0x90D24402,
+		0x90D28402, 0x90D2C402, 0x90D30402, 0x90D34402, 0x90D38402, 0x90D3C402, 0x90D40402, 0x90D44402,
+		0x90D48402, 0x90D4C402, 0x90D50402, 0x90D54402, 0x90D58402, 0x90D5C402, 0x90D60402, 0x90D64402,
+		0x90D68402, 0x90D6C402, 0x90D70402, 0x90D74402, 0x90D78402, 0x90D7C402, 0x90D80402, 0x90D84402,
+		0x90D88402, 0x90D8C402, 0x90D90402, 0x90D94402, 0x90D98402, 0x90D9C402, 0x90DA0402, 0x90DA4402,
+		0x90DA8402, 0x90DAC402, 0x90DB0402, 0x90DB4402, 0x90DB8402, 0x90DBC402, 0x90DC0402, 0x90DC4402,
+		0x90DC8402, 0x90DCC402, 0x90DD0402, 0x90DD4402, 0x90DD8402, 0x90DDC402, 0x90DE0402, 0x90DE4402,
+		0x90DE8402, 0x90DEC402, 0x90DF0402, 0x90DF4402, 0x90DF8402, 0x90DFC402, 0x90E00402, 0x90E04402,
+		0x90E08402, 0x90E0C402, 0x90E10402, 0x90E14402, 0x90E18402, 0x90E1C402, 0x90E20402, 0x90E24402,
+		0x90E28402, 0x90E2C402, 0x90E30402, 0x90E34402, 0x90E38402, 0x90E3C402, 0x90E40402, 0x90E44402,
+		0x90E48402, 0x90E4C402, 0x90E50402, 0x90E54402, 0x90E58402, 0x90E5C402, 0x90E60402, 0x90E64402,
+		0x90E68402, 0x90E6C402, 0x90E70402, 0x90E74402, 0x90E78402, 0x90E7C402, 0x90E80402, 0x90E84402,
+		0x90E88402, 0x90E8C402, 0x90E90402, 0x90E94402, 0x90E98402, 0x90E9C402, 0x90EA0402, 0x90EA4402,
+		0x90EA8402, 0x90EAC402, 0x90EB0402, 0x90EB4402, 0x90EB8402, 0x90EBC402, 0x90EC0402, 0x90EC4402,
+		0x90EC8402, 0x90ECC402, 0x90ED0402, 0x90ED4402, 0x90ED8402, 0x90EDC402, 0x90EE0402, 0x90EE4402,
+		0x90EE8402, 0x90EEC402, 0x90EF0402, 0x90EF4402, 0x90EF8402, 0x90EFC402, 0x90F00402, 0x90F04402,
+		0x90F08402, 0x90F0C402, 0x90F10402, 0x90F14402, 0x90F18402, 0x90F1C402, 0x90F20402, 0x90F24402,
+		0x90F28402, 0x90F2C402, 0x90F30402, 0x90F34402, 0x90F38402, 0x90F3C402, 0x90F40402, 0x90F44402,
+		0x90F48402, 0x90F4C402, 0x90F50402, 0x90F54402, 0x90F58402, 0x90F5C402, 0x90F60402, 0x90F64402,
+		0x90F68402, 0x90F6C402, 0x90F70402, 0x90F74402, 0x90F78402, 0x90F7C402, 0x90F80402, 0x90F84402,
+		0x90F88402, 0x90F8C402, 0x90F90402, 0x90F94402, 0x90F98402, 0x90F9C402, 0x90FA0402, 0x90FA4402,
+		0x90FA8402, 0x90FAC402, 0x90FB0402, 0x90FB4402, 0x90FB8402, 0x90FBC402, 0x90FC0402, 0x90FC4402,
+		0x90FC8402, 0x90FCC402, 0x90FD0402, 0x90FD4402, 0x90FD8402, 0x90FDC402, 0x90FE0402, 0x90FE4402,
+		0x90FE8402, 0x90FEC402, 0x90FF0402, 0x90FF4402, 0x90FF8402, 0x90FFC402, 0x91000402, 0x91004402,
+		0x91008402, 0x9100C402, 0x91010402, 0x91014402, 0x91018402, 0x9101C402, 0x91020402, 0x91024402,
+		0x91028402, 0x9102C402, 0x91030402, 0x91034402, 0x91038402, 0x9103C402, 0x91040402, 0x91044402,
+		0x91048402, 0x9104C402, 0x91050402, 0x91054402, 0x91058402, 0x9105C402, 0x91060402, 0x91064402,
+		0x91068402, 0x9106C402, 0x91070402, 0x91074402, 0x91078402, 0x9107C402, 0x91080402, 0x91084402,
+		0x91088402, 0x9108C402, 0x91090402, 0x91094402, 0x91098402, 0x9109C402, 0x910A0402, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x90C1C40D, 0x90C2040D, 0x90C2440D, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x90C1C40F, 0x90C2040F, 0x90C2440F, 0x90C2840F,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x92EFC402, 0x92F00402, 0x92F04402, 0x92F08402, 0x92F0C402, 0x92F10402, 0x92F14402, 0x92F18402,
+		0x92F1C402, 0x92F20402, 0x92F24402, 0x92F28402, 0x92F2C402, 0x92F30402, 0x92F34402, 0x92F38402,
+		0x92F3C402, 0x92F40402, 0x92F44402, 0x92F48402, 0x92F4C402, 0x92F50402, 0x92F54402, 0x92F58402,
+		0x92F5C402, 0x92F60402, 0x92F64402, 0x92F68402, 0x92F6C402, 0x92F70402, 0x92F74402, 0x92F78402,
+		0x92F7C402, 0x92F80402, 0x92F84402, 0x92F88402, 0x92F8C402, 0x92F90402, 0x92F94402, 0x92F98402,
+		0x92F9C402, 0x92FA0402, 0x92FA4402, 0x92FA8402, 0x92FAC402, 0x92FB0402, 0x92FB4402, 0x92FB8402,
+		0x92FBC402, 0x92FC0402, 0x92FC4402, 0x92FC8402, 0x92FCC402, 0x92FD0402, 0x92FD4402, 0x92FD8402,
+		0x92FDC402, 0x92FE0402, 0x92FE4402, 0x92FE8402, 0x92FEC402, 0x92FF0402, 0x92FF4402, 0x92FF8402,
+		0x92FFC402, 0x93000402, 0x93004402, 0x93008402, 0x9300C402, 0x93010402, 0x93014402, 0x93018402,
+		0x9301C402, 0x93020402, 0x93024402, 0x93028402, 0x9302C402, 0x93030402, 0x93034402, 0x93038402,
+		0x9303C402, 0x93040402, 0x93044402, 0x93048402, 0x9304C402, 0x93050402, 0x93054402, 0x93058402,
+		0x9305C402, 0x93060402, 0x93064402, 0x93068402, 0x9306C402, 0x93070402, 0x93074402, 0x93078402,
+		0x9307C402, 0x93080402, 0x93084402, 0x93088402, 0x9308C402, 0x93090402, 0x93094402, 0x93098402,
+		0x9309C402, 0x930A0402, 0x930A4402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x930A8402, 0x930AC402, 0x930B0402, 0x930B4402, 0x930B8402, 0x930BC402, 0x930C0402, 0x930C4402,
+		0x930C8402, 0x930CC402, 0x930D0402, 0x930D4402, 0x930D8402, 0x00000000, 0x00000000, 0x00000000,
+		0x930DC402, 0x930E0402, 0x930E4402, 0x930E8402, 0x930EC402, 0x930F0402, 0x930F4402, 0x930F8402,
+		0x930FC402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x93100402, 0x93104402, 0x93108402, 0x9310C402, 0x93110402, 0x93114402, 0x93118402, 0x9311C402,
+		0x93120402, 0x93124402, 0x00000000, 0x00000000, 0xC4C50402, 0x80000662, 0x800006A2, 0xC0A44402,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xC4490402, 0xC4494402, 0xC4498402, 0xC449C402, 0xC44A0402, 0xC44A4402, 0xC44A8402, 0xC44AC402,
+		0xC44B0402, 0xC44B4402, 0xC44B8402, 0xC44BC402, 0xC44C0402, 0xC44C4402, 0xC44C8402, 0xC44CC402,
+		0xC44D0402, 0xC44D4402, 0xC44D8402, 0xC44DC402, 0xC44E0402, 0xC44E4402, 0xC44E8402, 0xC44EC402,
+		0xC44F0402, 0xC44F4402, 0xC44F8402, 0xC44FC402, 0xC4500402, 0xC4504402, 0xC4508402, 0xC450C402,
+		0xC4510402, 0xC4514402, 0xC4518402, 0xC451C402, 0xC4520402, 0xC4524402, 0xC4528402, 0xC452C402,
+		0xC4530402, 0xC4534402, 0xC4538402, 0xC453C402, 0xC4540402, 0xC4544402, 0xC4548402, 0xC454C402,
+		0xC4550402, 0xC4554402, 0xC4558402, 0xC455C402, 0xC4560402, 0xC4564402, 0xC4568402, 0xC456C402,
+		0xC4570402, 0xC4574402, 0xC4578402, 0xC457C402, 0xC4580402, 0xC4584402, 0xC4588402, 0xC458C402,
+		0xC4590402, 0xC4594402, 0xC4598402, 0xC459C402, 0xC45A0402, 0xC45A4402, 0xC45A8402, 0xC45AC402,
+		0xC45B0402, 0xC45B4402, 0xC45B8402, 0xC45BC402, 0xC45C0402, 0xC45C4402, 0xC45C8402, 0xC45CC402,
+		0xC45D0402, 0xC45D4402, 0xC45D8402, 0xC45DC402, 0xC45E0402, 0xC45E4402, 0xC45E8402, 0xC45EC402,
+		0xC45F0402, 0xC45F4402, 0xC45F8402, 0xC45FC402, 0xC4600402, 0xC4604402, 0xC4608402, 0xC460C402,
+		0xC4610402, 0xC4614402, 0xC4618402, 0xC461C402, 0xC4620402, 0xC4624402, 0xC4628402, 0xC462C402,
+		0xC4630402, 0xC4634402, 0xC4638402, 0xC463C402, 0xC4640402, 0xC4644402, 0xC4648402, 0xC464C402,
+		0xC4650402, 0xC4654402, 0xC4658402, 0xC465C402, 0xC4660402, 0xC4664402, 0xC4668402, 0xC466C402,
+		0xC4670402, 0xC4674402, 0xC4678402, 0xC467C402, 0xC4680402, 0xC4684402, 0xC4688402, 0xC468C402,
+		0xC4690402, 0xC4694402, 0xC4698402, 0xC469C402, 0xC46A0402, 0xC46A4402, 0xC46A8402, 0xC46AC402,
+		0xC46B0402, 0xC46B4402, 0xC46B8402, 0xC46BC402, 0xC46C0402, 0xC46C4402, 0xC46C8402, 0xC46CC402,
+		0xC46D0402, 0xC46D4402, 0xC46D8402, 0xC46DC402, 0xC46E0402, 0xC46E4402, 0xC46E8402, 0xC46EC402,
+		0xC46F0402, 0xC46F4402, 0xC46F8402, 0xC46FC402, 0xC4700402, 0xC4704402, 0xC4708402, 0xC470C402,
+		0xC4710402, 0xC4714402, 0xC4718402, 0xC471C402, 0xC4720402, 0xC4724402, 0xC4728402, 0xC472C402,
+		0xC4730402, 0xC4734402, 0xC4738402, 0xC473C402, 0xC4740402, 0xC4744402, 0xC4748402, 0xC474C402,
+		0xC4750402, 0xC4754402, 0xC4758402, 0xC475C402, 0xC4760402, 0xC4764402, 0xC4768402, 0xC476C402,
+		0xC4770402, 0xC4774402, 0xC4778402, 0xC477C402, 0xC4780402, 0xC4784402, 0xC4788402, 0xC478C402,
+		0xC4790402, 0xC4794402, 0xC4798402, 0xC479C402, 0xC47A0402, 0xC47A4402, 0xC47A8402, 0xC47AC402,
+		0xC47B0402, 0xC47B4402, 0xC47B8402, 0xC47BC402, 0xC47C0402, 0xC47C4402, 0xC47C8402, 0xC47CC402,
+		0xC47D0402, 0xC47D4402, 0xC47D8402, 0xC47DC402, 0xC47E0402, 0xC47E4402, 0xC47E8402, 0xC47EC402,
+		0xC47F0402, 0xC47F4402, 0xC47F8402, 0xC47FC402, 0xC4800402, 0xC4804402, 0xC4808402, 0xC480C402,
+		0xC4810402, 0xC4814402, 0xC4818402, 0xC481C402, 0xC4820402, 0xC4824402, 0xC4828402, 0xC482C402,
+		0xC4830402, 0xC4834402, 0xC4838402, 0xC483C402, 0xC4840402, 0xC4844402, 0xC4848402, 0xC484C402,
+		0xC4850402, 0xC4854402, 0xC4858402, 0xC485C402, 0xC4860402, 0xC4864402, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xC4868402, 0xC486C402, 0xC4870402, 0xC4874402, 0xC4878402, 0xC487C402, 0xC4880402, 0xC4884402,
+		0xC4888402, 0xC488C402, 0xC4890402, 0xC4894402, 0xC4898402, 0xC489C402, 0xC48A0402, 0xC48A4402,
+		0xC48A8402, 0xC48AC402, 0xC48B0402, 0xC48B4402, 0xC48B8402, 0xC48BC402, 0xC48C0402, 0xC48C4402,
+		0xC48C8402, 0xC48CC402, 0xC48D0402, 0xC48D4402, 0xC48D8402, 0xC48DC402, 0xC48E0402, 0xC48E4402,
+		0xC48E8402, 0xC48EC402, 0xC48F0402, 0xC48F4402, 0xC48F8402, 0xC48FC402, 0xC4900402, 0x00000000,
+		0x00000000, 0xC4950402, 0xC4910402, 0xC4914402, 0xC4918402, 0xC491C402, 0xC4920402, 0xC4924402,
+		0xC4928402, 0xC492C402, 0xC4930402, 0xC4934402, 0xC4938402, 0xC493C402, 0xC4940402, 0xC4944402,
+		0xC4948402, 0xC494C402, 0xC4954402, 0xC4958402, 0xC495C402, 0xC4960402, 0xC4964402, 0xC4968402,
+		0xC496C402, 0xC4970402, 0xC4974402, 0xC4978402, 0xC497C402, 0xC4980402, 0xC4984402, 0xC4988402,
+		0xC498C402, 0xC4990402, 0xC4994402, 0xC4998402, 0xC499C402, 0xC49A0402, 0xC49A4402, 0xC49A8402,
+		0xC49AC402, 0xC49B0402, 0xC49B4402, 0xC49B8402, 0xC49BC402, 0xC49C0402, 0xC49C4402, 0xC49C8402,
+		0xC49CC402, 0xC49D0402, 0xC49D4402, 0xC49D8402, 0xC49DC402, 0xC49E0402, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0xC49E4402, 0xC49E8402, 0xC49EC402, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0xC49F0402, 0xC49F4402, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0xC49F8402, 0xC49FC402, 0xC4A00402, 0xC4A04402,
+		0xC4A08402, 0xC4A0C402, 0xC4A10402, 0xC4A14402, 0xC4A18402, 0xC4A1C402, 0xC4A20402, 0xC4A24402,
+		0xC4A28402, 0xC4A2C402, 0xC4A30402, 0xC4A34402, 0xC4A38402, 0xC4A3C402, 0xC4A40402, 0xC4A44402,
+		0xC4A48402, 0xC4A4C402, 0xC4A50402, 0xC4A54402, 0xC4A58402, 0xC4A5C402, 0xC4A60402, 0xC4A64402,
+		0xC4A68402, 0xC4A6C402, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0xC4A70402, 0xC4A74402,
+		0xC4A78402, 0xC4A7C402, 0xC4A80402, 0xC4A84402, 0xC4A88402, 0xC4A8C402, 0xC4A90402, 0xC4A94402,
+		0xC4A98402, 0xC4A9C402, 0xC4AA0402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0xC4AA4402, 0xC4AA8402, 0xC4AAC402, 0xC4AB0402, 0xC4AB4402, 0xC4AB8402, 0xC4ABC402,
+		0xC4AC0402, 0xC4AC4402, 0xC4AC8402, 0xC4ACC402, 0xC4AD0402, 0xC4AD4402, 0xC4AD8402, 0xC4ADC402,
+		0xC4AE0402, 0xC4AE4402, 0xC4AE8402, 0xC4AEC402, 0xC4AF0402, 0xC4AF4402, 0xC4AF8402, 0xC4AFC402,
+		0xC4B00402, 0xC4B04402, 0xC4B08402, 0xC4B0C402, 0xC4B10402, 0xC4B14402, 0xC4B18402, 0xC4B1C402,
+		0xC4B20402, 0xC4B24402, 0xC4B28402, 0xC4B2C402, 0xC4B30402, 0xC4B34402, 0xC4B38402, 0xC4B3C402,
+		0xC4B40402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xC4B44402, 0xC4B48402, 0xC4B4C402, 0xC4B50402, 0xC4B54402, 0xC4B58402, 0xC4B5C402, 0xC4B60402,
+		0xC4B64402, 0xC4B68402, 0xC4B6C402, 0xC4B70402, 0xC4B74402, 0xC4B78402, 0xC4B7C402, 0xC4B80402,
+		0xC4B84402, 0xC4B88402, 0xC4B8C402, 0xC4B90402, 0xC4B94402, 0xC4B98402, 0xC4B9C402, 0xC4BA0402,
+		0xC4BA4402, 0xC4BA8402, 0xC4BAC402, 0xC4BB0402, 0xC4BB4402, 0xC4BB8402, 0xC4BBC402, 0xC4BC0402,
+		0xC4BC4402, 0xC4BC8402, 0xC4BCC402, 0xC4BD0402, 0xC4BD4402, 0xC4BD8402, 0xC4BDC402, 0xC4BE0402,
+		0xC4BE4402, 0xC4BE8402, 0xC4BEC402, 0xC4BF0402, 0xC4BF4402, 0xC4BF8402, 0xC4BFC402, 0xC4C00402,
+		0xC4C04402, 0xC4C08402, 0xC4C0C402, 0xC4C10402, 0xC4C14402, 0xC4C18402, 0xC4C1C402, 0xC4C20402,
+		0xC4C24402, 0xC4C28402, 0xC4C2C402, 0xC4C30402, 0xC4C34402, 0xC4C38402, 0xC4C3C402, 0xC4C40402,
+		0xC4C44402, 0xC4C48402, 0x80000000, 0x80000000, 0x80000000, 0xC4C4C402, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0xC7A48402, 0xC7A4C402, 0xC7A50402, 0xC7A54402, 0xC7A58402, 0xC7A5C402,
+		0xC7A60402, 0xC7A64402, 0xC7A68402, 0xC7A6C402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xC40D8402, 0xC40DC402, 0xC40E0402, 0xC40E4402, 0xC40E8402, 0xC40EC402, 0xC40F0402, 0xC40F4402,
+		0xC40F8402, 0xC40FC402, 0xC4100402, 0xC4104402, 0xC4108402, 0xC410C402, 0xC4110402, 0xC4114402,
+		0xC4118402, 0xC411C402, 0xC4120402, 0xC4124402, 0xC4128402, 0xC412C402, 0xC4130402, 0xC4134402,
+		0xC4138402, 0xC413C402, 0xC4140402, 0xC4144402, 0xC4148402, 0xC414C402, 0xC4150402, 0xC4154402,
+		0xC4158402, 0xC415C402, 0xC4160402, 0xC4164402, 0xC4168402, 0xC416C402, 0xC4170402, 0xC4174402,
+		0xC4178402, 0xC417C402, 0xC4180402, 0xC4184402, 0xC4188402, 0xC418C402, 0xC4190402, 0xC4194402,
+		0xC4198402, 0xC419C402, 0xC41A0402, 0xC41A4402, 0xC41A8402, 0xC41AC402, 0xC41B0402, 0xC41B4402,
+		0xC41B8402, 0xC41BC402, 0xC41C0402, 0xC41C4402, 0xC41C8402, 0xC41CC402, 0xC41D0402, 0xC41D4402,
+		0xC41D8402, 0xC41DC402, 0xC41E0402, 0xC41E4402, 0xC41E8402, 0xC41EC402, 0xC41F0402, 0xC41F4402,
+		0xC41F8402, 0xC41FC402, 0xC4200402, 0xC4204402, 0xC4208402, 0xC420C402, 0xC4210402, 0xC4214402,
+		0xC4218402, 0xC421C402, 0xC4220402, 0xC4224402, 0xC4228402, 0xC422C402, 0xC4230402, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402, 0x87E80402,
+		0x87E84402, 0xC7CF4402, 0xC7CF8402, 0xC7CFC402, 0xC7D00402, 0xC7D04402, 0xC7D08402, 0xC7D0C402,
+		0xC7D10402, 0xC7D14402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E64402,
+		0x87E74402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x87E8840B, 0x87EF040B, 0x87F5840B, 0x87FAC40B, 0x8801C40B, 0x8810840B, 0x8814440B, 0x881D440B,
+		0x8824040B, 0x882AC40B, 0x8831040B, 0x8835840B, 0x8842440B, 0x8846040B, 0x884F040B, 0x885AC40B,
+		0x8860040B, 0x8864C40B, 0x8874840B, 0x887DC40B, 0x8885C40B, 0x8891C40B, 0x8896440B, 0x8899040B,
+		0x889C040B, 0x88A1840B, 0x87E88405, 0x87EF0405, 0x87F58405, 0x87FAC405, 0x8801C405, 0x88108405,
+		0x88144405, 0x881D4405, 0x88240405, 0x882AC405, 0x88310405, 0x88358405, 0x88424405, 0x88460405,
+		0x884F0405, 0x885AC405, 0x88600405, 0x8864C405, 0x88748405, 0x887DC405, 0x8885C405, 0x8891C405,
+		0x88964405, 0x88990405, 0x889C0405, 0x88A18405, 0x87E8840B, 0x87EF040B, 0x87F5840B, 0x87FAC40B,
+		0x8801C40B, 0x8810840B, 0x8814440B, 0x881D440B, 0x8824040B, 0x882AC40B, 0x8831040B, 0x8835840B,
+		0x8842440B, 0x8846040B, 0x884F040B, 0x885AC40B, 0x8860040B, 0x8864C40B, 0x8874840B, 0x887DC40B,
+		0x8885C40B, 0x8891C40B, 0x8896440B, 0x8899040B, 0x889C040B, 0x88A1840B, 0x87E88405, 0x87EF0405,
+		0x87F58405, 0x87FAC405, 0x8801C405, 0x88108405, 0x88144405, 0x00000000, 0x88240405, 0x882AC405,
+		0x88310405, 0x88358405, 0x88424405, 0x88460405, 0x884F0405, 0x885AC405, 0x88600405, 0x8864C405,
+		0x88748405, 0x887DC405, 0x8885C405, 0x8891C405, 0x88964405, 0x88990405, 0x889C0405, 0x88A18405,
+		0x87E8840B, 0x87EF040B, 0x87F5840B, 0x87FAC40B, 0x8801C40B, 0x8810840B, 0x8814440B, 0x881D440B,
+		0x8824040B, 0x882AC40B, 0x8831040B, 0x8835840B, 0x8842440B, 0x8846040B, 0x884F040B, 0x885AC40B,
+		0x8860040B, 0x8864C40B, 0x8874840B, 0x887DC40B, 0x8885C40B, 0x8891C40B, 0x8896440B, 0x8899040B,
+		0x889C040B, 0x88A1840B, 0x87E88405, 0x87EF0405, 0x87F58405, 0x87FAC405, 0x8801C405, 0x88108405,
+		0x88144405, 0x881D4405, 0x88240405, 0x882AC405, 0x88310405, 0x88358405, 0x88424405, 0x88460405,
+		0x884F0405, 0x885AC405, 0x88600405, 0x8864C405, 0x88748405, 0x887DC405, 0x8885C405, 0x8891C405,
+		0x88964405, 0x88990405, 0x889C0405, 0x88A18405, 0x87E8840B, 0x00000000, 0x87F5840B, 0x87FAC40B,
+		0x00000000, 0x00000000, 0x8814440B, 0x00000000, 0x00000000, 0x882AC40B, 0x8831040B, 0x00000000,
+		0x00000000, 0x8846040B, 0x884F040B, 0x885AC40B, 0x8860040B, 0x00000000, 0x8874840B, 0x887DC40B,
+		0x8885C40B, 0x8891C40B, 0x8896440B, 0x8899040B, 0x889C040B, 0x88A1840B, 0x87E88405, 0x87EF0405,
+		0x87F58405, 0x87FAC405, 0x00000000, 0x88108405, 0x00000000, 0x881D4405, 0x88240405, 0x882AC405,
+		0x88310405, 0x88358405, 0x88424405, 0x88460405, 0x00000000, 0x885AC405, 0x88600405, 0x8864C405,
+		0x88748405, 0x887DC405, 0x8885C405, 0x8891C405, 0x88964405, 0x88990405, 0x889C0405, 0x88A18405,
+		0x87E8840B, 0x87EF040B, 0x87F5840B, 0x87FAC40B, 0x8801C40B, 0x8810840B, 0x8814440B, 0x881D440B,
+		0x8824040B, 0x882AC40B, 0x8831040B, 0x8835840B, 0x8842440B, 0x8846040B, 0x884F040B, 0x885AC40B,
+		0x8860040B, 0x8864C40B, 0x8874840B, 0x887DC40B, 0x8885C40B, 0x8891C40B, 0x8896440B, 0x8899040B,
+		0x889C040B, 0x88A1840B, 0x87E88405, 0x87EF0405, 0x87F58405, 0x87FAC405, 0x8801C405, 0x88108405,
+		0x88144405, 0x881D4405, 0x88240405, 0x882AC405, 0x88310405, 0x88358405, 0x88424405, 0x88460405,
+		0x884F0405, 0x885AC405, 0x88600405, 0x8864C405, 0x88748405, 0x887DC405, 0x8885C405, 0x8891C405,
+		0x88964405, 0x88990405, 0x889C0405, 0x88A18405, 0x87E8840B, 0x87EF040B, 0x00000000, 0x87FAC40B,
+		0x8801C40B, 0x8810840B, 0x8814440B, 0x00000000, 0x00000000, 0x882AC40B, 0x8831040B, 0x8835840B,
+		0x8842440B, 0x8846040B, 0x884F040B, 0x885AC40B, 0x8860040B, 0x00000000, 0x8874840B, 0x887DC40B,
+		0x8885C40B, 0x8891C40B, 0x8896440B, 0x8899040B, 0x889C040B, 0x00000000, 0x87E88405, 0x87EF0405,
+		0x87F58405, 0x87FAC405, 0x8801C405, 0x88108405, 0x88144405, 0x881D4405, 0x88240405, 0x882AC405,
+		0x88310405, 0x88358405, 0x88424405, 0x88460405, 0x884F0405, 0x885AC405, 0x88600405, 0x8864C405,
+		0x88748405, 0x887DC405, 0x8885C405, 0x8891C405, 0x88964405, 0x88990405, 0x889C0405, 0x88A18405,
+		0x87E8840B, 0x87EF040B, 0x00000000, 0x87FAC40B, 0x8801C40B, 0x8810840B, 0x8814440B, 0x00000000,
+		0x8824040B, 0x882AC40B, 0x8831040B, 0x8835840B, 0x8842440B, 0x00000000, 0x884F040B, 0x00000000,
+		0x00000000, 0x00000000, 0x8874840B, 0x887DC40B, 0x8885C40B, 0x8891C40B, 0x8896440B, 0x8899040B,
+		0x889C040B, 0x00000000, 0x87E88405, 0x87EF0405, 0x87F58405, 0x87FAC405, 0x8801C405, 0x88108405,
+		0x88144405, 0x881D4405, 0x88240405, 0x882AC405, 0x88310405, 0x88358405, 0x88424405, 0x88460405,
+		0x884F0405, 0x885AC405, 0x88600405, 0x8864C405, 0x88748405, 0x887DC405, 0x8885C405, 0x8891C405,
+		0x88964405, 0x88990405, 0x889C0405, 0x88A18405, 0x87E8840B, 0x87EF040B, 0x87F5840B, 0x87FAC40B,
+		0x8801C40B, 0x8810840B, 0x8814440B, 0x881D440B, 0x8824040B, 0x882AC40B, 0x8831040B, 0x8835840B,
+		0x8842440B, 0x8846040B, 0x884F040B, 0x885AC40B, 0x8860040B, 0x8864C40B, 0x8874840B, 0x887DC40B,
+		0x8885C40B, 0x8891C40B, 0x8896440B, 0x8899040B, 0x889C040B, 0x88A1840B, 0x87E88405, 0x87EF0405,
+		0x87F58405, 0x87FAC405, 0x8801C405, 0x88108405, 0x88144405, 0x881D4405, 0x88240405, 0x882AC405,
+		0x88310405, 0x88358405, 0x88424405, 0x88460405, 0x884F0405, 0x885AC405, 0x88600405, 0x8864C405,
+		0x88748405, 0x887DC405, 0x8885C405, 0x8891C405, 0x88964405, 0x88990405, 0x889C0405, 0x88A18405,
+		0x87E8840B, 0x87EF040B, 0x87F5840B, 0x87FAC40B, 0x8801C40B, 0x8810840B, 0x8814440B, 0x881D440B,
+		0x8824040B, 0x882AC40B, 0x8831040B, 0x8835840B, 0x8842440B, 0x8846040B, 0x884F040B, 0x885AC40B,
+		0x8860040B, 0x8864C40B, 0x8874840B, 0x887DC40B, 0x8885C40B, 0x8891C40B, 0x8896440B, 0x8899040B,
+		0x889C040B, 0x88A1840B, 0x87E88405, 0x87EF0405, 0x87F58405, 0x87FAC405, 0x8801C405, 0x88108405,
+		0x88144405, 0x881D4405, 0x88240405, 0x882AC405, 0x88310405, 0x88358405, 0x88424405, 0x88460405,
+		0x884F0405, 0x885AC405, 0x88600405, 0x8864C405, 0x88748405, 0x887DC405, 0x8885C405, 0x8891C405,
+		0x88964405, 0x88990405, 0x889C0405, 0x88A18405, 0x87E8840B, 0x87EF040B, 0x87F5840B, 0x87FAC40B,
+		0x8801C40B, 0x8810840B, 0x8814440B, 0x881D440B, 0x8824040B, 0x882AC40B, 0x8831040B, 0x8835840B,
+		0x8842440B, 0x8846040B, 0x884F040B, 0x885AC40B, 0x8860040B, 0x8864C40B, 0x8874840B, 0x887DC40B,
+		0x8885C40B, 0x8891C40B, 0x8896440B, 0x8899040B, 0x889C040B, 0x88A1840B, 0x87E88405, 0x87EF0405,
+		0x87F58405, 0x87FAC405, 0x8801C405, 0x88108405, 0x88144405, 0x881D4405, 0x88240405, 0x882AC405,
+		0x88310405, 0x88358405, 0x88424405, 0x88460405, 0x884F0405, 0x885AC405, 0x88600405, 0x8864C405,
+		0x88748405, 0x887DC405, 0x8885C405, 0x8891C405, 0x88964405, 0x88990405, 0x889C0405, 0x88A18405,
+		0x87E8840B, 0x87EF040B, 0x87F5840B, 0x87FAC40B, 0x8801C40B, 0x8810840B, 0x8814440B, 0x881D440B,
+		0x8824040B, 0x882AC40B, 0x8831040B, 0x8835840B, 0x8842440B, 0x8846040B, 0x884F040B, 0x885AC40B,
+		0x8860040B, 0x8864C40B, 0x8874840B, 0x887DC40B, 0x8885C40B, 0x8891C40B, 0x8896440B, 0x8899040B,
+		0x889C040B, 0x88A1840B, 0x87E88405, 0x87EF0405, 0x87F58405, 0x87FAC405, 0x8801C405, 0x88108405,
+		0x88144405, 0x881D4405, 0x88240405, 0x882AC405, 0x88310405, 0x88358405, 0x88424405, 0x88460405,
+		0x884F0405, 0x885AC405, 0x88600405, 0x8864C405, 0x88748405, 0x887DC405, 0x8885C405, 0x8891C405,
+		0x88964405, 0x88990405, 0x889C0405, 0x88A18405, 0x87E8840B, 0x87EF040B, 0x87F5840B, 0x87FAC40B,
+		0x8801C40B, 0x8810840B, 0x8814440B, 0x881D440B, 0x8824040B, 0x882AC40B, 0x8831040B, 0x8835840B,
+		0x8842440B, 0x8846040B, 0x884F040B, 0x885AC40B, 0x8860040B, 0x8864C40B, 0x8874840B, 0x887DC40B,
+		0x8885C40B, 0x8891C40B, 0x8896440B, 0x8899040B, 0x889C040B, 0x88A1840B, 0x87E88405, 0x87EF0405,
+		0x87F58405, 0x87FAC405, 0x8801C405, 0x88108405, 0x88144405, 0x881D4405, 0x88240405, 0x882AC405,
+		0x88310405, 0x88358405, 0x88424405, 0x88460405, 0x884F0405, 0x885AC405, 0x88600405, 0x8864C405,
+		0x88748405, 0x887DC405, 0x8885C405, 0x8891C405, 0x88964405, 0x88990405, 0x889C0405, 0x88A18405,
+		0x87E8840B, 0x87EF040B, 0x87F5840B, 0x87FAC40B, 0x8801C40B, 0x8810840B, 0x8814440B, 0x881D440B,
+		0x8824040B, 0x882AC40B, 0x8831040B, 0x8835840B, 0x8842440B, 0x8846040B, 0x884F040B, 0x885AC40B,
+		0x8860040B, 0x8864C40B, 0x8874840B, 0x887DC40B, 0x8885C40B, 0x8891C40B, 0x8896440B, 0x8899040B,
+		0x889C040B, 0x88A1840B, 0x87E88405, 0x87EF0405, 0x87F58405, 0x87FAC405, 0x8801C405, 0x88108405,
+		0x88144405, 0x881D4405, 0x88240405, 0x882AC405, 0x88310405, 0x88358405, 0x88424405, 0x88460405,
+		0x884F0405, 0x885AC405, 0x88600405, 0x8864C405, 0x88748405, 0x887DC405, 0x8885C405, 0x8891C405,
+		0x88964405, 0x88990405, 0x889C0405, 0x88A18405, 0x88250405, 0x882BC405, 0x00000000, 0x00000000,
+		0x88C7840B, 0x88C7C40B, 0x88C8040B, 0x88C8840B, 0x88C8C40B, 0x88C9C40B, 0x88CA440B, 0x88CA840B,
+		0x88CAC40B, 0x88CB440B, 0x88CB840B, 0x88CC040B, 0x88CC440B, 0x88CC840B, 0x88CCC40B, 0x88CD040B,
+		0x88CE440B, 0x88CA840B, 0x88CF040B, 0x88D0040B, 0x88D0440B, 0x88D0840B, 0x88D0C40B, 0x88D1040B,
+		0x88D1840B, 0xC1970405, 0x88C78405, 0x88C7C405, 0x88C80405, 0x88C88405, 0x88C8C405, 0x88C9C405,
+		0x88CA4405, 0x88CA8405, 0x88CAC405, 0x88CB4405, 0x88CB8405, 0x88CC0405, 0x88CC4405, 0x88CC8405,
+		0x88CCC405, 0x88CD0405, 0x88CE4405, 0x88CF0405, 0x88CF0405, 0x88D00405, 0x88D04405, 0x88D08405,
+		0x88D0C405, 0x88D10405, 0x88D18405, 0xC1960405, 0x88C8C405, 0x88CA8405, 0x88CB4405, 0x88D08405,
+		0x88CE4405, 0x88CD0405, 0x88C7840B, 0x88C7C40B, 0x88C8040B, 0x88C8840B, 0x88C8C40B, 0x88C9C40B,
+		0x88CA440B, 0x88CA840B, 0x88CAC40B, 0x88CB440B, 0x88CB840B, 0x88CC040B, 0x88CC440B, 0x88CC840B,
+		0x88CCC40B, 0x88CD040B, 0x88CE440B, 0x88CA840B, 0x88CF040B, 0x88D0040B, 0x88D0440B, 0x88D0840B,
+		0x88D0C40B, 0x88D1040B, 0x88D1840B, 0xC1970405, 0x88C78405, 0x88C7C405, 0x88C80405, 0x88C88405,
+		0x88C8C405, 0x88C9C405, 0x88CA4405, 0x88CA8405, 0x88CAC405, 0x88CB4405, 0x88CB8405, 0x88CC0405,
+		0x88CC4405, 0x88CC8405, 0x88CCC405, 0x88CD0405, 0x88CE4405, 0x88CF0405, 0x88CF0405, 0x88D00405,
+		0x88D04405, 0x88D08405, 0x88D0C405, 0x88D10405, 0x88D18405, 0xC1960405, 0x88C8C405, 0x88CA8405,
+		0x88CB4405, 0x88D08405, 0x88CE4405, 0x88CD0405, 0x88C7840B, 0x88C7C40B, 0x88C8040B, 0x88C8840B,
+		0x88C8C40B, 0x88C9C40B, 0x88CA440B, 0x88CA840B, 0x88CAC40B, 0x88CB440B, 0x88CB840B, 0x88CC040B,
+		0x88CC440B, 0x88CC840B, 0x88CCC40B, 0x88CD040B, 0x88CE440B, 0x88CA840B, 0x88CF040B, 0x88D0040B,
+		0x88D0440B, 0x88D0840B, 0x88D0C40B, 0x88D1040B, 0x88D1840B, 0xC1970405, 0x88C78405, 0x88C7C405,
+		0x88C80405, 0x88C88405, 0x88C8C405, 0x88C9C405, 0x88CA4405, 0x88CA8405, 0x88CAC405, 0x88CB4405,
+		0x88CB8405, 0x88CC0405, 0x88CC4405, 0x88CC8405, 0x88CCC405, 0x88CD0405, 0x88CE4405, 0x88CF0405,
+		0x88CF0405, 0x88D00405, 0x88D04405, 0x88D08405, 0x88D0C405, 0x88D10405, 0x88D18405, 0xC1960405,
+		0x88C8C405, 0x88CA8405, 0x88CB4405, 0x88D08405, 0x88CE4405, 0x88CD0405, 0x88C7840B, 0x88C7C40B,
+		0x88C8040B, 0x88C8840B, 0x88C8C40B, 0x88C9C40B, 0x88CA440B, 0x88CA840B, 0x88CAC40B, 0x88CB440B,
+		0x88CB840B, 0x88CC040B, 0x88CC440B, 0x88CC840B, 0x88CCC40B, 0x88CD040B, 0x88CE440B, 0x88CA840B,
+		0x88CF040B, 0x88D0040B, 0x88D0440B, 0x88D0840B, 0x88D0C40B, 0x88D1040B, 0x88D1840B, 0xC1970405,
+		0x88C78405, 0x88C7C405, 0x88C80405, 0x88C88405, 0x88C8C405, 0x88C9C405, 0x88CA4405, 0x88CA8405,
+		0x88CAC405, 0x88CB4405, 0x88CB8405, 0x88CC0405, 0x88CC4405, 0x88CC8405, 0x88CCC405, 0x88CD0405,
+		0x88CE4405, 0x88CF0405, 0x88CF0405, 0x88D00405, 0x88D04405, 0x88D08405, 0x88D0C405, 0x88D10405,
+		0x88D18405, 0xC1960405, 0x88C8C405, 0x88CA8405, 0x88CB4405, 0x88D08405, 0x88CE4405, 0x88CD0405,
+		0x88C7840B, 0x88C7C40B, 0x88C8040B, 0x88C8840B, 0x88C8C40B, 0x88C9C40B, 0x88CA440B, 0x88CA840B,
+		0x88CAC40B, 0x88CB440B, 0x88CB840B, 0x88CC040B, 0x88CC440B, 0x88CC840B, 0x88CCC40B, 0x88CD040B,
+		0x88CE440B, 0x88CA840B, 0x88CF040B, 0x88D0040B, 0x88D0440B, 0x88D0840B, 0x88D0C40B, 0x88D1040B,
+		0x88D1840B, 0xC1970405, 0x88C78405, 0x88C7C405, 0x88C80405, 0x88C88405, 0x88C8C405, 0x88C9C405,
+		0x88CA4405, 0x88CA8405, 0x88CAC405, 0x88CB4405, 0x88CB8405, 0x88CC0405, 0x88CC4405, 0x88CC8405,
+		0x88CCC405, 0x88CD0405, 0x88CE4405, 0x88CF0405, 0x88CF0405, 0x88D00405, 0x88D04405, 0x88D08405,
+		0x88D0C405, 0x88D10405, 0x88D18405, 0xC1960405, 0x88C8C405, 0x88CA8405, 0x88CB4405, 0x88D08405,
+		0x88CE4405, 0x88CD0405, 0x88C9040B, 0x88C90405, 0x00000000, 0x00000000, 0x87E60405, 0x87E64405,
+		0x87E68405, 0x87E6C405, 0x87E70405, 0x87E74405, 0x87E78405, 0x87E7C405, 0x87E80405, 0x87E84405,
+		0x87E60405, 0x87E64405, 0x87E68405, 0x87E6C405, 0x87E70405, 0x87E74405, 0x87E78405, 0x87E7C405,
+		0x87E80405, 0x87E84405, 0x87E60405, 0x87E64405, 0x87E68405, 0x87E6C405, 0x87E70405, 0x87E74405,
+		0x87E78405, 0x87E7C405, 0x87E80405, 0x87E84405, 0x87E60405, 0x87E64405, 0x87E68405, 0x87E6C405,
+		0x87E70405, 0x87E74405, 0x87E78405, 0x87E7C405, 0x87E80405, 0x87E84405, 0x87E60405, 0x87E64405,
+		0x87E68405, 0x87E6C405, 0x87E70405, 0x87E74405, 0x87E78405, 0x87E7C405, 0x87E80405, 0x87E84405,
+		0xC6BFC402, 0xC6C00402, 0xC6C04402, 0xC6C08402, 0xC6C0C402, 0xC6C10402, 0xC6C14402, 0xC6C18402,
+		0xC6C1C402, 0xC6C20402, 0xC6C24402, 0xC6C28402, 0xC6C2C402, 0xC6C30402, 0xC6C34402, 0xC6C38402,
+		0xC6C3C402, 0xC6C40402, 0xC6C44402, 0xC6C48402, 0xC6C4C402, 0xC6C50402, 0xC6C54402, 0xC6C58402,
+		0xC6C5C402, 0xC6C60402, 0xC6C64402, 0xC6C68402, 0xC6C6C402, 0xC6C70402, 0xC6C74402, 0xC6C78402,
+		0xC6C7C402, 0xC6C80402, 0xC6C84402, 0xC6C88402, 0xC6C8C402, 0xC6C90402, 0xC6C94402, 0xC6C98402,
+		0xC6C9C402, 0xC6CA0402, 0xC6CA4402, 0xC6CA8402, 0xC6CAC402, 0xC6CB0402, 0xC6CB4402, 0xC6CB8402,
+		0xC6CBC402, 0xC6CC0402, 0xC6CC4402, 0xC6CC8402, 0xC6CCC402, 0xC6CD0402, 0xC6CD4402, 0xC6CD8402,
+		0xC6CDC402, 0xC6CE0402, 0xC6CE4402, 0xC6CE8402, 0xC6CEC402, 0xC6CF0402, 0xC6CF4402, 0xC6CF8402,
+		0xC6CFC402, 0xC6D00402, 0xC6D04402, 0xC6D08402, 0xC6D0C402, 0xC6D10402, 0xC6D14402, 0xC6D18402,
+		0xC6D1C402, 0xC6D20402, 0xC6D24402, 0xC6D28402, 0xC6D2C402, 0xC6D30402, 0xC6D34402, 0xC6D38402,
+		0xC6D3C402, 0xC6D40402, 0xC6D44402, 0xC6D48402, 0xC6D4C402, 0xC6D50402, 0xC6D54402, 0xC6D58402,
+		0xC6D5C402, 0xC6D60402, 0xC6D64402, 0xC6D68402, 0xC6D6C402, 0xC6D70402, 0xC6D74402, 0xC6D78402,
+		0xC6D7C402, 0xC6D80402, 0xC6D84402, 0xC6D88402, 0xC6D8C402, 0xC6D90402, 0xC6D94402, 0xC6D98402,
+		0xC6D9C402, 0xC6DA0402, 0xC6DA4402, 0xC6DA8402, 0xC6DAC402, 0xC6DB0402, 0xC6DB4402, 0xC6DB8402,
+		0xC6DBC402, 0xC6DC0402, 0xC6DC4402, 0xC6DC8402, 0xC6DCC402, 0xC6DD0402, 0xC6DD4402, 0xC6DD8402,
+		0xC6DDC402, 0xC6DE0402, 0xC6DE4402, 0xC6DE8402, 0xC6DEC402, 0xC6DF0402, 0xC6DF4402, 0xC6DF8402,
+		0xC6DFC402, 0xC6E00402, 0xC6E04402, 0xC6E08402, 0xC6E0C402, 0xC6E10402, 0xC6E14402, 0xC6E18402,
+		0xC6E1C402, 0xC6E20402, 0xC6E24402, 0xC6E28402, 0xC6E2C402, 0xC6E30402, 0xC6E34402, 0xC6E38402,
+		0xC6E3C402, 0xC6E40402, 0xC6E44402, 0xC6E48402, 0xC6E4C402, 0xC6E50402, 0xC6E54402, 0xC6E58402,
+		0xC6E5C402, 0xC6E60402, 0xC6E64402, 0xC6E68402, 0xC6E6C402, 0xC6E70402, 0xC6E74402, 0xC6E78402,
+		0xC6E7C402, 0xC6E80402, 0xC6E84402, 0xC6E88402, 0xC6E8C402, 0xC6E90402, 0xC6E94402, 0xC6E98402,
+		0xC6E9C402, 0xC6EA0402, 0xC6EA4402, 0xC6EA8402, 0xC6EAC402, 0xC6EB0402, 0xC6EB4402, 0xC6EB8402,
+		0xC6EBC402, 0xC6EC0402, 0xC6EC4402, 0xC6EC8402, 0xC6ECC402, 0xC6ED0402, 0xC6ED4402, 0xC6ED8402,
+		0xC6EDC402, 0xC6EE0402, 0xC6EE4402, 0xC6EE8402, 0xC6EEC402, 0xC6EF0402, 0xC6EF4402, 0xC6EF8402,
+		0xC6EFC402, 0xC6F00402, 0xC6F04402, 0xC6F08402, 0xC6F0C402, 0xC6F10402, 0xC6F14402, 0xC6F18402,
+		0xC6F1C402, 0xC6F20402, 0xC6F24402, 0xC6F28402, 0xC6F2C402, 0xC6F30402, 0xC6F34402, 0xC6F38402,
+		0xC6F3C402, 0xC6F40402, 0xC6F44402, 0xC6F48402, 0xC6F4C402, 0xC6F50402, 0xC6F54402, 0xC6F58402,
+		0xC6F5C402, 0xC6F60402, 0xC6F64402, 0xC6F68402, 0xC6F6C402, 0xC6F70402, 0xC6F74402, 0xC6F78402,
+		0xC6F7C402, 0xC6F80402, 0xC6F84402, 0xC6F88402, 0xC6F8C402, 0xC6F90402, 0xC6F94402, 0xC6F98402,
+		0xC6F9C402, 0xC6FA0402, 0xC6FA4402, 0xC6FA8402, 0xC6FAC402, 0xC6FB0402, 0xC6FB4402, 0xC6FB8402,
+		0xC6FBC402, 0xC6FC0402, 0xC6FC4402, 0xC6FC8402, 0xC6FCC402, 0xC6FD0402, 0xC6FD4402, 0xC6FD8402,
+		0xC6FDC402, 0xC6FE0402, 0xC6FE4402, 0xC6FE8402, 0xC6FEC402, 0xC6FF0402, 0xC6FF4402, 0xC6FF8402,
+		0xC6FFC402, 0xC7000402, 0xC7004402, 0xC7008402, 0xC700C402, 0xC7010402, 0xC7014402, 0xC7018402,
+		0xC701C402, 0xC7020402, 0xC7024402, 0xC7028402, 0xC702C402, 0xC7030402, 0xC7034402, 0xC7038402,
+		0xC703C402, 0xC7040402, 0xC7044402, 0xC7048402, 0xC704C402, 0xC7050402, 0xC7054402, 0xC7058402,
+		0xC705C402, 0xC7060402, 0xC7064402, 0xC7068402, 0xC706C402, 0xC7070402, 0xC7074402, 0xC7078402,
+		0xC707C402, 0xC7080402, 0xC7084402, 0xC7088402, 0xC708C402, 0xC7090402, 0xC7094402, 0xC7098402,
+		0xC709C402, 0xC70A0402, 0xC70A4402, 0xC70A8402, 0xC70AC402, 0xC70B0402, 0xC70B4402, 0xC70B8402,
+		0xC70BC402, 0xC70C0402, 0xC70C4402, 0xC70C8402, 0xC70CC402, 0xC70D0402, 0xC70D4402, 0xC70D8402,
+		0xC70DC402, 0xC70E0402, 0xC70E4402, 0xC70E8402, 0xC70EC402, 0xC70F0402, 0xC70F4402, 0xC70F8402,
+		0xC70FC402, 0xC7100402, 0xC7104402, 0xC7108402, 0xC710C402, 0xC7110402, 0xC7114402, 0xC7118402,
+		0xC711C402, 0xC7120402, 0xC7124402, 0xC7128402, 0xC712C402, 0xC7130402, 0xC7134402, 0xC7138402,
+		0xC713C402, 0xC7140402, 0xC7144402, 0xC7148402, 0xC714C402, 0xC7150402, 0xC7154402, 0xC7158402,
+		0xC715C402, 0xC7160402, 0xC7164402, 0xC7168402, 0xC716C402, 0xC7170402, 0xC7174402, 0xC7178402,
+		0xC717C402, 0xC7180402, 0xC7184402, 0xC7188402, 0xC718C402, 0xC7190402, 0xC7194402, 0xC7198402,
+		0xC719C402, 0xC71A0402, 0xC71A4402, 0xC71A8402, 0xC71AC402, 0xC71B0402, 0xC71B4402, 0xC71B8402,
+		0xC71BC402, 0xC71C0402, 0xC71C4402, 0xC71C8402, 0xC71CC402, 0xC71D0402, 0xC71D4402, 0xC71D8402,
+		0xC71DC402, 0xC71E0402, 0xC71E4402, 0xC71E8402, 0xC71EC402, 0xC71F0402, 0xC71F4402, 0xC71F8402,
+		0xC71FC402, 0xC7200402, 0xC7204402, 0xC7208402, 0xC720C402, 0xC7210402, 0xC7214402, 0xC7218402,
+		0xC721C402, 0xC7220402, 0xC7224402, 0xC7228402, 0xC722C402, 0xC7230402, 0xC7234402, 0xC7238402,
+		0xC723C402, 0xC7240402, 0xC7244402, 0xC7248402, 0xC724C402, 0xC7250402, 0xC7254402, 0xC7258402,
+		0xC725C402, 0xC7260402, 0xC7264402, 0xC7268402, 0xC726C402, 0xC7270402, 0xC7274402, 0xC7278402,
+		0xC727C402, 0xC7280402, 0xC7284402, 0xC7288402, 0xC728C402, 0xC7290402, 0xC7294402, 0xC7298402,
+		0xC729C402, 0xC72A0402, 0xC72A4402, 0xC72A8402, 0xC72AC402, 0xC72B0402, 0xC72B4402, 0xC72B8402,
+		0xC72BC402, 0xC72C0402, 0xC72C4402, 0xC72C8402, 0xC72CC402, 0xC72D0402, 0xC72D4402, 0xC72D8402,
+		0xC72DC402, 0xC72E0402, 0xC72E4402, 0xC72E8402, 0xC72EC402, 0xC72F0402, 0xC72F4402, 0xC72F8402,
+		0xC72FC402, 0xC7300402, 0xC7304402, 0xC7308402, 0xC730C402, 0xC7310402, 0xC7314402, 0xC7318402,
+		0xC731C402, 0xC7320402, 0xC7324402, 0xC7328402, 0xC732C402, 0xC7330402, 0xC7334402, 0xC7338402,
+		0xC733C402, 0xC7340402, 0xC7344402, 0xC7348402, 0xC734C402, 0xC7350402, 0xC7354402, 0xC7358402,
+		0xC735C402, 0xC7360402, 0xC7364402, 0xC7368402, 0xC736C402, 0xC7370402, 0xC7374402, 0xC7378402,
+		0xC737C402, 0xC7380402, 0xC7384402, 0xC7388402, 0xC738C402, 0xC7390402, 0xC7394402, 0xC7398402,
+		0xC739C402, 0xC73A0402, 0xC73A4402, 0xC73A8402, 0xC73AC402, 0xC73B0402, 0xC73B4402, 0xC73B8402,
+		0xC73BC402, 0xC73C0402, 0xC73C4402, 0xC73C8402, 0xC73CC402, 0xC73D0402, 0xC73D4402, 0xC73D8402,
+		0xC73DC402, 0xC73E0402, 0xC73E4402, 0xC73E8402, 0xC73EC402, 0xC73F0402, 0xC73F4402, 0xC73F8402,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0xC73FC402,
+		0xC7400402, 0xC7404402, 0xC7408402, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0xC740C402, 0xC7410402, 0xC7414402,
+		0xC7418402, 0xC741C402, 0xC7420402, 0xC7424402, 0xC7428402, 0x80000000, 0xC742C402, 0xC7430402,
+		0xC7434402, 0xC7438402, 0xC743C402, 0xC7440402, 0xC7444402, 0xC7448402, 0xC744C402, 0xC7450402,
+		0xC7454402, 0xC7458402, 0xC745C402, 0xC7460402, 0x80000000, 0xC7464402, 0xC7468402, 0xC12BC402,
+		0xC12C0402, 0xC12C4402, 0xC12C8402, 0xC12CC402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x00000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x89528404, 0x8952C404, 0x89530404, 0x89534404, 0x89538404, 0x8953C404, 0x89540404, 0x00000000,
+		0x89548404, 0x8954C404, 0x89550404, 0x89554404, 0x89558404, 0x8955C404, 0x89560404, 0x89564404,
+		0x89568404, 0x8956C404, 0x89570404, 0x89574404, 0x89578404, 0x8957C404, 0x89580404, 0x89584404,
+		0x89588404, 0x00000000, 0x00000000, 0x89594404, 0x89598404, 0x8959C404, 0x895A0404, 0x895A4404,
+		0x895A8404, 0x895AC404, 0x00000000, 0x895B4404, 0x895B8404, 0x00000000, 0x895C0404, 0x895C4404,
+		0x895C8404, 0x895CC404, 0x895D0404, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x92988402, 0x9298C402, 0x92990402, 0x92994402, 0x92998402, 0x9299C402, 0x929A0402, 0x929A4402,
+		0x929A8402, 0x929AC402, 0x929B0402, 0x929B4402, 0x929B8402, 0x929BC402, 0x929C0402, 0x929C4402,
+		0x929C8402, 0x929CC402, 0x929D0402, 0x929D4402, 0x929D8402, 0x929DC402, 0x929E0402, 0x929E4402,
+		0x929E8402, 0x929EC402, 0x929F0402, 0x929F4402, 0x929F8402, 0x929FC402, 0x92A00402, 0x92A04402,
+		0x92A08402, 0x92A0C402, 0x92A10402, 0x92A14402, 0x92A18402, 0x92A1C402, 0x92A20402, 0x92A24402,
+		0x92A28402, 0x92A2C402, 0x92A30402, 0x92A34402, 0x92A38402, 0x00000000, 0x00000000, 0x00000000,
+		0x80001F42, 0x80001EC2, 0x80001F02, 0x80001F22, 0x80001F62, 0x80001F82, 0x80001EE2, 0x92A3C402,
+		0x92A40402, 0x92A44402, 0x92A48402, 0x92A4C402, 0x87D54402, 0x87D58402, 0x00000000, 0x00000000,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x92A50402, 0xC448C402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x92A54402, 0x92A58402, 0x92A5C402, 0x92A60402, 0x92A64402, 0x92A68402, 0x92A6C402, 0x92A70402,
+		0x92A74402, 0x92A78402, 0x92A7C402, 0x92A80402, 0x92A84402, 0x92A88402, 0x92A8C402, 0x92A90402,
+		0x92A94402, 0x92A98402, 0x92A9C402, 0x92AA0402, 0x92AA4402, 0x92AA8402, 0x92AAC402, 0x92AB0402,
+		0x92AB4402, 0x92AB8402, 0x92ABC402, 0x92AC0402, 0x92AC4402, 0x92AC8402, 0x92ACC402, 0x92AD0402,
+		0x92AD4402, 0x92AD8402, 0x92ADC402, 0x92AE0402, 0x92AE4402, 0x92AE8402, 0x92AEC402, 0x92AF0402,
+		0x92AF4402, 0x92AF8402, 0x92AFC402, 0x92B00402, 0x80001FA2, 0x80001FC2, 0x80001FE2, 0x80002002,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x87DDC402,
+		0x901B4402, 0x901B8402, 0x901BC402, 0x901C0402, 0x901C4402, 0x901C8402, 0x901CC402, 0x901D0402,
+		0x901D4402, 0x901D8402, 0x901DC402, 0x901E0402, 0x901E4402, 0x901E8402, 0x901EC402, 0x901F0402,
+		0x901F4402, 0x901F8402, 0x901FC402, 0x90200402, 0x90204402, 0x90208402, 0x9020C402, 0x90210402,
+		0x90214402, 0x90218402, 0x9021C402, 0x90220402, 0x90224402, 0x90228402, 0x9022C402, 0x90230402,
+		0x90234402, 0x90238402, 0x9023C402, 0x90240402, 0x90244402, 0x90248402, 0x9024C402, 0x90250402,
+		0x90254402, 0x90258402, 0x9025C402, 0x90260402, 0x90264402, 0x90268402, 0x9026C402, 0x90270402,
+		0x90274402, 0x90278402, 0x9027C402, 0x90280402, 0x90284402, 0x90288402, 0x9028C402, 0x90290402,
+		0x90294402, 0x90298402, 0x9029C402, 0x902A0402, 0x902A4402, 0x902A8402, 0x902AC402, 0x902B0402,
+		0x902B4402, 0x902B8402, 0x902BC402, 0x902C0402, 0x902C4402, 0x902C8402, 0x902CC402, 0x902D0402,
+		0x902D4402, 0x902D8402, 0x902DC402, 0x902E0402, 0x902E4402, 0x902E8402, 0x902EC402, 0x902F0402,
+		0x902F4402, 0x902F8402, 0x902FC402, 0x90300402, 0x90304402, 0x90308402, 0x9030C402, 0x90310402,
+		0x90314402, 0x90318402, 0x9031C402, 0x90320402, 0x90324402, 0x90328402, 0x9032C402, 0x90330402,
+		0x90334402, 0x90338402, 0x9033C402, 0x90340402, 0x90344402, 0x90348402, 0x9034C402, 0x90350402,
+		0x90354402, 0x90358402, 0x9035C402, 0x90360402, 0x90364402, 0x90368402, 0x9036C402, 0x90370402,
+		0x90374402, 0x90378402, 0x9037C402, 0x90380402, 0x90384402, 0x90388402, 0x9038C402, 0x90390402,
+		0x90394402, 0x90398402, 0x9039C402, 0x903A0402, 0x903A4402, 0x903A8402, 0x903AC402, 0x903B0402,
+		0x903B4402, 0x903B8402, 0x903BC402, 0x903C0402, 0x903C4402, 0x903C8402, 0x903CC402, 0x903D0402,
+		0x903D4402, 0x903D8402, 0x903DC402, 0x903E0402, 0x903E4402, 0x903E8402, 0x903EC402, 0x903F0402,
+		0x903F4402, 0x903F8402, 0x903FC402, 0x90400402, 0x90404402, 0x90408402, 0x9040C402, 0x90410402,
+		0x90414402, 0x90418402, 0x9041C402, 0x90420402, 0x90424402, 0x90428402, 0x9042C402, 0x90430402,
+		0x90434402, 0x90438402, 0x9043C402, 0x90440402, 0x90444402, 0x90448402, 0x9044C402, 0x90450402,
+		0x90454402, 0x90458402, 0x9045C402, 0x90460402, 0x90464402, 0x90468402, 0x9046C402, 0x90470402,
+		0x90474402, 0x90478402, 0x9047C402, 0x90480402, 0x90484402, 0x90488402, 0x9048C402, 0x90490402,
+		0x90494402, 0x90498402, 0x9049C402, 0x904A0402, 0x904A4402, 0x904A8402, 0x904AC402, 0x904B0402,
+		0x904B4402, 0x904B8402, 0x904BC402, 0x904C0402, 0x904C4402, 0x00000000, 0x00000000, 0x87E64402,
+		0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402, 0x87E80402, 0x87E84402,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x90548408, 0x9054C408, 0x90550408, 0x90554408, 0x90558408, 0x9055C408, 0x90560408, 0x90564408,
+		0x90568408, 0x9056C408, 0x90570408, 0x90574408, 0x90578408, 0x9057C408, 0x90580408, 0x90584408,
+		0x90588408, 0x9058C408, 0x90590408, 0x90594408, 0x90598408, 0x9059C408, 0x905A0408, 0x905A4408,
+		0x905A8408, 0x905AC408, 0x905B0408, 0x905B4408, 0x905B8408, 0x905BC408, 0x905C0408, 0x905C4408,
+		0x905C8408, 0x905CC408, 0x90548402, 0x9054C402, 0x90550402, 0x90554402, 0x90558402, 0x9055C402,
+		0x90560402, 0x90564402, 0x90568402, 0x9056C402, 0x90570402, 0x90574402, 0x90578402, 0x9057C402,
+		0x90580402, 0x90584402, 0x90588402, 0x9058C402, 0x90590402, 0x90594402, 0x90598402, 0x9059C402,
+		0x905A0402, 0x905A4402, 0x905A8402, 0x905AC402, 0x905B0402, 0x905B4402, 0x905B8402, 0x905BC402,
+		0x905C0402, 0x905C4402, 0x905C8402, 0x905CC402, 0x800017A2, 0x800017A2, 0x800017A2, 0x800017E2,
+		0x80001802, 0x80001822, 0x800017C2, 0x905D0402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x87E60402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xC09B0402, 0xC09EC402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0xC7A70402, 0xC7A74402, 0xC7A78402, 0xC7A7C402, 0xC7A80402, 0xC7A84402,
+		0xC7A88402, 0xC7A8C402, 0xC7A90402, 0xC7A94402, 0xC7A98402, 0xC7A9C402, 0xC7AA0402, 0xC7AA4402,
+		0xC7AA8402, 0xC7AAC402, 0xC7AB0402, 0xC7AB4402, 0xC7AB8402, 0xC7ABC402, 0xC7AC0402, 0xC7AC4402,
+		0xC7AC8402, 0xC7ACC402, 0xC7AD0402, 0xC7AD4402, 0xC7AD8402, 0xC7ADC402, 0xC7AE0402, 0xC7AE4402,
+		0xC7AE8402, 0xC7AEC402, 0xC7AF0402, 0xC7AF4402, 0xC7AF8402, 0xC7AFC402, 0xC7B00402, 0xC7B04402,
+		0xC7B08402, 0xC7B0C402, 0xC7B10402, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402,
+		0x87E78402, 0x87E7C402, 0x87E80402, 0x87E84402, 0xC4C54402, 0xC7B14402, 0xC7B18402, 0xC7B1C402,
+		0x87E44402, 0x000119C2, 0x00032C42, 0xC7B20402, 0xC7B24402, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x87E64402, 0x87E68402, 0x87E6C402, 0x87E70402, 0x87E74402, 0x87E78402, 0x87E7C402,
+		0x87E80402, 0x87E84402, 0xC7B28402, 0xC7B2C402, 0xC7B30402, 0xC7B34402, 0xC7B38402, 0xC7B3C402,
+		0xC7B40402, 0xC7B44402, 0xC7B48402, 0xC7B4C402, 0xC7B50402, 0xC7B54402, 0xC7B58402, 0xC7B5C402,
+		0xC7B60402, 0xC7B64402, 0xC7B68402, 0xC7B6C402, 0xC7B70402, 0xC7B74402, 0xC7B78402, 0xC7B7C402,
+		0xC7B80402, 0xC7B84402, 0xC7B88402, 0xC7B8C402, 0xC7B90402, 0xC7B94402, 0xC7B98402, 0xC7B9C402,
+		0xC7BA0402, 0xC7BA4402, 0xC7BA8402, 0xC7BAC402, 0xC7BB0402, 0xC7BB4402, 0xC4C58402, 0x00047442,
+		0x00035DC2, 0x00019902, 0x0003A5C2, 0x00014502, 0x000025C2, 0x0003C002, 0x0003E6C2, 0xC7BB8402,
+		0xC7BBC402, 0xC7BC0402, 0xC7BC4402, 0xC7BC8402, 0xC7BCC402, 0xC7BD0402, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x899C8405, 0x899D0405, 0x89A3C405, 0x89A90405, 0x00000000, 0x89CA0405, 0x89AD0405, 0x89A64405,
+		0x89B5C405, 0x89CDC405, 0x89BD8405, 0x89C30405, 0x89C50405, 0x89C60405, 0x89B18405, 0x89B6C405,
+		0x89B90405, 0x89B44405, 0x89BC0405, 0x89ACC405, 0x89B1C405, 0x89A14405, 0x89A18405, 0x89A68405,
+		0x89A94405, 0x89B48405, 0x89B60405, 0x89B70405, 0x899CC405, 0x89C64405, 0x89B94405, 0x89BBC405,
+		0x00000000, 0x899D0405, 0x89A3C405, 0x00000000, 0x89C88405, 0x00000000, 0x00000000, 0x89A64405,
+		0x00000000, 0x89CDC405, 0x89BD8405, 0x89C30405, 0x89C50405, 0x89C60405, 0x89B18405, 0x89B6C405,
+		0x89B90405, 0x89B44405, 0x89BC0405, 0x00000000, 0x89B1C405, 0x89A14405, 0x89A18405, 0x89A68405,
+		0x00000000, 0x89B48405, 0x00000000, 0x89B70405, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x89A3C405, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x89A64405,
+		0x00000000, 0x89CDC405, 0x00000000, 0x89C30405, 0x00000000, 0x89C60405, 0x89B18405, 0x89B6C405,
+		0x00000000, 0x89B44405, 0x89BC0405, 0x00000000, 0x89B1C405, 0x00000000, 0x00000000, 0x89A68405,
+		0x00000000, 0x89B48405, 0x00000000, 0x89B70405, 0x00000000, 0x89C64405, 0x00000000, 0x89BBC405,
+		0x00000000, 0x899D0405, 0x89A3C405, 0x00000000, 0x89C88405, 0x00000000, 0x00000000, 0x89A64405,
+		0x89B5C405, 0x89CDC405, 0x89BD8405, 0x00000000, 0x89C50405, 0x89C60405, 0x89B18405, 0x89B6C405,
+		0x89B90405, 0x89B44405, 0x89BC0405, 0x00000000, 0x89B1C405, 0x89A14405, 0x89A18405, 0x89A68405,
+		0x00000000, 0x89B48405, 0x89B60405, 0x89B70405, 0x899CC405, 0x00000000, 0x89B94405, 0x00000000,
+		0x899C8405, 0x899D0405, 0x89A3C405, 0x89A90405, 0x89C88405, 0x89CA0405, 0x89AD0405, 0x89A64405,
+		0x89B5C405, 0x89CDC405, 0x00000000, 0x89C30405, 0x89C50405, 0x89C60405, 0x89B18405, 0x89B6C405,
+		0x89B90405, 0x89B44405, 0x89BC0405, 0x89ACC405, 0x89B1C405, 0x89A14405, 0x89A18405, 0x89A68405,
+		0x89A94405, 0x89B48405, 0x89B60405, 0x89B70405, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x899D0405, 0x89A3C405, 0x89A90405, 0x00000000, 0x89CA0405, 0x89AD0405, 0x89A64405,
+		0x89B5C405, 0x89CDC405, 0x00000000, 0x89C30405, 0x89C50405, 0x89C60405, 0x89B18405, 0x89B6C405,
+		0x89B90405, 0x89B44405, 0x89BC0405, 0x89ACC405, 0x89B1C405, 0x89A14405, 0x89A18405, 0x89A68405,
+		0x89A94405, 0x89B48405, 0x89B60405, 0x89B70405, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xC14BC402, 0xC14C0402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xC4C5C402, 0xC4C60402, 0xC4C64402, 0xC4C68402, 0xC4C6C402, 0xC4C70402, 0xC4C74402, 0xC4C78402,
+		0xC4C7C402, 0xC4C80402, 0xC4C84402, 0xC4C88402, 0xC4C8C402, 0xC4C90402, 0xC4C94402, 0xC4C98402,
+		0xC4C9C402, 0xC4CA0402, 0xC4CA4402, 0xC4CA8402, 0xC4CAC402, 0xC4CB0402, 0xC4CB4402, 0xC4CB8402,
+		0xC4CBC402, 0xC4CC0402, 0xC4CC4402, 0xC4CC8402, 0xC4CCC402, 0xC4CD0402, 0xC4CD4402, 0xC4CD8402,
+		0xC4CDC402, 0xC4CE0402, 0xC4CE4402, 0xC4CE8402, 0xC4CEC402, 0xC4CF0402, 0xC4CF4402, 0xC4CF8402,
+		0xC4CFC402, 0xC4D00402, 0xC4D04402, 0xC4D08402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xC4D0C402, 0xC4D10402, 0xC4D14402, 0xC4D18402, 0xC4D1C402, 0xC4D20402, 0xC4D24402, 0xC4D28402,
+		0xC4D2C402, 0xC4D30402, 0xC4D34402, 0xC4D38402, 0xC4D3C402, 0xC4D40402, 0xC4D44402, 0xC4D48402,
+		0xC4D4C402, 0xC4D50402, 0xC4D54402, 0xC4D58402, 0xC4D5C402, 0xC4D60402, 0xC4D64402, 0xC4D68402,
+		0xC4D6C402, 0xC4D70402, 0xC4D74402, 0xC4D78402, 0xC4D7C402, 0xC4D80402, 0xC4D84402, 0xC4D88402,
+		0xC4D8C402, 0xC4D90402, 0xC4D94402, 0xC4D98402, 0xC4D9C402, 0xC4DA0402, 0xC4DA4402, 0xC4DA8402,
+		0xC4DAC402, 0xC4DB0402, 0xC4DB4402, 0xC4DB8402, 0xC4DBC402, 0xC4DC0402, 0xC4DC4402, 0xC4DC8402,
+		0xC4DCC402, 0xC4DD0402, 0xC4DD4402, 0xC4DD8402, 0xC4DDC402, 0xC4DE0402, 0xC4DE4402, 0xC4DE8402,
+		0xC4DEC402, 0xC4DF0402, 0xC4DF4402, 0xC4DF8402, 0xC4DFC402, 0xC4E00402, 0xC4E04402, 0xC4E08402,
+		0xC4E0C402, 0xC4E10402, 0xC4E14402, 0xC4E18402, 0xC4E1C402, 0xC4E20402, 0xC4E24402, 0xC4E28402,
+		0xC4E2C402, 0xC4E30402, 0xC4E34402, 0xC4E38402, 0xC4E3C402, 0xC4E40402, 0xC4E44402, 0xC4E48402,
+		0xC4E4C402, 0xC4E50402, 0xC4E54402, 0xC4E58402, 0xC4E5C402, 0xC4E60402, 0xC4E64402, 0xC4E68402,
+		0xC4E6C402, 0xC4E70402, 0xC4E74402, 0xC4E78402, 0xC4E7C402, 0xC4E80402, 0xC4E84402, 0xC4E88402,
+		0xC4E8C402, 0xC4E90402, 0xC4E94402, 0xC4E98402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xC4E9C402, 0xC4EA0402, 0xC4EA4402, 0xC4EA8402, 0xC4EAC402, 0xC4EB0402, 0xC4EB4402, 0xC4EB8402,
+		0xC4EBC402, 0xC4EC0402, 0xC4EC4402, 0xC4EC8402, 0xC4ECC402, 0xC4ED0402, 0xC4ED4402, 0x00000000,
+		0x00000000, 0xC4ED8402, 0xC4EDC402, 0xC4EE0402, 0xC4EE4402, 0xC4EE8402, 0xC4EEC402, 0xC4EF0402,
+		0xC4EF4402, 0xC4EF8402, 0xC4EFC402, 0xC4F00402, 0xC4F04402, 0xC4F08402, 0xC4F0C402, 0xC4F10402,
+		0x00000000, 0xC4F14402, 0xC4F18402, 0xC4F1C402, 0xC4F20402, 0xC4F24402, 0xC4F28402, 0xC4F2C402,
+		0xC4F30402, 0xC4F34402, 0xC4F38402, 0xC4F3C402, 0xC4F40402, 0xC4F44402, 0xC4F48402, 0xC4F4C402,
+		0x00000000, 0xC4F50402, 0xC4F54402, 0xC4F58402, 0xC4F5C402, 0xC4F60402, 0xC4F64402, 0xC4F68402,
+		0xC4F6C402, 0xC4F70402, 0xC4F74402, 0xC4F78402, 0xC4F7C402, 0xC4F80402, 0xC4F84402, 0xC4F88402,
+		0xC4F8C402, 0xC4F90402, 0xC4F94402, 0xC4F98402, 0xC4F9C402, 0xC4FA0402, 0xC4FA4402, 0xC4FA8402,
+		0xC4FAC402, 0xC4FB0402, 0xC4FB4402, 0xC4FB8402, 0xC4FBC402, 0xC4FC0402, 0xC4FC4402, 0xC4FC8402,
+		0xC4FCC402, 0xC4FD0402, 0xC4FD4402, 0xC4FD8402, 0xC4FDC402, 0xC4FE0402, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00006202, 0x00048D42, 0x0001DE02, 0x00044402, 0x00031282, 0x0001EE02, 0x00021482, 0x000037C2,
+		0x0001B9C2, 0x0001C282, 0x0002D9C2, 0x87E60406, 0x87E60406, 0xC516C402, 0xC5170402, 0xC5174402,
+		0x0001A7C3, 0x00036E83, 0x0000C4C3, 0x00032183, 0x00045943, 0x0000B5C3, 0x000122C3, 0x000132C3,
+		0x00005103, 0x00005A83, 0x0003FF83, 0x000235C3, 0x00007F03, 0x00033983, 0x00044003, 0x00015FC3,
+		0x00043483, 0x000001C3, 0x0002B103, 0x00004DC3, 0x00019103, 0x0002E683, 0x00027A03, 0x0004A3C3,
+		0x00031EC3, 0x00032B83, 0x00020083, 0x87F5840C, 0x8864C40C, 0x00006E02, 0x0001B8C2, 0xC174C402,
+		0x87E8841D, 0x87EF041D, 0x87F5841D, 0x87FAC41D, 0x8801C41D, 0x8810841D, 0x8814441D, 0x881D441D,
+		0x8824041D, 0x882AC41D, 0x8831041D, 0x8835841D, 0x8842441D, 0x8846041D, 0x884F041D, 0x885AC41D,
+		0x8860041D, 0x8864C41D, 0x8874841D, 0x887DC41D, 0x8885C41D, 0x8891C41D, 0x8896441D, 0x8899041D,
+		0x889C041D, 0x88A1841D, 0x00036882, 0x00006582, 0x00024142, 0x0003CCC2, 0x00028543, 0x0000CC42,
+		0x87E8840C, 0x87EF040C, 0x87F5840C, 0x87FAC40C, 0x8801C40C, 0x8810840C, 0x8814440C, 0x881D440C,
+		0x8824040C, 0x882AC40C, 0x8831040C, 0x8835840C, 0x8842440C, 0x8846040C, 0x884F040C, 0x885AC40C,
+		0x8860040C, 0x8864C40C, 0x8874840C, 0x887DC40C, 0x8885C40C, 0x8891C40C, 0x8896440C, 0x8899040C,
+		0x889C040C, 0x88A1840C, 0x00034442, 0x00005C02, 0x00026182, 0xC5178402, 0xC517C402, 0xC5180402,
+		0x87E8841D, 0x87EF041D, 0x87F5841D, 0x87FAC41D, 0x8801C41D, 0x8810841D, 0x8814441D, 0x881D441D,
+		0x8824041D, 0x882AC41D, 0x8831041D, 0x8835841D, 0x8842441D, 0x8846041D, 0x884F041D, 0x885AC41D,
+		0x8860041D, 0x8864C41D, 0x8874841D, 0x887DC41D, 0x8885C41D, 0x8891C41D, 0x8896441D, 0x8899041D,
+		0x889C041D, 0x88A1841D, 0x885AC41D, 0x00001B82, 0x0001FB42, 0x00042CC2, 0x0002C6C2, 0x00011442,
+		0x00026982, 0x0001CB02, 0x00047C04, 0x00021384, 0x0000F7C2, 0x0004B483, 0x00044142, 0x0002D942,
+		0x0003BE43, 0x0003CB43, 0x000039C2, 0x000337C2, 0x00039A87, 0x00023242, 0x00012682, 0x0002B442,
+		0x0004B003, 0x00008783, 0x00029B04, 0x00004283, 0x00017644, 0x87FAC41C, 0x0002D342, 0x00043C43,
+		0x00035786, 0x000364C8, 0x000218C3, 0x0003F403, 0x00038B03, 0xC1754402, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xC2C88402, 0xC2C8C402,
+		0xC2C90402, 0xC2C94402, 0xC2C98402, 0xC2C9C402, 0xC2CA0402, 0xC2CA4402, 0xC2CA8402, 0xC2CAC402,
+		0xC2CB0402, 0xC2CB4402, 0xC2CB8402, 0xC2CBC402, 0xC2CC0402, 0xC2CC4402, 0xC2CC8402, 0xC2CCC402,
+		0xC2CD0402, 0xC2CD4402, 0xC2CD8402, 0xC2CDC402, 0xC2CE0402, 0xC2CE4402, 0xC2CE8402, 0xC2CEC402,
+		0x0000C9C2, 0x0003BF82, 0x90B9441C, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x0001DF82, 0x00027582, 0x00006302, 0x0002C0C2, 0x00040AC2, 0x00007842, 0x00000482, 0x00025982,
+		0x0000DB42, 0x0000E382, 0x000451C2, 0x00016542, 0x0000BB42, 0x0002BB42, 0x00041002, 0x00022B82,
+		0x00041DC2, 0x00012702, 0x00033102, 0x0000DBC2, 0x00020CC2, 0x0002F902, 0x00036C42, 0x0003A202,
+		0x0002C342, 0x0002CE42, 0x00018682, 0x00048842, 0x0002EF42, 0x0000CDC2, 0x0001CC02, 0x0003CE02,
+		0x0002CB82, 0x00023142, 0x000447C2, 0x0001E802, 0x0000B302, 0x00045B02, 0x00048302, 0x0002A442,
+		0x00042782, 0x00042242, 0x00008242, 0x00037602, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00002044, 0x00044944, 0x00022E04, 0x000493C4, 0x00035CC4, 0x00024FC4, 0x0001D504, 0x000096C4,
+		0x00017CC4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x000152C2, 0x00031442, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xC5184402, 0xC5188402, 0xC518C402, 0xC5190402, 0xC5194402, 0xC5198402, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xC519C402, 0xC51A0402, 0xC51A4402, 0xC51A8402, 0xC51AC402, 0xC51B0402, 0xC51B4402, 0xC51B8402,
+		0xC51BC402, 0xC51C0402, 0xC51C4402, 0xC51C8402, 0xC51CC402, 0xC51D0402, 0xC51D4402, 0xC51D8402,
+		0xC51DC402, 0xC51E0402, 0xC51E4402, 0xC51E8402, 0xC51EC402, 0xC51F0402, 0xC51F4402, 0xC51F8402,
+		0xC51FC402, 0xC5200402, 0xC5204402, 0xC5208402, 0xC520C402, 0xC5210402, 0xC5214402, 0xC5218402,
+		0xC521C402, 0xC5220402, 0xC5224402, 0xC5228402, 0xC522C402, 0xC5230402, 0xC5234402, 0xC5238402,
+		0xC523C402, 0xC5240402, 0xC5244402, 0xC5248402, 0xC524C402, 0xC5250402, 0xC5254402, 0xC5258402,
+		0xC525C402, 0xC5260402, 0xC5264402, 0xC5268402, 0xC526C402, 0xC5270402, 0xC5274402, 0xC5278402,
+		0xC527C402, 0xC5280402, 0xC5284402, 0xC5288402, 0xC528C402, 0xC5290402, 0xC5294402, 0xC5298402,
+		0xC529C402, 0xC52A0402, 0xC52A4402, 0xC52A8402, 0xC52AC402, 0xC52B0402, 0xC52B4402, 0xC52B8402,
+		0xC52BC402, 0xC52C0402, 0xC52C4402, 0xC52C8402, 0xC52CC402, 0xC52D0402, 0xC52D4402, 0xC52D8402,
+		0xC52DC402, 0xC52E0402, 0xC52E4402, 0xC52E8402, 0xC52EC402, 0xC52F0402, 0xC52F4402, 0xC52F8402,
+		0xC52FC402, 0xC5300402, 0xC5304402, 0xC5308402, 0xC530C402, 0xC5310402, 0xC5314402, 0xC5318402,
+		0xC531C402, 0xC5320402, 0xC5324402, 0xC5328402, 0xC532C402, 0xC5330402, 0xC5334402, 0xC5338402,
+		0xC533C402, 0xC5340402, 0xC5344402, 0xC5348402, 0xC534C402, 0xC5350402, 0xC5354402, 0xC5358402,
+		0xC535C402, 0xC5360402, 0xC5364402, 0xC5368402, 0xC536C402, 0xC5370402, 0xC5374402, 0xC5378402,
+		0xC537C402, 0xC5380402, 0xC5384402, 0xC5388402, 0xC538C402, 0xC5390402, 0xC5394402, 0xC5398402,
+		0xC539C402, 0xC53A0402, 0xC53A4402, 0xC53A8402, 0xC53AC402, 0xC53B0402, 0xC53B4402, 0xC53B8402,
+		0xC53BC402, 0xC53C0402, 0xC53C4402, 0xC53C8402, 0xC53CC402, 0xC53D0402, 0xC53D4402, 0xC53D8402,
+		0xC53DC402, 0xC53E0402, 0xC53E4402, 0xC53E8402, 0xC53EC402, 0xC53F0402, 0xC53F4402, 0xC53F8402,
+		0xC53FC402, 0xC5400402, 0xC5404402, 0xC5408402, 0xC540C402, 0xC5410402, 0xC5414402, 0xC5418402,
+		0xC541C402, 0xC5420402, 0xC5424402, 0xC5428402, 0xC542C402, 0xC5430402, 0xC5434402, 0xC5438402,
+		0xC543C402, 0xC5440402, 0xC5444402, 0xC5448402, 0xC544C402, 0xC5450402, 0xC5454402, 0xC5458402,
+		0xC545C402, 0xC5460402, 0xC5464402, 0xC5468402, 0xC546C402, 0xC5470402, 0xC5474402, 0xC5478402,
+		0xC547C402, 0xC5480402, 0xC5484402, 0xC5488402, 0xC548C402, 0xC5490402, 0xC5494402, 0xC5498402,
+		0xC549C402, 0xC54A0402, 0xC54A4402, 0xC54A8402, 0xC54AC402, 0xC54B0402, 0xC54B4402, 0xC54B8402,
+		0xC54BC402, 0xC54C0402, 0xC54C4402, 0xC54C8402, 0xC54CC402, 0xC54D0402, 0xC54D4402, 0xC54D8402,
+		0xC54DC402, 0xC54E0402, 0xC54E4402, 0xC54E8402, 0xC54EC402, 0xC54F0402, 0xC54F4402, 0xC54F8402,
+		0xC54FC402, 0xC5500402, 0xC5504402, 0xC5508402, 0xC550C402, 0xC5510402, 0xC5514402, 0xC5518402,
+		0xC551C402, 0xC5520402, 0xC5524402, 0xC5528402, 0xC552C402, 0xC5530402, 0xC5534402, 0xC5538402,
+		0xC553C402, 0xC5540402, 0xC5544402, 0xC5548402, 0xC554C402, 0xC5550402, 0xC5554402, 0xC5558402,
+		0xC555C402, 0xC5560402, 0xC5564402, 0xC5568402, 0xC556C402, 0xC5570402, 0xC5574402, 0xC5578402,
+		0xC557C402, 0xC5580402, 0xC5584402, 0xC5588402, 0xC558C402, 0xC5590402, 0xC5594402, 0xC5598402,
+		0xC559C402, 0xC55A0402, 0xC55A4402, 0xC55A8402, 0xC55AC402, 0xC55B0402, 0xC55B4402, 0xC55B8402,
+		0xC55BC402, 0xC55C0402, 0xC55C4402, 0xC55C8402, 0xC55CC402, 0xC55D0402, 0xC55D4402, 0xC55D8402,
+		0xC55DC402, 0xC55E0402, 0xC55E4402, 0xC55E8402, 0xC55EC402, 0xC55F0402, 0xC55F4402, 0xC55F8402,
+		0xC55FC402, 0xC5600402, 0xC5604402, 0xC5608402, 0xC560C402, 0xC5610402, 0xC5614402, 0xC5618402,
+		0xC561C402, 0xC5620402, 0xC5624402, 0xC5628402, 0xC562C402, 0xC5630402, 0xC5634402, 0xC5638402,
+		0xC563C402, 0xC5640402, 0xC5644402, 0xC5648402, 0xC564C402, 0xC5650402, 0xC5654402, 0xC5658402,
+		0xC565C402, 0xC5660402, 0xC5664402, 0xC5668402, 0xC566C402, 0xC5670402, 0xC5674402, 0xC5678402,
+		0xC567C402, 0xC5680402, 0xC5684402, 0xC5688402, 0xC568C402, 0xC5690402, 0xC5694402, 0xC5698402,
+		0xC569C402, 0xC56A0402, 0xC56A4402, 0xC56A8402, 0xC56AC402, 0xC56B0402, 0xC56B4402, 0xC56B8402,
+		0xC56BC402, 0xC56C0402, 0xC56C4402, 0xC56C8402, 0xC56CC402, 0xC56D0402, 0xC56D4402, 0xC56D8402,
+		0xC56DC402, 0xC56E0402, 0xC56E4402, 0xC56E8402, 0xC56EC402, 0xC56F0402, 0xC56F4402, 0xC56F8402,
+		0xC56FC402, 0xC5700402, 0xC5704402, 0xC5708402, 0xC570C402, 0xC5710402, 0xC5714402, 0xC5718402,
+		0xC571C402, 0xC5720402, 0xC5724402, 0xC5728402, 0xC572C402, 0xC5730402, 0xC5734402, 0xC5738402,
+		0xC573C402, 0xC5740402, 0xC5744402, 0xC5748402, 0xC574C402, 0xC5750402, 0xC5754402, 0xC5758402,
+		0xC575C402, 0xC5760402, 0xC5764402, 0xC5768402, 0xC576C402, 0xC5770402, 0xC5774402, 0xC5778402,
+		0xC577C402, 0xC5780402, 0xC5784402, 0xC5788402, 0xC578C402, 0xC5790402, 0xC5794402, 0xC5798402,
+		0xC579C402, 0xC57A0402, 0xC57A4402, 0xC57A8402, 0xC57AC402, 0xC57B0402, 0xC57B4402, 0xC57B8402,
+		0xC57BC402, 0xC57C0402, 0xC57C4402, 0xC57C8402, 0xC57CC402, 0xC57D0402, 0xC57D4402, 0xC57D8402,
+		0xC57DC402, 0xC57E0402, 0xC57E4402, 0xC57E8402, 0xC57EC402, 0xC57F0402, 0xC57F4402, 0xC57F8402,
+		0xC57FC402, 0xC5800402, 0xC5804402, 0xC5808402, 0xC580C402, 0xC5810402, 0xC5814402, 0xC5818402,
+		0xC581C402, 0xC5820402, 0xC5824402, 0xC5828402, 0xC582C402, 0xC5830402, 0xC5834402, 0xC5838402,
+		0xC583C402, 0xC5840402, 0xC5844402, 0xC5848402, 0xC584C402, 0xC5850402, 0xC5854402, 0xC5858402,
+		0xC585C402, 0xC5860402, 0xC5864402, 0xC5868402, 0xC586C402, 0xC5870402, 0xC5874402, 0xC5878402,
+		0xC587C402, 0xC5880402, 0xC5884402, 0xC5888402, 0xC588C402, 0xC5890402, 0xC5894402, 0xC5898402,
+		0xC589C402, 0xC58A0402, 0xC58A4402, 0xC58A8402, 0xC58AC402, 0xC58B0402, 0xC58B4402, 0xC58B8402,
+		0xC58BC402, 0xC58C0402, 0xC58C4402, 0xC58C8402, 0xC58CC402, 0xC58D0402, 0xC58D4402, 0xC58D8402,
+		0xC58DC402, 0xC58E0402, 0xC58E4402, 0xC58E8402, 0xC58EC402, 0xC58F0402, 0xC58F4402, 0xC58F8402,
+		0xC58FC402, 0xC5900402, 0xC5904402, 0xC5908402, 0xC590C402, 0xC5910402, 0xC5914402, 0xC5918402,
+		0xC591C402, 0xC5920402, 0xC5924402, 0xC5928402, 0xC592C402, 0xC5930402, 0xC5934402, 0xC5938402,
+		0xC593C402, 0xC5940402, 0xC5944402, 0xC5948402, 0xC594C402, 0xC5950402, 0xC5954402, 0xC5958402,
+		0xC595C402, 0xC5960402, 0xC5964402, 0xC5968402, 0xC596C402, 0xC5970402, 0xC5974402, 0xC5978402,
+		0xC597C402, 0xC5980402, 0xC5984402, 0xC5988402, 0xC598C402, 0xC5990402, 0xC5994402, 0xC5998402,
+		0xC599C402, 0xC59A0402, 0xC59A4402, 0xC59A8402, 0xC59AC402, 0xC59B0402, 0xC59B4402, 0xC59B8402,
+		0xC59BC402, 0xC59C0402, 0xC59C4402, 0xC59C8402, 0xC59CC402, 0xC59D0402, 0xC59D4402, 0xC59D8402,
+		0xC59DC402, 0xC59E0402, 0xC59E4402, 0xC59E8402, 0xC59EC402, 0xC59F0402, 0xC59F4402, 0xC59F8402,
+		0xC59FC402, 0xC5A00402, 0xC5A04402, 0xC5A08402, 0xC5A0C402, 0xC5A10402, 0xC5A14402, 0xC5A18402,
+		0xC5A1C402, 0xC5A20402, 0xC5A24402, 0xC5A28402, 0xC5A2C402, 0xC5A30402, 0xC5A34402, 0xC5A38402,
+		0xC5A3C402, 0xC5A40402, 0xC5A44402, 0xC5A48402, 0xC5A4C402, 0xC5A50402, 0xC5A54402, 0xC5A58402,
+		0xC5A5C402, 0xC5A60402, 0xC5A64402, 0xC5A68402, 0xC5A6C402, 0xC5A70402, 0xC5A74402, 0xC5A78402,
+		0xC5A7C402, 0xC5A80402, 0xC5A84402, 0xC5A88402, 0xC5A8C402, 0xC5A90402, 0xC5A94402, 0xC5A98402,
+		0xC5A9C402, 0xC5AA0402, 0xC5AA4402, 0xC5AA8402, 0xC5AAC402, 0xC5AB0402, 0xC5AB4402, 0xC5AB8402,
+		0xC5ABC402, 0xC5AC0402, 0xC5AC4402, 0xC5AC8402, 0xC5ACC402, 0xC5AD0402, 0xC5AD4402, 0xC5AD8402,
+		0xC5ADC402, 0xC5AE0402, 0xC5AE4402, 0xC5AE8402, 0xC5AEC402, 0xC5AF0402, 0xC5AF4402, 0xC5AF8402,
+		0xC5AFC402, 0xC5B00402, 0xC5B04402, 0xC5B08402, 0xC5B0C402, 0xC5B10402, 0xC5B14402, 0xC5B18402,
+		0xC5B1C402, 0xC5B20402, 0xC5B24402, 0xC5B28402, 0xC5B2C402, 0xC5B30402, 0xC5B34402, 0xC5B38402,
+		0xC5B3C402, 0xC5B40402, 0xC5B44402, 0xC5B48402, 0xC5B4C402, 0xC5B50402, 0xC5B54402, 0xC5B58402,
+		0xC5B5C402, 0xC5B60402, 0xC5B64402, 0xC5B68402, 0xC5B6C402, 0xC5B70402, 0xC5B74402, 0xC5B78402,
+		0xC5B7C402, 0xC5B80402, 0xC5B84402, 0xC5B88402, 0xC5B8C402, 0xC5B90402, 0xC5B94402, 0xC5B98402,
+		0xC5B9C402, 0xC5BA0402, 0xC5BA4402, 0xC5BA8402, 0xC5BAC402, 0xC5BB0402, 0xC5BB4402, 0xC5BB8402,
+		0xC5BBC402, 0xC5BC0402, 0xC5BC4402, 0xC5BC8402, 0xC5BCC402, 0xC5BD0402, 0xC5BD4402, 0xC5BD8402,
+		0xC5BDC402, 0xC5BE0402, 0xC5BE4402, 0xC5BE8402, 0xC5BEC402, 0xC5BF0402, 0xC5BF4402, 0xC5BF8402,
+		0xC5BFC402, 0xC5C00402, 0xC5C04402, 0xC5C08402, 0xC5C0C402, 0xC5C10402, 0xC5C14402, 0xC5C18402,
+		0xC5C1C402, 0xC5C20402, 0xC5C24402, 0xC5C28402, 0xC5C2C402, 0xC5C30402, 0xC5C34402, 0xC5C38402,
+		0xC5C3C402, 0xC5C40402, 0xC5C44402, 0xC5C48402, 0xC5C4C402, 0xC5C50402, 0xC5C54402, 0xC5C58402,
+		0xC5C5C402, 0xC5C60402, 0xC5C64402, 0xC5C68402, 0xC5C6C402, 0xC5C70402, 0xC5C74402, 0xC5C78402,
+		0xC5C7C402, 0xC5C80402, 0xC5C84402, 0xC5C88402, 0xC5C8C402, 0xC5C90402, 0xC5C94402, 0xC5C98402,
+		0xC5C9C402, 0xC5CA0402, 0xC5CA4402, 0xC5CA8402, 0xC5CAC402, 0xC5CB0402, 0xC5CB4402, 0xC5CB8402,
+		0xC5CBC402, 0xC5CC0402, 0xC5CC4402, 0xC5CC8402, 0xC5CCC402, 0xC5CD0402, 0xC5CD4402, 0xC5CD8402,
+		0xC5CDC402, 0xC5CE0402, 0xC5CE4402, 0xC5CE8402, 0xC5CEC402, 0xC5CF0402, 0xC5CF4402, 0xC5CF8402,
+		0xC5CFC402, 0xC5D00402, 0xC5D04402, 0xC5D08402, 0xC5D0C402, 0xC5D10402, 0xC5D14402, 0xC5D18402,
+		0xC5D1C402, 0xC5D20402, 0xC5D24402, 0xC5D28402, 0xC5D2C402, 0xC5D30402, 0xC5D34402, 0xC5D38402,
+		0xC5D3C402, 0xC5D40402, 0xC5D44402, 0xC5D48402, 0xC5D4C402, 0xC5D50402, 0xC5D54402, 0xC5D58402,
+		0xC5D5C402, 0xC5D60402, 0xC5D64402, 0xC5D68402, 0xC5D6C402, 0xC5D70402, 0xC5D74402, 0xC5D78402,
+		0xC5D7C402, 0xC5D80402, 0xC5D84402, 0xC5D88402, 0xC5D8C402, 0xC5D90402, 0xC5D94402, 0xC5D98402,
+		0xC6278402, 0xC627C402, 0xC6280402, 0xC6284402, 0xC6288402, 0xC628C402, 0xC6290402, 0xC6294402,
+		0xC6298402, 0xC629C402, 0xC62A0402, 0xC62A4402, 0xC62A8402, 0xC62AC402, 0xC62B0402, 0xC62B4402,
+		0xC62B8402, 0xC62BC402, 0xC62C0402, 0xC62C4402, 0xC62C8402, 0xC62CC402, 0xC62D0402, 0xC62D4402,
+		0xC62D8402, 0xC62DC402, 0xC62E0402, 0xC62E4402, 0xC62E8402, 0xC62EC402, 0xC62F0402, 0xC62F4402,
+		0xC62F8402, 0xC62FC402, 0xC6300402, 0xC6304402, 0xC6308402, 0xC630C402, 0xC6310402, 0xC6314402,
+		0xC6318402, 0xC631C402, 0xC6320402, 0xC6324402, 0xC6328402, 0xC632C402, 0xC6330402, 0xC6334402,
+		0xC6338402, 0xC633C402, 0xC6340402, 0xC6344402, 0xC6348402, 0xC634C402, 0xC6350402, 0xC6354402,
+		0xC6358402, 0xC635C402, 0xC6360402, 0xC6364402, 0xC6368402, 0xC636C402, 0xC6370402, 0xC6374402,
+		0xC6378402, 0xC637C402, 0xC6380402, 0xC6384402, 0xC6388402, 0xC638C402, 0xC6390402, 0xC6394402,
+		0xC6398402, 0xC639C402, 0xC63A0402, 0xC63A4402, 0xC63A8402, 0xC63AC402, 0xC63B0402, 0xC63B4402,
+		0xC63B8402, 0xC63BC402, 0xC63C0402, 0xC63C4402, 0xC63C8402, 0xC63CC402, 0xC63D0402, 0xC63D4402,
+		0xC63D8402, 0xC63DC402, 0xC63E0402, 0xC63E4402, 0xC63E8402, 0xC63EC402, 0xC63F0402, 0xC63F4402,
+		0xC63F8402, 0xC63FC402, 0xC6400402, 0xC6404402, 0xC6408402, 0xC640C402, 0xC6410402, 0xC6414402,
+		0xC6418402, 0xC641C402, 0xC6420402, 0xC6424402, 0xC6428402, 0xC642C402, 0xC6430402, 0xC6434402,
+		0xC6438402, 0xC643C402, 0xC6440402, 0xC6444402, 0xC6448402, 0xC644C402, 0xC6450402, 0xC6454402,
+		0xC6458402, 0xC645C402, 0xC6460402, 0xC6464402, 0xC6468402, 0xC646C402, 0xC6470402, 0xC6474402,
+		0xC6478402, 0xC647C402, 0xC6480402, 0xC6484402, 0xC6488402, 0xC648C402, 0xC6490402, 0xC6494402,
+		0xC6498402, 0xC649C402, 0xC64A0402, 0xC64A4402, 0xC64A8402, 0xC64AC402, 0xC64B0402, 0xC64B4402,
+		0xC64B8402, 0xC64BC402, 0xC64C0402, 0xC64C4402, 0xC64C8402, 0xC64CC402, 0xC64D0402, 0xC64D4402,
+		0xC64D8402, 0xC64DC402, 0xC64E0402, 0xC64E4402, 0xC64E8402, 0xC64EC402, 0xC64F0402, 0xC64F4402,
+		0xC64F8402, 0xC64FC402, 0xC6500402, 0xC6504402, 0xC6508402, 0xC650C402, 0xC6510402, 0xC6514402,
+		0xC6518402, 0xC651C402, 0xC6520402, 0xC6524402, 0xC6528402, 0xC652C402, 0xC6530402, 0xC6534402,
+		0xC6538402, 0xC653C402, 0xC6540402, 0xC6544402, 0xC6548402, 0xC654C402, 0xC6550402, 0xC6554402,
+		0xC6558402, 0xC655C402, 0xC6560402, 0xC6564402, 0xC6568402, 0xC656C402, 0xC6570402, 0xC6574402,
+		0xC6578402, 0xC657C402, 0xC6580402, 0xC6584402, 0xC6588402, 0xC658C402, 0xC6590402, 0xC6594402,
+		0xC6598402, 0xC659C402, 0xC65A0402, 0xC65A4402, 0xC65A8402, 0xC65AC402, 0xC65B0402, 0xC65B4402,
+		0xC65B8402, 0xC65BC402, 0xC65C0402, 0xC65C4402, 0xC65C8402, 0xC65CC402, 0xC65D0402, 0xC65D4402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xC65D8402, 0xC65DC402, 0xC65E0402, 0xC65E4402, 0xC65E8402, 0xC65EC402, 0xC65F0402, 0xC65F4402,
+		0xC65F8402, 0xC65FC402, 0xC6600402, 0xC6604402, 0xC6608402, 0x00000000, 0x00000000, 0x00000000,
+		0xC660C402, 0xC6610402, 0xC6614402, 0xC6618402, 0xC661C402, 0xC6620402, 0xC6624402, 0xC6628402,
+		0xC662C402, 0xC6630402, 0xC6634402, 0xC6638402, 0xC663C402, 0x00000000, 0x00000000, 0x00000000,
+		0xC6640402, 0xC6644402, 0xC6648402, 0xC664C402, 0xC6650402, 0xC6654402, 0xC6658402, 0xC665C402,
+		0xC6660402, 0xC6664402, 0xC6668402, 0xC666C402, 0xC6670402, 0xC6674402, 0xC6678402, 0xC667C402,
+		0xC6680402, 0xC6684402, 0xC6688402, 0xC668C402, 0xC6690402, 0xC6694402, 0xC6698402, 0xC669C402,
+		0xC66A0402, 0xC66A4402, 0xC66A8402, 0xC66AC402, 0xC66B0402, 0xC66B4402, 0xC66B8402, 0xC66BC402,
+		0xC66C0402, 0xC66C4402, 0xC66C8402, 0xC66CC402, 0xC66D0402, 0xC66D4402, 0xC66D8402, 0xC66DC402,
+		0xC66E0402, 0xC66E4402, 0xC66E8402, 0xC66EC402, 0xC66F0402, 0xC66F4402, 0xC66F8402, 0xC66FC402,
+		0xC6700402, 0xC6704402, 0xC6708402, 0xC670C402, 0xC6710402, 0xC6714402, 0xC6718402, 0xC671C402,
+		0xC6720402, 0xC6724402, 0xC6728402, 0xC672C402, 0xC6730402, 0xC6734402, 0xC6738402, 0xC673C402,
+		0xC6740402, 0xC6744402, 0xC6748402, 0xC674C402, 0xC6750402, 0xC6754402, 0xC6758402, 0xC675C402,
+		0xC6760402, 0xC6764402, 0xC6768402, 0xC676C402, 0xC6770402, 0xC6774402, 0xC6778402, 0xC677C402,
+		0xC6780402, 0xC6784402, 0xC6788402, 0xC678C402, 0xC6790402, 0xC6794402, 0xC6798402, 0xC679C402,
+		0xC67A0402, 0xC67A4402, 0xC67A8402, 0xC67AC402, 0xC67B0402, 0xC67B4402, 0xC67B8402, 0xC67BC402,
+		0xC67C0402, 0xC67C4402, 0xC67C8402, 0xC67CC402, 0xC67D0402, 0xC67D4402, 0xC67D8402, 0xC67DC402,
+		0xC67E0402, 0xC67E4402, 0xC67E8402, 0xC67EC402, 0xC67F0402, 0xC67F4402, 0xC67F8402, 0xC67FC402,
+		0xC6800402, 0xC6804402, 0xC6808402, 0xC680C402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xC6810402, 0xC6814402, 0xC6818402, 0xC681C402, 0xC6820402, 0xC6824402, 0xC6828402, 0xC682C402,
+		0xC6830402, 0xC6834402, 0xC6838402, 0xC683C402, 0xC6840402, 0xC6844402, 0xC6848402, 0xC684C402,
+		0xC6850402, 0xC6854402, 0xC6858402, 0xC685C402, 0xC6860402, 0xC6864402, 0xC6868402, 0xC686C402,
+		0xC6870402, 0xC6874402, 0xC6878402, 0xC687C402, 0xC6880402, 0xC6884402, 0xC6888402, 0xC688C402,
+		0xC6890402, 0xC6894402, 0xC6898402, 0xC689C402, 0xC68A0402, 0xC68A4402, 0xC68A8402, 0xC68AC402,
+		0xC68B0402, 0xC68B4402, 0xC68B8402, 0xC68BC402, 0xC68C0402, 0xC68C4402, 0xC68C8402, 0xC68CC402,
+		0xC68D0402, 0xC68D4402, 0xC68D8402, 0xC68DC402, 0xC68E0402, 0xC68E4402, 0xC68E8402, 0xC68EC402,
+		0xC68F0402, 0xC68F4402, 0xC68F8402, 0xC68FC402, 0xC6900402, 0xC6904402, 0xC6908402, 0xC690C402,
+		0xC6910402, 0xC6914402, 0xC6918402, 0xC691C402, 0xC6920402, 0xC6924402, 0xC6928402, 0xC692C402,
+		0xC6930402, 0xC6934402, 0xC6938402, 0xC693C402, 0xC6940402, 0xC6944402, 0xC6948402, 0xC694C402,
+		0xC6950402, 0xC6954402, 0xC6958402, 0xC695C402, 0xC6960402, 0xC6964402, 0xC6968402, 0xC696C402,
+		0xC6970402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xC6974402, 0xC6978402, 0xC697C402, 0xC6980402, 0xC6984402, 0xC6988402, 0xC698C402, 0xC6990402,
+		0xC6994402, 0xC6998402, 0xC699C402, 0xC69A0402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xC69A4402, 0xC69A8402, 0xC69AC402, 0xC69B0402, 0xC69B4402, 0xC69B8402, 0xC69BC402, 0xC69C0402,
+		0xC69C4402, 0xC69C8402, 0xC69CC402, 0xC69D0402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xC69D4402, 0xC69D8402, 0xC69DC402, 0xC69E0402, 0xC69E4402, 0xC69E8402, 0xC69EC402, 0xC69F0402,
+		0xC69F4402, 0xC69F8402, 0xC69FC402, 0xC6A00402, 0xC6A04402, 0xC6A08402, 0xC6A0C402, 0xC6A10402,
+		0xC6A14402, 0xC6A18402, 0xC6A1C402, 0xC6A20402, 0xC6A24402, 0xC6A28402, 0xC6A2C402, 0xC6A30402,
+		0xC6A34402, 0xC6A38402, 0xC6A3C402, 0xC6A40402, 0xC6A44402, 0xC6A48402, 0xC6A4C402, 0xC6A50402,
+		0xC6A54402, 0xC6A58402, 0xC6A5C402, 0xC6A60402, 0xC6A64402, 0xC6A68402, 0xC6A6C402, 0xC6A70402,
+		0xC6A74402, 0xC6A78402, 0xC6A7C402, 0xC6A80402, 0xC6A84402, 0xC6A88402, 0xC6A8C402, 0xC6A90402,
+		0xC6A94402, 0xC6A98402, 0xC6A9C402, 0xC6AA0402, 0xC6AA4402, 0xC6AA8402, 0xC6AAC402, 0xC6AB0402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xC6AB4402, 0xC6AB8402, 0xC6ABC402, 0xC6AC0402, 0xC6AC4402, 0xC6AC8402, 0xC6ACC402, 0xC6AD0402,
+		0xC6AD4402, 0xC6AD8402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xC6ADC402, 0xC6AE0402, 0xC6AE4402, 0xC6AE8402, 0xC6AEC402, 0xC6AF0402, 0xC6AF4402, 0xC6AF8402,
+		0xC6AFC402, 0xC6B00402, 0xC6B04402, 0xC6B08402, 0xC6B0C402, 0xC6B10402, 0xC6B14402, 0xC6B18402,
+		0xC6B1C402, 0xC6B20402, 0xC6B24402, 0xC6B28402, 0xC6B2C402, 0xC6B30402, 0xC6B34402, 0xC6B38402,
+		0xC6B3C402, 0xC6B40402, 0xC6B44402, 0xC6B48402, 0xC6B4C402, 0xC6B50402, 0xC6B54402, 0xC6B58402,
+		0xC6B5C402, 0xC6B60402, 0xC6B64402, 0xC6B68402, 0xC6B6C402, 0xC6B70402, 0xC6B74402, 0xC6B78402,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xC6B7C402, 0xC6B80402, 0xC6B84402, 0xC6B88402, 0xC6B8C402, 0xC6B90402, 0xC6B94402, 0xC6B98402,
+		0xC6B9C402, 0xC6BA0402, 0xC6BA4402, 0xC6BA8402, 0xC6BAC402, 0xC6BB0402, 0xC6BB4402, 0xC6BB8402,
+		0xC6BBC402, 0xC6BC0402, 0xC6BC4402, 0xC6BC8402, 0xC6BCC402, 0xC6BD0402, 0xC6BD4402, 0xC6BD8402,
+		0xC6BDC402, 0xC6BE0402, 0xC6BE4402, 0xC6BE8402, 0xC6BEC402, 0xC6BF0402, 0x00000000, 0x00000000,
+		0xC6BF4402, 0xC6BF8402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xC5D9C402, 0xC5DA0402, 0xC5DA4402, 0xC5DA8402, 0xC5DAC402, 0xC5DB0402, 0xC5DB4402, 0xC5DB8402,
+		0xC5DBC402, 0xC5DC0402, 0xC5DC4402, 0xC5DC8402, 0xC5DCC402, 0xC5DD0402, 0xC5DD4402, 0xC5DD8402,
+		0xC5DDC402, 0xC5DE0402, 0xC5DE4402, 0xC5DE8402, 0xC5DEC402, 0xC5DF0402, 0xC5DF4402, 0xC5DF8402,
+		0xC5DFC402, 0xC5E00402, 0xC5E04402, 0xC5E08402, 0xC5E0C402, 0xC5E10402, 0xC5E14402, 0xC5E18402,
+		0xC5E1C402, 0xC5E20402, 0xC5E24402, 0xC5E28402, 0xC5E2C402, 0xC5E30402, 0xC5E34402, 0xC5E38402,
+		0xC5E3C402, 0xC5E40402, 0xC5E44402, 0xC5E48402, 0xC5E4C402, 0xC5E50402, 0xC5E54402, 0xC5E58402,
+		0xC5E5C402, 0xC5E60402, 0xC5E64402, 0xC5E68402, 0xC5E6C402, 0xC5E70402, 0xC5E74402, 0xC5E78402,
+		0xC5E7C402, 0xC5E80402, 0xC5E84402, 0xC5E88402, 0xC5E8C402, 0xC5E90402, 0xC5E94402, 0xC5E98402,
+		0xC5E9C402, 0xC5EA0402, 0xC5EA4402, 0xC5EA8402, 0xC5EAC402, 0xC5EB0402, 0xC5EB4402, 0xC5EB8402,
+		0xC5EBC402, 0xC5EC0402, 0xC5EC4402, 0xC5EC8402, 0xC5ECC402, 0xC5ED0402, 0xC5ED4402, 0xC5ED8402,
+		0xC5EDC402, 0xC5EE0402, 0xC5EE4402, 0xC5EE8402, 0xC5EEC402, 0xC5EF0402, 0xC5EF4402, 0xC5EF8402,
+		0xC5EFC402, 0xC5F00402, 0xC5F04402, 0xC5F08402, 0xC5F0C402, 0xC5F10402, 0xC5F14402, 0xC5F18402,
+		0xC5F1C402, 0xC5F20402, 0xC5F24402, 0xC5F28402, 0xC5F2C402, 0xC5F30402, 0xC5F34402, 0xC5F38402,
+		0xC5F3C402, 0xC5F40402, 0xC5F44402, 0xC5F48402, 0xC5F4C402, 0xC5F50402, 0xC5F54402, 0xC5F58402,
+		0xC5F5C402, 0xC5F60402, 0xC5F64402, 0xC5F68402, 0xC5F6C402, 0xC5F70402, 0xC5F74402, 0xC5F78402,
+		0xC5F7C402, 0x00000000, 0xC5F80402, 0xC5F84402, 0xC5F88402, 0xC5F8C402, 0xC5F90402, 0xC5F94402,
+		0xC5F98402, 0xC5F9C402, 0xC5FA0402, 0xC5FA4402, 0xC5FA8402, 0xC5FAC402, 0xC5FB0402, 0xC5FB4402,
+		0xC5FB8402, 0xC5FBC402, 0xC5FC0402, 0xC5FC4402, 0xC5FC8402, 0xC5FCC402, 0xC5FD0402, 0xC5FD4402,
+		0xC5FD8402, 0xC5FDC402, 0xC5FE0402, 0xC5FE4402, 0xC5FE8402, 0xC5FEC402, 0xC5FF0402, 0xC5FF4402,
+		0xC5FF8402, 0xC5FFC402, 0xC6000402, 0xC6004402, 0xC6008402, 0xC600C402, 0xC6010402, 0xC6014402,
+		0xC6018402, 0xC601C402, 0xC6020402, 0xC6024402, 0xC6028402, 0xC602C402, 0xC6030402, 0xC6034402,
+		0xC6038402, 0xC603C402, 0xC6040402, 0xC6044402, 0xC6048402, 0xC604C402, 0xC6050402, 0xC6054402,
+		0xC6058402, 0xC605C402, 0xC6060402, 0xC6064402, 0xC6068402, 0xC606C402, 0xC6070402, 0xC6074402,
+		0xC6078402, 0xC607C402, 0xC6080402, 0xC6084402, 0xC6088402, 0xC608C402, 0xC6090402, 0xC6094402,
+		0xC6098402, 0xC609C402, 0xC60A0402, 0xC60A4402, 0xC60A8402, 0xC60AC402, 0xC60B0402, 0xC60B4402,
+		0xC60B8402, 0xC60BC402, 0xC60C0402, 0xC60C4402, 0x00000000, 0xC60C8402, 0xC60CC402, 0xC60D0402,
+		0xC60D4402, 0xC60D8402, 0xC60DC402, 0xC60E0402, 0xC60E4402, 0xC60E8402, 0xC60EC402, 0xC60F0402,
+		0xC60F4402, 0xC60F8402, 0xC60FC402, 0xC6100402, 0xC6104402, 0xC6108402, 0xC610C402, 0xC6110402,
+		0xC6114402, 0xC6118402, 0xC611C402, 0xC6120402, 0xC6124402, 0xC6128402, 0xC612C402, 0xC6130402,
+		0xC6134402, 0xC6138402, 0xC613C402, 0xC6140402, 0xC6144402, 0xC6148402, 0xC614C402, 0xC6150402,
+		0xC6154402, 0xC6158402, 0xC615C402, 0xC6160402, 0xC6164402, 0xC6168402, 0xC616C402, 0xC6170402,
+		0xC6174402, 0xC6178402, 0xC617C402, 0xC6180402, 0xC6184402, 0xC6188402, 0xC618C402, 0xC6190402,
+		0xC4FE4402, 0xC4FE8402, 0xC4FEC402, 0xC4FF0402, 0xC4FF4402, 0xC4FF8402, 0xC4FFC402, 0xC5000402,
+		0xC5004402, 0xC5008402, 0xC500C402, 0xC5010402, 0xC5014402, 0xC5018402, 0xC501C402, 0xC5020402,
+		0xC5024402, 0xC5028402, 0xC502C402, 0xC5030402, 0xC5034402, 0xC5038402, 0xC503C402, 0xC5040402,
+		0xC5044402, 0xC5048402, 0xC504C402, 0xC5050402, 0xC5054402, 0xC5058402, 0xC505C402, 0xC5060402,
+		0xC5064402, 0xC5068402, 0xC506C402, 0xC5070402, 0xC5074402, 0xC5078402, 0xC507C402, 0xC5080402,
+		0xC5084402, 0xC5088402, 0xC508C402, 0xC5090402, 0xC5094402, 0xC5098402, 0xC509C402, 0xC50A0402,
+		0xC50A4402, 0xC50A8402, 0xC50AC402, 0xC50B0402, 0xC50B4402, 0xC50B8402, 0xC50BC402, 0xC50C0402,
+		0xC50C4402, 0xC50C8402, 0xC50CC402, 0xC50D0402, 0xC50D4402, 0xC50D8402, 0xC50DC402, 0xC50E0402,
+		0xC50E4402, 0xC50E8402, 0xC50EC402, 0xC50F0402, 0xC50F4402, 0xC50F8402, 0xC50FC402, 0xC5100402,
+		0xC5104402, 0xC5108402, 0xC510C402, 0xC5110402, 0xC5114402, 0xC5118402, 0xC511C402, 0xC5120402,
+		0xC5124402, 0xC5128402, 0xC512C402, 0xC5130402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xC5134402, 0xC5138402, 0xC513C402, 0xC5140402, 0xC5144402, 0xC5148402, 0xC514C402, 0xC5150402,
+		0xC5154402, 0xC5158402, 0xC515C402, 0xC5160402, 0xC5164402, 0xC5168402, 0x00000000, 0x00000000,
+		0xC6194402, 0xC6198402, 0xC619C402, 0xC61A0402, 0xC61A4402, 0x00000000, 0x00000000, 0x00000000,
+		0xC61A8402, 0xC61AC402, 0xC61B0402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xC61B4402, 0xC61B8402, 0xC61BC402, 0xC61C0402, 0xC61C4402, 0xC61C8402, 0xC61CC402, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xC61D0402, 0xC61D4402, 0xC61D8402, 0xC61DC402, 0xC61E0402, 0xC61E4402, 0xC61E8402, 0xC61EC402,
+		0xC61F0402, 0xC61F4402, 0xC61F8402, 0xC61FC402, 0xC6200402, 0xC6204402, 0xC6208402, 0xC620C402,
+		0xC6210402, 0xC6214402, 0xC6218402, 0xC621C402, 0xC6220402, 0xC6224402, 0xC6228402, 0xC622C402,
+		0xC6230402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xC6234402, 0xC6238402, 0xC623C402, 0xC6240402, 0xC6244402, 0xC6248402, 0xC624C402, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xC6250402, 0xC6254402, 0xC6258402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xC625C402, 0xC6260402, 0xC6264402, 0xC6268402, 0xC626C402, 0xC6270402, 0xC6274402, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xC25A4402, 0xC25A8402, 0xC25AC402, 0xC25B0402, 0xC25B4402, 0xC25B8402, 0xC25BC402, 0xC25C0402,
+		0xC25C4402, 0xC25C8402, 0xC25CC402, 0xC25D0402, 0xC25D4402, 0xC25D8402, 0xC25DC402, 0xC25E0402,
+		0xC25E4402, 0xC25E8402, 0xC25EC402, 0xC25F0402, 0xC25F4402, 0xC25F8402, 0xC25FC402, 0xC2600402,
+		0xC2604402, 0xC2608402, 0xC260C402, 0xC2610402, 0xC2614402, 0xC2618402, 0xC261C402, 0xC2620402,
+		0xC2624402, 0xC2628402, 0xC262C402, 0xC2630402, 0xC2634402, 0xC2638402, 0xC263C402, 0xC2640402,
+		0xC2644402, 0xC2648402, 0xC264C402, 0xC2650402, 0xC2654402, 0xC2658402, 0xC265C402, 0xC2660402,
+		0xC2664402, 0xC2668402, 0xC266C402, 0xC2670402, 0xC2674402, 0xC2678402, 0xC267C402, 0xC2680402,
+		0xC2684402, 0xC2688402, 0xC268C402, 0xC2690402, 0xC2694402, 0xC2698402, 0xC269C402, 0xC26A0402,
+		0xC26A4402, 0xC26A8402, 0xC26AC402, 0xC26B0402, 0xC26B4402, 0xC26B8402, 0xC26BC402, 0xC26C0402,
+		0xC26C4402, 0xC26C8402, 0xC26CC402, 0xC26D0402, 0xC26D4402, 0xC26D8402, 0xC26DC402, 0xC26E0402,
+		0xC26E4402, 0xC26E8402, 0xC26EC402, 0xC26F0402, 0xC26F4402, 0xC26F8402, 0xC26FC402, 0xC2700402,
+		0xC2704402, 0xC2708402, 0xC270C402, 0xC2710402, 0xC2714402, 0xC2718402, 0xC271C402, 0xC2720402,
+		0xC2724402, 0xC2728402, 0xC272C402, 0xC2730402, 0xC2734402, 0xC2738402, 0xC273C402, 0xC2740402,
+		0xC2744402, 0xC2748402, 0xC274C402, 0xC2750402, 0xC2754402, 0xC2758402, 0xC275C402, 0xC2760402,
+		0xC2764402, 0xC2768402, 0xC276C402, 0xC2770402, 0xC2774402, 0xC2778402, 0xC277C402, 0xC2780402,
+		0xC2784402, 0xC2788402, 0xC278C402, 0xC2790402, 0xC2794402, 0xC2798402, 0xC279C402, 0xC27A0402,
+		0xC27A4402, 0xC27A8402, 0xC27AC402, 0xC27B0402, 0xC27B4402, 0xC27B8402, 0xC27BC402, 0xC27C0402,
+		0xC27C4402, 0xC27C8402, 0xC27CC402, 0xC27D0402, 0xC27D4402, 0xC27D8402, 0xC27DC402, 0xC27E0402,
+		0xC27E4402, 0xC27E8402, 0xC27EC402, 0x00000000, 0xC27F0402, 0xC27F4402, 0xC27F8402, 0xC27FC402,
+		0xC2800402, 0xC2804402, 0xC2808402, 0xC280C402, 0xC2810402, 0xC2814402, 0xC2818402, 0xC281C402,
+		0xC2820402, 0xC2824402, 0xC2828402, 0xC282C402, 0xC2830402, 0xC2834402, 0xC2838402, 0xC283C402,
+		0xC2840402, 0xC2844402, 0xC2848402, 0xC284C402, 0xC2850402, 0xC2854402, 0xC2858402, 0xC285C402,
+		0xC2860402, 0xC2864402, 0xC2868402, 0xC286C402, 0xC2870402, 0xC2874402, 0xC2878402, 0xC287C402,
+		0xC2880402, 0xC2884402, 0xC2888402, 0xC288C402, 0xC2890402, 0xC2894402, 0xC2898402, 0xC289C402,
+		0xC28A0402, 0xC28A4402, 0xC28A8402, 0xC28AC402, 0xC28B0402, 0xC28B4402, 0xC28B8402, 0xC28BC402,
+		0xC28C0402, 0xC28C4402, 0xC28C8402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x87E60405, 0x87E64405, 0x87E68405, 0x87E6C405, 0x87E70405, 0x87E74405, 0x87E78405, 0x87E7C405,
+		0x87E80405, 0x87E84405, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x80000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	};
+
+	/// The collation elements of expansions and contractions.
+	inline static constexpr uint32_t EXPANSIONS[6690] = {
+		0x00000E1A, 0x0000101A, 0x07E68404, 0x00002304, 0x09C50417, 0x09A68417, 0x09C50417, 0x40CA0404,
+		0x0864C40A, 0x40CA4404, 0x07E6C406, 0x07E60406, 0x3ED00404, 0x37794000, 0x07FAC41C, 0x0835841C,
+		0x099B841A, 0x09CAC41A, 0x3ED0441C, 0x2278C000, 0x13F08404, 0x00002304, 0x11124404, 0x00002324,
+		0x3ED04404, 0x24524000, 0x3ED04404, 0x27E70000, 0x3ED04404, 0x27C38000, 0x40CA0404, 0x07E64404,
+		0x07E6C404, 0x40CA4404, 0x00000E7A, 0x0000101A, 0x3ED00404, 0x3DAFC000, 0x3ED00404, 0x34808000,
+		0x16790404, 0x00002304, 0x09B4441A, 0x09CD841A, 0x3ED00406, 0x36E5C000, 0x3ED00404, 0x338D8000,
+		0x0DEE0402, 0x3ED00404, 0x3FE28000, 0x00002324, 0x3ED00404, 0x379FC000, 0x099B8417, 0x09C50417,
+		0x3ED00404, 0x3776C000, 0x09C30417, 0x09A3C417, 0x07E7C404, 0x3ED00404, 0x39794000, 0x3ED00404,
+		0x3965C000, 0x09C50417, 0x09A68417, 0x09A3C417, 0x07E6041E, 0x419D841E, 0x07E6C41E, 0x0846040A,
+		0x082AC404, 0x0864C404, 0x000006A4, 0x09BD8419, 0x099C8419, 0x10BD041C, 0x000006FC, 0x07D8041C,
+		0x10C1041C, 0x10C0C41C, 0x099B8419, 0x09AD0419, 0x3ED00404, 0x3E6E0000, 0x08990404, 0x08240404,
+		0x3ED00404, 0x37BF8000, 0x07E7041E, 0x419D841E, 0x07E7441E, 0x0831041D, 0x0842441D, 0x07E64404,
+		0x07E84404, 0x409F8404, 0x3ED00414, 0x33800000, 0x3ED04404, 0x209E4000, 0x00002324, 0x07E74404,
+		0x3ED00404, 0x39794000, 0x40CA0404, 0x3ED00404, 0x3B0D0000, 0x40CA4404, 0x0824041D, 0x07F5841D,
+		0x099B841A, 0x099C841A, 0x3ED00404, 0x34DA4000, 0x07E64404, 0x3ED00404, 0x3C2E4000, 0x40CA0404,
+		0x1061C404, 0x40CA4404, 0x09C30417, 0x09A3C417, 0x09C50417, 0x09C3041A, 0x0999841A, 0x087DC404,
+		0x07F94404, 0x40E28404, 0x3ED00404, 0x39CB0000, 0x40E2C404, 0x09A14417, 0x09A3C417, 0x09C50417,
+		0x0831041C, 0x087DC41C, 0x07FAC414, 0x00002314, 0x10B8041C, 0x10C0441C, 0x10BB041C, 0x10BB841C,
+		0x09B1841A, 0x09A6441A, 0x07F5841C, 0x07E8841C, 0x0835841C, 0x0F2D4404, 0x00002304, 0x07E7C404,
+		0x00002304, 0x09B6C417, 0x09C50417, 0x09C50417, 0x07E6C404, 0x3ED00404, 0x39C20000, 0x09B4841A,
+		0x09ACC41A, 0x09B44417, 0x09A64417, 0x09B1C419, 0x09C50419, 0x3ED04404, 0x27C80000, 0x3ED00404,
+		0x34608000, 0x3ED04404, 0x2087C000, 0x0842441C, 0x084F041C, 0x0835841C, 0x09CD841A, 0x0000131A,
+		0x07E70406, 0x07E64406, 0x3ED00404, 0x3C8FC000, 0x10B8841C, 0x000006FC, 0x10C0441C, 0x10BEC41C,
+		0x10BB841C, 0x10C2841C, 0x09B5C417, 0x09C50417, 0x07E64406, 0x07E78406, 0x08748414, 0x08424414,
+		0x09B6C41A, 0x09A3C41A, 0x3ED04404, 0x27C4C000, 0x10BDC41C, 0x10B8841C, 0x10BA841C, 0x07D8041C,
+		0x10C0C41C, 0x081D441C, 0x085AC41D, 0x07E8841C, 0x09A14419, 0x09C50419, 0x09CD8419, 0x09C50417,
+		0x09A3C417, 0x09C50417, 0x3ED00404, 0x371C4000, 0x0F2BC404, 0x00002304, 0x08358408, 0x00000722,
+		0x0824040A, 0x0824040A, 0x0824040A, 0x10BE441C, 0x10B6C41C, 0x10B8841C, 0x10C1441C, 0x07E78404,
+		0x4088C404, 0x10BD441C, 0x0000071C, 0x10B6841C, 0x10B9C41C, 0x10BB841C, 0x10C0C41C, 0x0891C41D,
+		0x0874841D, 0x081D441D, 0x0814441C, 0x40CA0404, 0x105DC404, 0x107CC404, 0x40CA4404, 0x10BD841C,
+		0x000006FC, 0x10BB041C, 0x10B9841C, 0x10B7841C, 0x10C0C41C, 0x07E68404, 0x07E74404, 0x3ED00404,
+		0x39794000, 0x10B6841C, 0x10C2841C, 0x10BDC41C, 0x0000071C, 0x10B6841C, 0x3ED04402, 0x3E8A0000,
+		0x0C948402, 0x09A3C419, 0x09A64419, 0x09CD8419, 0x07E64404, 0x07E84404, 0x3ED00404, 0x3C2E4000,
+		0x142A0404, 0x00002324, 0x07E7841C, 0x07E6041C, 0x085AC41D, 0x0831041D, 0x0831041D, 0x09B1841A,
+		0x09C5041A, 0x0DC40402, 0x0842441C, 0x07EF041C, 0x40CA0404, 0x0891C404, 0x40CA4404, 0x40CA0404,
+		0x105D4404, 0x107CC404, 0x40CA4404, 0x0842441C, 0x0842441C, 0x07E6C41C, 0x3ED04404, 0x23154000,
+		0x10BD441C, 0x0000071C, 0x10B8841C, 0x10C0C41C, 0x40CA0404, 0x3ED00404, 0x33824000, 0x40CA4404,
+		0x3ED00414, 0x33804000, 0x07E6C406, 0x07E84406, 0x16798404, 0x00002304, 0x09B1841A, 0x09A6841A,
+		0x3ED00406, 0x345B4000, 0x09CDC418, 0x09C50418, 0x07E6841E, 0x419D841E, 0x07E7441E, 0x40CA0404,
+		0x087DC40A, 0x40CA4404, 0x3ED00404, 0x37C4C000, 0x09C30419, 0x09A3C419, 0x09C50419, 0x3ED00404,
+		0x3FEF4000, 0x40CA0404, 0x07E68404, 0x40CA4404, 0x40CA0404, 0x0824040A, 0x40CA4404, 0x0F128404,
+		0x00002304, 0x099B841A, 0x09C9C41A, 0x3ED04404, 0x25D88000, 0x07E64406, 0x07E60406, 0x10B7C41C,
+		0x07D8041C, 0x10BEC41C, 0x3ED00404, 0x3AECC000, 0x09C30417, 0x09A3C417, 0x09A3C417, 0x3ED00404,
+		0x36454000, 0x084F0404, 0x00000564, 0x09C8841A, 0x09CD841A, 0x087DC404, 0x08748404, 0x0F288404,
+		0x00002304, 0x40CA0404, 0x1060C404, 0x107CC404, 0x40CA4404, 0x09B6C417, 0x09A3C417, 0x09C50417,
+		0x0842441D, 0x07EF041D, 0x40CA0404, 0x082AC40A, 0x40CA4404, 0x08108404, 0x08108404, 0x08358404,
+		0x08424414, 0x07FAC414, 0x099C841A, 0x00000DBA, 0x40CA0404, 0x3ED00404, 0x39C20000, 0x40CA4404,
+		0x3ED00404, 0x3AF2C000, 0x099D041A, 0x09A6841A, 0x40CA0404, 0x07E88404, 0x40CA4404, 0x3ED04404,
+		0x27B10000, 0x3ED04404, 0x25D78000, 0x09B18419, 0x09A68419, 0x09CDC419, 0x07FAC404, 0x08A8C404,
+		0x07E60404, 0x409F8404, 0x08748404, 0x087DC404, 0x3ED0041C, 0x34F30000, 0x0831041C, 0x07E8841D,
+		0x0864C41C, 0x07E8841C, 0x07FAC41C, 0x09B1C419, 0x09A64419, 0x09C50419, 0x0842441D, 0x0891C41D,
+		0x0846041C, 0x0891C41D, 0x0CB2C402, 0x099D0417, 0x09A3C417, 0x3ED00406, 0x3DB8C000, 0x099B8418,
+		0x09C88418, 0x3ED00404, 0x3D398000, 0x0CA48402, 0x0899040A, 0x0824040A, 0x07E6841E, 0x419D841E,
+		0x07E6C41E, 0x09A14419, 0x09CDC419, 0x10BF041C, 0x07D8041C, 0x10BB841C, 0x10C0C41C, 0x0F248404,
+		0x00002304, 0x07E84404, 0x3ED00404, 0x39794000, 0x40CA0404, 0x3ED00404, 0x3C9E4000, 0x40CA4404,
+		0x07F5840C, 0x07FAC40C, 0x07EF041D, 0x0860041C, 0x3ED00404, 0x37D40000, 0x00002304, 0x0C2A4404,
+		0x00002304, 0x07E74406, 0x07E60406, 0x1679C404, 0x00002304, 0x07E6C402, 0x00002302, 0x3ED00414,
+		0x33964000, 0x09B18419, 0x09A68419, 0x09CD8419, 0x3ED04404, 0x25F98000, 0x09C5041A, 0x09CD841A,
+		0x07E64404, 0x07E64404, 0x409F8404, 0x3ED04404, 0x27394000, 0x0885C40A, 0x00000564, 0x09C60419,
+		0x09C50419, 0x09CD8419, 0x0F214404, 0x00002304, 0x3ED00404, 0x3ADE4000, 0x08240404, 0x08240404,
+		0x08240404, 0x3ED0041C, 0x36468000, 0x07E84404, 0x3ED00404, 0x3C2E4000, 0x07E68404, 0x07E6C404,
+		0x3ED00404, 0x39794000, 0x07E64404, 0x07E64404, 0x3ED00404, 0x39C20000, 0x3ED04404, 0x262A0000,
+		0x3ED00406, 0x3E760000, 0x09A64417, 0x09A3C417, 0x099C841A, 0x09BD841A, 0x099D041A, 0x09ACC41A,
+		0x09C9C419, 0x00001079, 0x3ED04404, 0x207CC000, 0x40CA0404, 0x0842440A, 0x40CA4404, 0x3ED04404,
+		0x25D44000, 0x09BC0419, 0x09C50419, 0x09CDC419, 0x09B48419, 0x09CDC419, 0x07E88404, 0x00002304,
+		0x0891C404, 0x3ED0041C, 0x356D8000, 0x0885C404, 0x00000564, 0x099B8419, 0x09CD8419, 0x40CA0404,
+		0x105E8404, 0x40CA4404, 0x0864C41C, 0x07E8841C, 0x07FAC41C, 0x419D441C, 0x0874841C, 0x08748404,
+		0x00002324, 0x09B6C417, 0x09C50417, 0x10BF841C, 0x07D8041C, 0x10C0C41C, 0x07E7C41C, 0x409F841C,
+		0x07E6441C, 0x40CA0404, 0x3ED04404, 0x207A8000, 0x40CA4404, 0x40CA0404, 0x08460404, 0x40CA4404,
+		0x3ED00404, 0x3B044000, 0x09B9041A, 0x09C5041A, 0x09A1841A, 0x09CD841A, 0x09B1C419, 0x09A64419,
+		0x07E68406, 0x07E7C406, 0x085AC41C, 0x409F841C, 0x0842441C, 0x409F841C, 0x0F0D4404, 0x00002304,
+		0x3ED04404, 0x20830000, 0x105E0406, 0x107CC406, 0x07E70406, 0x07E6C406, 0x10BA041C, 0x10C2841C,
+		0x10BB841C, 0x0F1EC40A, 0x00002324, 0x09C50417, 0x09A68417, 0x10BF841C, 0x07D8041C, 0x10BB841C,
+		0x000006FC, 0x3ED04402, 0x3E890000, 0x07E88404, 0x40E98404, 0x08748404, 0x3ED00406, 0x34664000,
+		0x3ED00404, 0x34594000, 0x0B120402, 0x0864C41C, 0x07E8841C, 0x07FAC41C, 0x419D441C, 0x0874841C,
+		0x07E6841C, 0x09CDC419, 0x09AD0419, 0x40E28404, 0x3ED00404, 0x34B74000, 0x40E2C404, 0x0F188404,
+		0x00002304, 0x0846040A, 0x084F0404, 0x07E68404, 0x07E64404, 0x3ED00404, 0x39794000, 0x3ED0041C,
+		0x379CC000, 0x3ED0041C, 0x38840000, 0x10BDC41C, 0x0000071C, 0x10BC041C, 0x10BD441C, 0x3ED00406,
+		0x3B3A0000, 0x3ED04404, 0x26380000, 0x00002304, 0x3ED00404, 0x39784000, 0x10610406, 0x107CC406,
+		0x3ED00406, 0x36470000, 0x40CA0404, 0x3ED00404, 0x36D98000, 0x40CA4404, 0x09B18417, 0x09A68417,
+		0x0842441D, 0x081D441D, 0x08A1841C, 0x09B70419, 0x09CDC419, 0x09B4841A, 0x09A6441A, 0x099B8419,
+		0x09CEC419, 0x09C6041A, 0x09C5041A, 0x0835841C, 0x0842441C, 0x09A3C41A, 0x09CD841A, 0x00000FB8,
+		0x00001018, 0x09A18419, 0x09CDC419, 0x3ED00404, 0x3CAB4000, 0x09BD841A, 0x09A3C41A, 0x0F270404,
+		0x00002304, 0x07E6C406, 0x07E60406, 0x0846041C, 0x0896441D, 0x3ED00404, 0x33A80000, 0x09C6041A,
+		0x09CD841A, 0x09F20404, 0x00002304, 0x10BD441C, 0x0000071C, 0x10B9041C, 0x3ED00404, 0x3FD48000,
+		0x09B18417, 0x09A64417, 0x0CB44402, 0x3ED04404, 0x26380000, 0x3ED00406, 0x34DC0000, 0x3ED00404,
+		0x3B050000, 0x087DC404, 0x08748404, 0x3ED04404, 0x27D48000, 0x00002304, 0x0F128404, 0x00002324,
+		0x10B8441C, 0x000006FC, 0x10C0C41C, 0x10BA841C, 0x000006FC, 0x07D8041C, 0x0824040A, 0x082AC40A,
+		0x3ED04404, 0x27E7C000, 0x09C88417, 0x09C50417, 0x3ED04402, 0x3E850000, 0x09B1C418, 0x09A68418,
+		0x07FAC402, 0x00000722, 0x085AC41D, 0x07E8841C, 0x3ED0041C, 0x35020000, 0x0F290404, 0x00002304,
+		0x3ED00414, 0x338B4000, 0x40CA0404, 0x08748404, 0x40CA4404, 0x3ED04404, 0x236CC000, 0x40CA0404,
+		0x0810840A, 0x40CA4404, 0x0831040A, 0x000006A4, 0x0F0F4404, 0x00002304, 0x3ED00404, 0x34D04000,
+		0x09A14419, 0x09A3C419, 0x09CD8419, 0x08CB4404, 0x08C78404, 0x08CAC404, 0x10BE841C, 0x10C0841C,
+		0x0F250404, 0x00002304, 0x40CA0404, 0x087DC404, 0x40CA4404, 0x3ED0041C, 0x34934000, 0x07E80404,
+		0x3ED00404, 0x39C20000, 0x09B6C419, 0x09CDC419, 0x09B5C417, 0x09C50417, 0x09A64417, 0x07E68406,
+		0x07E60406, 0x3ED00404, 0x3EBE4000, 0x40CA0404, 0x07E80404, 0x40CA4404, 0x00000F5A, 0x0000101A,
+		0x09B5C41A, 0x09CDC41A, 0x09C6041A, 0x09A6841A, 0x0F35C404, 0x0F710404, 0x09B18418, 0x09C88418,
+		0x3ED00404, 0x33968000, 0x3ED04404, 0x2637C000, 0x084F041C, 0x0891C41D, 0x3ED04404, 0x20224000,
+		0x00002304, 0x0F238404, 0x00002304, 0x40CA0404, 0x07F5840A, 0x40CA4404, 0x3ED04404, 0x27E34000,
+		0x00002304, 0x07FAC404, 0x08A54404, 0x09BC0417, 0x09C50417, 0x09B1C419, 0x09C50419, 0x09A68419,
+		0x09A14417, 0x09A68417, 0x09C50417, 0x3ED00404, 0x39C20000, 0x40EFC404, 0x40EFC404, 0x10BE041C,
+		0x10B8041C, 0x40CA0404, 0x07E64404, 0x07E84404, 0x40CA4404, 0x16764404, 0x00002304, 0x3ED00406,
+		0x344A8000, 0x0896441D, 0x07F5841D, 0x09BD8419, 0x09CDC419, 0x09B18417, 0x09A3C417, 0x3ED0041C,
+		0x338B4000, 0x0B094404, 0x0B13C404, 0x0891C40A, 0x0824040A, 0x0824040A, 0x0824040A, 0x0842441C,
+		0x0842441C, 0x0F1AC40A, 0x00002304, 0x07E64404, 0x3ED00404, 0x39794000, 0x3ED04404, 0x225FC000,
+		0x3ED04404, 0x25870000, 0x110D0404, 0x00002324, 0x3ED04404, 0x27DFC000, 0x09B48417, 0x09A64417,
+		0x09C30419, 0x09CD8419, 0x40CA0404, 0x07E64404, 0x07E7C404, 0x40CA4404, 0x3ED00404, 0x34BE4000,
+		0x40CA0404, 0x0864C404, 0x40CA4404, 0x10C0C41C, 0x10BD441C, 0x0000071C, 0x07D8041C, 0x3ED00406,
+		0x33A30000, 0x09C30419, 0x099C8419, 0x0C9F8404, 0x0C9BC404, 0x07E88404, 0x084F0404, 0x3ED04404,
+		0x22748000, 0x0988C404, 0x0989C404, 0x16780404, 0x00002324, 0x3ED0041C, 0x33A90000, 0x3ED0441C,
+		0x232A4000, 0x09B90419, 0x09A68419, 0x09C50419, 0x3ED00404, 0x377C4000, 0x3ED04404, 0x26AA0000,
+		0x40CA0404, 0x08A18404, 0x40CA4404, 0x10B7841C, 0x10B9C41C, 0x10B8841C, 0x07D8041C, 0x10BB841C,
+		0x000006FC, 0x0F400404, 0x0F714404, 0x09C60417, 0x09A64417, 0x09C50417, 0x0F1EC404, 0x00002324,
+		0x40CA0404, 0x10618404, 0x107CC404, 0x40CA4404, 0x3ED04404, 0x27CEC000, 0x3ED0041C, 0x39880000,
+		0x09A14417, 0x09C50417, 0x09A64417, 0x3ED04404, 0x2262C000, 0x40CA0404, 0x3ED00404, 0x345AC000,
+		0x40CA4404, 0x099D041A, 0x09CDC41A, 0x09B9041A, 0x09A6841A, 0x0B258402, 0x07FAC40A, 0x08A18404,
+		0x09C60417, 0x09A68417, 0x3ED00406, 0x3E4F8000, 0x07E88404, 0x084F0404, 0x167AC404, 0x00002304,
+		0x09B4441A, 0x09C3041A, 0x09CD841A, 0x09A14417, 0x09A68417, 0x3ED00404, 0x3CE10000, 0x07E64404,
+		0x07E7C404, 0x3ED00404, 0x39794000, 0x10B9041C, 0x07D8041C, 0x10BE041C, 0x0000071C, 0x3ED00404,
+		0x3703C000, 0x00002324, 0x3ED04404, 0x23590000, 0x09BC041A, 0x09C5041A, 0x3ED00404, 0x3C8AC000,
+		0x09B6C41A, 0x09CDC41A, 0x3ED04404, 0x255FC000, 0x099C8404, 0x09990404, 0x099B841A, 0x09C5041A,
+		0x09C3041A, 0x09CD841A, 0x3ED04404, 0x27B34000, 0x09B9041A, 0x09A6441A, 0x10B9441C, 0x10B6C41C,
+		0x10B8841C, 0x10C0C41C, 0x09C30417, 0x09C88417, 0x40CA0404, 0x105EC404, 0x107CC404, 0x40CA4404,
+		0x105F8406, 0x107CC406, 0x07FAC40A, 0x08A18404, 0x00000504, 0x07E64406, 0x07E80406, 0x0824041D,
+		0x07FAC41D, 0x099D0419, 0x09AD0419, 0x3ED00404, 0x3CE24000, 0x07E6441E, 0x419D841E, 0x07E6841E,
+		0x141E4404, 0x00002324, 0x10BCC41C, 0x10BB041C, 0x10BB841C, 0x09B18419, 0x09C50419, 0x09C50419,
+		0x3ED00404, 0x338B0000, 0x09BC041A, 0x09CDC41A, 0x08748404, 0x00002324, 0x0891C40A, 0x089C040A,
+		0x3ED00404, 0x3708C000, 0x00002304, 0x40CA0404, 0x3ED00404, 0x3A0A8000, 0x40CA4404, 0x0F108404,
+		0x00002304, 0x10604406, 0x107CC406, 0x07E88404, 0x08B94404, 0x09A14419, 0x09AD0419, 0x09B1C41A,
+		0x09A6841A, 0x09B18419, 0x09CDC419, 0x09A68419, 0x09CDC419, 0x3ED04404, 0x201FC000, 0x3ED00404,
+		0x3D4C0000, 0x0BD2C404, 0x00002304, 0x07E64406, 0x07E68406, 0x07E74404, 0x3ED00404, 0x3C2E4000,
+		0x40CA0404, 0x1060C404, 0x40CA4404, 0x0846041C, 0x0874841C, 0x3ED00404, 0x34F8C000, 0x09824404,
+		0x09800404, 0x40CA0404, 0x081D4404, 0x40CA4404, 0x09C60417, 0x09C88417, 0x07D74402, 0x000006E2,
+		0x09A6841A, 0x09A3C41A, 0x07E6C406, 0x07E68406, 0x3ED00406, 0x3C1AC000, 0x3ED04404, 0x22E80000,
+		0x09CDC41A, 0x09CD841A, 0x40CA0404, 0x10604404, 0x10800404, 0x40CA4404, 0x0B0C0404, 0x0B13C404,
+		0x3ED00404, 0x3708C000, 0x0891C404, 0x08240404, 0x08240404, 0x08240404, 0x0864C40A, 0x08748404,
+		0x0BACC402, 0x07E6441E, 0x419D841E, 0x07E7C41E, 0x10B9041C, 0x10C0C41C, 0x10BBC41C, 0x09C50419,
+		0x099C8419, 0x09A1441A, 0x09A6441A, 0x09C50417, 0x09A64417, 0x167A4404, 0x00002324, 0x3ED04404,
+		0x25F2C000, 0x0896441D, 0x07F5841D, 0x3ED00404, 0x3CAB0000, 0x1113C404, 0x00002324, 0x07E64404,
+		0x07E78404, 0x409F8404, 0x3ED04404, 0x26AA0000, 0x00002304, 0x409B4404, 0x4099C404, 0x09B9041A,
+		0x09A3C41A, 0x085AC41C, 0x07E8841D, 0x07E64404, 0x07E6C404, 0x3ED00404, 0x3C2E4000, 0x07E64404,
+		0x00002304, 0x09BD8419, 0x09C50419, 0x09CDC419, 0x09C30419, 0x099A8419, 0x0C0A8402, 0x09A3C419,
+		0x09C50419, 0x09A64419, 0x3ED00404, 0x37088000, 0x00002304, 0x1675C404, 0x00002304, 0x0F444404,
+		0x0F714404, 0x09A14418, 0x09C88418, 0x11144404, 0x00002324, 0x167A4404, 0x00002304, 0x08748404,
+		0x00002324, 0x09B70419, 0x09C50419, 0x09CDC419, 0x09C50417, 0x09A64417, 0x09A3C417, 0x09C50417,
+		0x09A3C417, 0x3ED00404, 0x3703C000, 0x40CA0404, 0x0814440A, 0x40CA4404, 0x08108404, 0x08108404,
+		0x07E7C404, 0x3ED00404, 0x3C2E4000, 0x0B0C8404, 0x0B13C404, 0x07E68406, 0x07E68406, 0x09C50419,
+		0x09A3C419, 0x09CDC419, 0x07E7041C, 0x0831041D, 0x3ED0041C, 0x3F508000, 0x0F2B4404, 0x00002304,
+		0x08600404, 0x085AC404, 0x07E6C41E, 0x419D841E, 0x07E7041E, 0x3ED00404, 0x35C7C000, 0x0814441D,
+		0x089C041C, 0x409F8404, 0x409F8404, 0x409F8404, 0x09A18418, 0x09C88418, 0x07F58404, 0x40E98404,
+		0x084F0404, 0x3ED00406, 0x3EE3C000, 0x0846041C, 0x0842441C, 0x3ED00404, 0x35B5C000, 0x0B0E8404,
+		0x0B13C404, 0x0F0D8404, 0x00002324, 0x07E78404, 0x3ED00404, 0x3C2E4000, 0x07E64404, 0x409F8404,
+		0x0F104404, 0x00002344, 0x09B1C419, 0x09C50419, 0x09C50419, 0x3ED00406, 0x37798000, 0x099B8417,
+		0x09A3C417, 0x3ED04404, 0x20200000, 0x40CA0404, 0x081D440A, 0x40CA4404, 0x0810841C, 0x0842441C,
+		0x11128404, 0x00002324, 0x08358402, 0x10C00416, 0x10C08416, 0x09CB041A, 0x0999041A, 0x081D441C,
+		0x07E8841C, 0x3ED04404, 0x27E80000, 0x40CA0404, 0x07F58404, 0x40CA4404, 0x3ED04404, 0x25BA0000,
+		0x099B8419, 0x09CA0419, 0x09CDC402, 0x0C944402, 0x3ED04402, 0x3E844000, 0x0F294404, 0x00002304,
+		0x0824040A, 0x0891C40A, 0x09A64419, 0x09A3C419, 0x09CDC419, 0x3ED00404, 0x37BD0000, 0x0DEE8402,
+		0x3ED04404, 0x20008000, 0x40CA0404, 0x07FAC404, 0x40CA4404, 0x40CA0404, 0x07E74404, 0x40CA4404,
+		0x40CA0404, 0x0885C404, 0x40CA4404, 0x3ED00404, 0x3AD88000, 0x09BD8417, 0x09C30417, 0x40F00404,
+		0x40F00404, 0x40F00404, 0x09A3C419, 0x09A64419, 0x09CDC419, 0x0C2E4404, 0x00002304, 0x09CDC418,
+		0x09C88418, 0x3ED00404, 0x34780000, 0x00002304, 0x09A6841A, 0x09CDC41A, 0x099B8419, 0x09C50419,
+		0x09B1C417, 0x09C88417, 0x099B841A, 0x09CA041A, 0x07E78404, 0x00002304, 0x3ED00404, 0x3DBB8000,
+		0x00002304, 0x09BD841A, 0x09C3041A, 0x3ED00406, 0x34D50000, 0x099D0417, 0x09C50417, 0x09A18419,
+		0x09C50419, 0x09B5C419, 0x09CD8419, 0x0831041C, 0x0842441C, 0x07E6841C, 0x09B18417, 0x09C50417,
+		0x07E7C406, 0x07E60406, 0x07E78404, 0x3ED00404, 0x39794000, 0x40CA0404, 0x3ED00404, 0x35B6C000,
+		0x40CA4404, 0x40CA0404, 0x3ED00404, 0x34AD0000, 0x40CA4404, 0x08748404, 0x000006A4, 0x3ED00404,
+		0x38930000, 0x1061C406, 0x107CC406, 0x07E64406, 0x07E7C406, 0x09CDC41A, 0x09CDC41A, 0x099B8419,
+		0x09ACC419, 0x09B4441A, 0x09CDC41A, 0x10BE041C, 0x07D8041C, 0x10C2841C, 0x09C50417, 0x09A64417,
+		0x09C50417, 0x3ED00404, 0x37088000, 0x3ED00406, 0x37E5C000, 0x0F18C40A, 0x00002304, 0x087DC40A,
+		0x0801C40A, 0x0835840A, 0x07E80406, 0x07E60406, 0x09CDC417, 0x09A64417, 0x099D0417, 0x09A68417,
+		0x09B70419, 0x09C50419, 0x09C50419, 0x3ED04406, 0x2331C000, 0x10B6841C, 0x07D8041C, 0x10C0C41C,
+		0x3ED00404, 0x34D04000, 0x07E68404, 0x07E70404, 0x3ED00404, 0x3C2E4000, 0x0831041C, 0x0891C41D,
+		0x10C1841C, 0x10BB041C, 0x10BB841C, 0x09C3041A, 0x099A841A, 0x08358402, 0x00002302, 0x0F108404,
+		0x00002324, 0x3ED00404, 0x3C8D8000, 0x3ED00406, 0x3380C000, 0x40CA0404, 0x07EF0404, 0x40CA4404,
+		0x10B8441C, 0x10C1441C, 0x10C1841C, 0x10BB041C, 0x10BB841C, 0x3ED00404, 0x3E4E8000, 0x40CA0404,
+		0x085AC40A, 0x40CA4404, 0x099C8419, 0x00000DB9, 0x3ED04404, 0x26658000, 0x09BD8419, 0x09C30419,
+		0x3ED00404, 0x338FC000, 0x10BD041C, 0x10B6C41C, 0x10BB041C, 0x3ED00404, 0x3961C000, 0x3ED04404,
+		0x21938000, 0x0F1AC404, 0x00002324, 0x084F040A, 0x00000564, 0x3ED0041C, 0x39664000, 0x09A3C419,
+		0x09C50419, 0x09CDC419, 0x09A6841A, 0x09A6441A, 0x0DC3C402, 0x07E64406, 0x07E64406, 0x099B8419,
+		0x09C9C419, 0x09A14419, 0x09A64419, 0x09A3C419, 0x09B5C41A, 0x09C5041A, 0x099B8419, 0x09CAC419,
+		0x40CA0404, 0x10610404, 0x40CA4404, 0x3ED04404, 0x24244000, 0x09C60419, 0x09A3C419, 0x09A64419,
+		0x07E78406, 0x07E60406, 0x09BD8418, 0x09C30418, 0x09B4441A, 0x09C3041A, 0x09CD841A, 0x4082441A,
+		0x099C841A, 0x09C3041A, 0x09C3041A, 0x09C8841A, 0x4082441A, 0x09B6C41A, 0x09C3041A, 0x09CDC41A,
+		0x09C8841A, 0x4082441A, 0x09CA041A, 0x09B1841A, 0x09C3041A, 0x09C5041A, 0x10BF041C, 0x10B8041C,
+		0x000006FC, 0x10BB841C, 0x10C2841C, 0x0F1E840A, 0x00002304, 0x10BD841C, 0x10C0441C, 0x10C2841C,
+		0x07E70404, 0x3ED00404, 0x39C20000, 0x3ED00406, 0x33A50000, 0x3ED00406, 0x33C04000, 0x099D0417,
+		0x09A64417, 0x07E6441C, 0x07E6841C, 0x07E6041C, 0x085AC41D, 0x14284404, 0x00002324, 0x40CA0404,
+		0x07E64404, 0x07E70404, 0x40CA4404, 0x0885C404, 0x00000684, 0x0814441D, 0x085AC41D, 0x07E8841C,
+		0x3ED04404, 0x27B44000, 0x0842441C, 0x0824041C, 0x0835841C, 0x3ED00414, 0x33A30000, 0x3ED04404,
+		0x23274000, 0x07E70406, 0x07E60406, 0x40E28404, 0x3ED00404, 0x3955C000, 0x40E2C404, 0x40CA0404,
+		0x3ED04404, 0x23284000, 0x40CA4404, 0x3ED00404, 0x37F10000, 0x3ED00404, 0x3B0D4000, 0x09B9041A,
+		0x09CD841A, 0x3ED00404, 0x371B8000, 0x09B4841A, 0x09CDC41A, 0x09A64419, 0x09CD8419, 0x09C50417,
+		0x09A3C417, 0x09A64417, 0x099C841A, 0x09C3041A, 0x09C3041A, 0x09C8841A, 0x142E8404, 0x00002324,
+		0x0BD24404, 0x00002324, 0x40CA0404, 0x07E64404, 0x40CA4404, 0x09C60419, 0x09A64419, 0x09CDC419,
+		0x09A18419, 0x09ACC419, 0x3ED0041C, 0x33824000, 0x105E8406, 0x107CC406, 0x09C50417, 0x09C50417,
+		0x08CC041C, 0x0891C41D, 0x099D041A, 0x09CD841A, 0x0BD24404, 0x00002304, 0x0CB30402, 0x07E88404,
+		0x40E98404, 0x07F58404, 0x3ED04404, 0x279D4000, 0x00002304, 0x3ED04404, 0x26D68000, 0x07E64404,
+		0x07E68404, 0x409F8404, 0x09B44417, 0x09C50417, 0x09C50417, 0x08240404, 0x0891C404, 0x40CA0404,
+		0x10614404, 0x107CC404, 0x40CA4404, 0x09ACC41A, 0x0000131A, 0x08748404, 0x00002324, 0x087DC404,
+		0x3ED00404, 0x34658000, 0x09D28404, 0x00002324, 0x40CA0404, 0x0885C40A, 0x40CA4404, 0x09B1C419,
+		0x09A3C419, 0x09CDC419, 0x10BA041C, 0x10C2841C, 0x10BAC41C, 0x085AC41C, 0x0891C41D, 0x3ED00404,
+		0x39CA0000, 0x40CA0404, 0x3ED00404, 0x35C7C000, 0x40CA4404, 0x0ADA8402, 0x3ED00406, 0x3AD8C000,
+		0x10B8041C, 0x000006FC, 0x10C1441C, 0x10C2841C, 0x09CDC419, 0x09C50419, 0x087DC404, 0x08A18404,
+		0x3ED00414, 0x364A4000, 0x07FAC404, 0x08A64404, 0x07E70404, 0x00002304, 0x0F140404, 0x00002324,
+		0x07E80404, 0x3ED00404, 0x3C2E4000, 0x0831041D, 0x07EF041D, 0x40CA0404, 0x105E0404, 0x40CA4404,
+		0x3ED00404, 0x37D44000, 0x3ED04404, 0x25AD8000, 0x10B8041C, 0x000006FC, 0x10C2841C, 0x10BE441C,
+		0x0824041C, 0x0846041C, 0x1677C404, 0x00002304, 0x40CA0404, 0x3ED00404, 0x35034000, 0x40CA4404,
+		0x14294404, 0x00002324, 0x07E64406, 0x07E60406, 0x099B8419, 0x09CD8419, 0x40CA0404, 0x3ED04404,
+		0x24744000, 0x40CA4404, 0x40CA0404, 0x3ED04404, 0x207CC000, 0x40CA4404, 0x07E6441E, 0x419D841E,
+		0x07E7441E, 0x09A1841A, 0x09C5041A, 0x09A14419, 0x09CD8419, 0x09B1841A, 0x09CD841A, 0x0801C41C,
+		0x0864C41C, 0x0814441C, 0x40CA0404, 0x07E6C404, 0x40CA4404, 0x09C8841A, 0x09C5041A, 0x40CA0404,
+		0x07E8840A, 0x40CA4404, 0x0F2B0404, 0x00002304, 0x0BDE4404, 0x00002304, 0x3ED04404, 0x25BA0000,
+		0x00002304, 0x09C5041A, 0x09A6841A, 0x3ED00404, 0x34780000, 0x3ED04404, 0x27BF4000, 0x099D0418,
+		0x09C50418, 0x0831041C, 0x085AC41D, 0x07E8841C, 0x09B1C419, 0x09A3C419, 0x3ED00404, 0x3D370000,
+		0x0CA44402, 0x07E70404, 0x409F8404, 0x09C9C41A, 0x0000107A, 0x3ED04404, 0x207F0000, 0x0CCA4402,
+		0x3ED00404, 0x346AC000, 0x10BE841C, 0x10C0841C, 0x10BD041C, 0x000006FC, 0x07D8041C, 0x10C0C41C,
+		0x09ACC41A, 0x09CE041A, 0x099C841A, 0x09C3041A, 0x09C30419, 0x09A64419, 0x09CD8419, 0x3ED00406,
+		0x3E574000, 0x3ED00404, 0x36428000, 0x09A3C417, 0x09A64417, 0x3ED04404, 0x26004000, 0x167A8404,
+		0x00002324, 0x10B8041C, 0x10C1441C, 0x10C0841C, 0x07D8041C, 0x09C60419, 0x09AD0419, 0x07E68406,
+		0x07E84406, 0x09B1841A, 0x09A3C41A, 0x0896440C, 0x08A1840C, 0x07E8840A, 0x00000564, 0x07E7C404,
+		0x4088C404, 0x0F21440A, 0x00002304, 0x07E8841C, 0x409F841C, 0x0842441C, 0x409F841C, 0x3ED00406,
+		0x33974000, 0x3ED04404, 0x23D98000, 0x40CA0404, 0x10618404, 0x40CA4404, 0x0835841D, 0x087DC41D,
+		0x07FAC41D, 0x3ED04404, 0x2636C000, 0x3ED00414, 0x35CC0000, 0x40CA0404, 0x08358404, 0x40CA4404,
+		0x0F100404, 0x00002304, 0x40CA0404, 0x3ED00404, 0x39CA0000, 0x40CA4404, 0x09B5C418, 0x09C50418,
+		0x0F4F8404, 0x0F710404, 0x07E80404, 0x4088C404, 0x07E68404, 0x07E68404, 0x3ED00404, 0x39794000,
+		0x3ED00414, 0x33AE8000, 0x10BD041C, 0x0000071C, 0x07D8041C, 0x10BB041C, 0x0801C41C, 0x0891C41D,
+		0x09F18404, 0x00002304, 0x09A64419, 0x09C50419, 0x09CD8419, 0x3ED00404, 0x3F1CC000, 0x0885C404,
+		0x00000564, 0x07E6441E, 0x419D841E, 0x07E8041E, 0x09B5C41A, 0x09CD841A, 0x09CDC404, 0x09990404,
+		0x3ED00406, 0x33800000, 0x0F118404, 0x00002304, 0x07F5841D, 0x0835841D, 0x08358404, 0x08358404,
+		0x3ED0041C, 0x34FCC000, 0x0988C404, 0x0988C404, 0x40CA0404, 0x084F0404, 0x40CA4404, 0x0835840A,
+		0x082AC404, 0x110E4404, 0x00002324, 0x099B841A, 0x09CD841A, 0x09B7041A, 0x09C5041A, 0x3ED00404,
+		0x377F8000, 0x3ED00404, 0x3C96C000, 0x08358404, 0x08A18404, 0x3ED00404, 0x3396C000, 0x09B1C418,
+		0x09A3C418, 0x07FAC404, 0x00002324, 0x10B8C41C, 0x07D8041C, 0x10B9C41C, 0x0846041C, 0x0810841D,
+		0x09A1441A, 0x09A6841A, 0x3ED00404, 0x344FC000, 0x40E28404, 0x3ED00404, 0x3DB5C000, 0x40E2C404,
+		0x3ED04404, 0x27D28000, 0x09BC0417, 0x09A64417, 0x40CA0404, 0x10600404, 0x107EC404, 0x10604404,
+		0x107DC404, 0x10950404, 0x40CA4404, 0x08748404, 0x00002304, 0x08748404, 0x07E6C406, 0x07E70406,
+		0x09B1C417, 0x09C50417, 0x09C50417, 0x0F140404, 0x00002304, 0x0F140404, 0x00002304, 0x0F104404,
+		0x00002324, 0x09C5041A, 0x09CDC41A, 0x0F148404, 0x00002304, 0x0842441C, 0x419D441C, 0x0874841C,
+		0x07E64404, 0x4088C404, 0x3ED04404, 0x22748000, 0x3ED00414, 0x3D4C8000, 0x3ED0041C, 0x3892C000,
+		0x3ED04404, 0x261D4000, 0x0F118404, 0x0F144404, 0x3ED00404, 0x3EB2C000, 0x3ED00404, 0x34A6C000,
+		0x10C0841C, 0x10C0441C, 0x0F114404, 0x00002304, 0x16784404, 0x00002304, 0x0D170404, 0x0D1E8404,
+		0x07E6C406, 0x07E74406, 0x10BE441C, 0x10C2841C, 0x10B9841C, 0x10C0041C, 0x10C2841C, 0x07E68404,
+		0x3ED00404, 0x39794000, 0x3ED00406, 0x3D4DC000, 0x09A64417, 0x09C50417, 0x09B70419, 0x09CD8419,
+		0x3ED0041C, 0x3E9E8000, 0x0B0CC404, 0x0B13C404, 0x3ED00404, 0x3D9D8000, 0x07E64404, 0x07E60404,
+		0x3ED00404, 0x39C20000, 0x07E64404, 0x07E78404, 0x3ED00404, 0x3C2E4000, 0x07FAC408, 0x00000722,
+		0x3ED00404, 0x3FD4C000, 0x00002304, 0x09A14417, 0x09C50417, 0x09A3C417, 0x4099C404, 0x4099C404,
+		0x07E70404, 0x4088C404, 0x09C30417, 0x09C50417, 0x09A1441A, 0x09CD841A, 0x0DFE4402, 0x3ED00404,
+		0x39794000, 0x0F3B0404, 0x0F710404, 0x3ED00404, 0x3B03C000, 0x09C60419, 0x09A64419, 0x09CD8419,
+		0x09A14419, 0x09A68419, 0x09CDC419, 0x07EF041C, 0x07E8841C, 0x0864C41C, 0x10B8441C, 0x10BFC41C,
+		0x10C0841C, 0x07D8041C, 0x08240404, 0x082AC404, 0x07E68404, 0x07E80404, 0x3ED00404, 0x39794000,
+		0x16768404, 0x00002304, 0x3ED04404, 0x27E70000, 0x00002324, 0x3ED00404, 0x3703C000, 0x00002304,
+		0x3ED04404, 0x22704000, 0x09A1441A, 0x09C5041A, 0x0814441D, 0x081D441D, 0x08A1841C, 0x09B4841A,
+		0x09A3C41A, 0x09B48417, 0x09A3C417, 0x3ED04404, 0x255DC000, 0x085AC41D, 0x07E8841D, 0x40CA0404,
+		0x10600404, 0x107EC404, 0x1061C404, 0x10800404, 0x40CA4404, 0x00000EDA, 0x0000101A, 0x09C30419,
+		0x09C50419, 0x08A18404, 0x08964404, 0x167A0404, 0x00002304, 0x07E8840A, 0x00002304, 0x0801C40A,
+		0x07E8840A, 0x0885C40A, 0x40E28404, 0x0874840A, 0x40E2C404, 0x07E6C406, 0x07E78406, 0x09B48419,
+		0x09A64419, 0x09CD8419, 0x0835841C, 0x0846041C, 0x40CA0404, 0x089C0404, 0x40CA4404, 0x10B7C41C,
+		0x10C2841C, 0x10B9C41C, 0x07E6C406, 0x07E6C406, 0x09B48417, 0x09A68417, 0x09B5C417, 0x09C50417,
+		0x09C50417, 0x40CA0404, 0x07E64404, 0x07E80404, 0x40CA4404, 0x3ED00404, 0x34F20000, 0x3ED04404,
+		0x209E0000, 0x09A6441A, 0x09CDC41A, 0x09B44419, 0x09ACC419, 0x07E8840A, 0x084F040A, 0x0B05C404,
+		0x0B13C404, 0x07E70404, 0x3ED00404, 0x3C2E4000, 0x081D4414, 0x00000734, 0x10BD441C, 0x000006FC,
+		0x10C0C41C, 0x0D17C404, 0x0D1EC404, 0x3ED0041C, 0x363C0000, 0x0F2B8404, 0x00002304, 0x3ED04404,
+		0x27BF8000, 0x09B48419, 0x09A68419, 0x09C50419, 0x40CA0404, 0x3ED00404, 0x34D04000, 0x40CA4404,
+		0x09C88417, 0x09C50417, 0x09C50417, 0x08310404, 0x000006A4, 0x0B0E4404, 0x0B13C404, 0x0C954402,
+		0x099C8402, 0x085AC41C, 0x07F5841C, 0x07E6441E, 0x419D841E, 0x07E7041E, 0x0810841D, 0x0864C41D,
+		0x0801C41D, 0x0801C41D, 0x07E74404, 0x4088C404, 0x08108404, 0x08240404, 0x0874840A, 0x00002304,
+		0x0874840A, 0x09B90419, 0x09C50419, 0x09CDC419, 0x07F5841C, 0x0842441C, 0x09A68417, 0x09C50417,
+		0x07E88404, 0x00002304, 0x0801C404, 0x0874841D, 0x081D441D, 0x0891C41D, 0x3ED04406, 0x241A4000,
+		0x09850404, 0x09830404, 0x09C60417, 0x09C50417, 0x09B6C41A, 0x09C3041A, 0x09CDC41A, 0x09C8841A,
+		0x0CC44404, 0x00002324, 0x07FAC40A, 0x08A1840A, 0x00000504, 0x10600406, 0x107CC406, 0x0DEF8402,
+		0x3ED00404, 0x3D62C000, 0x3ED04404, 0x207F0000, 0x00002304, 0x3ED04404, 0x26378000, 0x09BC041A,
+		0x09CD841A, 0x3ED00404, 0x3C8AC000, 0x00002304, 0x07E64404, 0x07E68404, 0x3ED00404, 0x39794000,
+		0x087DC40A, 0x00002324, 0x16788404, 0x00002304, 0x3ED04404, 0x27AEC000, 0x3ED04404, 0x269B0000,
+		0x09C6041A, 0x09A6441A, 0x10B8841C, 0x10C0C41C, 0x10BA041C, 0x000006FC, 0x10B6C41C, 0x10C1441C,
+		0x07FAC404, 0x08A18404, 0x00000504, 0x3ED00404, 0x3D4A0000, 0x0CA54402, 0x3ED00404, 0x3C91C000,
+		0x07E6441E, 0x419D841E, 0x07E8441E, 0x3ED00404, 0x3FCD8000, 0x08D58404, 0x08D2C404, 0x08D54404,
+		0x10BB841C, 0x10C2841C, 0x3ED04404, 0x23E6C000, 0x3ED04404, 0x25DA4000, 0x3ED0041C, 0x396C0000,
+		0x3ED00404, 0x37DCC000, 0x09CA0404, 0x09990404, 0x0874840A, 0x00002324, 0x09A6441A, 0x09A3C41A,
+		0x40E28404, 0x3ED00404, 0x33A30000, 0x40E2C404, 0x0846041C, 0x07E8841D, 0x07E68406, 0x07E6C406,
+		0x09B90417, 0x09A68417, 0x09C50417, 0x0F28C404, 0x00002304, 0x3ED0041C, 0x3894C000, 0x09B6C41A,
+		0x09C5041A, 0x07E6841C, 0x0831041D, 0x40CA0404, 0x10600404, 0x40CA4404, 0x0C9F8404, 0x0C9DC404,
+		0x40CA0404, 0x08600404, 0x40CA4404, 0x09824404, 0x097E8404, 0x07E88404, 0x0891C404, 0x40CA0404,
+		0x0835840A, 0x40CA4404, 0x3ED04404, 0x23B28000, 0x0831041C, 0x0842441C, 0x0874841C, 0x0864C41C,
+		0x3ED04404, 0x255E0000, 0x099B841A, 0x09CD841A, 0x08F94402, 0x3ED04404, 0x27D40000, 0x09C3041A,
+		0x09C5041A, 0x40CA0404, 0x3ED00404, 0x39794000, 0x40CA4404, 0x07E64404, 0x07E80404, 0x409F8404,
+		0x3ED04404, 0x209E4000, 0x00002304, 0x07E70406, 0x07E78406, 0x0891C404, 0x089C0404, 0x3ED00404,
+		0x37088000, 0x09CDC41A, 0x09A6841A, 0x08358408, 0x00002302, 0x0B0C4404, 0x0B13C404, 0x40CA0404,
+		0x105F0404, 0x107CC404, 0x40CA4404, 0x3ED04404, 0x20224000, 0x0874841D, 0x07FAC41D, 0x09A14419,
+		0x09ACC419, 0x09B44419, 0x09CD8419, 0x09B5C417, 0x09A64417, 0x409F8404, 0x409F8404, 0x3ED04404,
+		0x209E4000, 0x09A18418, 0x09C50418, 0x07F58404, 0x40E98404, 0x0885C404, 0x10BDC41C, 0x0000071C,
+		0x07D8041C, 0x10B9841C, 0x000006FC, 0x07FAC404, 0x08A18404, 0x3ED00406, 0x39C24000, 0x09C30419,
+		0x09C50419, 0x09A64419, 0x07FAC41C, 0x0842441C, 0x07E6841C, 0x3ED00404, 0x36E00000, 0x0842441C,
+		0x0842441C, 0x07E6841C, 0x085AC41C, 0x0874841C, 0x09A14417, 0x09A64417, 0x07E68404, 0x3ED00404,
+		0x3C2E4000, 0x07E88414, 0x00002314, 0x0801C414, 0x07E64404, 0x07E68404, 0x3ED00404, 0x3C2E4000,
+		0x09C50419, 0x09A68419, 0x09CDC419, 0x0F230404, 0x00002304, 0x3ED00404, 0x34E08000, 0x40E28404,
+		0x3ED00404, 0x3894C000, 0x40E2C404, 0x1116C404, 0x00002324, 0x07F5841D, 0x084F041C, 0x409F841C,
+		0x09BC0419, 0x09C50419, 0x09C50419, 0x09C60417, 0x09A3C417, 0x09C50417, 0x07E68406, 0x07E60406,
+		0x3ED04402, 0x3E884000, 0x40CA0404, 0x08144404, 0x40CA4404, 0x07E64404, 0x07E80404, 0x3ED00404,
+		0x39794000, 0x07E64404, 0x07E70404, 0x3ED00404, 0x3C2E4000, 0x09B48419, 0x09A64419, 0x09CDC419,
+		0x0F1E8404, 0x00002304, 0x081D4408, 0x00000722, 0x084F0404, 0x084F0404, 0x3ED0041C, 0x364A4000,
+		0x09C30417, 0x09A64417, 0x09B18417, 0x09C50417, 0x09C50417, 0x0810840A, 0x00002324, 0x0D9C0402,
+		0x3ED00406, 0x34CEC000, 0x09BC0419, 0x09C50419, 0x09A64419, 0x099B8417, 0x09A68417, 0x07E8840A,
+		0x0891C40A, 0x3ED00404, 0x34D70000, 0x00002304, 0x3ED04404, 0x23AAC000, 0x084F040A, 0x084F040A,
+		0x0F134404, 0x00002304, 0x0F0D8404, 0x00002304, 0x07E64406, 0x07E7C406, 0x08424414, 0x0864C414,
+		0x3ED00404, 0x388D8000, 0x09B1C418, 0x09C50418, 0x07F5841D, 0x419D441C, 0x0831041C, 0x0814441C,
+		0x09C30419, 0x09A3C419, 0x09A3C419, 0x09C30419, 0x09C50419, 0x09CDC419, 0x3ED04404, 0x25FB4000,
+		0x3ED00404, 0x3649C000, 0x09C30417, 0x09A64417, 0x09C50417, 0x081D4402, 0x00000722, 0x40CA0404,
+		0x07E84404, 0x40CA4404, 0x07E64404, 0x07E74404, 0x3ED00404, 0x3C2E4000, 0x07FAC41D, 0x082AC41D,
+		0x3ED00404, 0x39BC0000, 0x16794404, 0x00002324, 0x0F1F840A, 0x00002304, 0x07E64404, 0x07E70404,
+		0x409F8404, 0x3ED04404, 0x235C0000, 0x3ED00404, 0x3892C000, 0x0814440A, 0x00002324, 0x0F1EC404,
+		0x00002304, 0x09C8841A, 0x09CDC41A, 0x0891C404, 0x08240404, 0x099D0419, 0x09ACC419, 0x09BD8417,
+		0x09C50417, 0x09C50417, 0x09D48404, 0x00002324, 0x3ED04404, 0x25600000, 0x08108404, 0x08108404,
+		0x08240404, 0x07E64404, 0x07E78404, 0x3ED00404, 0x39794000, 0x08CC041C, 0x0896441D, 0x091A8404,
+		0x091CC404, 0x09CDC419, 0x09CD8419, 0x0CB48402, 0x3ED00406, 0x338B4000, 0x3ED0041C, 0x36D5C000,
+		0x09B1C41A, 0x09A6441A, 0x09CDC41A, 0x09A6441A, 0x0F18C404, 0x00002304, 0x07E70406, 0x07E80406,
+		0x07E64406, 0x07E64406, 0x167B0404, 0x00002304, 0x07FAC404, 0x08A18404, 0x0F21840A, 0x00002304,
+		0x40CA0404, 0x0896440A, 0x40CA4404, 0x0896441D, 0x07EF041C, 0x0842441C, 0x07E8841D, 0x07E68406,
+		0x07E64406, 0x0F0DC404, 0x00002304, 0x3ED04404, 0x2658C000, 0x07F5841C, 0x07F5841C, 0x40CA0404,
+		0x3ED00404, 0x3DB8C000, 0x40CA4404, 0x09C50404, 0x00002324, 0x3ED00404, 0x39794000, 0x00002304,
+		0x3ED00406, 0x379F0000, 0x3ED00404, 0x36D40000, 0x07E64404, 0x07E74404, 0x3ED00404, 0x39794000,
+		0x09C30417, 0x09A68417, 0x09C50417, 0x10BE041C, 0x0000071C, 0x10B6C41C, 0x10C2841C, 0x10BB841C,
+		0x09B90419, 0x09CD8419, 0x07E6441E, 0x419D841E, 0x07E6C41E, 0x085AC41D, 0x085AC41D, 0x0891C41D,
+		0x0835840A, 0x082AC40A, 0x10614406, 0x107CC406, 0x09CDC419, 0x09A64419, 0x09CDC419, 0x3ED00406,
+		0x39C20000, 0x3ED00404, 0x38820000, 0x0F1AC40A, 0x00002324, 0x09CB0404, 0x09990404, 0x40CA0404,
+		0x0801C404, 0x40CA4404, 0x09BD841A, 0x09A6441A, 0x3ED00404, 0x3CE2C000, 0x00002304, 0x07FAC40A,
+		0x08A1840A, 0x10BB841C, 0x000006FC, 0x10C0C41C, 0x3ED04404, 0x279D4000, 0x3ED04404, 0x207A8000,
+		0x07E64406, 0x07E84406, 0x09B48419, 0x09CD8419, 0x09A3C41A, 0x09C5041A, 0x09CDC419, 0x09A3C419,
+		0x09CDC419, 0x09C3041A, 0x099C841A, 0x40CA0404, 0x105E8404, 0x107CC404, 0x40CA4404, 0x40CA0404,
+		0x105F8404, 0x40CA4404, 0x07F58404, 0x00000604, 0x09C88417, 0x00001317, 0x41A30404, 0x41A30404,
+		0x3ED04404, 0x26B60000, 0x09B1C418, 0x09A64418, 0x09C5041A, 0x09A6441A, 0x09C5041A, 0x09A9041A,
+		0x099B841A, 0x09A6441A, 0x09B70419, 0x09C50419, 0x09CD8419, 0x0F130404, 0x00002324, 0x0842441C,
+		0x419D441C, 0x0874841C, 0x07E6841C, 0x09A1841A, 0x09CDC41A, 0x09A14419, 0x09C50419, 0x40CA0404,
+		0x105EC404, 0x40CA4404, 0x3ED00404, 0x377CC000, 0x07E6841C, 0x07E6841C, 0x409F841C, 0x07E6841C,
+		0x10BE041C, 0x10C2841C, 0x40CA0404, 0x3ED00404, 0x39C24000, 0x40CA4404, 0x09C3041A, 0x09A6441A,
+		0x0891C41D, 0x419D441C, 0x0842441C, 0x08CC041C, 0x0842441C, 0x07E70406, 0x07E84406, 0x09B18417,
+		0x09C50417, 0x09A3C417, 0x09824404, 0x09808404, 0x09ACC41A, 0x09B1841A, 0x09CA041A, 0x09C3041A,
+		0x3ED04404, 0x25214000, 0x0BD00402, 0x3ED00404, 0x34D10000, 0x07E64404, 0x07E70404, 0x3ED00404,
+		0x39794000, 0x3ED0041C, 0x39C20000, 0x10BE841C, 0x10B8841C, 0x10C1441C, 0x10C2841C, 0x09990404,
+		0x00002324, 0x07E68404, 0x07E60404, 0x3ED00404, 0x39794000, 0x3ED00404, 0x3D648000, 0x08CC041C,
+		0x0874841C, 0x099D0417, 0x09C88417, 0x10BA841C, 0x000006FC, 0x07D8041C, 0x10B9C41C, 0x0DEF0402,
+		0x3ED00406, 0x39794000, 0x3ED04402, 0x3E88C000, 0x3ED04404, 0x201FC000, 0x00002304, 0x07E74406,
+		0x07E60406, 0x07E8841D, 0x419D441C, 0x0842441C, 0x3ED04404, 0x27A94000, 0x10BE041C, 0x000006FC,
+		0x10C0C41C, 0x10BB841C, 0x087DC404, 0x00002324, 0x09CDC41A, 0x09C5041A, 0x3ED04404, 0x23474000,
+		0x09B48417, 0x09C50417, 0x3ED04404, 0x24718000, 0x40CA0404, 0x0874840A, 0x40CA4404, 0x3ED04404,
+		0x219AC000, 0x09B1C417, 0x09A3C417, 0x40CA0404, 0x3ED00404, 0x351F0000, 0x40CA4404, 0x3ED04404,
+		0x27E34000, 0x07E8041C, 0x0831041D, 0x07E6C406, 0x07E64406, 0x09C50419, 0x09C50419, 0x16778404,
+		0x00002304, 0x09A18419, 0x09CD8419, 0x0891C40A, 0x0824040A, 0x3ED00404, 0x379E8000, 0x4099C404,
+		0x409B4404, 0x085AC41C, 0x0896441D, 0x084F040A, 0x00002304, 0x0801C40A, 0x3ED00404, 0x39690000,
+		0x09A3C417, 0x09C50417, 0x09A64417, 0x16774404, 0x00002304, 0x3ED0041C, 0x37E30000, 0x1678C404,
+		0x00002304, 0x0F44C404, 0x0F714404, 0x10BFC41C, 0x10B6841C, 0x10C2841C, 0x07E64406, 0x07E6C406,
+		0x3ED00404, 0x347D4000, 0x07FAC41C, 0x0842441C, 0x3ED00404, 0x36FE0000, 0x09C30417, 0x09C50417,
+		0x09A64417, 0x09B1C41A, 0x09C5041A, 0x10BB441C, 0x000006FC, 0x07E6C404, 0x07E60404, 0x3ED00404,
+		0x39794000, 0x110A4404, 0x00002324, 0x09D70404, 0x00002324, 0x3ED0041C, 0x38D54000, 0x40CA0404,
+		0x3ED00404, 0x345B4000, 0x40CA4404, 0x3ED00404, 0x39780000, 0x07E70404, 0x3ED00404, 0x39794000,
+		0x0989C404, 0x0989C404, 0x09CA0402, 0x07E8841D, 0x07EF041D, 0x07FAC404, 0x07EF0404, 0x07E7C41E,
+		0x419D841E, 0x07E8041E, 0x3ED00406, 0x33824000, 0x0CC58402, 0x09C60419, 0x09A3C419, 0x09C50419,
+		0x07FAC41C, 0x07EF041D, 0x0831041C, 0x0814441C, 0x099D0419, 0x09C50419, 0x3ED0441C, 0x235C0000,
+		0x3ED04404, 0x225F8000, 0x09B90417, 0x09A68417, 0x10B6C41C, 0x10C2841C, 0x10BAC41C, 0x3ED04404,
+		0x24744000, 0x3ED0041C, 0x33800000, 0x07E68404, 0x409F8404, 0x3ED00404, 0x338D8000, 0x00002304,
+		0x40CA0404, 0x07E7C404, 0x40CA4404, 0x0842441C, 0x0814441C, 0x07E88404, 0x0885C404, 0x0BD28404,
+		0x00002304, 0x07E6441E, 0x419D841E, 0x09B1C417, 0x09A64417, 0x081D441D, 0x07F5841C, 0x3ED04404,
+		0x22100000, 0x16780404, 0x00002304, 0x09CA041A, 0x09B1841A, 0x09C3041A, 0x09C5041A, 0x0F144404,
+		0x00002304, 0x09A3C41A, 0x09CDC41A, 0x09B18418, 0x09A3C418, 0x09B1C417, 0x09C50417, 0x09A68417,
+		0x0831041C, 0x0842441C, 0x07E6C41C, 0x3ED00404, 0x33A14000, 0x084F041D, 0x0831041D, 0x07E84404,
+		0x4088C404, 0x0831041C, 0x081D441D, 0x08A1841C, 0x09B7041A, 0x09CD841A, 0x0B0A8404, 0x0B13C404,
+		0x09A14419, 0x09C50419, 0x09CDC419, 0x3ED04404, 0x27B0C000, 0x3ED04404, 0x22130000, 0x09B1C417,
+		0x09A68417, 0x10BE441C, 0x10C0C41C, 0x10B8841C, 0x3ED00404, 0x3FD4C000, 0x099B8419, 0x09CB4419,
+		0x0B0C8404, 0x0B13C404, 0x3ED04404, 0x27E64000, 0x10B8441C, 0x000006FC, 0x10B8041C, 0x000006FC,
+		0x3ED00404, 0x3F3E0000, 0x10BBC41C, 0x10BCC41C, 0x0D724404, 0x0D808404, 0x0D724404, 0x3ED00404,
+		0x3AF50000, 0x07E6C404, 0x07E64404, 0x3ED00404, 0x39794000, 0x08144404, 0x000006A4, 0x10BE441C,
+		0x10B6C41C, 0x10C0C41C, 0x40CA0404, 0x0891C40A, 0x40CA4404, 0x3ED04404, 0x266B0000, 0x10BD841C,
+		0x10B6C41C, 0x07D8041C, 0x10BB841C, 0x07E78404, 0x3ED00404, 0x39C20000, 0x0F268404, 0x00002304,
+		0x07E7441E, 0x419D841E, 0x07E8041E, 0x09B1C419, 0x09CD8419, 0x0814441C, 0x07E8841C, 0x0835841C,
+		0x40CA0404, 0x1061C404, 0x107CC404, 0x40CA4404, 0x40CA0404, 0x10604404, 0x40CA4404, 0x3ED00406,
+		0x3B0D0000, 0x09B18418, 0x09A68418, 0x00000FBA, 0x0000101A, 0x3ED0041C, 0x37798000, 0x0835841C,
+		0x0899041C, 0x09B5C419, 0x09C50419, 0x09A64419, 0x07F5841C, 0x0842441C, 0x07E6C41C, 0x09B4441A,
+		0x09A6441A, 0x09A6441A, 0x09C5041A, 0x09A1441A, 0x09A3C41A, 0x08CC041C, 0x0814441C, 0x07E6C406,
+		0x07E80406, 0x3ED00414, 0x35B6C000, 0x3ED04404, 0x209B8000, 0x105DC406, 0x107CC406, 0x07E64404,
+		0x07E60404, 0x3ED00404, 0x3C2E4000, 0x09B1C419, 0x09ACC419, 0x09A6441A, 0x09CD841A, 0x3ED04404,
+		0x23ED8000, 0x00002304, 0x08240404, 0x08240404, 0x3ED0041C, 0x350E4000, 0x0A96C404, 0x0A9F0404,
+		0x3ED00404, 0x3FE28000, 0x0DFD4402, 0x3ED00404, 0x3C8EC000, 0x07E64404, 0x07E60404, 0x409F8404,
+		0x3ED00406, 0x35034000, 0x40CA0404, 0x08310404, 0x40CA4404, 0x09C60417, 0x09A64417, 0x09A14417,
+		0x09C50417, 0x3ED04404, 0x2637C000, 0x10B8841C, 0x000006FC, 0x10C0441C, 0x10BEC41C, 0x09C60419,
+		0x09C60419, 0x10B8041C, 0x10B6C41C, 0x10C0841C, 0x10B9441C, 0x10C2841C, 0x10BAC41C, 0x07D8041C,
+		0x10BEC41C, 0x09B18417, 0x09A3C417, 0x09A64417, 0x105F0406, 0x107CC406, 0x08460404, 0x082AC404,
+		0x3ED04402, 0x3E87C000, 0x09B1C41A, 0x09CDC41A, 0x09B6041A, 0x09C5041A, 0x105D4406, 0x107CC406,
+		0x09C50419, 0x09C50419, 0x09CDC419, 0x09A1441A, 0x09CDC41A, 0x09BC041A, 0x09A6441A, 0x3ED00404,
+		0x3C1B0000, 0x3ED04404, 0x257A0000, 0x09C3041A, 0x09CDC41A, 0x40CA0404, 0x3ED00404, 0x3C1AC000,
+		0x40CA4404, 0x40CA0404, 0x105D4404, 0x40CA4404, 0x0DFD8402, 0x0F610404, 0x0F710404, 0x10B90416,
+		0x10BB8416, 0x07E64406, 0x07E60406, 0x07E68404, 0x07E78404, 0x3ED00404, 0x39794000, 0x3ED00404,
+		0x3DBB8000, 0x3ED04404, 0x25874000, 0x09B4441A, 0x09C3041A, 0x09D1441A, 0x40CA0404, 0x3ED00404,
+		0x33C44000, 0x40CA4404, 0x3ED04402, 0x3E8A4000, 0x09A3C419, 0x09CDC419, 0x09C5041A, 0x09A6441A,
+		0x07E68406, 0x07E74406, 0x07E6C404, 0x4088C404, 0x0F258404, 0x00002304, 0x0899040A, 0x0824040A,
+		0x0824040A, 0x3ED00406, 0x34FBC000, 0x08358408, 0x3ED04404, 0x26CC8000, 0x3ED00406, 0x33C44000,
+		0x09CDC419, 0x09ACC419, 0x09A68419, 0x09CD8419, 0x1676C404, 0x00002304, 0x09A18417, 0x09C50417,
+		0x40CA0404, 0x08240404, 0x40CA4404, 0x3ED04406, 0x23284000, 0x07E78404, 0x409F8404, 0x3ED04404,
+		0x23ED8000, 0x00002324, 0x099D041A, 0x09A3C41A, 0x09B18419, 0x09C50419, 0x09A64419, 0x3ED00414,
+		0x33864000, 0x0831041C, 0x08D1841D, 0x3ED04404, 0x26CF0000, 0x00002304, 0x0ADAC402, 0x40CA0404,
+		0x10600404, 0x107CC404, 0x40CA4404, 0x40CA0404, 0x089C040A, 0x40CA4404, 0x0CC7C404, 0x0CCD8404,
+		0x00001884, 0x09C60419, 0x09CD8419, 0x09C60419, 0x09C50419, 0x09CDC419, 0x40CA0404, 0x07FAC40A,
+		0x40CA4404, 0x0F644404, 0x0F710404, 0x11170404, 0x00002344, 0x09A14418, 0x09C50418, 0x09B18419,
+		0x09A3C419, 0x09CD8419, 0x16760404, 0x00002304, 0x09B1C41A, 0x09CD841A, 0x0C2B0404, 0x00002304,
+		0x3ED04404, 0x24244000, 0x00002304, 0x3ED00404, 0x34800000, 0x00002304, 0x07E64404, 0x07E68404,
+		0x3ED00404, 0x39C20000, 0x07E68404, 0x07E60404, 0x3ED00404, 0x3C2E4000, 0x07E8840A, 0x00002304,
+		0x0891C40A, 0x0F628404, 0x0F714404, 0x40CA0404, 0x07E70404, 0x40CA4404, 0x40CA0404, 0x08A1840A,
+		0x40CA4404, 0x07E68404, 0x00002304, 0x09C60419, 0x09CDC419, 0x09BD8417, 0x09C50417, 0x0F260404,
+		0x00002304, 0x09B6C417, 0x09A3C417, 0x3ED00404, 0x37F0C000, 0x00002304, 0x40CA0404, 0x3ED00404,
+		0x3E574000, 0x40CA4404, 0x099B8417, 0x09CD8417, 0x3ED0041C, 0x3D47C000, 0x09A18419, 0x09AD0419,
+		0x08144404, 0x00002324, 0x09A3C419, 0x09CD8419, 0x07E6441E, 0x419D841E, 0x07E7841E, 0x0BDF8402,
+		0x07E80404, 0x409F8404, 0x09C6041A, 0x09CDC41A, 0x0842441C, 0x0891C41D, 0x3ED00404, 0x34D70000,
+		0x3ED00404, 0x345AC000, 0x3ED00404, 0x363AC000, 0x09C30419, 0x09A64419, 0x09C50419, 0x07E6C41C,
+		0x07FAC41D, 0x09B44417, 0x09A64417, 0x09A64417, 0x3ED04404, 0x2787C000, 0x40CA0404, 0x0846040A,
+		0x40CA4404, 0x0864C40A, 0x00002324, 0x07E60404, 0x3ED00404, 0x3C2E4000, 0x0BDF4402, 0x0AFF4402,
+		0x07E7C404, 0x409F8404, 0x0824041D, 0x0885C41D, 0x08108404, 0x084DC404, 0x0F0E0404, 0x00002324,
+		0x3ED00404, 0x3D460000, 0x0CA4C402, 0x0831041C, 0x07F5841C, 0x07E8841C, 0x0835841C, 0x0F120404,
+		0x00002304, 0x09B44419, 0x09A64419, 0x09CDC419, 0x10600406, 0x10800406, 0x3ED04404, 0x25D48000,
+		0x00000F58, 0x00001018, 0x419AC404, 0x419AC404, 0x419AC404, 0x09C30418, 0x09C50418, 0x09C5041A,
+		0x09C5041A, 0x08424414, 0x07F58414, 0x099B8418, 0x09C50418, 0x3ED00404, 0x3EBE4000, 0x00002304,
+		0x09BD841A, 0x09CDC41A, 0x07F5841C, 0x0842441C, 0x07E6841C, 0x09B44417, 0x09A68417, 0x09B4841A,
+		0x09A6841A, 0x07E70406, 0x07E60406, 0x0824040A, 0x0824040A, 0x3ED00404, 0x3DAB8000, 0x08358402,
+		0x00000722, 0x3ED00404, 0x3B0D0000, 0x09A3C417, 0x09C50417, 0x07FAC41C, 0x07E8841C, 0x10B8441C,
+		0x10C1441C, 0x3ED00406, 0x34AD0000, 0x3ED04402, 0x3E84C000, 0x0F0F4404, 0x00002364, 0x08E6C40A,
+		0x00002324, 0x0F1EC40A, 0x00002304, 0x07FAC40A, 0x00002324, 0x09C3041A, 0x09A3C41A, 0x3ED00404,
+		0x3F3E4000, 0x3ED00406, 0x36D98000, 0x099B8417, 0x09C88417, 0x0ACE4402, 0x09CDC417, 0x09C88417,
+		0x10BE041C, 0x0000071C, 0x10C2841C, 0x10BB841C, 0x000006FC, 0x0AECC402, 0x3ED00404, 0x3C8A8000,
+		0x09C50417, 0x09A3C417, 0x09A68417, 0x3ED00406, 0x345AC000, 0x08990404, 0x08240404, 0x08240404,
+		0x0C94C402, 0x0846040A, 0x082AC40A, 0x40CA0404, 0x08424404, 0x40CA4404, 0x081D441D, 0x0824041C,
+		0x4082441C, 0x0864C41D, 0x0801C41C, 0x0874841C, 0x0F0F4404, 0x00002324, 0x10B8441C, 0x10C1441C,
+		0x10BF041C, 0x07D8041C, 0x10BB841C, 0x10C0C41C, 0x085AC41D, 0x085AC41D, 0x0842441D, 0x10B6841C,
+		0x10C0C41C, 0x10BD841C, 0x10B6841C, 0x40E28404, 0x3ED00404, 0x3C2E4000, 0x40E2C404, 0x07E6C404,
+		0x00002304, 0x0F2CC404, 0x00002304, 0x07E68404, 0x07E60404, 0x409F8404, 0x3ED04404, 0x230DC000,
+		0x07E70406, 0x07E70406, 0x3ED04404, 0x20004000, 0x09B1C417, 0x09C50417, 0x07E64406, 0x07E84406,
+		0x09BD8419, 0x09C50419, 0x09C50419, 0x07E64406, 0x07E6C406, 0x099B8419, 0x099C8419, 0x07E8840A,
+		0x07E8840A, 0x0F128404, 0x00002344, 0x0835841D, 0x084F041C, 0x0874841C, 0x0874841C, 0x0835841C,
+		0x0801C41C, 0x0874841C, 0x0874841C, 0x40900404, 0x40900404, 0x419AC404, 0x40CA0404, 0x3ED00404,
+		0x33A30000, 0x40CA4404, 0x081D441D, 0x0891C41D, 0x40CA0404, 0x08964404, 0x40CA4404, 0x10BDC41C,
+		0x10C0C41C, 0x10BB041C, 0x09B5C41A, 0x09A6441A, 0x09B6C419, 0x09CD8419, 0x3ED00404, 0x3FD48000,
+		0x00002304, 0x3ED0041C, 0x3BC50000, 0x099B8419, 0x09CB0419, 0x09C60418, 0x09C50418, 0x0DED8402,
+		0x3ED00404, 0x37D40000, 0x40CA0404, 0x07EF040A, 0x40CA4404, 0x09BD8417, 0x09A3C417, 0x09A14417,
+		0x09A64417, 0x09C50417, 0x40EFC404, 0x40EFC404, 0x40EFC404, 0x10604406, 0x10800406, 0x10600406,
+		0x10818406, 0x0F314404, 0x0F710404, 0x09BD841A, 0x09CD841A, 0x3ED00404, 0x3E4EC000, 0x3ED00404,
+		0x33964000, 0x00002304, 0x09B4841A, 0x09CD841A, 0x3ED0041C, 0x398B4000, 0x3ED0041C, 0x35230000,
+		0x3ED0441C, 0x24534000, 0x08CC041C, 0x0835841C, 0x3ED04404, 0x22600000, 0x3ED00404, 0x338A0000,
+		0x09C60418, 0x09C88418, 0x09B70417, 0x09A3C417, 0x3ED00404, 0x34CE0000, 0x07E88404, 0x00000564,
+		0x09CDC417, 0x09C50417, 0x09BD8419, 0x09CD8419, 0x3ED04404, 0x27A98000, 0x10C1041C, 0x10C2841C,
+		0x10BB841C, 0x10B8C41C, 0x000006FC, 0x10C2841C, 0x3ED00404, 0x394BC000, 0x09B6C419, 0x09A3C419,
+		0x09C50419, 0x07E64406, 0x07E74406, 0x07E8840A, 0x40E98404, 0x0874840A, 0x3ED00404, 0x3E6F8000,
+		0x40CA0404, 0x07E64404, 0x07E78404, 0x40CA4404, 0x3ED00404, 0x34C54000, 0x0F10C404, 0x00002304,
+		0x10C0C41C, 0x07D8041C, 0x10BD841C, 0x000006FC, 0x10C0C41C, 0x09C3041A, 0x0999441A, 0x07E8840A,
+		0x089C040A, 0x07E64404, 0x07E80404, 0x3ED00404, 0x3C2E4000, 0x3ED04404, 0x23EC0000, 0x07E64406,
+		0x07E70406, 0x07E68404, 0x3ED00404, 0x39C20000, 0x40F00404, 0x40F00404, 0x07E64404, 0x07E60404,
+		0x3ED00404, 0x39794000, 0x16794404, 0x00002304, 0x097E8404, 0x09860404, 0x09BD8417, 0x09A68417,
+		0x08460404, 0x000006A4, 0x1428C404, 0x00002324, 0x0891C41D, 0x084F041D, 0x07FAC41D, 0x09CDC419,
+		0x09C50419, 0x09C50419, 0x16770404, 0x00002304, 0x09D1441A, 0x0000107A, 0x3ED00404, 0x34608000,
+		0x00002304, 0x099B8419, 0x09C60419, 0x07E68406, 0x07E60406, 0x3ED04404, 0x2078C000, 0x0F130404,
+		0x00002304, 0x09B44419, 0x09CDC419, 0x07E64404, 0x07E7C404, 0x3ED00404, 0x3C2E4000, 0x0F218404,
+		0x00002304, 0x09BC0417, 0x09C50417, 0x09A64417, 0x07E64406, 0x07E74406, 0x09B1841A, 0x09ACC41A,
+		0x09B18418, 0x09C50418, 0x09C3041A, 0x09A6841A, 0x409F8416, 0x409F8416, 0x16794404, 0x00002344,
+		0x3ED00406, 0x3961C000, 0x3ED00404, 0x365CC000, 0x09B18417, 0x09C50417, 0x09A64417, 0x09C30419,
+		0x09A68419, 0x09C50419, 0x3ED04404, 0x255DC000, 0x09B4441A, 0x09ACC41A, 0x09CDC41A, 0x09A3C41A,
+		0x07E64406, 0x07E78406, 0x07E6841C, 0x0846041C, 0x07FAC41C, 0x4082441C, 0x0874841D, 0x07F5841C,
+		0x0864C41C, 0x0F104404, 0x00002304, 0x0CC24404, 0x00002324, 0x3ED00406, 0x3A0A8000, 0x07E64404,
+		0x07E64404, 0x3ED00404, 0x39794000, 0x09A14417, 0x09A3C417, 0x16770404, 0x00002324, 0x09CDC419,
+		0x09CDC419, 0x07E64404, 0x07E6C404, 0x409F8404, 0x0824040A, 0x0899040A, 0x3ED00406, 0x3382C000,
+		0x3ED0041C, 0x38A54000, 0x0891C404, 0x08240404, 0x08240404, 0x3ED00404, 0x3C964000, 0x099D0419,
+		0x09CDC419, 0x08CC041C, 0x0810841D, 0x10B8841C, 0x10C1441C, 0x07D8041C, 0x10BC841C, 0x07E74404,
+		0x00002304, 0x10B7841C, 0x07D8041C, 0x10B8041C, 0x07D8041C, 0x0F2D0404, 0x00002304, 0x07E64404,
+		0x07E84404, 0x3ED00404, 0x39794000, 0x3ED0041C, 0x33B90000, 0x3ED0041C, 0x35230000, 0x0F0E0404,
+		0x00002304, 0x0842441C, 0x0874841C, 0x40CA0404, 0x08108404, 0x40CA4404, 0x3ED00406, 0x33828000,
+		0x07E64404, 0x07E74404, 0x409F8404, 0x3ED00406, 0x39CA0000, 0x084F0414, 0x00002314, 0x0801C414,
+		0x3ED00404, 0x37D84000, 0x09CDC419, 0x09C60419, 0x3ED04402, 0x3E838000, 0x09B6C419, 0x09C50419,
+		0x09CDC419, 0x09A14419, 0x09C60419, 0x07E6C41E, 0x419D841E, 0x07E8041E, 0x08F94408, 0x099D0419,
+		0x09CD8419, 0x40CA0404, 0x3ED00404, 0x33974000, 0x40CA4404, 0x40CA0404, 0x105E0404, 0x107CC404,
+		0x40CA4404, 0x0DD28404, 0x0DDC0404, 0x0DD28404, 0x3ED00404, 0x379E8000, 0x3ED04402, 0x3E83C000,
+		0x414A8404, 0x0810840A, 0x0F1F8404, 0x00002304, 0x40CA0404, 0x3ED00404, 0x3E4F8000, 0x40CA4404,
+		0x07F5841C, 0x07FAC41C, 0x09B7041A, 0x09A3C41A, 0x099B841A, 0x09A3C41A, 0x0F274404, 0x00002304,
+		0x3ED00406, 0x3553C000, 0x3ED00404, 0x3C96C000, 0x00002304, 0x09BD841A, 0x099C841A, 0x09B1C41A,
+		0x09ACC41A, 0x07E70406, 0x07E74406, 0x07E64406, 0x07E70406, 0x3ED04404, 0x279FC000, 0x085AC41D,
+		0x0864C41D, 0x0874841D, 0x084F041D, 0x0874841D, 0x08358404, 0x082AC404, 0x10B9041C, 0x10B9041C,
+		0x07E80404, 0x00002304, 0x1060C406, 0x107CC406, 0x099D0419, 0x09A64419, 0x09CDC419, 0x14188404,
+		0x14194404, 0x085AC41D, 0x087DC41D, 0x0801C41D, 0x08108404, 0x08358404, 0x099B8417, 0x09CEC417,
+		0x10BDC41C, 0x0000071C, 0x10C2841C, 0x10B9C41C, 0x3ED04404, 0x26658000, 0x00002304, 0x09C88417,
+		0x09A3C417, 0x07FAC404, 0x00002304, 0x09B4441A, 0x09C3041A, 0x09B6C41A, 0x09C5041A, 0x3ED04404,
+		0x25FCC000, 0x09B48419, 0x09ACC419, 0x16784404, 0x00002324, 0x3ED04404, 0x21934000, 0x3ED00404,
+		0x34ED8000, 0x07FAC40A, 0x00002304, 0x3ED00404, 0x33AE8000, 0x0885C41D, 0x085AC41D, 0x4099C41C,
+		0x07E6C404, 0x3ED00404, 0x3C2E4000, 0x0874841D, 0x0874841D, 0x40CA0404, 0x105F0404, 0x40CA4404,
+		0x3ED0041C, 0x38C1C000, 0x11170404, 0x00002324, 0x0DC50402, 0x09A3C41A, 0x09A6441A, 0x07E6441E,
+		0x419D841E, 0x07E6441E, 0x07E6041E, 0x3ED04406, 0x24744000, 0x09B1C419, 0x09A64419, 0x09CDC419,
+		0x3ED00414, 0x3382C000, 0x07FAC404, 0x00002324, 0x10BB441C, 0x000006FC, 0x10B9841C, 0x07E64404,
+		0x00002304, 0x099D0419, 0x09C60419, 0x09C30417, 0x09A68417, 0x0F264404, 0x00002304, 0x3ED00406,
+		0x35C7C000, 0x3ED00404, 0x3D9F4000, 0x3ED00404, 0x34DA4000, 0x00002304, 0x07E84404, 0x3ED00404,
+		0x39C20000, 0x07E68404, 0x07E84404, 0x3ED00404, 0x39794000, 0x08CC041C, 0x07E8841D, 0x10B8441C,
+		0x000006FC, 0x10BC041C, 0x07D8041C, 0x0DBE8404, 0x0DC40404, 0x0DC6C404, 0x09A14419, 0x09A68419,
+		0x09CD8419, 0x3ED04404, 0x26B7C000, 0x09C30419, 0x09CDC419, 0x3ED04404, 0x27E70000, 0x00002304,
+		0x41A30404, 0x41A30404, 0x41A30404, 0x07E64404, 0x07E7C404, 0x409F8404, 0x087DC404, 0x00002304,
+		0x081D4404, 0x40CA0404, 0x07E64404, 0x07E68404, 0x40CA4404, 0x0814440A, 0x000006A4, 0x07E7441E,
+		0x419D841E, 0x07E7841E, 0x3ED00404, 0x3AF6C000, 0x08240404, 0x08990404, 0x3ED04404, 0x22748000,
+		0x00002304, 0x0810840A, 0x07E8840A, 0x0899040A, 0x0835840A, 0x0835840A, 0x0F2D8404, 0x00002304,
+		0x10B7041C, 0x10B7C41C, 0x10C2841C, 0x07E84404, 0x00002304, 0x09B60417, 0x09C50417, 0x0F0DC404,
+		0x0F0DC404, 0x3ED04404, 0x24730000, 0x40CA0404, 0x085AC404, 0x40CA4404, 0x08B8C404, 0x08460404,
+		0x40CA0404, 0x07E64404, 0x07E64404, 0x40CA4404, 0x085AC41C, 0x0810841D, 0x0F42C404, 0x0F710404,
+		0x07FAC41C, 0x0842441C, 0x07E6C41C, 0x09A6841A, 0x09CD841A, 0x0DBE8404, 0x0DC40404, 0x08358404,
+		0x08748404, 0x09B48417, 0x09A68417, 0x09C50417, 0x09C60417, 0x09A3C417, 0x09A64417, 0x09B4441A,
+		0x09C5041A, 0x3ED00404, 0x37F0C000, 0x409B4404, 0x409B4404, 0x40CA0404, 0x3ED00404, 0x3380C000,
+		0x40CA4404, 0x3ED00404, 0x396E4000, 0x0F29C404, 0x00002304, 0x09A14417, 0x09C50417, 0x09A68417,
+		0x0885C41D, 0x081D441D, 0x07FAC41D, 0x0F244404, 0x00002304, 0x09C60419, 0x09A3C419, 0x09CD8419,
+		0x0989C404, 0x09888404, 0x0988C404, 0x09888404, 0x0CC4C404, 0x00002324, 0x09BC0419, 0x09CD8419,
+		0x07E64406, 0x07E60406, 0x0000101A, 0x0000131A, 0x07E64406, 0x07E60406, 0x0F2AC404, 0x00002304,
+		0x40CA0404, 0x3ED04404, 0x2331C000, 0x40CA4404, 0x0835841C, 0x084F041C, 0x0814441C, 0x3ED00404,
+		0x3ADE8000, 0x00002304, 0x3ED04404, 0x26338000, 0x09C6041A, 0x09A3C41A, 0x081D441D, 0x08A1841C,
+		0x0842441D, 0x0896441D, 0x07E6C406, 0x07E7C406, 0x087DC404, 0x08768404, 0x40CA0404, 0x0831040A,
+		0x40CA4404, 0x07E64404, 0x07E6C404, 0x3ED00404, 0x39794000, 0x40CA0404, 0x3ED00404, 0x33A50000,
+		0x40CA4404, 0x08CB440A, 0x08C78404, 0x08CAC404, 0x40CA0404, 0x07E68404, 0x07E60404, 0x40CA4404,
+		0x099B8417, 0x09A64417, 0x07E88404, 0x0891C404, 0x09BC0419, 0x09CDC419, 0x3ED00406, 0x34FCC000,
+		0x0891C40A, 0x0824040A, 0x0824040A, 0x0F254404, 0x00002304, 0x0831041C, 0x0896441D, 0x10BD841C,
+		0x10B6841C, 0x10C0441C, 0x10BB041C, 0x10BB841C, 0x000006FC, 0x3ED00404, 0x3FA7C000, 0x3ED00406,
+		0x365CC000, 0x3ED00404, 0x3AF34000, 0x3ED0041C, 0x33A30000, 0x10B6C41C, 0x10BC041C, 0x10C2841C,
+		0x10B8841C, 0x000006FC, 0x40CA0404, 0x3ED00404, 0x34D50000, 0x40CA4404, 0x09A68417, 0x09A3C417,
+		0x3ED00404, 0x33964000, 0x1110C404, 0x00002324, 0x3ED00404, 0x379C8000, 0x0F24C404, 0x00002304,
+		0x3ED0041C, 0x34634000, 0x3ED04404, 0x26C94000, 0x084F0404, 0x00002304, 0x0801C404, 0x3ED00414,
+		0x33828000, 0x08108404, 0x00002324, 0x41A30404, 0x41A30404, 0x41A30404, 0x41A30404, 0x07E68404,
+		0x07E7C404, 0x3ED00404, 0x39794000, 0x09878404, 0x098A4404, 0x09B18418, 0x09A64418, 0x0A9E0402,
+		0x09B90417, 0x09C50417, 0x41A34404, 0x41A34404, 0x3ED04404, 0x2218C000, 0x3ED04404, 0x26CBC000,
+		0x099B841A, 0x09CB441A, 0x40CA0404, 0x07E64404, 0x07E60404, 0x40CA4404, 0x07E7C404, 0x3ED00404,
+		0x39C20000, 0x07FAC404, 0x00002304, 0x3ED04404, 0x27D48000, 0x09B6C41A, 0x09CD841A, 0x3ED00404,
+		0x34E08000, 0x00002304, 0x09C30419, 0x09A3C419, 0x09CDC419, 0x16758404, 0x00002304, 0x3ED0041C,
+		0x34874000, 0x10BE441C, 0x10BB041C, 0x10BD041C, 0x09B90419, 0x09CDC419, 0x07E74404, 0x3ED00404,
+		0x39C20000, 0x09B18419, 0x09CD8419, 0x099B841A, 0x09CEC41A, 0x10BDC41C, 0x000006FC, 0x07D8041C,
+		0x10BA841C, 0x3ED0041C, 0x349C8000, 0x3ED00404, 0x3FD44000, 0x3ED00404, 0x39C20000, 0x00002304,
+		0x3ED04404, 0x209C8000, 0x40CA0404, 0x3ED00404, 0x33C04000, 0x40CA4404, 0x09B18419, 0x09ACC419,
+		0x0842441C, 0x07E6C41C, 0x0874841D, 0x0891C41C, 0x3ED00404, 0x33A30000, 0x3ED0041C, 0x3D4CC000,
+		0x07E6C404, 0x3ED00404, 0x39794000, 0x07E70406, 0x07E7C406, 0x3ED00414, 0x33824000, 0x0F1C0404,
+		0x00002304, 0x3ED04404, 0x27D28000, 0x00002304, 0x10C0841C, 0x10BB041C, 0x10BB841C, 0x10C0C41C,
+		0x3ED00406, 0x35B6C000, 0x0CC4C402, 0x0874841D, 0x07E8841D, 0x0842441C, 0x0896441D, 0x0D770402,
+		0x3ED00404, 0x34800000, 0x099D0418, 0x09C88418, 0x09B1C419, 0x09CDC419, 0x07E88404, 0x00002304,
+		0x09A14417, 0x09C88417, 0x09CDC417, 0x09A68417, 0x3ED04404, 0x26664000, 0x3ED00406, 0x3C9E4000,
+		0x1116C416, 0x00002336, 0x07E68406, 0x07E78406, 0x09B70417, 0x09C50417, 0x3ED04404, 0x2086C000,
+		0x09B1C419, 0x09A68419, 0x40CA0404, 0x0860040A, 0x40CA4404, 0x09C8841A, 0x09A3C41A, 0x3ED04404,
+		0x25870000, 0x00002304, 0x09C30419, 0x09A64419, 0x09CDC419, 0x3ED0041C, 0x3649C000, 0x3ED0041C,
+		0x3AD8C000, 0x3ED00404, 0x3E4E8000, 0x00002304, 0x09BD841A, 0x09C5041A, 0x3ED00404, 0x36408000,
+		0x0B124402, 0x09C5041A, 0x09A3C41A, 0x1060C406, 0x107CC406, 0x10980406, 0x105D4406, 0x107EC406,
+		0x00001B42, 0x081D441D, 0x07FAC41C, 0x0864C41D, 0x3ED04402, 0x3E89C000, 0x0842441D, 0x08D1841D,
+		0x09CDC417, 0x09C50417, 0x09C50417, 0x0864C404, 0x00002324, 0x3ED00404, 0x3AC80000, 0x0DFC4402,
+		0x40CA0404, 0x084F040A, 0x40CA4404, 0x3ED04404, 0x20048000, 0x0846041D, 0x0814441D, 0x07E68404,
+		0x07E70404, 0x3ED00404, 0x39794000, 0x3ED00404, 0x3D47C000, 0x0CA50402, 0x0F128404, 0x00002384,
+		0x07E68404, 0x4088C404, 0x09D24404, 0x00002344, 0x07E88404, 0x089C0404, 0x10BE4404, 0x10B9C404,
+		0x3ED04404, 0x25AE4000, 0x40CA0404, 0x082AC404, 0x40CA4404, 0x09824404, 0x09830404, 0x3ED0041C,
+		0x3E604000, 0x084F0402, 0x000005E2, 0x07E68406, 0x07E70406, 0x40E28404, 0x3ED00404, 0x33824000,
+		0x40E2C404, 0x09B7041A, 0x09CDC41A, 0x3ED04404, 0x200CC000, 0x3ED04404, 0x231E0000, 0x3ED0041C,
+		0x3A0A8000, 0x3ED0041C, 0x37C3C000, 0x3ED0041C, 0x33C68000, 0x3ED0041C, 0x3E4F8000, 0x0831041C,
+		0x0835841C, 0x0F1AC404, 0x00002304, 0x07E88404, 0x00002304, 0x0801C404, 0x40CA0404, 0x105F8404,
+		0x107CC404, 0x40CA4404, 0x09C60419, 0x09A3C419, 0x09CDC419, 0x105EC406, 0x107CC406, 0x3ED0041C,
+		0x3C484000, 0x3ED00404, 0x3B0E8000, 0x09B9041A, 0x09CDC41A, 0x40CA0404, 0x3ED00404, 0x3E5B4000,
+		0x40CA4404, 0x099B841A, 0x09CDC41A, 0x09BC041A, 0x09C3041A, 0x09D1441A, 0x0842441D, 0x085AC41D,
+		0x07E8841C, 0x09B44419, 0x09C50419, 0x09C50419, 0x3ED04404, 0x271F0000, 0x09B90417, 0x09A3C417,
+		0x3ED00404, 0x3FE2C000, 0x40CA0404, 0x07E78404, 0x40CA4404, 0x40CA0404, 0x0801C40A, 0x40CA4404,
+		0x07E64404, 0x07E64404, 0x3ED00404, 0x3C2E4000, 0x3ED0041C, 0x3BA00000, 0x07E6C404, 0x409F8404,
+		0x3ED0041C, 0x39838000, 0x3ED0041C, 0x3B2EC000, 0x409F8416, 0x409F8416, 0x409F8416, 0x09CD8419,
+		0x00001319, 0x10BF041C, 0x10B8041C, 0x000006FC, 0x09B90417, 0x09A64417, 0x3ED04404, 0x26CF0000,
+		0x3ED04406, 0x26014000, 0x09BD8418, 0x09C50418, 0x09C60417, 0x09A3C417, 0x10B98404, 0x10BF0404,
+		0x09A18419, 0x09C60419, 0x07E6C41E, 0x419D841E, 0x07E7441E, 0x07E88404, 0x00000564, 0x099D0419,
+		0x09A68419, 0x09CDC419, 0x0BDE8404, 0x00002304, 0x09C60419, 0x09ACC419, 0x07E84404, 0x409F8404,
+		0x0874840A, 0x000006A4, 0x09D28404, 0x00002344, 0x414A8404, 0x07F5840A, 0x3ED00404, 0x394D4000,
+		0x0F128404, 0x00002364, 0x07E64406, 0x07E68406, 0x40CA0404, 0x3ED00404, 0x33B8C000, 0x40CA4404,
+		0x10B9841C, 0x10C0841C, 0x10C2841C, 0x10B8841C, 0x000006FC, 0x07D70402, 0x000006E2, 0x3ED04404,
+		0x236CC000, 0x00002304, 0x0CC48404, 0x00002324, 0x3ED04404, 0x20030000, 0x40CA0404, 0x10604404,
+		0x107CC404, 0x40CA4404, 0x0F1C040A, 0x00002304, 0x087DC404, 0x08790404, 0x09B6C419, 0x09C50419,
+		0x09CD8419, 0x09A14419, 0x09A3C419, 0x09CDC419, 0x0F134404, 0x00002324, 0x09CDC419, 0x09C50419,
+		0x09CDC419, 0x09A1841A, 0x09A3C41A, 0x09B60418, 0x09C50418, 0x0F464404, 0x0F710404, 0x0814441D,
+		0x07EF041D, 0x07E68404, 0x00002304, 0x09B44419, 0x09A64419, 0x09A64419, 0x0842441D, 0x0891C41D,
+		0x0D9BC402, 0x099D041A, 0x09A6441A, 0x1428C404, 0x14298404, 0x09A64419, 0x09C50419, 0x09CDC419,
+		0x09C30419, 0x09998419, 0x40CA0404, 0x105DC404, 0x40CA4404, 0x09D30404, 0x00002344, 0x0CB3C402,
+		0x081D441D, 0x085AC41D, 0x3ED00404, 0x34D14000, 0x3ED04404, 0x22190000, 0x3ED00404, 0x394D0000,
+		0x07F5841D, 0x084F041D, 0x084F041D, 0x0835841D, 0x09B4841A, 0x09C5041A, 0x07E68404, 0x07E64404,
+		0x3ED00404, 0x3C2E4000, 0x084F0404, 0x00000564, 0x09A3C419, 0x09C50419, 0x09CD8419, 0x09B1841A,
+		0x09CDC41A, 0x09BD8419, 0x09C50419, 0x084F0404, 0x00000684, 0x0DC44402, 0x3ED04404, 0x23ED4000,
+		0x07E64404, 0x3ED00404, 0x39C20000, 0x0DFCC402, 0x3ED0041C, 0x39C24000, 0x09A14417, 0x09A64417,
+		0x09A3C417, 0x3ED04404, 0x23118000, 0x3ED00404, 0x3C1AC000, 0x09D14419, 0x00001079, 0x10B8441C,
+		0x10C1441C, 0x10B8841C, 0x000006FC, 0x10C0441C, 0x10BEC41C, 0x40EFC404, 0x40EFC404, 0x40EFC404,
+		0x40EFC404, 0x3ED0441C, 0x24128000, 0x07E68406, 0x07E80406, 0x085AC41D, 0x081D441D, 0x1677C404,
+		0x00002324, 0x0F0E0404, 0x00002344, 0x099B841A, 0x09CB041A, 0x3ED04404, 0x22800000, 0x0AD28402,
+		0x09BD841A, 0x09A6841A, 0x3ED00404, 0x3D62C000, 0x00002304, 0x07E60404, 0x4088C404, 0x07E70406,
+		0x07E68406, 0x3ED00404, 0x3DFCC000, 0x09A9441A, 0x0000131A, 0x3ED00406, 0x34D04000, 0x08FB4404,
+		0x00000564, 0x0F0F4404, 0x00002344, 0x10618406, 0x107CC406, 0x09CDC417, 0x09A3C417, 0x0F188404,
+		0x00002324, 0x10BDC41C, 0x0000071C, 0x10BA441C, 0x41A34404, 0x41A34404, 0x41A34404, 0x40E28404,
+		0x3ED00404, 0x36E24000, 0x40E2C404, 0x09C50419, 0x09A64419, 0x09CDC419, 0x09A64419, 0x09CDC419,
+		0x3ED00404, 0x33800000, 0x084F0408, 0x000005E2, 0x3ED00404, 0x370E0000, 0x40CA0404, 0x07E64404,
+		0x07E74404, 0x40CA4404, 0x3ED00404, 0x3E9D0000, 0x09F14404, 0x00002304, 0x419AC404, 0x419AC404,
+		0x3ED00404, 0x3DF88000, 0x0F5B4404, 0x0F710404, 0x0864C40A, 0x000006A4, 0x07E68404, 0x07E68404,
+		0x3ED00404, 0x3C2E4000, 0x09B1C41A, 0x09A3C41A, 0x07E8841D, 0x0885C41D, 0x0F26C404, 0x00002304,
+		0x07E64406, 0x07E60406, 0x3ED00404, 0x33AEC000, 0x10B6841C, 0x10BD041C, 0x0000071C, 0x07D8041C,
+		0x10BB841C, 0x10BD041C, 0x0000071C, 0x07D8041C, 0x10BA041C, 0x10C2841C, 0x10BB841C, 0x3ED00404,
+		0x37C2C000, 0x3ED00404, 0x3FD4C000, 0x00002324, 0x09B18417, 0x09A64417, 0x09A3C417, 0x40CA0404,
+		0x0899040A, 0x40CA4404, 0x09BD8417, 0x09A64417, 0x09A6841A, 0x09C5041A, 0x099D041A, 0x09C5041A,
+		0x09C60419, 0x09C50419, 0x00000ED8, 0x00001018, 0x09B18417, 0x09C88417, 0x09C30419, 0x09994419,
+		0x07E68404, 0x07E6C404, 0x3ED00404, 0x3C2E4000, 0x0AFD4402, 0x40CA0404, 0x3ED00404, 0x33800000,
+		0x40CA4404, 0x40CA0404, 0x10610404, 0x107CC404, 0x40CA4404, 0x40CA0404, 0x10614404, 0x40CA4404,
+		0x3ED04404, 0x23ED8000, 0x087DC41D, 0x081D441D, 0x08A1841C, 0x09B44417, 0x09C50417, 0x09B6C419,
+		0x09C50419, 0x09C50419, 0x11138404, 0x00002324, 0x3ED00404, 0x34C68000, 0x07E74404, 0x409F8404,
+		0x07E7441C, 0x409F841C, 0x07E6441C, 0x07E64406, 0x07E80406, 0x09B1C417, 0x09A64417, 0x09C50417,
+		0x0F0E0404, 0x00002364, 0x07E88404, 0x07E88404, 0x10C1041C, 0x10BEC41C, 0x0842441C, 0x0835841C,
+		0x087DC40A, 0x08A18404, 0x0846041D, 0x0801C41D, 0x0896441D, 0x09B1C418, 0x09C88418, 0x40CA0404,
+		0x08990404, 0x40CA4404, 0x081D4402, 0x00000722, 0x0842441C, 0x07E6841C, 0x0F140404, 0x00002304,
+		0x09B5C419, 0x09CDC419, 0x09B5C419, 0x09C50419, 0x09CDC419, 0x09A3C41A, 0x09C3041A, 0x4082441A,
+		0x09A3C41A, 0x09C3041A, 0x099C841A, 0x09C3041A, 0x09C8841A, 0x167A8404, 0x00002304, 0x09C88417,
+		0x09C50417, 0x09A3C417, 0x0846040A, 0x000006A4, 0x0C950402, 0x08E6C404, 0x00002324, 0x099B8419,
+		0x09CDC419, 0x0DF08402, 0x3ED00404, 0x3FE28000, 0x00002304, 0x00001C02, 0x3ED00404, 0x3DF6C000,
+		0x07E80404, 0x3ED00404, 0x39794000, 0x10BE041C, 0x07D8041C, 0x10C0C41C, 0x087DC414, 0x08424414,
+		0x3ED04404, 0x27BE4000, 0x08358408, 0x00002302, 0x08358402, 0x00002302, 0x08FC8408, 0x08FC8402,
+		0x09994402, 0x09998402, 0x099A8402, 0x099A4402, 0x099B8402, 0x0A9E8402, 0x0A9EC402, 0x0ACEC402,
+		0x0ACE8402, 0x0ACF0402, 0x0AD30402, 0x0ADB4402, 0x0ADBC402, 0x0ADB8402, 0x0AED4402, 0x0AFD8402,
+		0x0B000402, 0x0B004402, 0x0AFF8402, 0x0AFFC402, 0x0B12C402, 0x0B134402, 0x0B130402, 0x0B25C402,
+		0x0B264402, 0x0B268402, 0x0B26C402, 0x0C85C402, 0x0C944402, 0x0C860402, 0x0C944402, 0x0C864402,
+		0x0C944402, 0x0C868402, 0x0C944402, 0x0C86C402, 0x0C944402, 0x0C870402, 0x0C944402, 0x0C874402,
+		0x0C944402, 0x0C878402, 0x0C944402, 0x0C87C402, 0x0C944402, 0x0C880402, 0x0C944402, 0x0C884402,
+		0x0C944402, 0x0C888402, 0x0C944402, 0x0C88C402, 0x0C944402, 0x0C890402, 0x0C944402, 0x0C894402,
+		0x0C944402, 0x0C898402, 0x0C944402, 0x0C89C402, 0x0C944402, 0x0C8A0402, 0x0C944402, 0x0C8A4402,
+		0x0C944402, 0x0C8A8402, 0x0C944402, 0x0C8AC402, 0x0C944402, 0x0C8B0402, 0x0C944402, 0x0C8B4402,
+		0x0C944402, 0x0C8B8402, 0x0C944402, 0x0C8BC402, 0x0C944402, 0x0C8C0402, 0x0C944402, 0x0C8C4402,
+		0x0C944402, 0x0C8C8402, 0x0C944402, 0x0C8CC402, 0x0C944402, 0x0C8D0402, 0x0C944402, 0x0C8D4402,
+		0x0C944402, 0x0C8D8402, 0x0C944402, 0x0C8DC402, 0x0C944402, 0x0C8E0402, 0x0C944402, 0x0C8E4402,
+		0x0C944402, 0x0C8E8402, 0x0C944402, 0x0C8EC402, 0x0C944402, 0x0C8F0402, 0x0C944402, 0x0C8F4402,
+		0x0C944402, 0x0C8F8402, 0x0C944402, 0x0C8FC402, 0x0C944402, 0x0C900402, 0x0C944402, 0x0C904402,
+		0x0C944402, 0x0C908402, 0x0C944402, 0x0C90C402, 0x0C944402, 0x0C910402, 0x0C944402, 0x0C85C402,
+		0x0C948402, 0x0C860402, 0x0C948402, 0x0C864402, 0x0C948402, 0x0C868402, 0x0C948402, 0x0C86C402,
+		0x0C948402, 0x0C870402, 0x0C948402, 0x0C874402, 0x0C948402, 0x0C878402, 0x0C948402, 0x0C87C402,
+		0x0C948402, 0x0C880402, 0x0C948402, 0x0C884402, 0x0C948402, 0x0C888402, 0x0C948402, 0x0C88C402,
+		0x0C948402, 0x0C890402, 0x0C948402, 0x0C894402, 0x0C948402, 0x0C898402, 0x0C948402, 0x0C89C402,
+		0x0C948402, 0x0C8A0402, 0x0C948402, 0x0C8A4402, 0x0C948402, 0x0C8A8402, 0x0C948402, 0x0C8AC402,
+		0x0C948402, 0x0C8B0402, 0x0C948402, 0x0C8B4402, 0x0C948402, 0x0C8B8402, 0x0C948402, 0x0C8BC402,
+		0x0C948402, 0x0C8C0402, 0x0C948402, 0x0C8C4402, 0x0C948402, 0x0C8C8402, 0x0C948402, 0x0C8CC402,
+		0x0C948402, 0x0C8D0402, 0x0C948402, 0x0C8D4402, 0x0C948402, 0x0C8D8402, 0x0C948402, 0x0C8DC402,
+		0x0C948402, 0x0C8E0402, 0x0C948402, 0x0C8E4402, 0x0C948402, 0x0C8E8402, 0x0C948402, 0x0C8EC402,
+		0x0C948402, 0x0C8F0402, 0x0C948402, 0x0C8F4402, 0x0C948402, 0x0C8F8402, 0x0C948402, 0x0C8FC402,
+		0x0C948402, 0x0C900402, 0x0C948402, 0x0C904402, 0x0C948402, 0x0C908402, 0x0C948402, 0x0C90C402,
+		0x0C948402, 0x0C910402, 0x0C948402, 0x0C85C402, 0x0C94C402, 0x0C860402, 0x0C94C402, 0x0C864402,
+		0x0C94C402, 0x0C868402, 0x0C94C402, 0x0C86C402, 0x0C94C402, 0x0C870402, 0x0C94C402, 0x0C874402,
+		0x0C94C402, 0x0C878402, 0x0C94C402, 0x0C87C402, 0x0C94C402, 0x0C880402, 0x0C94C402, 0x0C884402,
+		0x0C94C402, 0x0C888402, 0x0C94C402, 0x0C88C402, 0x0C94C402, 0x0C890402, 0x0C94C402, 0x0C894402,
+		0x0C94C402, 0x0C898402, 0x0C94C402, 0x0C89C402, 0x0C94C402, 0x0C8A0402, 0x0C94C402, 0x0C8A4402,
+		0x0C94C402, 0x0C8A8402, 0x0C94C402, 0x0C8AC402, 0x0C94C402, 0x0C8B0402, 0x0C94C402, 0x0C8B4402,
+		0x0C94C402, 0x0C8B8402, 0x0C94C402, 0x0C8BC402, 0x0C94C402, 0x0C8C0402, 0x0C94C402, 0x0C8C4402,
+		0x0C94C402, 0x0C8C8402, 0x0C94C402, 0x0C8CC402, 0x0C94C402, 0x0C8D0402, 0x0C94C402, 0x0C8D4402,
+		0x0C94C402, 0x0C8D8402, 0x0C94C402, 0x0C8DC402, 0x0C94C402, 0x0C8E0402, 0x0C94C402, 0x0C8E4402,
+		0x0C94C402, 0x0C8E8402, 0x0C94C402, 0x0C8EC402, 0x0C94C402, 0x0C8F0402, 0x0C94C402, 0x0C8F4402,
+		0x0C94C402, 0x0C8F8402, 0x0C94C402, 0x0C8FC402, 0x0C94C402, 0x0C900402, 0x0C94C402, 0x0C904402,
+		0x0C94C402, 0x0C908402, 0x0C94C402, 0x0C90C402, 0x0C94C402, 0x0C910402, 0x0C94C402, 0x0C85C402,
+		0x0C950402, 0x0C860402, 0x0C950402, 0x0C864402, 0x0C950402, 0x0C868402, 0x0C950402, 0x0C86C402,
+		0x0C950402, 0x0C870402, 0x0C950402, 0x0C874402, 0x0C950402, 0x0C878402, 0x0C950402, 0x0C87C402,
+		0x0C950402, 0x0C880402, 0x0C950402, 0x0C884402, 0x0C950402, 0x0C888402, 0x0C950402, 0x0C88C402,
+		0x0C950402, 0x0C890402, 0x0C950402, 0x0C894402, 0x0C950402, 0x0C898402, 0x0C950402, 0x0C89C402,
+		0x0C950402, 0x0C8A0402, 0x0C950402, 0x0C8A4402, 0x0C950402, 0x0C8A8402, 0x0C950402, 0x0C8AC402,
+		0x0C950402, 0x0C8B0402, 0x0C950402, 0x0C8B4402, 0x0C950402, 0x0C8B8402, 0x0C950402, 0x0C8BC402,
+		0x0C950402, 0x0C8C0402, 0x0C950402, 0x0C8C4402, 0x0C950402, 0x0C8C8402, 0x0C950402, 0x0C8CC402,
+		0x0C950402, 0x0C8D0402, 0x0C950402, 0x0C8D4402, 0x0C950402, 0x0C8D8402, 0x0C950402, 0x0C8DC402,
+		0x0C950402, 0x0C8E0402, 0x0C950402, 0x0C8E4402, 0x0C950402, 0x0C8E8402, 0x0C950402, 0x0C8EC402,
+		0x0C950402, 0x0C8F0402, 0x0C950402, 0x0C8F4402, 0x0C950402, 0x0C8F8402, 0x0C950402, 0x0C8FC402,
+		0x0C950402, 0x0C900402, 0x0C950402, 0x0C904402, 0x0C950402, 0x0C908402, 0x0C950402, 0x0C90C402,
+		0x0C950402, 0x0C910402, 0x0C950402, 0x0C85C402, 0x0C954402, 0x0C860402, 0x0C954402, 0x0C864402,
+		0x0C954402, 0x0C868402, 0x0C954402, 0x0C86C402, 0x0C954402, 0x0C870402, 0x0C954402, 0x0C874402,
+		0x0C954402, 0x0C878402, 0x0C954402, 0x0C87C402, 0x0C954402, 0x0C880402, 0x0C954402, 0x0C884402,
+		0x0C954402, 0x0C888402, 0x0C954402, 0x0C88C402, 0x0C954402, 0x0C890402, 0x0C954402, 0x0C894402,
+		0x0C954402, 0x0C898402, 0x0C954402, 0x0C89C402, 0x0C954402, 0x0C8A0402, 0x0C954402, 0x0C8A4402,
+		0x0C954402, 0x0C8A8402, 0x0C954402, 0x0C8AC402, 0x0C954402, 0x0C8B0402, 0x0C954402, 0x0C8B4402,
+		0x0C954402, 0x0C8B8402, 0x0C954402, 0x0C8BC402, 0x0C954402, 0x0C8C0402, 0x0C954402, 0x0C8C4402,
+		0x0C954402, 0x0C8C8402, 0x0C954402, 0x0C8CC402, 0x0C954402, 0x0C8D0402, 0x0C954402, 0x0C8D4402,
+		0x0C954402, 0x0C8D8402, 0x0C954402, 0x0C8DC402, 0x0C954402, 0x0C8E0402, 0x0C954402, 0x0C8E4402,
+		0x0C954402, 0x0C8E8402, 0x0C954402, 0x0C8EC402, 0x0C954402, 0x0C8F0402, 0x0C954402, 0x0C8F4402,
+		0x0C954402, 0x0C8F8402, 0x0C954402, 0x0C8FC402, 0x0C954402, 0x0C900402, 0x0C954402, 0x0C904402,
+		0x0C954402, 0x0C908402, 0x0C954402, 0x0C90C402, 0x0C954402, 0x0C910402, 0x0C954402, 0x0C924402,
+		0x0C960402, 0x0CA44402, 0x0C964402, 0x0CA44402, 0x0C968402, 0x0CA44402, 0x0C96C402, 0x0CA44402,
+		0x0C970402, 0x0CA44402, 0x0C974402, 0x0CA44402, 0x0C978402, 0x0CA44402, 0x0C980402, 0x0CA44402,
+		0x0C984402, 0x0CA44402, 0x0C990402, 0x0CA44402, 0x0C988402, 0x0CA44402, 0x0C994402, 0x0CA44402,
+		0x0C998402, 0x0CA44402, 0x0C99C402, 0x0CA44402, 0x0C9A0402, 0x0CA44402, 0x0C9A4402, 0x0CA44402,
+		0x0C9A8402, 0x0CA44402, 0x0C9AC402, 0x0CA44402, 0x0C9B0402, 0x0CA44402, 0x0C9B4402, 0x0CA44402,
+		0x0C9B8402, 0x0CA44402, 0x0C9BC402, 0x0CA44402, 0x0C9C0402, 0x0CA44402, 0x0C9C4402, 0x0CA44402,
+		0x0C9C8402, 0x0CA44402, 0x0C9CC402, 0x0CA44402, 0x0C9D0402, 0x0CA44402, 0x0C9D4402, 0x0CA44402,
+		0x0C9D8402, 0x0CA44402, 0x0C9DC402, 0x0CA44402, 0x0C9E0402, 0x0CA44402, 0x0C9E4402, 0x0CA44402,
+		0x0C9E8402, 0x0CA44402, 0x0C9EC402, 0x0CA44402, 0x0C9F0402, 0x0CA44402, 0x0C9F4402, 0x0CA44402,
+		0x0C97C402, 0x0CA44402, 0x0C9F8402, 0x0CA44402, 0x0C9FC402, 0x0CA44402, 0x0CA00402, 0x0CA44402,
+		0x0CA04402, 0x0CA44402, 0x0C9F8404, 0x0C9BC404, 0x0CA44402, 0x0C9F8404, 0x0C9DC404, 0x0CA44402,
+		0x0C95C402, 0x0CA44402, 0x0C98C402, 0x0CA44402, 0x0C960402, 0x0CA48402, 0x0C964402, 0x0CA48402,
+		0x0C968402, 0x0CA48402, 0x0C96C402, 0x0CA48402, 0x0C970402, 0x0CA48402, 0x0C974402, 0x0CA48402,
+		0x0C978402, 0x0CA48402, 0x0C980402, 0x0CA48402, 0x0C984402, 0x0CA48402, 0x0C990402, 0x0CA48402,
+		0x0C988402, 0x0CA48402, 0x0C994402, 0x0CA48402, 0x0C998402, 0x0CA48402, 0x0C99C402, 0x0CA48402,
+		0x0C9A0402, 0x0CA48402, 0x0C9A4402, 0x0CA48402, 0x0C9A8402, 0x0CA48402, 0x0C9AC402, 0x0CA48402,
+		0x0C9B0402, 0x0CA48402, 0x0C9B4402, 0x0CA48402, 0x0C9B8402, 0x0CA48402, 0x0C9BC402, 0x0CA48402,
+		0x0C9C0402, 0x0CA48402, 0x0C9C4402, 0x0CA48402, 0x0C9C8402, 0x0CA48402, 0x0C9CC402, 0x0CA48402,
+		0x0C9D0402, 0x0CA48402, 0x0C9D4402, 0x0CA48402, 0x0C9D8402, 0x0CA48402, 0x0C9DC402, 0x0CA48402,
+		0x0C9E0402, 0x0CA48402, 0x0C9E4402, 0x0CA48402, 0x0C9E8402, 0x0CA48402, 0x0C9EC402, 0x0CA48402,
+		0x0C9F0402, 0x0CA48402, 0x0C9F4402, 0x0CA48402, 0x0C97C402, 0x0CA48402, 0x0C9F8402, 0x0CA48402,
+		0x0C9FC402, 0x0CA48402, 0x0CA00402, 0x0CA48402, 0x0CA04402, 0x0CA48402, 0x0C9F8404, 0x0C9BC404,
+		0x0CA48402, 0x0C9F8404, 0x0C9DC404, 0x0CA48402, 0x0C95C402, 0x0CA48402, 0x0C98C402, 0x0CA48402,
+		0x0C960402, 0x0CA4C402, 0x0C964402, 0x0CA4C402, 0x0C968402, 0x0CA4C402, 0x0C96C402, 0x0CA4C402,
+		0x0C970402, 0x0CA4C402, 0x0C974402, 0x0CA4C402, 0x0C978402, 0x0CA4C402, 0x0C980402, 0x0CA4C402,
+		0x0C984402, 0x0CA4C402, 0x0C990402, 0x0CA4C402, 0x0C988402, 0x0CA4C402, 0x0C994402, 0x0CA4C402,
+		0x0C998402, 0x0CA4C402, 0x0C99C402, 0x0CA4C402, 0x0C9A0402, 0x0CA4C402, 0x0C9A4402, 0x0CA4C402,
+		0x0C9A8402, 0x0CA4C402, 0x0C9AC402, 0x0CA4C402, 0x0C9B0402, 0x0CA4C402, 0x0C9B4402, 0x0CA4C402,
+		0x0C9B8402, 0x0CA4C402, 0x0C9BC402, 0x0CA4C402, 0x0C9C0402, 0x0CA4C402, 0x0C9C4402, 0x0CA4C402,
+		0x0C9C8402, 0x0CA4C402, 0x0C9CC402, 0x0CA4C402, 0x0C9D0402, 0x0CA4C402, 0x0C9D4402, 0x0CA4C402,
+		0x0C9D8402, 0x0CA4C402, 0x0C9DC402, 0x0CA4C402, 0x0C9E0402, 0x0CA4C402, 0x0C9E4402, 0x0CA4C402,
+		0x0C9E8402, 0x0CA4C402, 0x0C9EC402, 0x0CA4C402, 0x0C9F0402, 0x0CA4C402, 0x0C9F4402, 0x0CA4C402,
+		0x0C97C402, 0x0CA4C402, 0x0C9F8402, 0x0CA4C402, 0x0C9FC402, 0x0CA4C402, 0x0CA00402, 0x0CA4C402,
+		0x0CA04402, 0x0CA4C402, 0x0C9F8404, 0x0C9BC404, 0x0CA4C402, 0x0C9F8404, 0x0C9DC404, 0x0CA4C402,
+		0x0C95C402, 0x0CA4C402, 0x0C98C402, 0x0CA4C402, 0x0C960402, 0x0CA50402, 0x0C964402, 0x0CA50402,
+		0x0C968402, 0x0CA50402, 0x0C96C402, 0x0CA50402, 0x0C970402, 0x0CA50402, 0x0C974402, 0x0CA50402,
+		0x0C978402, 0x0CA50402, 0x0C980402, 0x0CA50402, 0x0C984402, 0x0CA50402, 0x0C990402, 0x0CA50402,
+		0x0C988402, 0x0CA50402, 0x0C994402, 0x0CA50402, 0x0C998402, 0x0CA50402, 0x0C99C402, 0x0CA50402,
+		0x0C9A0402, 0x0CA50402, 0x0C9A4402, 0x0CA50402, 0x0C9A8402, 0x0CA50402, 0x0C9AC402, 0x0CA50402,
+		0x0C9B0402, 0x0CA50402, 0x0C9B4402, 0x0CA50402, 0x0C9B8402, 0x0CA50402, 0x0C9BC402, 0x0CA50402,
+		0x0C9C0402, 0x0CA50402, 0x0C9C4402, 0x0CA50402, 0x0C9C8402, 0x0CA50402, 0x0C9CC402, 0x0CA50402,
+		0x0C9D0402, 0x0CA50402, 0x0C9D4402, 0x0CA50402, 0x0C9D8402, 0x0CA50402, 0x0C9DC402, 0x0CA50402,
+		0x0C9E0402, 0x0CA50402, 0x0C9E4402, 0x0CA50402, 0x0C9E8402, 0x0CA50402, 0x0C9EC402, 0x0CA50402,
+		0x0C9F0402, 0x0CA50402, 0x0C9F4402, 0x0CA50402, 0x0C97C402, 0x0CA50402, 0x0C9F8402, 0x0CA50402,
+		0x0C9FC402, 0x0CA50402, 0x0CA00402, 0x0CA50402, 0x0CA04402, 0x0CA50402, 0x0C9F8404, 0x0C9BC404,
+		0x0CA50402, 0x0C9F8404, 0x0C9DC404, 0x0CA50402, 0x0C95C402, 0x0CA50402, 0x0C98C402, 0x0CA50402,
+		0x0C960402, 0x0CA54402, 0x0C964402, 0x0CA54402, 0x0C968402, 0x0CA54402, 0x0C96C402, 0x0CA54402,
+		0x0C970402, 0x0CA54402, 0x0C974402, 0x0CA54402, 0x0C978402, 0x0CA54402, 0x0C980402, 0x0CA54402,
+		0x0C984402, 0x0CA54402, 0x0C990402, 0x0CA54402, 0x0C988402, 0x0CA54402, 0x0C994402, 0x0CA54402,
+		0x0C998402, 0x0CA54402, 0x0C99C402, 0x0CA54402, 0x0C9A0402, 0x0CA54402, 0x0C9A4402, 0x0CA54402,
+		0x0C9A8402, 0x0CA54402, 0x0C9AC402, 0x0CA54402, 0x0C9B0402, 0x0CA54402, 0x0C9B4402, 0x0CA54402,
+		0x0C9B8402, 0x0CA54402, 0x0C9BC402, 0x0CA54402, 0x0C9C0402, 0x0CA54402, 0x0C9C4402, 0x0CA54402,
+		0x0C9C8402, 0x0CA54402, 0x0C9CC402, 0x0CA54402, 0x0C9D0402, 0x0CA54402, 0x0C9D4402, 0x0CA54402,
+		0x0C9D8402, 0x0CA54402, 0x0C9DC402, 0x0CA54402, 0x0C9E0402, 0x0CA54402, 0x0C9E4402, 0x0CA54402,
+		0x0C9E8402, 0x0CA54402, 0x0C9EC402, 0x0CA54402, 0x0C9F0402, 0x0CA54402, 0x0C9F4402, 0x0CA54402,
+		0x0C97C402, 0x0CA54402, 0x0C9F8402, 0x0CA54402, 0x0C9FC402, 0x0CA54402, 0x0CA00402, 0x0CA54402,
+		0x0CA04402, 0x0CA54402, 0x0C9F8404, 0x0C9BC404, 0x0CA54402, 0x0C9F8404, 0x0C9DC404, 0x0CA54402,
+		0x0C95C402, 0x0CA54402, 0x0C98C402, 0x0CA54402, 0x0CA18402, 0x0CCAC402, 0x0CCBC402, 0x0CCB4402,
+		0x0CCC4402, 0x0CCC0402, 0x0CCCC402, 0x0CCC8402, 0x0D774402, 0x0DB78402, 0x0DC3C402, 0x0DB7C402,
+		0x0DC3C402, 0x0DB80402, 0x0DC3C402, 0x0DB84402, 0x0DC3C402, 0x0DB88402, 0x0DC3C402, 0x0DB8C402,
+		0x0DC3C402, 0x0DB90402, 0x0DC3C402, 0x0DB94402, 0x0DC3C402, 0x0DB98402, 0x0DC3C402, 0x0DB9C402,
+		0x0DC3C402, 0x0DBA0402, 0x0DC3C402, 0x0DBA4402, 0x0DC3C402, 0x0DBA8402, 0x0DC3C402, 0x0DBAC402,
+		0x0DC3C402, 0x0DBB0402, 0x0DC3C402, 0x0DBB4402, 0x0DC3C402, 0x0DBB8402, 0x0DC3C402, 0x0DBBC402,
+		0x0DC3C402, 0x0DBC0402, 0x0DC3C402, 0x0DBC4402, 0x0DC3C402, 0x0DBC8402, 0x0DC3C402, 0x0DBCC402,
+		0x0DC3C402, 0x0DBD0402, 0x0DC3C402, 0x0DBD4402, 0x0DC3C402, 0x0DBD8402, 0x0DC3C402, 0x0DBDC402,
+		0x0DC3C402, 0x0DBE0402, 0x0DC3C402, 0x0DBE4402, 0x0DC3C402, 0x0DBE8402, 0x0DC3C402, 0x0DBEC402,
+		0x0DC3C402, 0x0DBF0402, 0x0DC3C402, 0x0DBF4402, 0x0DC3C402, 0x0DBF8402, 0x0DC3C402, 0x0DBFC402,
+		0x0DC3C402, 0x0DC00402, 0x0DC3C402, 0x0DC04402, 0x0DC3C402, 0x0DC08402, 0x0DC3C402, 0x0DC0C402,
+		0x0DC3C402, 0x0DC10402, 0x0DC3C402, 0x0DC14402, 0x0DC3C402, 0x0DC18402, 0x0DC3C402, 0x0DC1C402,
+		0x0DC3C402, 0x0DC20402, 0x0DC3C402, 0x0DC24402, 0x0DC3C402, 0x0DB78402, 0x0DC40402, 0x0DB7C402,
+		0x0DC40402, 0x0DB80402, 0x0DC40402, 0x0DB84402, 0x0DC40402, 0x0DB88402, 0x0DC40402, 0x0DB8C402,
+		0x0DC40402, 0x0DB90402, 0x0DC40402, 0x0DB94402, 0x0DC40402, 0x0DB98402, 0x0DC40402, 0x0DB9C402,
+		0x0DC40402, 0x0DBA0402, 0x0DC40402, 0x0DBA4402, 0x0DC40402, 0x0DBA8402, 0x0DC40402, 0x0DBAC402,
+		0x0DC40402, 0x0DBB0402, 0x0DC40402, 0x0DBB4402, 0x0DC40402, 0x0DBB8402, 0x0DC40402, 0x0DBBC402,
+		0x0DC40402, 0x0DBC0402, 0x0DC40402, 0x0DBC4402, 0x0DC40402, 0x0DBC8402, 0x0DC40402, 0x0DBCC402,
+		0x0DC40402, 0x0DBD0402, 0x0DC40402, 0x0DBD4402, 0x0DC40402, 0x0DBD8402, 0x0DC40402, 0x0DBDC402,
+		0x0DC40402, 0x0DBE0402, 0x0DC40402, 0x0DBE4402, 0x0DC40402, 0x0DBE8402, 0x0DC40402, 0x0DBEC402,
+		0x0DC40402, 0x0DBF0402, 0x0DC40402, 0x0DBF4402, 0x0DC40402, 0x0DBF8402, 0x0DC40402, 0x0DBFC402,
+		0x0DC40402, 0x0DC00402, 0x0DC40402, 0x0DC04402, 0x0DC40402, 0x0DC08402, 0x0DC40402, 0x0DC0C402,
+		0x0DC40402, 0x0DC10402, 0x0DC40402, 0x0DC14402, 0x0DC40402, 0x0DC18402, 0x0DC40402, 0x0DC1C402,
+		0x0DC40402, 0x0DC20402, 0x0DC40402, 0x0DC24402, 0x0DC40402, 0x0DB78402, 0x0DC44402, 0x0DB7C402,
+		0x0DC44402, 0x0DB80402, 0x0DC44402, 0x0DB84402, 0x0DC44402, 0x0DB88402, 0x0DC44402, 0x0DB8C402,
+		0x0DC44402, 0x0DB90402, 0x0DC44402, 0x0DB94402, 0x0DC44402, 0x0DB98402, 0x0DC44402, 0x0DB9C402,
+		0x0DC44402, 0x0DBA0402, 0x0DC44402, 0x0DBA4402, 0x0DC44402, 0x0DBA8402, 0x0DC44402, 0x0DBAC402,
+		0x0DC44402, 0x0DBB0402, 0x0DC44402, 0x0DBB4402, 0x0DC44402, 0x0DBB8402, 0x0DC44402, 0x0DBBC402,
+		0x0DC44402, 0x0DBC0402, 0x0DC44402, 0x0DBC4402, 0x0DC44402, 0x0DBC8402, 0x0DC44402, 0x0DBCC402,
+		0x0DC44402, 0x0DBD0402, 0x0DC44402, 0x0DBD4402, 0x0DC44402, 0x0DBD8402, 0x0DC44402, 0x0DBDC402,
+		0x0DC44402, 0x0DBE0402, 0x0DC44402, 0x0DBE4402, 0x0DC44402, 0x0DBE8402, 0x0DC44402, 0x0DBEC402,
+		0x0DC44402, 0x0DBF0402, 0x0DC44402, 0x0DBF4402, 0x0DC44402, 0x0DBF8402, 0x0DC44402, 0x0DBFC402,
+		0x0DC44402, 0x0DC00402, 0x0DC44402, 0x0DC04402, 0x0DC44402, 0x0DC08402, 0x0DC44402, 0x0DC0C402,
+		0x0DC44402, 0x0DC10402, 0x0DC44402, 0x0DC14402, 0x0DC44402, 0x0DC18402, 0x0DC44402, 0x0DC1C402,
+		0x0DC44402, 0x0DC20402, 0x0DC44402, 0x0DC24402, 0x0DC44402, 0x0DB78402, 0x0DC50402, 0x0DB7C402,
+		0x0DC50402, 0x0DB80402, 0x0DC50402, 0x0DB84402, 0x0DC50402, 0x0DB88402, 0x0DC50402, 0x0DB8C402,
+		0x0DC50402, 0x0DB90402, 0x0DC50402, 0x0DB94402, 0x0DC50402, 0x0DB98402, 0x0DC50402, 0x0DB9C402,
+		0x0DC50402, 0x0DBA0402, 0x0DC50402, 0x0DBA4402, 0x0DC50402, 0x0DBA8402, 0x0DC50402, 0x0DBAC402,
+		0x0DC50402, 0x0DBB0402, 0x0DC50402, 0x0DBB4402, 0x0DC50402, 0x0DBB8402, 0x0DC50402, 0x0DBBC402,
+		0x0DC50402, 0x0DBC0402, 0x0DC50402, 0x0DBC4402, 0x0DC50402, 0x0DBC8402, 0x0DC50402, 0x0DBCC402,
+		0x0DC50402, 0x0DBD0402, 0x0DC50402, 0x0DBD4402, 0x0DC50402, 0x0DBD8402, 0x0DC50402, 0x0DBDC402,
+		0x0DC50402, 0x0DBE0402, 0x0DC50402, 0x0DBE4402, 0x0DC50402, 0x0DBE8402, 0x0DC50402, 0x0DBEC402,
+		0x0DC50402, 0x0DBF0402, 0x0DC50402, 0x0DBF4402, 0x0DC50402, 0x0DBF8402, 0x0DC50402, 0x0DBFC402,
+		0x0DC50402, 0x0DC00402, 0x0DC50402, 0x0DC04402, 0x0DC50402, 0x0DC08402, 0x0DC50402, 0x0DC0C402,
+		0x0DC50402, 0x0DC10402, 0x0DC50402, 0x0DC14402, 0x0DC50402, 0x0DC18402, 0x0DC50402, 0x0DC1C402,
+		0x0DC50402, 0x0DC20402, 0x0DC50402, 0x0DC24402, 0x0DC50402, 0x0DEDC402, 0x0DEE4402, 0x0DEEC402,
+		0x0DEF4402, 0x0DEFC402, 0x0DF0C402, 0x0DFC8402, 0x0DFD0402, 0x0DFDC402, 0x0DFE0402, 0x0DFE8402,
+		0x0CA58402, 0x0CB2C402, 0x0CA5C402, 0x0CB2C402, 0x0CA60402, 0x0CB2C402, 0x0CA64402, 0x0CB2C402,
+		0x0CA68402, 0x0CB2C402, 0x0CA6C402, 0x0CB2C402, 0x0CA70402, 0x0CB2C402, 0x0CA74402, 0x0CB2C402,
+		0x0CA78402, 0x0CB2C402, 0x0CA7C402, 0x0CB2C402, 0x0CA80402, 0x0CB2C402, 0x0CA84402, 0x0CB2C402,
+		0x0CA88402, 0x0CB2C402, 0x0CA8C402, 0x0CB2C402, 0x0CA90402, 0x0CB2C402, 0x0CA94402, 0x0CB2C402,
+		0x0CA98402, 0x0CB2C402, 0x0CA9C402, 0x0CB2C402, 0x0CAA0402, 0x0CB2C402, 0x0CAA4402, 0x0CB2C402,
+		0x0CAA8402, 0x0CB2C402, 0x0CAAC402, 0x0CB2C402, 0x0CAB0402, 0x0CB2C402, 0x0CAB4402, 0x0CB2C402,
+		0x0CAB8402, 0x0CB2C402, 0x0CABC402, 0x0CB2C402, 0x0CAC0402, 0x0CB2C402, 0x0CAC4402, 0x0CB2C402,
+		0x0CAC8402, 0x0CB2C402, 0x0CACC402, 0x0CB2C402, 0x0CAD0402, 0x0CB2C402, 0x0CAD4402, 0x0CB2C402,
+		0x0CAD8402, 0x0CB2C402, 0x0CADC402, 0x0CB2C402, 0x0CAE0402, 0x0CB2C402, 0x0CAE4402, 0x0CB2C402,
+		0x0CAE8402, 0x0CB2C402, 0x0CAEC402, 0x0CB2C402, 0x0CAF0402, 0x0CB2C402, 0x0CAF4402, 0x0CB2C402,
+		0x0CAF8402, 0x0CB2C402, 0x0CAFC402, 0x0CB2C402, 0x0CB00402, 0x0CB2C402, 0x0CB04402, 0x0CB2C402,
+		0x0CB08402, 0x0CB2C402, 0x0CB0C402, 0x0CB2C402, 0x0CB10402, 0x0CB2C402, 0x0CB14402, 0x0CB2C402,
+		0x0CA58402, 0x0CB30402, 0x0CA5C402, 0x0CB30402, 0x0CA60402, 0x0CB30402, 0x0CA64402, 0x0CB30402,
+		0x0CA68402, 0x0CB30402, 0x0CA6C402, 0x0CB30402, 0x0CA70402, 0x0CB30402, 0x0CA74402, 0x0CB30402,
+		0x0CA78402, 0x0CB30402, 0x0CA7C402, 0x0CB30402, 0x0CA80402, 0x0CB30402, 0x0CA84402, 0x0CB30402,
+		0x0CA88402, 0x0CB30402, 0x0CA8C402, 0x0CB30402, 0x0CA90402, 0x0CB30402, 0x0CA94402, 0x0CB30402,
+		0x0CA98402, 0x0CB30402, 0x0CA9C402, 0x0CB30402, 0x0CAA0402, 0x0CB30402, 0x0CAA4402, 0x0CB30402,
+		0x0CAA8402, 0x0CB30402, 0x0CAAC402, 0x0CB30402, 0x0CAB0402, 0x0CB30402, 0x0CAB4402, 0x0CB30402,
+		0x0CAB8402, 0x0CB30402, 0x0CABC402, 0x0CB30402, 0x0CAC0402, 0x0CB30402, 0x0CAC4402, 0x0CB30402,
+		0x0CAC8402, 0x0CB30402, 0x0CACC402, 0x0CB30402, 0x0CAD0402, 0x0CB30402, 0x0CAD4402, 0x0CB30402,
+		0x0CAD8402, 0x0CB30402, 0x0CADC402, 0x0CB30402, 0x0CAE0402, 0x0CB30402, 0x0CAE4402, 0x0CB30402,
+		0x0CAE8402, 0x0CB30402, 0x0CAEC402, 0x0CB30402, 0x0CAF0402, 0x0CB30402, 0x0CAF4402, 0x0CB30402,
+		0x0CAF8402, 0x0CB30402, 0x0CAFC402, 0x0CB30402, 0x0CB00402, 0x0CB30402, 0x0CB04402, 0x0CB30402,
+		0x0CB08402, 0x0CB30402, 0x0CB0C402, 0x0CB30402, 0x0CB10402, 0x0CB30402, 0x0CB14402, 0x0CB30402,
+		0x0CA58402, 0x0CB3C402, 0x0CA5C402, 0x0CB3C402, 0x0CA60402, 0x0CB3C402, 0x0CA64402, 0x0CB3C402,
+		0x0CA68402, 0x0CB3C402, 0x0CA6C402, 0x0CB3C402, 0x0CA70402, 0x0CB3C402, 0x0CA74402, 0x0CB3C402,
+		0x0CA78402, 0x0CB3C402, 0x0CA7C402, 0x0CB3C402, 0x0CA80402, 0x0CB3C402, 0x0CA84402, 0x0CB3C402,
+		0x0CA88402, 0x0CB3C402, 0x0CA8C402, 0x0CB3C402, 0x0CA90402, 0x0CB3C402, 0x0CA94402, 0x0CB3C402,
+		0x0CA98402, 0x0CB3C402, 0x0CA9C402, 0x0CB3C402, 0x0CAA0402, 0x0CB3C402, 0x0CAA4402, 0x0CB3C402,
+		0x0CAA8402, 0x0CB3C402, 0x0CAAC402, 0x0CB3C402, 0x0CAB0402, 0x0CB3C402, 0x0CAB4402, 0x0CB3C402,
+		0x0CAB8402, 0x0CB3C402, 0x0CABC402, 0x0CB3C402, 0x0CAC0402, 0x0CB3C402, 0x0CAC4402, 0x0CB3C402,
+		0x0CAC8402, 0x0CB3C402, 0x0CACC402, 0x0CB3C402, 0x0CAD0402, 0x0CB3C402, 0x0CAD4402, 0x0CB3C402,
+		0x0CAD8402, 0x0CB3C402, 0x0CADC402, 0x0CB3C402, 0x0CAE0402, 0x0CB3C402, 0x0CAE4402, 0x0CB3C402,
+		0x0CAE8402, 0x0CB3C402, 0x0CAEC402, 0x0CB3C402, 0x0CAF0402, 0x0CB3C402, 0x0CAF4402, 0x0CB3C402,
+		0x0CAF8402, 0x0CB3C402, 0x0CAFC402, 0x0CB3C402, 0x0CB00402, 0x0CB3C402, 0x0CB04402, 0x0CB3C402,
+		0x0CB08402, 0x0CB3C402, 0x0CB0C402, 0x0CB3C402, 0x0CB10402, 0x0CB3C402, 0x0CB14402, 0x0CB3C402,
+		0x0CA58402, 0x0CB44402, 0x0CA5C402, 0x0CB44402, 0x0CA60402, 0x0CB44402, 0x0CA64402, 0x0CB44402,
+		0x0CA68402, 0x0CB44402, 0x0CA6C402, 0x0CB44402, 0x0CA70402, 0x0CB44402, 0x0CA74402, 0x0CB44402,
+		0x0CA78402, 0x0CB44402, 0x0CA7C402, 0x0CB44402, 0x0CA80402, 0x0CB44402, 0x0CA84402, 0x0CB44402,
+		0x0CA88402, 0x0CB44402, 0x0CA8C402, 0x0CB44402, 0x0CA90402, 0x0CB44402, 0x0CA94402, 0x0CB44402,
+		0x0CA98402, 0x0CB44402, 0x0CA9C402, 0x0CB44402, 0x0CAA0402, 0x0CB44402, 0x0CAA4402, 0x0CB44402,
+		0x0CAA8402, 0x0CB44402, 0x0CAAC402, 0x0CB44402, 0x0CAB0402, 0x0CB44402, 0x0CAB4402, 0x0CB44402,
+		0x0CAB8402, 0x0CB44402, 0x0CABC402, 0x0CB44402, 0x0CAC0402, 0x0CB44402, 0x0CAC4402, 0x0CB44402,
+		0x0CAC8402, 0x0CB44402, 0x0CACC402, 0x0CB44402, 0x0CAD0402, 0x0CB44402, 0x0CAD4402, 0x0CB44402,
+		0x0CAD8402, 0x0CB44402, 0x0CADC402, 0x0CB44402, 0x0CAE0402, 0x0CB44402, 0x0CAE4402, 0x0CB44402,
+		0x0CAE8402, 0x0CB44402, 0x0CAEC402, 0x0CB44402, 0x0CAF0402, 0x0CB44402, 0x0CAF4402, 0x0CB44402,
+		0x0CAF8402, 0x0CB44402, 0x0CAFC402, 0x0CB44402, 0x0CB00402, 0x0CB44402, 0x0CB04402, 0x0CB44402,
+		0x0CB08402, 0x0CB44402, 0x0CB0C402, 0x0CB44402, 0x0CB10402, 0x0CB44402, 0x0CB14402, 0x0CB44402,
+		0x0CA58402, 0x0CB48402, 0x0CA5C402, 0x0CB48402, 0x0CA60402, 0x0CB48402, 0x0CA64402, 0x0CB48402,
+		0x0CA68402, 0x0CB48402, 0x0CA6C402, 0x0CB48402, 0x0CA70402, 0x0CB48402, 0x0CA74402, 0x0CB48402,
+		0x0CA78402, 0x0CB48402, 0x0CA7C402, 0x0CB48402, 0x0CA80402, 0x0CB48402, 0x0CA84402, 0x0CB48402,
+		0x0CA88402, 0x0CB48402, 0x0CA8C402, 0x0CB48402, 0x0CA90402, 0x0CB48402, 0x0CA94402, 0x0CB48402,
+		0x0CA98402, 0x0CB48402, 0x0CA9C402, 0x0CB48402, 0x0CAA0402, 0x0CB48402, 0x0CAA4402, 0x0CB48402,
+		0x0CAA8402, 0x0CB48402, 0x0CAAC402, 0x0CB48402, 0x0CAB0402, 0x0CB48402, 0x0CAB4402, 0x0CB48402,
+		0x0CAB8402, 0x0CB48402, 0x0CABC402, 0x0CB48402, 0x0CAC0402, 0x0CB48402, 0x0CAC4402, 0x0CB48402,
+		0x0CAC8402, 0x0CB48402, 0x0CACC402, 0x0CB48402, 0x0CAD0402, 0x0CB48402, 0x0CAD4402, 0x0CB48402,
+		0x0CAD8402, 0x0CB48402, 0x0CADC402, 0x0CB48402, 0x0CAE0402, 0x0CB48402, 0x0CAE4402, 0x0CB48402,
+		0x0CAE8402, 0x0CB48402, 0x0CAEC402, 0x0CB48402, 0x0CAF0402, 0x0CB48402, 0x0CAF4402, 0x0CB48402,
+		0x0CAF8402, 0x0CB48402, 0x0CAFC402, 0x0CB48402, 0x0CB00402, 0x0CB48402, 0x0CB04402, 0x0CB48402,
+		0x0CB08402, 0x0CB48402, 0x0CB0C402, 0x0CB48402, 0x0CB10402, 0x0CB48402, 0x0CB14402, 0x0CB48402,
+		0x0D9B0402, 0x0D9B4402, 0x0BAD4402, 0x0BAD8402, 0x0BD0C402, 0x0BD08402, 0x0BD14402, 0x0BDFC402,
+		0x0BE00402, 0x0C0B0402,
+	};
+
+	/// The contractions, sorted by sequence.
+	inline static constexpr contraction CONTRACTIONS[933] = {
+		{{0x004C, 0x00B7, 0x0000}, 4874, 2},
+		{{0x006C, 0x00B7, 0x0000}, 4876, 2},
+		{{0x0418, 0x0306, 0x0000}, 4878, 1},
+		{{0x0438, 0x0306, 0x0000}, 4879, 1},
+		{{0x0627, 0x0653, 0x0000}, 4880, 1},
+		{{0x0627, 0x0654, 0x0000}, 4881, 1},
+		{{0x0627, 0x0655, 0x0000}, 4882, 1},
+		{{0x0648, 0x0654, 0x0000}, 4883, 1},
+		{{0x064A, 0x0654, 0x0000}, 4884, 1},
+		{{0x09C7, 0x09BE, 0x0000}, 4885, 1},
+		{{0x09C7, 0x09D7, 0x0000}, 4886, 1},
+		{{0x0B47, 0x0B3E, 0x0000}, 4887, 1},
+		{{0x0B47, 0x0B56, 0x0000}, 4888, 1},
+		{{0x0B47, 0x0B57, 0x0000}, 4889, 1},
+		{{0x0B92, 0x0BD7, 0x0000}, 4890, 1},
+		{{0x0BC6, 0x0BBE, 0x0000}, 4891, 1},
+		{{0x0BC6, 0x0BD7, 0x0000}, 4892, 1},
+		{{0x0BC7, 0x0BBE, 0x0000}, 4893, 1},
+		{{0x0C46, 0x0C56, 0x0000}, 4894, 1},
+		{{0x0CBF, 0x0CD5, 0x0000}, 4895, 1},
+		{{0x0CC6, 0x0CC2, 0x0000}, 4896, 1},
+		{{0x0CC6, 0x0CC2, 0x0CD5}, 4897, 1},
+		{{0x0CC6, 0x0CD5, 0x0000}, 4898, 1},
+		{{0x0CC6, 0x0CD6, 0x0000}, 4899, 1},
+		{{0x0D46, 0x0D3E, 0x0000}, 4900, 1},
+		{{0x0D46, 0x0D57, 0x0000}, 4901, 1},
+		{{0x0D47, 0x0D3E, 0x0000}, 4902, 1},
+		{{0x0DD9, 0x0DCA, 0x0000}, 4903, 1},
+		{{0x0DD9, 0x0DCF, 0x0000}, 4904, 1},
+		{{0x0DD9, 0x0DCF, 0x0DCA}, 4905, 1},
+		{{0x0DD9, 0x0DDF, 0x0000}, 4906, 1},
+		{{0x0E40, 0x0E01, 0x0000}, 4907, 2},
+		{{0x0E40, 0x0E02, 0x0000}, 4909, 2},
+		{{0x0E40, 0x0E03, 0x0000}, 4911, 2},
+		{{0x0E40, 0x0E04, 0x0000}, 4913, 2},
+		{{0x0E40, 0x0E05, 0x0000}, 4915, 2},
+		{{0x0E40, 0x0E06, 0x0000}, 4917, 2},
+		{{0x0E40, 0x0E07, 0x0000}, 4919, 2},
+		{{0x0E40, 0x0E08, 0x0000}, 4921, 2},
+		{{0x0E40, 0x0E09, 0x0000}, 4923, 2},
+		{{0x0E40, 0x0E0A, 0x0000}, 4925, 2},
+		{{0x0E40, 0x0E0B, 0x0000}, 4927, 2},
+		{{0x0E40, 0x0E0C, 0x0000}, 4929, 2},
+		{{0x0E40, 0x0E0D, 0x0000}, 4931, 2},
+		{{0x0E40, 0x0E0E, 0x0000}, 4933, 2},
+		{{0x0E40, 0x0E0F, 0x0000}, 4935, 2},
+		{{0x0E40, 0x0E10, 0x0000}, 4937, 2},
+		{{0x0E40, 0x0E11, 0x0000}, 4939, 2},
+		{{0x0E40, 0x0E12, 0x0000}, 4941, 2},
+		{{0x0E40, 0x0E13, 0x0000}, 4943, 2},
+		{{0x0E40, 0x0E14, 0x0000}, 4945, 2},
+		{{0x0E40, 0x0E15, 0x0000}, 4947, 2},
+		{{0x0E40, 0x0E16, 0x0000}, 4949, 2},
+		{{0x0E40, 0x0E17, 0x0000}, 4951, 2},
+		{{0x0E40, 0x0E18, 0x0000}, 4953, 2},
+		{{0x0E40, 0x0E19, 0x0000}, 4955, 2},
+		{{0x0E40, 0x0E1A, 0x0000}, 4957, 2},
+		{{0x0E40, 0x0E1B, 0x0000}, 4959, 2},
+		{{0x0E40, 0x0E1C, 0x0000}, 4961, 2},
+		{{0x0E40, 0x0E1D, 0x0000}, 4963, 2},
+		{{0x0E40, 0x0E1E, 0x0000}, 4965, 2},
+		{{0x0E40, 0x0E1F, 0x0000}, 4967, 2},
+		{{0x0E40, 0x0E20, 0x0000}, 4969, 2},
+		{{0x0E40, 0x0E21, 0x0000}, 4971, 2},
+		{{0x0E40, 0x0E22, 0x0000}, 4973, 2},
+		{{0x0E40, 0x0E23, 0x0000}, 4975, 2},
+		{{0x0E40, 0x0E24, 0x0000}, 4977, 2},
+		{{0x0E40, 0x0E25, 0x0000}, 4979, 2},
+		{{0x0E40, 0x0E26, 0x0000}, 4981, 2},
+		{{0x0E40, 0x0E27, 0x0000}, 4983, 2},
+		{{0x0E40, 0x0E28, 0x0000}, 4985, 2},
+		{{0x0E40, 0x0E29, 0x0000}, 4987, 2},
+		{{0x0E40, 0x0E2A, 0x0000}, 4989, 2},
+		{{0x0E40, 0x0E2B, 0x0000}, 4991, 2},
+		{{0x0E40, 0x0E2C, 0x0000}, 4993, 2},
+		{{0x0E40, 0x0E2D, 0x0000}, 4995, 2},
+		{{0x0E40, 0x0E2E, 0x0000}, 4997, 2},
+		{{0x0E41, 0x0E01, 0x0000}, 4999, 2},
+		{{0x0E41, 0x0E02, 0x0000}, 5001, 2},
+		{{0x0E41, 0x0E03, 0x0000}, 5003, 2},
+		{{0x0E41, 0x0E04, 0x0000}, 5005, 2},
+		{{0x0E41, 0x0E05, 0x0000}, 5007, 2},
+		{{0x0E41, 0x0E06, 0x0000}, 5009, 2},
+		{{0x0E41, 0x0E07, 0x0000}, 5011, 2},
+		{{0x0E41, 0x0E08, 0x0000}, 5013, 2},
+		{{0x0E41, 0x0E09, 0x0000}, 5015, 2},
+		{{0x0E41, 0x0E0A, 0x0000}, 5017, 2},
+		{{0x0E41, 0x0E0B, 0x0000}, 5019, 2},
+		{{0x0E41, 0x0E0C, 0x0000}, 5021, 2},
+		{{0x0E41, 0x0E0D, 0x0000}, 5023, 2},
+		{{0x0E41, 0x0E0E, 0x0000}, 5025, 2},
+		{{0x0E41, 0x0E0F, 0x0000}, 5027, 2},
+		{{0x0E41, 0x0E10, 0x0000}, 5029, 2},
+		{{0x0E41, 0x0E11, 0x0000}, 5031, 2},
+		{{0x0E41, 0x0E12, 0x0000}, 5033, 2},
+		{{0x0E41, 0x0E13, 0x0000}, 5035, 2},
+		{{0x0E41, 0x0E14, 0x0000}, 5037, 2},
+		{{0x0E41, 0x0E15, 0x0000}, 5039, 2},
+		{{0x0E41, 0x0E16, 0x0000}, 5041, 2},
+		{{0x0E41, 0x0E17, 0x0000}, 5043, 2},
+		{{0x0E41, 0x0E18, 0x0000}, 5045, 2},
+		{{0x0E41, 0x0E19, 0x0000}, 5047, 2},
+		{{0x0E41, 0x0E1A, 0x0000}, 5049, 2},
+		{{0x0E41, 0x0E1B, 0x0000}, 5051, 2},
+		{{0x0E41, 0x0E1C, 0x0000}, 5053, 2},
+		{{0x0E41, 0x0E1D, 0x0000}, 5055, 2},
+		{{0x0E41, 0x0E1E, 0x0000}, 5057, 2},
+		{{0x0E41, 0x0E1F, 0x0000}, 5059, 2},
+		{{0x0E41, 0x0E20, 0x0000}, 5061, 2},
+		{{0x0E41, 0x0E21, 0x0000}, 5063, 2},
+		{{0x0E41, 0x0E22, 0x0000}, 5065, 2},
+		{{0x0E41, 0x0E23, 0x0000}, 5067, 2},
+		{{0x0E41, 0x0E24, 0x0000}, 5069, 2},
+		{{0x0E41, 0x0E25, 0x0000}, 5071, 2},
+		{{0x0E41, 0x0E26, 0x0000}, 5073, 2},
+		{{0x0E41, 0x0E27, 0x0000}, 5075, 2},
+		{{0x0E41, 0x0E28, 0x0000}, 5077, 2},
+		{{0x0E41, 0x0E29, 0x0000}, 5079, 2},
+		{{0x0E41, 0x0E2A, 0x0000}, 5081, 2},
+		{{0x0E41, 0x0E2B, 0x0000}, 5083, 2},
+		{{0x0E41, 0x0E2C, 0x0000}, 5085, 2},
+		{{0x0E41, 0x0E2D, 0x0000}, 5087, 2},
+		{{0x0E41, 0x0E2E, 0x0000}, 5089, 2},
+		{{0x0E42, 0x0E01, 0x0000}, 5091, 2},
+		{{0x0E42, 0x0E02, 0x0000}, 5093, 2},
+		{{0x0E42, 0x0E03, 0x0000}, 5095, 2},
+		{{0x0E42, 0x0E04, 0x0000}, 5097, 2},
+		{{0x0E42, 0x0E05, 0x0000}, 5099, 2},
+		{{0x0E42, 0x0E06, 0x0000}, 5101, 2},
+		{{0x0E42, 0x0E07, 0x0000}, 5103, 2},
+		{{0x0E42, 0x0E08, 0x0000}, 5105, 2},
+		{{0x0E42, 0x0E09, 0x0000}, 5107, 2},
+		{{0x0E42, 0x0E0A, 0x0000}, 5109, 2},
+		{{0x0E42, 0x0E0B, 0x0000}, 5111, 2},
+		{{0x0E42, 0x0E0C, 0x0000}, 5113, 2},
+		{{0x0E42, 0x0E0D, 0x0000}, 5115, 2},
+		{{0x0E42, 0x0E0E, 0x0000}, 5117, 2},
+		{{0x0E42, 0x0E0F, 0x0000}, 5119, 2},
+		{{0x0E42, 0x0E10, 0x0000}, 5121, 2},
+		{{0x0E42, 0x0E11, 0x0000}, 5123, 2},
+		{{0x0E42, 0x0E12, 0x0000}, 5125, 2},
+		{{0x0E42, 0x0E13, 0x0000}, 5127, 2},
+		{{0x0E42, 0x0E14, 0x0000}, 5129, 2},
+		{{0x0E42, 0x0E15, 0x0000}, 5131, 2},
+		{{0x0E42, 0x0E16, 0x0000}, 5133, 2},
+		{{0x0E42, 0x0E17, 0x0000}, 5135, 2},
+		{{0x0E42, 0x0E18, 0x0000}, 5137, 2},
+		{{0x0E42, 0x0E19, 0x0000}, 5139, 2},
+		{{0x0E42, 0x0E1A, 0x0000}, 5141, 2},
+		{{0x0E42, 0x0E1B, 0x0000}, 5143, 2},
+		{{0x0E42, 0x0E1C, 0x0000}, 5145, 2},
+		{{0x0E42, 0x0E1D, 0x0000}, 5147, 2},
+		{{0x0E42, 0x0E1E, 0x0000}, 5149, 2},
+		{{0x0E42, 0x0E1F, 0x0000}, 5151, 2},
+		{{0x0E42, 0x0E20, 0x0000}, 5153, 2},
+		{{0x0E42, 0x0E21, 0x0000}, 5155, 2},
+		{{0x0E42, 0x0E22, 0x0000}, 5157, 2},
+		{{0x0E42, 0x0E23, 0x0000}, 5159, 2},
+		{{0x0E42, 0x0E24, 0x0000}, 5161, 2},
+		{{0x0E42, 0x0E25, 0x0000}, 5163, 2},
+		{{0x0E42, 0x0E26, 0x0000}, 5165, 2},
+		{{0x0E42, 0x0E27, 0x0000}, 5167, 2},
+		{{0x0E42, 0x0E28, 0x0000}, 5169, 2},
+		{{0x0E42, 0x0E29, 0x0000}, 5171, 2},
+		{{0x0E42, 0x0E2A, 0x0000}, 5173, 2},
+		{{0x0E42, 0x0E2B, 0x0000}, 5175, 2},
+		{{0x0E42, 0x0E2C, 0x0000}, 5177, 2},
+		{{0x0E42, 0x0E2D, 0x0000}, 5179, 2},
+		{{0x0E42, 0x0E2E, 0x0000}, 5181, 2},
+		{{0x0E43, 0x0E01, 0x0000}, 5183, 2},
+		{{0x0E43, 0x0E02, 0x0000}, 5185, 2},
+		{{0x0E43, 0x0E03, 0x0000}, 5187, 2},
+		{{0x0E43, 0x0E04, 0x0000}, 5189, 2},
+		{{0x0E43, 0x0E05, 0x0000}, 5191, 2},
+		{{0x0E43, 0x0E06, 0x0000}, 5193, 2},
+		{{0x0E43, 0x0E07, 0x0000}, 5195, 2},
+		{{0x0E43, 0x0E08, 0x0000}, 5197, 2},
+		{{0x0E43, 0x0E09, 0x0000}, 5199, 2},
+		{{0x0E43, 0x0E0A, 0x0000}, 5201, 2},
+		{{0x0E43, 0x0E0B, 0x0000}, 5203, 2},
+		{{0x0E43, 0x0E0C, 0x0000}, 5205, 2},
+		{{0x0E43, 0x0E0D, 0x0000}, 5207, 2},
+		{{0x0E43, 0x0E0E, 0x0000}, 5209, 2},
+		{{0x0E43, 0x0E0F, 0x0000}, 5211, 2},
+		{{0x0E43, 0x0E10, 0x0000}, 5213, 2},
+		{{0x0E43, 0x0E11, 0x0000}, 5215, 2},
+		{{0x0E43, 0x0E12, 0x0000}, 5217, 2},
+		{{0x0E43, 0x0E13, 0x0000}, 5219, 2},
+		{{0x0E43, 0x0E14, 0x0000}, 5221, 2},
+		{{0x0E43, 0x0E15, 0x0000}, 5223, 2},
+		{{0x0E43, 0x0E16, 0x0000}, 5225, 2},
+		{{0x0E43, 0x0E17, 0x0000}, 5227, 2},
+		{{0x0E43, 0x0E18, 0x0000}, 5229, 2},
+		{{0x0E43, 0x0E19, 0x0000}, 5231, 2},
+		{{0x0E43, 0x0E1A, 0x0000}, 5233, 2},
+		{{0x0E43, 0x0E1B, 0x0000}, 5235, 2},
+		{{0x0E43, 0x0E1C, 0x0000}, 5237, 2},
+		{{0x0E43, 0x0E1D, 0x0000}, 5239, 2},
+		{{0x0E43, 0x0E1E, 0x0000}, 5241, 2},
+		{{0x0E43, 0x0E1F, 0x0000}, 5243, 2},
+		{{0x0E43, 0x0E20, 0x0000}, 5245, 2},
+		{{0x0E43, 0x0E21, 0x0000}, 5247, 2},
+		{{0x0E43, 0x0E22, 0x0000}, 5249, 2},
+		{{0x0E43, 0x0E23, 0x0000}, 5251, 2},
+		{{0x0E43, 0x0E24, 0x0000}, 5253, 2},
+		{{0x0E43, 0x0E25, 0x0000}, 5255, 2},
+		{{0x0E43, 0x0E26, 0x0000}, 5257, 2},
+		{{0x0E43, 0x0E27, 0x0000}, 5259, 2},
+		{{0x0E43, 0x0E28, 0x0000}, 5261, 2},
+		{{0x0E43, 0x0E29, 0x0000}, 5263, 2},
+		{{0x0E43, 0x0E2A, 0x0000}, 5265, 2},
+		{{0x0E43, 0x0E2B, 0x0000}, 5267, 2},
+		{{0x0E43, 0x0E2C, 0x0000}, 5269, 2},
+		{{0x0E43, 0x0E2D, 0x0000}, 5271, 2},
+		{{0x0E43, 0x0E2E, 0x0000}, 5273, 2},
+		{{0x0E44, 0x0E01, 0x0000}, 5275, 2},
+		{{0x0E44, 0x0E02, 0x0000}, 5277, 2},
+		{{0x0E44, 0x0E03, 0x0000}, 5279, 2},
+		{{0x0E44, 0x0E04, 0x0000}, 5281, 2},
+		{{0x0E44, 0x0E05, 0x0000}, 5283, 2},
+		{{0x0E44, 0x0E06, 0x0000}, 5285, 2},
+		{{0x0E44, 0x0E07, 0x0000}, 5287, 2},
+		{{0x0E44, 0x0E08, 0x0000}, 5289, 2},
+		{{0x0E44, 0x0E09, 0x0000}, 5291, 2},
+		{{0x0E44, 0x0E0A, 0x0000}, 5293, 2},
+		{{0x0E44, 0x0E0B, 0x0000}, 5295, 2},
+		{{0x0E44, 0x0E0C, 0x0000}, 5297, 2},
+		{{0x0E44, 0x0E0D, 0x0000}, 5299, 2},
+		{{0x0E44, 0x0E0E, 0x0000}, 5301, 2},
+		{{0x0E44, 0x0E0F, 0x0000}, 5303, 2},
+		{{0x0E44, 0x0E10, 0x0000}, 5305, 2},
+		{{0x0E44, 0x0E11, 0x0000}, 5307, 2},
+		{{0x0E44, 0x0E12, 0x0000}, 5309, 2},
+		{{0x0E44, 0x0E13, 0x0000}, 5311, 2},
+		{{0x0E44, 0x0E14, 0x0000}, 5313, 2},
+		{{0x0E44, 0x0E15, 0x0000}, 5315, 2},
+		{{0x0E44, 0x0E16, 0x0000}, 5317, 2},
+		{{0x0E44, 0x0E17, 0x0000}, 5319, 2},
+		{{0x0E44, 0x0E18, 0x0000}, 5321, 2},
+		{{0x0E44, 0x0E19, 0x0000}, 5323, 2},
+		{{0x0E44, 0x0E1A, 0x0000}, 5325, 2},
+		{{0x0E44, 0x0E1B, 0x0000}, 5327, 2},
+		{{0x0E44, 0x0E1C, 0x0000}, 5329, 2},
+		{{0x0E44, 0x0E1D, 0x0000}, 5331, 2},
+		{{0x0E44, 0x0E1E, 0x0000}, 5333, 2},
+		{{0x0E44, 0x0E1F, 0x0000}, 5335, 2},
+		{{0x0E44, 0x0E20, 0x0000}, 5337, 2},
+		{{0x0E44, 0x0E21, 0x0000}, 5339, 2},
+		{{0x0E44, 0x0E22, 0x0000}, 5341, 2},
+		{{0x0E44, 0x0E23, 0x0000}, 5343, 2},
+		{{0x0E44, 0x0E24, 0x0000}, 5345, 2},
+		{{0x0E44, 0x0E25, 0x0000}, 5347, 2},
+		{{0x0E44, 0x0E26, 0x0000}, 5349, 2},
+		{{0x0E44, 0x0E27, 0x0000}, 5351, 2},
+		{{0x0E44, 0x0E28, 0x0000}, 5353, 2},
+		{{0x0E44, 0x0E29, 0x0000}, 5355, 2},
+		{{0x0E44, 0x0E2A, 0x0000}, 5357, 2},
+		{{0x0E44, 0x0E2B, 0x0000}, 5359, 2},
+		{{0x0E44, 0x0E2C, 0x0000}, 5361, 2},
+		{{0x0E44, 0x0E2D, 0x0000}, 5363, 2},
+		{{0x0E44, 0x0E2E, 0x0000}, 5365, 2},
+		{{0x0E4D, 0x0E32, 0x0000}, 5367, 1},
+		{{0x0EC0, 0x0E81, 0x0000}, 5368, 2},
+		{{0x0EC0, 0x0E82, 0x0000}, 5370, 2},
+		{{0x0EC0, 0x0E84, 0x0000}, 5372, 2},
+		{{0x0EC0, 0x0E86, 0x0000}, 5374, 2},
+		{{0x0EC0, 0x0E87, 0x0000}, 5376, 2},
+		{{0x0EC0, 0x0E88, 0x0000}, 5378, 2},
+		{{0x0EC0, 0x0E89, 0x0000}, 5380, 2},
+		{{0x0EC0, 0x0E8A, 0x0000}, 5382, 2},
+		{{0x0EC0, 0x0E8C, 0x0000}, 5384, 2},
+		{{0x0EC0, 0x0E8D, 0x0000}, 5386, 2},
+		{{0x0EC0, 0x0E8E, 0x0000}, 5388, 2},
+		{{0x0EC0, 0x0E8F, 0x0000}, 5390, 2},
+		{{0x0EC0, 0x0E90, 0x0000}, 5392, 2},
+		{{0x0EC0, 0x0E91, 0x0000}, 5394, 2},
+		{{0x0EC0, 0x0E92, 0x0000}, 5396, 2},
+		{{0x0EC0, 0x0E93, 0x0000}, 5398, 2},
+		{{0x0EC0, 0x0E94, 0x0000}, 5400, 2},
+		{{0x0EC0, 0x0E95, 0x0000}, 5402, 2},
+		{{0x0EC0, 0x0E96, 0x0000}, 5404, 2},
+		{{0x0EC0, 0x0E97, 0x0000}, 5406, 2},
+		{{0x0EC0, 0x0E98, 0x0000}, 5408, 2},
+		{{0x0EC0, 0x0E99, 0x0000}, 5410, 2},
+		{{0x0EC0, 0x0E9A, 0x0000}, 5412, 2},
+		{{0x0EC0, 0x0E9B, 0x0000}, 5414, 2},
+		{{0x0EC0, 0x0E9C, 0x0000}, 5416, 2},
+		{{0x0EC0, 0x0E9D, 0x0000}, 5418, 2},
+		{{0x0EC0, 0x0E9E, 0x0000}, 5420, 2},
+		{{0x0EC0, 0x0E9F, 0x0000}, 5422, 2},
+		{{0x0EC0, 0x0EA0, 0x0000}, 5424, 2},
+		{{0x0EC0, 0x0EA1, 0x0000}, 5426, 2},
+		{{0x0EC0, 0x0EA2, 0x0000}, 5428, 2},
+		{{0x0EC0, 0x0EA3, 0x0000}, 5430, 2},
+		{{0x0EC0, 0x0EA5, 0x0000}, 5432, 2},
+		{{0x0EC0, 0x0EA7, 0x0000}, 5434, 2},
+		{{0x0EC0, 0x0EA8, 0x0000}, 5436, 2},
+		{{0x0EC0, 0x0EA9, 0x0000}, 5438, 2},
+		{{0x0EC0, 0x0EAA, 0x0000}, 5440, 2},
+		{{0x0EC0, 0x0EAB, 0x0000}, 5442, 2},
+		{{0x0EC0, 0x0EAC, 0x0000}, 5444, 2},
+		{{0x0EC0, 0x0EAD, 0x0000}, 5446, 2},
+		{{0x0EC0, 0x0EAE, 0x0000}, 5448, 2},
+		{{0x0EC0, 0x0EDC, 0x0000}, 5450, 3},
+		{{0x0EC0, 0x0EDD, 0x0000}, 5453, 3},
+		{{0x0EC0, 0x0EDE, 0x0000}, 5456, 2},
+		{{0x0EC0, 0x0EDF, 0x0000}, 5458, 2},
+		{{0x0EC1, 0x0E81, 0x0000}, 5460, 2},
+		{{0x0EC1, 0x0E82, 0x0000}, 5462, 2},
+		{{0x0EC1, 0x0E84, 0x0000}, 5464, 2},
+		{{0x0EC1, 0x0E86, 0x0000}, 5466, 2},
+		{{0x0EC1, 0x0E87, 0x0000}, 5468, 2},
+		{{0x0EC1, 0x0E88, 0x0000}, 5470, 2},
+		{{0x0EC1, 0x0E89, 0x0000}, 5472, 2},
+		{{0x0EC1, 0x0E8A, 0x0000}, 5474, 2},
+		{{0x0EC1, 0x0E8C, 0x0000}, 5476, 2},
+		{{0x0EC1, 0x0E8D, 0x0000}, 5478, 2},
+		{{0x0EC1, 0x0E8E, 0x0000}, 5480, 2},
+		{{0x0EC1, 0x0E8F, 0x0000}, 5482, 2},
+		{{0x0EC1, 0x0E90, 0x0000}, 5484, 2},
+		{{0x0EC1, 0x0E91, 0x0000}, 5486, 2},
+		{{0x0EC1, 0x0E92, 0x0000}, 5488, 2},
+		{{0x0EC1, 0x0E93, 0x0000}, 5490, 2},
+		{{0x0EC1, 0x0E94, 0x0000}, 5492, 2},
+		{{0x0EC1, 0x0E95, 0x0000}, 5494, 2},
+		{{0x0EC1, 0x0E96, 0x0000}, 5496, 2},
+		{{0x0EC1, 0x0E97, 0x0000}, 5498, 2},
+		{{0x0EC1, 0x0E98, 0x0000}, 5500, 2},
+		{{0x0EC1, 0x0E99, 0x0000}, 5502, 2},
+		{{0x0EC1, 0x0E9A, 0x0000}, 5504, 2},
+		{{0x0EC1, 0x0E9B, 0x0000}, 5506, 2},
+		{{0x0EC1, 0x0E9C, 0x0000}, 5508, 2},
+		{{0x0EC1, 0x0E9D, 0x0000}, 5510, 2},
+		{{0x0EC1, 0x0E9E, 0x0000}, 5512, 2},
+		{{0x0EC1, 0x0E9F, 0x0000}, 5514, 2},
+		{{0x0EC1, 0x0EA0, 0x0000}, 5516, 2},
+		{{0x0EC1, 0x0EA1, 0x0000}, 5518, 2},
+		{{0x0EC1, 0x0EA2, 0x0000}, 5520, 2},
+		{{0x0EC1, 0x0EA3, 0x0000}, 5522, 2},
+		{{0x0EC1, 0x0EA5, 0x0000}, 5524, 2},
+		{{0x0EC1, 0x0EA7, 0x0000}, 5526, 2},
+		{{0x0EC1, 0x0EA8, 0x0000}, 5528, 2},
+		{{0x0EC1, 0x0EA9, 0x0000}, 5530, 2},
+		{{0x0EC1, 0x0EAA, 0x0000}, 5532, 2},
+		{{0x0EC1, 0x0EAB, 0x0000}, 5534, 2},
+		{{0x0EC1, 0x0EAC, 0x0000}, 5536, 2},
+		{{0x0EC1, 0x0EAD, 0x0000}, 5538, 2},
+		{{0x0EC1, 0x0EAE, 0x0000}, 5540, 2},
+		{{0x0EC1, 0x0EDC, 0x0000}, 5542, 3},
+		{{0x0EC1, 0x0EDD, 0x0000}, 5545, 3},
+		{{0x0EC1, 0x0EDE, 0x0000}, 5548, 2},
+		{{0x0EC1, 0x0EDF, 0x0000}, 5550, 2},
+		{{0x0EC2, 0x0E81, 0x0000}, 5552, 2},
+		{{0x0EC2, 0x0E82, 0x0000}, 5554, 2},
+		{{0x0EC2, 0x0E84, 0x0000}, 5556, 2},
+		{{0x0EC2, 0x0E86, 0x0000}, 5558, 2},
+		{{0x0EC2, 0x0E87, 0x0000}, 5560, 2},
+		{{0x0EC2, 0x0E88, 0x0000}, 5562, 2},
+		{{0x0EC2, 0x0E89, 0x0000}, 5564, 2},
+		{{0x0EC2, 0x0E8A, 0x0000}, 5566, 2},
+		{{0x0EC2, 0x0E8C, 0x0000}, 5568, 2},
+		{{0x0EC2, 0x0E8D, 0x0000}, 5570, 2},
+		{{0x0EC2, 0x0E8E, 0x0000}, 5572, 2},
+		{{0x0EC2, 0x0E8F, 0x0000}, 5574, 2},
+		{{0x0EC2, 0x0E90, 0x0000}, 5576, 2},
+		{{0x0EC2, 0x0E91, 0x0000}, 5578, 2},
+		{{0x0EC2, 0x0E92, 0x0000}, 5580, 2},
+		{{0x0EC2, 0x0E93, 0x0000}, 5582, 2},
+		{{0x0EC2, 0x0E94, 0x0000}, 5584, 2},
+		{{0x0EC2, 0x0E95, 0x0000}, 5586, 2},
+		{{0x0EC2, 0x0E96, 0x0000}, 5588, 2},
+		{{0x0EC2, 0x0E97, 0x0000}, 5590, 2},
+		{{0x0EC2, 0x0E98, 0x0000}, 5592, 2},
+		{{0x0EC2, 0x0E99, 0x0000}, 5594, 2},
+		{{0x0EC2, 0x0E9A, 0x0000}, 5596, 2},
+		{{0x0EC2, 0x0E9B, 0x0000}, 5598, 2},
+		{{0x0EC2, 0x0E9C, 0x0000}, 5600, 2},
+		{{0x0EC2, 0x0E9D, 0x0000}, 5602, 2},
+		{{0x0EC2, 0x0E9E, 0x0000}, 5604, 2},
+		{{0x0EC2, 0x0E9F, 0x0000}, 5606, 2},
+		{{0x0EC2, 0x0EA0, 0x0000}, 5608, 2},
+		{{0x0EC2, 0x0EA1, 0x0000}, 5610, 2},
+		{{0x0EC2, 0x0EA2, 0x0000}, 5612, 2},
+		{{0x0EC2, 0x0EA3, 0x0000}, 5614, 2},
+		{{0x0EC2, 0x0EA5, 0x0000}, 5616, 2},
+		{{0x0EC2, 0x0EA7, 0x0000}, 5618, 2},
+		{{0x0EC2, 0x0EA8, 0x0000}, 5620, 2},
+		{{0x0EC2, 0x0EA9, 0x0000}, 5622, 2},
+		{{0x0EC2, 0x0EAA, 0x0000}, 5624, 2},
+		{{0x0EC2, 0x0EAB, 0x0000}, 5626, 2},
+		{{0x0EC2, 0x0EAC, 0x0000}, 5628, 2},
+		{{0x0EC2, 0x0EAD, 0x0000}, 5630, 2},
+		{{0x0EC2, 0x0EAE, 0x0000}, 5632, 2},
+		{{0x0EC2, 0x0EDC, 0x0000}, 5634, 3},
+		{{0x0EC2, 0x0EDD, 0x0000}, 5637, 3},
+		{{0x0EC2, 0x0EDE, 0x0000}, 5640, 2},
+		{{0x0EC2, 0x0EDF, 0x0000}, 5642, 2},
+		{{0x0EC3, 0x0E81, 0x0000}, 5644, 2},
+		{{0x0EC3, 0x0E82, 0x0000}, 5646, 2},
+		{{0x0EC3, 0x0E84, 0x0000}, 5648, 2},
+		{{0x0EC3, 0x0E86, 0x0000}, 5650, 2},
+		{{0x0EC3, 0x0E87, 0x0000}, 5652, 2},
+		{{0x0EC3, 0x0E88, 0x0000}, 5654, 2},
+		{{0x0EC3, 0x0E89, 0x0000}, 5656, 2},
+		{{0x0EC3, 0x0E8A, 0x0000}, 5658, 2},
+		{{0x0EC3, 0x0E8C, 0x0000}, 5660, 2},
+		{{0x0EC3, 0x0E8D, 0x0000}, 5662, 2},
+		{{0x0EC3, 0x0E8E, 0x0000}, 5664, 2},
+		{{0x0EC3, 0x0E8F, 0x0000}, 5666, 2},
+		{{0x0EC3, 0x0E90, 0x0000}, 5668, 2},
+		{{0x0EC3, 0x0E91, 0x0000}, 5670, 2},
+		{{0x0EC3, 0x0E92, 0x0000}, 5672, 2},
+		{{0x0EC3, 0x0E93, 0x0000}, 5674, 2},
+		{{0x0EC3, 0x0E94, 0x0000}, 5676, 2},
+		{{0x0EC3, 0x0E95, 0x0000}, 5678, 2},
+		{{0x0EC3, 0x0E96, 0x0000}, 5680, 2},
+		{{0x0EC3, 0x0E97, 0x0000}, 5682, 2},
+		{{0x0EC3, 0x0E98, 0x0000}, 5684, 2},
+		{{0x0EC3, 0x0E99, 0x0000}, 5686, 2},
+		{{0x0EC3, 0x0E9A, 0x0000}, 5688, 2},
+		{{0x0EC3, 0x0E9B, 0x0000}, 5690, 2},
+		{{0x0EC3, 0x0E9C, 0x0000}, 5692, 2},
+		{{0x0EC3, 0x0E9D, 0x0000}, 5694, 2},
+		{{0x0EC3, 0x0E9E, 0x0000}, 5696, 2},
+		{{0x0EC3, 0x0E9F, 0x0000}, 5698, 2},
+		{{0x0EC3, 0x0EA0, 0x0000}, 5700, 2},
+		{{0x0EC3, 0x0EA1, 0x0000}, 5702, 2},
+		{{0x0EC3, 0x0EA2, 0x0000}, 5704, 2},
+		{{0x0EC3, 0x0EA3, 0x0000}, 5706, 2},
+		{{0x0EC3, 0x0EA5, 0x0000}, 5708, 2},
+		{{0x0EC3, 0x0EA7, 0x0000}, 5710, 2},
+		{{0x0EC3, 0x0EA8, 0x0000}, 5712, 2},
+		{{0x0EC3, 0x0EA9, 0x0000}, 5714, 2},
+		{{0x0EC3, 0x0EAA, 0x0000}, 5716, 2},
+		{{0x0EC3, 0x0EAB, 0x0000}, 5718, 2},
+		{{0x0EC3, 0x0EAC, 0x0000}, 5720, 2},
+		{{0x0EC3, 0x0EAD, 0x0000}, 5722, 2},
+		{{0x0EC3, 0x0EAE, 0x0000}, 5724, 2},
+		{{0x0EC3, 0x0EDC, 0x0000}, 5726, 3},
+		{{0x0EC3, 0x0EDD, 0x0000}, 5729, 3},
+		{{0x0EC3, 0x0EDE, 0x0000}, 5732, 2},
+		{{0x0EC3, 0x0EDF, 0x0000}, 5734, 2},
+		{{0x0EC4, 0x0E81, 0x0000}, 5736, 2},
+		{{0x0EC4, 0x0E82, 0x0000}, 5738, 2},
+		{{0x0EC4, 0x0E84, 0x0000}, 5740, 2},
+		{{0x0EC4, 0x0E86, 0x0000}, 5742, 2},
+		{{0x0EC4, 0x0E87, 0x0000}, 5744, 2},
+		{{0x0EC4, 0x0E88, 0x0000}, 5746, 2},
+		{{0x0EC4, 0x0E89, 0x0000}, 5748, 2},
+		{{0x0EC4, 0x0E8A, 0x0000}, 5750, 2},
+		{{0x0EC4, 0x0E8C, 0x0000}, 5752, 2},
+		{{0x0EC4, 0x0E8D, 0x0000}, 5754, 2},
+		{{0x0EC4, 0x0E8E, 0x0000}, 5756, 2},
+		{{0x0EC4, 0x0E8F, 0x0000}, 5758, 2},
+		{{0x0EC4, 0x0E90, 0x0000}, 5760, 2},
+		{{0x0EC4, 0x0E91, 0x0000}, 5762, 2},
+		{{0x0EC4, 0x0E92, 0x0000}, 5764, 2},
+		{{0x0EC4, 0x0E93, 0x0000}, 5766, 2},
+		{{0x0EC4, 0x0E94, 0x0000}, 5768, 2},
+		{{0x0EC4, 0x0E95, 0x0000}, 5770, 2},
+		{{0x0EC4, 0x0E96, 0x0000}, 5772, 2},
+		{{0x0EC4, 0x0E97, 0x0000}, 5774, 2},
+		{{0x0EC4, 0x0E98, 0x0000}, 5776, 2},
+		{{0x0EC4, 0x0E99, 0x0000}, 5778, 2},
+		{{0x0EC4, 0x0E9A, 0x0000}, 5780, 2},
+		{{0x0EC4, 0x0E9B, 0x0000}, 5782, 2},
+		{{0x0EC4, 0x0E9C, 0x0000}, 5784, 2},
+		{{0x0EC4, 0x0E9D, 0x0000}, 5786, 2},
+		{{0x0EC4, 0x0E9E, 0x0000}, 5788, 2},
+		{{0x0EC4, 0x0E9F, 0x0000}, 5790, 2},
+		{{0x0EC4, 0x0EA0, 0x0000}, 5792, 2},
+		{{0x0EC4, 0x0EA1, 0x0000}, 5794, 2},
+		{{0x0EC4, 0x0EA2, 0x0000}, 5796, 2},
+		{{0x0EC4, 0x0EA3, 0x0000}, 5798, 2},
+		{{0x0EC4, 0x0EA5, 0x0000}, 5800, 2},
+		{{0x0EC4, 0x0EA7, 0x0000}, 5802, 2},
+		{{0x0EC4, 0x0EA8, 0x0000}, 5804, 2},
+		{{0x0EC4, 0x0EA9, 0x0000}, 5806, 2},
+		{{0x0EC4, 0x0EAA, 0x0000}, 5808, 2},
+		{{0x0EC4, 0x0EAB, 0x0000}, 5810, 2},
+		{{0x0EC4, 0x0EAC, 0x0000}, 5812, 2},
+		{{0x0EC4, 0x0EAD, 0x0000}, 5814, 2},
+		{{0x0EC4, 0x0EAE, 0x0000}, 5816, 2},
+		{{0x0EC4, 0x0EDC, 0x0000}, 5818, 3},
+		{{0x0EC4, 0x0EDD, 0x0000}, 5821, 3},
+		{{0x0EC4, 0x0EDE, 0x0000}, 5824, 2},
+		{{0x0EC4, 0x0EDF, 0x0000}, 5826, 2},
+		{{0x0ECD, 0x0EB2, 0x0000}, 5828, 1},
+		{{0x0F71, 0x0F72, 0x0000}, 5829, 1},
+		{{0x0F71, 0x0F74, 0x0000}, 5830, 1},
+		{{0x0F71, 0x0F80, 0x0000}, 5831, 1},
+		{{0x0FB2, 0x0F71, 0x0F80}, 5832, 1},
+		{{0x0FB2, 0x0F80, 0x0000}, 5833, 1},
+		{{0x0FB3, 0x0F71, 0x0F80}, 5834, 1},
+		{{0x0FB3, 0x0F80, 0x0000}, 5835, 1},
+		{{0x1025, 0x102E, 0x0000}, 5836, 1},
+		{{0x19B5, 0x1980, 0x0000}, 5837, 2},
+		{{0x19B5, 0x1981, 0x0000}, 5839, 2},
+		{{0x19B5, 0x1982, 0x0000}, 5841, 2},
+		{{0x19B5, 0x1983, 0x0000}, 5843, 2},
+		{{0x19B5, 0x1984, 0x0000}, 5845, 2},
+		{{0x19B5, 0x1985, 0x0000}, 5847, 2},
+		{{0x19B5, 0x1986, 0x0000}, 5849, 2},
+		{{0x19B5, 0x1987, 0x0000}, 5851, 2},
+		{{0x19B5, 0x1988, 0x0000}, 5853, 2},
+		{{0x19B5, 0x1989, 0x0000}, 5855, 2},
+		{{0x19B5, 0x198A, 0x0000}, 5857, 2},
+		{{0x19B5, 0x198B, 0x0000}, 5859, 2},
+		{{0x19B5, 0x198C, 0x0000}, 5861, 2},
+		{{0x19B5, 0x198D, 0x0000}, 5863, 2},
+		{{0x19B5, 0x198E, 0x0000}, 5865, 2},
+		{{0x19B5, 0x198F, 0x0000}, 5867, 2},
+		{{0x19B5, 0x1990, 0x0000}, 5869, 2},
+		{{0x19B5, 0x1991, 0x0000}, 5871, 2},
+		{{0x19B5, 0x1992, 0x0000}, 5873, 2},
+		{{0x19B5, 0x1993, 0x0000}, 5875, 2},
+		{{0x19B5, 0x1994, 0x0000}, 5877, 2},
+		{{0x19B5, 0x1995, 0x0000}, 5879, 2},
+		{{0x19B5, 0x1996, 0x0000}, 5881, 2},
+		{{0x19B5, 0x1997, 0x0000}, 5883, 2},
+		{{0x19B5, 0x1998, 0x0000}, 5885, 2},
+		{{0x19B5, 0x1999, 0x0000}, 5887, 2},
+		{{0x19B5, 0x199A, 0x0000}, 5889, 2},
+		{{0x19B5, 0x199B, 0x0000}, 5891, 2},
+		{{0x19B5, 0x199C, 0x0000}, 5893, 2},
+		{{0x19B5, 0x199D, 0x0000}, 5895, 2},
+		{{0x19B5, 0x199E, 0x0000}, 5897, 2},
+		{{0x19B5, 0x199F, 0x0000}, 5899, 2},
+		{{0x19B5, 0x19A0, 0x0000}, 5901, 2},
+		{{0x19B5, 0x19A1, 0x0000}, 5903, 2},
+		{{0x19B5, 0x19A2, 0x0000}, 5905, 2},
+		{{0x19B5, 0x19A3, 0x0000}, 5907, 2},
+		{{0x19B5, 0x19A4, 0x0000}, 5909, 2},
+		{{0x19B5, 0x19A5, 0x0000}, 5911, 2},
+		{{0x19B5, 0x19A6, 0x0000}, 5913, 2},
+		{{0x19B5, 0x19A7, 0x0000}, 5915, 2},
+		{{0x19B5, 0x19A8, 0x0000}, 5917, 2},
+		{{0x19B5, 0x19A9, 0x0000}, 5919, 2},
+		{{0x19B5, 0x19AA, 0x0000}, 5921, 2},
+		{{0x19B5, 0x19AB, 0x0000}, 5923, 2},
+		{{0x19B6, 0x1980, 0x0000}, 5925, 2},
+		{{0x19B6, 0x1981, 0x0000}, 5927, 2},
+		{{0x19B6, 0x1982, 0x0000}, 5929, 2},
+		{{0x19B6, 0x1983, 0x0000}, 5931, 2},
+		{{0x19B6, 0x1984, 0x0000}, 5933, 2},
+		{{0x19B6, 0x1985, 0x0000}, 5935, 2},
+		{{0x19B6, 0x1986, 0x0000}, 5937, 2},
+		{{0x19B6, 0x1987, 0x0000}, 5939, 2},
+		{{0x19B6, 0x1988, 0x0000}, 5941, 2},
+		{{0x19B6, 0x1989, 0x0000}, 5943, 2},
+		{{0x19B6, 0x198A, 0x0000}, 5945, 2},
+		{{0x19B6, 0x198B, 0x0000}, 5947, 2},
+		{{0x19B6, 0x198C, 0x0000}, 5949, 2},
+		{{0x19B6, 0x198D, 0x0000}, 5951, 2},
+		{{0x19B6, 0x198E, 0x0000}, 5953, 2},
+		{{0x19B6, 0x198F, 0x0000}, 5955, 2},
+		{{0x19B6, 0x1990, 0x0000}, 5957, 2},
+		{{0x19B6, 0x1991, 0x0000}, 5959, 2},
+		{{0x19B6, 0x1992, 0x0000}, 5961, 2},
+		{{0x19B6, 0x1993, 0x0000}, 5963, 2},
+		{{0x19B6, 0x1994, 0x0000}, 5965, 2},
+		{{0x19B6, 0x1995, 0x0000}, 5967, 2},
+		{{0x19B6, 0x1996, 0x0000}, 5969, 2},
+		{{0x19B6, 0x1997, 0x0000}, 5971, 2},
+		{{0x19B6, 0x1998, 0x0000}, 5973, 2},
+		{{0x19B6, 0x1999, 0x0000}, 5975, 2},
+		{{0x19B6, 0x199A, 0x0000}, 5977, 2},
+		{{0x19B6, 0x199B, 0x0000}, 5979, 2},
+		{{0x19B6, 0x199C, 0x0000}, 5981, 2},
+		{{0x19B6, 0x199D, 0x0000}, 5983, 2},
+		{{0x19B6, 0x199E, 0x0000}, 5985, 2},
+		{{0x19B6, 0x199F, 0x0000}, 5987, 2},
+		{{0x19B6, 0x19A0, 0x0000}, 5989, 2},
+		{{0x19B6, 0x19A1, 0x0000}, 5991, 2},
+		{{0x19B6, 0x19A2, 0x0000}, 5993, 2},
+		{{0x19B6, 0x19A3, 0x0000}, 5995, 2},
+		{{0x19B6, 0x19A4, 0x0000}, 5997, 2},
+		{{0x19B6, 0x19A5, 0x0000}, 5999, 2},
+		{{0x19B6, 0x19A6, 0x0000}, 6001, 2},
+		{{0x19B6, 0x19A7, 0x0000}, 6003, 2},
+		{{0x19B6, 0x19A8, 0x0000}, 6005, 2},
+		{{0x19B6, 0x19A9, 0x0000}, 6007, 2},
+		{{0x19B6, 0x19AA, 0x0000}, 6009, 2},
+		{{0x19B6, 0x19AB, 0x0000}, 6011, 2},
+		{{0x19B7, 0x1980, 0x0000}, 6013, 2},
+		{{0x19B7, 0x1981, 0x0000}, 6015, 2},
+		{{0x19B7, 0x1982, 0x0000}, 6017, 2},
+		{{0x19B7, 0x1983, 0x0000}, 6019, 2},
+		{{0x19B7, 0x1984, 0x0000}, 6021, 2},
+		{{0x19B7, 0x1985, 0x0000}, 6023, 2},
+		{{0x19B7, 0x1986, 0x0000}, 6025, 2},
+		{{0x19B7, 0x1987, 0x0000}, 6027, 2},
+		{{0x19B7, 0x1988, 0x0000}, 6029, 2},
+		{{0x19B7, 0x1989, 0x0000}, 6031, 2},
+		{{0x19B7, 0x198A, 0x0000}, 6033, 2},
+		{{0x19B7, 0x198B, 0x0000}, 6035, 2},
+		{{0x19B7, 0x198C, 0x0000}, 6037, 2},
+		{{0x19B7, 0x198D, 0x0000}, 6039, 2},
+		{{0x19B7, 0x198E, 0x0000}, 6041, 2},
+		{{0x19B7, 0x198F, 0x0000}, 6043, 2},
+		{{0x19B7, 0x1990, 0x0000}, 6045, 2},
+		{{0x19B7, 0x1991, 0x0000}, 6047, 2},
+		{{0x19B7, 0x1992, 0x0000}, 6049, 2},
+		{{0x19B7, 0x1993, 0x0000}, 6051, 2},
+		{{0x19B7, 0x1994, 0x0000}, 6053, 2},
+		{{0x19B7, 0x1995, 0x0000}, 6055, 2},
+		{{0x19B7, 0x1996, 0x0000}, 6057, 2},
+		{{0x19B7, 0x1997, 0x0000}, 6059, 2},
+		{{0x19B7, 0x1998, 0x0000}, 6061, 2},
+		{{0x19B7, 0x1999, 0x0000}, 6063, 2},
+		{{0x19B7, 0x199A, 0x0000}, 6065, 2},
+		{{0x19B7, 0x199B, 0x0000}, 6067, 2},
+		{{0x19B7, 0x199C, 0x0000}, 6069, 2},
+		{{0x19B7, 0x199D, 0x0000}, 6071, 2},
+		{{0x19B7, 0x199E, 0x0000}, 6073, 2},
+		{{0x19B7, 0x199F, 0x0000}, 6075, 2},
+		{{0x19B7, 0x19A0, 0x0000}, 6077, 2},
+		{{0x19B7, 0x19A1, 0x0000}, 6079, 2},
+		{{0x19B7, 0x19A2, 0x0000}, 6081, 2},
+		{{0x19B7, 0x19A3, 0x0000}, 6083, 2},
+		{{0x19B7, 0x19A4, 0x0000}, 6085, 2},
+		{{0x19B7, 0x19A5, 0x0000}, 6087, 2},
+		{{0x19B7, 0x19A6, 0x0000}, 6089, 2},
+		{{0x19B7, 0x19A7, 0x0000}, 6091, 2},
+		{{0x19B7, 0x19A8, 0x0000}, 6093, 2},
+		{{0x19B7, 0x19A9, 0x0000}, 6095, 2},
+		{{0x19B7, 0x19AA, 0x0000}, 6097, 2},
+		{{0x19B7, 0x19AB, 0x0000}, 6099, 2},
+		{{0x19BA, 0x1980, 0x0000}, 6101, 2},
+		{{0x19BA, 0x1981, 0x0000}, 6103, 2},
+		{{0x19BA, 0x1982, 0x0000}, 6105, 2},
+		{{0x19BA, 0x1983, 0x0000}, 6107, 2},
+		{{0x19BA, 0x1984, 0x0000}, 6109, 2},
+		{{0x19BA, 0x1985, 0x0000}, 6111, 2},
+		{{0x19BA, 0x1986, 0x0000}, 6113, 2},
+		{{0x19BA, 0x1987, 0x0000}, 6115, 2},
+		{{0x19BA, 0x1988, 0x0000}, 6117, 2},
+		{{0x19BA, 0x1989, 0x0000}, 6119, 2},
+		{{0x19BA, 0x198A, 0x0000}, 6121, 2},
+		{{0x19BA, 0x198B, 0x0000}, 6123, 2},
+		{{0x19BA, 0x198C, 0x0000}, 6125, 2},
+		{{0x19BA, 0x198D, 0x0000}, 6127, 2},
+		{{0x19BA, 0x198E, 0x0000}, 6129, 2},
+		{{0x19BA, 0x198F, 0x0000}, 6131, 2},
+		{{0x19BA, 0x1990, 0x0000}, 6133, 2},
+		{{0x19BA, 0x1991, 0x0000}, 6135, 2},
+		{{0x19BA, 0x1992, 0x0000}, 6137, 2},
+		{{0x19BA, 0x1993, 0x0000}, 6139, 2},
+		{{0x19BA, 0x1994, 0x0000}, 6141, 2},
+		{{0x19BA, 0x1995, 0x0000}, 6143, 2},
+		{{0x19BA, 0x1996, 0x0000}, 6145, 2},
+		{{0x19BA, 0x1997, 0x0000}, 6147, 2},
+		{{0x19BA, 0x1998, 0x0000}, 6149, 2},
+		{{0x19BA, 0x1999, 0x0000}, 6151, 2},
+		{{0x19BA, 0x199A, 0x0000}, 6153, 2},
+		{{0x19BA, 0x199B, 0x0000}, 6155, 2},
+		{{0x19BA, 0x199C, 0x0000}, 6157, 2},
+		{{0x19BA, 0x199D, 0x0000}, 6159, 2},
+		{{0x19BA, 0x199E, 0x0000}, 6161, 2},
+		{{0x19BA, 0x199F, 0x0000}, 6163, 2},
+		{{0x19BA, 0x19A0, 0x0000}, 6165, 2},
+		{{0x19BA, 0x19A1, 0x0000}, 6167, 2},
+		{{0x19BA, 0x19A2, 0x0000}, 6169, 2},
+		{{0x19BA, 0x19A3, 0x0000}, 6171, 2},
+		{{0x19BA, 0x19A4, 0x0000}, 6173, 2},
+		{{0x19BA, 0x19A5, 0x0000}, 6175, 2},
+		{{0x19BA, 0x19A6, 0x0000}, 6177, 2},
+		{{0x19BA, 0x19A7, 0x0000}, 6179, 2},
+		{{0x19BA, 0x19A8, 0x0000}, 6181, 2},
+		{{0x19BA, 0x19A9, 0x0000}, 6183, 2},
+		{{0x19BA, 0x19AA, 0x0000}, 6185, 2},
+		{{0x19BA, 0x19AB, 0x0000}, 6187, 2},
+		{{0x1B05, 0x1B35, 0x0000}, 6189, 1},
+		{{0x1B07, 0x1B35, 0x0000}, 6190, 1},
+		{{0x1B09, 0x1B35, 0x0000}, 6191, 1},
+		{{0x1B0B, 0x1B35, 0x0000}, 6192, 1},
+		{{0x1B0D, 0x1B35, 0x0000}, 6193, 1},
+		{{0x1B11, 0x1B35, 0x0000}, 6194, 1},
+		{{0x1B3A, 0x1B35, 0x0000}, 6195, 1},
+		{{0x1B3C, 0x1B35, 0x0000}, 6196, 1},
+		{{0x1B3E, 0x1B35, 0x0000}, 6197, 1},
+		{{0x1B3F, 0x1B35, 0x0000}, 6198, 1},
+		{{0x1B42, 0x1B35, 0x0000}, 6199, 1},
+		{{0xAAB5, 0xAA80, 0x0000}, 6200, 2},
+		{{0xAAB5, 0xAA81, 0x0000}, 6202, 2},
+		{{0xAAB5, 0xAA82, 0x0000}, 6204, 2},
+		{{0xAAB5, 0xAA83, 0x0000}, 6206, 2},
+		{{0xAAB5, 0xAA84, 0x0000}, 6208, 2},
+		{{0xAAB5, 0xAA85, 0x0000}, 6210, 2},
+		{{0xAAB5, 0xAA86, 0x0000}, 6212, 2},
+		{{0xAAB5, 0xAA87, 0x0000}, 6214, 2},
+		{{0xAAB5, 0xAA88, 0x0000}, 6216, 2},
+		{{0xAAB5, 0xAA89, 0x0000}, 6218, 2},
+		{{0xAAB5, 0xAA8A, 0x0000}, 6220, 2},
+		{{0xAAB5, 0xAA8B, 0x0000}, 6222, 2},
+		{{0xAAB5, 0xAA8C, 0x0000}, 6224, 2},
+		{{0xAAB5, 0xAA8D, 0x0000}, 6226, 2},
+		{{0xAAB5, 0xAA8E, 0x0000}, 6228, 2},
+		{{0xAAB5, 0xAA8F, 0x0000}, 6230, 2},
+		{{0xAAB5, 0xAA90, 0x0000}, 6232, 2},
+		{{0xAAB5, 0xAA91, 0x0000}, 6234, 2},
+		{{0xAAB5, 0xAA92, 0x0000}, 6236, 2},
+		{{0xAAB5, 0xAA93, 0x0000}, 6238, 2},
+		{{0xAAB5, 0xAA94, 0x0000}, 6240, 2},
+		{{0xAAB5, 0xAA95, 0x0000}, 6242, 2},
+		{{0xAAB5, 0xAA96, 0x0000}, 6244, 2},
+		{{0xAAB5, 0xAA97, 0x0000}, 6246, 2},
+		{{0xAAB5, 0xAA98, 0x0000}, 6248, 2},
+		{{0xAAB5, 0xAA99, 0x0000}, 6250, 2},
+		{{0xAAB5, 0xAA9A, 0x0000}, 6252, 2},
+		{{0xAAB5, 0xAA9B, 0x0000}, 6254, 2},
+		{{0xAAB5, 0xAA9C, 0x0000}, 6256, 2},
+		{{0xAAB5, 0xAA9D, 0x0000}, 6258, 2},
+		{{0xAAB5, 0xAA9E, 0x0000}, 6260, 2},
+		{{0xAAB5, 0xAA9F, 0x0000}, 6262, 2},
+		{{0xAAB5, 0xAAA0, 0x0000}, 6264, 2},
+		{{0xAAB5, 0xAAA1, 0x0000}, 6266, 2},
+		{{0xAAB5, 0xAAA2, 0x0000}, 6268, 2},
+		{{0xAAB5, 0xAAA3, 0x0000}, 6270, 2},
+		{{0xAAB5, 0xAAA4, 0x0000}, 6272, 2},
+		{{0xAAB5, 0xAAA5, 0x0000}, 6274, 2},
+		{{0xAAB5, 0xAAA6, 0x0000}, 6276, 2},
+		{{0xAAB5, 0xAAA7, 0x0000}, 6278, 2},
+		{{0xAAB5, 0xAAA8, 0x0000}, 6280, 2},
+		{{0xAAB5, 0xAAA9, 0x0000}, 6282, 2},
+		{{0xAAB5, 0xAAAA, 0x0000}, 6284, 2},
+		{{0xAAB5, 0xAAAB, 0x0000}, 6286, 2},
+		{{0xAAB5, 0xAAAC, 0x0000}, 6288, 2},
+		{{0xAAB5, 0xAAAD, 0x0000}, 6290, 2},
+		{{0xAAB5, 0xAAAE, 0x0000}, 6292, 2},
+		{{0xAAB5, 0xAAAF, 0x0000}, 6294, 2},
+		{{0xAAB6, 0xAA80, 0x0000}, 6296, 2},
+		{{0xAAB6, 0xAA81, 0x0000}, 6298, 2},
+		{{0xAAB6, 0xAA82, 0x0000}, 6300, 2},
+		{{0xAAB6, 0xAA83, 0x0000}, 6302, 2},
+		{{0xAAB6, 0xAA84, 0x0000}, 6304, 2},
+		{{0xAAB6, 0xAA85, 0x0000}, 6306, 2},
+		{{0xAAB6, 0xAA86, 0x0000}, 6308, 2},
+		{{0xAAB6, 0xAA87, 0x0000}, 6310, 2},
+		{{0xAAB6, 0xAA88, 0x0000}, 6312, 2},
+		{{0xAAB6, 0xAA89, 0x0000}, 6314, 2},
+		{{0xAAB6, 0xAA8A, 0x0000}, 6316, 2},
+		{{0xAAB6, 0xAA8B, 0x0000}, 6318, 2},
+		{{0xAAB6, 0xAA8C, 0x0000}, 6320, 2},
+		{{0xAAB6, 0xAA8D, 0x0000}, 6322, 2},
+		{{0xAAB6, 0xAA8E, 0x0000}, 6324, 2},
+		{{0xAAB6, 0xAA8F, 0x0000}, 6326, 2},
+		{{0xAAB6, 0xAA90, 0x0000}, 6328, 2},
+		{{0xAAB6, 0xAA91, 0x0000}, 6330, 2},
+		{{0xAAB6, 0xAA92, 0x0000}, 6332, 2},
+		{{0xAAB6, 0xAA93, 0x0000}, 6334, 2},
+		{{0xAAB6, 0xAA94, 0x0000}, 6336, 2},
+		{{0xAAB6, 0xAA95, 0x0000}, 6338, 2},
+		{{0xAAB6, 0xAA96, 0x0000}, 6340, 2},
+		{{0xAAB6, 0xAA97, 0x0000}, 6342, 2},
+		{{0xAAB6, 0xAA98, 0x0000}, 6344, 2},
+		{{0xAAB6, 0xAA99, 0x0000}, 6346, 2},
+		{{0xAAB6, 0xAA9A, 0x0000}, 6348, 2},
+		{{0xAAB6, 0xAA9B, 0x0000}, 6350, 2},
+		{{0xAAB6, 0xAA9C, 0x0000}, 6352, 2},
+		{{0xAAB6, 0xAA9D, 0x0000}, 6354, 2},
+		{{0xAAB6, 0xAA9E, 0x0000}, 6356, 2},
+		{{0xAAB6, 0xAA9F, 0x0000}, 6358, 2},
+		{{0xAAB6, 0xAAA0, 0x0000}, 6360, 2},
+		{{0xAAB6, 0xAAA1, 0x0000}, 6362, 2},
+		{{0xAAB6, 0xAAA2, 0x0000}, 6364, 2},
+		{{0xAAB6, 0xAAA3, 0x0000}, 6366, 2},
+		{{0xAAB6, 0xAAA4, 0x0000}, 6368, 2},
+		{{0xAAB6, 0xAAA5, 0x0000}, 6370, 2},
+		{{0xAAB6, 0xAAA6, 0x0000}, 6372, 2},
+		{{0xAAB6, 0xAAA7, 0x0000}, 6374, 2},
+		{{0xAAB6, 0xAAA8, 0x0000}, 6376, 2},
+		{{0xAAB6, 0xAAA9, 0x0000}, 6378, 2},
+		{{0xAAB6, 0xAAAA, 0x0000}, 6380, 2},
+		{{0xAAB6, 0xAAAB, 0x0000}, 6382, 2},
+		{{0xAAB6, 0xAAAC, 0x0000}, 6384, 2},
+		{{0xAAB6, 0xAAAD, 0x0000}, 6386, 2},
+		{{0xAAB6, 0xAAAE, 0x0000}, 6388, 2},
+		{{0xAAB6, 0xAAAF, 0x0000}, 6390, 2},
+		{{0xAAB9, 0xAA80, 0x0000}, 6392, 2},
+		{{0xAAB9, 0xAA81, 0x0000}, 6394, 2},
+		{{0xAAB9, 0xAA82, 0x0000}, 6396, 2},
+		{{0xAAB9, 0xAA83, 0x0000}, 6398, 2},
+		{{0xAAB9, 0xAA84, 0x0000}, 6400, 2},
+		{{0xAAB9, 0xAA85, 0x0000}, 6402, 2},
+		{{0xAAB9, 0xAA86, 0x0000}, 6404, 2},
+		{{0xAAB9, 0xAA87, 0x0000}, 6406, 2},
+		{{0xAAB9, 0xAA88, 0x0000}, 6408, 2},
+		{{0xAAB9, 0xAA89, 0x0000}, 6410, 2},
+		{{0xAAB9, 0xAA8A, 0x0000}, 6412, 2},
+		{{0xAAB9, 0xAA8B, 0x0000}, 6414, 2},
+		{{0xAAB9, 0xAA8C, 0x0000}, 6416, 2},
+		{{0xAAB9, 0xAA8D, 0x0000}, 6418, 2},
+		{{0xAAB9, 0xAA8E, 0x0000}, 6420, 2},
+		{{0xAAB9, 0xAA8F, 0x0000}, 6422, 2},
+		{{0xAAB9, 0xAA90, 0x0000}, 6424, 2},
+		{{0xAAB9, 0xAA91, 0x0000}, 6426, 2},
+		{{0xAAB9, 0xAA92, 0x0000}, 6428, 2},
+		{{0xAAB9, 0xAA93, 0x0000}, 6430, 2},
+		{{0xAAB9, 0xAA94, 0x0000}, 6432, 2},
+		{{0xAAB9, 0xAA95, 0x0000}, 6434, 2},
+		{{0xAAB9, 0xAA96, 0x0000}, 6436, 2},
+		{{0xAAB9, 0xAA97, 0x0000}, 6438, 2},
+		{{0xAAB9, 0xAA98, 0x0000}, 6440, 2},
+		{{0xAAB9, 0xAA99, 0x0000}, 6442, 2},
+		{{0xAAB9, 0xAA9A, 0x0000}, 6444, 2},
+		{{0xAAB9, 0xAA9B, 0x0000}, 6446, 2},
+		{{0xAAB9, 0xAA9C, 0x0000}, 6448, 2},
+		{{0xAAB9, 0xAA9D, 0x0000}, 6450, 2},
+		{{0xAAB9, 0xAA9E, 0x0000}, 6452, 2},
+		{{0xAAB9, 0xAA9F, 0x0000}, 6454, 2},
+		{{0xAAB9, 0xAAA0, 0x0000}, 6456, 2},
+		{{0xAAB9, 0xAAA1, 0x0000}, 6458, 2},
+		{{0xAAB9, 0xAAA2, 0x0000}, 6460, 2},
+		{{0xAAB9, 0xAAA3, 0x0000}, 6462, 2},
+		{{0xAAB9, 0xAAA4, 0x0000}, 6464, 2},
+		{{0xAAB9, 0xAAA5, 0x0000}, 6466, 2},
+		{{0xAAB9, 0xAAA6, 0x0000}, 6468, 2},
+		{{0xAAB9, 0xAAA7, 0x0000}, 6470, 2},
+		{{0xAAB9, 0xAAA8, 0x0000}, 6472, 2},
+		{{0xAAB9, 0xAAA9, 0x0000}, 6474, 2},
+		{{0xAAB9, 0xAAAA, 0x0000}, 6476, 2},
+		{{0xAAB9, 0xAAAB, 0x0000}, 6478, 2},
+		{{0xAAB9, 0xAAAC, 0x0000}, 6480, 2},
+		{{0xAAB9, 0xAAAD, 0x0000}, 6482, 2},
+		{{0xAAB9, 0xAAAE, 0x0000}, 6484, 2},
+		{{0xAAB9, 0xAAAF, 0x0000}, 6486, 2},
+		{{0xAABB, 0xAA80, 0x0000}, 6488, 2},
+		{{0xAABB, 0xAA81, 0x0000}, 6490, 2},
+		{{0xAABB, 0xAA82, 0x0000}, 6492, 2},
+		{{0xAABB, 0xAA83, 0x0000}, 6494, 2},
+		{{0xAABB, 0xAA84, 0x0000}, 6496, 2},
+		{{0xAABB, 0xAA85, 0x0000}, 6498, 2},
+		{{0xAABB, 0xAA86, 0x0000}, 6500, 2},
+		{{0xAABB, 0xAA87, 0x0000}, 6502, 2},
+		{{0xAABB, 0xAA88, 0x0000}, 6504, 2},
+		{{0xAABB, 0xAA89, 0x0000}, 6506, 2},
+		{{0xAABB, 0xAA8A, 0x0000}, 6508, 2},
+		{{0xAABB, 0xAA8B, 0x0000}, 6510, 2},
+		{{0xAABB, 0xAA8C, 0x0000}, 6512, 2},
+		{{0xAABB, 0xAA8D, 0x0000}, 6514, 2},
+		{{0xAABB, 0xAA8E, 0x0000}, 6516, 2},
+		{{0xAABB, 0xAA8F, 0x0000}, 6518, 2},
+		{{0xAABB, 0xAA90, 0x0000}, 6520, 2},
+		{{0xAABB, 0xAA91, 0x0000}, 6522, 2},
+		{{0xAABB, 0xAA92, 0x0000}, 6524, 2},
+		{{0xAABB, 0xAA93, 0x0000}, 6526, 2},
+		{{0xAABB, 0xAA94, 0x0000}, 6528, 2},
+		{{0xAABB, 0xAA95, 0x0000}, 6530, 2},
+		{{0xAABB, 0xAA96, 0x0000}, 6532, 2},
+		{{0xAABB, 0xAA97, 0x0000}, 6534, 2},
+		{{0xAABB, 0xAA98, 0x0000}, 6536, 2},
+		{{0xAABB, 0xAA99, 0x0000}, 6538, 2},
+		{{0xAABB, 0xAA9A, 0x0000}, 6540, 2},
+		{{0xAABB, 0xAA9B, 0x0000}, 6542, 2},
+		{{0xAABB, 0xAA9C, 0x0000}, 6544, 2},
+		{{0xAABB, 0xAA9D, 0x0000}, 6546, 2},
+		{{0xAABB, 0xAA9E, 0x0000}, 6548, 2},
+		{{0xAABB, 0xAA9F, 0x0000}, 6550, 2},
+		{{0xAABB, 0xAAA0, 0x0000}, 6552, 2},
+		{{0xAABB, 0xAAA1, 0x0000}, 6554, 2},
+		{{0xAABB, 0xAAA2, 0x0000}, 6556, 2},
+		{{0xAABB, 0xAAA3, 0x0000}, 6558, 2},
+		{{0xAABB, 0xAAA4, 0x0000}, 6560, 2},
+		{{0xAABB, 0xAAA5, 0x0000}, 6562, 2},
+		{{0xAABB, 0xAAA6, 0x0000}, 6564, 2},
+		{{0xAABB, 0xAAA7, 0x0000}, 6566, 2},
+		{{0xAABB, 0xAAA8, 0x0000}, 6568, 2},
+		{{0xAABB, 0xAAA9, 0x0000}, 6570, 2},
+		{{0xAABB, 0xAAAA, 0x0000}, 6572, 2},
+		{{0xAABB, 0xAAAB, 0x0000}, 6574, 2},
+		{{0xAABB, 0xAAAC, 0x0000}, 6576, 2},
+		{{0xAABB, 0xAAAD, 0x0000}, 6578, 2},
+		{{0xAABB, 0xAAAE, 0x0000}, 6580, 2},
+		{{0xAABB, 0xAAAF, 0x0000}, 6582, 2},
+		{{0xAABC, 0xAA80, 0x0000}, 6584, 2},
+		{{0xAABC, 0xAA81, 0x0000}, 6586, 2},
+		{{0xAABC, 0xAA82, 0x0000}, 6588, 2},
+		{{0xAABC, 0xAA83, 0x0000}, 6590, 2},
+		{{0xAABC, 0xAA84, 0x0000}, 6592, 2},
+		{{0xAABC, 0xAA85, 0x0000}, 6594, 2},
+		{{0xAABC, 0xAA86, 0x0000}, 6596, 2},
+		{{0xAABC, 0xAA87, 0x0000}, 6598, 2},
+		{{0xAABC, 0xAA88, 0x0000}, 6600, 2},
+		{{0xAABC, 0xAA89, 0x0000}, 6602, 2},
+		{{0xAABC, 0xAA8A, 0x0000}, 6604, 2},
+		{{0xAABC, 0xAA8B, 0x0000}, 6606, 2},
+		{{0xAABC, 0xAA8C, 0x0000}, 6608, 2},
+		{{0xAABC, 0xAA8D, 0x0000}, 6610, 2},
+		{{0xAABC, 0xAA8E, 0x0000}, 6612, 2},
+		{{0xAABC, 0xAA8F, 0x0000}, 6614, 2},
+		{{0xAABC, 0xAA90, 0x0000}, 6616, 2},
+		{{0xAABC, 0xAA91, 0x0000}, 6618, 2},
+		{{0xAABC, 0xAA92, 0x0000}, 6620, 2},
+		{{0xAABC, 0xAA93, 0x0000}, 6622, 2},
+		{{0xAABC, 0xAA94, 0x0000}, 6624, 2},
+		{{0xAABC, 0xAA95, 0x0000}, 6626, 2},
+		{{0xAABC, 0xAA96, 0x0000}, 6628, 2},
+		{{0xAABC, 0xAA97, 0x0000}, 6630, 2},
+		{{0xAABC, 0xAA98, 0x0000}, 6632, 2},
+		{{0xAABC, 0xAA99, 0x0000}, 6634, 2},
+		{{0xAABC, 0xAA9A, 0x0000}, 6636, 2},
+		{{0xAABC, 0xAA9B, 0x0000}, 6638, 2},
+		{{0xAABC, 0xAA9C, 0x0000}, 6640, 2},
+		{{0xAABC, 0xAA9D, 0x0000}, 6642, 2},
+		{{0xAABC, 0xAA9E, 0x0000}, 6644, 2},
+		{{0xAABC, 0xAA9F, 0x0000}, 6646, 2},
+		{{0xAABC, 0xAAA0, 0x0000}, 6648, 2},
+		{{0xAABC, 0xAAA1, 0x0000}, 6650, 2},
+		{{0xAABC, 0xAAA2, 0x0000}, 6652, 2},
+		{{0xAABC, 0xAAA3, 0x0000}, 6654, 2},
+		{{0xAABC, 0xAAA4, 0x0000}, 6656, 2},
+		{{0xAABC, 0xAAA5, 0x0000}, 6658, 2},
+		{{0xAABC, 0xAAA6, 0x0000}, 6660, 2},
+		{{0xAABC, 0xAAA7, 0x0000}, 6662, 2},
+		{{0xAABC, 0xAAA8, 0x0000}, 6664, 2},
+		{{0xAABC, 0xAAA9, 0x0000}, 6666, 2},
+		{{0xAABC, 0xAAAA, 0x0000}, 6668, 2},
+		{{0xAABC, 0xAAAB, 0x0000}, 6670, 2},
+		{{0xAABC, 0xAAAC, 0x0000}, 6672, 2},
+		{{0xAABC, 0xAAAD, 0x0000}, 6674, 2},
+		{{0xAABC, 0xAAAE, 0x0000}, 6676, 2},
+		{{0xAABC, 0xAAAF, 0x0000}, 6678, 2},
+		{{0x11131, 0x11127, 0x0000}, 6680, 1},
+		{{0x11132, 0x11127, 0x0000}, 6681, 1},
+		{{0x11347, 0x1133E, 0x0000}, 6682, 1},
+		{{0x11347, 0x11357, 0x0000}, 6683, 1},
+		{{0x114B9, 0x114B0, 0x0000}, 6684, 1},
+		{{0x114B9, 0x114BA, 0x0000}, 6685, 1},
+		{{0x114B9, 0x114BD, 0x0000}, 6686, 1},
+		{{0x115B8, 0x115AF, 0x0000}, 6687, 1},
+		{{0x115B9, 0x115AF, 0x0000}, 6688, 1},
+		{{0x11935, 0x11930, 0x0000}, 6689, 1},
+	};
+
+	/// The ranges of implicitly weighted ideographs, sorted by code point.
+	inline static constexpr implicit_range IMPLICIT_RANGES[20] = {
+		{0x3400, 0x4DBF, 0xFB80, 0x0000},
+		{0x4E00, 0x9FFF, 0xFB40, 0x0000},
+		{0xFA0E, 0xFA0F, 0xFB40, 0x0000},
+		{0xFA11, 0xFA11, 0xFB40, 0x0000},
+		{0xFA13, 0xFA14, 0xFB40, 0x0000},
+		{0xFA1F, 0xFA1F, 0xFB40, 0x0000},
+		{0xFA21, 0xFA21, 0xFB40, 0x0000},
+		{0xFA23, 0xFA24, 0xFB40, 0x0000},
+		{0xFA27, 0xFA29, 0xFB40, 0x0000},
+		{0x17000, 0x187F7, 0xFB00, 0x17000},
+		{0x18800, 0x18AFF, 0xFB00, 0x17000},
+		{0x18B00, 0x18CD5, 0xFB02, 0x18B00},
+		{0x18D00, 0x18D08, 0xFB00, 0x17000},
+		{0x1B170, 0x1B2FB, 0xFB01, 0x1B170},
+		{0x20000, 0x2A6DF, 0xFB80, 0x0000},
+		{0x2A700, 0x2B738, 0xFB80, 0x0000},
+		{0x2B740, 0x2B81D, 0xFB80, 0x0000},
+		{0x2B820, 0x2CEA1, 0xFB80, 0x0000},
+		{0x2CEB0, 0x2EBE0, 0xFB80, 0x0000},
+		{0x30000, 0x3134A, 0xFB80, 0x0000},
+	};
+
+	/// The implicit primary weight base of any other code point.
+	inline static constexpr uint16_t UNASSIGNED_BASE = 0xFBC0;
+
+	/** Looks up the STAGE2 value of a code point.
+	 * \param the code point
+	 * \return the value */
+	static uint32_t lookup(char32_t cp)
+	{
+		size_t block = cp >> BLOCK_SHIFT;
+		if (block >= sizeof(STAGE1) / sizeof(STAGE1[0])) {
+			return 0;
+		}
+		size_t offset = cp & ((1u << BLOCK_SHIFT) - 1);
+		return STAGE2[(STAGE1[block] << BLOCK_SHIFT) + offset];
+	}
+};
+
+#endif  // ONESTRING_UNICODE_COLLATION_TABLES_HPP
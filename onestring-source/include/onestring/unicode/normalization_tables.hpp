@@ -0,0 +1,11826 @@
+/** Unicode 14.0.0 Data Tables
+ * Version: 1.0
+ *
+ * Generated by tools/generate_unicode_tables.pl. Do not edit.
+ */
+
+#ifndef ONESTRING_UNICODE_NORMALIZATION_TABLES_HPP
+#define ONESTRING_UNICODE_NORMALIZATION_TABLES_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+/** The Unicode combining classes, quick check properties, decompositions,
+ * and compositions used for normalization. */
+struct onestring_normalization_tables
+{
+	/// The code point never occurs in NFD.
+	inline static constexpr uint8_t NFD_NO = 0x01;
+	/// The code point never occurs in NFKD.
+	inline static constexpr uint8_t NFKD_NO = 0x02;
+	/// The code point never occurs in NFC.
+	inline static constexpr uint8_t NFC_NO = 0x04;
+	/// The code point may compose with the one before it in NFC.
+	inline static constexpr uint8_t NFC_MAYBE = 0x08;
+	/// The code point never occurs in NFKC.
+	inline static constexpr uint8_t NFKC_NO = 0x10;
+	/// The code point may compose with the one before it in NFKC.
+	inline static constexpr uint8_t NFKC_MAYBE = 0x20;
+
+	/** The canonical combining class of a code point, and its flags. */
+	struct record
+	{
+		uint8_t ccc;
+		uint8_t flags;
+	};
+
+	/** The full decomposition of a code point, as a range of DATA. */
+	struct decomposition
+	{
+		char32_t cp;
+		uint16_t offset;
+		uint16_t length;
+	};
+
+	/** Two code points that compose to one. */
+	struct composition
+	{
+		char32_t first;
+		char32_t second;
+		char32_t composite;
+	};
+
+	/// The number of low code point bits that index a block of STAGE2.
+	inline static constexpr unsigned BLOCK_SHIFT = 7;
+
+	/// The block of STAGE2 for each block of code points.
+	inline static constexpr uint8_t STAGE1[1525] = {
+		0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 10, 11, 12, 13, 14,
+		15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30,
+		31, 32, 33, 34, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 36, 37,
+		0, 38, 39, 0, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51,
+		52, 53, 54, 55, 56, 57, 58, 0, 59, 60, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 61, 62, 0, 0, 63, 64, 65, 66, 0, 67, 68, 69,
+		70, 71, 72, 73, 74, 68, 68, 68, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 76, 77, 78,
+		79, 80, 81, 82, 0, 83, 84, 85, 48, 48, 48, 48, 48, 48, 48, 48,
+		48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+		48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+		48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+		48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+		48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 86,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 87, 87, 88, 89, 90, 91, 68, 68, 92, 93, 94, 95, 96, 97,
+		0, 0, 0, 98, 0, 99, 100, 0, 0, 0, 0, 0, 0, 0, 0, 101,
+		0, 0, 0, 0, 102, 103, 0, 0, 0, 0, 104, 0, 0, 105, 106, 107,
+		108, 109, 110, 111, 112, 113, 114, 0, 115, 116, 0, 117, 118, 119, 120, 0,
+		121, 0, 122, 123, 124, 125, 0, 0, 118, 0, 126, 127, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 128, 129, 0, 0, 0, 0, 0, 0, 0, 0, 130,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 132, 133, 134, 0, 0, 0, 135, 136, 137, 68, 68, 138, 68, 139,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		140, 0, 129, 0, 0, 141, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 142, 143, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 145, 0, 0,
+		0, 0, 146, 147, 148, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 149, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		87, 87, 87, 87, 150,
+	};
+
+	/// The record index for each code point in a block.
+	inline static constexpr uint8_t STAGE2[19328] = {
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 1,
+		0, 0, 1, 1, 1, 1, 0, 0, 1, 1, 1, 0, 1, 1, 1, 0,
+		2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		0, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 0, 0,
+		2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		0, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 0, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 0, 1, 1, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 1,
+		1, 0, 0, 2, 2, 2, 2, 2, 2, 1, 0, 0, 2, 2, 2, 2,
+		2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+		2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2,
+		2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 1, 1, 1, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2,
+		0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0,
+		1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		3, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3, 3, 3, 4, 4, 3,
+		4, 3, 4, 3, 3, 5, 6, 6, 6, 6, 5, 7, 6, 6, 6, 6,
+		6, 8, 8, 9, 9, 9, 9, 10, 10, 6, 6, 6, 6, 9, 9, 6,
+		9, 9, 6, 6, 11, 11, 11, 11, 12, 6, 6, 6, 6, 4, 4, 4,
+		13, 13, 3, 13, 13, 14, 4, 6, 6, 6, 4, 4, 4, 6, 6, 0,
+		4, 4, 4, 6, 6, 6, 6, 4, 5, 6, 6, 4, 15, 16, 16, 15,
+		16, 16, 15, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 1, 0, 0, 0, 17, 0,
+		0, 0, 0, 0, 1, 18, 2, 17, 2, 2, 2, 0, 2, 0, 2, 2,
+		2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2,
+		2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 0,
+		1, 1, 1, 18, 18, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+		2, 2, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 2, 2, 2, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		2, 2, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 2, 2, 2, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		2, 2, 2, 2, 0, 0, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2,
+		0, 0, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 6, 4, 4, 4, 4, 6, 4, 4, 4, 19, 6, 4, 4, 4, 4,
+		4, 4, 6, 6, 6, 6, 6, 6, 4, 4, 6, 4, 4, 19, 20, 4,
+		21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 30, 31, 32, 33, 0, 34,
+		0, 35, 36, 0, 4, 6, 0, 29, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 4, 4, 4, 4, 4, 4, 37, 38, 39, 0, 0, 0, 0, 0,
+		0, 0, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 41, 42, 37, 38,
+		39, 43, 44, 3, 3, 9, 6, 4, 4, 4, 4, 4, 6, 4, 4, 6,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		45, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 2, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 4,
+		4, 4, 4, 6, 4, 0, 0, 4, 4, 0, 6, 4, 4, 6, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 6, 4, 4, 6, 4, 4, 6, 6, 6, 4, 6, 6, 4, 6, 4,
+		4, 4, 6, 4, 6, 4, 6, 4, 6, 4, 4, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4,
+		4, 4, 6, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 0, 4, 4, 4, 0, 4, 4, 4, 4, 4, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 4, 6, 6, 6, 4, 4, 4, 4,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 6,
+		6, 6, 6, 6, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 0, 6, 4, 4, 6, 4, 4, 6, 4, 4, 4, 6, 6, 6,
+		40, 41, 42, 4, 4, 4, 6, 4, 4, 6, 6, 4, 4, 4, 4, 4,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+		0, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 47, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0,
+		0, 4, 6, 4, 4, 0, 0, 0, 17, 17, 17, 17, 17, 17, 17, 17,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 50, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 48, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 17, 17, 0, 17,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 17, 0, 0, 17, 0, 0, 0, 0, 0, 49, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 17, 17, 0, 0, 17, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 50, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 2, 2, 48, 0, 0,
+		0, 0, 0, 0, 0, 0, 50, 50, 0, 0, 0, 0, 17, 17, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 48, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 48, 0, 0,
+		0, 0, 0, 0, 0, 51, 52, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0,
+		2, 0, 50, 0, 0, 0, 0, 2, 2, 0, 2, 2, 0, 48, 0, 0,
+		0, 0, 0, 0, 0, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 48, 0, 50, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 48, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 50,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 2, 2, 50,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 1, 0, 0, 0, 0, 54, 54, 48, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 55, 55, 55, 55, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 1, 0, 0, 0, 0, 56, 56, 48, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 57, 57, 57, 57, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 6, 0, 6, 0, 58, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0,
+		0, 0, 17, 0, 0, 0, 0, 17, 0, 0, 0, 0, 17, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0,
+		0, 59, 60, 17, 61, 17, 17, 1, 17, 1, 60, 60, 60, 60, 0, 0,
+		60, 17, 4, 4, 48, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0,
+		0, 0, 17, 0, 0, 0, 0, 17, 0, 0, 0, 0, 17, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 50, 0,
+		0, 0, 0, 0, 0, 0, 0, 49, 0, 48, 48, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+		50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50,
+		50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+		50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 48, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 4, 6, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 6,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 4, 4, 4, 6, 6, 6, 6, 6, 6, 4, 4, 6, 0, 6,
+		6, 4, 4, 6, 6, 4, 4, 4, 4, 4, 6, 4, 4, 4, 4, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0,
+		0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 49, 50, 0, 0, 0, 0, 0, 2, 0, 2, 0, 0,
+		2, 2, 0, 2, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 6, 4, 4, 4,
+		4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 48, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 48, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 4, 0, 11, 6, 6, 6, 6, 6, 4, 4, 6, 6, 6, 6,
+		4, 0, 11, 11, 11, 11, 11, 11, 11, 0, 0, 0, 0, 6, 0, 0,
+		0, 0, 0, 0, 4, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		4, 4, 6, 4, 4, 4, 4, 4, 4, 4, 6, 4, 4, 16, 62, 6,
+		8, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 5, 20, 20, 6, 63, 4, 15, 6, 4, 6,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 18, 0, 0, 0, 0,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 0, 0,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 0, 0,
+		2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 0, 2, 0, 2, 0, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 17, 2, 17, 2, 17, 2, 17, 2, 17, 2, 17, 2, 17, 0, 0,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 17, 2, 1, 17, 1,
+		1, 18, 2, 2, 2, 0, 2, 2, 2, 17, 2, 17, 2, 18, 18, 18,
+		2, 2, 2, 17, 0, 0, 2, 2, 2, 2, 2, 17, 0, 18, 18, 18,
+		2, 2, 2, 17, 2, 2, 2, 2, 2, 2, 2, 17, 2, 18, 17, 17,
+		0, 0, 2, 2, 2, 0, 2, 2, 2, 17, 2, 17, 2, 17, 1, 0,
+		17, 17, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+		0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+		0, 0, 0, 1, 1, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 0,
+		0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 11, 11, 4, 4, 4, 4, 11, 11, 11, 4, 4, 0, 0, 0,
+		0, 4, 0, 0, 0, 11, 11, 4, 6, 4, 11, 11, 6, 6, 6, 6,
+		4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 0, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 0, 1, 1, 0, 0, 1, 1, 1, 1, 1, 0, 0,
+		1, 1, 1, 0, 1, 0, 17, 0, 1, 0, 17, 17, 1, 1, 0, 1,
+		1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1,
+		1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, 2, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 2, 0, 2, 0, 0, 0, 0, 0, 1, 1, 0, 1,
+		1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 2, 0, 0, 2, 0, 0, 2, 0, 2, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2,
+		2, 2, 0, 0, 2, 2, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0,
+		2, 2, 0, 0, 2, 2, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 17, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+		4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 20, 5, 19, 64, 64,
+		0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0,
+		2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0,
+		2, 0, 2, 0, 0, 2, 0, 2, 0, 2, 0, 0, 0, 0, 0, 0,
+		2, 2, 0, 2, 2, 0, 2, 2, 0, 2, 2, 0, 2, 2, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 2, 0, 0, 0, 0, 65, 65, 1, 1, 0, 2, 1,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0,
+		2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0,
+		2, 0, 2, 0, 0, 2, 0, 2, 0, 2, 0, 0, 0, 0, 0, 0,
+		2, 2, 0, 2, 2, 0, 2, 2, 0, 2, 2, 0, 2, 2, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 2, 0, 0, 2, 2, 2, 2, 0, 0, 0, 2, 1,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+		0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+		0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 4, 4,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 0, 4, 4, 6, 0, 0, 4, 4, 0, 0, 0, 0, 0, 4, 4,
+		0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 0,
+		17, 0, 17, 0, 0, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0,
+		17, 0, 17, 0, 0, 17, 17, 0, 0, 0, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 0,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 17, 66, 17,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 0, 17, 17, 17, 17, 17, 0, 17, 0,
+		17, 17, 0, 17, 17, 0, 17, 17, 17, 17, 17, 17, 17, 17, 17, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+		4, 4, 4, 4, 4, 4, 4, 6, 6, 6, 6, 6, 6, 6, 4, 4,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+		1, 1, 1, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+		0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+		0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1,
+		0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0,
+		0, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 4,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 4, 11, 6, 0, 0, 0, 0, 48,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 6, 6, 4, 4, 4, 6, 4, 6, 6, 6,
+		6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 4, 6, 4, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 47, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 2, 2,
+		0, 0, 0, 48, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 48, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 48, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 0, 50, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 48, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0,
+		4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 48, 0, 0, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 2, 2, 50, 2, 0,
+		0, 0, 48, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 48,
+		49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 48, 49, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 49, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		50, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 48, 48, 0,
+		0, 0, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 49, 0, 48, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		11, 11, 11, 11, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		67, 67, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 17,
+		17, 17, 17, 17, 17, 58, 58, 11, 11, 11, 0, 0, 0, 68, 58, 58,
+		58, 58, 58, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6,
+		6, 6, 6, 0, 0, 4, 4, 4, 4, 4, 6, 6, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 17, 17, 17, 17,
+		17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1,
+		0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 1, 1, 1, 0, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 1, 1, 1,
+		1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 0, 1, 1, 1,
+		1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0,
+		1, 1, 1, 1, 1, 0, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+		1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 4, 4, 4, 4, 4,
+		4, 4, 0, 4, 4, 0, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 49, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 0, 1, 1, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0,
+		0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1, 1, 1,
+		0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+		0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1,
+		1, 1, 1, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 1, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+		0, 1, 1, 1, 0, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	};
+
+	/// The distinct records.
+	inline static constexpr record RECORDS[69] = {
+		{0, 0},
+		{0, NFKD_NO | NFKC_NO},
+		{0, NFD_NO | NFKD_NO},
+		{230, NFC_MAYBE | NFKC_MAYBE},
+		{230, 0},
+		{232, 0},
+		{220, 0},
+		{216, NFC_MAYBE | NFKC_MAYBE},
+		{202, 0},
+		{220, NFC_MAYBE | NFKC_MAYBE},
+		{202, NFC_MAYBE | NFKC_MAYBE},
+		{1, 0},
+		{1, NFC_MAYBE | NFKC_MAYBE},
+		{230, NFD_NO | NFKD_NO | NFC_NO | NFKC_NO},
+		{240, NFC_MAYBE | NFKC_MAYBE},
+		{233, 0},
+		{234, 0},
+		{0, NFD_NO | NFKD_NO | NFC_NO | NFKC_NO},
+		{0, NFD_NO | NFKD_NO | NFKC_NO},
+		{222, 0},
+		{228, 0},
+		{10, 0},
+		{11, 0},
+		{12, 0},
+		{13, 0},
+		{14, 0},
+		{15, 0},
+		{16, 0},
+		{17, 0},
+		{18, 0},
+		{19, 0},
+		{20, 0},
+		{21, 0},
+		{22, 0},
+		{23, 0},
+		{24, 0},
+		{25, 0},
+		{30, 0},
+		{31, 0},
+		{32, 0},
+		{27, 0},
+		{28, 0},
+		{29, 0},
+		{33, 0},
+		{34, 0},
+		{35, 0},
+		{36, 0},
+		{7, NFC_MAYBE | NFKC_MAYBE},
+		{9, 0},
+		{7, 0},
+		{0, NFC_MAYBE | NFKC_MAYBE},
+		{84, 0},
+		{91, NFC_MAYBE | NFKC_MAYBE},
+		{9, NFC_MAYBE | NFKC_MAYBE},
+		{103, 0},
+		{107, 0},
+		{118, 0},
+		{122, 0},
+		{216, 0},
+		{129, 0},
+		{130, 0},
+		{132, 0},
+		{214, 0},
+		{218, 0},
+		{224, 0},
+		{8, NFC_MAYBE | NFKC_MAYBE},
+		{26, 0},
+		{6, 0},
+		{226, 0},
+	};
+
+	/// The code points of every decomposition.
+	inline static constexpr char32_t DATA[12456] = {
+		0x0041, 0x0300, 0x0041, 0x0301, 0x0041, 0x0302, 0x0041, 0x0303,
+		0x0041, 0x0308, 0x0041, 0x030A, 0x0043, 0x0327, 0x0045, 0x0300,
+		0x0045, 0x0301, 0x0045, 0x0302, 0x0045, 0x0308, 0x0049, 0x0300,
+		0x0049, 0x0301, 0x0049, 0x0302, 0x0049, 0x0308, 0x004E, 0x0303,
+		0x004F, 0x0300, 0x004F, 0x0301, 0x004F, 0x0302, 0x004F, 0x0303,
+		0x004F, 0x0308, 0x0055, 0x0300, 0x0055, 0x0301, 0x0055, 0x0302,
+		0x0055, 0x0308, 0x0059, 0x0301, 0x0061, 0x0300, 0x0061, 0x0301,
+		0x0061, 0x0302, 0x0061, 0x0303, 0x0061, 0x0308, 0x0061, 0x030A,
+		0x0063, 0x0327, 0x0065, 0x0300, 0x0065, 0x0301, 0x0065, 0x0302,
+		0x0065, 0x0308, 0x0069, 0x0300, 0x0069, 0x0301, 0x0069, 0x0302,
+		0x0069, 0x0308, 0x006E, 0x0303, 0x006F, 0x0300, 0x006F, 0x0301,
+		0x006F, 0x0302, 0x006F, 0x0303, 0x006F, 0x0308, 0x0075, 0x0300,
+		0x0075, 0x0301, 0x0075, 0x0302, 0x0075, 0x0308, 0x0079, 0x0301,
+		0x0079, 0x0308, 0x0041, 0x0304, 0x0061, 0x0304, 0x0041, 0x0306,
+		0x0061, 0x0306, 0x0041, 0x0328, 0x0061, 0x0328, 0x0043, 0x0301,
+		0x0063, 0x0301, 0x0043, 0x0302, 0x0063, 0x0302, 0x0043, 0x0307,
+		0x0063, 0x0307, 0x0043, 0x030C, 0x0063, 0x030C, 0x0044, 0x030C,
+		0x0064, 0x030C, 0x0045, 0x0304, 0x0065, 0x0304, 0x0045, 0x0306,
+		0x0065, 0x0306, 0x0045, 0x0307, 0x0065, 0x0307, 0x0045, 0x0328,
+		0x0065, 0x0328, 0x0045, 0x030C, 0x0065, 0x030C, 0x0047, 0x0302,
+		0x0067, 0x0302, 0x0047, 0x0306, 0x0067, 0x0306, 0x0047, 0x0307,
+		0x0067, 0x0307, 0x0047, 0x0327, 0x0067, 0x0327, 0x0048, 0x0302,
+		0x0068, 0x0302, 0x0049, 0x0303, 0x0069, 0x0303, 0x0049, 0x0304,
+		0x0069, 0x0304, 0x0049, 0x0306, 0x0069, 0x0306, 0x0049, 0x0328,
+		0x0069, 0x0328, 0x0049, 0x0307, 0x004A, 0x0302, 0x006A, 0x0302,
+		0x004B, 0x0327, 0x006B, 0x0327, 0x004C, 0x0301, 0x006C, 0x0301,
+		0x004C, 0x0327, 0x006C, 0x0327, 0x004C, 0x030C, 0x006C, 0x030C,
+		0x004E, 0x0301, 0x006E, 0x0301, 0x004E, 0x0327, 0x006E, 0x0327,
+		0x004E, 0x030C, 0x006E, 0x030C, 0x004F, 0x0304, 0x006F, 0x0304,
+		0x004F, 0x0306, 0x006F, 0x0306, 0x004F, 0x030B, 0x006F, 0x030B,
+		0x0052, 0x0301, 0x0072, 0x0301, 0x0052, 0x0327, 0x0072, 0x0327,
+		0x0052, 0x030C, 0x0072, 0x030C, 0x0053, 0x0301, 0x0073, 0x0301,
+		0x0053, 0x0302, 0x0073, 0x0302, 0x0053, 0x0327, 0x0073, 0x0327,
+		0x0053, 0x030C, 0x0073, 0x030C, 0x0054, 0x0327, 0x0074, 0x0327,
+		0x0054, 0x030C, 0x0074, 0x030C, 0x0055, 0x0303, 0x0075, 0x0303,
+		0x0055, 0x0304, 0x0075, 0x0304, 0x0055, 0x0306, 0x0075, 0x0306,
+		0x0055, 0x030A, 0x0075, 0x030A, 0x0055, 0x030B, 0x0075, 0x030B,
+		0x0055, 0x0328, 0x0075, 0x0328, 0x0057, 0x0302, 0x0077, 0x0302,
+		0x0059, 0x0302, 0x0079, 0x0302, 0x0059, 0x0308, 0x005A, 0x0301,
+		0x007A, 0x0301, 0x005A, 0x0307, 0x007A, 0x0307, 0x005A, 0x030C,
+		0x007A, 0x030C, 0x004F, 0x031B, 0x006F, 0x031B, 0x0055, 0x031B,
+		0x0075, 0x031B, 0x0041, 0x030C, 0x0061, 0x030C, 0x0049, 0x030C,
+		0x0069, 0x030C, 0x004F, 0x030C, 0x006F, 0x030C, 0x0055, 0x030C,
+		0x0075, 0x030C, 0x0055, 0x0308, 0x0304, 0x0075, 0x0308, 0x0304,
+		0x0055, 0x0308, 0x0301, 0x0075, 0x0308, 0x0301, 0x0055, 0x0308,
+		0x030C, 0x0075, 0x0308, 0x030C, 0x0055, 0x0308, 0x0300, 0x0075,
+		0x0308, 0x0300, 0x0041, 0x0308, 0x0304, 0x0061, 0x0308, 0x0304,
+		0x0041, 0x0307, 0x0304, 0x0061, 0x0307, 0x0304, 0x00C6, 0x0304,
+		0x00E6, 0x0304, 0x0047, 0x030C, 0x0067, 0x030C, 0x004B, 0x030C,
+		0x006B, 0x030C, 0x004F, 0x0328, 0x006F, 0x0328, 0x004F, 0x0328,
+		0x0304, 0x006F, 0x0328, 0x0304, 0x01B7, 0x030C, 0x0292, 0x030C,
+		0x006A, 0x030C, 0x0047, 0x0301, 0x0067, 0x0301, 0x004E, 0x0300,
+		0x006E, 0x0300, 0x0041, 0x030A, 0x0301, 0x0061, 0x030A, 0x0301,
+		0x00C6, 0x0301, 0x00E6, 0x0301, 0x00D8, 0x0301, 0x00F8, 0x0301,
+		0x0041, 0x030F, 0x0061, 0x030F, 0x0041, 0x0311, 0x0061, 0x0311,
+		0x0045, 0x030F, 0x0065, 0x030F, 0x0045, 0x0311, 0x0065, 0x0311,
+		0x0049, 0x030F, 0x0069, 0x030F, 0x0049, 0x0311, 0x0069, 0x0311,
+		0x004F, 0x030F, 0x006F, 0x030F, 0x004F, 0x0311, 0x006F, 0x0311,
+		0x0052, 0x030F, 0x0072, 0x030F, 0x0052, 0x0311, 0x0072, 0x0311,
+		0x0055, 0x030F, 0x0075, 0x030F, 0x0055, 0x0311, 0x0075, 0x0311,
+		0x0053, 0x0326, 0x0073, 0x0326, 0x0054, 0x0326, 0x0074, 0x0326,
+		0x0048, 0x030C, 0x0068, 0x030C, 0x0041, 0x0307, 0x0061, 0x0307,
+		0x0045, 0x0327, 0x0065, 0x0327, 0x004F, 0x0308, 0x0304, 0x006F,
+		0x0308, 0x0304, 0x004F, 0x0303, 0x0304, 0x006F, 0x0303, 0x0304,
+		0x004F, 0x0307, 0x006F, 0x0307, 0x004F, 0x0307, 0x0304, 0x006F,
+		0x0307, 0x0304, 0x0059, 0x0304, 0x0079, 0x0304, 0x0300, 0x0301,
+		0x0313, 0x0308, 0x0301, 0x02B9, 0x003B, 0x00A8, 0x0301, 0x0391,
+		0x0301, 0x00B7, 0x0395, 0x0301, 0x0397, 0x0301, 0x0399, 0x0301,
+		0x039F, 0x0301, 0x03A5, 0x0301, 0x03A9, 0x0301, 0x03B9, 0x0308,
+		0x0301, 0x0399, 0x0308, 0x03A5, 0x0308, 0x03B1, 0x0301, 0x03B5,
+		0x0301, 0x03B7, 0x0301, 0x03B9, 0x0301, 0x03C5, 0x0308, 0x0301,
+		0x03B9, 0x0308, 0x03C5, 0x0308, 0x03BF, 0x0301, 0x03C5, 0x0301,
+		0x03C9, 0x0301, 0x03D2, 0x0301, 0x03D2, 0x0308, 0x0415, 0x0300,
+		0x0415, 0x0308, 0x0413, 0x0301, 0x0406, 0x0308, 0x041A, 0x0301,
+		0x0418, 0x0300, 0x0423, 0x0306, 0x0418, 0x0306, 0x0438, 0x0306,
+		0x0435, 0x0300, 0x0435, 0x0308, 0x0433, 0x0301, 0x0456, 0x0308,
+		0x043A, 0x0301, 0x0438, 0x0300, 0x0443, 0x0306, 0x0474, 0x030F,
+		0x0475, 0x030F, 0x0416, 0x0306, 0x0436, 0x0306, 0x0410, 0x0306,
+		0x0430, 0x0306, 0x0410, 0x0308, 0x0430, 0x0308, 0x0415, 0x0306,
+		0x0435, 0x0306, 0x04D8, 0x0308, 0x04D9, 0x0308, 0x0416, 0x0308,
+		0x0436, 0x0308, 0x0417, 0x0308, 0x0437, 0x0308, 0x0418, 0x0304,
+		0x0438, 0x0304, 0x0418, 0x0308, 0x0438, 0x0308, 0x041E, 0x0308,
+		0x043E, 0x0308, 0x04E8, 0x0308, 0x04E9, 0x0308, 0x042D, 0x0308,
+		0x044D, 0x0308, 0x0423, 0x0304, 0x0443, 0x0304, 0x0423, 0x0308,
+		0x0443, 0x0308, 0x0423, 0x030B, 0x0443, 0x030B, 0x0427, 0x0308,
+		0x0447, 0x0308, 0x042B, 0x0308, 0x044B, 0x0308, 0x0627, 0x0653,
+		0x0627, 0x0654, 0x0648, 0x0654, 0x0627, 0x0655, 0x064A, 0x0654,
+		0x06D5, 0x0654, 0x06C1, 0x0654, 0x06D2, 0x0654, 0x0928, 0x093C,
+		0x0930, 0x093C, 0x0933, 0x093C, 0x0915, 0x093C, 0x0916, 0x093C,
+		0x0917, 0x093C, 0x091C, 0x093C, 0x0921, 0x093C, 0x0922, 0x093C,
+		0x092B, 0x093C, 0x092F, 0x093C, 0x09C7, 0x09BE, 0x09C7, 0x09D7,
+		0x09A1, 0x09BC, 0x09A2, 0x09BC, 0x09AF, 0x09BC, 0x0A32, 0x0A3C,
+		0x0A38, 0x0A3C, 0x0A16, 0x0A3C, 0x0A17, 0x0A3C, 0x0A1C, 0x0A3C,
+		0x0A2B, 0x0A3C, 0x0B47, 0x0B56, 0x0B47, 0x0B3E, 0x0B47, 0x0B57,
+		0x0B21, 0x0B3C, 0x0B22, 0x0B3C, 0x0B92, 0x0BD7, 0x0BC6, 0x0BBE,
+		0x0BC7, 0x0BBE, 0x0BC6, 0x0BD7, 0x0C46, 0x0C56, 0x0CBF, 0x0CD5,
+		0x0CC6, 0x0CD5, 0x0CC6, 0x0CD6, 0x0CC6, 0x0CC2, 0x0CC6, 0x0CC2,
+		0x0CD5, 0x0D46, 0x0D3E, 0x0D47, 0x0D3E, 0x0D46, 0x0D57, 0x0DD9,
+		0x0DCA, 0x0DD9, 0x0DCF, 0x0DD9, 0x0DCF, 0x0DCA, 0x0DD9, 0x0DDF,
+		0x0F42, 0x0FB7, 0x0F4C, 0x0FB7, 0x0F51, 0x0FB7, 0x0F56, 0x0FB7,
+		0x0F5B, 0x0FB7, 0x0F40, 0x0FB5, 0x0F71, 0x0F72, 0x0F71, 0x0F74,
+		0x0FB2, 0x0F80, 0x0FB3, 0x0F80, 0x0F71, 0x0F80, 0x0F92, 0x0FB7,
+		0x0F9C, 0x0FB7, 0x0FA1, 0x0FB7, 0x0FA6, 0x0FB7, 0x0FAB, 0x0FB7,
+		0x0F90, 0x0FB5, 0x1025, 0x102E, 0x1B05, 0x1B35, 0x1B07, 0x1B35,
+		0x1B09, 0x1B35, 0x1B0B, 0x1B35, 0x1B0D, 0x1B35, 0x1B11, 0x1B35,
+		0x1B3A, 0x1B35, 0x1B3C, 0x1B35, 0x1B3E, 0x1B35, 0x1B3F, 0x1B35,
+		0x1B42, 0x1B35, 0x0041, 0x0325, 0x0061, 0x0325, 0x0042, 0x0307,
+		0x0062, 0x0307, 0x0042, 0x0323, 0x0062, 0x0323, 0x0042, 0x0331,
+		0x0062, 0x0331, 0x0043, 0x0327, 0x0301, 0x0063, 0x0327, 0x0301,
+		0x0044, 0x0307, 0x0064, 0x0307, 0x0044, 0x0323, 0x0064, 0x0323,
+		0x0044, 0x0331, 0x0064, 0x0331, 0x0044, 0x0327, 0x0064, 0x0327,
+		0x0044, 0x032D, 0x0064, 0x032D, 0x0045, 0x0304, 0x0300, 0x0065,
+		0x0304, 0x0300, 0x0045, 0x0304, 0x0301, 0x0065, 0x0304, 0x0301,
+		0x0045, 0x032D, 0x0065, 0x032D, 0x0045, 0x0330, 0x0065, 0x0330,
+		0x0045, 0x0327, 0x0306, 0x0065, 0x0327, 0x0306, 0x0046, 0x0307,
+		0x0066, 0x0307, 0x0047, 0x0304, 0x0067, 0x0304, 0x0048, 0x0307,
+		0x0068, 0x0307, 0x0048, 0x0323, 0x0068, 0x0323, 0x0048, 0x0308,
+		0x0068, 0x0308, 0x0048, 0x0327, 0x0068, 0x0327, 0x0048, 0x032E,
+		0x0068, 0x032E, 0x0049, 0x0330, 0x0069, 0x0330, 0x0049, 0x0308,
+		0x0301, 0x0069, 0x0308, 0x0301, 0x004B, 0x0301, 0x006B, 0x0301,
+		0x004B, 0x0323, 0x006B, 0x0323, 0x004B, 0x0331, 0x006B, 0x0331,
+		0x004C, 0x0323, 0x006C, 0x0323, 0x004C, 0x0323, 0x0304, 0x006C,
+		0x0323, 0x0304, 0x004C, 0x0331, 0x006C, 0x0331, 0x004C, 0x032D,
+		0x006C, 0x032D, 0x004D, 0x0301, 0x006D, 0x0301, 0x004D, 0x0307,
+		0x006D, 0x0307, 0x004D, 0x0323, 0x006D, 0x0323, 0x004E, 0x0307,
+		0x006E, 0x0307, 0x004E, 0x0323, 0x006E, 0x0323, 0x004E, 0x0331,
+		0x006E, 0x0331, 0x004E, 0x032D, 0x006E, 0x032D, 0x004F, 0x0303,
+		0x0301, 0x006F, 0x0303, 0x0301, 0x004F, 0x0303, 0x0308, 0x006F,
+		0x0303, 0x0308, 0x004F, 0x0304, 0x0300, 0x006F, 0x0304, 0x0300,
+		0x004F, 0x0304, 0x0301, 0x006F, 0x0304, 0x0301, 0x0050, 0x0301,
+		0x0070, 0x0301, 0x0050, 0x0307, 0x0070, 0x0307, 0x0052, 0x0307,
+		0x0072, 0x0307, 0x0052, 0x0323, 0x0072, 0x0323, 0x0052, 0x0323,
+		0x0304, 0x0072, 0x0323, 0x0304, 0x0052, 0x0331, 0x0072, 0x0331,
+		0x0053, 0x0307, 0x0073, 0x0307, 0x0053, 0x0323, 0x0073, 0x0323,
+		0x0053, 0x0301, 0x0307, 0x0073, 0x0301, 0x0307, 0x0053, 0x030C,
+		0x0307, 0x0073, 0x030C, 0x0307, 0x0053, 0x0323, 0x0307, 0x0073,
+		0x0323, 0x0307, 0x0054, 0x0307, 0x0074, 0x0307, 0x0054, 0x0323,
+		0x0074, 0x0323, 0x0054, 0x0331, 0x0074, 0x0331, 0x0054, 0x032D,
+		0x0074, 0x032D, 0x0055, 0x0324, 0x0075, 0x0324, 0x0055, 0x0330,
+		0x0075, 0x0330, 0x0055, 0x032D, 0x0075, 0x032D, 0x0055, 0x0303,
+		0x0301, 0x0075, 0x0303, 0x0301, 0x0055, 0x0304, 0x0308, 0x0075,
+		0x0304, 0x0308, 0x0056, 0x0303, 0x0076, 0x0303, 0x0056, 0x0323,
+		0x0076, 0x0323, 0x0057, 0x0300, 0x0077, 0x0300, 0x0057, 0x0301,
+		0x0077, 0x0301, 0x0057, 0x0308, 0x0077, 0x0308, 0x0057, 0x0307,
+		0x0077, 0x0307, 0x0057, 0x0323, 0x0077, 0x0323, 0x0058, 0x0307,
+		0x0078, 0x0307, 0x0058, 0x0308, 0x0078, 0x0308, 0x0059, 0x0307,
+		0x0079, 0x0307, 0x005A, 0x0302, 0x007A, 0x0302, 0x005A, 0x0323,
+		0x007A, 0x0323, 0x005A, 0x0331, 0x007A, 0x0331, 0x0068, 0x0331,
+		0x0074, 0x0308, 0x0077, 0x030A, 0x0079, 0x030A, 0x017F, 0x0307,
+		0x0041, 0x0323, 0x0061, 0x0323, 0x0041, 0x0309, 0x0061, 0x0309,
+		0x0041, 0x0302, 0x0301, 0x0061, 0x0302, 0x0301, 0x0041, 0x0302,
+		0x0300, 0x0061, 0x0302, 0x0300, 0x0041, 0x0302, 0x0309, 0x0061,
+		0x0302, 0x0309, 0x0041, 0x0302, 0x0303, 0x0061, 0x0302, 0x0303,
+		0x0041, 0x0323, 0x0302, 0x0061, 0x0323, 0x0302, 0x0041, 0x0306,
+		0x0301, 0x0061, 0x0306, 0x0301, 0x0041, 0x0306, 0x0300, 0x0061,
+		0x0306, 0x0300, 0x0041, 0x0306, 0x0309, 0x0061, 0x0306, 0x0309,
+		0x0041, 0x0306, 0x0303, 0x0061, 0x0306, 0x0303, 0x0041, 0x0323,
+		0x0306, 0x0061, 0x0323, 0x0306, 0x0045, 0x0323, 0x0065, 0x0323,
+		0x0045, 0x0309, 0x0065, 0x0309, 0x0045, 0x0303, 0x0065, 0x0303,
+		0x0045, 0x0302, 0x0301, 0x0065, 0x0302, 0x0301, 0x0045, 0x0302,
+		0x0300, 0x0065, 0x0302, 0x0300, 0x0045, 0x0302, 0x0309, 0x0065,
+		0x0302, 0x0309, 0x0045, 0x0302, 0x0303, 0x0065, 0x0302, 0x0303,
+		0x0045, 0x0323, 0x0302, 0x0065, 0x0323, 0x0302, 0x0049, 0x0309,
+		0x0069, 0x0309, 0x0049, 0x0323, 0x0069, 0x0323, 0x004F, 0x0323,
+		0x006F, 0x0323, 0x004F, 0x0309, 0x006F, 0x0309, 0x004F, 0x0302,
+		0x0301, 0x006F, 0x0302, 0x0301, 0x004F, 0x0302, 0x0300, 0x006F,
+		0x0302, 0x0300, 0x004F, 0x0302, 0x0309, 0x006F, 0x0302, 0x0309,
+		0x004F, 0x0302, 0x0303, 0x006F, 0x0302, 0x0303, 0x004F, 0x0323,
+		0x0302, 0x006F, 0x0323, 0x0302, 0x004F, 0x031B, 0x0301, 0x006F,
+		0x031B, 0x0301, 0x004F, 0x031B, 0x0300, 0x006F, 0x031B, 0x0300,
+		0x004F, 0x031B, 0x0309, 0x006F, 0x031B, 0x0309, 0x004F, 0x031B,
+		0x0303, 0x006F, 0x031B, 0x0303, 0x004F, 0x031B, 0x0323, 0x006F,
+		0x031B, 0x0323, 0x0055, 0x0323, 0x0075, 0x0323, 0x0055, 0x0309,
+		0x0075, 0x0309, 0x0055, 0x031B, 0x0301, 0x0075, 0x031B, 0x0301,
+		0x0055, 0x031B, 0x0300, 0x0075, 0x031B, 0x0300, 0x0055, 0x031B,
+		0x0309, 0x0075, 0x031B, 0x0309, 0x0055, 0x031B, 0x0303, 0x0075,
+		0x031B, 0x0303, 0x0055, 0x031B, 0x0323, 0x0075, 0x031B, 0x0323,
+		0x0059, 0x0300, 0x0079, 0x0300, 0x0059, 0x0323, 0x0079, 0x0323,
+		0x0059, 0x0309, 0x0079, 0x0309, 0x0059, 0x0303, 0x0079, 0x0303,
+		0x03B1, 0x0313, 0x03B1, 0x0314, 0x03B1, 0x0313, 0x0300, 0x03B1,
+		0x0314, 0x0300, 0x03B1, 0x0313, 0x0301, 0x03B1, 0x0314, 0x0301,
+		0x03B1, 0x0313, 0x0342, 0x03B1, 0x0314, 0x0342, 0x0391, 0x0313,
+		0x0391, 0x0314, 0x0391, 0x0313, 0x0300, 0x0391, 0x0314, 0x0300,
+		0x0391, 0x0313, 0x0301, 0x0391, 0x0314, 0x0301, 0x0391, 0x0313,
+		0x0342, 0x0391, 0x0314, 0x0342, 0x03B5, 0x0313, 0x03B5, 0x0314,
+		0x03B5, 0x0313, 0x0300, 0x03B5, 0x0314, 0x0300, 0x03B5, 0x0313,
+		0x0301, 0x03B5, 0x0314, 0x0301, 0x0395, 0x0313, 0x0395, 0x0314,
+		0x0395, 0x0313, 0x0300, 0x0395, 0x0314, 0x0300, 0x0395, 0x0313,
+		0x0301, 0x0395, 0x0314, 0x0301, 0x03B7, 0x0313, 0x03B7, 0x0314,
+		0x03B7, 0x0313, 0x0300, 0x03B7, 0x0314, 0x0300, 0x03B7, 0x0313,
+		0x0301, 0x03B7, 0x0314, 0x0301, 0x03B7, 0x0313, 0x0342, 0x03B7,
+		0x0314, 0x0342, 0x0397, 0x0313, 0x0397, 0x0314, 0x0397, 0x0313,
+		0x0300, 0x0397, 0x0314, 0x0300, 0x0397, 0x0313, 0x0301, 0x0397,
+		0x0314, 0x0301, 0x0397, 0x0313, 0x0342, 0x0397, 0x0314, 0x0342,
+		0x03B9, 0x0313, 0x03B9, 0x0314, 0x03B9, 0x0313, 0x0300, 0x03B9,
+		0x0314, 0x0300, 0x03B9, 0x0313, 0x0301, 0x03B9, 0x0314, 0x0301,
+		0x03B9, 0x0313, 0x0342, 0x03B9, 0x0314, 0x0342, 0x0399, 0x0313,
+		0x0399, 0x0314, 0x0399, 0x0313, 0x0300, 0x0399, 0x0314, 0x0300,
+		0x0399, 0x0313, 0x0301, 0x0399, 0x0314, 0x0301, 0x0399, 0x0313,
+		0x0342, 0x0399, 0x0314, 0x0342, 0x03BF, 0x0313, 0x03BF, 0x0314,
+		0x03BF, 0x0313, 0x0300, 0x03BF, 0x0314, 0x0300, 0x03BF, 0x0313,
+		0x0301, 0x03BF, 0x0314, 0x0301, 0x039F, 0x0313, 0x039F, 0x0314,
+		0x039F, 0x0313, 0x0300, 0x039F, 0x0314, 0x0300, 0x039F, 0x0313,
+		0x0301, 0x039F, 0x0314, 0x0301, 0x03C5, 0x0313, 0x03C5, 0x0314,
+		0x03C5, 0x0313, 0x0300, 0x03C5, 0x0314, 0x0300, 0x03C5, 0x0313,
+		0x0301, 0x03C5, 0x0314, 0x0301, 0x03C5, 0x0313, 0x0342, 0x03C5,
+		0x0314, 0x0342, 0x03A5, 0x0314, 0x03A5, 0x0314, 0x0300, 0x03A5,
+		0x0314, 0x0301, 0x03A5, 0x0314, 0x0342, 0x03C9, 0x0313, 0x03C9,
+		0x0314, 0x03C9, 0x0313, 0x0300, 0x03C9, 0x0314, 0x0300, 0x03C9,
+		0x0313, 0x0301, 0x03C9, 0x0314, 0x0301, 0x03C9, 0x0313, 0x0342,
+		0x03C9, 0x0314, 0x0342, 0x03A9, 0x0313, 0x03A9, 0x0314, 0x03A9,
+		0x0313, 0x0300, 0x03A9, 0x0314, 0x0300, 0x03A9, 0x0313, 0x0301,
+		0x03A9, 0x0314, 0x0301, 0x03A9, 0x0313, 0x0342, 0x03A9, 0x0314,
+		0x0342, 0x03B1, 0x0300, 0x03B1, 0x0301, 0x03B5, 0x0300, 0x03B5,
+		0x0301, 0x03B7, 0x0300, 0x03B7, 0x0301, 0x03B9, 0x0300, 0x03B9,
+		0x0301, 0x03BF, 0x0300, 0x03BF, 0x0301, 0x03C5, 0x0300, 0x03C5,
+		0x0301, 0x03C9, 0x0300, 0x03C9, 0x0301, 0x03B1, 0x0313, 0x0345,
+		0x03B1, 0x0314, 0x0345, 0x03B1, 0x0313, 0x0300, 0x0345, 0x03B1,
+		0x0314, 0x0300, 0x0345, 0x03B1, 0x0313, 0x0301, 0x0345, 0x03B1,
+		0x0314, 0x0301, 0x0345, 0x03B1, 0x0313, 0x0342, 0x0345, 0x03B1,
+		0x0314, 0x0342, 0x0345, 0x0391, 0x0313, 0x0345, 0x0391, 0x0314,
+		0x0345, 0x0391, 0x0313, 0x0300, 0x0345, 0x0391, 0x0314, 0x0300,
+		0x0345, 0x0391, 0x0313, 0x0301, 0x0345, 0x0391, 0x0314, 0x0301,
+		0x0345, 0x0391, 0x0313, 0x0342, 0x0345, 0x0391, 0x0314, 0x0342,
+		0x0345, 0x03B7, 0x0313, 0x0345, 0x03B7, 0x0314, 0x0345, 0x03B7,
+		0x0313, 0x0300, 0x0345, 0x03B7, 0x0314, 0x0300, 0x0345, 0x03B7,
+		0x0313, 0x0301, 0x0345, 0x03B7, 0x0314, 0x0301, 0x0345, 0x03B7,
+		0x0313, 0x0342, 0x0345, 0x03B7, 0x0314, 0x0342, 0x0345, 0x0397,
+		0x0313, 0x0345, 0x0397, 0x0314, 0x0345, 0x0397, 0x0313, 0x0300,
+		0x0345, 0x0397, 0x0314, 0x0300, 0x0345, 0x0397, 0x0313, 0x0301,
+		0x0345, 0x0397, 0x0314, 0x0301, 0x0345, 0x0397, 0x0313, 0x0342,
+		0x0345, 0x0397, 0x0314, 0x0342, 0x0345, 0x03C9, 0x0313, 0x0345,
+		0x03C9, 0x0314, 0x0345, 0x03C9, 0x0313, 0x0300, 0x0345, 0x03C9,
+		0x0314, 0x0300, 0x0345, 0x03C9, 0x0313, 0x0301, 0x0345, 0x03C9,
+		0x0314, 0x0301, 0x0345, 0x03C9, 0x0313, 0x0342, 0x0345, 0x03C9,
+		0x0314, 0x0342, 0x0345, 0x03A9, 0x0313, 0x0345, 0x03A9, 0x0314,
+		0x0345, 0x03A9, 0x0313, 0x0300, 0x0345, 0x03A9, 0x0314, 0x0300,
+		0x0345, 0x03A9, 0x0313, 0x0301, 0x0345, 0x03A9, 0x0314, 0x0301,
+		0x0345, 0x03A9, 0x0313, 0x0342, 0x0345, 0x03A9, 0x0314, 0x0342,
+		0x0345, 0x03B1, 0x0306, 0x03B1, 0x0304, 0x03B1, 0x0300, 0x0345,
+		0x03B1, 0x0345, 0x03B1, 0x0301, 0x0345, 0x03B1, 0x0342, 0x03B1,
+		0x0342, 0x0345, 0x0391, 0x0306, 0x0391, 0x0304, 0x0391, 0x0300,
+		0x0391, 0x0301, 0x0391, 0x0345, 0x03B9, 0x00A8, 0x0342, 0x03B7,
+		0x0300, 0x0345, 0x03B7, 0x0345, 0x03B7, 0x0301, 0x0345, 0x03B7,
+		0x0342, 0x03B7, 0x0342, 0x0345, 0x0395, 0x0300, 0x0395, 0x0301,
+		0x0397, 0x0300, 0x0397, 0x0301, 0x0397, 0x0345, 0x1FBF, 0x0300,
+		0x1FBF, 0x0301, 0x1FBF, 0x0342, 0x03B9, 0x0306, 0x03B9, 0x0304,
+		0x03B9, 0x0308, 0x0300, 0x03B9, 0x0308, 0x0301, 0x03B9, 0x0342,
+		0x03B9, 0x0308, 0x0342, 0x0399, 0x0306, 0x0399, 0x0304, 0x0399,
+		0x0300, 0x0399, 0x0301, 0x1FFE, 0x0300, 0x1FFE, 0x0301, 0x1FFE,
+		0x0342, 0x03C5, 0x0306, 0x03C5, 0x0304, 0x03C5, 0x0308, 0x0300,
+		0x03C5, 0x0308, 0x0301, 0x03C1, 0x0313, 0x03C1, 0x0314, 0x03C5,
+		0x0342, 0x03C5, 0x0308, 0x0342, 0x03A5, 0x0306, 0x03A5, 0x0304,
+		0x03A5, 0x0300, 0x03A5, 0x0301, 0x03A1, 0x0314, 0x00A8, 0x0300,
+		0x00A8, 0x0301, 0x0060, 0x03C9, 0x0300, 0x0345, 0x03C9, 0x0345,
+		0x03C9, 0x0301, 0x0345, 0x03C9, 0x0342, 0x03C9, 0x0342, 0x0345,
+		0x039F, 0x0300, 0x039F, 0x0301, 0x03A9, 0x0300, 0x03A9, 0x0301,
+		0x03A9, 0x0345, 0x00B4, 0x2002, 0x2003, 0x03A9, 0x004B, 0x0041,
+		0x030A, 0x2190, 0x0338, 0x2192, 0x0338, 0x2194, 0x0338, 0x21D0,
+		0x0338, 0x21D4, 0x0338, 0x21D2, 0x0338, 0x2203, 0x0338, 0x2208,
+		0x0338, 0x220B, 0x0338, 0x2223, 0x0338, 0x2225, 0x0338, 0x223C,
+		0x0338, 0x2243, 0x0338, 0x2245, 0x0338, 0x2248, 0x0338, 0x003D,
+		0x0338, 0x2261, 0x0338, 0x224D, 0x0338, 0x003C, 0x0338, 0x003E,
+		0x0338, 0x2264, 0x0338, 0x2265, 0x0338, 0x2272, 0x0338, 0x2273,
+		0x0338, 0x2276, 0x0338, 0x2277, 0x0338, 0x227A, 0x0338, 0x227B,
+		0x0338, 0x2282, 0x0338, 0x2283, 0x0338, 0x2286, 0x0338, 0x2287,
+		0x0338, 0x22A2, 0x0338, 0x22A8, 0x0338, 0x22A9, 0x0338, 0x22AB,
+		0x0338, 0x227C, 0x0338, 0x227D, 0x0338, 0x2291, 0x0338, 0x2292,
+		0x0338, 0x22B2, 0x0338, 0x22B3, 0x0338, 0x22B4, 0x0338, 0x22B5,
+		0x0338, 0x3008, 0x3009, 0x2ADD, 0x0338, 0x304B, 0x3099, 0x304D,
+		0x3099, 0x304F, 0x3099, 0x3051, 0x3099, 0x3053, 0x3099, 0x3055,
+		0x3099, 0x3057, 0x3099, 0x3059, 0x3099, 0x305B, 0x3099, 0x305D,
+		0x3099, 0x305F, 0x3099, 0x3061, 0x3099, 0x3064, 0x3099, 0x3066,
+		0x3099, 0x3068, 0x3099, 0x306F, 0x3099, 0x306F, 0x309A, 0x3072,
+		0x3099, 0x3072, 0x309A, 0x3075, 0x3099, 0x3075, 0x309A, 0x3078,
+		0x3099, 0x3078, 0x309A, 0x307B, 0x3099, 0x307B, 0x309A, 0x3046,
+		0x3099, 0x309D, 0x3099, 0x30AB, 0x3099, 0x30AD, 0x3099, 0x30AF,
+		0x3099, 0x30B1, 0x3099, 0x30B3, 0x3099, 0x30B5, 0x3099, 0x30B7,
+		0x3099, 0x30B9, 0x3099, 0x30BB, 0x3099, 0x30BD, 0x3099, 0x30BF,
+		0x3099, 0x30C1, 0x3099, 0x30C4, 0x3099, 0x30C6, 0x3099, 0x30C8,
+		0x3099, 0x30CF, 0x3099, 0x30CF, 0x309A, 0x30D2, 0x3099, 0x30D2,
+		0x309A, 0x30D5, 0x3099, 0x30D5, 0x309A, 0x30D8, 0x3099, 0x30D8,
+		0x309A, 0x30DB, 0x3099, 0x30DB, 0x309A, 0x30A6, 0x3099, 0x30EF,
+		0x3099, 0x30F0, 0x3099, 0x30F1, 0x3099, 0x30F2, 0x3099, 0x30FD,
+		0x3099, 0x8C48, 0x66F4, 0x8ECA, 0x8CC8, 0x6ED1, 0x4E32, 0x53E5,
+		0x9F9C, 0x9F9C, 0x5951, 0x91D1, 0x5587, 0x5948, 0x61F6, 0x7669,
+		0x7F85, 0x863F, 0x87BA, 0x88F8, 0x908F, 0x6A02, 0x6D1B, 0x70D9,
+		0x73DE, 0x843D, 0x916A, 0x99F1, 0x4E82, 0x5375, 0x6B04, 0x721B,
+		0x862D, 0x9E1E, 0x5D50, 0x6FEB, 0x85CD, 0x8964, 0x62C9, 0x81D8,
+		0x881F, 0x5ECA, 0x6717, 0x6D6A, 0x72FC, 0x90CE, 0x4F86, 0x51B7,
+		0x52DE, 0x64C4, 0x6AD3, 0x7210, 0x76E7, 0x8001, 0x8606, 0x865C,
+		0x8DEF, 0x9732, 0x9B6F, 0x9DFA, 0x788C, 0x797F, 0x7DA0, 0x83C9,
+		0x9304, 0x9E7F, 0x8AD6, 0x58DF, 0x5F04, 0x7C60, 0x807E, 0x7262,
+		0x78CA, 0x8CC2, 0x96F7, 0x58D8, 0x5C62, 0x6A13, 0x6DDA, 0x6F0F,
+		0x7D2F, 0x7E37, 0x964B, 0x52D2, 0x808B, 0x51DC, 0x51CC, 0x7A1C,
+		0x7DBE, 0x83F1, 0x9675, 0x8B80, 0x62CF, 0x6A02, 0x8AFE, 0x4E39,
+		0x5BE7, 0x6012, 0x7387, 0x7570, 0x5317, 0x78FB, 0x4FBF, 0x5FA9,
+		0x4E0D, 0x6CCC, 0x6578, 0x7D22, 0x53C3, 0x585E, 0x7701, 0x8449,
+		0x8AAA, 0x6BBA, 0x8FB0, 0x6C88, 0x62FE, 0x82E5, 0x63A0, 0x7565,
+		0x4EAE, 0x5169, 0x51C9, 0x6881, 0x7CE7, 0x826F, 0x8AD2, 0x91CF,
+		0x52F5, 0x5442, 0x5973, 0x5EEC, 0x65C5, 0x6FFE, 0x792A, 0x95AD,
+		0x9A6A, 0x9E97, 0x9ECE, 0x529B, 0x66C6, 0x6B77, 0x8F62, 0x5E74,
+		0x6190, 0x6200, 0x649A, 0x6F23, 0x7149, 0x7489, 0x79CA, 0x7DF4,
+		0x806F, 0x8F26, 0x84EE, 0x9023, 0x934A, 0x5217, 0x52A3, 0x54BD,
+		0x70C8, 0x88C2, 0x8AAA, 0x5EC9, 0x5FF5, 0x637B, 0x6BAE, 0x7C3E,
+		0x7375, 0x4EE4, 0x56F9, 0x5BE7, 0x5DBA, 0x601C, 0x73B2, 0x7469,
+		0x7F9A, 0x8046, 0x9234, 0x96F6, 0x9748, 0x9818, 0x4F8B, 0x79AE,
+		0x91B4, 0x96B8, 0x60E1, 0x4E86, 0x50DA, 0x5BEE, 0x5C3F, 0x6599,
+		0x6A02, 0x71CE, 0x7642, 0x84FC, 0x907C, 0x9F8D, 0x6688, 0x962E,
+		0x5289, 0x677B, 0x67F3, 0x6D41, 0x6E9C, 0x7409, 0x7559, 0x786B,
+		0x7D10, 0x985E, 0x516D, 0x622E, 0x9678, 0x502B, 0x5D19, 0x6DEA,
+		0x8F2A, 0x5F8B, 0x6144, 0x6817, 0x7387, 0x9686, 0x5229, 0x540F,
+		0x5C65, 0x6613, 0x674E, 0x68A8, 0x6CE5, 0x7406, 0x75E2, 0x7F79,
+		0x88CF, 0x88E1, 0x91CC, 0x96E2, 0x533F, 0x6EBA, 0x541D, 0x71D0,
+		0x7498, 0x85FA, 0x96A3, 0x9C57, 0x9E9F, 0x6797, 0x6DCB, 0x81E8,
+		0x7ACB, 0x7B20, 0x7C92, 0x72C0, 0x7099, 0x8B58, 0x4EC0, 0x8336,
+		0x523A, 0x5207, 0x5EA6, 0x62D3, 0x7CD6, 0x5B85, 0x6D1E, 0x66B4,
+		0x8F3B, 0x884C, 0x964D, 0x898B, 0x5ED3, 0x5140, 0x55C0, 0x585A,
+		0x6674, 0x51DE, 0x732A, 0x76CA, 0x793C, 0x795E, 0x7965, 0x798F,
+		0x9756, 0x7CBE, 0x7FBD, 0x8612, 0x8AF8, 0x9038, 0x90FD, 0x98EF,
+		0x98FC, 0x9928, 0x9DB4, 0x90DE, 0x96B7, 0x4FAE, 0x50E7, 0x514D,
+		0x52C9, 0x52E4, 0x5351, 0x559D, 0x5606, 0x5668, 0x5840, 0x58A8,
+		0x5C64, 0x5C6E, 0x6094, 0x6168, 0x618E, 0x61F2, 0x654F, 0x65E2,
+		0x6691, 0x6885, 0x6D77, 0x6E1A, 0x6F22, 0x716E, 0x722B, 0x7422,
+		0x7891, 0x793E, 0x7949, 0x7948, 0x7950, 0x7956, 0x795D, 0x798D,
+		0x798E, 0x7A40, 0x7A81, 0x7BC0, 0x7DF4, 0x7E09, 0x7E41, 0x7F72,
+		0x8005, 0x81ED, 0x8279, 0x8279, 0x8457, 0x8910, 0x8996, 0x8B01,
+		0x8B39, 0x8CD3, 0x8D08, 0x8FB6, 0x9038, 0x96E3, 0x97FF, 0x983B,
+		0x6075, 0x242EE, 0x8218, 0x4E26, 0x51B5, 0x5168, 0x4F80, 0x5145,
+		0x5180, 0x52C7, 0x52FA, 0x559D, 0x5555, 0x5599, 0x55E2, 0x585A,
+		0x58B3, 0x5944, 0x5954, 0x5A62, 0x5B28, 0x5ED2, 0x5ED9, 0x5F69,
+		0x5FAD, 0x60D8, 0x614E, 0x6108, 0x618E, 0x6160, 0x61F2, 0x6234,
+		0x63C4, 0x641C, 0x6452, 0x6556, 0x6674, 0x6717, 0x671B, 0x6756,
+		0x6B79, 0x6BBA, 0x6D41, 0x6EDB, 0x6ECB, 0x6F22, 0x701E, 0x716E,
+		0x77A7, 0x7235, 0x72AF, 0x732A, 0x7471, 0x7506, 0x753B, 0x761D,
+		0x761F, 0x76CA, 0x76DB, 0x76F4, 0x774A, 0x7740, 0x78CC, 0x7AB1,
+		0x7BC0, 0x7C7B, 0x7D5B, 0x7DF4, 0x7F3E, 0x8005, 0x8352, 0x83EF,
+		0x8779, 0x8941, 0x8986, 0x8996, 0x8ABF, 0x8AF8, 0x8ACB, 0x8B01,
+		0x8AFE, 0x8AED, 0x8B39, 0x8B8A, 0x8D08, 0x8F38, 0x9072, 0x9199,
+		0x9276, 0x967C, 0x96E3, 0x9756, 0x97DB, 0x97FF, 0x980B, 0x983B,
+		0x9B12, 0x9F9C, 0x2284A, 0x22844, 0x233D5, 0x3B9D, 0x4018, 0x4039,
+		0x25249, 0x25CD0, 0x27ED3, 0x9F43, 0x9F8E, 0x05D9, 0x05B4, 0x05F2,
+		0x05B7, 0x05E9, 0x05C1, 0x05E9, 0x05C2, 0x05E9, 0x05BC, 0x05C1,
+		0x05E9, 0x05BC, 0x05C2, 0x05D0, 0x05B7, 0x05D0, 0x05B8, 0x05D0,
+		0x05BC, 0x05D1, 0x05BC, 0x05D2, 0x05BC, 0x05D3, 0x05BC, 0x05D4,
+		0x05BC, 0x05D5, 0x05BC, 0x05D6, 0x05BC, 0x05D8, 0x05BC, 0x05D9,
+		0x05BC, 0x05DA, 0x05BC, 0x05DB, 0x05BC, 0x05DC, 0x05BC, 0x05DE,
+		0x05BC, 0x05E0, 0x05BC, 0x05E1, 0x05BC, 0x05E3, 0x05BC, 0x05E4,
+		0x05BC, 0x05E6, 0x05BC, 0x05E7, 0x05BC, 0x05E8, 0x05BC, 0x05E9,
+		0x05BC, 0x05EA, 0x05BC, 0x05D5, 0x05B9, 0x05D1, 0x05BF, 0x05DB,
+		0x05BF, 0x05E4, 0x05BF, 0x11099, 0x110BA, 0x1109B, 0x110BA, 0x110A5,
+		0x110BA, 0x11131, 0x11127, 0x11132, 0x11127, 0x11347, 0x1133E, 0x11347,
+		0x11357, 0x114B9, 0x114BA, 0x114B9, 0x114B0, 0x114B9, 0x114BD, 0x115B8,
+		0x115AF, 0x115B9, 0x115AF, 0x11935, 0x11930, 0x1D157, 0x1D165, 0x1D158,
+		0x1D165, 0x1D158, 0x1D165, 0x1D16E, 0x1D158, 0x1D165, 0x1D16F, 0x1D158,
+		0x1D165, 0x1D170, 0x1D158, 0x1D165, 0x1D171, 0x1D158, 0x1D165, 0x1D172,
+		0x1D1B9, 0x1D165, 0x1D1BA, 0x1D165, 0x1D1B9, 0x1D165, 0x1D16E, 0x1D1BA,
+		0x1D165, 0x1D16E, 0x1D1B9, 0x1D165, 0x1D16F, 0x1D1BA, 0x1D165, 0x1D16F,
+		0x4E3D, 0x4E38, 0x4E41, 0x20122, 0x4F60, 0x4FAE, 0x4FBB, 0x5002,
+		0x507A, 0x5099, 0x50E7, 0x50CF, 0x349E, 0x2063A, 0x514D, 0x5154,
+		0x5164, 0x5177, 0x2051C, 0x34B9, 0x5167, 0x518D, 0x2054B, 0x5197,
+		0x51A4, 0x4ECC, 0x51AC, 0x51B5, 0x291DF, 0x51F5, 0x5203, 0x34DF,
+		0x523B, 0x5246, 0x5272, 0x5277, 0x3515, 0x52C7, 0x52C9, 0x52E4,
+		0x52FA, 0x5305, 0x5306, 0x5317, 0x5349, 0x5351, 0x535A, 0x5373,
+		0x537D, 0x537F, 0x537F, 0x537F, 0x20A2C, 0x7070, 0x53CA, 0x53DF,
+		0x20B63, 0x53EB, 0x53F1, 0x5406, 0x549E, 0x5438, 0x5448, 0x5468,
+		0x54A2, 0x54F6, 0x5510, 0x5553, 0x5563, 0x5584, 0x5584, 0x5599,
+		0x55AB, 0x55B3, 0x55C2, 0x5716, 0x5606, 0x5717, 0x5651, 0x5674,
+		0x5207, 0x58EE, 0x57CE, 0x57F4, 0x580D, 0x578B, 0x5832, 0x5831,
+		0x58AC, 0x214E4, 0x58F2, 0x58F7, 0x5906, 0x591A, 0x5922, 0x5962,
+		0x216A8, 0x216EA, 0x59EC, 0x5A1B, 0x5A27, 0x59D8, 0x5A66, 0x36EE,
+		0x36FC, 0x5B08, 0x5B3E, 0x5B3E, 0x219C8, 0x5BC3, 0x5BD8, 0x5BE7,
+		0x5BF3, 0x21B18, 0x5BFF, 0x5C06, 0x5F53, 0x5C22, 0x3781, 0x5C60,
+		0x5C6E, 0x5CC0, 0x5C8D, 0x21DE4, 0x5D43, 0x21DE6, 0x5D6E, 0x5D6B,
+		0x5D7C, 0x5DE1, 0x5DE2, 0x382F, 0x5DFD, 0x5E28, 0x5E3D, 0x5E69,
+		0x3862, 0x22183, 0x387C, 0x5EB0, 0x5EB3, 0x5EB6, 0x5ECA, 0x2A392,
+		0x5EFE, 0x22331, 0x22331, 0x8201, 0x5F22, 0x5F22, 0x38C7, 0x232B8,
+		0x261DA, 0x5F62, 0x5F6B, 0x38E3, 0x5F9A, 0x5FCD, 0x5FD7, 0x5FF9,
+		0x6081, 0x393A, 0x391C, 0x6094, 0x226D4, 0x60C7, 0x6148, 0x614C,
+		0x614E, 0x614C, 0x617A, 0x618E, 0x61B2, 0x61A4, 0x61AF, 0x61DE,
+		0x61F2, 0x61F6, 0x6210, 0x621B, 0x625D, 0x62B1, 0x62D4, 0x6350,
+		0x22B0C, 0x633D, 0x62FC, 0x6368, 0x6383, 0x63E4, 0x22BF1, 0x6422,
+		0x63C5, 0x63A9, 0x3A2E, 0x6469, 0x647E, 0x649D, 0x6477, 0x3A6C,
+		0x654F, 0x656C, 0x2300A, 0x65E3, 0x66F8, 0x6649, 0x3B19, 0x6691,
+		0x3B08, 0x3AE4, 0x5192, 0x5195, 0x6700, 0x669C, 0x80AD, 0x43D9,
+		0x6717, 0x671B, 0x6721, 0x675E, 0x6753, 0x233C3, 0x3B49, 0x67FA,
+		0x6785, 0x6852, 0x6885, 0x2346D, 0x688E, 0x681F, 0x6914, 0x3B9D,
+		0x6942, 0x69A3, 0x69EA, 0x6AA8, 0x236A3, 0x6ADB, 0x3C18, 0x6B21,
+		0x238A7, 0x6B54, 0x3C4E, 0x6B72, 0x6B9F, 0x6BBA, 0x6BBB, 0x23A8D,
+		0x21D0B, 0x23AFA, 0x6C4E, 0x23CBC, 0x6CBF, 0x6CCD, 0x6C67, 0x6D16,
+		0x6D3E, 0x6D77, 0x6D41, 0x6D69, 0x6D78, 0x6D85, 0x23D1E, 0x6D34,
+		0x6E2F, 0x6E6E, 0x3D33, 0x6ECB, 0x6EC7, 0x23ED1, 0x6DF9, 0x6F6E,
+		0x23F5E, 0x23F8E, 0x6FC6, 0x7039, 0x701E, 0x701B, 0x3D96, 0x704A,
+		0x707D, 0x7077, 0x70AD, 0x20525, 0x7145, 0x24263, 0x719C, 0x243AB,
+		0x7228, 0x7235, 0x7250, 0x24608, 0x7280, 0x7295, 0x24735, 0x24814,
+		0x737A, 0x738B, 0x3EAC, 0x73A5, 0x3EB8, 0x3EB8, 0x7447, 0x745C,
+		0x7471, 0x7485, 0x74CA, 0x3F1B, 0x7524, 0x24C36, 0x753E, 0x24C92,
+		0x7570, 0x2219F, 0x7610, 0x24FA1, 0x24FB8, 0x25044, 0x3FFC, 0x4008,
+		0x76F4, 0x250F3, 0x250F2, 0x25119, 0x25133, 0x771E, 0x771F, 0x771F,
+		0x774A, 0x4039, 0x778B, 0x4046, 0x4096, 0x2541D, 0x784E, 0x788C,
+		0x78CC, 0x40E3, 0x25626, 0x7956, 0x2569A, 0x256C5, 0x798F, 0x79EB,
+		0x412F, 0x7A40, 0x7A4A, 0x7A4F, 0x2597C, 0x25AA7, 0x25AA7, 0x7AEE,
+		0x4202, 0x25BAB, 0x7BC6, 0x7BC9, 0x4227, 0x25C80, 0x7CD2, 0x42A0,
+		0x7CE8, 0x7CE3, 0x7D00, 0x25F86, 0x7D63, 0x4301, 0x7DC7, 0x7E02,
+		0x7E45, 0x4334, 0x26228, 0x26247, 0x4359, 0x262D9, 0x7F7A, 0x2633E,
+		0x7F95, 0x7FFA, 0x8005, 0x264DA, 0x26523, 0x8060, 0x265A8, 0x8070,
+		0x2335F, 0x43D5, 0x80B2, 0x8103, 0x440B, 0x813E, 0x5AB5, 0x267A7,
+		0x267B5, 0x23393, 0x2339C, 0x8201, 0x8204, 0x8F9E, 0x446B, 0x8291,
+		0x828B, 0x829D, 0x52B3, 0x82B1, 0x82B3, 0x82BD, 0x82E6, 0x26B3C,
+		0x82E5, 0x831D, 0x8363, 0x83AD, 0x8323, 0x83BD, 0x83E7, 0x8457,
+		0x8353, 0x83CA, 0x83CC, 0x83DC, 0x26C36, 0x26D6B, 0x26CD5, 0x452B,
+		0x84F1, 0x84F3, 0x8516, 0x273CA, 0x8564, 0x26F2C, 0x455D, 0x4561,
+		0x26FB1, 0x270D2, 0x456B, 0x8650, 0x865C, 0x8667, 0x8669, 0x86A9,
+		0x8688, 0x870E, 0x86E2, 0x8779, 0x8728, 0x876B, 0x8786, 0x45D7,
+		0x87E1, 0x8801, 0x45F9, 0x8860, 0x8863, 0x27667, 0x88D7, 0x88DE,
+		0x4635, 0x88FA, 0x34BB, 0x278AE, 0x27966, 0x46BE, 0x46C7, 0x8AA0,
+		0x8AED, 0x8B8A, 0x8C55, 0x27CA8, 0x8CAB, 0x8CC1, 0x8D1B, 0x8D77,
+		0x27F2F, 0x20804, 0x8DCB, 0x8DBC, 0x8DF0, 0x208DE, 0x8ED4, 0x8F38,
+		0x285D2, 0x285ED, 0x9094, 0x90F1, 0x9111, 0x2872E, 0x911B, 0x9238,
+		0x92D7, 0x92D8, 0x927C, 0x93F9, 0x9415, 0x28BFA, 0x958B, 0x4995,
+		0x95B7, 0x28D77, 0x49E6, 0x96C3, 0x5DB2, 0x9723, 0x29145, 0x2921A,
+		0x4A6E, 0x4A76, 0x97E0, 0x2940A, 0x4AB2, 0x29496, 0x980B, 0x980B,
+		0x9829, 0x295B6, 0x98E2, 0x4B33, 0x9929, 0x99A7, 0x99C2, 0x99FE,
+		0x4BCE, 0x29B30, 0x9B12, 0x9C40, 0x9CFD, 0x4CCE, 0x4CED, 0x9D67,
+		0x2A0CE, 0x4CF8, 0x2A105, 0x2A20E, 0x2A291, 0x9EBB, 0x4D56, 0x9EF9,
+		0x9EFE, 0x9F05, 0x9F0F, 0x9F16, 0x9F3B, 0x2A600, 0x0020, 0x0020,
+		0x0308, 0x0061, 0x0020, 0x0304, 0x0032, 0x0033, 0x0020, 0x0301,
+		0x03BC, 0x0020, 0x0327, 0x0031, 0x006F, 0x0031, 0x2044, 0x0034,
+		0x0031, 0x2044, 0x0032, 0x0033, 0x2044, 0x0034, 0x0041, 0x0300,
+		0x0041, 0x0301, 0x0041, 0x0302, 0x0041, 0x0303, 0x0041, 0x0308,
+		0x0041, 0x030A, 0x0043, 0x0327, 0x0045, 0x0300, 0x0045, 0x0301,
+		0x0045, 0x0302, 0x0045, 0x0308, 0x0049, 0x0300, 0x0049, 0x0301,
+		0x0049, 0x0302, 0x0049, 0x0308, 0x004E, 0x0303, 0x004F, 0x0300,
+		0x004F, 0x0301, 0x004F, 0x0302, 0x004F, 0x0303, 0x004F, 0x0308,
+		0x0055, 0x0300, 0x0055, 0x0301, 0x0055, 0x0302, 0x0055, 0x0308,
+		0x0059, 0x0301, 0x0061, 0x0300, 0x0061, 0x0301, 0x0061, 0x0302,
+		0x0061, 0x0303, 0x0061, 0x0308, 0x0061, 0x030A, 0x0063, 0x0327,
+		0x0065, 0x0300, 0x0065, 0x0301, 0x0065, 0x0302, 0x0065, 0x0308,
+		0x0069, 0x0300, 0x0069, 0x0301, 0x0069, 0x0302, 0x0069, 0x0308,
+		0x006E, 0x0303, 0x006F, 0x0300, 0x006F, 0x0301, 0x006F, 0x0302,
+		0x006F, 0x0303, 0x006F, 0x0308, 0x0075, 0x0300, 0x0075, 0x0301,
+		0x0075, 0x0302, 0x0075, 0x0308, 0x0079, 0x0301, 0x0079, 0x0308,
+		0x0041, 0x0304, 0x0061, 0x0304, 0x0041, 0x0306, 0x0061, 0x0306,
+		0x0041, 0x0328, 0x0061, 0x0328, 0x0043, 0x0301, 0x0063, 0x0301,
+		0x0043, 0x0302, 0x0063, 0x0302, 0x0043, 0x0307, 0x0063, 0x0307,
+		0x0043, 0x030C, 0x0063, 0x030C, 0x0044, 0x030C, 0x0064, 0x030C,
+		0x0045, 0x0304, 0x0065, 0x0304, 0x0045, 0x0306, 0x0065, 0x0306,
+		0x0045, 0x0307, 0x0065, 0x0307, 0x0045, 0x0328, 0x0065, 0x0328,
+		0x0045, 0x030C, 0x0065, 0x030C, 0x0047, 0x0302, 0x0067, 0x0302,
+		0x0047, 0x0306, 0x0067, 0x0306, 0x0047, 0x0307, 0x0067, 0x0307,
+		0x0047, 0x0327, 0x0067, 0x0327, 0x0048, 0x0302, 0x0068, 0x0302,
+		0x0049, 0x0303, 0x0069, 0x0303, 0x0049, 0x0304, 0x0069, 0x0304,
+		0x0049, 0x0306, 0x0069, 0x0306, 0x0049, 0x0328, 0x0069, 0x0328,
+		0x0049, 0x0307, 0x0049, 0x004A, 0x0069, 0x006A, 0x004A, 0x0302,
+		0x006A, 0x0302, 0x004B, 0x0327, 0x006B, 0x0327, 0x004C, 0x0301,
+		0x006C, 0x0301, 0x004C, 0x0327, 0x006C, 0x0327, 0x004C, 0x030C,
+		0x006C, 0x030C, 0x004C, 0x00B7, 0x006C, 0x00B7, 0x004E, 0x0301,
+		0x006E, 0x0301, 0x004E, 0x0327, 0x006E, 0x0327, 0x004E, 0x030C,
+		0x006E, 0x030C, 0x02BC, 0x006E, 0x004F, 0x0304, 0x006F, 0x0304,
+		0x004F, 0x0306, 0x006F, 0x0306, 0x004F, 0x030B, 0x006F, 0x030B,
+		0x0052, 0x0301, 0x0072, 0x0301, 0x0052, 0x0327, 0x0072, 0x0327,
+		0x0052, 0x030C, 0x0072, 0x030C, 0x0053, 0x0301, 0x0073, 0x0301,
+		0x0053, 0x0302, 0x0073, 0x0302, 0x0053, 0x0327, 0x0073, 0x0327,
+		0x0053, 0x030C, 0x0073, 0x030C, 0x0054, 0x0327, 0x0074, 0x0327,
+		0x0054, 0x030C, 0x0074, 0x030C, 0x0055, 0x0303, 0x0075, 0x0303,
+		0x0055, 0x0304, 0x0075, 0x0304, 0x0055, 0x0306, 0x0075, 0x0306,
+		0x0055, 0x030A, 0x0075, 0x030A, 0x0055, 0x030B, 0x0075, 0x030B,
+		0x0055, 0x0328, 0x0075, 0x0328, 0x0057, 0x0302, 0x0077, 0x0302,
+		0x0059, 0x0302, 0x0079, 0x0302, 0x0059, 0x0308, 0x005A, 0x0301,
+		0x007A, 0x0301, 0x005A, 0x0307, 0x007A, 0x0307, 0x005A, 0x030C,
+		0x007A, 0x030C, 0x0073, 0x004F, 0x031B, 0x006F, 0x031B, 0x0055,
+		0x031B, 0x0075, 0x031B, 0x0044, 0x005A, 0x030C, 0x0044, 0x007A,
+		0x030C, 0x0064, 0x007A, 0x030C, 0x004C, 0x004A, 0x004C, 0x006A,
+		0x006C, 0x006A, 0x004E, 0x004A, 0x004E, 0x006A, 0x006E, 0x006A,
+		0x0041, 0x030C, 0x0061, 0x030C, 0x0049, 0x030C, 0x0069, 0x030C,
+		0x004F, 0x030C, 0x006F, 0x030C, 0x0055, 0x030C, 0x0075, 0x030C,
+		0x0055, 0x0308, 0x0304, 0x0075, 0x0308, 0x0304, 0x0055, 0x0308,
+		0x0301, 0x0075, 0x0308, 0x0301, 0x0055, 0x0308, 0x030C, 0x0075,
+		0x0308, 0x030C, 0x0055, 0x0308, 0x0300, 0x0075, 0x0308, 0x0300,
+		0x0041, 0x0308, 0x0304, 0x0061, 0x0308, 0x0304, 0x0041, 0x0307,
+		0x0304, 0x0061, 0x0307, 0x0304, 0x00C6, 0x0304, 0x00E6, 0x0304,
+		0x0047, 0x030C, 0x0067, 0x030C, 0x004B, 0x030C, 0x006B, 0x030C,
+		0x004F, 0x0328, 0x006F, 0x0328, 0x004F, 0x0328, 0x0304, 0x006F,
+		0x0328, 0x0304, 0x01B7, 0x030C, 0x0292, 0x030C, 0x006A, 0x030C,
+		0x0044, 0x005A, 0x0044, 0x007A, 0x0064, 0x007A, 0x0047, 0x0301,
+		0x0067, 0x0301, 0x004E, 0x0300, 0x006E, 0x0300, 0x0041, 0x030A,
+		0x0301, 0x0061, 0x030A, 0x0301, 0x00C6, 0x0301, 0x00E6, 0x0301,
+		0x00D8, 0x0301, 0x00F8, 0x0301, 0x0041, 0x030F, 0x0061, 0x030F,
+		0x0041, 0x0311, 0x0061, 0x0311, 0x0045, 0x030F, 0x0065, 0x030F,
+		0x0045, 0x0311, 0x0065, 0x0311, 0x0049, 0x030F, 0x0069, 0x030F,
+		0x0049, 0x0311, 0x0069, 0x0311, 0x004F, 0x030F, 0x006F, 0x030F,
+		0x004F, 0x0311, 0x006F, 0x0311, 0x0052, 0x030F, 0x0072, 0x030F,
+		0x0052, 0x0311, 0x0072, 0x0311, 0x0055, 0x030F, 0x0075, 0x030F,
+		0x0055, 0x0311, 0x0075, 0x0311, 0x0053, 0x0326, 0x0073, 0x0326,
+		0x0054, 0x0326, 0x0074, 0x0326, 0x0048, 0x030C, 0x0068, 0x030C,
+		0x0041, 0x0307, 0x0061, 0x0307, 0x0045, 0x0327, 0x0065, 0x0327,
+		0x004F, 0x0308, 0x0304, 0x006F, 0x0308, 0x0304, 0x004F, 0x0303,
+		0x0304, 0x006F, 0x0303, 0x0304, 0x004F, 0x0307, 0x006F, 0x0307,
+		0x004F, 0x0307, 0x0304, 0x006F, 0x0307, 0x0304, 0x0059, 0x0304,
+		0x0079, 0x0304, 0x0068, 0x0266, 0x006A, 0x0072, 0x0279, 0x027B,
+		0x0281, 0x0077, 0x0079, 0x0020, 0x0306, 0x0020, 0x0307, 0x0020,
+		0x030A, 0x0020, 0x0328, 0x0020, 0x0303, 0x0020, 0x030B, 0x0263,
+		0x006C, 0x0073, 0x0078, 0x0295, 0x0300, 0x0301, 0x0313, 0x0308,
+		0x0301, 0x02B9, 0x0020, 0x0345, 0x003B, 0x0020, 0x0301, 0x0020,
+		0x0308, 0x0301, 0x0391, 0x0301, 0x00B7, 0x0395, 0x0301, 0x0397,
+		0x0301, 0x0399, 0x0301, 0x039F, 0x0301, 0x03A5, 0x0301, 0x03A9,
+		0x0301, 0x03B9, 0x0308, 0x0301, 0x0399, 0x0308, 0x03A5, 0x0308,
+		0x03B1, 0x0301, 0x03B5, 0x0301, 0x03B7, 0x0301, 0x03B9, 0x0301,
+		0x03C5, 0x0308, 0x0301, 0x03B9, 0x0308, 0x03C5, 0x0308, 0x03BF,
+		0x0301, 0x03C5, 0x0301, 0x03C9, 0x0301, 0x03B2, 0x03B8, 0x03A5,
+		0x03A5, 0x0301, 0x03A5, 0x0308, 0x03C6, 0x03C0, 0x03BA, 0x03C1,
+		0x03C2, 0x0398, 0x03B5, 0x03A3, 0x0415, 0x0300, 0x0415, 0x0308,
+		0x0413, 0x0301, 0x0406, 0x0308, 0x041A, 0x0301, 0x0418, 0x0300,
+		0x0423, 0x0306, 0x0418, 0x0306, 0x0438, 0x0306, 0x0435, 0x0300,
+		0x0435, 0x0308, 0x0433, 0x0301, 0x0456, 0x0308, 0x043A, 0x0301,
+		0x0438, 0x0300, 0x0443, 0x0306, 0x0474, 0x030F, 0x0475, 0x030F,
+		0x0416, 0x0306, 0x0436, 0x0306, 0x0410, 0x0306, 0x0430, 0x0306,
+		0x0410, 0x0308, 0x0430, 0x0308, 0x0415, 0x0306, 0x0435, 0x0306,
+		0x04D8, 0x0308, 0x04D9, 0x0308, 0x0416, 0x0308, 0x0436, 0x0308,
+		0x0417, 0x0308, 0x0437, 0x0308, 0x0418, 0x0304, 0x0438, 0x0304,
+		0x0418, 0x0308, 0x0438, 0x0308, 0x041E, 0x0308, 0x043E, 0x0308,
+		0x04E8, 0x0308, 0x04E9, 0x0308, 0x042D, 0x0308, 0x044D, 0x0308,
+		0x0423, 0x0304, 0x0443, 0x0304, 0x0423, 0x0308, 0x0443, 0x0308,
+		0x0423, 0x030B, 0x0443, 0x030B, 0x0427, 0x0308, 0x0447, 0x0308,
+		0x042B, 0x0308, 0x044B, 0x0308, 0x0565, 0x0582, 0x0627, 0x0653,
+		0x0627, 0x0654, 0x0648, 0x0654, 0x0627, 0x0655, 0x064A, 0x0654,
+		0x0627, 0x0674, 0x0648, 0x0674, 0x06C7, 0x0674, 0x064A, 0x0674,
+		0x06D5, 0x0654, 0x06C1, 0x0654, 0x06D2, 0x0654, 0x0928, 0x093C,
+		0x0930, 0x093C, 0x0933, 0x093C, 0x0915, 0x093C, 0x0916, 0x093C,
+		0x0917, 0x093C, 0x091C, 0x093C, 0x0921, 0x093C, 0x0922, 0x093C,
+		0x092B, 0x093C, 0x092F, 0x093C, 0x09C7, 0x09BE, 0x09C7, 0x09D7,
+		0x09A1, 0x09BC, 0x09A2, 0x09BC, 0x09AF, 0x09BC, 0x0A32, 0x0A3C,
+		0x0A38, 0x0A3C, 0x0A16, 0x0A3C, 0x0A17, 0x0A3C, 0x0A1C, 0x0A3C,
+		0x0A2B, 0x0A3C, 0x0B47, 0x0B56, 0x0B47, 0x0B3E, 0x0B47, 0x0B57,
+		0x0B21, 0x0B3C, 0x0B22, 0x0B3C, 0x0B92, 0x0BD7, 0x0BC6, 0x0BBE,
+		0x0BC7, 0x0BBE, 0x0BC6, 0x0BD7, 0x0C46, 0x0C56, 0x0CBF, 0x0CD5,
+		0x0CC6, 0x0CD5, 0x0CC6, 0x0CD6, 0x0CC6, 0x0CC2, 0x0CC6, 0x0CC2,
+		0x0CD5, 0x0D46, 0x0D3E, 0x0D47, 0x0D3E, 0x0D46, 0x0D57, 0x0DD9,
+		0x0DCA, 0x0DD9, 0x0DCF, 0x0DD9, 0x0DCF, 0x0DCA, 0x0DD9, 0x0DDF,
+		0x0E4D, 0x0E32, 0x0ECD, 0x0EB2, 0x0EAB, 0x0E99, 0x0EAB, 0x0EA1,
+		0x0F0B, 0x0F42, 0x0FB7, 0x0F4C, 0x0FB7, 0x0F51, 0x0FB7, 0x0F56,
+		0x0FB7, 0x0F5B, 0x0FB7, 0x0F40, 0x0FB5, 0x0F71, 0x0F72, 0x0F71,
+		0x0F74, 0x0FB2, 0x0F80, 0x0FB2, 0x0F71, 0x0F80, 0x0FB3, 0x0F80,
+		0x0FB3, 0x0F71, 0x0F80, 0x0F71, 0x0F80, 0x0F92, 0x0FB7, 0x0F9C,
+		0x0FB7, 0x0FA1, 0x0FB7, 0x0FA6, 0x0FB7, 0x0FAB, 0x0FB7, 0x0F90,
+		0x0FB5, 0x1025, 0x102E, 0x10DC, 0x1B05, 0x1B35, 0x1B07, 0x1B35,
+		0x1B09, 0x1B35, 0x1B0B, 0x1B35, 0x1B0D, 0x1B35, 0x1B11, 0x1B35,
+		0x1B3A, 0x1B35, 0x1B3C, 0x1B35, 0x1B3E, 0x1B35, 0x1B3F, 0x1B35,
+		0x1B42, 0x1B35, 0x0041, 0x00C6, 0x0042, 0x0044, 0x0045, 0x018E,
+		0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E,
+		0x004F, 0x0222, 0x0050, 0x0052, 0x0054, 0x0055, 0x0057, 0x0061,
+		0x0250, 0x0251, 0x1D02, 0x0062, 0x0064, 0x0065, 0x0259, 0x025B,
+		0x025C, 0x0067, 0x006B, 0x006D, 0x014B, 0x006F, 0x0254, 0x1D16,
+		0x1D17, 0x0070, 0x0074, 0x0075, 0x1D1D, 0x026F, 0x0076, 0x1D25,
+		0x03B2, 0x03B3, 0x03B4, 0x03C6, 0x03C7, 0x0069, 0x0072, 0x0075,
+		0x0076, 0x03B2, 0x03B3, 0x03C1, 0x03C6, 0x03C7, 0x043D, 0x0252,
+		0x0063, 0x0255, 0x00F0, 0x025C, 0x0066, 0x025F, 0x0261, 0x0265,
+		0x0268, 0x0269, 0x026A, 0x1D7B, 0x029D, 0x026D, 0x1D85, 0x029F,
+		0x0271, 0x0270, 0x0272, 0x0273, 0x0274, 0x0275, 0x0278, 0x0282,
+		0x0283, 0x01AB, 0x0289, 0x028A, 0x1D1C, 0x028B, 0x028C, 0x007A,
+		0x0290, 0x0291, 0x0292, 0x03B8, 0x0041, 0x0325, 0x0061, 0x0325,
+		0x0042, 0x0307, 0x0062, 0x0307, 0x0042, 0x0323, 0x0062, 0x0323,
+		0x0042, 0x0331, 0x0062, 0x0331, 0x0043, 0x0327, 0x0301, 0x0063,
+		0x0327, 0x0301, 0x0044, 0x0307, 0x0064, 0x0307, 0x0044, 0x0323,
+		0x0064, 0x0323, 0x0044, 0x0331, 0x0064, 0x0331, 0x0044, 0x0327,
+		0x0064, 0x0327, 0x0044, 0x032D, 0x0064, 0x032D, 0x0045, 0x0304,
+		0x0300, 0x0065, 0x0304, 0x0300, 0x0045, 0x0304, 0x0301, 0x0065,
+		0x0304, 0x0301, 0x0045, 0x032D, 0x0065, 0x032D, 0x0045, 0x0330,
+		0x0065, 0x0330, 0x0045, 0x0327, 0x0306, 0x0065, 0x0327, 0x0306,
+		0x0046, 0x0307, 0x0066, 0x0307, 0x0047, 0x0304, 0x0067, 0x0304,
+		0x0048, 0x0307, 0x0068, 0x0307, 0x0048, 0x0323, 0x0068, 0x0323,
+		0x0048, 0x0308, 0x0068, 0x0308, 0x0048, 0x0327, 0x0068, 0x0327,
+		0x0048, 0x032E, 0x0068, 0x032E, 0x0049, 0x0330, 0x0069, 0x0330,
+		0x0049, 0x0308, 0x0301, 0x0069, 0x0308, 0x0301, 0x004B, 0x0301,
+		0x006B, 0x0301, 0x004B, 0x0323, 0x006B, 0x0323, 0x004B, 0x0331,
+		0x006B, 0x0331, 0x004C, 0x0323, 0x006C, 0x0323, 0x004C, 0x0323,
+		0x0304, 0x006C, 0x0323, 0x0304, 0x004C, 0x0331, 0x006C, 0x0331,
+		0x004C, 0x032D, 0x006C, 0x032D, 0x004D, 0x0301, 0x006D, 0x0301,
+		0x004D, 0x0307, 0x006D, 0x0307, 0x004D, 0x0323, 0x006D, 0x0323,
+		0x004E, 0x0307, 0x006E, 0x0307, 0x004E, 0x0323, 0x006E, 0x0323,
+		0x004E, 0x0331, 0x006E, 0x0331, 0x004E, 0x032D, 0x006E, 0x032D,
+		0x004F, 0x0303, 0x0301, 0x006F, 0x0303, 0x0301, 0x004F, 0x0303,
+		0x0308, 0x006F, 0x0303, 0x0308, 0x004F, 0x0304, 0x0300, 0x006F,
+		0x0304, 0x0300, 0x004F, 0x0304, 0x0301, 0x006F, 0x0304, 0x0301,
+		0x0050, 0x0301, 0x0070, 0x0301, 0x0050, 0x0307, 0x0070, 0x0307,
+		0x0052, 0x0307, 0x0072, 0x0307, 0x0052, 0x0323, 0x0072, 0x0323,
+		0x0052, 0x0323, 0x0304, 0x0072, 0x0323, 0x0304, 0x0052, 0x0331,
+		0x0072, 0x0331, 0x0053, 0x0307, 0x0073, 0x0307, 0x0053, 0x0323,
+		0x0073, 0x0323, 0x0053, 0x0301, 0x0307, 0x0073, 0x0301, 0x0307,
+		0x0053, 0x030C, 0x0307, 0x0073, 0x030C, 0x0307, 0x0053, 0x0323,
+		0x0307, 0x0073, 0x0323, 0x0307, 0x0054, 0x0307, 0x0074, 0x0307,
+		0x0054, 0x0323, 0x0074, 0x0323, 0x0054, 0x0331, 0x0074, 0x0331,
+		0x0054, 0x032D, 0x0074, 0x032D, 0x0055, 0x0324, 0x0075, 0x0324,
+		0x0055, 0x0330, 0x0075, 0x0330, 0x0055, 0x032D, 0x0075, 0x032D,
+		0x0055, 0x0303, 0x0301, 0x0075, 0x0303, 0x0301, 0x0055, 0x0304,
+		0x0308, 0x0075, 0x0304, 0x0308, 0x0056, 0x0303, 0x0076, 0x0303,
+		0x0056, 0x0323, 0x0076, 0x0323, 0x0057, 0x0300, 0x0077, 0x0300,
+		0x0057, 0x0301, 0x0077, 0x0301, 0x0057, 0x0308, 0x0077, 0x0308,
+		0x0057, 0x0307, 0x0077, 0x0307, 0x0057, 0x0323, 0x0077, 0x0323,
+		0x0058, 0x0307, 0x0078, 0x0307, 0x0058, 0x0308, 0x0078, 0x0308,
+		0x0059, 0x0307, 0x0079, 0x0307, 0x005A, 0x0302, 0x007A, 0x0302,
+		0x005A, 0x0323, 0x007A, 0x0323, 0x005A, 0x0331, 0x007A, 0x0331,
+		0x0068, 0x0331, 0x0074, 0x0308, 0x0077, 0x030A, 0x0079, 0x030A,
+		0x0061, 0x02BE, 0x0073, 0x0307, 0x0041, 0x0323, 0x0061, 0x0323,
+		0x0041, 0x0309, 0x0061, 0x0309, 0x0041, 0x0302, 0x0301, 0x0061,
+		0x0302, 0x0301, 0x0041, 0x0302, 0x0300, 0x0061, 0x0302, 0x0300,
+		0x0041, 0x0302, 0x0309, 0x0061, 0x0302, 0x0309, 0x0041, 0x0302,
+		0x0303, 0x0061, 0x0302, 0x0303, 0x0041, 0x0323, 0x0302, 0x0061,
+		0x0323, 0x0302, 0x0041, 0x0306, 0x0301, 0x0061, 0x0306, 0x0301,
+		0x0041, 0x0306, 0x0300, 0x0061, 0x0306, 0x0300, 0x0041, 0x0306,
+		0x0309, 0x0061, 0x0306, 0x0309, 0x0041, 0x0306, 0x0303, 0x0061,
+		0x0306, 0x0303, 0x0041, 0x0323, 0x0306, 0x0061, 0x0323, 0x0306,
+		0x0045, 0x0323, 0x0065, 0x0323, 0x0045, 0x0309, 0x0065, 0x0309,
+		0x0045, 0x0303, 0x0065, 0x0303, 0x0045, 0x0302, 0x0301, 0x0065,
+		0x0302, 0x0301, 0x0045, 0x0302, 0x0300, 0x0065, 0x0302, 0x0300,
+		0x0045, 0x0302, 0x0309, 0x0065, 0x0302, 0x0309, 0x0045, 0x0302,
+		0x0303, 0x0065, 0x0302, 0x0303, 0x0045, 0x0323, 0x0302, 0x0065,
+		0x0323, 0x0302, 0x0049, 0x0309, 0x0069, 0x0309, 0x0049, 0x0323,
+		0x0069, 0x0323, 0x004F, 0x0323, 0x006F, 0x0323, 0x004F, 0x0309,
+		0x006F, 0x0309, 0x004F, 0x0302, 0x0301, 0x006F, 0x0302, 0x0301,
+		0x004F, 0x0302, 0x0300, 0x006F, 0x0302, 0x0300, 0x004F, 0x0302,
+		0x0309, 0x006F, 0x0302, 0x0309, 0x004F, 0x0302, 0x0303, 0x006F,
+		0x0302, 0x0303, 0x004F, 0x0323, 0x0302, 0x006F, 0x0323, 0x0302,
+		0x004F, 0x031B, 0x0301, 0x006F, 0x031B, 0x0301, 0x004F, 0x031B,
+		0x0300, 0x006F, 0x031B, 0x0300, 0x004F, 0x031B, 0x0309, 0x006F,
+		0x031B, 0x0309, 0x004F, 0x031B, 0x0303, 0x006F, 0x031B, 0x0303,
+		0x004F, 0x031B, 0x0323, 0x006F, 0x031B, 0x0323, 0x0055, 0x0323,
+		0x0075, 0x0323, 0x0055, 0x0309, 0x0075, 0x0309, 0x0055, 0x031B,
+		0x0301, 0x0075, 0x031B, 0x0301, 0x0055, 0x031B, 0x0300, 0x0075,
+		0x031B, 0x0300, 0x0055, 0x031B, 0x0309, 0x0075, 0x031B, 0x0309,
+		0x0055, 0x031B, 0x0303, 0x0075, 0x031B, 0x0303, 0x0055, 0x031B,
+		0x0323, 0x0075, 0x031B, 0x0323, 0x0059, 0x0300, 0x0079, 0x0300,
+		0x0059, 0x0323, 0x0079, 0x0323, 0x0059, 0x0309, 0x0079, 0x0309,
+		0x0059, 0x0303, 0x0079, 0x0303, 0x03B1, 0x0313, 0x03B1, 0x0314,
+		0x03B1, 0x0313, 0x0300, 0x03B1, 0x0314, 0x0300, 0x03B1, 0x0313,
+		0x0301, 0x03B1, 0x0314, 0x0301, 0x03B1, 0x0313, 0x0342, 0x03B1,
+		0x0314, 0x0342, 0x0391, 0x0313, 0x0391, 0x0314, 0x0391, 0x0313,
+		0x0300, 0x0391, 0x0314, 0x0300, 0x0391, 0x0313, 0x0301, 0x0391,
+		0x0314, 0x0301, 0x0391, 0x0313, 0x0342, 0x0391, 0x0314, 0x0342,
+		0x03B5, 0x0313, 0x03B5, 0x0314, 0x03B5, 0x0313, 0x0300, 0x03B5,
+		0x0314, 0x0300, 0x03B5, 0x0313, 0x0301, 0x03B5, 0x0314, 0x0301,
+		0x0395, 0x0313, 0x0395, 0x0314, 0x0395, 0x0313, 0x0300, 0x0395,
+		0x0314, 0x0300, 0x0395, 0x0313, 0x0301, 0x0395, 0x0314, 0x0301,
+		0x03B7, 0x0313, 0x03B7, 0x0314, 0x03B7, 0x0313, 0x0300, 0x03B7,
+		0x0314, 0x0300, 0x03B7, 0x0313, 0x0301, 0x03B7, 0x0314, 0x0301,
+		0x03B7, 0x0313, 0x0342, 0x03B7, 0x0314, 0x0342, 0x0397, 0x0313,
+		0x0397, 0x0314, 0x0397, 0x0313, 0x0300, 0x0397, 0x0314, 0x0300,
+		0x0397, 0x0313, 0x0301, 0x0397, 0x0314, 0x0301, 0x0397, 0x0313,
+		0x0342, 0x0397, 0x0314, 0x0342, 0x03B9, 0x0313, 0x03B9, 0x0314,
+		0x03B9, 0x0313, 0x0300, 0x03B9, 0x0314, 0x0300, 0x03B9, 0x0313,
+		0x0301, 0x03B9, 0x0314, 0x0301, 0x03B9, 0x0313, 0x0342, 0x03B9,
+		0x0314, 0x0342, 0x0399, 0x0313, 0x0399, 0x0314, 0x0399, 0x0313,
+		0x0300, 0x0399, 0x0314, 0x0300, 0x0399, 0x0313, 0x0301, 0x0399,
+		0x0314, 0x0301, 0x0399, 0x0313, 0x0342, 0x0399, 0x0314, 0x0342,
+		0x03BF, 0x0313, 0x03BF, 0x0314, 0x03BF, 0x0313, 0x0300, 0x03BF,
+		0x0314, 0x0300, 0x03BF, 0x0313, 0x0301, 0x03BF, 0x0314, 0x0301,
+		0x039F, 0x0313, 0x039F, 0x0314, 0x039F, 0x0313, 0x0300, 0x039F,
+		0x0314, 0x0300, 0x039F, 0x0313, 0x0301, 0x039F, 0x0314, 0x0301,
+		0x03C5, 0x0313, 0x03C5, 0x0314, 0x03C5, 0x0313, 0x0300, 0x03C5,
+		0x0314, 0x0300, 0x03C5, 0x0313, 0x0301, 0x03C5, 0x0314, 0x0301,
+		0x03C5, 0x0313, 0x0342, 0x03C5, 0x0314, 0x0342, 0x03A5, 0x0314,
+		0x03A5, 0x0314, 0x0300, 0x03A5, 0x0314, 0x0301, 0x03A5, 0x0314,
+		0x0342, 0x03C9, 0x0313, 0x03C9, 0x0314, 0x03C9, 0x0313, 0x0300,
+		0x03C9, 0x0314, 0x0300, 0x03C9, 0x0313, 0x0301, 0x03C9, 0x0314,
+		0x0301, 0x03C9, 0x0313, 0x0342, 0x03C9, 0x0314, 0x0342, 0x03A9,
+		0x0313, 0x03A9, 0x0314, 0x03A9, 0x0313, 0x0300, 0x03A9, 0x0314,
+		0x0300, 0x03A9, 0x0313, 0x0301, 0x03A9, 0x0314, 0x0301, 0x03A9,
+		0x0313, 0x0342, 0x03A9, 0x0314, 0x0342, 0x03B1, 0x0300, 0x03B1,
+		0x0301, 0x03B5, 0x0300, 0x03B5, 0x0301, 0x03B7, 0x0300, 0x03B7,
+		0x0301, 0x03B9, 0x0300, 0x03B9, 0x0301, 0x03BF, 0x0300, 0x03BF,
+		0x0301, 0x03C5, 0x0300, 0x03C5, 0x0301, 0x03C9, 0x0300, 0x03C9,
+		0x0301, 0x03B1, 0x0313, 0x0345, 0x03B1, 0x0314, 0x0345, 0x03B1,
+		0x0313, 0x0300, 0x0345, 0x03B1, 0x0314, 0x0300, 0x0345, 0x03B1,
+		0x0313, 0x0301, 0x0345, 0x03B1, 0x0314, 0x0301, 0x0345, 0x03B1,
+		0x0313, 0x0342, 0x0345, 0x03B1, 0x0314, 0x0342, 0x0345, 0x0391,
+		0x0313, 0x0345, 0x0391, 0x0314, 0x0345, 0x0391, 0x0313, 0x0300,
+		0x0345, 0x0391, 0x0314, 0x0300, 0x0345, 0x0391, 0x0313, 0x0301,
+		0x0345, 0x0391, 0x0314, 0x0301, 0x0345, 0x0391, 0x0313, 0x0342,
+		0x0345, 0x0391, 0x0314, 0x0342, 0x0345, 0x03B7, 0x0313, 0x0345,
+		0x03B7, 0x0314, 0x0345, 0x03B7, 0x0313, 0x0300, 0x0345, 0x03B7,
+		0x0314, 0x0300, 0x0345, 0x03B7, 0x0313, 0x0301, 0x0345, 0x03B7,
+		0x0314, 0x0301, 0x0345, 0x03B7, 0x0313, 0x0342, 0x0345, 0x03B7,
+		0x0314, 0x0342, 0x0345, 0x0397, 0x0313, 0x0345, 0x0397, 0x0314,
+		0x0345, 0x0397, 0x0313, 0x0300, 0x0345, 0x0397, 0x0314, 0x0300,
+		0x0345, 0x0397, 0x0313, 0x0301, 0x0345, 0x0397, 0x0314, 0x0301,
+		0x0345, 0x0397, 0x0313, 0x0342, 0x0345, 0x0397, 0x0314, 0x0342,
+		0x0345, 0x03C9, 0x0313, 0x0345, 0x03C9, 0x0314, 0x0345, 0x03C9,
+		0x0313, 0x0300, 0x0345, 0x03C9, 0x0314, 0x0300, 0x0345, 0x03C9,
+		0x0313, 0x0301, 0x0345, 0x03C9, 0x0314, 0x0301, 0x0345, 0x03C9,
+		0x0313, 0x0342, 0x0345, 0x03C9, 0x0314, 0x0342, 0x0345, 0x03A9,
+		0x0313, 0x0345, 0x03A9, 0x0314, 0x0345, 0x03A9, 0x0313, 0x0300,
+		0x0345, 0x03A9, 0x0314, 0x0300, 0x0345, 0x03A9, 0x0313, 0x0301,
+		0x0345, 0x03A9, 0x0314, 0x0301, 0x0345, 0x03A9, 0x0313, 0x0342,
+		0x0345, 0x03A9, 0x0314, 0x0342, 0x0345, 0x03B1, 0x0306, 0x03B1,
+		0x0304, 0x03B1, 0x0300, 0x0345, 0x03B1, 0x0345, 0x03B1, 0x0301,
+		0x0345, 0x03B1, 0x0342, 0x03B1, 0x0342, 0x0345, 0x0391, 0x0306,
+		0x0391, 0x0304, 0x0391, 0x0300, 0x0391, 0x0301, 0x0391, 0x0345,
+		0x0020, 0x0313, 0x03B9, 0x0020, 0x0313, 0x0020, 0x0342, 0x0020,
+		0x0308, 0x0342, 0x03B7, 0x0300, 0x0345, 0x03B7, 0x0345, 0x03B7,
+		0x0301, 0x0345, 0x03B7, 0x0342, 0x03B7, 0x0342, 0x0345, 0x0395,
+		0x0300, 0x0395, 0x0301, 0x0397, 0x0300, 0x0397, 0x0301, 0x0397,
+		0x0345, 0x0020, 0x0313, 0x0300, 0x0020, 0x0313, 0x0301, 0x0020,
+		0x0313, 0x0342, 0x03B9, 0x0306, 0x03B9, 0x0304, 0x03B9, 0x0308,
+		0x0300, 0x03B9, 0x0308, 0x0301, 0x03B9, 0x0342, 0x03B9, 0x0308,
+		0x0342, 0x0399, 0x0306, 0x0399, 0x0304, 0x0399, 0x0300, 0x0399,
+		0x0301, 0x0020, 0x0314, 0x0300, 0x0020, 0x0314, 0x0301, 0x0020,
+		0x0314, 0x0342, 0x03C5, 0x0306, 0x03C5, 0x0304, 0x03C5, 0x0308,
+		0x0300, 0x03C5, 0x0308, 0x0301, 0x03C1, 0x0313, 0x03C1, 0x0314,
+		0x03C5, 0x0342, 0x03C5, 0x0308, 0x0342, 0x03A5, 0x0306, 0x03A5,
+		0x0304, 0x03A5, 0x0300, 0x03A5, 0x0301, 0x03A1, 0x0314, 0x0020,
+		0x0308, 0x0300, 0x0020, 0x0308, 0x0301, 0x0060, 0x03C9, 0x0300,
+		0x0345, 0x03C9, 0x0345, 0x03C9, 0x0301, 0x0345, 0x03C9, 0x0342,
+		0x03C9, 0x0342, 0x0345, 0x039F, 0x0300, 0x039F, 0x0301, 0x03A9,
+		0x0300, 0x03A9, 0x0301, 0x03A9, 0x0345, 0x0020, 0x0301, 0x0020,
+		0x0314, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+		0x0020, 0x0020, 0x0020, 0x0020, 0x2010, 0x0020, 0x0333, 0x002E,
+		0x002E, 0x002E, 0x002E, 0x002E, 0x002E, 0x0020, 0x2032, 0x2032,
+		0x2032, 0x2032, 0x2032, 0x2035, 0x2035, 0x2035, 0x2035, 0x2035,
+		0x0021, 0x0021, 0x0020, 0x0305, 0x003F, 0x003F, 0x003F, 0x0021,
+		0x0021, 0x003F, 0x2032, 0x2032, 0x2032, 0x2032, 0x0020, 0x0030,
+		0x0069, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x002B,
+		0x2212, 0x003D, 0x0028, 0x0029, 0x006E, 0x0030, 0x0031, 0x0032,
+		0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x002B,
+		0x2212, 0x003D, 0x0028, 0x0029, 0x0061, 0x0065, 0x006F, 0x0078,
+		0x0259, 0x0068, 0x006B, 0x006C, 0x006D, 0x006E, 0x0070, 0x0073,
+		0x0074, 0x0052, 0x0073, 0x0061, 0x002F, 0x0063, 0x0061, 0x002F,
+		0x0073, 0x0043, 0x00B0, 0x0043, 0x0063, 0x002F, 0x006F, 0x0063,
+		0x002F, 0x0075, 0x0190, 0x00B0, 0x0046, 0x0067, 0x0048, 0x0048,
+		0x0048, 0x0068, 0x0127, 0x0049, 0x0049, 0x004C, 0x006C, 0x004E,
+		0x004E, 0x006F, 0x0050, 0x0051, 0x0052, 0x0052, 0x0052, 0x0053,
+		0x004D, 0x0054, 0x0045, 0x004C, 0x0054, 0x004D, 0x005A, 0x03A9,
+		0x005A, 0x004B, 0x0041, 0x030A, 0x0042, 0x0043, 0x0065, 0x0045,
+		0x0046, 0x004D, 0x006F, 0x05D0, 0x05D1, 0x05D2, 0x05D3, 0x0069,
+		0x0046, 0x0041, 0x0058, 0x03C0, 0x03B3, 0x0393, 0x03A0, 0x2211,
+		0x0044, 0x0064, 0x0065, 0x0069, 0x006A, 0x0031, 0x2044, 0x0037,
+		0x0031, 0x2044, 0x0039, 0x0031, 0x2044, 0x0031, 0x0030, 0x0031,
+		0x2044, 0x0033, 0x0032, 0x2044, 0x0033, 0x0031, 0x2044, 0x0035,
+		0x0032, 0x2044, 0x0035, 0x0033, 0x2044, 0x0035, 0x0034, 0x2044,
+		0x0035, 0x0031, 0x2044, 0x0036, 0x0035, 0x2044, 0x0036, 0x0031,
+		0x2044, 0x0038, 0x0033, 0x2044, 0x0038, 0x0035, 0x2044, 0x0038,
+		0x0037, 0x2044, 0x0038, 0x0031, 0x2044, 0x0049, 0x0049, 0x0049,
+		0x0049, 0x0049, 0x0049, 0x0049, 0x0056, 0x0056, 0x0056, 0x0049,
+		0x0056, 0x0049, 0x0049, 0x0056, 0x0049, 0x0049, 0x0049, 0x0049,
+		0x0058, 0x0058, 0x0058, 0x0049, 0x0058, 0x0049, 0x0049, 0x004C,
+		0x0043, 0x0044, 0x004D, 0x0069, 0x0069, 0x0069, 0x0069, 0x0069,
+		0x0069, 0x0069, 0x0076, 0x0076, 0x0076, 0x0069, 0x0076, 0x0069,
+		0x0069, 0x0076, 0x0069, 0x0069, 0x0069, 0x0069, 0x0078, 0x0078,
+		0x0078, 0x0069, 0x0078, 0x0069, 0x0069, 0x006C, 0x0063, 0x0064,
+		0x006D, 0x0030, 0x2044, 0x0033, 0x2190, 0x0338, 0x2192, 0x0338,
+		0x2194, 0x0338, 0x21D0, 0x0338, 0x21D4, 0x0338, 0x21D2, 0x0338,
+		0x2203, 0x0338, 0x2208, 0x0338, 0x220B, 0x0338, 0x2223, 0x0338,
+		0x2225, 0x0338, 0x222B, 0x222B, 0x222B, 0x222B, 0x222B, 0x222E,
+		0x222E, 0x222E, 0x222E, 0x222E, 0x223C, 0x0338, 0x2243, 0x0338,
+		0x2245, 0x0338, 0x2248, 0x0338, 0x003D, 0x0338, 0x2261, 0x0338,
+		0x224D, 0x0338, 0x003C, 0x0338, 0x003E, 0x0338, 0x2264, 0x0338,
+		0x2265, 0x0338, 0x2272, 0x0338, 0x2273, 0x0338, 0x2276, 0x0338,
+		0x2277, 0x0338, 0x227A, 0x0338, 0x227B, 0x0338, 0x2282, 0x0338,
+		0x2283, 0x0338, 0x2286, 0x0338, 0x2287, 0x0338, 0x22A2, 0x0338,
+		0x22A8, 0x0338, 0x22A9, 0x0338, 0x22AB, 0x0338, 0x227C, 0x0338,
+		0x227D, 0x0338, 0x2291, 0x0338, 0x2292, 0x0338, 0x22B2, 0x0338,
+		0x22B3, 0x0338, 0x22B4, 0x0338, 0x22B5, 0x0338, 0x3008, 0x3009,
+		0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038,
+		0x0039, 0x0031, 0x0030, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031,
+		0x0033, 0x0031, 0x0034, 0x0031, 0x0035, 0x0031, 0x0036, 0x0031,
+		0x0037, 0x0031, 0x0038, 0x0031, 0x0039, 0x0032, 0x0030, 0x0028,
+		0x0031, 0x0029, 0x0028, 0x0032, 0x0029, 0x0028, 0x0033, 0x0029,
+		0x0028, 0x0034, 0x0029, 0x0028, 0x0035, 0x0029, 0x0028, 0x0036,
+		0x0029, 0x0028, 0x0037, 0x0029, 0x0028, 0x0038, 0x0029, 0x0028,
+		0x0039, 0x0029, 0x0028, 0x0031, 0x0030, 0x0029, 0x0028, 0x0031,
+		0x0031, 0x0029, 0x0028, 0x0031, 0x0032, 0x0029, 0x0028, 0x0031,
+		0x0033, 0x0029, 0x0028, 0x0031, 0x0034, 0x0029, 0x0028, 0x0031,
+		0x0035, 0x0029, 0x0028, 0x0031, 0x0036, 0x0029, 0x0028, 0x0031,
+		0x0037, 0x0029, 0x0028, 0x0031, 0x0038, 0x0029, 0x0028, 0x0031,
+		0x0039, 0x0029, 0x0028, 0x0032, 0x0030, 0x0029, 0x0031, 0x002E,
+		0x0032, 0x002E, 0x0033, 0x002E, 0x0034, 0x002E, 0x0035, 0x002E,
+		0x0036, 0x002E, 0x0037, 0x002E, 0x0038, 0x002E, 0x0039, 0x002E,
+		0x0031, 0x0030, 0x002E, 0x0031, 0x0031, 0x002E, 0x0031, 0x0032,
+		0x002E, 0x0031, 0x0033, 0x002E, 0x0031, 0x0034, 0x002E, 0x0031,
+		0x0035, 0x002E, 0x0031, 0x0036, 0x002E, 0x0031, 0x0037, 0x002E,
+		0x0031, 0x0038, 0x002E, 0x0031, 0x0039, 0x002E, 0x0032, 0x0030,
+		0x002E, 0x0028, 0x0061, 0x0029, 0x0028, 0x0062, 0x0029, 0x0028,
+		0x0063, 0x0029, 0x0028, 0x0064, 0x0029, 0x0028, 0x0065, 0x0029,
+		0x0028, 0x0066, 0x0029, 0x0028, 0x0067, 0x0029, 0x0028, 0x0068,
+		0x0029, 0x0028, 0x0069, 0x0029, 0x0028, 0x006A, 0x0029, 0x0028,
+		0x006B, 0x0029, 0x0028, 0x006C, 0x0029, 0x0028, 0x006D, 0x0029,
+		0x0028, 0x006E, 0x0029, 0x0028, 0x006F, 0x0029, 0x0028, 0x0070,
+		0x0029, 0x0028, 0x0071, 0x0029, 0x0028, 0x0072, 0x0029, 0x0028,
+		0x0073, 0x0029, 0x0028, 0x0074, 0x0029, 0x0028, 0x0075, 0x0029,
+		0x0028, 0x0076, 0x0029, 0x0028, 0x0077, 0x0029, 0x0028, 0x0078,
+		0x0029, 0x0028, 0x0079, 0x0029, 0x0028, 0x007A, 0x0029, 0x0041,
+		0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049,
+		0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051,
+		0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059,
+		0x005A, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+		0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+		0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+		0x0078, 0x0079, 0x007A, 0x0030, 0x222B, 0x222B, 0x222B, 0x222B,
+		0x003A, 0x003A, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D,
+		0x2ADD, 0x0338, 0x006A, 0x0056, 0x2D61, 0x6BCD, 0x9F9F, 0x4E00,
+		0x4E28, 0x4E36, 0x4E3F, 0x4E59, 0x4E85, 0x4E8C, 0x4EA0, 0x4EBA,
+		0x513F, 0x5165, 0x516B, 0x5182, 0x5196, 0x51AB, 0x51E0, 0x51F5,
+		0x5200, 0x529B, 0x52F9, 0x5315, 0x531A, 0x5338, 0x5341, 0x535C,
+		0x5369, 0x5382, 0x53B6, 0x53C8, 0x53E3, 0x56D7, 0x571F, 0x58EB,
+		0x5902, 0x590A, 0x5915, 0x5927, 0x5973, 0x5B50, 0x5B80, 0x5BF8,
+		0x5C0F, 0x5C22, 0x5C38, 0x5C6E, 0x5C71, 0x5DDB, 0x5DE5, 0x5DF1,
+		0x5DFE, 0x5E72, 0x5E7A, 0x5E7F, 0x5EF4, 0x5EFE, 0x5F0B, 0x5F13,
+		0x5F50, 0x5F61, 0x5F73, 0x5FC3, 0x6208, 0x6236, 0x624B, 0x652F,
+		0x6534, 0x6587, 0x6597, 0x65A4, 0x65B9, 0x65E0, 0x65E5, 0x66F0,
+		0x6708, 0x6728, 0x6B20, 0x6B62, 0x6B79, 0x6BB3, 0x6BCB, 0x6BD4,
+		0x6BDB, 0x6C0F, 0x6C14, 0x6C34, 0x706B, 0x722A, 0x7236, 0x723B,
+		0x723F, 0x7247, 0x7259, 0x725B, 0x72AC, 0x7384, 0x7389, 0x74DC,
+		0x74E6, 0x7518, 0x751F, 0x7528, 0x7530, 0x758B, 0x7592, 0x7676,
+		0x767D, 0x76AE, 0x76BF, 0x76EE, 0x77DB, 0x77E2, 0x77F3, 0x793A,
+		0x79B8, 0x79BE, 0x7A74, 0x7ACB, 0x7AF9, 0x7C73, 0x7CF8, 0x7F36,
+		0x7F51, 0x7F8A, 0x7FBD, 0x8001, 0x800C, 0x8012, 0x8033, 0x807F,
+		0x8089, 0x81E3, 0x81EA, 0x81F3, 0x81FC, 0x820C, 0x821B, 0x821F,
+		0x826E, 0x8272, 0x8278, 0x864D, 0x866B, 0x8840, 0x884C, 0x8863,
+		0x897E, 0x898B, 0x89D2, 0x8A00, 0x8C37, 0x8C46, 0x8C55, 0x8C78,
+		0x8C9D, 0x8D64, 0x8D70, 0x8DB3, 0x8EAB, 0x8ECA, 0x8F9B, 0x8FB0,
+		0x8FB5, 0x9091, 0x9149, 0x91C6, 0x91CC, 0x91D1, 0x9577, 0x9580,
+		0x961C, 0x96B6, 0x96B9, 0x96E8, 0x9751, 0x975E, 0x9762, 0x9769,
+		0x97CB, 0x97ED, 0x97F3, 0x9801, 0x98A8, 0x98DB, 0x98DF, 0x9996,
+		0x9999, 0x99AC, 0x9AA8, 0x9AD8, 0x9ADF, 0x9B25, 0x9B2F, 0x9B32,
+		0x9B3C, 0x9B5A, 0x9CE5, 0x9E75, 0x9E7F, 0x9EA5, 0x9EBB, 0x9EC3,
+		0x9ECD, 0x9ED1, 0x9EF9, 0x9EFD, 0x9F0E, 0x9F13, 0x9F20, 0x9F3B,
+		0x9F4A, 0x9F52, 0x9F8D, 0x9F9C, 0x9FA0, 0x0020, 0x3012, 0x5341,
+		0x5344, 0x5345, 0x304B, 0x3099, 0x304D, 0x3099, 0x304F, 0x3099,
+		0x3051, 0x3099, 0x3053, 0x3099, 0x3055, 0x3099, 0x3057, 0x3099,
+		0x3059, 0x3099, 0x305B, 0x3099, 0x305D, 0x3099, 0x305F, 0x3099,
+		0x3061, 0x3099, 0x3064, 0x3099, 0x3066, 0x3099, 0x3068, 0x3099,
+		0x306F, 0x3099, 0x306F, 0x309A, 0x3072, 0x3099, 0x3072, 0x309A,
+		0x3075, 0x3099, 0x3075, 0x309A, 0x3078, 0x3099, 0x3078, 0x309A,
+		0x307B, 0x3099, 0x307B, 0x309A, 0x3046, 0x3099, 0x0020, 0x3099,
+		0x0020, 0x309A, 0x309D, 0x3099, 0x3088, 0x308A, 0x30AB, 0x3099,
+		0x30AD, 0x3099, 0x30AF, 0x3099, 0x30B1, 0x3099, 0x30B3, 0x3099,
+		0x30B5, 0x3099, 0x30B7, 0x3099, 0x30B9, 0x3099, 0x30BB, 0x3099,
+		0x30BD, 0x3099, 0x30BF, 0x3099, 0x30C1, 0x3099, 0x30C4, 0x3099,
+		0x30C6, 0x3099, 0x30C8, 0x3099, 0x30CF, 0x3099, 0x30CF, 0x309A,
+		0x30D2, 0x3099, 0x30D2, 0x309A, 0x30D5, 0x3099, 0x30D5, 0x309A,
+		0x30D8, 0x3099, 0x30D8, 0x309A, 0x30DB, 0x3099, 0x30DB, 0x309A,
+		0x30A6, 0x3099, 0x30EF, 0x3099, 0x30F0, 0x3099, 0x30F1, 0x3099,
+		0x30F2, 0x3099, 0x30FD, 0x3099, 0x30B3, 0x30C8, 0x1100, 0x1101,
+		0x11AA, 0x1102, 0x11AC, 0x11AD, 0x1103, 0x1104, 0x1105, 0x11B0,
+		0x11B1, 0x11B2, 0x11B3, 0x11B4, 0x11B5, 0x111A, 0x1106, 0x1107,
+		0x1108, 0x1121, 0x1109, 0x110A, 0x110B, 0x110C, 0x110D, 0x110E,
+		0x110F, 0x1110, 0x1111, 0x1112, 0x1161, 0x1162, 0x1163, 0x1164,
+		0x1165, 0x1166, 0x1167, 0x1168, 0x1169, 0x116A, 0x116B, 0x116C,
+		0x116D, 0x116E, 0x116F, 0x1170, 0x1171, 0x1172, 0x1173, 0x1174,
+		0x1175, 0x1160, 0x1114, 0x1115, 0x11C7, 0x11C8, 0x11CC, 0x11CE,
+		0x11D3, 0x11D7, 0x11D9, 0x111C, 0x11DD, 0x11DF, 0x111D, 0x111E,
+		0x1120, 0x1122, 0x1123, 0x1127, 0x1129, 0x112B, 0x112C, 0x112D,
+		0x112E, 0x112F, 0x1132, 0x1136, 0x1140, 0x1147, 0x114C, 0x11F1,
+		0x11F2, 0x1157, 0x1158, 0x1159, 0x1184, 0x1185, 0x1188, 0x1191,
+		0x1192, 0x1194, 0x119E, 0x11A1, 0x4E00, 0x4E8C, 0x4E09, 0x56DB,
+		0x4E0A, 0x4E2D, 0x4E0B, 0x7532, 0x4E59, 0x4E19, 0x4E01, 0x5929,
+		0x5730, 0x4EBA, 0x0028, 0x1100, 0x0029, 0x0028, 0x1102, 0x0029,
+		0x0028, 0x1103, 0x0029, 0x0028, 0x1105, 0x0029, 0x0028, 0x1106,
+		0x0029, 0x0028, 0x1107, 0x0029, 0x0028, 0x1109, 0x0029, 0x0028,
+		0x110B, 0x0029, 0x0028, 0x110C, 0x0029, 0x0028, 0x110E, 0x0029,
+		0x0028, 0x110F, 0x0029, 0x0028, 0x1110, 0x0029, 0x0028, 0x1111,
+		0x0029, 0x0028, 0x1112, 0x0029, 0x0028, 0x1100, 0x1161, 0x0029,
+		0x0028, 0x1102, 0x1161, 0x0029, 0x0028, 0x1103, 0x1161, 0x0029,
+		0x0028, 0x1105, 0x1161, 0x0029, 0x0028, 0x1106, 0x1161, 0x0029,
+		0x0028, 0x1107, 0x1161, 0x0029, 0x0028, 0x1109, 0x1161, 0x0029,
+		0x0028, 0x110B, 0x1161, 0x0029, 0x0028, 0x110C, 0x1161, 0x0029,
+		0x0028, 0x110E, 0x1161, 0x0029, 0x0028, 0x110F, 0x1161, 0x0029,
+		0x0028, 0x1110, 0x1161, 0x0029, 0x0028, 0x1111, 0x1161, 0x0029,
+		0x0028, 0x1112, 0x1161, 0x0029, 0x0028, 0x110C, 0x116E, 0x0029,
+		0x0028, 0x110B, 0x1169, 0x110C, 0x1165, 0x11AB, 0x0029, 0x0028,
+		0x110B, 0x1169, 0x1112, 0x116E, 0x0029, 0x0028, 0x4E00, 0x0029,
+		0x0028, 0x4E8C, 0x0029, 0x0028, 0x4E09, 0x0029, 0x0028, 0x56DB,
+		0x0029, 0x0028, 0x4E94, 0x0029, 0x0028, 0x516D, 0x0029, 0x0028,
+		0x4E03, 0x0029, 0x0028, 0x516B, 0x0029, 0x0028, 0x4E5D, 0x0029,
+		0x0028, 0x5341, 0x0029, 0x0028, 0x6708, 0x0029, 0x0028, 0x706B,
+		0x0029, 0x0028, 0x6C34, 0x0029, 0x0028, 0x6728, 0x0029, 0x0028,
+		0x91D1, 0x0029, 0x0028, 0x571F, 0x0029, 0x0028, 0x65E5, 0x0029,
+		0x0028, 0x682A, 0x0029, 0x0028, 0x6709, 0x0029, 0x0028, 0x793E,
+		0x0029, 0x0028, 0x540D, 0x0029, 0x0028, 0x7279, 0x0029, 0x0028,
+		0x8CA1, 0x0029, 0x0028, 0x795D, 0x0029, 0x0028, 0x52B4, 0x0029,
+		0x0028, 0x4EE3, 0x0029, 0x0028, 0x547C, 0x0029, 0x0028, 0x5B66,
+		0x0029, 0x0028, 0x76E3, 0x0029, 0x0028, 0x4F01, 0x0029, 0x0028,
+		0x8CC7, 0x0029, 0x0028, 0x5354, 0x0029, 0x0028, 0x796D, 0x0029,
+		0x0028, 0x4F11, 0x0029, 0x0028, 0x81EA, 0x0029, 0x0028, 0x81F3,
+		0x0029, 0x554F, 0x5E7C, 0x6587, 0x7B8F, 0x0050, 0x0054, 0x0045,
+		0x0032, 0x0031, 0x0032, 0x0032, 0x0032, 0x0033, 0x0032, 0x0034,
+		0x0032, 0x0035, 0x0032, 0x0036, 0x0032, 0x0037, 0x0032, 0x0038,
+		0x0032, 0x0039, 0x0033, 0x0030, 0x0033, 0x0031, 0x0033, 0x0032,
+		0x0033, 0x0033, 0x0033, 0x0034, 0x0033, 0x0035, 0x1100, 0x1102,
+		0x1103, 0x1105, 0x1106, 0x1107, 0x1109, 0x110B, 0x110C, 0x110E,
+		0x110F, 0x1110, 0x1111, 0x1112, 0x1100, 0x1161, 0x1102, 0x1161,
+		0x1103, 0x1161, 0x1105, 0x1161, 0x1106, 0x1161, 0x1107, 0x1161,
+		0x1109, 0x1161, 0x110B, 0x1161, 0x110C, 0x1161, 0x110E, 0x1161,
+		0x110F, 0x1161, 0x1110, 0x1161, 0x1111, 0x1161, 0x1112, 0x1161,
+		0x110E, 0x1161, 0x11B7, 0x1100, 0x1169, 0x110C, 0x116E, 0x110B,
+		0x1174, 0x110B, 0x116E, 0x4E00, 0x4E8C, 0x4E09, 0x56DB, 0x4E94,
+		0x516D, 0x4E03, 0x516B, 0x4E5D, 0x5341, 0x6708, 0x706B, 0x6C34,
+		0x6728, 0x91D1, 0x571F, 0x65E5, 0x682A, 0x6709, 0x793E, 0x540D,
+		0x7279, 0x8CA1, 0x795D, 0x52B4, 0x79D8, 0x7537, 0x5973, 0x9069,
+		0x512A, 0x5370, 0x6CE8, 0x9805, 0x4F11, 0x5199, 0x6B63, 0x4E0A,
+		0x4E2D, 0x4E0B, 0x5DE6, 0x53F3, 0x533B, 0x5B97, 0x5B66, 0x76E3,
+		0x4F01, 0x8CC7, 0x5354, 0x591C, 0x0033, 0x0036, 0x0033, 0x0037,
+		0x0033, 0x0038, 0x0033, 0x0039, 0x0034, 0x0030, 0x0034, 0x0031,
+		0x0034, 0x0032, 0x0034, 0x0033, 0x0034, 0x0034, 0x0034, 0x0035,
+		0x0034, 0x0036, 0x0034, 0x0037, 0x0034, 0x0038, 0x0034, 0x0039,
+		0x0035, 0x0030, 0x0031, 0x6708, 0x0032, 0x6708, 0x0033, 0x6708,
+		0x0034, 0x6708, 0x0035, 0x6708, 0x0036, 0x6708, 0x0037, 0x6708,
+		0x0038, 0x6708, 0x0039, 0x6708, 0x0031, 0x0030, 0x6708, 0x0031,
+		0x0031, 0x6708, 0x0031, 0x0032, 0x6708, 0x0048, 0x0067, 0x0065,
+		0x0072, 0x0067, 0x0065, 0x0056, 0x004C, 0x0054, 0x0044, 0x30A2,
+		0x30A4, 0x30A6, 0x30A8, 0x30AA, 0x30AB, 0x30AD, 0x30AF, 0x30B1,
+		0x30B3, 0x30B5, 0x30B7, 0x30B9, 0x30BB, 0x30BD, 0x30BF, 0x30C1,
+		0x30C4, 0x30C6, 0x30C8, 0x30CA, 0x30CB, 0x30CC, 0x30CD, 0x30CE,
+		0x30CF, 0x30D2, 0x30D5, 0x30D8, 0x30DB, 0x30DE, 0x30DF, 0x30E0,
+		0x30E1, 0x30E2, 0x30E4, 0x30E6, 0x30E8, 0x30E9, 0x30EA, 0x30EB,
+		0x30EC, 0x30ED, 0x30EF, 0x30F0, 0x30F1, 0x30F2, 0x4EE4, 0x548C,
+		0x30A2, 0x30CF, 0x309A, 0x30FC, 0x30C8, 0x30A2, 0x30EB, 0x30D5,
+		0x30A1, 0x30A2, 0x30F3, 0x30D8, 0x309A, 0x30A2, 0x30A2, 0x30FC,
+		0x30EB, 0x30A4, 0x30CB, 0x30F3, 0x30AF, 0x3099, 0x30A4, 0x30F3,
+		0x30C1, 0x30A6, 0x30A9, 0x30F3, 0x30A8, 0x30B9, 0x30AF, 0x30FC,
+		0x30C8, 0x3099, 0x30A8, 0x30FC, 0x30AB, 0x30FC, 0x30AA, 0x30F3,
+		0x30B9, 0x30AA, 0x30FC, 0x30E0, 0x30AB, 0x30A4, 0x30EA, 0x30AB,
+		0x30E9, 0x30C3, 0x30C8, 0x30AB, 0x30ED, 0x30EA, 0x30FC, 0x30AB,
+		0x3099, 0x30ED, 0x30F3, 0x30AB, 0x3099, 0x30F3, 0x30DE, 0x30AD,
+		0x3099, 0x30AB, 0x3099, 0x30AD, 0x3099, 0x30CB, 0x30FC, 0x30AD,
+		0x30E5, 0x30EA, 0x30FC, 0x30AD, 0x3099, 0x30EB, 0x30BF, 0x3099,
+		0x30FC, 0x30AD, 0x30ED, 0x30AD, 0x30ED, 0x30AF, 0x3099, 0x30E9,
+		0x30E0, 0x30AD, 0x30ED, 0x30E1, 0x30FC, 0x30C8, 0x30EB, 0x30AD,
+		0x30ED, 0x30EF, 0x30C3, 0x30C8, 0x30AF, 0x3099, 0x30E9, 0x30E0,
+		0x30AF, 0x3099, 0x30E9, 0x30E0, 0x30C8, 0x30F3, 0x30AF, 0x30EB,
+		0x30BB, 0x3099, 0x30A4, 0x30ED, 0x30AF, 0x30ED, 0x30FC, 0x30CD,
+		0x30B1, 0x30FC, 0x30B9, 0x30B3, 0x30EB, 0x30CA, 0x30B3, 0x30FC,
+		0x30DB, 0x309A, 0x30B5, 0x30A4, 0x30AF, 0x30EB, 0x30B5, 0x30F3,
+		0x30C1, 0x30FC, 0x30E0, 0x30B7, 0x30EA, 0x30F3, 0x30AF, 0x3099,
+		0x30BB, 0x30F3, 0x30C1, 0x30BB, 0x30F3, 0x30C8, 0x30BF, 0x3099,
+		0x30FC, 0x30B9, 0x30C6, 0x3099, 0x30B7, 0x30C8, 0x3099, 0x30EB,
+		0x30C8, 0x30F3, 0x30CA, 0x30CE, 0x30CE, 0x30C3, 0x30C8, 0x30CF,
+		0x30A4, 0x30C4, 0x30CF, 0x309A, 0x30FC, 0x30BB, 0x30F3, 0x30C8,
+		0x30CF, 0x309A, 0x30FC, 0x30C4, 0x30CF, 0x3099, 0x30FC, 0x30EC,
+		0x30EB, 0x30D2, 0x309A, 0x30A2, 0x30B9, 0x30C8, 0x30EB, 0x30D2,
+		0x309A, 0x30AF, 0x30EB, 0x30D2, 0x309A, 0x30B3, 0x30D2, 0x3099,
+		0x30EB, 0x30D5, 0x30A1, 0x30E9, 0x30C3, 0x30C8, 0x3099, 0x30D5,
+		0x30A3, 0x30FC, 0x30C8, 0x30D5, 0x3099, 0x30C3, 0x30B7, 0x30A7,
+		0x30EB, 0x30D5, 0x30E9, 0x30F3, 0x30D8, 0x30AF, 0x30BF, 0x30FC,
+		0x30EB, 0x30D8, 0x309A, 0x30BD, 0x30D8, 0x309A, 0x30CB, 0x30D2,
+		0x30D8, 0x30EB, 0x30C4, 0x30D8, 0x309A, 0x30F3, 0x30B9, 0x30D8,
+		0x309A, 0x30FC, 0x30B7, 0x3099, 0x30D8, 0x3099, 0x30FC, 0x30BF,
+		0x30DB, 0x309A, 0x30A4, 0x30F3, 0x30C8, 0x30DB, 0x3099, 0x30EB,
+		0x30C8, 0x30DB, 0x30F3, 0x30DB, 0x309A, 0x30F3, 0x30C8, 0x3099,
+		0x30DB, 0x30FC, 0x30EB, 0x30DB, 0x30FC, 0x30F3, 0x30DE, 0x30A4,
+		0x30AF, 0x30ED, 0x30DE, 0x30A4, 0x30EB, 0x30DE, 0x30C3, 0x30CF,
+		0x30DE, 0x30EB, 0x30AF, 0x30DE, 0x30F3, 0x30B7, 0x30E7, 0x30F3,
+		0x30DF, 0x30AF, 0x30ED, 0x30F3, 0x30DF, 0x30EA, 0x30DF, 0x30EA,
+		0x30CF, 0x3099, 0x30FC, 0x30EB, 0x30E1, 0x30AB, 0x3099, 0x30E1,
+		0x30AB, 0x3099, 0x30C8, 0x30F3, 0x30E1, 0x30FC, 0x30C8, 0x30EB,
+		0x30E4, 0x30FC, 0x30C8, 0x3099, 0x30E4, 0x30FC, 0x30EB, 0x30E6,
+		0x30A2, 0x30F3, 0x30EA, 0x30C3, 0x30C8, 0x30EB, 0x30EA, 0x30E9,
+		0x30EB, 0x30D2, 0x309A, 0x30FC, 0x30EB, 0x30FC, 0x30D5, 0x3099,
+		0x30EB, 0x30EC, 0x30E0, 0x30EC, 0x30F3, 0x30C8, 0x30B1, 0x3099,
+		0x30F3, 0x30EF, 0x30C3, 0x30C8, 0x0030, 0x70B9, 0x0031, 0x70B9,
+		0x0032, 0x70B9, 0x0033, 0x70B9, 0x0034, 0x70B9, 0x0035, 0x70B9,
+		0x0036, 0x70B9, 0x0037, 0x70B9, 0x0038, 0x70B9, 0x0039, 0x70B9,
+		0x0031, 0x0030, 0x70B9, 0x0031, 0x0031, 0x70B9, 0x0031, 0x0032,
+		0x70B9, 0x0031, 0x0033, 0x70B9, 0x0031, 0x0034, 0x70B9, 0x0031,
+		0x0035, 0x70B9, 0x0031, 0x0036, 0x70B9, 0x0031, 0x0037, 0x70B9,
+		0x0031, 0x0038, 0x70B9, 0x0031, 0x0039, 0x70B9, 0x0032, 0x0030,
+		0x70B9, 0x0032, 0x0031, 0x70B9, 0x0032, 0x0032, 0x70B9, 0x0032,
+		0x0033, 0x70B9, 0x0032, 0x0034, 0x70B9, 0x0068, 0x0050, 0x0061,
+		0x0064, 0x0061, 0x0041, 0x0055, 0x0062, 0x0061, 0x0072, 0x006F,
+		0x0056, 0x0070, 0x0063, 0x0064, 0x006D, 0x0064, 0x006D, 0x0032,
+		0x0064, 0x006D, 0x0033, 0x0049, 0x0055, 0x5E73, 0x6210, 0x662D,
+		0x548C, 0x5927, 0x6B63, 0x660E, 0x6CBB, 0x682A, 0x5F0F, 0x4F1A,
+		0x793E, 0x0070, 0x0041, 0x006E, 0x0041, 0x03BC, 0x0041, 0x006D,
+		0x0041, 0x006B, 0x0041, 0x004B, 0x0042, 0x004D, 0x0042, 0x0047,
+		0x0042, 0x0063, 0x0061, 0x006C, 0x006B, 0x0063, 0x0061, 0x006C,
+		0x0070, 0x0046, 0x006E, 0x0046, 0x03BC, 0x0046, 0x03BC, 0x0067,
+		0x006D, 0x0067, 0x006B, 0x0067, 0x0048, 0x007A, 0x006B, 0x0048,
+		0x007A, 0x004D, 0x0048, 0x007A, 0x0047, 0x0048, 0x007A, 0x0054,
+		0x0048, 0x007A, 0x03BC, 0x006C, 0x006D, 0x006C, 0x0064, 0x006C,
+		0x006B, 0x006C, 0x0066, 0x006D, 0x006E, 0x006D, 0x03BC, 0x006D,
+		0x006D, 0x006D, 0x0063, 0x006D, 0x006B, 0x006D, 0x006D, 0x006D,
+		0x0032, 0x0063, 0x006D, 0x0032, 0x006D, 0x0032, 0x006B, 0x006D,
+		0x0032, 0x006D, 0x006D, 0x0033, 0x0063, 0x006D, 0x0033, 0x006D,
+		0x0033, 0x006B, 0x006D, 0x0033, 0x006D, 0x2215, 0x0073, 0x006D,
+		0x2215, 0x0073, 0x0032, 0x0050, 0x0061, 0x006B, 0x0050, 0x0061,
+		0x004D, 0x0050, 0x0061, 0x0047, 0x0050, 0x0061, 0x0072, 0x0061,
+		0x0064, 0x0072, 0x0061, 0x0064, 0x2215, 0x0073, 0x0072, 0x0061,
+		0x0064, 0x2215, 0x0073, 0x0032, 0x0070, 0x0073, 0x006E, 0x0073,
+		0x03BC, 0x0073, 0x006D, 0x0073, 0x0070, 0x0056, 0x006E, 0x0056,
+		0x03BC, 0x0056, 0x006D, 0x0056, 0x006B, 0x0056, 0x004D, 0x0056,
+		0x0070, 0x0057, 0x006E, 0x0057, 0x03BC, 0x0057, 0x006D, 0x0057,
+		0x006B, 0x0057, 0x004D, 0x0057, 0x006B, 0x03A9, 0x004D, 0x03A9,
+		0x0061, 0x002E, 0x006D, 0x002E, 0x0042, 0x0071, 0x0063, 0x0063,
+		0x0063, 0x0064, 0x0043, 0x2215, 0x006B, 0x0067, 0x0043, 0x006F,
+		0x002E, 0x0064, 0x0042, 0x0047, 0x0079, 0x0068, 0x0061, 0x0048,
+		0x0050, 0x0069, 0x006E, 0x004B, 0x004B, 0x004B, 0x004D, 0x006B,
+		0x0074, 0x006C, 0x006D, 0x006C, 0x006E, 0x006C, 0x006F, 0x0067,
+		0x006C, 0x0078, 0x006D, 0x0062, 0x006D, 0x0069, 0x006C, 0x006D,
+		0x006F, 0x006C, 0x0050, 0x0048, 0x0070, 0x002E, 0x006D, 0x002E,
+		0x0050, 0x0050, 0x004D, 0x0050, 0x0052, 0x0073, 0x0072, 0x0053,
+		0x0076, 0x0057, 0x0062, 0x0056, 0x2215, 0x006D, 0x0041, 0x2215,
+		0x006D, 0x0031, 0x65E5, 0x0032, 0x65E5, 0x0033, 0x65E5, 0x0034,
+		0x65E5, 0x0035, 0x65E5, 0x0036, 0x65E5, 0x0037, 0x65E5, 0x0038,
+		0x65E5, 0x0039, 0x65E5, 0x0031, 0x0030, 0x65E5, 0x0031, 0x0031,
+		0x65E5, 0x0031, 0x0032, 0x65E5, 0x0031, 0x0033, 0x65E5, 0x0031,
+		0x0034, 0x65E5, 0x0031, 0x0035, 0x65E5, 0x0031, 0x0036, 0x65E5,
+		0x0031, 0x0037, 0x65E5, 0x0031, 0x0038, 0x65E5, 0x0031, 0x0039,
+		0x65E5, 0x0032, 0x0030, 0x65E5, 0x0032, 0x0031, 0x65E5, 0x0032,
+		0x0032, 0x65E5, 0x0032, 0x0033, 0x65E5, 0x0032, 0x0034, 0x65E5,
+		0x0032, 0x0035, 0x65E5, 0x0032, 0x0036, 0x65E5, 0x0032, 0x0037,
+		0x65E5, 0x0032, 0x0038, 0x65E5, 0x0032, 0x0039, 0x65E5, 0x0033,
+		0x0030, 0x65E5, 0x0033, 0x0031, 0x65E5, 0x0067, 0x0061, 0x006C,
+		0x044A, 0x044C, 0xA76F, 0x0043, 0x0046, 0x0051, 0x0126, 0x0153,
+		0xA727, 0xAB37, 0x026B, 0xAB52, 0x028D, 0x8C48, 0x66F4, 0x8ECA,
+		0x8CC8, 0x6ED1, 0x4E32, 0x53E5, 0x9F9C, 0x9F9C, 0x5951, 0x91D1,
+		0x5587, 0x5948, 0x61F6, 0x7669, 0x7F85, 0x863F, 0x87BA, 0x88F8,
+		0x908F, 0x6A02, 0x6D1B, 0x70D9, 0x73DE, 0x843D, 0x916A, 0x99F1,
+		0x4E82, 0x5375, 0x6B04, 0x721B, 0x862D, 0x9E1E, 0x5D50, 0x6FEB,
+		0x85CD, 0x8964, 0x62C9, 0x81D8, 0x881F, 0x5ECA, 0x6717, 0x6D6A,
+		0x72FC, 0x90CE, 0x4F86, 0x51B7, 0x52DE, 0x64C4, 0x6AD3, 0x7210,
+		0x76E7, 0x8001, 0x8606, 0x865C, 0x8DEF, 0x9732, 0x9B6F, 0x9DFA,
+		0x788C, 0x797F, 0x7DA0, 0x83C9, 0x9304, 0x9E7F, 0x8AD6, 0x58DF,
+		0x5F04, 0x7C60, 0x807E, 0x7262, 0x78CA, 0x8CC2, 0x96F7, 0x58D8,
+		0x5C62, 0x6A13, 0x6DDA, 0x6F0F, 0x7D2F, 0x7E37, 0x964B, 0x52D2,
+		0x808B, 0x51DC, 0x51CC, 0x7A1C, 0x7DBE, 0x83F1, 0x9675, 0x8B80,
+		0x62CF, 0x6A02, 0x8AFE, 0x4E39, 0x5BE7, 0x6012, 0x7387, 0x7570,
+		0x5317, 0x78FB, 0x4FBF, 0x5FA9, 0x4E0D, 0x6CCC, 0x6578, 0x7D22,
+		0x53C3, 0x585E, 0x7701, 0x8449, 0x8AAA, 0x6BBA, 0x8FB0, 0x6C88,
+		0x62FE, 0x82E5, 0x63A0, 0x7565, 0x4EAE, 0x5169, 0x51C9, 0x6881,
+		0x7CE7, 0x826F, 0x8AD2, 0x91CF, 0x52F5, 0x5442, 0x5973, 0x5EEC,
+		0x65C5, 0x6FFE, 0x792A, 0x95AD, 0x9A6A, 0x9E97, 0x9ECE, 0x529B,
+		0x66C6, 0x6B77, 0x8F62, 0x5E74, 0x6190, 0x6200, 0x649A, 0x6F23,
+		0x7149, 0x7489, 0x79CA, 0x7DF4, 0x806F, 0x8F26, 0x84EE, 0x9023,
+		0x934A, 0x5217, 0x52A3, 0x54BD, 0x70C8, 0x88C2, 0x8AAA, 0x5EC9,
+		0x5FF5, 0x637B, 0x6BAE, 0x7C3E, 0x7375, 0x4EE4, 0x56F9, 0x5BE7,
+		0x5DBA, 0x601C, 0x73B2, 0x7469, 0x7F9A, 0x8046, 0x9234, 0x96F6,
+		0x9748, 0x9818, 0x4F8B, 0x79AE, 0x91B4, 0x96B8, 0x60E1, 0x4E86,
+		0x50DA, 0x5BEE, 0x5C3F, 0x6599, 0x6A02, 0x71CE, 0x7642, 0x84FC,
+		0x907C, 0x9F8D, 0x6688, 0x962E, 0x5289, 0x677B, 0x67F3, 0x6D41,
+		0x6E9C, 0x7409, 0x7559, 0x786B, 0x7D10, 0x985E, 0x516D, 0x622E,
+		0x9678, 0x502B, 0x5D19, 0x6DEA, 0x8F2A, 0x5F8B, 0x6144, 0x6817,
+		0x7387, 0x9686, 0x5229, 0x540F, 0x5C65, 0x6613, 0x674E, 0x68A8,
+		0x6CE5, 0x7406, 0x75E2, 0x7F79, 0x88CF, 0x88E1, 0x91CC, 0x96E2,
+		0x533F, 0x6EBA, 0x541D, 0x71D0, 0x7498, 0x85FA, 0x96A3, 0x9C57,
+		0x9E9F, 0x6797, 0x6DCB, 0x81E8, 0x7ACB, 0x7B20, 0x7C92, 0x72C0,
+		0x7099, 0x8B58, 0x4EC0, 0x8336, 0x523A, 0x5207, 0x5EA6, 0x62D3,
+		0x7CD6, 0x5B85, 0x6D1E, 0x66B4, 0x8F3B, 0x884C, 0x964D, 0x898B,
+		0x5ED3, 0x5140, 0x55C0, 0x585A, 0x6674, 0x51DE, 0x732A, 0x76CA,
+		0x793C, 0x795E, 0x7965, 0x798F, 0x9756, 0x7CBE, 0x7FBD, 0x8612,
+		0x8AF8, 0x9038, 0x90FD, 0x98EF, 0x98FC, 0x9928, 0x9DB4, 0x90DE,
+		0x96B7, 0x4FAE, 0x50E7, 0x514D, 0x52C9, 0x52E4, 0x5351, 0x559D,
+		0x5606, 0x5668, 0x5840, 0x58A8, 0x5C64, 0x5C6E, 0x6094, 0x6168,
+		0x618E, 0x61F2, 0x654F, 0x65E2, 0x6691, 0x6885, 0x6D77, 0x6E1A,
+		0x6F22, 0x716E, 0x722B, 0x7422, 0x7891, 0x793E, 0x7949, 0x7948,
+		0x7950, 0x7956, 0x795D, 0x798D, 0x798E, 0x7A40, 0x7A81, 0x7BC0,
+		0x7DF4, 0x7E09, 0x7E41, 0x7F72, 0x8005, 0x81ED, 0x8279, 0x8279,
+		0x8457, 0x8910, 0x8996, 0x8B01, 0x8B39, 0x8CD3, 0x8D08, 0x8FB6,
+		0x9038, 0x96E3, 0x97FF, 0x983B, 0x6075, 0x242EE, 0x8218, 0x4E26,
+		0x51B5, 0x5168, 0x4F80, 0x5145, 0x5180, 0x52C7, 0x52FA, 0x559D,
+		0x5555, 0x5599, 0x55E2, 0x585A, 0x58B3, 0x5944, 0x5954, 0x5A62,
+		0x5B28, 0x5ED2, 0x5ED9, 0x5F69, 0x5FAD, 0x60D8, 0x614E, 0x6108,
+		0x618E, 0x6160, 0x61F2, 0x6234, 0x63C4, 0x641C, 0x6452, 0x6556,
+		0x6674, 0x6717, 0x671B, 0x6756, 0x6B79, 0x6BBA, 0x6D41, 0x6EDB,
+		0x6ECB, 0x6F22, 0x701E, 0x716E, 0x77A7, 0x7235, 0x72AF, 0x732A,
+		0x7471, 0x7506, 0x753B, 0x761D, 0x761F, 0x76CA, 0x76DB, 0x76F4,
+		0x774A, 0x7740, 0x78CC, 0x7AB1, 0x7BC0, 0x7C7B, 0x7D5B, 0x7DF4,
+		0x7F3E, 0x8005, 0x8352, 0x83EF, 0x8779, 0x8941, 0x8986, 0x8996,
+		0x8ABF, 0x8AF8, 0x8ACB, 0x8B01, 0x8AFE, 0x8AED, 0x8B39, 0x8B8A,
+		0x8D08, 0x8F38, 0x9072, 0x9199, 0x9276, 0x967C, 0x96E3, 0x9756,
+		0x97DB, 0x97FF, 0x980B, 0x983B, 0x9B12, 0x9F9C, 0x2284A, 0x22844,
+		0x233D5, 0x3B9D, 0x4018, 0x4039, 0x25249, 0x25CD0, 0x27ED3, 0x9F43,
+		0x9F8E, 0x0066, 0x0066, 0x0066, 0x0069, 0x0066, 0x006C, 0x0066,
+		0x0066, 0x0069, 0x0066, 0x0066, 0x006C, 0x0073, 0x0074, 0x0073,
+		0x0074, 0x0574, 0x0576, 0x0574, 0x0565, 0x0574, 0x056B, 0x057E,
+		0x0576, 0x0574, 0x056D, 0x05D9, 0x05B4, 0x05F2, 0x05B7, 0x05E2,
+		0x05D0, 0x05D3, 0x05D4, 0x05DB, 0x05DC, 0x05DD, 0x05E8, 0x05EA,
+		0x002B, 0x05E9, 0x05C1, 0x05E9, 0x05C2, 0x05E9, 0x05BC, 0x05C1,
+		0x05E9, 0x05BC, 0x05C2, 0x05D0, 0x05B7, 0x05D0, 0x05B8, 0x05D0,
+		0x05BC, 0x05D1, 0x05BC, 0x05D2, 0x05BC, 0x05D3, 0x05BC, 0x05D4,
+		0x05BC, 0x05D5, 0x05BC, 0x05D6, 0x05BC, 0x05D8, 0x05BC, 0x05D9,
+		0x05BC, 0x05DA, 0x05BC, 0x05DB, 0x05BC, 0x05DC, 0x05BC, 0x05DE,
+		0x05BC, 0x05E0, 0x05BC, 0x05E1, 0x05BC, 0x05E3, 0x05BC, 0x05E4,
+		0x05BC, 0x05E6, 0x05BC, 0x05E7, 0x05BC, 0x05E8, 0x05BC, 0x05E9,
+		0x05BC, 0x05EA, 0x05BC, 0x05D5, 0x05B9, 0x05D1, 0x05BF, 0x05DB,
+		0x05BF, 0x05E4, 0x05BF, 0x05D0, 0x05DC, 0x0671, 0x0671, 0x067B,
+		0x067B, 0x067B, 0x067B, 0x067E, 0x067E, 0x067E, 0x067E, 0x0680,
+		0x0680, 0x0680, 0x0680, 0x067A, 0x067A, 0x067A, 0x067A, 0x067F,
+		0x067F, 0x067F, 0x067F, 0x0679, 0x0679, 0x0679, 0x0679, 0x06A4,
+		0x06A4, 0x06A4, 0x06A4, 0x06A6, 0x06A6, 0x06A6, 0x06A6, 0x0684,
+		0x0684, 0x0684, 0x0684, 0x0683, 0x0683, 0x0683, 0x0683, 0x0686,
+		0x0686, 0x0686, 0x0686, 0x0687, 0x0687, 0x0687, 0x0687, 0x068D,
+		0x068D, 0x068C, 0x068C, 0x068E, 0x068E, 0x0688, 0x0688, 0x0698,
+		0x0698, 0x0691, 0x0691, 0x06A9, 0x06A9, 0x06A9, 0x06A9, 0x06AF,
+		0x06AF, 0x06AF, 0x06AF, 0x06B3, 0x06B3, 0x06B3, 0x06B3, 0x06B1,
+		0x06B1, 0x06B1, 0x06B1, 0x06BA, 0x06BA, 0x06BB, 0x06BB, 0x06BB,
+		0x06BB, 0x06D5, 0x0654, 0x06D5, 0x0654, 0x06C1, 0x06C1, 0x06C1,
+		0x06C1, 0x06BE, 0x06BE, 0x06BE, 0x06BE, 0x06D2, 0x06D2, 0x06D2,
+		0x0654, 0x06D2, 0x0654, 0x06AD, 0x06AD, 0x06AD, 0x06AD, 0x06C7,
+		0x06C7, 0x06C6, 0x06C6, 0x06C8, 0x06C8, 0x06C7, 0x0674, 0x06CB,
+		0x06CB, 0x06C5, 0x06C5, 0x06C9, 0x06C9, 0x06D0, 0x06D0, 0x06D0,
+		0x06D0, 0x0649, 0x0649, 0x064A, 0x0654, 0x0627, 0x064A, 0x0654,
+		0x0627, 0x064A, 0x0654, 0x06D5, 0x064A, 0x0654, 0x06D5, 0x064A,
+		0x0654, 0x0648, 0x064A, 0x0654, 0x0648, 0x064A, 0x0654, 0x06C7,
+		0x064A, 0x0654, 0x06C7, 0x064A, 0x0654, 0x06C6, 0x064A, 0x0654,
+		0x06C6, 0x064A, 0x0654, 0x06C8, 0x064A, 0x0654, 0x06C8, 0x064A,
+		0x0654, 0x06D0, 0x064A, 0x0654, 0x06D0, 0x064A, 0x0654, 0x06D0,
+		0x064A, 0x0654, 0x0649, 0x064A, 0x0654, 0x0649, 0x064A, 0x0654,
+		0x0649, 0x06CC, 0x06CC, 0x06CC, 0x06CC, 0x064A, 0x0654, 0x062C,
+		0x064A, 0x0654, 0x062D, 0x064A, 0x0654, 0x0645, 0x064A, 0x0654,
+		0x0649, 0x064A, 0x0654, 0x064A, 0x0628, 0x062C, 0x0628, 0x062D,
+		0x0628, 0x062E, 0x0628, 0x0645, 0x0628, 0x0649, 0x0628, 0x064A,
+		0x062A, 0x062C, 0x062A, 0x062D, 0x062A, 0x062E, 0x062A, 0x0645,
+		0x062A, 0x0649, 0x062A, 0x064A, 0x062B, 0x062C, 0x062B, 0x0645,
+		0x062B, 0x0649, 0x062B, 0x064A, 0x062C, 0x062D, 0x062C, 0x0645,
+		0x062D, 0x062C, 0x062D, 0x0645, 0x062E, 0x062C, 0x062E, 0x062D,
+		0x062E, 0x0645, 0x0633, 0x062C, 0x0633, 0x062D, 0x0633, 0x062E,
+		0x0633, 0x0645, 0x0635, 0x062D, 0x0635, 0x0645, 0x0636, 0x062C,
+		0x0636, 0x062D, 0x0636, 0x062E, 0x0636, 0x0645, 0x0637, 0x062D,
+		0x0637, 0x0645, 0x0638, 0x0645, 0x0639, 0x062C, 0x0639, 0x0645,
+		0x063A, 0x062C, 0x063A, 0x0645, 0x0641, 0x062C, 0x0641, 0x062D,
+		0x0641, 0x062E, 0x0641, 0x0645, 0x0641, 0x0649, 0x0641, 0x064A,
+		0x0642, 0x062D, 0x0642, 0x0645, 0x0642, 0x0649, 0x0642, 0x064A,
+		0x0643, 0x0627, 0x0643, 0x062C, 0x0643, 0x062D, 0x0643, 0x062E,
+		0x0643, 0x0644, 0x0643, 0x0645, 0x0643, 0x0649, 0x0643, 0x064A,
+		0x0644, 0x062C, 0x0644, 0x062D, 0x0644, 0x062E, 0x0644, 0x0645,
+		0x0644, 0x0649, 0x0644, 0x064A, 0x0645, 0x062C, 0x0645, 0x062D,
+		0x0645, 0x062E, 0x0645, 0x0645, 0x0645, 0x0649, 0x0645, 0x064A,
+		0x0646, 0x062C, 0x0646, 0x062D, 0x0646, 0x062E, 0x0646, 0x0645,
+		0x0646, 0x0649, 0x0646, 0x064A, 0x0647, 0x062C, 0x0647, 0x0645,
+		0x0647, 0x0649, 0x0647, 0x064A, 0x064A, 0x062C, 0x064A, 0x062D,
+		0x064A, 0x062E, 0x064A, 0x0645, 0x064A, 0x0649, 0x064A, 0x064A,
+		0x0630, 0x0670, 0x0631, 0x0670, 0x0649, 0x0670, 0x0020, 0x064C,
+		0x0651, 0x0020, 0x064D, 0x0651, 0x0020, 0x064E, 0x0651, 0x0020,
+		0x064F, 0x0651, 0x0020, 0x0650, 0x0651, 0x0020, 0x0651, 0x0670,
+		0x064A, 0x0654, 0x0631, 0x064A, 0x0654, 0x0632, 0x064A, 0x0654,
+		0x0645, 0x064A, 0x0654, 0x0646, 0x064A, 0x0654, 0x0649, 0x064A,
+		0x0654, 0x064A, 0x0628, 0x0631, 0x0628, 0x0632, 0x0628, 0x0645,
+		0x0628, 0x0646, 0x0628, 0x0649, 0x0628, 0x064A, 0x062A, 0x0631,
+		0x062A, 0x0632, 0x062A, 0x0645, 0x062A, 0x0646, 0x062A, 0x0649,
+		0x062A, 0x064A, 0x062B, 0x0631, 0x062B, 0x0632, 0x062B, 0x0645,
+		0x062B, 0x0646, 0x062B, 0x0649, 0x062B, 0x064A, 0x0641, 0x0649,
+		0x0641, 0x064A, 0x0642, 0x0649, 0x0642, 0x064A, 0x0643, 0x0627,
+		0x0643, 0x0644, 0x0643, 0x0645, 0x0643, 0x0649, 0x0643, 0x064A,
+		0x0644, 0x0645, 0x0644, 0x0649, 0x0644, 0x064A, 0x0645, 0x0627,
+		0x0645, 0x0645, 0x0646, 0x0631, 0x0646, 0x0632, 0x0646, 0x0645,
+		0x0646, 0x0646, 0x0646, 0x0649, 0x0646, 0x064A, 0x0649, 0x0670,
+		0x064A, 0x0631, 0x064A, 0x0632, 0x064A, 0x0645, 0x064A, 0x0646,
+		0x064A, 0x0649, 0x064A, 0x064A, 0x064A, 0x0654, 0x062C, 0x064A,
+		0x0654, 0x062D, 0x064A, 0x0654, 0x062E, 0x064A, 0x0654, 0x0645,
+		0x064A, 0x0654, 0x0647, 0x0628, 0x062C, 0x0628, 0x062D, 0x0628,
+		0x062E, 0x0628, 0x0645, 0x0628, 0x0647, 0x062A, 0x062C, 0x062A,
+		0x062D, 0x062A, 0x062E, 0x062A, 0x0645, 0x062A, 0x0647, 0x062B,
+		0x0645, 0x062C, 0x062D, 0x062C, 0x0645, 0x062D, 0x062C, 0x062D,
+		0x0645, 0x062E, 0x062C, 0x062E, 0x0645, 0x0633, 0x062C, 0x0633,
+		0x062D, 0x0633, 0x062E, 0x0633, 0x0645, 0x0635, 0x062D, 0x0635,
+		0x062E, 0x0635, 0x0645, 0x0636, 0x062C, 0x0636, 0x062D, 0x0636,
+		0x062E, 0x0636, 0x0645, 0x0637, 0x062D, 0x0638, 0x0645, 0x0639,
+		0x062C, 0x0639, 0x0645, 0x063A, 0x062C, 0x063A, 0x0645, 0x0641,
+		0x062C, 0x0641, 0x062D, 0x0641, 0x062E, 0x0641, 0x0645, 0x0642,
+		0x062D, 0x0642, 0x0645, 0x0643, 0x062C, 0x0643, 0x062D, 0x0643,
+		0x062E, 0x0643, 0x0644, 0x0643, 0x0645, 0x0644, 0x062C, 0x0644,
+		0x062D, 0x0644, 0x062E, 0x0644, 0x0645, 0x0644, 0x0647, 0x0645,
+		0x062C, 0x0645, 0x062D, 0x0645, 0x062E, 0x0645, 0x0645, 0x0646,
+		0x062C, 0x0646, 0x062D, 0x0646, 0x062E, 0x0646, 0x0645, 0x0646,
+		0x0647, 0x0647, 0x062C, 0x0647, 0x0645, 0x0647, 0x0670, 0x064A,
+		0x062C, 0x064A, 0x062D, 0x064A, 0x062E, 0x064A, 0x0645, 0x064A,
+		0x0647, 0x064A, 0x0654, 0x0645, 0x064A, 0x0654, 0x0647, 0x0628,
+		0x0645, 0x0628, 0x0647, 0x062A, 0x0645, 0x062A, 0x0647, 0x062B,
+		0x0645, 0x062B, 0x0647, 0x0633, 0x0645, 0x0633, 0x0647, 0x0634,
+		0x0645, 0x0634, 0x0647, 0x0643, 0x0644, 0x0643, 0x0645, 0x0644,
+		0x0645, 0x0646, 0x0645, 0x0646, 0x0647, 0x064A, 0x0645, 0x064A,
+		0x0647, 0x0640, 0x064E, 0x0651, 0x0640, 0x064F, 0x0651, 0x0640,
+		0x0650, 0x0651, 0x0637, 0x0649, 0x0637, 0x064A, 0x0639, 0x0649,
+		0x0639, 0x064A, 0x063A, 0x0649, 0x063A, 0x064A, 0x0633, 0x0649,
+		0x0633, 0x064A, 0x0634, 0x0649, 0x0634, 0x064A, 0x062D, 0x0649,
+		0x062D, 0x064A, 0x062C, 0x0649, 0x062C, 0x064A, 0x062E, 0x0649,
+		0x062E, 0x064A, 0x0635, 0x0649, 0x0635, 0x064A, 0x0636, 0x0649,
+		0x0636, 0x064A, 0x0634, 0x062C, 0x0634, 0x062D, 0x0634, 0x062E,
+		0x0634, 0x0645, 0x0634, 0x0631, 0x0633, 0x0631, 0x0635, 0x0631,
+		0x0636, 0x0631, 0x0637, 0x0649, 0x0637, 0x064A, 0x0639, 0x0649,
+		0x0639, 0x064A, 0x063A, 0x0649, 0x063A, 0x064A, 0x0633, 0x0649,
+		0x0633, 0x064A, 0x0634, 0x0649, 0x0634, 0x064A, 0x062D, 0x0649,
+		0x062D, 0x064A, 0x062C, 0x0649, 0x062C, 0x064A, 0x062E, 0x0649,
+		0x062E, 0x064A, 0x0635, 0x0649, 0x0635, 0x064A, 0x0636, 0x0649,
+		0x0636, 0x064A, 0x0634, 0x062C, 0x0634, 0x062D, 0x0634, 0x062E,
+		0x0634, 0x0645, 0x0634, 0x0631, 0x0633, 0x0631, 0x0635, 0x0631,
+		0x0636, 0x0631, 0x0634, 0x062C, 0x0634, 0x062D, 0x0634, 0x062E,
+		0x0634, 0x0645, 0x0633, 0x0647, 0x0634, 0x0647, 0x0637, 0x0645,
+		0x0633, 0x062C, 0x0633, 0x062D, 0x0633, 0x062E, 0x0634, 0x062C,
+		0x0634, 0x062D, 0x0634, 0x062E, 0x0637, 0x0645, 0x0638, 0x0645,
+		0x0627, 0x064B, 0x0627, 0x064B, 0x062A, 0x062C, 0x0645, 0x062A,
+		0x062D, 0x062C, 0x062A, 0x062D, 0x062C, 0x062A, 0x062D, 0x0645,
+		0x062A, 0x062E, 0x0645, 0x062A, 0x0645, 0x062C, 0x062A, 0x0645,
+		0x062D, 0x062A, 0x0645, 0x062E, 0x062C, 0x0645, 0x062D, 0x062C,
+		0x0645, 0x062D, 0x062D, 0x0645, 0x064A, 0x062D, 0x0645, 0x0649,
+		0x0633, 0x062D, 0x062C, 0x0633, 0x062C, 0x062D, 0x0633, 0x062C,
+		0x0649, 0x0633, 0x0645, 0x062D, 0x0633, 0x0645, 0x062D, 0x0633,
+		0x0645, 0x062C, 0x0633, 0x0645, 0x0645, 0x0633, 0x0645, 0x0645,
+		0x0635, 0x062D, 0x062D, 0x0635, 0x062D, 0x062D, 0x0635, 0x0645,
+		0x0645, 0x0634, 0x062D, 0x0645, 0x0634, 0x062D, 0x0645, 0x0634,
+		0x062C, 0x064A, 0x0634, 0x0645, 0x062E, 0x0634, 0x0645, 0x062E,
+		0x0634, 0x0645, 0x0645, 0x0634, 0x0645, 0x0645, 0x0636, 0x062D,
+		0x0649, 0x0636, 0x062E, 0x0645, 0x0636, 0x062E, 0x0645, 0x0637,
+		0x0645, 0x062D, 0x0637, 0x0645, 0x062D, 0x0637, 0x0645, 0x0645,
+		0x0637, 0x0645, 0x064A, 0x0639, 0x062C, 0x0645, 0x0639, 0x0645,
+		0x0645, 0x0639, 0x0645, 0x0645, 0x0639, 0x0645, 0x0649, 0x063A,
+		0x0645, 0x0645, 0x063A, 0x0645, 0x064A, 0x063A, 0x0645, 0x0649,
+		0x0641, 0x062E, 0x0645, 0x0641, 0x062E, 0x0645, 0x0642, 0x0645,
+		0x062D, 0x0642, 0x0645, 0x0645, 0x0644, 0x062D, 0x0645, 0x0644,
+		0x062D, 0x064A, 0x0644, 0x062D, 0x0649, 0x0644, 0x062C, 0x062C,
+		0x0644, 0x062C, 0x062C, 0x0644, 0x062E, 0x0645, 0x0644, 0x062E,
+		0x0645, 0x0644, 0x0645, 0x062D, 0x0644, 0x0645, 0x062D, 0x0645,
+		0x062D, 0x062C, 0x0645, 0x062D, 0x0645, 0x0645, 0x062D, 0x064A,
+		0x0645, 0x062C, 0x062D, 0x0645, 0x062C, 0x0645, 0x0645, 0x062E,
+		0x062C, 0x0645, 0x062E, 0x0645, 0x0645, 0x062C, 0x062E, 0x0647,
+		0x0645, 0x062C, 0x0647, 0x0645, 0x0645, 0x0646, 0x062D, 0x0645,
+		0x0646, 0x062D, 0x0649, 0x0646, 0x062C, 0x0645, 0x0646, 0x062C,
+		0x0645, 0x0646, 0x062C, 0x0649, 0x0646, 0x0645, 0x064A, 0x0646,
+		0x0645, 0x0649, 0x064A, 0x0645, 0x0645, 0x064A, 0x0645, 0x0645,
+		0x0628, 0x062E, 0x064A, 0x062A, 0x062C, 0x064A, 0x062A, 0x062C,
+		0x0649, 0x062A, 0x062E, 0x064A, 0x062A, 0x062E, 0x0649, 0x062A,
+		0x0645, 0x064A, 0x062A, 0x0645, 0x0649, 0x062C, 0x0645, 0x064A,
+		0x062C, 0x062D, 0x0649, 0x062C, 0x0645, 0x0649, 0x0633, 0x062E,
+		0x0649, 0x0635, 0x062D, 0x064A, 0x0634, 0x062D, 0x064A, 0x0636,
+		0x062D, 0x064A, 0x0644, 0x062C, 0x064A, 0x0644, 0x0645, 0x064A,
+		0x064A, 0x062D, 0x064A, 0x064A, 0x062C, 0x064A, 0x064A, 0x0645,
+		0x064A, 0x0645, 0x0645, 0x064A, 0x0642, 0x0645, 0x064A, 0x0646,
+		0x062D, 0x064A, 0x0642, 0x0645, 0x062D, 0x0644, 0x062D, 0x0645,
+		0x0639, 0x0645, 0x064A, 0x0643, 0x0645, 0x064A, 0x0646, 0x062C,
+		0x062D, 0x0645, 0x062E, 0x064A, 0x0644, 0x062C, 0x0645, 0x0643,
+		0x0645, 0x0645, 0x0644, 0x062C, 0x0645, 0x0646, 0x062C, 0x062D,
+		0x062C, 0x062D, 0x064A, 0x062D, 0x062C, 0x064A, 0x0645, 0x062C,
+		0x064A, 0x0641, 0x0645, 0x064A, 0x0628, 0x062D, 0x064A, 0x0643,
+		0x0645, 0x0645, 0x0639, 0x062C, 0x0645, 0x0635, 0x0645, 0x0645,
+		0x0633, 0x062E, 0x064A, 0x0646, 0x062C, 0x064A, 0x0635, 0x0644,
+		0x06D2, 0x0642, 0x0644, 0x06D2, 0x0627, 0x0644, 0x0644, 0x0647,
+		0x0627, 0x0643, 0x0628, 0x0631, 0x0645, 0x062D, 0x0645, 0x062F,
+		0x0635, 0x0644, 0x0639, 0x0645, 0x0631, 0x0633, 0x0648, 0x0644,
+		0x0639, 0x0644, 0x064A, 0x0647, 0x0648, 0x0633, 0x0644, 0x0645,
+		0x0635, 0x0644, 0x0649, 0x0635, 0x0644, 0x0649, 0x0020, 0x0627,
+		0x0644, 0x0644, 0x0647, 0x0020, 0x0639, 0x0644, 0x064A, 0x0647,
+		0x0020, 0x0648, 0x0633, 0x0644, 0x0645, 0x062C, 0x0644, 0x0020,
+		0x062C, 0x0644, 0x0627, 0x0644, 0x0647, 0x0631, 0x06CC, 0x0627,
+		0x0644, 0x002C, 0x3001, 0x3002, 0x003A, 0x003B, 0x0021, 0x003F,
+		0x3016, 0x3017, 0x002E, 0x002E, 0x002E, 0x002E, 0x002E, 0x2014,
+		0x2013, 0x005F, 0x005F, 0x0028, 0x0029, 0x007B, 0x007D, 0x3014,
+		0x3015, 0x3010, 0x3011, 0x300A, 0x300B, 0x3008, 0x3009, 0x300C,
+		0x300D, 0x300E, 0x300F, 0x005B, 0x005D, 0x0020, 0x0305, 0x0020,
+		0x0305, 0x0020, 0x0305, 0x0020, 0x0305, 0x005F, 0x005F, 0x005F,
+		0x002C, 0x3001, 0x002E, 0x003B, 0x003A, 0x003F, 0x0021, 0x2014,
+		0x0028, 0x0029, 0x007B, 0x007D, 0x3014, 0x3015, 0x0023, 0x0026,
+		0x002A, 0x002B, 0x002D, 0x003C, 0x003E, 0x003D, 0x005C, 0x0024,
+		0x0025, 0x0040, 0x0020, 0x064B, 0x0640, 0x064B, 0x0020, 0x064C,
+		0x0020, 0x064D, 0x0020, 0x064E, 0x0640, 0x064E, 0x0020, 0x064F,
+		0x0640, 0x064F, 0x0020, 0x0650, 0x0640, 0x0650, 0x0020, 0x0651,
+		0x0640, 0x0651, 0x0020, 0x0652, 0x0640, 0x0652, 0x0621, 0x0627,
+		0x0653, 0x0627, 0x0653, 0x0627, 0x0654, 0x0627, 0x0654, 0x0648,
+		0x0654, 0x0648, 0x0654, 0x0627, 0x0655, 0x0627, 0x0655, 0x064A,
+		0x0654, 0x064A, 0x0654, 0x064A, 0x0654, 0x064A, 0x0654, 0x0627,
+		0x0627, 0x0628, 0x0628, 0x0628, 0x0628, 0x0629, 0x0629, 0x062A,
+		0x062A, 0x062A, 0x062A, 0x062B, 0x062B, 0x062B, 0x062B, 0x062C,
+		0x062C, 0x062C, 0x062C, 0x062D, 0x062D, 0x062D, 0x062D, 0x062E,
+		0x062E, 0x062E, 0x062E, 0x062F, 0x062F, 0x0630, 0x0630, 0x0631,
+		0x0631, 0x0632, 0x0632, 0x0633, 0x0633, 0x0633, 0x0633, 0x0634,
+		0x0634, 0x0634, 0x0634, 0x0635, 0x0635, 0x0635, 0x0635, 0x0636,
+		0x0636, 0x0636, 0x0636, 0x0637, 0x0637, 0x0637, 0x0637, 0x0638,
+		0x0638, 0x0638, 0x0638, 0x0639, 0x0639, 0x0639, 0x0639, 0x063A,
+		0x063A, 0x063A, 0x063A, 0x0641, 0x0641, 0x0641, 0x0641, 0x0642,
+		0x0642, 0x0642, 0x0642, 0x0643, 0x0643, 0x0643, 0x0643, 0x0644,
+		0x0644, 0x0644, 0x0644, 0x0645, 0x0645, 0x0645, 0x0645, 0x0646,
+		0x0646, 0x0646, 0x0646, 0x0647, 0x0647, 0x0647, 0x0647, 0x0648,
+		0x0648, 0x0649, 0x0649, 0x064A, 0x064A, 0x064A, 0x064A, 0x0644,
+		0x0627, 0x0653, 0x0644, 0x0627, 0x0653, 0x0644, 0x0627, 0x0654,
+		0x0644, 0x0627, 0x0654, 0x0644, 0x0627, 0x0655, 0x0644, 0x0627,
+		0x0655, 0x0644, 0x0627, 0x0644, 0x0627, 0x0021, 0x0022, 0x0023,
+		0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B,
+		0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031, 0x0032, 0x0033,
+		0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B,
+		0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041, 0x0042, 0x0043,
+		0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B,
+		0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053,
+		0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B,
+		0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0x0061, 0x0062, 0x0063,
+		0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B,
+		0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073,
+		0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B,
+		0x007C, 0x007D, 0x007E, 0x2985, 0x2986, 0x3002, 0x300C, 0x300D,
+		0x3001, 0x30FB, 0x30F2, 0x30A1, 0x30A3, 0x30A5, 0x30A7, 0x30A9,
+		0x30E3, 0x30E5, 0x30E7, 0x30C3, 0x30FC, 0x30A2, 0x30A4, 0x30A6,
+		0x30A8, 0x30AA, 0x30AB, 0x30AD, 0x30AF, 0x30B1, 0x30B3, 0x30B5,
+		0x30B7, 0x30B9, 0x30BB, 0x30BD, 0x30BF, 0x30C1, 0x30C4, 0x30C6,
+		0x30C8, 0x30CA, 0x30CB, 0x30CC, 0x30CD, 0x30CE, 0x30CF, 0x30D2,
+		0x30D5, 0x30D8, 0x30DB, 0x30DE, 0x30DF, 0x30E0, 0x30E1, 0x30E2,
+		0x30E4, 0x30E6, 0x30E8, 0x30E9, 0x30EA, 0x30EB, 0x30EC, 0x30ED,
+		0x30EF, 0x30F3, 0x3099, 0x309A, 0x1160, 0x1100, 0x1101, 0x11AA,
+		0x1102, 0x11AC, 0x11AD, 0x1103, 0x1104, 0x1105, 0x11B0, 0x11B1,
+		0x11B2, 0x11B3, 0x11B4, 0x11B5, 0x111A, 0x1106, 0x1107, 0x1108,
+		0x1121, 0x1109, 0x110A, 0x110B, 0x110C, 0x110D, 0x110E, 0x110F,
+		0x1110, 0x1111, 0x1112, 0x1161, 0x1162, 0x1163, 0x1164, 0x1165,
+		0x1166, 0x1167, 0x1168, 0x1169, 0x116A, 0x116B, 0x116C, 0x116D,
+		0x116E, 0x116F, 0x1170, 0x1171, 0x1172, 0x1173, 0x1174, 0x1175,
+		0x00A2, 0x00A3, 0x00AC, 0x0020, 0x0304, 0x00A6, 0x00A5, 0x20A9,
+		0x2502, 0x2190, 0x2191, 0x2192, 0x2193, 0x25A0, 0x25CB, 0x02D0,
+		0x02D1, 0x00E6, 0x0299, 0x0253, 0x02A3, 0xAB66, 0x02A5, 0x02A4,
+		0x0256, 0x0257, 0x1D91, 0x0258, 0x025E, 0x02A9, 0x0264, 0x0262,
+		0x0260, 0x029B, 0x0127, 0x029C, 0x0267, 0x0284, 0x02AA, 0x02AB,
+		0x026C, 0x1DF04, 0xA78E, 0x026E, 0x1DF05, 0x028E, 0x1DF06, 0x00F8,
+		0x0276, 0x0277, 0x0071, 0x027A, 0x1DF08, 0x027D, 0x027E, 0x0280,
+		0x02A8, 0x02A6, 0xAB67, 0x02A7, 0x0288, 0x2C71, 0x028F, 0x02A1,
+		0x02A2, 0x0298, 0x01C0, 0x01C1, 0x01C2, 0x1DF0A, 0x1DF1E, 0x11099,
+		0x110BA, 0x1109B, 0x110BA, 0x110A5, 0x110BA, 0x11131, 0x11127, 0x11132,
+		0x11127, 0x11347, 0x1133E, 0x11347, 0x11357, 0x114B9, 0x114BA, 0x114B9,
+		0x114B0, 0x114B9, 0x114BD, 0x115B8, 0x115AF, 0x115B9, 0x115AF, 0x11935,
+		0x11930, 0x1D157, 0x1D165, 0x1D158, 0x1D165, 0x1D158, 0x1D165, 0x1D16E,
+		0x1D158, 0x1D165, 0x1D16F, 0x1D158, 0x1D165, 0x1D170, 0x1D158, 0x1D165,
+		0x1D171, 0x1D158, 0x1D165, 0x1D172, 0x1D1B9, 0x1D165, 0x1D1BA, 0x1D165,
+		0x1D1B9, 0x1D165, 0x1D16E, 0x1D1BA, 0x1D165, 0x1D16E, 0x1D1B9, 0x1D165,
+		0x1D16F, 0x1D1BA, 0x1D165, 0x1D16F, 0x0041, 0x0042, 0x0043, 0x0044,
+		0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C,
+		0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054,
+		0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x0061, 0x0062,
+		0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A,
+		0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072,
+		0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A,
+		0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048,
+		0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050,
+		0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058,
+		0x0059, 0x005A, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066,
+		0x0067, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+		0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+		0x0078, 0x0079, 0x007A, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045,
+		0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D,
+		0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055,
+		0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x0061, 0x0062, 0x0063,
+		0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B,
+		0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073,
+		0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x0041,
+		0x0043, 0x0044, 0x0047, 0x004A, 0x004B, 0x004E, 0x004F, 0x0050,
+		0x0051, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059,
+		0x005A, 0x0061, 0x0062, 0x0063, 0x0064, 0x0066, 0x0068, 0x0069,
+		0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x0070, 0x0071, 0x0072,
+		0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A,
+		0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048,
+		0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050,
+		0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058,
+		0x0059, 0x005A, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066,
+		0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E,
+		0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076,
+		0x0077, 0x0078, 0x0079, 0x007A, 0x0041, 0x0042, 0x0044, 0x0045,
+		0x0046, 0x0047, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+		0x0050, 0x0051, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058,
+		0x0059, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+		0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+		0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+		0x0078, 0x0079, 0x007A, 0x0041, 0x0042, 0x0044, 0x0045, 0x0046,
+		0x0047, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004F, 0x0053,
+		0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x0061, 0x0062,
+		0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A,
+		0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072,
+		0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A,
+		0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048,
+		0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050,
+		0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058,
+		0x0059, 0x005A, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066,
+		0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E,
+		0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076,
+		0x0077, 0x0078, 0x0079, 0x007A, 0x0041, 0x0042, 0x0043, 0x0044,
+		0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C,
+		0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054,
+		0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x0061, 0x0062,
+		0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A,
+		0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072,
+		0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A,
+		0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048,
+		0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050,
+		0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058,
+		0x0059, 0x005A, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066,
+		0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E,
+		0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076,
+		0x0077, 0x0078, 0x0079, 0x007A, 0x0041, 0x0042, 0x0043, 0x0044,
+		0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C,
+		0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054,
+		0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x0061, 0x0062,
+		0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A,
+		0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072,
+		0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A,
+		0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048,
+		0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050,
+		0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058,
+		0x0059, 0x005A, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066,
+		0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E,
+		0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076,
+		0x0077, 0x0078, 0x0079, 0x007A, 0x0041, 0x0042, 0x0043, 0x0044,
+		0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C,
+		0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054,
+		0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x0061, 0x0062,
+		0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A,
+		0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072,
+		0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A,
+		0x0131, 0x0237, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396,
+		0x0397, 0x0398, 0x0399, 0x039A, 0x039B, 0x039C, 0x039D, 0x039E,
+		0x039F, 0x03A0, 0x03A1, 0x0398, 0x03A3, 0x03A4, 0x03A5, 0x03A6,
+		0x03A7, 0x03A8, 0x03A9, 0x2207, 0x03B1, 0x03B2, 0x03B3, 0x03B4,
+		0x03B5, 0x03B6, 0x03B7, 0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC,
+		0x03BD, 0x03BE, 0x03BF, 0x03C0, 0x03C1, 0x03C2, 0x03C3, 0x03C4,
+		0x03C5, 0x03C6, 0x03C7, 0x03C8, 0x03C9, 0x2202, 0x03B5, 0x03B8,
+		0x03BA, 0x03C6, 0x03C1, 0x03C0, 0x0391, 0x0392, 0x0393, 0x0394,
+		0x0395, 0x0396, 0x0397, 0x0398, 0x0399, 0x039A, 0x039B, 0x039C,
+		0x039D, 0x039E, 0x039F, 0x03A0, 0x03A1, 0x0398, 0x03A3, 0x03A4,
+		0x03A5, 0x03A6, 0x03A7, 0x03A8, 0x03A9, 0x2207, 0x03B1, 0x03B2,
+		0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7, 0x03B8, 0x03B9, 0x03BA,
+		0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF, 0x03C0, 0x03C1, 0x03C2,
+		0x03C3, 0x03C4, 0x03C5, 0x03C6, 0x03C7, 0x03C8, 0x03C9, 0x2202,
+		0x03B5, 0x03B8, 0x03BA, 0x03C6, 0x03C1, 0x03C0, 0x0391, 0x0392,
+		0x0393, 0x0394, 0x0395, 0x0396, 0x0397, 0x0398, 0x0399, 0x039A,
+		0x039B, 0x039C, 0x039D, 0x039E, 0x039F, 0x03A0, 0x03A1, 0x0398,
+		0x03A3, 0x03A4, 0x03A5, 0x03A6, 0x03A7, 0x03A8, 0x03A9, 0x2207,
+		0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7, 0x03B8,
+		0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF, 0x03C0,
+		0x03C1, 0x03C2, 0x03C3, 0x03C4, 0x03C5, 0x03C6, 0x03C7, 0x03C8,
+		0x03C9, 0x2202, 0x03B5, 0x03B8, 0x03BA, 0x03C6, 0x03C1, 0x03C0,
+		0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397, 0x0398,
+		0x0399, 0x039A, 0x039B, 0x039C, 0x039D, 0x039E, 0x039F, 0x03A0,
+		0x03A1, 0x0398, 0x03A3, 0x03A4, 0x03A5, 0x03A6, 0x03A7, 0x03A8,
+		0x03A9, 0x2207, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6,
+		0x03B7, 0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BE,
+		0x03BF, 0x03C0, 0x03C1, 0x03C2, 0x03C3, 0x03C4, 0x03C5, 0x03C6,
+		0x03C7, 0x03C8, 0x03C9, 0x2202, 0x03B5, 0x03B8, 0x03BA, 0x03C6,
+		0x03C1, 0x03C0, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396,
+		0x0397, 0x0398, 0x0399, 0x039A, 0x039B, 0x039C, 0x039D, 0x039E,
+		0x039F, 0x03A0, 0x03A1, 0x0398, 0x03A3, 0x03A4, 0x03A5, 0x03A6,
+		0x03A7, 0x03A8, 0x03A9, 0x2207, 0x03B1, 0x03B2, 0x03B3, 0x03B4,
+		0x03B5, 0x03B6, 0x03B7, 0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC,
+		0x03BD, 0x03BE, 0x03BF, 0x03C0, 0x03C1, 0x03C2, 0x03C3, 0x03C4,
+		0x03C5, 0x03C6, 0x03C7, 0x03C8, 0x03C9, 0x2202, 0x03B5, 0x03B8,
+		0x03BA, 0x03C6, 0x03C1, 0x03C0, 0x03DC, 0x03DD, 0x0030, 0x0031,
+		0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039,
+		0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+		0x0038, 0x0039, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035,
+		0x0036, 0x0037, 0x0038, 0x0039, 0x0030, 0x0031, 0x0032, 0x0033,
+		0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x0030, 0x0031,
+		0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039,
+		0x0627, 0x0628, 0x062C, 0x062F, 0x0648, 0x0632, 0x062D, 0x0637,
+		0x064A, 0x0643, 0x0644, 0x0645, 0x0646, 0x0633, 0x0639, 0x0641,
+		0x0635, 0x0642, 0x0631, 0x0634, 0x062A, 0x062B, 0x062E, 0x0630,
+		0x0636, 0x0638, 0x063A, 0x066E, 0x06BA, 0x06A1, 0x066F, 0x0628,
+		0x062C, 0x0647, 0x062D, 0x064A, 0x0643, 0x0644, 0x0645, 0x0646,
+		0x0633, 0x0639, 0x0641, 0x0635, 0x0642, 0x0634, 0x062A, 0x062B,
+		0x062E, 0x0636, 0x063A, 0x062C, 0x062D, 0x064A, 0x0644, 0x0646,
+		0x0633, 0x0639, 0x0635, 0x0642, 0x0634, 0x062E, 0x0636, 0x063A,
+		0x06BA, 0x066F, 0x0628, 0x062C, 0x0647, 0x062D, 0x0637, 0x064A,
+		0x0643, 0x0645, 0x0646, 0x0633, 0x0639, 0x0641, 0x0635, 0x0642,
+		0x0634, 0x062A, 0x062B, 0x062E, 0x0636, 0x0638, 0x063A, 0x066E,
+		0x06A1, 0x0627, 0x0628, 0x062C, 0x062F, 0x0647, 0x0648, 0x0632,
+		0x062D, 0x0637, 0x064A, 0x0644, 0x0645, 0x0646, 0x0633, 0x0639,
+		0x0641, 0x0635, 0x0642, 0x0631, 0x0634, 0x062A, 0x062B, 0x062E,
+		0x0630, 0x0636, 0x0638, 0x063A, 0x0628, 0x062C, 0x062F, 0x0648,
+		0x0632, 0x062D, 0x0637, 0x064A, 0x0644, 0x0645, 0x0646, 0x0633,
+		0x0639, 0x0641, 0x0635, 0x0642, 0x0631, 0x0634, 0x062A, 0x062B,
+		0x062E, 0x0630, 0x0636, 0x0638, 0x063A, 0x0030, 0x002E, 0x0030,
+		0x002C, 0x0031, 0x002C, 0x0032, 0x002C, 0x0033, 0x002C, 0x0034,
+		0x002C, 0x0035, 0x002C, 0x0036, 0x002C, 0x0037, 0x002C, 0x0038,
+		0x002C, 0x0039, 0x002C, 0x0028, 0x0041, 0x0029, 0x0028, 0x0042,
+		0x0029, 0x0028, 0x0043, 0x0029, 0x0028, 0x0044, 0x0029, 0x0028,
+		0x0045, 0x0029, 0x0028, 0x0046, 0x0029, 0x0028, 0x0047, 0x0029,
+		0x0028, 0x0048, 0x0029, 0x0028, 0x0049, 0x0029, 0x0028, 0x004A,
+		0x0029, 0x0028, 0x004B, 0x0029, 0x0028, 0x004C, 0x0029, 0x0028,
+		0x004D, 0x0029, 0x0028, 0x004E, 0x0029, 0x0028, 0x004F, 0x0029,
+		0x0028, 0x0050, 0x0029, 0x0028, 0x0051, 0x0029, 0x0028, 0x0052,
+		0x0029, 0x0028, 0x0053, 0x0029, 0x0028, 0x0054, 0x0029, 0x0028,
+		0x0055, 0x0029, 0x0028, 0x0056, 0x0029, 0x0028, 0x0057, 0x0029,
+		0x0028, 0x0058, 0x0029, 0x0028, 0x0059, 0x0029, 0x0028, 0x005A,
+		0x0029, 0x3014, 0x0053, 0x3015, 0x0043, 0x0052, 0x0043, 0x0044,
+		0x0057, 0x005A, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046,
+		0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E,
+		0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056,
+		0x0057, 0x0058, 0x0059, 0x005A, 0x0048, 0x0056, 0x004D, 0x0056,
+		0x0053, 0x0044, 0x0053, 0x0053, 0x0050, 0x0050, 0x0056, 0x0057,
+		0x0043, 0x004D, 0x0043, 0x004D, 0x0044, 0x004D, 0x0052, 0x0044,
+		0x004A, 0x307B, 0x304B, 0x30B3, 0x30B3, 0x30B5, 0x624B, 0x5B57,
+		0x53CC, 0x30C6, 0x3099, 0x4E8C, 0x591A, 0x89E3, 0x5929, 0x4EA4,
+		0x6620, 0x7121, 0x6599, 0x524D, 0x5F8C, 0x518D, 0x65B0, 0x521D,
+		0x7D42, 0x751F, 0x8CA9, 0x58F0, 0x5439, 0x6F14, 0x6295, 0x6355,
+		0x4E00, 0x4E09, 0x904A, 0x5DE6, 0x4E2D, 0x53F3, 0x6307, 0x8D70,
+		0x6253, 0x7981, 0x7A7A, 0x5408, 0x6E80, 0x6709, 0x6708, 0x7533,
+		0x5272, 0x55B6, 0x914D, 0x3014, 0x672C, 0x3015, 0x3014, 0x4E09,
+		0x3015, 0x3014, 0x4E8C, 0x3015, 0x3014, 0x5B89, 0x3015, 0x3014,
+		0x70B9, 0x3015, 0x3014, 0x6253, 0x3015, 0x3014, 0x76D7, 0x3015,
+		0x3014, 0x52DD, 0x3015, 0x3014, 0x6557, 0x3015, 0x5F97, 0x53EF,
+		0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+		0x0038, 0x0039, 0x4E3D, 0x4E38, 0x4E41, 0x20122, 0x4F60, 0x4FAE,
+		0x4FBB, 0x5002, 0x507A, 0x5099, 0x50E7, 0x50CF, 0x349E, 0x2063A,
+		0x514D, 0x5154, 0x5164, 0x5177, 0x2051C, 0x34B9, 0x5167, 0x518D,
+		0x2054B, 0x5197, 0x51A4, 0x4ECC, 0x51AC, 0x51B5, 0x291DF, 0x51F5,
+		0x5203, 0x34DF, 0x523B, 0x5246, 0x5272, 0x5277, 0x3515, 0x52C7,
+		0x52C9, 0x52E4, 0x52FA, 0x5305, 0x5306, 0x5317, 0x5349, 0x5351,
+		0x535A, 0x5373, 0x537D, 0x537F, 0x537F, 0x537F, 0x20A2C, 0x7070,
+		0x53CA, 0x53DF, 0x20B63, 0x53EB, 0x53F1, 0x5406, 0x549E, 0x5438,
+		0x5448, 0x5468, 0x54A2, 0x54F6, 0x5510, 0x5553, 0x5563, 0x5584,
+		0x5584, 0x5599, 0x55AB, 0x55B3, 0x55C2, 0x5716, 0x5606, 0x5717,
+		0x5651, 0x5674, 0x5207, 0x58EE, 0x57CE, 0x57F4, 0x580D, 0x578B,
+		0x5832, 0x5831, 0x58AC, 0x214E4, 0x58F2, 0x58F7, 0x5906, 0x591A,
+		0x5922, 0x5962, 0x216A8, 0x216EA, 0x59EC, 0x5A1B, 0x5A27, 0x59D8,
+		0x5A66, 0x36EE, 0x36FC, 0x5B08, 0x5B3E, 0x5B3E, 0x219C8, 0x5BC3,
+		0x5BD8, 0x5BE7, 0x5BF3, 0x21B18, 0x5BFF, 0x5C06, 0x5F53, 0x5C22,
+		0x3781, 0x5C60, 0x5C6E, 0x5CC0, 0x5C8D, 0x21DE4, 0x5D43, 0x21DE6,
+		0x5D6E, 0x5D6B, 0x5D7C, 0x5DE1, 0x5DE2, 0x382F, 0x5DFD, 0x5E28,
+		0x5E3D, 0x5E69, 0x3862, 0x22183, 0x387C, 0x5EB0, 0x5EB3, 0x5EB6,
+		0x5ECA, 0x2A392, 0x5EFE, 0x22331, 0x22331, 0x8201, 0x5F22, 0x5F22,
+		0x38C7, 0x232B8, 0x261DA, 0x5F62, 0x5F6B, 0x38E3, 0x5F9A, 0x5FCD,
+		0x5FD7, 0x5FF9, 0x6081, 0x393A, 0x391C, 0x6094, 0x226D4, 0x60C7,
+		0x6148, 0x614C, 0x614E, 0x614C, 0x617A, 0x618E, 0x61B2, 0x61A4,
+		0x61AF, 0x61DE, 0x61F2, 0x61F6, 0x6210, 0x621B, 0x625D, 0x62B1,
+		0x62D4, 0x6350, 0x22B0C, 0x633D, 0x62FC, 0x6368, 0x6383, 0x63E4,
+		0x22BF1, 0x6422, 0x63C5, 0x63A9, 0x3A2E, 0x6469, 0x647E, 0x649D,
+		0x6477, 0x3A6C, 0x654F, 0x656C, 0x2300A, 0x65E3, 0x66F8, 0x6649,
+		0x3B19, 0x6691, 0x3B08, 0x3AE4, 0x5192, 0x5195, 0x6700, 0x669C,
+		0x80AD, 0x43D9, 0x6717, 0x671B, 0x6721, 0x675E, 0x6753, 0x233C3,
+		0x3B49, 0x67FA, 0x6785, 0x6852, 0x6885, 0x2346D, 0x688E, 0x681F,
+		0x6914, 0x3B9D, 0x6942, 0x69A3, 0x69EA, 0x6AA8, 0x236A3, 0x6ADB,
+		0x3C18, 0x6B21, 0x238A7, 0x6B54, 0x3C4E, 0x6B72, 0x6B9F, 0x6BBA,
+		0x6BBB, 0x23A8D, 0x21D0B, 0x23AFA, 0x6C4E, 0x23CBC, 0x6CBF, 0x6CCD,
+		0x6C67, 0x6D16, 0x6D3E, 0x6D77, 0x6D41, 0x6D69, 0x6D78, 0x6D85,
+		0x23D1E, 0x6D34, 0x6E2F, 0x6E6E, 0x3D33, 0x6ECB, 0x6EC7, 0x23ED1,
+		0x6DF9, 0x6F6E, 0x23F5E, 0x23F8E, 0x6FC6, 0x7039, 0x701E, 0x701B,
+		0x3D96, 0x704A, 0x707D, 0x7077, 0x70AD, 0x20525, 0x7145, 0x24263,
+		0x719C, 0x243AB, 0x7228, 0x7235, 0x7250, 0x24608, 0x7280, 0x7295,
+		0x24735, 0x24814, 0x737A, 0x738B, 0x3EAC, 0x73A5, 0x3EB8, 0x3EB8,
+		0x7447, 0x745C, 0x7471, 0x7485, 0x74CA, 0x3F1B, 0x7524, 0x24C36,
+		0x753E, 0x24C92, 0x7570, 0x2219F, 0x7610, 0x24FA1, 0x24FB8, 0x25044,
+		0x3FFC, 0x4008, 0x76F4, 0x250F3, 0x250F2, 0x25119, 0x25133, 0x771E,
+		0x771F, 0x771F, 0x774A, 0x4039, 0x778B, 0x4046, 0x4096, 0x2541D,
+		0x784E, 0x788C, 0x78CC, 0x40E3, 0x25626, 0x7956, 0x2569A, 0x256C5,
+		0x798F, 0x79EB, 0x412F, 0x7A40, 0x7A4A, 0x7A4F, 0x2597C, 0x25AA7,
+		0x25AA7, 0x7AEE, 0x4202, 0x25BAB, 0x7BC6, 0x7BC9, 0x4227, 0x25C80,
+		0x7CD2, 0x42A0, 0x7CE8, 0x7CE3, 0x7D00, 0x25F86, 0x7D63, 0x4301,
+		0x7DC7, 0x7E02, 0x7E45, 0x4334, 0x26228, 0x26247, 0x4359, 0x262D9,
+		0x7F7A, 0x2633E, 0x7F95, 0x7FFA, 0x8005, 0x264DA, 0x26523, 0x8060,
+		0x265A8, 0x8070, 0x2335F, 0x43D5, 0x80B2, 0x8103, 0x440B, 0x813E,
+		0x5AB5, 0x267A7, 0x267B5, 0x23393, 0x2339C, 0x8201, 0x8204, 0x8F9E,
+		0x446B, 0x8291, 0x828B, 0x829D, 0x52B3, 0x82B1, 0x82B3, 0x82BD,
+		0x82E6, 0x26B3C, 0x82E5, 0x831D, 0x8363, 0x83AD, 0x8323, 0x83BD,
+		0x83E7, 0x8457, 0x8353, 0x83CA, 0x83CC, 0x83DC, 0x26C36, 0x26D6B,
+		0x26CD5, 0x452B, 0x84F1, 0x84F3, 0x8516, 0x273CA, 0x8564, 0x26F2C,
+		0x455D, 0x4561, 0x26FB1, 0x270D2, 0x456B, 0x8650, 0x865C, 0x8667,
+		0x8669, 0x86A9, 0x8688, 0x870E, 0x86E2, 0x8779, 0x8728, 0x876B,
+		0x8786, 0x45D7, 0x87E1, 0x8801, 0x45F9, 0x8860, 0x8863, 0x27667,
+		0x88D7, 0x88DE, 0x4635, 0x88FA, 0x34BB, 0x278AE, 0x27966, 0x46BE,
+		0x46C7, 0x8AA0, 0x8AED, 0x8B8A, 0x8C55, 0x27CA8, 0x8CAB, 0x8CC1,
+		0x8D1B, 0x8D77, 0x27F2F, 0x20804, 0x8DCB, 0x8DBC, 0x8DF0, 0x208DE,
+		0x8ED4, 0x8F38, 0x285D2, 0x285ED, 0x9094, 0x90F1, 0x9111, 0x2872E,
+		0x911B, 0x9238, 0x92D7, 0x92D8, 0x927C, 0x93F9, 0x9415, 0x28BFA,
+		0x958B, 0x4995, 0x95B7, 0x28D77, 0x49E6, 0x96C3, 0x5DB2, 0x9723,
+		0x29145, 0x2921A, 0x4A6E, 0x4A76, 0x97E0, 0x2940A, 0x4AB2, 0x29496,
+		0x980B, 0x980B, 0x9829, 0x295B6, 0x98E2, 0x4B33, 0x9929, 0x99A7,
+		0x99C2, 0x99FE, 0x4BCE, 0x29B30, 0x9B12, 0x9C40, 0x9CFD, 0x4CCE,
+		0x4CED, 0x9D67, 0x2A0CE, 0x4CF8, 0x2A105, 0x2A20E, 0x2A291, 0x9EBB,
+		0x4D56, 0x9EF9, 0x9EFE, 0x9F05, 0x9F0F, 0x9F16, 0x9F3B, 0x2A600,
+	};
+
+	/// The full canonical decompositions, by code point, except Hangul.
+	inline static constexpr decomposition CANONICAL[2061] = {
+		{0x00C0, 0, 2},
+		{0x00C1, 2, 2},
+		{0x00C2, 4, 2},
+		{0x00C3, 6, 2},
+		{0x00C4, 8, 2},
+		{0x00C5, 10, 2},
+		{0x00C7, 12, 2},
+		{0x00C8, 14, 2},
+		{0x00C9, 16, 2},
+		{0x00CA, 18, 2},
+		{0x00CB, 20, 2},
+		{0x00CC, 22, 2},
+		{0x00CD, 24, 2},
+		{0x00CE, 26, 2},
+		{0x00CF, 28, 2},
+		{0x00D1, 30, 2},
+		{0x00D2, 32, 2},
+		{0x00D3, 34, 2},
+		{0x00D4, 36, 2},
+		{0x00D5, 38, 2},
+		{0x00D6, 40, 2},
+		{0x00D9, 42, 2},
+		{0x00DA, 44, 2},
+		{0x00DB, 46, 2},
+		{0x00DC, 48, 2},
+		{0x00DD, 50, 2},
+		{0x00E0, 52, 2},
+		{0x00E1, 54, 2},
+		{0x00E2, 56, 2},
+		{0x00E3, 58, 2},
+		{0x00E4, 60, 2},
+		{0x00E5, 62, 2},
+		{0x00E7, 64, 2},
+		{0x00E8, 66, 2},
+		{0x00E9, 68, 2},
+		{0x00EA, 70, 2},
+		{0x00EB, 72, 2},
+		{0x00EC, 74, 2},
+		{0x00ED, 76, 2},
+		{0x00EE, 78, 2},
+		{0x00EF, 80, 2},
+		{0x00F1, 82, 2},
+		{0x00F2, 84, 2},
+		{0x00F3, 86, 2},
+		{0x00F4, 88, 2},
+		{0x00F5, 90, 2},
+		{0x00F6, 92, 2},
+		{0x00F9, 94, 2},
+		{0x00FA, 96, 2},
+		{0x00FB, 98, 2},
+		{0x00FC, 100, 2},
+		{0x00FD, 102, 2},
+		{0x00FF, 104, 2},
+		{0x0100, 106, 2},
+		{0x0101, 108, 2},
+		{0x0102, 110, 2},
+		{0x0103, 112, 2},
+		{0x0104, 114, 2},
+		{0x0105, 116, 2},
+		{0x0106, 118, 2},
+		{0x0107, 120, 2},
+		{0x0108, 122, 2},
+		{0x0109, 124, 2},
+		{0x010A, 126, 2},
+		{0x010B, 128, 2},
+		{0x010C, 130, 2},
+		{0x010D, 132, 2},
+		{0x010E, 134, 2},
+		{0x010F, 136, 2},
+		{0x0112, 138, 2},
+		{0x0113, 140, 2},
+		{0x0114, 142, 2},
+		{0x0115, 144, 2},
+		{0x0116, 146, 2},
+		{0x0117, 148, 2},
+		{0x0118, 150, 2},
+		{0x0119, 152, 2},
+		{0x011A, 154, 2},
+		{0x011B, 156, 2},
+		{0x011C, 158, 2},
+		{0x011D, 160, 2},
+		{0x011E, 162, 2},
+		{0x011F, 164, 2},
+		{0x0120, 166, 2},
+		{0x0121, 168, 2},
+		{0x0122, 170, 2},
+		{0x0123, 172, 2},
+		{0x0124, 174, 2},
+		{0x0125, 176, 2},
+		{0x0128, 178, 2},
+		{0x0129, 180, 2},
+		{0x012A, 182, 2},
+		{0x012B, 184, 2},
+		{0x012C, 186, 2},
+		{0x012D, 188, 2},
+		{0x012E, 190, 2},
+		{0x012F, 192, 2},
+		{0x0130, 194, 2},
+		{0x0134, 196, 2},
+		{0x0135, 198, 2},
+		{0x0136, 200, 2},
+		{0x0137, 202, 2},
+		{0x0139, 204, 2},
+		{0x013A, 206, 2},
+		{0x013B, 208, 2},
+		{0x013C, 210, 2},
+		{0x013D, 212, 2},
+		{0x013E, 214, 2},
+		{0x0143, 216, 2},
+		{0x0144, 218, 2},
+		{0x0145, 220, 2},
+		{0x0146, 222, 2},
+		{0x0147, 224, 2},
+		{0x0148, 226, 2},
+		{0x014C, 228, 2},
+		{0x014D, 230, 2},
+		{0x014E, 232, 2},
+		{0x014F, 234, 2},
+		{0x0150, 236, 2},
+		{0x0151, 238, 2},
+		{0x0154, 240, 2},
+		{0x0155, 242, 2},
+		{0x0156, 244, 2},
+		{0x0157, 246, 2},
+		{0x0158, 248, 2},
+		{0x0159, 250, 2},
+		{0x015A, 252, 2},
+		{0x015B, 254, 2},
+		{0x015C, 256, 2},
+		{0x015D, 258, 2},
+		{0x015E, 260, 2},
+		{0x015F, 262, 2},
+		{0x0160, 264, 2},
+		{0x0161, 266, 2},
+		{0x0162, 268, 2},
+		{0x0163, 270, 2},
+		{0x0164, 272, 2},
+		{0x0165, 274, 2},
+		{0x0168, 276, 2},
+		{0x0169, 278, 2},
+		{0x016A, 280, 2},
+		{0x016B, 282, 2},
+		{0x016C, 284, 2},
+		{0x016D, 286, 2},
+		{0x016E, 288, 2},
+		{0x016F, 290, 2},
+		{0x0170, 292, 2},
+		{0x0171, 294, 2},
+		{0x0172, 296, 2},
+		{0x0173, 298, 2},
+		{0x0174, 300, 2},
+		{0x0175, 302, 2},
+		{0x0176, 304, 2},
+		{0x0177, 306, 2},
+		{0x0178, 308, 2},
+		{0x0179, 310, 2},
+		{0x017A, 312, 2},
+		{0x017B, 314, 2},
+		{0x017C, 316, 2},
+		{0x017D, 318, 2},
+		{0x017E, 320, 2},
+		{0x01A0, 322, 2},
+		{0x01A1, 324, 2},
+		{0x01AF, 326, 2},
+		{0x01B0, 328, 2},
+		{0x01CD, 330, 2},
+		{0x01CE, 332, 2},
+		{0x01CF, 334, 2},
+		{0x01D0, 336, 2},
+		{0x01D1, 338, 2},
+		{0x01D2, 340, 2},
+		{0x01D3, 342, 2},
+		{0x01D4, 344, 2},
+		{0x01D5, 346, 3},
+		{0x01D6, 349, 3},
+		{0x01D7, 352, 3},
+		{0x01D8, 355, 3},
+		{0x01D9, 358, 3},
+		{0x01DA, 361, 3},
+		{0x01DB, 364, 3},
+		{0x01DC, 367, 3},
+		{0x01DE, 370, 3},
+		{0x01DF, 373, 3},
+		{0x01E0, 376, 3},
+		{0x01E1, 379, 3},
+		{0x01E2, 382, 2},
+		{0x01E3, 384, 2},
+		{0x01E6, 386, 2},
+		{0x01E7, 388, 2},
+		{0x01E8, 390, 2},
+		{0x01E9, 392, 2},
+		{0x01EA, 394, 2},
+		{0x01EB, 396, 2},
+		{0x01EC, 398, 3},
+		{0x01ED, 401, 3},
+		{0x01EE, 404, 2},
+		{0x01EF, 406, 2},
+		{0x01F0, 408, 2},
+		{0x01F4, 410, 2},
+		{0x01F5, 412, 2},
+		{0x01F8, 414, 2},
+		{0x01F9, 416, 2},
+		{0x01FA, 418, 3},
+		{0x01FB, 421, 3},
+		{0x01FC, 424, 2},
+		{0x01FD, 426, 2},
+		{0x01FE, 428, 2},
+		{0x01FF, 430, 2},
+		{0x0200, 432, 2},
+		{0x0201, 434, 2},
+		{0x0202, 436, 2},
+		{0x0203, 438, 2},
+		{0x0204, 440, 2},
+		{0x0205, 442, 2},
+		{0x0206, 444, 2},
+		{0x0207, 446, 2},
+		{0x0208, 448, 2},
+		{0x0209, 450, 2},
+		{0x020A, 452, 2},
+		{0x020B, 454, 2},
+		{0x020C, 456, 2},
+		{0x020D, 458, 2},
+		{0x020E, 460, 2},
+		{0x020F, 462, 2},
+		{0x0210, 464, 2},
+		{0x0211, 466, 2},
+		{0x0212, 468, 2},
+		{0x0213, 470, 2},
+		{0x0214, 472, 2},
+		{0x0215, 474, 2},
+		{0x0216, 476, 2},
+		{0x0217, 478, 2},
+		{0x0218, 480, 2},
+		{0x0219, 482, 2},
+		{0x021A, 484, 2},
+		{0x021B, 486, 2},
+		{0x021E, 488, 2},
+		{0x021F, 490, 2},
+		{0x0226, 492, 2},
+		{0x0227, 494, 2},
+		{0x0228, 496, 2},
+		{0x0229, 498, 2},
+		{0x022A, 500, 3},
+		{0x022B, 503, 3},
+		{0x022C, 506, 3},
+		{0x022D, 509, 3},
+		{0x022E, 512, 2},
+		{0x022F, 514, 2},
+		{0x0230, 516, 3},
+		{0x0231, 519, 3},
+		{0x0232, 522, 2},
+		{0x0233, 524, 2},
+		{0x0340, 526, 1},
+		{0x0341, 527, 1},
+		{0x0343, 528, 1},
+		{0x0344, 529, 2},
+		{0x0374, 531, 1},
+		{0x037E, 532, 1},
+		{0x0385, 533, 2},
+		{0x0386, 535, 2},
+		{0x0387, 537, 1},
+		{0x0388, 538, 2},
+		{0x0389, 540, 2},
+		{0x038A, 542, 2},
+		{0x038C, 544, 2},
+		{0x038E, 546, 2},
+		{0x038F, 548, 2},
+		{0x0390, 550, 3},
+		{0x03AA, 553, 2},
+		{0x03AB, 555, 2},
+		{0x03AC, 557, 2},
+		{0x03AD, 559, 2},
+		{0x03AE, 561, 2},
+		{0x03AF, 563, 2},
+		{0x03B0, 565, 3},
+		{0x03CA, 568, 2},
+		{0x03CB, 570, 2},
+		{0x03CC, 572, 2},
+		{0x03CD, 574, 2},
+		{0x03CE, 576, 2},
+		{0x03D3, 578, 2},
+		{0x03D4, 580, 2},
+		{0x0400, 582, 2},
+		{0x0401, 584, 2},
+		{0x0403, 586, 2},
+		{0x0407, 588, 2},
+		{0x040C, 590, 2},
+		{0x040D, 592, 2},
+		{0x040E, 594, 2},
+		{0x0419, 596, 2},
+		{0x0439, 598, 2},
+		{0x0450, 600, 2},
+		{0x0451, 602, 2},
+		{0x0453, 604, 2},
+		{0x0457, 606, 2},
+		{0x045C, 608, 2},
+		{0x045D, 610, 2},
+		{0x045E, 612, 2},
+		{0x0476, 614, 2},
+		{0x0477, 616, 2},
+		{0x04C1, 618, 2},
+		{0x04C2, 620, 2},
+		{0x04D0, 622, 2},
+		{0x04D1, 624, 2},
+		{0x04D2, 626, 2},
+		{0x04D3, 628, 2},
+		{0x04D6, 630, 2},
+		{0x04D7, 632, 2},
+		{0x04DA, 634, 2},
+		{0x04DB, 636, 2},
+		{0x04DC, 638, 2},
+		{0x04DD, 640, 2},
+		{0x04DE, 642, 2},
+		{0x04DF, 644, 2},
+		{0x04E2, 646, 2},
+		{0x04E3, 648, 2},
+		{0x04E4, 650, 2},
+		{0x04E5, 652, 2},
+		{0x04E6, 654, 2},
+		{0x04E7, 656, 2},
+		{0x04EA, 658, 2},
+		{0x04EB, 660, 2},
+		{0x04EC, 662, 2},
+		{0x04ED, 664, 2},
+		{0x04EE, 666, 2},
+		{0x04EF, 668, 2},
+		{0x04F0, 670, 2},
+		{0x04F1, 672, 2},
+		{0x04F2, 674, 2},
+		{0x04F3, 676, 2},
+		{0x04F4, 678, 2},
+		{0x04F5, 680, 2},
+		{0x04F8, 682, 2},
+		{0x04F9, 684, 2},
+		{0x0622, 686, 2},
+		{0x0623, 688, 2},
+		{0x0624, 690, 2},
+		{0x0625, 692, 2},
+		{0x0626, 694, 2},
+		{0x06C0, 696, 2},
+		{0x06C2, 698, 2},
+		{0x06D3, 700, 2},
+		{0x0929, 702, 2},
+		{0x0931, 704, 2},
+		{0x0934, 706, 2},
+		{0x0958, 708, 2},
+		{0x0959, 710, 2},
+		{0x095A, 712, 2},
+		{0x095B, 714, 2},
+		{0x095C, 716, 2},
+		{0x095D, 718, 2},
+		{0x095E, 720, 2},
+		{0x095F, 722, 2},
+		{0x09CB, 724, 2},
+		{0x09CC, 726, 2},
+		{0x09DC, 728, 2},
+		{0x09DD, 730, 2},
+		{0x09DF, 732, 2},
+		{0x0A33, 734, 2},
+		{0x0A36, 736, 2},
+		{0x0A59, 738, 2},
+		{0x0A5A, 740, 2},
+		{0x0A5B, 742, 2},
+		{0x0A5E, 744, 2},
+		{0x0B48, 746, 2},
+		{0x0B4B, 748, 2},
+		{0x0B4C, 750, 2},
+		{0x0B5C, 752, 2},
+		{0x0B5D, 754, 2},
+		{0x0B94, 756, 2},
+		{0x0BCA, 758, 2},
+		{0x0BCB, 760, 2},
+		{0x0BCC, 762, 2},
+		{0x0C48, 764, 2},
+		{0x0CC0, 766, 2},
+		{0x0CC7, 768, 2},
+		{0x0CC8, 770, 2},
+		{0x0CCA, 772, 2},
+		{0x0CCB, 774, 3},
+		{0x0D4A, 777, 2},
+		{0x0D4B, 779, 2},
+		{0x0D4C, 781, 2},
+		{0x0DDA, 783, 2},
+		{0x0DDC, 785, 2},
+		{0x0DDD, 787, 3},
+		{0x0DDE, 790, 2},
+		{0x0F43, 792, 2},
+		{0x0F4D, 794, 2},
+		{0x0F52, 796, 2},
+		{0x0F57, 798, 2},
+		{0x0F5C, 800, 2},
+		{0x0F69, 802, 2},
+		{0x0F73, 804, 2},
+		{0x0F75, 806, 2},
+		{0x0F76, 808, 2},
+		{0x0F78, 810, 2},
+		{0x0F81, 812, 2},
+		{0x0F93, 814, 2},
+		{0x0F9D, 816, 2},
+		{0x0FA2, 818, 2},
+		{0x0FA7, 820, 2},
+		{0x0FAC, 822, 2},
+		{0x0FB9, 824, 2},
+		{0x1026, 826, 2},
+		{0x1B06, 828, 2},
+		{0x1B08, 830, 2},
+		{0x1B0A, 832, 2},
+		{0x1B0C, 834, 2},
+		{0x1B0E, 836, 2},
+		{0x1B12, 838, 2},
+		{0x1B3B, 840, 2},
+		{0x1B3D, 842, 2},
+		{0x1B40, 844, 2},
+		{0x1B41, 846, 2},
+		{0x1B43, 848, 2},
+		{0x1E00, 850, 2},
+		{0x1E01, 852, 2},
+		{0x1E02, 854, 2},
+		{0x1E03, 856, 2},
+		{0x1E04, 858, 2},
+		{0x1E05, 860, 2},
+		{0x1E06, 862, 2},
+		{0x1E07, 864, 2},
+		{0x1E08, 866, 3},
+		{0x1E09, 869, 3},
+		{0x1E0A, 872, 2},
+		{0x1E0B, 874, 2},
+		{0x1E0C, 876, 2},
+		{0x1E0D, 878, 2},
+		{0x1E0E, 880, 2},
+		{0x1E0F, 882, 2},
+		{0x1E10, 884, 2},
+		{0x1E11, 886, 2},
+		{0x1E12, 888, 2},
+		{0x1E13, 890, 2},
+		{0x1E14, 892, 3},
+		{0x1E15, 895, 3},
+		{0x1E16, 898, 3},
+		{0x1E17, 901, 3},
+		{0x1E18, 904, 2},
+		{0x1E19, 906, 2},
+		{0x1E1A, 908, 2},
+		{0x1E1B, 910, 2},
+		{0x1E1C, 912, 3},
+		{0x1E1D, 915, 3},
+		{0x1E1E, 918, 2},
+		{0x1E1F, 920, 2},
+		{0x1E20, 922, 2},
+		{0x1E21, 924, 2},
+		{0x1E22, 926, 2},
+		{0x1E23, 928, 2},
+		{0x1E24, 930, 2},
+		{0x1E25, 932, 2},
+		{0x1E26, 934, 2},
+		{0x1E27, 936, 2},
+		{0x1E28, 938, 2},
+		{0x1E29, 940, 2},
+		{0x1E2A, 942, 2},
+		{0x1E2B, 944, 2},
+		{0x1E2C, 946, 2},
+		{0x1E2D, 948, 2},
+		{0x1E2E, 950, 3},
+		{0x1E2F, 953, 3},
+		{0x1E30, 956, 2},
+		{0x1E31, 958, 2},
+		{0x1E32, 960, 2},
+		{0x1E33, 962, 2},
+		{0x1E34, 964, 2},
+		{0x1E35, 966, 2},
+		{0x1E36, 968, 2},
+		{0x1E37, 970, 2},
+		{0x1E38, 972, 3},
+		{0x1E39, 975, 3},
+		{0x1E3A, 978, 2},
+		{0x1E3B, 980, 2},
+		{0x1E3C, 982, 2},
+		{0x1E3D, 984, 2},
+		{0x1E3E, 986, 2},
+		{0x1E3F, 988, 2},
+		{0x1E40, 990, 2},
+		{0x1E41, 992, 2},
+		{0x1E42, 994, 2},
+		{0x1E43, 996, 2},
+		{0x1E44, 998, 2},
+		{0x1E45, 1000, 2},
+		{0x1E46, 1002, 2},
+		{0x1E47, 1004, 2},
+		{0x1E48, 1006, 2},
+		{0x1E49, 1008, 2},
+		{0x1E4A, 1010, 2},
+		{0x1E4B, 1012, 2},
+		{0x1E4C, 1014, 3},
+		{0x1E4D, 1017, 3},
+		{0x1E4E, 1020, 3},
+		{0x1E4F, 1023, 3},
+		{0x1E50, 1026, 3},
+		{0x1E51, 1029, 3},
+		{0x1E52, 1032, 3},
+		{0x1E53, 1035, 3},
+		{0x1E54, 1038, 2},
+		{0x1E55, 1040, 2},
+		{0x1E56, 1042, 2},
+		{0x1E57, 1044, 2},
+		{0x1E58, 1046, 2},
+		{0x1E59, 1048, 2},
+		{0x1E5A, 1050, 2},
+		{0x1E5B, 1052, 2},
+		{0x1E5C, 1054, 3},
+		{0x1E5D, 1057, 3},
+		{0x1E5E, 1060, 2},
+		{0x1E5F, 1062, 2},
+		{0x1E60, 1064, 2},
+		{0x1E61, 1066, 2},
+		{0x1E62, 1068, 2},
+		{0x1E63, 1070, 2},
+		{0x1E64, 1072, 3},
+		{0x1E65, 1075, 3},
+		{0x1E66, 1078, 3},
+		{0x1E67, 1081, 3},
+		{0x1E68, 1084, 3},
+		{0x1E69, 1087, 3},
+		{0x1E6A, 1090, 2},
+		{0x1E6B, 1092, 2},
+		{0x1E6C, 1094, 2},
+		{0x1E6D, 1096, 2},
+		{0x1E6E, 1098, 2},
+		{0x1E6F, 1100, 2},
+		{0x1E70, 1102, 2},
+		{0x1E71, 1104, 2},
+		{0x1E72, 1106, 2},
+		{0x1E73, 1108, 2},
+		{0x1E74, 1110, 2},
+		{0x1E75, 1112, 2},
+		{0x1E76, 1114, 2},
+		{0x1E77, 1116, 2},
+		{0x1E78, 1118, 3},
+		{0x1E79, 1121, 3},
+		{0x1E7A, 1124, 3},
+		{0x1E7B, 1127, 3},
+		{0x1E7C, 1130, 2},
+		{0x1E7D, 1132, 2},
+		{0x1E7E, 1134, 2},
+		{0x1E7F, 1136, 2},
+		{0x1E80, 1138, 2},
+		{0x1E81, 1140, 2},
+		{0x1E82, 1142, 2},
+		{0x1E83, 1144, 2},
+		{0x1E84, 1146, 2},
+		{0x1E85, 1148, 2},
+		{0x1E86, 1150, 2},
+		{0x1E87, 1152, 2},
+		{0x1E88, 1154, 2},
+		{0x1E89, 1156, 2},
+		{0x1E8A, 1158, 2},
+		{0x1E8B, 1160, 2},
+		{0x1E8C, 1162, 2},
+		{0x1E8D, 1164, 2},
+		{0x1E8E, 1166, 2},
+		{0x1E8F, 1168, 2},
+		{0x1E90, 1170, 2},
+		{0x1E91, 1172, 2},
+		{0x1E92, 1174, 2},
+		{0x1E93, 1176, 2},
+		{0x1E94, 1178, 2},
+		{0x1E95, 1180, 2},
+		{0x1E96, 1182, 2},
+		{0x1E97, 1184, 2},
+		{0x1E98, 1186, 2},
+		{0x1E99, 1188, 2},
+		{0x1E9B, 1190, 2},
+		{0x1EA0, 1192, 2},
+		{0x1EA1, 1194, 2},
+		{0x1EA2, 1196, 2},
+		{0x1EA3, 1198, 2},
+		{0x1EA4, 1200, 3},
+		{0x1EA5, 1203, 3},
+		{0x1EA6, 1206, 3},
+		{0x1EA7, 1209, 3},
+		{0x1EA8, 1212, 3},
+		{0x1EA9, 1215, 3},
+		{0x1EAA, 1218, 3},
+		{0x1EAB, 1221, 3},
+		{0x1EAC, 1224, 3},
+		{0x1EAD, 1227, 3},
+		{0x1EAE, 1230, 3},
+		{0x1EAF, 1233, 3},
+		{0x1EB0, 1236, 3},
+		{0x1EB1, 1239, 3},
+		{0x1EB2, 1242, 3},
+		{0x1EB3, 1245, 3},
+		{0x1EB4, 1248, 3},
+		{0x1EB5, 1251, 3},
+		{0x1EB6, 1254, 3},
+		{0x1EB7, 1257, 3},
+		{0x1EB8, 1260, 2},
+		{0x1EB9, 1262, 2},
+		{0x1EBA, 1264, 2},
+		{0x1EBB, 1266, 2},
+		{0x1EBC, 1268, 2},
+		{0x1EBD, 1270, 2},
+		{0x1EBE, 1272, 3},
+		{0x1EBF, 1275, 3},
+		{0x1EC0, 1278, 3},
+		{0x1EC1, 1281, 3},
+		{0x1EC2, 1284, 3},
+		{0x1EC3, 1287, 3},
+		{0x1EC4, 1290, 3},
+		{0x1EC5, 1293, 3},
+		{0x1EC6, 1296, 3},
+		{0x1EC7, 1299, 3},
+		{0x1EC8, 1302, 2},
+		{0x1EC9, 1304, 2},
+		{0x1ECA, 1306, 2},
+		{0x1ECB, 1308, 2},
+		{0x1ECC, 1310, 2},
+		{0x1ECD, 1312, 2},
+		{0x1ECE, 1314, 2},
+		{0x1ECF, 1316, 2},
+		{0x1ED0, 1318, 3},
+		{0x1ED1, 1321, 3},
+		{0x1ED2, 1324, 3},
+		{0x1ED3, 1327, 3},
+		{0x1ED4, 1330, 3},
+		{0x1ED5, 1333, 3},
+		{0x1ED6, 1336, 3},
+		{0x1ED7, 1339, 3},
+		{0x1ED8, 1342, 3},
+		{0x1ED9, 1345, 3},
+		{0x1EDA, 1348, 3},
+		{0x1EDB, 1351, 3},
+		{0x1EDC, 1354, 3},
+		{0x1EDD, 1357, 3},
+		{0x1EDE, 1360, 3},
+		{0x1EDF, 1363, 3},
+		{0x1EE0, 1366, 3},
+		{0x1EE1, 1369, 3},
+		{0x1EE2, 1372, 3},
+		{0x1EE3, 1375, 3},
+		{0x1EE4, 1378, 2},
+		{0x1EE5, 1380, 2},
+		{0x1EE6, 1382, 2},
+		{0x1EE7, 1384, 2},
+		{0x1EE8, 1386, 3},
+		{0x1EE9, 1389, 3},
+		{0x1EEA, 1392, 3},
+		{0x1EEB, 1395, 3},
+		{0x1EEC, 1398, 3},
+		{0x1EED, 1401, 3},
+		{0x1EEE, 1404, 3},
+		{0x1EEF, 1407, 3},
+		{0x1EF0, 1410, 3},
+		{0x1EF1, 1413, 3},
+		{0x1EF2, 1416, 2},
+		{0x1EF3, 1418, 2},
+		{0x1EF4, 1420, 2},
+		{0x1EF5, 1422, 2},
+		{0x1EF6, 1424, 2},
+		{0x1EF7, 1426, 2},
+		{0x1EF8, 1428, 2},
+		{0x1EF9, 1430, 2},
+		{0x1F00, 1432, 2},
+		{0x1F01, 1434, 2},
+		{0x1F02, 1436, 3},
+		{0x1F03, 1439, 3},
+		{0x1F04, 1442, 3},
+		{0x1F05, 1445, 3},
+		{0x1F06, 1448, 3},
+		{0x1F07, 1451, 3},
+		{0x1F08, 1454, 2},
+		{0x1F09, 1456, 2},
+		{0x1F0A, 1458, 3},
+		{0x1F0B, 1461, 3},
+		{0x1F0C, 1464, 3},
+		{0x1F0D, 1467, 3},
+		{0x1F0E, 1470, 3},
+		{0x1F0F, 1473, 3},
+		{0x1F10, 1476, 2},
+		{0x1F11, 1478, 2},
+		{0x1F12, 1480, 3},
+		{0x1F13, 1483, 3},
+		{0x1F14, 1486, 3},
+		{0x1F15, 1489, 3},
+		{0x1F18, 1492, 2},
+		{0x1F19, 1494, 2},
+		{0x1F1A, 1496, 3},
+		{0x1F1B, 1499, 3},
+		{0x1F1C, 1502, 3},
+		{0x1F1D, 1505, 3},
+		{0x1F20, 1508, 2},
+		{0x1F21, 1510, 2},
+		{0x1F22, 1512, 3},
+		{0x1F23, 1515, 3},
+		{0x1F24, 1518, 3},
+		{0x1F25, 1521, 3},
+		{0x1F26, 1524, 3},
+		{0x1F27, 1527, 3},
+		{0x1F28, 1530, 2},
+		{0x1F29, 1532, 2},
+		{0x1F2A, 1534, 3},
+		{0x1F2B, 1537, 3},
+		{0x1F2C, 1540, 3},
+		{0x1F2D, 1543, 3},
+		{0x1F2E, 1546, 3},
+		{0x1F2F, 1549, 3},
+		{0x1F30, 1552, 2},
+		{0x1F31, 1554, 2},
+		{0x1F32, 1556, 3},
+		{0x1F33, 1559, 3},
+		{0x1F34, 1562, 3},
+		{0x1F35, 1565, 3},
+		{0x1F36, 1568, 3},
+		{0x1F37, 1571, 3},
+		{0x1F38, 1574, 2},
+		{0x1F39, 1576, 2},
+		{0x1F3A, 1578, 3},
+		{0x1F3B, 1581, 3},
+		{0x1F3C, 1584, 3},
+		{0x1F3D, 1587, 3},
+		{0x1F3E, 1590, 3},
+		{0x1F3F, 1593, 3},
+		{0x1F40, 1596, 2},
+		{0x1F41, 1598, 2},
+		{0x1F42, 1600, 3},
+		{0x1F43, 1603, 3},
+		{0x1F44, 1606, 3},
+		{0x1F45, 1609, 3},
+		{0x1F48, 1612, 2},
+		{0x1F49, 1614, 2},
+		{0x1F4A, 1616, 3},
+		{0x1F4B, 1619, 3},
+		{0x1F4C, 1622, 3},
+		{0x1F4D, 1625, 3},
+		{0x1F50, 1628, 2},
+		{0x1F51, 1630, 2},
+		{0x1F52, 1632, 3},
+		{0x1F53, 1635, 3},
+		{0x1F54, 1638, 3},
+		{0x1F55, 1641, 3},
+		{0x1F56, 1644, 3},
+		{0x1F57, 1647, 3},
+		{0x1F59, 1650, 2},
+		{0x1F5B, 1652, 3},
+		{0x1F5D, 1655, 3},
+		{0x1F5F, 1658, 3},
+		{0x1F60, 1661, 2},
+		{0x1F61, 1663, 2},
+		{0x1F62, 1665, 3},
+		{0x1F63, 1668, 3},
+		{0x1F64, 1671, 3},
+		{0x1F65, 1674, 3},
+		{0x1F66, 1677, 3},
+		{0x1F67, 1680, 3},
+		{0x1F68, 1683, 2},
+		{0x1F69, 1685, 2},
+		{0x1F6A, 1687, 3},
+		{0x1F6B, 1690, 3},
+		{0x1F6C, 1693, 3},
+		{0x1F6D, 1696, 3},
+		{0x1F6E, 1699, 3},
+		{0x1F6F, 1702, 3},
+		{0x1F70, 1705, 2},
+		{0x1F71, 1707, 2},
+		{0x1F72, 1709, 2},
+		{0x1F73, 1711, 2},
+		{0x1F74, 1713, 2},
+		{0x1F75, 1715, 2},
+		{0x1F76, 1717, 2},
+		{0x1F77, 1719, 2},
+		{0x1F78, 1721, 2},
+		{0x1F79, 1723, 2},
+		{0x1F7A, 1725, 2},
+		{0x1F7B, 1727, 2},
+		{0x1F7C, 1729, 2},
+		{0x1F7D, 1731, 2},
+		{0x1F80, 1733, 3},
+		{0x1F81, 1736, 3},
+		{0x1F82, 1739, 4},
+		{0x1F83, 1743, 4},
+		{0x1F84, 1747, 4},
+		{0x1F85, 1751, 4},
+		{0x1F86, 1755, 4},
+		{0x1F87, 1759, 4},
+		{0x1F88, 1763, 3},
+		{0x1F89, 1766, 3},
+		{0x1F8A, 1769, 4},
+		{0x1F8B, 1773, 4},
+		{0x1F8C, 1777, 4},
+		{0x1F8D, 1781, 4},
+		{0x1F8E, 1785, 4},
+		{0x1F8F, 1789, 4},
+		{0x1F90, 1793, 3},
+		{0x1F91, 1796, 3},
+		{0x1F92, 1799, 4},
+		{0x1F93, 1803, 4},
+		{0x1F94, 1807, 4},
+		{0x1F95, 1811, 4},
+		{0x1F96, 1815, 4},
+		{0x1F97, 1819, 4},
+		{0x1F98, 1823, 3},
+		{0x1F99, 1826, 3},
+		{0x1F9A, 1829, 4},
+		{0x1F9B, 1833, 4},
+		{0x1F9C, 1837, 4},
+		{0x1F9D, 1841, 4},
+		{0x1F9E, 1845, 4},
+		{0x1F9F, 1849, 4},
+		{0x1FA0, 1853, 3},
+		{0x1FA1, 1856, 3},
+		{0x1FA2, 1859, 4},
+		{0x1FA3, 1863, 4},
+		{0x1FA4, 1867, 4},
+		{0x1FA5, 1871, 4},
+		{0x1FA6, 1875, 4},
+		{0x1FA7, 1879, 4},
+		{0x1FA8, 1883, 3},
+		{0x1FA9, 1886, 3},
+		{0x1FAA, 1889, 4},
+		{0x1FAB, 1893, 4},
+		{0x1FAC, 1897, 4},
+		{0x1FAD, 1901, 4},
+		{0x1FAE, 1905, 4},
+		{0x1FAF, 1909, 4},
+		{0x1FB0, 1913, 2},
+		{0x1FB1, 1915, 2},
+		{0x1FB2, 1917, 3},
+		{0x1FB3, 1920, 2},
+		{0x1FB4, 1922, 3},
+		{0x1FB6, 1925, 2},
+		{0x1FB7, 1927, 3},
+		{0x1FB8, 1930, 2},
+		{0x1FB9, 1932, 2},
+		{0x1FBA, 1934, 2},
+		{0x1FBB, 1936, 2},
+		{0x1FBC, 1938, 2},
+		{0x1FBE, 1940, 1},
+		{0x1FC1, 1941, 2},
+		{0x1FC2, 1943, 3},
+		{0x1FC3, 1946, 2},
+		{0x1FC4, 1948, 3},
+		{0x1FC6, 1951, 2},
+		{0x1FC7, 1953, 3},
+		{0x1FC8, 1956, 2},
+		{0x1FC9, 1958, 2},
+		{0x1FCA, 1960, 2},
+		{0x1FCB, 1962, 2},
+		{0x1FCC, 1964, 2},
+		{0x1FCD, 1966, 2},
+		{0x1FCE, 1968, 2},
+		{0x1FCF, 1970, 2},
+		{0x1FD0, 1972, 2},
+		{0x1FD1, 1974, 2},
+		{0x1FD2, 1976, 3},
+		{0x1FD3, 1979, 3},
+		{0x1FD6, 1982, 2},
+		{0x1FD7, 1984, 3},
+		{0x1FD8, 1987, 2},
+		{0x1FD9, 1989, 2},
+		{0x1FDA, 1991, 2},
+		{0x1FDB, 1993, 2},
+		{0x1FDD, 1995, 2},
+		{0x1FDE, 1997, 2},
+		{0x1FDF, 1999, 2},
+		{0x1FE0, 2001, 2},
+		{0x1FE1, 2003, 2},
+		{0x1FE2, 2005, 3},
+		{0x1FE3, 2008, 3},
+		{0x1FE4, 2011, 2},
+		{0x1FE5, 2013, 2},
+		{0x1FE6, 2015, 2},
+		{0x1FE7, 2017, 3},
+		{0x1FE8, 2020, 2},
+		{0x1FE9, 2022, 2},
+		{0x1FEA, 2024, 2},
+		{0x1FEB, 2026, 2},
+		{0x1FEC, 2028, 2},
+		{0x1FED, 2030, 2},
+		{0x1FEE, 2032, 2},
+		{0x1FEF, 2034, 1},
+		{0x1FF2, 2035, 3},
+		{0x1FF3, 2038, 2},
+		{0x1FF4, 2040, 3},
+		{0x1FF6, 2043, 2},
+		{0x1FF7, 2045, 3},
+		{0x1FF8, 2048, 2},
+		{0x1FF9, 2050, 2},
+		{0x1FFA, 2052, 2},
+		{0x1FFB, 2054, 2},
+		{0x1FFC, 2056, 2},
+		{0x1FFD, 2058, 1},
+		{0x2000, 2059, 1},
+		{0x2001, 2060, 1},
+		{0x2126, 2061, 1},
+		{0x212A, 2062, 1},
+		{0x212B, 2063, 2},
+		{0x219A, 2065, 2},
+		{0x219B, 2067, 2},
+		{0x21AE, 2069, 2},
+		{0x21CD, 2071, 2},
+		{0x21CE, 2073, 2},
+		{0x21CF, 2075, 2},
+		{0x2204, 2077, 2},
+		{0x2209, 2079, 2},
+		{0x220C, 2081, 2},
+		{0x2224, 2083, 2},
+		{0x2226, 2085, 2},
+		{0x2241, 2087, 2},
+		{0x2244, 2089, 2},
+		{0x2247, 2091, 2},
+		{0x2249, 2093, 2},
+		{0x2260, 2095, 2},
+		{0x2262, 2097, 2},
+		{0x226D, 2099, 2},
+		{0x226E, 2101, 2},
+		{0x226F, 2103, 2},
+		{0x2270, 2105, 2},
+		{0x2271, 2107, 2},
+		{0x2274, 2109, 2},
+		{0x2275, 2111, 2},
+		{0x2278, 2113, 2},
+		{0x2279, 2115, 2},
+		{0x2280, 2117, 2},
+		{0x2281, 2119, 2},
+		{0x2284, 2121, 2},
+		{0x2285, 2123, 2},
+		{0x2288, 2125, 2},
+		{0x2289, 2127, 2},
+		{0x22AC, 2129, 2},
+		{0x22AD, 2131, 2},
+		{0x22AE, 2133, 2},
+		{0x22AF, 2135, 2},
+		{0x22E0, 2137, 2},
+		{0x22E1, 2139, 2},
+		{0x22E2, 2141, 2},
+		{0x22E3, 2143, 2},
+		{0x22EA, 2145, 2},
+		{0x22EB, 2147, 2},
+		{0x22EC, 2149, 2},
+		{0x22ED, 2151, 2},
+		{0x2329, 2153, 1},
+		{0x232A, 2154, 1},
+		{0x2ADC, 2155, 2},
+		{0x304C, 2157, 2},
+		{0x304E, 2159, 2},
+		{0x3050, 2161, 2},
+		{0x3052, 2163, 2},
+		{0x3054, 2165, 2},
+		{0x3056, 2167, 2},
+		{0x3058, 2169, 2},
+		{0x305A, 2171, 2},
+		{0x305C, 2173, 2},
+		{0x305E, 2175, 2},
+		{0x3060, 2177, 2},
+		{0x3062, 2179, 2},
+		{0x3065, 2181, 2},
+		{0x3067, 2183, 2},
+		{0x3069, 2185, 2},
+		{0x3070, 2187, 2},
+		{0x3071, 2189, 2},
+		{0x3073, 2191, 2},
+		{0x3074, 2193, 2},
+		{0x3076, 2195, 2},
+		{0x3077, 2197, 2},
+		{0x3079, 2199, 2},
+		{0x307A, 2201, 2},
+		{0x307C, 2203, 2},
+		{0x307D, 2205, 2},
+		{0x3094, 2207, 2},
+		{0x309E, 2209, 2},
+		{0x30AC, 2211, 2},
+		{0x30AE, 2213, 2},
+		{0x30B0, 2215, 2},
+		{0x30B2, 2217, 2},
+		{0x30B4, 2219, 2},
+		{0x30B6, 2221, 2},
+		{0x30B8, 2223, 2},
+		{0x30BA, 2225, 2},
+		{0x30BC, 2227, 2},
+		{0x30BE, 2229, 2},
+		{0x30C0, 2231, 2},
+		{0x30C2, 2233, 2},
+		{0x30C5, 2235, 2},
+		{0x30C7, 2237, 2},
+		{0x30C9, 2239, 2},
+		{0x30D0, 2241, 2},
+		{0x30D1, 2243, 2},
+		{0x30D3, 2245, 2},
+		{0x30D4, 2247, 2},
+		{0x30D6, 2249, 2},
+		{0x30D7, 2251, 2},
+		{0x30D9, 2253, 2},
+		{0x30DA, 2255, 2},
+		{0x30DC, 2257, 2},
+		{0x30DD, 2259, 2},
+		{0x30F4, 2261, 2},
+		{0x30F7, 2263, 2},
+		{0x30F8, 2265, 2},
+		{0x30F9, 2267, 2},
+		{0x30FA, 2269, 2},
+		{0x30FE, 2271, 2},
+		{0xF900, 2273, 1},
+		{0xF901, 2274, 1},
+		{0xF902, 2275, 1},
+		{0xF903, 2276, 1},
+		{0xF904, 2277, 1},
+		{0xF905, 2278, 1},
+		{0xF906, 2279, 1},
+		{0xF907, 2280, 1},
+		{0xF908, 2281, 1},
+		{0xF909, 2282, 1},
+		{0xF90A, 2283, 1},
+		{0xF90B, 2284, 1},
+		{0xF90C, 2285, 1},
+		{0xF90D, 2286, 1},
+		{0xF90E, 2287, 1},
+		{0xF90F, 2288, 1},
+		{0xF910, 2289, 1},
+		{0xF911, 2290, 1},
+		{0xF912, 2291, 1},
+		{0xF913, 2292, 1},
+		{0xF914, 2293, 1},
+		{0xF915, 2294, 1},
+		{0xF916, 2295, 1},
+		{0xF917, 2296, 1},
+		{0xF918, 2297, 1},
+		{0xF919, 2298, 1},
+		{0xF91A, 2299, 1},
+		{0xF91B, 2300, 1},
+		{0xF91C, 2301, 1},
+		{0xF91D, 2302, 1},
+		{0xF91E, 2303, 1},
+		{0xF91F, 2304, 1},
+		{0xF920, 2305, 1},
+		{0xF921, 2306, 1},
+		{0xF922, 2307, 1},
+		{0xF923, 2308, 1},
+		{0xF924, 2309, 1},
+		{0xF925, 2310, 1},
+		{0xF926, 2311, 1},
+		{0xF927, 2312, 1},
+		{0xF928, 2313, 1},
+		{0xF929, 2314, 1},
+		{0xF92A, 2315, 1},
+		{0xF92B, 2316, 1},
+		{0xF92C, 2317, 1},
+		{0xF92D, 2318, 1},
+		{0xF92E, 2319, 1},
+		{0xF92F, 2320, 1},
+		{0xF930, 2321, 1},
+		{0xF931, 2322, 1},
+		{0xF932, 2323, 1},
+		{0xF933, 2324, 1},
+		{0xF934, 2325, 1},
+		{0xF935, 2326, 1},
+		{0xF936, 2327, 1},
+		{0xF937, 2328, 1},
+		{0xF938, 2329, 1},
+		{0xF939, 2330, 1},
+		{0xF93A, 2331, 1},
+		{0xF93B, 2332, 1},
+		{0xF93C, 2333, 1},
+		{0xF93D, 2334, 1},
+		{0xF93E, 2335, 1},
+		{0xF93F, 2336, 1},
+		{0xF940, 2337, 1},
+		{0xF941, 2338, 1},
+		{0xF942, 2339, 1},
+		{0xF943, 2340, 1},
+		{0xF944, 2341, 1},
+		{0xF945, 2342, 1},
+		{0xF946, 2343, 1},
+		{0xF947, 2344, 1},
+		{0xF948, 2345, 1},
+		{0xF949, 2346, 1},
+		{0xF94A, 2347, 1},
+		{0xF94B, 2348, 1},
+		{0xF94C, 2349, 1},
+		{0xF94D, 2350, 1},
+		{0xF94E, 2351, 1},
+		{0xF94F, 2352, 1},
+		{0xF950, 2353, 1},
+		{0xF951, 2354, 1},
+		{0xF952, 2355, 1},
+		{0xF953, 2356, 1},
+		{0xF954, 2357, 1},
+		{0xF955, 2358, 1},
+		{0xF956, 2359, 1},
+		{0xF957, 2360, 1},
+		{0xF958, 2361, 1},
+		{0xF959, 2362, 1},
+		{0xF95A, 2363, 1},
+		{0xF95B, 2364, 1},
+		{0xF95C, 2365, 1},
+		{0xF95D, 2366, 1},
+		{0xF95E, 2367, 1},
+		{0xF95F, 2368, 1},
+		{0xF960, 2369, 1},
+		{0xF961, 2370, 1},
+		{0xF962, 2371, 1},
+		{0xF963, 2372, 1},
+		{0xF964, 2373, 1},
+		{0xF965, 2374, 1},
+		{0xF966, 2375, 1},
+		{0xF967, 2376, 1},
+		{0xF968, 2377, 1},
+		{0xF969, 2378, 1},
+		{0xF96A, 2379, 1},
+		{0xF96B, 2380, 1},
+		{0xF96C, 2381, 1},
+		{0xF96D, 2382, 1},
+		{0xF96E, 2383, 1},
+		{0xF96F, 2384, 1},
+		{0xF970, 2385, 1},
+		{0xF971, 2386, 1},
+		{0xF972, 2387, 1},
+		{0xF973, 2388, 1},
+		{0xF974, 2389, 1},
+		{0xF975, 2390, 1},
+		{0xF976, 2391, 1},
+		{0xF977, 2392, 1},
+		{0xF978, 2393, 1},
+		{0xF979, 2394, 1},
+		{0xF97A, 2395, 1},
+		{0xF97B, 2396, 1},
+		{0xF97C, 2397, 1},
+		{0xF97D, 2398, 1},
+		{0xF97E, 2399, 1},
+		{0xF97F, 2400, 1},
+		{0xF980, 2401, 1},
+		{0xF981, 2402, 1},
+		{0xF982, 2403, 1},
+		{0xF983, 2404, 1},
+		{0xF984, 2405, 1},
+		{0xF985, 2406, 1},
+		{0xF986, 2407, 1},
+		{0xF987, 2408, 1},
+		{0xF988, 2409, 1},
+		{0xF989, 2410, 1},
+		{0xF98A, 2411, 1},
+		{0xF98B, 2412, 1},
+		{0xF98C, 2413, 1},
+		{0xF98D, 2414, 1},
+		{0xF98E, 2415, 1},
+		{0xF98F, 2416, 1},
+		{0xF990, 2417, 1},
+		{0xF991, 2418, 1},
+		{0xF992, 2419, 1},
+		{0xF993, 2420, 1},
+		{0xF994, 2421, 1},
+		{0xF995, 2422, 1},
+		{0xF996, 2423, 1},
+		{0xF997, 2424, 1},
+		{0xF998, 2425, 1},
+		{0xF999, 2426, 1},
+		{0xF99A, 2427, 1},
+		{0xF99B, 2428, 1},
+		{0xF99C, 2429, 1},
+		{0xF99D, 2430, 1},
+		{0xF99E, 2431, 1},
+		{0xF99F, 2432, 1},
+		{0xF9A0, 2433, 1},
+		{0xF9A1, 2434, 1},
+		{0xF9A2, 2435, 1},
+		{0xF9A3, 2436, 1},
+		{0xF9A4, 2437, 1},
+		{0xF9A5, 2438, 1},
+		{0xF9A6, 2439, 1},
+		{0xF9A7, 2440, 1},
+		{0xF9A8, 2441, 1},
+		{0xF9A9, 2442, 1},
+		{0xF9AA, 2443, 1},
+		{0xF9AB, 2444, 1},
+		{0xF9AC, 2445, 1},
+		{0xF9AD, 2446, 1},
+		{0xF9AE, 2447, 1},
+		{0xF9AF, 2448, 1},
+		{0xF9B0, 2449, 1},
+		{0xF9B1, 2450, 1},
+		{0xF9B2, 2451, 1},
+		{0xF9B3, 2452, 1},
+		{0xF9B4, 2453, 1},
+		{0xF9B5, 2454, 1},
+		{0xF9B6, 2455, 1},
+		{0xF9B7, 2456, 1},
+		{0xF9B8, 2457, 1},
+		{0xF9B9, 2458, 1},
+		{0xF9BA, 2459, 1},
+		{0xF9BB, 2460, 1},
+		{0xF9BC, 2461, 1},
+		{0xF9BD, 2462, 1},
+		{0xF9BE, 2463, 1},
+		{0xF9BF, 2464, 1},
+		{0xF9C0, 2465, 1},
+		{0xF9C1, 2466, 1},
+		{0xF9C2, 2467, 1},
+		{0xF9C3, 2468, 1},
+		{0xF9C4, 2469, 1},
+		{0xF9C5, 2470, 1},
+		{0xF9C6, 2471, 1},
+		{0xF9C7, 2472, 1},
+		{0xF9C8, 2473, 1},
+		{0xF9C9, 2474, 1},
+		{0xF9CA, 2475, 1},
+		{0xF9CB, 2476, 1},
+		{0xF9CC, 2477, 1},
+		{0xF9CD, 2478, 1},
+		{0xF9CE, 2479, 1},
+		{0xF9CF, 2480, 1},
+		{0xF9D0, 2481, 1},
+		{0xF9D1, 2482, 1},
+		{0xF9D2, 2483, 1},
+		{0xF9D3, 2484, 1},
+		{0xF9D4, 2485, 1},
+		{0xF9D5, 2486, 1},
+		{0xF9D6, 2487, 1},
+		{0xF9D7, 2488, 1},
+		{0xF9D8, 2489, 1},
+		{0xF9D9, 2490, 1},
+		{0xF9DA, 2491, 1},
+		{0xF9DB, 2492, 1},
+		{0xF9DC, 2493, 1},
+		{0xF9DD, 2494, 1},
+		{0xF9DE, 2495, 1},
+		{0xF9DF, 2496, 1},
+		{0xF9E0, 2497, 1},
+		{0xF9E1, 2498, 1},
+		{0xF9E2, 2499, 1},
+		{0xF9E3, 2500, 1},
+		{0xF9E4, 2501, 1},
+		{0xF9E5, 2502, 1},
+		{0xF9E6, 2503, 1},
+		{0xF9E7, 2504, 1},
+		{0xF9E8, 2505, 1},
+		{0xF9E9, 2506, 1},
+		{0xF9EA, 2507, 1},
+		{0xF9EB, 2508, 1},
+		{0xF9EC, 2509, 1},
+		{0xF9ED, 2510, 1},
+		{0xF9EE, 2511, 1},
+		{0xF9EF, 2512, 1},
+		{0xF9F0, 2513, 1},
+		{0xF9F1, 2514, 1},
+		{0xF9F2, 2515, 1},
+		{0xF9F3, 2516, 1},
+		{0xF9F4, 2517, 1},
+		{0xF9F5, 2518, 1},
+		{0xF9F6, 2519, 1},
+		{0xF9F7, 2520, 1},
+		{0xF9F8, 2521, 1},
+		{0xF9F9, 2522, 1},
+		{0xF9FA, 2523, 1},
+		{0xF9FB, 2524, 1},
+		{0xF9FC, 2525, 1},
+		{0xF9FD, 2526, 1},
+		{0xF9FE, 2527, 1},
+		{0xF9FF, 2528, 1},
+		{0xFA00, 2529, 1},
+		{0xFA01, 2530, 1},
+		{0xFA02, 2531, 1},
+		{0xFA03, 2532, 1},
+		{0xFA04, 2533, 1},
+		{0xFA05, 2534, 1},
+		{0xFA06, 2535, 1},
+		{0xFA07, 2536, 1},
+		{0xFA08, 2537, 1},
+		{0xFA09, 2538, 1},
+		{0xFA0A, 2539, 1},
+		{0xFA0B, 2540, 1},
+		{0xFA0C, 2541, 1},
+		{0xFA0D, 2542, 1},
+		{0xFA10, 2543, 1},
+		{0xFA12, 2544, 1},
+		{0xFA15, 2545, 1},
+		{0xFA16, 2546, 1},
+		{0xFA17, 2547, 1},
+		{0xFA18, 2548, 1},
+		{0xFA19, 2549, 1},
+		{0xFA1A, 2550, 1},
+		{0xFA1B, 2551, 1},
+		{0xFA1C, 2552, 1},
+		{0xFA1D, 2553, 1},
+		{0xFA1E, 2554, 1},
+		{0xFA20, 2555, 1},
+		{0xFA22, 2556, 1},
+		{0xFA25, 2557, 1},
+		{0xFA26, 2558, 1},
+		{0xFA2A, 2559, 1},
+		{0xFA2B, 2560, 1},
+		{0xFA2C, 2561, 1},
+		{0xFA2D, 2562, 1},
+		{0xFA2E, 2563, 1},
+		{0xFA2F, 2564, 1},
+		{0xFA30, 2565, 1},
+		{0xFA31, 2566, 1},
+		{0xFA32, 2567, 1},
+		{0xFA33, 2568, 1},
+		{0xFA34, 2569, 1},
+		{0xFA35, 2570, 1},
+		{0xFA36, 2571, 1},
+		{0xFA37, 2572, 1},
+		{0xFA38, 2573, 1},
+		{0xFA39, 2574, 1},
+		{0xFA3A, 2575, 1},
+		{0xFA3B, 2576, 1},
+		{0xFA3C, 2577, 1},
+		{0xFA3D, 2578, 1},
+		{0xFA3E, 2579, 1},
+		{0xFA3F, 2580, 1},
+		{0xFA40, 2581, 1},
+		{0xFA41, 2582, 1},
+		{0xFA42, 2583, 1},
+		{0xFA43, 2584, 1},
+		{0xFA44, 2585, 1},
+		{0xFA45, 2586, 1},
+		{0xFA46, 2587, 1},
+		{0xFA47, 2588, 1},
+		{0xFA48, 2589, 1},
+		{0xFA49, 2590, 1},
+		{0xFA4A, 2591, 1},
+		{0xFA4B, 2592, 1},
+		{0xFA4C, 2593, 1},
+		{0xFA4D, 2594, 1},
+		{0xFA4E, 2595, 1},
+		{0xFA4F, 2596, 1},
+		{0xFA50, 2597, 1},
+		{0xFA51, 2598, 1},
+		{0xFA52, 2599, 1},
+		{0xFA53, 2600, 1},
+		{0xFA54, 2601, 1},
+		{0xFA55, 2602, 1},
+		{0xFA56, 2603, 1},
+		{0xFA57, 2604, 1},
+		{0xFA58, 2605, 1},
+		{0xFA59, 2606, 1},
+		{0xFA5A, 2607, 1},
+		{0xFA5B, 2608, 1},
+		{0xFA5C, 2609, 1},
+		{0xFA5D, 2610, 1},
+		{0xFA5E, 2611, 1},
+		{0xFA5F, 2612, 1},
+		{0xFA60, 2613, 1},
+		{0xFA61, 2614, 1},
+		{0xFA62, 2615, 1},
+		{0xFA63, 2616, 1},
+		{0xFA64, 2617, 1},
+		{0xFA65, 2618, 1},
+		{0xFA66, 2619, 1},
+		{0xFA67, 2620, 1},
+		{0xFA68, 2621, 1},
+		{0xFA69, 2622, 1},
+		{0xFA6A, 2623, 1},
+		{0xFA6B, 2624, 1},
+		{0xFA6C, 2625, 1},
+		{0xFA6D, 2626, 1},
+		{0xFA70, 2627, 1},
+		{0xFA71, 2628, 1},
+		{0xFA72, 2629, 1},
+		{0xFA73, 2630, 1},
+		{0xFA74, 2631, 1},
+		{0xFA75, 2632, 1},
+		{0xFA76, 2633, 1},
+		{0xFA77, 2634, 1},
+		{0xFA78, 2635, 1},
+		{0xFA79, 2636, 1},
+		{0xFA7A, 2637, 1},
+		{0xFA7B, 2638, 1},
+		{0xFA7C, 2639, 1},
+		{0xFA7D, 2640, 1},
+		{0xFA7E, 2641, 1},
+		{0xFA7F, 2642, 1},
+		{0xFA80, 2643, 1},
+		{0xFA81, 2644, 1},
+		{0xFA82, 2645, 1},
+		{0xFA83, 2646, 1},
+		{0xFA84, 2647, 1},
+		{0xFA85, 2648, 1},
+		{0xFA86, 2649, 1},
+		{0xFA87, 2650, 1},
+		{0xFA88, 2651, 1},
+		{0xFA89, 2652, 1},
+		{0xFA8A, 2653, 1},
+		{0xFA8B, 2654, 1},
+		{0xFA8C, 2655, 1},
+		{0xFA8D, 2656, 1},
+		{0xFA8E, 2657, 1},
+		{0xFA8F, 2658, 1},
+		{0xFA90, 2659, 1},
+		{0xFA91, 2660, 1},
+		{0xFA92, 2661, 1},
+		{0xFA93, 2662, 1},
+		{0xFA94, 2663, 1},
+		{0xFA95, 2664, 1},
+		{0xFA96, 2665, 1},
+		{0xFA97, 2666, 1},
+		{0xFA98, 2667, 1},
+		{0xFA99, 2668, 1},
+		{0xFA9A, 2669, 1},
+		{0xFA9B, 2670, 1},
+		{0xFA9C, 2671, 1},
+		{0xFA9D, 2672, 1},
+		{0xFA9E, 2673, 1},
+		{0xFA9F, 2674, 1},
+		{0xFAA0, 2675, 1},
+		{0xFAA1, 2676, 1},
+		{0xFAA2, 2677, 1},
+		{0xFAA3, 2678, 1},
+		{0xFAA4, 2679, 1},
+		{0xFAA5, 2680, 1},
+		{0xFAA6, 2681, 1},
+		{0xFAA7, 2682, 1},
+		{0xFAA8, 2683, 1},
+		{0xFAA9, 2684, 1},
+		{0xFAAA, 2685, 1},
+		{0xFAAB, 2686, 1},
+		{0xFAAC, 2687, 1},
+		{0xFAAD, 2688, 1},
+		{0xFAAE, 2689, 1},
+		{0xFAAF, 2690, 1},
+		{0xFAB0, 2691, 1},
+		{0xFAB1, 2692, 1},
+		{0xFAB2, 2693, 1},
+		{0xFAB3, 2694, 1},
+		{0xFAB4, 2695, 1},
+		{0xFAB5, 2696, 1},
+		{0xFAB6, 2697, 1},
+		{0xFAB7, 2698, 1},
+		{0xFAB8, 2699, 1},
+		{0xFAB9, 2700, 1},
+		{0xFABA, 2701, 1},
+		{0xFABB, 2702, 1},
+		{0xFABC, 2703, 1},
+		{0xFABD, 2704, 1},
+		{0xFABE, 2705, 1},
+		{0xFABF, 2706, 1},
+		{0xFAC0, 2707, 1},
+		{0xFAC1, 2708, 1},
+		{0xFAC2, 2709, 1},
+		{0xFAC3, 2710, 1},
+		{0xFAC4, 2711, 1},
+		{0xFAC5, 2712, 1},
+		{0xFAC6, 2713, 1},
+		{0xFAC7, 2714, 1},
+		{0xFAC8, 2715, 1},
+		{0xFAC9, 2716, 1},
+		{0xFACA, 2717, 1},
+		{0xFACB, 2718, 1},
+		{0xFACC, 2719, 1},
+		{0xFACD, 2720, 1},
+		{0xFACE, 2721, 1},
+		{0xFACF, 2722, 1},
+		{0xFAD0, 2723, 1},
+		{0xFAD1, 2724, 1},
+		{0xFAD2, 2725, 1},
+		{0xFAD3, 2726, 1},
+		{0xFAD4, 2727, 1},
+		{0xFAD5, 2728, 1},
+		{0xFAD6, 2729, 1},
+		{0xFAD7, 2730, 1},
+		{0xFAD8, 2731, 1},
+		{0xFAD9, 2732, 1},
+		{0xFB1D, 2733, 2},
+		{0xFB1F, 2735, 2},
+		{0xFB2A, 2737, 2},
+		{0xFB2B, 2739, 2},
+		{0xFB2C, 2741, 3},
+		{0xFB2D, 2744, 3},
+		{0xFB2E, 2747, 2},
+		{0xFB2F, 2749, 2},
+		{0xFB30, 2751, 2},
+		{0xFB31, 2753, 2},
+		{0xFB32, 2755, 2},
+		{0xFB33, 2757, 2},
+		{0xFB34, 2759, 2},
+		{0xFB35, 2761, 2},
+		{0xFB36, 2763, 2},
+		{0xFB38, 2765, 2},
+		{0xFB39, 2767, 2},
+		{0xFB3A, 2769, 2},
+		{0xFB3B, 2771, 2},
+		{0xFB3C, 2773, 2},
+		{0xFB3E, 2775, 2},
+		{0xFB40, 2777, 2},
+		{0xFB41, 2779, 2},
+		{0xFB43, 2781, 2},
+		{0xFB44, 2783, 2},
+		{0xFB46, 2785, 2},
+		{0xFB47, 2787, 2},
+		{0xFB48, 2789, 2},
+		{0xFB49, 2791, 2},
+		{0xFB4A, 2793, 2},
+		{0xFB4B, 2795, 2},
+		{0xFB4C, 2797, 2},
+		{0xFB4D, 2799, 2},
+		{0xFB4E, 2801, 2},
+		{0x1109A, 2803, 2},
+		{0x1109C, 2805, 2},
+		{0x110AB, 2807, 2},
+		{0x1112E, 2809, 2},
+		{0x1112F, 2811, 2},
+		{0x1134B, 2813, 2},
+		{0x1134C, 2815, 2},
+		{0x114BB, 2817, 2},
+		{0x114BC, 2819, 2},
+		{0x114BE, 2821, 2},
+		{0x115BA, 2823, 2},
+		{0x115BB, 2825, 2},
+		{0x11938, 2827, 2},
+		{0x1D15E, 2829, 2},
+		{0x1D15F, 2831, 2},
+		{0x1D160, 2833, 3},
+		{0x1D161, 2836, 3},
+		{0x1D162, 2839, 3},
+		{0x1D163, 2842, 3},
+		{0x1D164, 2845, 3},
+		{0x1D1BB, 2848, 2},
+		{0x1D1BC, 2850, 2},
+		{0x1D1BD, 2852, 3},
+		{0x1D1BE, 2855, 3},
+		{0x1D1BF, 2858, 3},
+		{0x1D1C0, 2861, 3},
+		{0x2F800, 2864, 1},
+		{0x2F801, 2865, 1},
+		{0x2F802, 2866, 1},
+		{0x2F803, 2867, 1},
+		{0x2F804, 2868, 1},
+		{0x2F805, 2869, 1},
+		{0x2F806, 2870, 1},
+		{0x2F807, 2871, 1},
+		{0x2F808, 2872, 1},
+		{0x2F809, 2873, 1},
+		{0x2F80A, 2874, 1},
+		{0x2F80B, 2875, 1},
+		{0x2F80C, 2876, 1},
+		{0x2F80D, 2877, 1},
+		{0x2F80E, 2878, 1},
+		{0x2F80F, 2879, 1},
+		{0x2F810, 2880, 1},
+		{0x2F811, 2881, 1},
+		{0x2F812, 2882, 1},
+		{0x2F813, 2883, 1},
+		{0x2F814, 2884, 1},
+		{0x2F815, 2885, 1},
+		{0x2F816, 2886, 1},
+		{0x2F817, 2887, 1},
+		{0x2F818, 2888, 1},
+		{0x2F819, 2889, 1},
+		{0x2F81A, 2890, 1},
+		{0x2F81B, 2891, 1},
+		{0x2F81C, 2892, 1},
+		{0x2F81D, 2893, 1},
+		{0x2F81E, 2894, 1},
+		{0x2F81F, 2895, 1},
+		{0x2F820, 2896, 1},
+		{0x2F821, 2897, 1},
+		{0x2F822, 2898, 1},
+		{0x2F823, 2899, 1},
+		{0x2F824, 2900, 1},
+		{0x2F825, 2901, 1},
+		{0x2F826, 2902, 1},
+		{0x2F827, 2903, 1},
+		{0x2F828, 2904, 1},
+		{0x2F829, 2905, 1},
+		{0x2F82A, 2906, 1},
+		{0x2F82B, 2907, 1},
+		{0x2F82C, 2908, 1},
+		{0x2F82D, 2909, 1},
+		{0x2F82E, 2910, 1},
+		{0x2F82F, 2911, 1},
+		{0x2F830, 2912, 1},
+		{0x2F831, 2913, 1},
+		{0x2F832, 2914, 1},
+		{0x2F833, 2915, 1},
+		{0x2F834, 2916, 1},
+		{0x2F835, 2917, 1},
+		{0x2F836, 2918, 1},
+		{0x2F837, 2919, 1},
+		{0x2F838, 2920, 1},
+		{0x2F839, 2921, 1},
+		{0x2F83A, 2922, 1},
+		{0x2F83B, 2923, 1},
+		{0x2F83C, 2924, 1},
+		{0x2F83D, 2925, 1},
+		{0x2F83E, 2926, 1},
+		{0x2F83F, 2927, 1},
+		{0x2F840, 2928, 1},
+		{0x2F841, 2929, 1},
+		{0x2F842, 2930, 1},
+		{0x2F843, 2931, 1},
+		{0x2F844, 2932, 1},
+		{0x2F845, 2933, 1},
+		{0x2F846, 2934, 1},
+		{0x2F847, 2935, 1},
+		{0x2F848, 2936, 1},
+		{0x2F849, 2937, 1},
+		{0x2F84A, 2938, 1},
+		{0x2F84B, 2939, 1},
+		{0x2F84C, 2940, 1},
+		{0x2F84D, 2941, 1},
+		{0x2F84E, 2942, 1},
+		{0x2F84F, 2943, 1},
+		{0x2F850, 2944, 1},
+		{0x2F851, 2945, 1},
+		{0x2F852, 2946, 1},
+		{0x2F853, 2947, 1},
+		{0x2F854, 2948, 1},
+		{0x2F855, 2949, 1},
+		{0x2F856, 2950, 1},
+		{0x2F857, 2951, 1},
+		{0x2F858, 2952, 1},
+		{0x2F859, 2953, 1},
+		{0x2F85A, 2954, 1},
+		{0x2F85B, 2955, 1},
+		{0x2F85C, 2956, 1},
+		{0x2F85D, 2957, 1},
+		{0x2F85E, 2958, 1},
+		{0x2F85F, 2959, 1},
+		{0x2F860, 2960, 1},
+		{0x2F861, 2961, 1},
+		{0x2F862, 2962, 1},
+		{0x2F863, 2963, 1},
+		{0x2F864, 2964, 1},
+		{0x2F865, 2965, 1},
+		{0x2F866, 2966, 1},
+		{0x2F867, 2967, 1},
+		{0x2F868, 2968, 1},
+		{0x2F869, 2969, 1},
+		{0x2F86A, 2970, 1},
+		{0x2F86B, 2971, 1},
+		{0x2F86C, 2972, 1},
+		{0x2F86D, 2973, 1},
+		{0x2F86E, 2974, 1},
+		{0x2F86F, 2975, 1},
+		{0x2F870, 2976, 1},
+		{0x2F871, 2977, 1},
+		{0x2F872, 2978, 1},
+		{0x2F873, 2979, 1},
+		{0x2F874, 2980, 1},
+		{0x2F875, 2981, 1},
+		{0x2F876, 2982, 1},
+		{0x2F877, 2983, 1},
+		{0x2F878, 2984, 1},
+		{0x2F879, 2985, 1},
+		{0x2F87A, 2986, 1},
+		{0x2F87B, 2987, 1},
+		{0x2F87C, 2988, 1},
+		{0x2F87D, 2989, 1},
+		{0x2F87E, 2990, 1},
+		{0x2F87F, 2991, 1},
+		{0x2F880, 2992, 1},
+		{0x2F881, 2993, 1},
+		{0x2F882, 2994, 1},
+		{0x2F883, 2995, 1},
+		{0x2F884, 2996, 1},
+		{0x2F885, 2997, 1},
+		{0x2F886, 2998, 1},
+		{0x2F887, 2999, 1},
+		{0x2F888, 3000, 1},
+		{0x2F889, 3001, 1},
+		{0x2F88A, 3002, 1},
+		{0x2F88B, 3003, 1},
+		{0x2F88C, 3004, 1},
+		{0x2F88D, 3005, 1},
+		{0x2F88E, 3006, 1},
+		{0x2F88F, 3007, 1},
+		{0x2F890, 3008, 1},
+		{0x2F891, 3009, 1},
+		{0x2F892, 3010, 1},
+		{0x2F893, 3011, 1},
+		{0x2F894, 3012, 1},
+		{0x2F895, 3013, 1},
+		{0x2F896, 3014, 1},
+		{0x2F897, 3015, 1},
+		{0x2F898, 3016, 1},
+		{0x2F899, 3017, 1},
+		{0x2F89A, 3018, 1},
+		{0x2F89B, 3019, 1},
+		{0x2F89C, 3020, 1},
+		{0x2F89D, 3021, 1},
+		{0x2F89E, 3022, 1},
+		{0x2F89F, 3023, 1},
+		{0x2F8A0, 3024, 1},
+		{0x2F8A1, 3025, 1},
+		{0x2F8A2, 3026, 1},
+		{0x2F8A3, 3027, 1},
+		{0x2F8A4, 3028, 1},
+		{0x2F8A5, 3029, 1},
+		{0x2F8A6, 3030, 1},
+		{0x2F8A7, 3031, 1},
+		{0x2F8A8, 3032, 1},
+		{0x2F8A9, 3033, 1},
+		{0x2F8AA, 3034, 1},
+		{0x2F8AB, 3035, 1},
+		{0x2F8AC, 3036, 1},
+		{0x2F8AD, 3037, 1},
+		{0x2F8AE, 3038, 1},
+		{0x2F8AF, 3039, 1},
+		{0x2F8B0, 3040, 1},
+		{0x2F8B1, 3041, 1},
+		{0x2F8B2, 3042, 1},
+		{0x2F8B3, 3043, 1},
+		{0x2F8B4, 3044, 1},
+		{0x2F8B5, 3045, 1},
+		{0x2F8B6, 3046, 1},
+		{0x2F8B7, 3047, 1},
+		{0x2F8B8, 3048, 1},
+		{0x2F8B9, 3049, 1},
+		{0x2F8BA, 3050, 1},
+		{0x2F8BB, 3051, 1},
+		{0x2F8BC, 3052, 1},
+		{0x2F8BD, 3053, 1},
+		{0x2F8BE, 3054, 1},
+		{0x2F8BF, 3055, 1},
+		{0x2F8C0, 3056, 1},
+		{0x2F8C1, 3057, 1},
+		{0x2F8C2, 3058, 1},
+		{0x2F8C3, 3059, 1},
+		{0x2F8C4, 3060, 1},
+		{0x2F8C5, 3061, 1},
+		{0x2F8C6, 3062, 1},
+		{0x2F8C7, 3063, 1},
+		{0x2F8C8, 3064, 1},
+		{0x2F8C9, 3065, 1},
+		{0x2F8CA, 3066, 1},
+		{0x2F8CB, 3067, 1},
+		{0x2F8CC, 3068, 1},
+		{0x2F8CD, 3069, 1},
+		{0x2F8CE, 3070, 1},
+		{0x2F8CF, 3071, 1},
+		{0x2F8D0, 3072, 1},
+		{0x2F8D1, 3073, 1},
+		{0x2F8D2, 3074, 1},
+		{0x2F8D3, 3075, 1},
+		{0x2F8D4, 3076, 1},
+		{0x2F8D5, 3077, 1},
+		{0x2F8D6, 3078, 1},
+		{0x2F8D7, 3079, 1},
+		{0x2F8D8, 3080, 1},
+		{0x2F8D9, 3081, 1},
+		{0x2F8DA, 3082, 1},
+		{0x2F8DB, 3083, 1},
+		{0x2F8DC, 3084, 1},
+		{0x2F8DD, 3085, 1},
+		{0x2F8DE, 3086, 1},
+		{0x2F8DF, 3087, 1},
+		{0x2F8E0, 3088, 1},
+		{0x2F8E1, 3089, 1},
+		{0x2F8E2, 3090, 1},
+		{0x2F8E3, 3091, 1},
+		{0x2F8E4, 3092, 1},
+		{0x2F8E5, 3093, 1},
+		{0x2F8E6, 3094, 1},
+		{0x2F8E7, 3095, 1},
+		{0x2F8E8, 3096, 1},
+		{0x2F8E9, 3097, 1},
+		{0x2F8EA, 3098, 1},
+		{0x2F8EB, 3099, 1},
+		{0x2F8EC, 3100, 1},
+		{0x2F8ED, 3101, 1},
+		{0x2F8EE, 3102, 1},
+		{0x2F8EF, 3103, 1},
+		{0x2F8F0, 3104, 1},
+		{0x2F8F1, 3105, 1},
+		{0x2F8F2, 3106, 1},
+		{0x2F8F3, 3107, 1},
+		{0x2F8F4, 3108, 1},
+		{0x2F8F5, 3109, 1},
+		{0x2F8F6, 3110, 1},
+		{0x2F8F7, 3111, 1},
+		{0x2F8F8, 3112, 1},
+		{0x2F8F9, 3113, 1},
+		{0x2F8FA, 3114, 1},
+		{0x2F8FB, 3115, 1},
+		{0x2F8FC, 3116, 1},
+		{0x2F8FD, 3117, 1},
+		{0x2F8FE, 3118, 1},
+		{0x2F8FF, 3119, 1},
+		{0x2F900, 3120, 1},
+		{0x2F901, 3121, 1},
+		{0x2F902, 3122, 1},
+		{0x2F903, 3123, 1},
+		{0x2F904, 3124, 1},
+		{0x2F905, 3125, 1},
+		{0x2F906, 3126, 1},
+		{0x2F907, 3127, 1},
+		{0x2F908, 3128, 1},
+		{0x2F909, 3129, 1},
+		{0x2F90A, 3130, 1},
+		{0x2F90B, 3131, 1},
+		{0x2F90C, 3132, 1},
+		{0x2F90D, 3133, 1},
+		{0x2F90E, 3134, 1},
+		{0x2F90F, 3135, 1},
+		{0x2F910, 3136, 1},
+		{0x2F911, 3137, 1},
+		{0x2F912, 3138, 1},
+		{0x2F913, 3139, 1},
+		{0x2F914, 3140, 1},
+		{0x2F915, 3141, 1},
+		{0x2F916, 3142, 1},
+		{0x2F917, 3143, 1},
+		{0x2F918, 3144, 1},
+		{0x2F919, 3145, 1},
+		{0x2F91A, 3146, 1},
+		{0x2F91B, 3147, 1},
+		{0x2F91C, 3148, 1},
+		{0x2F91D, 3149, 1},
+		{0x2F91E, 3150, 1},
+		{0x2F91F, 3151, 1},
+		{0x2F920, 3152, 1},
+		{0x2F921, 3153, 1},
+		{0x2F922, 3154, 1},
+		{0x2F923, 3155, 1},
+		{0x2F924, 3156, 1},
+		{0x2F925, 3157, 1},
+		{0x2F926, 3158, 1},
+		{0x2F927, 3159, 1},
+		{0x2F928, 3160, 1},
+		{0x2F929, 3161, 1},
+		{0x2F92A, 3162, 1},
+		{0x2F92B, 3163, 1},
+		{0x2F92C, 3164, 1},
+		{0x2F92D, 3165, 1},
+		{0x2F92E, 3166, 1},
+		{0x2F92F, 3167, 1},
+		{0x2F930, 3168, 1},
+		{0x2F931, 3169, 1},
+		{0x2F932, 3170, 1},
+		{0x2F933, 3171, 1},
+		{0x2F934, 3172, 1},
+		{0x2F935, 3173, 1},
+		{0x2F936, 3174, 1},
+		{0x2F937, 3175, 1},
+		{0x2F938, 3176, 1},
+		{0x2F939, 3177, 1},
+		{0x2F93A, 3178, 1},
+		{0x2F93B, 3179, 1},
+		{0x2F93C, 3180, 1},
+		{0x2F93D, 3181, 1},
+		{0x2F93E, 3182, 1},
+		{0x2F93F, 3183, 1},
+		{0x2F940, 3184, 1},
+		{0x2F941, 3185, 1},
+		{0x2F942, 3186, 1},
+		{0x2F943, 3187, 1},
+		{0x2F944, 3188, 1},
+		{0x2F945, 3189, 1},
+		{0x2F946, 3190, 1},
+		{0x2F947, 3191, 1},
+		{0x2F948, 3192, 1},
+		{0x2F949, 3193, 1},
+		{0x2F94A, 3194, 1},
+		{0x2F94B, 3195, 1},
+		{0x2F94C, 3196, 1},
+		{0x2F94D, 3197, 1},
+		{0x2F94E, 3198, 1},
+		{0x2F94F, 3199, 1},
+		{0x2F950, 3200, 1},
+		{0x2F951, 3201, 1},
+		{0x2F952, 3202, 1},
+		{0x2F953, 3203, 1},
+		{0x2F954, 3204, 1},
+		{0x2F955, 3205, 1},
+		{0x2F956, 3206, 1},
+		{0x2F957, 3207, 1},
+		{0x2F958, 3208, 1},
+		{0x2F959, 3209, 1},
+		{0x2F95A, 3210, 1},
+		{0x2F95B, 3211, 1},
+		{0x2F95C, 3212, 1},
+		{0x2F95D, 3213, 1},
+		{0x2F95E, 3214, 1},
+		{0x2F95F, 3215, 1},
+		{0x2F960, 3216, 1},
+		{0x2F961, 3217, 1},
+		{0x2F962, 3218, 1},
+		{0x2F963, 3219, 1},
+		{0x2F964, 3220, 1},
+		{0x2F965, 3221, 1},
+		{0x2F966, 3222, 1},
+		{0x2F967, 3223, 1},
+		{0x2F968, 3224, 1},
+		{0x2F969, 3225, 1},
+		{0x2F96A, 3226, 1},
+		{0x2F96B, 3227, 1},
+		{0x2F96C, 3228, 1},
+		{0x2F96D, 3229, 1},
+		{0x2F96E, 3230, 1},
+		{0x2F96F, 3231, 1},
+		{0x2F970, 3232, 1},
+		{0x2F971, 3233, 1},
+		{0x2F972, 3234, 1},
+		{0x2F973, 3235, 1},
+		{0x2F974, 3236, 1},
+		{0x2F975, 3237, 1},
+		{0x2F976, 3238, 1},
+		{0x2F977, 3239, 1},
+		{0x2F978, 3240, 1},
+		{0x2F979, 3241, 1},
+		{0x2F97A, 3242, 1},
+		{0x2F97B, 3243, 1},
+		{0x2F97C, 3244, 1},
+		{0x2F97D, 3245, 1},
+		{0x2F97E, 3246, 1},
+		{0x2F97F, 3247, 1},
+		{0x2F980, 3248, 1},
+		{0x2F981, 3249, 1},
+		{0x2F982, 3250, 1},
+		{0x2F983, 3251, 1},
+		{0x2F984, 3252, 1},
+		{0x2F985, 3253, 1},
+		{0x2F986, 3254, 1},
+		{0x2F987, 3255, 1},
+		{0x2F988, 3256, 1},
+		{0x2F989, 3257, 1},
+		{0x2F98A, 3258, 1},
+		{0x2F98B, 3259, 1},
+		{0x2F98C, 3260, 1},
+		{0x2F98D, 3261, 1},
+		{0x2F98E, 3262, 1},
+		{0x2F98F, 3263, 1},
+		{0x2F990, 3264, 1},
+		{0x2F991, 3265, 1},
+		{0x2F992, 3266, 1},
+		{0x2F993, 3267, 1},
+		{0x2F994, 3268, 1},
+		{0x2F995, 3269, 1},
+		{0x2F996, 3270, 1},
+		{0x2F997, 3271, 1},
+		{0x2F998, 3272, 1},
+		{0x2F999, 3273, 1},
+		{0x2F99A, 3274, 1},
+		{0x2F99B, 3275, 1},
+		{0x2F99C, 3276, 1},
+		{0x2F99D, 3277, 1},
+		{0x2F99E, 3278, 1},
+		{0x2F99F, 3279, 1},
+		{0x2F9A0, 3280, 1},
+		{0x2F9A1, 3281, 1},
+		{0x2F9A2, 3282, 1},
+		{0x2F9A3, 3283, 1},
+		{0x2F9A4, 3284, 1},
+		{0x2F9A5, 3285, 1},
+		{0x2F9A6, 3286, 1},
+		{0x2F9A7, 3287, 1},
+		{0x2F9A8, 3288, 1},
+		{0x2F9A9, 3289, 1},
+		{0x2F9AA, 3290, 1},
+		{0x2F9AB, 3291, 1},
+		{0x2F9AC, 3292, 1},
+		{0x2F9AD, 3293, 1},
+		{0x2F9AE, 3294, 1},
+		{0x2F9AF, 3295, 1},
+		{0x2F9B0, 3296, 1},
+		{0x2F9B1, 3297, 1},
+		{0x2F9B2, 3298, 1},
+		{0x2F9B3, 3299, 1},
+		{0x2F9B4, 3300, 1},
+		{0x2F9B5, 3301, 1},
+		{0x2F9B6, 3302, 1},
+		{0x2F9B7, 3303, 1},
+		{0x2F9B8, 3304, 1},
+		{0x2F9B9, 3305, 1},
+		{0x2F9BA, 3306, 1},
+		{0x2F9BB, 3307, 1},
+		{0x2F9BC, 3308, 1},
+		{0x2F9BD, 3309, 1},
+		{0x2F9BE, 3310, 1},
+		{0x2F9BF, 3311, 1},
+		{0x2F9C0, 3312, 1},
+		{0x2F9C1, 3313, 1},
+		{0x2F9C2, 3314, 1},
+		{0x2F9C3, 3315, 1},
+		{0x2F9C4, 3316, 1},
+		{0x2F9C5, 3317, 1},
+		{0x2F9C6, 3318, 1},
+		{0x2F9C7, 3319, 1},
+		{0x2F9C8, 3320, 1},
+		{0x2F9C9, 3321, 1},
+		{0x2F9CA, 3322, 1},
+		{0x2F9CB, 3323, 1},
+		{0x2F9CC, 3324, 1},
+		{0x2F9CD, 3325, 1},
+		{0x2F9CE, 3326, 1},
+		{0x2F9CF, 3327, 1},
+		{0x2F9D0, 3328, 1},
+		{0x2F9D1, 3329, 1},
+		{0x2F9D2, 3330, 1},
+		{0x2F9D3, 3331, 1},
+		{0x2F9D4, 3332, 1},
+		{0x2F9D5, 3333, 1},
+		{0x2F9D6, 3334, 1},
+		{0x2F9D7, 3335, 1},
+		{0x2F9D8, 3336, 1},
+		{0x2F9D9, 3337, 1},
+		{0x2F9DA, 3338, 1},
+		{0x2F9DB, 3339, 1},
+		{0x2F9DC, 3340, 1},
+		{0x2F9DD, 3341, 1},
+		{0x2F9DE, 3342, 1},
+		{0x2F9DF, 3343, 1},
+		{0x2F9E0, 3344, 1},
+		{0x2F9E1, 3345, 1},
+		{0x2F9E2, 3346, 1},
+		{0x2F9E3, 3347, 1},
+		{0x2F9E4, 3348, 1},
+		{0x2F9E5, 3349, 1},
+		{0x2F9E6, 3350, 1},
+		{0x2F9E7, 3351, 1},
+		{0x2F9E8, 3352, 1},
+		{0x2F9E9, 3353, 1},
+		{0x2F9EA, 3354, 1},
+		{0x2F9EB, 3355, 1},
+		{0x2F9EC, 3356, 1},
+		{0x2F9ED, 3357, 1},
+		{0x2F9EE, 3358, 1},
+		{0x2F9EF, 3359, 1},
+		{0x2F9F0, 3360, 1},
+		{0x2F9F1, 3361, 1},
+		{0x2F9F2, 3362, 1},
+		{0x2F9F3, 3363, 1},
+		{0x2F9F4, 3364, 1},
+		{0x2F9F5, 3365, 1},
+		{0x2F9F6, 3366, 1},
+		{0x2F9F7, 3367, 1},
+		{0x2F9F8, 3368, 1},
+		{0x2F9F9, 3369, 1},
+		{0x2F9FA, 3370, 1},
+		{0x2F9FB, 3371, 1},
+		{0x2F9FC, 3372, 1},
+		{0x2F9FD, 3373, 1},
+		{0x2F9FE, 3374, 1},
+		{0x2F9FF, 3375, 1},
+		{0x2FA00, 3376, 1},
+		{0x2FA01, 3377, 1},
+		{0x2FA02, 3378, 1},
+		{0x2FA03, 3379, 1},
+		{0x2FA04, 3380, 1},
+		{0x2FA05, 3381, 1},
+		{0x2FA06, 3382, 1},
+		{0x2FA07, 3383, 1},
+		{0x2FA08, 3384, 1},
+		{0x2FA09, 3385, 1},
+		{0x2FA0A, 3386, 1},
+		{0x2FA0B, 3387, 1},
+		{0x2FA0C, 3388, 1},
+		{0x2FA0D, 3389, 1},
+		{0x2FA0E, 3390, 1},
+		{0x2FA0F, 3391, 1},
+		{0x2FA10, 3392, 1},
+		{0x2FA11, 3393, 1},
+		{0x2FA12, 3394, 1},
+		{0x2FA13, 3395, 1},
+		{0x2FA14, 3396, 1},
+		{0x2FA15, 3397, 1},
+		{0x2FA16, 3398, 1},
+		{0x2FA17, 3399, 1},
+		{0x2FA18, 3400, 1},
+		{0x2FA19, 3401, 1},
+		{0x2FA1A, 3402, 1},
+		{0x2FA1B, 3403, 1},
+		{0x2FA1C, 3404, 1},
+		{0x2FA1D, 3405, 1},
+	};
+
+	/// The full compatibility decompositions, by code point, except Hangul.
+	inline static constexpr decomposition COMPATIBILITY[5795] = {
+		{0x00A0, 3406, 1},
+		{0x00A8, 3407, 2},
+		{0x00AA, 3409, 1},
+		{0x00AF, 3410, 2},
+		{0x00B2, 3412, 1},
+		{0x00B3, 3413, 1},
+		{0x00B4, 3414, 2},
+		{0x00B5, 3416, 1},
+		{0x00B8, 3417, 2},
+		{0x00B9, 3419, 1},
+		{0x00BA, 3420, 1},
+		{0x00BC, 3421, 3},
+		{0x00BD, 3424, 3},
+		{0x00BE, 3427, 3},
+		{0x00C0, 3430, 2},
+		{0x00C1, 3432, 2},
+		{0x00C2, 3434, 2},
+		{0x00C3, 3436, 2},
+		{0x00C4, 3438, 2},
+		{0x00C5, 3440, 2},
+		{0x00C7, 3442, 2},
+		{0x00C8, 3444, 2},
+		{0x00C9, 3446, 2},
+		{0x00CA, 3448, 2},
+		{0x00CB, 3450, 2},
+		{0x00CC, 3452, 2},
+		{0x00CD, 3454, 2},
+		{0x00CE, 3456, 2},
+		{0x00CF, 3458, 2},
+		{0x00D1, 3460, 2},
+		{0x00D2, 3462, 2},
+		{0x00D3, 3464, 2},
+		{0x00D4, 3466, 2},
+		{0x00D5, 3468, 2},
+		{0x00D6, 3470, 2},
+		{0x00D9, 3472, 2},
+		{0x00DA, 3474, 2},
+		{0x00DB, 3476, 2},
+		{0x00DC, 3478, 2},
+		{0x00DD, 3480, 2},
+		{0x00E0, 3482, 2},
+		{0x00E1, 3484, 2},
+		{0x00E2, 3486, 2},
+		{0x00E3, 3488, 2},
+		{0x00E4, 3490, 2},
+		{0x00E5, 3492, 2},
+		{0x00E7, 3494, 2},
+		{0x00E8, 3496, 2},
+		{0x00E9, 3498, 2},
+		{0x00EA, 3500, 2},
+		{0x00EB, 3502, 2},
+		{0x00EC, 3504, 2},
+		{0x00ED, 3506, 2},
+		{0x00EE, 3508, 2},
+		{0x00EF, 3510, 2},
+		{0x00F1, 3512, 2},
+		{0x00F2, 3514, 2},
+		{0x00F3, 3516, 2},
+		{0x00F4, 3518, 2},
+		{0x00F5, 3520, 2},
+		{0x00F6, 3522, 2},
+		{0x00F9, 3524, 2},
+		{0x00FA, 3526, 2},
+		{0x00FB, 3528, 2},
+		{0x00FC, 3530, 2},
+		{0x00FD, 3532, 2},
+		{0x00FF, 3534, 2},
+		{0x0100, 3536, 2},
+		{0x0101, 3538, 2},
+		{0x0102, 3540, 2},
+		{0x0103, 3542, 2},
+		{0x0104, 3544, 2},
+		{0x0105, 3546, 2},
+		{0x0106, 3548, 2},
+		{0x0107, 3550, 2},
+		{0x0108, 3552, 2},
+		{0x0109, 3554, 2},
+		{0x010A, 3556, 2},
+		{0x010B, 3558, 2},
+		{0x010C, 3560, 2},
+		{0x010D, 3562, 2},
+		{0x010E, 3564, 2},
+		{0x010F, 3566, 2},
+		{0x0112, 3568, 2},
+		{0x0113, 3570, 2},
+		{0x0114, 3572, 2},
+		{0x0115, 3574, 2},
+		{0x0116, 3576, 2},
+		{0x0117, 3578, 2},
+		{0x0118, 3580, 2},
+		{0x0119, 3582, 2},
+		{0x011A, 3584, 2},
+		{0x011B, 3586, 2},
+		{0x011C, 3588, 2},
+		{0x011D, 3590, 2},
+		{0x011E, 3592, 2},
+		{0x011F, 3594, 2},
+		{0x0120, 3596, 2},
+		{0x0121, 3598, 2},
+		{0x0122, 3600, 2},
+		{0x0123, 3602, 2},
+		{0x0124, 3604, 2},
+		{0x0125, 3606, 2},
+		{0x0128, 3608, 2},
+		{0x0129, 3610, 2},
+		{0x012A, 3612, 2},
+		{0x012B, 3614, 2},
+		{0x012C, 3616, 2},
+		{0x012D, 3618, 2},
+		{0x012E, 3620, 2},
+		{0x012F, 3622, 2},
+		{0x0130, 3624, 2},
+		{0x0132, 3626, 2},
+		{0x0133, 3628, 2},
+		{0x0134, 3630, 2},
+		{0x0135, 3632, 2},
+		{0x0136, 3634, 2},
+		{0x0137, 3636, 2},
+		{0x0139, 3638, 2},
+		{0x013A, 3640, 2},
+		{0x013B, 3642, 2},
+		{0x013C, 3644, 2},
+		{0x013D, 3646, 2},
+		{0x013E, 3648, 2},
+		{0x013F, 3650, 2},
+		{0x0140, 3652, 2},
+		{0x0143, 3654, 2},
+		{0x0144, 3656, 2},
+		{0x0145, 3658, 2},
+		{0x0146, 3660, 2},
+		{0x0147, 3662, 2},
+		{0x0148, 3664, 2},
+		{0x0149, 3666, 2},
+		{0x014C, 3668, 2},
+		{0x014D, 3670, 2},
+		{0x014E, 3672, 2},
+		{0x014F, 3674, 2},
+		{0x0150, 3676, 2},
+		{0x0151, 3678, 2},
+		{0x0154, 3680, 2},
+		{0x0155, 3682, 2},
+		{0x0156, 3684, 2},
+		{0x0157, 3686, 2},
+		{0x0158, 3688, 2},
+		{0x0159, 3690, 2},
+		{0x015A, 3692, 2},
+		{0x015B, 3694, 2},
+		{0x015C, 3696, 2},
+		{0x015D, 3698, 2},
+		{0x015E, 3700, 2},
+		{0x015F, 3702, 2},
+		{0x0160, 3704, 2},
+		{0x0161, 3706, 2},
+		{0x0162, 3708, 2},
+		{0x0163, 3710, 2},
+		{0x0164, 3712, 2},
+		{0x0165, 3714, 2},
+		{0x0168, 3716, 2},
+		{0x0169, 3718, 2},
+		{0x016A, 3720, 2},
+		{0x016B, 3722, 2},
+		{0x016C, 3724, 2},
+		{0x016D, 3726, 2},
+		{0x016E, 3728, 2},
+		{0x016F, 3730, 2},
+		{0x0170, 3732, 2},
+		{0x0171, 3734, 2},
+		{0x0172, 3736, 2},
+		{0x0173, 3738, 2},
+		{0x0174, 3740, 2},
+		{0x0175, 3742, 2},
+		{0x0176, 3744, 2},
+		{0x0177, 3746, 2},
+		{0x0178, 3748, 2},
+		{0x0179, 3750, 2},
+		{0x017A, 3752, 2},
+		{0x017B, 3754, 2},
+		{0x017C, 3756, 2},
+		{0x017D, 3758, 2},
+		{0x017E, 3760, 2},
+		{0x017F, 3762, 1},
+		{0x01A0, 3763, 2},
+		{0x01A1, 3765, 2},
+		{0x01AF, 3767, 2},
+		{0x01B0, 3769, 2},
+		{0x01C4, 3771, 3},
+		{0x01C5, 3774, 3},
+		{0x01C6, 3777, 3},
+		{0x01C7, 3780, 2},
+		{0x01C8, 3782, 2},
+		{0x01C9, 3784, 2},
+		{0x01CA, 3786, 2},
+		{0x01CB, 3788, 2},
+		{0x01CC, 3790, 2},
+		{0x01CD, 3792, 2},
+		{0x01CE, 3794, 2},
+		{0x01CF, 3796, 2},
+		{0x01D0, 3798, 2},
+		{0x01D1, 3800, 2},
+		{0x01D2, 3802, 2},
+		{0x01D3, 3804, 2},
+		{0x01D4, 3806, 2},
+		{0x01D5, 3808, 3},
+		{0x01D6, 3811, 3},
+		{0x01D7, 3814, 3},
+		{0x01D8, 3817, 3},
+		{0x01D9, 3820, 3},
+		{0x01DA, 3823, 3},
+		{0x01DB, 3826, 3},
+		{0x01DC, 3829, 3},
+		{0x01DE, 3832, 3},
+		{0x01DF, 3835, 3},
+		{0x01E0, 3838, 3},
+		{0x01E1, 3841, 3},
+		{0x01E2, 3844, 2},
+		{0x01E3, 3846, 2},
+		{0x01E6, 3848, 2},
+		{0x01E7, 3850, 2},
+		{0x01E8, 3852, 2},
+		{0x01E9, 3854, 2},
+		{0x01EA, 3856, 2},
+		{0x01EB, 3858, 2},
+		{0x01EC, 3860, 3},
+		{0x01ED, 3863, 3},
+		{0x01EE, 3866, 2},
+		{0x01EF, 3868, 2},
+		{0x01F0, 3870, 2},
+		{0x01F1, 3872, 2},
+		{0x01F2, 3874, 2},
+		{0x01F3, 3876, 2},
+		{0x01F4, 3878, 2},
+		{0x01F5, 3880, 2},
+		{0x01F8, 3882, 2},
+		{0x01F9, 3884, 2},
+		{0x01FA, 3886, 3},
+		{0x01FB, 3889, 3},
+		{0x01FC, 3892, 2},
+		{0x01FD, 3894, 2},
+		{0x01FE, 3896, 2},
+		{0x01FF, 3898, 2},
+		{0x0200, 3900, 2},
+		{0x0201, 3902, 2},
+		{0x0202, 3904, 2},
+		{0x0203, 3906, 2},
+		{0x0204, 3908, 2},
+		{0x0205, 3910, 2},
+		{0x0206, 3912, 2},
+		{0x0207, 3914, 2},
+		{0x0208, 3916, 2},
+		{0x0209, 3918, 2},
+		{0x020A, 3920, 2},
+		{0x020B, 3922, 2},
+		{0x020C, 3924, 2},
+		{0x020D, 3926, 2},
+		{0x020E, 3928, 2},
+		{0x020F, 3930, 2},
+		{0x0210, 3932, 2},
+		{0x0211, 3934, 2},
+		{0x0212, 3936, 2},
+		{0x0213, 3938, 2},
+		{0x0214, 3940, 2},
+		{0x0215, 3942, 2},
+		{0x0216, 3944, 2},
+		{0x0217, 3946, 2},
+		{0x0218, 3948, 2},
+		{0x0219, 3950, 2},
+		{0x021A, 3952, 2},
+		{0x021B, 3954, 2},
+		{0x021E, 3956, 2},
+		{0x021F, 3958, 2},
+		{0x0226, 3960, 2},
+		{0x0227, 3962, 2},
+		{0x0228, 3964, 2},
+		{0x0229, 3966, 2},
+		{0x022A, 3968, 3},
+		{0x022B, 3971, 3},
+		{0x022C, 3974, 3},
+		{0x022D, 3977, 3},
+		{0x022E, 3980, 2},
+		{0x022F, 3982, 2},
+		{0x0230, 3984, 3},
+		{0x0231, 3987, 3},
+		{0x0232, 3990, 2},
+		{0x0233, 3992, 2},
+		{0x02B0, 3994, 1},
+		{0x02B1, 3995, 1},
+		{0x02B2, 3996, 1},
+		{0x02B3, 3997, 1},
+		{0x02B4, 3998, 1},
+		{0x02B5, 3999, 1},
+		{0x02B6, 4000, 1},
+		{0x02B7, 4001, 1},
+		{0x02B8, 4002, 1},
+		{0x02D8, 4003, 2},
+		{0x02D9, 4005, 2},
+		{0x02DA, 4007, 2},
+		{0x02DB, 4009, 2},
+		{0x02DC, 4011, 2},
+		{0x02DD, 4013, 2},
+		{0x02E0, 4015, 1},
+		{0x02E1, 4016, 1},
+		{0x02E2, 4017, 1},
+		{0x02E3, 4018, 1},
+		{0x02E4, 4019, 1},
+		{0x0340, 4020, 1},
+		{0x0341, 4021, 1},
+		{0x0343, 4022, 1},
+		{0x0344, 4023, 2},
+		{0x0374, 4025, 1},
+		{0x037A, 4026, 2},
+		{0x037E, 4028, 1},
+		{0x0384, 4029, 2},
+		{0x0385, 4031, 3},
+		{0x0386, 4034, 2},
+		{0x0387, 4036, 1},
+		{0x0388, 4037, 2},
+		{0x0389, 4039, 2},
+		{0x038A, 4041, 2},
+		{0x038C, 4043, 2},
+		{0x038E, 4045, 2},
+		{0x038F, 4047, 2},
+		{0x0390, 4049, 3},
+		{0x03AA, 4052, 2},
+		{0x03AB, 4054, 2},
+		{0x03AC, 4056, 2},
+		{0x03AD, 4058, 2},
+		{0x03AE, 4060, 2},
+		{0x03AF, 4062, 2},
+		{0x03B0, 4064, 3},
+		{0x03CA, 4067, 2},
+		{0x03CB, 4069, 2},
+		{0x03CC, 4071, 2},
+		{0x03CD, 4073, 2},
+		{0x03CE, 4075, 2},
+		{0x03D0, 4077, 1},
+		{0x03D1, 4078, 1},
+		{0x03D2, 4079, 1},
+		{0x03D3, 4080, 2},
+		{0x03D4, 4082, 2},
+		{0x03D5, 4084, 1},
+		{0x03D6, 4085, 1},
+		{0x03F0, 4086, 1},
+		{0x03F1, 4087, 1},
+		{0x03F2, 4088, 1},
+		{0x03F4, 4089, 1},
+		{0x03F5, 4090, 1},
+		{0x03F9, 4091, 1},
+		{0x0400, 4092, 2},
+		{0x0401, 4094, 2},
+		{0x0403, 4096, 2},
+		{0x0407, 4098, 2},
+		{0x040C, 4100, 2},
+		{0x040D, 4102, 2},
+		{0x040E, 4104, 2},
+		{0x0419, 4106, 2},
+		{0x0439, 4108, 2},
+		{0x0450, 4110, 2},
+		{0x0451, 4112, 2},
+		{0x0453, 4114, 2},
+		{0x0457, 4116, 2},
+		{0x045C, 4118, 2},
+		{0x045D, 4120, 2},
+		{0x045E, 4122, 2},
+		{0x0476, 4124, 2},
+		{0x0477, 4126, 2},
+		{0x04C1, 4128, 2},
+		{0x04C2, 4130, 2},
+		{0x04D0, 4132, 2},
+		{0x04D1, 4134, 2},
+		{0x04D2, 4136, 2},
+		{0x04D3, 4138, 2},
+		{0x04D6, 4140, 2},
+		{0x04D7, 4142, 2},
+		{0x04DA, 4144, 2},
+		{0x04DB, 4146, 2},
+		{0x04DC, 4148, 2},
+		{0x04DD, 4150, 2},
+		{0x04DE, 4152, 2},
+		{0x04DF, 4154, 2},
+		{0x04E2, 4156, 2},
+		{0x04E3, 4158, 2},
+		{0x04E4, 4160, 2},
+		{0x04E5, 4162, 2},
+		{0x04E6, 4164, 2},
+		{0x04E7, 4166, 2},
+		{0x04EA, 4168, 2},
+		{0x04EB, 4170, 2},
+		{0x04EC, 4172, 2},
+		{0x04ED, 4174, 2},
+		{0x04EE, 4176, 2},
+		{0x04EF, 4178, 2},
+		{0x04F0, 4180, 2},
+		{0x04F1, 4182, 2},
+		{0x04F2, 4184, 2},
+		{0x04F3, 4186, 2},
+		{0x04F4, 4188, 2},
+		{0x04F5, 4190, 2},
+		{0x04F8, 4192, 2},
+		{0x04F9, 4194, 2},
+		{0x0587, 4196, 2},
+		{0x0622, 4198, 2},
+		{0x0623, 4200, 2},
+		{0x0624, 4202, 2},
+		{0x0625, 4204, 2},
+		{0x0626, 4206, 2},
+		{0x0675, 4208, 2},
+		{0x0676, 4210, 2},
+		{0x0677, 4212, 2},
+		{0x0678, 4214, 2},
+		{0x06C0, 4216, 2},
+		{0x06C2, 4218, 2},
+		{0x06D3, 4220, 2},
+		{0x0929, 4222, 2},
+		{0x0931, 4224, 2},
+		{0x0934, 4226, 2},
+		{0x0958, 4228, 2},
+		{0x0959, 4230, 2},
+		{0x095A, 4232, 2},
+		{0x095B, 4234, 2},
+		{0x095C, 4236, 2},
+		{0x095D, 4238, 2},
+		{0x095E, 4240, 2},
+		{0x095F, 4242, 2},
+		{0x09CB, 4244, 2},
+		{0x09CC, 4246, 2},
+		{0x09DC, 4248, 2},
+		{0x09DD, 4250, 2},
+		{0x09DF, 4252, 2},
+		{0x0A33, 4254, 2},
+		{0x0A36, 4256, 2},
+		{0x0A59, 4258, 2},
+		{0x0A5A, 4260, 2},
+		{0x0A5B, 4262, 2},
+		{0x0A5E, 4264, 2},
+		{0x0B48, 4266, 2},
+		{0x0B4B, 4268, 2},
+		{0x0B4C, 4270, 2},
+		{0x0B5C, 4272, 2},
+		{0x0B5D, 4274, 2},
+		{0x0B94, 4276, 2},
+		{0x0BCA, 4278, 2},
+		{0x0BCB, 4280, 2},
+		{0x0BCC, 4282, 2},
+		{0x0C48, 4284, 2},
+		{0x0CC0, 4286, 2},
+		{0x0CC7, 4288, 2},
+		{0x0CC8, 4290, 2},
+		{0x0CCA, 4292, 2},
+		{0x0CCB, 4294, 3},
+		{0x0D4A, 4297, 2},
+		{0x0D4B, 4299, 2},
+		{0x0D4C, 4301, 2},
+		{0x0DDA, 4303, 2},
+		{0x0DDC, 4305, 2},
+		{0x0DDD, 4307, 3},
+		{0x0DDE, 4310, 2},
+		{0x0E33, 4312, 2},
+		{0x0EB3, 4314, 2},
+		{0x0EDC, 4316, 2},
+		{0x0EDD, 4318, 2},
+		{0x0F0C, 4320, 1},
+		{0x0F43, 4321, 2},
+		{0x0F4D, 4323, 2},
+		{0x0F52, 4325, 2},
+		{0x0F57, 4327, 2},
+		{0x0F5C, 4329, 2},
+		{0x0F69, 4331, 2},
+		{0x0F73, 4333, 2},
+		{0x0F75, 4335, 2},
+		{0x0F76, 4337, 2},
+		{0x0F77, 4339, 3},
+		{0x0F78, 4342, 2},
+		{0x0F79, 4344, 3},
+		{0x0F81, 4347, 2},
+		{0x0F93, 4349, 2},
+		{0x0F9D, 4351, 2},
+		{0x0FA2, 4353, 2},
+		{0x0FA7, 4355, 2},
+		{0x0FAC, 4357, 2},
+		{0x0FB9, 4359, 2},
+		{0x1026, 4361, 2},
+		{0x10FC, 4363, 1},
+		{0x1B06, 4364, 2},
+		{0x1B08, 4366, 2},
+		{0x1B0A, 4368, 2},
+		{0x1B0C, 4370, 2},
+		{0x1B0E, 4372, 2},
+		{0x1B12, 4374, 2},
+		{0x1B3B, 4376, 2},
+		{0x1B3D, 4378, 2},
+		{0x1B40, 4380, 2},
+		{0x1B41, 4382, 2},
+		{0x1B43, 4384, 2},
+		{0x1D2C, 4386, 1},
+		{0x1D2D, 4387, 1},
+		{0x1D2E, 4388, 1},
+		{0x1D30, 4389, 1},
+		{0x1D31, 4390, 1},
+		{0x1D32, 4391, 1},
+		{0x1D33, 4392, 1},
+		{0x1D34, 4393, 1},
+		{0x1D35, 4394, 1},
+		{0x1D36, 4395, 1},
+		{0x1D37, 4396, 1},
+		{0x1D38, 4397, 1},
+		{0x1D39, 4398, 1},
+		{0x1D3A, 4399, 1},
+		{0x1D3C, 4400, 1},
+		{0x1D3D, 4401, 1},
+		{0x1D3E, 4402, 1},
+		{0x1D3F, 4403, 1},
+		{0x1D40, 4404, 1},
+		{0x1D41, 4405, 1},
+		{0x1D42, 4406, 1},
+		{0x1D43, 4407, 1},
+		{0x1D44, 4408, 1},
+		{0x1D45, 4409, 1},
+		{0x1D46, 4410, 1},
+		{0x1D47, 4411, 1},
+		{0x1D48, 4412, 1},
+		{0x1D49, 4413, 1},
+		{0x1D4A, 4414, 1},
+		{0x1D4B, 4415, 1},
+		{0x1D4C, 4416, 1},
+		{0x1D4D, 4417, 1},
+		{0x1D4F, 4418, 1},
+		{0x1D50, 4419, 1},
+		{0x1D51, 4420, 1},
+		{0x1D52, 4421, 1},
+		{0x1D53, 4422, 1},
+		{0x1D54, 4423, 1},
+		{0x1D55, 4424, 1},
+		{0x1D56, 4425, 1},
+		{0x1D57, 4426, 1},
+		{0x1D58, 4427, 1},
+		{0x1D59, 4428, 1},
+		{0x1D5A, 4429, 1},
+		{0x1D5B, 4430, 1},
+		{0x1D5C, 4431, 1},
+		{0x1D5D, 4432, 1},
+		{0x1D5E, 4433, 1},
+		{0x1D5F, 4434, 1},
+		{0x1D60, 4435, 1},
+		{0x1D61, 4436, 1},
+		{0x1D62, 4437, 1},
+		{0x1D63, 4438, 1},
+		{0x1D64, 4439, 1},
+		{0x1D65, 4440, 1},
+		{0x1D66, 4441, 1},
+		{0x1D67, 4442, 1},
+		{0x1D68, 4443, 1},
+		{0x1D69, 4444, 1},
+		{0x1D6A, 4445, 1},
+		{0x1D78, 4446, 1},
+		{0x1D9B, 4447, 1},
+		{0x1D9C, 4448, 1},
+		{0x1D9D, 4449, 1},
+		{0x1D9E, 4450, 1},
+		{0x1D9F, 4451, 1},
+		{0x1DA0, 4452, 1},
+		{0x1DA1, 4453, 1},
+		{0x1DA2, 4454, 1},
+		{0x1DA3, 4455, 1},
+		{0x1DA4, 4456, 1},
+		{0x1DA5, 4457, 1},
+		{0x1DA6, 4458, 1},
+		{0x1DA7, 4459, 1},
+		{0x1DA8, 4460, 1},
+		{0x1DA9, 4461, 1},
+		{0x1DAA, 4462, 1},
+		{0x1DAB, 4463, 1},
+		{0x1DAC, 4464, 1},
+		{0x1DAD, 4465, 1},
+		{0x1DAE, 4466, 1},
+		{0x1DAF, 4467, 1},
+		{0x1DB0, 4468, 1},
+		{0x1DB1, 4469, 1},
+		{0x1DB2, 4470, 1},
+		{0x1DB3, 4471, 1},
+		{0x1DB4, 4472, 1},
+		{0x1DB5, 4473, 1},
+		{0x1DB6, 4474, 1},
+		{0x1DB7, 4475, 1},
+		{0x1DB8, 4476, 1},
+		{0x1DB9, 4477, 1},
+		{0x1DBA, 4478, 1},
+		{0x1DBB, 4479, 1},
+		{0x1DBC, 4480, 1},
+		{0x1DBD, 4481, 1},
+		{0x1DBE, 4482, 1},
+		{0x1DBF, 4483, 1},
+		{0x1E00, 4484, 2},
+		{0x1E01, 4486, 2},
+		{0x1E02, 4488, 2},
+		{0x1E03, 4490, 2},
+		{0x1E04, 4492, 2},
+		{0x1E05, 4494, 2},
+		{0x1E06, 4496, 2},
+		{0x1E07, 4498, 2},
+		{0x1E08, 4500, 3},
+		{0x1E09, 4503, 3},
+		{0x1E0A, 4506, 2},
+		{0x1E0B, 4508, 2},
+		{0x1E0C, 4510, 2},
+		{0x1E0D, 4512, 2},
+		{0x1E0E, 4514, 2},
+		{0x1E0F, 4516, 2},
+		{0x1E10, 4518, 2},
+		{0x1E11, 4520, 2},
+		{0x1E12, 4522, 2},
+		{0x1E13, 4524, 2},
+		{0x1E14, 4526, 3},
+		{0x1E15, 4529, 3},
+		{0x1E16, 4532, 3},
+		{0x1E17, 4535, 3},
+		{0x1E18, 4538, 2},
+		{0x1E19, 4540, 2},
+		{0x1E1A, 4542, 2},
+		{0x1E1B, 4544, 2},
+		{0x1E1C, 4546, 3},
+		{0x1E1D, 4549, 3},
+		{0x1E1E, 4552, 2},
+		{0x1E1F, 4554, 2},
+		{0x1E20, 4556, 2},
+		{0x1E21, 4558, 2},
+		{0x1E22, 4560, 2},
+		{0x1E23, 4562, 2},
+		{0x1E24, 4564, 2},
+		{0x1E25, 4566, 2},
+		{0x1E26, 4568, 2},
+		{0x1E27, 4570, 2},
+		{0x1E28, 4572, 2},
+		{0x1E29, 4574, 2},
+		{0x1E2A, 4576, 2},
+		{0x1E2B, 4578, 2},
+		{0x1E2C, 4580, 2},
+		{0x1E2D, 4582, 2},
+		{0x1E2E, 4584, 3},
+		{0x1E2F, 4587, 3},
+		{0x1E30, 4590, 2},
+		{0x1E31, 4592, 2},
+		{0x1E32, 4594, 2},
+		{0x1E33, 4596, 2},
+		{0x1E34, 4598, 2},
+		{0x1E35, 4600, 2},
+		{0x1E36, 4602, 2},
+		{0x1E37, 4604, 2},
+		{0x1E38, 4606, 3},
+		{0x1E39, 4609, 3},
+		{0x1E3A, 4612, 2},
+		{0x1E3B, 4614, 2},
+		{0x1E3C, 4616, 2},
+		{0x1E3D, 4618, 2},
+		{0x1E3E, 4620, 2},
+		{0x1E3F, 4622, 2},
+		{0x1E40, 4624, 2},
+		{0x1E41, 4626, 2},
+		{0x1E42, 4628, 2},
+		{0x1E43, 4630, 2},
+		{0x1E44, 4632, 2},
+		{0x1E45, 4634, 2},
+		{0x1E46, 4636, 2},
+		{0x1E47, 4638, 2},
+		{0x1E48, 4640, 2},
+		{0x1E49, 4642, 2},
+		{0x1E4A, 4644, 2},
+		{0x1E4B, 4646, 2},
+		{0x1E4C, 4648, 3},
+		{0x1E4D, 4651, 3},
+		{0x1E4E, 4654, 3},
+		{0x1E4F, 4657, 3},
+		{0x1E50, 4660, 3},
+		{0x1E51, 4663, 3},
+		{0x1E52, 4666, 3},
+		{0x1E53, 4669, 3},
+		{0x1E54, 4672, 2},
+		{0x1E55, 4674, 2},
+		{0x1E56, 4676, 2},
+		{0x1E57, 4678, 2},
+		{0x1E58, 4680, 2},
+		{0x1E59, 4682, 2},
+		{0x1E5A, 4684, 2},
+		{0x1E5B, 4686, 2},
+		{0x1E5C, 4688, 3},
+		{0x1E5D, 4691, 3},
+		{0x1E5E, 4694, 2},
+		{0x1E5F, 4696, 2},
+		{0x1E60, 4698, 2},
+		{0x1E61, 4700, 2},
+		{0x1E62, 4702, 2},
+		{0x1E63, 4704, 2},
+		{0x1E64, 4706, 3},
+		{0x1E65, 4709, 3},
+		{0x1E66, 4712, 3},
+		{0x1E67, 4715, 3},
+		{0x1E68, 4718, 3},
+		{0x1E69, 4721, 3},
+		{0x1E6A, 4724, 2},
+		{0x1E6B, 4726, 2},
+		{0x1E6C, 4728, 2},
+		{0x1E6D, 4730, 2},
+		{0x1E6E, 4732, 2},
+		{0x1E6F, 4734, 2},
+		{0x1E70, 4736, 2},
+		{0x1E71, 4738, 2},
+		{0x1E72, 4740, 2},
+		{0x1E73, 4742, 2},
+		{0x1E74, 4744, 2},
+		{0x1E75, 4746, 2},
+		{0x1E76, 4748, 2},
+		{0x1E77, 4750, 2},
+		{0x1E78, 4752, 3},
+		{0x1E79, 4755, 3},
+		{0x1E7A, 4758, 3},
+		{0x1E7B, 4761, 3},
+		{0x1E7C, 4764, 2},
+		{0x1E7D, 4766, 2},
+		{0x1E7E, 4768, 2},
+		{0x1E7F, 4770, 2},
+		{0x1E80, 4772, 2},
+		{0x1E81, 4774, 2},
+		{0x1E82, 4776, 2},
+		{0x1E83, 4778, 2},
+		{0x1E84, 4780, 2},
+		{0x1E85, 4782, 2},
+		{0x1E86, 4784, 2},
+		{0x1E87, 4786, 2},
+		{0x1E88, 4788, 2},
+		{0x1E89, 4790, 2},
+		{0x1E8A, 4792, 2},
+		{0x1E8B, 4794, 2},
+		{0x1E8C, 4796, 2},
+		{0x1E8D, 4798, 2},
+		{0x1E8E, 4800, 2},
+		{0x1E8F, 4802, 2},
+		{0x1E90, 4804, 2},
+		{0x1E91, 4806, 2},
+		{0x1E92, 4808, 2},
+		{0x1E93, 4810, 2},
+		{0x1E94, 4812, 2},
+		{0x1E95, 4814, 2},
+		{0x1E96, 4816, 2},
+		{0x1E97, 4818, 2},
+		{0x1E98, 4820, 2},
+		{0x1E99, 4822, 2},
+		{0x1E9A, 4824, 2},
+		{0x1E9B, 4826, 2},
+		{0x1EA0, 4828, 2},
+		{0x1EA1, 4830, 2},
+		{0x1EA2, 4832, 2},
+		{0x1EA3, 4834, 2},
+		{0x1EA4, 4836, 3},
+		{0x1EA5, 4839, 3},
+		{0x1EA6, 4842, 3},
+		{0x1EA7, 4845, 3},
+		{0x1EA8, 4848, 3},
+		{0x1EA9, 4851, 3},
+		{0x1EAA, 4854, 3},
+		{0x1EAB, 4857, 3},
+		{0x1EAC, 4860, 3},
+		{0x1EAD, 4863, 3},
+		{0x1EAE, 4866, 3},
+		{0x1EAF, 4869, 3},
+		{0x1EB0, 4872, 3},
+		{0x1EB1, 4875, 3},
+		{0x1EB2, 4878, 3},
+		{0x1EB3, 4881, 3},
+		{0x1EB4, 4884, 3},
+		{0x1EB5, 4887, 3},
+		{0x1EB6, 4890, 3},
+		{0x1EB7, 4893, 3},
+		{0x1EB8, 4896, 2},
+		{0x1EB9, 4898, 2},
+		{0x1EBA, 4900, 2},
+		{0x1EBB, 4902, 2},
+		{0x1EBC, 4904, 2},
+		{0x1EBD, 4906, 2},
+		{0x1EBE, 4908, 3},
+		{0x1EBF, 4911, 3},
+		{0x1EC0, 4914, 3},
+		{0x1EC1, 4917, 3},
+		{0x1EC2, 4920, 3},
+		{0x1EC3, 4923, 3},
+		{0x1EC4, 4926, 3},
+		{0x1EC5, 4929, 3},
+		{0x1EC6, 4932, 3},
+		{0x1EC7, 4935, 3},
+		{0x1EC8, 4938, 2},
+		{0x1EC9, 4940, 2},
+		{0x1ECA, 4942, 2},
+		{0x1ECB, 4944, 2},
+		{0x1ECC, 4946, 2},
+		{0x1ECD, 4948, 2},
+		{0x1ECE, 4950, 2},
+		{0x1ECF, 4952, 2},
+		{0x1ED0, 4954, 3},
+		{0x1ED1, 4957, 3},
+		{0x1ED2, 4960, 3},
+		{0x1ED3, 4963, 3},
+		{0x1ED4, 4966, 3},
+		{0x1ED5, 4969, 3},
+		{0x1ED6, 4972, 3},
+		{0x1ED7, 4975, 3},
+		{0x1ED8, 4978, 3},
+		{0x1ED9, 4981, 3},
+		{0x1EDA, 4984, 3},
+		{0x1EDB, 4987, 3},
+		{0x1EDC, 4990, 3},
+		{0x1EDD, 4993, 3},
+		{0x1EDE, 4996, 3},
+		{0x1EDF, 4999, 3},
+		{0x1EE0, 5002, 3},
+		{0x1EE1, 5005, 3},
+		{0x1EE2, 5008, 3},
+		{0x1EE3, 5011, 3},
+		{0x1EE4, 5014, 2},
+		{0x1EE5, 5016, 2},
+		{0x1EE6, 5018, 2},
+		{0x1EE7, 5020, 2},
+		{0x1EE8, 5022, 3},
+		{0x1EE9, 5025, 3},
+		{0x1EEA, 5028, 3},
+		{0x1EEB, 5031, 3},
+		{0x1EEC, 5034, 3},
+		{0x1EED, 5037, 3},
+		{0x1EEE, 5040, 3},
+		{0x1EEF, 5043, 3},
+		{0x1EF0, 5046, 3},
+		{0x1EF1, 5049, 3},
+		{0x1EF2, 5052, 2},
+		{0x1EF3, 5054, 2},
+		{0x1EF4, 5056, 2},
+		{0x1EF5, 5058, 2},
+		{0x1EF6, 5060, 2},
+		{0x1EF7, 5062, 2},
+		{0x1EF8, 5064, 2},
+		{0x1EF9, 5066, 2},
+		{0x1F00, 5068, 2},
+		{0x1F01, 5070, 2},
+		{0x1F02, 5072, 3},
+		{0x1F03, 5075, 3},
+		{0x1F04, 5078, 3},
+		{0x1F05, 5081, 3},
+		{0x1F06, 5084, 3},
+		{0x1F07, 5087, 3},
+		{0x1F08, 5090, 2},
+		{0x1F09, 5092, 2},
+		{0x1F0A, 5094, 3},
+		{0x1F0B, 5097, 3},
+		{0x1F0C, 5100, 3},
+		{0x1F0D, 5103, 3},
+		{0x1F0E, 5106, 3},
+		{0x1F0F, 5109, 3},
+		{0x1F10, 5112, 2},
+		{0x1F11, 5114, 2},
+		{0x1F12, 5116, 3},
+		{0x1F13, 5119, 3},
+		{0x1F14, 5122, 3},
+		{0x1F15, 5125, 3},
+		{0x1F18, 5128, 2},
+		{0x1F19, 5130, 2},
+		{0x1F1A, 5132, 3},
+		{0x1F1B, 5135, 3},
+		{0x1F1C, 5138, 3},
+		{0x1F1D, 5141, 3},
+		{0x1F20, 5144, 2},
+		{0x1F21, 5146, 2},
+		{0x1F22, 5148, 3},
+		{0x1F23, 5151, 3},
+		{0x1F24, 5154, 3},
+		{0x1F25, 5157, 3},
+		{0x1F26, 5160, 3},
+		{0x1F27, 5163, 3},
+		{0x1F28, 5166, 2},
+		{0x1F29, 5168, 2},
+		{0x1F2A, 5170, 3},
+		{0x1F2B, 5173, 3},
+		{0x1F2C, 5176, 3},
+		{0x1F2D, 5179, 3},
+		{0x1F2E, 5182, 3},
+		{0x1F2F, 5185, 3},
+		{0x1F30, 5188, 2},
+		{0x1F31, 5190, 2},
+		{0x1F32, 5192, 3},
+		{0x1F33, 5195, 3},
+		{0x1F34, 5198, 3},
+		{0x1F35, 5201, 3},
+		{0x1F36, 5204, 3},
+		{0x1F37, 5207, 3},
+		{0x1F38, 5210, 2},
+		{0x1F39, 5212, 2},
+		{0x1F3A, 5214, 3},
+		{0x1F3B, 5217, 3},
+		{0x1F3C, 5220, 3},
+		{0x1F3D, 5223, 3},
+		{0x1F3E, 5226, 3},
+		{0x1F3F, 5229, 3},
+		{0x1F40, 5232, 2},
+		{0x1F41, 5234, 2},
+		{0x1F42, 5236, 3},
+		{0x1F43, 5239, 3},
+		{0x1F44, 5242, 3},
+		{0x1F45, 5245, 3},
+		{0x1F48, 5248, 2},
+		{0x1F49, 5250, 2},
+		{0x1F4A, 5252, 3},
+		{0x1F4B, 5255, 3},
+		{0x1F4C, 5258, 3},
+		{0x1F4D, 5261, 3},
+		{0x1F50, 5264, 2},
+		{0x1F51, 5266, 2},
+		{0x1F52, 5268, 3},
+		{0x1F53, 5271, 3},
+		{0x1F54, 5274, 3},
+		{0x1F55, 5277, 3},
+		{0x1F56, 5280, 3},
+		{0x1F57, 5283, 3},
+		{0x1F59, 5286, 2},
+		{0x1F5B, 5288, 3},
+		{0x1F5D, 5291, 3},
+		{0x1F5F, 5294, 3},
+		{0x1F60, 5297, 2},
+		{0x1F61, 5299, 2},
+		{0x1F62, 5301, 3},
+		{0x1F63, 5304, 3},
+		{0x1F64, 5307, 3},
+		{0x1F65, 5310, 3},
+		{0x1F66, 5313, 3},
+		{0x1F67, 5316, 3},
+		{0x1F68, 5319, 2},
+		{0x1F69, 5321, 2},
+		{0x1F6A, 5323, 3},
+		{0x1F6B, 5326, 3},
+		{0x1F6C, 5329, 3},
+		{0x1F6D, 5332, 3},
+		{0x1F6E, 5335, 3},
+		{0x1F6F, 5338, 3},
+		{0x1F70, 5341, 2},
+		{0x1F71, 5343, 2},
+		{0x1F72, 5345, 2},
+		{0x1F73, 5347, 2},
+		{0x1F74, 5349, 2},
+		{0x1F75, 5351, 2},
+		{0x1F76, 5353, 2},
+		{0x1F77, 5355, 2},
+		{0x1F78, 5357, 2},
+		{0x1F79, 5359, 2},
+		{0x1F7A, 5361, 2},
+		{0x1F7B, 5363, 2},
+		{0x1F7C, 5365, 2},
+		{0x1F7D, 5367, 2},
+		{0x1F80, 5369, 3},
+		{0x1F81, 5372, 3},
+		{0x1F82, 5375, 4},
+		{0x1F83, 5379, 4},
+		{0x1F84, 5383, 4},
+		{0x1F85, 5387, 4},
+		{0x1F86, 5391, 4},
+		{0x1F87, 5395, 4},
+		{0x1F88, 5399, 3},
+		{0x1F89, 5402, 3},
+		{0x1F8A, 5405, 4},
+		{0x1F8B, 5409, 4},
+		{0x1F8C, 5413, 4},
+		{0x1F8D, 5417, 4},
+		{0x1F8E, 5421, 4},
+		{0x1F8F, 5425, 4},
+		{0x1F90, 5429, 3},
+		{0x1F91, 5432, 3},
+		{0x1F92, 5435, 4},
+		{0x1F93, 5439, 4},
+		{0x1F94, 5443, 4},
+		{0x1F95, 5447, 4},
+		{0x1F96, 5451, 4},
+		{0x1F97, 5455, 4},
+		{0x1F98, 5459, 3},
+		{0x1F99, 5462, 3},
+		{0x1F9A, 5465, 4},
+		{0x1F9B, 5469, 4},
+		{0x1F9C, 5473, 4},
+		{0x1F9D, 5477, 4},
+		{0x1F9E, 5481, 4},
+		{0x1F9F, 5485, 4},
+		{0x1FA0, 5489, 3},
+		{0x1FA1, 5492, 3},
+		{0x1FA2, 5495, 4},
+		{0x1FA3, 5499, 4},
+		{0x1FA4, 5503, 4},
+		{0x1FA5, 5507, 4},
+		{0x1FA6, 5511, 4},
+		{0x1FA7, 5515, 4},
+		{0x1FA8, 5519, 3},
+		{0x1FA9, 5522, 3},
+		{0x1FAA, 5525, 4},
+		{0x1FAB, 5529, 4},
+		{0x1FAC, 5533, 4},
+		{0x1FAD, 5537, 4},
+		{0x1FAE, 5541, 4},
+		{0x1FAF, 5545, 4},
+		{0x1FB0, 5549, 2},
+		{0x1FB1, 5551, 2},
+		{0x1FB2, 5553, 3},
+		{0x1FB3, 5556, 2},
+		{0x1FB4, 5558, 3},
+		{0x1FB6, 5561, 2},
+		{0x1FB7, 5563, 3},
+		{0x1FB8, 5566, 2},
+		{0x1FB9, 5568, 2},
+		{0x1FBA, 5570, 2},
+		{0x1FBB, 5572, 2},
+		{0x1FBC, 5574, 2},
+		{0x1FBD, 5576, 2},
+		{0x1FBE, 5578, 1},
+		{0x1FBF, 5579, 2},
+		{0x1FC0, 5581, 2},
+		{0x1FC1, 5583, 3},
+		{0x1FC2, 5586, 3},
+		{0x1FC3, 5589, 2},
+		{0x1FC4, 5591, 3},
+		{0x1FC6, 5594, 2},
+		{0x1FC7, 5596, 3},
+		{0x1FC8, 5599, 2},
+		{0x1FC9, 5601, 2},
+		{0x1FCA, 5603, 2},
+		{0x1FCB, 5605, 2},
+		{0x1FCC, 5607, 2},
+		{0x1FCD, 5609, 3},
+		{0x1FCE, 5612, 3},
+		{0x1FCF, 5615, 3},
+		{0x1FD0, 5618, 2},
+		{0x1FD1, 5620, 2},
+		{0x1FD2, 5622, 3},
+		{0x1FD3, 5625, 3},
+		{0x1FD6, 5628, 2},
+		{0x1FD7, 5630, 3},
+		{0x1FD8, 5633, 2},
+		{0x1FD9, 5635, 2},
+		{0x1FDA, 5637, 2},
+		{0x1FDB, 5639, 2},
+		{0x1FDD, 5641, 3},
+		{0x1FDE, 5644, 3},
+		{0x1FDF, 5647, 3},
+		{0x1FE0, 5650, 2},
+		{0x1FE1, 5652, 2},
+		{0x1FE2, 5654, 3},
+		{0x1FE3, 5657, 3},
+		{0x1FE4, 5660, 2},
+		{0x1FE5, 5662, 2},
+		{0x1FE6, 5664, 2},
+		{0x1FE7, 5666, 3},
+		{0x1FE8, 5669, 2},
+		{0x1FE9, 5671, 2},
+		{0x1FEA, 5673, 2},
+		{0x1FEB, 5675, 2},
+		{0x1FEC, 5677, 2},
+		{0x1FED, 5679, 3},
+		{0x1FEE, 5682, 3},
+		{0x1FEF, 5685, 1},
+		{0x1FF2, 5686, 3},
+		{0x1FF3, 5689, 2},
+		{0x1FF4, 5691, 3},
+		{0x1FF6, 5694, 2},
+		{0x1FF7, 5696, 3},
+		{0x1FF8, 5699, 2},
+		{0x1FF9, 5701, 2},
+		{0x1FFA, 5703, 2},
+		{0x1FFB, 5705, 2},
+		{0x1FFC, 5707, 2},
+		{0x1FFD, 5709, 2},
+		{0x1FFE, 5711, 2},
+		{0x2000, 5713, 1},
+		{0x2001, 5714, 1},
+		{0x2002, 5715, 1},
+		{0x2003, 5716, 1},
+		{0x2004, 5717, 1},
+		{0x2005, 5718, 1},
+		{0x2006, 5719, 1},
+		{0x2007, 5720, 1},
+		{0x2008, 5721, 1},
+		{0x2009, 5722, 1},
+		{0x200A, 5723, 1},
+		{0x2011, 5724, 1},
+		{0x2017, 5725, 2},
+		{0x2024, 5727, 1},
+		{0x2025, 5728, 2},
+		{0x2026, 5730, 3},
+		{0x202F, 5733, 1},
+		{0x2033, 5734, 2},
+		{0x2034, 5736, 3},
+		{0x2036, 5739, 2},
+		{0x2037, 5741, 3},
+		{0x203C, 5744, 2},
+		{0x203E, 5746, 2},
+		{0x2047, 5748, 2},
+		{0x2048, 5750, 2},
+		{0x2049, 5752, 2},
+		{0x2057, 5754, 4},
+		{0x205F, 5758, 1},
+		{0x2070, 5759, 1},
+		{0x2071, 5760, 1},
+		{0x2074, 5761, 1},
+		{0x2075, 5762, 1},
+		{0x2076, 5763, 1},
+		{0x2077, 5764, 1},
+		{0x2078, 5765, 1},
+		{0x2079, 5766, 1},
+		{0x207A, 5767, 1},
+		{0x207B, 5768, 1},
+		{0x207C, 5769, 1},
+		{0x207D, 5770, 1},
+		{0x207E, 5771, 1},
+		{0x207F, 5772, 1},
+		{0x2080, 5773, 1},
+		{0x2081, 5774, 1},
+		{0x2082, 5775, 1},
+		{0x2083, 5776, 1},
+		{0x2084, 5777, 1},
+		{0x2085, 5778, 1},
+		{0x2086, 5779, 1},
+		{0x2087, 5780, 1},
+		{0x2088, 5781, 1},
+		{0x2089, 5782, 1},
+		{0x208A, 5783, 1},
+		{0x208B, 5784, 1},
+		{0x208C, 5785, 1},
+		{0x208D, 5786, 1},
+		{0x208E, 5787, 1},
+		{0x2090, 5788, 1},
+		{0x2091, 5789, 1},
+		{0x2092, 5790, 1},
+		{0x2093, 5791, 1},
+		{0x2094, 5792, 1},
+		{0x2095, 5793, 1},
+		{0x2096, 5794, 1},
+		{0x2097, 5795, 1},
+		{0x2098, 5796, 1},
+		{0x2099, 5797, 1},
+		{0x209A, 5798, 1},
+		{0x209B, 5799, 1},
+		{0x209C, 5800, 1},
+		{0x20A8, 5801, 2},
+		{0x2100, 5803, 3},
+		{0x2101, 5806, 3},
+		{0x2102, 5809, 1},
+		{0x2103, 5810, 2},
+		{0x2105, 5812, 3},
+		{0x2106, 5815, 3},
+		{0x2107, 5818, 1},
+		{0x2109, 5819, 2},
+		{0x210A, 5821, 1},
+		{0x210B, 5822, 1},
+		{0x210C, 5823, 1},
+		{0x210D, 5824, 1},
+		{0x210E, 5825, 1},
+		{0x210F, 5826, 1},
+		{0x2110, 5827, 1},
+		{0x2111, 5828, 1},
+		{0x2112, 5829, 1},
+		{0x2113, 5830, 1},
+		{0x2115, 5831, 1},
+		{0x2116, 5832, 2},
+		{0x2119, 5834, 1},
+		{0x211A, 5835, 1},
+		{0x211B, 5836, 1},
+		{0x211C, 5837, 1},
+		{0x211D, 5838, 1},
+		{0x2120, 5839, 2},
+		{0x2121, 5841, 3},
+		{0x2122, 5844, 2},
+		{0x2124, 5846, 1},
+		{0x2126, 5847, 1},
+		{0x2128, 5848, 1},
+		{0x212A, 5849, 1},
+		{0x212B, 5850, 2},
+		{0x212C, 5852, 1},
+		{0x212D, 5853, 1},
+		{0x212F, 5854, 1},
+		{0x2130, 5855, 1},
+		{0x2131, 5856, 1},
+		{0x2133, 5857, 1},
+		{0x2134, 5858, 1},
+		{0x2135, 5859, 1},
+		{0x2136, 5860, 1},
+		{0x2137, 5861, 1},
+		{0x2138, 5862, 1},
+		{0x2139, 5863, 1},
+		{0x213B, 5864, 3},
+		{0x213C, 5867, 1},
+		{0x213D, 5868, 1},
+		{0x213E, 5869, 1},
+		{0x213F, 5870, 1},
+		{0x2140, 5871, 1},
+		{0x2145, 5872, 1},
+		{0x2146, 5873, 1},
+		{0x2147, 5874, 1},
+		{0x2148, 5875, 1},
+		{0x2149, 5876, 1},
+		{0x2150, 5877, 3},
+		{0x2151, 5880, 3},
+		{0x2152, 5883, 4},
+		{0x2153, 5887, 3},
+		{0x2154, 5890, 3},
+		{0x2155, 5893, 3},
+		{0x2156, 5896, 3},
+		{0x2157, 5899, 3},
+		{0x2158, 5902, 3},
+		{0x2159, 5905, 3},
+		{0x215A, 5908, 3},
+		{0x215B, 5911, 3},
+		{0x215C, 5914, 3},
+		{0x215D, 5917, 3},
+		{0x215E, 5920, 3},
+		{0x215F, 5923, 2},
+		{0x2160, 5925, 1},
+		{0x2161, 5926, 2},
+		{0x2162, 5928, 3},
+		{0x2163, 5931, 2},
+		{0x2164, 5933, 1},
+		{0x2165, 5934, 2},
+		{0x2166, 5936, 3},
+		{0x2167, 5939, 4},
+		{0x2168, 5943, 2},
+		{0x2169, 5945, 1},
+		{0x216A, 5946, 2},
+		{0x216B, 5948, 3},
+		{0x216C, 5951, 1},
+		{0x216D, 5952, 1},
+		{0x216E, 5953, 1},
+		{0x216F, 5954, 1},
+		{0x2170, 5955, 1},
+		{0x2171, 5956, 2},
+		{0x2172, 5958, 3},
+		{0x2173, 5961, 2},
+		{0x2174, 5963, 1},
+		{0x2175, 5964, 2},
+		{0x2176, 5966, 3},
+		{0x2177, 5969, 4},
+		{0x2178, 5973, 2},
+		{0x2179, 5975, 1},
+		{0x217A, 5976, 2},
+		{0x217B, 5978, 3},
+		{0x217C, 5981, 1},
+		{0x217D, 5982, 1},
+		{0x217E, 5983, 1},
+		{0x217F, 5984, 1},
+		{0x2189, 5985, 3},
+		{0x219A, 5988, 2},
+		{0x219B, 5990, 2},
+		{0x21AE, 5992, 2},
+		{0x21CD, 5994, 2},
+		{0x21CE, 5996, 2},
+		{0x21CF, 5998, 2},
+		{0x2204, 6000, 2},
+		{0x2209, 6002, 2},
+		{0x220C, 6004, 2},
+		{0x2224, 6006, 2},
+		{0x2226, 6008, 2},
+		{0x222C, 6010, 2},
+		{0x222D, 6012, 3},
+		{0x222F, 6015, 2},
+		{0x2230, 6017, 3},
+		{0x2241, 6020, 2},
+		{0x2244, 6022, 2},
+		{0x2247, 6024, 2},
+		{0x2249, 6026, 2},
+		{0x2260, 6028, 2},
+		{0x2262, 6030, 2},
+		{0x226D, 6032, 2},
+		{0x226E, 6034, 2},
+		{0x226F, 6036, 2},
+		{0x2270, 6038, 2},
+		{0x2271, 6040, 2},
+		{0x2274, 6042, 2},
+		{0x2275, 6044, 2},
+		{0x2278, 6046, 2},
+		{0x2279, 6048, 2},
+		{0x2280, 6050, 2},
+		{0x2281, 6052, 2},
+		{0x2284, 6054, 2},
+		{0x2285, 6056, 2},
+		{0x2288, 6058, 2},
+		{0x2289, 6060, 2},
+		{0x22AC, 6062, 2},
+		{0x22AD, 6064, 2},
+		{0x22AE, 6066, 2},
+		{0x22AF, 6068, 2},
+		{0x22E0, 6070, 2},
+		{0x22E1, 6072, 2},
+		{0x22E2, 6074, 2},
+		{0x22E3, 6076, 2},
+		{0x22EA, 6078, 2},
+		{0x22EB, 6080, 2},
+		{0x22EC, 6082, 2},
+		{0x22ED, 6084, 2},
+		{0x2329, 6086, 1},
+		{0x232A, 6087, 1},
+		{0x2460, 6088, 1},
+		{0x2461, 6089, 1},
+		{0x2462, 6090, 1},
+		{0x2463, 6091, 1},
+		{0x2464, 6092, 1},
+		{0x2465, 6093, 1},
+		{0x2466, 6094, 1},
+		{0x2467, 6095, 1},
+		{0x2468, 6096, 1},
+		{0x2469, 6097, 2},
+		{0x246A, 6099, 2},
+		{0x246B, 6101, 2},
+		{0x246C, 6103, 2},
+		{0x246D, 6105, 2},
+		{0x246E, 6107, 2},
+		{0x246F, 6109, 2},
+		{0x2470, 6111, 2},
+		{0x2471, 6113, 2},
+		{0x2472, 6115, 2},
+		{0x2473, 6117, 2},
+		{0x2474, 6119, 3},
+		{0x2475, 6122, 3},
+		{0x2476, 6125, 3},
+		{0x2477, 6128, 3},
+		{0x2478, 6131, 3},
+		{0x2479, 6134, 3},
+		{0x247A, 6137, 3},
+		{0x247B, 6140, 3},
+		{0x247C, 6143, 3},
+		{0x247D, 6146, 4},
+		{0x247E, 6150, 4},
+		{0x247F, 6154, 4},
+		{0x2480, 6158, 4},
+		{0x2481, 6162, 4},
+		{0x2482, 6166, 4},
+		{0x2483, 6170, 4},
+		{0x2484, 6174, 4},
+		{0x2485, 6178, 4},
+		{0x2486, 6182, 4},
+		{0x2487, 6186, 4},
+		{0x2488, 6190, 2},
+		{0x2489, 6192, 2},
+		{0x248A, 6194, 2},
+		{0x248B, 6196, 2},
+		{0x248C, 6198, 2},
+		{0x248D, 6200, 2},
+		{0x248E, 6202, 2},
+		{0x248F, 6204, 2},
+		{0x2490, 6206, 2},
+		{0x2491, 6208, 3},
+		{0x2492, 6211, 3},
+		{0x2493, 6214, 3},
+		{0x2494, 6217, 3},
+		{0x2495, 6220, 3},
+		{0x2496, 6223, 3},
+		{0x2497, 6226, 3},
+		{0x2498, 6229, 3},
+		{0x2499, 6232, 3},
+		{0x249A, 6235, 3},
+		{0x249B, 6238, 3},
+		{0x249C, 6241, 3},
+		{0x249D, 6244, 3},
+		{0x249E, 6247, 3},
+		{0x249F, 6250, 3},
+		{0x24A0, 6253, 3},
+		{0x24A1, 6256, 3},
+		{0x24A2, 6259, 3},
+		{0x24A3, 6262, 3},
+		{0x24A4, 6265, 3},
+		{0x24A5, 6268, 3},
+		{0x24A6, 6271, 3},
+		{0x24A7, 6274, 3},
+		{0x24A8, 6277, 3},
+		{0x24A9, 6280, 3},
+		{0x24AA, 6283, 3},
+		{0x24AB, 6286, 3},
+		{0x24AC, 6289, 3},
+		{0x24AD, 6292, 3},
+		{0x24AE, 6295, 3},
+		{0x24AF, 6298, 3},
+		{0x24B0, 6301, 3},
+		{0x24B1, 6304, 3},
+		{0x24B2, 6307, 3},
+		{0x24B3, 6310, 3},
+		{0x24B4, 6313, 3},
+		{0x24B5, 6316, 3},
+		{0x24B6, 6319, 1},
+		{0x24B7, 6320, 1},
+		{0x24B8, 6321, 1},
+		{0x24B9, 6322, 1},
+		{0x24BA, 6323, 1},
+		{0x24BB, 6324, 1},
+		{0x24BC, 6325, 1},
+		{0x24BD, 6326, 1},
+		{0x24BE, 6327, 1},
+		{0x24BF, 6328, 1},
+		{0x24C0, 6329, 1},
+		{0x24C1, 6330, 1},
+		{0x24C2, 6331, 1},
+		{0x24C3, 6332, 1},
+		{0x24C4, 6333, 1},
+		{0x24C5, 6334, 1},
+		{0x24C6, 6335, 1},
+		{0x24C7, 6336, 1},
+		{0x24C8, 6337, 1},
+		{0x24C9, 6338, 1},
+		{0x24CA, 6339, 1},
+		{0x24CB, 6340, 1},
+		{0x24CC, 6341, 1},
+		{0x24CD, 6342, 1},
+		{0x24CE, 6343, 1},
+		{0x24CF, 6344, 1},
+		{0x24D0, 6345, 1},
+		{0x24D1, 6346, 1},
+		{0x24D2, 6347, 1},
+		{0x24D3, 6348, 1},
+		{0x24D4, 6349, 1},
+		{0x24D5, 6350, 1},
+		{0x24D6, 6351, 1},
+		{0x24D7, 6352, 1},
+		{0x24D8, 6353, 1},
+		{0x24D9, 6354, 1},
+		{0x24DA, 6355, 1},
+		{0x24DB, 6356, 1},
+		{0x24DC, 6357, 1},
+		{0x24DD, 6358, 1},
+		{0x24DE, 6359, 1},
+		{0x24DF, 6360, 1},
+		{0x24E0, 6361, 1},
+		{0x24E1, 6362, 1},
+		{0x24E2, 6363, 1},
+		{0x24E3, 6364, 1},
+		{0x24E4, 6365, 1},
+		{0x24E5, 6366, 1},
+		{0x24E6, 6367, 1},
+		{0x24E7, 6368, 1},
+		{0x24E8, 6369, 1},
+		{0x24E9, 6370, 1},
+		{0x24EA, 6371, 1},
+		{0x2A0C, 6372, 4},
+		{0x2A74, 6376, 3},
+		{0x2A75, 6379, 2},
+		{0x2A76, 6381, 3},
+		{0x2ADC, 6384, 2},
+		{0x2C7C, 6386, 1},
+		{0x2C7D, 6387, 1},
+		{0x2D6F, 6388, 1},
+		{0x2E9F, 6389, 1},
+		{0x2EF3, 6390, 1},
+		{0x2F00, 6391, 1},
+		{0x2F01, 6392, 1},
+		{0x2F02, 6393, 1},
+		{0x2F03, 6394, 1},
+		{0x2F04, 6395, 1},
+		{0x2F05, 6396, 1},
+		{0x2F06, 6397, 1},
+		{0x2F07, 6398, 1},
+		{0x2F08, 6399, 1},
+		{0x2F09, 6400, 1},
+		{0x2F0A, 6401, 1},
+		{0x2F0B, 6402, 1},
+		{0x2F0C, 6403, 1},
+		{0x2F0D, 6404, 1},
+		{0x2F0E, 6405, 1},
+		{0x2F0F, 6406, 1},
+		{0x2F10, 6407, 1},
+		{0x2F11, 6408, 1},
+		{0x2F12, 6409, 1},
+		{0x2F13, 6410, 1},
+		{0x2F14, 6411, 1},
+		{0x2F15, 6412, 1},
+		{0x2F16, 6413, 1},
+		{0x2F17, 6414, 1},
+		{0x2F18, 6415, 1},
+		{0x2F19, 6416, 1},
+		{0x2F1A, 6417, 1},
+		{0x2F1B, 6418, 1},
+		{0x2F1C, 6419, 1},
+		{0x2F1D, 6420, 1},
+		{0x2F1E, 6421, 1},
+		{0x2F1F, 6422, 1},
+		{0x2F20, 6423, 1},
+		{0x2F21, 6424, 1},
+		{0x2F22, 6425, 1},
+		{0x2F23, 6426, 1},
+		{0x2F24, 6427, 1},
+		{0x2F25, 6428, 1},
+		{0x2F26, 6429, 1},
+		{0x2F27, 6430, 1},
+		{0x2F28, 6431, 1},
+		{0x2F29, 6432, 1},
+		{0x2F2A, 6433, 1},
+		{0x2F2B, 6434, 1},
+		{0x2F2C, 6435, 1},
+		{0x2F2D, 6436, 1},
+		{0x2F2E, 6437, 1},
+		{0x2F2F, 6438, 1},
+		{0x2F30, 6439, 1},
+		{0x2F31, 6440, 1},
+		{0x2F32, 6441, 1},
+		{0x2F33, 6442, 1},
+		{0x2F34, 6443, 1},
+		{0x2F35, 6444, 1},
+		{0x2F36, 6445, 1},
+		{0x2F37, 6446, 1},
+		{0x2F38, 6447, 1},
+		{0x2F39, 6448, 1},
+		{0x2F3A, 6449, 1},
+		{0x2F3B, 6450, 1},
+		{0x2F3C, 6451, 1},
+		{0x2F3D, 6452, 1},
+		{0x2F3E, 6453, 1},
+		{0x2F3F, 6454, 1},
+		{0x2F40, 6455, 1},
+		{0x2F41, 6456, 1},
+		{0x2F42, 6457, 1},
+		{0x2F43, 6458, 1},
+		{0x2F44, 6459, 1},
+		{0x2F45, 6460, 1},
+		{0x2F46, 6461, 1},
+		{0x2F47, 6462, 1},
+		{0x2F48, 6463, 1},
+		{0x2F49, 6464, 1},
+		{0x2F4A, 6465, 1},
+		{0x2F4B, 6466, 1},
+		{0x2F4C, 6467, 1},
+		{0x2F4D, 6468, 1},
+		{0x2F4E, 6469, 1},
+		{0x2F4F, 6470, 1},
+		{0x2F50, 6471, 1},
+		{0x2F51, 6472, 1},
+		{0x2F52, 6473, 1},
+		{0x2F53, 6474, 1},
+		{0x2F54, 6475, 1},
+		{0x2F55, 6476, 1},
+		{0x2F56, 6477, 1},
+		{0x2F57, 6478, 1},
+		{0x2F58, 6479, 1},
+		{0x2F59, 6480, 1},
+		{0x2F5A, 6481, 1},
+		{0x2F5B, 6482, 1},
+		{0x2F5C, 6483, 1},
+		{0x2F5D, 6484, 1},
+		{0x2F5E, 6485, 1},
+		{0x2F5F, 6486, 1},
+		{0x2F60, 6487, 1},
+		{0x2F61, 6488, 1},
+		{0x2F62, 6489, 1},
+		{0x2F63, 6490, 1},
+		{0x2F64, 6491, 1},
+		{0x2F65, 6492, 1},
+		{0x2F66, 6493, 1},
+		{0x2F67, 6494, 1},
+		{0x2F68, 6495, 1},
+		{0x2F69, 6496, 1},
+		{0x2F6A, 6497, 1},
+		{0x2F6B, 6498, 1},
+		{0x2F6C, 6499, 1},
+		{0x2F6D, 6500, 1},
+		{0x2F6E, 6501, 1},
+		{0x2F6F, 6502, 1},
+		{0x2F70, 6503, 1},
+		{0x2F71, 6504, 1},
+		{0x2F72, 6505, 1},
+		{0x2F73, 6506, 1},
+		{0x2F74, 6507, 1},
+		{0x2F75, 6508, 1},
+		{0x2F76, 6509, 1},
+		{0x2F77, 6510, 1},
+		{0x2F78, 6511, 1},
+		{0x2F79, 6512, 1},
+		{0x2F7A, 6513, 1},
+		{0x2F7B, 6514, 1},
+		{0x2F7C, 6515, 1},
+		{0x2F7D, 6516, 1},
+		{0x2F7E, 6517, 1},
+		{0x2F7F, 6518, 1},
+		{0x2F80, 6519, 1},
+		{0x2F81, 6520, 1},
+		{0x2F82, 6521, 1},
+		{0x2F83, 6522, 1},
+		{0x2F84, 6523, 1},
+		{0x2F85, 6524, 1},
+		{0x2F86, 6525, 1},
+		{0x2F87, 6526, 1},
+		{0x2F88, 6527, 1},
+		{0x2F89, 6528, 1},
+		{0x2F8A, 6529, 1},
+		{0x2F8B, 6530, 1},
+		{0x2F8C, 6531, 1},
+		{0x2F8D, 6532, 1},
+		{0x2F8E, 6533, 1},
+		{0x2F8F, 6534, 1},
+		{0x2F90, 6535, 1},
+		{0x2F91, 6536, 1},
+		{0x2F92, 6537, 1},
+		{0x2F93, 6538, 1},
+		{0x2F94, 6539, 1},
+		{0x2F95, 6540, 1},
+		{0x2F96, 6541, 1},
+		{0x2F97, 6542, 1},
+		{0x2F98, 6543, 1},
+		{0x2F99, 6544, 1},
+		{0x2F9A, 6545, 1},
+		{0x2F9B, 6546, 1},
+		{0x2F9C, 6547, 1},
+		{0x2F9D, 6548, 1},
+		{0x2F9E, 6549, 1},
+		{0x2F9F, 6550, 1},
+		{0x2FA0, 6551, 1},
+		{0x2FA1, 6552, 1},
+		{0x2FA2, 6553, 1},
+		{0x2FA3, 6554, 1},
+		{0x2FA4, 6555, 1},
+		{0x2FA5, 6556, 1},
+		{0x2FA6, 6557, 1},
+		{0x2FA7, 6558, 1},
+		{0x2FA8, 6559, 1},
+		{0x2FA9, 6560, 1},
+		{0x2FAA, 6561, 1},
+		{0x2FAB, 6562, 1},
+		{0x2FAC, 6563, 1},
+		{0x2FAD, 6564, 1},
+		{0x2FAE, 6565, 1},
+		{0x2FAF, 6566, 1},
+		{0x2FB0, 6567, 1},
+		{0x2FB1, 6568, 1},
+		{0x2FB2, 6569, 1},
+		{0x2FB3, 6570, 1},
+		{0x2FB4, 6571, 1},
+		{0x2FB5, 6572, 1},
+		{0x2FB6, 6573, 1},
+		{0x2FB7, 6574, 1},
+		{0x2FB8, 6575, 1},
+		{0x2FB9, 6576, 1},
+		{0x2FBA, 6577, 1},
+		{0x2FBB, 6578, 1},
+		{0x2FBC, 6579, 1},
+		{0x2FBD, 6580, 1},
+		{0x2FBE, 6581, 1},
+		{0x2FBF, 6582, 1},
+		{0x2FC0, 6583, 1},
+		{0x2FC1, 6584, 1},
+		{0x2FC2, 6585, 1},
+		{0x2FC3, 6586, 1},
+		{0x2FC4, 6587, 1},
+		{0x2FC5, 6588, 1},
+		{0x2FC6, 6589, 1},
+		{0x2FC7, 6590, 1},
+		{0x2FC8, 6591, 1},
+		{0x2FC9, 6592, 1},
+		{0x2FCA, 6593, 1},
+		{0x2FCB, 6594, 1},
+		{0x2FCC, 6595, 1},
+		{0x2FCD, 6596, 1},
+		{0x2FCE, 6597, 1},
+		{0x2FCF, 6598, 1},
+		{0x2FD0, 6599, 1},
+		{0x2FD1, 6600, 1},
+		{0x2FD2, 6601, 1},
+		{0x2FD3, 6602, 1},
+		{0x2FD4, 6603, 1},
+		{0x2FD5, 6604, 1},
+		{0x3000, 6605, 1},
+		{0x3036, 6606, 1},
+		{0x3038, 6607, 1},
+		{0x3039, 6608, 1},
+		{0x303A, 6609, 1},
+		{0x304C, 6610, 2},
+		{0x304E, 6612, 2},
+		{0x3050, 6614, 2},
+		{0x3052, 6616, 2},
+		{0x3054, 6618, 2},
+		{0x3056, 6620, 2},
+		{0x3058, 6622, 2},
+		{0x305A, 6624, 2},
+		{0x305C, 6626, 2},
+		{0x305E, 6628, 2},
+		{0x3060, 6630, 2},
+		{0x3062, 6632, 2},
+		{0x3065, 6634, 2},
+		{0x3067, 6636, 2},
+		{0x3069, 6638, 2},
+		{0x3070, 6640, 2},
+		{0x3071, 6642, 2},
+		{0x3073, 6644, 2},
+		{0x3074, 6646, 2},
+		{0x3076, 6648, 2},
+		{0x3077, 6650, 2},
+		{0x3079, 6652, 2},
+		{0x307A, 6654, 2},
+		{0x307C, 6656, 2},
+		{0x307D, 6658, 2},
+		{0x3094, 6660, 2},
+		{0x309B, 6662, 2},
+		{0x309C, 6664, 2},
+		{0x309E, 6666, 2},
+		{0x309F, 6668, 2},
+		{0x30AC, 6670, 2},
+		{0x30AE, 6672, 2},
+		{0x30B0, 6674, 2},
+		{0x30B2, 6676, 2},
+		{0x30B4, 6678, 2},
+		{0x30B6, 6680, 2},
+		{0x30B8, 6682, 2},
+		{0x30BA, 6684, 2},
+		{0x30BC, 6686, 2},
+		{0x30BE, 6688, 2},
+		{0x30C0, 6690, 2},
+		{0x30C2, 6692, 2},
+		{0x30C5, 6694, 2},
+		{0x30C7, 6696, 2},
+		{0x30C9, 6698, 2},
+		{0x30D0, 6700, 2},
+		{0x30D1, 6702, 2},
+		{0x30D3, 6704, 2},
+		{0x30D4, 6706, 2},
+		{0x30D6, 6708, 2},
+		{0x30D7, 6710, 2},
+		{0x30D9, 6712, 2},
+		{0x30DA, 6714, 2},
+		{0x30DC, 6716, 2},
+		{0x30DD, 6718, 2},
+		{0x30F4, 6720, 2},
+		{0x30F7, 6722, 2},
+		{0x30F8, 6724, 2},
+		{0x30F9, 6726, 2},
+		{0x30FA, 6728, 2},
+		{0x30FE, 6730, 2},
+		{0x30FF, 6732, 2},
+		{0x3131, 6734, 1},
+		{0x3132, 6735, 1},
+		{0x3133, 6736, 1},
+		{0x3134, 6737, 1},
+		{0x3135, 6738, 1},
+		{0x3136, 6739, 1},
+		{0x3137, 6740, 1},
+		{0x3138, 6741, 1},
+		{0x3139, 6742, 1},
+		{0x313A, 6743, 1},
+		{0x313B, 6744, 1},
+		{0x313C, 6745, 1},
+		{0x313D, 6746, 1},
+		{0x313E, 6747, 1},
+		{0x313F, 6748, 1},
+		{0x3140, 6749, 1},
+		{0x3141, 6750, 1},
+		{0x3142, 6751, 1},
+		{0x3143, 6752, 1},
+		{0x3144, 6753, 1},
+		{0x3145, 6754, 1},
+		{0x3146, 6755, 1},
+		{0x3147, 6756, 1},
+		{0x3148, 6757, 1},
+		{0x3149, 6758, 1},
+		{0x314A, 6759, 1},
+		{0x314B, 6760, 1},
+		{0x314C, 6761, 1},
+		{0x314D, 6762, 1},
+		{0x314E, 6763, 1},
+		{0x314F, 6764, 1},
+		{0x3150, 6765, 1},
+		{0x3151, 6766, 1},
+		{0x3152, 6767, 1},
+		{0x3153, 6768, 1},
+		{0x3154, 6769, 1},
+		{0x3155, 6770, 1},
+		{0x3156, 6771, 1},
+		{0x3157, 6772, 1},
+		{0x3158, 6773, 1},
+		{0x3159, 6774, 1},
+		{0x315A, 6775, 1},
+		{0x315B, 6776, 1},
+		{0x315C, 6777, 1},
+		{0x315D, 6778, 1},
+		{0x315E, 6779, 1},
+		{0x315F, 6780, 1},
+		{0x3160, 6781, 1},
+		{0x3161, 6782, 1},
+		{0x3162, 6783, 1},
+		{0x3163, 6784, 1},
+		{0x3164, 6785, 1},
+		{0x3165, 6786, 1},
+		{0x3166, 6787, 1},
+		{0x3167, 6788, 1},
+		{0x3168, 6789, 1},
+		{0x3169, 6790, 1},
+		{0x316A, 6791, 1},
+		{0x316B, 6792, 1},
+		{0x316C, 6793, 1},
+		{0x316D, 6794, 1},
+		{0x316E, 6795, 1},
+		{0x316F, 6796, 1},
+		{0x3170, 6797, 1},
+		{0x3171, 6798, 1},
+		{0x3172, 6799, 1},
+		{0x3173, 6800, 1},
+		{0x3174, 6801, 1},
+		{0x3175, 6802, 1},
+		{0x3176, 6803, 1},
+		{0x3177, 6804, 1},
+		{0x3178, 6805, 1},
+		{0x3179, 6806, 1},
+		{0x317A, 6807, 1},
+		{0x317B, 6808, 1},
+		{0x317C, 6809, 1},
+		{0x317D, 6810, 1},
+		{0x317E, 6811, 1},
+		{0x317F, 6812, 1},
+		{0x3180, 6813, 1},
+		{0x3181, 6814, 1},
+		{0x3182, 6815, 1},
+		{0x3183, 6816, 1},
+		{0x3184, 6817, 1},
+		{0x3185, 6818, 1},
+		{0x3186, 6819, 1},
+		{0x3187, 6820, 1},
+		{0x3188, 6821, 1},
+		{0x3189, 6822, 1},
+		{0x318A, 6823, 1},
+		{0x318B, 6824, 1},
+		{0x318C, 6825, 1},
+		{0x318D, 6826, 1},
+		{0x318E, 6827, 1},
+		{0x3192, 6828, 1},
+		{0x3193, 6829, 1},
+		{0x3194, 6830, 1},
+		{0x3195, 6831, 1},
+		{0x3196, 6832, 1},
+		{0x3197, 6833, 1},
+		{0x3198, 6834, 1},
+		{0x3199, 6835, 1},
+		{0x319A, 6836, 1},
+		{0x319B, 6837, 1},
+		{0x319C, 6838, 1},
+		{0x319D, 6839, 1},
+		{0x319E, 6840, 1},
+		{0x319F, 6841, 1},
+		{0x3200, 6842, 3},
+		{0x3201, 6845, 3},
+		{0x3202, 6848, 3},
+		{0x3203, 6851, 3},
+		{0x3204, 6854, 3},
+		{0x3205, 6857, 3},
+		{0x3206, 6860, 3},
+		{0x3207, 6863, 3},
+		{0x3208, 6866, 3},
+		{0x3209, 6869, 3},
+		{0x320A, 6872, 3},
+		{0x320B, 6875, 3},
+		{0x320C, 6878, 3},
+		{0x320D, 6881, 3},
+		{0x320E, 6884, 4},
+		{0x320F, 6888, 4},
+		{0x3210, 6892, 4},
+		{0x3211, 6896, 4},
+		{0x3212, 6900, 4},
+		{0x3213, 6904, 4},
+		{0x3214, 6908, 4},
+		{0x3215, 6912, 4},
+		{0x3216, 6916, 4},
+		{0x3217, 6920, 4},
+		{0x3218, 6924, 4},
+		{0x3219, 6928, 4},
+		{0x321A, 6932, 4},
+		{0x321B, 6936, 4},
+		{0x321C, 6940, 4},
+		{0x321D, 6944, 7},
+		{0x321E, 6951, 6},
+		{0x3220, 6957, 3},
+		{0x3221, 6960, 3},
+		{0x3222, 6963, 3},
+		{0x3223, 6966, 3},
+		{0x3224, 6969, 3},
+		{0x3225, 6972, 3},
+		{0x3226, 6975, 3},
+		{0x3227, 6978, 3},
+		{0x3228, 6981, 3},
+		{0x3229, 6984, 3},
+		{0x322A, 6987, 3},
+		{0x322B, 6990, 3},
+		{0x322C, 6993, 3},
+		{0x322D, 6996, 3},
+		{0x322E, 6999, 3},
+		{0x322F, 7002, 3},
+		{0x3230, 7005, 3},
+		{0x3231, 7008, 3},
+		{0x3232, 7011, 3},
+		{0x3233, 7014, 3},
+		{0x3234, 7017, 3},
+		{0x3235, 7020, 3},
+		{0x3236, 7023, 3},
+		{0x3237, 7026, 3},
+		{0x3238, 7029, 3},
+		{0x3239, 7032, 3},
+		{0x323A, 7035, 3},
+		{0x323B, 7038, 3},
+		{0x323C, 7041, 3},
+		{0x323D, 7044, 3},
+		{0x323E, 7047, 3},
+		{0x323F, 7050, 3},
+		{0x3240, 7053, 3},
+		{0x3241, 7056, 3},
+		{0x3242, 7059, 3},
+		{0x3243, 7062, 3},
+		{0x3244, 7065, 1},
+		{0x3245, 7066, 1},
+		{0x3246, 7067, 1},
+		{0x3247, 7068, 1},
+		{0x3250, 7069, 3},
+		{0x3251, 7072, 2},
+		{0x3252, 7074, 2},
+		{0x3253, 7076, 2},
+		{0x3254, 7078, 2},
+		{0x3255, 7080, 2},
+		{0x3256, 7082, 2},
+		{0x3257, 7084, 2},
+		{0x3258, 7086, 2},
+		{0x3259, 7088, 2},
+		{0x325A, 7090, 2},
+		{0x325B, 7092, 2},
+		{0x325C, 7094, 2},
+		{0x325D, 7096, 2},
+		{0x325E, 7098, 2},
+		{0x325F, 7100, 2},
+		{0x3260, 7102, 1},
+		{0x3261, 7103, 1},
+		{0x3262, 7104, 1},
+		{0x3263, 7105, 1},
+		{0x3264, 7106, 1},
+		{0x3265, 7107, 1},
+		{0x3266, 7108, 1},
+		{0x3267, 7109, 1},
+		{0x3268, 7110, 1},
+		{0x3269, 7111, 1},
+		{0x326A, 7112, 1},
+		{0x326B, 7113, 1},
+		{0x326C, 7114, 1},
+		{0x326D, 7115, 1},
+		{0x326E, 7116, 2},
+		{0x326F, 7118, 2},
+		{0x3270, 7120, 2},
+		{0x3271, 7122, 2},
+		{0x3272, 7124, 2},
+		{0x3273, 7126, 2},
+		{0x3274, 7128, 2},
+		{0x3275, 7130, 2},
+		{0x3276, 7132, 2},
+		{0x3277, 7134, 2},
+		{0x3278, 7136, 2},
+		{0x3279, 7138, 2},
+		{0x327A, 7140, 2},
+		{0x327B, 7142, 2},
+		{0x327C, 7144, 5},
+		{0x327D, 7149, 4},
+		{0x327E, 7153, 2},
+		{0x3280, 7155, 1},
+		{0x3281, 7156, 1},
+		{0x3282, 7157, 1},
+		{0x3283, 7158, 1},
+		{0x3284, 7159, 1},
+		{0x3285, 7160, 1},
+		{0x3286, 7161, 1},
+		{0x3287, 7162, 1},
+		{0x3288, 7163, 1},
+		{0x3289, 7164, 1},
+		{0x328A, 7165, 1},
+		{0x328B, 7166, 1},
+		{0x328C, 7167, 1},
+		{0x328D, 7168, 1},
+		{0x328E, 7169, 1},
+		{0x328F, 7170, 1},
+		{0x3290, 7171, 1},
+		{0x3291, 7172, 1},
+		{0x3292, 7173, 1},
+		{0x3293, 7174, 1},
+		{0x3294, 7175, 1},
+		{0x3295, 7176, 1},
+		{0x3296, 7177, 1},
+		{0x3297, 7178, 1},
+		{0x3298, 7179, 1},
+		{0x3299, 7180, 1},
+		{0x329A, 7181, 1},
+		{0x329B, 7182, 1},
+		{0x329C, 7183, 1},
+		{0x329D, 7184, 1},
+		{0x329E, 7185, 1},
+		{0x329F, 7186, 1},
+		{0x32A0, 7187, 1},
+		{0x32A1, 7188, 1},
+		{0x32A2, 7189, 1},
+		{0x32A3, 7190, 1},
+		{0x32A4, 7191, 1},
+		{0x32A5, 7192, 1},
+		{0x32A6, 7193, 1},
+		{0x32A7, 7194, 1},
+		{0x32A8, 7195, 1},
+		{0x32A9, 7196, 1},
+		{0x32AA, 7197, 1},
+		{0x32AB, 7198, 1},
+		{0x32AC, 7199, 1},
+		{0x32AD, 7200, 1},
+		{0x32AE, 7201, 1},
+		{0x32AF, 7202, 1},
+		{0x32B0, 7203, 1},
+		{0x32B1, 7204, 2},
+		{0x32B2, 7206, 2},
+		{0x32B3, 7208, 2},
+		{0x32B4, 7210, 2},
+		{0x32B5, 7212, 2},
+		{0x32B6, 7214, 2},
+		{0x32B7, 7216, 2},
+		{0x32B8, 7218, 2},
+		{0x32B9, 7220, 2},
+		{0x32BA, 7222, 2},
+		{0x32BB, 7224, 2},
+		{0x32BC, 7226, 2},
+		{0x32BD, 7228, 2},
+		{0x32BE, 7230, 2},
+		{0x32BF, 7232, 2},
+		{0x32C0, 7234, 2},
+		{0x32C1, 7236, 2},
+		{0x32C2, 7238, 2},
+		{0x32C3, 7240, 2},
+		{0x32C4, 7242, 2},
+		{0x32C5, 7244, 2},
+		{0x32C6, 7246, 2},
+		{0x32C7, 7248, 2},
+		{0x32C8, 7250, 2},
+		{0x32C9, 7252, 3},
+		{0x32CA, 7255, 3},
+		{0x32CB, 7258, 3},
+		{0x32CC, 7261, 2},
+		{0x32CD, 7263, 3},
+		{0x32CE, 7266, 2},
+		{0x32CF, 7268, 3},
+		{0x32D0, 7271, 1},
+		{0x32D1, 7272, 1},
+		{0x32D2, 7273, 1},
+		{0x32D3, 7274, 1},
+		{0x32D4, 7275, 1},
+		{0x32D5, 7276, 1},
+		{0x32D6, 7277, 1},
+		{0x32D7, 7278, 1},
+		{0x32D8, 7279, 1},
+		{0x32D9, 7280, 1},
+		{0x32DA, 7281, 1},
+		{0x32DB, 7282, 1},
+		{0x32DC, 7283, 1},
+		{0x32DD, 7284, 1},
+		{0x32DE, 7285, 1},
+		{0x32DF, 7286, 1},
+		{0x32E0, 7287, 1},
+		{0x32E1, 7288, 1},
+		{0x32E2, 7289, 1},
+		{0x32E3, 7290, 1},
+		{0x32E4, 7291, 1},
+		{0x32E5, 7292, 1},
+		{0x32E6, 7293, 1},
+		{0x32E7, 7294, 1},
+		{0x32E8, 7295, 1},
+		{0x32E9, 7296, 1},
+		{0x32EA, 7297, 1},
+		{0x32EB, 7298, 1},
+		{0x32EC, 7299, 1},
+		{0x32ED, 7300, 1},
+		{0x32EE, 7301, 1},
+		{0x32EF, 7302, 1},
+		{0x32F0, 7303, 1},
+		{0x32F1, 7304, 1},
+		{0x32F2, 7305, 1},
+		{0x32F3, 7306, 1},
+		{0x32F4, 7307, 1},
+		{0x32F5, 7308, 1},
+		{0x32F6, 7309, 1},
+		{0x32F7, 7310, 1},
+		{0x32F8, 7311, 1},
+		{0x32F9, 7312, 1},
+		{0x32FA, 7313, 1},
+		{0x32FB, 7314, 1},
+		{0x32FC, 7315, 1},
+		{0x32FD, 7316, 1},
+		{0x32FE, 7317, 1},
+		{0x32FF, 7318, 2},
+		{0x3300, 7320, 5},
+		{0x3301, 7325, 4},
+		{0x3302, 7329, 5},
+		{0x3303, 7334, 3},
+		{0x3304, 7337, 5},
+		{0x3305, 7342, 3},
+		{0x3306, 7345, 3},
+		{0x3307, 7348, 6},
+		{0x3308, 7354, 4},
+		{0x3309, 7358, 3},
+		{0x330A, 7361, 3},
+		{0x330B, 7364, 3},
+		{0x330C, 7367, 4},
+		{0x330D, 7371, 4},
+		{0x330E, 7375, 4},
+		{0x330F, 7379, 4},
+		{0x3310, 7383, 4},
+		{0x3311, 7387, 4},
+		{0x3312, 7391, 4},
+		{0x3313, 7395, 6},
+		{0x3314, 7401, 2},
+		{0x3315, 7403, 6},
+		{0x3316, 7409, 6},
+		{0x3317, 7415, 5},
+		{0x3318, 7420, 4},
+		{0x3319, 7424, 6},
+		{0x331A, 7430, 6},
+		{0x331B, 7436, 4},
+		{0x331C, 7440, 3},
+		{0x331D, 7443, 3},
+		{0x331E, 7446, 4},
+		{0x331F, 7450, 4},
+		{0x3320, 7454, 5},
+		{0x3321, 7459, 5},
+		{0x3322, 7464, 3},
+		{0x3323, 7467, 3},
+		{0x3324, 7470, 4},
+		{0x3325, 7474, 3},
+		{0x3326, 7477, 3},
+		{0x3327, 7480, 2},
+		{0x3328, 7482, 2},
+		{0x3329, 7484, 3},
+		{0x332A, 7487, 3},
+		{0x332B, 7490, 6},
+		{0x332C, 7496, 4},
+		{0x332D, 7500, 5},
+		{0x332E, 7505, 6},
+		{0x332F, 7511, 4},
+		{0x3330, 7515, 3},
+		{0x3331, 7518, 3},
+		{0x3332, 7521, 6},
+		{0x3333, 7527, 4},
+		{0x3334, 7531, 6},
+		{0x3335, 7537, 3},
+		{0x3336, 7540, 5},
+		{0x3337, 7545, 3},
+		{0x3338, 7548, 4},
+		{0x3339, 7552, 3},
+		{0x333A, 7555, 4},
+		{0x333B, 7559, 5},
+		{0x333C, 7564, 4},
+		{0x333D, 7568, 5},
+		{0x333E, 7573, 4},
+		{0x333F, 7577, 2},
+		{0x3340, 7579, 5},
+		{0x3341, 7584, 3},
+		{0x3342, 7587, 3},
+		{0x3343, 7590, 4},
+		{0x3344, 7594, 3},
+		{0x3345, 7597, 3},
+		{0x3346, 7600, 3},
+		{0x3347, 7603, 5},
+		{0x3348, 7608, 4},
+		{0x3349, 7612, 2},
+		{0x334A, 7614, 6},
+		{0x334B, 7620, 3},
+		{0x334C, 7623, 5},
+		{0x334D, 7628, 4},
+		{0x334E, 7632, 4},
+		{0x334F, 7636, 3},
+		{0x3350, 7639, 3},
+		{0x3351, 7642, 4},
+		{0x3352, 7646, 2},
+		{0x3353, 7648, 4},
+		{0x3354, 7652, 5},
+		{0x3355, 7657, 2},
+		{0x3356, 7659, 6},
+		{0x3357, 7665, 3},
+		{0x3358, 7668, 2},
+		{0x3359, 7670, 2},
+		{0x335A, 7672, 2},
+		{0x335B, 7674, 2},
+		{0x335C, 7676, 2},
+		{0x335D, 7678, 2},
+		{0x335E, 7680, 2},
+		{0x335F, 7682, 2},
+		{0x3360, 7684, 2},
+		{0x3361, 7686, 2},
+		{0x3362, 7688, 3},
+		{0x3363, 7691, 3},
+		{0x3364, 7694, 3},
+		{0x3365, 7697, 3},
+		{0x3366, 7700, 3},
+		{0x3367, 7703, 3},
+		{0x3368, 7706, 3},
+		{0x3369, 7709, 3},
+		{0x336A, 7712, 3},
+		{0x336B, 7715, 3},
+		{0x336C, 7718, 3},
+		{0x336D, 7721, 3},
+		{0x336E, 7724, 3},
+		{0x336F, 7727, 3},
+		{0x3370, 7730, 3},
+		{0x3371, 7733, 3},
+		{0x3372, 7736, 2},
+		{0x3373, 7738, 2},
+		{0x3374, 7740, 3},
+		{0x3375, 7743, 2},
+		{0x3376, 7745, 2},
+		{0x3377, 7747, 2},
+		{0x3378, 7749, 3},
+		{0x3379, 7752, 3},
+		{0x337A, 7755, 2},
+		{0x337B, 7757, 2},
+		{0x337C, 7759, 2},
+		{0x337D, 7761, 2},
+		{0x337E, 7763, 2},
+		{0x337F, 7765, 4},
+		{0x3380, 7769, 2},
+		{0x3381, 7771, 2},
+		{0x3382, 7773, 2},
+		{0x3383, 7775, 2},
+		{0x3384, 7777, 2},
+		{0x3385, 7779, 2},
+		{0x3386, 7781, 2},
+		{0x3387, 7783, 2},
+		{0x3388, 7785, 3},
+		{0x3389, 7788, 4},
+		{0x338A, 7792, 2},
+		{0x338B, 7794, 2},
+		{0x338C, 7796, 2},
+		{0x338D, 7798, 2},
+		{0x338E, 7800, 2},
+		{0x338F, 7802, 2},
+		{0x3390, 7804, 2},
+		{0x3391, 7806, 3},
+		{0x3392, 7809, 3},
+		{0x3393, 7812, 3},
+		{0x3394, 7815, 3},
+		{0x3395, 7818, 2},
+		{0x3396, 7820, 2},
+		{0x3397, 7822, 2},
+		{0x3398, 7824, 2},
+		{0x3399, 7826, 2},
+		{0x339A, 7828, 2},
+		{0x339B, 7830, 2},
+		{0x339C, 7832, 2},
+		{0x339D, 7834, 2},
+		{0x339E, 7836, 2},
+		{0x339F, 7838, 3},
+		{0x33A0, 7841, 3},
+		{0x33A1, 7844, 2},
+		{0x33A2, 7846, 3},
+		{0x33A3, 7849, 3},
+		{0x33A4, 7852, 3},
+		{0x33A5, 7855, 2},
+		{0x33A6, 7857, 3},
+		{0x33A7, 7860, 3},
+		{0x33A8, 7863, 4},
+		{0x33A9, 7867, 2},
+		{0x33AA, 7869, 3},
+		{0x33AB, 7872, 3},
+		{0x33AC, 7875, 3},
+		{0x33AD, 7878, 3},
+		{0x33AE, 7881, 5},
+		{0x33AF, 7886, 6},
+		{0x33B0, 7892, 2},
+		{0x33B1, 7894, 2},
+		{0x33B2, 7896, 2},
+		{0x33B3, 7898, 2},
+		{0x33B4, 7900, 2},
+		{0x33B5, 7902, 2},
+		{0x33B6, 7904, 2},
+		{0x33B7, 7906, 2},
+		{0x33B8, 7908, 2},
+		{0x33B9, 7910, 2},
+		{0x33BA, 7912, 2},
+		{0x33BB, 7914, 2},
+		{0x33BC, 7916, 2},
+		{0x33BD, 7918, 2},
+		{0x33BE, 7920, 2},
+		{0x33BF, 7922, 2},
+		{0x33C0, 7924, 2},
+		{0x33C1, 7926, 2},
+		{0x33C2, 7928, 4},
+		{0x33C3, 7932, 2},
+		{0x33C4, 7934, 2},
+		{0x33C5, 7936, 2},
+		{0x33C6, 7938, 4},
+		{0x33C7, 7942, 3},
+		{0x33C8, 7945, 2},
+		{0x33C9, 7947, 2},
+		{0x33CA, 7949, 2},
+		{0x33CB, 7951, 2},
+		{0x33CC, 7953, 2},
+		{0x33CD, 7955, 2},
+		{0x33CE, 7957, 2},
+		{0x33CF, 7959, 2},
+		{0x33D0, 7961, 2},
+		{0x33D1, 7963, 2},
+		{0x33D2, 7965, 3},
+		{0x33D3, 7968, 2},
+		{0x33D4, 7970, 2},
+		{0x33D5, 7972, 3},
+		{0x33D6, 7975, 3},
+		{0x33D7, 7978, 2},
+		{0x33D8, 7980, 4},
+		{0x33D9, 7984, 3},
+		{0x33DA, 7987, 2},
+		{0x33DB, 7989, 2},
+		{0x33DC, 7991, 2},
+		{0x33DD, 7993, 2},
+		{0x33DE, 7995, 3},
+		{0x33DF, 7998, 3},
+		{0x33E0, 8001, 2},
+		{0x33E1, 8003, 2},
+		{0x33E2, 8005, 2},
+		{0x33E3, 8007, 2},
+		{0x33E4, 8009, 2},
+		{0x33E5, 8011, 2},
+		{0x33E6, 8013, 2},
+		{0x33E7, 8015, 2},
+		{0x33E8, 8017, 2},
+		{0x33E9, 8019, 3},
+		{0x33EA, 8022, 3},
+		{0x33EB, 8025, 3},
+		{0x33EC, 8028, 3},
+		{0x33ED, 8031, 3},
+		{0x33EE, 8034, 3},
+		{0x33EF, 8037, 3},
+		{0x33F0, 8040, 3},
+		{0x33F1, 8043, 3},
+		{0x33F2, 8046, 3},
+		{0x33F3, 8049, 3},
+		{0x33F4, 8052, 3},
+		{0x33F5, 8055, 3},
+		{0x33F6, 8058, 3},
+		{0x33F7, 8061, 3},
+		{0x33F8, 8064, 3},
+		{0x33F9, 8067, 3},
+		{0x33FA, 8070, 3},
+		{0x33FB, 8073, 3},
+		{0x33FC, 8076, 3},
+		{0x33FD, 8079, 3},
+		{0x33FE, 8082, 3},
+		{0x33FF, 8085, 3},
+		{0xA69C, 8088, 1},
+		{0xA69D, 8089, 1},
+		{0xA770, 8090, 1},
+		{0xA7F2, 8091, 1},
+		{0xA7F3, 8092, 1},
+		{0xA7F4, 8093, 1},
+		{0xA7F8, 8094, 1},
+		{0xA7F9, 8095, 1},
+		{0xAB5C, 8096, 1},
+		{0xAB5D, 8097, 1},
+		{0xAB5E, 8098, 1},
+		{0xAB5F, 8099, 1},
+		{0xAB69, 8100, 1},
+		{0xF900, 8101, 1},
+		{0xF901, 8102, 1},
+		{0xF902, 8103, 1},
+		{0xF903, 8104, 1},
+		{0xF904, 8105, 1},
+		{0xF905, 8106, 1},
+		{0xF906, 8107, 1},
+		{0xF907, 8108, 1},
+		{0xF908, 8109, 1},
+		{0xF909, 8110, 1},
+		{0xF90A, 8111, 1},
+		{0xF90B, 8112, 1},
+		{0xF90C, 8113, 1},
+		{0xF90D, 8114, 1},
+		{0xF90E, 8115, 1},
+		{0xF90F, 8116, 1},
+		{0xF910, 8117, 1},
+		{0xF911, 8118, 1},
+		{0xF912, 8119, 1},
+		{0xF913, 8120, 1},
+		{0xF914, 8121, 1},
+		{0xF915, 8122, 1},
+		{0xF916, 8123, 1},
+		{0xF917, 8124, 1},
+		{0xF918, 8125, 1},
+		{0xF919, 8126, 1},
+		{0xF91A, 8127, 1},
+		{0xF91B, 8128, 1},
+		{0xF91C, 8129, 1},
+		{0xF91D, 8130, 1},
+		{0xF91E, 8131, 1},
+		{0xF91F, 8132, 1},
+		{0xF920, 8133, 1},
+		{0xF921, 8134, 1},
+		{0xF922, 8135, 1},
+		{0xF923, 8136, 1},
+		{0xF924, 8137, 1},
+		{0xF925, 8138, 1},
+		{0xF926, 8139, 1},
+		{0xF927, 8140, 1},
+		{0xF928, 8141, 1},
+		{0xF929, 8142, 1},
+		{0xF92A, 8143, 1},
+		{0xF92B, 8144, 1},
+		{0xF92C, 8145, 1},
+		{0xF92D, 8146, 1},
+		{0xF92E, 8147, 1},
+		{0xF92F, 8148, 1},
+		{0xF930, 8149, 1},
+		{0xF931, 8150, 1},
+		{0xF932, 8151, 1},
+		{0xF933, 8152, 1},
+		{0xF934, 8153, 1},
+		{0xF935, 8154, 1},
+		{0xF936, 8155, 1},
+		{0xF937, 8156, 1},
+		{0xF938, 8157, 1},
+		{0xF939, 8158, 1},
+		{0xF93A, 8159, 1},
+		{0xF93B, 8160, 1},
+		{0xF93C, 8161, 1},
+		{0xF93D, 8162, 1},
+		{0xF93E, 8163, 1},
+		{0xF93F, 8164, 1},
+		{0xF940, 8165, 1},
+		{0xF941, 8166, 1},
+		{0xF942, 8167, 1},
+		{0xF943, 8168, 1},
+		{0xF944, 8169, 1},
+		{0xF945, 8170, 1},
+		{0xF946, 8171, 1},
+		{0xF947, 8172, 1},
+		{0xF948, 8173, 1},
+		{0xF949, 8174, 1},
+		{0xF94A, 8175, 1},
+		{0xF94B, 8176, 1},
+		{0xF94C, 8177, 1},
+		{0xF94D, 8178, 1},
+		{0xF94E, 8179, 1},
+		{0xF94F, 8180, 1},
+		{0xF950, 8181, 1},
+		{0xF951, 8182, 1},
+		{0xF952, 8183, 1},
+		{0xF953, 8184, 1},
+		{0xF954, 8185, 1},
+		{0xF955, 8186, 1},
+		{0xF956, 8187, 1},
+		{0xF957, 8188, 1},
+		{0xF958, 8189, 1},
+		{0xF959, 8190, 1},
+		{0xF95A, 8191, 1},
+		{0xF95B, 8192, 1},
+		{0xF95C, 8193, 1},
+		{0xF95D, 8194, 1},
+		{0xF95E, 8195, 1},
+		{0xF95F, 8196, 1},
+		{0xF960, 8197, 1},
+		{0xF961, 8198, 1},
+		{0xF962, 8199, 1},
+		{0xF963, 8200, 1},
+		{0xF964, 8201, 1},
+		{0xF965, 8202, 1},
+		{0xF966, 8203, 1},
+		{0xF967, 8204, 1},
+		{0xF968, 8205, 1},
+		{0xF969, 8206, 1},
+		{0xF96A, 8207, 1},
+		{0xF96B, 8208, 1},
+		{0xF96C, 8209, 1},
+		{0xF96D, 8210, 1},
+		{0xF96E, 8211, 1},
+		{0xF96F, 8212, 1},
+		{0xF970, 8213, 1},
+		{0xF971, 8214, 1},
+		{0xF972, 8215, 1},
+		{0xF973, 8216, 1},
+		{0xF974, 8217, 1},
+		{0xF975, 8218, 1},
+		{0xF976, 8219, 1},
+		{0xF977, 8220, 1},
+		{0xF978, 8221, 1},
+		{0xF979, 8222, 1},
+		{0xF97A, 8223, 1},
+		{0xF97B, 8224, 1},
+		{0xF97C, 8225, 1},
+		{0xF97D, 8226, 1},
+		{0xF97E, 8227, 1},
+		{0xF97F, 8228, 1},
+		{0xF980, 8229, 1},
+		{0xF981, 8230, 1},
+		{0xF982, 8231, 1},
+		{0xF983, 8232, 1},
+		{0xF984, 8233, 1},
+		{0xF985, 8234, 1},
+		{0xF986, 8235, 1},
+		{0xF987, 8236, 1},
+		{0xF988, 8237, 1},
+		{0xF989, 8238, 1},
+		{0xF98A, 8239, 1},
+		{0xF98B, 8240, 1},
+		{0xF98C, 8241, 1},
+		{0xF98D, 8242, 1},
+		{0xF98E, 8243, 1},
+		{0xF98F, 8244, 1},
+		{0xF990, 8245, 1},
+		{0xF991, 8246, 1},
+		{0xF992, 8247, 1},
+		{0xF993, 8248, 1},
+		{0xF994, 8249, 1},
+		{0xF995, 8250, 1},
+		{0xF996, 8251, 1},
+		{0xF997, 8252, 1},
+		{0xF998, 8253, 1},
+		{0xF999, 8254, 1},
+		{0xF99A, 8255, 1},
+		{0xF99B, 8256, 1},
+		{0xF99C, 8257, 1},
+		{0xF99D, 8258, 1},
+		{0xF99E, 8259, 1},
+		{0xF99F, 8260, 1},
+		{0xF9A0, 8261, 1},
+		{0xF9A1, 8262, 1},
+		{0xF9A2, 8263, 1},
+		{0xF9A3, 8264, 1},
+		{0xF9A4, 8265, 1},
+		{0xF9A5, 8266, 1},
+		{0xF9A6, 8267, 1},
+		{0xF9A7, 8268, 1},
+		{0xF9A8, 8269, 1},
+		{0xF9A9, 8270, 1},
+		{0xF9AA, 8271, 1},
+		{0xF9AB, 8272, 1},
+		{0xF9AC, 8273, 1},
+		{0xF9AD, 8274, 1},
+		{0xF9AE, 8275, 1},
+		{0xF9AF, 8276, 1},
+		{0xF9B0, 8277, 1},
+		{0xF9B1, 8278, 1},
+		{0xF9B2, 8279, 1},
+		{0xF9B3, 8280, 1},
+		{0xF9B4, 8281, 1},
+		{0xF9B5, 8282, 1},
+		{0xF9B6, 8283, 1},
+		{0xF9B7, 8284, 1},
+		{0xF9B8, 8285, 1},
+		{0xF9B9, 8286, 1},
+		{0xF9BA, 8287, 1},
+		{0xF9BB, 8288, 1},
+		{0xF9BC, 8289, 1},
+		{0xF9BD, 8290, 1},
+		{0xF9BE, 8291, 1},
+		{0xF9BF, 8292, 1},
+		{0xF9C0, 8293, 1},
+		{0xF9C1, 8294, 1},
+		{0xF9C2, 8295, 1},
+		{0xF9C3, 8296, 1},
+		{0xF9C4, 8297, 1},
+		{0xF9C5, 8298, 1},
+		{0xF9C6, 8299, 1},
+		{0xF9C7, 8300, 1},
+		{0xF9C8, 8301, 1},
+		{0xF9C9, 8302, 1},
+		{0xF9CA, 8303, 1},
+		{0xF9CB, 8304, 1},
+		{0xF9CC, 8305, 1},
+		{0xF9CD, 8306, 1},
+		{0xF9CE, 8307, 1},
+		{0xF9CF, 8308, 1},
+		{0xF9D0, 8309, 1},
+		{0xF9D1, 8310, 1},
+		{0xF9D2, 8311, 1},
+		{0xF9D3, 8312, 1},
+		{0xF9D4, 8313, 1},
+		{0xF9D5, 8314, 1},
+		{0xF9D6, 8315, 1},
+		{0xF9D7, 8316, 1},
+		{0xF9D8, 8317, 1},
+		{0xF9D9, 8318, 1},
+		{0xF9DA, 8319, 1},
+		{0xF9DB, 8320, 1},
+		{0xF9DC, 8321, 1},
+		{0xF9DD, 8322, 1},
+		{0xF9DE, 8323, 1},
+		{0xF9DF, 8324, 1},
+		{0xF9E0, 8325, 1},
+		{0xF9E1, 8326, 1},
+		{0xF9E2, 8327, 1},
+		{0xF9E3, 8328, 1},
+		{0xF9E4, 8329, 1},
+		{0xF9E5, 8330, 1},
+		{0xF9E6, 8331, 1},
+		{0xF9E7, 8332, 1},
+		{0xF9E8, 8333, 1},
+		{0xF9E9, 8334, 1},
+		{0xF9EA, 8335, 1},
+		{0xF9EB, 8336, 1},
+		{0xF9EC, 8337, 1},
+		{0xF9ED, 8338, 1},
+		{0xF9EE, 8339, 1},
+		{0xF9EF, 8340, 1},
+		{0xF9F0, 8341, 1},
+		{0xF9F1, 8342, 1},
+		{0xF9F2, 8343, 1},
+		{0xF9F3, 8344, 1},
+		{0xF9F4, 8345, 1},
+		{0xF9F5, 8346, 1},
+		{0xF9F6, 8347, 1},
+		{0xF9F7, 8348, 1},
+		{0xF9F8, 8349, 1},
+		{0xF9F9, 8350, 1},
+		{0xF9FA, 8351, 1},
+		{0xF9FB, 8352, 1},
+		{0xF9FC, 8353, 1},
+		{0xF9FD, 8354, 1},
+		{0xF9FE, 8355, 1},
+		{0xF9FF, 8356, 1},
+		{0xFA00, 8357, 1},
+		{0xFA01, 8358, 1},
+		{0xFA02, 8359, 1},
+		{0xFA03, 8360, 1},
+		{0xFA04, 8361, 1},
+		{0xFA05, 8362, 1},
+		{0xFA06, 8363, 1},
+		{0xFA07, 8364, 1},
+		{0xFA08, 8365, 1},
+		{0xFA09, 8366, 1},
+		{0xFA0A, 8367, 1},
+		{0xFA0B, 8368, 1},
+		{0xFA0C, 8369, 1},
+		{0xFA0D, 8370, 1},
+		{0xFA10, 8371, 1},
+		{0xFA12, 8372, 1},
+		{0xFA15, 8373, 1},
+		{0xFA16, 8374, 1},
+		{0xFA17, 8375, 1},
+		{0xFA18, 8376, 1},
+		{0xFA19, 8377, 1},
+		{0xFA1A, 8378, 1},
+		{0xFA1B, 8379, 1},
+		{0xFA1C, 8380, 1},
+		{0xFA1D, 8381, 1},
+		{0xFA1E, 8382, 1},
+		{0xFA20, 8383, 1},
+		{0xFA22, 8384, 1},
+		{0xFA25, 8385, 1},
+		{0xFA26, 8386, 1},
+		{0xFA2A, 8387, 1},
+		{0xFA2B, 8388, 1},
+		{0xFA2C, 8389, 1},
+		{0xFA2D, 8390, 1},
+		{0xFA2E, 8391, 1},
+		{0xFA2F, 8392, 1},
+		{0xFA30, 8393, 1},
+		{0xFA31, 8394, 1},
+		{0xFA32, 8395, 1},
+		{0xFA33, 8396, 1},
+		{0xFA34, 8397, 1},
+		{0xFA35, 8398, 1},
+		{0xFA36, 8399, 1},
+		{0xFA37, 8400, 1},
+		{0xFA38, 8401, 1},
+		{0xFA39, 8402, 1},
+		{0xFA3A, 8403, 1},
+		{0xFA3B, 8404, 1},
+		{0xFA3C, 8405, 1},
+		{0xFA3D, 8406, 1},
+		{0xFA3E, 8407, 1},
+		{0xFA3F, 8408, 1},
+		{0xFA40, 8409, 1},
+		{0xFA41, 8410, 1},
+		{0xFA42, 8411, 1},
+		{0xFA43, 8412, 1},
+		{0xFA44, 8413, 1},
+		{0xFA45, 8414, 1},
+		{0xFA46, 8415, 1},
+		{0xFA47, 8416, 1},
+		{0xFA48, 8417, 1},
+		{0xFA49, 8418, 1},
+		{0xFA4A, 8419, 1},
+		{0xFA4B, 8420, 1},
+		{0xFA4C, 8421, 1},
+		{0xFA4D, 8422, 1},
+		{0xFA4E, 8423, 1},
+		{0xFA4F, 8424, 1},
+		{0xFA50, 8425, 1},
+		{0xFA51, 8426, 1},
+		{0xFA52, 8427, 1},
+		{0xFA53, 8428, 1},
+		{0xFA54, 8429, 1},
+		{0xFA55, 8430, 1},
+		{0xFA56, 8431, 1},
+		{0xFA57, 8432, 1},
+		{0xFA58, 8433, 1},
+		{0xFA59, 8434, 1},
+		{0xFA5A, 8435, 1},
+		{0xFA5B, 8436, 1},
+		{0xFA5C, 8437, 1},
+		{0xFA5D, 8438, 1},
+		{0xFA5E, 8439, 1},
+		{0xFA5F, 8440, 1},
+		{0xFA60, 8441, 1},
+		{0xFA61, 8442, 1},
+		{0xFA62, 8443, 1},
+		{0xFA63, 8444, 1},
+		{0xFA64, 8445, 1},
+		{0xFA65, 8446, 1},
+		{0xFA66, 8447, 1},
+		{0xFA67, 8448, 1},
+		{0xFA68, 8449, 1},
+		{0xFA69, 8450, 1},
+		{0xFA6A, 8451, 1},
+		{0xFA6B, 8452, 1},
+		{0xFA6C, 8453, 1},
+		{0xFA6D, 8454, 1},
+		{0xFA70, 8455, 1},
+		{0xFA71, 8456, 1},
+		{0xFA72, 8457, 1},
+		{0xFA73, 8458, 1},
+		{0xFA74, 8459, 1},
+		{0xFA75, 8460, 1},
+		{0xFA76, 8461, 1},
+		{0xFA77, 8462, 1},
+		{0xFA78, 8463, 1},
+		{0xFA79, 8464, 1},
+		{0xFA7A, 8465, 1},
+		{0xFA7B, 8466, 1},
+		{0xFA7C, 8467, 1},
+		{0xFA7D, 8468, 1},
+		{0xFA7E, 8469, 1},
+		{0xFA7F, 8470, 1},
+		{0xFA80, 8471, 1},
+		{0xFA81, 8472, 1},
+		{0xFA82, 8473, 1},
+		{0xFA83, 8474, 1},
+		{0xFA84, 8475, 1},
+		{0xFA85, 8476, 1},
+		{0xFA86, 8477, 1},
+		{0xFA87, 8478, 1},
+		{0xFA88, 8479, 1},
+		{0xFA89, 8480, 1},
+		{0xFA8A, 8481, 1},
+		{0xFA8B, 8482, 1},
+		{0xFA8C, 8483, 1},
+		{0xFA8D, 8484, 1},
+		{0xFA8E, 8485, 1},
+		{0xFA8F, 8486, 1},
+		{0xFA90, 8487, 1},
+		{0xFA91, 8488, 1},
+		{0xFA92, 8489, 1},
+		{0xFA93, 8490, 1},
+		{0xFA94, 8491, 1},
+		{0xFA95, 8492, 1},
+		{0xFA96, 8493, 1},
+		{0xFA97, 8494, 1},
+		{0xFA98, 8495, 1},
+		{0xFA99, 8496, 1},
+		{0xFA9A, 8497, 1},
+		{0xFA9B, 8498, 1},
+		{0xFA9C, 8499, 1},
+		{0xFA9D, 8500, 1},
+		{0xFA9E, 8501, 1},
+		{0xFA9F, 8502, 1},
+		{0xFAA0, 8503, 1},
+		{0xFAA1, 8504, 1},
+		{0xFAA2, 8505, 1},
+		{0xFAA3, 8506, 1},
+		{0xFAA4, 8507, 1},
+		{0xFAA5, 8508, 1},
+		{0xFAA6, 8509, 1},
+		{0xFAA7, 8510, 1},
+		{0xFAA8, 8511, 1},
+		{0xFAA9, 8512, 1},
+		{0xFAAA, 8513, 1},
+		{0xFAAB, 8514, 1},
+		{0xFAAC, 8515, 1},
+		{0xFAAD, 8516, 1},
+		{0xFAAE, 8517, 1},
+		{0xFAAF, 8518, 1},
+		{0xFAB0, 8519, 1},
+		{0xFAB1, 8520, 1},
+		{0xFAB2, 8521, 1},
+		{0xFAB3, 8522, 1},
+		{0xFAB4, 8523, 1},
+		{0xFAB5, 8524, 1},
+		{0xFAB6, 8525, 1},
+		{0xFAB7, 8526, 1},
+		{0xFAB8, 8527, 1},
+		{0xFAB9, 8528, 1},
+		{0xFABA, 8529, 1},
+		{0xFABB, 8530, 1},
+		{0xFABC, 8531, 1},
+		{0xFABD, 8532, 1},
+		{0xFABE, 8533, 1},
+		{0xFABF, 8534, 1},
+		{0xFAC0, 8535, 1},
+		{0xFAC1, 8536, 1},
+		{0xFAC2, 8537, 1},
+		{0xFAC3, 8538, 1},
+		{0xFAC4, 8539, 1},
+		{0xFAC5, 8540, 1},
+		{0xFAC6, 8541, 1},
+		{0xFAC7, 8542, 1},
+		{0xFAC8, 8543, 1},
+		{0xFAC9, 8544, 1},
+		{0xFACA, 8545, 1},
+		{0xFACB, 8546, 1},
+		{0xFACC, 8547, 1},
+		{0xFACD, 8548, 1},
+		{0xFACE, 8549, 1},
+		{0xFACF, 8550, 1},
+		{0xFAD0, 8551, 1},
+		{0xFAD1, 8552, 1},
+		{0xFAD2, 8553, 1},
+		{0xFAD3, 8554, 1},
+		{0xFAD4, 8555, 1},
+		{0xFAD5, 8556, 1},
+		{0xFAD6, 8557, 1},
+		{0xFAD7, 8558, 1},
+		{0xFAD8, 8559, 1},
+		{0xFAD9, 8560, 1},
+		{0xFB00, 8561, 2},
+		{0xFB01, 8563, 2},
+		{0xFB02, 8565, 2},
+		{0xFB03, 8567, 3},
+		{0xFB04, 8570, 3},
+		{0xFB05, 8573, 2},
+		{0xFB06, 8575, 2},
+		{0xFB13, 8577, 2},
+		{0xFB14, 8579, 2},
+		{0xFB15, 8581, 2},
+		{0xFB16, 8583, 2},
+		{0xFB17, 8585, 2},
+		{0xFB1D, 8587, 2},
+		{0xFB1F, 8589, 2},
+		{0xFB20, 8591, 1},
+		{0xFB21, 8592, 1},
+		{0xFB22, 8593, 1},
+		{0xFB23, 8594, 1},
+		{0xFB24, 8595, 1},
+		{0xFB25, 8596, 1},
+		{0xFB26, 8597, 1},
+		{0xFB27, 8598, 1},
+		{0xFB28, 8599, 1},
+		{0xFB29, 8600, 1},
+		{0xFB2A, 8601, 2},
+		{0xFB2B, 8603, 2},
+		{0xFB2C, 8605, 3},
+		{0xFB2D, 8608, 3},
+		{0xFB2E, 8611, 2},
+		{0xFB2F, 8613, 2},
+		{0xFB30, 8615, 2},
+		{0xFB31, 8617, 2},
+		{0xFB32, 8619, 2},
+		{0xFB33, 8621, 2},
+		{0xFB34, 8623, 2},
+		{0xFB35, 8625, 2},
+		{0xFB36, 8627, 2},
+		{0xFB38, 8629, 2},
+		{0xFB39, 8631, 2},
+		{0xFB3A, 8633, 2},
+		{0xFB3B, 8635, 2},
+		{0xFB3C, 8637, 2},
+		{0xFB3E, 8639, 2},
+		{0xFB40, 8641, 2},
+		{0xFB41, 8643, 2},
+		{0xFB43, 8645, 2},
+		{0xFB44, 8647, 2},
+		{0xFB46, 8649, 2},
+		{0xFB47, 8651, 2},
+		{0xFB48, 8653, 2},
+		{0xFB49, 8655, 2},
+		{0xFB4A, 8657, 2},
+		{0xFB4B, 8659, 2},
+		{0xFB4C, 8661, 2},
+		{0xFB4D, 8663, 2},
+		{0xFB4E, 8665, 2},
+		{0xFB4F, 8667, 2},
+		{0xFB50, 8669, 1},
+		{0xFB51, 8670, 1},
+		{0xFB52, 8671, 1},
+		{0xFB53, 8672, 1},
+		{0xFB54, 8673, 1},
+		{0xFB55, 8674, 1},
+		{0xFB56, 8675, 1},
+		{0xFB57, 8676, 1},
+		{0xFB58, 8677, 1},
+		{0xFB59, 8678, 1},
+		{0xFB5A, 8679, 1},
+		{0xFB5B, 8680, 1},
+		{0xFB5C, 8681, 1},
+		{0xFB5D, 8682, 1},
+		{0xFB5E, 8683, 1},
+		{0xFB5F, 8684, 1},
+		{0xFB60, 8685, 1},
+		{0xFB61, 8686, 1},
+		{0xFB62, 8687, 1},
+		{0xFB63, 8688, 1},
+		{0xFB64, 8689, 1},
+		{0xFB65, 8690, 1},
+		{0xFB66, 8691, 1},
+		{0xFB67, 8692, 1},
+		{0xFB68, 8693, 1},
+		{0xFB69, 8694, 1},
+		{0xFB6A, 8695, 1},
+		{0xFB6B, 8696, 1},
+		{0xFB6C, 8697, 1},
+		{0xFB6D, 8698, 1},
+		{0xFB6E, 8699, 1},
+		{0xFB6F, 8700, 1},
+		{0xFB70, 8701, 1},
+		{0xFB71, 8702, 1},
+		{0xFB72, 8703, 1},
+		{0xFB73, 8704, 1},
+		{0xFB74, 8705, 1},
+		{0xFB75, 8706, 1},
+		{0xFB76, 8707, 1},
+		{0xFB77, 8708, 1},
+		{0xFB78, 8709, 1},
+		{0xFB79, 8710, 1},
+		{0xFB7A, 8711, 1},
+		{0xFB7B, 8712, 1},
+		{0xFB7C, 8713, 1},
+		{0xFB7D, 8714, 1},
+		{0xFB7E, 8715, 1},
+		{0xFB7F, 8716, 1},
+		{0xFB80, 8717, 1},
+		{0xFB81, 8718, 1},
+		{0xFB82, 8719, 1},
+		{0xFB83, 8720, 1},
+		{0xFB84, 8721, 1},
+		{0xFB85, 8722, 1},
+		{0xFB86, 8723, 1},
+		{0xFB87, 8724, 1},
+		{0xFB88, 8725, 1},
+		{0xFB89, 8726, 1},
+		{0xFB8A, 8727, 1},
+		{0xFB8B, 8728, 1},
+		{0xFB8C, 8729, 1},
+		{0xFB8D, 8730, 1},
+		{0xFB8E, 8731, 1},
+		{0xFB8F, 8732, 1},
+		{0xFB90, 8733, 1},
+		{0xFB91, 8734, 1},
+		{0xFB92, 8735, 1},
+		{0xFB93, 8736, 1},
+		{0xFB94, 8737, 1},
+		{0xFB95, 8738, 1},
+		{0xFB96, 8739, 1},
+		{0xFB97, 8740, 1},
+		{0xFB98, 8741, 1},
+		{0xFB99, 8742, 1},
+		{0xFB9A, 8743, 1},
+		{0xFB9B, 8744, 1},
+		{0xFB9C, 8745, 1},
+		{0xFB9D, 8746, 1},
+		{0xFB9E, 8747, 1},
+		{0xFB9F, 8748, 1},
+		{0xFBA0, 8749, 1},
+		{0xFBA1, 8750, 1},
+		{0xFBA2, 8751, 1},
+		{0xFBA3, 8752, 1},
+		{0xFBA4, 8753, 2},
+		{0xFBA5, 8755, 2},
+		{0xFBA6, 8757, 1},
+		{0xFBA7, 8758, 1},
+		{0xFBA8, 8759, 1},
+		{0xFBA9, 8760, 1},
+		{0xFBAA, 8761, 1},
+		{0xFBAB, 8762, 1},
+		{0xFBAC, 8763, 1},
+		{0xFBAD, 8764, 1},
+		{0xFBAE, 8765, 1},
+		{0xFBAF, 8766, 1},
+		{0xFBB0, 8767, 2},
+		{0xFBB1, 8769, 2},
+		{0xFBD3, 8771, 1},
+		{0xFBD4, 8772, 1},
+		{0xFBD5, 8773, 1},
+		{0xFBD6, 8774, 1},
+		{0xFBD7, 8775, 1},
+		{0xFBD8, 8776, 1},
+		{0xFBD9, 8777, 1},
+		{0xFBDA, 8778, 1},
+		{0xFBDB, 8779, 1},
+		{0xFBDC, 8780, 1},
+		{0xFBDD, 8781, 2},
+		{0xFBDE, 8783, 1},
+		{0xFBDF, 8784, 1},
+		{0xFBE0, 8785, 1},
+		{0xFBE1, 8786, 1},
+		{0xFBE2, 8787, 1},
+		{0xFBE3, 8788, 1},
+		{0xFBE4, 8789, 1},
+		{0xFBE5, 8790, 1},
+		{0xFBE6, 8791, 1},
+		{0xFBE7, 8792, 1},
+		{0xFBE8, 8793, 1},
+		{0xFBE9, 8794, 1},
+		{0xFBEA, 8795, 3},
+		{0xFBEB, 8798, 3},
+		{0xFBEC, 8801, 3},
+		{0xFBED, 8804, 3},
+		{0xFBEE, 8807, 3},
+		{0xFBEF, 8810, 3},
+		{0xFBF0, 8813, 3},
+		{0xFBF1, 8816, 3},
+		{0xFBF2, 8819, 3},
+		{0xFBF3, 8822, 3},
+		{0xFBF4, 8825, 3},
+		{0xFBF5, 8828, 3},
+		{0xFBF6, 8831, 3},
+		{0xFBF7, 8834, 3},
+		{0xFBF8, 8837, 3},
+		{0xFBF9, 8840, 3},
+		{0xFBFA, 8843, 3},
+		{0xFBFB, 8846, 3},
+		{0xFBFC, 8849, 1},
+		{0xFBFD, 8850, 1},
+		{0xFBFE, 8851, 1},
+		{0xFBFF, 8852, 1},
+		{0xFC00, 8853, 3},
+		{0xFC01, 8856, 3},
+		{0xFC02, 8859, 3},
+		{0xFC03, 8862, 3},
+		{0xFC04, 8865, 3},
+		{0xFC05, 8868, 2},
+		{0xFC06, 8870, 2},
+		{0xFC07, 8872, 2},
+		{0xFC08, 8874, 2},
+		{0xFC09, 8876, 2},
+		{0xFC0A, 8878, 2},
+		{0xFC0B, 8880, 2},
+		{0xFC0C, 8882, 2},
+		{0xFC0D, 8884, 2},
+		{0xFC0E, 8886, 2},
+		{0xFC0F, 8888, 2},
+		{0xFC10, 8890, 2},
+		{0xFC11, 8892, 2},
+		{0xFC12, 8894, 2},
+		{0xFC13, 8896, 2},
+		{0xFC14, 8898, 2},
+		{0xFC15, 8900, 2},
+		{0xFC16, 8902, 2},
+		{0xFC17, 8904, 2},
+		{0xFC18, 8906, 2},
+		{0xFC19, 8908, 2},
+		{0xFC1A, 8910, 2},
+		{0xFC1B, 8912, 2},
+		{0xFC1C, 8914, 2},
+		{0xFC1D, 8916, 2},
+		{0xFC1E, 8918, 2},
+		{0xFC1F, 8920, 2},
+		{0xFC20, 8922, 2},
+		{0xFC21, 8924, 2},
+		{0xFC22, 8926, 2},
+		{0xFC23, 8928, 2},
+		{0xFC24, 8930, 2},
+		{0xFC25, 8932, 2},
+		{0xFC26, 8934, 2},
+		{0xFC27, 8936, 2},
+		{0xFC28, 8938, 2},
+		{0xFC29, 8940, 2},
+		{0xFC2A, 8942, 2},
+		{0xFC2B, 8944, 2},
+		{0xFC2C, 8946, 2},
+		{0xFC2D, 8948, 2},
+		{0xFC2E, 8950, 2},
+		{0xFC2F, 8952, 2},
+		{0xFC30, 8954, 2},
+		{0xFC31, 8956, 2},
+		{0xFC32, 8958, 2},
+		{0xFC33, 8960, 2},
+		{0xFC34, 8962, 2},
+		{0xFC35, 8964, 2},
+		{0xFC36, 8966, 2},
+		{0xFC37, 8968, 2},
+		{0xFC38, 8970, 2},
+		{0xFC39, 8972, 2},
+		{0xFC3A, 8974, 2},
+		{0xFC3B, 8976, 2},
+		{0xFC3C, 8978, 2},
+		{0xFC3D, 8980, 2},
+		{0xFC3E, 8982, 2},
+		{0xFC3F, 8984, 2},
+		{0xFC40, 8986, 2},
+		{0xFC41, 8988, 2},
+		{0xFC42, 8990, 2},
+		{0xFC43, 8992, 2},
+		{0xFC44, 8994, 2},
+		{0xFC45, 8996, 2},
+		{0xFC46, 8998, 2},
+		{0xFC47, 9000, 2},
+		{0xFC48, 9002, 2},
+		{0xFC49, 9004, 2},
+		{0xFC4A, 9006, 2},
+		{0xFC4B, 9008, 2},
+		{0xFC4C, 9010, 2},
+		{0xFC4D, 9012, 2},
+		{0xFC4E, 9014, 2},
+		{0xFC4F, 9016, 2},
+		{0xFC50, 9018, 2},
+		{0xFC51, 9020, 2},
+		{0xFC52, 9022, 2},
+		{0xFC53, 9024, 2},
+		{0xFC54, 9026, 2},
+		{0xFC55, 9028, 2},
+		{0xFC56, 9030, 2},
+		{0xFC57, 9032, 2},
+		{0xFC58, 9034, 2},
+		{0xFC59, 9036, 2},
+		{0xFC5A, 9038, 2},
+		{0xFC5B, 9040, 2},
+		{0xFC5C, 9042, 2},
+		{0xFC5D, 9044, 2},
+		{0xFC5E, 9046, 3},
+		{0xFC5F, 9049, 3},
+		{0xFC60, 9052, 3},
+		{0xFC61, 9055, 3},
+		{0xFC62, 9058, 3},
+		{0xFC63, 9061, 3},
+		{0xFC64, 9064, 3},
+		{0xFC65, 9067, 3},
+		{0xFC66, 9070, 3},
+		{0xFC67, 9073, 3},
+		{0xFC68, 9076, 3},
+		{0xFC69, 9079, 3},
+		{0xFC6A, 9082, 2},
+		{0xFC6B, 9084, 2},
+		{0xFC6C, 9086, 2},
+		{0xFC6D, 9088, 2},
+		{0xFC6E, 9090, 2},
+		{0xFC6F, 9092, 2},
+		{0xFC70, 9094, 2},
+		{0xFC71, 9096, 2},
+		{0xFC72, 9098, 2},
+		{0xFC73, 9100, 2},
+		{0xFC74, 9102, 2},
+		{0xFC75, 9104, 2},
+		{0xFC76, 9106, 2},
+		{0xFC77, 9108, 2},
+		{0xFC78, 9110, 2},
+		{0xFC79, 9112, 2},
+		{0xFC7A, 9114, 2},
+		{0xFC7B, 9116, 2},
+		{0xFC7C, 9118, 2},
+		{0xFC7D, 9120, 2},
+		{0xFC7E, 9122, 2},
+		{0xFC7F, 9124, 2},
+		{0xFC80, 9126, 2},
+		{0xFC81, 9128, 2},
+		{0xFC82, 9130, 2},
+		{0xFC83, 9132, 2},
+		{0xFC84, 9134, 2},
+		{0xFC85, 9136, 2},
+		{0xFC86, 9138, 2},
+		{0xFC87, 9140, 2},
+		{0xFC88, 9142, 2},
+		{0xFC89, 9144, 2},
+		{0xFC8A, 9146, 2},
+		{0xFC8B, 9148, 2},
+		{0xFC8C, 9150, 2},
+		{0xFC8D, 9152, 2},
+		{0xFC8E, 9154, 2},
+		{0xFC8F, 9156, 2},
+		{0xFC90, 9158, 2},
+		{0xFC91, 9160, 2},
+		{0xFC92, 9162, 2},
+		{0xFC93, 9164, 2},
+		{0xFC94, 9166, 2},
+		{0xFC95, 9168, 2},
+		{0xFC96, 9170, 2},
+		{0xFC97, 9172, 3},
+		{0xFC98, 9175, 3},
+		{0xFC99, 9178, 3},
+		{0xFC9A, 9181, 3},
+		{0xFC9B, 9184, 3},
+		{0xFC9C, 9187, 2},
+		{0xFC9D, 9189, 2},
+		{0xFC9E, 9191, 2},
+		{0xFC9F, 9193, 2},
+		{0xFCA0, 9195, 2},
+		{0xFCA1, 9197, 2},
+		{0xFCA2, 9199, 2},
+		{0xFCA3, 9201, 2},
+		{0xFCA4, 9203, 2},
+		{0xFCA5, 9205, 2},
+		{0xFCA6, 9207, 2},
+		{0xFCA7, 9209, 2},
+		{0xFCA8, 9211, 2},
+		{0xFCA9, 9213, 2},
+		{0xFCAA, 9215, 2},
+		{0xFCAB, 9217, 2},
+		{0xFCAC, 9219, 2},
+		{0xFCAD, 9221, 2},
+		{0xFCAE, 9223, 2},
+		{0xFCAF, 9225, 2},
+		{0xFCB0, 9227, 2},
+		{0xFCB1, 9229, 2},
+		{0xFCB2, 9231, 2},
+		{0xFCB3, 9233, 2},
+		{0xFCB4, 9235, 2},
+		{0xFCB5, 9237, 2},
+		{0xFCB6, 9239, 2},
+		{0xFCB7, 9241, 2},
+		{0xFCB8, 9243, 2},
+		{0xFCB9, 9245, 2},
+		{0xFCBA, 9247, 2},
+		{0xFCBB, 9249, 2},
+		{0xFCBC, 9251, 2},
+		{0xFCBD, 9253, 2},
+		{0xFCBE, 9255, 2},
+		{0xFCBF, 9257, 2},
+		{0xFCC0, 9259, 2},
+		{0xFCC1, 9261, 2},
+		{0xFCC2, 9263, 2},
+		{0xFCC3, 9265, 2},
+		{0xFCC4, 9267, 2},
+		{0xFCC5, 9269, 2},
+		{0xFCC6, 9271, 2},
+		{0xFCC7, 9273, 2},
+		{0xFCC8, 9275, 2},
+		{0xFCC9, 9277, 2},
+		{0xFCCA, 9279, 2},
+		{0xFCCB, 9281, 2},
+		{0xFCCC, 9283, 2},
+		{0xFCCD, 9285, 2},
+		{0xFCCE, 9287, 2},
+		{0xFCCF, 9289, 2},
+		{0xFCD0, 9291, 2},
+		{0xFCD1, 9293, 2},
+		{0xFCD2, 9295, 2},
+		{0xFCD3, 9297, 2},
+		{0xFCD4, 9299, 2},
+		{0xFCD5, 9301, 2},
+		{0xFCD6, 9303, 2},
+		{0xFCD7, 9305, 2},
+		{0xFCD8, 9307, 2},
+		{0xFCD9, 9309, 2},
+		{0xFCDA, 9311, 2},
+		{0xFCDB, 9313, 2},
+		{0xFCDC, 9315, 2},
+		{0xFCDD, 9317, 2},
+		{0xFCDE, 9319, 2},
+		{0xFCDF, 9321, 3},
+		{0xFCE0, 9324, 3},
+		{0xFCE1, 9327, 2},
+		{0xFCE2, 9329, 2},
+		{0xFCE3, 9331, 2},
+		{0xFCE4, 9333, 2},
+		{0xFCE5, 9335, 2},
+		{0xFCE6, 9337, 2},
+		{0xFCE7, 9339, 2},
+		{0xFCE8, 9341, 2},
+		{0xFCE9, 9343, 2},
+		{0xFCEA, 9345, 2},
+		{0xFCEB, 9347, 2},
+		{0xFCEC, 9349, 2},
+		{0xFCED, 9351, 2},
+		{0xFCEE, 9353, 2},
+		{0xFCEF, 9355, 2},
+		{0xFCF0, 9357, 2},
+		{0xFCF1, 9359, 2},
+		{0xFCF2, 9361, 3},
+		{0xFCF3, 9364, 3},
+		{0xFCF4, 9367, 3},
+		{0xFCF5, 9370, 2},
+		{0xFCF6, 9372, 2},
+		{0xFCF7, 9374, 2},
+		{0xFCF8, 9376, 2},
+		{0xFCF9, 9378, 2},
+		{0xFCFA, 9380, 2},
+		{0xFCFB, 9382, 2},
+		{0xFCFC, 9384, 2},
+		{0xFCFD, 9386, 2},
+		{0xFCFE, 9388, 2},
+		{0xFCFF, 9390, 2},
+		{0xFD00, 9392, 2},
+		{0xFD01, 9394, 2},
+		{0xFD02, 9396, 2},
+		{0xFD03, 9398, 2},
+		{0xFD04, 9400, 2},
+		{0xFD05, 9402, 2},
+		{0xFD06, 9404, 2},
+		{0xFD07, 9406, 2},
+		{0xFD08, 9408, 2},
+		{0xFD09, 9410, 2},
+		{0xFD0A, 9412, 2},
+		{0xFD0B, 9414, 2},
+		{0xFD0C, 9416, 2},
+		{0xFD0D, 9418, 2},
+		{0xFD0E, 9420, 2},
+		{0xFD0F, 9422, 2},
+		{0xFD10, 9424, 2},
+		{0xFD11, 9426, 2},
+		{0xFD12, 9428, 2},
+		{0xFD13, 9430, 2},
+		{0xFD14, 9432, 2},
+		{0xFD15, 9434, 2},
+		{0xFD16, 9436, 2},
+		{0xFD17, 9438, 2},
+		{0xFD18, 9440, 2},
+		{0xFD19, 9442, 2},
+		{0xFD1A, 9444, 2},
+		{0xFD1B, 9446, 2},
+		{0xFD1C, 9448, 2},
+		{0xFD1D, 9450, 2},
+		{0xFD1E, 9452, 2},
+		{0xFD1F, 9454, 2},
+		{0xFD20, 9456, 2},
+		{0xFD21, 9458, 2},
+		{0xFD22, 9460, 2},
+		{0xFD23, 9462, 2},
+		{0xFD24, 9464, 2},
+		{0xFD25, 9466, 2},
+		{0xFD26, 9468, 2},
+		{0xFD27, 9470, 2},
+		{0xFD28, 9472, 2},
+		{0xFD29, 9474, 2},
+		{0xFD2A, 9476, 2},
+		{0xFD2B, 9478, 2},
+		{0xFD2C, 9480, 2},
+		{0xFD2D, 9482, 2},
+		{0xFD2E, 9484, 2},
+		{0xFD2F, 9486, 2},
+		{0xFD30, 9488, 2},
+		{0xFD31, 9490, 2},
+		{0xFD32, 9492, 2},
+		{0xFD33, 9494, 2},
+		{0xFD34, 9496, 2},
+		{0xFD35, 9498, 2},
+		{0xFD36, 9500, 2},
+		{0xFD37, 9502, 2},
+		{0xFD38, 9504, 2},
+		{0xFD39, 9506, 2},
+		{0xFD3A, 9508, 2},
+		{0xFD3B, 9510, 2},
+		{0xFD3C, 9512, 2},
+		{0xFD3D, 9514, 2},
+		{0xFD50, 9516, 3},
+		{0xFD51, 9519, 3},
+		{0xFD52, 9522, 3},
+		{0xFD53, 9525, 3},
+		{0xFD54, 9528, 3},
+		{0xFD55, 9531, 3},
+		{0xFD56, 9534, 3},
+		{0xFD57, 9537, 3},
+		{0xFD58, 9540, 3},
+		{0xFD59, 9543, 3},
+		{0xFD5A, 9546, 3},
+		{0xFD5B, 9549, 3},
+		{0xFD5C, 9552, 3},
+		{0xFD5D, 9555, 3},
+		{0xFD5E, 9558, 3},
+		{0xFD5F, 9561, 3},
+		{0xFD60, 9564, 3},
+		{0xFD61, 9567, 3},
+		{0xFD62, 9570, 3},
+		{0xFD63, 9573, 3},
+		{0xFD64, 9576, 3},
+		{0xFD65, 9579, 3},
+		{0xFD66, 9582, 3},
+		{0xFD67, 9585, 3},
+		{0xFD68, 9588, 3},
+		{0xFD69, 9591, 3},
+		{0xFD6A, 9594, 3},
+		{0xFD6B, 9597, 3},
+		{0xFD6C, 9600, 3},
+		{0xFD6D, 9603, 3},
+		{0xFD6E, 9606, 3},
+		{0xFD6F, 9609, 3},
+		{0xFD70, 9612, 3},
+		{0xFD71, 9615, 3},
+		{0xFD72, 9618, 3},
+		{0xFD73, 9621, 3},
+		{0xFD74, 9624, 3},
+		{0xFD75, 9627, 3},
+		{0xFD76, 9630, 3},
+		{0xFD77, 9633, 3},
+		{0xFD78, 9636, 3},
+		{0xFD79, 9639, 3},
+		{0xFD7A, 9642, 3},
+		{0xFD7B, 9645, 3},
+		{0xFD7C, 9648, 3},
+		{0xFD7D, 9651, 3},
+		{0xFD7E, 9654, 3},
+		{0xFD7F, 9657, 3},
+		{0xFD80, 9660, 3},
+		{0xFD81, 9663, 3},
+		{0xFD82, 9666, 3},
+		{0xFD83, 9669, 3},
+		{0xFD84, 9672, 3},
+		{0xFD85, 9675, 3},
+		{0xFD86, 9678, 3},
+		{0xFD87, 9681, 3},
+		{0xFD88, 9684, 3},
+		{0xFD89, 9687, 3},
+		{0xFD8A, 9690, 3},
+		{0xFD8B, 9693, 3},
+		{0xFD8C, 9696, 3},
+		{0xFD8D, 9699, 3},
+		{0xFD8E, 9702, 3},
+		{0xFD8F, 9705, 3},
+		{0xFD92, 9708, 3},
+		{0xFD93, 9711, 3},
+		{0xFD94, 9714, 3},
+		{0xFD95, 9717, 3},
+		{0xFD96, 9720, 3},
+		{0xFD97, 9723, 3},
+		{0xFD98, 9726, 3},
+		{0xFD99, 9729, 3},
+		{0xFD9A, 9732, 3},
+		{0xFD9B, 9735, 3},
+		{0xFD9C, 9738, 3},
+		{0xFD9D, 9741, 3},
+		{0xFD9E, 9744, 3},
+		{0xFD9F, 9747, 3},
+		{0xFDA0, 9750, 3},
+		{0xFDA1, 9753, 3},
+		{0xFDA2, 9756, 3},
+		{0xFDA3, 9759, 3},
+		{0xFDA4, 9762, 3},
+		{0xFDA5, 9765, 3},
+		{0xFDA6, 9768, 3},
+		{0xFDA7, 9771, 3},
+		{0xFDA8, 9774, 3},
+		{0xFDA9, 9777, 3},
+		{0xFDAA, 9780, 3},
+		{0xFDAB, 9783, 3},
+		{0xFDAC, 9786, 3},
+		{0xFDAD, 9789, 3},
+		{0xFDAE, 9792, 3},
+		{0xFDAF, 9795, 3},
+		{0xFDB0, 9798, 3},
+		{0xFDB1, 9801, 3},
+		{0xFDB2, 9804, 3},
+		{0xFDB3, 9807, 3},
+		{0xFDB4, 9810, 3},
+		{0xFDB5, 9813, 3},
+		{0xFDB6, 9816, 3},
+		{0xFDB7, 9819, 3},
+		{0xFDB8, 9822, 3},
+		{0xFDB9, 9825, 3},
+		{0xFDBA, 9828, 3},
+		{0xFDBB, 9831, 3},
+		{0xFDBC, 9834, 3},
+		{0xFDBD, 9837, 3},
+		{0xFDBE, 9840, 3},
+		{0xFDBF, 9843, 3},
+		{0xFDC0, 9846, 3},
+		{0xFDC1, 9849, 3},
+		{0xFDC2, 9852, 3},
+		{0xFDC3, 9855, 3},
+		{0xFDC4, 9858, 3},
+		{0xFDC5, 9861, 3},
+		{0xFDC6, 9864, 3},
+		{0xFDC7, 9867, 3},
+		{0xFDF0, 9870, 3},
+		{0xFDF1, 9873, 3},
+		{0xFDF2, 9876, 4},
+		{0xFDF3, 9880, 4},
+		{0xFDF4, 9884, 4},
+		{0xFDF5, 9888, 4},
+		{0xFDF6, 9892, 4},
+		{0xFDF7, 9896, 4},
+		{0xFDF8, 9900, 4},
+		{0xFDF9, 9904, 3},
+		{0xFDFA, 9907, 18},
+		{0xFDFB, 9925, 8},
+		{0xFDFC, 9933, 4},
+		{0xFE10, 9937, 1},
+		{0xFE11, 9938, 1},
+		{0xFE12, 9939, 1},
+		{0xFE13, 9940, 1},
+		{0xFE14, 9941, 1},
+		{0xFE15, 9942, 1},
+		{0xFE16, 9943, 1},
+		{0xFE17, 9944, 1},
+		{0xFE18, 9945, 1},
+		{0xFE19, 9946, 3},
+		{0xFE30, 9949, 2},
+		{0xFE31, 9951, 1},
+		{0xFE32, 9952, 1},
+		{0xFE33, 9953, 1},
+		{0xFE34, 9954, 1},
+		{0xFE35, 9955, 1},
+		{0xFE36, 9956, 1},
+		{0xFE37, 9957, 1},
+		{0xFE38, 9958, 1},
+		{0xFE39, 9959, 1},
+		{0xFE3A, 9960, 1},
+		{0xFE3B, 9961, 1},
+		{0xFE3C, 9962, 1},
+		{0xFE3D, 9963, 1},
+		{0xFE3E, 9964, 1},
+		{0xFE3F, 9965, 1},
+		{0xFE40, 9966, 1},
+		{0xFE41, 9967, 1},
+		{0xFE42, 9968, 1},
+		{0xFE43, 9969, 1},
+		{0xFE44, 9970, 1},
+		{0xFE47, 9971, 1},
+		{0xFE48, 9972, 1},
+		{0xFE49, 9973, 2},
+		{0xFE4A, 9975, 2},
+		{0xFE4B, 9977, 2},
+		{0xFE4C, 9979, 2},
+		{0xFE4D, 9981, 1},
+		{0xFE4E, 9982, 1},
+		{0xFE4F, 9983, 1},
+		{0xFE50, 9984, 1},
+		{0xFE51, 9985, 1},
+		{0xFE52, 9986, 1},
+		{0xFE54, 9987, 1},
+		{0xFE55, 9988, 1},
+		{0xFE56, 9989, 1},
+		{0xFE57, 9990, 1},
+		{0xFE58, 9991, 1},
+		{0xFE59, 9992, 1},
+		{0xFE5A, 9993, 1},
+		{0xFE5B, 9994, 1},
+		{0xFE5C, 9995, 1},
+		{0xFE5D, 9996, 1},
+		{0xFE5E, 9997, 1},
+		{0xFE5F, 9998, 1},
+		{0xFE60, 9999, 1},
+		{0xFE61, 10000, 1},
+		{0xFE62, 10001, 1},
+		{0xFE63, 10002, 1},
+		{0xFE64, 10003, 1},
+		{0xFE65, 10004, 1},
+		{0xFE66, 10005, 1},
+		{0xFE68, 10006, 1},
+		{0xFE69, 10007, 1},
+		{0xFE6A, 10008, 1},
+		{0xFE6B, 10009, 1},
+		{0xFE70, 10010, 2},
+		{0xFE71, 10012, 2},
+		{0xFE72, 10014, 2},
+		{0xFE74, 10016, 2},
+		{0xFE76, 10018, 2},
+		{0xFE77, 10020, 2},
+		{0xFE78, 10022, 2},
+		{0xFE79, 10024, 2},
+		{0xFE7A, 10026, 2},
+		{0xFE7B, 10028, 2},
+		{0xFE7C, 10030, 2},
+		{0xFE7D, 10032, 2},
+		{0xFE7E, 10034, 2},
+		{0xFE7F, 10036, 2},
+		{0xFE80, 10038, 1},
+		{0xFE81, 10039, 2},
+		{0xFE82, 10041, 2},
+		{0xFE83, 10043, 2},
+		{0xFE84, 10045, 2},
+		{0xFE85, 10047, 2},
+		{0xFE86, 10049, 2},
+		{0xFE87, 10051, 2},
+		{0xFE88, 10053, 2},
+		{0xFE89, 10055, 2},
+		{0xFE8A, 10057, 2},
+		{0xFE8B, 10059, 2},
+		{0xFE8C, 10061, 2},
+		{0xFE8D, 10063, 1},
+		{0xFE8E, 10064, 1},
+		{0xFE8F, 10065, 1},
+		{0xFE90, 10066, 1},
+		{0xFE91, 10067, 1},
+		{0xFE92, 10068, 1},
+		{0xFE93, 10069, 1},
+		{0xFE94, 10070, 1},
+		{0xFE95, 10071, 1},
+		{0xFE96, 10072, 1},
+		{0xFE97, 10073, 1},
+		{0xFE98, 10074, 1},
+		{0xFE99, 10075, 1},
+		{0xFE9A, 10076, 1},
+		{0xFE9B, 10077, 1},
+		{0xFE9C, 10078, 1},
+		{0xFE9D, 10079, 1},
+		{0xFE9E, 10080, 1},
+		{0xFE9F, 10081, 1},
+		{0xFEA0, 10082, 1},
+		{0xFEA1, 10083, 1},
+		{0xFEA2, 10084, 1},
+		{0xFEA3, 10085, 1},
+		{0xFEA4, 10086, 1},
+		{0xFEA5, 10087, 1},
+		{0xFEA6, 10088, 1},
+		{0xFEA7, 10089, 1},
+		{0xFEA8, 10090, 1},
+		{0xFEA9, 10091, 1},
+		{0xFEAA, 10092, 1},
+		{0xFEAB, 10093, 1},
+		{0xFEAC, 10094, 1},
+		{0xFEAD, 10095, 1},
+		{0xFEAE, 10096, 1},
+		{0xFEAF, 10097, 1},
+		{0xFEB0, 10098, 1},
+		{0xFEB1, 10099, 1},
+		{0xFEB2, 10100, 1},
+		{0xFEB3, 10101, 1},
+		{0xFEB4, 10102, 1},
+		{0xFEB5, 10103, 1},
+		{0xFEB6, 10104, 1},
+		{0xFEB7, 10105, 1},
+		{0xFEB8, 10106, 1},
+		{0xFEB9, 10107, 1},
+		{0xFEBA, 10108, 1},
+		{0xFEBB, 10109, 1},
+		{0xFEBC, 10110, 1},
+		{0xFEBD, 10111, 1},
+		{0xFEBE, 10112, 1},
+		{0xFEBF, 10113, 1},
+		{0xFEC0, 10114, 1},
+		{0xFEC1, 10115, 1},
+		{0xFEC2, 10116, 1},
+		{0xFEC3, 10117, 1},
+		{0xFEC4, 10118, 1},
+		{0xFEC5, 10119, 1},
+		{0xFEC6, 10120, 1},
+		{0xFEC7, 10121, 1},
+		{0xFEC8, 10122, 1},
+		{0xFEC9, 10123, 1},
+		{0xFECA, 10124, 1},
+		{0xFECB, 10125, 1},
+		{0xFECC, 10126, 1},
+		{0xFECD, 10127, 1},
+		{0xFECE, 10128, 1},
+		{0xFECF, 10129, 1},
+		{0xFED0, 10130, 1},
+		{0xFED1, 10131, 1},
+		{0xFED2, 10132, 1},
+		{0xFED3, 10133, 1},
+		{0xFED4, 10134, 1},
+		{0xFED5, 10135, 1},
+		{0xFED6, 10136, 1},
+		{0xFED7, 10137, 1},
+		{0xFED8, 10138, 1},
+		{0xFED9, 10139, 1},
+		{0xFEDA, 10140, 1},
+		{0xFEDB, 10141, 1},
+		{0xFEDC, 10142, 1},
+		{0xFEDD, 10143, 1},
+		{0xFEDE, 10144, 1},
+		{0xFEDF, 10145, 1},
+		{0xFEE0, 10146, 1},
+		{0xFEE1, 10147, 1},
+		{0xFEE2, 10148, 1},
+		{0xFEE3, 10149, 1},
+		{0xFEE4, 10150, 1},
+		{0xFEE5, 10151, 1},
+		{0xFEE6, 10152, 1},
+		{0xFEE7, 10153, 1},
+		{0xFEE8, 10154, 1},
+		{0xFEE9, 10155, 1},
+		{0xFEEA, 10156, 1},
+		{0xFEEB, 10157, 1},
+		{0xFEEC, 10158, 1},
+		{0xFEED, 10159, 1},
+		{0xFEEE, 10160, 1},
+		{0xFEEF, 10161, 1},
+		{0xFEF0, 10162, 1},
+		{0xFEF1, 10163, 1},
+		{0xFEF2, 10164, 1},
+		{0xFEF3, 10165, 1},
+		{0xFEF4, 10166, 1},
+		{0xFEF5, 10167, 3},
+		{0xFEF6, 10170, 3},
+		{0xFEF7, 10173, 3},
+		{0xFEF8, 10176, 3},
+		{0xFEF9, 10179, 3},
+		{0xFEFA, 10182, 3},
+		{0xFEFB, 10185, 2},
+		{0xFEFC, 10187, 2},
+		{0xFF01, 10189, 1},
+		{0xFF02, 10190, 1},
+		{0xFF03, 10191, 1},
+		{0xFF04, 10192, 1},
+		{0xFF05, 10193, 1},
+		{0xFF06, 10194, 1},
+		{0xFF07, 10195, 1},
+		{0xFF08, 10196, 1},
+		{0xFF09, 10197, 1},
+		{0xFF0A, 10198, 1},
+		{0xFF0B, 10199, 1},
+		{0xFF0C, 10200, 1},
+		{0xFF0D, 10201, 1},
+		{0xFF0E, 10202, 1},
+		{0xFF0F, 10203, 1},
+		{0xFF10, 10204, 1},
+		{0xFF11, 10205, 1},
+		{0xFF12, 10206, 1},
+		{0xFF13, 10207, 1},
+		{0xFF14, 10208, 1},
+		{0xFF15, 10209, 1},
+		{0xFF16, 10210, 1},
+		{0xFF17, 10211, 1},
+		{0xFF18, 10212, 1},
+		{0xFF19, 10213, 1},
+		{0xFF1A, 10214, 1},
+		{0xFF1B, 10215, 1},
+		{0xFF1C, 10216, 1},
+		{0xFF1D, 10217, 1},
+		{0xFF1E, 10218, 1},
+		{0xFF1F, 10219, 1},
+		{0xFF20, 10220, 1},
+		{0xFF21, 10221, 1},
+		{0xFF22, 10222, 1},
+		{0xFF23, 10223, 1},
+		{0xFF24, 10224, 1},
+		{0xFF25, 10225, 1},
+		{0xFF26, 10226, 1},
+		{0xFF27, 10227, 1},
+		{0xFF28, 10228, 1},
+		{0xFF29, 10229, 1},
+		{0xFF2A, 10230, 1},
+		{0xFF2B, 10231, 1},
+		{0xFF2C, 10232, 1},
+		{0xFF2D, 10233, 1},
+		{0xFF2E, 10234, 1},
+		{0xFF2F, 10235, 1},
+		{0xFF30, 10236, 1},
+		{0xFF31, 10237, 1},
+		{0xFF32, 10238, 1},
+		{0xFF33, 10239, 1},
+		{0xFF34, 10240, 1},
+		{0xFF35, 10241, 1},
+		{0xFF36, 10242, 1},
+		{0xFF37, 10243, 1},
+		{0xFF38, 10244, 1},
+		{0xFF39, 10245, 1},
+		{0xFF3A, 10246, 1},
+		{0xFF3B, 10247, 1},
+		{0xFF3C, 10248, 1},
+		{0xFF3D, 10249, 1},
+		{0xFF3E, 10250, 1},
+		{0xFF3F, 10251, 1},
+		{0xFF40, 10252, 1},
+		{0xFF41, 10253, 1},
+		{0xFF42, 10254, 1},
+		{0xFF43, 10255, 1},
+		{0xFF44, 10256, 1},
+		{0xFF45, 10257, 1},
+		{0xFF46, 10258, 1},
+		{0xFF47, 10259, 1},
+		{0xFF48, 10260, 1},
+		{0xFF49, 10261, 1},
+		{0xFF4A, 10262, 1},
+		{0xFF4B, 10263, 1},
+		{0xFF4C, 10264, 1},
+		{0xFF4D, 10265, 1},
+		{0xFF4E, 10266, 1},
+		{0xFF4F, 10267, 1},
+		{0xFF50, 10268, 1},
+		{0xFF51, 10269, 1},
+		{0xFF52, 10270, 1},
+		{0xFF53, 10271, 1},
+		{0xFF54, 10272, 1},
+		{0xFF55, 10273, 1},
+		{0xFF56, 10274, 1},
+		{0xFF57, 10275, 1},
+		{0xFF58, 10276, 1},
+		{0xFF59, 10277, 1},
+		{0xFF5A, 10278, 1},
+		{0xFF5B, 10279, 1},
+		{0xFF5C, 10280, 1},
+		{0xFF5D, 10281, 1},
+		{0xFF5E, 10282, 1},
+		{0xFF5F, 10283, 1},
+		{0xFF60, 10284, 1},
+		{0xFF61, 10285, 1},
+		{0xFF62, 10286, 1},
+		{0xFF63, 10287, 1},
+		{0xFF64, 10288, 1},
+		{0xFF65, 10289, 1},
+		{0xFF66, 10290, 1},
+		{0xFF67, 10291, 1},
+		{0xFF68, 10292, 1},
+		{0xFF69, 10293, 1},
+		{0xFF6A, 10294, 1},
+		{0xFF6B, 10295, 1},
+		{0xFF6C, 10296, 1},
+		{0xFF6D, 10297, 1},
+		{0xFF6E, 10298, 1},
+		{0xFF6F, 10299, 1},
+		{0xFF70, 10300, 1},
+		{0xFF71, 10301, 1},
+		{0xFF72, 10302, 1},
+		{0xFF73, 10303, 1},
+		{0xFF74, 10304, 1},
+		{0xFF75, 10305, 1},
+		{0xFF76, 10306, 1},
+		{0xFF77, 10307, 1},
+		{0xFF78, 10308, 1},
+		{0xFF79, 10309, 1},
+		{0xFF7A, 10310, 1},
+		{0xFF7B, 10311, 1},
+		{0xFF7C, 10312, 1},
+		{0xFF7D, 10313, 1},
+		{0xFF7E, 10314, 1},
+		{0xFF7F, 10315, 1},
+		{0xFF80, 10316, 1},
+		{0xFF81, 10317, 1},
+		{0xFF82, 10318, 1},
+		{0xFF83, 10319, 1},
+		{0xFF84, 10320, 1},
+		{0xFF85, 10321, 1},
+		{0xFF86, 10322, 1},
+		{0xFF87, 10323, 1},
+		{0xFF88, 10324, 1},
+		{0xFF89, 10325, 1},
+		{0xFF8A, 10326, 1},
+		{0xFF8B, 10327, 1},
+		{0xFF8C, 10328, 1},
+		{0xFF8D, 10329, 1},
+		{0xFF8E, 10330, 1},
+		{0xFF8F, 10331, 1},
+		{0xFF90, 10332, 1},
+		{0xFF91, 10333, 1},
+		{0xFF92, 10334, 1},
+		{0xFF93, 10335, 1},
+		{0xFF94, 10336, 1},
+		{0xFF95, 10337, 1},
+		{0xFF96, 10338, 1},
+		{0xFF97, 10339, 1},
+		{0xFF98, 10340, 1},
+		{0xFF99, 10341, 1},
+		{0xFF9A, 10342, 1},
+		{0xFF9B, 10343, 1},
+		{0xFF9C, 10344, 1},
+		{0xFF9D, 10345, 1},
+		{0xFF9E, 10346, 1},
+		{0xFF9F, 10347, 1},
+		{0xFFA0, 10348, 1},
+		{0xFFA1, 10349, 1},
+		{0xFFA2, 10350, 1},
+		{0xFFA3, 10351, 1},
+		{0xFFA4, 10352, 1},
+		{0xFFA5, 10353, 1},
+		{0xFFA6, 10354, 1},
+		{0xFFA7, 10355, 1},
+		{0xFFA8, 10356, 1},
+		{0xFFA9, 10357, 1},
+		{0xFFAA, 10358, 1},
+		{0xFFAB, 10359, 1},
+		{0xFFAC, 10360, 1},
+		{0xFFAD, 10361, 1},
+		{0xFFAE, 10362, 1},
+		{0xFFAF, 10363, 1},
+		{0xFFB0, 10364, 1},
+		{0xFFB1, 10365, 1},
+		{0xFFB2, 10366, 1},
+		{0xFFB3, 10367, 1},
+		{0xFFB4, 10368, 1},
+		{0xFFB5, 10369, 1},
+		{0xFFB6, 10370, 1},
+		{0xFFB7, 10371, 1},
+		{0xFFB8, 10372, 1},
+		{0xFFB9, 10373, 1},
+		{0xFFBA, 10374, 1},
+		{0xFFBB, 10375, 1},
+		{0xFFBC, 10376, 1},
+		{0xFFBD, 10377, 1},
+		{0xFFBE, 10378, 1},
+		{0xFFC2, 10379, 1},
+		{0xFFC3, 10380, 1},
+		{0xFFC4, 10381, 1},
+		{0xFFC5, 10382, 1},
+		{0xFFC6, 10383, 1},
+		{0xFFC7, 10384, 1},
+		{0xFFCA, 10385, 1},
+		{0xFFCB, 10386, 1},
+		{0xFFCC, 10387, 1},
+		{0xFFCD, 10388, 1},
+		{0xFFCE, 10389, 1},
+		{0xFFCF, 10390, 1},
+		{0xFFD2, 10391, 1},
+		{0xFFD3, 10392, 1},
+		{0xFFD4, 10393, 1},
+		{0xFFD5, 10394, 1},
+		{0xFFD6, 10395, 1},
+		{0xFFD7, 10396, 1},
+		{0xFFDA, 10397, 1},
+		{0xFFDB, 10398, 1},
+		{0xFFDC, 10399, 1},
+		{0xFFE0, 10400, 1},
+		{0xFFE1, 10401, 1},
+		{0xFFE2, 10402, 1},
+		{0xFFE3, 10403, 2},
+		{0xFFE4, 10405, 1},
+		{0xFFE5, 10406, 1},
+		{0xFFE6, 10407, 1},
+		{0xFFE8, 10408, 1},
+		{0xFFE9, 10409, 1},
+		{0xFFEA, 10410, 1},
+		{0xFFEB, 10411, 1},
+		{0xFFEC, 10412, 1},
+		{0xFFED, 10413, 1},
+		{0xFFEE, 10414, 1},
+		{0x10781, 10415, 1},
+		{0x10782, 10416, 1},
+		{0x10783, 10417, 1},
+		{0x10784, 10418, 1},
+		{0x10785, 10419, 1},
+		{0x10787, 10420, 1},
+		{0x10788, 10421, 1},
+		{0x10789, 10422, 1},
+		{0x1078A, 10423, 1},
+		{0x1078B, 10424, 1},
+		{0x1078C, 10425, 1},
+		{0x1078D, 10426, 1},
+		{0x1078E, 10427, 1},
+		{0x1078F, 10428, 1},
+		{0x10790, 10429, 1},
+		{0x10791, 10430, 1},
+		{0x10792, 10431, 1},
+		{0x10793, 10432, 1},
+		{0x10794, 10433, 1},
+		{0x10795, 10434, 1},
+		{0x10796, 10435, 1},
+		{0x10797, 10436, 1},
+		{0x10798, 10437, 1},
+		{0x10799, 10438, 1},
+		{0x1079A, 10439, 1},
+		{0x1079B, 10440, 1},
+		{0x1079C, 10441, 1},
+		{0x1079D, 10442, 1},
+		{0x1079E, 10443, 1},
+		{0x1079F, 10444, 1},
+		{0x107A0, 10445, 1},
+		{0x107A1, 10446, 1},
+		{0x107A2, 10447, 1},
+		{0x107A3, 10448, 1},
+		{0x107A4, 10449, 1},
+		{0x107A5, 10450, 1},
+		{0x107A6, 10451, 1},
+		{0x107A7, 10452, 1},
+		{0x107A8, 10453, 1},
+		{0x107A9, 10454, 1},
+		{0x107AA, 10455, 1},
+		{0x107AB, 10456, 1},
+		{0x107AC, 10457, 1},
+		{0x107AD, 10458, 1},
+		{0x107AE, 10459, 1},
+		{0x107AF, 10460, 1},
+		{0x107B0, 10461, 1},
+		{0x107B2, 10462, 1},
+		{0x107B3, 10463, 1},
+		{0x107B4, 10464, 1},
+		{0x107B5, 10465, 1},
+		{0x107B6, 10466, 1},
+		{0x107B7, 10467, 1},
+		{0x107B8, 10468, 1},
+		{0x107B9, 10469, 1},
+		{0x107BA, 10470, 1},
+		{0x1109A, 10471, 2},
+		{0x1109C, 10473, 2},
+		{0x110AB, 10475, 2},
+		{0x1112E, 10477, 2},
+		{0x1112F, 10479, 2},
+		{0x1134B, 10481, 2},
+		{0x1134C, 10483, 2},
+		{0x114BB, 10485, 2},
+		{0x114BC, 10487, 2},
+		{0x114BE, 10489, 2},
+		{0x115BA, 10491, 2},
+		{0x115BB, 10493, 2},
+		{0x11938, 10495, 2},
+		{0x1D15E, 10497, 2},
+		{0x1D15F, 10499, 2},
+		{0x1D160, 10501, 3},
+		{0x1D161, 10504, 3},
+		{0x1D162, 10507, 3},
+		{0x1D163, 10510, 3},
+		{0x1D164, 10513, 3},
+		{0x1D1BB, 10516, 2},
+		{0x1D1BC, 10518, 2},
+		{0x1D1BD, 10520, 3},
+		{0x1D1BE, 10523, 3},
+		{0x1D1BF, 10526, 3},
+		{0x1D1C0, 10529, 3},
+		{0x1D400, 10532, 1},
+		{0x1D401, 10533, 1},
+		{0x1D402, 10534, 1},
+		{0x1D403, 10535, 1},
+		{0x1D404, 10536, 1},
+		{0x1D405, 10537, 1},
+		{0x1D406, 10538, 1},
+		{0x1D407, 10539, 1},
+		{0x1D408, 10540, 1},
+		{0x1D409, 10541, 1},
+		{0x1D40A, 10542, 1},
+		{0x1D40B, 10543, 1},
+		{0x1D40C, 10544, 1},
+		{0x1D40D, 10545, 1},
+		{0x1D40E, 10546, 1},
+		{0x1D40F, 10547, 1},
+		{0x1D410, 10548, 1},
+		{0x1D411, 10549, 1},
+		{0x1D412, 10550, 1},
+		{0x1D413, 10551, 1},
+		{0x1D414, 10552, 1},
+		{0x1D415, 10553, 1},
+		{0x1D416, 10554, 1},
+		{0x1D417, 10555, 1},
+		{0x1D418, 10556, 1},
+		{0x1D419, 10557, 1},
+		{0x1D41A, 10558, 1},
+		{0x1D41B, 10559, 1},
+		{0x1D41C, 10560, 1},
+		{0x1D41D, 10561, 1},
+		{0x1D41E, 10562, 1},
+		{0x1D41F, 10563, 1},
+		{0x1D420, 10564, 1},
+		{0x1D421, 10565, 1},
+		{0x1D422, 10566, 1},
+		{0x1D423, 10567, 1},
+		{0x1D424, 10568, 1},
+		{0x1D425, 10569, 1},
+		{0x1D426, 10570, 1},
+		{0x1D427, 10571, 1},
+		{0x1D428, 10572, 1},
+		{0x1D429, 10573, 1},
+		{0x1D42A, 10574, 1},
+		{0x1D42B, 10575, 1},
+		{0x1D42C, 10576, 1},
+		{0x1D42D, 10577, 1},
+		{0x1D42E, 10578, 1},
+		{0x1D42F, 10579, 1},
+		{0x1D430, 10580, 1},
+		{0x1D431, 10581, 1},
+		{0x1D432, 10582, 1},
+		{0x1D433, 10583, 1},
+		{0x1D434, 10584, 1},
+		{0x1D435, 10585, 1},
+		{0x1D436, 10586, 1},
+		{0x1D437, 10587, 1},
+		{0x1D438, 10588, 1},
+		{0x1D439, 10589, 1},
+		{0x1D43A, 10590, 1},
+		{0x1D43B, 10591, 1},
+		{0x1D43C, 10592, 1},
+		{0x1D43D, 10593, 1},
+		{0x1D43E, 10594, 1},
+		{0x1D43F, 10595, 1},
+		{0x1D440, 10596, 1},
+		{0x1D441, 10597, 1},
+		{0x1D442, 10598, 1},
+		{0x1D443, 10599, 1},
+		{0x1D444, 10600, 1},
+		{0x1D445, 10601, 1},
+		{0x1D446, 10602, 1},
+		{0x1D447, 10603, 1},
+		{0x1D448, 10604, 1},
+		{0x1D449, 10605, 1},
+		{0x1D44A, 10606, 1},
+		{0x1D44B, 10607, 1},
+		{0x1D44C, 10608, 1},
+		{0x1D44D, 10609, 1},
+		{0x1D44E, 10610, 1},
+		{0x1D44F, 10611, 1},
+		{0x1D450, 10612, 1},
+		{0x1D451, 10613, 1},
+		{0x1D452, 10614, 1},
+		{0x1D453, 10615, 1},
+		{0x1D454, 10616, 1},
+		{0x1D456, 10617, 1},
+		{0x1D457, 10618, 1},
+		{0x1D458, 10619, 1},
+		{0x1D459, 10620, 1},
+		{0x1D45A, 10621, 1},
+		{0x1D45B, 10622, 1},
+		{0x1D45C, 10623, 1},
+		{0x1D45D, 10624, 1},
+		{0x1D45E, 10625, 1},
+		{0x1D45F, 10626, 1},
+		{0x1D460, 10627, 1},
+		{0x1D461, 10628, 1},
+		{0x1D462, 10629, 1},
+		{0x1D463, 10630, 1},
+		{0x1D464, 10631, 1},
+		{0x1D465, 10632, 1},
+		{0x1D466, 10633, 1},
+		{0x1D467, 10634, 1},
+		{0x1D468, 10635, 1},
+		{0x1D469, 10636, 1},
+		{0x1D46A, 10637, 1},
+		{0x1D46B, 10638, 1},
+		{0x1D46C, 10639, 1},
+		{0x1D46D, 10640, 1},
+		{0x1D46E, 10641, 1},
+		{0x1D46F, 10642, 1},
+		{0x1D470, 10643, 1},
+		{0x1D471, 10644, 1},
+		{0x1D472, 10645, 1},
+		{0x1D473, 10646, 1},
+		{0x1D474, 10647, 1},
+		{0x1D475, 10648, 1},
+		{0x1D476, 10649, 1},
+		{0x1D477, 10650, 1},
+		{0x1D478, 10651, 1},
+		{0x1D479, 10652, 1},
+		{0x1D47A, 10653, 1},
+		{0x1D47B, 10654, 1},
+		{0x1D47C, 10655, 1},
+		{0x1D47D, 10656, 1},
+		{0x1D47E, 10657, 1},
+		{0x1D47F, 10658, 1},
+		{0x1D480, 10659, 1},
+		{0x1D481, 10660, 1},
+		{0x1D482, 10661, 1},
+		{0x1D483, 10662, 1},
+		{0x1D484, 10663, 1},
+		{0x1D485, 10664, 1},
+		{0x1D486, 10665, 1},
+		{0x1D487, 10666, 1},
+		{0x1D488, 10667, 1},
+		{0x1D489, 10668, 1},
+		{0x1D48A, 10669, 1},
+		{0x1D48B, 10670, 1},
+		{0x1D48C, 10671, 1},
+		{0x1D48D, 10672, 1},
+		{0x1D48E, 10673, 1},
+		{0x1D48F, 10674, 1},
+		{0x1D490, 10675, 1},
+		{0x1D491, 10676, 1},
+		{0x1D492, 10677, 1},
+		{0x1D493, 10678, 1},
+		{0x1D494, 10679, 1},
+		{0x1D495, 10680, 1},
+		{0x1D496, 10681, 1},
+		{0x1D497, 10682, 1},
+		{0x1D498, 10683, 1},
+		{0x1D499, 10684, 1},
+		{0x1D49A, 10685, 1},
+		{0x1D49B, 10686, 1},
+		{0x1D49C, 10687, 1},
+		{0x1D49E, 10688, 1},
+		{0x1D49F, 10689, 1},
+		{0x1D4A2, 10690, 1},
+		{0x1D4A5, 10691, 1},
+		{0x1D4A6, 10692, 1},
+		{0x1D4A9, 10693, 1},
+		{0x1D4AA, 10694, 1},
+		{0x1D4AB, 10695, 1},
+		{0x1D4AC, 10696, 1},
+		{0x1D4AE, 10697, 1},
+		{0x1D4AF, 10698, 1},
+		{0x1D4B0, 10699, 1},
+		{0x1D4B1, 10700, 1},
+		{0x1D4B2, 10701, 1},
+		{0x1D4B3, 10702, 1},
+		{0x1D4B4, 10703, 1},
+		{0x1D4B5, 10704, 1},
+		{0x1D4B6, 10705, 1},
+		{0x1D4B7, 10706, 1},
+		{0x1D4B8, 10707, 1},
+		{0x1D4B9, 10708, 1},
+		{0x1D4BB, 10709, 1},
+		{0x1D4BD, 10710, 1},
+		{0x1D4BE, 10711, 1},
+		{0x1D4BF, 10712, 1},
+		{0x1D4C0, 10713, 1},
+		{0x1D4C1, 10714, 1},
+		{0x1D4C2, 10715, 1},
+		{0x1D4C3, 10716, 1},
+		{0x1D4C5, 10717, 1},
+		{0x1D4C6, 10718, 1},
+		{0x1D4C7, 10719, 1},
+		{0x1D4C8, 10720, 1},
+		{0x1D4C9, 10721, 1},
+		{0x1D4CA, 10722, 1},
+		{0x1D4CB, 10723, 1},
+		{0x1D4CC, 10724, 1},
+		{0x1D4CD, 10725, 1},
+		{0x1D4CE, 10726, 1},
+		{0x1D4CF, 10727, 1},
+		{0x1D4D0, 10728, 1},
+		{0x1D4D1, 10729, 1},
+		{0x1D4D2, 10730, 1},
+		{0x1D4D3, 10731, 1},
+		{0x1D4D4, 10732, 1},
+		{0x1D4D5, 10733, 1},
+		{0x1D4D6, 10734, 1},
+		{0x1D4D7, 10735, 1},
+		{0x1D4D8, 10736, 1},
+		{0x1D4D9, 10737, 1},
+		{0x1D4DA, 10738, 1},
+		{0x1D4DB, 10739, 1},
+		{0x1D4DC, 10740, 1},
+		{0x1D4DD, 10741, 1},
+		{0x1D4DE, 10742, 1},
+		{0x1D4DF, 10743, 1},
+		{0x1D4E0, 10744, 1},
+		{0x1D4E1, 10745, 1},
+		{0x1D4E2, 10746, 1},
+		{0x1D4E3, 10747, 1},
+		{0x1D4E4, 10748, 1},
+		{0x1D4E5, 10749, 1},
+		{0x1D4E6, 10750, 1},
+		{0x1D4E7, 10751, 1},
+		{0x1D4E8, 10752, 1},
+		{0x1D4E9, 10753, 1},
+		{0x1D4EA, 10754, 1},
+		{0x1D4EB, 10755, 1},
+		{0x1D4EC, 10756, 1},
+		{0x1D4ED, 10757, 1},
+		{0x1D4EE, 10758, 1},
+		{0x1D4EF, 10759, 1},
+		{0x1D4F0, 10760, 1},
+		{0x1D4F1, 10761, 1},
+		{0x1D4F2, 10762, 1},
+		{0x1D4F3, 10763, 1},
+		{0x1D4F4, 10764, 1},
+		{0x1D4F5, 10765, 1},
+		{0x1D4F6, 10766, 1},
+		{0x1D4F7, 10767, 1},
+		{0x1D4F8, 10768, 1},
+		{0x1D4F9, 10769, 1},
+		{0x1D4FA, 10770, 1},
+		{0x1D4FB, 10771, 1},
+		{0x1D4FC, 10772, 1},
+		{0x1D4FD, 10773, 1},
+		{0x1D4FE, 10774, 1},
+		{0x1D4FF, 10775, 1},
+		{0x1D500, 10776, 1},
+		{0x1D501, 10777, 1},
+		{0x1D502, 10778, 1},
+		{0x1D503, 10779, 1},
+		{0x1D504, 10780, 1},
+		{0x1D505, 10781, 1},
+		{0x1D507, 10782, 1},
+		{0x1D508, 10783, 1},
+		{0x1D509, 10784, 1},
+		{0x1D50A, 10785, 1},
+		{0x1D50D, 10786, 1},
+		{0x1D50E, 10787, 1},
+		{0x1D50F, 10788, 1},
+		{0x1D510, 10789, 1},
+		{0x1D511, 10790, 1},
+		{0x1D512, 10791, 1},
+		{0x1D513, 10792, 1},
+		{0x1D514, 10793, 1},
+		{0x1D516, 10794, 1},
+		{0x1D517, 10795, 1},
+		{0x1D518, 10796, 1},
+		{0x1D519, 10797, 1},
+		{0x1D51A, 10798, 1},
+		{0x1D51B, 10799, 1},
+		{0x1D51C, 10800, 1},
+		{0x1D51E, 10801, 1},
+		{0x1D51F, 10802, 1},
+		{0x1D520, 10803, 1},
+		{0x1D521, 10804, 1},
+		{0x1D522, 10805, 1},
+		{0x1D523, 10806, 1},
+		{0x1D524, 10807, 1},
+		{0x1D525, 10808, 1},
+		{0x1D526, 10809, 1},
+		{0x1D527, 10810, 1},
+		{0x1D528, 10811, 1},
+		{0x1D529, 10812, 1},
+		{0x1D52A, 10813, 1},
+		{0x1D52B, 10814, 1},
+		{0x1D52C, 10815, 1},
+		{0x1D52D, 10816, 1},
+		{0x1D52E, 10817, 1},
+		{0x1D52F, 10818, 1},
+		{0x1D530, 10819, 1},
+		{0x1D531, 10820, 1},
+		{0x1D532, 10821, 1},
+		{0x1D533, 10822, 1},
+		{0x1D534, 10823, 1},
+		{0x1D535, 10824, 1},
+		{0x1D536, 10825, 1},
+		{0x1D537, 10826, 1},
+		{0x1D538, 10827, 1},
+		{0x1D539, 10828, 1},
+		{0x1D53B, 10829, 1},
+		{0x1D53C, 10830, 1},
+		{0x1D53D, 10831, 1},
+		{0x1D53E, 10832, 1},
+		{0x1D540, 10833, 1},
+		{0x1D541, 10834, 1},
+		{0x1D542, 10835, 1},
+		{0x1D543, 10836, 1},
+		{0x1D544, 10837, 1},
+		{0x1D546, 10838, 1},
+		{0x1D54A, 10839, 1},
+		{0x1D54B, 10840, 1},
+		{0x1D54C, 10841, 1},
+		{0x1D54D, 10842, 1},
+		{0x1D54E, 10843, 1},
+		{0x1D54F, 10844, 1},
+		{0x1D550, 10845, 1},
+		{0x1D552, 10846, 1},
+		{0x1D553, 10847, 1},
+		{0x1D554, 10848, 1},
+		{0x1D555, 10849, 1},
+		{0x1D556, 10850, 1},
+		{0x1D557, 10851, 1},
+		{0x1D558, 10852, 1},
+		{0x1D559, 10853, 1},
+		{0x1D55A, 10854, 1},
+		{0x1D55B, 10855, 1},
+		{0x1D55C, 10856, 1},
+		{0x1D55D, 10857, 1},
+		{0x1D55E, 10858, 1},
+		{0x1D55F, 10859, 1},
+		{0x1D560, 10860, 1},
+		{0x1D561, 10861, 1},
+		{0x1D562, 10862, 1},
+		{0x1D563, 10863, 1},
+		{0x1D564, 10864, 1},
+		{0x1D565, 10865, 1},
+		{0x1D566, 10866, 1},
+		{0x1D567, 10867, 1},
+		{0x1D568, 10868, 1},
+		{0x1D569, 10869, 1},
+		{0x1D56A, 10870, 1},
+		{0x1D56B, 10871, 1},
+		{0x1D56C, 10872, 1},
+		{0x1D56D, 10873, 1},
+		{0x1D56E, 10874, 1},
+		{0x1D56F, 10875, 1},
+		{0x1D570, 10876, 1},
+		{0x1D571, 10877, 1},
+		{0x1D572, 10878, 1},
+		{0x1D573, 10879, 1},
+		{0x1D574, 10880, 1},
+		{0x1D575, 10881, 1},
+		{0x1D576, 10882, 1},
+		{0x1D577, 10883, 1},
+		{0x1D578, 10884, 1},
+		{0x1D579, 10885, 1},
+		{0x1D57A, 10886, 1},
+		{0x1D57B, 10887, 1},
+		{0x1D57C, 10888, 1},
+		{0x1D57D, 10889, 1},
+		{0x1D57E, 10890, 1},
+		{0x1D57F, 10891, 1},
+		{0x1D580, 10892, 1},
+		{0x1D581, 10893, 1},
+		{0x1D582, 10894, 1},
+		{0x1D583, 10895, 1},
+		{0x1D584, 10896, 1},
+		{0x1D585, 10897, 1},
+		{0x1D586, 10898, 1},
+		{0x1D587, 10899, 1},
+		{0x1D588, 10900, 1},
+		{0x1D589, 10901, 1},
+		{0x1D58A, 10902, 1},
+		{0x1D58B, 10903, 1},
+		{0x1D58C, 10904, 1},
+		{0x1D58D, 10905, 1},
+		{0x1D58E, 10906, 1},
+		{0x1D58F, 10907, 1},
+		{0x1D590, 10908, 1},
+		{0x1D591, 10909, 1},
+		{0x1D592, 10910, 1},
+		{0x1D593, 10911, 1},
+		{0x1D594, 10912, 1},
+		{0x1D595, 10913, 1},
+		{0x1D596, 10914, 1},
+		{0x1D597, 10915, 1},
+		{0x1D598, 10916, 1},
+		{0x1D599, 10917, 1},
+		{0x1D59A, 10918, 1},
+		{0x1D59B, 10919, 1},
+		{0x1D59C, 10920, 1},
+		{0x1D59D, 10921, 1},
+		{0x1D59E, 10922, 1},
+		{0x1D59F, 10923, 1},
+		{0x1D5A0, 10924, 1},
+		{0x1D5A1, 10925, 1},
+		{0x1D5A2, 10926, 1},
+		{0x1D5A3, 10927, 1},
+		{0x1D5A4, 10928, 1},
+		{0x1D5A5, 10929, 1},
+		{0x1D5A6, 10930, 1},
+		{0x1D5A7, 10931, 1},
+		{0x1D5A8, 10932, 1},
+		{0x1D5A9, 10933, 1},
+		{0x1D5AA, 10934, 1},
+		{0x1D5AB, 10935, 1},
+		{0x1D5AC, 10936, 1},
+		{0x1D5AD, 10937, 1},
+		{0x1D5AE, 10938, 1},
+		{0x1D5AF, 10939, 1},
+		{0x1D5B0, 10940, 1},
+		{0x1D5B1, 10941, 1},
+		{0x1D5B2, 10942, 1},
+		{0x1D5B3, 10943, 1},
+		{0x1D5B4, 10944, 1},
+		{0x1D5B5, 10945, 1},
+		{0x1D5B6, 10946, 1},
+		{0x1D5B7, 10947, 1},
+		{0x1D5B8, 10948, 1},
+		{0x1D5B9, 10949, 1},
+		{0x1D5BA, 10950, 1},
+		{0x1D5BB, 10951, 1},
+		{0x1D5BC, 10952, 1},
+		{0x1D5BD, 10953, 1},
+		{0x1D5BE, 10954, 1},
+		{0x1D5BF, 10955, 1},
+		{0x1D5C0, 10956, 1},
+		{0x1D5C1, 10957, 1},
+		{0x1D5C2, 10958, 1},
+		{0x1D5C3, 10959, 1},
+		{0x1D5C4, 10960, 1},
+		{0x1D5C5, 10961, 1},
+		{0x1D5C6, 10962, 1},
+		{0x1D5C7, 10963, 1},
+		{0x1D5C8, 10964, 1},
+		{0x1D5C9, 10965, 1},
+		{0x1D5CA, 10966, 1},
+		{0x1D5CB, 10967, 1},
+		{0x1D5CC, 10968, 1},
+		{0x1D5CD, 10969, 1},
+		{0x1D5CE, 10970, 1},
+		{0x1D5CF, 10971, 1},
+		{0x1D5D0, 10972, 1},
+		{0x1D5D1, 10973, 1},
+		{0x1D5D2, 10974, 1},
+		{0x1D5D3, 10975, 1},
+		{0x1D5D4, 10976, 1},
+		{0x1D5D5, 10977, 1},
+		{0x1D5D6, 10978, 1},
+		{0x1D5D7, 10979, 1},
+		{0x1D5D8, 10980, 1},
+		{0x1D5D9, 10981, 1},
+		{0x1D5DA, 10982, 1},
+		{0x1D5DB, 10983, 1},
+		{0x1D5DC, 10984, 1},
+		{0x1D5DD, 10985, 1},
+		{0x1D5DE, 10986, 1},
+		{0x1D5DF, 10987, 1},
+		{0x1D5E0, 10988, 1},
+		{0x1D5E1, 10989, 1},
+		{0x1D5E2, 10990, 1},
+		{0x1D5E3, 10991, 1},
+		{0x1D5E4, 10992, 1},
+		{0x1D5E5, 10993, 1},
+		{0x1D5E6, 10994, 1},
+		{0x1D5E7, 10995, 1},
+		{0x1D5E8, 10996, 1},
+		{0x1D5E9, 10997, 1},
+		{0x1D5EA, 10998, 1},
+		{0x1D5EB, 10999, 1},
+		{0x1D5EC, 11000, 1},
+		{0x1D5ED, 11001, 1},
+		{0x1D5EE, 11002, 1},
+		{0x1D5EF, 11003, 1},
+		{0x1D5F0, 11004, 1},
+		{0x1D5F1, 11005, 1},
+		{0x1D5F2, 11006, 1},
+		{0x1D5F3, 11007, 1},
+		{0x1D5F4, 11008, 1},
+		{0x1D5F5, 11009, 1},
+		{0x1D5F6, 11010, 1},
+		{0x1D5F7, 11011, 1},
+		{0x1D5F8, 11012, 1},
+		{0x1D5F9, 11013, 1},
+		{0x1D5FA, 11014, 1},
+		{0x1D5FB, 11015, 1},
+		{0x1D5FC, 11016, 1},
+		{0x1D5FD, 11017, 1},
+		{0x1D5FE, 11018, 1},
+		{0x1D5FF, 11019, 1},
+		{0x1D600, 11020, 1},
+		{0x1D601, 11021, 1},
+		{0x1D602, 11022, 1},
+		{0x1D603, 11023, 1},
+		{0x1D604, 11024, 1},
+		{0x1D605, 11025, 1},
+		{0x1D606, 11026, 1},
+		{0x1D607, 11027, 1},
+		{0x1D608, 11028, 1},
+		{0x1D609, 11029, 1},
+		{0x1D60A, 11030, 1},
+		{0x1D60B, 11031, 1},
+		{0x1D60C, 11032, 1},
+		{0x1D60D, 11033, 1},
+		{0x1D60E, 11034, 1},
+		{0x1D60F, 11035, 1},
+		{0x1D610, 11036, 1},
+		{0x1D611, 11037, 1},
+		{0x1D612, 11038, 1},
+		{0x1D613, 11039, 1},
+		{0x1D614, 11040, 1},
+		{0x1D615, 11041, 1},
+		{0x1D616, 11042, 1},
+		{0x1D617, 11043, 1},
+		{0x1D618, 11044, 1},
+		{0x1D619, 11045, 1},
+		{0x1D61A, 11046, 1},
+		{0x1D61B, 11047, 1},
+		{0x1D61C, 11048, 1},
+		{0x1D61D, 11049, 1},
+		{0x1D61E, 11050, 1},
+		{0x1D61F, 11051, 1},
+		{0x1D620, 11052, 1},
+		{0x1D621, 11053, 1},
+		{0x1D622, 11054, 1},
+		{0x1D623, 11055, 1},
+		{0x1D624, 11056, 1},
+		{0x1D625, 11057, 1},
+		{0x1D626, 11058, 1},
+		{0x1D627, 11059, 1},
+		{0x1D628, 11060, 1},
+		{0x1D629, 11061, 1},
+		{0x1D62A, 11062, 1},
+		{0x1D62B, 11063, 1},
+		{0x1D62C, 11064, 1},
+		{0x1D62D, 11065, 1},
+		{0x1D62E, 11066, 1},
+		{0x1D62F, 11067, 1},
+		{0x1D630, 11068, 1},
+		{0x1D631, 11069, 1},
+		{0x1D632, 11070, 1},
+		{0x1D633, 11071, 1},
+		{0x1D634, 11072, 1},
+		{0x1D635, 11073, 1},
+		{0x1D636, 11074, 1},
+		{0x1D637, 11075, 1},
+		{0x1D638, 11076, 1},
+		{0x1D639, 11077, 1},
+		{0x1D63A, 11078, 1},
+		{0x1D63B, 11079, 1},
+		{0x1D63C, 11080, 1},
+		{0x1D63D, 11081, 1},
+		{0x1D63E, 11082, 1},
+		{0x1D63F, 11083, 1},
+		{0x1D640, 11084, 1},
+		{0x1D641, 11085, 1},
+		{0x1D642, 11086, 1},
+		{0x1D643, 11087, 1},
+		{0x1D644, 11088, 1},
+		{0x1D645, 11089, 1},
+		{0x1D646, 11090, 1},
+		{0x1D647, 11091, 1},
+		{0x1D648, 11092, 1},
+		{0x1D649, 11093, 1},
+		{0x1D64A, 11094, 1},
+		{0x1D64B, 11095, 1},
+		{0x1D64C, 11096, 1},
+		{0x1D64D, 11097, 1},
+		{0x1D64E, 11098, 1},
+		{0x1D64F, 11099, 1},
+		{0x1D650, 11100, 1},
+		{0x1D651, 11101, 1},
+		{0x1D652, 11102, 1},
+		{0x1D653, 11103, 1},
+		{0x1D654, 11104, 1},
+		{0x1D655, 11105, 1},
+		{0x1D656, 11106, 1},
+		{0x1D657, 11107, 1},
+		{0x1D658, 11108, 1},
+		{0x1D659, 11109, 1},
+		{0x1D65A, 11110, 1},
+		{0x1D65B, 11111, 1},
+		{0x1D65C, 11112, 1},
+		{0x1D65D, 11113, 1},
+		{0x1D65E, 11114, 1},
+		{0x1D65F, 11115, 1},
+		{0x1D660, 11116, 1},
+		{0x1D661, 11117, 1},
+		{0x1D662, 11118, 1},
+		{0x1D663, 11119, 1},
+		{0x1D664, 11120, 1},
+		{0x1D665, 11121, 1},
+		{0x1D666, 11122, 1},
+		{0x1D667, 11123, 1},
+		{0x1D668, 11124, 1},
+		{0x1D669, 11125, 1},
+		{0x1D66A, 11126, 1},
+		{0x1D66B, 11127, 1},
+		{0x1D66C, 11128, 1},
+		{0x1D66D, 11129, 1},
+		{0x1D66E, 11130, 1},
+		{0x1D66F, 11131, 1},
+		{0x1D670, 11132, 1},
+		{0x1D671, 11133, 1},
+		{0x1D672, 11134, 1},
+		{0x1D673, 11135, 1},
+		{0x1D674, 11136, 1},
+		{0x1D675, 11137, 1},
+		{0x1D676, 11138, 1},
+		{0x1D677, 11139, 1},
+		{0x1D678, 11140, 1},
+		{0x1D679, 11141, 1},
+		{0x1D67A, 11142, 1},
+		{0x1D67B, 11143, 1},
+		{0x1D67C, 11144, 1},
+		{0x1D67D, 11145, 1},
+		{0x1D67E, 11146, 1},
+		{0x1D67F, 11147, 1},
+		{0x1D680, 11148, 1},
+		{0x1D681, 11149, 1},
+		{0x1D682, 11150, 1},
+		{0x1D683, 11151, 1},
+		{0x1D684, 11152, 1},
+		{0x1D685, 11153, 1},
+		{0x1D686, 11154, 1},
+		{0x1D687, 11155, 1},
+		{0x1D688, 11156, 1},
+		{0x1D689, 11157, 1},
+		{0x1D68A, 11158, 1},
+		{0x1D68B, 11159, 1},
+		{0x1D68C, 11160, 1},
+		{0x1D68D, 11161, 1},
+		{0x1D68E, 11162, 1},
+		{0x1D68F, 11163, 1},
+		{0x1D690, 11164, 1},
+		{0x1D691, 11165, 1},
+		{0x1D692, 11166, 1},
+		{0x1D693, 11167, 1},
+		{0x1D694, 11168, 1},
+		{0x1D695, 11169, 1},
+		{0x1D696, 11170, 1},
+		{0x1D697, 11171, 1},
+		{0x1D698, 11172, 1},
+		{0x1D699, 11173, 1},
+		{0x1D69A, 11174, 1},
+		{0x1D69B, 11175, 1},
+		{0x1D69C, 11176, 1},
+		{0x1D69D, 11177, 1},
+		{0x1D69E, 11178, 1},
+		{0x1D69F, 11179, 1},
+		{0x1D6A0, 11180, 1},
+		{0x1D6A1, 11181, 1},
+		{0x1D6A2, 11182, 1},
+		{0x1D6A3, 11183, 1},
+		{0x1D6A4, 11184, 1},
+		{0x1D6A5, 11185, 1},
+		{0x1D6A8, 11186, 1},
+		{0x1D6A9, 11187, 1},
+		{0x1D6AA, 11188, 1},
+		{0x1D6AB, 11189, 1},
+		{0x1D6AC, 11190, 1},
+		{0x1D6AD, 11191, 1},
+		{0x1D6AE, 11192, 1},
+		{0x1D6AF, 11193, 1},
+		{0x1D6B0, 11194, 1},
+		{0x1D6B1, 11195, 1},
+		{0x1D6B2, 11196, 1},
+		{0x1D6B3, 11197, 1},
+		{0x1D6B4, 11198, 1},
+		{0x1D6B5, 11199, 1},
+		{0x1D6B6, 11200, 1},
+		{0x1D6B7, 11201, 1},
+		{0x1D6B8, 11202, 1},
+		{0x1D6B9, 11203, 1},
+		{0x1D6BA, 11204, 1},
+		{0x1D6BB, 11205, 1},
+		{0x1D6BC, 11206, 1},
+		{0x1D6BD, 11207, 1},
+		{0x1D6BE, 11208, 1},
+		{0x1D6BF, 11209, 1},
+		{0x1D6C0, 11210, 1},
+		{0x1D6C1, 11211, 1},
+		{0x1D6C2, 11212, 1},
+		{0x1D6C3, 11213, 1},
+		{0x1D6C4, 11214, 1},
+		{0x1D6C5, 11215, 1},
+		{0x1D6C6, 11216, 1},
+		{0x1D6C7, 11217, 1},
+		{0x1D6C8, 11218, 1},
+		{0x1D6C9, 11219, 1},
+		{0x1D6CA, 11220, 1},
+		{0x1D6CB, 11221, 1},
+		{0x1D6CC, 11222, 1},
+		{0x1D6CD, 11223, 1},
+		{0x1D6CE, 11224, 1},
+		{0x1D6CF, 11225, 1},
+		{0x1D6D0, 11226, 1},
+		{0x1D6D1, 11227, 1},
+		{0x1D6D2, 11228, 1},
+		{0x1D6D3, 11229, 1},
+		{0x1D6D4, 11230, 1},
+		{0x1D6D5, 11231, 1},
+		{0x1D6D6, 11232, 1},
+		{0x1D6D7, 11233, 1},
+		{0x1D6D8, 11234, 1},
+		{0x1D6D9, 11235, 1},
+		{0x1D6DA, 11236, 1},
+		{0x1D6DB, 11237, 1},
+		{0x1D6DC, 11238, 1},
+		{0x1D6DD, 11239, 1},
+		{0x1D6DE, 11240, 1},
+		{0x1D6DF, 11241, 1},
+		{0x1D6E0, 11242, 1},
+		{0x1D6E1, 11243, 1},
+		{0x1D6E2, 11244, 1},
+		{0x1D6E3, 11245, 1},
+		{0x1D6E4, 11246, 1},
+		{0x1D6E5, 11247, 1},
+		{0x1D6E6, 11248, 1},
+		{0x1D6E7, 11249, 1},
+		{0x1D6E8, 11250, 1},
+		{0x1D6E9, 11251, 1},
+		{0x1D6EA, 11252, 1},
+		{0x1D6EB, 11253, 1},
+		{0x1D6EC, 11254, 1},
+		{0x1D6ED, 11255, 1},
+		{0x1D6EE, 11256, 1},
+		{0x1D6EF, 11257, 1},
+		{0x1D6F0, 11258, 1},
+		{0x1D6F1, 11259, 1},
+		{0x1D6F2, 11260, 1},
+		{0x1D6F3, 11261, 1},
+		{0x1D6F4, 11262, 1},
+		{0x1D6F5, 11263, 1},
+		{0x1D6F6, 11264, 1},
+		{0x1D6F7, 11265, 1},
+		{0x1D6F8, 11266, 1},
+		{0x1D6F9, 11267, 1},
+		{0x1D6FA, 11268, 1},
+		{0x1D6FB, 11269, 1},
+		{0x1D6FC, 11270, 1},
+		{0x1D6FD, 11271, 1},
+		{0x1D6FE, 11272, 1},
+		{0x1D6FF, 11273, 1},
+		{0x1D700, 11274, 1},
+		{0x1D701, 11275, 1},
+		{0x1D702, 11276, 1},
+		{0x1D703, 11277, 1},
+		{0x1D704, 11278, 1},
+		{0x1D705, 11279, 1},
+		{0x1D706, 11280, 1},
+		{0x1D707, 11281, 1},
+		{0x1D708, 11282, 1},
+		{0x1D709, 11283, 1},
+		{0x1D70A, 11284, 1},
+		{0x1D70B, 11285, 1},
+		{0x1D70C, 11286, 1},
+		{0x1D70D, 11287, 1},
+		{0x1D70E, 11288, 1},
+		{0x1D70F, 11289, 1},
+		{0x1D710, 11290, 1},
+		{0x1D711, 11291, 1},
+		{0x1D712, 11292, 1},
+		{0x1D713, 11293, 1},
+		{0x1D714, 11294, 1},
+		{0x1D715, 11295, 1},
+		{0x1D716, 11296, 1},
+		{0x1D717, 11297, 1},
+		{0x1D718, 11298, 1},
+		{0x1D719, 11299, 1},
+		{0x1D71A, 11300, 1},
+		{0x1D71B, 11301, 1},
+		{0x1D71C, 11302, 1},
+		{0x1D71D, 11303, 1},
+		{0x1D71E, 11304, 1},
+		{0x1D71F, 11305, 1},
+		{0x1D720, 11306, 1},
+		{0x1D721, 11307, 1},
+		{0x1D722, 11308, 1},
+		{0x1D723, 11309, 1},
+		{0x1D724, 11310, 1},
+		{0x1D725, 11311, 1},
+		{0x1D726, 11312, 1},
+		{0x1D727, 11313, 1},
+		{0x1D728, 11314, 1},
+		{0x1D729, 11315, 1},
+		{0x1D72A, 11316, 1},
+		{0x1D72B, 11317, 1},
+		{0x1D72C, 11318, 1},
+		{0x1D72D, 11319, 1},
+		{0x1D72E, 11320, 1},
+		{0x1D72F, 11321, 1},
+		{0x1D730, 11322, 1},
+		{0x1D731, 11323, 1},
+		{0x1D732, 11324, 1},
+		{0x1D733, 11325, 1},
+		{0x1D734, 11326, 1},
+		{0x1D735, 11327, 1},
+		{0x1D736, 11328, 1},
+		{0x1D737, 11329, 1},
+		{0x1D738, 11330, 1},
+		{0x1D739, 11331, 1},
+		{0x1D73A, 11332, 1},
+		{0x1D73B, 11333, 1},
+		{0x1D73C, 11334, 1},
+		{0x1D73D, 11335, 1},
+		{0x1D73E, 11336, 1},
+		{0x1D73F, 11337, 1},
+		{0x1D740, 11338, 1},
+		{0x1D741, 11339, 1},
+		{0x1D742, 11340, 1},
+		{0x1D743, 11341, 1},
+		{0x1D744, 11342, 1},
+		{0x1D745, 11343, 1},
+		{0x1D746, 11344, 1},
+		{0x1D747, 11345, 1},
+		{0x1D748, 11346, 1},
+		{0x1D749, 11347, 1},
+		{0x1D74A, 11348, 1},
+		{0x1D74B, 11349, 1},
+		{0x1D74C, 11350, 1},
+		{0x1D74D, 11351, 1},
+		{0x1D74E, 11352, 1},
+		{0x1D74F, 11353, 1},
+		{0x1D750, 11354, 1},
+		{0x1D751, 11355, 1},
+		{0x1D752, 11356, 1},
+		{0x1D753, 11357, 1},
+		{0x1D754, 11358, 1},
+		{0x1D755, 11359, 1},
+		{0x1D756, 11360, 1},
+		{0x1D757, 11361, 1},
+		{0x1D758, 11362, 1},
+		{0x1D759, 11363, 1},
+		{0x1D75A, 11364, 1},
+		{0x1D75B, 11365, 1},
+		{0x1D75C, 11366, 1},
+		{0x1D75D, 11367, 1},
+		{0x1D75E, 11368, 1},
+		{0x1D75F, 11369, 1},
+		{0x1D760, 11370, 1},
+		{0x1D761, 11371, 1},
+		{0x1D762, 11372, 1},
+		{0x1D763, 11373, 1},
+		{0x1D764, 11374, 1},
+		{0x1D765, 11375, 1},
+		{0x1D766, 11376, 1},
+		{0x1D767, 11377, 1},
+		{0x1D768, 11378, 1},
+		{0x1D769, 11379, 1},
+		{0x1D76A, 11380, 1},
+		{0x1D76B, 11381, 1},
+		{0x1D76C, 11382, 1},
+		{0x1D76D, 11383, 1},
+		{0x1D76E, 11384, 1},
+		{0x1D76F, 11385, 1},
+		{0x1D770, 11386, 1},
+		{0x1D771, 11387, 1},
+		{0x1D772, 11388, 1},
+		{0x1D773, 11389, 1},
+		{0x1D774, 11390, 1},
+		{0x1D775, 11391, 1},
+		{0x1D776, 11392, 1},
+		{0x1D777, 11393, 1},
+		{0x1D778, 11394, 1},
+		{0x1D779, 11395, 1},
+		{0x1D77A, 11396, 1},
+		{0x1D77B, 11397, 1},
+		{0x1D77C, 11398, 1},
+		{0x1D77D, 11399, 1},
+		{0x1D77E, 11400, 1},
+		{0x1D77F, 11401, 1},
+		{0x1D780, 11402, 1},
+		{0x1D781, 11403, 1},
+		{0x1D782, 11404, 1},
+		{0x1D783, 11405, 1},
+		{0x1D784, 11406, 1},
+		{0x1D785, 11407, 1},
+		{0x1D786, 11408, 1},
+		{0x1D787, 11409, 1},
+		{0x1D788, 11410, 1},
+		{0x1D789, 11411, 1},
+		{0x1D78A, 11412, 1},
+		{0x1D78B, 11413, 1},
+		{0x1D78C, 11414, 1},
+		{0x1D78D, 11415, 1},
+		{0x1D78E, 11416, 1},
+		{0x1D78F, 11417, 1},
+		{0x1D790, 11418, 1},
+		{0x1D791, 11419, 1},
+		{0x1D792, 11420, 1},
+		{0x1D793, 11421, 1},
+		{0x1D794, 11422, 1},
+		{0x1D795, 11423, 1},
+		{0x1D796, 11424, 1},
+		{0x1D797, 11425, 1},
+		{0x1D798, 11426, 1},
+		{0x1D799, 11427, 1},
+		{0x1D79A, 11428, 1},
+		{0x1D79B, 11429, 1},
+		{0x1D79C, 11430, 1},
+		{0x1D79D, 11431, 1},
+		{0x1D79E, 11432, 1},
+		{0x1D79F, 11433, 1},
+		{0x1D7A0, 11434, 1},
+		{0x1D7A1, 11435, 1},
+		{0x1D7A2, 11436, 1},
+		{0x1D7A3, 11437, 1},
+		{0x1D7A4, 11438, 1},
+		{0x1D7A5, 11439, 1},
+		{0x1D7A6, 11440, 1},
+		{0x1D7A7, 11441, 1},
+		{0x1D7A8, 11442, 1},
+		{0x1D7A9, 11443, 1},
+		{0x1D7AA, 11444, 1},
+		{0x1D7AB, 11445, 1},
+		{0x1D7AC, 11446, 1},
+		{0x1D7AD, 11447, 1},
+		{0x1D7AE, 11448, 1},
+		{0x1D7AF, 11449, 1},
+		{0x1D7B0, 11450, 1},
+		{0x1D7B1, 11451, 1},
+		{0x1D7B2, 11452, 1},
+		{0x1D7B3, 11453, 1},
+		{0x1D7B4, 11454, 1},
+		{0x1D7B5, 11455, 1},
+		{0x1D7B6, 11456, 1},
+		{0x1D7B7, 11457, 1},
+		{0x1D7B8, 11458, 1},
+		{0x1D7B9, 11459, 1},
+		{0x1D7BA, 11460, 1},
+		{0x1D7BB, 11461, 1},
+		{0x1D7BC, 11462, 1},
+		{0x1D7BD, 11463, 1},
+		{0x1D7BE, 11464, 1},
+		{0x1D7BF, 11465, 1},
+		{0x1D7C0, 11466, 1},
+		{0x1D7C1, 11467, 1},
+		{0x1D7C2, 11468, 1},
+		{0x1D7C3, 11469, 1},
+		{0x1D7C4, 11470, 1},
+		{0x1D7C5, 11471, 1},
+		{0x1D7C6, 11472, 1},
+		{0x1D7C7, 11473, 1},
+		{0x1D7C8, 11474, 1},
+		{0x1D7C9, 11475, 1},
+		{0x1D7CA, 11476, 1},
+		{0x1D7CB, 11477, 1},
+		{0x1D7CE, 11478, 1},
+		{0x1D7CF, 11479, 1},
+		{0x1D7D0, 11480, 1},
+		{0x1D7D1, 11481, 1},
+		{0x1D7D2, 11482, 1},
+		{0x1D7D3, 11483, 1},
+		{0x1D7D4, 11484, 1},
+		{0x1D7D5, 11485, 1},
+		{0x1D7D6, 11486, 1},
+		{0x1D7D7, 11487, 1},
+		{0x1D7D8, 11488, 1},
+		{0x1D7D9, 11489, 1},
+		{0x1D7DA, 11490, 1},
+		{0x1D7DB, 11491, 1},
+		{0x1D7DC, 11492, 1},
+		{0x1D7DD, 11493, 1},
+		{0x1D7DE, 11494, 1},
+		{0x1D7DF, 11495, 1},
+		{0x1D7E0, 11496, 1},
+		{0x1D7E1, 11497, 1},
+		{0x1D7E2, 11498, 1},
+		{0x1D7E3, 11499, 1},
+		{0x1D7E4, 11500, 1},
+		{0x1D7E5, 11501, 1},
+		{0x1D7E6, 11502, 1},
+		{0x1D7E7, 11503, 1},
+		{0x1D7E8, 11504, 1},
+		{0x1D7E9, 11505, 1},
+		{0x1D7EA, 11506, 1},
+		{0x1D7EB, 11507, 1},
+		{0x1D7EC, 11508, 1},
+		{0x1D7ED, 11509, 1},
+		{0x1D7EE, 11510, 1},
+		{0x1D7EF, 11511, 1},
+		{0x1D7F0, 11512, 1},
+		{0x1D7F1, 11513, 1},
+		{0x1D7F2, 11514, 1},
+		{0x1D7F3, 11515, 1},
+		{0x1D7F4, 11516, 1},
+		{0x1D7F5, 11517, 1},
+		{0x1D7F6, 11518, 1},
+		{0x1D7F7, 11519, 1},
+		{0x1D7F8, 11520, 1},
+		{0x1D7F9, 11521, 1},
+		{0x1D7FA, 11522, 1},
+		{0x1D7FB, 11523, 1},
+		{0x1D7FC, 11524, 1},
+		{0x1D7FD, 11525, 1},
+		{0x1D7FE, 11526, 1},
+		{0x1D7FF, 11527, 1},
+		{0x1EE00, 11528, 1},
+		{0x1EE01, 11529, 1},
+		{0x1EE02, 11530, 1},
+		{0x1EE03, 11531, 1},
+		{0x1EE05, 11532, 1},
+		{0x1EE06, 11533, 1},
+		{0x1EE07, 11534, 1},
+		{0x1EE08, 11535, 1},
+		{0x1EE09, 11536, 1},
+		{0x1EE0A, 11537, 1},
+		{0x1EE0B, 11538, 1},
+		{0x1EE0C, 11539, 1},
+		{0x1EE0D, 11540, 1},
+		{0x1EE0E, 11541, 1},
+		{0x1EE0F, 11542, 1},
+		{0x1EE10, 11543, 1},
+		{0x1EE11, 11544, 1},
+		{0x1EE12, 11545, 1},
+		{0x1EE13, 11546, 1},
+		{0x1EE14, 11547, 1},
+		{0x1EE15, 11548, 1},
+		{0x1EE16, 11549, 1},
+		{0x1EE17, 11550, 1},
+		{0x1EE18, 11551, 1},
+		{0x1EE19, 11552, 1},
+		{0x1EE1A, 11553, 1},
+		{0x1EE1B, 11554, 1},
+		{0x1EE1C, 11555, 1},
+		{0x1EE1D, 11556, 1},
+		{0x1EE1E, 11557, 1},
+		{0x1EE1F, 11558, 1},
+		{0x1EE21, 11559, 1},
+		{0x1EE22, 11560, 1},
+		{0x1EE24, 11561, 1},
+		{0x1EE27, 11562, 1},
+		{0x1EE29, 11563, 1},
+		{0x1EE2A, 11564, 1},
+		{0x1EE2B, 11565, 1},
+		{0x1EE2C, 11566, 1},
+		{0x1EE2D, 11567, 1},
+		{0x1EE2E, 11568, 1},
+		{0x1EE2F, 11569, 1},
+		{0x1EE30, 11570, 1},
+		{0x1EE31, 11571, 1},
+		{0x1EE32, 11572, 1},
+		{0x1EE34, 11573, 1},
+		{0x1EE35, 11574, 1},
+		{0x1EE36, 11575, 1},
+		{0x1EE37, 11576, 1},
+		{0x1EE39, 11577, 1},
+		{0x1EE3B, 11578, 1},
+		{0x1EE42, 11579, 1},
+		{0x1EE47, 11580, 1},
+		{0x1EE49, 11581, 1},
+		{0x1EE4B, 11582, 1},
+		{0x1EE4D, 11583, 1},
+		{0x1EE4E, 11584, 1},
+		{0x1EE4F, 11585, 1},
+		{0x1EE51, 11586, 1},
+		{0x1EE52, 11587, 1},
+		{0x1EE54, 11588, 1},
+		{0x1EE57, 11589, 1},
+		{0x1EE59, 11590, 1},
+		{0x1EE5B, 11591, 1},
+		{0x1EE5D, 11592, 1},
+		{0x1EE5F, 11593, 1},
+		{0x1EE61, 11594, 1},
+		{0x1EE62, 11595, 1},
+		{0x1EE64, 11596, 1},
+		{0x1EE67, 11597, 1},
+		{0x1EE68, 11598, 1},
+		{0x1EE69, 11599, 1},
+		{0x1EE6A, 11600, 1},
+		{0x1EE6C, 11601, 1},
+		{0x1EE6D, 11602, 1},
+		{0x1EE6E, 11603, 1},
+		{0x1EE6F, 11604, 1},
+		{0x1EE70, 11605, 1},
+		{0x1EE71, 11606, 1},
+		{0x1EE72, 11607, 1},
+		{0x1EE74, 11608, 1},
+		{0x1EE75, 11609, 1},
+		{0x1EE76, 11610, 1},
+		{0x1EE77, 11611, 1},
+		{0x1EE79, 11612, 1},
+		{0x1EE7A, 11613, 1},
+		{0x1EE7B, 11614, 1},
+		{0x1EE7C, 11615, 1},
+		{0x1EE7E, 11616, 1},
+		{0x1EE80, 11617, 1},
+		{0x1EE81, 11618, 1},
+		{0x1EE82, 11619, 1},
+		{0x1EE83, 11620, 1},
+		{0x1EE84, 11621, 1},
+		{0x1EE85, 11622, 1},
+		{0x1EE86, 11623, 1},
+		{0x1EE87, 11624, 1},
+		{0x1EE88, 11625, 1},
+		{0x1EE89, 11626, 1},
+		{0x1EE8B, 11627, 1},
+		{0x1EE8C, 11628, 1},
+		{0x1EE8D, 11629, 1},
+		{0x1EE8E, 11630, 1},
+		{0x1EE8F, 11631, 1},
+		{0x1EE90, 11632, 1},
+		{0x1EE91, 11633, 1},
+		{0x1EE92, 11634, 1},
+		{0x1EE93, 11635, 1},
+		{0x1EE94, 11636, 1},
+		{0x1EE95, 11637, 1},
+		{0x1EE96, 11638, 1},
+		{0x1EE97, 11639, 1},
+		{0x1EE98, 11640, 1},
+		{0x1EE99, 11641, 1},
+		{0x1EE9A, 11642, 1},
+		{0x1EE9B, 11643, 1},
+		{0x1EEA1, 11644, 1},
+		{0x1EEA2, 11645, 1},
+		{0x1EEA3, 11646, 1},
+		{0x1EEA5, 11647, 1},
+		{0x1EEA6, 11648, 1},
+		{0x1EEA7, 11649, 1},
+		{0x1EEA8, 11650, 1},
+		{0x1EEA9, 11651, 1},
+		{0x1EEAB, 11652, 1},
+		{0x1EEAC, 11653, 1},
+		{0x1EEAD, 11654, 1},
+		{0x1EEAE, 11655, 1},
+		{0x1EEAF, 11656, 1},
+		{0x1EEB0, 11657, 1},
+		{0x1EEB1, 11658, 1},
+		{0x1EEB2, 11659, 1},
+		{0x1EEB3, 11660, 1},
+		{0x1EEB4, 11661, 1},
+		{0x1EEB5, 11662, 1},
+		{0x1EEB6, 11663, 1},
+		{0x1EEB7, 11664, 1},
+		{0x1EEB8, 11665, 1},
+		{0x1EEB9, 11666, 1},
+		{0x1EEBA, 11667, 1},
+		{0x1EEBB, 11668, 1},
+		{0x1F100, 11669, 2},
+		{0x1F101, 11671, 2},
+		{0x1F102, 11673, 2},
+		{0x1F103, 11675, 2},
+		{0x1F104, 11677, 2},
+		{0x1F105, 11679, 2},
+		{0x1F106, 11681, 2},
+		{0x1F107, 11683, 2},
+		{0x1F108, 11685, 2},
+		{0x1F109, 11687, 2},
+		{0x1F10A, 11689, 2},
+		{0x1F110, 11691, 3},
+		{0x1F111, 11694, 3},
+		{0x1F112, 11697, 3},
+		{0x1F113, 11700, 3},
+		{0x1F114, 11703, 3},
+		{0x1F115, 11706, 3},
+		{0x1F116, 11709, 3},
+		{0x1F117, 11712, 3},
+		{0x1F118, 11715, 3},
+		{0x1F119, 11718, 3},
+		{0x1F11A, 11721, 3},
+		{0x1F11B, 11724, 3},
+		{0x1F11C, 11727, 3},
+		{0x1F11D, 11730, 3},
+		{0x1F11E, 11733, 3},
+		{0x1F11F, 11736, 3},
+		{0x1F120, 11739, 3},
+		{0x1F121, 11742, 3},
+		{0x1F122, 11745, 3},
+		{0x1F123, 11748, 3},
+		{0x1F124, 11751, 3},
+		{0x1F125, 11754, 3},
+		{0x1F126, 11757, 3},
+		{0x1F127, 11760, 3},
+		{0x1F128, 11763, 3},
+		{0x1F129, 11766, 3},
+		{0x1F12A, 11769, 3},
+		{0x1F12B, 11772, 1},
+		{0x1F12C, 11773, 1},
+		{0x1F12D, 11774, 2},
+		{0x1F12E, 11776, 2},
+		{0x1F130, 11778, 1},
+		{0x1F131, 11779, 1},
+		{0x1F132, 11780, 1},
+		{0x1F133, 11781, 1},
+		{0x1F134, 11782, 1},
+		{0x1F135, 11783, 1},
+		{0x1F136, 11784, 1},
+		{0x1F137, 11785, 1},
+		{0x1F138, 11786, 1},
+		{0x1F139, 11787, 1},
+		{0x1F13A, 11788, 1},
+		{0x1F13B, 11789, 1},
+		{0x1F13C, 11790, 1},
+		{0x1F13D, 11791, 1},
+		{0x1F13E, 11792, 1},
+		{0x1F13F, 11793, 1},
+		{0x1F140, 11794, 1},
+		{0x1F141, 11795, 1},
+		{0x1F142, 11796, 1},
+		{0x1F143, 11797, 1},
+		{0x1F144, 11798, 1},
+		{0x1F145, 11799, 1},
+		{0x1F146, 11800, 1},
+		{0x1F147, 11801, 1},
+		{0x1F148, 11802, 1},
+		{0x1F149, 11803, 1},
+		{0x1F14A, 11804, 2},
+		{0x1F14B, 11806, 2},
+		{0x1F14C, 11808, 2},
+		{0x1F14D, 11810, 2},
+		{0x1F14E, 11812, 3},
+		{0x1F14F, 11815, 2},
+		{0x1F16A, 11817, 2},
+		{0x1F16B, 11819, 2},
+		{0x1F16C, 11821, 2},
+		{0x1F190, 11823, 2},
+		{0x1F200, 11825, 2},
+		{0x1F201, 11827, 2},
+		{0x1F202, 11829, 1},
+		{0x1F210, 11830, 1},
+		{0x1F211, 11831, 1},
+		{0x1F212, 11832, 1},
+		{0x1F213, 11833, 2},
+		{0x1F214, 11835, 1},
+		{0x1F215, 11836, 1},
+		{0x1F216, 11837, 1},
+		{0x1F217, 11838, 1},
+		{0x1F218, 11839, 1},
+		{0x1F219, 11840, 1},
+		{0x1F21A, 11841, 1},
+		{0x1F21B, 11842, 1},
+		{0x1F21C, 11843, 1},
+		{0x1F21D, 11844, 1},
+		{0x1F21E, 11845, 1},
+		{0x1F21F, 11846, 1},
+		{0x1F220, 11847, 1},
+		{0x1F221, 11848, 1},
+		{0x1F222, 11849, 1},
+		{0x1F223, 11850, 1},
+		{0x1F224, 11851, 1},
+		{0x1F225, 11852, 1},
+		{0x1F226, 11853, 1},
+		{0x1F227, 11854, 1},
+		{0x1F228, 11855, 1},
+		{0x1F229, 11856, 1},
+		{0x1F22A, 11857, 1},
+		{0x1F22B, 11858, 1},
+		{0x1F22C, 11859, 1},
+		{0x1F22D, 11860, 1},
+		{0x1F22E, 11861, 1},
+		{0x1F22F, 11862, 1},
+		{0x1F230, 11863, 1},
+		{0x1F231, 11864, 1},
+		{0x1F232, 11865, 1},
+		{0x1F233, 11866, 1},
+		{0x1F234, 11867, 1},
+		{0x1F235, 11868, 1},
+		{0x1F236, 11869, 1},
+		{0x1F237, 11870, 1},
+		{0x1F238, 11871, 1},
+		{0x1F239, 11872, 1},
+		{0x1F23A, 11873, 1},
+		{0x1F23B, 11874, 1},
+		{0x1F240, 11875, 3},
+		{0x1F241, 11878, 3},
+		{0x1F242, 11881, 3},
+		{0x1F243, 11884, 3},
+		{0x1F244, 11887, 3},
+		{0x1F245, 11890, 3},
+		{0x1F246, 11893, 3},
+		{0x1F247, 11896, 3},
+		{0x1F248, 11899, 3},
+		{0x1F250, 11902, 1},
+		{0x1F251, 11903, 1},
+		{0x1FBF0, 11904, 1},
+		{0x1FBF1, 11905, 1},
+		{0x1FBF2, 11906, 1},
+		{0x1FBF3, 11907, 1},
+		{0x1FBF4, 11908, 1},
+		{0x1FBF5, 11909, 1},
+		{0x1FBF6, 11910, 1},
+		{0x1FBF7, 11911, 1},
+		{0x1FBF8, 11912, 1},
+		{0x1FBF9, 11913, 1},
+		{0x2F800, 11914, 1},
+		{0x2F801, 11915, 1},
+		{0x2F802, 11916, 1},
+		{0x2F803, 11917, 1},
+		{0x2F804, 11918, 1},
+		{0x2F805, 11919, 1},
+		{0x2F806, 11920, 1},
+		{0x2F807, 11921, 1},
+		{0x2F808, 11922, 1},
+		{0x2F809, 11923, 1},
+		{0x2F80A, 11924, 1},
+		{0x2F80B, 11925, 1},
+		{0x2F80C, 11926, 1},
+		{0x2F80D, 11927, 1},
+		{0x2F80E, 11928, 1},
+		{0x2F80F, 11929, 1},
+		{0x2F810, 11930, 1},
+		{0x2F811, 11931, 1},
+		{0x2F812, 11932, 1},
+		{0x2F813, 11933, 1},
+		{0x2F814, 11934, 1},
+		{0x2F815, 11935, 1},
+		{0x2F816, 11936, 1},
+		{0x2F817, 11937, 1},
+		{0x2F818, 11938, 1},
+		{0x2F819, 11939, 1},
+		{0x2F81A, 11940, 1},
+		{0x2F81B, 11941, 1},
+		{0x2F81C, 11942, 1},
+		{0x2F81D, 11943, 1},
+		{0x2F81E, 11944, 1},
+		{0x2F81F, 11945, 1},
+		{0x2F820, 11946, 1},
+		{0x2F821, 11947, 1},
+		{0x2F822, 11948, 1},
+		{0x2F823, 11949, 1},
+		{0x2F824, 11950, 1},
+		{0x2F825, 11951, 1},
+		{0x2F826, 11952, 1},
+		{0x2F827, 11953, 1},
+		{0x2F828, 11954, 1},
+		{0x2F829, 11955, 1},
+		{0x2F82A, 11956, 1},
+		{0x2F82B, 11957, 1},
+		{0x2F82C, 11958, 1},
+		{0x2F82D, 11959, 1},
+		{0x2F82E, 11960, 1},
+		{0x2F82F, 11961, 1},
+		{0x2F830, 11962, 1},
+		{0x2F831, 11963, 1},
+		{0x2F832, 11964, 1},
+		{0x2F833, 11965, 1},
+		{0x2F834, 11966, 1},
+		{0x2F835, 11967, 1},
+		{0x2F836, 11968, 1},
+		{0x2F837, 11969, 1},
+		{0x2F838, 11970, 1},
+		{0x2F839, 11971, 1},
+		{0x2F83A, 11972, 1},
+		{0x2F83B, 11973, 1},
+		{0x2F83C, 11974, 1},
+		{0x2F83D, 11975, 1},
+		{0x2F83E, 11976, 1},
+		{0x2F83F, 11977, 1},
+		{0x2F840, 11978, 1},
+		{0x2F841, 11979, 1},
+		{0x2F842, 11980, 1},
+		{0x2F843, 11981, 1},
+		{0x2F844, 11982, 1},
+		{0x2F845, 11983, 1},
+		{0x2F846, 11984, 1},
+		{0x2F847, 11985, 1},
+		{0x2F848, 11986, 1},
+		{0x2F849, 11987, 1},
+		{0x2F84A, 11988, 1},
+		{0x2F84B, 11989, 1},
+		{0x2F84C, 11990, 1},
+		{0x2F84D, 11991, 1},
+		{0x2F84E, 11992, 1},
+		{0x2F84F, 11993, 1},
+		{0x2F850, 11994, 1},
+		{0x2F851, 11995, 1},
+		{0x2F852, 11996, 1},
+		{0x2F853, 11997, 1},
+		{0x2F854, 11998, 1},
+		{0x2F855, 11999, 1},
+		{0x2F856, 12000, 1},
+		{0x2F857, 12001, 1},
+		{0x2F858, 12002, 1},
+		{0x2F859, 12003, 1},
+		{0x2F85A, 12004, 1},
+		{0x2F85B, 12005, 1},
+		{0x2F85C, 12006, 1},
+		{0x2F85D, 12007, 1},
+		{0x2F85E, 12008, 1},
+		{0x2F85F, 12009, 1},
+		{0x2F860, 12010, 1},
+		{0x2F861, 12011, 1},
+		{0x2F862, 12012, 1},
+		{0x2F863, 12013, 1},
+		{0x2F864, 12014, 1},
+		{0x2F865, 12015, 1},
+		{0x2F866, 12016, 1},
+		{0x2F867, 12017, 1},
+		{0x2F868, 12018, 1},
+		{0x2F869, 12019, 1},
+		{0x2F86A, 12020, 1},
+		{0x2F86B, 12021, 1},
+		{0x2F86C, 12022, 1},
+		{0x2F86D, 12023, 1},
+		{0x2F86E, 12024, 1},
+		{0x2F86F, 12025, 1},
+		{0x2F870, 12026, 1},
+		{0x2F871, 12027, 1},
+		{0x2F872, 12028, 1},
+		{0x2F873, 12029, 1},
+		{0x2F874, 12030, 1},
+		{0x2F875, 12031, 1},
+		{0x2F876, 12032, 1},
+		{0x2F877, 12033, 1},
+		{0x2F878, 12034, 1},
+		{0x2F879, 12035, 1},
+		{0x2F87A, 12036, 1},
+		{0x2F87B, 12037, 1},
+		{0x2F87C, 12038, 1},
+		{0x2F87D, 12039, 1},
+		{0x2F87E, 12040, 1},
+		{0x2F87F, 12041, 1},
+		{0x2F880, 12042, 1},
+		{0x2F881, 12043, 1},
+		{0x2F882, 12044, 1},
+		{0x2F883, 12045, 1},
+		{0x2F884, 12046, 1},
+		{0x2F885, 12047, 1},
+		{0x2F886, 12048, 1},
+		{0x2F887, 12049, 1},
+		{0x2F888, 12050, 1},
+		{0x2F889, 12051, 1},
+		{0x2F88A, 12052, 1},
+		{0x2F88B, 12053, 1},
+		{0x2F88C, 12054, 1},
+		{0x2F88D, 12055, 1},
+		{0x2F88E, 12056, 1},
+		{0x2F88F, 12057, 1},
+		{0x2F890, 12058, 1},
+		{0x2F891, 12059, 1},
+		{0x2F892, 12060, 1},
+		{0x2F893, 12061, 1},
+		{0x2F894, 12062, 1},
+		{0x2F895, 12063, 1},
+		{0x2F896, 12064, 1},
+		{0x2F897, 12065, 1},
+		{0x2F898, 12066, 1},
+		{0x2F899, 12067, 1},
+		{0x2F89A, 12068, 1},
+		{0x2F89B, 12069, 1},
+		{0x2F89C, 12070, 1},
+		{0x2F89D, 12071, 1},
+		{0x2F89E, 12072, 1},
+		{0x2F89F, 12073, 1},
+		{0x2F8A0, 12074, 1},
+		{0x2F8A1, 12075, 1},
+		{0x2F8A2, 12076, 1},
+		{0x2F8A3, 12077, 1},
+		{0x2F8A4, 12078, 1},
+		{0x2F8A5, 12079, 1},
+		{0x2F8A6, 12080, 1},
+		{0x2F8A7, 12081, 1},
+		{0x2F8A8, 12082, 1},
+		{0x2F8A9, 12083, 1},
+		{0x2F8AA, 12084, 1},
+		{0x2F8AB, 12085, 1},
+		{0x2F8AC, 12086, 1},
+		{0x2F8AD, 12087, 1},
+		{0x2F8AE, 12088, 1},
+		{0x2F8AF, 12089, 1},
+		{0x2F8B0, 12090, 1},
+		{0x2F8B1, 12091, 1},
+		{0x2F8B2, 12092, 1},
+		{0x2F8B3, 12093, 1},
+		{0x2F8B4, 12094, 1},
+		{0x2F8B5, 12095, 1},
+		{0x2F8B6, 12096, 1},
+		{0x2F8B7, 12097, 1},
+		{0x2F8B8, 12098, 1},
+		{0x2F8B9, 12099, 1},
+		{0x2F8BA, 12100, 1},
+		{0x2F8BB, 12101, 1},
+		{0x2F8BC, 12102, 1},
+		{0x2F8BD, 12103, 1},
+		{0x2F8BE, 12104, 1},
+		{0x2F8BF, 12105, 1},
+		{0x2F8C0, 12106, 1},
+		{0x2F8C1, 12107, 1},
+		{0x2F8C2, 12108, 1},
+		{0x2F8C3, 12109, 1},
+		{0x2F8C4, 12110, 1},
+		{0x2F8C5, 12111, 1},
+		{0x2F8C6, 12112, 1},
+		{0x2F8C7, 12113, 1},
+		{0x2F8C8, 12114, 1},
+		{0x2F8C9, 12115, 1},
+		{0x2F8CA, 12116, 1},
+		{0x2F8CB, 12117, 1},
+		{0x2F8CC, 12118, 1},
+		{0x2F8CD, 12119, 1},
+		{0x2F8CE, 12120, 1},
+		{0x2F8CF, 12121, 1},
+		{0x2F8D0, 12122, 1},
+		{0x2F8D1, 12123, 1},
+		{0x2F8D2, 12124, 1},
+		{0x2F8D3, 12125, 1},
+		{0x2F8D4, 12126, 1},
+		{0x2F8D5, 12127, 1},
+		{0x2F8D6, 12128, 1},
+		{0x2F8D7, 12129, 1},
+		{0x2F8D8, 12130, 1},
+		{0x2F8D9, 12131, 1},
+		{0x2F8DA, 12132, 1},
+		{0x2F8DB, 12133, 1},
+		{0x2F8DC, 12134, 1},
+		{0x2F8DD, 12135, 1},
+		{0x2F8DE, 12136, 1},
+		{0x2F8DF, 12137, 1},
+		{0x2F8E0, 12138, 1},
+		{0x2F8E1, 12139, 1},
+		{0x2F8E2, 12140, 1},
+		{0x2F8E3, 12141, 1},
+		{0x2F8E4, 12142, 1},
+		{0x2F8E5, 12143, 1},
+		{0x2F8E6, 12144, 1},
+		{0x2F8E7, 12145, 1},
+		{0x2F8E8, 12146, 1},
+		{0x2F8E9, 12147, 1},
+		{0x2F8EA, 12148, 1},
+		{0x2F8EB, 12149, 1},
+		{0x2F8EC, 12150, 1},
+		{0x2F8ED, 12151, 1},
+		{0x2F8EE, 12152, 1},
+		{0x2F8EF, 12153, 1},
+		{0x2F8F0, 12154, 1},
+		{0x2F8F1, 12155, 1},
+		{0x2F8F2, 12156, 1},
+		{0x2F8F3, 12157, 1},
+		{0x2F8F4, 12158, 1},
+		{0x2F8F5, 12159, 1},
+		{0x2F8F6, 12160, 1},
+		{0x2F8F7, 12161, 1},
+		{0x2F8F8, 12162, 1},
+		{0x2F8F9, 12163, 1},
+		{0x2F8FA, 12164, 1},
+		{0x2F8FB, 12165, 1},
+		{0x2F8FC, 12166, 1},
+		{0x2F8FD, 12167, 1},
+		{0x2F8FE, 12168, 1},
+		{0x2F8FF, 12169, 1},
+		{0x2F900, 12170, 1},
+		{0x2F901, 12171, 1},
+		{0x2F902, 12172, 1},
+		{0x2F903, 12173, 1},
+		{0x2F904, 12174, 1},
+		{0x2F905, 12175, 1},
+		{0x2F906, 12176, 1},
+		{0x2F907, 12177, 1},
+		{0x2F908, 12178, 1},
+		{0x2F909, 12179, 1},
+		{0x2F90A, 12180, 1},
+		{0x2F90B, 12181, 1},
+		{0x2F90C, 12182, 1},
+		{0x2F90D, 12183, 1},
+		{0x2F90E, 12184, 1},
+		{0x2F90F, 12185, 1},
+		{0x2F910, 12186, 1},
+		{0x2F911, 12187, 1},
+		{0x2F912, 12188, 1},
+		{0x2F913, 12189, 1},
+		{0x2F914, 12190, 1},
+		{0x2F915, 12191, 1},
+		{0x2F916, 12192, 1},
+		{0x2F917, 12193, 1},
+		{0x2F918, 12194, 1},
+		{0x2F919, 12195, 1},
+		{0x2F91A, 12196, 1},
+		{0x2F91B, 12197, 1},
+		{0x2F91C, 12198, 1},
+		{0x2F91D, 12199, 1},
+		{0x2F91E, 12200, 1},
+		{0x2F91F, 12201, 1},
+		{0x2F920, 12202, 1},
+		{0x2F921, 12203, 1},
+		{0x2F922, 12204, 1},
+		{0x2F923, 12205, 1},
+		{0x2F924, 12206, 1},
+		{0x2F925, 12207, 1},
+		{0x2F926, 12208, 1},
+		{0x2F927, 12209, 1},
+		{0x2F928, 12210, 1},
+		{0x2F929, 12211, 1},
+		{0x2F92A, 12212, 1},
+		{0x2F92B, 12213, 1},
+		{0x2F92C, 12214, 1},
+		{0x2F92D, 12215, 1},
+		{0x2F92E, 12216, 1},
+		{0x2F92F, 12217, 1},
+		{0x2F930, 12218, 1},
+		{0x2F931, 12219, 1},
+		{0x2F932, 12220, 1},
+		{0x2F933, 12221, 1},
+		{0x2F934, 12222, 1},
+		{0x2F935, 12223, 1},
+		{0x2F936, 12224, 1},
+		{0x2F937, 12225, 1},
+		{0x2F938, 12226, 1},
+		{0x2F939, 12227, 1},
+		{0x2F93A, 12228, 1},
+		{0x2F93B, 12229, 1},
+		{0x2F93C, 12230, 1},
+		{0x2F93D, 12231, 1},
+		{0x2F93E, 12232, 1},
+		{0x2F93F, 12233, 1},
+		{0x2F940, 12234, 1},
+		{0x2F941, 12235, 1},
+		{0x2F942, 12236, 1},
+		{0x2F943, 12237, 1},
+		{0x2F944, 12238, 1},
+		{0x2F945, 12239, 1},
+		{0x2F946, 12240, 1},
+		{0x2F947, 12241, 1},
+		{0x2F948, 12242, 1},
+		{0x2F949, 12243, 1},
+		{0x2F94A, 12244, 1},
+		{0x2F94B, 12245, 1},
+		{0x2F94C, 12246, 1},
+		{0x2F94D, 12247, 1},
+		{0x2F94E, 12248, 1},
+		{0x2F94F, 12249, 1},
+		{0x2F950, 12250, 1},
+		{0x2F951, 12251, 1},
+		{0x2F952, 12252, 1},
+		{0x2F953, 12253, 1},
+		{0x2F954, 12254, 1},
+		{0x2F955, 12255, 1},
+		{0x2F956, 12256, 1},
+		{0x2F957, 12257, 1},
+		{0x2F958, 12258, 1},
+		{0x2F959, 12259, 1},
+		{0x2F95A, 12260, 1},
+		{0x2F95B, 12261, 1},
+		{0x2F95C, 12262, 1},
+		{0x2F95D, 12263, 1},
+		{0x2F95E, 12264, 1},
+		{0x2F95F, 12265, 1},
+		{0x2F960, 12266, 1},
+		{0x2F961, 12267, 1},
+		{0x2F962, 12268, 1},
+		{0x2F963, 12269, 1},
+		{0x2F964, 12270, 1},
+		{0x2F965, 12271, 1},
+		{0x2F966, 12272, 1},
+		{0x2F967, 12273, 1},
+		{0x2F968, 12274, 1},
+		{0x2F969, 12275, 1},
+		{0x2F96A, 12276, 1},
+		{0x2F96B, 12277, 1},
+		{0x2F96C, 12278, 1},
+		{0x2F96D, 12279, 1},
+		{0x2F96E, 12280, 1},
+		{0x2F96F, 12281, 1},
+		{0x2F970, 12282, 1},
+		{0x2F971, 12283, 1},
+		{0x2F972, 12284, 1},
+		{0x2F973, 12285, 1},
+		{0x2F974, 12286, 1},
+		{0x2F975, 12287, 1},
+		{0x2F976, 12288, 1},
+		{0x2F977, 12289, 1},
+		{0x2F978, 12290, 1},
+		{0x2F979, 12291, 1},
+		{0x2F97A, 12292, 1},
+		{0x2F97B, 12293, 1},
+		{0x2F97C, 12294, 1},
+		{0x2F97D, 12295, 1},
+		{0x2F97E, 12296, 1},
+		{0x2F97F, 12297, 1},
+		{0x2F980, 12298, 1},
+		{0x2F981, 12299, 1},
+		{0x2F982, 12300, 1},
+		{0x2F983, 12301, 1},
+		{0x2F984, 12302, 1},
+		{0x2F985, 12303, 1},
+		{0x2F986, 12304, 1},
+		{0x2F987, 12305, 1},
+		{0x2F988, 12306, 1},
+		{0x2F989, 12307, 1},
+		{0x2F98A, 12308, 1},
+		{0x2F98B, 12309, 1},
+		{0x2F98C, 12310, 1},
+		{0x2F98D, 12311, 1},
+		{0x2F98E, 12312, 1},
+		{0x2F98F, 12313, 1},
+		{0x2F990, 12314, 1},
+		{0x2F991, 12315, 1},
+		{0x2F992, 12316, 1},
+		{0x2F993, 12317, 1},
+		{0x2F994, 12318, 1},
+		{0x2F995, 12319, 1},
+		{0x2F996, 12320, 1},
+		{0x2F997, 12321, 1},
+		{0x2F998, 12322, 1},
+		{0x2F999, 12323, 1},
+		{0x2F99A, 12324, 1},
+		{0x2F99B, 12325, 1},
+		{0x2F99C, 12326, 1},
+		{0x2F99D, 12327, 1},
+		{0x2F99E, 12328, 1},
+		{0x2F99F, 12329, 1},
+		{0x2F9A0, 12330, 1},
+		{0x2F9A1, 12331, 1},
+		{0x2F9A2, 12332, 1},
+		{0x2F9A3, 12333, 1},
+		{0x2F9A4, 12334, 1},
+		{0x2F9A5, 12335, 1},
+		{0x2F9A6, 12336, 1},
+		{0x2F9A7, 12337, 1},
+		{0x2F9A8, 12338, 1},
+		{0x2F9A9, 12339, 1},
+		{0x2F9AA, 12340, 1},
+		{0x2F9AB, 12341, 1},
+		{0x2F9AC, 12342, 1},
+		{0x2F9AD, 12343, 1},
+		{0x2F9AE, 12344, 1},
+		{0x2F9AF, 12345, 1},
+		{0x2F9B0, 12346, 1},
+		{0x2F9B1, 12347, 1},
+		{0x2F9B2, 12348, 1},
+		{0x2F9B3, 12349, 1},
+		{0x2F9B4, 12350, 1},
+		{0x2F9B5, 12351, 1},
+		{0x2F9B6, 12352, 1},
+		{0x2F9B7, 12353, 1},
+		{0x2F9B8, 12354, 1},
+		{0x2F9B9, 12355, 1},
+		{0x2F9BA, 12356, 1},
+		{0x2F9BB, 12357, 1},
+		{0x2F9BC, 12358, 1},
+		{0x2F9BD, 12359, 1},
+		{0x2F9BE, 12360, 1},
+		{0x2F9BF, 12361, 1},
+		{0x2F9C0, 12362, 1},
+		{0x2F9C1, 12363, 1},
+		{0x2F9C2, 12364, 1},
+		{0x2F9C3, 12365, 1},
+		{0x2F9C4, 12366, 1},
+		{0x2F9C5, 12367, 1},
+		{0x2F9C6, 12368, 1},
+		{0x2F9C7, 12369, 1},
+		{0x2F9C8, 12370, 1},
+		{0x2F9C9, 12371, 1},
+		{0x2F9CA, 12372, 1},
+		{0x2F9CB, 12373, 1},
+		{0x2F9CC, 12374, 1},
+		{0x2F9CD, 12375, 1},
+		{0x2F9CE, 12376, 1},
+		{0x2F9CF, 12377, 1},
+		{0x2F9D0, 12378, 1},
+		{0x2F9D1, 12379, 1},
+		{0x2F9D2, 12380, 1},
+		{0x2F9D3, 12381, 1},
+		{0x2F9D4, 12382, 1},
+		{0x2F9D5, 12383, 1},
+		{0x2F9D6, 12384, 1},
+		{0x2F9D7, 12385, 1},
+		{0x2F9D8, 12386, 1},
+		{0x2F9D9, 12387, 1},
+		{0x2F9DA, 12388, 1},
+		{0x2F9DB, 12389, 1},
+		{0x2F9DC, 12390, 1},
+		{0x2F9DD, 12391, 1},
+		{0x2F9DE, 12392, 1},
+		{0x2F9DF, 12393, 1},
+		{0x2F9E0, 12394, 1},
+		{0x2F9E1, 12395, 1},
+		{0x2F9E2, 12396, 1},
+		{0x2F9E3, 12397, 1},
+		{0x2F9E4, 12398, 1},
+		{0x2F9E5, 12399, 1},
+		{0x2F9E6, 12400, 1},
+		{0x2F9E7, 12401, 1},
+		{0x2F9E8, 12402, 1},
+		{0x2F9E9, 12403, 1},
+		{0x2F9EA, 12404, 1},
+		{0x2F9EB, 12405, 1},
+		{0x2F9EC, 12406, 1},
+		{0x2F9ED, 12407, 1},
+		{0x2F9EE, 12408, 1},
+		{0x2F9EF, 12409, 1},
+		{0x2F9F0, 12410, 1},
+		{0x2F9F1, 12411, 1},
+		{0x2F9F2, 12412, 1},
+		{0x2F9F3, 12413, 1},
+		{0x2F9F4, 12414, 1},
+		{0x2F9F5, 12415, 1},
+		{0x2F9F6, 12416, 1},
+		{0x2F9F7, 12417, 1},
+		{0x2F9F8, 12418, 1},
+		{0x2F9F9, 12419, 1},
+		{0x2F9FA, 12420, 1},
+		{0x2F9FB, 12421, 1},
+		{0x2F9FC, 12422, 1},
+		{0x2F9FD, 12423, 1},
+		{0x2F9FE, 12424, 1},
+		{0x2F9FF, 12425, 1},
+		{0x2FA00, 12426, 1},
+		{0x2FA01, 12427, 1},
+		{0x2FA02, 12428, 1},
+		{0x2FA03, 12429, 1},
+		{0x2FA04, 12430, 1},
+		{0x2FA05, 12431, 1},
+		{0x2FA06, 12432, 1},
+		{0x2FA07, 12433, 1},
+		{0x2FA08, 12434, 1},
+		{0x2FA09, 12435, 1},
+		{0x2FA0A, 12436, 1},
+		{0x2FA0B, 12437, 1},
+		{0x2FA0C, 12438, 1},
+		{0x2FA0D, 12439, 1},
+		{0x2FA0E, 12440, 1},
+		{0x2FA0F, 12441, 1},
+		{0x2FA10, 12442, 1},
+		{0x2FA11, 12443, 1},
+		{0x2FA12, 12444, 1},
+		{0x2FA13, 12445, 1},
+		{0x2FA14, 12446, 1},
+		{0x2FA15, 12447, 1},
+		{0x2FA16, 12448, 1},
+		{0x2FA17, 12449, 1},
+		{0x2FA18, 12450, 1},
+		{0x2FA19, 12451, 1},
+		{0x2FA1A, 12452, 1},
+		{0x2FA1B, 12453, 1},
+		{0x2FA1C, 12454, 1},
+		{0x2FA1D, 12455, 1},
+	};
+
+	/// The primary composites, by first and then second code point,
+	/// except Hangul.
+	inline static constexpr composition COMPOSITIONS[941] = {
+		{0x003C, 0x0338, 0x226E},
+		{0x003D, 0x0338, 0x2260},
+		{0x003E, 0x0338, 0x226F},
+		{0x0041, 0x0300, 0x00C0},
+		{0x0041, 0x0301, 0x00C1},
+		{0x0041, 0x0302, 0x00C2},
+		{0x0041, 0x0303, 0x00C3},
+		{0x0041, 0x0304, 0x0100},
+		{0x0041, 0x0306, 0x0102},
+		{0x0041, 0x0307, 0x0226},
+		{0x0041, 0x0308, 0x00C4},
+		{0x0041, 0x0309, 0x1EA2},
+		{0x0041, 0x030A, 0x00C5},
+		{0x0041, 0x030C, 0x01CD},
+		{0x0041, 0x030F, 0x0200},
+		{0x0041, 0x0311, 0x0202},
+		{0x0041, 0x0323, 0x1EA0},
+		{0x0041, 0x0325, 0x1E00},
+		{0x0041, 0x0328, 0x0104},
+		{0x0042, 0x0307, 0x1E02},
+		{0x0042, 0x0323, 0x1E04},
+		{0x0042, 0x0331, 0x1E06},
+		{0x0043, 0x0301, 0x0106},
+		{0x0043, 0x0302, 0x0108},
+		{0x0043, 0x0307, 0x010A},
+		{0x0043, 0x030C, 0x010C},
+		{0x0043, 0x0327, 0x00C7},
+		{0x0044, 0x0307, 0x1E0A},
+		{0x0044, 0x030C, 0x010E},
+		{0x0044, 0x0323, 0x1E0C},
+		{0x0044, 0x0327, 0x1E10},
+		{0x0044, 0x032D, 0x1E12},
+		{0x0044, 0x0331, 0x1E0E},
+		{0x0045, 0x0300, 0x00C8},
+		{0x0045, 0x0301, 0x00C9},
+		{0x0045, 0x0302, 0x00CA},
+		{0x0045, 0x0303, 0x1EBC},
+		{0x0045, 0x0304, 0x0112},
+		{0x0045, 0x0306, 0x0114},
+		{0x0045, 0x0307, 0x0116},
+		{0x0045, 0x0308, 0x00CB},
+		{0x0045, 0x0309, 0x1EBA},
+		{0x0045, 0x030C, 0x011A},
+		{0x0045, 0x030F, 0x0204},
+		{0x0045, 0x0311, 0x0206},
+		{0x0045, 0x0323, 0x1EB8},
+		{0x0045, 0x0327, 0x0228},
+		{0x0045, 0x0328, 0x0118},
+		{0x0045, 0x032D, 0x1E18},
+		{0x0045, 0x0330, 0x1E1A},
+		{0x0046, 0x0307, 0x1E1E},
+		{0x0047, 0x0301, 0x01F4},
+		{0x0047, 0x0302, 0x011C},
+		{0x0047, 0x0304, 0x1E20},
+		{0x0047, 0x0306, 0x011E},
+		{0x0047, 0x0307, 0x0120},
+		{0x0047, 0x030C, 0x01E6},
+		{0x0047, 0x0327, 0x0122},
+		{0x0048, 0x0302, 0x0124},
+		{0x0048, 0x0307, 0x1E22},
+		{0x0048, 0x0308, 0x1E26},
+		{0x0048, 0x030C, 0x021E},
+		{0x0048, 0x0323, 0x1E24},
+		{0x0048, 0x0327, 0x1E28},
+		{0x0048, 0x032E, 0x1E2A},
+		{0x0049, 0x0300, 0x00CC},
+		{0x0049, 0x0301, 0x00CD},
+		{0x0049, 0x0302, 0x00CE},
+		{0x0049, 0x0303, 0x0128},
+		{0x0049, 0x0304, 0x012A},
+		{0x0049, 0x0306, 0x012C},
+		{0x0049, 0x0307, 0x0130},
+		{0x0049, 0x0308, 0x00CF},
+		{0x0049, 0x0309, 0x1EC8},
+		{0x0049, 0x030C, 0x01CF},
+		{0x0049, 0x030F, 0x0208},
+		{0x0049, 0x0311, 0x020A},
+		{0x0049, 0x0323, 0x1ECA},
+		{0x0049, 0x0328, 0x012E},
+		{0x0049, 0x0330, 0x1E2C},
+		{0x004A, 0x0302, 0x0134},
+		{0x004B, 0x0301, 0x1E30},
+		{0x004B, 0x030C, 0x01E8},
+		{0x004B, 0x0323, 0x1E32},
+		{0x004B, 0x0327, 0x0136},
+		{0x004B, 0x0331, 0x1E34},
+		{0x004C, 0x0301, 0x0139},
+		{0x004C, 0x030C, 0x013D},
+		{0x004C, 0x0323, 0x1E36},
+		{0x004C, 0x0327, 0x013B},
+		{0x004C, 0x032D, 0x1E3C},
+		{0x004C, 0x0331, 0x1E3A},
+		{0x004D, 0x0301, 0x1E3E},
+		{0x004D, 0x0307, 0x1E40},
+		{0x004D, 0x0323, 0x1E42},
+		{0x004E, 0x0300, 0x01F8},
+		{0x004E, 0x0301, 0x0143},
+		{0x004E, 0x0303, 0x00D1},
+		{0x004E, 0x0307, 0x1E44},
+		{0x004E, 0x030C, 0x0147},
+		{0x004E, 0x0323, 0x1E46},
+		{0x004E, 0x0327, 0x0145},
+		{0x004E, 0x032D, 0x1E4A},
+		{0x004E, 0x0331, 0x1E48},
+		{0x004F, 0x0300, 0x00D2},
+		{0x004F, 0x0301, 0x00D3},
+		{0x004F, 0x0302, 0x00D4},
+		{0x004F, 0x0303, 0x00D5},
+		{0x004F, 0x0304, 0x014C},
+		{0x004F, 0x0306, 0x014E},
+		{0x004F, 0x0307, 0x022E},
+		{0x004F, 0x0308, 0x00D6},
+		{0x004F, 0x0309, 0x1ECE},
+		{0x004F, 0x030B, 0x0150},
+		{0x004F, 0x030C, 0x01D1},
+		{0x004F, 0x030F, 0x020C},
+		{0x004F, 0x0311, 0x020E},
+		{0x004F, 0x031B, 0x01A0},
+		{0x004F, 0x0323, 0x1ECC},
+		{0x004F, 0x0328, 0x01EA},
+		{0x0050, 0x0301, 0x1E54},
+		{0x0050, 0x0307, 0x1E56},
+		{0x0052, 0x0301, 0x0154},
+		{0x0052, 0x0307, 0x1E58},
+		{0x0052, 0x030C, 0x0158},
+		{0x0052, 0x030F, 0x0210},
+		{0x0052, 0x0311, 0x0212},
+		{0x0052, 0x0323, 0x1E5A},
+		{0x0052, 0x0327, 0x0156},
+		{0x0052, 0x0331, 0x1E5E},
+		{0x0053, 0x0301, 0x015A},
+		{0x0053, 0x0302, 0x015C},
+		{0x0053, 0x0307, 0x1E60},
+		{0x0053, 0x030C, 0x0160},
+		{0x0053, 0x0323, 0x1E62},
+		{0x0053, 0x0326, 0x0218},
+		{0x0053, 0x0327, 0x015E},
+		{0x0054, 0x0307, 0x1E6A},
+		{0x0054, 0x030C, 0x0164},
+		{0x0054, 0x0323, 0x1E6C},
+		{0x0054, 0x0326, 0x021A},
+		{0x0054, 0x0327, 0x0162},
+		{0x0054, 0x032D, 0x1E70},
+		{0x0054, 0x0331, 0x1E6E},
+		{0x0055, 0x0300, 0x00D9},
+		{0x0055, 0x0301, 0x00DA},
+		{0x0055, 0x0302, 0x00DB},
+		{0x0055, 0x0303, 0x0168},
+		{0x0055, 0x0304, 0x016A},
+		{0x0055, 0x0306, 0x016C},
+		{0x0055, 0x0308, 0x00DC},
+		{0x0055, 0x0309, 0x1EE6},
+		{0x0055, 0x030A, 0x016E},
+		{0x0055, 0x030B, 0x0170},
+		{0x0055, 0x030C, 0x01D3},
+		{0x0055, 0x030F, 0x0214},
+		{0x0055, 0x0311, 0x0216},
+		{0x0055, 0x031B, 0x01AF},
+		{0x0055, 0x0323, 0x1EE4},
+		{0x0055, 0x0324, 0x1E72},
+		{0x0055, 0x0328, 0x0172},
+		{0x0055, 0x032D, 0x1E76},
+		{0x0055, 0x0330, 0x1E74},
+		{0x0056, 0x0303, 0x1E7C},
+		{0x0056, 0x0323, 0x1E7E},
+		{0x0057, 0x0300, 0x1E80},
+		{0x0057, 0x0301, 0x1E82},
+		{0x0057, 0x0302, 0x0174},
+		{0x0057, 0x0307, 0x1E86},
+		{0x0057, 0x0308, 0x1E84},
+		{0x0057, 0x0323, 0x1E88},
+		{0x0058, 0x0307, 0x1E8A},
+		{0x0058, 0x0308, 0x1E8C},
+		{0x0059, 0x0300, 0x1EF2},
+		{0x0059, 0x0301, 0x00DD},
+		{0x0059, 0x0302, 0x0176},
+		{0x0059, 0x0303, 0x1EF8},
+		{0x0059, 0x0304, 0x0232},
+		{0x0059, 0x0307, 0x1E8E},
+		{0x0059, 0x0308, 0x0178},
+		{0x0059, 0x0309, 0x1EF6},
+		{0x0059, 0x0323, 0x1EF4},
+		{0x005A, 0x0301, 0x0179},
+		{0x005A, 0x0302, 0x1E90},
+		{0x005A, 0x0307, 0x017B},
+		{0x005A, 0x030C, 0x017D},
+		{0x005A, 0x0323, 0x1E92},
+		{0x005A, 0x0331, 0x1E94},
+		{0x0061, 0x0300, 0x00E0},
+		{0x0061, 0x0301, 0x00E1},
+		{0x0061, 0x0302, 0x00E2},
+		{0x0061, 0x0303, 0x00E3},
+		{0x0061, 0x0304, 0x0101},
+		{0x0061, 0x0306, 0x0103},
+		{0x0061, 0x0307, 0x0227},
+		{0x0061, 0x0308, 0x00E4},
+		{0x0061, 0x0309, 0x1EA3},
+		{0x0061, 0x030A, 0x00E5},
+		{0x0061, 0x030C, 0x01CE},
+		{0x0061, 0x030F, 0x0201},
+		{0x0061, 0x0311, 0x0203},
+		{0x0061, 0x0323, 0x1EA1},
+		{0x0061, 0x0325, 0x1E01},
+		{0x0061, 0x0328, 0x0105},
+		{0x0062, 0x0307, 0x1E03},
+		{0x0062, 0x0323, 0x1E05},
+		{0x0062, 0x0331, 0x1E07},
+		{0x0063, 0x0301, 0x0107},
+		{0x0063, 0x0302, 0x0109},
+		{0x0063, 0x0307, 0x010B},
+		{0x0063, 0x030C, 0x010D},
+		{0x0063, 0x0327, 0x00E7},
+		{0x0064, 0x0307, 0x1E0B},
+		{0x0064, 0x030C, 0x010F},
+		{0x0064, 0x0323, 0x1E0D},
+		{0x0064, 0x0327, 0x1E11},
+		{0x0064, 0x032D, 0x1E13},
+		{0x0064, 0x0331, 0x1E0F},
+		{0x0065, 0x0300, 0x00E8},
+		{0x0065, 0x0301, 0x00E9},
+		{0x0065, 0x0302, 0x00EA},
+		{0x0065, 0x0303, 0x1EBD},
+		{0x0065, 0x0304, 0x0113},
+		{0x0065, 0x0306, 0x0115},
+		{0x0065, 0x0307, 0x0117},
+		{0x0065, 0x0308, 0x00EB},
+		{0x0065, 0x0309, 0x1EBB},
+		{0x0065, 0x030C, 0x011B},
+		{0x0065, 0x030F, 0x0205},
+		{0x0065, 0x0311, 0x0207},
+		{0x0065, 0x0323, 0x1EB9},
+		{0x0065, 0x0327, 0x0229},
+		{0x0065, 0x0328, 0x0119},
+		{0x0065, 0x032D, 0x1E19},
+		{0x0065, 0x0330, 0x1E1B},
+		{0x0066, 0x0307, 0x1E1F},
+		{0x0067, 0x0301, 0x01F5},
+		{0x0067, 0x0302, 0x011D},
+		{0x0067, 0x0304, 0x1E21},
+		{0x0067, 0x0306, 0x011F},
+		{0x0067, 0x0307, 0x0121},
+		{0x0067, 0x030C, 0x01E7},
+		{0x0067, 0x0327, 0x0123},
+		{0x0068, 0x0302, 0x0125},
+		{0x0068, 0x0307, 0x1E23},
+		{0x0068, 0x0308, 0x1E27},
+		{0x0068, 0x030C, 0x021F},
+		{0x0068, 0x0323, 0x1E25},
+		{0x0068, 0x0327, 0x1E29},
+		{0x0068, 0x032E, 0x1E2B},
+		{0x0068, 0x0331, 0x1E96},
+		{0x0069, 0x0300, 0x00EC},
+		{0x0069, 0x0301, 0x00ED},
+		{0x0069, 0x0302, 0x00EE},
+		{0x0069, 0x0303, 0x0129},
+		{0x0069, 0x0304, 0x012B},
+		{0x0069, 0x0306, 0x012D},
+		{0x0069, 0x0308, 0x00EF},
+		{0x0069, 0x0309, 0x1EC9},
+		{0x0069, 0x030C, 0x01D0},
+		{0x0069, 0x030F, 0x0209},
+		{0x0069, 0x0311, 0x020B},
+		{0x0069, 0x0323, 0x1ECB},
+		{0x0069, 0x0328, 0x012F},
+		{0x0069, 0x0330, 0x1E2D},
+		{0x006A, 0x0302, 0x0135},
+		{0x006A, 0x030C, 0x01F0},
+		{0x006B, 0x0301, 0x1E31},
+		{0x006B, 0x030C, 0x01E9},
+		{0x006B, 0x0323, 0x1E33},
+		{0x006B, 0x0327, 0x0137},
+		{0x006B, 0x0331, 0x1E35},
+		{0x006C, 0x0301, 0x013A},
+		{0x006C, 0x030C, 0x013E},
+		{0x006C, 0x0323, 0x1E37},
+		{0x006C, 0x0327, 0x013C},
+		{0x006C, 0x032D, 0x1E3D},
+		{0x006C, 0x0331, 0x1E3B},
+		{0x006D, 0x0301, 0x1E3F},
+		{0x006D, 0x0307, 0x1E41},
+		{0x006D, 0x0323, 0x1E43},
+		{0x006E, 0x0300, 0x01F9},
+		{0x006E, 0x0301, 0x0144},
+		{0x006E, 0x0303, 0x00F1},
+		{0x006E, 0x0307, 0x1E45},
+		{0x006E, 0x030C, 0x0148},
+		{0x006E, 0x0323, 0x1E47},
+		{0x006E, 0x0327, 0x0146},
+		{0x006E, 0x032D, 0x1E4B},
+		{0x006E, 0x0331, 0x1E49},
+		{0x006F, 0x0300, 0x00F2},
+		{0x006F, 0x0301, 0x00F3},
+		{0x006F, 0x0302, 0x00F4},
+		{0x006F, 0x0303, 0x00F5},
+		{0x006F, 0x0304, 0x014D},
+		{0x006F, 0x0306, 0x014F},
+		{0x006F, 0x0307, 0x022F},
+		{0x006F, 0x0308, 0x00F6},
+		{0x006F, 0x0309, 0x1ECF},
+		{0x006F, 0x030B, 0x0151},
+		{0x006F, 0x030C, 0x01D2},
+		{0x006F, 0x030F, 0x020D},
+		{0x006F, 0x0311, 0x020F},
+		{0x006F, 0x031B, 0x01A1},
+		{0x006F, 0x0323, 0x1ECD},
+		{0x006F, 0x0328, 0x01EB},
+		{0x0070, 0x0301, 0x1E55},
+		{0x0070, 0x0307, 0x1E57},
+		{0x0072, 0x0301, 0x0155},
+		{0x0072, 0x0307, 0x1E59},
+		{0x0072, 0x030C, 0x0159},
+		{0x0072, 0x030F, 0x0211},
+		{0x0072, 0x0311, 0x0213},
+		{0x0072, 0x0323, 0x1E5B},
+		{0x0072, 0x0327, 0x0157},
+		{0x0072, 0x0331, 0x1E5F},
+		{0x0073, 0x0301, 0x015B},
+		{0x0073, 0x0302, 0x015D},
+		{0x0073, 0x0307, 0x1E61},
+		{0x0073, 0x030C, 0x0161},
+		{0x0073, 0x0323, 0x1E63},
+		{0x0073, 0x0326, 0x0219},
+		{0x0073, 0x0327, 0x015F},
+		{0x0074, 0x0307, 0x1E6B},
+		{0x0074, 0x0308, 0x1E97},
+		{0x0074, 0x030C, 0x0165},
+		{0x0074, 0x0323, 0x1E6D},
+		{0x0074, 0x0326, 0x021B},
+		{0x0074, 0x0327, 0x0163},
+		{0x0074, 0x032D, 0x1E71},
+		{0x0074, 0x0331, 0x1E6F},
+		{0x0075, 0x0300, 0x00F9},
+		{0x0075, 0x0301, 0x00FA},
+		{0x0075, 0x0302, 0x00FB},
+		{0x0075, 0x0303, 0x0169},
+		{0x0075, 0x0304, 0x016B},
+		{0x0075, 0x0306, 0x016D},
+		{0x0075, 0x0308, 0x00FC},
+		{0x0075, 0x0309, 0x1EE7},
+		{0x0075, 0x030A, 0x016F},
+		{0x0075, 0x030B, 0x0171},
+		{0x0075, 0x030C, 0x01D4},
+		{0x0075, 0x030F, 0x0215},
+		{0x0075, 0x0311, 0x0217},
+		{0x0075, 0x031B, 0x01B0},
+		{0x0075, 0x0323, 0x1EE5},
+		{0x0075, 0x0324, 0x1E73},
+		{0x0075, 0x0328, 0x0173},
+		{0x0075, 0x032D, 0x1E77},
+		{0x0075, 0x0330, 0x1E75},
+		{0x0076, 0x0303, 0x1E7D},
+		{0x0076, 0x0323, 0x1E7F},
+		{0x0077, 0x0300, 0x1E81},
+		{0x0077, 0x0301, 0x1E83},
+		{0x0077, 0x0302, 0x0175},
+		{0x0077, 0x0307, 0x1E87},
+		{0x0077, 0x0308, 0x1E85},
+		{0x0077, 0x030A, 0x1E98},
+		{0x0077, 0x0323, 0x1E89},
+		{0x0078, 0x0307, 0x1E8B},
+		{0x0078, 0x0308, 0x1E8D},
+		{0x0079, 0x0300, 0x1EF3},
+		{0x0079, 0x0301, 0x00FD},
+		{0x0079, 0x0302, 0x0177},
+		{0x0079, 0x0303, 0x1EF9},
+		{0x0079, 0x0304, 0x0233},
+		{0x0079, 0x0307, 0x1E8F},
+		{0x0079, 0x0308, 0x00FF},
+		{0x0079, 0x0309, 0x1EF7},
+		{0x0079, 0x030A, 0x1E99},
+		{0x0079, 0x0323, 0x1EF5},
+		{0x007A, 0x0301, 0x017A},
+		{0x007A, 0x0302, 0x1E91},
+		{0x007A, 0x0307, 0x017C},
+		{0x007A, 0x030C, 0x017E},
+		{0x007A, 0x0323, 0x1E93},
+		{0x007A, 0x0331, 0x1E95},
+		{0x00A8, 0x0300, 0x1FED},
+		{0x00A8, 0x0301, 0x0385},
+		{0x00A8, 0x0342, 0x1FC1},
+		{0x00C2, 0x0300, 0x1EA6},
+		{0x00C2, 0x0301, 0x1EA4},
+		{0x00C2, 0x0303, 0x1EAA},
+		{0x00C2, 0x0309, 0x1EA8},
+		{0x00C4, 0x0304, 0x01DE},
+		{0x00C5, 0x0301, 0x01FA},
+		{0x00C6, 0x0301, 0x01FC},
+		{0x00C6, 0x0304, 0x01E2},
+		{0x00C7, 0x0301, 0x1E08},
+		{0x00CA, 0x0300, 0x1EC0},
+		{0x00CA, 0x0301, 0x1EBE},
+		{0x00CA, 0x0303, 0x1EC4},
+		{0x00CA, 0x0309, 0x1EC2},
+		{0x00CF, 0x0301, 0x1E2E},
+		{0x00D4, 0x0300, 0x1ED2},
+		{0x00D4, 0x0301, 0x1ED0},
+		{0x00D4, 0x0303, 0x1ED6},
+		{0x00D4, 0x0309, 0x1ED4},
+		{0x00D5, 0x0301, 0x1E4C},
+		{0x00D5, 0x0304, 0x022C},
+		{0x00D5, 0x0308, 0x1E4E},
+		{0x00D6, 0x0304, 0x022A},
+		{0x00D8, 0x0301, 0x01FE},
+		{0x00DC, 0x0300, 0x01DB},
+		{0x00DC, 0x0301, 0x01D7},
+		{0x00DC, 0x0304, 0x01D5},
+		{0x00DC, 0x030C, 0x01D9},
+		{0x00E2, 0x0300, 0x1EA7},
+		{0x00E2, 0x0301, 0x1EA5},
+		{0x00E2, 0x0303, 0x1EAB},
+		{0x00E2, 0x0309, 0x1EA9},
+		{0x00E4, 0x0304, 0x01DF},
+		{0x00E5, 0x0301, 0x01FB},
+		{0x00E6, 0x0301, 0x01FD},
+		{0x00E6, 0x0304, 0x01E3},
+		{0x00E7, 0x0301, 0x1E09},
+		{0x00EA, 0x0300, 0x1EC1},
+		{0x00EA, 0x0301, 0x1EBF},
+		{0x00EA, 0x0303, 0x1EC5},
+		{0x00EA, 0x0309, 0x1EC3},
+		{0x00EF, 0x0301, 0x1E2F},
+		{0x00F4, 0x0300, 0x1ED3},
+		{0x00F4, 0x0301, 0x1ED1},
+		{0x00F4, 0x0303, 0x1ED7},
+		{0x00F4, 0x0309, 0x1ED5},
+		{0x00F5, 0x0301, 0x1E4D},
+		{0x00F5, 0x0304, 0x022D},
+		{0x00F5, 0x0308, 0x1E4F},
+		{0x00F6, 0x0304, 0x022B},
+		{0x00F8, 0x0301, 0x01FF},
+		{0x00FC, 0x0300, 0x01DC},
+		{0x00FC, 0x0301, 0x01D8},
+		{0x00FC, 0x0304, 0x01D6},
+		{0x00FC, 0x030C, 0x01DA},
+		{0x0102, 0x0300, 0x1EB0},
+		{0x0102, 0x0301, 0x1EAE},
+		{0x0102, 0x0303, 0x1EB4},
+		{0x0102, 0x0309, 0x1EB2},
+		{0x0103, 0x0300, 0x1EB1},
+		{0x0103, 0x0301, 0x1EAF},
+		{0x0103, 0x0303, 0x1EB5},
+		{0x0103, 0x0309, 0x1EB3},
+		{0x0112, 0x0300, 0x1E14},
+		{0x0112, 0x0301, 0x1E16},
+		{0x0113, 0x0300, 0x1E15},
+		{0x0113, 0x0301, 0x1E17},
+		{0x014C, 0x0300, 0x1E50},
+		{0x014C, 0x0301, 0x1E52},
+		{0x014D, 0x0300, 0x1E51},
+		{0x014D, 0x0301, 0x1E53},
+		{0x015A, 0x0307, 0x1E64},
+		{0x015B, 0x0307, 0x1E65},
+		{0x0160, 0x0307, 0x1E66},
+		{0x0161, 0x0307, 0x1E67},
+		{0x0168, 0x0301, 0x1E78},
+		{0x0169, 0x0301, 0x1E79},
+		{0x016A, 0x0308, 0x1E7A},
+		{0x016B, 0x0308, 0x1E7B},
+		{0x017F, 0x0307, 0x1E9B},
+		{0x01A0, 0x0300, 0x1EDC},
+		{0x01A0, 0x0301, 0x1EDA},
+		{0x01A0, 0x0303, 0x1EE0},
+		{0x01A0, 0x0309, 0x1EDE},
+		{0x01A0, 0x0323, 0x1EE2},
+		{0x01A1, 0x0300, 0x1EDD},
+		{0x01A1, 0x0301, 0x1EDB},
+		{0x01A1, 0x0303, 0x1EE1},
+		{0x01A1, 0x0309, 0x1EDF},
+		{0x01A1, 0x0323, 0x1EE3},
+		{0x01AF, 0x0300, 0x1EEA},
+		{0x01AF, 0x0301, 0x1EE8},
+		{0x01AF, 0x0303, 0x1EEE},
+		{0x01AF, 0x0309, 0x1EEC},
+		{0x01AF, 0x0323, 0x1EF0},
+		{0x01B0, 0x0300, 0x1EEB},
+		{0x01B0, 0x0301, 0x1EE9},
+		{0x01B0, 0x0303, 0x1EEF},
+		{0x01B0, 0x0309, 0x1EED},
+		{0x01B0, 0x0323, 0x1EF1},
+		{0x01B7, 0x030C, 0x01EE},
+		{0x01EA, 0x0304, 0x01EC},
+		{0x01EB, 0x0304, 0x01ED},
+		{0x0226, 0x0304, 0x01E0},
+		{0x0227, 0x0304, 0x01E1},
+		{0x0228, 0x0306, 0x1E1C},
+		{0x0229, 0x0306, 0x1E1D},
+		{0x022E, 0x0304, 0x0230},
+		{0x022F, 0x0304, 0x0231},
+		{0x0292, 0x030C, 0x01EF},
+		{0x0391, 0x0300, 0x1FBA},
+		{0x0391, 0x0301, 0x0386},
+		{0x0391, 0x0304, 0x1FB9},
+		{0x0391, 0x0306, 0x1FB8},
+		{0x0391, 0x0313, 0x1F08},
+		{0x0391, 0x0314, 0x1F09},
+		{0x0391, 0x0345, 0x1FBC},
+		{0x0395, 0x0300, 0x1FC8},
+		{0x0395, 0x0301, 0x0388},
+		{0x0395, 0x0313, 0x1F18},
+		{0x0395, 0x0314, 0x1F19},
+		{0x0397, 0x0300, 0x1FCA},
+		{0x0397, 0x0301, 0x0389},
+		{0x0397, 0x0313, 0x1F28},
+		{0x0397, 0x0314, 0x1F29},
+		{0x0397, 0x0345, 0x1FCC},
+		{0x0399, 0x0300, 0x1FDA},
+		{0x0399, 0x0301, 0x038A},
+		{0x0399, 0x0304, 0x1FD9},
+		{0x0399, 0x0306, 0x1FD8},
+		{0x0399, 0x0308, 0x03AA},
+		{0x0399, 0x0313, 0x1F38},
+		{0x0399, 0x0314, 0x1F39},
+		{0x039F, 0x0300, 0x1FF8},
+		{0x039F, 0x0301, 0x038C},
+		{0x039F, 0x0313, 0x1F48},
+		{0x039F, 0x0314, 0x1F49},
+		{0x03A1, 0x0314, 0x1FEC},
+		{0x03A5, 0x0300, 0x1FEA},
+		{0x03A5, 0x0301, 0x038E},
+		{0x03A5, 0x0304, 0x1FE9},
+		{0x03A5, 0x0306, 0x1FE8},
+		{0x03A5, 0x0308, 0x03AB},
+		{0x03A5, 0x0314, 0x1F59},
+		{0x03A9, 0x0300, 0x1FFA},
+		{0x03A9, 0x0301, 0x038F},
+		{0x03A9, 0x0313, 0x1F68},
+		{0x03A9, 0x0314, 0x1F69},
+		{0x03A9, 0x0345, 0x1FFC},
+		{0x03AC, 0x0345, 0x1FB4},
+		{0x03AE, 0x0345, 0x1FC4},
+		{0x03B1, 0x0300, 0x1F70},
+		{0x03B1, 0x0301, 0x03AC},
+		{0x03B1, 0x0304, 0x1FB1},
+		{0x03B1, 0x0306, 0x1FB0},
+		{0x03B1, 0x0313, 0x1F00},
+		{0x03B1, 0x0314, 0x1F01},
+		{0x03B1, 0x0342, 0x1FB6},
+		{0x03B1, 0x0345, 0x1FB3},
+		{0x03B5, 0x0300, 0x1F72},
+		{0x03B5, 0x0301, 0x03AD},
+		{0x03B5, 0x0313, 0x1F10},
+		{0x03B5, 0x0314, 0x1F11},
+		{0x03B7, 0x0300, 0x1F74},
+		{0x03B7, 0x0301, 0x03AE},
+		{0x03B7, 0x0313, 0x1F20},
+		{0x03B7, 0x0314, 0x1F21},
+		{0x03B7, 0x0342, 0x1FC6},
+		{0x03B7, 0x0345, 0x1FC3},
+		{0x03B9, 0x0300, 0x1F76},
+		{0x03B9, 0x0301, 0x03AF},
+		{0x03B9, 0x0304, 0x1FD1},
+		{0x03B9, 0x0306, 0x1FD0},
+		{0x03B9, 0x0308, 0x03CA},
+		{0x03B9, 0x0313, 0x1F30},
+		{0x03B9, 0x0314, 0x1F31},
+		{0x03B9, 0x0342, 0x1FD6},
+		{0x03BF, 0x0300, 0x1F78},
+		{0x03BF, 0x0301, 0x03CC},
+		{0x03BF, 0x0313, 0x1F40},
+		{0x03BF, 0x0314, 0x1F41},
+		{0x03C1, 0x0313, 0x1FE4},
+		{0x03C1, 0x0314, 0x1FE5},
+		{0x03C5, 0x0300, 0x1F7A},
+		{0x03C5, 0x0301, 0x03CD},
+		{0x03C5, 0x0304, 0x1FE1},
+		{0x03C5, 0x0306, 0x1FE0},
+		{0x03C5, 0x0308, 0x03CB},
+		{0x03C5, 0x0313, 0x1F50},
+		{0x03C5, 0x0314, 0x1F51},
+		{0x03C5, 0x0342, 0x1FE6},
+		{0x03C9, 0x0300, 0x1F7C},
+		{0x03C9, 0x0301, 0x03CE},
+		{0x03C9, 0x0313, 0x1F60},
+		{0x03C9, 0x0314, 0x1F61},
+		{0x03C9, 0x0342, 0x1FF6},
+		{0x03C9, 0x0345, 0x1FF3},
+		{0x03CA, 0x0300, 0x1FD2},
+		{0x03CA, 0x0301, 0x0390},
+		{0x03CA, 0x0342, 0x1FD7},
+		{0x03CB, 0x0300, 0x1FE2},
+		{0x03CB, 0x0301, 0x03B0},
+		{0x03CB, 0x0342, 0x1FE7},
+		{0x03CE, 0x0345, 0x1FF4},
+		{0x03D2, 0x0301, 0x03D3},
+		{0x03D2, 0x0308, 0x03D4},
+		{0x0406, 0x0308, 0x0407},
+		{0x0410, 0x0306, 0x04D0},
+		{0x0410, 0x0308, 0x04D2},
+		{0x0413, 0x0301, 0x0403},
+		{0x0415, 0x0300, 0x0400},
+		{0x0415, 0x0306, 0x04D6},
+		{0x0415, 0x0308, 0x0401},
+		{0x0416, 0x0306, 0x04C1},
+		{0x0416, 0x0308, 0x04DC},
+		{0x0417, 0x0308, 0x04DE},
+		{0x0418, 0x0300, 0x040D},
+		{0x0418, 0x0304, 0x04E2},
+		{0x0418, 0x0306, 0x0419},
+		{0x0418, 0x0308, 0x04E4},
+		{0x041A, 0x0301, 0x040C},
+		{0x041E, 0x0308, 0x04E6},
+		{0x0423, 0x0304, 0x04EE},
+		{0x0423, 0x0306, 0x040E},
+		{0x0423, 0x0308, 0x04F0},
+		{0x0423, 0x030B, 0x04F2},
+		{0x0427, 0x0308, 0x04F4},
+		{0x042B, 0x0308, 0x04F8},
+		{0x042D, 0x0308, 0x04EC},
+		{0x0430, 0x0306, 0x04D1},
+		{0x0430, 0x0308, 0x04D3},
+		{0x0433, 0x0301, 0x0453},
+		{0x0435, 0x0300, 0x0450},
+		{0x0435, 0x0306, 0x04D7},
+		{0x0435, 0x0308, 0x0451},
+		{0x0436, 0x0306, 0x04C2},
+		{0x0436, 0x0308, 0x04DD},
+		{0x0437, 0x0308, 0x04DF},
+		{0x0438, 0x0300, 0x045D},
+		{0x0438, 0x0304, 0x04E3},
+		{0x0438, 0x0306, 0x0439},
+		{0x0438, 0x0308, 0x04E5},
+		{0x043A, 0x0301, 0x045C},
+		{0x043E, 0x0308, 0x04E7},
+		{0x0443, 0x0304, 0x04EF},
+		{0x0443, 0x0306, 0x045E},
+		{0x0443, 0x0308, 0x04F1},
+		{0x0443, 0x030B, 0x04F3},
+		{0x0447, 0x0308, 0x04F5},
+		{0x044B, 0x0308, 0x04F9},
+		{0x044D, 0x0308, 0x04ED},
+		{0x0456, 0x0308, 0x0457},
+		{0x0474, 0x030F, 0x0476},
+		{0x0475, 0x030F, 0x0477},
+		{0x04D8, 0x0308, 0x04DA},
+		{0x04D9, 0x0308, 0x04DB},
+		{0x04E8, 0x0308, 0x04EA},
+		{0x04E9, 0x0308, 0x04EB},
+		{0x0627, 0x0653, 0x0622},
+		{0x0627, 0x0654, 0x0623},
+		{0x0627, 0x0655, 0x0625},
+		{0x0648, 0x0654, 0x0624},
+		{0x064A, 0x0654, 0x0626},
+		{0x06C1, 0x0654, 0x06C2},
+		{0x06D2, 0x0654, 0x06D3},
+		{0x06D5, 0x0654, 0x06C0},
+		{0x0928, 0x093C, 0x0929},
+		{0x0930, 0x093C, 0x0931},
+		{0x0933, 0x093C, 0x0934},
+		{0x09C7, 0x09BE, 0x09CB},
+		{0x09C7, 0x09D7, 0x09CC},
+		{0x0B47, 0x0B3E, 0x0B4B},
+		{0x0B47, 0x0B56, 0x0B48},
+		{0x0B47, 0x0B57, 0x0B4C},
+		{0x0B92, 0x0BD7, 0x0B94},
+		{0x0BC6, 0x0BBE, 0x0BCA},
+		{0x0BC6, 0x0BD7, 0x0BCC},
+		{0x0BC7, 0x0BBE, 0x0BCB},
+		{0x0C46, 0x0C56, 0x0C48},
+		{0x0CBF, 0x0CD5, 0x0CC0},
+		{0x0CC6, 0x0CC2, 0x0CCA},
+		{0x0CC6, 0x0CD5, 0x0CC7},
+		{0x0CC6, 0x0CD6, 0x0CC8},
+		{0x0CCA, 0x0CD5, 0x0CCB},
+		{0x0D46, 0x0D3E, 0x0D4A},
+		{0x0D46, 0x0D57, 0x0D4C},
+		{0x0D47, 0x0D3E, 0x0D4B},
+		{0x0DD9, 0x0DCA, 0x0DDA},
+		{0x0DD9, 0x0DCF, 0x0DDC},
+		{0x0DD9, 0x0DDF, 0x0DDE},
+		{0x0DDC, 0x0DCA, 0x0DDD},
+		{0x1025, 0x102E, 0x1026},
+		{0x1B05, 0x1B35, 0x1B06},
+		{0x1B07, 0x1B35, 0x1B08},
+		{0x1B09, 0x1B35, 0x1B0A},
+		{0x1B0B, 0x1B35, 0x1B0C},
+		{0x1B0D, 0x1B35, 0x1B0E},
+		{0x1B11, 0x1B35, 0x1B12},
+		{0x1B3A, 0x1B35, 0x1B3B},
+		{0x1B3C, 0x1B35, 0x1B3D},
+		{0x1B3E, 0x1B35, 0x1B40},
+		{0x1B3F, 0x1B35, 0x1B41},
+		{0x1B42, 0x1B35, 0x1B43},
+		{0x1E36, 0x0304, 0x1E38},
+		{0x1E37, 0x0304, 0x1E39},
+		{0x1E5A, 0x0304, 0x1E5C},
+		{0x1E5B, 0x0304, 0x1E5D},
+		{0x1E62, 0x0307, 0x1E68},
+		{0x1E63, 0x0307, 0x1E69},
+		{0x1EA0, 0x0302, 0x1EAC},
+		{0x1EA0, 0x0306, 0x1EB6},
+		{0x1EA1, 0x0302, 0x1EAD},
+		{0x1EA1, 0x0306, 0x1EB7},
+		{0x1EB8, 0x0302, 0x1EC6},
+		{0x1EB9, 0x0302, 0x1EC7},
+		{0x1ECC, 0x0302, 0x1ED8},
+		{0x1ECD, 0x0302, 0x1ED9},
+		{0x1F00, 0x0300, 0x1F02},
+		{0x1F00, 0x0301, 0x1F04},
+		{0x1F00, 0x0342, 0x1F06},
+		{0x1F00, 0x0345, 0x1F80},
+		{0x1F01, 0x0300, 0x1F03},
+		{0x1F01, 0x0301, 0x1F05},
+		{0x1F01, 0x0342, 0x1F07},
+		{0x1F01, 0x0345, 0x1F81},
+		{0x1F02, 0x0345, 0x1F82},
+		{0x1F03, 0x0345, 0x1F83},
+		{0x1F04, 0x0345, 0x1F84},
+		{0x1F05, 0x0345, 0x1F85},
+		{0x1F06, 0x0345, 0x1F86},
+		{0x1F07, 0x0345, 0x1F87},
+		{0x1F08, 0x0300, 0x1F0A},
+		{0x1F08, 0x0301, 0x1F0C},
+		{0x1F08, 0x0342, 0x1F0E},
+		{0x1F08, 0x0345, 0x1F88},
+		{0x1F09, 0x0300, 0x1F0B},
+		{0x1F09, 0x0301, 0x1F0D},
+		{0x1F09, 0x0342, 0x1F0F},
+		{0x1F09, 0x0345, 0x1F89},
+		{0x1F0A, 0x0345, 0x1F8A},
+		{0x1F0B, 0x0345, 0x1F8B},
+		{0x1F0C, 0x0345, 0x1F8C},
+		{0x1F0D, 0x0345, 0x1F8D},
+		{0x1F0E, 0x0345, 0x1F8E},
+		{0x1F0F, 0x0345, 0x1F8F},
+		{0x1F10, 0x0300, 0x1F12},
+		{0x1F10, 0x0301, 0x1F14},
+		{0x1F11, 0x0300, 0x1F13},
+		{0x1F11, 0x0301, 0x1F15},
+		{0x1F18, 0x0300, 0x1F1A},
+		{0x1F18, 0x0301, 0x1F1C},
+		{0x1F19, 0x0300, 0x1F1B},
+		{0x1F19, 0x0301, 0x1F1D},
+		{0x1F20, 0x0300, 0x1F22},
+		{0x1F20, 0x0301, 0x1F24},
+		{0x1F20, 0x0342, 0x1F26},
+		{0x1F20, 0x0345, 0x1F90},
+		{0x1F21, 0x0300, 0x1F23},
+		{0x1F21, 0x0301, 0x1F25},
+		{0x1F21, 0x0342, 0x1F27},
+		{0x1F21, 0x0345, 0x1F91},
+		{0x1F22, 0x0345, 0x1F92},
+		{0x1F23, 0x0345, 0x1F93},
+		{0x1F24, 0x0345, 0x1F94},
+		{0x1F25, 0x0345, 0x1F95},
+		{0x1F26, 0x0345, 0x1F96},
+		{0x1F27, 0x0345, 0x1F97},
+		{0x1F28, 0x0300, 0x1F2A},
+		{0x1F28, 0x0301, 0x1F2C},
+		{0x1F28, 0x0342, 0x1F2E},
+		{0x1F28, 0x0345, 0x1F98},
+		{0x1F29, 0x0300, 0x1F2B},
+		{0x1F29, 0x0301, 0x1F2D},
+		{0x1F29, 0x0342, 0x1F2F},
+		{0x1F29, 0x0345, 0x1F99},
+		{0x1F2A, 0x0345, 0x1F9A},
+		{0x1F2B, 0x0345, 0x1F9B},
+		{0x1F2C, 0x0345, 0x1F9C},
+		{0x1F2D, 0x0345, 0x1F9D},
+		{0x1F2E, 0x0345, 0x1F9E},
+		{0x1F2F, 0x0345, 0x1F9F},
+		{0x1F30, 0x0300, 0x1F32},
+		{0x1F30, 0x0301, 0x1F34},
+		{0x1F30, 0x0342, 0x1F36},
+		{0x1F31, 0x0300, 0x1F33},
+		{0x1F31, 0x0301, 0x1F35},
+		{0x1F31, 0x0342, 0x1F37},
+		{0x1F38, 0x0300, 0x1F3A},
+		{0x1F38, 0x0301, 0x1F3C},
+		{0x1F38, 0x0342, 0x1F3E},
+		{0x1F39, 0x0300, 0x1F3B},
+		{0x1F39, 0x0301, 0x1F3D},
+		{0x1F39, 0x0342, 0x1F3F},
+		{0x1F40, 0x0300, 0x1F42},
+		{0x1F40, 0x0301, 0x1F44},
+		{0x1F41, 0x0300, 0x1F43},
+		{0x1F41, 0x0301, 0x1F45},
+		{0x1F48, 0x0300, 0x1F4A},
+		{0x1F48, 0x0301, 0x1F4C},
+		{0x1F49, 0x0300, 0x1F4B},
+		{0x1F49, 0x0301, 0x1F4D},
+		{0x1F50, 0x0300, 0x1F52},
+		{0x1F50, 0x0301, 0x1F54},
+		{0x1F50, 0x0342, 0x1F56},
+		{0x1F51, 0x0300, 0x1F53},
+		{0x1F51, 0x0301, 0x1F55},
+		{0x1F51, 0x0342, 0x1F57},
+		{0x1F59, 0x0300, 0x1F5B},
+		{0x1F59, 0x0301, 0x1F5D},
+		{0x1F59, 0x0342, 0x1F5F},
+		{0x1F60, 0x0300, 0x1F62},
+		{0x1F60, 0x0301, 0x1F64},
+		{0x1F60, 0x0342, 0x1F66},
+		{0x1F60, 0x0345, 0x1FA0},
+		{0x1F61, 0x0300, 0x1F63},
+		{0x1F61, 0x0301, 0x1F65},
+		{0x1F61, 0x0342, 0x1F67},
+		{0x1F61, 0x0345, 0x1FA1},
+		{0x1F62, 0x0345, 0x1FA2},
+		{0x1F63, 0x0345, 0x1FA3},
+		{0x1F64, 0x0345, 0x1FA4},
+		{0x1F65, 0x0345, 0x1FA5},
+		{0x1F66, 0x0345, 0x1FA6},
+		{0x1F67, 0x0345, 0x1FA7},
+		{0x1F68, 0x0300, 0x1F6A},
+		{0x1F68, 0x0301, 0x1F6C},
+		{0x1F68, 0x0342, 0x1F6E},
+		{0x1F68, 0x0345, 0x1FA8},
+		{0x1F69, 0x0300, 0x1F6B},
+		{0x1F69, 0x0301, 0x1F6D},
+		{0x1F69, 0x0342, 0x1F6F},
+		{0x1F69, 0x0345, 0x1FA9},
+		{0x1F6A, 0x0345, 0x1FAA},
+		{0x1F6B, 0x0345, 0x1FAB},
+		{0x1F6C, 0x0345, 0x1FAC},
+		{0x1F6D, 0x0345, 0x1FAD},
+		{0x1F6E, 0x0345, 0x1FAE},
+		{0x1F6F, 0x0345, 0x1FAF},
+		{0x1F70, 0x0345, 0x1FB2},
+		{0x1F74, 0x0345, 0x1FC2},
+		{0x1F7C, 0x0345, 0x1FF2},
+		{0x1FB6, 0x0345, 0x1FB7},
+		{0x1FBF, 0x0300, 0x1FCD},
+		{0x1FBF, 0x0301, 0x1FCE},
+		{0x1FBF, 0x0342, 0x1FCF},
+		{0x1FC6, 0x0345, 0x1FC7},
+		{0x1FF6, 0x0345, 0x1FF7},
+		{0x1FFE, 0x0300, 0x1FDD},
+		{0x1FFE, 0x0301, 0x1FDE},
+		{0x1FFE, 0x0342, 0x1FDF},
+		{0x2190, 0x0338, 0x219A},
+		{0x2192, 0x0338, 0x219B},
+		{0x2194, 0x0338, 0x21AE},
+		{0x21D0, 0x0338, 0x21CD},
+		{0x21D2, 0x0338, 0x21CF},
+		{0x21D4, 0x0338, 0x21CE},
+		{0x2203, 0x0338, 0x2204},
+		{0x2208, 0x0338, 0x2209},
+		{0x220B, 0x0338, 0x220C},
+		{0x2223, 0x0338, 0x2224},
+		{0x2225, 0x0338, 0x2226},
+		{0x223C, 0x0338, 0x2241},
+		{0x2243, 0x0338, 0x2244},
+		{0x2245, 0x0338, 0x2247},
+		{0x2248, 0x0338, 0x2249},
+		{0x224D, 0x0338, 0x226D},
+		{0x2261, 0x0338, 0x2262},
+		{0x2264, 0x0338, 0x2270},
+		{0x2265, 0x0338, 0x2271},
+		{0x2272, 0x0338, 0x2274},
+		{0x2273, 0x0338, 0x2275},
+		{0x2276, 0x0338, 0x2278},
+		{0x2277, 0x0338, 0x2279},
+		{0x227A, 0x0338, 0x2280},
+		{0x227B, 0x0338, 0x2281},
+		{0x227C, 0x0338, 0x22E0},
+		{0x227D, 0x0338, 0x22E1},
+		{0x2282, 0x0338, 0x2284},
+		{0x2283, 0x0338, 0x2285},
+		{0x2286, 0x0338, 0x2288},
+		{0x2287, 0x0338, 0x2289},
+		{0x2291, 0x0338, 0x22E2},
+		{0x2292, 0x0338, 0x22E3},
+		{0x22A2, 0x0338, 0x22AC},
+		{0x22A8, 0x0338, 0x22AD},
+		{0x22A9, 0x0338, 0x22AE},
+		{0x22AB, 0x0338, 0x22AF},
+		{0x22B2, 0x0338, 0x22EA},
+		{0x22B3, 0x0338, 0x22EB},
+		{0x22B4, 0x0338, 0x22EC},
+		{0x22B5, 0x0338, 0x22ED},
+		{0x3046, 0x3099, 0x3094},
+		{0x304B, 0x3099, 0x304C},
+		{0x304D, 0x3099, 0x304E},
+		{0x304F, 0x3099, 0x3050},
+		{0x3051, 0x3099, 0x3052},
+		{0x3053, 0x3099, 0x3054},
+		{0x3055, 0x3099, 0x3056},
+		{0x3057, 0x3099, 0x3058},
+		{0x3059, 0x3099, 0x305A},
+		{0x305B, 0x3099, 0x305C},
+		{0x305D, 0x3099, 0x305E},
+		{0x305F, 0x3099, 0x3060},
+		{0x3061, 0x3099, 0x3062},
+		{0x3064, 0x3099, 0x3065},
+		{0x3066, 0x3099, 0x3067},
+		{0x3068, 0x3099, 0x3069},
+		{0x306F, 0x3099, 0x3070},
+		{0x306F, 0x309A, 0x3071},
+		{0x3072, 0x3099, 0x3073},
+		{0x3072, 0x309A, 0x3074},
+		{0x3075, 0x3099, 0x3076},
+		{0x3075, 0x309A, 0x3077},
+		{0x3078, 0x3099, 0x3079},
+		{0x3078, 0x309A, 0x307A},
+		{0x307B, 0x3099, 0x307C},
+		{0x307B, 0x309A, 0x307D},
+		{0x309D, 0x3099, 0x309E},
+		{0x30A6, 0x3099, 0x30F4},
+		{0x30AB, 0x3099, 0x30AC},
+		{0x30AD, 0x3099, 0x30AE},
+		{0x30AF, 0x3099, 0x30B0},
+		{0x30B1, 0x3099, 0x30B2},
+		{0x30B3, 0x3099, 0x30B4},
+		{0x30B5, 0x3099, 0x30B6},
+		{0x30B7, 0x3099, 0x30B8},
+		{0x30B9, 0x3099, 0x30BA},
+		{0x30BB, 0x3099, 0x30BC},
+		{0x30BD, 0x3099, 0x30BE},
+		{0x30BF, 0x3099, 0x30C0},
+		{0x30C1, 0x3099, 0x30C2},
+		{0x30C4, 0x3099, 0x30C5},
+		{0x30C6, 0x3099, 0x30C7},
+		{0x30C8, 0x3099, 0x30C9},
+		{0x30CF, 0x3099, 0x30D0},
+		{0x30CF, 0x309A, 0x30D1},
+		{0x30D2, 0x3099, 0x30D3},
+		{0x30D2, 0x309A, 0x30D4},
+		{0x30D5, 0x3099, 0x30D6},
+		{0x30D5, 0x309A, 0x30D7},
+		{0x30D8, 0x3099, 0x30D9},
+		{0x30D8, 0x309A, 0x30DA},
+		{0x30DB, 0x3099, 0x30DC},
+		{0x30DB, 0x309A, 0x30DD},
+		{0x30EF, 0x3099, 0x30F7},
+		{0x30F0, 0x3099, 0x30F8},
+		{0x30F1, 0x3099, 0x30F9},
+		{0x30F2, 0x3099, 0x30FA},
+		{0x30FD, 0x3099, 0x30FE},
+		{0x11099, 0x110BA, 0x1109A},
+		{0x1109B, 0x110BA, 0x1109C},
+		{0x110A5, 0x110BA, 0x110AB},
+		{0x11131, 0x11127, 0x1112E},
+		{0x11132, 0x11127, 0x1112F},
+		{0x11347, 0x1133E, 0x1134B},
+		{0x11347, 0x11357, 0x1134C},
+		{0x114B9, 0x114B0, 0x114BC},
+		{0x114B9, 0x114BA, 0x114BB},
+		{0x114B9, 0x114BD, 0x114BE},
+		{0x115B8, 0x115AF, 0x115BA},
+		{0x115B9, 0x115AF, 0x115BB},
+		{0x11935, 0x11930, 0x11938},
+	};
+
+	/** Looks up the record of a code point.
+	 * \param the code point
+	 * \return the record */
+	static const record& lookup(char32_t cp)
+	{
+		size_t block = cp >> BLOCK_SHIFT;
+		if (block >= sizeof(STAGE1) / sizeof(STAGE1[0])) {
+			return RECORDS[0];
+		}
+		size_t offset = cp & ((1u << BLOCK_SHIFT) - 1);
+		return RECORDS[STAGE2[(STAGE1[block] << BLOCK_SHIFT) + offset]];
+	}
+};
+
+#endif  // ONESTRING_UNICODE_NORMALIZATION_TABLES_HPP
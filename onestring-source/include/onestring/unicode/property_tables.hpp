@@ -0,0 +1,2311 @@
+/** Unicode 14.0.0 Data Tables
+ * Version: 1.0
+ *
+ * Generated by tools/generate_unicode_tables.pl. Do not edit.
+ */
+
+#ifndef ONESTRING_UNICODE_PROPERTY_TABLES_HPP
+#define ONESTRING_UNICODE_PROPERTY_TABLES_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+/** The General_Category and Script of each code point, and whether it is
+ * White_Space, Alphabetic, or Numeric. */
+struct onestring_property_tables
+{
+	/** The General_Category property. */
+	enum class general_category : uint8_t {
+		UPPERCASE_LETTER = 0,
+		LOWERCASE_LETTER = 1,
+		TITLECASE_LETTER = 2,
+		MODIFIER_LETTER = 3,
+		OTHER_LETTER = 4,
+		NONSPACING_MARK = 5,
+		SPACING_MARK = 6,
+		ENCLOSING_MARK = 7,
+		DECIMAL_NUMBER = 8,
+		LETTER_NUMBER = 9,
+		OTHER_NUMBER = 10,
+		CONNECTOR_PUNCTUATION = 11,
+		DASH_PUNCTUATION = 12,
+		OPEN_PUNCTUATION = 13,
+		CLOSE_PUNCTUATION = 14,
+		INITIAL_PUNCTUATION = 15,
+		FINAL_PUNCTUATION = 16,
+		OTHER_PUNCTUATION = 17,
+		MATH_SYMBOL = 18,
+		CURRENCY_SYMBOL = 19,
+		MODIFIER_SYMBOL = 20,
+		OTHER_SYMBOL = 21,
+		SPACE_SEPARATOR = 22,
+		LINE_SEPARATOR = 23,
+		PARAGRAPH_SEPARATOR = 24,
+		CONTROL = 25,
+		FORMAT = 26,
+		SURROGATE = 27,
+		PRIVATE_USE = 28,
+		UNASSIGNED = 29,
+	};
+
+	/// The number of general_category values.
+	inline static constexpr size_t GENERAL_CATEGORIES = 30;
+
+	/** The Script property. */
+	enum class script_code : uint8_t {
+		UNKNOWN = 0,
+		COMMON = 1,
+		INHERITED = 2,
+		ADLAM = 3,
+		AHOM = 4,
+		ANATOLIAN_HIEROGLYPHS = 5,
+		ARABIC = 6,
+		ARMENIAN = 7,
+		AVESTAN = 8,
+		BALINESE = 9,
+		BAMUM = 10,
+		BASSA_VAH = 11,
+		BATAK = 12,
+		BENGALI = 13,
+		BHAIKSUKI = 14,
+		BOPOMOFO = 15,
+		BRAHMI = 16,
+		BRAILLE = 17,
+		BUGINESE = 18,
+		BUHID = 19,
+		CANADIAN_ABORIGINAL = 20,
+		CARIAN = 21,
+		CAUCASIAN_ALBANIAN = 22,
+		CHAKMA = 23,
+		CHAM = 24,
+		CHEROKEE = 25,
+		CHORASMIAN = 26,
+		COPTIC = 27,
+		CUNEIFORM = 28,
+		CYPRIOT = 29,
+		CYPRO_MINOAN = 30,
+		CYRILLIC = 31,
+		DESERET = 32,
+		DEVANAGARI = 33,
+		DIVES_AKURU = 34,
+		DOGRA = 35,
+		DUPLOYAN = 36,
+		EGYPTIAN_HIEROGLYPHS = 37,
+		ELBASAN = 38,
+		ELYMAIC = 39,
+		ETHIOPIC = 40,
+		GEORGIAN = 41,
+		GLAGOLITIC = 42,
+		GOTHIC = 43,
+		GRANTHA = 44,
+		GREEK = 45,
+		GUJARATI = 46,
+		GUNJALA_GONDI = 47,
+		GURMUKHI = 48,
+		HAN = 49,
+		HANGUL = 50,
+		HANIFI_ROHINGYA = 51,
+		HANUNOO = 52,
+		HATRAN = 53,
+		HEBREW = 54,
+		HIRAGANA = 55,
+		IMPERIAL_ARAMAIC = 56,
+		INSCRIPTIONAL_PAHLAVI = 57,
+		INSCRIPTIONAL_PARTHIAN = 58,
+		JAVANESE = 59,
+		KAITHI = 60,
+		KANNADA = 61,
+		KATAKANA = 62,
+		KAYAH_LI = 63,
+		KHAROSHTHI = 64,
+		KHITAN_SMALL_SCRIPT = 65,
+		KHMER = 66,
+		KHOJKI = 67,
+		KHUDAWADI = 68,
+		LAO = 69,
+		LATIN = 70,
+		LEPCHA = 71,
+		LIMBU = 72,
+		LINEAR_A = 73,
+		LINEAR_B = 74,
+		LISU = 75,
+		LYCIAN = 76,
+		LYDIAN = 77,
+		MAHAJANI = 78,
+		MAKASAR = 79,
+		MALAYALAM = 80,
+		MANDAIC = 81,
+		MANICHAEAN = 82,
+		MARCHEN = 83,
+		MASARAM_GONDI = 84,
+		MEDEFAIDRIN = 85,
+		MEETEI_MAYEK = 86,
+		MENDE_KIKAKUI = 87,
+		MEROITIC_CURSIVE = 88,
+		MEROITIC_HIEROGLYPHS = 89,
+		MIAO = 90,
+		MODI = 91,
+		MONGOLIAN = 92,
+		MRO = 93,
+		MULTANI = 94,
+		MYANMAR = 95,
+		NABATAEAN = 96,
+		NANDINAGARI = 97,
+		NEW_TAI_LUE = 98,
+		NEWA = 99,
+		NKO = 100,
+		NUSHU = 101,
+		NYIAKENG_PUACHUE_HMONG = 102,
+		OGHAM = 103,
+		OL_CHIKI = 104,
+		OLD_HUNGARIAN = 105,
+		OLD_ITALIC = 106,
+		OLD_NORTH_ARABIAN = 107,
+		OLD_PERMIC = 108,
+		OLD_PERSIAN = 109,
+		OLD_SOGDIAN = 110,
+		OLD_SOUTH_ARABIAN = 111,
+		OLD_TURKIC = 112,
+		OLD_UYGHUR = 113,
+		ORIYA = 114,
+		OSAGE = 115,
+		OSMANYA = 116,
+		PAHAWH_HMONG = 117,
+		PALMYRENE = 118,
+		PAU_CIN_HAU = 119,
+		PHAGS_PA = 120,
+		PHOENICIAN = 121,
+		PSALTER_PAHLAVI = 122,
+		REJANG = 123,
+		RUNIC = 124,
+		SAMARITAN = 125,
+		SAURASHTRA = 126,
+		SHARADA = 127,
+		SHAVIAN = 128,
+		SIDDHAM = 129,
+		SIGN_WRITING = 130,
+		SINHALA = 131,
+		SOGDIAN = 132,
+		SORA_SOMPENG = 133,
+		SOYOMBO = 134,
+		SUNDANESE = 135,
+		SYLOTI_NAGRI = 136,
+		SYRIAC = 137,
+		TAGALOG = 138,
+		TAGBANWA = 139,
+		TAI_LE = 140,
+		TAI_THAM = 141,
+		TAI_VIET = 142,
+		TAKRI = 143,
+		TAMIL = 144,
+		TANGSA = 145,
+		TANGUT = 146,
+		TELUGU = 147,
+		THAANA = 148,
+		THAI = 149,
+		TIBETAN = 150,
+		TIFINAGH = 151,
+		TIRHUTA = 152,
+		TOTO = 153,
+		UGARITIC = 154,
+		VAI = 155,
+		VITHKUQI = 156,
+		WANCHO = 157,
+		WARANG_CITI = 158,
+		YEZIDI = 159,
+		YI = 160,
+		ZANABAZAR_SQUARE = 161,
+	};
+
+	/// The number of script_code values.
+	inline static constexpr size_t SCRIPTS = 162;
+
+	/// The code point has the White_Space property.
+	inline static constexpr uint8_t WHITE_SPACE = 0x01;
+	/// The code point has the Alphabetic property.
+	inline static constexpr uint8_t ALPHABETIC = 0x02;
+	/// The code point has a Numeric_Type other than None.
+	inline static constexpr uint8_t NUMERIC = 0x04;
+
+	/** The properties of a code point. */
+	struct record
+	{
+		general_category category;
+		script_code script;
+		uint8_t flags;
+	};
+
+	/// The number of low code point bits that index a group of STAGE2.
+	inline static constexpr unsigned GROUP_SHIFT = 8;
+
+	/// The number of low code point bits that index a block of STAGE3.
+	inline static constexpr unsigned BLOCK_SHIFT = 3;
+
+	/// The group of STAGE2 for each group of code points.
+	inline static constexpr uint8_t STAGE1[4352] = {
+		0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+		16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+		32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 34, 42, 43, 44, 45, 46,
+		47, 48, 49, 50, 51, 52, 52, 52, 53, 52, 52, 54, 52, 52, 52, 52,
+		52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 55, 56, 57,
+		52, 58, 52, 59, 52, 52, 60, 52, 61, 52, 52, 52, 52, 52, 62, 63,
+		52, 52, 64, 65, 52, 52, 52, 66, 52, 52, 52, 52, 52, 52, 52, 67,
+		52, 52, 52, 68, 52, 52, 69, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+		70, 52, 52, 52, 71, 52, 52, 52, 52, 52, 52, 52, 72, 73, 52, 52,
+		52, 52, 52, 52, 52, 52, 74, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+		75, 76, 76, 76, 77, 78, 79, 80, 81, 82, 83, 84, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 85, 86, 86, 86, 86, 86, 86, 86, 86,
+		87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+		87, 87, 87, 87, 87, 87, 87, 87, 87, 88, 89, 90, 91, 92, 93, 94,
+		95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110,
+		111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126,
+		127, 127, 127, 128, 129, 130, 122, 122, 122, 122, 122, 122, 122, 122, 122, 131,
+		132, 132, 132, 132, 133, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 134, 134, 135, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 136, 136, 137, 138, 122, 122, 139, 140,
+		141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141,
+		141, 141, 141, 141, 141, 141, 141, 142, 141, 141, 141, 143, 144, 145, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 146,
+		147, 148, 149, 122, 122, 122, 122, 122, 122, 122, 122, 122, 150, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 151,
+		152, 153, 154, 155, 156, 157, 158, 159, 160, 160, 161, 122, 122, 122, 122, 162,
+		163, 164, 165, 122, 122, 122, 122, 166, 167, 168, 122, 122, 169, 170, 171, 122,
+		172, 173, 174, 175, 176, 176, 177, 178, 179, 176, 180, 181, 122, 122, 122, 122,
+		182, 183, 52, 52, 52, 52, 52, 52, 52, 184, 185, 186, 52, 52, 52, 52,
+		52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+		52, 52, 52, 187, 52, 52, 52, 52, 52, 188, 52, 52, 52, 52, 52, 52,
+		52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 189, 52, 52, 52, 52,
+		52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+		52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+		52, 52, 190, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+		52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+		52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+		52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+		52, 52, 52, 52, 52, 52, 191, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+		52, 52, 52, 52, 52, 52, 52, 192, 193, 52, 52, 52, 52, 52, 52, 52,
+		52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 194, 52,
+		52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+		52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 195, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 187, 52, 196, 122, 122, 122, 122, 122,
+		52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+		52, 52, 52, 197, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		198, 199, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+		87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+		87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+		87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+		87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+		87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+		87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+		87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+		87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+		87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+		87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+		87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+		87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+		87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+		87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+		87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 200,
+		87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+		87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+		87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+		87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+		87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+		87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+		87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+		87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+		87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+		87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+		87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+		87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+		87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+		87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+		87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+		87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 200,
+	};
+
+	/// The block of STAGE3 for each block of code points in a group.
+	inline static constexpr uint16_t STAGE2[6432] = {
+		0, 1, 0, 0, 2, 3, 4, 5, 6, 7, 7, 8, 9, 10, 10, 11,
+		12, 0, 0, 0, 13, 14, 15, 16, 7, 7, 17, 18, 10, 10, 19, 10,
+		20, 20, 20, 20, 20, 20, 20, 21, 21, 22, 20, 20, 20, 20, 20, 23,
+		24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 21, 34, 20, 20, 35, 20,
+		20, 20, 20, 20, 20, 20, 36, 37, 38, 20, 10, 10, 10, 10, 10, 10,
+		10, 10, 39, 10, 10, 10, 40, 41, 42, 43, 44, 45, 46, 47, 45, 45,
+		48, 48, 48, 48, 48, 48, 48, 48, 49, 48, 48, 48, 48, 48, 50, 51,
+		52, 53, 54, 55, 56, 57, 58, 58, 58, 59, 60, 61, 62, 63, 64, 65,
+		66, 66, 66, 66, 66, 66, 67, 67, 67, 67, 67, 67, 68, 68, 68, 68,
+		69, 70, 68, 68, 68, 68, 68, 68, 71, 72, 68, 68, 68, 68, 68, 68,
+		68, 68, 68, 68, 68, 68, 73, 74, 74, 74, 75, 76, 77, 77, 77, 77,
+		77, 78, 79, 80, 80, 80, 81, 82, 83, 84, 85, 85, 85, 86, 87, 84,
+		88, 89, 90, 91, 92, 92, 92, 92, 93, 94, 95, 96, 97, 98, 99, 92,
+		92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 100, 101, 102, 103, 97, 104,
+		105, 106, 107, 108, 108, 108, 109, 109, 110, 111, 92, 92, 92, 92, 92, 92,
+		112, 112, 112, 112, 113, 114, 115, 84, 116, 117, 118, 118, 118, 119, 120, 121,
+		122, 122, 123, 124, 125, 126, 127, 128, 129, 129, 129, 130, 108, 131, 92, 92,
+		92, 132, 133, 134, 92, 92, 92, 92, 92, 135, 136, 90, 137, 138, 90, 90,
+		139, 140, 140, 140, 140, 140, 140, 141, 142, 143, 144, 140, 145, 146, 147, 140,
+		148, 149, 150, 151, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162,
+		163, 164, 165, 166, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 84,
+		177, 178, 179, 180, 180, 181, 182, 183, 184, 185, 186, 84, 187, 188, 189, 190,
+		191, 192, 193, 194, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 84,
+		205, 206, 207, 208, 209, 206, 210, 211, 212, 213, 214, 84, 215, 216, 217, 218,
+		219, 220, 221, 222, 222, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231,
+		232, 233, 234, 235, 235, 234, 236, 237, 238, 239, 240, 241, 242, 243, 244, 84,
+		245, 246, 247, 248, 248, 248, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257,
+		258, 259, 260, 261, 259, 259, 262, 263, 260, 264, 265, 266, 267, 268, 269, 84,
+		270, 271, 271, 271, 271, 271, 272, 273, 274, 275, 276, 277, 84, 84, 84, 84,
+		278, 279, 280, 280, 281, 280, 282, 283, 284, 285, 286, 287, 84, 84, 84, 84,
+		288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 296, 296, 296, 298, 299, 300,
+		301, 302, 303, 299, 303, 303, 303, 304, 305, 306, 307, 308, 84, 84, 84, 84,
+		309, 309, 309, 309, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 309,
+		320, 321, 313, 322, 323, 323, 323, 323, 324, 325, 326, 326, 326, 326, 326, 327,
+		328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328,
+		328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328,
+		329, 329, 329, 329, 329, 329, 329, 329, 329, 330, 331, 330, 329, 329, 329, 329,
+		329, 330, 329, 329, 329, 329, 330, 331, 330, 329, 331, 329, 329, 329, 329, 329,
+		329, 329, 330, 329, 329, 329, 329, 329, 329, 329, 329, 332, 333, 334, 335, 336,
+		329, 329, 337, 338, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 340, 341,
+		342, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343,
+		343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343,
+		343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343,
+		343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343,
+		343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 344, 343, 343,
+		345, 346, 346, 347, 348, 348, 348, 348, 348, 348, 348, 348, 348, 349, 350, 351,
+		352, 352, 353, 354, 355, 355, 356, 84, 357, 357, 358, 84, 359, 360, 361, 84,
+		362, 362, 362, 362, 362, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372,
+		373, 374, 375, 376, 377, 377, 377, 377, 378, 377, 377, 377, 377, 377, 377, 379,
+		380, 377, 377, 377, 377, 381, 343, 343, 343, 343, 343, 343, 343, 343, 382, 84,
+		383, 383, 383, 384, 385, 386, 387, 388, 389, 390, 391, 391, 391, 392, 393, 84,
+		394, 394, 394, 394, 394, 395, 394, 394, 394, 396, 397, 398, 399, 399, 399, 399,
+		400, 400, 401, 402, 403, 403, 403, 403, 403, 403, 404, 405, 406, 407, 408, 409,
+		410, 411, 410, 411, 412, 413, 48, 414, 415, 416, 84, 84, 84, 84, 84, 84,
+		417, 418, 418, 418, 418, 418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428,
+		429, 430, 430, 430, 431, 432, 433, 434, 435, 435, 435, 435, 436, 437, 438, 439,
+		440, 440, 440, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 449, 449, 450,
+		67, 451, 323, 323, 323, 323, 323, 452, 453, 84, 454, 48, 455, 456, 457, 458,
+		10, 10, 10, 10, 459, 460, 40, 40, 40, 40, 40, 461, 462, 463, 10, 464,
+		10, 10, 10, 465, 40, 40, 40, 466, 48, 48, 48, 48, 467, 468, 469, 48,
+		20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+		20, 20, 470, 471, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+		58, 55, 472, 473, 58, 55, 58, 55, 472, 473, 58, 474, 58, 55, 58, 472,
+		58, 475, 58, 475, 58, 475, 476, 477, 478, 479, 480, 481, 58, 482, 483, 484,
+		485, 486, 487, 488, 489, 490, 489, 491, 492, 489, 493, 494, 495, 496, 497, 498,
+		499, 500, 40, 501, 502, 502, 502, 502, 503, 84, 48, 504, 505, 48, 506, 84,
+		507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 499, 499, 517, 517, 517, 517,
+		518, 519, 520, 521, 522, 523, 524, 524, 524, 525, 526, 524, 524, 524, 527, 528,
+		528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528,
+		528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528,
+		524, 529, 524, 524, 530, 531, 524, 524, 524, 524, 524, 524, 524, 524, 524, 532,
+		524, 524, 524, 533, 528, 528, 534, 524, 524, 524, 524, 527, 530, 524, 524, 524,
+		524, 524, 524, 524, 535, 84, 84, 84, 524, 536, 84, 84, 499, 499, 499, 499,
+		499, 499, 499, 537, 524, 524, 538, 539, 539, 539, 539, 539, 539, 540, 499, 499,
+		524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524,
+		524, 524, 524, 524, 524, 524, 541, 524, 542, 524, 524, 524, 524, 524, 524, 528,
+		524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 541, 524, 524,
+		524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524,
+		524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 543, 544, 499,
+		499, 499, 537, 524, 524, 524, 524, 524, 545, 528, 528, 528, 546, 543, 528, 528,
+		547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547,
+		547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547,
+		528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528,
+		548, 549, 549, 550, 528, 528, 528, 528, 528, 528, 528, 551, 528, 528, 528, 552,
+		524, 524, 524, 524, 524, 524, 528, 528, 553, 520, 524, 524, 524, 524, 554, 524,
+		524, 524, 555, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524,
+		556, 556, 556, 556, 556, 556, 557, 557, 557, 557, 557, 557, 558, 559, 560, 561,
+		63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 562, 563, 564, 565,
+		326, 326, 326, 326, 566, 567, 568, 568, 568, 568, 568, 568, 568, 569, 570, 571,
+		329, 329, 331, 84, 331, 331, 331, 331, 331, 331, 331, 331, 572, 572, 572, 572,
+		573, 574, 575, 576, 577, 578, 489, 579, 580, 489, 581, 582, 84, 84, 84, 84,
+		583, 583, 583, 584, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 585, 84,
+		583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583,
+		583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 586, 84, 84, 84, 524, 587,
+		588, 543, 589, 590, 591, 592, 593, 594, 595, 596, 596, 596, 596, 596, 596, 596,
+		596, 596, 597, 598, 599, 600, 600, 600, 600, 600, 600, 600, 600, 600, 600, 601,
+		602, 603, 603, 603, 603, 603, 604, 328, 328, 328, 328, 328, 328, 328, 328, 328,
+		328, 605, 606, 524, 603, 603, 603, 603, 524, 524, 524, 524, 587, 84, 600, 600,
+		607, 607, 607, 608, 499, 609, 524, 524, 524, 499, 610, 499, 607, 607, 607, 611,
+		499, 609, 524, 524, 524, 524, 610, 499, 524, 524, 612, 612, 612, 612, 612, 613,
+		612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 524, 524, 524, 524, 524,
+		524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524,
+		614, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		616, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 617, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 614, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 524, 524, 524, 524, 524, 524, 524, 524,
+		618, 619, 615, 615, 615, 615, 615, 615, 615, 615, 615, 614, 615, 615, 615, 615,
+		615, 620, 621, 615, 615, 615, 615, 622, 623, 615, 615, 622, 615, 623, 615, 615,
+		615, 614, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 623, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		620, 615, 615, 615, 615, 615, 615, 615, 624, 615, 615, 615, 615, 625, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 626, 620, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 627, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 616, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 619, 619,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 617,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 628,
+		615, 629, 623, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 624,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 620, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 617, 615, 615, 615, 615, 615,
+		624, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 624, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 624,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		624, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 620, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 624, 616, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 623, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 619, 615, 615, 615, 624, 620, 615, 615, 615, 615, 615, 623,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 624, 615,
+		630, 630, 631, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630,
+		630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630,
+		630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630,
+		630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630,
+		630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630,
+		630, 632, 633, 633, 633, 633, 633, 633, 634, 84, 635, 635, 635, 635, 635, 636,
+		637, 637, 637, 637, 637, 637, 637, 637, 637, 637, 637, 637, 637, 637, 637, 637,
+		637, 637, 637, 637, 637, 637, 637, 637, 637, 637, 637, 637, 637, 637, 637, 637,
+		637, 638, 637, 637, 639, 640, 84, 84, 68, 68, 68, 68, 68, 641, 642, 643,
+		68, 68, 68, 644, 645, 645, 645, 645, 645, 645, 645, 645, 646, 647, 648, 84,
+		45, 45, 649, 43, 650, 20, 22, 20, 20, 20, 20, 20, 20, 20, 651, 652,
+		20, 653, 654, 20, 20, 655, 656, 20, 657, 658, 659, 660, 84, 84, 661, 662,
+		663, 664, 665, 665, 666, 667, 668, 669, 670, 670, 670, 670, 670, 670, 671, 84,
+		672, 673, 673, 673, 673, 673, 674, 675, 676, 677, 678, 679, 680, 680, 681, 682,
+		683, 684, 685, 685, 686, 687, 688, 688, 689, 690, 691, 692, 328, 328, 328, 693,
+		694, 695, 695, 695, 695, 695, 696, 697, 698, 699, 700, 701, 702, 309, 313, 703,
+		704, 704, 704, 704, 704, 705, 706, 84, 707, 708, 709, 710, 309, 309, 711, 712,
+		713, 713, 713, 713, 713, 713, 714, 715, 716, 84, 84, 717, 718, 719, 720, 84,
+		721, 721, 721, 84, 331, 331, 10, 10, 10, 10, 10, 722, 723, 724, 725, 725,
+		725, 725, 725, 725, 725, 725, 725, 725, 718, 718, 718, 718, 726, 727, 728, 729,
+		328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328,
+		328, 328, 328, 328, 730, 84, 328, 328, 605, 731, 328, 328, 328, 328, 328, 730,
+		732, 732, 732, 732, 732, 732, 732, 732, 732, 732, 732, 732, 732, 732, 732, 732,
+		732, 732, 732, 732, 732, 732, 732, 732, 732, 732, 732, 732, 732, 732, 732, 732,
+		733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733,
+		733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 616, 616, 623,
+		615, 615, 615, 615, 615, 615, 617, 615, 615, 615, 734, 615, 615, 615, 615, 614,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 735, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 736, 84, 84, 84, 84,
+		737, 84, 738, 739, 85, 740, 741, 742, 743, 85, 92, 92, 92, 92, 92, 92,
+		92, 92, 92, 92, 92, 92, 744, 745, 746, 84, 747, 92, 92, 92, 92, 92,
+		92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92,
+		92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92,
+		92, 92, 92, 92, 92, 92, 92, 748, 749, 749, 92, 92, 92, 92, 92, 92,
+		92, 92, 750, 92, 92, 92, 92, 92, 92, 751, 84, 84, 84, 84, 92, 752,
+		48, 48, 753, 754, 48, 755, 756, 549, 757, 758, 759, 760, 761, 762, 763, 92,
+		92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 764,
+		765, 3, 4, 5, 6, 7, 7, 8, 9, 10, 10, 766, 767, 600, 768, 600,
+		600, 600, 600, 769, 328, 328, 328, 605, 770, 770, 770, 771, 772, 773, 84, 774,
+		775, 776, 775, 775, 777, 775, 775, 778, 775, 779, 775, 779, 84, 84, 84, 84,
+		775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 780,
+		781, 499, 499, 499, 499, 499, 782, 524, 783, 783, 783, 783, 783, 783, 784, 785,
+		786, 787, 524, 788, 789, 84, 84, 84, 84, 84, 524, 524, 524, 524, 524, 790,
+		84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		791, 791, 791, 792, 793, 793, 793, 793, 793, 793, 794, 84, 795, 499, 499, 796,
+		797, 797, 797, 797, 798, 799, 800, 800, 801, 802, 803, 803, 803, 803, 804, 805,
+		806, 806, 806, 807, 808, 808, 808, 808, 809, 808, 810, 84, 84, 84, 84, 84,
+		811, 811, 811, 811, 811, 812, 812, 812, 812, 812, 813, 813, 813, 813, 813, 813,
+		814, 814, 814, 815, 816, 817, 818, 818, 818, 818, 819, 820, 820, 820, 820, 821,
+		822, 822, 822, 822, 822, 84, 823, 823, 823, 823, 823, 823, 824, 825, 826, 827,
+		826, 827, 828, 829, 830, 829, 830, 831, 84, 84, 84, 84, 84, 84, 84, 84,
+		832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832,
+		832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832,
+		832, 832, 832, 832, 832, 832, 833, 84, 832, 832, 834, 84, 832, 84, 84, 84,
+		835, 40, 40, 40, 40, 40, 836, 837, 84, 84, 84, 84, 84, 84, 84, 84,
+		838, 839, 840, 840, 840, 840, 841, 842, 843, 843, 844, 845, 846, 846, 847, 848,
+		849, 849, 849, 850, 851, 852, 84, 84, 84, 84, 84, 84, 853, 853, 854, 855,
+		856, 856, 857, 858, 859, 859, 859, 860, 84, 84, 84, 84, 84, 84, 84, 84,
+		861, 861, 861, 861, 862, 862, 862, 863, 864, 864, 865, 864, 864, 864, 864, 864,
+		866, 867, 868, 869, 870, 870, 871, 872, 873, 874, 875, 876, 877, 877, 877, 878,
+		879, 879, 879, 880, 84, 84, 84, 84, 881, 882, 881, 881, 883, 884, 885, 84,
+		886, 886, 886, 886, 886, 886, 887, 888, 889, 889, 890, 891, 892, 892, 893, 894,
+		895, 895, 896, 897, 84, 898, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		899, 899, 899, 899, 899, 899, 899, 899, 899, 900, 84, 84, 84, 84, 84, 84,
+		901, 901, 901, 901, 901, 901, 902, 84, 903, 903, 903, 903, 903, 903, 904, 905,
+		906, 906, 906, 906, 907, 84, 908, 909, 84, 84, 84, 84, 84, 84, 84, 84,
+		84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 910, 910, 910, 911,
+		912, 912, 912, 912, 912, 913, 914, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		915, 915, 915, 916, 917, 84, 918, 918, 919, 920, 921, 922, 84, 84, 923, 923,
+		924, 925, 84, 84, 84, 84, 926, 926, 927, 928, 84, 84, 929, 929, 930, 84,
+		931, 932, 932, 932, 932, 932, 932, 933, 934, 935, 936, 937, 938, 939, 940, 941,
+		942, 943, 943, 943, 943, 943, 944, 945, 946, 947, 948, 948, 948, 949, 950, 951,
+		952, 953, 953, 953, 954, 955, 956, 957, 958, 84, 959, 959, 959, 959, 960, 84,
+		961, 962, 962, 962, 962, 962, 963, 964, 965, 966, 967, 968, 969, 970, 971, 84,
+		972, 972, 973, 972, 972, 974, 975, 976, 84, 84, 84, 84, 84, 84, 84, 84,
+		977, 978, 979, 980, 979, 981, 982, 982, 982, 982, 982, 983, 984, 985, 986, 987,
+		988, 989, 990, 991, 991, 992, 993, 994, 995, 996, 997, 998, 999, 1000, 1000, 84,
+		84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		1001, 1001, 1001, 1001, 1001, 1001, 1002, 1003, 1004, 1005, 1006, 1007, 1008, 84, 84, 84,
+		1009, 1009, 1009, 1009, 1009, 1009, 1010, 1011, 1012, 84, 1013, 1014, 84, 84, 84, 84,
+		84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		1015, 1015, 1015, 1015, 1015, 1016, 1017, 1018, 1019, 1020, 1020, 1021, 84, 84, 84, 84,
+		1022, 1022, 1022, 1022, 1022, 1022, 1023, 1024, 1025, 84, 1026, 1027, 1028, 1029, 84, 84,
+		1030, 1030, 1030, 1030, 1030, 1031, 1032, 1033, 1034, 1035, 84, 84, 84, 84, 84, 84,
+		1036, 1036, 1036, 1037, 1038, 1039, 1040, 1041, 1042, 84, 84, 84, 84, 84, 84, 84,
+		84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		1043, 1043, 1043, 1043, 1043, 1044, 1045, 1046, 84, 84, 84, 84, 84, 84, 84, 84,
+		84, 84, 84, 84, 1047, 1047, 1047, 1047, 1048, 1048, 1048, 1048, 1049, 1050, 1051, 1052,
+		1053, 1054, 1055, 1056, 1056, 1056, 1057, 1058, 1059, 84, 1060, 1061, 84, 84, 84, 84,
+		84, 84, 84, 84, 1062, 1063, 1062, 1062, 1062, 1062, 1064, 1065, 1066, 84, 84, 84,
+		1067, 1068, 1069, 1069, 1069, 1069, 1070, 1071, 1072, 84, 1073, 1074, 1075, 1075, 1075, 1075,
+		1075, 1076, 1077, 1078, 1079, 84, 343, 343, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1081,
+		84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		1082, 1083, 1082, 1082, 1082, 1084, 1085, 1086, 1087, 84, 1088, 1089, 1090, 1091, 1092, 1093,
+		1093, 1093, 1094, 1095, 1095, 1096, 1097, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		1098, 1099, 1100, 1100, 1100, 1100, 1101, 1102, 1103, 84, 1104, 1105, 1106, 1107, 1108, 1108,
+		1108, 1109, 1110, 1111, 1112, 1113, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 1114, 1114, 1115, 1116,
+		84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		84, 84, 84, 84, 84, 84, 1117, 84, 1118, 1118, 1119, 1120, 1121, 1122, 1123, 1124,
+		1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125,
+		1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125,
+		1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125,
+		1125, 1125, 1125, 1126, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1128, 1129, 84,
+		1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125,
+		1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1130, 84, 84, 84, 84, 84, 84, 84,
+		84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		84, 84, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1132, 84,
+		1133, 1133, 1133, 1133, 1133, 1133, 1133, 1133, 1133, 1133, 1133, 1133, 1133, 1133, 1133, 1133,
+		1133, 1133, 1133, 1133, 1133, 1133, 1133, 1133, 1133, 1133, 1133, 1133, 1133, 1133, 1133, 1133,
+		1133, 1133, 1133, 1133, 1133, 1134, 1135, 1136, 84, 84, 84, 84, 84, 84, 84, 84,
+		84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137,
+		1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137,
+		1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1138, 84, 84, 84, 84, 84, 84, 84,
+		84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645,
+		645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645,
+		645, 645, 645, 645, 645, 645, 645, 1139, 1140, 1140, 1140, 1141, 1142, 1143, 1144, 1144,
+		1144, 1144, 1144, 1144, 1144, 1144, 1144, 1145, 1146, 1147, 1148, 1148, 1148, 1149, 1150, 84,
+		1151, 1151, 1151, 1151, 1151, 1151, 1152, 1153, 1154, 84, 1155, 1156, 1157, 1151, 1151, 1158,
+		1151, 1151, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		84, 84, 84, 84, 84, 84, 84, 84, 1159, 1159, 1159, 1159, 1160, 1160, 1160, 1160,
+		1161, 1161, 1162, 1163, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1165, 1166, 1167, 1167, 1167, 1167, 1167,
+		1167, 1168, 1169, 1170, 84, 84, 84, 84, 84, 84, 84, 84, 1171, 84, 1172, 84,
+		1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173,
+		1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173,
+		1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173,
+		1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 84,
+		1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174,
+		1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174,
+		1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174,
+		1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1175, 84, 84, 84, 84, 84,
+		1173, 1176, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 1177, 1178,
+		1179, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596,
+		596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596,
+		596, 596, 596, 596, 1180, 84, 84, 84, 84, 84, 1181, 84, 1182, 84, 1183, 1183,
+		1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183,
+		1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183,
+		1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1184,
+		1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1186, 1185, 1187,
+		1185, 1188, 1185, 1189, 1190, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		48, 48, 48, 48, 48, 1191, 48, 48, 1192, 84, 524, 524, 524, 524, 524, 524,
+		524, 524, 524, 524, 524, 524, 524, 524, 587, 84, 84, 84, 84, 84, 84, 84,
+		524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524,
+		524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 1193, 84,
+		524, 524, 524, 524, 535, 1194, 524, 524, 524, 524, 524, 524, 1195, 1196, 1197, 1198,
+		1199, 1200, 524, 524, 524, 1201, 524, 524, 524, 524, 524, 524, 524, 536, 84, 84,
+		786, 786, 786, 786, 786, 786, 786, 786, 1202, 84, 84, 84, 84, 84, 84, 84,
+		84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 499, 499, 796, 84,
+		524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 535, 84, 499, 499, 499, 1203,
+		84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		1204, 1204, 1204, 1205, 1206, 1206, 1207, 1204, 1204, 1208, 1209, 1206, 1206, 1204, 1204, 1204,
+		1205, 1206, 1206, 1210, 1211, 1212, 1208, 1213, 1214, 1206, 1204, 1204, 1204, 1205, 1206, 1206,
+		1215, 1216, 1217, 1218, 1206, 1206, 1206, 1219, 1220, 1221, 1222, 1206, 1206, 1207, 1204, 1204,
+		1208, 1206, 1206, 1206, 1204, 1204, 1204, 1205, 1206, 1206, 1207, 1204, 1204, 1208, 1206, 1206,
+		1206, 1204, 1204, 1204, 1205, 1206, 1206, 1207, 1204, 1204, 1208, 1206, 1206, 1206, 1204, 1204,
+		1204, 1205, 1206, 1206, 1223, 1204, 1204, 1204, 1224, 1206, 1206, 1225, 1226, 1204, 1204, 1227,
+		1206, 1206, 1228, 1207, 1204, 1204, 1229, 1206, 1206, 1230, 1231, 1204, 1204, 1232, 1206, 1206,
+		1206, 1233, 1204, 1204, 1204, 1224, 1206, 1206, 1225, 1234, 4, 4, 4, 4, 4, 4,
+		1235, 1235, 1235, 1235, 1235, 1235, 1235, 1235, 1235, 1235, 1235, 1235, 1235, 1235, 1235, 1235,
+		1235, 1235, 1235, 1235, 1235, 1235, 1235, 1235, 1235, 1235, 1235, 1235, 1235, 1235, 1235, 1235,
+		1236, 1236, 1236, 1236, 1236, 1236, 1237, 1238, 1236, 1236, 1236, 1236, 1236, 1239, 1240, 1235,
+		1241, 1242, 84, 1243, 1244, 1236, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		10, 1245, 10, 737, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		1246, 1247, 1247, 1248, 1249, 1250, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		1251, 1251, 1251, 1251, 1251, 1252, 1253, 1254, 1255, 1256, 84, 84, 84, 84, 84, 84,
+		84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		84, 84, 1257, 1257, 1257, 1258, 84, 84, 1259, 1259, 1259, 1259, 1259, 1260, 1261, 1262,
+		84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 331, 1263, 329, 331,
+		1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264,
+		1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1265, 1266, 1267, 84, 84, 84, 84, 84,
+		1268, 1268, 1268, 1268, 1269, 1270, 1270, 1270, 1271, 1272, 1273, 1274, 84, 84, 84, 84,
+		84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 1275, 499,
+		499, 499, 499, 499, 499, 1276, 1277, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		1275, 499, 499, 499, 499, 1278, 499, 1279, 84, 84, 84, 84, 84, 84, 84, 84,
+		84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		1280, 92, 92, 92, 1281, 1282, 1283, 1284, 1285, 1286, 1281, 1287, 1281, 1283, 1283, 1288,
+		92, 1289, 92, 1290, 1291, 1289, 92, 1290, 84, 84, 84, 84, 84, 84, 1292, 84,
+		524, 524, 524, 524, 524, 587, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524,
+		524, 524, 587, 84, 524, 535, 1194, 524, 1194, 524, 1194, 524, 524, 524, 1193, 84,
+		499, 1293, 524, 524, 524, 524, 539, 539, 539, 1294, 539, 539, 539, 1294, 539, 539,
+		539, 1294, 524, 524, 524, 1193, 84, 84, 84, 84, 84, 84, 1295, 524, 524, 524,
+		1296, 84, 524, 524, 524, 524, 524, 587, 524, 1297, 1298, 84, 1193, 84, 84, 84,
+		84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524,
+		524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 1299,
+		524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524,
+		524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524,
+		524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524,
+		524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 1300, 524, 788, 524, 788,
+		524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 587, 84,
+		524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 1297, 524, 587, 1297, 84,
+		524, 587, 524, 524, 524, 524, 524, 524, 524, 84, 524, 1298, 524, 524, 524, 524,
+		524, 84, 524, 524, 524, 1193, 1298, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 587, 84, 524, 1193, 788, 788,
+		535, 84, 524, 524, 524, 788, 524, 536, 1193, 84, 524, 1298, 524, 84, 535, 84,
+		524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524,
+		524, 524, 1301, 524, 524, 524, 524, 524, 524, 536, 84, 84, 84, 84, 4, 1302,
+		619, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 620, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 617, 615, 615, 615,
+		615, 615, 615, 615, 619, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 617, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		616, 620, 615, 620, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 617, 615, 614,
+		615, 615, 615, 619, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 623, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 623, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 616, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 614, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 84, 84, 84, 84,
+		615, 615, 615, 615, 615, 615, 615, 1303, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 735, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 736, 84, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 1303, 84, 84, 84,
+		615, 615, 615, 735, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 1304, 84, 84, 84, 84, 84, 84,
+		84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		1305, 84, 84, 84, 496, 496, 496, 496, 496, 496, 496, 496, 496, 496, 496, 496,
+		84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+		48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 84, 84,
+		733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733,
+		733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 1306,
+	};
+
+	/// The record index for each code point in a block.
+	inline static constexpr uint16_t STAGE3[10456] = {
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 1, 1,
+		3, 4, 4, 4, 5, 4, 4, 4, 6, 7, 4, 8, 4, 9, 4, 4,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 8, 8, 8, 4,
+		4, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		11, 11, 11, 6, 4, 7, 12, 13, 12, 14, 14, 14, 14, 14, 14, 14,
+		14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 6, 8, 7, 8, 1,
+		1, 1, 1, 1, 1, 2, 1, 1, 3, 4, 5, 5, 5, 5, 15, 4,
+		12, 15, 16, 17, 8, 18, 15, 12, 15, 8, 19, 19, 12, 20, 4, 4,
+		12, 19, 16, 21, 19, 19, 19, 4, 11, 11, 11, 11, 11, 11, 11, 8,
+		11, 11, 11, 11, 11, 11, 11, 14, 14, 14, 14, 14, 14, 14, 14, 8,
+		11, 14, 11, 14, 11, 14, 11, 14, 14, 11, 14, 11, 14, 11, 14, 11,
+		14, 14, 11, 14, 11, 14, 11, 14, 11, 11, 14, 11, 14, 11, 14, 14,
+		14, 11, 11, 14, 11, 14, 11, 11, 14, 11, 11, 11, 14, 14, 11, 11,
+		11, 11, 14, 11, 11, 14, 11, 11, 11, 14, 14, 14, 11, 11, 14, 11,
+		11, 14, 11, 14, 11, 14, 11, 11, 14, 11, 14, 14, 11, 14, 11, 11,
+		14, 11, 11, 11, 14, 11, 14, 11, 11, 14, 14, 16, 11, 14, 14, 14,
+		16, 16, 16, 16, 11, 22, 14, 11, 22, 14, 11, 22, 14, 11, 14, 11,
+		14, 11, 14, 11, 14, 14, 11, 14, 14, 11, 22, 14, 11, 14, 11, 11,
+		11, 14, 11, 14, 14, 14, 14, 14, 14, 14, 11, 11, 14, 11, 11, 14,
+		14, 11, 14, 11, 11, 11, 11, 14, 14, 14, 14, 14, 16, 14, 14, 14,
+		23, 23, 23, 23, 23, 23, 23, 23, 23, 24, 24, 24, 24, 24, 24, 24,
+		24, 24, 12, 12, 12, 12, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+		24, 24, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+		23, 23, 23, 23, 23, 12, 12, 12, 12, 12, 25, 25, 24, 12, 24, 12,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 27, 26, 26,
+		28, 29, 28, 29, 24, 30, 28, 29, 0, 0, 31, 29, 29, 29, 4, 28,
+		0, 0, 0, 0, 30, 12, 28, 4, 28, 28, 28, 0, 28, 0, 28, 28,
+		29, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+		28, 28, 0, 28, 28, 28, 28, 28, 28, 28, 28, 28, 29, 29, 29, 29,
+		29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 28,
+		29, 29, 28, 28, 28, 29, 29, 29, 28, 29, 28, 29, 28, 29, 28, 29,
+		28, 29, 32, 33, 32, 33, 32, 33, 32, 33, 32, 33, 32, 33, 32, 33,
+		29, 29, 29, 29, 28, 29, 34, 28, 29, 28, 28, 29, 29, 28, 28, 28,
+		35, 35, 35, 35, 35, 35, 35, 35, 36, 36, 36, 36, 36, 36, 36, 36,
+		35, 36, 35, 36, 35, 36, 35, 36, 35, 36, 37, 38, 38, 26, 26, 38,
+		39, 39, 35, 36, 35, 36, 35, 36, 35, 35, 36, 35, 36, 35, 36, 35,
+		36, 35, 36, 35, 36, 35, 36, 36, 0, 40, 40, 40, 40, 40, 40, 40,
+		40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0,
+		0, 41, 42, 42, 42, 42, 42, 42, 43, 43, 43, 43, 43, 43, 43, 43,
+		43, 42, 44, 0, 0, 45, 45, 46, 0, 47, 47, 47, 47, 47, 47, 47,
+		47, 47, 47, 47, 47, 47, 47, 47, 48, 48, 48, 48, 48, 48, 48, 48,
+		48, 48, 48, 48, 48, 48, 49, 48, 50, 48, 48, 50, 48, 48, 50, 48,
+		0, 0, 0, 0, 0, 0, 0, 0, 51, 51, 51, 51, 51, 51, 51, 51,
+		51, 51, 51, 0, 0, 0, 0, 51, 51, 51, 51, 50, 50, 0, 0, 0,
+		52, 52, 52, 52, 52, 18, 53, 53, 53, 54, 54, 55, 4, 54, 56, 56,
+		57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 4, 52, 54, 54, 4,
+		58, 58, 58, 58, 58, 58, 58, 58, 24, 58, 58, 58, 58, 58, 58, 58,
+		58, 58, 58, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 57, 57,
+		59, 57, 57, 57, 57, 57, 57, 57, 60, 60, 60, 60, 60, 60, 60, 60,
+		60, 60, 54, 54, 54, 54, 58, 58, 27, 58, 58, 58, 58, 58, 58, 58,
+		58, 58, 58, 58, 54, 58, 57, 57, 57, 57, 57, 57, 57, 18, 56, 59,
+		59, 57, 57, 57, 57, 61, 61, 57, 57, 56, 59, 59, 59, 57, 58, 58,
+		60, 60, 58, 58, 58, 56, 56, 58, 62, 62, 62, 62, 62, 62, 62, 62,
+		62, 62, 62, 62, 62, 62, 0, 63, 64, 65, 64, 64, 64, 64, 64, 64,
+		64, 64, 64, 64, 64, 64, 64, 64, 65, 65, 65, 65, 65, 65, 65, 65,
+		66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 0, 0, 64, 64, 64,
+		67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 68, 68,
+		68, 68, 68, 68, 68, 68, 68, 68, 68, 67, 0, 0, 0, 0, 0, 0,
+		69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 70, 70, 70, 70, 70, 70,
+		70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 71, 71, 71, 71, 71,
+		71, 71, 71, 71, 72, 72, 73, 74, 74, 74, 72, 0, 0, 71, 75, 75,
+		76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 77, 77,
+		78, 78, 79, 77, 77, 77, 77, 77, 77, 77, 77, 77, 79, 77, 77, 77,
+		79, 77, 77, 77, 77, 78, 0, 0, 80, 80, 80, 80, 80, 80, 80, 80,
+		80, 80, 80, 80, 80, 80, 80, 0, 81, 81, 81, 81, 81, 81, 81, 81,
+		81, 82, 82, 82, 0, 0, 83, 0, 64, 64, 64, 0, 0, 0, 0, 0,
+		84, 58, 58, 58, 58, 58, 58, 0, 52, 52, 0, 0, 0, 0, 0, 0,
+		59, 59, 59, 59, 59, 59, 59, 59, 58, 61, 59, 59, 59, 59, 59, 59,
+		59, 59, 59, 59, 57, 57, 57, 57, 59, 59, 18, 57, 57, 57, 57, 57,
+		57, 57, 59, 59, 59, 59, 59, 59, 85, 85, 85, 86, 87, 87, 87, 87,
+		87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 85, 86, 88, 87, 86, 86,
+		86, 85, 85, 85, 85, 85, 85, 85, 85, 86, 86, 86, 86, 88, 86, 86,
+		87, 26, 26, 26, 26, 85, 85, 85, 87, 87, 85, 85, 4, 4, 89, 89,
+		89, 89, 89, 89, 89, 89, 89, 89, 90, 91, 87, 87, 87, 87, 87, 87,
+		92, 93, 94, 94, 0, 92, 92, 92, 92, 92, 92, 92, 92, 0, 0, 92,
+		92, 0, 0, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92,
+		92, 0, 92, 92, 92, 92, 92, 92, 92, 0, 92, 0, 0, 0, 92, 92,
+		92, 92, 0, 0, 95, 92, 94, 94, 94, 93, 93, 93, 93, 0, 0, 94,
+		94, 0, 0, 94, 94, 95, 92, 0, 0, 0, 0, 0, 0, 0, 0, 94,
+		0, 0, 0, 0, 92, 92, 0, 92, 92, 92, 93, 93, 0, 0, 96, 96,
+		96, 96, 96, 96, 96, 96, 96, 96, 92, 92, 97, 97, 98, 98, 98, 98,
+		98, 98, 99, 97, 92, 100, 95, 0, 0, 101, 101, 102, 0, 103, 103, 103,
+		103, 103, 103, 0, 0, 0, 0, 103, 103, 0, 0, 103, 103, 103, 103, 103,
+		103, 103, 103, 103, 103, 103, 103, 103, 103, 0, 103, 103, 103, 103, 103, 103,
+		103, 0, 103, 103, 0, 103, 103, 0, 103, 103, 0, 0, 104, 0, 102, 102,
+		102, 101, 101, 0, 0, 0, 0, 101, 101, 0, 0, 101, 101, 104, 0, 0,
+		0, 101, 0, 0, 0, 0, 0, 0, 0, 103, 103, 103, 103, 0, 103, 0,
+		0, 0, 0, 0, 0, 0, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105,
+		101, 101, 103, 103, 103, 101, 106, 0, 0, 107, 107, 108, 0, 109, 109, 109,
+		109, 109, 109, 109, 109, 109, 0, 109, 109, 109, 0, 109, 109, 109, 109, 109,
+		109, 109, 109, 109, 109, 109, 109, 109, 109, 0, 109, 109, 109, 109, 109, 109,
+		109, 0, 109, 109, 0, 109, 109, 109, 109, 109, 0, 0, 110, 109, 108, 108,
+		108, 107, 107, 107, 107, 107, 0, 107, 107, 108, 0, 108, 108, 110, 0, 0,
+		109, 0, 0, 0, 0, 0, 0, 0, 109, 109, 107, 107, 0, 0, 111, 111,
+		111, 111, 111, 111, 111, 111, 111, 111, 112, 113, 0, 0, 0, 0, 0, 0,
+		0, 109, 107, 107, 107, 110, 110, 110, 0, 114, 115, 115, 0, 116, 116, 116,
+		116, 116, 116, 116, 116, 0, 0, 116, 116, 0, 0, 116, 116, 116, 116, 116,
+		116, 116, 116, 116, 116, 116, 116, 116, 116, 0, 116, 116, 116, 116, 116, 116,
+		116, 0, 116, 116, 0, 116, 116, 116, 116, 116, 0, 0, 117, 116, 115, 114,
+		115, 114, 114, 114, 114, 0, 0, 115, 115, 0, 0, 115, 115, 117, 0, 0,
+		0, 0, 0, 0, 0, 117, 114, 115, 0, 0, 0, 0, 116, 116, 0, 116,
+		116, 116, 114, 114, 0, 0, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118,
+		119, 116, 120, 120, 120, 120, 120, 120, 0, 0, 121, 122, 0, 122, 122, 122,
+		122, 122, 122, 0, 0, 0, 122, 122, 122, 0, 122, 122, 122, 122, 0, 0,
+		0, 122, 122, 0, 122, 0, 122, 122, 0, 0, 0, 122, 122, 0, 0, 0,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 0, 0, 0, 0, 123, 123,
+		121, 123, 123, 0, 0, 0, 123, 123, 123, 0, 123, 123, 123, 124, 0, 0,
+		122, 0, 0, 0, 0, 0, 0, 123, 0, 0, 0, 0, 0, 0, 125, 125,
+		125, 125, 125, 125, 125, 125, 125, 125, 126, 126, 126, 127, 127, 127, 127, 127,
+		127, 128, 127, 0, 0, 0, 0, 0, 129, 130, 130, 130, 131, 132, 132, 132,
+		132, 132, 132, 132, 132, 0, 132, 132, 132, 0, 132, 132, 132, 132, 132, 132,
+		132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 0, 0, 131, 132, 129, 129,
+		129, 130, 130, 130, 130, 0, 129, 129, 129, 0, 129, 129, 129, 131, 0, 0,
+		0, 0, 0, 0, 0, 129, 129, 0, 132, 132, 132, 0, 0, 132, 0, 0,
+		132, 132, 129, 129, 0, 0, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+		0, 0, 0, 0, 0, 0, 0, 134, 135, 135, 135, 135, 135, 135, 135, 136,
+		137, 138, 139, 139, 140, 137, 137, 137, 137, 137, 137, 137, 137, 0, 137, 137,
+		137, 0, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137,
+		137, 137, 137, 137, 0, 137, 137, 137, 137, 137, 0, 0, 141, 137, 139, 138,
+		139, 139, 139, 139, 139, 0, 138, 139, 139, 0, 139, 139, 138, 141, 0, 0,
+		0, 0, 0, 0, 0, 139, 139, 0, 0, 0, 0, 0, 0, 137, 137, 0,
+		137, 137, 138, 138, 0, 0, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+		0, 137, 137, 0, 0, 0, 0, 0, 143, 143, 144, 144, 145, 145, 145, 145,
+		145, 145, 145, 145, 145, 0, 145, 145, 145, 0, 145, 145, 145, 145, 145, 145,
+		145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 146, 146, 145, 144, 144,
+		144, 143, 143, 143, 143, 0, 144, 144, 144, 0, 144, 144, 144, 146, 145, 147,
+		0, 0, 0, 0, 145, 145, 145, 144, 148, 148, 148, 148, 148, 148, 148, 145,
+		145, 145, 143, 143, 0, 0, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149,
+		148, 148, 148, 148, 148, 148, 148, 148, 148, 147, 145, 145, 145, 145, 145, 145,
+		0, 150, 151, 151, 0, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152,
+		152, 152, 152, 152, 152, 152, 152, 0, 0, 0, 152, 152, 152, 152, 152, 152,
+		152, 152, 0, 152, 152, 152, 152, 152, 152, 152, 152, 152, 0, 152, 0, 0,
+		0, 0, 153, 0, 0, 0, 0, 151, 151, 151, 150, 150, 150, 0, 150, 0,
+		151, 151, 151, 151, 151, 151, 151, 151, 0, 0, 0, 0, 0, 0, 154, 154,
+		154, 154, 154, 154, 154, 154, 154, 154, 0, 0, 151, 151, 155, 0, 0, 0,
+		0, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+		156, 157, 156, 156, 157, 157, 157, 157, 157, 157, 157, 0, 0, 0, 0, 5,
+		156, 156, 156, 156, 156, 156, 158, 159, 159, 159, 159, 159, 159, 157, 159, 160,
+		161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 160, 160, 0, 0, 0, 0,
+		0, 162, 162, 0, 162, 0, 162, 162, 162, 162, 162, 0, 162, 162, 162, 162,
+		162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 0, 162, 0, 162,
+		162, 163, 162, 162, 163, 163, 163, 163, 163, 163, 164, 163, 163, 162, 0, 0,
+		162, 162, 162, 162, 162, 0, 165, 0, 164, 164, 164, 164, 164, 163, 0, 0,
+		166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 0, 0, 162, 162, 162, 162,
+		167, 168, 168, 168, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+		169, 169, 169, 168, 169, 168, 168, 168, 170, 170, 168, 168, 168, 168, 168, 168,
+		171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 172, 172, 172, 172, 172, 172,
+		172, 172, 172, 172, 168, 170, 168, 170, 168, 170, 173, 174, 173, 174, 175, 175,
+		167, 167, 167, 167, 167, 167, 167, 167, 0, 167, 167, 167, 167, 167, 167, 167,
+		167, 167, 167, 167, 167, 0, 0, 0, 0, 176, 176, 176, 176, 176, 176, 176,
+		176, 176, 176, 176, 176, 176, 176, 177, 176, 176, 170, 170, 170, 169, 170, 170,
+		167, 167, 167, 167, 167, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+		176, 176, 176, 176, 176, 0, 168, 168, 168, 168, 168, 168, 168, 168, 170, 168,
+		168, 168, 168, 168, 168, 0, 168, 168, 169, 169, 169, 169, 169, 15, 15, 15,
+		15, 169, 169, 0, 0, 0, 0, 0, 178, 178, 178, 178, 178, 178, 178, 178,
+		178, 178, 178, 179, 179, 180, 180, 180, 180, 179, 180, 180, 180, 180, 180, 181,
+		179, 181, 181, 179, 179, 180, 180, 178, 182, 182, 182, 182, 182, 182, 182, 182,
+		182, 182, 183, 183, 183, 183, 183, 183, 178, 178, 178, 178, 178, 178, 179, 179,
+		180, 180, 178, 178, 178, 178, 180, 180, 180, 178, 179, 179, 179, 178, 178, 179,
+		179, 179, 179, 179, 179, 179, 178, 178, 178, 180, 180, 180, 180, 178, 178, 178,
+		178, 178, 180, 179, 179, 180, 180, 179, 179, 179, 179, 179, 179, 180, 178, 179,
+		182, 182, 179, 179, 179, 180, 184, 184, 185, 185, 185, 185, 185, 185, 185, 185,
+		185, 185, 185, 185, 185, 185, 0, 185, 0, 0, 0, 0, 0, 185, 0, 0,
+		186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 4, 187, 186, 186, 186,
+		188, 188, 188, 188, 188, 188, 188, 188, 189, 189, 189, 189, 189, 189, 189, 189,
+		189, 0, 189, 189, 189, 189, 0, 0, 189, 189, 189, 189, 189, 189, 189, 0,
+		189, 189, 189, 0, 0, 190, 190, 190, 191, 191, 191, 191, 191, 191, 191, 191,
+		191, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+		192, 192, 192, 192, 192, 0, 0, 0, 193, 193, 193, 193, 193, 193, 193, 193,
+		193, 193, 0, 0, 0, 0, 0, 0, 194, 194, 194, 194, 194, 194, 194, 194,
+		194, 194, 194, 194, 194, 194, 0, 0, 195, 195, 195, 195, 195, 195, 0, 0,
+		196, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197,
+		197, 197, 197, 197, 197, 198, 199, 197, 200, 201, 201, 201, 201, 201, 201, 201,
+		201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 202, 203, 0, 0, 0,
+		204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 4, 4, 4, 205, 205,
+		205, 204, 204, 204, 204, 204, 204, 204, 204, 0, 0, 0, 0, 0, 0, 0,
+		206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 207, 207, 208, 209, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 206, 210, 210, 210, 210, 210, 210, 210, 210,
+		210, 210, 211, 211, 212, 4, 4, 0, 213, 213, 213, 213, 213, 213, 213, 213,
+		213, 213, 214, 214, 0, 0, 0, 0, 215, 215, 215, 215, 215, 215, 215, 215,
+		215, 215, 215, 215, 215, 0, 215, 215, 215, 0, 216, 216, 0, 0, 0, 0,
+		217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 218, 218, 219, 220,
+		220, 220, 220, 220, 220, 220, 219, 219, 219, 219, 219, 219, 219, 219, 220, 219,
+		219, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 221, 221, 221, 222,
+		221, 221, 221, 223, 217, 218, 0, 0, 224, 224, 224, 224, 224, 224, 224, 224,
+		224, 224, 0, 0, 0, 0, 0, 0, 225, 225, 225, 225, 225, 225, 225, 225,
+		225, 225, 0, 0, 0, 0, 0, 0, 226, 226, 4, 4, 226, 4, 227, 226,
+		226, 226, 226, 228, 228, 228, 229, 228, 230, 230, 230, 230, 230, 230, 230, 230,
+		230, 230, 0, 0, 0, 0, 0, 0, 231, 231, 231, 231, 231, 231, 231, 231,
+		231, 231, 231, 232, 231, 231, 231, 231, 231, 0, 0, 0, 0, 0, 0, 0,
+		231, 231, 231, 231, 231, 233, 233, 231, 231, 233, 231, 0, 0, 0, 0, 0,
+		197, 197, 197, 197, 197, 197, 0, 0, 234, 234, 234, 234, 234, 234, 234, 234,
+		234, 234, 234, 234, 234, 234, 234, 0, 235, 235, 235, 236, 236, 236, 236, 235,
+		235, 236, 236, 236, 0, 0, 0, 0, 236, 236, 235, 236, 236, 236, 236, 236,
+		236, 237, 237, 237, 0, 0, 0, 0, 238, 0, 0, 0, 239, 239, 240, 240,
+		240, 240, 240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241, 241, 241, 241,
+		241, 241, 241, 241, 241, 241, 0, 0, 241, 241, 241, 241, 241, 0, 0, 0,
+		242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 0, 0, 0, 0,
+		242, 242, 0, 0, 0, 0, 0, 0, 243, 243, 243, 243, 243, 243, 243, 243,
+		243, 243, 244, 0, 0, 0, 245, 245, 246, 246, 246, 246, 246, 246, 246, 246,
+		247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 248,
+		248, 249, 249, 248, 0, 0, 250, 250, 251, 251, 251, 251, 251, 251, 251, 251,
+		251, 251, 251, 251, 251, 252, 253, 252, 253, 253, 253, 253, 253, 253, 253, 0,
+		254, 252, 253, 252, 252, 253, 253, 253, 253, 253, 253, 253, 253, 252, 252, 252,
+		252, 252, 252, 253, 253, 254, 254, 254, 254, 254, 254, 254, 254, 0, 0, 254,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0,
+		256, 256, 256, 256, 256, 256, 256, 257, 256, 256, 256, 256, 256, 256, 0, 0,
+		26, 26, 26, 26, 26, 26, 258, 27, 27, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 27, 27, 27, 0, 259, 259, 259, 259, 260, 261, 261, 261,
+		261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 262, 260, 259, 259,
+		259, 259, 259, 260, 259, 260, 260, 260, 260, 260, 259, 260, 263, 261, 261, 261,
+		261, 261, 261, 261, 261, 0, 0, 0, 264, 264, 264, 264, 264, 264, 264, 264,
+		264, 264, 265, 265, 265, 265, 265, 265, 265, 266, 266, 266, 266, 266, 266, 266,
+		266, 266, 266, 262, 262, 262, 262, 262, 262, 262, 262, 262, 266, 266, 266, 266,
+		266, 266, 266, 266, 266, 265, 265, 0, 267, 267, 268, 269, 269, 269, 269, 269,
+		269, 269, 269, 269, 269, 269, 269, 269, 269, 268, 267, 267, 267, 267, 268, 268,
+		267, 267, 270, 271, 267, 267, 269, 269, 272, 272, 272, 272, 272, 272, 272, 272,
+		272, 272, 269, 269, 269, 269, 269, 269, 273, 273, 273, 273, 273, 273, 273, 273,
+		273, 273, 273, 273, 273, 273, 274, 275, 276, 276, 275, 275, 275, 276, 275, 276,
+		276, 276, 277, 277, 0, 0, 0, 0, 0, 0, 0, 0, 278, 278, 278, 278,
+		279, 279, 279, 279, 279, 279, 279, 279, 279, 279, 279, 279, 280, 280, 280, 280,
+		280, 280, 280, 280, 281, 281, 281, 281, 281, 281, 281, 281, 280, 280, 281, 282,
+		0, 0, 0, 283, 283, 283, 283, 283, 284, 284, 284, 284, 284, 284, 284, 284,
+		284, 284, 0, 0, 0, 279, 279, 279, 285, 285, 285, 285, 285, 285, 285, 285,
+		285, 285, 286, 286, 286, 286, 286, 286, 286, 286, 286, 286, 286, 286, 286, 286,
+		287, 287, 287, 287, 287, 287, 288, 288, 36, 0, 0, 0, 0, 0, 0, 0,
+		185, 185, 185, 0, 0, 185, 185, 185, 289, 289, 289, 289, 289, 289, 289, 289,
+		26, 26, 26, 4, 26, 26, 26, 26, 26, 290, 26, 26, 26, 26, 26, 26,
+		26, 291, 291, 291, 291, 26, 291, 291, 291, 291, 291, 291, 26, 291, 291, 290,
+		26, 26, 291, 0, 0, 0, 0, 0, 14, 14, 14, 14, 14, 14, 29, 29,
+		29, 29, 29, 36, 23, 23, 23, 23, 23, 23, 23, 23, 23, 31, 31, 31,
+		31, 31, 23, 23, 23, 23, 31, 31, 31, 31, 31, 14, 14, 14, 14, 14,
+		292, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 23, 23, 23, 23, 23,
+		23, 23, 23, 23, 23, 23, 23, 31, 26, 26, 26, 26, 26, 26, 26, 27,
+		27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 26, 26, 26,
+		11, 14, 11, 14, 11, 14, 14, 14, 14, 14, 14, 14, 14, 14, 11, 14,
+		29, 29, 29, 29, 29, 29, 0, 0, 28, 28, 28, 28, 28, 28, 0, 0,
+		0, 28, 0, 28, 0, 28, 0, 28, 293, 293, 293, 293, 293, 293, 293, 293,
+		29, 29, 29, 29, 29, 0, 29, 29, 28, 28, 28, 28, 293, 30, 29, 30,
+		30, 30, 29, 29, 29, 0, 29, 29, 28, 28, 28, 28, 293, 30, 30, 30,
+		29, 29, 29, 29, 0, 0, 29, 29, 28, 28, 28, 28, 0, 30, 30, 30,
+		28, 28, 28, 28, 28, 30, 30, 30, 0, 0, 29, 29, 29, 0, 29, 29,
+		28, 28, 28, 28, 293, 30, 30, 0, 3, 3, 3, 3, 3, 3, 3, 3,
+		3, 3, 3, 18, 294, 294, 18, 18, 9, 9, 9, 9, 9, 9, 4, 4,
+		17, 21, 6, 17, 17, 21, 6, 17, 4, 4, 4, 4, 4, 4, 4, 4,
+		295, 296, 18, 18, 18, 18, 18, 3, 4, 17, 21, 4, 4, 4, 4, 13,
+		13, 4, 4, 4, 8, 6, 7, 4, 4, 4, 8, 4, 13, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 3, 18, 18, 18, 18, 18, 0, 18, 18,
+		18, 18, 18, 18, 18, 18, 18, 18, 19, 23, 0, 0, 19, 19, 19, 19,
+		19, 19, 8, 8, 8, 6, 7, 23, 19, 19, 19, 19, 19, 19, 19, 19,
+		19, 19, 8, 8, 8, 6, 7, 0, 23, 23, 23, 23, 23, 0, 0, 0,
+		5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0,
+		26, 26, 26, 26, 26, 258, 258, 258, 258, 26, 258, 258, 258, 26, 26, 26,
+		26, 0, 0, 0, 0, 0, 0, 0, 15, 15, 297, 15, 15, 15, 15, 297,
+		15, 15, 20, 297, 297, 297, 20, 20, 297, 297, 297, 20, 15, 297, 15, 15,
+		8, 297, 297, 297, 297, 297, 15, 15, 15, 15, 15, 15, 297, 15, 28, 15,
+		297, 15, 11, 11, 297, 297, 15, 20, 297, 297, 11, 297, 20, 291, 291, 291,
+		291, 20, 15, 15, 20, 20, 297, 297, 8, 8, 8, 8, 8, 297, 20, 20,
+		20, 20, 15, 8, 15, 15, 14, 15, 298, 298, 298, 298, 298, 298, 298, 298,
+		298, 298, 298, 11, 14, 298, 298, 298, 298, 19, 15, 15, 0, 0, 0, 0,
+		8, 8, 8, 8, 8, 15, 15, 15, 15, 15, 8, 8, 15, 15, 15, 15,
+		8, 15, 15, 8, 15, 15, 8, 15, 15, 15, 15, 15, 15, 15, 8, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 8, 8,
+		15, 15, 8, 15, 8, 15, 15, 15, 15, 15, 15, 15, 8, 8, 8, 8,
+		8, 8, 8, 8, 8, 8, 8, 8, 6, 7, 6, 7, 15, 15, 15, 15,
+		8, 8, 15, 15, 15, 15, 15, 15, 15, 6, 7, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 8, 15, 15, 15, 15, 15, 15, 8, 8, 8, 8, 8,
+		8, 8, 8, 8, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 0,
+		15, 15, 15, 0, 0, 0, 0, 0, 19, 19, 19, 19, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 299, 299, 299, 299, 299, 299, 299, 299, 299, 299,
+		299, 299, 19, 19, 19, 19, 19, 19, 15, 15, 15, 15, 15, 15, 15, 8,
+		15, 8, 15, 15, 15, 15, 15, 15, 6, 7, 6, 7, 6, 7, 6, 7,
+		6, 7, 6, 7, 6, 7, 19, 19, 8, 8, 8, 8, 8, 6, 7, 8,
+		8, 8, 8, 8, 8, 8, 6, 7, 300, 300, 300, 300, 300, 300, 300, 300,
+		8, 8, 8, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+		7, 8, 8, 8, 8, 8, 8, 8, 6, 7, 6, 7, 8, 8, 8, 8,
+		8, 8, 8, 8, 6, 7, 8, 8, 8, 8, 8, 8, 8, 15, 15, 8,
+		15, 15, 15, 15, 0, 0, 15, 15, 15, 15, 15, 15, 15, 15, 0, 15,
+		301, 301, 301, 301, 301, 301, 301, 301, 302, 302, 302, 302, 302, 302, 302, 302,
+		11, 14, 11, 11, 11, 14, 14, 11, 14, 11, 14, 11, 14, 11, 11, 11,
+		11, 14, 11, 14, 14, 11, 14, 14, 14, 14, 14, 14, 23, 23, 11, 11,
+		32, 33, 32, 33, 33, 303, 303, 303, 303, 303, 303, 32, 33, 32, 33, 304,
+		304, 304, 32, 33, 0, 0, 0, 0, 0, 305, 305, 305, 305, 306, 305, 305,
+		186, 186, 186, 186, 186, 186, 0, 186, 0, 0, 0, 0, 0, 186, 0, 0,
+		307, 307, 307, 307, 307, 307, 307, 307, 0, 0, 0, 0, 0, 0, 0, 308,
+		309, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 310,
+		311, 311, 311, 311, 311, 311, 311, 311, 4, 4, 17, 21, 17, 21, 4, 4,
+		4, 17, 21, 4, 17, 21, 4, 4, 4, 4, 4, 4, 4, 4, 4, 9,
+		4, 4, 9, 4, 17, 21, 4, 4, 17, 21, 6, 7, 6, 7, 6, 7,
+		6, 7, 4, 4, 4, 4, 4, 24, 4, 4, 9, 9, 4, 4, 4, 4,
+		9, 4, 6, 4, 4, 4, 4, 4, 15, 15, 4, 4, 4, 6, 7, 6,
+		7, 6, 7, 6, 7, 9, 0, 0, 312, 312, 312, 312, 312, 312, 312, 312,
+		312, 312, 0, 312, 312, 312, 312, 312, 312, 312, 312, 312, 0, 0, 0, 0,
+		312, 312, 312, 312, 312, 312, 0, 0, 15, 15, 15, 15, 0, 0, 0, 0,
+		3, 4, 4, 4, 15, 313, 291, 314, 6, 7, 15, 15, 6, 7, 6, 7,
+		6, 7, 6, 7, 9, 6, 7, 7, 15, 314, 314, 314, 314, 314, 314, 314,
+		314, 314, 26, 26, 26, 26, 315, 315, 9, 24, 24, 24, 24, 24, 15, 15,
+		314, 314, 314, 313, 291, 4, 15, 15, 0, 316, 316, 316, 316, 316, 316, 316,
+		316, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316, 0,
+		0, 26, 26, 12, 12, 317, 317, 316, 9, 318, 318, 318, 318, 318, 318, 318,
+		318, 318, 318, 318, 318, 318, 318, 318, 318, 318, 318, 4, 24, 319, 319, 318,
+		0, 0, 0, 0, 0, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+		0, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 0,
+		15, 15, 19, 19, 19, 19, 15, 15, 321, 321, 321, 321, 321, 321, 321, 321,
+		321, 321, 321, 321, 321, 321, 321, 0, 19, 19, 15, 15, 15, 15, 15, 15,
+		15, 19, 19, 19, 19, 19, 19, 19, 321, 321, 321, 321, 321, 321, 321, 15,
+		322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 15,
+		323, 323, 323, 323, 323, 324, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323,
+		323, 323, 323, 324, 323, 323, 323, 323, 323, 323, 324, 323, 323, 323, 323, 323,
+		324, 323, 323, 324, 323, 323, 323, 324, 323, 324, 323, 323, 323, 323, 323, 323,
+		323, 323, 323, 323, 324, 323, 323, 323, 323, 323, 323, 323, 324, 323, 324, 323,
+		323, 323, 323, 323, 323, 323, 323, 324, 324, 323, 323, 323, 323, 323, 323, 323,
+		323, 323, 323, 323, 323, 323, 324, 323, 323, 324, 323, 324, 323, 324, 323, 323,
+		323, 324, 323, 324, 324, 324, 323, 323, 323, 324, 324, 324, 324, 323, 323, 323,
+		323, 323, 323, 323, 323, 323, 324, 324, 323, 323, 323, 323, 324, 324, 324, 323,
+		325, 325, 325, 325, 325, 325, 325, 325, 325, 325, 325, 325, 325, 326, 325, 325,
+		325, 325, 325, 325, 325, 0, 0, 0, 327, 327, 327, 327, 327, 327, 327, 327,
+		327, 327, 327, 327, 327, 327, 327, 0, 328, 328, 328, 328, 328, 328, 328, 328,
+		329, 329, 329, 329, 329, 329, 330, 330, 331, 331, 331, 331, 331, 331, 331, 331,
+		331, 331, 331, 331, 332, 333, 333, 333, 334, 334, 334, 334, 334, 334, 334, 334,
+		334, 334, 331, 331, 0, 0, 0, 0, 35, 36, 35, 36, 35, 36, 335, 38,
+		39, 39, 39, 336, 311, 311, 311, 311, 311, 311, 311, 311, 38, 38, 336, 292,
+		35, 36, 35, 36, 292, 292, 311, 311, 337, 337, 337, 337, 337, 337, 337, 337,
+		337, 337, 337, 337, 337, 337, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338,
+		339, 339, 340, 340, 340, 340, 340, 340, 12, 12, 12, 12, 12, 12, 12, 24,
+		12, 12, 11, 14, 11, 14, 11, 14, 23, 14, 14, 14, 14, 14, 14, 14,
+		14, 11, 14, 11, 14, 11, 11, 14, 24, 12, 12, 11, 14, 11, 14, 16,
+		11, 14, 11, 14, 14, 14, 11, 14, 11, 14, 11, 11, 11, 11, 11, 14,
+		11, 11, 11, 11, 11, 14, 11, 14, 11, 14, 11, 14, 11, 11, 11, 11,
+		14, 11, 14, 0, 0, 0, 0, 0, 11, 14, 0, 14, 0, 14, 11, 14,
+		11, 14, 0, 0, 0, 0, 0, 0, 0, 0, 23, 23, 23, 11, 14, 16,
+		23, 23, 14, 16, 16, 16, 16, 16, 341, 341, 342, 341, 341, 341, 343, 341,
+		341, 341, 341, 342, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+		341, 341, 341, 344, 344, 342, 342, 344, 345, 345, 345, 345, 343, 0, 0, 0,
+		19, 19, 19, 19, 19, 19, 15, 15, 5, 15, 0, 0, 0, 0, 0, 0,
+		346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 347, 347, 347, 347,
+		348, 348, 349, 349, 349, 349, 349, 349, 349, 349, 349, 349, 349, 349, 349, 349,
+		349, 349, 349, 349, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348,
+		348, 348, 348, 348, 350, 351, 0, 0, 0, 0, 0, 0, 0, 0, 352, 352,
+		353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 0, 0, 0, 0, 0, 0,
+		88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 87, 87, 87, 87, 87, 87,
+		90, 90, 90, 87, 90, 87, 87, 85, 354, 354, 354, 354, 354, 354, 354, 354,
+		354, 354, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355,
+		355, 355, 355, 355, 355, 355, 356, 356, 356, 356, 356, 357, 357, 357, 4, 358,
+		359, 359, 359, 359, 359, 359, 359, 359, 359, 359, 359, 359, 359, 359, 359, 360,
+		360, 360, 360, 360, 360, 360, 360, 360, 360, 360, 361, 362, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 363, 188, 188, 188, 188, 188, 0, 0, 0,
+		364, 364, 364, 365, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366,
+		366, 366, 366, 367, 365, 365, 364, 364, 364, 364, 365, 365, 364, 364, 365, 365,
+		368, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 0, 24,
+		370, 370, 370, 370, 370, 370, 370, 370, 370, 370, 0, 0, 0, 0, 369, 369,
+		178, 178, 178, 178, 178, 180, 371, 178, 182, 182, 178, 178, 178, 178, 178, 0,
+		372, 372, 372, 372, 372, 372, 372, 372, 372, 373, 373, 373, 373, 373, 373, 374,
+		374, 373, 373, 374, 374, 373, 373, 0, 372, 372, 372, 373, 372, 372, 372, 372,
+		372, 372, 372, 372, 373, 374, 0, 0, 375, 375, 375, 375, 375, 375, 375, 375,
+		375, 375, 0, 0, 376, 376, 376, 376, 371, 178, 178, 178, 178, 178, 178, 184,
+		184, 184, 178, 179, 180, 179, 178, 178, 377, 377, 377, 377, 377, 377, 377, 377,
+		378, 377, 378, 378, 378, 377, 377, 378, 378, 377, 377, 377, 377, 377, 378, 379,
+		377, 379, 377, 0, 0, 0, 0, 0, 0, 0, 0, 377, 377, 380, 381, 381,
+		382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 383, 384, 384, 383, 383,
+		385, 385, 382, 386, 386, 383, 387, 0, 0, 189, 189, 189, 189, 189, 189, 0,
+		14, 14, 14, 12, 23, 23, 23, 23, 14, 14, 14, 14, 14, 29, 14, 14,
+		14, 23, 12, 12, 0, 0, 0, 0, 195, 195, 195, 195, 195, 195, 195, 195,
+		382, 382, 382, 383, 383, 384, 383, 383, 384, 383, 383, 385, 388, 387, 0, 0,
+		389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 0, 0, 0, 0, 0, 0,
+		188, 188, 188, 188, 0, 0, 0, 0, 0, 0, 0, 188, 188, 188, 188, 188,
+		390, 390, 390, 390, 390, 390, 390, 390, 391, 391, 391, 391, 391, 391, 391, 391,
+		323, 324, 323, 324, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 0, 0,
+		323, 323, 0, 0, 0, 0, 0, 0, 14, 14, 14, 14, 14, 14, 14, 0,
+		0, 0, 0, 43, 43, 43, 43, 43, 0, 0, 0, 0, 0, 51, 48, 51,
+		51, 392, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 0,
+		51, 51, 51, 51, 51, 0, 51, 0, 51, 51, 0, 51, 51, 0, 51, 51,
+		58, 58, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+		84, 84, 84, 0, 0, 0, 0, 0, 0, 0, 0, 58, 58, 58, 58, 58,
+		58, 58, 58, 58, 58, 58, 7, 6, 56, 56, 56, 56, 56, 56, 56, 56,
+		0, 0, 58, 58, 58, 58, 58, 58, 0, 0, 0, 0, 0, 0, 0, 56,
+		58, 58, 58, 58, 55, 56, 56, 56, 4, 4, 4, 4, 4, 4, 4, 6,
+		7, 4, 0, 0, 0, 0, 0, 0, 26, 26, 26, 26, 26, 26, 38, 38,
+		4, 9, 9, 13, 13, 6, 7, 6, 7, 6, 7, 6, 7, 4, 4, 6,
+		7, 4, 4, 4, 4, 13, 13, 13, 4, 4, 4, 0, 4, 4, 4, 4,
+		9, 6, 7, 6, 7, 6, 7, 4, 4, 4, 8, 9, 8, 8, 8, 0,
+		4, 5, 4, 4, 0, 0, 0, 0, 58, 58, 58, 58, 58, 0, 58, 58,
+		58, 58, 58, 58, 58, 0, 0, 18, 0, 4, 4, 4, 5, 4, 4, 4,
+		14, 14, 14, 6, 8, 7, 8, 6, 7, 4, 6, 7, 4, 4, 318, 318,
+		24, 318, 318, 318, 318, 318, 318, 318, 318, 318, 318, 318, 318, 318, 24, 24,
+		0, 0, 188, 188, 188, 188, 188, 188, 0, 0, 188, 188, 188, 0, 0, 0,
+		5, 5, 8, 12, 15, 5, 5, 0, 15, 8, 8, 8, 8, 15, 15, 0,
+		0, 18, 18, 18, 15, 15, 0, 0, 393, 393, 393, 393, 393, 393, 393, 393,
+		393, 393, 393, 393, 0, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 0,
+		393, 393, 393, 0, 393, 393, 0, 393, 393, 393, 393, 393, 393, 393, 0, 0,
+		393, 393, 393, 0, 0, 0, 0, 0, 4, 4, 4, 0, 0, 0, 0, 19,
+		19, 19, 19, 19, 0, 0, 0, 15, 394, 394, 394, 394, 394, 394, 394, 394,
+		394, 394, 394, 394, 394, 395, 395, 395, 395, 396, 396, 396, 396, 396, 396, 396,
+		396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 395, 395, 396, 396, 396, 0,
+		15, 15, 15, 15, 15, 0, 0, 0, 396, 0, 0, 0, 0, 0, 0, 0,
+		15, 15, 15, 15, 15, 26, 0, 0, 397, 397, 397, 397, 397, 397, 397, 397,
+		397, 397, 397, 397, 397, 0, 0, 0, 398, 398, 398, 398, 398, 398, 398, 398,
+		398, 0, 0, 0, 0, 0, 0, 0, 26, 19, 19, 19, 19, 19, 19, 19,
+		19, 19, 19, 19, 0, 0, 0, 0, 399, 399, 399, 399, 399, 399, 399, 399,
+		400, 400, 400, 400, 0, 0, 0, 0, 0, 0, 0, 0, 0, 399, 399, 399,
+		401, 401, 401, 401, 401, 401, 401, 401, 401, 402, 401, 401, 401, 401, 401, 401,
+		401, 401, 402, 0, 0, 0, 0, 0, 403, 403, 403, 403, 403, 403, 403, 403,
+		403, 403, 403, 403, 403, 403, 404, 404, 404, 404, 404, 0, 0, 0, 0, 0,
+		405, 405, 405, 405, 405, 405, 405, 405, 405, 405, 405, 405, 405, 405, 0, 406,
+		407, 407, 407, 407, 407, 407, 407, 407, 407, 407, 407, 407, 0, 0, 0, 0,
+		408, 409, 409, 409, 409, 409, 0, 0, 410, 410, 410, 410, 410, 410, 410, 410,
+		411, 411, 411, 411, 411, 411, 411, 411, 412, 412, 412, 412, 412, 412, 412, 412,
+		413, 413, 413, 413, 413, 413, 413, 413, 413, 413, 413, 413, 413, 413, 0, 0,
+		414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 0, 0, 0, 0, 0, 0,
+		415, 415, 415, 415, 415, 415, 415, 415, 415, 415, 415, 415, 0, 0, 0, 0,
+		416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 0, 0, 0, 0,
+		417, 417, 417, 417, 417, 417, 417, 417, 418, 418, 418, 418, 418, 418, 418, 418,
+		418, 418, 418, 418, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 419,
+		420, 420, 420, 420, 420, 420, 420, 420, 420, 420, 420, 0, 420, 420, 420, 420,
+		420, 420, 420, 0, 420, 420, 0, 421, 421, 421, 421, 421, 421, 421, 421, 421,
+		421, 421, 0, 421, 421, 421, 421, 421, 421, 421, 0, 421, 421, 0, 0, 0,
+		422, 422, 422, 422, 422, 422, 422, 422, 422, 422, 422, 422, 422, 422, 422, 0,
+		422, 422, 422, 422, 422, 422, 0, 0, 23, 23, 23, 23, 23, 23, 0, 23,
+		23, 0, 23, 23, 23, 23, 23, 23, 23, 23, 23, 0, 0, 0, 0, 0,
+		423, 423, 423, 423, 423, 423, 0, 0, 423, 0, 423, 423, 423, 423, 423, 423,
+		423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 0, 423,
+		423, 0, 0, 0, 423, 0, 0, 423, 424, 424, 424, 424, 424, 424, 424, 424,
+		424, 424, 424, 424, 424, 424, 0, 425, 426, 426, 426, 426, 426, 426, 426, 426,
+		427, 427, 427, 427, 427, 427, 427, 427, 427, 427, 427, 427, 427, 427, 427, 428,
+		428, 429, 429, 429, 429, 429, 429, 429, 430, 430, 430, 430, 430, 430, 430, 430,
+		430, 430, 430, 430, 430, 430, 430, 0, 0, 0, 0, 0, 0, 0, 0, 431,
+		431, 431, 431, 431, 431, 431, 431, 431, 432, 432, 432, 432, 432, 432, 432, 432,
+		432, 432, 432, 0, 432, 432, 0, 0, 0, 0, 0, 433, 433, 433, 433, 433,
+		434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 435, 435,
+		435, 435, 435, 435, 0, 0, 0, 436, 437, 437, 437, 437, 437, 437, 437, 437,
+		437, 437, 0, 0, 0, 0, 0, 438, 439, 439, 439, 439, 439, 439, 439, 439,
+		440, 440, 440, 440, 440, 440, 440, 440, 0, 0, 0, 0, 441, 441, 440, 440,
+		441, 441, 441, 441, 441, 441, 441, 441, 0, 0, 441, 441, 441, 441, 441, 441,
+		442, 443, 443, 443, 0, 443, 443, 0, 0, 0, 0, 0, 443, 443, 443, 443,
+		442, 442, 442, 442, 0, 442, 442, 442, 0, 442, 442, 442, 442, 442, 442, 442,
+		442, 442, 442, 442, 442, 442, 442, 442, 442, 442, 442, 442, 442, 442, 0, 0,
+		444, 444, 444, 0, 0, 0, 0, 444, 445, 445, 445, 445, 445, 445, 445, 445,
+		445, 0, 0, 0, 0, 0, 0, 0, 446, 446, 446, 446, 446, 446, 446, 446,
+		446, 0, 0, 0, 0, 0, 0, 0, 447, 447, 447, 447, 447, 447, 447, 447,
+		447, 447, 447, 447, 447, 448, 448, 449, 450, 450, 450, 450, 450, 450, 450, 450,
+		450, 450, 450, 450, 450, 451, 451, 451, 452, 452, 452, 452, 452, 452, 452, 452,
+		453, 452, 452, 452, 452, 452, 452, 452, 452, 452, 452, 452, 452, 454, 454, 0,
+		0, 0, 0, 455, 455, 455, 455, 455, 456, 456, 456, 456, 456, 456, 456, 0,
+		457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 0, 0,
+		0, 458, 458, 458, 458, 458, 458, 458, 459, 459, 459, 459, 459, 459, 459, 459,
+		459, 459, 459, 459, 459, 459, 0, 0, 460, 460, 460, 460, 460, 460, 460, 460,
+		461, 461, 461, 461, 461, 461, 461, 461, 461, 461, 461, 0, 0, 0, 0, 0,
+		462, 462, 462, 462, 462, 462, 462, 462, 463, 463, 463, 463, 463, 463, 463, 463,
+		463, 463, 0, 0, 0, 0, 0, 0, 0, 464, 464, 464, 464, 0, 0, 0,
+		0, 465, 465, 465, 465, 465, 465, 465, 466, 466, 466, 466, 466, 466, 466, 466,
+		466, 0, 0, 0, 0, 0, 0, 0, 467, 467, 467, 467, 467, 467, 467, 467,
+		467, 467, 467, 0, 0, 0, 0, 0, 468, 468, 468, 468, 468, 468, 468, 468,
+		468, 468, 468, 0, 0, 0, 0, 0, 0, 0, 469, 469, 469, 469, 469, 469,
+		470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 471, 471, 471, 471,
+		472, 472, 472, 472, 472, 472, 472, 472, 472, 472, 0, 0, 0, 0, 0, 0,
+		473, 473, 473, 473, 473, 473, 473, 473, 473, 473, 473, 473, 473, 473, 473, 0,
+		474, 474, 474, 474, 474, 474, 474, 474, 474, 474, 0, 475, 475, 476, 0, 0,
+		474, 474, 0, 0, 0, 0, 0, 0, 477, 477, 477, 477, 477, 477, 477, 477,
+		477, 477, 477, 477, 477, 478, 478, 478, 478, 478, 478, 478, 478, 478, 478, 477,
+		479, 479, 479, 479, 479, 479, 479, 479, 479, 479, 479, 479, 479, 479, 480, 480,
+		480, 480, 480, 480, 480, 480, 480, 480, 480, 481, 481, 481, 481, 482, 482, 482,
+		482, 482, 0, 0, 0, 0, 0, 0, 483, 483, 483, 483, 483, 483, 483, 483,
+		483, 483, 484, 484, 484, 484, 485, 485, 485, 485, 0, 0, 0, 0, 0, 0,
+		486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 487, 487, 487,
+		487, 487, 487, 487, 0, 0, 0, 0, 488, 488, 488, 488, 488, 488, 488, 488,
+		488, 488, 488, 488, 488, 488, 488, 0, 489, 490, 489, 491, 491, 491, 491, 491,
+		491, 491, 491, 491, 491, 491, 491, 491, 490, 490, 490, 490, 490, 490, 490, 490,
+		490, 490, 490, 490, 490, 490, 492, 493, 493, 493, 493, 493, 493, 493, 0, 0,
+		0, 0, 494, 494, 494, 494, 494, 494, 494, 494, 494, 494, 494, 494, 494, 494,
+		494, 494, 494, 494, 494, 494, 495, 495, 495, 495, 495, 495, 495, 495, 495, 495,
+		492, 491, 491, 490, 490, 491, 0, 0, 0, 0, 0, 0, 0, 0, 0, 492,
+		496, 496, 497, 498, 498, 498, 498, 498, 498, 498, 498, 498, 498, 498, 498, 498,
+		497, 497, 497, 499, 499, 499, 499, 497, 497, 496, 496, 500, 500, 501, 500, 500,
+		500, 500, 499, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 501, 0, 0,
+		502, 502, 502, 502, 502, 502, 502, 502, 502, 0, 0, 0, 0, 0, 0, 0,
+		503, 503, 503, 503, 503, 503, 503, 503, 503, 503, 0, 0, 0, 0, 0, 0,
+		504, 504, 504, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505,
+		505, 505, 505, 505, 505, 505, 505, 504, 504, 504, 504, 504, 506, 504, 504, 504,
+		504, 504, 504, 507, 507, 0, 508, 508, 508, 508, 508, 508, 508, 508, 508, 508,
+		509, 509, 509, 509, 505, 506, 506, 505, 510, 510, 510, 510, 510, 510, 510, 510,
+		510, 510, 510, 511, 512, 512, 510, 0, 513, 513, 514, 515, 515, 515, 515, 515,
+		515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 514, 514, 514, 513, 513,
+		513, 513, 513, 513, 513, 513, 513, 514, 516, 515, 515, 515, 515, 517, 517, 517,
+		517, 518, 518, 518, 518, 517, 514, 513, 519, 519, 519, 519, 519, 519, 519, 519,
+		519, 519, 515, 517, 515, 517, 517, 517, 0, 520, 520, 520, 520, 520, 520, 520,
+		520, 520, 520, 520, 520, 520, 520, 520, 520, 520, 520, 520, 520, 0, 0, 0,
+		521, 521, 521, 521, 521, 521, 521, 521, 521, 521, 0, 521, 521, 521, 521, 521,
+		521, 521, 521, 521, 522, 522, 522, 523, 523, 523, 522, 522, 523, 524, 525, 523,
+		526, 526, 526, 526, 526, 526, 523, 0, 527, 527, 527, 527, 527, 527, 527, 0,
+		527, 0, 527, 527, 527, 527, 0, 527, 527, 527, 527, 527, 527, 527, 527, 527,
+		527, 527, 527, 527, 527, 527, 0, 527, 527, 528, 0, 0, 0, 0, 0, 0,
+		529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 530,
+		531, 531, 531, 530, 530, 530, 530, 530, 530, 532, 532, 0, 0, 0, 0, 0,
+		533, 533, 533, 533, 533, 533, 533, 533, 533, 533, 0, 0, 0, 0, 0, 0,
+		534, 534, 535, 535, 0, 536, 536, 536, 536, 536, 536, 536, 536, 0, 0, 536,
+		536, 0, 0, 536, 536, 536, 536, 536, 536, 536, 536, 536, 536, 536, 536, 536,
+		536, 0, 536, 536, 536, 536, 536, 536, 536, 0, 536, 536, 0, 536, 536, 536,
+		536, 536, 0, 26, 537, 536, 535, 535, 534, 535, 535, 535, 535, 0, 0, 535,
+		535, 0, 0, 535, 535, 538, 0, 0, 536, 0, 0, 0, 0, 0, 0, 535,
+		0, 0, 0, 0, 0, 536, 536, 536, 536, 536, 535, 535, 0, 0, 537, 537,
+		537, 537, 537, 537, 537, 0, 0, 0, 539, 539, 539, 539, 539, 539, 539, 539,
+		539, 539, 539, 539, 539, 540, 540, 540, 541, 541, 541, 541, 541, 541, 541, 541,
+		540, 540, 542, 541, 541, 540, 542, 539, 539, 539, 539, 543, 543, 543, 543, 543,
+		544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 543, 543, 0, 543, 542, 539,
+		539, 539, 0, 0, 0, 0, 0, 0, 545, 545, 545, 545, 545, 545, 545, 545,
+		546, 546, 546, 547, 547, 547, 547, 547, 547, 546, 547, 546, 546, 546, 546, 547,
+		547, 546, 548, 548, 545, 545, 549, 545, 550, 550, 550, 550, 550, 550, 550, 550,
+		550, 550, 0, 0, 0, 0, 0, 0, 551, 551, 551, 551, 551, 551, 551, 551,
+		551, 551, 551, 551, 551, 551, 551, 552, 552, 552, 553, 553, 553, 553, 0, 0,
+		552, 552, 552, 552, 553, 553, 552, 554, 554, 555, 555, 555, 555, 555, 555, 555,
+		555, 555, 555, 555, 555, 555, 555, 555, 551, 551, 551, 551, 553, 553, 0, 0,
+		556, 556, 556, 556, 556, 556, 556, 556, 557, 557, 557, 558, 558, 558, 558, 558,
+		558, 558, 558, 557, 557, 558, 557, 559, 558, 560, 560, 560, 556, 0, 0, 0,
+		561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 0, 0, 0, 0, 0, 0,
+		226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 0, 0, 0,
+		562, 562, 562, 562, 562, 562, 562, 562, 562, 562, 562, 563, 564, 563, 564, 564,
+		563, 563, 563, 563, 563, 563, 565, 566, 562, 567, 0, 0, 0, 0, 0, 0,
+		568, 568, 568, 568, 568, 568, 568, 568, 568, 568, 0, 0, 0, 0, 0, 0,
+		569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 0, 0, 570, 570, 570,
+		571, 571, 570, 570, 570, 570, 571, 570, 570, 570, 570, 572, 0, 0, 0, 0,
+		573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 574, 574, 575, 575, 575, 576,
+		569, 569, 569, 569, 569, 569, 569, 0, 577, 577, 577, 577, 577, 577, 577, 577,
+		577, 577, 577, 577, 578, 578, 578, 579, 579, 579, 579, 579, 579, 579, 579, 579,
+		578, 580, 580, 581, 0, 0, 0, 0, 582, 582, 582, 582, 582, 582, 582, 582,
+		583, 583, 583, 583, 583, 583, 583, 583, 584, 584, 584, 584, 584, 584, 584, 584,
+		584, 584, 585, 585, 585, 585, 585, 585, 585, 585, 585, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 586, 587, 587, 587, 587, 587, 587, 587, 0,
+		0, 587, 0, 0, 587, 587, 587, 587, 587, 587, 587, 587, 0, 587, 587, 0,
+		587, 587, 587, 587, 587, 587, 587, 587, 588, 588, 588, 588, 588, 588, 0, 588,
+		588, 0, 0, 589, 589, 590, 591, 587, 588, 587, 588, 591, 592, 592, 592, 0,
+		593, 593, 593, 593, 593, 593, 593, 593, 593, 593, 0, 0, 0, 0, 0, 0,
+		594, 594, 594, 594, 594, 594, 594, 594, 0, 0, 594, 594, 594, 594, 594, 594,
+		594, 595, 595, 595, 596, 596, 596, 596, 0, 0, 596, 596, 595, 595, 595, 595,
+		597, 594, 598, 594, 595, 0, 0, 0, 599, 600, 600, 600, 600, 600, 600, 600,
+		600, 600, 600, 599, 599, 599, 599, 599, 599, 599, 599, 599, 599, 599, 599, 599,
+		599, 599, 599, 601, 601, 600, 600, 600, 600, 602, 599, 600, 600, 600, 600, 603,
+		603, 603, 603, 603, 603, 603, 603, 601, 604, 605, 605, 605, 605, 605, 605, 606,
+		606, 605, 605, 605, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604,
+		604, 604, 605, 605, 605, 605, 605, 605, 605, 605, 605, 605, 605, 605, 605, 606,
+		607, 607, 608, 608, 608, 604, 608, 608, 608, 608, 608, 0, 0, 0, 0, 0,
+		609, 609, 609, 609, 609, 609, 609, 609, 609, 0, 0, 0, 0, 0, 0, 0,
+		610, 610, 610, 610, 610, 610, 610, 610, 610, 0, 610, 610, 610, 610, 610, 610,
+		610, 610, 610, 610, 610, 610, 610, 611, 612, 612, 612, 612, 612, 612, 612, 0,
+		612, 612, 612, 612, 612, 612, 611, 613, 610, 614, 614, 614, 614, 614, 0, 0,
+		615, 615, 615, 615, 615, 615, 615, 615, 615, 615, 616, 616, 616, 616, 616, 616,
+		616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 0, 0, 0,
+		617, 617, 618, 618, 618, 618, 618, 618, 618, 618, 618, 618, 618, 618, 618, 618,
+		0, 0, 619, 619, 619, 619, 619, 619, 619, 619, 619, 619, 619, 619, 619, 619,
+		0, 620, 619, 619, 619, 619, 619, 619, 619, 620, 619, 619, 620, 619, 619, 0,
+		621, 621, 621, 621, 621, 621, 621, 0, 621, 621, 0, 621, 621, 621, 621, 621,
+		621, 621, 621, 621, 621, 621, 621, 621, 621, 622, 622, 622, 622, 622, 622, 0,
+		0, 0, 622, 0, 622, 622, 0, 622, 622, 622, 623, 622, 623, 623, 621, 622,
+		624, 624, 624, 624, 624, 624, 624, 624, 624, 624, 0, 0, 0, 0, 0, 0,
+		625, 625, 625, 625, 625, 625, 0, 625, 625, 0, 625, 625, 625, 625, 625, 625,
+		625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 626, 626, 626, 626, 626, 0,
+		627, 627, 0, 626, 626, 627, 626, 628, 625, 0, 0, 0, 0, 0, 0, 0,
+		629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 0, 0, 0, 0, 0, 0,
+		630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 631, 631, 632, 632, 633,
+		633, 0, 0, 0, 0, 0, 0, 0, 328, 0, 0, 0, 0, 0, 0, 0,
+		126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 127, 127, 127,
+		127, 127, 127, 127, 127, 128, 128, 128, 128, 127, 127, 127, 127, 127, 127, 127,
+		127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 634, 635, 635, 635, 635, 635, 635, 635, 635,
+		635, 635, 0, 0, 0, 0, 0, 0, 636, 636, 636, 636, 636, 636, 636, 636,
+		636, 636, 636, 636, 636, 636, 636, 0, 637, 637, 637, 637, 637, 0, 0, 0,
+		635, 635, 635, 635, 0, 0, 0, 0, 638, 638, 638, 638, 638, 638, 638, 638,
+		638, 639, 639, 0, 0, 0, 0, 0, 640, 640, 640, 640, 640, 640, 640, 640,
+		640, 640, 640, 640, 640, 640, 640, 0, 641, 641, 641, 641, 641, 641, 641, 641,
+		641, 0, 0, 0, 0, 0, 0, 0, 642, 642, 642, 642, 642, 642, 642, 642,
+		642, 642, 642, 642, 642, 642, 642, 0, 337, 0, 0, 0, 0, 0, 0, 0,
+		643, 643, 643, 643, 643, 643, 643, 643, 643, 643, 643, 643, 643, 643, 643, 0,
+		644, 644, 644, 644, 644, 644, 644, 644, 644, 644, 0, 0, 0, 0, 645, 645,
+		646, 646, 646, 646, 646, 646, 646, 646, 646, 646, 646, 646, 646, 646, 646, 0,
+		647, 647, 647, 647, 647, 647, 647, 647, 647, 647, 0, 0, 0, 0, 0, 0,
+		648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 0, 0,
+		649, 649, 649, 649, 649, 650, 0, 0, 651, 651, 651, 651, 651, 651, 651, 651,
+		652, 652, 652, 652, 652, 652, 652, 653, 653, 653, 653, 653, 654, 654, 654, 654,
+		655, 655, 655, 655, 653, 654, 0, 0, 656, 656, 656, 656, 656, 656, 656, 656,
+		656, 656, 0, 657, 657, 657, 657, 657, 657, 657, 0, 651, 651, 651, 651, 651,
+		0, 0, 0, 0, 0, 651, 651, 651, 658, 658, 658, 658, 658, 658, 658, 658,
+		659, 659, 659, 659, 659, 659, 659, 659, 660, 660, 660, 660, 660, 660, 660, 660,
+		660, 660, 660, 660, 660, 660, 660, 661, 661, 661, 661, 0, 0, 0, 0, 0,
+		662, 662, 662, 662, 662, 662, 662, 662, 662, 662, 662, 0, 0, 0, 0, 663,
+		662, 664, 664, 664, 664, 664, 664, 664, 664, 664, 664, 664, 664, 664, 664, 664,
+		0, 0, 0, 0, 0, 0, 0, 663, 663, 663, 663, 665, 665, 665, 665, 665,
+		665, 665, 665, 665, 665, 665, 665, 665, 666, 667, 668, 313, 669, 0, 0, 0,
+		670, 670, 0, 0, 0, 0, 0, 0, 671, 671, 671, 671, 671, 671, 671, 671,
+		672, 672, 672, 672, 672, 672, 672, 672, 672, 672, 672, 672, 672, 672, 0, 0,
+		671, 0, 0, 0, 0, 0, 0, 0, 319, 319, 319, 319, 0, 319, 319, 319,
+		319, 319, 319, 319, 0, 319, 319, 0, 318, 316, 316, 316, 316, 316, 316, 316,
+		318, 318, 318, 0, 0, 0, 0, 0, 316, 316, 316, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 318, 318, 318, 318, 673, 673, 673, 673, 673, 673, 673, 673,
+		673, 673, 673, 673, 0, 0, 0, 0, 674, 674, 674, 674, 674, 674, 674, 674,
+		674, 674, 674, 0, 0, 0, 0, 0, 674, 674, 674, 674, 674, 0, 0, 0,
+		674, 0, 0, 0, 0, 0, 0, 0, 674, 674, 0, 0, 675, 676, 677, 678,
+		18, 18, 18, 18, 0, 0, 0, 0, 26, 26, 26, 26, 26, 26, 0, 0,
+		26, 26, 26, 26, 26, 26, 26, 0, 15, 15, 15, 15, 15, 15, 0, 0,
+		0, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 290, 290, 26,
+		26, 26, 15, 15, 15, 290, 290, 290, 290, 290, 290, 18, 18, 18, 18, 18,
+		18, 18, 18, 26, 26, 26, 26, 26, 26, 26, 26, 15, 15, 26, 26, 26,
+		26, 26, 26, 26, 15, 15, 15, 15, 15, 15, 26, 26, 26, 26, 15, 15,
+		396, 396, 679, 679, 679, 396, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0,
+		297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 20, 20, 20, 20, 20, 20,
+		20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 297, 297, 297, 297,
+		297, 297, 297, 297, 297, 297, 20, 20, 20, 20, 20, 20, 20, 0, 20, 20,
+		20, 20, 20, 20, 297, 0, 297, 297, 0, 0, 297, 0, 0, 297, 297, 0,
+		0, 297, 297, 297, 297, 0, 297, 297, 20, 20, 0, 20, 0, 20, 20, 20,
+		20, 20, 20, 20, 0, 20, 20, 20, 20, 20, 20, 20, 297, 297, 0, 297,
+		297, 297, 297, 0, 0, 297, 297, 297, 297, 297, 297, 297, 297, 0, 297, 297,
+		297, 297, 297, 297, 297, 0, 20, 20, 297, 297, 0, 297, 297, 297, 297, 0,
+		297, 297, 297, 297, 297, 0, 297, 0, 0, 0, 297, 297, 297, 297, 297, 297,
+		297, 0, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 0,
+		297, 8, 20, 20, 20, 20, 20, 20, 20, 20, 20, 8, 20, 20, 20, 20,
+		20, 20, 297, 297, 297, 297, 297, 297, 297, 297, 297, 8, 20, 20, 20, 20,
+		20, 20, 20, 20, 20, 8, 20, 20, 297, 297, 297, 297, 297, 8, 20, 20,
+		20, 20, 20, 20, 20, 20, 20, 8, 20, 20, 20, 20, 20, 20, 297, 297,
+		297, 297, 297, 297, 297, 297, 297, 8, 20, 8, 20, 20, 20, 20, 20, 20,
+		20, 20, 297, 20, 0, 0, 10, 10, 680, 680, 680, 680, 680, 680, 680, 680,
+		681, 681, 681, 681, 681, 681, 681, 681, 681, 681, 681, 681, 681, 681, 681, 680,
+		680, 680, 680, 681, 681, 681, 681, 681, 681, 681, 681, 681, 681, 680, 680, 680,
+		680, 680, 680, 680, 680, 681, 680, 680, 680, 680, 680, 680, 681, 680, 680, 682,
+		682, 682, 682, 682, 0, 0, 0, 0, 0, 0, 0, 681, 681, 681, 681, 681,
+		0, 681, 681, 681, 681, 681, 681, 681, 14, 14, 16, 14, 14, 14, 14, 14,
+		683, 683, 683, 683, 683, 683, 683, 0, 683, 683, 683, 683, 683, 683, 683, 683,
+		683, 0, 0, 683, 683, 683, 683, 683, 683, 683, 0, 683, 683, 0, 683, 683,
+		683, 683, 683, 0, 0, 0, 0, 0, 684, 684, 684, 684, 684, 684, 684, 684,
+		684, 684, 684, 684, 684, 0, 0, 0, 685, 685, 685, 685, 685, 685, 685, 686,
+		686, 686, 686, 686, 686, 686, 0, 0, 687, 687, 687, 687, 687, 687, 687, 687,
+		687, 687, 0, 0, 0, 0, 684, 688, 689, 689, 689, 689, 689, 689, 689, 689,
+		689, 689, 689, 689, 689, 689, 690, 0, 691, 691, 691, 691, 691, 691, 691, 691,
+		691, 691, 691, 691, 692, 692, 692, 692, 693, 693, 693, 693, 693, 693, 693, 693,
+		693, 693, 0, 0, 0, 0, 0, 694, 189, 189, 189, 189, 0, 189, 189, 0,
+		695, 695, 695, 695, 695, 695, 695, 695, 695, 695, 695, 695, 695, 0, 0, 696,
+		696, 696, 696, 696, 696, 696, 696, 696, 697, 697, 697, 697, 697, 697, 697, 0,
+		698, 698, 698, 698, 698, 698, 698, 698, 698, 698, 699, 699, 699, 699, 699, 699,
+		699, 699, 699, 699, 699, 699, 699, 699, 699, 699, 699, 699, 700, 700, 700, 701,
+		700, 700, 700, 702, 0, 0, 0, 0, 703, 703, 703, 703, 703, 703, 703, 703,
+		703, 703, 0, 0, 0, 0, 704, 704, 0, 19, 19, 19, 19, 19, 19, 19,
+		19, 19, 19, 19, 15, 19, 19, 19, 5, 19, 19, 19, 19, 0, 0, 0,
+		19, 19, 19, 19, 19, 19, 15, 19, 19, 19, 19, 19, 19, 19, 0, 0,
+		58, 58, 58, 58, 0, 58, 58, 58, 0, 58, 58, 0, 58, 0, 0, 58,
+		0, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 0, 58, 58, 58, 58,
+		0, 58, 0, 58, 0, 0, 0, 0, 0, 0, 58, 0, 0, 0, 0, 58,
+		0, 58, 0, 58, 0, 58, 58, 58, 0, 58, 0, 58, 0, 58, 0, 58,
+		0, 58, 58, 58, 58, 0, 58, 0, 58, 58, 0, 58, 58, 58, 58, 58,
+		58, 58, 58, 58, 0, 0, 0, 0, 0, 58, 58, 58, 0, 58, 58, 58,
+		53, 53, 0, 0, 0, 0, 0, 0, 19, 19, 19, 19, 19, 15, 15, 15,
+		299, 299, 15, 15, 15, 15, 15, 15, 0, 0, 0, 0, 0, 0, 15, 15,
+		705, 15, 15, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0,
+		15, 15, 0, 0, 0, 0, 0, 0, 15, 15, 15, 12, 12, 12, 12, 12,
+		0, 0, 0, 0, 0, 15, 15, 15, 15, 15, 15, 0, 15, 15, 15, 15,
+		10, 10, 0, 0, 0, 0, 0, 0, 323, 0, 0, 0, 0, 0, 0, 0,
+		323, 323, 323, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0,
+		391, 391, 391, 391, 391, 391, 0, 0,
+	};
+
+	/// The distinct records.
+	inline static constexpr record RECORDS[706] = {
+		{general_category::UNASSIGNED, script_code::UNKNOWN, 0},
+		{general_category::CONTROL, script_code::COMMON, 0},
+		{general_category::CONTROL, script_code::COMMON, WHITE_SPACE},
+		{general_category::SPACE_SEPARATOR, script_code::COMMON, WHITE_SPACE},
+		{general_category::OTHER_PUNCTUATION, script_code::COMMON, 0},
+		{general_category::CURRENCY_SYMBOL, script_code::COMMON, 0},
+		{general_category::OPEN_PUNCTUATION, script_code::COMMON, 0},
+		{general_category::CLOSE_PUNCTUATION, script_code::COMMON, 0},
+		{general_category::MATH_SYMBOL, script_code::COMMON, 0},
+		{general_category::DASH_PUNCTUATION, script_code::COMMON, 0},
+		{general_category::DECIMAL_NUMBER, script_code::COMMON, NUMERIC},
+		{general_category::UPPERCASE_LETTER, script_code::LATIN, ALPHABETIC},
+		{general_category::MODIFIER_SYMBOL, script_code::COMMON, 0},
+		{general_category::CONNECTOR_PUNCTUATION, script_code::COMMON, 0},
+		{general_category::LOWERCASE_LETTER, script_code::LATIN, ALPHABETIC},
+		{general_category::OTHER_SYMBOL, script_code::COMMON, 0},
+		{general_category::OTHER_LETTER, script_code::LATIN, ALPHABETIC},
+		{general_category::INITIAL_PUNCTUATION, script_code::COMMON, 0},
+		{general_category::FORMAT, script_code::COMMON, 0},
+		{general_category::OTHER_NUMBER, script_code::COMMON, NUMERIC},
+		{general_category::LOWERCASE_LETTER, script_code::COMMON, ALPHABETIC},
+		{general_category::FINAL_PUNCTUATION, script_code::COMMON, 0},
+		{general_category::TITLECASE_LETTER, script_code::LATIN, ALPHABETIC},
+		{general_category::MODIFIER_LETTER, script_code::LATIN, ALPHABETIC},
+		{general_category::MODIFIER_LETTER, script_code::COMMON, ALPHABETIC},
+		{general_category::MODIFIER_SYMBOL, script_code::BOPOMOFO, 0},
+		{general_category::NONSPACING_MARK, script_code::INHERITED, 0},
+		{general_category::NONSPACING_MARK, script_code::INHERITED, ALPHABETIC},
+		{general_category::UPPERCASE_LETTER, script_code::GREEK, ALPHABETIC},
+		{general_category::LOWERCASE_LETTER, script_code::GREEK, ALPHABETIC},
+		{general_category::MODIFIER_SYMBOL, script_code::GREEK, 0},
+		{general_category::MODIFIER_LETTER, script_code::GREEK, ALPHABETIC},
+		{general_category::UPPERCASE_LETTER, script_code::COPTIC, ALPHABETIC},
+		{general_category::LOWERCASE_LETTER, script_code::COPTIC, ALPHABETIC},
+		{general_category::MATH_SYMBOL, script_code::GREEK, 0},
+		{general_category::UPPERCASE_LETTER, script_code::CYRILLIC, ALPHABETIC},
+		{general_category::LOWERCASE_LETTER, script_code::CYRILLIC, ALPHABETIC},
+		{general_category::OTHER_SYMBOL, script_code::CYRILLIC, 0},
+		{general_category::NONSPACING_MARK, script_code::CYRILLIC, 0},
+		{general_category::ENCLOSING_MARK, script_code::CYRILLIC, 0},
+		{general_category::UPPERCASE_LETTER, script_code::ARMENIAN, ALPHABETIC},
+		{general_category::MODIFIER_LETTER, script_code::ARMENIAN, ALPHABETIC},
+		{general_category::OTHER_PUNCTUATION, script_code::ARMENIAN, 0},
+		{general_category::LOWERCASE_LETTER, script_code::ARMENIAN, ALPHABETIC},
+		{general_category::DASH_PUNCTUATION, script_code::ARMENIAN, 0},
+		{general_category::OTHER_SYMBOL, script_code::ARMENIAN, 0},
+		{general_category::CURRENCY_SYMBOL, script_code::ARMENIAN, 0},
+		{general_category::NONSPACING_MARK, script_code::HEBREW, 0},
+		{general_category::NONSPACING_MARK, script_code::HEBREW, ALPHABETIC},
+		{general_category::DASH_PUNCTUATION, script_code::HEBREW, 0},
+		{general_category::OTHER_PUNCTUATION, script_code::HEBREW, 0},
+		{general_category::OTHER_LETTER, script_code::HEBREW, ALPHABETIC},
+		{general_category::FORMAT, script_code::ARABIC, 0},
+		{general_category::MATH_SYMBOL, script_code::ARABIC, 0},
+		{general_category::OTHER_PUNCTUATION, script_code::ARABIC, 0},
+		{general_category::CURRENCY_SYMBOL, script_code::ARABIC, 0},
+		{general_category::OTHER_SYMBOL, script_code::ARABIC, 0},
+		{general_category::NONSPACING_MARK, script_code::ARABIC, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::ARABIC, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::ARABIC, 0},
+		{general_category::DECIMAL_NUMBER, script_code::ARABIC, NUMERIC},
+		{general_category::MODIFIER_LETTER, script_code::ARABIC, ALPHABETIC},
+		{general_category::OTHER_PUNCTUATION, script_code::SYRIAC, 0},
+		{general_category::FORMAT, script_code::SYRIAC, 0},
+		{general_category::OTHER_LETTER, script_code::SYRIAC, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::SYRIAC, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::SYRIAC, 0},
+		{general_category::OTHER_LETTER, script_code::THAANA, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::THAANA, ALPHABETIC},
+		{general_category::DECIMAL_NUMBER, script_code::NKO, NUMERIC},
+		{general_category::OTHER_LETTER, script_code::NKO, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::NKO, 0},
+		{general_category::MODIFIER_LETTER, script_code::NKO, ALPHABETIC},
+		{general_category::OTHER_SYMBOL, script_code::NKO, 0},
+		{general_category::OTHER_PUNCTUATION, script_code::NKO, 0},
+		{general_category::CURRENCY_SYMBOL, script_code::NKO, 0},
+		{general_category::OTHER_LETTER, script_code::SAMARITAN, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::SAMARITAN, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::SAMARITAN, 0},
+		{general_category::MODIFIER_LETTER, script_code::SAMARITAN, ALPHABETIC},
+		{general_category::OTHER_PUNCTUATION, script_code::SAMARITAN, 0},
+		{general_category::OTHER_LETTER, script_code::MANDAIC, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::MANDAIC, 0},
+		{general_category::OTHER_PUNCTUATION, script_code::MANDAIC, 0},
+		{general_category::MODIFIER_SYMBOL, script_code::ARABIC, 0},
+		{general_category::NONSPACING_MARK, script_code::DEVANAGARI, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::DEVANAGARI, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::DEVANAGARI, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::DEVANAGARI, 0},
+		{general_category::DECIMAL_NUMBER, script_code::DEVANAGARI, NUMERIC},
+		{general_category::OTHER_PUNCTUATION, script_code::DEVANAGARI, 0},
+		{general_category::MODIFIER_LETTER, script_code::DEVANAGARI, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::BENGALI, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::BENGALI, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::BENGALI, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::BENGALI, 0},
+		{general_category::DECIMAL_NUMBER, script_code::BENGALI, NUMERIC},
+		{general_category::CURRENCY_SYMBOL, script_code::BENGALI, 0},
+		{general_category::OTHER_NUMBER, script_code::BENGALI, NUMERIC},
+		{general_category::OTHER_SYMBOL, script_code::BENGALI, 0},
+		{general_category::OTHER_PUNCTUATION, script_code::BENGALI, 0},
+		{general_category::NONSPACING_MARK, script_code::GURMUKHI, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::GURMUKHI, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::GURMUKHI, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::GURMUKHI, 0},
+		{general_category::DECIMAL_NUMBER, script_code::GURMUKHI, NUMERIC},
+		{general_category::OTHER_PUNCTUATION, script_code::GURMUKHI, 0},
+		{general_category::NONSPACING_MARK, script_code::GUJARATI, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::GUJARATI, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::GUJARATI, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::GUJARATI, 0},
+		{general_category::DECIMAL_NUMBER, script_code::GUJARATI, NUMERIC},
+		{general_category::OTHER_PUNCTUATION, script_code::GUJARATI, 0},
+		{general_category::CURRENCY_SYMBOL, script_code::GUJARATI, 0},
+		{general_category::NONSPACING_MARK, script_code::ORIYA, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::ORIYA, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::ORIYA, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::ORIYA, 0},
+		{general_category::DECIMAL_NUMBER, script_code::ORIYA, NUMERIC},
+		{general_category::OTHER_SYMBOL, script_code::ORIYA, 0},
+		{general_category::OTHER_NUMBER, script_code::ORIYA, NUMERIC},
+		{general_category::NONSPACING_MARK, script_code::TAMIL, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::TAMIL, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::TAMIL, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::TAMIL, 0},
+		{general_category::DECIMAL_NUMBER, script_code::TAMIL, NUMERIC},
+		{general_category::OTHER_NUMBER, script_code::TAMIL, NUMERIC},
+		{general_category::OTHER_SYMBOL, script_code::TAMIL, 0},
+		{general_category::CURRENCY_SYMBOL, script_code::TAMIL, 0},
+		{general_category::NONSPACING_MARK, script_code::TELUGU, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::TELUGU, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::TELUGU, 0},
+		{general_category::OTHER_LETTER, script_code::TELUGU, ALPHABETIC},
+		{general_category::DECIMAL_NUMBER, script_code::TELUGU, NUMERIC},
+		{general_category::OTHER_PUNCTUATION, script_code::TELUGU, 0},
+		{general_category::OTHER_NUMBER, script_code::TELUGU, NUMERIC},
+		{general_category::OTHER_SYMBOL, script_code::TELUGU, 0},
+		{general_category::OTHER_LETTER, script_code::KANNADA, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::KANNADA, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::KANNADA, ALPHABETIC},
+		{general_category::OTHER_PUNCTUATION, script_code::KANNADA, 0},
+		{general_category::NONSPACING_MARK, script_code::KANNADA, 0},
+		{general_category::DECIMAL_NUMBER, script_code::KANNADA, NUMERIC},
+		{general_category::NONSPACING_MARK, script_code::MALAYALAM, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::MALAYALAM, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::MALAYALAM, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::MALAYALAM, 0},
+		{general_category::OTHER_SYMBOL, script_code::MALAYALAM, 0},
+		{general_category::OTHER_NUMBER, script_code::MALAYALAM, NUMERIC},
+		{general_category::DECIMAL_NUMBER, script_code::MALAYALAM, NUMERIC},
+		{general_category::NONSPACING_MARK, script_code::SINHALA, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::SINHALA, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::SINHALA, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::SINHALA, 0},
+		{general_category::DECIMAL_NUMBER, script_code::SINHALA, NUMERIC},
+		{general_category::OTHER_PUNCTUATION, script_code::SINHALA, 0},
+		{general_category::OTHER_LETTER, script_code::THAI, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::THAI, ALPHABETIC},
+		{general_category::MODIFIER_LETTER, script_code::THAI, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::THAI, 0},
+		{general_category::OTHER_PUNCTUATION, script_code::THAI, 0},
+		{general_category::DECIMAL_NUMBER, script_code::THAI, NUMERIC},
+		{general_category::OTHER_LETTER, script_code::LAO, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::LAO, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::LAO, 0},
+		{general_category::MODIFIER_LETTER, script_code::LAO, ALPHABETIC},
+		{general_category::DECIMAL_NUMBER, script_code::LAO, NUMERIC},
+		{general_category::OTHER_LETTER, script_code::TIBETAN, ALPHABETIC},
+		{general_category::OTHER_SYMBOL, script_code::TIBETAN, 0},
+		{general_category::OTHER_PUNCTUATION, script_code::TIBETAN, 0},
+		{general_category::NONSPACING_MARK, script_code::TIBETAN, 0},
+		{general_category::DECIMAL_NUMBER, script_code::TIBETAN, NUMERIC},
+		{general_category::OTHER_NUMBER, script_code::TIBETAN, NUMERIC},
+		{general_category::OPEN_PUNCTUATION, script_code::TIBETAN, 0},
+		{general_category::CLOSE_PUNCTUATION, script_code::TIBETAN, 0},
+		{general_category::SPACING_MARK, script_code::TIBETAN, 0},
+		{general_category::NONSPACING_MARK, script_code::TIBETAN, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::TIBETAN, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::MYANMAR, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::MYANMAR, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::MYANMAR, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::MYANMAR, 0},
+		{general_category::DECIMAL_NUMBER, script_code::MYANMAR, NUMERIC},
+		{general_category::OTHER_PUNCTUATION, script_code::MYANMAR, 0},
+		{general_category::OTHER_SYMBOL, script_code::MYANMAR, 0},
+		{general_category::UPPERCASE_LETTER, script_code::GEORGIAN, ALPHABETIC},
+		{general_category::LOWERCASE_LETTER, script_code::GEORGIAN, ALPHABETIC},
+		{general_category::MODIFIER_LETTER, script_code::GEORGIAN, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::HANGUL, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::ETHIOPIC, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::ETHIOPIC, 0},
+		{general_category::OTHER_PUNCTUATION, script_code::ETHIOPIC, 0},
+		{general_category::OTHER_NUMBER, script_code::ETHIOPIC, NUMERIC},
+		{general_category::OTHER_SYMBOL, script_code::ETHIOPIC, 0},
+		{general_category::UPPERCASE_LETTER, script_code::CHEROKEE, ALPHABETIC},
+		{general_category::LOWERCASE_LETTER, script_code::CHEROKEE, ALPHABETIC},
+		{general_category::DASH_PUNCTUATION, script_code::CANADIAN_ABORIGINAL, 0},
+		{general_category::OTHER_LETTER, script_code::CANADIAN_ABORIGINAL, ALPHABETIC},
+		{general_category::OTHER_SYMBOL, script_code::CANADIAN_ABORIGINAL, 0},
+		{general_category::OTHER_PUNCTUATION, script_code::CANADIAN_ABORIGINAL, 0},
+		{general_category::SPACE_SEPARATOR, script_code::OGHAM, WHITE_SPACE},
+		{general_category::OTHER_LETTER, script_code::OGHAM, ALPHABETIC},
+		{general_category::OPEN_PUNCTUATION, script_code::OGHAM, 0},
+		{general_category::CLOSE_PUNCTUATION, script_code::OGHAM, 0},
+		{general_category::OTHER_LETTER, script_code::RUNIC, ALPHABETIC},
+		{general_category::LETTER_NUMBER, script_code::RUNIC, ALPHABETIC | NUMERIC},
+		{general_category::OTHER_LETTER, script_code::TAGALOG, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::TAGALOG, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::TAGALOG, 0},
+		{general_category::SPACING_MARK, script_code::TAGALOG, 0},
+		{general_category::OTHER_LETTER, script_code::HANUNOO, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::HANUNOO, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::HANUNOO, 0},
+		{general_category::OTHER_LETTER, script_code::BUHID, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::BUHID, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::TAGBANWA, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::TAGBANWA, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::KHMER, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::KHMER, 0},
+		{general_category::SPACING_MARK, script_code::KHMER, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::KHMER, ALPHABETIC},
+		{general_category::OTHER_PUNCTUATION, script_code::KHMER, 0},
+		{general_category::MODIFIER_LETTER, script_code::KHMER, ALPHABETIC},
+		{general_category::CURRENCY_SYMBOL, script_code::KHMER, 0},
+		{general_category::DECIMAL_NUMBER, script_code::KHMER, NUMERIC},
+		{general_category::OTHER_NUMBER, script_code::KHMER, NUMERIC},
+		{general_category::OTHER_PUNCTUATION, script_code::MONGOLIAN, 0},
+		{general_category::DASH_PUNCTUATION, script_code::MONGOLIAN, 0},
+		{general_category::NONSPACING_MARK, script_code::MONGOLIAN, 0},
+		{general_category::FORMAT, script_code::MONGOLIAN, 0},
+		{general_category::DECIMAL_NUMBER, script_code::MONGOLIAN, NUMERIC},
+		{general_category::OTHER_LETTER, script_code::MONGOLIAN, ALPHABETIC},
+		{general_category::MODIFIER_LETTER, script_code::MONGOLIAN, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::MONGOLIAN, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::LIMBU, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::LIMBU, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::LIMBU, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::LIMBU, 0},
+		{general_category::OTHER_SYMBOL, script_code::LIMBU, 0},
+		{general_category::OTHER_PUNCTUATION, script_code::LIMBU, 0},
+		{general_category::DECIMAL_NUMBER, script_code::LIMBU, NUMERIC},
+		{general_category::OTHER_LETTER, script_code::TAI_LE, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::NEW_TAI_LUE, ALPHABETIC},
+		{general_category::DECIMAL_NUMBER, script_code::NEW_TAI_LUE, NUMERIC},
+		{general_category::OTHER_NUMBER, script_code::NEW_TAI_LUE, NUMERIC},
+		{general_category::OTHER_SYMBOL, script_code::NEW_TAI_LUE, 0},
+		{general_category::OTHER_SYMBOL, script_code::KHMER, 0},
+		{general_category::OTHER_LETTER, script_code::BUGINESE, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::BUGINESE, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::BUGINESE, ALPHABETIC},
+		{general_category::OTHER_PUNCTUATION, script_code::BUGINESE, 0},
+		{general_category::OTHER_LETTER, script_code::TAI_THAM, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::TAI_THAM, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::TAI_THAM, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::TAI_THAM, 0},
+		{general_category::DECIMAL_NUMBER, script_code::TAI_THAM, NUMERIC},
+		{general_category::OTHER_PUNCTUATION, script_code::TAI_THAM, 0},
+		{general_category::MODIFIER_LETTER, script_code::TAI_THAM, ALPHABETIC},
+		{general_category::ENCLOSING_MARK, script_code::INHERITED, 0},
+		{general_category::NONSPACING_MARK, script_code::BALINESE, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::BALINESE, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::BALINESE, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::BALINESE, 0},
+		{general_category::SPACING_MARK, script_code::BALINESE, 0},
+		{general_category::DECIMAL_NUMBER, script_code::BALINESE, NUMERIC},
+		{general_category::OTHER_PUNCTUATION, script_code::BALINESE, 0},
+		{general_category::OTHER_SYMBOL, script_code::BALINESE, 0},
+		{general_category::NONSPACING_MARK, script_code::SUNDANESE, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::SUNDANESE, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::SUNDANESE, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::SUNDANESE, 0},
+		{general_category::NONSPACING_MARK, script_code::SUNDANESE, 0},
+		{general_category::DECIMAL_NUMBER, script_code::SUNDANESE, NUMERIC},
+		{general_category::OTHER_LETTER, script_code::BATAK, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::BATAK, 0},
+		{general_category::SPACING_MARK, script_code::BATAK, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::BATAK, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::BATAK, 0},
+		{general_category::OTHER_PUNCTUATION, script_code::BATAK, 0},
+		{general_category::OTHER_LETTER, script_code::LEPCHA, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::LEPCHA, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::LEPCHA, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::LEPCHA, 0},
+		{general_category::OTHER_PUNCTUATION, script_code::LEPCHA, 0},
+		{general_category::DECIMAL_NUMBER, script_code::LEPCHA, NUMERIC},
+		{general_category::DECIMAL_NUMBER, script_code::OL_CHIKI, NUMERIC},
+		{general_category::OTHER_LETTER, script_code::OL_CHIKI, ALPHABETIC},
+		{general_category::MODIFIER_LETTER, script_code::OL_CHIKI, ALPHABETIC},
+		{general_category::OTHER_PUNCTUATION, script_code::OL_CHIKI, 0},
+		{general_category::OTHER_PUNCTUATION, script_code::SUNDANESE, 0},
+		{general_category::SPACING_MARK, script_code::COMMON, 0},
+		{general_category::OTHER_LETTER, script_code::COMMON, ALPHABETIC},
+		{general_category::MODIFIER_LETTER, script_code::CYRILLIC, ALPHABETIC},
+		{general_category::TITLECASE_LETTER, script_code::GREEK, ALPHABETIC},
+		{general_category::FORMAT, script_code::INHERITED, 0},
+		{general_category::LINE_SEPARATOR, script_code::COMMON, WHITE_SPACE},
+		{general_category::PARAGRAPH_SEPARATOR, script_code::COMMON, WHITE_SPACE},
+		{general_category::UPPERCASE_LETTER, script_code::COMMON, ALPHABETIC},
+		{general_category::LETTER_NUMBER, script_code::LATIN, ALPHABETIC | NUMERIC},
+		{general_category::OTHER_SYMBOL, script_code::COMMON, ALPHABETIC},
+		{general_category::OTHER_SYMBOL, script_code::BRAILLE, 0},
+		{general_category::UPPERCASE_LETTER, script_code::GLAGOLITIC, ALPHABETIC},
+		{general_category::LOWERCASE_LETTER, script_code::GLAGOLITIC, ALPHABETIC},
+		{general_category::OTHER_SYMBOL, script_code::COPTIC, 0},
+		{general_category::NONSPACING_MARK, script_code::COPTIC, 0},
+		{general_category::OTHER_PUNCTUATION, script_code::COPTIC, 0},
+		{general_category::OTHER_NUMBER, script_code::COPTIC, NUMERIC},
+		{general_category::OTHER_LETTER, script_code::TIFINAGH, ALPHABETIC},
+		{general_category::MODIFIER_LETTER, script_code::TIFINAGH, ALPHABETIC},
+		{general_category::OTHER_PUNCTUATION, script_code::TIFINAGH, 0},
+		{general_category::NONSPACING_MARK, script_code::TIFINAGH, 0},
+		{general_category::NONSPACING_MARK, script_code::CYRILLIC, ALPHABETIC},
+		{general_category::OTHER_SYMBOL, script_code::HAN, 0},
+		{general_category::MODIFIER_LETTER, script_code::HAN, ALPHABETIC},
+		{general_category::LETTER_NUMBER, script_code::HAN, ALPHABETIC | NUMERIC},
+		{general_category::SPACING_MARK, script_code::HANGUL, 0},
+		{general_category::OTHER_LETTER, script_code::HIRAGANA, ALPHABETIC},
+		{general_category::MODIFIER_LETTER, script_code::HIRAGANA, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::KATAKANA, ALPHABETIC},
+		{general_category::MODIFIER_LETTER, script_code::KATAKANA, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::BOPOMOFO, ALPHABETIC},
+		{general_category::OTHER_SYMBOL, script_code::HANGUL, 0},
+		{general_category::OTHER_SYMBOL, script_code::KATAKANA, 0},
+		{general_category::OTHER_LETTER, script_code::HAN, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::HAN, ALPHABETIC | NUMERIC},
+		{general_category::OTHER_LETTER, script_code::YI, ALPHABETIC},
+		{general_category::MODIFIER_LETTER, script_code::YI, ALPHABETIC},
+		{general_category::OTHER_SYMBOL, script_code::YI, 0},
+		{general_category::OTHER_LETTER, script_code::LISU, ALPHABETIC},
+		{general_category::MODIFIER_LETTER, script_code::LISU, ALPHABETIC},
+		{general_category::OTHER_PUNCTUATION, script_code::LISU, 0},
+		{general_category::OTHER_LETTER, script_code::VAI, ALPHABETIC},
+		{general_category::MODIFIER_LETTER, script_code::VAI, ALPHABETIC},
+		{general_category::OTHER_PUNCTUATION, script_code::VAI, 0},
+		{general_category::DECIMAL_NUMBER, script_code::VAI, NUMERIC},
+		{general_category::OTHER_LETTER, script_code::CYRILLIC, ALPHABETIC},
+		{general_category::OTHER_PUNCTUATION, script_code::CYRILLIC, 0},
+		{general_category::OTHER_LETTER, script_code::BAMUM, ALPHABETIC},
+		{general_category::LETTER_NUMBER, script_code::BAMUM, ALPHABETIC | NUMERIC},
+		{general_category::NONSPACING_MARK, script_code::BAMUM, 0},
+		{general_category::OTHER_PUNCTUATION, script_code::BAMUM, 0},
+		{general_category::OTHER_LETTER, script_code::SYLOTI_NAGRI, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::SYLOTI_NAGRI, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::SYLOTI_NAGRI, 0},
+		{general_category::SPACING_MARK, script_code::SYLOTI_NAGRI, ALPHABETIC},
+		{general_category::OTHER_SYMBOL, script_code::SYLOTI_NAGRI, 0},
+		{general_category::OTHER_LETTER, script_code::PHAGS_PA, ALPHABETIC},
+		{general_category::OTHER_PUNCTUATION, script_code::PHAGS_PA, 0},
+		{general_category::SPACING_MARK, script_code::SAURASHTRA, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::SAURASHTRA, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::SAURASHTRA, 0},
+		{general_category::NONSPACING_MARK, script_code::SAURASHTRA, ALPHABETIC},
+		{general_category::OTHER_PUNCTUATION, script_code::SAURASHTRA, 0},
+		{general_category::DECIMAL_NUMBER, script_code::SAURASHTRA, NUMERIC},
+		{general_category::DECIMAL_NUMBER, script_code::KAYAH_LI, NUMERIC},
+		{general_category::OTHER_LETTER, script_code::KAYAH_LI, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::KAYAH_LI, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::KAYAH_LI, 0},
+		{general_category::OTHER_PUNCTUATION, script_code::KAYAH_LI, 0},
+		{general_category::OTHER_LETTER, script_code::REJANG, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::REJANG, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::REJANG, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::REJANG, 0},
+		{general_category::OTHER_PUNCTUATION, script_code::REJANG, 0},
+		{general_category::NONSPACING_MARK, script_code::JAVANESE, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::JAVANESE, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::JAVANESE, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::JAVANESE, 0},
+		{general_category::SPACING_MARK, script_code::JAVANESE, 0},
+		{general_category::OTHER_PUNCTUATION, script_code::JAVANESE, 0},
+		{general_category::DECIMAL_NUMBER, script_code::JAVANESE, NUMERIC},
+		{general_category::MODIFIER_LETTER, script_code::MYANMAR, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::CHAM, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::CHAM, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::CHAM, ALPHABETIC},
+		{general_category::DECIMAL_NUMBER, script_code::CHAM, NUMERIC},
+		{general_category::OTHER_PUNCTUATION, script_code::CHAM, 0},
+		{general_category::OTHER_LETTER, script_code::TAI_VIET, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::TAI_VIET, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::TAI_VIET, 0},
+		{general_category::MODIFIER_LETTER, script_code::TAI_VIET, ALPHABETIC},
+		{general_category::OTHER_PUNCTUATION, script_code::TAI_VIET, 0},
+		{general_category::OTHER_LETTER, script_code::MEETEI_MAYEK, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::MEETEI_MAYEK, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::MEETEI_MAYEK, ALPHABETIC},
+		{general_category::OTHER_PUNCTUATION, script_code::MEETEI_MAYEK, 0},
+		{general_category::MODIFIER_LETTER, script_code::MEETEI_MAYEK, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::MEETEI_MAYEK, 0},
+		{general_category::SPACING_MARK, script_code::MEETEI_MAYEK, 0},
+		{general_category::DECIMAL_NUMBER, script_code::MEETEI_MAYEK, NUMERIC},
+		{general_category::SURROGATE, script_code::UNKNOWN, 0},
+		{general_category::PRIVATE_USE, script_code::UNKNOWN, 0},
+		{general_category::MATH_SYMBOL, script_code::HEBREW, 0},
+		{general_category::OTHER_LETTER, script_code::LINEAR_B, ALPHABETIC},
+		{general_category::LETTER_NUMBER, script_code::GREEK, ALPHABETIC | NUMERIC},
+		{general_category::OTHER_NUMBER, script_code::GREEK, NUMERIC},
+		{general_category::OTHER_SYMBOL, script_code::GREEK, 0},
+		{general_category::OTHER_LETTER, script_code::LYCIAN, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::CARIAN, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::OLD_ITALIC, ALPHABETIC},
+		{general_category::OTHER_NUMBER, script_code::OLD_ITALIC, NUMERIC},
+		{general_category::OTHER_LETTER, script_code::GOTHIC, ALPHABETIC},
+		{general_category::LETTER_NUMBER, script_code::GOTHIC, ALPHABETIC | NUMERIC},
+		{general_category::OTHER_LETTER, script_code::OLD_PERMIC, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::OLD_PERMIC, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::UGARITIC, ALPHABETIC},
+		{general_category::OTHER_PUNCTUATION, script_code::UGARITIC, 0},
+		{general_category::OTHER_LETTER, script_code::OLD_PERSIAN, ALPHABETIC},
+		{general_category::OTHER_PUNCTUATION, script_code::OLD_PERSIAN, 0},
+		{general_category::LETTER_NUMBER, script_code::OLD_PERSIAN, ALPHABETIC | NUMERIC},
+		{general_category::UPPERCASE_LETTER, script_code::DESERET, ALPHABETIC},
+		{general_category::LOWERCASE_LETTER, script_code::DESERET, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::SHAVIAN, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::OSMANYA, ALPHABETIC},
+		{general_category::DECIMAL_NUMBER, script_code::OSMANYA, NUMERIC},
+		{general_category::UPPERCASE_LETTER, script_code::OSAGE, ALPHABETIC},
+		{general_category::LOWERCASE_LETTER, script_code::OSAGE, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::ELBASAN, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::CAUCASIAN_ALBANIAN, ALPHABETIC},
+		{general_category::OTHER_PUNCTUATION, script_code::CAUCASIAN_ALBANIAN, 0},
+		{general_category::UPPERCASE_LETTER, script_code::VITHKUQI, ALPHABETIC},
+		{general_category::LOWERCASE_LETTER, script_code::VITHKUQI, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::LINEAR_A, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::CYPRIOT, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::IMPERIAL_ARAMAIC, ALPHABETIC},
+		{general_category::OTHER_PUNCTUATION, script_code::IMPERIAL_ARAMAIC, 0},
+		{general_category::OTHER_NUMBER, script_code::IMPERIAL_ARAMAIC, NUMERIC},
+		{general_category::OTHER_LETTER, script_code::PALMYRENE, ALPHABETIC},
+		{general_category::OTHER_SYMBOL, script_code::PALMYRENE, 0},
+		{general_category::OTHER_NUMBER, script_code::PALMYRENE, NUMERIC},
+		{general_category::OTHER_LETTER, script_code::NABATAEAN, ALPHABETIC},
+		{general_category::OTHER_NUMBER, script_code::NABATAEAN, NUMERIC},
+		{general_category::OTHER_LETTER, script_code::HATRAN, ALPHABETIC},
+		{general_category::OTHER_NUMBER, script_code::HATRAN, NUMERIC},
+		{general_category::OTHER_LETTER, script_code::PHOENICIAN, ALPHABETIC},
+		{general_category::OTHER_NUMBER, script_code::PHOENICIAN, NUMERIC},
+		{general_category::OTHER_PUNCTUATION, script_code::PHOENICIAN, 0},
+		{general_category::OTHER_LETTER, script_code::LYDIAN, ALPHABETIC},
+		{general_category::OTHER_PUNCTUATION, script_code::LYDIAN, 0},
+		{general_category::OTHER_LETTER, script_code::MEROITIC_HIEROGLYPHS, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::MEROITIC_CURSIVE, ALPHABETIC},
+		{general_category::OTHER_NUMBER, script_code::MEROITIC_CURSIVE, NUMERIC},
+		{general_category::OTHER_LETTER, script_code::KHAROSHTHI, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::KHAROSHTHI, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::KHAROSHTHI, 0},
+		{general_category::OTHER_NUMBER, script_code::KHAROSHTHI, NUMERIC},
+		{general_category::OTHER_PUNCTUATION, script_code::KHAROSHTHI, 0},
+		{general_category::OTHER_LETTER, script_code::OLD_SOUTH_ARABIAN, ALPHABETIC},
+		{general_category::OTHER_NUMBER, script_code::OLD_SOUTH_ARABIAN, NUMERIC},
+		{general_category::OTHER_PUNCTUATION, script_code::OLD_SOUTH_ARABIAN, 0},
+		{general_category::OTHER_LETTER, script_code::OLD_NORTH_ARABIAN, ALPHABETIC},
+		{general_category::OTHER_NUMBER, script_code::OLD_NORTH_ARABIAN, NUMERIC},
+		{general_category::OTHER_LETTER, script_code::MANICHAEAN, ALPHABETIC},
+		{general_category::OTHER_SYMBOL, script_code::MANICHAEAN, 0},
+		{general_category::NONSPACING_MARK, script_code::MANICHAEAN, 0},
+		{general_category::OTHER_NUMBER, script_code::MANICHAEAN, NUMERIC},
+		{general_category::OTHER_PUNCTUATION, script_code::MANICHAEAN, 0},
+		{general_category::OTHER_LETTER, script_code::AVESTAN, ALPHABETIC},
+		{general_category::OTHER_PUNCTUATION, script_code::AVESTAN, 0},
+		{general_category::OTHER_LETTER, script_code::INSCRIPTIONAL_PARTHIAN, ALPHABETIC},
+		{general_category::OTHER_NUMBER, script_code::INSCRIPTIONAL_PARTHIAN, NUMERIC},
+		{general_category::OTHER_LETTER, script_code::INSCRIPTIONAL_PAHLAVI, ALPHABETIC},
+		{general_category::OTHER_NUMBER, script_code::INSCRIPTIONAL_PAHLAVI, NUMERIC},
+		{general_category::OTHER_LETTER, script_code::PSALTER_PAHLAVI, ALPHABETIC},
+		{general_category::OTHER_PUNCTUATION, script_code::PSALTER_PAHLAVI, 0},
+		{general_category::OTHER_NUMBER, script_code::PSALTER_PAHLAVI, NUMERIC},
+		{general_category::OTHER_LETTER, script_code::OLD_TURKIC, ALPHABETIC},
+		{general_category::UPPERCASE_LETTER, script_code::OLD_HUNGARIAN, ALPHABETIC},
+		{general_category::LOWERCASE_LETTER, script_code::OLD_HUNGARIAN, ALPHABETIC},
+		{general_category::OTHER_NUMBER, script_code::OLD_HUNGARIAN, NUMERIC},
+		{general_category::OTHER_LETTER, script_code::HANIFI_ROHINGYA, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::HANIFI_ROHINGYA, ALPHABETIC},
+		{general_category::DECIMAL_NUMBER, script_code::HANIFI_ROHINGYA, NUMERIC},
+		{general_category::OTHER_NUMBER, script_code::ARABIC, NUMERIC},
+		{general_category::OTHER_LETTER, script_code::YEZIDI, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::YEZIDI, ALPHABETIC},
+		{general_category::DASH_PUNCTUATION, script_code::YEZIDI, 0},
+		{general_category::OTHER_LETTER, script_code::OLD_SOGDIAN, ALPHABETIC},
+		{general_category::OTHER_NUMBER, script_code::OLD_SOGDIAN, NUMERIC},
+		{general_category::OTHER_LETTER, script_code::SOGDIAN, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::SOGDIAN, 0},
+		{general_category::OTHER_NUMBER, script_code::SOGDIAN, NUMERIC},
+		{general_category::OTHER_PUNCTUATION, script_code::SOGDIAN, 0},
+		{general_category::OTHER_LETTER, script_code::OLD_UYGHUR, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::OLD_UYGHUR, 0},
+		{general_category::OTHER_PUNCTUATION, script_code::OLD_UYGHUR, 0},
+		{general_category::OTHER_LETTER, script_code::CHORASMIAN, ALPHABETIC},
+		{general_category::OTHER_NUMBER, script_code::CHORASMIAN, NUMERIC},
+		{general_category::OTHER_LETTER, script_code::ELYMAIC, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::BRAHMI, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::BRAHMI, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::BRAHMI, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::BRAHMI, 0},
+		{general_category::OTHER_PUNCTUATION, script_code::BRAHMI, 0},
+		{general_category::OTHER_NUMBER, script_code::BRAHMI, NUMERIC},
+		{general_category::DECIMAL_NUMBER, script_code::BRAHMI, NUMERIC},
+		{general_category::NONSPACING_MARK, script_code::KAITHI, 0},
+		{general_category::SPACING_MARK, script_code::KAITHI, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::KAITHI, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::KAITHI, ALPHABETIC},
+		{general_category::OTHER_PUNCTUATION, script_code::KAITHI, 0},
+		{general_category::FORMAT, script_code::KAITHI, 0},
+		{general_category::OTHER_LETTER, script_code::SORA_SOMPENG, ALPHABETIC},
+		{general_category::DECIMAL_NUMBER, script_code::SORA_SOMPENG, NUMERIC},
+		{general_category::NONSPACING_MARK, script_code::CHAKMA, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::CHAKMA, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::CHAKMA, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::CHAKMA, 0},
+		{general_category::DECIMAL_NUMBER, script_code::CHAKMA, NUMERIC},
+		{general_category::OTHER_PUNCTUATION, script_code::CHAKMA, 0},
+		{general_category::OTHER_LETTER, script_code::MAHAJANI, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::MAHAJANI, 0},
+		{general_category::OTHER_PUNCTUATION, script_code::MAHAJANI, 0},
+		{general_category::NONSPACING_MARK, script_code::SHARADA, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::SHARADA, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::SHARADA, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::SHARADA, 0},
+		{general_category::OTHER_PUNCTUATION, script_code::SHARADA, 0},
+		{general_category::NONSPACING_MARK, script_code::SHARADA, 0},
+		{general_category::DECIMAL_NUMBER, script_code::SHARADA, NUMERIC},
+		{general_category::OTHER_NUMBER, script_code::SINHALA, NUMERIC},
+		{general_category::OTHER_LETTER, script_code::KHOJKI, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::KHOJKI, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::KHOJKI, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::KHOJKI, 0},
+		{general_category::NONSPACING_MARK, script_code::KHOJKI, 0},
+		{general_category::OTHER_PUNCTUATION, script_code::KHOJKI, 0},
+		{general_category::OTHER_LETTER, script_code::MULTANI, ALPHABETIC},
+		{general_category::OTHER_PUNCTUATION, script_code::MULTANI, 0},
+		{general_category::OTHER_LETTER, script_code::KHUDAWADI, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::KHUDAWADI, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::KHUDAWADI, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::KHUDAWADI, 0},
+		{general_category::DECIMAL_NUMBER, script_code::KHUDAWADI, NUMERIC},
+		{general_category::NONSPACING_MARK, script_code::GRANTHA, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::GRANTHA, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::GRANTHA, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::GRANTHA, 0},
+		{general_category::SPACING_MARK, script_code::GRANTHA, 0},
+		{general_category::OTHER_LETTER, script_code::NEWA, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::NEWA, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::NEWA, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::NEWA, 0},
+		{general_category::OTHER_PUNCTUATION, script_code::NEWA, 0},
+		{general_category::DECIMAL_NUMBER, script_code::NEWA, NUMERIC},
+		{general_category::OTHER_LETTER, script_code::TIRHUTA, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::TIRHUTA, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::TIRHUTA, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::TIRHUTA, 0},
+		{general_category::OTHER_PUNCTUATION, script_code::TIRHUTA, 0},
+		{general_category::DECIMAL_NUMBER, script_code::TIRHUTA, NUMERIC},
+		{general_category::OTHER_LETTER, script_code::SIDDHAM, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::SIDDHAM, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::SIDDHAM, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::SIDDHAM, 0},
+		{general_category::OTHER_PUNCTUATION, script_code::SIDDHAM, 0},
+		{general_category::OTHER_LETTER, script_code::MODI, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::MODI, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::MODI, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::MODI, 0},
+		{general_category::OTHER_PUNCTUATION, script_code::MODI, 0},
+		{general_category::DECIMAL_NUMBER, script_code::MODI, NUMERIC},
+		{general_category::OTHER_LETTER, script_code::TAKRI, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::TAKRI, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::TAKRI, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::TAKRI, 0},
+		{general_category::NONSPACING_MARK, script_code::TAKRI, 0},
+		{general_category::OTHER_PUNCTUATION, script_code::TAKRI, 0},
+		{general_category::DECIMAL_NUMBER, script_code::TAKRI, NUMERIC},
+		{general_category::OTHER_LETTER, script_code::AHOM, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::AHOM, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::AHOM, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::AHOM, 0},
+		{general_category::DECIMAL_NUMBER, script_code::AHOM, NUMERIC},
+		{general_category::OTHER_NUMBER, script_code::AHOM, NUMERIC},
+		{general_category::OTHER_PUNCTUATION, script_code::AHOM, 0},
+		{general_category::OTHER_SYMBOL, script_code::AHOM, 0},
+		{general_category::OTHER_LETTER, script_code::DOGRA, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::DOGRA, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::DOGRA, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::DOGRA, 0},
+		{general_category::OTHER_PUNCTUATION, script_code::DOGRA, 0},
+		{general_category::UPPERCASE_LETTER, script_code::WARANG_CITI, ALPHABETIC},
+		{general_category::LOWERCASE_LETTER, script_code::WARANG_CITI, ALPHABETIC},
+		{general_category::DECIMAL_NUMBER, script_code::WARANG_CITI, NUMERIC},
+		{general_category::OTHER_NUMBER, script_code::WARANG_CITI, NUMERIC},
+		{general_category::OTHER_LETTER, script_code::WARANG_CITI, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::DIVES_AKURU, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::DIVES_AKURU, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::DIVES_AKURU, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::DIVES_AKURU, 0},
+		{general_category::NONSPACING_MARK, script_code::DIVES_AKURU, 0},
+		{general_category::OTHER_PUNCTUATION, script_code::DIVES_AKURU, 0},
+		{general_category::DECIMAL_NUMBER, script_code::DIVES_AKURU, NUMERIC},
+		{general_category::OTHER_LETTER, script_code::NANDINAGARI, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::NANDINAGARI, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::NANDINAGARI, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::NANDINAGARI, 0},
+		{general_category::OTHER_PUNCTUATION, script_code::NANDINAGARI, 0},
+		{general_category::OTHER_LETTER, script_code::ZANABAZAR_SQUARE, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::ZANABAZAR_SQUARE, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::ZANABAZAR_SQUARE, 0},
+		{general_category::SPACING_MARK, script_code::ZANABAZAR_SQUARE, ALPHABETIC},
+		{general_category::OTHER_PUNCTUATION, script_code::ZANABAZAR_SQUARE, 0},
+		{general_category::OTHER_LETTER, script_code::SOYOMBO, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::SOYOMBO, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::SOYOMBO, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::SOYOMBO, 0},
+		{general_category::OTHER_PUNCTUATION, script_code::SOYOMBO, 0},
+		{general_category::OTHER_LETTER, script_code::PAU_CIN_HAU, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::BHAIKSUKI, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::BHAIKSUKI, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::BHAIKSUKI, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::BHAIKSUKI, 0},
+		{general_category::OTHER_PUNCTUATION, script_code::BHAIKSUKI, 0},
+		{general_category::DECIMAL_NUMBER, script_code::BHAIKSUKI, NUMERIC},
+		{general_category::OTHER_NUMBER, script_code::BHAIKSUKI, NUMERIC},
+		{general_category::OTHER_PUNCTUATION, script_code::MARCHEN, 0},
+		{general_category::OTHER_LETTER, script_code::MARCHEN, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::MARCHEN, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::MARCHEN, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::MASARAM_GONDI, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::MASARAM_GONDI, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::MASARAM_GONDI, 0},
+		{general_category::DECIMAL_NUMBER, script_code::MASARAM_GONDI, NUMERIC},
+		{general_category::OTHER_LETTER, script_code::GUNJALA_GONDI, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::GUNJALA_GONDI, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::GUNJALA_GONDI, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::GUNJALA_GONDI, 0},
+		{general_category::DECIMAL_NUMBER, script_code::GUNJALA_GONDI, NUMERIC},
+		{general_category::OTHER_LETTER, script_code::MAKASAR, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::MAKASAR, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::MAKASAR, ALPHABETIC},
+		{general_category::OTHER_PUNCTUATION, script_code::MAKASAR, 0},
+		{general_category::OTHER_PUNCTUATION, script_code::TAMIL, 0},
+		{general_category::OTHER_LETTER, script_code::CUNEIFORM, ALPHABETIC},
+		{general_category::LETTER_NUMBER, script_code::CUNEIFORM, ALPHABETIC | NUMERIC},
+		{general_category::OTHER_PUNCTUATION, script_code::CUNEIFORM, 0},
+		{general_category::OTHER_LETTER, script_code::CYPRO_MINOAN, ALPHABETIC},
+		{general_category::OTHER_PUNCTUATION, script_code::CYPRO_MINOAN, 0},
+		{general_category::OTHER_LETTER, script_code::EGYPTIAN_HIEROGLYPHS, ALPHABETIC},
+		{general_category::FORMAT, script_code::EGYPTIAN_HIEROGLYPHS, 0},
+		{general_category::OTHER_LETTER, script_code::ANATOLIAN_HIEROGLYPHS, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::MRO, ALPHABETIC},
+		{general_category::DECIMAL_NUMBER, script_code::MRO, NUMERIC},
+		{general_category::OTHER_PUNCTUATION, script_code::MRO, 0},
+		{general_category::OTHER_LETTER, script_code::TANGSA, ALPHABETIC},
+		{general_category::DECIMAL_NUMBER, script_code::TANGSA, NUMERIC},
+		{general_category::OTHER_LETTER, script_code::BASSA_VAH, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::BASSA_VAH, 0},
+		{general_category::OTHER_PUNCTUATION, script_code::BASSA_VAH, 0},
+		{general_category::OTHER_LETTER, script_code::PAHAWH_HMONG, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::PAHAWH_HMONG, 0},
+		{general_category::OTHER_PUNCTUATION, script_code::PAHAWH_HMONG, 0},
+		{general_category::OTHER_SYMBOL, script_code::PAHAWH_HMONG, 0},
+		{general_category::MODIFIER_LETTER, script_code::PAHAWH_HMONG, ALPHABETIC},
+		{general_category::DECIMAL_NUMBER, script_code::PAHAWH_HMONG, NUMERIC},
+		{general_category::OTHER_NUMBER, script_code::PAHAWH_HMONG, NUMERIC},
+		{general_category::UPPERCASE_LETTER, script_code::MEDEFAIDRIN, ALPHABETIC},
+		{general_category::LOWERCASE_LETTER, script_code::MEDEFAIDRIN, ALPHABETIC},
+		{general_category::OTHER_NUMBER, script_code::MEDEFAIDRIN, NUMERIC},
+		{general_category::OTHER_PUNCTUATION, script_code::MEDEFAIDRIN, 0},
+		{general_category::OTHER_LETTER, script_code::MIAO, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::MIAO, ALPHABETIC},
+		{general_category::SPACING_MARK, script_code::MIAO, ALPHABETIC},
+		{general_category::MODIFIER_LETTER, script_code::MIAO, ALPHABETIC},
+		{general_category::MODIFIER_LETTER, script_code::TANGUT, ALPHABETIC},
+		{general_category::MODIFIER_LETTER, script_code::NUSHU, ALPHABETIC},
+		{general_category::OTHER_PUNCTUATION, script_code::HAN, 0},
+		{general_category::NONSPACING_MARK, script_code::KHITAN_SMALL_SCRIPT, 0},
+		{general_category::SPACING_MARK, script_code::HAN, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::TANGUT, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::KHITAN_SMALL_SCRIPT, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::NUSHU, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::DUPLOYAN, ALPHABETIC},
+		{general_category::OTHER_SYMBOL, script_code::DUPLOYAN, 0},
+		{general_category::NONSPACING_MARK, script_code::DUPLOYAN, 0},
+		{general_category::NONSPACING_MARK, script_code::DUPLOYAN, ALPHABETIC},
+		{general_category::OTHER_PUNCTUATION, script_code::DUPLOYAN, 0},
+		{general_category::NONSPACING_MARK, script_code::GREEK, 0},
+		{general_category::OTHER_SYMBOL, script_code::SIGN_WRITING, 0},
+		{general_category::NONSPACING_MARK, script_code::SIGN_WRITING, 0},
+		{general_category::OTHER_PUNCTUATION, script_code::SIGN_WRITING, 0},
+		{general_category::NONSPACING_MARK, script_code::GLAGOLITIC, ALPHABETIC},
+		{general_category::OTHER_LETTER, script_code::NYIAKENG_PUACHUE_HMONG, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::NYIAKENG_PUACHUE_HMONG, 0},
+		{general_category::MODIFIER_LETTER, script_code::NYIAKENG_PUACHUE_HMONG, ALPHABETIC},
+		{general_category::DECIMAL_NUMBER, script_code::NYIAKENG_PUACHUE_HMONG, NUMERIC},
+		{general_category::OTHER_SYMBOL, script_code::NYIAKENG_PUACHUE_HMONG, 0},
+		{general_category::OTHER_LETTER, script_code::TOTO, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::TOTO, 0},
+		{general_category::OTHER_LETTER, script_code::WANCHO, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::WANCHO, 0},
+		{general_category::DECIMAL_NUMBER, script_code::WANCHO, NUMERIC},
+		{general_category::CURRENCY_SYMBOL, script_code::WANCHO, 0},
+		{general_category::OTHER_LETTER, script_code::MENDE_KIKAKUI, ALPHABETIC},
+		{general_category::OTHER_NUMBER, script_code::MENDE_KIKAKUI, NUMERIC},
+		{general_category::NONSPACING_MARK, script_code::MENDE_KIKAKUI, 0},
+		{general_category::UPPERCASE_LETTER, script_code::ADLAM, ALPHABETIC},
+		{general_category::LOWERCASE_LETTER, script_code::ADLAM, ALPHABETIC},
+		{general_category::NONSPACING_MARK, script_code::ADLAM, 0},
+		{general_category::NONSPACING_MARK, script_code::ADLAM, ALPHABETIC},
+		{general_category::MODIFIER_LETTER, script_code::ADLAM, ALPHABETIC},
+		{general_category::DECIMAL_NUMBER, script_code::ADLAM, NUMERIC},
+		{general_category::OTHER_PUNCTUATION, script_code::ADLAM, 0},
+		{general_category::OTHER_SYMBOL, script_code::HIRAGANA, 0},
+	};
+
+	/** Looks up the record of a code point.
+	 * \param the code point
+	 * \return the record */
+	static const record& lookup(char32_t cp)
+	{
+		size_t group = cp >> GROUP_SHIFT;
+		if (group >= sizeof(STAGE1) / sizeof(STAGE1[0])) {
+			return RECORDS[0];
+		}
+		constexpr unsigned GROUP_BITS = GROUP_SHIFT - BLOCK_SHIFT;
+		size_t block = STAGE2[(STAGE1[group] << GROUP_BITS) +
+							  ((cp >> BLOCK_SHIFT) & ((1u << GROUP_BITS) - 1))];
+		size_t offset = cp & ((1u << BLOCK_SHIFT) - 1);
+		return RECORDS[STAGE3[(block << BLOCK_SHIFT) + offset]];
+	}
+};
+
+#endif  // ONESTRING_UNICODE_PROPERTY_TABLES_HPP
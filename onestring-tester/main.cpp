@@ -49,7 +49,14 @@
 #include "onestring/onestring.hpp"
 
 #include "onestring/tests/onechar_tests.hpp"
+#include "onestring/tests/onestring_collator_tests.hpp"
+#include "onestring/tests/onestring_decoder_tests.hpp"
+#include "onestring/tests/onestring_matcher_tests.hpp"
+#include "onestring/tests/onestring_regex_tests.hpp"
+#include "onestring/tests/onestring_searcher_tests.hpp"
+#include "onestring/tests/onestring_segments_tests.hpp"
 #include "onestring/tests/onestring_tests.hpp"
+#include "onestring/tests/onestring_view_tests.hpp"
 
 /** Temporary test code goes in this function ONLY.
  * All test code that is needed long term should be
@@ -163,6 +170,13 @@ int main(int argc, char* argv[])
 	GoldilocksShell* shell = new GoldilocksShell(">> ");
 	shell->register_suite<TestSuite_Onechar>("O-sB1");
 	shell->register_suite<TestSuite_Onestring>("O-sB2");
+	shell->register_suite<TestSuite_OnestringDecoder>("O-sB3");
+	shell->register_suite<TestSuite_OnestringView>("O-sB4");
+	shell->register_suite<TestSuite_OnestringSegments>("O-sB5");
+	shell->register_suite<TestSuite_OnestringCollator>("O-sB6");
+	shell->register_suite<TestSuite_OnestringMatcher>("O-sB7");
+	shell->register_suite<TestSuite_OnestringRegex>("O-sB8");
+	shell->register_suite<TestSuite_OnestringSearcher>("O-sB9");
 
 	// If we got command-line arguments.
 	if(argc > 1)
@@ -0,0 +1,1317 @@
+#!/usr/bin/env perl
+# Generates the Unicode data tables in onestring-source/include/onestring/unicode
+# from the Unicode Character Database that ships with Perl (Unicode::UCD).
+#
+# Usage (from the repository root):
+#     perl tools/generate_unicode_tables.pl
+#
+# Each table is a two-stage lookup: the code point, shifted right by
+# BLOCK_SHIFT, indexes STAGE1, which gives the block of STAGE2 to use. The
+# low bits index that block, which gives an index into the table's records.
+# Identical blocks are stored only once. The property table has too many
+# distinct records for that to stay small, so it has three stages instead
+# (see three_stage()).
+
+use strict;
+use warnings;
+
+use File::Basename qw(dirname);
+use File::Spec;
+use Unicode::Normalize qw(NFC NFD NFKC NFKD);
+use Unicode::UCD qw(charblock prop_invlist prop_invmap);
+
+my $ROOT = File::Spec->catdir(dirname(__FILE__), File::Spec->updir());
+my $INCLUDE = File::Spec->catdir($ROOT, 'onestring-source', 'include',
+	'onestring');
+my $OUT = File::Spec->catdir($INCLUDE, 'unicode');
+my $TESTS = File::Spec->catdir($INCLUDE, 'tests');
+my $VERSION = Unicode::UCD::UnicodeVersion();
+
+my $BLOCK_SHIFT = 7;
+my $BLOCK_SIZE = 1 << $BLOCK_SHIFT;
+
+# Returns a hash of every code point whose mapping is not itself, to the
+# list of code points it maps to.
+sub mapping_of
+{
+	my ($property) = @_;
+	my ($list, $map, $format) = prop_invmap($property);
+	die "unexpected format $format for $property" unless $format =~ /^al?$/;
+
+	my %mapping;
+	for my $i (0 .. $#$list - 1) {
+		my $value = $map->[$i];
+		next if !ref $value && $value == 0;
+		for my $cp ($list->[$i] .. $list->[$i + 1] - 1) {
+			$mapping{$cp} =
+				ref $value ? [@$value] : [$value + $cp - $list->[$i]];
+		}
+	}
+	return \%mapping;
+}
+
+# Returns a hash of every code point to its value of a property, leaving out
+# code points with the default value.
+sub values_of
+{
+	my ($property) = @_;
+	my ($list, $map, $format, $default) = prop_invmap($property);
+
+	my %values;
+	for my $i (0 .. $#$list - 1) {
+		next if $map->[$i] eq $default;
+		$values{$_} = $map->[$i] for $list->[$i] .. $list->[$i + 1] - 1;
+	}
+	return \%values;
+}
+
+# Returns a hash of every code point with a binary property.
+sub members_of
+{
+	my ($property) = @_;
+	my ($list, $map) = prop_invmap($property);
+
+	my %members;
+	for my $i (0 .. $#$list - 1) {
+		next unless $map->[$i] eq 'Y';
+		$members{$_} = 1 for $list->[$i] .. $list->[$i + 1] - 1;
+	}
+	return \%members;
+}
+
+# Splits a hash of code points to record indices into the two stages.
+# Code points missing from the hash use record 0, as do those past the end
+# of STAGE1.
+sub two_stage
+{
+	my ($index_of) = @_;
+	my ($last) = sort { $b <=> $a } keys %$index_of;
+	my $blocks = defined $last ? ($last >> $BLOCK_SHIFT) + 1 : 1;
+
+	my (@stage1, @stage2, %block_at);
+	for my $block (0 .. $blocks - 1) {
+		my @values = map { $index_of->{($block << $BLOCK_SHIFT) + $_} // 0 }
+			0 .. $BLOCK_SIZE - 1;
+		my $key = join(',', @values);
+		if (!exists $block_at{$key}) {
+			$block_at{$key} = scalar(@stage2) >> $BLOCK_SHIFT;
+			push @stage2, @values;
+		}
+		push @stage1, $block_at{$key};
+	}
+	return (\@stage1, \@stage2);
+}
+
+# Splits a hash of code points to record indices into three stages, for
+# tables with too many distinct records for two stages to stay small. The
+# code point, shifted right by GROUP_SHIFT, indexes STAGE1, which gives the
+# group of STAGE2 to use. The next bits index that group, which gives the
+# block of STAGE3 to use, and the low BLOCK_SHIFT bits index that block.
+sub three_stage
+{
+	my ($index_of, $group_shift, $block_shift) = @_;
+	my ($last) = sort { $b <=> $a } keys %$index_of;
+	my $groups = defined $last ? ($last >> $group_shift) + 1 : 1;
+	my $group_size = 1 << ($group_shift - $block_shift);
+	my $block_size = 1 << $block_shift;
+
+	my (@stage1, @stage2, @stage3, %group_at, %block_at);
+	for my $group (0 .. $groups - 1) {
+		my @blocks;
+		for my $block (0 .. $group_size - 1) {
+			my $first = ($group << $group_shift) + ($block << $block_shift);
+			my @values = map { $index_of->{$first + $_} // 0 }
+				0 .. $block_size - 1;
+			my $key = join(',', @values);
+			if (!exists $block_at{$key}) {
+				$block_at{$key} = scalar(@stage3) >> $block_shift;
+				push @stage3, @values;
+			}
+			push @blocks, $block_at{$key};
+		}
+		my $key = join(',', @blocks);
+		if (!exists $group_at{$key}) {
+			$group_at{$key} = scalar(@stage2) / $group_size;
+			push @stage2, @blocks;
+		}
+		push @stage1, $group_at{$key};
+	}
+	return (\@stage1, \@stage2, \@stage3);
+}
+
+# Returns the smallest unsigned type that holds every value.
+sub type_of
+{
+	my ($max) = sort { $b <=> $a } @_;
+	return $max < 0x100 ? 'uint8_t' : $max < 0x10000 ? 'uint16_t' : 'uint32_t';
+}
+
+# Formats a list of values as the body of an array initializer.
+sub array_body
+{
+	my ($per_line, @values) = @_;
+	my @lines;
+	while (my @row = splice(@values, 0, $per_line)) {
+		push @lines, "\t\t" . join(', ', @row) . ',';
+	}
+	return join("\n", @lines);
+}
+
+# Formats the stages of a table as C++ declarations. STAGE2 holds record
+# indices, unless a description of its values is given, in which case they
+# are written in hexadecimal.
+sub stage_declarations
+{
+	my ($stage1, $stage2, $values) = @_;
+	my $type1 = type_of(@$stage1);
+	my $type2 = type_of(@$stage2);
+	my $count1 = scalar(@$stage1);
+	my $count2 = scalar(@$stage2);
+	my $body1 = array_body(16, @$stage1);
+	my $body2 = defined $values
+		? array_body(8, map { sprintf('0x%08X', $_) } @$stage2)
+		: array_body(16, @$stage2);
+	$values //= 'The record index for each code point in a block.';
+
+	return <<"END";
+	/// The number of low code point bits that index a block of STAGE2.
+	inline static constexpr unsigned BLOCK_SHIFT = $BLOCK_SHIFT;
+
+	/// The block of STAGE2 for each block of code points.
+	inline static constexpr $type1 STAGE1[$count1] = {
+$body1
+	};
+
+	/// $values
+	inline static constexpr $type2 STAGE2[$count2] = {
+$body2
+	};
+END
+}
+
+# The C++ definition of lookup(), which finds the record of a code point.
+my $LOOKUP = <<'END';
+	/** Looks up the record of a code point.
+	 * \param the code point
+	 * \return the record */
+	static const record& lookup(char32_t cp)
+	{
+		size_t block = cp >> BLOCK_SHIFT;
+		if (block >= sizeof(STAGE1) / sizeof(STAGE1[0])) {
+			return RECORDS[0];
+		}
+		size_t offset = cp & ((1u << BLOCK_SHIFT) - 1);
+		return RECORDS[STAGE2[(STAGE1[block] << BLOCK_SHIFT) + offset]];
+	}
+END
+
+sub write_header
+{
+	my ($name, $guard, $body, $directory) = @_;
+	$directory //= $OUT;
+	my $path = File::Spec->catfile($directory, $name);
+	mkdir $directory unless -d $directory;
+
+	open(my $fh, '>', $path) or die "cannot write $path: $!";
+	print $fh <<"END";
+/** Unicode $VERSION Data Tables
+ * Version: 1.0
+ *
+ * Generated by tools/generate_unicode_tables.pl. Do not edit.
+ */
+
+#ifndef $guard
+#define $guard
+
+#include <cstddef>
+#include <cstdint>
+
+$body
+#endif  // $guard
+END
+	close($fh);
+	print "Wrote $path\n";
+}
+
+sub hex_cp
+{
+	return sprintf('0x%04X', $_[0]);
+}
+
+sub generate_case
+{
+	my $simple_lower = mapping_of('Simple_Lowercase_Mapping');
+	my $simple_upper = mapping_of('Simple_Uppercase_Mapping');
+	my $full_lower = mapping_of('Lowercase_Mapping');
+	my $full_upper = mapping_of('Uppercase_Mapping');
+	my $simple_fold = mapping_of('Simple_Case_Folding');
+	my $full_fold = mapping_of('Case_Folding');
+	my $cased = members_of('Cased');
+	my $ignorable = members_of('Case_Ignorable');
+
+	my %points;
+	$points{$_} = 1
+		for keys %$simple_lower, keys %$simple_upper, keys %$full_lower,
+		keys %$full_upper, keys %$simple_fold, keys %$full_fold, keys %$cased,
+		keys %$ignorable;
+
+	# Record 0 leaves the code point unchanged and has no properties.
+	my @records = ('0, 0, 0, 0');
+	my %record_at = ($records[0] => 0);
+	my %index_of;
+	for my $cp (sort { $a <=> $b } keys %points) {
+		my $lower = $simple_lower->{$cp} ? $simple_lower->{$cp}[0] - $cp : 0;
+		my $upper = $simple_upper->{$cp} ? $simple_upper->{$cp}[0] - $cp : 0;
+		my $fold = $simple_fold->{$cp} ? $simple_fold->{$cp}[0] - $cp : 0;
+		my @flags;
+		push @flags, 'CASED' if $cased->{$cp};
+		push @flags, 'CASE_IGNORABLE' if $ignorable->{$cp};
+		push @flags, 'FULL_LOWER'
+			if $full_lower->{$cp} && @{$full_lower->{$cp}} > 1;
+		push @flags, 'FULL_UPPER'
+			if $full_upper->{$cp} && @{$full_upper->{$cp}} > 1;
+		push @flags, 'FULL_FOLD'
+			if $full_fold->{$cp} && @{$full_fold->{$cp}} > 1;
+
+		my $record = "$lower, $upper, $fold, "
+			. (@flags ? join(' | ', @flags) : '0');
+		if (!exists $record_at{$record}) {
+			$record_at{$record} = scalar(@records);
+			push @records, $record;
+		}
+		$index_of{$cp} = $record_at{$record};
+	}
+
+	my ($stage1, $stage2) = two_stage(\%index_of);
+	my $stages = stage_declarations($stage1, $stage2);
+	my $record_count = scalar(@records);
+	my $record_body = join("\n", map { "\t\t{$_}," } @records);
+	my $lookup = $LOOKUP;
+
+	my $full_table = sub {
+		my ($mapping) = @_;
+		my @rows;
+		for my $cp (sort { $a <=> $b } keys %$mapping) {
+			my @to = @{$mapping->{$cp}};
+			next unless @to > 1;
+			push @to, 0 while @to < 3;
+			push @rows,
+				"\t\t{" . hex_cp($cp) . ', {' . join(', ', map { hex_cp($_) } @to)
+				. '}},';
+		}
+		return (scalar(@rows), join("\n", @rows));
+	};
+	my ($lower_count, $lower_body) = $full_table->($full_lower);
+	my ($upper_count, $upper_body) = $full_table->($full_upper);
+	my ($fold_count, $fold_body) = $full_table->($full_fold);
+
+	write_header('case_tables.hpp', 'ONESTRING_UNICODE_CASE_TABLES_HPP', <<"END");
+/** The Unicode case mappings and case folding, and the properties used by
+ * the mappings' conditions. */
+struct onestring_case_tables
+{
+	/// The code point has the Cased property.
+	inline static constexpr uint8_t CASED = 0x01;
+	/// The code point has the Case_Ignorable property.
+	inline static constexpr uint8_t CASE_IGNORABLE = 0x02;
+	/// The code point lowercases to more than one code point.
+	inline static constexpr uint8_t FULL_LOWER = 0x04;
+	/// The code point uppercases to more than one code point.
+	inline static constexpr uint8_t FULL_UPPER = 0x08;
+	/// The code point case folds to more than one code point.
+	inline static constexpr uint8_t FULL_FOLD = 0x10;
+
+	/** The simple mappings and case folding of a code point, as offsets,
+	 * and its flags. */
+	struct record
+	{
+		int32_t lower;
+		int32_t upper;
+		int32_t fold;
+		uint8_t flags;
+	};
+
+	/** A mapping from one code point to up to three code points.
+	 * Unused code points in the mapping are zero. */
+	struct full_mapping
+	{
+		char32_t cp;
+		char32_t mapping[3];
+	};
+
+$stages
+	/// The distinct records.
+	inline static constexpr record RECORDS[$record_count] = {
+$record_body
+	};
+
+	/// The lowercase mappings longer than one code point, by code point.
+	inline static constexpr full_mapping FULL_LOWER_MAPPINGS[$lower_count] = {
+$lower_body
+	};
+
+	/// The uppercase mappings longer than one code point, by code point.
+	inline static constexpr full_mapping FULL_UPPER_MAPPINGS[$upper_count] = {
+$upper_body
+	};
+
+	/// The case foldings longer than one code point, by code point.
+	inline static constexpr full_mapping FULL_FOLD_MAPPINGS[$fold_count] = {
+$fold_body
+	};
+
+$lookup};
+END
+}
+
+# The first Hangul syllable, and the number of them. Syllables decompose
+# and compose algorithmically, so they are left out of the tables.
+my $HANGUL_BASE = 0xAC00;
+my $HANGUL_COUNT = 11172;
+
+sub is_hangul
+{
+	return $_[0] >= $HANGUL_BASE && $_[0] < $HANGUL_BASE + $HANGUL_COUNT;
+}
+
+sub generate_normalization
+{
+	my $ccc = values_of('Canonical_Combining_Class');
+	my %quick_check = (
+		NFD => values_of('NFD_Quick_Check'),
+		NFKD => values_of('NFKD_Quick_Check'),
+		NFC => values_of('NFC_Quick_Check'),
+		NFKC => values_of('NFKC_Quick_Check'),
+	);
+	my $excluded = members_of('Full_Composition_Exclusion');
+
+	my %points;
+	$points{$_} = 1 for keys %$ccc, map { keys %$_ } values %quick_check;
+
+	# Record 0 is a starter that is already in every normalization form.
+	my @records = ('0, 0');
+	my %record_at = ($records[0] => 0);
+	my %index_of;
+	for my $cp (sort { $a <=> $b } keys %points) {
+		my @flags;
+		for my $form (qw(NFD NFKD NFC NFKC)) {
+			my $value = $quick_check{$form}{$cp} // 'Y';
+			push @flags, "${form}_NO" if $value =~ /^N/;
+			push @flags, "${form}_MAYBE" if $value =~ /^M/;
+		}
+		my $record =
+			($ccc->{$cp} // 0) . ', ' . (@flags ? join(' | ', @flags) : '0');
+		if (!exists $record_at{$record}) {
+			$record_at{$record} = scalar(@records);
+			push @records, $record;
+		}
+		$index_of{$cp} = $record_at{$record};
+	}
+
+	my ($stage1, $stage2) = two_stage(\%index_of);
+	my $stages = stage_declarations($stage1, $stage2);
+	my $record_count = scalar(@records);
+	my $record_body = join("\n", map { "\t\t{$_}," } @records);
+	my $lookup = $LOOKUP;
+
+	# Full decompositions share one array of code points.
+	my @data;
+	my $decompositions = sub {
+		my ($form, $normalize) = @_;
+		my @rows;
+		for my $cp (sort { $a <=> $b } keys %{$quick_check{$form}}) {
+			next if is_hangul($cp);
+			my @to = map { ord } split //, $normalize->(chr($cp));
+			push @rows, "\t\t{" . hex_cp($cp) . ', ' . scalar(@data) . ', '
+				. scalar(@to) . '},';
+			push @data, map { hex_cp($_) } @to;
+		}
+		return (scalar(@rows), join("\n", @rows));
+	};
+	my ($canonical_count, $canonical_body) =
+		$decompositions->('NFD', \&NFD);
+	my ($compatibility_count, $compatibility_body) =
+		$decompositions->('NFKD', \&NFKD);
+	my $data_count = scalar(@data);
+	my $data_body = array_body(8, @data);
+
+	# Primary composites are the canonical pairs not excluded from NFC.
+	my ($list, $map) = prop_invmap('Decomposition_Mapping');
+	my ($type_list, $type_map) = prop_invmap('Decomposition_Type');
+	my @pairs;
+	for my $i (0 .. $#$list - 1) {
+		next unless ref $map->[$i] && @{$map->[$i]} == 2;
+		my $cp = $list->[$i];
+		next if $excluded->{$cp};
+		my $type = $type_map->[Unicode::UCD::search_invlist($type_list, $cp)];
+		next unless $type eq 'Canonical';
+		push @pairs, [@{$map->[$i]}, $cp];
+	}
+	@pairs = sort { $a->[0] <=> $b->[0] || $a->[1] <=> $b->[1] } @pairs;
+	my $composition_count = scalar(@pairs);
+	my $composition_body = join("\n",
+		map { "\t\t{" . join(', ', map { hex_cp($_) } @$_) . '},' } @pairs);
+
+	write_header('normalization_tables.hpp',
+		'ONESTRING_UNICODE_NORMALIZATION_TABLES_HPP', <<"END");
+/** The Unicode combining classes, quick check properties, decompositions,
+ * and compositions used for normalization. */
+struct onestring_normalization_tables
+{
+	/// The code point never occurs in NFD.
+	inline static constexpr uint8_t NFD_NO = 0x01;
+	/// The code point never occurs in NFKD.
+	inline static constexpr uint8_t NFKD_NO = 0x02;
+	/// The code point never occurs in NFC.
+	inline static constexpr uint8_t NFC_NO = 0x04;
+	/// The code point may compose with the one before it in NFC.
+	inline static constexpr uint8_t NFC_MAYBE = 0x08;
+	/// The code point never occurs in NFKC.
+	inline static constexpr uint8_t NFKC_NO = 0x10;
+	/// The code point may compose with the one before it in NFKC.
+	inline static constexpr uint8_t NFKC_MAYBE = 0x20;
+
+	/** The canonical combining class of a code point, and its flags. */
+	struct record
+	{
+		uint8_t ccc;
+		uint8_t flags;
+	};
+
+	/** The full decomposition of a code point, as a range of DATA. */
+	struct decomposition
+	{
+		char32_t cp;
+		uint16_t offset;
+		uint16_t length;
+	};
+
+	/** Two code points that compose to one. */
+	struct composition
+	{
+		char32_t first;
+		char32_t second;
+		char32_t composite;
+	};
+
+$stages
+	/// The distinct records.
+	inline static constexpr record RECORDS[$record_count] = {
+$record_body
+	};
+
+	/// The code points of every decomposition.
+	inline static constexpr char32_t DATA[$data_count] = {
+$data_body
+	};
+
+	/// The full canonical decompositions, by code point, except Hangul.
+	inline static constexpr decomposition CANONICAL[$canonical_count] = {
+$canonical_body
+	};
+
+	/// The full compatibility decompositions, by code point, except Hangul.
+	inline static constexpr decomposition COMPATIBILITY[$compatibility_count] = {
+$compatibility_body
+	};
+
+	/// The primary composites, by first and then second code point,
+	/// except Hangul.
+	inline static constexpr composition COMPOSITIONS[$composition_count] = {
+$composition_body
+	};
+
+$lookup};
+END
+}
+
+# Formats a string as a UTF-32 literal.
+sub u32_literal
+{
+	my @escaped;
+	for my $cp (map { ord } split //, $_[0]) {
+		if ($cp >= 0x20 && $cp < 0x7F && $cp != 0x22 && $cp != 0x5C) {
+			push @escaped, chr($cp);
+		} elsif ($cp < 0x10000) {
+			push @escaped, sprintf('\\u%04X', $cp);
+		} else {
+			push @escaped, sprintf('\\U%08X', $cp);
+		}
+	}
+	return 'U"' . join('', @escaped) . '"';
+}
+
+# Generates conformance tests in the format of NormalizationTest.txt: for
+# each source string, its NFC, NFD, NFKC, and NFKD forms. The expected forms
+# come from Unicode::Normalize, which is independent of our tables.
+sub generate_normalization_tests
+{
+	my @sources = (
+		# Canonical ordering of combining marks
+		"\x{1E0A}\x{0323}", "\x{1E0C}\x{0307}", "\x{0044}\x{0307}\x{0323}",
+		"\x{0044}\x{0323}\x{0307}", "\x{1E0A}\x{031B}\x{0323}",
+		"\x{0061}\x{05AE}\x{0300}\x{0315}\x{0062}",
+		"\x{0061}\x{0315}\x{0300}\x{05AE}\x{0301}\x{0062}",
+		# Blocked and unblocked composition
+		"\x{0041}\x{0300}\x{0301}", "\x{0041}\x{0301}\x{0300}",
+		"\x{0041}\x{0327}\x{0301}", "\x{0065}\x{0304}\x{0300}",
+		"\x{00C5}\x{0328}", "\x{212B}\x{0328}", "\x{0041}\x{030A}\x{0328}",
+		# Composition exclusions and singletons
+		"\x{0958}", "\x{2126}", "\x{0344}", "\x{0F73}", "\x{2ADC}",
+		# Starters that compose with each other
+		"\x{0B47}\x{0B3E}", "\x{0B47}\x{0300}\x{0B3E}", "\x{09C7}\x{09BE}",
+		"\x{1100}\x{1161}", "\x{1100}\x{1161}\x{11A8}", "\x{AC00}\x{11A8}",
+		"\x{AC01}\x{11A8}", "\x{1100}\x{0300}\x{1161}", "\x{D4DB}",
+		# Compatibility decompositions
+		"\x{FB03}", "\x{1E9B}\x{0323}", "\x{FDFA}", "\x{3300}", "\x{FF76}\x{FF9E}",
+		"\x{2460}\x{00BD}", "\x{1D400}\x{2126}",
+		# Mixed text
+		"Caf\x{0065}\x{0301} cr\x{00E8}me br\x{00FB}l\x{00E9}e",
+		"\x{1F42D} \x{0041}\x{0308}\x{0304}\x{0332} \x{03D3}",
+	);
+
+	# Every code point that is not in all four forms, except that only
+	# every hundredth Hangul syllable is included.
+	my %points;
+	for my $form (qw(NFD_Quick_Check NFKD_Quick_Check NFC_Quick_Check
+		NFKC_Quick_Check))
+	{
+		$points{$_} = 1 for keys %{values_of($form)};
+	}
+	for my $cp (keys %points) {
+		delete $points{$cp}
+			if is_hangul($cp) && ($cp - $HANGUL_BASE) % 100 != 0;
+	}
+	push @sources, map { chr } sort { $a <=> $b } keys %points;
+
+	my @rows;
+	for my $source (@sources) {
+		push @rows, "\t{" . join(', ',
+			map { u32_literal($_) }
+			($source, NFC($source), NFD($source), NFKC($source),
+			NFKD($source))) . '},';
+	}
+	my $count = scalar(@rows);
+	my $body = join("\n", @rows);
+
+	write_header('normalization_test_data.hpp',
+		'ONESTRING_NORMALIZATION_TEST_DATA_HPP', <<"END", $TESTS);
+/** Normalization conformance tests: for each source string, its NFC, NFD,
+ * NFKC, and NFKD forms. Every code point not listed alone, other than a
+ * Hangul syllable, is already in all four forms. */
+static const char32_t* const NORMALIZATION_TESTS[$count][5] = {
+$body
+};
+END
+}
+
+# Formats a list of names as the body of an enum, numbered from zero.
+sub enum_body
+{
+	my @names = @_;
+	return join("\n", map { "\t\t$names[$_] = $_," } 0 .. $#names);
+}
+
+# The Grapheme_Cluster_Break values, with Extended_Pictographic (which is
+# Other for this property) as a value of its own.
+my @GRAPHEME_BREAKS = qw(Other CR LF Control Extend ZWJ Regional_Indicator
+	Prepend SpacingMark L V T LV LVT Extended_Pictographic);
+
+# The Word_Break values.
+my @WORD_BREAKS = qw(Other CR LF Newline Extend ZWJ Regional_Indicator Format
+	Katakana Hebrew_Letter ALetter Single_Quote Double_Quote MidNumLet
+	MidLetter MidNum Numeric ExtendNumLet WSegSpace);
+
+# The Sentence_Break values.
+my @SENTENCE_BREAKS = qw(Other CR LF Extend Sep Format Sp Lower Upper OLetter
+	Numeric ATerm SContinue STerm Close);
+
+# Converts a property value name to the style of a C++ constant.
+sub constant_name
+{
+	my ($name) = @_;
+	$name =~ s/([a-z])([A-Z])/$1_$2/g;
+	return uc($name);
+}
+
+# Tests whether UAX #29 puts a grapheme cluster boundary between two
+# values, by the rules that depend only on the pair (GB3 to GB9b, GB999).
+sub grapheme_pair_breaks
+{
+	my ($before, $after) = @_;
+	my %is = map { $_ => 1 } qw(CR LF Control);
+
+	return 0 if $before eq 'CR' && $after eq 'LF';    # GB3
+	return 1 if $is{$before} || $is{$after};          # GB4, GB5
+	return 0 if $before eq 'L' && $after =~ /^(L|V|LV|LVT)$/;    # GB6
+	return 0 if $before =~ /^(LV|V)$/ && $after =~ /^(V|T)$/;    # GB7
+	return 0 if $before =~ /^(LVT|T)$/ && $after eq 'T';         # GB8
+	return 0 if $after =~ /^(Extend|ZWJ|SpacingMark)$/;          # GB9, GB9a
+	return 0 if $before eq 'Prepend';                            # GB9b
+	return 1;                                                    # GB999
+}
+
+# Formats a table of pair rules: for each value before a position, a bit
+# mask with a bit set for each value after it that makes a boundary.
+sub pair_table_body
+{
+	my ($rule, @values) = @_;
+	my $digits = int((@values + 3) / 4);
+	my @rows;
+	for my $before (@values) {
+		my $mask = 0;
+		for my $i (0 .. $#values) {
+			$mask |= 1 << $i if $rule->($before, $values[$i]);
+		}
+		push @rows, sprintf("\t\t0x%0*X,  // %s", $digits, $mask, $before);
+	}
+	return join("\n", @rows);
+}
+
+# Tests whether UAX #29 forbids a word boundary between two values, by
+# the rules that depend only on the pair, after ignoring Extend, Format,
+# and ZWJ (WB5, WB7a, WB8 to WB10, WB13 to WB13b). Every other pair is a
+# boundary, unless a rule with more context applies.
+sub word_pair_breaks
+{
+	my ($before, $after) = @_;
+	my $letter = qr/^(ALetter|Hebrew_Letter)$/;
+
+	return 0 if $before =~ $letter && $after =~ $letter;          # WB5
+	return 0 if $before eq 'Hebrew_Letter' && $after eq 'Single_Quote';  # WB7a
+	return 0 if $before eq 'Numeric' && $after eq 'Numeric';      # WB8
+	return 0 if $before =~ $letter && $after eq 'Numeric';        # WB9
+	return 0 if $before eq 'Numeric' && $after =~ $letter;        # WB10
+	return 0 if $before eq 'Katakana' && $after eq 'Katakana';    # WB13
+	return 0
+		if $before =~ /^(ALetter|Hebrew_Letter|Numeric|Katakana|ExtendNumLet)$/
+		&& $after eq 'ExtendNumLet';                              # WB13a
+	return 0
+		if $before eq 'ExtendNumLet'
+		&& $after =~ /^(ALetter|Hebrew_Letter|Numeric|Katakana)$/;    # WB13b
+	return 1;
+}
+
+sub generate_breaks
+{
+	my $pictographic = members_of('Extended_Pictographic');
+	my $general = values_of('General_Category');
+
+	# Perl reports Extended_Pictographic characters as "ExtPict_XX" rather
+	# than "Other".
+	my $grapheme = values_of('Grapheme_Cluster_Break');
+	for my $cp (keys %$grapheme) {
+		die sprintf('unexpected grapheme break for U+%04X', $cp)
+			if $pictographic->{$cp} && $grapheme->{$cp} ne 'ExtPict_XX';
+		delete $grapheme->{$cp} if $grapheme->{$cp} eq 'ExtPict_XX';
+	}
+	$grapheme->{$_} = 'Extended_Pictographic' for keys %$pictographic;
+
+	# Perl also tailors Word_Break: Extended_Pictographic characters are
+	# "ExtPict_LE" (ALetter) or "ExtPict_XX" (Other), and horizontal spaces
+	# are "Perl_Tailored_HSpace". Of those, WSegSpace is the space
+	# separators without a no-break decomposition.
+	my ($type_list, $type_map) = prop_invmap('Decomposition_Type');
+	my $word = values_of('Word_Break');
+	for my $cp (keys %$word) {
+		my $value = $word->{$cp};
+		if ($value eq 'ExtPict_LE') {
+			$word->{$cp} = 'ALetter';
+		} elsif ($value eq 'ExtPict_XX') {
+			delete $word->{$cp};
+		} elsif ($value eq 'Perl_Tailored_HSpace') {
+			my $type = $type_map->[Unicode::UCD::search_invlist($type_list, $cp)];
+			if (($general->{$cp} // '') eq 'Zs' && $type ne 'noBreak') {
+				$word->{$cp} = 'WSegSpace';
+			} else {
+				delete $word->{$cp};
+			}
+		}
+	}
+
+	my $sentence = values_of('Sentence_Break');
+
+	my %is_value = map { $_ => 1 }
+		(@GRAPHEME_BREAKS, @WORD_BREAKS, @SENTENCE_BREAKS);
+	my %points;
+	$points{$_} = 1 for keys %$grapheme, keys %$word, keys %$sentence,
+		grep { $general->{$_} =~ /^[LN]/ } keys %$general;
+
+	# Record 0 is Other for every property, with no flags.
+	my @records =
+		('grapheme_break::OTHER, word_break::OTHER, sentence_break::OTHER, 0');
+	my %record_at = ($records[0] => 0);
+	my %index_of;
+	for my $cp (sort { $a <=> $b } keys %points) {
+		my @values = map { $_->{$cp} // 'Other' } ($grapheme, $word, $sentence);
+		for my $value (@values) {
+			die "unknown break value $value" unless $is_value{$value};
+		}
+		my @flags;
+		push @flags, 'EXTENDED_PICTOGRAPHIC' if $pictographic->{$cp};
+		push @flags, 'WORD_LIKE' if ($general->{$cp} // '') =~ /^[LN]/;
+
+		my $record = join(', ',
+			'grapheme_break::' . constant_name($values[0]),
+			'word_break::' . constant_name($values[1]),
+			'sentence_break::' . constant_name($values[2]),
+			@flags ? join(' | ', @flags) : '0');
+		if (!exists $record_at{$record}) {
+			$record_at{$record} = scalar(@records);
+			push @records, $record;
+		}
+		$index_of{$cp} = $record_at{$record};
+	}
+
+	my ($stage1, $stage2) = two_stage(\%index_of);
+	my $stages = stage_declarations($stage1, $stage2);
+	my $record_count = scalar(@records);
+	my $record_body = join("\n", map { "\t\t{$_}," } @records);
+	my $lookup = $LOOKUP;
+	my $grapheme_count = scalar(@GRAPHEME_BREAKS);
+	my $grapheme_body = enum_body(map { constant_name($_) } @GRAPHEME_BREAKS);
+	my $grapheme_pairs =
+		pair_table_body(\&grapheme_pair_breaks, @GRAPHEME_BREAKS);
+	my $word_count = scalar(@WORD_BREAKS);
+	my $word_body = enum_body(map { constant_name($_) } @WORD_BREAKS);
+	my $word_pairs = pair_table_body(\&word_pair_breaks, @WORD_BREAKS);
+	my $sentence_count = scalar(@SENTENCE_BREAKS);
+	my $sentence_body = enum_body(map { constant_name($_) } @SENTENCE_BREAKS);
+
+	write_header('break_tables.hpp', 'ONESTRING_UNICODE_BREAK_TABLES_HPP',
+		<<"END");
+/** The Unicode properties used to find text boundaries (UAX #29). */
+struct onestring_break_tables
+{
+	/** The Grapheme_Cluster_Break property, with Extended_Pictographic. */
+	enum class grapheme_break : uint8_t {
+$grapheme_body
+	};
+
+	/// The number of grapheme_break values.
+	inline static constexpr size_t GRAPHEME_BREAKS = $grapheme_count;
+
+	/// For each grapheme_break value, a bit mask of the values after it
+	/// that begin a new grapheme cluster, by the rules that depend only on
+	/// the pair. Emoji sequences and regional indicators (GB11 to GB13)
+	/// need more context, and are left to the caller.
+	inline static constexpr uint16_t GRAPHEME_PAIRS[$grapheme_count] = {
+$grapheme_pairs
+	};
+
+	/** The Word_Break property. */
+	enum class word_break : uint8_t {
+$word_body
+	};
+
+	/// The number of word_break values.
+	inline static constexpr size_t WORD_BREAKS = $word_count;
+
+	/// For each word_break value, a bit mask of the values after it that
+	/// begin a new word, by the rules that depend only on the pair, once
+	/// Extend, Format, and ZWJ are ignored. The caller applies the rules
+	/// that need more context first.
+	inline static constexpr uint32_t WORD_PAIRS[$word_count] = {
+$word_pairs
+	};
+
+	/** The Sentence_Break property. */
+	enum class sentence_break : uint8_t {
+$sentence_body
+	};
+
+	/// The number of sentence_break values.
+	inline static constexpr size_t SENTENCE_BREAKS = $sentence_count;
+
+	/// The code point has the Extended_Pictographic property.
+	inline static constexpr uint8_t EXTENDED_PICTOGRAPHIC = 0x01;
+	/// The code point is a letter or number (General_Category L or N).
+	inline static constexpr uint8_t WORD_LIKE = 0x02;
+
+	/** The break properties of a code point, and its flags. */
+	struct record
+	{
+		grapheme_break grapheme;
+		word_break word;
+		sentence_break sentence;
+		uint8_t flags;
+	};
+
+$stages
+	/// The distinct records.
+	inline static constexpr record RECORDS[$record_count] = {
+$record_body
+	};
+
+$lookup};
+END
+}
+
+# The General_Category values, in the order of the Unicode Standard.
+my @GENERAL_CATEGORIES = qw(Lu Ll Lt Lm Lo Mn Mc Me Nd Nl No Pc Pd Ps Pe Pi Pf
+	Po Sm Sc Sk So Zs Zl Zp Cc Cf Cs Co Cn);
+
+sub generate_properties
+{
+	my ($category_list, $category_map) = prop_invmap('General_Category');
+	my ($script_list, $script_map) = prop_invmap('Script');
+	my $white_space = members_of('White_Space');
+	my $alphabetic = members_of('Alphabetic');
+	my $numeric = values_of('Numeric_Type');
+
+	# Unknown, Common, and Inherited come first, then the rest by name.
+	my %special = (Unknown => 0, Common => 1, Inherited => 2);
+	my %seen = map { $_ => 1 } @$script_map;
+	my @scripts = sort {
+		($special{$a} // 3) <=> ($special{$b} // 3) or $a cmp $b
+	} keys %seen;
+
+	my %category_name;
+	for my $short (@GENERAL_CATEGORIES) {
+		my ($alias, $long) = Unicode::UCD::prop_value_aliases('gc', $short);
+		$category_name{$short} = constant_name($long);
+	}
+
+	# Record 0 is an unassigned code point.
+	my @records = ('general_category::UNASSIGNED, script_code::UNKNOWN, 0');
+	my %record_at = ($records[0] => 0);
+	my %index_of;
+	for my $i (0 .. $#$category_list - 1) {
+		for my $cp ($category_list->[$i] .. $category_list->[$i + 1] - 1) {
+			my $category = $category_map->[$i];
+			my $script = $script_map->[
+				Unicode::UCD::search_invlist($script_list, $cp)];
+			my @flags;
+			push @flags, 'WHITE_SPACE' if $white_space->{$cp};
+			push @flags, 'ALPHABETIC' if $alphabetic->{$cp};
+			push @flags, 'NUMERIC' if $numeric->{$cp};
+
+			my $record = join(', ',
+				"general_category::$category_name{$category}",
+				'script_code::' . constant_name($script),
+				@flags ? join(' | ', @flags) : '0');
+			next if $record eq $records[0];
+			if (!exists $record_at{$record}) {
+				$record_at{$record} = scalar(@records);
+				push @records, $record;
+			}
+			$index_of{$cp} = $record_at{$record};
+		}
+	}
+
+	# Over 700 distinct records make two stages too large, so this table
+	# has three. These shifts give the smallest total size.
+	my ($group_shift, $block_shift) = (8, 3);
+	my ($stage1, $stage2, $stage3) =
+		three_stage(\%index_of, $group_shift, $block_shift);
+	my ($type1, $type2, $type3) = map { type_of(@$_) } ($stage1, $stage2, $stage3);
+	my ($count1, $count2, $count3) = map { scalar(@$_) } ($stage1, $stage2, $stage3);
+	my ($body1, $body2, $body3) =
+		map { array_body(16, @$_) } ($stage1, $stage2, $stage3);
+	my $record_count = scalar(@records);
+	my $record_body = join("\n", map { "\t\t{$_}," } @records);
+	my $category_body =
+		enum_body(map { $category_name{$_} } @GENERAL_CATEGORIES);
+	my $category_count = scalar(@GENERAL_CATEGORIES);
+	my $script_body = enum_body(map { constant_name($_) } @scripts);
+	my $script_count = scalar(@scripts);
+
+	write_header('property_tables.hpp', 'ONESTRING_UNICODE_PROPERTY_TABLES_HPP',
+		<<"END");
+/** The General_Category and Script of each code point, and whether it is
+ * White_Space, Alphabetic, or Numeric. */
+struct onestring_property_tables
+{
+	/** The General_Category property. */
+	enum class general_category : uint8_t {
+$category_body
+	};
+
+	/// The number of general_category values.
+	inline static constexpr size_t GENERAL_CATEGORIES = $category_count;
+
+	/** The Script property. */
+	enum class script_code : uint8_t {
+$script_body
+	};
+
+	/// The number of script_code values.
+	inline static constexpr size_t SCRIPTS = $script_count;
+
+	/// The code point has the White_Space property.
+	inline static constexpr uint8_t WHITE_SPACE = 0x01;
+	/// The code point has the Alphabetic property.
+	inline static constexpr uint8_t ALPHABETIC = 0x02;
+	/// The code point has a Numeric_Type other than None.
+	inline static constexpr uint8_t NUMERIC = 0x04;
+
+	/** The properties of a code point. */
+	struct record
+	{
+		general_category category;
+		script_code script;
+		uint8_t flags;
+	};
+
+	/// The number of low code point bits that index a group of STAGE2.
+	inline static constexpr unsigned GROUP_SHIFT = $group_shift;
+
+	/// The number of low code point bits that index a block of STAGE3.
+	inline static constexpr unsigned BLOCK_SHIFT = $block_shift;
+
+	/// The group of STAGE2 for each group of code points.
+	inline static constexpr $type1 STAGE1[$count1] = {
+$body1
+	};
+
+	/// The block of STAGE3 for each block of code points in a group.
+	inline static constexpr $type2 STAGE2[$count2] = {
+$body2
+	};
+
+	/// The record index for each code point in a block.
+	inline static constexpr $type3 STAGE3[$count3] = {
+$body3
+	};
+
+	/// The distinct records.
+	inline static constexpr record RECORDS[$record_count] = {
+$record_body
+	};
+
+	/** Looks up the record of a code point.
+	 * \\param the code point
+	 * \\return the record */
+	static const record& lookup(char32_t cp)
+	{
+		size_t group = cp >> GROUP_SHIFT;
+		if (group >= sizeof(STAGE1) / sizeof(STAGE1[0])) {
+			return RECORDS[0];
+		}
+		constexpr unsigned GROUP_BITS = GROUP_SHIFT - BLOCK_SHIFT;
+		size_t block = STAGE2[(STAGE1[group] << GROUP_BITS) +
+							  ((cp >> BLOCK_SHIFT) & ((1u << GROUP_BITS) - 1))];
+		size_t offset = cp & ((1u << BLOCK_SHIFT) - 1);
+		return RECORDS[STAGE3[(block << BLOCK_SHIFT) + offset]];
+	}
+};
+END
+}
+
+sub generate_widths
+{
+	my $category = values_of('General_Category');
+	my $east_asian = values_of('East_Asian_Width');
+	my $hangul = values_of('Hangul_Syllable_Type');
+	my $ignorable = members_of('Default_Ignorable_Code_Point');
+	my $presentation = members_of('Emoji_Presentation');
+	my $emoji = members_of('Emoji');
+	my $pictographic = members_of('Extended_Pictographic');
+	my $modifier = members_of('Emoji_Modifier');
+	my $prepended = members_of('Prepended_Concatenation_Mark');
+
+	my %points;
+	$points{$_} = 1 for keys %$category, keys %$east_asian, keys %$hangul,
+		keys %$ignorable, keys %$presentation, keys %$emoji;
+
+	# Record 0 is one column wide, with no flags.
+	my @records = ('1, 0');
+	my %record_at = ($records[0] => 0);
+	my %index_of;
+	for my $cp (sort { $a <=> $b } keys %points) {
+		my $gc = $category->{$cp} // 'Cn';
+		my $ea = $east_asian->{$cp} // 'N';
+		my $hst = $hangul->{$cp} // 'NA';
+
+		# Controls, marks, format characters, and the medial vowels and
+		# final consonants of Hangul syllables take no columns. The soft
+		# hyphen is shown as a hyphen when it is shown at all, and the
+		# prepended concatenation marks, such as U+0600, are drawn above the
+		# digits after them, but still take a column of their own.
+		my $width = 1;
+		if ($cp != 0xAD && !$prepended->{$cp}
+			&& ($gc =~ /^(Cc|Mn|Me|Cf)$/ || $ignorable->{$cp}
+				|| $hst =~ /^(V|T)$/)) {
+			$width = 0;
+		} elsif ($ea =~ /^(W|F)$/ || $presentation->{$cp}) {
+			$width = 2;
+		}
+
+		my @flags;
+		push @flags, 'EMOJI' if $emoji->{$cp};
+		push @flags, 'EXTENDED_PICTOGRAPHIC' if $pictographic->{$cp};
+		push @flags, 'EMOJI_MODIFIER' if $modifier->{$cp};
+
+		my $record = "$width, " . (@flags ? join(' | ', @flags) : '0');
+		next if $record eq $records[0];
+		if (!exists $record_at{$record}) {
+			$record_at{$record} = scalar(@records);
+			push @records, $record;
+		}
+		$index_of{$cp} = $record_at{$record};
+	}
+
+	my ($stage1, $stage2) = two_stage(\%index_of);
+	my $stages = stage_declarations($stage1, $stage2);
+	my $record_count = scalar(@records);
+	my $record_body = join("\n", map { "\t\t{$_}," } @records);
+	my $lookup = $LOOKUP;
+
+	write_header('width_tables.hpp', 'ONESTRING_UNICODE_WIDTH_TABLES_HPP',
+		<<"END");
+/** The number of terminal columns each code point takes, from its
+ * East_Asian_Width and General_Category, and the emoji properties that
+ * affect the width of emoji sequences. Ambiguous characters are narrow. */
+struct onestring_width_tables
+{
+	/// The code point has the Emoji property.
+	inline static constexpr uint8_t EMOJI = 0x01;
+	/// The code point has the Extended_Pictographic property.
+	inline static constexpr uint8_t EXTENDED_PICTOGRAPHIC = 0x02;
+	/// The code point is an emoji skin tone modifier.
+	inline static constexpr uint8_t EMOJI_MODIFIER = 0x04;
+
+	/** The width of a code point, and its flags. */
+	struct record
+	{
+		uint8_t width;
+		uint8_t flags;
+	};
+
+$stages
+	/// The distinct records.
+	inline static constexpr record RECORDS[$record_count] = {
+$record_body
+	};
+
+$lookup};
+END
+}
+
+# The Default Unicode Collation Element Table, which ships with Perl's
+# Unicode::Collate.
+my $ALLKEYS = File::Spec->catfile(dirname($INC{'Unicode/UCD.pm'}),
+	'Collate', 'allkeys.txt');
+
+# Packs a collation element, as in the lines of allkeys.txt, into 31 bits.
+sub pack_element
+{
+	my ($variable, $primary, $secondary, $tertiary) = @_;
+	die "secondary $secondary is too large" if $secondary >= 0x200;
+	die "tertiary $tertiary is too large" if $tertiary >= 0x20;
+	return ($variable ? 1 << 30 : 0) | ($primary << 14) | ($secondary << 5)
+		| $tertiary;
+}
+
+sub generate_collation
+{
+	open(my $fh, '<', $ALLKEYS) or die "cannot read $ALLKEYS: $!";
+	my ($ducet_version, @implicit, %elements_of);
+	while (my $line = <$fh>) {
+		if ($line =~ /^\@version\s+(\S+)/) {
+			$ducet_version = $1;
+		} elsif ($line =~ /^\@implicitweights\s+([0-9A-F]+)\.\.([0-9A-F]+);\s*([0-9A-F]+)/) {
+			push @implicit, [hex $1, hex $2, hex $3];
+		} elsif ($line =~ /^([0-9A-F ]+?)\s*;\s*((?:\[[.*][0-9A-F.]+\])+)/) {
+			my ($sequence, $keys) = ($1, $2);
+			my @elements;
+			while ($keys =~ /\[([.*])([0-9A-F]{4})\.([0-9A-F]{4})\.([0-9A-F]{4})\]/g) {
+				push @elements, pack_element($1 eq '*', hex $2, hex $3, hex $4);
+			}
+			$elements_of{$sequence} = \@elements;
+		}
+	}
+	close($fh);
+	die "no \@version in $ALLKEYS" unless defined $ducet_version;
+
+	# The collator works on NFD text, so anything that decomposes can never
+	# be looked up.
+	my @sequences = grep {
+		my $text = join('', map { chr hex } split / /);
+		NFD($text) eq $text;
+	} keys %elements_of;
+
+	my %starts_contraction;
+	my @contractions;
+	for my $sequence (@sequences) {
+		my @cps = map { hex } split / /, $sequence;
+		next unless @cps > 1;
+		die "contraction $sequence is too long" if @cps > 3;
+		$starts_contraction{$cps[0]} = 1;
+		push @contractions, [\@cps, $elements_of{$sequence}];
+	}
+	@contractions = sort {
+		$a->[0][0] <=> $b->[0][0] || ($a->[0][1] // 0) <=> ($b->[0][1] // 0)
+			|| ($a->[0][2] // 0) <=> ($b->[0][2] // 0)
+	} @contractions;
+
+	# Code points with one collation element, that start no contraction,
+	# store it directly. The rest refer to a run of EXPANSIONS.
+	my @expansions;
+	my $expansion = sub {
+		my ($elements) = @_;
+		my $offset = scalar(@expansions);
+		push @expansions, @$elements;
+		return ($offset, scalar(@$elements));
+	};
+	my %value_of;
+	for my $sequence (@sequences) {
+		next if $sequence =~ / /;
+		my $cp = hex $sequence;
+		my $elements = $elements_of{$sequence};
+		if (@$elements == 1 && !$starts_contraction{$cp}) {
+			$value_of{$cp} = 0x80000000 | $elements->[0];
+		} else {
+			my ($offset, $count) = $expansion->($elements);
+			$value_of{$cp} = ($offset << 6)
+				| ($starts_contraction{$cp} ? 0x20 : 0) | $count;
+		}
+	}
+	# A contraction whose first code point has no entry of its own still
+	# needs a value, so that the contraction is looked for; its count of
+	# zero means it has implicit weights on its own.
+	for my $cp (keys %starts_contraction) {
+		$value_of{$cp} //= 0x20;
+	}
+
+	my @contraction_rows;
+	for my $contraction (@contractions) {
+		my ($cps, $elements) = @$contraction;
+		my ($offset, $count) = $expansion->($elements);
+		my @sequence = @$cps;
+		push @sequence, 0 while @sequence < 3;
+		push @contraction_rows, "\t\t{{" . join(', ', map { hex_cp($_) } @sequence)
+			. "}, $offset, $count},";
+	}
+	die "too many expansions" if @expansions >= 1 << 24;
+
+	# Han ideographs, and the scripts with @implicitweights, are weighted by
+	# code point rather than listed.
+	my @ranges;
+	my @ideographs = prop_invlist('Unified_Ideograph');
+	while (my ($first, $end) = splice(@ideographs, 0, 2)) {
+		my $block = charblock($first);
+		my $base = ($block eq 'CJK Unified Ideographs'
+				|| $block eq 'CJK Compatibility Ideographs') ? 0xFB40 : 0xFB80;
+		push @ranges, [$first, $end - 1, $base, 0];
+	}
+	my $category = values_of('General_Category');
+	for my $range (@implicit) {
+		my ($first, $last, $base) = @$range;
+		# Ranges that share a base continue from the first of them.
+		my ($origin) = map { $_->[0] } grep { $_->[2] == $base } @implicit;
+		# Only assigned code points in the ranges have these weights.
+		my $start;
+		for my $cp ($first .. $last + 1) {
+			my $assigned = $cp <= $last && ($category->{$cp} // 'Cn') ne 'Cn';
+			if ($assigned && !defined $start) {
+				$start = $cp;
+			} elsif (!$assigned && defined $start) {
+				push @ranges, [$start, $cp - 1, $base, $origin];
+				undef $start;
+			}
+		}
+	}
+	@ranges = sort { $a->[0] <=> $b->[0] } @ranges;
+	my $range_count = scalar(@ranges);
+	my $range_body = join("\n", map {
+		"\t\t{" . join(', ', map { hex_cp($_) } @$_) . '},'
+	} @ranges);
+
+	my ($stage1, $stage2) = two_stage(\%value_of);
+	my $stages = stage_declarations($stage1, $stage2,
+		'The value of each code point in a block.');
+	my $expansion_count = scalar(@expansions);
+	my $expansion_body = array_body(8, map { sprintf('0x%08X', $_) } @expansions);
+	my $contraction_count = scalar(@contraction_rows);
+	my $contraction_body = join("\n", @contraction_rows);
+
+	write_header('collation_tables.hpp', 'ONESTRING_UNICODE_COLLATION_TABLES_HPP',
+		<<"END");
+/** The Default Unicode Collation Element Table (DUCET) $ducet_version, for the
+ * Unicode Collation Algorithm, leaving out characters that are not in NFD.
+ *
+ * A collation element is packed into 32 bits: bit 30 is set for variable
+ * elements, bits 14 to 29 are the primary weight, bits 5 to 13 are the
+ * secondary weight, and bits 0 to 4 are the tertiary weight.
+ *
+ * The STAGE2 value of a code point with a single collation element is that
+ * element, with DIRECT set. Otherwise, bits 6 and up are the offset of its
+ * collation elements in EXPANSIONS, and bits 0 to 4 are their count; the
+ * CONTRACTION bit is set if the code point begins any contractions. A value
+ * of 0 means the code point is not listed, and has implicit weights. */
+struct onestring_collation_tables
+{
+	/// The STAGE2 value is a collation element.
+	inline static constexpr uint32_t DIRECT = 0x80000000;
+	/// The code point begins a contraction.
+	inline static constexpr uint32_t CONTRACTION = 0x20;
+	/// The bits of a STAGE2 value that count its collation elements.
+	inline static constexpr uint32_t COUNT_MASK = 0x1F;
+	/// The shift of the offset in a STAGE2 value.
+	inline static constexpr unsigned OFFSET_SHIFT = 6;
+	/// The collation element is variable, such as for spaces and punctuation.
+	inline static constexpr uint32_t VARIABLE = 0x40000000;
+
+	/** A sequence of up to three code points with its own collation
+	 * elements. Unused code points in the sequence are zero. */
+	struct contraction
+	{
+		char32_t sequence[3];
+		uint32_t offset;
+		uint8_t count;
+	};
+
+	/** A range of code points with implicit weights. The first collation
+	 * element has the primary weight base + ((cp - origin) >> 15), and the
+	 * second has the primary weight ((cp - origin) & 0x7FFF) | 0x8000. */
+	struct implicit_range
+	{
+		char32_t first;
+		char32_t last;
+		uint16_t base;
+		char32_t origin;
+	};
+
+$stages
+	/// The collation elements of expansions and contractions.
+	inline static constexpr uint32_t EXPANSIONS[$expansion_count] = {
+$expansion_body
+	};
+
+	/// The contractions, sorted by sequence.
+	inline static constexpr contraction CONTRACTIONS[$contraction_count] = {
+$contraction_body
+	};
+
+	/// The ranges of implicitly weighted ideographs, sorted by code point.
+	inline static constexpr implicit_range IMPLICIT_RANGES[$range_count] = {
+$range_body
+	};
+
+	/// The implicit primary weight base of any other code point.
+	inline static constexpr uint16_t UNASSIGNED_BASE = 0xFBC0;
+
+	/** Looks up the STAGE2 value of a code point.
+	 * \\param the code point
+	 * \\return the value */
+	static uint32_t lookup(char32_t cp)
+	{
+		size_t block = cp >> BLOCK_SHIFT;
+		if (block >= sizeof(STAGE1) / sizeof(STAGE1[0])) {
+			return 0;
+		}
+		size_t offset = cp & ((1u << BLOCK_SHIFT) - 1);
+		return STAGE2[(STAGE1[block] << BLOCK_SHIFT) + offset];
+	}
+};
+END
+}
+
+generate_case();
+generate_normalization();
+generate_breaks();
+generate_properties();
+generate_widths();
+generate_collation();
+generate_normalization_tests();